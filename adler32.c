@@ -29,18 +29,11 @@ uint32_t Z_EXPORT PREFIX(adler32)(uint32_t adler, const unsigned char *buf, uint
 #endif
 
 /* ========================================================================= */
-static uint32_t adler32_combine_(uint32_t adler1, uint32_t adler2, z_off64_t len2) {
+static uint32_t adler32_combine_op_(uint32_t adler1, uint32_t adler2, unsigned rem) {
     uint32_t sum1;
     uint32_t sum2;
-    unsigned rem;
-
-    /* for negative len, return invalid adler32 as a clue for debugging */
-    if (len2 < 0)
-        return 0xffffffff;
 
     /* the derivation of this formula is left as an exercise for the reader */
-    len2 %= BASE;                 /* assumes len2 >= 0 */
-    rem = (unsigned)len2;
     sum1 = adler1 & 0xffff;
     sum2 = rem * sum1;
     sum2 %= BASE;
@@ -53,6 +46,14 @@ static uint32_t adler32_combine_(uint32_t adler1, uint32_t adler2, z_off64_t len
     return sum1 | (sum2 << 16);
 }
 
+static uint32_t adler32_combine_(uint32_t adler1, uint32_t adler2, z_off64_t len2) {
+    /* for negative len, return invalid adler32 as a clue for debugging */
+    if (len2 < 0)
+        return 0xffffffff;
+
+    return adler32_combine_op_(adler1, adler2, (unsigned)(len2 % BASE));
+}
+
 /* ========================================================================= */
 #ifdef ZLIB_COMPAT
 unsigned long Z_EXPORT PREFIX(adler32_combine)(unsigned long adler1, unsigned long adler2, z_off_t len2) {
@@ -67,3 +68,36 @@ uint32_t Z_EXPORT PREFIX4(adler32_combine)(uint32_t adler1, uint32_t adler2, z_o
     return adler32_combine_(adler1, adler2, len2);
 }
 #endif
+
+#ifndef ZLIB_COMPAT
+/* ========================================================================= */
+void Z_EXPORT PREFIX(adler32_multi)(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    FUNCTABLE_CALL(adler32_multi)(bufs, lens, out, n);
+}
+#endif
+
+#ifndef ZLIB_COMPAT
+/* ========================================================================= */
+/* The operator for a length is simply the length modulo BASE */
+uint32_t Z_EXPORT PREFIX(adler32_combine_gen)(z_off64_t len2) {
+    /* for negative len, return an invalid operator as a clue for debugging */
+    if (len2 < 0)
+        return 0xffffffff;
+
+    return (uint32_t)(len2 % BASE);
+}
+
+uint32_t Z_EXPORT PREFIX(adler32_combine_op)(uint32_t adler1, uint32_t adler2, const uint32_t op) {
+    if (op >= BASE)
+        return 0xffffffff;
+
+    return adler32_combine_op_(adler1, adler2, op);
+}
+
+uint32_t Z_EXPORT PREFIX(adler32_combine_n)(uint32_t adler, const uint32_t *adlers, size_t n, const uint32_t op) {
+    if (op >= BASE)
+        return 0xffffffff;
+
+    return FUNCTABLE_CALL(adler32_combine_n)(adler, adlers, n, op);
+}
+#endif
@@ -11,6 +11,8 @@
 #define BASE 65521U     /* largest prime smaller than 65536 */
 #define NMAX 5552
 /* NMAX is the largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1 */
+/* Number of check values adler32_combine_n() sums per block before reducing, keeps the weighted sum within 2^48 */
+#define ADLER32_COMBINE_NMAX 65536
 
 #define DO1(sum1, sum2, buf, i)  {(sum1) += buf[(i)]; (sum2) += (sum1);}
 #define DO2(sum1, sum2, buf, i)  {DO1(sum1, sum2, buf, i); DO1(sum1, sum2, buf, i+1);}
@@ -67,4 +69,26 @@ static inline uint32_t adler32_len_64(uint32_t adler, const uint8_t *buf, size_t
     return adler32_len_16(adler, buf, len, sum2);
 }
 
+/* Completes adler32_combine_n() for n check values following adler, each covering a length of op modulo BASE.
+ * sum1 and sum2 are the sums of the low and high halves of the check values and sumw is the sum of the low halves
+ * weighted by the number of check values following each, all reduced modulo BASE. */
+static inline uint32_t adler32_combine_n_final(uint32_t adler, uint64_t sum1, uint64_t sum2, uint64_t sumw,
+                                               size_t n, uint32_t op) {
+    uint64_t nmod = n % BASE, pairs, a, b;
+
+    /* Every check value carries the initial 1 of its own low half, which is subtracted once per check value and
+     * once per following check value, n(n-1)/2 times in total */
+    if (n % 2 == 0)
+        pairs = ((n / 2) % BASE) * ((n - 1) % BASE);
+    else
+        pairs = nmod * (((n - 1) / 2) % BASE);
+    sumw = (sumw + BASE - pairs % BASE) % BASE;
+
+    a = adler & 0xffff;
+    b = (adler >> 16) & 0xffff;
+    b = (b + sum2 + op * ((nmod * a + sumw) % BASE) + BASE - (nmod * op) % BASE) % BASE;
+    a = (a + sum1 + BASE - nmod) % BASE;
+    return (uint32_t)(a | (b << 16));
+}
+
 #endif /* ADLER32_P_H */
@@ -12,6 +12,7 @@ uint8_t* chunkmemset_safe_neon(uint8_t *out, uint8_t *from, unsigned len, unsign
 
 #  ifdef HAVE_BUILTIN_CTZLL
 uint32_t compare256_neon(const uint8_t *src0, const uint8_t *src1);
+uint32_t compare256_rle_neon(const uint8_t *src0, const uint8_t *src1);
 uint32_t longest_match_neon(deflate_state *const s, Pos cur_match);
 uint32_t longest_match_slow_neon(deflate_state *const s, Pos cur_match);
 #  endif
@@ -49,6 +50,8 @@ void slide_hash_armv6(deflate_state *s);
 #    ifdef HAVE_BUILTIN_CTZLL
 #      undef native_compare256
 #      define native_compare256 compare256_neon
+#      undef native_compare256_rle
+#      define native_compare256_rle compare256_rle_neon
 #      undef native_longest_match
 #      define native_longest_match longest_match_neon
 #      undef native_longest_match_slow
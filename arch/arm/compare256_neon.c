@@ -46,6 +46,38 @@ Z_INTERNAL uint32_t compare256_neon(const uint8_t *src0, const uint8_t *src1) {
     return compare256_neon_static(src0, src1);
 }
 
+/* Length of the run of src0[0] at src1, 16 bytes at a time */
+Z_INTERNAL uint32_t compare256_rle_neon(const uint8_t *src0, const uint8_t *src1) {
+    uint8x16_t a = vdupq_n_u8(*src0);
+    uint32_t len = 0;
+
+    do {
+        uint8x16_t b, cmp;
+        uint64_t lane;
+
+        b = vld1q_u8(src1);
+
+        cmp = veorq_u8(a, b);
+
+        lane = vgetq_lane_u64(vreinterpretq_u64_u8(cmp), 0);
+        if (lane) {
+            uint32_t match_byte = (uint32_t)__builtin_ctzll(lane) / 8;
+            return len + match_byte;
+        }
+        len += 8;
+        lane = vgetq_lane_u64(vreinterpretq_u64_u8(cmp), 1);
+        if (lane) {
+            uint32_t match_byte = (uint32_t)__builtin_ctzll(lane) / 8;
+            return len + match_byte;
+        }
+        len += 8;
+
+        src1 += 16;
+    } while (len < 256);
+
+    return 256;
+}
+
 #define LONGEST_MATCH       longest_match_neon
 #define COMPARE256          compare256_neon_static
 
@@ -52,3 +52,24 @@ Z_INTERNAL uint32_t adler32_c(uint32_t adler, const uint8_t *buf, size_t len) {
     /* do remaining bytes (less than NMAX, still just one modulo) */
     return adler32_len_64(adler, buf, len, sum2);
 }
+
+/* ========================================================================= */
+Z_INTERNAL uint32_t adler32_combine_n_c(uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op) {
+    uint64_t sum1 = 0, sum2 = 0, sumw = 0;
+    size_t i = 0, k;
+
+    while (i < n) {
+        k = MIN(n - i, ADLER32_COMBINE_NMAX);
+        while (k--) {
+            sumw += sum1;
+            sum1 += adlers[i] & 0xffff;
+            sum2 += (adlers[i] >> 16) & 0xffff;
+            i++;
+        }
+        sum1 %= BASE;
+        sum2 %= BASE;
+        sumw %= BASE;
+    }
+
+    return adler32_combine_n_final(adler, sum1, sum2, sumw, n, op);
+}
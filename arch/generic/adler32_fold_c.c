@@ -13,3 +13,10 @@ Z_INTERNAL uint32_t adler32_fold_copy_c(uint32_t adler, uint8_t *dst, const uint
     memcpy(dst, src, len);
     return adler;
 }
+
+Z_INTERNAL void adler32_multi_c(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = FUNCTABLE_CALL(adler32)(ADLER32_INITIAL_VALUE, bufs[i], lens[i]);
+}
@@ -7,6 +7,7 @@
 #include "zutil_p.h"
 #include "deflate.h"
 #include "fallback_builtins.h"
+#include "compare256_rle.h"
 
 /* ALIGNED, byte comparison */
 static inline uint32_t compare256_c_static(const uint8_t *src0, const uint8_t *src1) {
@@ -188,3 +189,18 @@ Z_INTERNAL uint32_t compare256_unaligned_64(const uint8_t *src0, const uint8_t *
 #endif
 
 #endif
+
+/* Run-length comparison for deflate_rle(), using the widest scalar variant */
+Z_INTERNAL uint32_t compare256_rle_generic(const uint8_t *src0, const uint8_t *src1) {
+#if OPTIMAL_CMP >= 32
+#  if defined(HAVE_BUILTIN_CTZLL) && OPTIMAL_CMP >= 64
+    return compare256_rle_unaligned_64(src0, src1);
+#  elif defined(HAVE_BUILTIN_CTZ)
+    return compare256_rle_unaligned_32(src0, src1);
+#  else
+    return compare256_rle_unaligned_16(src0, src1);
+#  endif
+#else
+    return compare256_rle_c(src0, src1);
+#endif
+}
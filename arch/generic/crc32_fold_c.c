@@ -29,3 +29,29 @@ Z_INTERNAL void crc32_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, ui
 Z_INTERNAL uint32_t crc32_fold_final_c(crc32_fold *crc) {
     return crc->value;
 }
+
+Z_INTERNAL void crc32_multi_c(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = FUNCTABLE_CALL(crc32)(CRC32_INITIAL_VALUE, bufs[i], lens[i]);
+}
+
+Z_INTERNAL uint32_t crc32c_fold_reset_c(crc32_fold *crc) {
+    crc->value = CRC32_INITIAL_VALUE;
+    return crc->value;
+}
+
+Z_INTERNAL void crc32c_fold_copy_c(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    crc->value = FUNCTABLE_CALL(crc32c)(crc->value, src, len);
+    memcpy(dst, src, len);
+}
+
+Z_INTERNAL void crc32c_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc) {
+    Z_UNUSED(init_crc);
+    crc->value = FUNCTABLE_CALL(crc32c)(crc->value, src, len);
+}
+
+Z_INTERNAL uint32_t crc32c_fold_final_c(crc32_fold *crc) {
+    return crc->value;
+}
@@ -0,0 +1,14 @@
+/* crc32c_braid_c.c -- compute the CRC-32C of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "crc32_braid_p.h"
+#include "crc32c_braid_tbl.h"
+
+#define CRC32_BRAID     crc32c_braid
+#define CRC_TABLE       crc32c_table
+#define CRC_BIG_TABLE   crc32c_big_table
+#define CRC_BRAID_TABLE CRC32C_BRAID_TABLE
+
+#include "crc32_braid_tpl.h"
@@ -0,0 +1,21 @@
+/* crc64_braid_c.c -- compute the CRC-64 of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "crc32_braid_p.h"
+
+/* A braid word must be able to hold the whole CRC, only braid with a 64-bit z_word_t */
+#if defined(W) && W != 8
+#  undef W
+#endif
+
+#include "crc64_braid_tbl.h"
+
+#define CRC_T           uint64_t
+#define CRC32_BRAID     crc64_braid
+#define CRC_TABLE       crc64_table
+#define CRC_BIG_TABLE   crc64_big_table
+#define CRC_BRAID_TABLE CRC64_BRAID_TABLE
+
+#include "crc32_braid_tpl.h"
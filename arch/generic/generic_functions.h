@@ -11,13 +11,27 @@ Z_INTERNAL uint32_t crc32_fold_reset_c(crc32_fold *crc);
 Z_INTERNAL void     crc32_fold_copy_c(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
 Z_INTERNAL void     crc32_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 Z_INTERNAL uint32_t crc32_fold_final_c(crc32_fold *crc);
+Z_INTERNAL void     crc32_multi_c(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
 
+Z_INTERNAL uint32_t crc32c_fold_reset_c(crc32_fold *crc);
+Z_INTERNAL void     crc32c_fold_copy_c(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
+Z_INTERNAL void     crc32c_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
+Z_INTERNAL uint32_t crc32c_fold_final_c(crc32_fold *crc);
+
+Z_INTERNAL uint32_t adler32_combine_n_c(uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op);
 Z_INTERNAL uint32_t adler32_fold_copy_c(uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
+Z_INTERNAL void     adler32_multi_c(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
+
+Z_INTERNAL void     histogram_c(uint32_t *hist, const uint8_t *buf, size_t len);
 
 
 typedef uint32_t (*adler32_func)(uint32_t adler, const uint8_t *buf, size_t len);
+typedef uint32_t (*adler32_combine_n_func)(uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op);
 typedef uint32_t (*compare256_func)(const uint8_t *src0, const uint8_t *src1);
 typedef uint32_t (*crc32_func)(uint32_t crc32, const uint8_t *buf, size_t len);
+typedef void     (*checksum_multi_func)(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
+typedef uint64_t (*crc64_func)(uint64_t crc64, const uint8_t *buf, size_t len);
+typedef void     (*histogram_func)(uint32_t *hist, const uint8_t *buf, size_t len);
 
 uint32_t adler32_c(uint32_t adler, const uint8_t *buf, size_t len);
 
@@ -26,8 +40,11 @@ uint8_t* chunkmemset_safe_c(uint8_t *out, uint8_t *from, unsigned len, unsigned
 void     inflate_fast_c(PREFIX3(stream) *strm, uint32_t start);
 
 uint32_t PREFIX(crc32_braid)(uint32_t crc, const uint8_t *buf, size_t len);
+uint32_t crc32c_braid(uint32_t crc, const uint8_t *buf, size_t len);
+uint64_t crc64_braid(uint64_t crc, const uint8_t *buf, size_t len);
 
 uint32_t compare256_c(const uint8_t *src0, const uint8_t *src1);
+uint32_t compare256_rle_generic(const uint8_t *src0, const uint8_t *src1);
 #if OPTIMAL_CMP >= 32
     uint32_t compare256_unaligned_16(const uint8_t *src0, const uint8_t *src1);
 #  ifdef HAVE_BUILTIN_CTZ
@@ -83,7 +100,9 @@ uint32_t longest_match_slow_c(deflate_state *const s, Pos cur_match);
 #ifdef DISABLE_RUNTIME_CPU_DETECTION
 // Generic code
 #  define native_adler32 adler32_c
+#  define native_adler32_combine_n adler32_combine_n_c
 #  define native_adler32_fold_copy adler32_fold_copy_c
+#  define native_adler32_multi adler32_multi_c
 #  define native_chunkmemset_safe chunkmemset_safe_c
 #  define native_chunksize chunksize_c
 #  define native_crc32 PREFIX(crc32_braid)
@@ -91,11 +110,20 @@ uint32_t longest_match_slow_c(deflate_state *const s, Pos cur_match);
 #  define native_crc32_fold_copy crc32_fold_copy_c
 #  define native_crc32_fold_final crc32_fold_final_c
 #  define native_crc32_fold_reset crc32_fold_reset_c
+#  define native_crc32_multi crc32_multi_c
+#  define native_crc32c crc32c_braid
+#  define native_crc32c_fold crc32c_fold_c
+#  define native_crc32c_fold_copy crc32c_fold_copy_c
+#  define native_crc32c_fold_final crc32c_fold_final_c
+#  define native_crc32c_fold_reset crc32c_fold_reset_c
+#  define native_crc64 crc64_braid
+#  define native_histogram histogram_c
 #  define native_inflate_fast inflate_fast_c
 #  define native_slide_hash slide_hash_c
 #  define native_longest_match longest_match_generic
 #  define native_longest_match_slow longest_match_slow_generic
 #  define native_compare256 compare256_generic
+#  define native_compare256_rle compare256_rle_generic
 #endif
 
 #endif
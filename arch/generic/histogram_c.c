@@ -0,0 +1,46 @@
+/* histogram_c.c -- byte frequency count C implementation
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+
+/* Below this length the sub-histograms cost more than they save */
+#define HISTOGRAM_MIN_LEN 64
+
+/* Count the bytes of buf into hist[256]. Consecutive bytes often have the same value, so every byte of a group of
+ * four goes to its own sub-histogram. That keeps successive increments of the same counter from waiting on each
+ * other's store, the sub-histograms are added to hist at the end. */
+Z_INTERNAL void histogram_c(uint32_t *hist, const uint8_t *buf, size_t len) {
+    uint32_t hist1[256], hist2[256], hist3[256];
+    uint32_t i;
+
+    if (len < HISTOGRAM_MIN_LEN) {
+        while (len--)
+            hist[*buf++]++;
+        return;
+    }
+
+    memset(hist1, 0, sizeof(hist1));
+    memset(hist2, 0, sizeof(hist2));
+    memset(hist3, 0, sizeof(hist3));
+
+    while (len >= 8) {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        hist[v & 0xff]++;
+        hist1[(v >> 8) & 0xff]++;
+        hist2[(v >> 16) & 0xff]++;
+        hist3[(v >> 24) & 0xff]++;
+        hist[(v >> 32) & 0xff]++;
+        hist1[(v >> 40) & 0xff]++;
+        hist2[(v >> 48) & 0xff]++;
+        hist3[v >> 56]++;
+        buf += 8;
+        len -= 8;
+    }
+    while (len--)
+        hist[*buf++]++;
+
+    for (i = 0; i < 256; i++)
+        hist[i] += hist1[i] + hist2[i] + hist3[i];
+}
@@ -142,4 +142,132 @@ Z_INTERNAL uint32_t adler32_fold_copy_avx2(uint32_t adler, uint8_t *dst, const u
     return adler32_fold_copy_impl(adler, dst, src, len, 1);
 }
 
+static inline __m256i load_multi_32(const uint8_t *src0, const uint8_t *src1) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)src0)),
+                                   _mm_loadu_si128((__m128i *)src1), 1);
+}
+
+/* Folds the block sums of the buffer held in 128-bit lane h of the stored vectors into its
+ * running checksum. The byte sums sit in the even 32-bit elements of the lane, the weighted
+ * sums are spread over all four. */
+static inline void adler32_multi_update(uint32_t *adler0, uint32_t *adler1, const uint32_t *s1, const uint32_t *s2,
+                                        const uint32_t *s3, int h, size_t k) {
+    uint64_t sum1 = (uint64_t)s1[h * 4] + s1[h * 4 + 2];
+    uint64_t sum2 = (uint64_t)s2[h * 4] + s2[h * 4 + 1] + s2[h * 4 + 2] + s2[h * 4 + 3];
+    uint64_t sum3 = (uint64_t)s3[h * 4] + s3[h * 4 + 2];
+
+    *adler1 = (uint32_t)((*adler1 + (uint64_t)k * *adler0 + 16 * sum3 + sum2) % BASE);
+    *adler0 = (uint32_t)((*adler0 + sum1) % BASE);
+}
+
+/* Hashes four independent buffers at once with two buffers per 256-bit vector, 16 bytes from
+ * each per iteration. The sums for a block are gathered relative to zero and folded into each
+ * running checksum afterwards, so the buffers never have to share a starting value. */
+Z_INTERNAL void adler32_multi_avx2(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    const __m256i dot2v = _mm256_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+                                           16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m256i dot3v = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t ALIGNED_(32) s1[2][8], s2[2][8], s3[2][8];
+    uint32_t adler0[4], adler1[4];
+    size_t i, j, k, done, min_len;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const uint8_t *src0 = bufs[i], *src1 = bufs[i + 1], *src2 = bufs[i + 2], *src3 = bufs[i + 3];
+
+        min_len = MIN(MIN(lens[i], lens[i + 1]), MIN(lens[i + 2], lens[i + 3]));
+        for (j = 0; j < 4; j++) {
+            adler0[j] = 1;
+            adler1[j] = 0;
+        }
+
+        for (done = 0; min_len - done >= 16; done += k) {
+            __m256i vs1_a = _mm256_setzero_si256(), vs2_a = _mm256_setzero_si256(), vs3_a = _mm256_setzero_si256();
+            __m256i vs1_b = _mm256_setzero_si256(), vs2_b = _mm256_setzero_si256(), vs3_b = _mm256_setzero_si256();
+
+            k = MIN(min_len - done, NMAX);
+            k -= k % 16;
+
+            for (j = done; j < done + k; j += 16) {
+                __m256i vbuf_a = load_multi_32(src0 + j, src1 + j);
+                __m256i vbuf_b = load_multi_32(src2 + j, src3 + j);
+
+                vs3_a = _mm256_add_epi32(vs3_a, vs1_a);
+                vs3_b = _mm256_add_epi32(vs3_b, vs1_b);
+                vs1_a = _mm256_add_epi32(vs1_a, _mm256_sad_epu8(vbuf_a, zero));
+                vs1_b = _mm256_add_epi32(vs1_b, _mm256_sad_epu8(vbuf_b, zero));
+                vs2_a = _mm256_add_epi32(vs2_a, _mm256_madd_epi16(_mm256_maddubs_epi16(vbuf_a, dot2v), dot3v));
+                vs2_b = _mm256_add_epi32(vs2_b, _mm256_madd_epi16(_mm256_maddubs_epi16(vbuf_b, dot2v), dot3v));
+            }
+
+            _mm256_store_si256((__m256i *)s1[0], vs1_a);
+            _mm256_store_si256((__m256i *)s2[0], vs2_a);
+            _mm256_store_si256((__m256i *)s3[0], vs3_a);
+            _mm256_store_si256((__m256i *)s1[1], vs1_b);
+            _mm256_store_si256((__m256i *)s2[1], vs2_b);
+            _mm256_store_si256((__m256i *)s3[1], vs3_b);
+
+            for (j = 0; j < 4; j++)
+                adler32_multi_update(&adler0[j], &adler1[j], s1[j / 2], s2[j / 2], s3[j / 2], (int)(j % 2), k);
+        }
+
+        out[i] = adler32_avx2(adler0[0] | (adler1[0] << 16), src0 + done, lens[i] - done);
+        out[i + 1] = adler32_avx2(adler0[1] | (adler1[1] << 16), src1 + done, lens[i + 1] - done);
+        out[i + 2] = adler32_avx2(adler0[2] | (adler1[2] << 16), src2 + done, lens[i + 2] - done);
+        out[i + 3] = adler32_avx2(adler0[3] | (adler1[3] << 16), src3 + done, lens[i + 3] - done);
+    }
+
+    for (; i < n; i++)
+        out[i] = adler32_avx2(1, bufs[i], lens[i]);
+}
+
+/* Combines four check values per iteration, with the sums of each vector lane kept in 64 bits. Within a block the
+ * weighted sum counts the following check values in whole vectors through vs3 and inside the vector through the
+ * lane weights, the same way the byte sums are gathered above. */
+Z_INTERNAL uint32_t adler32_combine_n_avx2(uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op) {
+    const __m256i weights = _mm256_setr_epi64x(3, 2, 1, 0);
+    const __m128i mask = _mm_set1_epi32(0xffff);
+    uint64_t ALIGNED_(32) s1[4], s2[4], s3[4], sw[4];
+    uint64_t sum1 = 0, sum2 = 0, sumw = 0;
+    size_t i = 0, j, k;
+
+    while (n - i >= 4) {
+        __m256i vs1 = _mm256_setzero_si256(), vs2 = _mm256_setzero_si256();
+        __m256i vs3 = _mm256_setzero_si256(), vsw = _mm256_setzero_si256();
+
+        k = MIN(n - i, ADLER32_COMBINE_NMAX);
+        k -= k % 4;
+
+        for (j = 0; j < k; j += 4) {
+            __m128i v = _mm_loadu_si128((__m128i *)(adlers + i + j));
+            __m256i lo = _mm256_cvtepu32_epi64(_mm_and_si128(v, mask));
+            __m256i hi = _mm256_cvtepu32_epi64(_mm_srli_epi32(v, 16));
+
+            vs3 = _mm256_add_epi64(vs3, vs1);
+            vs1 = _mm256_add_epi64(vs1, lo);
+            vs2 = _mm256_add_epi64(vs2, hi);
+            vsw = _mm256_add_epi64(vsw, _mm256_mul_epu32(lo, weights));
+        }
+
+        _mm256_store_si256((__m256i *)s1, vs1);
+        _mm256_store_si256((__m256i *)s2, vs2);
+        _mm256_store_si256((__m256i *)s3, vs3);
+        _mm256_store_si256((__m256i *)sw, vsw);
+
+        /* Every check value before this block is followed by the k in it */
+        sumw = (sumw + k * sum1 + 4 * (s3[0] + s3[1] + s3[2] + s3[3]) + sw[0] + sw[1] + sw[2] + sw[3]) % BASE;
+        sum1 = (sum1 + s1[0] + s1[1] + s1[2] + s1[3]) % BASE;
+        sum2 = (sum2 + s2[0] + s2[1] + s2[2] + s2[3]) % BASE;
+        i += k;
+    }
+
+    for (; i < n; i++) {
+        sumw += sum1;
+        sum1 += adlers[i] & 0xffff;
+        sum2 += (adlers[i] >> 16) & 0xffff;
+    }
+
+    return adler32_combine_n_final(adler, sum1 % BASE, sum2 % BASE, sumw % BASE, n, op);
+}
+
 #endif
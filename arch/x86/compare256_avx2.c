@@ -50,6 +50,37 @@ Z_INTERNAL uint32_t compare256_avx2(const uint8_t *src0, const uint8_t *src1) {
     return compare256_avx2_static(src0, src1);
 }
 
+/* Length of the run of src0[0] at src1, 32 bytes at a time */
+Z_INTERNAL uint32_t compare256_rle_avx2(const uint8_t *src0, const uint8_t *src1) {
+    __m256i ymm_src0 = _mm256_set1_epi8((char)*src0);
+    uint32_t len = 0;
+
+    do {
+        __m256i ymm_src1, ymm_cmp;
+        ymm_src1 = _mm256_loadu_si256((__m256i*)src1);
+        ymm_cmp = _mm256_cmpeq_epi8(ymm_src0, ymm_src1);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(ymm_cmp);
+        if (mask != 0xFFFFFFFF) {
+            uint32_t match_byte = (uint32_t)__builtin_ctz(~mask);
+            return len + match_byte;
+        }
+
+        src1 += 32, len += 32;
+
+        ymm_src1 = _mm256_loadu_si256((__m256i*)src1);
+        ymm_cmp = _mm256_cmpeq_epi8(ymm_src0, ymm_src1);
+        mask = (unsigned)_mm256_movemask_epi8(ymm_cmp);
+        if (mask != 0xFFFFFFFF) {
+            uint32_t match_byte = (uint32_t)__builtin_ctz(~mask);
+            return len + match_byte;
+        }
+
+        src1 += 32, len += 32;
+    } while (len < 256);
+
+    return 256;
+}
+
 #define LONGEST_MATCH       longest_match_avx2
 #define COMPARE256          compare256_avx2_static
 
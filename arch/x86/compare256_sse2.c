@@ -83,6 +83,37 @@ Z_INTERNAL uint32_t compare256_sse2(const uint8_t *src0, const uint8_t *src1) {
     return compare256_sse2_static(src0, src1);
 }
 
+/* Length of the run of src0[0] at src1, 16 bytes at a time */
+Z_INTERNAL uint32_t compare256_rle_sse2(const uint8_t *src0, const uint8_t *src1) {
+    __m128i xmm_src0 = _mm_set1_epi8((char)*src0);
+    uint32_t len = 0;
+
+    do {
+        __m128i xmm_src1, xmm_cmp;
+        xmm_src1 = _mm_loadu_si128((__m128i*)src1);
+        xmm_cmp = _mm_cmpeq_epi8(xmm_src0, xmm_src1);
+        unsigned mask = (unsigned)_mm_movemask_epi8(xmm_cmp);
+        if (mask != 0xFFFF) {
+            uint32_t match_byte = (uint32_t)__builtin_ctz(~mask);
+            return len + match_byte;
+        }
+
+        src1 += 16, len += 16;
+
+        xmm_src1 = _mm_loadu_si128((__m128i*)src1);
+        xmm_cmp = _mm_cmpeq_epi8(xmm_src0, xmm_src1);
+        mask = (unsigned)_mm_movemask_epi8(xmm_cmp);
+        if (mask != 0xFFFF) {
+            uint32_t match_byte = (uint32_t)__builtin_ctz(~mask);
+            return len + match_byte;
+        }
+
+        src1 += 16, len += 16;
+    } while (len < 256);
+
+    return 256;
+}
+
 #define LONGEST_MATCH       longest_match_sse2
 #define COMPARE256          compare256_sse2_static
 
@@ -20,7 +20,7 @@
 #ifdef COPY
 Z_INTERNAL void CRC32_FOLD_COPY(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len) {
 #else
-Z_INTERNAL void CRC32_FOLD(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc) {
+Z_INTERNAL void CRC32_FOLD(CRC_FOLD *crc, const uint8_t *src, size_t len, CRC_T init_crc) {
 #endif
     unsigned long algn_diff;
     __m128i xmm_t0, xmm_t1, xmm_t2, xmm_t3;
@@ -28,7 +28,7 @@ Z_INTERNAL void CRC32_FOLD(crc32_fold *crc, const uint8_t *src, size_t len, uint
     __m128i xmm_crc_part = _mm_setzero_si128();
     char ALIGNED_(16) partial_buf[16] = { 0 };
 #ifndef COPY
-    __m128i xmm_initial = _mm_cvtsi32_si128(init_crc);
+    __m128i xmm_initial = CRC_TO_XMM(init_crc);
     int32_t first = init_crc != 0;
 
     /* The CRC functions don't call this for input < 16, as a minimum of 16 bytes of input is needed
@@ -60,7 +60,7 @@ Z_INTERNAL void CRC32_FOLD(crc32_fold *crc, const uint8_t *src, size_t len, uint
 #else
         XOR_INITIAL128(xmm_crc_part);
 
-        if (algn_diff < 4 && init_crc != 0) {
+        if (algn_diff < sizeof(init_crc) && init_crc != 0) {
             xmm_t0 = xmm_crc_part;
             if (len >= 32) {
                 xmm_crc_part = _mm_loadu_si128((__m128i*)src + 1);
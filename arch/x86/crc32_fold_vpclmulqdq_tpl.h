@@ -16,10 +16,8 @@ static size_t fold_16_vpclmulqdq(__m128i *xmm_crc0, __m128i *xmm_crc1,
     __m512i zmm_crc0, zmm_crc1, zmm_crc2, zmm_crc3;
     __m512i z0, z1, z2, z3;
     size_t len_tmp = len;
-    const __m512i zmm_fold4 = _mm512_set4_epi32(
-        0x00000001, 0x54442bd4, 0x00000001, 0xc6e41596);
-    const __m512i zmm_fold16 = _mm512_set4_epi32(
-        0x00000001, 0x1542778a, 0x00000001, 0x322d1430);
+    const __m512i zmm_fold4 = _mm512_set4_epi32(FOLD4_K);
+    const __m512i zmm_fold16 = _mm512_set4_epi32(FOLD16_K);
 
     // zmm register init
     zmm_crc0 = _mm512_setzero_si512();
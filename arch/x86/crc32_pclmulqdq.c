@@ -24,6 +24,7 @@
 #define CRC32_FOLD_RESET crc32_fold_pclmulqdq_reset
 #define CRC32_FOLD_FINAL crc32_fold_pclmulqdq_final
 #define CRC32            crc32_pclmulqdq
+#define CRC32_MULTI      crc32_multi_pclmulqdq
 
 #include "crc32_pclmulqdq_tpl.h"
 
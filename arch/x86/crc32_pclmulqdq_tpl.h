@@ -28,21 +28,57 @@
 
 #include "crc32.h"
 #include "crc32_braid_p.h"
-#include "crc32_braid_tbl.h"
+#if defined(CRC64)
+#  include "crc64_braid_tbl.h"
+#elif defined(CRC32C)
+#  include "crc32c_braid_tbl.h"
+#else
+#  include "crc32_braid_tbl.h"
+#endif
 #include "x86_intrins.h"
 #include <assert.h>
 
+/* Folding constants are x^(k+32) and x^(k-32) mod p(x), bit-reflected, for folding across k = 512 (FOLD4_K)
+ * and k = 2048 (FOLD16_K) bits. CRC32C selects the Castagnoli polynomial instead of the gzip one. CRC64
+ * selects the 64-bit ECMA-182 polynomial, for which the constants are x^(k+63) and x^(k-1) mod p(x), so
+ * that they fit in 64 bits, and the fold state and check values are 64 bits wide. */
+#if defined(CRC64)
+#  define FOLD4_K      0x6ae3efbb, 0x9dd441f3, 0x081f6054, 0xa7842df4
+#  define FOLD16_K     0x8260adf2, 0x381ad81c, 0xf31fd927, 0x1e228b79
+#  define FOLD_RESET_K 0x825e19da, 0xaf12e0d1 /* fold state equivalent to an initial crc of ~0 */
+#  define SMALL_TABLE  crc64_table
+#  define CRC_FOLD     crc64_fold
+#  define CRC_T        uint64_t
+#  define CRC_TO_XMM(crc) _mm_set_epi64x(0, (int64_t)(crc))
+#elif defined(CRC32C)
+#  define FOLD4_K      0x00000000, 0x740eef02, 0x00000000, 0x9e4addf8
+#  define FOLD16_K     0x00000000, 0xdcb17aa4, 0x00000000, 0xb9e02b86
+#  define FOLD_RESET_K 0x00000000, 0x6b115ea6
+#  define SMALL_TABLE  crc32c_table
+#else
+#  define FOLD4_K      0x00000001, 0x54442bd4, 0x00000001, 0xc6e41596
+#  define FOLD16_K     0x00000001, 0x1542778a, 0x00000001, 0x322d1430
+#  define FOLD_RESET_K 0x00000000, 0x9db42487
+#  define SMALL_TABLE  crc_table
+#endif
+#ifndef CRC64
+#  define CRC_FOLD     crc32_fold
+#  define CRC_T        uint32_t
+#  define CRC_TO_XMM(crc) _mm_cvtsi32_si128(crc)
+#endif
+
 #ifdef X86_VPCLMULQDQ
 static size_t fold_16_vpclmulqdq(__m128i *xmm_crc0, __m128i *xmm_crc1,
     __m128i *xmm_crc2, __m128i *xmm_crc3, const uint8_t *src, size_t len, __m128i init_crc,
     int32_t first);
+#  ifndef CRC64
 static size_t fold_16_vpclmulqdq_copy(__m128i *xmm_crc0, __m128i *xmm_crc1,
     __m128i *xmm_crc2, __m128i *xmm_crc3, uint8_t *dst, const uint8_t *src, size_t len);
+#  endif
 #endif
 
 static void fold_1(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m128i *xmm_crc3) {
-    const __m128i xmm_fold4 = _mm_set_epi32( 0x00000001, 0x54442bd4,
-                                             0x00000001, 0xc6e41596);
+    const __m128i xmm_fold4 = _mm_set_epi32(FOLD4_K);
     __m128i x_tmp3;
     __m128 ps_crc0, ps_crc3, ps_res;
 
@@ -62,8 +98,7 @@ static void fold_1(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m1
 }
 
 static void fold_2(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m128i *xmm_crc3) {
-    const __m128i xmm_fold4 = _mm_set_epi32( 0x00000001, 0x54442bd4,
-                                             0x00000001, 0xc6e41596);
+    const __m128i xmm_fold4 = _mm_set_epi32(FOLD4_K);
     __m128i x_tmp3, x_tmp2;
     __m128 ps_crc0, ps_crc1, ps_crc2, ps_crc3, ps_res31, ps_res20;
 
@@ -91,8 +126,7 @@ static void fold_2(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m1
 }
 
 static void fold_3(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m128i *xmm_crc3) {
-    const __m128i xmm_fold4 = _mm_set_epi32( 0x00000001, 0x54442bd4,
-                                             0x00000001, 0xc6e41596);
+    const __m128i xmm_fold4 = _mm_set_epi32(FOLD4_K);
     __m128i x_tmp3;
     __m128 ps_crc0, ps_crc1, ps_crc2, ps_crc3, ps_res32, ps_res21, ps_res10;
 
@@ -126,8 +160,7 @@ static void fold_3(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m1
 }
 
 static void fold_4(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m128i *xmm_crc3) {
-    const __m128i xmm_fold4 = _mm_set_epi32( 0x00000001, 0x54442bd4,
-                                             0x00000001, 0xc6e41596);
+    const __m128i xmm_fold4 = _mm_set_epi32(FOLD4_K);
     __m128i x_tmp0, x_tmp1, x_tmp2, x_tmp3;
     __m128 ps_crc0, ps_crc1, ps_crc2, ps_crc3;
     __m128 ps_t0, ps_t1, ps_t2, ps_t3;
@@ -188,8 +221,7 @@ static const unsigned ALIGNED_(32) pshufb_shf_table[60] = {
 
 static void partial_fold(const size_t len, __m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2,
                          __m128i *xmm_crc3, __m128i *xmm_crc_part) {
-    const __m128i xmm_fold4 = _mm_set_epi32( 0x00000001, 0x54442bd4,
-                                             0x00000001, 0xc6e41596);
+    const __m128i xmm_fold4 = _mm_set_epi32(FOLD4_K);
     const __m128i xmm_mask3 = _mm_set1_epi32((int32_t)0x80808080);
 
     __m128i xmm_shl, xmm_shr, xmm_tmp1, xmm_tmp2, xmm_tmp3;
@@ -246,8 +278,8 @@ static inline void crc32_fold_save(__m128i *fold, const __m128i *fold0, const __
     _mm_storeu_si128(fold + 3, *fold3);
 }
 
-Z_INTERNAL uint32_t CRC32_FOLD_RESET(crc32_fold *crc) {
-    __m128i xmm_crc0 = _mm_cvtsi32_si128(0x9db42487);
+Z_INTERNAL CRC_T CRC32_FOLD_RESET(CRC_FOLD *crc) {
+    __m128i xmm_crc0 = _mm_set_epi32(0, 0, FOLD_RESET_K);
     __m128i xmm_zero = _mm_setzero_si128();
     crc32_fold_save((__m128i *)crc->fold, &xmm_crc0, &xmm_zero, &xmm_zero, &xmm_zero);
     return 0;
@@ -263,21 +295,41 @@ Z_INTERNAL uint32_t CRC32_FOLD_RESET(crc32_fold *crc) {
 #  include "crc32_fold_vpclmulqdq_tpl.h"
 #endif
 #include "crc32_fold_pclmulqdq_tpl.h"
-#define COPY
-#ifdef X86_VPCLMULQDQ
-#  include "crc32_fold_vpclmulqdq_tpl.h"
+/* Only the CRC-32 variants are used for copying while hashing */
+#ifndef CRC64
+#  define COPY
+#  ifdef X86_VPCLMULQDQ
+#    include "crc32_fold_vpclmulqdq_tpl.h"
+#  endif
+#  include "crc32_fold_pclmulqdq_tpl.h"
 #endif
-#include "crc32_fold_pclmulqdq_tpl.h"
 
 static const unsigned ALIGNED_(16) crc_k[] = {
+#if defined(CRC64)
+    0xc7875f40, 0xdabe95af, /* rk1 */
+    0xca393ae4, 0xe05dd497, /* rk2 */
+    0xc7875f40, 0xdabe95af, /* rk5 */
+    0x00000000, 0x00000000, /* rk6 */
+    0x172963d5, 0x9c3e466c, /* rk7 */
+    0xaf0e1e85, 0x92d8af2b  /* rk8 */
+#elif defined(CRC32C)
+    0x4cd00bd6, 0x00000001, /* rk1 */
+    0xf20c0dfe, 0x00000000, /* rk2 */
+    0x4cd00bd6, 0x00000001, /* rk5 */
+    0xdd45aab8, 0x00000000, /* rk6 */
+    0xdea713f0, 0x00000000, /* rk7 */
+    0x05ec76f0, 0x00000001  /* rk8 */
+#else
     0xccaa009e, 0x00000000, /* rk1 */
     0x751997d0, 0x00000001, /* rk2 */
     0xccaa009e, 0x00000000, /* rk5 */
     0x63cd6124, 0x00000001, /* rk6 */
     0xf7011640, 0x00000001, /* rk7 */
     0xdb710640, 0x00000001  /* rk8 */
+#endif
 };
 
+#ifndef CRC64
 static const unsigned ALIGNED_(16) crc_mask[4] = {
     0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000
 };
@@ -285,7 +337,62 @@ static const unsigned ALIGNED_(16) crc_mask[4] = {
 static const unsigned ALIGNED_(16) crc_mask2[4] = {
     0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
 };
+#endif
 
+#ifdef CRC64
+Z_INTERNAL uint64_t CRC32_FOLD_FINAL(crc64_fold *crc) {
+    __m128i xmm_crc0, xmm_crc1, xmm_crc2, xmm_crc3;
+    __m128i x_tmp0, x_tmp1, x_tmp2, crc_fold;
+
+    crc32_fold_load((__m128i *)crc->fold, &xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3);
+
+    /*
+     * k1
+     */
+    crc_fold = _mm_load_si128((__m128i *)crc_k);
+
+    x_tmp0 = _mm_clmulepi64_si128(xmm_crc0, crc_fold, 0x10);
+    xmm_crc0 = _mm_clmulepi64_si128(xmm_crc0, crc_fold, 0x01);
+    xmm_crc1 = _mm_xor_si128(xmm_crc1, x_tmp0);
+    xmm_crc1 = _mm_xor_si128(xmm_crc1, xmm_crc0);
+
+    x_tmp1 = _mm_clmulepi64_si128(xmm_crc1, crc_fold, 0x10);
+    xmm_crc1 = _mm_clmulepi64_si128(xmm_crc1, crc_fold, 0x01);
+    xmm_crc2 = _mm_xor_si128(xmm_crc2, x_tmp1);
+    xmm_crc2 = _mm_xor_si128(xmm_crc2, xmm_crc1);
+
+    x_tmp2 = _mm_clmulepi64_si128(xmm_crc2, crc_fold, 0x10);
+    xmm_crc2 = _mm_clmulepi64_si128(xmm_crc2, crc_fold, 0x01);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, x_tmp2);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc2);
+
+    /*
+     * k5, fold 128 bits to 64 bits
+     */
+    crc_fold = _mm_load_si128((__m128i *)(crc_k + 4));
+
+    xmm_crc0 = _mm_srli_si128(xmm_crc3, 8);
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc0);
+
+    /*
+     * k7, Barrett reduction of the remaining 64 bits
+     */
+    crc_fold = _mm_load_si128((__m128i *)(crc_k + 8));
+
+    xmm_crc2 = xmm_crc3;
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0);
+    xmm_crc1 = _mm_slli_si128(xmm_crc3, 8);
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0x10);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc1);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc2);
+
+    crc->value = ~(((uint64_t)(uint32_t)_mm_extract_epi32(xmm_crc3, 3) << 32) |
+                    (uint32_t)_mm_extract_epi32(xmm_crc3, 2));
+
+    return crc->value;
+}
+#else
 Z_INTERNAL uint32_t CRC32_FOLD_FINAL(crc32_fold *crc) {
     const __m128i xmm_mask  = _mm_load_si128((__m128i *)crc_mask);
     const __m128i xmm_mask2 = _mm_load_si128((__m128i *)crc_mask2);
@@ -350,26 +457,89 @@ Z_INTERNAL uint32_t CRC32_FOLD_FINAL(crc32_fold *crc) {
 
     return crc->value;
 }
+#endif
 
-static inline uint32_t crc32_small(uint32_t crc, const uint8_t *buf, size_t len) {
-    uint32_t c = (~crc) & 0xffffffff;
+static inline CRC_T crc32_small(CRC_T crc, const uint8_t *buf, size_t len) {
+    CRC_T c = (CRC_T)~crc;
 
     while (len) {
         len--;
-        DO1;
+        c = SMALL_TABLE[(c ^ *buf++) & 0xff] ^ (c >> 8);
     }
 
-    return c ^ 0xffffffff;
+    return (CRC_T)~c;
 }
 
-Z_INTERNAL uint32_t CRC32(uint32_t crc32, const uint8_t *buf, size_t len) {
+Z_INTERNAL CRC_T CRC32(CRC_T crc32, const uint8_t *buf, size_t len) {
     /* For lens smaller than ~12, crc32_small method is faster.
      * But there are also minimum requirements for the pclmul functions due to alignment */
     if (len < 16)
         return crc32_small(crc32, buf, len);
 
-    crc32_fold ALIGNED_(16) crc_state;
+    CRC_FOLD ALIGNED_(16) crc_state;
     CRC32_FOLD_RESET(&crc_state);
     CRC32_FOLD(&crc_state, buf, len, crc32);
     return CRC32_FOLD_FINAL(&crc_state);
 }
+
+#ifdef CRC32_MULTI
+static inline __m128i fold_multi_16(__m128i xmm_crc, const __m128i xmm_fold1, const uint8_t *src) {
+    __m128i x_tmp0 = _mm_clmulepi64_si128(xmm_crc, xmm_fold1, 0x10);
+    __m128i x_tmp1 = _mm_clmulepi64_si128(xmm_crc, xmm_fold1, 0x01);
+    return _mm_xor_si128(_mm_xor_si128(x_tmp0, x_tmp1), _mm_loadu_si128((__m128i *)src));
+}
+
+static inline uint32_t fold_multi_final(__m128i xmm_crc, const uint8_t *src, size_t len) {
+    crc32_fold ALIGNED_(16) crc_state;
+    __m128i xmm_zero = _mm_setzero_si128();
+
+    /* Reduce the remainder as the last block of an otherwise empty fold state and let the
+     * single buffer path hash whatever is left of the longer buffers */
+    crc32_fold_save((__m128i *)crc_state.fold, &xmm_zero, &xmm_zero, &xmm_zero, &xmm_crc);
+    return CRC32(CRC32_FOLD_FINAL(&crc_state), src, len);
+}
+
+/* Hashes four independent buffers at once, keeping one 128-bit remainder per buffer so that
+ * the carry-less multiplications of the different streams can overlap. Each step folds the
+ * remainder forward by 16 bytes with the same constants used for the final reduction. */
+Z_INTERNAL void CRC32_MULTI(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    const __m128i xmm_fold1 = _mm_load_si128((__m128i *)crc_k);
+    const __m128i xmm_initial = _mm_cvtsi32_si128(0xffffffff);
+    __m128i xmm_crc0, xmm_crc1, xmm_crc2, xmm_crc3;
+    const uint8_t *src0, *src1, *src2, *src3;
+    size_t i, k, min_len;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        min_len = MIN(MIN(lens[i], lens[i + 1]), MIN(lens[i + 2], lens[i + 3]));
+        if (min_len < 16) {
+            for (k = 0; k < 4; k++)
+                out[i + k] = CRC32(0, bufs[i + k], lens[i + k]);
+            continue;
+        }
+
+        src0 = bufs[i];
+        src1 = bufs[i + 1];
+        src2 = bufs[i + 2];
+        src3 = bufs[i + 3];
+        xmm_crc0 = _mm_xor_si128(_mm_loadu_si128((__m128i *)src0), xmm_initial);
+        xmm_crc1 = _mm_xor_si128(_mm_loadu_si128((__m128i *)src1), xmm_initial);
+        xmm_crc2 = _mm_xor_si128(_mm_loadu_si128((__m128i *)src2), xmm_initial);
+        xmm_crc3 = _mm_xor_si128(_mm_loadu_si128((__m128i *)src3), xmm_initial);
+
+        for (k = 16; k + 16 <= min_len; k += 16) {
+            xmm_crc0 = fold_multi_16(xmm_crc0, xmm_fold1, src0 + k);
+            xmm_crc1 = fold_multi_16(xmm_crc1, xmm_fold1, src1 + k);
+            xmm_crc2 = fold_multi_16(xmm_crc2, xmm_fold1, src2 + k);
+            xmm_crc3 = fold_multi_16(xmm_crc3, xmm_fold1, src3 + k);
+        }
+
+        out[i] = fold_multi_final(xmm_crc0, src0 + k, lens[i] - k);
+        out[i + 1] = fold_multi_final(xmm_crc1, src1 + k, lens[i + 1] - k);
+        out[i + 2] = fold_multi_final(xmm_crc2, src2 + k, lens[i + 2] - k);
+        out[i + 3] = fold_multi_final(xmm_crc3, src3 + k, lens[i + 3] - k);
+    }
+
+    for (; i < n; i++)
+        out[i] = CRC32(0, bufs[i], lens[i]);
+}
+#endif
@@ -0,0 +1,16 @@
+/* crc32c_pclmulqdq.c -- PCLMULQDQ-based CRC-32C folding implementation.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_PCLMULQDQ_CRC
+
+#define CRC32C
+#define CRC32_FOLD_COPY  crc32c_fold_pclmulqdq_copy
+#define CRC32_FOLD       crc32c_fold_pclmulqdq
+#define CRC32_FOLD_RESET crc32c_fold_pclmulqdq_reset
+#define CRC32_FOLD_FINAL crc32c_fold_pclmulqdq_final
+#define CRC32            crc32c_pclmulqdq
+
+#include "crc32_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,53 @@
+/* crc32c_sse42.c -- compute the CRC-32C of a data stream with the SSE4.2 crc32 instruction
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_SSE42
+
+#include "zbuild.h"
+#include <nmmintrin.h>
+
+Z_INTERNAL uint32_t crc32c_sse42(uint32_t crc, const uint8_t *buf, size_t len) {
+    uint32_t c = ~crc;
+
+    /* Align the input, so that the wide loads below don't cross cache lines */
+    while (len && ((uintptr_t)buf & 7) != 0) {
+        c = _mm_crc32_u8(c, *buf++);
+        len--;
+    }
+
+#if defined(__x86_64__) || defined(_M_X64)
+    {
+        uint64_t c64 = c;
+        while (len >= 32) {
+            c64 = _mm_crc32_u64(c64, *(const uint64_t *)buf);
+            c64 = _mm_crc32_u64(c64, *(const uint64_t *)(buf + 8));
+            c64 = _mm_crc32_u64(c64, *(const uint64_t *)(buf + 16));
+            c64 = _mm_crc32_u64(c64, *(const uint64_t *)(buf + 24));
+            buf += 32;
+            len -= 32;
+        }
+        while (len >= 8) {
+            c64 = _mm_crc32_u64(c64, *(const uint64_t *)buf);
+            buf += 8;
+            len -= 8;
+        }
+        c = (uint32_t)c64;
+    }
+#else
+    while (len >= 4) {
+        c = _mm_crc32_u32(c, *(const uint32_t *)buf);
+        buf += 4;
+        len -= 4;
+    }
+#endif
+
+    while (len) {
+        c = _mm_crc32_u8(c, *buf++);
+        len--;
+    }
+
+    return ~c;
+}
+
+#endif
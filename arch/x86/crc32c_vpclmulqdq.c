@@ -0,0 +1,17 @@
+/* crc32c_vpclmulqdq.c -- VPCMULQDQ-based CRC-32C folding implementation.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_VPCLMULQDQ_CRC
+
+#define X86_VPCLMULQDQ
+#define CRC32C
+#define CRC32_FOLD_COPY  crc32c_fold_vpclmulqdq_copy
+#define CRC32_FOLD       crc32c_fold_vpclmulqdq
+#define CRC32_FOLD_RESET crc32c_fold_vpclmulqdq_reset
+#define CRC32_FOLD_FINAL crc32c_fold_vpclmulqdq_final
+#define CRC32            crc32c_vpclmulqdq
+
+#include "crc32_pclmulqdq_tpl.h"
+
+#endif
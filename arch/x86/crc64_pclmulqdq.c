@@ -0,0 +1,15 @@
+/* crc64_pclmulqdq.c -- PCLMULQDQ-based CRC-64 folding implementation.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_PCLMULQDQ_CRC
+
+#define CRC64
+#define CRC32_FOLD       crc64_fold_pclmulqdq
+#define CRC32_FOLD_RESET crc64_fold_pclmulqdq_reset
+#define CRC32_FOLD_FINAL crc64_fold_pclmulqdq_final
+#define CRC32            crc64_pclmulqdq
+
+#include "crc32_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,16 @@
+/* crc64_vpclmulqdq.c -- VPCMULQDQ-based CRC-64 folding implementation.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_VPCLMULQDQ_CRC
+
+#define X86_VPCLMULQDQ
+#define CRC64
+#define CRC32_FOLD       crc64_fold_vpclmulqdq
+#define CRC32_FOLD_RESET crc64_fold_vpclmulqdq_reset
+#define CRC32_FOLD_FINAL crc64_fold_vpclmulqdq_final
+#define CRC32            crc64_vpclmulqdq
+
+#include "crc32_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,66 @@
+/* histogram_avx2.c -- AVX2 byte frequency count
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+
+#ifdef X86_AVX2
+
+#include <immintrin.h>
+
+/* Below this length the sub-histograms cost more than they save */
+#define HISTOGRAM_MIN_LEN 64
+
+/* Same four sub-histograms as histogram_c(), but every 32 bytes are first compared with their first byte, so runs
+ * of a single value are counted with one add. The sub-histograms are summed with vector adds. */
+Z_INTERNAL void histogram_avx2(uint32_t *hist, const uint8_t *buf, size_t len) {
+    ALIGNED_(32) uint32_t hist1[256], hist2[256], hist3[256];
+    uint32_t i;
+
+    if (len < HISTOGRAM_MIN_LEN) {
+        while (len--)
+            hist[*buf++]++;
+        return;
+    }
+
+    memset(hist1, 0, sizeof(hist1));
+    memset(hist2, 0, sizeof(hist2));
+    memset(hist3, 0, sizeof(hist3));
+
+    while (len >= 32) {
+        __m256i ymm_src = _mm256_loadu_si256((__m256i *)buf);
+        __m256i ymm_run = _mm256_set1_epi8((char)buf[0]);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm_src, ymm_run));
+
+        if (mask == 0xFFFFFFFF) {
+            hist[buf[0]] += 32;
+        } else {
+            for (i = 0; i < 32; i += 8) {
+                uint64_t v;
+                memcpy(&v, buf + i, sizeof(v));
+                hist[v & 0xff]++;
+                hist1[(v >> 8) & 0xff]++;
+                hist2[(v >> 16) & 0xff]++;
+                hist3[(v >> 24) & 0xff]++;
+                hist[(v >> 32) & 0xff]++;
+                hist1[(v >> 40) & 0xff]++;
+                hist2[(v >> 48) & 0xff]++;
+                hist3[v >> 56]++;
+            }
+        }
+        buf += 32;
+        len -= 32;
+    }
+    while (len--)
+        hist[*buf++]++;
+
+    for (i = 0; i < 256; i += 8) {
+        __m256i ymm_hist = _mm256_loadu_si256((__m256i *)(hist + i));
+        ymm_hist = _mm256_add_epi32(ymm_hist, _mm256_load_si256((__m256i *)(hist1 + i)));
+        ymm_hist = _mm256_add_epi32(ymm_hist, _mm256_load_si256((__m256i *)(hist2 + i)));
+        ymm_hist = _mm256_add_epi32(ymm_hist, _mm256_load_si256((__m256i *)(hist3 + i)));
+        _mm256_storeu_si256((__m256i *)(hist + i), ymm_hist);
+    }
+}
+
+#endif
@@ -12,6 +12,7 @@ uint8_t* chunkmemset_safe_sse2(uint8_t *out, uint8_t *from, unsigned len, unsign
 
 #  ifdef HAVE_BUILTIN_CTZ
     uint32_t compare256_sse2(const uint8_t *src0, const uint8_t *src1);
+    uint32_t compare256_rle_sse2(const uint8_t *src0, const uint8_t *src1);
     uint32_t longest_match_sse2(deflate_state *const s, Pos cur_match);
     uint32_t longest_match_slow_sse2(deflate_state *const s, Pos cur_match);
     void slide_hash_sse2(deflate_state *s);
@@ -27,16 +28,21 @@ void inflate_fast_ssse3(PREFIX3(stream) *strm, uint32_t start);
 
 #ifdef X86_SSE42
 uint32_t adler32_fold_copy_sse42(uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
+uint32_t crc32c_sse42(uint32_t crc, const uint8_t *buf, size_t len);
 #endif
 
 #ifdef X86_AVX2
 uint32_t adler32_avx2(uint32_t adler, const uint8_t *buf, size_t len);
+uint32_t adler32_combine_n_avx2(uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op);
 uint32_t adler32_fold_copy_avx2(uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
+void     adler32_multi_avx2(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
 uint32_t chunksize_avx2(void);
 uint8_t* chunkmemset_safe_avx2(uint8_t *out, uint8_t *from, unsigned len, unsigned left);
+void     histogram_avx2(uint32_t *hist, const uint8_t *buf, size_t len);
 
 #  ifdef HAVE_BUILTIN_CTZ
     uint32_t compare256_avx2(const uint8_t *src0, const uint8_t *src1);
+    uint32_t compare256_rle_avx2(const uint8_t *src0, const uint8_t *src1);
     uint32_t longest_match_avx2(deflate_state *const s, Pos cur_match);
     uint32_t longest_match_slow_avx2(deflate_state *const s, Pos cur_match);
     void slide_hash_avx2(deflate_state *s);
@@ -61,6 +67,16 @@ void     crc32_fold_pclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t
 void     crc32_fold_pclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 uint32_t crc32_fold_pclmulqdq_final(crc32_fold *crc);
 uint32_t crc32_pclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+void     crc32_multi_pclmulqdq(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
+uint32_t crc32c_fold_pclmulqdq_reset(crc32_fold *crc);
+void     crc32c_fold_pclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
+void     crc32c_fold_pclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
+uint32_t crc32c_fold_pclmulqdq_final(crc32_fold *crc);
+uint32_t crc32c_pclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+uint64_t crc64_fold_pclmulqdq_reset(crc64_fold *crc);
+void     crc64_fold_pclmulqdq(crc64_fold *crc, const uint8_t *src, size_t len, uint64_t init_crc);
+uint64_t crc64_fold_pclmulqdq_final(crc64_fold *crc);
+uint64_t crc64_pclmulqdq(uint64_t crc64, const uint8_t *buf, size_t len);
 #endif
 #ifdef X86_VPCLMULQDQ_CRC
 uint32_t crc32_fold_vpclmulqdq_reset(crc32_fold *crc);
@@ -68,6 +84,15 @@ void     crc32_fold_vpclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t
 void     crc32_fold_vpclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 uint32_t crc32_fold_vpclmulqdq_final(crc32_fold *crc);
 uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+uint32_t crc32c_fold_vpclmulqdq_reset(crc32_fold *crc);
+void     crc32c_fold_vpclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
+void     crc32c_fold_vpclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
+uint32_t crc32c_fold_vpclmulqdq_final(crc32_fold *crc);
+uint32_t crc32c_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+uint64_t crc64_fold_vpclmulqdq_reset(crc64_fold *crc);
+void     crc64_fold_vpclmulqdq(crc64_fold *crc, const uint8_t *src, size_t len, uint64_t init_crc);
+uint64_t crc64_fold_vpclmulqdq_final(crc64_fold *crc);
+uint64_t crc64_vpclmulqdq(uint64_t crc64, const uint8_t *buf, size_t len);
 #endif
 
 
@@ -85,6 +110,8 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #    ifdef HAVE_BUILTIN_CTZ
 #      undef native_compare256
 #      define native_compare256 compare256_sse2
+#      undef native_compare256_rle
+#      define native_compare256_rle compare256_rle_sse2
 #      undef native_longest_match
 #      define native_longest_match longest_match_sse2
 #      undef native_longest_match_slow
@@ -104,6 +131,8 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #  if defined(X86_SSE42) && defined(__SSE4_2__)
 #    undef native_adler32_fold_copy
 #    define native_adler32_fold_copy adler32_fold_copy_sse42
+#    undef native_crc32c
+#    define native_crc32c crc32c_sse42
 #  endif
 
 // X86 - PCLMUL
@@ -118,17 +147,37 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #  define native_crc32_fold_final crc32_fold_pclmulqdq_final
 #  undef native_crc32_fold_reset
 #  define native_crc32_fold_reset crc32_fold_pclmulqdq_reset
+#  undef native_crc32_multi
+#  define native_crc32_multi crc32_multi_pclmulqdq
+#  undef native_crc32c
+#  define native_crc32c crc32c_pclmulqdq
+#  undef native_crc32c_fold
+#  define native_crc32c_fold crc32c_fold_pclmulqdq
+#  undef native_crc32c_fold_copy
+#  define native_crc32c_fold_copy crc32c_fold_pclmulqdq_copy
+#  undef native_crc32c_fold_final
+#  define native_crc32c_fold_final crc32c_fold_pclmulqdq_final
+#  undef native_crc32c_fold_reset
+#  define native_crc32c_fold_reset crc32c_fold_pclmulqdq_reset
+#  undef native_crc64
+#  define native_crc64 crc64_pclmulqdq
 #endif
 // X86 - AVX
 #  if defined(X86_AVX2) && defined(__AVX2__)
 #    undef native_adler32
 #    define native_adler32 adler32_avx2
+#    undef native_adler32_combine_n
+#    define native_adler32_combine_n adler32_combine_n_avx2
 #    undef native_adler32_fold_copy
 #    define native_adler32_fold_copy adler32_fold_copy_avx2
+#    undef native_adler32_multi
+#    define native_adler32_multi adler32_multi_avx2
 #    undef native_chunkmemset_safe
 #    define native_chunkmemset_safe chunkmemset_safe_avx2
 #    undef native_chunksize
 #    define native_chunksize chunksize_avx2
+#    undef native_histogram
+#    define native_histogram histogram_avx2
 #    undef native_inflate_fast
 #    define native_inflate_fast inflate_fast_avx2
 #    undef native_slide_hash
@@ -136,6 +185,8 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #    ifdef HAVE_BUILTIN_CTZ
 #      undef native_compare256
 #      define native_compare256 compare256_avx2
+#      undef native_compare256_rle
+#      define native_compare256_rle compare256_rle_avx2
 #      undef native_longest_match
 #      define native_longest_match longest_match_avx2
 #      undef native_longest_match_slow
@@ -174,6 +225,18 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #      define native_crc32_fold_final crc32_fold_vpclmulqdq_final
 #      undef native_crc32_fold_reset
 #      define native_crc32_fold_reset crc32_fold_vpclmulqdq_reset
+#      undef native_crc32c
+#      define native_crc32c crc32c_vpclmulqdq
+#      undef native_crc32c_fold
+#      define native_crc32c_fold crc32c_fold_vpclmulqdq
+#      undef native_crc32c_fold_copy
+#      define native_crc32c_fold_copy crc32c_fold_vpclmulqdq_copy
+#      undef native_crc32c_fold_final
+#      define native_crc32c_fold_final crc32c_fold_vpclmulqdq_final
+#      undef native_crc32c_fold_reset
+#      define native_crc32c_fold_reset crc32c_fold_vpclmulqdq_reset
+#      undef native_crc64
+#      define native_crc64 crc64_vpclmulqdq
 #    endif
 #  endif
 #endif
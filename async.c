@@ -0,0 +1,308 @@
+/* async.c -- asynchronous compression jobs run by a pool of worker threads
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   An event loop that calls deflate() on a large response stalls every other connection for as long as the call
+   takes. The asynchronous queue moves such calls to a pool of worker threads: a job is one deflate() or inflate()
+   call on a stream of the caller, or the compress2() or uncompress2() of a buffer, and it completes either with a
+   callback on the worker thread, or by being handed back through zng_async_poll() or zng_async_wait(). Buffer jobs go
+   through compress2() and uncompress2(), so that with the state cache each worker keeps its own streams for them.
+
+   Jobs that complete without a callback are kept on a list, and a file descriptor, an eventfd on Linux and a pipe
+   on other POSIX systems, is readable while that list is not empty, so that the event loop can wait for it with
+   poll(), epoll or kqueue along with its sockets. Without thread support, jobs are run by zng_async_submit()
+   itself, and complete before it returns.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "zutil_p.h"
+#include "zthread.h"
+
+#ifndef ZLIB_COMPAT
+
+#ifdef __linux__
+#  include <sys/eventfd.h>
+#  include <unistd.h>
+#elif !defined(_WIN32)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+#define ASYNC_MAX_THREADS 64
+
+struct zng_async_queue_s {
+    zng_async_job *pending;     /* jobs that no worker has taken yet */
+    zng_async_job *pending_tail;
+    zng_async_job *done;        /* completed jobs without a callback, not yet handed back */
+    zng_async_job *done_tail;
+    size_t active;              /* jobs submitted and not completed */
+    int fd[2];                  /* readable end and writable end of the notification, or -1 */
+#ifdef WITH_THREADS
+    zng_mutex lock;
+    zng_cond work;              /* signalled when a job is queued or the workers should stop */
+    zng_cond completed;         /* signalled when a job completes */
+    zng_thread workers[ASYNC_MAX_THREADS];
+    int32_t threads;
+    int stop;
+#endif
+};
+
+/* ===========================================================================
+ * Make the notification readable, or no longer readable. Called with the lock
+ * held, when the list of completed jobs stops or starts being empty.
+ */
+static void async_notify(zng_async_queue *queue) {
+#if defined(__linux__)
+    uint64_t one = 1;
+    if (write(queue->fd[1], &one, sizeof(one)) < 0)
+        return;
+#elif !defined(_WIN32)
+    uint8_t one = 1;
+    if (write(queue->fd[1], &one, sizeof(one)) < 0)
+        return;
+#else
+    Z_UNUSED(queue);
+#endif
+}
+
+static void async_drain(zng_async_queue *queue) {
+#if defined(__linux__)
+    uint64_t count;
+    if (read(queue->fd[0], &count, sizeof(count)) < 0)
+        return;
+#elif !defined(_WIN32)
+    uint8_t buf[64];
+    while (read(queue->fd[0], buf, sizeof(buf)) > 0);
+#else
+    Z_UNUSED(queue);
+#endif
+}
+
+/* ===========================================================================
+ * Run a job: one call of deflate() or inflate() on its stream, or the
+ * compression or decompression of its buffer.
+ */
+static void async_run(zng_async_job *job) {
+    if (job->strm != NULL) {
+        if (job->decompress)
+            job->status = zng_inflate(job->strm, job->flush);
+        else
+            job->status = zng_deflate(job->strm, job->flush);
+    } else if (job->decompress) {
+        job->status = zng_uncompress2(job->dest, &job->dest_len, job->src, &job->src_len);
+    } else {
+        job->status = zng_compress2(job->dest, &job->dest_len, job->src, job->src_len, job->level);
+    }
+}
+
+/* ===========================================================================
+ * Complete a job that has run, with the lock held. The job counts as active
+ * until its callback returns, so that zng_async_wait() and
+ * zng_async_destroy() wait for the callback too. The callback may free or
+ * submit the job again, so the job is not touched after it.
+ */
+static void async_complete(zng_async_queue *queue, zng_async_job *job) {
+    if (job->callback != NULL) {
+#ifdef WITH_THREADS
+        zng_mutex_unlock(&queue->lock);
+        job->callback(job);
+        zng_mutex_lock(&queue->lock);
+#else
+        job->callback(job);
+#endif
+    } else {
+        job->next = NULL;
+        if (queue->done == NULL) {
+            queue->done = job;
+            async_notify(queue);
+        } else {
+            queue->done_tail->next = job;
+        }
+        queue->done_tail = job;
+    }
+
+    queue->active--;
+#ifdef WITH_THREADS
+    zng_cond_broadcast(&queue->completed);
+#endif
+}
+
+#ifdef WITH_THREADS
+static ZNG_THREAD_PROC(async_worker_proc, arg) {
+    zng_async_queue *queue = (zng_async_queue *)arg;
+    zng_async_job *job;
+
+    zng_mutex_lock(&queue->lock);
+    for (;;) {
+        while (queue->pending == NULL && !queue->stop)
+            zng_cond_wait(&queue->work, &queue->lock);
+        /* The jobs that are queued are run before the workers stop */
+        job = queue->pending;
+        if (job == NULL)
+            break;
+        queue->pending = job->next;
+        zng_mutex_unlock(&queue->lock);
+
+        async_run(job);
+
+        zng_mutex_lock(&queue->lock);
+        async_complete(queue, job);
+    }
+    zng_mutex_unlock(&queue->lock);
+    return ZNG_THREAD_RETURN;
+}
+#endif
+
+/* ========================================================================= */
+zng_async_queue * Z_EXPORT zng_async_create(int32_t threads) {
+#if !defined(__linux__) && !defined(_WIN32)
+    int i;
+#endif
+    zng_async_queue *queue = (zng_async_queue *)zng_alloc(sizeof(zng_async_queue));
+
+    if (queue == NULL)
+        return NULL;
+    memset(queue, 0, sizeof(zng_async_queue));
+    queue->fd[0] = queue->fd[1] = -1;
+
+#if defined(__linux__)
+    queue->fd[0] = queue->fd[1] = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (queue->fd[0] < 0) {
+        zng_free(queue);
+        return NULL;
+    }
+#elif !defined(_WIN32)
+    if (pipe(queue->fd) != 0) {
+        zng_free(queue);
+        return NULL;
+    }
+    for (i = 0; i < 2; i++) {
+        fcntl(queue->fd[i], F_SETFD, FD_CLOEXEC);
+        fcntl(queue->fd[i], F_SETFL, fcntl(queue->fd[i], F_GETFL) | O_NONBLOCK);
+    }
+#endif
+
+#ifdef WITH_THREADS
+    if (threads < 1)
+        threads = 1;
+    if (threads > ASYNC_MAX_THREADS)
+        threads = ASYNC_MAX_THREADS;
+    zng_mutex_init(&queue->lock);
+    zng_cond_init(&queue->work);
+    zng_cond_init(&queue->completed);
+    while (queue->threads < threads &&
+           zng_thread_create(&queue->workers[queue->threads], async_worker_proc, queue) == 0)
+        queue->threads++;
+    if (queue->threads == 0) {
+        zng_async_destroy(queue);
+        return NULL;
+    }
+#else
+    Z_UNUSED(threads);
+#endif
+    return queue;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_async_submit(zng_async_queue *queue, zng_async_job *job) {
+    if (queue == NULL || job == NULL)
+        return Z_STREAM_ERROR;
+    job->next = NULL;
+
+#ifdef WITH_THREADS
+    zng_mutex_lock(&queue->lock);
+    if (queue->pending == NULL)
+        queue->pending = job;
+    else
+        queue->pending_tail->next = job;
+    queue->pending_tail = job;
+    queue->active++;
+    zng_cond_signal(&queue->work);
+    zng_mutex_unlock(&queue->lock);
+#else
+    queue->active++;
+    async_run(job);
+    async_complete(queue, job);
+#endif
+    return Z_OK;
+}
+
+/* Take the first completed job off the list, with the lock held */
+static zng_async_job *async_take(zng_async_queue *queue) {
+    zng_async_job *job = queue->done;
+
+    if (job != NULL) {
+        queue->done = job->next;
+        job->next = NULL;
+        if (queue->done == NULL)
+            async_drain(queue);
+    }
+    return job;
+}
+
+/* ========================================================================= */
+zng_async_job * Z_EXPORT zng_async_poll(zng_async_queue *queue) {
+    zng_async_job *job;
+
+    if (queue == NULL)
+        return NULL;
+#ifdef WITH_THREADS
+    zng_mutex_lock(&queue->lock);
+    job = async_take(queue);
+    zng_mutex_unlock(&queue->lock);
+#else
+    job = async_take(queue);
+#endif
+    return job;
+}
+
+/* ========================================================================= */
+zng_async_job * Z_EXPORT zng_async_wait(zng_async_queue *queue) {
+    zng_async_job *job;
+
+    if (queue == NULL)
+        return NULL;
+#ifdef WITH_THREADS
+    zng_mutex_lock(&queue->lock);
+    while (queue->done == NULL && queue->active > 0)
+        zng_cond_wait(&queue->completed, &queue->lock);
+    job = async_take(queue);
+    zng_mutex_unlock(&queue->lock);
+#else
+    job = async_take(queue);
+#endif
+    return job;
+}
+
+/* ========================================================================= */
+int Z_EXPORT zng_async_fd(zng_async_queue *queue) {
+    return queue == NULL ? -1 : queue->fd[0];
+}
+
+/* ========================================================================= */
+void Z_EXPORT zng_async_destroy(zng_async_queue *queue) {
+    if (queue == NULL)
+        return;
+#ifdef WITH_THREADS
+    zng_mutex_lock(&queue->lock);
+    queue->stop = 1;
+    zng_cond_broadcast(&queue->work);
+    zng_mutex_unlock(&queue->lock);
+    while (queue->threads > 0)
+        zng_thread_join(queue->workers[--queue->threads]);
+    zng_cond_destroy(&queue->completed);
+    zng_cond_destroy(&queue->work);
+    zng_mutex_destroy(&queue->lock);
+#endif
+#ifndef _WIN32
+    if (queue->fd[0] >= 0)
+        close(queue->fd[0]);
+    if (queue->fd[1] >= 0 && queue->fd[1] != queue->fd[0])
+        close(queue->fd[1]);
+#endif
+    zng_free(queue);
+}
+
+#endif
@@ -0,0 +1,263 @@
+/* batch.c -- compress and uncompress batches of independent buffers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   compress2() and uncompress2() set up and free a whole stream for every buffer. For small records this costs
+   more than the compression itself: the deflate state, window and hash table are allocated, and the 128K hash
+   table is cleared, every time. The batch functions set up one stream per thread and reset it between items. The
+   deflate state is reset with deflateResetLazy(), which only clears the hash table entries that a short item
+   could have set.
+
+   With thread support, the items are shared among the calling thread and up to threads - 1 worker threads, each
+   with its own stream, which take BATCH_CHUNK items at a time so that threads that get the short items take more
+   of them.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "deflate.h"
+#include "offload.h"
+#include "zthread.h"
+
+#ifndef ZLIB_COMPAT
+
+#define BATCH_CHUNK       16    /* items taken by a thread at a time */
+#define BATCH_MAX_THREADS 64
+
+typedef struct batch_s {
+    zng_batch_item *items;
+    size_t count;
+    size_t next;                /* first item that no thread has taken yet */
+    int32_t level;              /* compression level */
+    int decompress;             /* whether the items are uncompressed */
+#ifdef WITH_THREADS
+    zng_mutex lock;
+#endif
+} batch;
+
+/* ===========================================================================
+ * Compress one item as compress2() does, with a stream that was reset.
+ */
+static int32_t batch_deflate(zng_stream *strm, zng_batch_item *item) {
+    const uint32_t max = UINT32_MAX;
+    size_t src_len = item->src_len;
+    size_t left = item->dest_len;
+    int32_t err;
+
+    strm->next_in = item->src;
+    strm->avail_in = 0;
+    strm->next_out = item->dest;
+    strm->avail_out = 0;
+
+    do {
+        if (strm->avail_out == 0) {
+            strm->avail_out = (uint32_t)MIN(left, max);
+            left -= strm->avail_out;
+        }
+        if (strm->avail_in == 0) {
+            strm->avail_in = (uint32_t)MIN(src_len, max);
+            src_len -= strm->avail_in;
+        }
+        err = zng_deflate(strm, src_len ? Z_NO_FLUSH : Z_FINISH);
+    } while (err == Z_OK);
+
+    item->dest_len = strm->total_out;
+    zng_deflateResetLazy(strm);
+    return err == Z_STREAM_END ? Z_OK : err;
+}
+
+/* ===========================================================================
+ * Uncompress one item as uncompress2() does, with a stream that was reset.
+ */
+static int32_t batch_inflate(zng_stream *strm, zng_batch_item *item) {
+    const uint32_t max = UINT32_MAX;
+    size_t src_len = item->src_len;
+    size_t left;
+    uint8_t buf[1];             /* for detection of incomplete stream when dest_len is 0 */
+    uint8_t *dest = item->dest;
+    int32_t err;
+
+    if (item->dest_len) {
+        left = item->dest_len;
+    } else {
+        left = 1;
+        dest = buf;
+    }
+
+    strm->next_in = item->src;
+    strm->avail_in = 0;
+    strm->next_out = dest;
+    strm->avail_out = 0;
+
+    do {
+        if (strm->avail_out == 0) {
+            strm->avail_out = (uint32_t)MIN(left, max);
+            left -= strm->avail_out;
+        }
+        if (strm->avail_in == 0) {
+            strm->avail_in = (uint32_t)MIN(src_len, max);
+            src_len -= strm->avail_in;
+        }
+        err = zng_inflate(strm, Z_NO_FLUSH);
+    } while (err == Z_OK);
+
+    item->src_len -= src_len + strm->avail_in;
+    if (dest != buf)
+        item->dest_len = strm->total_out;
+    else if (strm->total_out && err == Z_BUF_ERROR)
+        left = 1;
+    left += strm->avail_out;
+
+    zng_inflateReset(strm);
+    return err == Z_STREAM_END ? Z_OK :
+           err == Z_NEED_DICT ? Z_DATA_ERROR :
+           err == Z_BUF_ERROR && left ? Z_DATA_ERROR :
+           err;
+}
+
+/* ===========================================================================
+ * Set up a stream for the batch, with offloading disabled since a provider
+ * would have to be opened for every item.
+ */
+static int32_t batch_init(batch *b, zng_stream *strm) {
+    int32_t ret;
+
+    memset(strm, 0, sizeof(*strm));
+    if (b->decompress) {
+        ret = zng_inflateInit(strm);
+        if (ret == Z_OK)
+            offload_disable_inflate(strm);
+    } else {
+        ret = zng_deflateInit(strm, b->level);
+        if (ret == Z_OK)
+            offload_disable_deflate(strm);
+    }
+    return ret;
+}
+
+/* Take the next chunk of items, and return 0 if there is none left */
+static int batch_take(batch *b, size_t *first, size_t *last) {
+#ifdef WITH_THREADS
+    zng_mutex_lock(&b->lock);
+#endif
+    *first = b->next;
+    *last = MIN(b->count, b->next + BATCH_CHUNK);
+    b->next = *last;
+#ifdef WITH_THREADS
+    zng_mutex_unlock(&b->lock);
+#endif
+    return *first < *last;
+}
+
+/* ===========================================================================
+ * Process chunks of items with strm until there are none left, then end strm.
+ */
+static void batch_run(batch *b, zng_stream *strm) {
+    size_t first, last, i;
+
+    while (batch_take(b, &first, &last)) {
+        for (i = first; i < last; i++) {
+            zng_batch_item *item = &b->items[i];
+            if (b->decompress)
+                item->status = batch_inflate(strm, item);
+            else
+                item->status = batch_deflate(strm, item);
+        }
+    }
+
+    if (b->decompress)
+        zng_inflateEnd(strm);
+    else
+        zng_deflateEnd(strm);
+}
+
+#ifdef WITH_THREADS
+static ZNG_THREAD_PROC(batch_worker_proc, arg) {
+    batch *b = (batch *)arg;
+    zng_stream strm;
+
+    /* The other threads do the work of a worker that cannot set up its stream */
+    if (batch_init(b, &strm) == Z_OK)
+        batch_run(b, &strm);
+    return ZNG_THREAD_RETURN;
+}
+#endif
+
+/* ===========================================================================
+ * Process all the items of the batch, and return Z_OK or the status of the
+ * first item that failed.
+ */
+static int32_t batch_process(batch *b, int32_t threads) {
+    zng_stream strm;
+    size_t i;
+    int32_t ret;
+#ifdef WITH_THREADS
+    zng_thread workers[BATCH_MAX_THREADS - 1];
+    int32_t started = 0;
+#endif
+
+    if (b->items == NULL && b->count != 0)
+        return Z_STREAM_ERROR;
+    if (b->count == 0)
+        return Z_OK;
+
+    /* The calling thread always takes part, so that the batch does not depend on worker threads */
+    ret = batch_init(b, &strm);
+    if (ret != Z_OK) {
+        for (i = 0; i < b->count; i++)
+            b->items[i].status = ret;
+        return ret;
+    }
+
+#ifdef WITH_THREADS
+    /* No more threads than chunks of items */
+    if (threads > BATCH_MAX_THREADS)
+        threads = BATCH_MAX_THREADS;
+    if (threads > 1 && (size_t)threads > (b->count + BATCH_CHUNK - 1) / BATCH_CHUNK)
+        threads = (int32_t)((b->count + BATCH_CHUNK - 1) / BATCH_CHUNK);
+
+    zng_mutex_init(&b->lock);
+    while (started < threads - 1 && zng_thread_create(&workers[started], batch_worker_proc, b) == 0)
+        started++;
+    batch_run(b, &strm);
+    while (started > 0)
+        zng_thread_join(workers[--started]);
+    zng_mutex_destroy(&b->lock);
+#else
+    Z_UNUSED(threads);
+    batch_run(b, &strm);
+#endif
+
+    for (i = 0; i < b->count; i++) {
+        if (b->items[i].status != Z_OK)
+            return b->items[i].status;
+    }
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_compress_batch(zng_batch_item *items, size_t count, int32_t level, int32_t threads) {
+    batch b;
+
+    b.items = items;
+    b.count = count;
+    b.next = 0;
+    b.level = level;
+    b.decompress = 0;
+    return batch_process(&b, threads);
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_uncompress_batch(zng_batch_item *items, size_t count, int32_t threads) {
+    batch b;
+
+    b.items = items;
+    b.count = count;
+    b.next = 0;
+    b.level = 0;
+    b.decompress = 1;
+    return batch_process(&b, threads);
+}
+
+#endif
@@ -0,0 +1,108 @@
+/* checksum_parallel.c -- CRC-32 and Adler-32 of large buffers on several threads
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   The buffer is split into one chunk per thread. Every chunk is hashed from the initial value on its own thread
+   (the calling thread takes the first one), and the partial checks are then merged in order with the combine
+   functions, so the result is identical to hashing the whole buffer in one call. The crc32 combine operator only
+   depends on the chunk length, so it is generated once for all the equally sized chunks. Without thread support
+   the chunks are simply hashed one after the other.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+#include "zthread.h"
+
+#ifndef ZLIB_COMPAT
+
+#define PARALLEL_MIN_CHUNK  (1024 * 1024)   /* smaller chunks are not worth a thread */
+#define PARALLEL_MAX_CHUNKS 64
+
+typedef struct {
+    const uint8_t *buf;
+    size_t len;
+    uint32_t check;             /* check value of the chunk alone */
+    int adler;                  /* whether to compute adler32 instead of crc32 */
+} parallel_chunk;
+
+static void parallel_hash(parallel_chunk *chunk) {
+    if (chunk->adler)
+        chunk->check = FUNCTABLE_CALL(adler32)(ADLER32_INITIAL_VALUE, chunk->buf, chunk->len);
+    else
+        chunk->check = FUNCTABLE_CALL(crc32)(CRC32_INITIAL_VALUE, chunk->buf, chunk->len);
+}
+
+#ifdef WITH_THREADS
+static ZNG_THREAD_PROC(parallel_proc, arg) {
+    parallel_hash((parallel_chunk *)arg);
+    return ZNG_THREAD_RETURN;
+}
+#endif
+
+static uint32_t checksum_parallel(uint32_t check, const uint8_t *buf, size_t len, int32_t threads, int adler) {
+    parallel_chunk chunks[PARALLEL_MAX_CHUNKS];
+#ifdef WITH_THREADS
+    zng_thread handles[PARALLEL_MAX_CHUNKS];
+    int started[PARALLEL_MAX_CHUNKS];
+#endif
+    size_t chunk_len, count, i;
+    uint32_t op = 0;
+
+    count = (size_t)MAX(threads, 1);
+    count = MIN(count, PARALLEL_MAX_CHUNKS);
+    count = MIN(count, len / PARALLEL_MIN_CHUNK);
+    count = MAX(count, 1);
+    chunk_len = len / count;
+
+    for (i = 0; i < count; i++) {
+        chunks[i].buf = buf + i * chunk_len;
+        chunks[i].len = i == count - 1 ? len - i * chunk_len : chunk_len;
+        chunks[i].adler = adler;
+    }
+
+#ifdef WITH_THREADS
+    /* Chunks whose thread could not be started are hashed by the calling thread instead */
+    for (i = 1; i < count; i++)
+        started[i] = zng_thread_create(&handles[i], parallel_proc, &chunks[i]) == 0;
+    parallel_hash(&chunks[0]);
+    for (i = 1; i < count; i++) {
+        if (started[i])
+            zng_thread_join(handles[i]);
+        else
+            parallel_hash(&chunks[i]);
+    }
+#else
+    for (i = 0; i < count; i++)
+        parallel_hash(&chunks[i]);
+#endif
+
+    if (!adler)
+        op = PREFIX(crc32_combine_gen)((z_off64_t)chunk_len);
+    for (i = 0; i < count; i++) {
+        if (adler)
+            check = PREFIX4(adler32_combine)(check, chunks[i].check, (z_off64_t)chunks[i].len);
+        else if (chunks[i].len == chunk_len)
+            check = PREFIX(crc32_combine_op)(check, chunks[i].check, op);
+        else
+            check = PREFIX4(crc32_combine)(check, chunks[i].check, (z_off64_t)chunks[i].len);
+    }
+    return check;
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT PREFIX(crc32_parallel)(uint32_t crc, const uint8_t *buf, size_t len, int32_t threads) {
+    if (buf == NULL) return 0;
+
+    return checksum_parallel(crc, buf, len, threads, 0);
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT PREFIX(adler32_parallel)(uint32_t adler, const uint8_t *buf, size_t len, int32_t threads) {
+    if (buf == NULL) return 1;
+
+    return checksum_parallel(adler, buf, len, threads, 1);
+}
+
+#endif
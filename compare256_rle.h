@@ -3,6 +3,9 @@
  * For conditions of distribution and use, see copyright notice in zlib.h
  */
 
+#ifndef COMPARE256_RLE_H_
+#define COMPARE256_RLE_H_
+
 #include "zbuild.h"
 #include "fallback_builtins.h"
 #include "zendian.h"
@@ -141,3 +144,4 @@ static inline uint32_t compare256_rle_unaligned_64(const uint8_t *src0, const ui
 
 #endif
 
+#endif
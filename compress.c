@@ -5,6 +5,7 @@
 
 #include "zbuild.h"
 #include "zutil.h"
+#include "state_cache.h"
 
 /* ===========================================================================
  *  Architecture-specific hooks.
@@ -30,7 +31,7 @@
 */
 int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source,
                         z_uintmax_t sourceLen, int level) {
-    PREFIX3(stream) stream;
+    PREFIX3(stream) stream, *strm;
     int err;
     const unsigned int max = (unsigned int)-1;
     z_size_t left;
@@ -38,33 +39,40 @@ int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const
     left = *destLen;
     *destLen = 0;
 
-    stream.zalloc = NULL;
-    stream.zfree = NULL;
-    stream.opaque = NULL;
+    strm = state_cache_deflate(level, MAX_WBITS, DEF_MEM_LEVEL);
+    if (strm == NULL) {
+        strm = &stream;
+        stream.zalloc = NULL;
+        stream.zfree = NULL;
+        stream.opaque = NULL;
 
-    err = PREFIX(deflateInit)(&stream, level);
-    if (err != Z_OK)
-        return err;
+        err = PREFIX(deflateInit)(&stream, level);
+        if (err != Z_OK)
+            return err;
+    }
 
-    stream.next_out = dest;
-    stream.avail_out = 0;
-    stream.next_in = (z_const unsigned char *)source;
-    stream.avail_in = 0;
+    strm->next_out = dest;
+    strm->avail_out = 0;
+    strm->next_in = (z_const unsigned char *)source;
+    strm->avail_in = 0;
 
     do {
-        if (stream.avail_out == 0) {
-            stream.avail_out = left > (unsigned long)max ? max : (unsigned int)left;
-            left -= stream.avail_out;
+        if (strm->avail_out == 0) {
+            strm->avail_out = left > (unsigned long)max ? max : (unsigned int)left;
+            left -= strm->avail_out;
         }
-        if (stream.avail_in == 0) {
-            stream.avail_in = sourceLen > (unsigned long)max ? max : (unsigned int)sourceLen;
-            sourceLen -= stream.avail_in;
+        if (strm->avail_in == 0) {
+            strm->avail_in = sourceLen > (unsigned long)max ? max : (unsigned int)sourceLen;
+            sourceLen -= strm->avail_in;
         }
-        err = PREFIX(deflate)(&stream, sourceLen ? Z_NO_FLUSH : Z_FINISH);
+        err = PREFIX(deflate)(strm, sourceLen ? Z_NO_FLUSH : Z_FINISH);
     } while (err == Z_OK);
 
-    *destLen = stream.total_out;
-    PREFIX(deflateEnd)(&stream);
+    *destLen = strm->total_out;
+    if (strm == &stream)
+        PREFIX(deflateEnd)(&stream);
+    else
+        state_cache_deflate_done(strm);
     return err == Z_STREAM_END ? Z_OK : err;
 }
 
@@ -40,3 +40,10 @@ uint32_t Z_EXPORT PREFIX(crc32)(uint32_t crc, const unsigned char *buf, uint32_t
     return PREFIX(crc32_z)(crc, buf, len);
 }
 #endif
+
+#ifndef ZLIB_COMPAT
+/* ========================================================================= */
+void Z_EXPORT PREFIX(crc32_multi)(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    FUNCTABLE_CALL(crc32_multi)(bufs, lens, out, n);
+}
+#endif
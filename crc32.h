@@ -13,4 +13,9 @@ typedef struct crc32_fold_s {
     uint32_t value;
 } crc32_fold;
 
+typedef struct crc64_fold_s {
+    uint8_t fold[CRC32_FOLD_BUFFER_SIZE];
+    uint64_t value;
+} crc64_fold;
+
 #endif
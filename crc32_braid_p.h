@@ -44,6 +44,8 @@
 #if BYTE_ORDER == LITTLE_ENDIAN
 #  define ZSWAPWORD(word) (word)
 #  define BRAID_TABLE crc_braid_table
+#  define CRC32C_BRAID_TABLE crc32c_braid_table
+#  define CRC64_BRAID_TABLE crc64_braid_table
 #elif BYTE_ORDER == BIG_ENDIAN
 #  if W == 8
 #    define ZSWAPWORD(word) ZSWAP64(word)
@@ -51,6 +53,8 @@
 #    define ZSWAPWORD(word) ZSWAP32(word)
 #  endif
 #  define BRAID_TABLE crc_braid_big_table
+#  define CRC32C_BRAID_TABLE crc32c_braid_big_table
+#  define CRC64_BRAID_TABLE crc64_braid_big_table
 #else
 #  error "No endian defined"
 #endif
@@ -60,5 +64,7 @@
 
 /* CRC polynomial. */
 #define POLY 0xedb88320         /* p(x) reflected, with x^32 implied */
+#define CRC32C_POLY 0x82f63b78  /* Castagnoli p(x) reflected, with x^32 implied */
+#define CRC64_POLY UINT64_C(0xc96c5795d7870f42)  /* ECMA-182 p(x) reflected, with x^64 implied */
 
 #endif /* CRC32_BRAID_P_H_ */
@@ -0,0 +1,60 @@
+/* crc32c.c -- compute the CRC-32C (Castagnoli) of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+#include "crc32_braid_p.h"
+#include "crc32c_braid_tbl.h"
+
+#ifndef ZLIB_COMPAT
+
+/* Reuse the polynomial arithmetic of the CRC-32 combine functions with the CRC-32C polynomial */
+#undef POLY
+#define POLY CRC32C_POLY
+#define x2n_table crc32c_x2n_table
+#include "crc32_braid_comb_p.h"
+
+static uint32_t crc32c_combine_(uint32_t crc1, uint32_t crc2, z_off64_t len2) {
+    return multmodp(x2nmodp(len2, 3), crc1) ^ crc2;
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT PREFIX(crc32c)(uint32_t crc, const unsigned char *buf, size_t len) {
+    if (buf == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc32c)(crc, buf, len);
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT PREFIX(crc32c_copy)(uint32_t crc, unsigned char *dst, const unsigned char *src, size_t len) {
+    crc32_fold ALIGNED_(16) crc_state;
+    uint32_t value;
+
+    if (dst == NULL || src == NULL) return 0;
+    if (len == 0) return crc;
+
+    /* Folding always starts from the initial value, a running crc is combined afterwards */
+    FUNCTABLE_CALL(crc32c_fold_reset)(&crc_state);
+    FUNCTABLE_CALL(crc32c_fold_copy)(&crc_state, dst, src, len);
+    value = FUNCTABLE_CALL(crc32c_fold_final)(&crc_state);
+    if (crc == CRC32_INITIAL_VALUE)
+        return value;
+    return crc32c_combine_(crc, value, (z_off64_t)len);
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT PREFIX(crc32c_combine)(uint32_t crc1, uint32_t crc2, z_off64_t len2) {
+    return crc32c_combine_(crc1, crc2, len2);
+}
+
+uint32_t Z_EXPORT PREFIX(crc32c_combine_gen)(z_off64_t len2) {
+    return x2nmodp(len2, 3);
+}
+
+uint32_t Z_EXPORT PREFIX(crc32c_combine_op)(uint32_t crc1, uint32_t crc2, const uint32_t op) {
+    return multmodp(op, crc1) ^ crc2;
+}
+
+#endif
@@ -0,0 +1,9446 @@
+#ifndef CRC32C_BRAID_TBL_H_
+#define CRC32C_BRAID_TBL_H_
+
+/* crc32c_braid_tbl.h -- tables for braided CRC calculation
+ * Generated automatically by makecrct.c
+ */
+
+static const uint32_t crc32c_table[] = {
+    0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f,
+    0x35f1141c, 0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc,
+    0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27,
+    0x5e133c24, 0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b,
+    0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384, 0x9a879fa0,
+    0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+    0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29,
+    0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e,
+    0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa, 0x30e349b1, 0xc288cab2,
+    0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59,
+    0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+    0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc,
+    0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0,
+    0x67dafa54, 0x95b17957, 0xcba24573, 0x39c9c670, 0x2a993584,
+    0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc,
+    0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+    0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4,
+    0x0f36e6f7, 0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+    0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789, 0xeb1fcbad,
+    0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1,
+    0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e, 0x90a324fa,
+    0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd,
+    0xceb018de, 0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b,
+    0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90,
+    0x563c5f93, 0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+    0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c, 0x92a8fc17,
+    0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+    0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f,
+    0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9,
+    0x97baa1ba, 0x84ea524e, 0x7681d14d, 0x2892ed69, 0xdaf96e6a,
+    0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81,
+    0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+    0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06,
+    0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a,
+    0x1e6dcdee, 0xec064eed, 0xc38d26c4, 0x31e6a5c7, 0x22b65633,
+    0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914,
+    0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+    0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643,
+    0x07198540, 0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+    0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a,
+    0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06,
+    0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6, 0x88d28022,
+    0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a,
+    0xc69f7b69, 0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9,
+    0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052,
+    0xad7d5351};
+
+#ifdef W
+
+#if W == 8
+
+static const z_word_t crc32c_big_table[] = {
+    0x0000000000000000, 0x03836bf200000000, 0xf7703be100000000,
+    0xf4f3501300000000, 0x1f979ac700000000, 0x1c14f13500000000,
+    0xe8e7a12600000000, 0xeb64cad400000000, 0xcf58d98a00000000,
+    0xccdbb27800000000, 0x3828e26b00000000, 0x3bab899900000000,
+    0xd0cf434d00000000, 0xd34c28bf00000000, 0x27bf78ac00000000,
+    0x243c135e00000000, 0x6fc75e1000000000, 0x6c4435e200000000,
+    0x98b765f100000000, 0x9b340e0300000000, 0x7050c4d700000000,
+    0x73d3af2500000000, 0x8720ff3600000000, 0x84a394c400000000,
+    0xa09f879a00000000, 0xa31cec6800000000, 0x57efbc7b00000000,
+    0x546cd78900000000, 0xbf081d5d00000000, 0xbc8b76af00000000,
+    0x487826bc00000000, 0x4bfb4d4e00000000, 0xde8ebd2000000000,
+    0xdd0dd6d200000000, 0x29fe86c100000000, 0x2a7ded3300000000,
+    0xc11927e700000000, 0xc29a4c1500000000, 0x36691c0600000000,
+    0x35ea77f400000000, 0x11d664aa00000000, 0x12550f5800000000,
+    0xe6a65f4b00000000, 0xe52534b900000000, 0x0e41fe6d00000000,
+    0x0dc2959f00000000, 0xf931c58c00000000, 0xfab2ae7e00000000,
+    0xb149e33000000000, 0xb2ca88c200000000, 0x4639d8d100000000,
+    0x45bab32300000000, 0xaede79f700000000, 0xad5d120500000000,
+    0x59ae421600000000, 0x5a2d29e400000000, 0x7e113aba00000000,
+    0x7d92514800000000, 0x8961015b00000000, 0x8ae26aa900000000,
+    0x6186a07d00000000, 0x6205cb8f00000000, 0x96f69b9c00000000,
+    0x9575f06e00000000, 0xbc1d7b4100000000, 0xbf9e10b300000000,
+    0x4b6d40a000000000, 0x48ee2b5200000000, 0xa38ae18600000000,
+    0xa0098a7400000000, 0x54fada6700000000, 0x5779b19500000000,
+    0x7345a2cb00000000, 0x70c6c93900000000, 0x8435992a00000000,
+    0x87b6f2d800000000, 0x6cd2380c00000000, 0x6f5153fe00000000,
+    0x9ba203ed00000000, 0x9821681f00000000, 0xd3da255100000000,
+    0xd0594ea300000000, 0x24aa1eb000000000, 0x2729754200000000,
+    0xcc4dbf9600000000, 0xcfced46400000000, 0x3b3d847700000000,
+    0x38beef8500000000, 0x1c82fcdb00000000, 0x1f01972900000000,
+    0xebf2c73a00000000, 0xe871acc800000000, 0x0315661c00000000,
+    0x00960dee00000000, 0xf4655dfd00000000, 0xf7e6360f00000000,
+    0x6293c66100000000, 0x6110ad9300000000, 0x95e3fd8000000000,
+    0x9660967200000000, 0x7d045ca600000000, 0x7e87375400000000,
+    0x8a74674700000000, 0x89f70cb500000000, 0xadcb1feb00000000,
+    0xae48741900000000, 0x5abb240a00000000, 0x59384ff800000000,
+    0xb25c852c00000000, 0xb1dfeede00000000, 0x452cbecd00000000,
+    0x46afd53f00000000, 0x0d54987100000000, 0x0ed7f38300000000,
+    0xfa24a39000000000, 0xf9a7c86200000000, 0x12c302b600000000,
+    0x1140694400000000, 0xe5b3395700000000, 0xe63052a500000000,
+    0xc20c41fb00000000, 0xc18f2a0900000000, 0x357c7a1a00000000,
+    0x36ff11e800000000, 0xdd9bdb3c00000000, 0xde18b0ce00000000,
+    0x2aebe0dd00000000, 0x29688b2f00000000, 0x783bf68200000000,
+    0x7bb89d7000000000, 0x8f4bcd6300000000, 0x8cc8a69100000000,
+    0x67ac6c4500000000, 0x642f07b700000000, 0x90dc57a400000000,
+    0x935f3c5600000000, 0xb7632f0800000000, 0xb4e044fa00000000,
+    0x401314e900000000, 0x43907f1b00000000, 0xa8f4b5cf00000000,
+    0xab77de3d00000000, 0x5f848e2e00000000, 0x5c07e5dc00000000,
+    0x17fca89200000000, 0x147fc36000000000, 0xe08c937300000000,
+    0xe30ff88100000000, 0x086b325500000000, 0x0be859a700000000,
+    0xff1b09b400000000, 0xfc98624600000000, 0xd8a4711800000000,
+    0xdb271aea00000000, 0x2fd44af900000000, 0x2c57210b00000000,
+    0xc733ebdf00000000, 0xc4b0802d00000000, 0x3043d03e00000000,
+    0x33c0bbcc00000000, 0xa6b54ba200000000, 0xa536205000000000,
+    0x51c5704300000000, 0x52461bb100000000, 0xb922d16500000000,
+    0xbaa1ba9700000000, 0x4e52ea8400000000, 0x4dd1817600000000,
+    0x69ed922800000000, 0x6a6ef9da00000000, 0x9e9da9c900000000,
+    0x9d1ec23b00000000, 0x767a08ef00000000, 0x75f9631d00000000,
+    0x810a330e00000000, 0x828958fc00000000, 0xc97215b200000000,
+    0xcaf17e4000000000, 0x3e022e5300000000, 0x3d8145a100000000,
+    0xd6e58f7500000000, 0xd566e48700000000, 0x2195b49400000000,
+    0x2216df6600000000, 0x062acc3800000000, 0x05a9a7ca00000000,
+    0xf15af7d900000000, 0xf2d99c2b00000000, 0x19bd56ff00000000,
+    0x1a3e3d0d00000000, 0xeecd6d1e00000000, 0xed4e06ec00000000,
+    0xc4268dc300000000, 0xc7a5e63100000000, 0x3356b62200000000,
+    0x30d5ddd000000000, 0xdbb1170400000000, 0xd8327cf600000000,
+    0x2cc12ce500000000, 0x2f42471700000000, 0x0b7e544900000000,
+    0x08fd3fbb00000000, 0xfc0e6fa800000000, 0xff8d045a00000000,
+    0x14e9ce8e00000000, 0x176aa57c00000000, 0xe399f56f00000000,
+    0xe01a9e9d00000000, 0xabe1d3d300000000, 0xa862b82100000000,
+    0x5c91e83200000000, 0x5f1283c000000000, 0xb476491400000000,
+    0xb7f522e600000000, 0x430672f500000000, 0x4085190700000000,
+    0x64b90a5900000000, 0x673a61ab00000000, 0x93c931b800000000,
+    0x904a5a4a00000000, 0x7b2e909e00000000, 0x78adfb6c00000000,
+    0x8c5eab7f00000000, 0x8fddc08d00000000, 0x1aa830e300000000,
+    0x192b5b1100000000, 0xedd80b0200000000, 0xee5b60f000000000,
+    0x053faa2400000000, 0x06bcc1d600000000, 0xf24f91c500000000,
+    0xf1ccfa3700000000, 0xd5f0e96900000000, 0xd673829b00000000,
+    0x2280d28800000000, 0x2103b97a00000000, 0xca6773ae00000000,
+    0xc9e4185c00000000, 0x3d17484f00000000, 0x3e9423bd00000000,
+    0x756f6ef300000000, 0x76ec050100000000, 0x821f551200000000,
+    0x819c3ee000000000, 0x6af8f43400000000, 0x697b9fc600000000,
+    0x9d88cfd500000000, 0x9e0ba42700000000, 0xba37b77900000000,
+    0xb9b4dc8b00000000, 0x4d478c9800000000, 0x4ec4e76a00000000,
+    0xa5a02dbe00000000, 0xa623464c00000000, 0x52d0165f00000000,
+    0x51537dad00000000};
+
+#else /* W == 4 */
+
+static const z_word_t crc32c_big_table[] = {
+    0x00000000, 0x03836bf2, 0xf7703be1, 0xf4f35013, 0x1f979ac7,
+    0x1c14f135, 0xe8e7a126, 0xeb64cad4, 0xcf58d98a, 0xccdbb278,
+    0x3828e26b, 0x3bab8999, 0xd0cf434d, 0xd34c28bf, 0x27bf78ac,
+    0x243c135e, 0x6fc75e10, 0x6c4435e2, 0x98b765f1, 0x9b340e03,
+    0x7050c4d7, 0x73d3af25, 0x8720ff36, 0x84a394c4, 0xa09f879a,
+    0xa31cec68, 0x57efbc7b, 0x546cd789, 0xbf081d5d, 0xbc8b76af,
+    0x487826bc, 0x4bfb4d4e, 0xde8ebd20, 0xdd0dd6d2, 0x29fe86c1,
+    0x2a7ded33, 0xc11927e7, 0xc29a4c15, 0x36691c06, 0x35ea77f4,
+    0x11d664aa, 0x12550f58, 0xe6a65f4b, 0xe52534b9, 0x0e41fe6d,
+    0x0dc2959f, 0xf931c58c, 0xfab2ae7e, 0xb149e330, 0xb2ca88c2,
+    0x4639d8d1, 0x45bab323, 0xaede79f7, 0xad5d1205, 0x59ae4216,
+    0x5a2d29e4, 0x7e113aba, 0x7d925148, 0x8961015b, 0x8ae26aa9,
+    0x6186a07d, 0x6205cb8f, 0x96f69b9c, 0x9575f06e, 0xbc1d7b41,
+    0xbf9e10b3, 0x4b6d40a0, 0x48ee2b52, 0xa38ae186, 0xa0098a74,
+    0x54fada67, 0x5779b195, 0x7345a2cb, 0x70c6c939, 0x8435992a,
+    0x87b6f2d8, 0x6cd2380c, 0x6f5153fe, 0x9ba203ed, 0x9821681f,
+    0xd3da2551, 0xd0594ea3, 0x24aa1eb0, 0x27297542, 0xcc4dbf96,
+    0xcfced464, 0x3b3d8477, 0x38beef85, 0x1c82fcdb, 0x1f019729,
+    0xebf2c73a, 0xe871acc8, 0x0315661c, 0x00960dee, 0xf4655dfd,
+    0xf7e6360f, 0x6293c661, 0x6110ad93, 0x95e3fd80, 0x96609672,
+    0x7d045ca6, 0x7e873754, 0x8a746747, 0x89f70cb5, 0xadcb1feb,
+    0xae487419, 0x5abb240a, 0x59384ff8, 0xb25c852c, 0xb1dfeede,
+    0x452cbecd, 0x46afd53f, 0x0d549871, 0x0ed7f383, 0xfa24a390,
+    0xf9a7c862, 0x12c302b6, 0x11406944, 0xe5b33957, 0xe63052a5,
+    0xc20c41fb, 0xc18f2a09, 0x357c7a1a, 0x36ff11e8, 0xdd9bdb3c,
+    0xde18b0ce, 0x2aebe0dd, 0x29688b2f, 0x783bf682, 0x7bb89d70,
+    0x8f4bcd63, 0x8cc8a691, 0x67ac6c45, 0x642f07b7, 0x90dc57a4,
+    0x935f3c56, 0xb7632f08, 0xb4e044fa, 0x401314e9, 0x43907f1b,
+    0xa8f4b5cf, 0xab77de3d, 0x5f848e2e, 0x5c07e5dc, 0x17fca892,
+    0x147fc360, 0xe08c9373, 0xe30ff881, 0x086b3255, 0x0be859a7,
+    0xff1b09b4, 0xfc986246, 0xd8a47118, 0xdb271aea, 0x2fd44af9,
+    0x2c57210b, 0xc733ebdf, 0xc4b0802d, 0x3043d03e, 0x33c0bbcc,
+    0xa6b54ba2, 0xa5362050, 0x51c57043, 0x52461bb1, 0xb922d165,
+    0xbaa1ba97, 0x4e52ea84, 0x4dd18176, 0x69ed9228, 0x6a6ef9da,
+    0x9e9da9c9, 0x9d1ec23b, 0x767a08ef, 0x75f9631d, 0x810a330e,
+    0x828958fc, 0xc97215b2, 0xcaf17e40, 0x3e022e53, 0x3d8145a1,
+    0xd6e58f75, 0xd566e487, 0x2195b494, 0x2216df66, 0x062acc38,
+    0x05a9a7ca, 0xf15af7d9, 0xf2d99c2b, 0x19bd56ff, 0x1a3e3d0d,
+    0xeecd6d1e, 0xed4e06ec, 0xc4268dc3, 0xc7a5e631, 0x3356b622,
+    0x30d5ddd0, 0xdbb11704, 0xd8327cf6, 0x2cc12ce5, 0x2f424717,
+    0x0b7e5449, 0x08fd3fbb, 0xfc0e6fa8, 0xff8d045a, 0x14e9ce8e,
+    0x176aa57c, 0xe399f56f, 0xe01a9e9d, 0xabe1d3d3, 0xa862b821,
+    0x5c91e832, 0x5f1283c0, 0xb4764914, 0xb7f522e6, 0x430672f5,
+    0x40851907, 0x64b90a59, 0x673a61ab, 0x93c931b8, 0x904a5a4a,
+    0x7b2e909e, 0x78adfb6c, 0x8c5eab7f, 0x8fddc08d, 0x1aa830e3,
+    0x192b5b11, 0xedd80b02, 0xee5b60f0, 0x053faa24, 0x06bcc1d6,
+    0xf24f91c5, 0xf1ccfa37, 0xd5f0e969, 0xd673829b, 0x2280d288,
+    0x2103b97a, 0xca6773ae, 0xc9e4185c, 0x3d17484f, 0x3e9423bd,
+    0x756f6ef3, 0x76ec0501, 0x821f5512, 0x819c3ee0, 0x6af8f434,
+    0x697b9fc6, 0x9d88cfd5, 0x9e0ba427, 0xba37b779, 0xb9b4dc8b,
+    0x4d478c98, 0x4ec4e76a, 0xa5a02dbe, 0xa623464c, 0x52d0165f,
+    0x51537dad};
+
+#endif
+
+#endif /* W */
+
+#if N == 1
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d,
+    0x6821ff4a, 0xb3657823, 0xfa590504, 0x423b04da, 0x0b0779fd,
+    0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9,
+    0xb86201de, 0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd,
+    0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0, 0xc64d0d6e,
+    0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224,
+    0x7528754d, 0x3c14086a, 0x0d006599, 0x443c18be, 0x9f789fd7,
+    0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+    0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e,
+    0x271a9e09, 0xfc5e1960, 0xb5626447, 0x89766c2d, 0xc04a110a,
+    0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e,
+    0x732f6929, 0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e,
+    0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3, 0x1a00cb32,
+    0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478,
+    0xa965b311, 0xe059ce36, 0x583bcfe8, 0x1107b2cf, 0xca4335a6,
+    0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+    0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb,
+    0xf6573dcc, 0x2d13baa5, 0x642fc782, 0xdc4dc65c, 0x9571bb7b,
+    0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f,
+    0x2614c358, 0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2,
+    0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf, 0x553baa71,
+    0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b,
+    0xe65ed252, 0xaf62af75, 0x9376a71f, 0xda4ada38, 0x010e5d51,
+    0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+    0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8,
+    0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1, 0x34019664, 0x7d3deb43,
+    0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47,
+    0xce589360, 0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7,
+    0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba, 0xb0779fd0,
+    0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a,
+    0x0312e7f3, 0x4a2e9ad4, 0xf24c9b0a, 0xbb70e62d, 0x60346144,
+    0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+    0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190,
+    0x51200cb7, 0x8a648bde, 0xc358f6f9, 0x7b3af727, 0x32068a00,
+    0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04,
+    0x8163f223, 0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20,
+    0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d, 0xff4cfe93,
+    0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9,
+    0x4c2986b0, 0x0515fb97, 0x2e015d56, 0x673d2071, 0xbc79a718,
+    0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+    0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1,
+    0x041ba6c6, 0xdf5f21af, 0x96635c88, 0xaa7754e2, 0xe34b29c5,
+    0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1,
+    0x502e51e6, 0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751,
+    0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c, 0x230138cf,
+    0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785,
+    0x906440ec, 0xd9583dcb, 0x613a3c15, 0x28064132, 0xf342c65b,
+    0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+    0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316,
+    0xcf56ce31, 0x14124958, 0x5d2e347f, 0xe54c35a1, 0xac704886,
+    0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82,
+    0x1f1530a5},
+   {0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1,
+    0xcde3e919, 0x75e69c41, 0x1de5b089, 0x4e2dfd53, 0x262ed19b,
+    0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112,
+    0x53c84dda, 0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe,
+    0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f, 0xd27607f5,
+    0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec,
+    0xa7909bb4, 0xcf93b77c, 0x3d5b83bd, 0x5558af75, 0xed5dda2d,
+    0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+    0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f,
+    0xbe9597f7, 0x0690e2af, 0x6e93ce67, 0xa100791b, 0xc90355d3,
+    0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a,
+    0xbce5c992, 0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110,
+    0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1, 0x7ab7077a,
+    0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63,
+    0x0f519b3b, 0x6752b7f3, 0x349afa29, 0x5c99d6e1, 0xe49ca3b9,
+    0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+    0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d,
+    0x2b0f14c5, 0x930a619d, 0xfb094d55, 0xa8c1008f, 0xc0c22c47,
+    0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce,
+    0xb524b006, 0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f,
+    0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e, 0x09c17994,
+    0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d,
+    0x7c27e5d5, 0x1424c91d, 0xdbb77e61, 0xb3b452a9, 0x0bb127f1,
+    0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+    0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3,
+    0x58796a2b, 0xe07c1f73, 0x887f33bb, 0xf56e0ef4, 0x9d6d223c,
+    0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5,
+    0xe88bbe7d, 0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff,
+    0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e, 0x6935f452,
+    0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b,
+    0x1cd36813, 0x74d044db, 0x27180901, 0x4f1b25c9, 0xf71e5091,
+    0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+    0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898,
+    0x05d66450, 0xbdd31108, 0xd5d03dc0, 0x8618701a, 0xee1b5cd2,
+    0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b,
+    0x9bfdc093, 0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7,
+    0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766, 0x1a438abc,
+    0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5,
+    0x6fa516fd, 0x07a63a35, 0x8fd9098e, 0xe7da2546, 0x5fdf501e,
+    0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+    0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c,
+    0x0c171dc4, 0xb412689c, 0xdc114454, 0x1382f328, 0x7b81dfe0,
+    0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69,
+    0x0e6743a1, 0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23,
+    0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2, 0xb2828a33,
+    0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a,
+    0xc7641672, 0xaf673aba, 0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0,
+    0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+    0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544,
+    0xe33a998c, 0x5b3fecd4, 0x333cc01c, 0x60f48dc6, 0x08f7a10e,
+    0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187,
+    0x7d113d4f},
+   {0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777,
+    0x5dc55c6e, 0x697997b4, 0x8649fcad, 0x6006181f, 0x8f367306,
+    0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab,
+    0xe64fe4b2, 0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4,
+    0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93, 0xa00a2821,
+    0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f,
+    0xc973bf95, 0x2643d48c, 0x85f4168d, 0x6ac47d94, 0x5e78b64e,
+    0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+    0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5,
+    0xb83752fc, 0x8c8b9926, 0x63bbf23f, 0x45f826b3, 0xaac84daa,
+    0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107,
+    0xc3b1da1e, 0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576,
+    0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201, 0x0e045beb,
+    0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785,
+    0x677dcc5f, 0x884da746, 0x6e0243f4, 0x813228ed, 0xb58ee337,
+    0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+    0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2,
+    0x93cd37bb, 0xa771fc61, 0x48419778, 0xae0e73ca, 0x413e18d3,
+    0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e,
+    0x28478f67, 0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc,
+    0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb, 0xebf65579,
+    0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917,
+    0x828fc2cd, 0x6dbfa9d4, 0x4bfc7d58, 0xa4cc1641, 0x9070dd9b,
+    0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+    0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230,
+    0x763f3929, 0x4283f2f3, 0xadb399ea, 0x1c08b7d6, 0xf338dccf,
+    0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062,
+    0x9a414b7b, 0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413,
+    0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364, 0xdc0487e8,
+    0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86,
+    0xb57d105c, 0x5a4d7b45, 0xbc029ff7, 0x5332f4ee, 0x678e3f34,
+    0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+    0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c,
+    0xc439fd35, 0xf08536ef, 0x1fb55df6, 0xf9fab944, 0x16cad25d,
+    0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0,
+    0x7fb345e9, 0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf,
+    0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8, 0x39f6897a,
+    0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514,
+    0x508f1ece, 0xbfbf75d7, 0x120cec3d, 0xfd3c8724, 0xc9804cfe,
+    0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+    0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355,
+    0x2fcfa84c, 0x1b736396, 0xf443088f, 0xd200dc03, 0x3d30b71a,
+    0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7,
+    0x544920ae, 0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6,
+    0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1, 0x97f8fab0,
+    0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de,
+    0xfe816d04, 0x11b1061d, 0xf7fee2af, 0x18ce89b6, 0x2c72426c,
+    0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+    0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9,
+    0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623, 0x37f2d291, 0xd8c2b988,
+    0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525,
+    0xb1bb2e3c},
+   {0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0,
+    0xd854d11c, 0x906761e8, 0xa8760e44, 0xc5670b91, 0xfd76643d,
+    0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79,
+    0x6d1105d5, 0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127,
+    0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97, 0x4a456a42,
+    0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e,
+    0xda220baa, 0xe2336406, 0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f,
+    0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+    0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076,
+    0x069b6fda, 0x4ea8df2e, 0x76b9b082, 0x948ad484, 0xac9bbb28,
+    0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c,
+    0x3cfcdac0, 0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1,
+    0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151, 0x37516aae,
+    0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2,
+    0xa7360b46, 0x9f2764ea, 0xf236613f, 0xca270e93, 0x8214be67,
+    0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+    0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd,
+    0x6027da61, 0x28146a95, 0x10050539, 0x7d1400ec, 0x45056f40,
+    0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104,
+    0xd5620ea8, 0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d,
+    0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd, 0xe99ed468,
+    0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574,
+    0x79f9b580, 0x41e8da2c, 0xa3dbbe2a, 0x9bcad186, 0xd3f96172,
+    0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+    0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b,
+    0xbee864a7, 0xf6dbd453, 0xcecabbff, 0x6ea2d55c, 0x56b3baf0,
+    0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4,
+    0xc6d4db18, 0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39,
+    0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089, 0xe180b48f,
+    0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593,
+    0x71e7d567, 0x49f6bacb, 0x24e7bf1e, 0x1cf6d0b2, 0x54c56046,
+    0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+    0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb,
+    0xad5eb117, 0xe56d01e3, 0xdd7c6e4f, 0xb06d6b9a, 0x887c0436,
+    0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72,
+    0x181b65de, 0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c,
+    0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c, 0x3f4f0a49,
+    0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55,
+    0xaf286ba1, 0x9739040d, 0x59f3bff2, 0x61e2d05e, 0x29d160aa,
+    0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+    0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3,
+    0x44c0657f, 0x0cf3d58b, 0x34e2ba27, 0xd6d1de21, 0xeec0b18d,
+    0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9,
+    0x7ea7d065, 0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544,
+    0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4, 0x425b0aa5,
+    0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9,
+    0xd23c6b4d, 0xea2d04e1, 0x873c0134, 0xbf2d6e98, 0xf71ede6c,
+    0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+    0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6,
+    0x152dba6a, 0x5d1e0a9e, 0x650f6532, 0x081e60e7, 0x300f0f4b,
+    0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f,
+    0xa0686ea3},
+   {0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3,
+    0xa6679b4b, 0xc4451272, 0x1900b8ca, 0xf64463e6, 0x2b01c95e,
+    0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194,
+    0xef44db2c, 0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804,
+    0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7, 0x1f20d2db,
+    0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990,
+    0xdb65c0a9, 0x06206a11, 0xd725148b, 0x0a60be33, 0x6842370a,
+    0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+    0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e,
+    0x8706ec26, 0xe524651f, 0x3861cfa7, 0x3e41a5b6, 0xe3040f0e,
+    0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4,
+    0x27411d7c, 0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69,
+    0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a, 0xaba65fe7,
+    0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac,
+    0x6fe34d95, 0xb2a6e72d, 0x5de23c01, 0x80a796b9, 0xe2851f80,
+    0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+    0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29,
+    0xe4a57591, 0x8687fca8, 0x5bc25610, 0xb4868d3c, 0x69c32784,
+    0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e,
+    0xad8635f6, 0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255,
+    0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6, 0x8ac7288a,
+    0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1,
+    0x4e823af8, 0x93c79040, 0x95e7fa51, 0x48a250e9, 0x2a80d9d0,
+    0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+    0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844,
+    0xc5c402fc, 0xa7e68bc5, 0x7aa3217d, 0x52a0c93f, 0x8fe56387,
+    0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d,
+    0x4ba071f5, 0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0,
+    0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213, 0xbbc47802,
+    0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349,
+    0x7f816a70, 0xa2c4c0c8, 0x4d801be4, 0x90c5b15c, 0xf2e73865,
+    0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+    0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47,
+    0x23e246ff, 0x41c0cfc6, 0x9c85657e, 0x73c1be52, 0xae8414ea,
+    0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20,
+    0x6ac10698, 0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0,
+    0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443, 0x9aa50f6f,
+    0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424,
+    0x5ee01d1d, 0x83a5b7a5, 0xf90696d8, 0x24433c60, 0x4661b559,
+    0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+    0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd,
+    0xa9256e75, 0xcb07e74c, 0x16424df4, 0x106227e5, 0xcd278d5d,
+    0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597,
+    0x09629f2f, 0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a,
+    0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9, 0x2e238253,
+    0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918,
+    0xea669021, 0x37233a99, 0xd867e1b5, 0x05224b0d, 0x6700c234,
+    0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+    0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d,
+    0x6120a825, 0x0302211c, 0xde478ba4, 0x31035088, 0xec46fa30,
+    0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa,
+    0x2803e842},
+   {0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a,
+    0x3b9f3664, 0xd1b1f617, 0x74f06469, 0x38513ec5, 0x9d10acbb,
+    0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2,
+    0x4ca15aac, 0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9,
+    0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3, 0x48f3434f,
+    0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b,
+    0x9942b558, 0x3c032726, 0xe144fb14, 0x4405696a, 0xae2ba919,
+    0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+    0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb,
+    0xe28af3b5, 0x08a433c6, 0xade5a1b8, 0x91e6869e, 0x34a714e0,
+    0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089,
+    0xe516e2f7, 0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828,
+    0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32, 0xc76580d9,
+    0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd,
+    0x16d476ce, 0xb395e4b0, 0xff34be1c, 0x5a752c62, 0xb05bec11,
+    0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+    0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949,
+    0x8c58cb37, 0x66760b44, 0xc337993a, 0x8f96c396, 0x2ad751e8,
+    0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581,
+    0xfb66a7ff, 0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe,
+    0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4, 0x1e704508,
+    0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c,
+    0xcfc1b31f, 0x6a802161, 0x56830647, 0xf3c29439, 0x19ec544a,
+    0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+    0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98,
+    0x554d0ee6, 0xbf63ce95, 0x1a225ceb, 0x8b277743, 0x2e66e53d,
+    0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154,
+    0xffd7132a, 0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5,
+    0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def, 0xfb850ac9,
+    0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad,
+    0x2a34fcde, 0x8f756ea0, 0xc3d4340c, 0x6695a672, 0x8cbb6601,
+    0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+    0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d,
+    0x51fcba33, 0xbbd27a40, 0x1e93e83e, 0x5232b292, 0xf77320ec,
+    0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485,
+    0x26c2d6fb, 0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae,
+    0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4, 0x2290cf18,
+    0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c,
+    0xf321390f, 0x5660ab71, 0x4c42f79a, 0xe90365e4, 0x032da597,
+    0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+    0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45,
+    0x4f8cff3b, 0xa5a23f48, 0x00e3ad36, 0x3ce08a10, 0x99a1186e,
+    0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07,
+    0x4810ee79, 0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6,
+    0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc, 0xad060c8e,
+    0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea,
+    0x7cb7fa99, 0xd9f668e7, 0x9557324b, 0x3016a035, 0xda386046,
+    0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+    0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e,
+    0xe63b4760, 0x0c158713, 0xa954156d, 0xe5f54fc1, 0x40b4ddbf,
+    0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6,
+    0x91052ba8},
+   {0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc,
+    0x5d28f9ab, 0x69cf5132, 0x7a6dc945, 0x9d14c3b8, 0x8eb65bcf,
+    0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a,
+    0xe7790afd, 0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918,
+    0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4, 0xa2d13239,
+    0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92,
+    0xcb1e630b, 0xd8bcfb7c, 0x7f8be302, 0x6c297b75, 0x58ced3ec,
+    0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+    0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166,
+    0xbfb7d911, 0x8b507188, 0x98f2e9ff, 0x404e1283, 0x53ec8af4,
+    0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1,
+    0x3a23dbc6, 0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2,
+    0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e, 0xff17c604,
+    0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf,
+    0x96d89736, 0x857a0f41, 0x620305bc, 0x71a19dcb, 0x45463552,
+    0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+    0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659,
+    0x9dface2e, 0xa91d66b7, 0xbabffec0, 0x5dc6f43d, 0x4e646c4a,
+    0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f,
+    0x27ab3d78, 0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f,
+    0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43, 0x1d88e6be,
+    0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15,
+    0x7447b78c, 0x67e52ffb, 0xbf59d487, 0xacfb4cf0, 0x981ce469,
+    0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+    0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3,
+    0x7f65ee94, 0x4b82460d, 0x5820de7a, 0xfbc3faf9, 0xe861628e,
+    0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb,
+    0x81ae33bc, 0x66d73941, 0x7575a136, 0x419209af, 0x523091d8,
+    0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004, 0xc4060b78,
+    0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3,
+    0xadc95a4a, 0xbe6bc23d, 0x5912c8c0, 0x4ab050b7, 0x7e57f82e,
+    0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+    0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827,
+    0xd960e050, 0xed8748c9, 0xfe25d0be, 0x195cda43, 0x0afe4234,
+    0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71,
+    0x63311306, 0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3,
+    0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f, 0x26992bc2,
+    0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269,
+    0x4f567af0, 0x5cf4e287, 0x04d43cfd, 0x1776a48a, 0x23910c13,
+    0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+    0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99,
+    0xc4e806ee, 0xf00fae77, 0xe3ad3600, 0x3b11cd7c, 0x28b3550b,
+    0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e,
+    0x417c0439, 0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d,
+    0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781, 0x7b5fdfff,
+    0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654,
+    0x12908ecd, 0x013216ba, 0xe64b1c47, 0xf5e98430, 0xc10e2ca9,
+    0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+    0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2,
+    0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b, 0xd98eedc6, 0xca2c75b1,
+    0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4,
+    0xa3e32483},
+   {0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f,
+    0x35f1141c, 0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc,
+    0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27,
+    0x5e133c24, 0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b,
+    0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384, 0x9a879fa0,
+    0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+    0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29,
+    0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e,
+    0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa, 0x30e349b1, 0xc288cab2,
+    0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59,
+    0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+    0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc,
+    0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0,
+    0x67dafa54, 0x95b17957, 0xcba24573, 0x39c9c670, 0x2a993584,
+    0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc,
+    0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+    0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4,
+    0x0f36e6f7, 0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+    0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789, 0xeb1fcbad,
+    0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1,
+    0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e, 0x90a324fa,
+    0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd,
+    0xceb018de, 0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b,
+    0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90,
+    0x563c5f93, 0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+    0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c, 0x92a8fc17,
+    0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+    0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f,
+    0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9,
+    0x97baa1ba, 0x84ea524e, 0x7681d14d, 0x2892ed69, 0xdaf96e6a,
+    0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81,
+    0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+    0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06,
+    0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a,
+    0x1e6dcdee, 0xec064eed, 0xc38d26c4, 0x31e6a5c7, 0x22b65633,
+    0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914,
+    0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+    0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643,
+    0x07198540, 0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+    0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a,
+    0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06,
+    0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6, 0x88d28022,
+    0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a,
+    0xc69f7b69, 0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9,
+    0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052,
+    0xad7d5351}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0x03836bf200000000, 0xf7703be100000000,
+    0xf4f3501300000000, 0x1f979ac700000000, 0x1c14f13500000000,
+    0xe8e7a12600000000, 0xeb64cad400000000, 0xcf58d98a00000000,
+    0xccdbb27800000000, 0x3828e26b00000000, 0x3bab899900000000,
+    0xd0cf434d00000000, 0xd34c28bf00000000, 0x27bf78ac00000000,
+    0x243c135e00000000, 0x6fc75e1000000000, 0x6c4435e200000000,
+    0x98b765f100000000, 0x9b340e0300000000, 0x7050c4d700000000,
+    0x73d3af2500000000, 0x8720ff3600000000, 0x84a394c400000000,
+    0xa09f879a00000000, 0xa31cec6800000000, 0x57efbc7b00000000,
+    0x546cd78900000000, 0xbf081d5d00000000, 0xbc8b76af00000000,
+    0x487826bc00000000, 0x4bfb4d4e00000000, 0xde8ebd2000000000,
+    0xdd0dd6d200000000, 0x29fe86c100000000, 0x2a7ded3300000000,
+    0xc11927e700000000, 0xc29a4c1500000000, 0x36691c0600000000,
+    0x35ea77f400000000, 0x11d664aa00000000, 0x12550f5800000000,
+    0xe6a65f4b00000000, 0xe52534b900000000, 0x0e41fe6d00000000,
+    0x0dc2959f00000000, 0xf931c58c00000000, 0xfab2ae7e00000000,
+    0xb149e33000000000, 0xb2ca88c200000000, 0x4639d8d100000000,
+    0x45bab32300000000, 0xaede79f700000000, 0xad5d120500000000,
+    0x59ae421600000000, 0x5a2d29e400000000, 0x7e113aba00000000,
+    0x7d92514800000000, 0x8961015b00000000, 0x8ae26aa900000000,
+    0x6186a07d00000000, 0x6205cb8f00000000, 0x96f69b9c00000000,
+    0x9575f06e00000000, 0xbc1d7b4100000000, 0xbf9e10b300000000,
+    0x4b6d40a000000000, 0x48ee2b5200000000, 0xa38ae18600000000,
+    0xa0098a7400000000, 0x54fada6700000000, 0x5779b19500000000,
+    0x7345a2cb00000000, 0x70c6c93900000000, 0x8435992a00000000,
+    0x87b6f2d800000000, 0x6cd2380c00000000, 0x6f5153fe00000000,
+    0x9ba203ed00000000, 0x9821681f00000000, 0xd3da255100000000,
+    0xd0594ea300000000, 0x24aa1eb000000000, 0x2729754200000000,
+    0xcc4dbf9600000000, 0xcfced46400000000, 0x3b3d847700000000,
+    0x38beef8500000000, 0x1c82fcdb00000000, 0x1f01972900000000,
+    0xebf2c73a00000000, 0xe871acc800000000, 0x0315661c00000000,
+    0x00960dee00000000, 0xf4655dfd00000000, 0xf7e6360f00000000,
+    0x6293c66100000000, 0x6110ad9300000000, 0x95e3fd8000000000,
+    0x9660967200000000, 0x7d045ca600000000, 0x7e87375400000000,
+    0x8a74674700000000, 0x89f70cb500000000, 0xadcb1feb00000000,
+    0xae48741900000000, 0x5abb240a00000000, 0x59384ff800000000,
+    0xb25c852c00000000, 0xb1dfeede00000000, 0x452cbecd00000000,
+    0x46afd53f00000000, 0x0d54987100000000, 0x0ed7f38300000000,
+    0xfa24a39000000000, 0xf9a7c86200000000, 0x12c302b600000000,
+    0x1140694400000000, 0xe5b3395700000000, 0xe63052a500000000,
+    0xc20c41fb00000000, 0xc18f2a0900000000, 0x357c7a1a00000000,
+    0x36ff11e800000000, 0xdd9bdb3c00000000, 0xde18b0ce00000000,
+    0x2aebe0dd00000000, 0x29688b2f00000000, 0x783bf68200000000,
+    0x7bb89d7000000000, 0x8f4bcd6300000000, 0x8cc8a69100000000,
+    0x67ac6c4500000000, 0x642f07b700000000, 0x90dc57a400000000,
+    0x935f3c5600000000, 0xb7632f0800000000, 0xb4e044fa00000000,
+    0x401314e900000000, 0x43907f1b00000000, 0xa8f4b5cf00000000,
+    0xab77de3d00000000, 0x5f848e2e00000000, 0x5c07e5dc00000000,
+    0x17fca89200000000, 0x147fc36000000000, 0xe08c937300000000,
+    0xe30ff88100000000, 0x086b325500000000, 0x0be859a700000000,
+    0xff1b09b400000000, 0xfc98624600000000, 0xd8a4711800000000,
+    0xdb271aea00000000, 0x2fd44af900000000, 0x2c57210b00000000,
+    0xc733ebdf00000000, 0xc4b0802d00000000, 0x3043d03e00000000,
+    0x33c0bbcc00000000, 0xa6b54ba200000000, 0xa536205000000000,
+    0x51c5704300000000, 0x52461bb100000000, 0xb922d16500000000,
+    0xbaa1ba9700000000, 0x4e52ea8400000000, 0x4dd1817600000000,
+    0x69ed922800000000, 0x6a6ef9da00000000, 0x9e9da9c900000000,
+    0x9d1ec23b00000000, 0x767a08ef00000000, 0x75f9631d00000000,
+    0x810a330e00000000, 0x828958fc00000000, 0xc97215b200000000,
+    0xcaf17e4000000000, 0x3e022e5300000000, 0x3d8145a100000000,
+    0xd6e58f7500000000, 0xd566e48700000000, 0x2195b49400000000,
+    0x2216df6600000000, 0x062acc3800000000, 0x05a9a7ca00000000,
+    0xf15af7d900000000, 0xf2d99c2b00000000, 0x19bd56ff00000000,
+    0x1a3e3d0d00000000, 0xeecd6d1e00000000, 0xed4e06ec00000000,
+    0xc4268dc300000000, 0xc7a5e63100000000, 0x3356b62200000000,
+    0x30d5ddd000000000, 0xdbb1170400000000, 0xd8327cf600000000,
+    0x2cc12ce500000000, 0x2f42471700000000, 0x0b7e544900000000,
+    0x08fd3fbb00000000, 0xfc0e6fa800000000, 0xff8d045a00000000,
+    0x14e9ce8e00000000, 0x176aa57c00000000, 0xe399f56f00000000,
+    0xe01a9e9d00000000, 0xabe1d3d300000000, 0xa862b82100000000,
+    0x5c91e83200000000, 0x5f1283c000000000, 0xb476491400000000,
+    0xb7f522e600000000, 0x430672f500000000, 0x4085190700000000,
+    0x64b90a5900000000, 0x673a61ab00000000, 0x93c931b800000000,
+    0x904a5a4a00000000, 0x7b2e909e00000000, 0x78adfb6c00000000,
+    0x8c5eab7f00000000, 0x8fddc08d00000000, 0x1aa830e300000000,
+    0x192b5b1100000000, 0xedd80b0200000000, 0xee5b60f000000000,
+    0x053faa2400000000, 0x06bcc1d600000000, 0xf24f91c500000000,
+    0xf1ccfa3700000000, 0xd5f0e96900000000, 0xd673829b00000000,
+    0x2280d28800000000, 0x2103b97a00000000, 0xca6773ae00000000,
+    0xc9e4185c00000000, 0x3d17484f00000000, 0x3e9423bd00000000,
+    0x756f6ef300000000, 0x76ec050100000000, 0x821f551200000000,
+    0x819c3ee000000000, 0x6af8f43400000000, 0x697b9fc600000000,
+    0x9d88cfd500000000, 0x9e0ba42700000000, 0xba37b77900000000,
+    0xb9b4dc8b00000000, 0x4d478c9800000000, 0x4ec4e76a00000000,
+    0xa5a02dbe00000000, 0xa623464c00000000, 0x52d0165f00000000,
+    0x51537dad00000000},
+   {0x0000000000000000, 0x7798a21300000000, 0xee30452700000000,
+    0x99a8e73400000000, 0xdc618a4e00000000, 0xabf9285d00000000,
+    0x3251cf6900000000, 0x45c96d7a00000000, 0xb8c3149d00000000,
+    0xcf5bb68e00000000, 0x56f351ba00000000, 0x216bf3a900000000,
+    0x64a29ed300000000, 0x133a3cc000000000, 0x8a92dbf400000000,
+    0xfd0a79e700000000, 0x81f1c53f00000000, 0xf669672c00000000,
+    0x6fc1801800000000, 0x1859220b00000000, 0x5d904f7100000000,
+    0x2a08ed6200000000, 0xb3a00a5600000000, 0xc438a84500000000,
+    0x3932d1a200000000, 0x4eaa73b100000000, 0xd702948500000000,
+    0xa09a369600000000, 0xe5535bec00000000, 0x92cbf9ff00000000,
+    0x0b631ecb00000000, 0x7cfbbcd800000000, 0x02e38b7f00000000,
+    0x757b296c00000000, 0xecd3ce5800000000, 0x9b4b6c4b00000000,
+    0xde82013100000000, 0xa91aa32200000000, 0x30b2441600000000,
+    0x472ae60500000000, 0xba209fe200000000, 0xcdb83df100000000,
+    0x5410dac500000000, 0x238878d600000000, 0x664115ac00000000,
+    0x11d9b7bf00000000, 0x8871508b00000000, 0xffe9f29800000000,
+    0x83124e4000000000, 0xf48aec5300000000, 0x6d220b6700000000,
+    0x1abaa97400000000, 0x5f73c40e00000000, 0x28eb661d00000000,
+    0xb143812900000000, 0xc6db233a00000000, 0x3bd15add00000000,
+    0x4c49f8ce00000000, 0xd5e11ffa00000000, 0xa279bde900000000,
+    0xe7b0d09300000000, 0x9028728000000000, 0x098095b400000000,
+    0x7e1837a700000000, 0x04c617ff00000000, 0x735eb5ec00000000,
+    0xeaf652d800000000, 0x9d6ef0cb00000000, 0xd8a79db100000000,
+    0xaf3f3fa200000000, 0x3697d89600000000, 0x410f7a8500000000,
+    0xbc05036200000000, 0xcb9da17100000000, 0x5235464500000000,
+    0x25ade45600000000, 0x6064892c00000000, 0x17fc2b3f00000000,
+    0x8e54cc0b00000000, 0xf9cc6e1800000000, 0x8537d2c000000000,
+    0xf2af70d300000000, 0x6b0797e700000000, 0x1c9f35f400000000,
+    0x5956588e00000000, 0x2ecefa9d00000000, 0xb7661da900000000,
+    0xc0febfba00000000, 0x3df4c65d00000000, 0x4a6c644e00000000,
+    0xd3c4837a00000000, 0xa45c216900000000, 0xe1954c1300000000,
+    0x960dee0000000000, 0x0fa5093400000000, 0x783dab2700000000,
+    0x06259c8000000000, 0x71bd3e9300000000, 0xe815d9a700000000,
+    0x9f8d7bb400000000, 0xda4416ce00000000, 0xaddcb4dd00000000,
+    0x347453e900000000, 0x43ecf1fa00000000, 0xbee6881d00000000,
+    0xc97e2a0e00000000, 0x50d6cd3a00000000, 0x274e6f2900000000,
+    0x6287025300000000, 0x151fa04000000000, 0x8cb7477400000000,
+    0xfb2fe56700000000, 0x87d459bf00000000, 0xf04cfbac00000000,
+    0x69e41c9800000000, 0x1e7cbe8b00000000, 0x5bb5d3f100000000,
+    0x2c2d71e200000000, 0xb58596d600000000, 0xc21d34c500000000,
+    0x3f174d2200000000, 0x488fef3100000000, 0xd127080500000000,
+    0xa6bfaa1600000000, 0xe376c76c00000000, 0x94ee657f00000000,
+    0x0d46824b00000000, 0x7ade205800000000, 0xf9fac3fb00000000,
+    0x8e6261e800000000, 0x17ca86dc00000000, 0x605224cf00000000,
+    0x259b49b500000000, 0x5203eba600000000, 0xcbab0c9200000000,
+    0xbc33ae8100000000, 0x4139d76600000000, 0x36a1757500000000,
+    0xaf09924100000000, 0xd891305200000000, 0x9d585d2800000000,
+    0xeac0ff3b00000000, 0x7368180f00000000, 0x04f0ba1c00000000,
+    0x780b06c400000000, 0x0f93a4d700000000, 0x963b43e300000000,
+    0xe1a3e1f000000000, 0xa46a8c8a00000000, 0xd3f22e9900000000,
+    0x4a5ac9ad00000000, 0x3dc26bbe00000000, 0xc0c8125900000000,
+    0xb750b04a00000000, 0x2ef8577e00000000, 0x5960f56d00000000,
+    0x1ca9981700000000, 0x6b313a0400000000, 0xf299dd3000000000,
+    0x85017f2300000000, 0xfb19488400000000, 0x8c81ea9700000000,
+    0x15290da300000000, 0x62b1afb000000000, 0x2778c2ca00000000,
+    0x50e060d900000000, 0xc94887ed00000000, 0xbed025fe00000000,
+    0x43da5c1900000000, 0x3442fe0a00000000, 0xadea193e00000000,
+    0xda72bb2d00000000, 0x9fbbd65700000000, 0xe823744400000000,
+    0x718b937000000000, 0x0613316300000000, 0x7ae88dbb00000000,
+    0x0d702fa800000000, 0x94d8c89c00000000, 0xe3406a8f00000000,
+    0xa68907f500000000, 0xd111a5e600000000, 0x48b942d200000000,
+    0x3f21e0c100000000, 0xc22b992600000000, 0xb5b33b3500000000,
+    0x2c1bdc0100000000, 0x5b837e1200000000, 0x1e4a136800000000,
+    0x69d2b17b00000000, 0xf07a564f00000000, 0x87e2f45c00000000,
+    0xfd3cd40400000000, 0x8aa4761700000000, 0x130c912300000000,
+    0x6494333000000000, 0x215d5e4a00000000, 0x56c5fc5900000000,
+    0xcf6d1b6d00000000, 0xb8f5b97e00000000, 0x45ffc09900000000,
+    0x3267628a00000000, 0xabcf85be00000000, 0xdc5727ad00000000,
+    0x999e4ad700000000, 0xee06e8c400000000, 0x77ae0ff000000000,
+    0x0036ade300000000, 0x7ccd113b00000000, 0x0b55b32800000000,
+    0x92fd541c00000000, 0xe565f60f00000000, 0xa0ac9b7500000000,
+    0xd734396600000000, 0x4e9cde5200000000, 0x39047c4100000000,
+    0xc40e05a600000000, 0xb396a7b500000000, 0x2a3e408100000000,
+    0x5da6e29200000000, 0x186f8fe800000000, 0x6ff72dfb00000000,
+    0xf65fcacf00000000, 0x81c768dc00000000, 0xffdf5f7b00000000,
+    0x8847fd6800000000, 0x11ef1a5c00000000, 0x6677b84f00000000,
+    0x23bed53500000000, 0x5426772600000000, 0xcd8e901200000000,
+    0xba16320100000000, 0x471c4be600000000, 0x3084e9f500000000,
+    0xa92c0ec100000000, 0xdeb4acd200000000, 0x9b7dc1a800000000,
+    0xece563bb00000000, 0x754d848f00000000, 0x02d5269c00000000,
+    0x7e2e9a4400000000, 0x09b6385700000000, 0x901edf6300000000,
+    0xe7867d7000000000, 0xa24f100a00000000, 0xd5d7b21900000000,
+    0x4c7f552d00000000, 0x3be7f73e00000000, 0xc6ed8ed900000000,
+    0xb1752cca00000000, 0x28ddcbfe00000000, 0x5f4569ed00000000,
+    0x1a8c049700000000, 0x6d14a68400000000, 0xf4bc41b000000000,
+    0x8324e3a300000000},
+   {0x0000000000000000, 0x7e9241a500000000, 0x0d526f4f00000000,
+    0x73c02eea00000000, 0x1aa4de9e00000000, 0x64369f3b00000000,
+    0x17f6b1d100000000, 0x6964f07400000000, 0xc53e513800000000,
+    0xbbac109d00000000, 0xc86c3e7700000000, 0xb6fe7fd200000000,
+    0xdf9a8fa600000000, 0xa108ce0300000000, 0xd2c8e0e900000000,
+    0xac5aa14c00000000, 0x8a7da27000000000, 0xf4efe3d500000000,
+    0x872fcd3f00000000, 0xf9bd8c9a00000000, 0x90d97cee00000000,
+    0xee4b3d4b00000000, 0x9d8b13a100000000, 0xe319520400000000,
+    0x4f43f34800000000, 0x31d1b2ed00000000, 0x42119c0700000000,
+    0x3c83dda200000000, 0x55e72dd600000000, 0x2b756c7300000000,
+    0x58b5429900000000, 0x2627033c00000000, 0x14fb44e100000000,
+    0x6a69054400000000, 0x19a92bae00000000, 0x673b6a0b00000000,
+    0x0e5f9a7f00000000, 0x70cddbda00000000, 0x030df53000000000,
+    0x7d9fb49500000000, 0xd1c515d900000000, 0xaf57547c00000000,
+    0xdc977a9600000000, 0xa2053b3300000000, 0xcb61cb4700000000,
+    0xb5f38ae200000000, 0xc633a40800000000, 0xb8a1e5ad00000000,
+    0x9e86e69100000000, 0xe014a73400000000, 0x93d489de00000000,
+    0xed46c87b00000000, 0x8422380f00000000, 0xfab079aa00000000,
+    0x8970574000000000, 0xf7e216e500000000, 0x5bb8b7a900000000,
+    0x252af60c00000000, 0x56ead8e600000000, 0x2878994300000000,
+    0x411c693700000000, 0x3f8e289200000000, 0x4c4e067800000000,
+    0x32dc47dd00000000, 0xd98065c700000000, 0xa712246200000000,
+    0xd4d20a8800000000, 0xaa404b2d00000000, 0xc324bb5900000000,
+    0xbdb6fafc00000000, 0xce76d41600000000, 0xb0e495b300000000,
+    0x1cbe34ff00000000, 0x622c755a00000000, 0x11ec5bb000000000,
+    0x6f7e1a1500000000, 0x061aea6100000000, 0x7888abc400000000,
+    0x0b48852e00000000, 0x75dac48b00000000, 0x53fdc7b700000000,
+    0x2d6f861200000000, 0x5eafa8f800000000, 0x203de95d00000000,
+    0x4959192900000000, 0x37cb588c00000000, 0x440b766600000000,
+    0x3a9937c300000000, 0x96c3968f00000000, 0xe851d72a00000000,
+    0x9b91f9c000000000, 0xe503b86500000000, 0x8c67481100000000,
+    0xf2f509b400000000, 0x8135275e00000000, 0xffa766fb00000000,
+    0xcd7b212600000000, 0xb3e9608300000000, 0xc0294e6900000000,
+    0xbebb0fcc00000000, 0xd7dfffb800000000, 0xa94dbe1d00000000,
+    0xda8d90f700000000, 0xa41fd15200000000, 0x0845701e00000000,
+    0x76d731bb00000000, 0x05171f5100000000, 0x7b855ef400000000,
+    0x12e1ae8000000000, 0x6c73ef2500000000, 0x1fb3c1cf00000000,
+    0x6121806a00000000, 0x4706835600000000, 0x3994c2f300000000,
+    0x4a54ec1900000000, 0x34c6adbc00000000, 0x5da25dc800000000,
+    0x23301c6d00000000, 0x50f0328700000000, 0x2e62732200000000,
+    0x8238d26e00000000, 0xfcaa93cb00000000, 0x8f6abd2100000000,
+    0xf1f8fc8400000000, 0x989c0cf000000000, 0xe60e4d5500000000,
+    0x95ce63bf00000000, 0xeb5c221a00000000, 0x4377278b00000000,
+    0x3de5662e00000000, 0x4e2548c400000000, 0x30b7096100000000,
+    0x59d3f91500000000, 0x2741b8b000000000, 0x5481965a00000000,
+    0x2a13d7ff00000000, 0x864976b300000000, 0xf8db371600000000,
+    0x8b1b19fc00000000, 0xf589585900000000, 0x9ceda82d00000000,
+    0xe27fe98800000000, 0x91bfc76200000000, 0xef2d86c700000000,
+    0xc90a85fb00000000, 0xb798c45e00000000, 0xc458eab400000000,
+    0xbacaab1100000000, 0xd3ae5b6500000000, 0xad3c1ac000000000,
+    0xdefc342a00000000, 0xa06e758f00000000, 0x0c34d4c300000000,
+    0x72a6956600000000, 0x0166bb8c00000000, 0x7ff4fa2900000000,
+    0x16900a5d00000000, 0x68024bf800000000, 0x1bc2651200000000,
+    0x655024b700000000, 0x578c636a00000000, 0x291e22cf00000000,
+    0x5ade0c2500000000, 0x244c4d8000000000, 0x4d28bdf400000000,
+    0x33bafc5100000000, 0x407ad2bb00000000, 0x3ee8931e00000000,
+    0x92b2325200000000, 0xec2073f700000000, 0x9fe05d1d00000000,
+    0xe1721cb800000000, 0x8816eccc00000000, 0xf684ad6900000000,
+    0x8544838300000000, 0xfbd6c22600000000, 0xddf1c11a00000000,
+    0xa36380bf00000000, 0xd0a3ae5500000000, 0xae31eff000000000,
+    0xc7551f8400000000, 0xb9c75e2100000000, 0xca0770cb00000000,
+    0xb495316e00000000, 0x18cf902200000000, 0x665dd18700000000,
+    0x159dff6d00000000, 0x6b0fbec800000000, 0x026b4ebc00000000,
+    0x7cf90f1900000000, 0x0f3921f300000000, 0x71ab605600000000,
+    0x9af7424c00000000, 0xe46503e900000000, 0x97a52d0300000000,
+    0xe9376ca600000000, 0x80539cd200000000, 0xfec1dd7700000000,
+    0x8d01f39d00000000, 0xf393b23800000000, 0x5fc9137400000000,
+    0x215b52d100000000, 0x529b7c3b00000000, 0x2c093d9e00000000,
+    0x456dcdea00000000, 0x3bff8c4f00000000, 0x483fa2a500000000,
+    0x36ade30000000000, 0x108ae03c00000000, 0x6e18a19900000000,
+    0x1dd88f7300000000, 0x634aced600000000, 0x0a2e3ea200000000,
+    0x74bc7f0700000000, 0x077c51ed00000000, 0x79ee104800000000,
+    0xd5b4b10400000000, 0xab26f0a100000000, 0xd8e6de4b00000000,
+    0xa6749fee00000000, 0xcf106f9a00000000, 0xb1822e3f00000000,
+    0xc24200d500000000, 0xbcd0417000000000, 0x8e0c06ad00000000,
+    0xf09e470800000000, 0x835e69e200000000, 0xfdcc284700000000,
+    0x94a8d83300000000, 0xea3a999600000000, 0x99fab77c00000000,
+    0xe768f6d900000000, 0x4b32579500000000, 0x35a0163000000000,
+    0x466038da00000000, 0x38f2797f00000000, 0x5196890b00000000,
+    0x2f04c8ae00000000, 0x5cc4e64400000000, 0x2256a7e100000000,
+    0x0471a4dd00000000, 0x7ae3e57800000000, 0x0923cb9200000000,
+    0x77b18a3700000000, 0x1ed57a4300000000, 0x60473be600000000,
+    0x1387150c00000000, 0x6d1554a900000000, 0xc14ff5e500000000,
+    0xbfddb44000000000, 0xcc1d9aaa00000000, 0xb28fdb0f00000000,
+    0xdbeb2b7b00000000, 0xa5796ade00000000, 0xd6b9443400000000,
+    0xa82b059100000000},
+   {0x0000000000000000, 0xb8aa45dd00000000, 0x812367bf00000000,
+    0x3989226200000000, 0xf331227b00000000, 0x4b9b67a600000000,
+    0x721245c400000000, 0xcab8001900000000, 0xe66344f600000000,
+    0x5ec9012b00000000, 0x6740234900000000, 0xdfea669400000000,
+    0x1552668d00000000, 0xadf8235000000000, 0x9471013200000000,
+    0x2cdb44ef00000000, 0x3db164e900000000, 0x851b213400000000,
+    0xbc92035600000000, 0x0438468b00000000, 0xce80469200000000,
+    0x762a034f00000000, 0x4fa3212d00000000, 0xf70964f000000000,
+    0xdbd2201f00000000, 0x637865c200000000, 0x5af147a000000000,
+    0xe25b027d00000000, 0x28e3026400000000, 0x904947b900000000,
+    0xa9c065db00000000, 0x116a200600000000, 0x8b1425d700000000,
+    0x33be600a00000000, 0x0a37426800000000, 0xb29d07b500000000,
+    0x782507ac00000000, 0xc08f427100000000, 0xf906601300000000,
+    0x41ac25ce00000000, 0x6d77612100000000, 0xd5dd24fc00000000,
+    0xec54069e00000000, 0x54fe434300000000, 0x9e46435a00000000,
+    0x26ec068700000000, 0x1f6524e500000000, 0xa7cf613800000000,
+    0xb6a5413e00000000, 0x0e0f04e300000000, 0x3786268100000000,
+    0x8f2c635c00000000, 0x4594634500000000, 0xfd3e269800000000,
+    0xc4b704fa00000000, 0x7c1d412700000000, 0x50c605c800000000,
+    0xe86c401500000000, 0xd1e5627700000000, 0x694f27aa00000000,
+    0xa3f727b300000000, 0x1b5d626e00000000, 0x22d4400c00000000,
+    0x9a7e05d100000000, 0xe75fa6ab00000000, 0x5ff5e37600000000,
+    0x667cc11400000000, 0xded684c900000000, 0x146e84d000000000,
+    0xacc4c10d00000000, 0x954de36f00000000, 0x2de7a6b200000000,
+    0x013ce25d00000000, 0xb996a78000000000, 0x801f85e200000000,
+    0x38b5c03f00000000, 0xf20dc02600000000, 0x4aa785fb00000000,
+    0x732ea79900000000, 0xcb84e24400000000, 0xdaeec24200000000,
+    0x6244879f00000000, 0x5bcda5fd00000000, 0xe367e02000000000,
+    0x29dfe03900000000, 0x9175a5e400000000, 0xa8fc878600000000,
+    0x1056c25b00000000, 0x3c8d86b400000000, 0x8427c36900000000,
+    0xbdaee10b00000000, 0x0504a4d600000000, 0xcfbca4cf00000000,
+    0x7716e11200000000, 0x4e9fc37000000000, 0xf63586ad00000000,
+    0x6c4b837c00000000, 0xd4e1c6a100000000, 0xed68e4c300000000,
+    0x55c2a11e00000000, 0x9f7aa10700000000, 0x27d0e4da00000000,
+    0x1e59c6b800000000, 0xa6f3836500000000, 0x8a28c78a00000000,
+    0x3282825700000000, 0x0b0ba03500000000, 0xb3a1e5e800000000,
+    0x7919e5f100000000, 0xc1b3a02c00000000, 0xf83a824e00000000,
+    0x4090c79300000000, 0x51fae79500000000, 0xe950a24800000000,
+    0xd0d9802a00000000, 0x6873c5f700000000, 0xa2cbc5ee00000000,
+    0x1a61803300000000, 0x23e8a25100000000, 0x9b42e78c00000000,
+    0xb799a36300000000, 0x0f33e6be00000000, 0x36bac4dc00000000,
+    0x8e10810100000000, 0x44a8811800000000, 0xfc02c4c500000000,
+    0xc58be6a700000000, 0x7d21a37a00000000, 0x3fc9a05200000000,
+    0x8763e58f00000000, 0xbeeac7ed00000000, 0x0640823000000000,
+    0xccf8822900000000, 0x7452c7f400000000, 0x4ddbe59600000000,
+    0xf571a04b00000000, 0xd9aae4a400000000, 0x6100a17900000000,
+    0x5889831b00000000, 0xe023c6c600000000, 0x2a9bc6df00000000,
+    0x9231830200000000, 0xabb8a16000000000, 0x1312e4bd00000000,
+    0x0278c4bb00000000, 0xbad2816600000000, 0x835ba30400000000,
+    0x3bf1e6d900000000, 0xf149e6c000000000, 0x49e3a31d00000000,
+    0x706a817f00000000, 0xc8c0c4a200000000, 0xe41b804d00000000,
+    0x5cb1c59000000000, 0x6538e7f200000000, 0xdd92a22f00000000,
+    0x172aa23600000000, 0xaf80e7eb00000000, 0x9609c58900000000,
+    0x2ea3805400000000, 0xb4dd858500000000, 0x0c77c05800000000,
+    0x35fee23a00000000, 0x8d54a7e700000000, 0x47eca7fe00000000,
+    0xff46e22300000000, 0xc6cfc04100000000, 0x7e65859c00000000,
+    0x52bec17300000000, 0xea1484ae00000000, 0xd39da6cc00000000,
+    0x6b37e31100000000, 0xa18fe30800000000, 0x1925a6d500000000,
+    0x20ac84b700000000, 0x9806c16a00000000, 0x896ce16c00000000,
+    0x31c6a4b100000000, 0x084f86d300000000, 0xb0e5c30e00000000,
+    0x7a5dc31700000000, 0xc2f786ca00000000, 0xfb7ea4a800000000,
+    0x43d4e17500000000, 0x6f0fa59a00000000, 0xd7a5e04700000000,
+    0xee2cc22500000000, 0x568687f800000000, 0x9c3e87e100000000,
+    0x2494c23c00000000, 0x1d1de05e00000000, 0xa5b7a58300000000,
+    0xd89606f900000000, 0x603c432400000000, 0x59b5614600000000,
+    0xe11f249b00000000, 0x2ba7248200000000, 0x930d615f00000000,
+    0xaa84433d00000000, 0x122e06e000000000, 0x3ef5420f00000000,
+    0x865f07d200000000, 0xbfd625b000000000, 0x077c606d00000000,
+    0xcdc4607400000000, 0x756e25a900000000, 0x4ce707cb00000000,
+    0xf44d421600000000, 0xe527621000000000, 0x5d8d27cd00000000,
+    0x640405af00000000, 0xdcae407200000000, 0x1616406b00000000,
+    0xaebc05b600000000, 0x973527d400000000, 0x2f9f620900000000,
+    0x034426e600000000, 0xbbee633b00000000, 0x8267415900000000,
+    0x3acd048400000000, 0xf075049d00000000, 0x48df414000000000,
+    0x7156632200000000, 0xc9fc26ff00000000, 0x5382232e00000000,
+    0xeb2866f300000000, 0xd2a1449100000000, 0x6a0b014c00000000,
+    0xa0b3015500000000, 0x1819448800000000, 0x219066ea00000000,
+    0x993a233700000000, 0xb5e167d800000000, 0x0d4b220500000000,
+    0x34c2006700000000, 0x8c6845ba00000000, 0x46d045a300000000,
+    0xfe7a007e00000000, 0xc7f3221c00000000, 0x7f5967c100000000,
+    0x6e3347c700000000, 0xd699021a00000000, 0xef10207800000000,
+    0x57ba65a500000000, 0x9d0265bc00000000, 0x25a8206100000000,
+    0x1c21020300000000, 0xa48b47de00000000, 0x8850033100000000,
+    0x30fa46ec00000000, 0x0973648e00000000, 0xb1d9215300000000,
+    0x7b61214a00000000, 0xc3cb649700000000, 0xfa4246f500000000,
+    0x42e8032800000000},
+   {0x0000000000000000, 0xac6f113800000000, 0x58df227000000000,
+    0xf4b0334800000000, 0xb0be45e000000000, 0x1cd154d800000000,
+    0xe861679000000000, 0x440e76a800000000, 0x910b67c500000000,
+    0x3d6476fd00000000, 0xc9d445b500000000, 0x65bb548d00000000,
+    0x21b5222500000000, 0x8dda331d00000000, 0x796a005500000000,
+    0xd505116d00000000, 0xd361228f00000000, 0x7f0e33b700000000,
+    0x8bbe00ff00000000, 0x27d111c700000000, 0x63df676f00000000,
+    0xcfb0765700000000, 0x3b00451f00000000, 0x976f542700000000,
+    0x426a454a00000000, 0xee05547200000000, 0x1ab5673a00000000,
+    0xb6da760200000000, 0xf2d400aa00000000, 0x5ebb119200000000,
+    0xaa0b22da00000000, 0x066433e200000000, 0x57b5a81b00000000,
+    0xfbdab92300000000, 0x0f6a8a6b00000000, 0xa3059b5300000000,
+    0xe70bedfb00000000, 0x4b64fcc300000000, 0xbfd4cf8b00000000,
+    0x13bbdeb300000000, 0xc6becfde00000000, 0x6ad1dee600000000,
+    0x9e61edae00000000, 0x320efc9600000000, 0x76008a3e00000000,
+    0xda6f9b0600000000, 0x2edfa84e00000000, 0x82b0b97600000000,
+    0x84d48a9400000000, 0x28bb9bac00000000, 0xdc0ba8e400000000,
+    0x7064b9dc00000000, 0x346acf7400000000, 0x9805de4c00000000,
+    0x6cb5ed0400000000, 0xc0dafc3c00000000, 0x15dfed5100000000,
+    0xb9b0fc6900000000, 0x4d00cf2100000000, 0xe16fde1900000000,
+    0xa561a8b100000000, 0x090eb98900000000, 0xfdbe8ac100000000,
+    0x51d19bf900000000, 0xae6a513700000000, 0x0205400f00000000,
+    0xf6b5734700000000, 0x5ada627f00000000, 0x1ed414d700000000,
+    0xb2bb05ef00000000, 0x460b36a700000000, 0xea64279f00000000,
+    0x3f6136f200000000, 0x930e27ca00000000, 0x67be148200000000,
+    0xcbd105ba00000000, 0x8fdf731200000000, 0x23b0622a00000000,
+    0xd700516200000000, 0x7b6f405a00000000, 0x7d0b73b800000000,
+    0xd164628000000000, 0x25d451c800000000, 0x89bb40f000000000,
+    0xcdb5365800000000, 0x61da276000000000, 0x956a142800000000,
+    0x3905051000000000, 0xec00147d00000000, 0x406f054500000000,
+    0xb4df360d00000000, 0x18b0273500000000, 0x5cbe519d00000000,
+    0xf0d140a500000000, 0x046173ed00000000, 0xa80e62d500000000,
+    0xf9dff92c00000000, 0x55b0e81400000000, 0xa100db5c00000000,
+    0x0d6fca6400000000, 0x4961bccc00000000, 0xe50eadf400000000,
+    0x11be9ebc00000000, 0xbdd18f8400000000, 0x68d49ee900000000,
+    0xc4bb8fd100000000, 0x300bbc9900000000, 0x9c64ada100000000,
+    0xd86adb0900000000, 0x7405ca3100000000, 0x80b5f97900000000,
+    0x2cdae84100000000, 0x2abedba300000000, 0x86d1ca9b00000000,
+    0x7261f9d300000000, 0xde0ee8eb00000000, 0x9a009e4300000000,
+    0x366f8f7b00000000, 0xc2dfbc3300000000, 0x6eb0ad0b00000000,
+    0xbbb5bc6600000000, 0x17daad5e00000000, 0xe36a9e1600000000,
+    0x4f058f2e00000000, 0x0b0bf98600000000, 0xa764e8be00000000,
+    0x53d4dbf600000000, 0xffbbcace00000000, 0x5cd5a26e00000000,
+    0xf0bab35600000000, 0x040a801e00000000, 0xa865912600000000,
+    0xec6be78e00000000, 0x4004f6b600000000, 0xb4b4c5fe00000000,
+    0x18dbd4c600000000, 0xcddec5ab00000000, 0x61b1d49300000000,
+    0x9501e7db00000000, 0x396ef6e300000000, 0x7d60804b00000000,
+    0xd10f917300000000, 0x25bfa23b00000000, 0x89d0b30300000000,
+    0x8fb480e100000000, 0x23db91d900000000, 0xd76ba29100000000,
+    0x7b04b3a900000000, 0x3f0ac50100000000, 0x9365d43900000000,
+    0x67d5e77100000000, 0xcbbaf64900000000, 0x1ebfe72400000000,
+    0xb2d0f61c00000000, 0x4660c55400000000, 0xea0fd46c00000000,
+    0xae01a2c400000000, 0x026eb3fc00000000, 0xf6de80b400000000,
+    0x5ab1918c00000000, 0x0b600a7500000000, 0xa70f1b4d00000000,
+    0x53bf280500000000, 0xffd0393d00000000, 0xbbde4f9500000000,
+    0x17b15ead00000000, 0xe3016de500000000, 0x4f6e7cdd00000000,
+    0x9a6b6db000000000, 0x36047c8800000000, 0xc2b44fc000000000,
+    0x6edb5ef800000000, 0x2ad5285000000000, 0x86ba396800000000,
+    0x720a0a2000000000, 0xde651b1800000000, 0xd80128fa00000000,
+    0x746e39c200000000, 0x80de0a8a00000000, 0x2cb11bb200000000,
+    0x68bf6d1a00000000, 0xc4d07c2200000000, 0x30604f6a00000000,
+    0x9c0f5e5200000000, 0x490a4f3f00000000, 0xe5655e0700000000,
+    0x11d56d4f00000000, 0xbdba7c7700000000, 0xf9b40adf00000000,
+    0x55db1be700000000, 0xa16b28af00000000, 0x0d04399700000000,
+    0xf2bff35900000000, 0x5ed0e26100000000, 0xaa60d12900000000,
+    0x060fc01100000000, 0x4201b6b900000000, 0xee6ea78100000000,
+    0x1ade94c900000000, 0xb6b185f100000000, 0x63b4949c00000000,
+    0xcfdb85a400000000, 0x3b6bb6ec00000000, 0x9704a7d400000000,
+    0xd30ad17c00000000, 0x7f65c04400000000, 0x8bd5f30c00000000,
+    0x27bae23400000000, 0x21ded1d600000000, 0x8db1c0ee00000000,
+    0x7901f3a600000000, 0xd56ee29e00000000, 0x9160943600000000,
+    0x3d0f850e00000000, 0xc9bfb64600000000, 0x65d0a77e00000000,
+    0xb0d5b61300000000, 0x1cbaa72b00000000, 0xe80a946300000000,
+    0x4465855b00000000, 0x006bf3f300000000, 0xac04e2cb00000000,
+    0x58b4d18300000000, 0xf4dbc0bb00000000, 0xa50a5b4200000000,
+    0x09654a7a00000000, 0xfdd5793200000000, 0x51ba680a00000000,
+    0x15b41ea200000000, 0xb9db0f9a00000000, 0x4d6b3cd200000000,
+    0xe1042dea00000000, 0x34013c8700000000, 0x986e2dbf00000000,
+    0x6cde1ef700000000, 0xc0b10fcf00000000, 0x84bf796700000000,
+    0x28d0685f00000000, 0xdc605b1700000000, 0x700f4a2f00000000,
+    0x766b79cd00000000, 0xda0468f500000000, 0x2eb45bbd00000000,
+    0x82db4a8500000000, 0xc6d53c2d00000000, 0x6aba2d1500000000,
+    0x9e0a1e5d00000000, 0x32650f6500000000, 0xe7601e0800000000,
+    0x4b0f0f3000000000, 0xbfbf3c7800000000, 0x13d02d4000000000,
+    0x57de5be800000000, 0xfbb14ad000000000, 0x0f01799800000000,
+    0xa36e68a000000000},
+   {0x0000000000000000, 0x196b30ef00000000, 0xc3a08cdb00000000,
+    0xdacbbc3400000000, 0x7737f5b200000000, 0x6e5cc55d00000000,
+    0xb497796900000000, 0xadfc498600000000, 0x1f18066000000000,
+    0x0673368f00000000, 0xdcb88abb00000000, 0xc5d3ba5400000000,
+    0x682ff3d200000000, 0x7144c33d00000000, 0xab8f7f0900000000,
+    0xb2e44fe600000000, 0x3e300cc000000000, 0x275b3c2f00000000,
+    0xfd90801b00000000, 0xe4fbb0f400000000, 0x4907f97200000000,
+    0x506cc99d00000000, 0x8aa775a900000000, 0x93cc454600000000,
+    0x21280aa000000000, 0x38433a4f00000000, 0xe288867b00000000,
+    0xfbe3b69400000000, 0x561fff1200000000, 0x4f74cffd00000000,
+    0x95bf73c900000000, 0x8cd4432600000000, 0x8d16f48500000000,
+    0x947dc46a00000000, 0x4eb6785e00000000, 0x57dd48b100000000,
+    0xfa21013700000000, 0xe34a31d800000000, 0x39818dec00000000,
+    0x20eabd0300000000, 0x920ef2e500000000, 0x8b65c20a00000000,
+    0x51ae7e3e00000000, 0x48c54ed100000000, 0xe539075700000000,
+    0xfc5237b800000000, 0x26998b8c00000000, 0x3ff2bb6300000000,
+    0xb326f84500000000, 0xaa4dc8aa00000000, 0x7086749e00000000,
+    0x69ed447100000000, 0xc4110df700000000, 0xdd7a3d1800000000,
+    0x07b1812c00000000, 0x1edab1c300000000, 0xac3efe2500000000,
+    0xb555ceca00000000, 0x6f9e72fe00000000, 0x76f5421100000000,
+    0xdb090b9700000000, 0xc2623b7800000000, 0x18a9874c00000000,
+    0x01c2b7a300000000, 0xeb5b040e00000000, 0xf23034e100000000,
+    0x28fb88d500000000, 0x3190b83a00000000, 0x9c6cf1bc00000000,
+    0x8507c15300000000, 0x5fcc7d6700000000, 0x46a74d8800000000,
+    0xf443026e00000000, 0xed28328100000000, 0x37e38eb500000000,
+    0x2e88be5a00000000, 0x8374f7dc00000000, 0x9a1fc73300000000,
+    0x40d47b0700000000, 0x59bf4be800000000, 0xd56b08ce00000000,
+    0xcc00382100000000, 0x16cb841500000000, 0x0fa0b4fa00000000,
+    0xa25cfd7c00000000, 0xbb37cd9300000000, 0x61fc71a700000000,
+    0x7897414800000000, 0xca730eae00000000, 0xd3183e4100000000,
+    0x09d3827500000000, 0x10b8b29a00000000, 0xbd44fb1c00000000,
+    0xa42fcbf300000000, 0x7ee477c700000000, 0x678f472800000000,
+    0x664df08b00000000, 0x7f26c06400000000, 0xa5ed7c5000000000,
+    0xbc864cbf00000000, 0x117a053900000000, 0x081135d600000000,
+    0xd2da89e200000000, 0xcbb1b90d00000000, 0x7955f6eb00000000,
+    0x603ec60400000000, 0xbaf57a3000000000, 0xa39e4adf00000000,
+    0x0e62035900000000, 0x170933b600000000, 0xcdc28f8200000000,
+    0xd4a9bf6d00000000, 0x587dfc4b00000000, 0x4116cca400000000,
+    0x9bdd709000000000, 0x82b6407f00000000, 0x2f4a09f900000000,
+    0x3621391600000000, 0xecea852200000000, 0xf581b5cd00000000,
+    0x4765fa2b00000000, 0x5e0ecac400000000, 0x84c576f000000000,
+    0x9dae461f00000000, 0x30520f9900000000, 0x29393f7600000000,
+    0xf3f2834200000000, 0xea99b3ad00000000, 0xd6b7081c00000000,
+    0xcfdc38f300000000, 0x151784c700000000, 0x0c7cb42800000000,
+    0xa180fdae00000000, 0xb8ebcd4100000000, 0x6220717500000000,
+    0x7b4b419a00000000, 0xc9af0e7c00000000, 0xd0c43e9300000000,
+    0x0a0f82a700000000, 0x1364b24800000000, 0xbe98fbce00000000,
+    0xa7f3cb2100000000, 0x7d38771500000000, 0x645347fa00000000,
+    0xe88704dc00000000, 0xf1ec343300000000, 0x2b27880700000000,
+    0x324cb8e800000000, 0x9fb0f16e00000000, 0x86dbc18100000000,
+    0x5c107db500000000, 0x457b4d5a00000000, 0xf79f02bc00000000,
+    0xeef4325300000000, 0x343f8e6700000000, 0x2d54be8800000000,
+    0x80a8f70e00000000, 0x99c3c7e100000000, 0x43087bd500000000,
+    0x5a634b3a00000000, 0x5ba1fc9900000000, 0x42cacc7600000000,
+    0x9801704200000000, 0x816a40ad00000000, 0x2c96092b00000000,
+    0x35fd39c400000000, 0xef3685f000000000, 0xf65db51f00000000,
+    0x44b9faf900000000, 0x5dd2ca1600000000, 0x8719762200000000,
+    0x9e7246cd00000000, 0x338e0f4b00000000, 0x2ae53fa400000000,
+    0xf02e839000000000, 0xe945b37f00000000, 0x6591f05900000000,
+    0x7cfac0b600000000, 0xa6317c8200000000, 0xbf5a4c6d00000000,
+    0x12a605eb00000000, 0x0bcd350400000000, 0xd106893000000000,
+    0xc86db9df00000000, 0x7a89f63900000000, 0x63e2c6d600000000,
+    0xb9297ae200000000, 0xa0424a0d00000000, 0x0dbe038b00000000,
+    0x14d5336400000000, 0xce1e8f5000000000, 0xd775bfbf00000000,
+    0x3dec0c1200000000, 0x24873cfd00000000, 0xfe4c80c900000000,
+    0xe727b02600000000, 0x4adbf9a000000000, 0x53b0c94f00000000,
+    0x897b757b00000000, 0x9010459400000000, 0x22f40a7200000000,
+    0x3b9f3a9d00000000, 0xe15486a900000000, 0xf83fb64600000000,
+    0x55c3ffc000000000, 0x4ca8cf2f00000000, 0x9663731b00000000,
+    0x8f0843f400000000, 0x03dc00d200000000, 0x1ab7303d00000000,
+    0xc07c8c0900000000, 0xd917bce600000000, 0x74ebf56000000000,
+    0x6d80c58f00000000, 0xb74b79bb00000000, 0xae20495400000000,
+    0x1cc406b200000000, 0x05af365d00000000, 0xdf648a6900000000,
+    0xc60fba8600000000, 0x6bf3f30000000000, 0x7298c3ef00000000,
+    0xa8537fdb00000000, 0xb1384f3400000000, 0xb0faf89700000000,
+    0xa991c87800000000, 0x735a744c00000000, 0x6a3144a300000000,
+    0xc7cd0d2500000000, 0xdea63dca00000000, 0x046d81fe00000000,
+    0x1d06b11100000000, 0xafe2fef700000000, 0xb689ce1800000000,
+    0x6c42722c00000000, 0x752942c300000000, 0xd8d50b4500000000,
+    0xc1be3baa00000000, 0x1b75879e00000000, 0x021eb77100000000,
+    0x8ecaf45700000000, 0x97a1c4b800000000, 0x4d6a788c00000000,
+    0x5401486300000000, 0xf9fd01e500000000, 0xe096310a00000000,
+    0x3a5d8d3e00000000, 0x2336bdd100000000, 0x91d2f23700000000,
+    0x88b9c2d800000000, 0x52727eec00000000, 0x4b194e0300000000,
+    0xe6e5078500000000, 0xff8e376a00000000, 0x25458b5e00000000,
+    0x3c2ebbb100000000},
+   {0x0000000000000000, 0xc82c036800000000, 0x905906d000000000,
+    0x587505b800000000, 0xd1c5e0a500000000, 0x19e9e3cd00000000,
+    0x419ce67500000000, 0x89b0e51d00000000, 0x53fd2d4e00000000,
+    0x9bd12e2600000000, 0xc3a42b9e00000000, 0x0b8828f600000000,
+    0x8238cdeb00000000, 0x4a14ce8300000000, 0x1261cb3b00000000,
+    0xda4dc85300000000, 0xa6fa5b9c00000000, 0x6ed658f400000000,
+    0x36a35d4c00000000, 0xfe8f5e2400000000, 0x773fbb3900000000,
+    0xbf13b85100000000, 0xe766bde900000000, 0x2f4abe8100000000,
+    0xf50776d200000000, 0x3d2b75ba00000000, 0x655e700200000000,
+    0xad72736a00000000, 0x24c2967700000000, 0xecee951f00000000,
+    0xb49b90a700000000, 0x7cb793cf00000000, 0xbd835b3d00000000,
+    0x75af585500000000, 0x2dda5ded00000000, 0xe5f65e8500000000,
+    0x6c46bb9800000000, 0xa46ab8f000000000, 0xfc1fbd4800000000,
+    0x3433be2000000000, 0xee7e767300000000, 0x2652751b00000000,
+    0x7e2770a300000000, 0xb60b73cb00000000, 0x3fbb96d600000000,
+    0xf79795be00000000, 0xafe2900600000000, 0x67ce936e00000000,
+    0x1b7900a100000000, 0xd35503c900000000, 0x8b20067100000000,
+    0x430c051900000000, 0xcabce00400000000, 0x0290e36c00000000,
+    0x5ae5e6d400000000, 0x92c9e5bc00000000, 0x48842def00000000,
+    0x80a82e8700000000, 0xd8dd2b3f00000000, 0x10f1285700000000,
+    0x9941cd4a00000000, 0x516dce2200000000, 0x0918cb9a00000000,
+    0xc134c8f200000000, 0x7a07b77a00000000, 0xb22bb41200000000,
+    0xea5eb1aa00000000, 0x2272b2c200000000, 0xabc257df00000000,
+    0x63ee54b700000000, 0x3b9b510f00000000, 0xf3b7526700000000,
+    0x29fa9a3400000000, 0xe1d6995c00000000, 0xb9a39ce400000000,
+    0x718f9f8c00000000, 0xf83f7a9100000000, 0x301379f900000000,
+    0x68667c4100000000, 0xa04a7f2900000000, 0xdcfdece600000000,
+    0x14d1ef8e00000000, 0x4ca4ea3600000000, 0x8488e95e00000000,
+    0x0d380c4300000000, 0xc5140f2b00000000, 0x9d610a9300000000,
+    0x554d09fb00000000, 0x8f00c1a800000000, 0x472cc2c000000000,
+    0x1f59c77800000000, 0xd775c41000000000, 0x5ec5210d00000000,
+    0x96e9226500000000, 0xce9c27dd00000000, 0x06b024b500000000,
+    0xc784ec4700000000, 0x0fa8ef2f00000000, 0x57ddea9700000000,
+    0x9ff1e9ff00000000, 0x16410ce200000000, 0xde6d0f8a00000000,
+    0x86180a3200000000, 0x4e34095a00000000, 0x9479c10900000000,
+    0x5c55c26100000000, 0x0420c7d900000000, 0xcc0cc4b100000000,
+    0x45bc21ac00000000, 0x8d9022c400000000, 0xd5e5277c00000000,
+    0x1dc9241400000000, 0x617eb7db00000000, 0xa952b4b300000000,
+    0xf127b10b00000000, 0x390bb26300000000, 0xb0bb577e00000000,
+    0x7897541600000000, 0x20e251ae00000000, 0xe8ce52c600000000,
+    0x32839a9500000000, 0xfaaf99fd00000000, 0xa2da9c4500000000,
+    0x6af69f2d00000000, 0xe3467a3000000000, 0x2b6a795800000000,
+    0x731f7ce000000000, 0xbb337f8800000000, 0xf40e6ef500000000,
+    0x3c226d9d00000000, 0x6457682500000000, 0xac7b6b4d00000000,
+    0x25cb8e5000000000, 0xede78d3800000000, 0xb592888000000000,
+    0x7dbe8be800000000, 0xa7f343bb00000000, 0x6fdf40d300000000,
+    0x37aa456b00000000, 0xff86460300000000, 0x7636a31e00000000,
+    0xbe1aa07600000000, 0xe66fa5ce00000000, 0x2e43a6a600000000,
+    0x52f4356900000000, 0x9ad8360100000000, 0xc2ad33b900000000,
+    0x0a8130d100000000, 0x8331d5cc00000000, 0x4b1dd6a400000000,
+    0x1368d31c00000000, 0xdb44d07400000000, 0x0109182700000000,
+    0xc9251b4f00000000, 0x91501ef700000000, 0x597c1d9f00000000,
+    0xd0ccf88200000000, 0x18e0fbea00000000, 0x4095fe5200000000,
+    0x88b9fd3a00000000, 0x498d35c800000000, 0x81a136a000000000,
+    0xd9d4331800000000, 0x11f8307000000000, 0x9848d56d00000000,
+    0x5064d60500000000, 0x0811d3bd00000000, 0xc03dd0d500000000,
+    0x1a70188600000000, 0xd25c1bee00000000, 0x8a291e5600000000,
+    0x42051d3e00000000, 0xcbb5f82300000000, 0x0399fb4b00000000,
+    0x5becfef300000000, 0x93c0fd9b00000000, 0xef776e5400000000,
+    0x275b6d3c00000000, 0x7f2e688400000000, 0xb7026bec00000000,
+    0x3eb28ef100000000, 0xf69e8d9900000000, 0xaeeb882100000000,
+    0x66c78b4900000000, 0xbc8a431a00000000, 0x74a6407200000000,
+    0x2cd345ca00000000, 0xe4ff46a200000000, 0x6d4fa3bf00000000,
+    0xa563a0d700000000, 0xfd16a56f00000000, 0x353aa60700000000,
+    0x8e09d98f00000000, 0x4625dae700000000, 0x1e50df5f00000000,
+    0xd67cdc3700000000, 0x5fcc392a00000000, 0x97e03a4200000000,
+    0xcf953ffa00000000, 0x07b93c9200000000, 0xddf4f4c100000000,
+    0x15d8f7a900000000, 0x4dadf21100000000, 0x8581f17900000000,
+    0x0c31146400000000, 0xc41d170c00000000, 0x9c6812b400000000,
+    0x544411dc00000000, 0x28f3821300000000, 0xe0df817b00000000,
+    0xb8aa84c300000000, 0x708687ab00000000, 0xf93662b600000000,
+    0x311a61de00000000, 0x696f646600000000, 0xa143670e00000000,
+    0x7b0eaf5d00000000, 0xb322ac3500000000, 0xeb57a98d00000000,
+    0x237baae500000000, 0xaacb4ff800000000, 0x62e74c9000000000,
+    0x3a92492800000000, 0xf2be4a4000000000, 0x338a82b200000000,
+    0xfba681da00000000, 0xa3d3846200000000, 0x6bff870a00000000,
+    0xe24f621700000000, 0x2a63617f00000000, 0x721664c700000000,
+    0xba3a67af00000000, 0x6077affc00000000, 0xa85bac9400000000,
+    0xf02ea92c00000000, 0x3802aa4400000000, 0xb1b24f5900000000,
+    0x799e4c3100000000, 0x21eb498900000000, 0xe9c74ae100000000,
+    0x9570d92e00000000, 0x5d5cda4600000000, 0x0529dffe00000000,
+    0xcd05dc9600000000, 0x44b5398b00000000, 0x8c993ae300000000,
+    0xd4ec3f5b00000000, 0x1cc03c3300000000, 0xc68df46000000000,
+    0x0ea1f70800000000, 0x56d4f2b000000000, 0x9ef8f1d800000000,
+    0x174814c500000000, 0xdf6417ad00000000, 0x8711121500000000,
+    0x4f3d117d00000000},
+   {0x0000000000000000, 0x277d3c4900000000, 0x4efa789200000000,
+    0x698744db00000000, 0x6d821d2100000000, 0x4aff216800000000,
+    0x237865b300000000, 0x040559fa00000000, 0xda043b4200000000,
+    0xfd79070b00000000, 0x94fe43d000000000, 0xb3837f9900000000,
+    0xb786266300000000, 0x90fb1a2a00000000, 0xf97c5ef100000000,
+    0xde0162b800000000, 0xb409768400000000, 0x93744acd00000000,
+    0xfaf30e1600000000, 0xdd8e325f00000000, 0xd98b6ba500000000,
+    0xfef657ec00000000, 0x9771133700000000, 0xb00c2f7e00000000,
+    0x6e0d4dc600000000, 0x4970718f00000000, 0x20f7355400000000,
+    0x078a091d00000000, 0x038f50e700000000, 0x24f26cae00000000,
+    0x4d75287500000000, 0x6a08143c00000000, 0x9965000d00000000,
+    0xbe183c4400000000, 0xd79f789f00000000, 0xf0e244d600000000,
+    0xf4e71d2c00000000, 0xd39a216500000000, 0xba1d65be00000000,
+    0x9d6059f700000000, 0x43613b4f00000000, 0x641c070600000000,
+    0x0d9b43dd00000000, 0x2ae67f9400000000, 0x2ee3266e00000000,
+    0x099e1a2700000000, 0x60195efc00000000, 0x476462b500000000,
+    0x2d6c768900000000, 0x0a114ac000000000, 0x63960e1b00000000,
+    0x44eb325200000000, 0x40ee6ba800000000, 0x679357e100000000,
+    0x0e14133a00000000, 0x29692f7300000000, 0xf7684dcb00000000,
+    0xd015718200000000, 0xb992355900000000, 0x9eef091000000000,
+    0x9aea50ea00000000, 0xbd976ca300000000, 0xd410287800000000,
+    0xf36d143100000000, 0x32cb001a00000000, 0x15b63c5300000000,
+    0x7c31788800000000, 0x5b4c44c100000000, 0x5f491d3b00000000,
+    0x7834217200000000, 0x11b365a900000000, 0x36ce59e000000000,
+    0xe8cf3b5800000000, 0xcfb2071100000000, 0xa63543ca00000000,
+    0x81487f8300000000, 0x854d267900000000, 0xa2301a3000000000,
+    0xcbb75eeb00000000, 0xecca62a200000000, 0x86c2769e00000000,
+    0xa1bf4ad700000000, 0xc8380e0c00000000, 0xef45324500000000,
+    0xeb406bbf00000000, 0xcc3d57f600000000, 0xa5ba132d00000000,
+    0x82c72f6400000000, 0x5cc64ddc00000000, 0x7bbb719500000000,
+    0x123c354e00000000, 0x3541090700000000, 0x314450fd00000000,
+    0x16396cb400000000, 0x7fbe286f00000000, 0x58c3142600000000,
+    0xabae001700000000, 0x8cd33c5e00000000, 0xe554788500000000,
+    0xc22944cc00000000, 0xc62c1d3600000000, 0xe151217f00000000,
+    0x88d665a400000000, 0xafab59ed00000000, 0x71aa3b5500000000,
+    0x56d7071c00000000, 0x3f5043c700000000, 0x182d7f8e00000000,
+    0x1c28267400000000, 0x3b551a3d00000000, 0x52d25ee600000000,
+    0x75af62af00000000, 0x1fa7769300000000, 0x38da4ada00000000,
+    0x515d0e0100000000, 0x7620324800000000, 0x72256bb200000000,
+    0x555857fb00000000, 0x3cdf132000000000, 0x1ba22f6900000000,
+    0xc5a34dd100000000, 0xe2de719800000000, 0x8b59354300000000,
+    0xac24090a00000000, 0xa82150f000000000, 0x8f5c6cb900000000,
+    0xe6db286200000000, 0xc1a6142b00000000, 0x6496013400000000,
+    0x43eb3d7d00000000, 0x2a6c79a600000000, 0x0d1145ef00000000,
+    0x09141c1500000000, 0x2e69205c00000000, 0x47ee648700000000,
+    0x609358ce00000000, 0xbe923a7600000000, 0x99ef063f00000000,
+    0xf06842e400000000, 0xd7157ead00000000, 0xd310275700000000,
+    0xf46d1b1e00000000, 0x9dea5fc500000000, 0xba97638c00000000,
+    0xd09f77b000000000, 0xf7e24bf900000000, 0x9e650f2200000000,
+    0xb918336b00000000, 0xbd1d6a9100000000, 0x9a6056d800000000,
+    0xf3e7120300000000, 0xd49a2e4a00000000, 0x0a9b4cf200000000,
+    0x2de670bb00000000, 0x4461346000000000, 0x631c082900000000,
+    0x671951d300000000, 0x40646d9a00000000, 0x29e3294100000000,
+    0x0e9e150800000000, 0xfdf3013900000000, 0xda8e3d7000000000,
+    0xb30979ab00000000, 0x947445e200000000, 0x90711c1800000000,
+    0xb70c205100000000, 0xde8b648a00000000, 0xf9f658c300000000,
+    0x27f73a7b00000000, 0x008a063200000000, 0x690d42e900000000,
+    0x4e707ea000000000, 0x4a75275a00000000, 0x6d081b1300000000,
+    0x048f5fc800000000, 0x23f2638100000000, 0x49fa77bd00000000,
+    0x6e874bf400000000, 0x07000f2f00000000, 0x207d336600000000,
+    0x24786a9c00000000, 0x030556d500000000, 0x6a82120e00000000,
+    0x4dff2e4700000000, 0x93fe4cff00000000, 0xb48370b600000000,
+    0xdd04346d00000000, 0xfa79082400000000, 0xfe7c51de00000000,
+    0xd9016d9700000000, 0xb086294c00000000, 0x97fb150500000000,
+    0x565d012e00000000, 0x71203d6700000000, 0x18a779bc00000000,
+    0x3fda45f500000000, 0x3bdf1c0f00000000, 0x1ca2204600000000,
+    0x7525649d00000000, 0x525858d400000000, 0x8c593a6c00000000,
+    0xab24062500000000, 0xc2a342fe00000000, 0xe5de7eb700000000,
+    0xe1db274d00000000, 0xc6a61b0400000000, 0xaf215fdf00000000,
+    0x885c639600000000, 0xe25477aa00000000, 0xc5294be300000000,
+    0xacae0f3800000000, 0x8bd3337100000000, 0x8fd66a8b00000000,
+    0xa8ab56c200000000, 0xc12c121900000000, 0xe6512e5000000000,
+    0x38504ce800000000, 0x1f2d70a100000000, 0x76aa347a00000000,
+    0x51d7083300000000, 0x55d251c900000000, 0x72af6d8000000000,
+    0x1b28295b00000000, 0x3c55151200000000, 0xcf38012300000000,
+    0xe8453d6a00000000, 0x81c279b100000000, 0xa6bf45f800000000,
+    0xa2ba1c0200000000, 0x85c7204b00000000, 0xec40649000000000,
+    0xcb3d58d900000000, 0x153c3a6100000000, 0x3241062800000000,
+    0x5bc642f300000000, 0x7cbb7eba00000000, 0x78be274000000000,
+    0x5fc31b0900000000, 0x36445fd200000000, 0x1139639b00000000,
+    0x7b3177a700000000, 0x5c4c4bee00000000, 0x35cb0f3500000000,
+    0x12b6337c00000000, 0x16b36a8600000000, 0x31ce56cf00000000,
+    0x5849121400000000, 0x7f342e5d00000000, 0xa1354ce500000000,
+    0x864870ac00000000, 0xefcf347700000000, 0xc8b2083e00000000,
+    0xccb751c400000000, 0xebca6d8d00000000, 0x824d295600000000,
+    0xa530151f00000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3,
+    0xa6679b4b, 0xc4451272, 0x1900b8ca, 0xf64463e6, 0x2b01c95e,
+    0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194,
+    0xef44db2c, 0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804,
+    0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7, 0x1f20d2db,
+    0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990,
+    0xdb65c0a9, 0x06206a11, 0xd725148b, 0x0a60be33, 0x6842370a,
+    0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+    0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e,
+    0x8706ec26, 0xe524651f, 0x3861cfa7, 0x3e41a5b6, 0xe3040f0e,
+    0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4,
+    0x27411d7c, 0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69,
+    0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a, 0xaba65fe7,
+    0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac,
+    0x6fe34d95, 0xb2a6e72d, 0x5de23c01, 0x80a796b9, 0xe2851f80,
+    0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+    0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29,
+    0xe4a57591, 0x8687fca8, 0x5bc25610, 0xb4868d3c, 0x69c32784,
+    0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e,
+    0xad8635f6, 0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255,
+    0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6, 0x8ac7288a,
+    0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1,
+    0x4e823af8, 0x93c79040, 0x95e7fa51, 0x48a250e9, 0x2a80d9d0,
+    0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+    0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844,
+    0xc5c402fc, 0xa7e68bc5, 0x7aa3217d, 0x52a0c93f, 0x8fe56387,
+    0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d,
+    0x4ba071f5, 0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0,
+    0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213, 0xbbc47802,
+    0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349,
+    0x7f816a70, 0xa2c4c0c8, 0x4d801be4, 0x90c5b15c, 0xf2e73865,
+    0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+    0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47,
+    0x23e246ff, 0x41c0cfc6, 0x9c85657e, 0x73c1be52, 0xae8414ea,
+    0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20,
+    0x6ac10698, 0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0,
+    0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443, 0x9aa50f6f,
+    0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424,
+    0x5ee01d1d, 0x83a5b7a5, 0xf90696d8, 0x24433c60, 0x4661b559,
+    0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+    0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd,
+    0xa9256e75, 0xcb07e74c, 0x16424df4, 0x106227e5, 0xcd278d5d,
+    0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597,
+    0x09629f2f, 0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a,
+    0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9, 0x2e238253,
+    0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918,
+    0xea669021, 0x37233a99, 0xd867e1b5, 0x05224b0d, 0x6700c234,
+    0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+    0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d,
+    0x6120a825, 0x0302211c, 0xde478ba4, 0x31035088, 0xec46fa30,
+    0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa,
+    0x2803e842},
+   {0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a,
+    0x3b9f3664, 0xd1b1f617, 0x74f06469, 0x38513ec5, 0x9d10acbb,
+    0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2,
+    0x4ca15aac, 0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9,
+    0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3, 0x48f3434f,
+    0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b,
+    0x9942b558, 0x3c032726, 0xe144fb14, 0x4405696a, 0xae2ba919,
+    0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+    0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb,
+    0xe28af3b5, 0x08a433c6, 0xade5a1b8, 0x91e6869e, 0x34a714e0,
+    0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089,
+    0xe516e2f7, 0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828,
+    0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32, 0xc76580d9,
+    0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd,
+    0x16d476ce, 0xb395e4b0, 0xff34be1c, 0x5a752c62, 0xb05bec11,
+    0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+    0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949,
+    0x8c58cb37, 0x66760b44, 0xc337993a, 0x8f96c396, 0x2ad751e8,
+    0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581,
+    0xfb66a7ff, 0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe,
+    0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4, 0x1e704508,
+    0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c,
+    0xcfc1b31f, 0x6a802161, 0x56830647, 0xf3c29439, 0x19ec544a,
+    0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+    0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98,
+    0x554d0ee6, 0xbf63ce95, 0x1a225ceb, 0x8b277743, 0x2e66e53d,
+    0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154,
+    0xffd7132a, 0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5,
+    0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def, 0xfb850ac9,
+    0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad,
+    0x2a34fcde, 0x8f756ea0, 0xc3d4340c, 0x6695a672, 0x8cbb6601,
+    0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+    0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d,
+    0x51fcba33, 0xbbd27a40, 0x1e93e83e, 0x5232b292, 0xf77320ec,
+    0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485,
+    0x26c2d6fb, 0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae,
+    0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4, 0x2290cf18,
+    0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c,
+    0xf321390f, 0x5660ab71, 0x4c42f79a, 0xe90365e4, 0x032da597,
+    0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+    0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45,
+    0x4f8cff3b, 0xa5a23f48, 0x00e3ad36, 0x3ce08a10, 0x99a1186e,
+    0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07,
+    0x4810ee79, 0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6,
+    0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc, 0xad060c8e,
+    0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea,
+    0x7cb7fa99, 0xd9f668e7, 0x9557324b, 0x3016a035, 0xda386046,
+    0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+    0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e,
+    0xe63b4760, 0x0c158713, 0xa954156d, 0xe5f54fc1, 0x40b4ddbf,
+    0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6,
+    0x91052ba8},
+   {0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc,
+    0x5d28f9ab, 0x69cf5132, 0x7a6dc945, 0x9d14c3b8, 0x8eb65bcf,
+    0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a,
+    0xe7790afd, 0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918,
+    0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4, 0xa2d13239,
+    0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92,
+    0xcb1e630b, 0xd8bcfb7c, 0x7f8be302, 0x6c297b75, 0x58ced3ec,
+    0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+    0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166,
+    0xbfb7d911, 0x8b507188, 0x98f2e9ff, 0x404e1283, 0x53ec8af4,
+    0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1,
+    0x3a23dbc6, 0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2,
+    0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e, 0xff17c604,
+    0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf,
+    0x96d89736, 0x857a0f41, 0x620305bc, 0x71a19dcb, 0x45463552,
+    0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+    0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659,
+    0x9dface2e, 0xa91d66b7, 0xbabffec0, 0x5dc6f43d, 0x4e646c4a,
+    0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f,
+    0x27ab3d78, 0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f,
+    0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43, 0x1d88e6be,
+    0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15,
+    0x7447b78c, 0x67e52ffb, 0xbf59d487, 0xacfb4cf0, 0x981ce469,
+    0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+    0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3,
+    0x7f65ee94, 0x4b82460d, 0x5820de7a, 0xfbc3faf9, 0xe861628e,
+    0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb,
+    0x81ae33bc, 0x66d73941, 0x7575a136, 0x419209af, 0x523091d8,
+    0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004, 0xc4060b78,
+    0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3,
+    0xadc95a4a, 0xbe6bc23d, 0x5912c8c0, 0x4ab050b7, 0x7e57f82e,
+    0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+    0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827,
+    0xd960e050, 0xed8748c9, 0xfe25d0be, 0x195cda43, 0x0afe4234,
+    0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71,
+    0x63311306, 0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3,
+    0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f, 0x26992bc2,
+    0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269,
+    0x4f567af0, 0x5cf4e287, 0x04d43cfd, 0x1776a48a, 0x23910c13,
+    0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+    0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99,
+    0xc4e806ee, 0xf00fae77, 0xe3ad3600, 0x3b11cd7c, 0x28b3550b,
+    0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e,
+    0x417c0439, 0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d,
+    0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781, 0x7b5fdfff,
+    0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654,
+    0x12908ecd, 0x013216ba, 0xe64b1c47, 0xf5e98430, 0xc10e2ca9,
+    0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+    0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2,
+    0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b, 0xd98eedc6, 0xca2c75b1,
+    0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4,
+    0xa3e32483},
+   {0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f,
+    0x35f1141c, 0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc,
+    0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27,
+    0x5e133c24, 0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b,
+    0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384, 0x9a879fa0,
+    0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+    0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29,
+    0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e,
+    0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa, 0x30e349b1, 0xc288cab2,
+    0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59,
+    0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+    0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc,
+    0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0,
+    0x67dafa54, 0x95b17957, 0xcba24573, 0x39c9c670, 0x2a993584,
+    0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc,
+    0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+    0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4,
+    0x0f36e6f7, 0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+    0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789, 0xeb1fcbad,
+    0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1,
+    0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e, 0x90a324fa,
+    0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd,
+    0xceb018de, 0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b,
+    0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90,
+    0x563c5f93, 0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+    0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c, 0x92a8fc17,
+    0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+    0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f,
+    0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9,
+    0x97baa1ba, 0x84ea524e, 0x7681d14d, 0x2892ed69, 0xdaf96e6a,
+    0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81,
+    0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+    0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06,
+    0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a,
+    0x1e6dcdee, 0xec064eed, 0xc38d26c4, 0x31e6a5c7, 0x22b65633,
+    0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914,
+    0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+    0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643,
+    0x07198540, 0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+    0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a,
+    0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06,
+    0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6, 0x88d28022,
+    0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a,
+    0xc69f7b69, 0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9,
+    0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052,
+    0xad7d5351}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0x03836bf2, 0xf7703be1, 0xf4f35013, 0x1f979ac7,
+    0x1c14f135, 0xe8e7a126, 0xeb64cad4, 0xcf58d98a, 0xccdbb278,
+    0x3828e26b, 0x3bab8999, 0xd0cf434d, 0xd34c28bf, 0x27bf78ac,
+    0x243c135e, 0x6fc75e10, 0x6c4435e2, 0x98b765f1, 0x9b340e03,
+    0x7050c4d7, 0x73d3af25, 0x8720ff36, 0x84a394c4, 0xa09f879a,
+    0xa31cec68, 0x57efbc7b, 0x546cd789, 0xbf081d5d, 0xbc8b76af,
+    0x487826bc, 0x4bfb4d4e, 0xde8ebd20, 0xdd0dd6d2, 0x29fe86c1,
+    0x2a7ded33, 0xc11927e7, 0xc29a4c15, 0x36691c06, 0x35ea77f4,
+    0x11d664aa, 0x12550f58, 0xe6a65f4b, 0xe52534b9, 0x0e41fe6d,
+    0x0dc2959f, 0xf931c58c, 0xfab2ae7e, 0xb149e330, 0xb2ca88c2,
+    0x4639d8d1, 0x45bab323, 0xaede79f7, 0xad5d1205, 0x59ae4216,
+    0x5a2d29e4, 0x7e113aba, 0x7d925148, 0x8961015b, 0x8ae26aa9,
+    0x6186a07d, 0x6205cb8f, 0x96f69b9c, 0x9575f06e, 0xbc1d7b41,
+    0xbf9e10b3, 0x4b6d40a0, 0x48ee2b52, 0xa38ae186, 0xa0098a74,
+    0x54fada67, 0x5779b195, 0x7345a2cb, 0x70c6c939, 0x8435992a,
+    0x87b6f2d8, 0x6cd2380c, 0x6f5153fe, 0x9ba203ed, 0x9821681f,
+    0xd3da2551, 0xd0594ea3, 0x24aa1eb0, 0x27297542, 0xcc4dbf96,
+    0xcfced464, 0x3b3d8477, 0x38beef85, 0x1c82fcdb, 0x1f019729,
+    0xebf2c73a, 0xe871acc8, 0x0315661c, 0x00960dee, 0xf4655dfd,
+    0xf7e6360f, 0x6293c661, 0x6110ad93, 0x95e3fd80, 0x96609672,
+    0x7d045ca6, 0x7e873754, 0x8a746747, 0x89f70cb5, 0xadcb1feb,
+    0xae487419, 0x5abb240a, 0x59384ff8, 0xb25c852c, 0xb1dfeede,
+    0x452cbecd, 0x46afd53f, 0x0d549871, 0x0ed7f383, 0xfa24a390,
+    0xf9a7c862, 0x12c302b6, 0x11406944, 0xe5b33957, 0xe63052a5,
+    0xc20c41fb, 0xc18f2a09, 0x357c7a1a, 0x36ff11e8, 0xdd9bdb3c,
+    0xde18b0ce, 0x2aebe0dd, 0x29688b2f, 0x783bf682, 0x7bb89d70,
+    0x8f4bcd63, 0x8cc8a691, 0x67ac6c45, 0x642f07b7, 0x90dc57a4,
+    0x935f3c56, 0xb7632f08, 0xb4e044fa, 0x401314e9, 0x43907f1b,
+    0xa8f4b5cf, 0xab77de3d, 0x5f848e2e, 0x5c07e5dc, 0x17fca892,
+    0x147fc360, 0xe08c9373, 0xe30ff881, 0x086b3255, 0x0be859a7,
+    0xff1b09b4, 0xfc986246, 0xd8a47118, 0xdb271aea, 0x2fd44af9,
+    0x2c57210b, 0xc733ebdf, 0xc4b0802d, 0x3043d03e, 0x33c0bbcc,
+    0xa6b54ba2, 0xa5362050, 0x51c57043, 0x52461bb1, 0xb922d165,
+    0xbaa1ba97, 0x4e52ea84, 0x4dd18176, 0x69ed9228, 0x6a6ef9da,
+    0x9e9da9c9, 0x9d1ec23b, 0x767a08ef, 0x75f9631d, 0x810a330e,
+    0x828958fc, 0xc97215b2, 0xcaf17e40, 0x3e022e53, 0x3d8145a1,
+    0xd6e58f75, 0xd566e487, 0x2195b494, 0x2216df66, 0x062acc38,
+    0x05a9a7ca, 0xf15af7d9, 0xf2d99c2b, 0x19bd56ff, 0x1a3e3d0d,
+    0xeecd6d1e, 0xed4e06ec, 0xc4268dc3, 0xc7a5e631, 0x3356b622,
+    0x30d5ddd0, 0xdbb11704, 0xd8327cf6, 0x2cc12ce5, 0x2f424717,
+    0x0b7e5449, 0x08fd3fbb, 0xfc0e6fa8, 0xff8d045a, 0x14e9ce8e,
+    0x176aa57c, 0xe399f56f, 0xe01a9e9d, 0xabe1d3d3, 0xa862b821,
+    0x5c91e832, 0x5f1283c0, 0xb4764914, 0xb7f522e6, 0x430672f5,
+    0x40851907, 0x64b90a59, 0x673a61ab, 0x93c931b8, 0x904a5a4a,
+    0x7b2e909e, 0x78adfb6c, 0x8c5eab7f, 0x8fddc08d, 0x1aa830e3,
+    0x192b5b11, 0xedd80b02, 0xee5b60f0, 0x053faa24, 0x06bcc1d6,
+    0xf24f91c5, 0xf1ccfa37, 0xd5f0e969, 0xd673829b, 0x2280d288,
+    0x2103b97a, 0xca6773ae, 0xc9e4185c, 0x3d17484f, 0x3e9423bd,
+    0x756f6ef3, 0x76ec0501, 0x821f5512, 0x819c3ee0, 0x6af8f434,
+    0x697b9fc6, 0x9d88cfd5, 0x9e0ba427, 0xba37b779, 0xb9b4dc8b,
+    0x4d478c98, 0x4ec4e76a, 0xa5a02dbe, 0xa623464c, 0x52d0165f,
+    0x51537dad},
+   {0x00000000, 0x7798a213, 0xee304527, 0x99a8e734, 0xdc618a4e,
+    0xabf9285d, 0x3251cf69, 0x45c96d7a, 0xb8c3149d, 0xcf5bb68e,
+    0x56f351ba, 0x216bf3a9, 0x64a29ed3, 0x133a3cc0, 0x8a92dbf4,
+    0xfd0a79e7, 0x81f1c53f, 0xf669672c, 0x6fc18018, 0x1859220b,
+    0x5d904f71, 0x2a08ed62, 0xb3a00a56, 0xc438a845, 0x3932d1a2,
+    0x4eaa73b1, 0xd7029485, 0xa09a3696, 0xe5535bec, 0x92cbf9ff,
+    0x0b631ecb, 0x7cfbbcd8, 0x02e38b7f, 0x757b296c, 0xecd3ce58,
+    0x9b4b6c4b, 0xde820131, 0xa91aa322, 0x30b24416, 0x472ae605,
+    0xba209fe2, 0xcdb83df1, 0x5410dac5, 0x238878d6, 0x664115ac,
+    0x11d9b7bf, 0x8871508b, 0xffe9f298, 0x83124e40, 0xf48aec53,
+    0x6d220b67, 0x1abaa974, 0x5f73c40e, 0x28eb661d, 0xb1438129,
+    0xc6db233a, 0x3bd15add, 0x4c49f8ce, 0xd5e11ffa, 0xa279bde9,
+    0xe7b0d093, 0x90287280, 0x098095b4, 0x7e1837a7, 0x04c617ff,
+    0x735eb5ec, 0xeaf652d8, 0x9d6ef0cb, 0xd8a79db1, 0xaf3f3fa2,
+    0x3697d896, 0x410f7a85, 0xbc050362, 0xcb9da171, 0x52354645,
+    0x25ade456, 0x6064892c, 0x17fc2b3f, 0x8e54cc0b, 0xf9cc6e18,
+    0x8537d2c0, 0xf2af70d3, 0x6b0797e7, 0x1c9f35f4, 0x5956588e,
+    0x2ecefa9d, 0xb7661da9, 0xc0febfba, 0x3df4c65d, 0x4a6c644e,
+    0xd3c4837a, 0xa45c2169, 0xe1954c13, 0x960dee00, 0x0fa50934,
+    0x783dab27, 0x06259c80, 0x71bd3e93, 0xe815d9a7, 0x9f8d7bb4,
+    0xda4416ce, 0xaddcb4dd, 0x347453e9, 0x43ecf1fa, 0xbee6881d,
+    0xc97e2a0e, 0x50d6cd3a, 0x274e6f29, 0x62870253, 0x151fa040,
+    0x8cb74774, 0xfb2fe567, 0x87d459bf, 0xf04cfbac, 0x69e41c98,
+    0x1e7cbe8b, 0x5bb5d3f1, 0x2c2d71e2, 0xb58596d6, 0xc21d34c5,
+    0x3f174d22, 0x488fef31, 0xd1270805, 0xa6bfaa16, 0xe376c76c,
+    0x94ee657f, 0x0d46824b, 0x7ade2058, 0xf9fac3fb, 0x8e6261e8,
+    0x17ca86dc, 0x605224cf, 0x259b49b5, 0x5203eba6, 0xcbab0c92,
+    0xbc33ae81, 0x4139d766, 0x36a17575, 0xaf099241, 0xd8913052,
+    0x9d585d28, 0xeac0ff3b, 0x7368180f, 0x04f0ba1c, 0x780b06c4,
+    0x0f93a4d7, 0x963b43e3, 0xe1a3e1f0, 0xa46a8c8a, 0xd3f22e99,
+    0x4a5ac9ad, 0x3dc26bbe, 0xc0c81259, 0xb750b04a, 0x2ef8577e,
+    0x5960f56d, 0x1ca99817, 0x6b313a04, 0xf299dd30, 0x85017f23,
+    0xfb194884, 0x8c81ea97, 0x15290da3, 0x62b1afb0, 0x2778c2ca,
+    0x50e060d9, 0xc94887ed, 0xbed025fe, 0x43da5c19, 0x3442fe0a,
+    0xadea193e, 0xda72bb2d, 0x9fbbd657, 0xe8237444, 0x718b9370,
+    0x06133163, 0x7ae88dbb, 0x0d702fa8, 0x94d8c89c, 0xe3406a8f,
+    0xa68907f5, 0xd111a5e6, 0x48b942d2, 0x3f21e0c1, 0xc22b9926,
+    0xb5b33b35, 0x2c1bdc01, 0x5b837e12, 0x1e4a1368, 0x69d2b17b,
+    0xf07a564f, 0x87e2f45c, 0xfd3cd404, 0x8aa47617, 0x130c9123,
+    0x64943330, 0x215d5e4a, 0x56c5fc59, 0xcf6d1b6d, 0xb8f5b97e,
+    0x45ffc099, 0x3267628a, 0xabcf85be, 0xdc5727ad, 0x999e4ad7,
+    0xee06e8c4, 0x77ae0ff0, 0x0036ade3, 0x7ccd113b, 0x0b55b328,
+    0x92fd541c, 0xe565f60f, 0xa0ac9b75, 0xd7343966, 0x4e9cde52,
+    0x39047c41, 0xc40e05a6, 0xb396a7b5, 0x2a3e4081, 0x5da6e292,
+    0x186f8fe8, 0x6ff72dfb, 0xf65fcacf, 0x81c768dc, 0xffdf5f7b,
+    0x8847fd68, 0x11ef1a5c, 0x6677b84f, 0x23bed535, 0x54267726,
+    0xcd8e9012, 0xba163201, 0x471c4be6, 0x3084e9f5, 0xa92c0ec1,
+    0xdeb4acd2, 0x9b7dc1a8, 0xece563bb, 0x754d848f, 0x02d5269c,
+    0x7e2e9a44, 0x09b63857, 0x901edf63, 0xe7867d70, 0xa24f100a,
+    0xd5d7b219, 0x4c7f552d, 0x3be7f73e, 0xc6ed8ed9, 0xb1752cca,
+    0x28ddcbfe, 0x5f4569ed, 0x1a8c0497, 0x6d14a684, 0xf4bc41b0,
+    0x8324e3a3},
+   {0x00000000, 0x7e9241a5, 0x0d526f4f, 0x73c02eea, 0x1aa4de9e,
+    0x64369f3b, 0x17f6b1d1, 0x6964f074, 0xc53e5138, 0xbbac109d,
+    0xc86c3e77, 0xb6fe7fd2, 0xdf9a8fa6, 0xa108ce03, 0xd2c8e0e9,
+    0xac5aa14c, 0x8a7da270, 0xf4efe3d5, 0x872fcd3f, 0xf9bd8c9a,
+    0x90d97cee, 0xee4b3d4b, 0x9d8b13a1, 0xe3195204, 0x4f43f348,
+    0x31d1b2ed, 0x42119c07, 0x3c83dda2, 0x55e72dd6, 0x2b756c73,
+    0x58b54299, 0x2627033c, 0x14fb44e1, 0x6a690544, 0x19a92bae,
+    0x673b6a0b, 0x0e5f9a7f, 0x70cddbda, 0x030df530, 0x7d9fb495,
+    0xd1c515d9, 0xaf57547c, 0xdc977a96, 0xa2053b33, 0xcb61cb47,
+    0xb5f38ae2, 0xc633a408, 0xb8a1e5ad, 0x9e86e691, 0xe014a734,
+    0x93d489de, 0xed46c87b, 0x8422380f, 0xfab079aa, 0x89705740,
+    0xf7e216e5, 0x5bb8b7a9, 0x252af60c, 0x56ead8e6, 0x28789943,
+    0x411c6937, 0x3f8e2892, 0x4c4e0678, 0x32dc47dd, 0xd98065c7,
+    0xa7122462, 0xd4d20a88, 0xaa404b2d, 0xc324bb59, 0xbdb6fafc,
+    0xce76d416, 0xb0e495b3, 0x1cbe34ff, 0x622c755a, 0x11ec5bb0,
+    0x6f7e1a15, 0x061aea61, 0x7888abc4, 0x0b48852e, 0x75dac48b,
+    0x53fdc7b7, 0x2d6f8612, 0x5eafa8f8, 0x203de95d, 0x49591929,
+    0x37cb588c, 0x440b7666, 0x3a9937c3, 0x96c3968f, 0xe851d72a,
+    0x9b91f9c0, 0xe503b865, 0x8c674811, 0xf2f509b4, 0x8135275e,
+    0xffa766fb, 0xcd7b2126, 0xb3e96083, 0xc0294e69, 0xbebb0fcc,
+    0xd7dfffb8, 0xa94dbe1d, 0xda8d90f7, 0xa41fd152, 0x0845701e,
+    0x76d731bb, 0x05171f51, 0x7b855ef4, 0x12e1ae80, 0x6c73ef25,
+    0x1fb3c1cf, 0x6121806a, 0x47068356, 0x3994c2f3, 0x4a54ec19,
+    0x34c6adbc, 0x5da25dc8, 0x23301c6d, 0x50f03287, 0x2e627322,
+    0x8238d26e, 0xfcaa93cb, 0x8f6abd21, 0xf1f8fc84, 0x989c0cf0,
+    0xe60e4d55, 0x95ce63bf, 0xeb5c221a, 0x4377278b, 0x3de5662e,
+    0x4e2548c4, 0x30b70961, 0x59d3f915, 0x2741b8b0, 0x5481965a,
+    0x2a13d7ff, 0x864976b3, 0xf8db3716, 0x8b1b19fc, 0xf5895859,
+    0x9ceda82d, 0xe27fe988, 0x91bfc762, 0xef2d86c7, 0xc90a85fb,
+    0xb798c45e, 0xc458eab4, 0xbacaab11, 0xd3ae5b65, 0xad3c1ac0,
+    0xdefc342a, 0xa06e758f, 0x0c34d4c3, 0x72a69566, 0x0166bb8c,
+    0x7ff4fa29, 0x16900a5d, 0x68024bf8, 0x1bc26512, 0x655024b7,
+    0x578c636a, 0x291e22cf, 0x5ade0c25, 0x244c4d80, 0x4d28bdf4,
+    0x33bafc51, 0x407ad2bb, 0x3ee8931e, 0x92b23252, 0xec2073f7,
+    0x9fe05d1d, 0xe1721cb8, 0x8816eccc, 0xf684ad69, 0x85448383,
+    0xfbd6c226, 0xddf1c11a, 0xa36380bf, 0xd0a3ae55, 0xae31eff0,
+    0xc7551f84, 0xb9c75e21, 0xca0770cb, 0xb495316e, 0x18cf9022,
+    0x665dd187, 0x159dff6d, 0x6b0fbec8, 0x026b4ebc, 0x7cf90f19,
+    0x0f3921f3, 0x71ab6056, 0x9af7424c, 0xe46503e9, 0x97a52d03,
+    0xe9376ca6, 0x80539cd2, 0xfec1dd77, 0x8d01f39d, 0xf393b238,
+    0x5fc91374, 0x215b52d1, 0x529b7c3b, 0x2c093d9e, 0x456dcdea,
+    0x3bff8c4f, 0x483fa2a5, 0x36ade300, 0x108ae03c, 0x6e18a199,
+    0x1dd88f73, 0x634aced6, 0x0a2e3ea2, 0x74bc7f07, 0x077c51ed,
+    0x79ee1048, 0xd5b4b104, 0xab26f0a1, 0xd8e6de4b, 0xa6749fee,
+    0xcf106f9a, 0xb1822e3f, 0xc24200d5, 0xbcd04170, 0x8e0c06ad,
+    0xf09e4708, 0x835e69e2, 0xfdcc2847, 0x94a8d833, 0xea3a9996,
+    0x99fab77c, 0xe768f6d9, 0x4b325795, 0x35a01630, 0x466038da,
+    0x38f2797f, 0x5196890b, 0x2f04c8ae, 0x5cc4e644, 0x2256a7e1,
+    0x0471a4dd, 0x7ae3e578, 0x0923cb92, 0x77b18a37, 0x1ed57a43,
+    0x60473be6, 0x1387150c, 0x6d1554a9, 0xc14ff5e5, 0xbfddb440,
+    0xcc1d9aaa, 0xb28fdb0f, 0xdbeb2b7b, 0xa5796ade, 0xd6b94434,
+    0xa82b0591},
+   {0x00000000, 0xb8aa45dd, 0x812367bf, 0x39892262, 0xf331227b,
+    0x4b9b67a6, 0x721245c4, 0xcab80019, 0xe66344f6, 0x5ec9012b,
+    0x67402349, 0xdfea6694, 0x1552668d, 0xadf82350, 0x94710132,
+    0x2cdb44ef, 0x3db164e9, 0x851b2134, 0xbc920356, 0x0438468b,
+    0xce804692, 0x762a034f, 0x4fa3212d, 0xf70964f0, 0xdbd2201f,
+    0x637865c2, 0x5af147a0, 0xe25b027d, 0x28e30264, 0x904947b9,
+    0xa9c065db, 0x116a2006, 0x8b1425d7, 0x33be600a, 0x0a374268,
+    0xb29d07b5, 0x782507ac, 0xc08f4271, 0xf9066013, 0x41ac25ce,
+    0x6d776121, 0xd5dd24fc, 0xec54069e, 0x54fe4343, 0x9e46435a,
+    0x26ec0687, 0x1f6524e5, 0xa7cf6138, 0xb6a5413e, 0x0e0f04e3,
+    0x37862681, 0x8f2c635c, 0x45946345, 0xfd3e2698, 0xc4b704fa,
+    0x7c1d4127, 0x50c605c8, 0xe86c4015, 0xd1e56277, 0x694f27aa,
+    0xa3f727b3, 0x1b5d626e, 0x22d4400c, 0x9a7e05d1, 0xe75fa6ab,
+    0x5ff5e376, 0x667cc114, 0xded684c9, 0x146e84d0, 0xacc4c10d,
+    0x954de36f, 0x2de7a6b2, 0x013ce25d, 0xb996a780, 0x801f85e2,
+    0x38b5c03f, 0xf20dc026, 0x4aa785fb, 0x732ea799, 0xcb84e244,
+    0xdaeec242, 0x6244879f, 0x5bcda5fd, 0xe367e020, 0x29dfe039,
+    0x9175a5e4, 0xa8fc8786, 0x1056c25b, 0x3c8d86b4, 0x8427c369,
+    0xbdaee10b, 0x0504a4d6, 0xcfbca4cf, 0x7716e112, 0x4e9fc370,
+    0xf63586ad, 0x6c4b837c, 0xd4e1c6a1, 0xed68e4c3, 0x55c2a11e,
+    0x9f7aa107, 0x27d0e4da, 0x1e59c6b8, 0xa6f38365, 0x8a28c78a,
+    0x32828257, 0x0b0ba035, 0xb3a1e5e8, 0x7919e5f1, 0xc1b3a02c,
+    0xf83a824e, 0x4090c793, 0x51fae795, 0xe950a248, 0xd0d9802a,
+    0x6873c5f7, 0xa2cbc5ee, 0x1a618033, 0x23e8a251, 0x9b42e78c,
+    0xb799a363, 0x0f33e6be, 0x36bac4dc, 0x8e108101, 0x44a88118,
+    0xfc02c4c5, 0xc58be6a7, 0x7d21a37a, 0x3fc9a052, 0x8763e58f,
+    0xbeeac7ed, 0x06408230, 0xccf88229, 0x7452c7f4, 0x4ddbe596,
+    0xf571a04b, 0xd9aae4a4, 0x6100a179, 0x5889831b, 0xe023c6c6,
+    0x2a9bc6df, 0x92318302, 0xabb8a160, 0x1312e4bd, 0x0278c4bb,
+    0xbad28166, 0x835ba304, 0x3bf1e6d9, 0xf149e6c0, 0x49e3a31d,
+    0x706a817f, 0xc8c0c4a2, 0xe41b804d, 0x5cb1c590, 0x6538e7f2,
+    0xdd92a22f, 0x172aa236, 0xaf80e7eb, 0x9609c589, 0x2ea38054,
+    0xb4dd8585, 0x0c77c058, 0x35fee23a, 0x8d54a7e7, 0x47eca7fe,
+    0xff46e223, 0xc6cfc041, 0x7e65859c, 0x52bec173, 0xea1484ae,
+    0xd39da6cc, 0x6b37e311, 0xa18fe308, 0x1925a6d5, 0x20ac84b7,
+    0x9806c16a, 0x896ce16c, 0x31c6a4b1, 0x084f86d3, 0xb0e5c30e,
+    0x7a5dc317, 0xc2f786ca, 0xfb7ea4a8, 0x43d4e175, 0x6f0fa59a,
+    0xd7a5e047, 0xee2cc225, 0x568687f8, 0x9c3e87e1, 0x2494c23c,
+    0x1d1de05e, 0xa5b7a583, 0xd89606f9, 0x603c4324, 0x59b56146,
+    0xe11f249b, 0x2ba72482, 0x930d615f, 0xaa84433d, 0x122e06e0,
+    0x3ef5420f, 0x865f07d2, 0xbfd625b0, 0x077c606d, 0xcdc46074,
+    0x756e25a9, 0x4ce707cb, 0xf44d4216, 0xe5276210, 0x5d8d27cd,
+    0x640405af, 0xdcae4072, 0x1616406b, 0xaebc05b6, 0x973527d4,
+    0x2f9f6209, 0x034426e6, 0xbbee633b, 0x82674159, 0x3acd0484,
+    0xf075049d, 0x48df4140, 0x71566322, 0xc9fc26ff, 0x5382232e,
+    0xeb2866f3, 0xd2a14491, 0x6a0b014c, 0xa0b30155, 0x18194488,
+    0x219066ea, 0x993a2337, 0xb5e167d8, 0x0d4b2205, 0x34c20067,
+    0x8c6845ba, 0x46d045a3, 0xfe7a007e, 0xc7f3221c, 0x7f5967c1,
+    0x6e3347c7, 0xd699021a, 0xef102078, 0x57ba65a5, 0x9d0265bc,
+    0x25a82061, 0x1c210203, 0xa48b47de, 0x88500331, 0x30fa46ec,
+    0x0973648e, 0xb1d92153, 0x7b61214a, 0xc3cb6497, 0xfa4246f5,
+    0x42e80328}};
+
+#endif /* W */
+
+#endif /* N == 1 */
+#if N == 2
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xf20c0dfe, 0xe1f46d0d, 0x13f860f3, 0xc604aceb,
+    0x3408a115, 0x27f0c1e6, 0xd5fccc18, 0x89e52f27, 0x7be922d9,
+    0x6811422a, 0x9a1d4fd4, 0x4fe183cc, 0xbded8e32, 0xae15eec1,
+    0x5c19e33f, 0x162628bf, 0xe42a2541, 0xf7d245b2, 0x05de484c,
+    0xd0228454, 0x222e89aa, 0x31d6e959, 0xc3dae4a7, 0x9fc30798,
+    0x6dcf0a66, 0x7e376a95, 0x8c3b676b, 0x59c7ab73, 0xabcba68d,
+    0xb833c67e, 0x4a3fcb80, 0x2c4c517e, 0xde405c80, 0xcdb83c73,
+    0x3fb4318d, 0xea48fd95, 0x1844f06b, 0x0bbc9098, 0xf9b09d66,
+    0xa5a97e59, 0x57a573a7, 0x445d1354, 0xb6511eaa, 0x63add2b2,
+    0x91a1df4c, 0x8259bfbf, 0x7055b241, 0x3a6a79c1, 0xc866743f,
+    0xdb9e14cc, 0x29921932, 0xfc6ed52a, 0x0e62d8d4, 0x1d9ab827,
+    0xef96b5d9, 0xb38f56e6, 0x41835b18, 0x527b3beb, 0xa0773615,
+    0x758bfa0d, 0x8787f7f3, 0x947f9700, 0x66739afe, 0x5898a2fc,
+    0xaa94af02, 0xb96ccff1, 0x4b60c20f, 0x9e9c0e17, 0x6c9003e9,
+    0x7f68631a, 0x8d646ee4, 0xd17d8ddb, 0x23718025, 0x3089e0d6,
+    0xc285ed28, 0x17792130, 0xe5752cce, 0xf68d4c3d, 0x048141c3,
+    0x4ebe8a43, 0xbcb287bd, 0xaf4ae74e, 0x5d46eab0, 0x88ba26a8,
+    0x7ab62b56, 0x694e4ba5, 0x9b42465b, 0xc75ba564, 0x3557a89a,
+    0x26afc869, 0xd4a3c597, 0x015f098f, 0xf3530471, 0xe0ab6482,
+    0x12a7697c, 0x74d4f382, 0x86d8fe7c, 0x95209e8f, 0x672c9371,
+    0xb2d05f69, 0x40dc5297, 0x53243264, 0xa1283f9a, 0xfd31dca5,
+    0x0f3dd15b, 0x1cc5b1a8, 0xeec9bc56, 0x3b35704e, 0xc9397db0,
+    0xdac11d43, 0x28cd10bd, 0x62f2db3d, 0x90fed6c3, 0x8306b630,
+    0x710abbce, 0xa4f677d6, 0x56fa7a28, 0x45021adb, 0xb70e1725,
+    0xeb17f41a, 0x191bf9e4, 0x0ae39917, 0xf8ef94e9, 0x2d1358f1,
+    0xdf1f550f, 0xcce735fc, 0x3eeb3802, 0xb13145f8, 0x433d4806,
+    0x50c528f5, 0xa2c9250b, 0x7735e913, 0x8539e4ed, 0x96c1841e,
+    0x64cd89e0, 0x38d46adf, 0xcad86721, 0xd92007d2, 0x2b2c0a2c,
+    0xfed0c634, 0x0cdccbca, 0x1f24ab39, 0xed28a6c7, 0xa7176d47,
+    0x551b60b9, 0x46e3004a, 0xb4ef0db4, 0x6113c1ac, 0x931fcc52,
+    0x80e7aca1, 0x72eba15f, 0x2ef24260, 0xdcfe4f9e, 0xcf062f6d,
+    0x3d0a2293, 0xe8f6ee8b, 0x1afae375, 0x09028386, 0xfb0e8e78,
+    0x9d7d1486, 0x6f711978, 0x7c89798b, 0x8e857475, 0x5b79b86d,
+    0xa975b593, 0xba8dd560, 0x4881d89e, 0x14983ba1, 0xe694365f,
+    0xf56c56ac, 0x07605b52, 0xd29c974a, 0x20909ab4, 0x3368fa47,
+    0xc164f7b9, 0x8b5b3c39, 0x795731c7, 0x6aaf5134, 0x98a35cca,
+    0x4d5f90d2, 0xbf539d2c, 0xacabfddf, 0x5ea7f021, 0x02be131e,
+    0xf0b21ee0, 0xe34a7e13, 0x114673ed, 0xc4babff5, 0x36b6b20b,
+    0x254ed2f8, 0xd742df06, 0xe9a9e704, 0x1ba5eafa, 0x085d8a09,
+    0xfa5187f7, 0x2fad4bef, 0xdda14611, 0xce5926e2, 0x3c552b1c,
+    0x604cc823, 0x9240c5dd, 0x81b8a52e, 0x73b4a8d0, 0xa64864c8,
+    0x54446936, 0x47bc09c5, 0xb5b0043b, 0xff8fcfbb, 0x0d83c245,
+    0x1e7ba2b6, 0xec77af48, 0x398b6350, 0xcb876eae, 0xd87f0e5d,
+    0x2a7303a3, 0x766ae09c, 0x8466ed62, 0x979e8d91, 0x6592806f,
+    0xb06e4c77, 0x42624189, 0x519a217a, 0xa3962c84, 0xc5e5b67a,
+    0x37e9bb84, 0x2411db77, 0xd61dd689, 0x03e11a91, 0xf1ed176f,
+    0xe215779c, 0x10197a62, 0x4c00995d, 0xbe0c94a3, 0xadf4f450,
+    0x5ff8f9ae, 0x8a0435b6, 0x78083848, 0x6bf058bb, 0x99fc5545,
+    0xd3c39ec5, 0x21cf933b, 0x3237f3c8, 0xc03bfe36, 0x15c7322e,
+    0xe7cb3fd0, 0xf4335f23, 0x063f52dd, 0x5a26b1e2, 0xa82abc1c,
+    0xbbd2dcef, 0x49ded111, 0x9c221d09, 0x6e2e10f7, 0x7dd67004,
+    0x8fda7dfa},
+   {0x00000000, 0x678efd01, 0xcf1dfa02, 0xa8930703, 0x9bd782f5,
+    0xfc597ff4, 0x54ca78f7, 0x334485f6, 0x3243731b, 0x55cd8e1a,
+    0xfd5e8919, 0x9ad07418, 0xa994f1ee, 0xce1a0cef, 0x66890bec,
+    0x0107f6ed, 0x6486e636, 0x03081b37, 0xab9b1c34, 0xcc15e135,
+    0xff5164c3, 0x98df99c2, 0x304c9ec1, 0x57c263c0, 0x56c5952d,
+    0x314b682c, 0x99d86f2f, 0xfe56922e, 0xcd1217d8, 0xaa9cead9,
+    0x020fedda, 0x658110db, 0xc90dcc6c, 0xae83316d, 0x0610366e,
+    0x619ecb6f, 0x52da4e99, 0x3554b398, 0x9dc7b49b, 0xfa49499a,
+    0xfb4ebf77, 0x9cc04276, 0x34534575, 0x53ddb874, 0x60993d82,
+    0x0717c083, 0xaf84c780, 0xc80a3a81, 0xad8b2a5a, 0xca05d75b,
+    0x6296d058, 0x05182d59, 0x365ca8af, 0x51d255ae, 0xf94152ad,
+    0x9ecfafac, 0x9fc85941, 0xf846a440, 0x50d5a343, 0x375b5e42,
+    0x041fdbb4, 0x639126b5, 0xcb0221b6, 0xac8cdcb7, 0x97f7ee29,
+    0xf0791328, 0x58ea142b, 0x3f64e92a, 0x0c206cdc, 0x6bae91dd,
+    0xc33d96de, 0xa4b36bdf, 0xa5b49d32, 0xc23a6033, 0x6aa96730,
+    0x0d279a31, 0x3e631fc7, 0x59ede2c6, 0xf17ee5c5, 0x96f018c4,
+    0xf371081f, 0x94fff51e, 0x3c6cf21d, 0x5be20f1c, 0x68a68aea,
+    0x0f2877eb, 0xa7bb70e8, 0xc0358de9, 0xc1327b04, 0xa6bc8605,
+    0x0e2f8106, 0x69a17c07, 0x5ae5f9f1, 0x3d6b04f0, 0x95f803f3,
+    0xf276fef2, 0x5efa2245, 0x3974df44, 0x91e7d847, 0xf6692546,
+    0xc52da0b0, 0xa2a35db1, 0x0a305ab2, 0x6dbea7b3, 0x6cb9515e,
+    0x0b37ac5f, 0xa3a4ab5c, 0xc42a565d, 0xf76ed3ab, 0x90e02eaa,
+    0x387329a9, 0x5ffdd4a8, 0x3a7cc473, 0x5df23972, 0xf5613e71,
+    0x92efc370, 0xa1ab4686, 0xc625bb87, 0x6eb6bc84, 0x09384185,
+    0x083fb768, 0x6fb14a69, 0xc7224d6a, 0xa0acb06b, 0x93e8359d,
+    0xf466c89c, 0x5cf5cf9f, 0x3b7b329e, 0x2a03aaa3, 0x4d8d57a2,
+    0xe51e50a1, 0x8290ada0, 0xb1d42856, 0xd65ad557, 0x7ec9d254,
+    0x19472f55, 0x1840d9b8, 0x7fce24b9, 0xd75d23ba, 0xb0d3debb,
+    0x83975b4d, 0xe419a64c, 0x4c8aa14f, 0x2b045c4e, 0x4e854c95,
+    0x290bb194, 0x8198b697, 0xe6164b96, 0xd552ce60, 0xb2dc3361,
+    0x1a4f3462, 0x7dc1c963, 0x7cc63f8e, 0x1b48c28f, 0xb3dbc58c,
+    0xd455388d, 0xe711bd7b, 0x809f407a, 0x280c4779, 0x4f82ba78,
+    0xe30e66cf, 0x84809bce, 0x2c139ccd, 0x4b9d61cc, 0x78d9e43a,
+    0x1f57193b, 0xb7c41e38, 0xd04ae339, 0xd14d15d4, 0xb6c3e8d5,
+    0x1e50efd6, 0x79de12d7, 0x4a9a9721, 0x2d146a20, 0x85876d23,
+    0xe2099022, 0x878880f9, 0xe0067df8, 0x48957afb, 0x2f1b87fa,
+    0x1c5f020c, 0x7bd1ff0d, 0xd342f80e, 0xb4cc050f, 0xb5cbf3e2,
+    0xd2450ee3, 0x7ad609e0, 0x1d58f4e1, 0x2e1c7117, 0x49928c16,
+    0xe1018b15, 0x868f7614, 0xbdf4448a, 0xda7ab98b, 0x72e9be88,
+    0x15674389, 0x2623c67f, 0x41ad3b7e, 0xe93e3c7d, 0x8eb0c17c,
+    0x8fb73791, 0xe839ca90, 0x40aacd93, 0x27243092, 0x1460b564,
+    0x73ee4865, 0xdb7d4f66, 0xbcf3b267, 0xd972a2bc, 0xbefc5fbd,
+    0x166f58be, 0x71e1a5bf, 0x42a52049, 0x252bdd48, 0x8db8da4b,
+    0xea36274a, 0xeb31d1a7, 0x8cbf2ca6, 0x242c2ba5, 0x43a2d6a4,
+    0x70e65352, 0x1768ae53, 0xbffba950, 0xd8755451, 0x74f988e6,
+    0x137775e7, 0xbbe472e4, 0xdc6a8fe5, 0xef2e0a13, 0x88a0f712,
+    0x2033f011, 0x47bd0d10, 0x46bafbfd, 0x213406fc, 0x89a701ff,
+    0xee29fcfe, 0xdd6d7908, 0xbae38409, 0x1270830a, 0x75fe7e0b,
+    0x107f6ed0, 0x77f193d1, 0xdf6294d2, 0xb8ec69d3, 0x8ba8ec25,
+    0xec261124, 0x44b51627, 0x233beb26, 0x223c1dcb, 0x45b2e0ca,
+    0xed21e7c9, 0x8aaf1ac8, 0xb9eb9f3e, 0xde65623f, 0x76f6653c,
+    0x1178983d},
+   {0x00000000, 0x54075546, 0xa80eaa8c, 0xfc09ffca, 0x55f123e9,
+    0x01f676af, 0xfdff8965, 0xa9f8dc23, 0xabe247d2, 0xffe51294,
+    0x03eced5e, 0x57ebb818, 0xfe13643b, 0xaa14317d, 0x561dceb7,
+    0x021a9bf1, 0x5228f955, 0x062fac13, 0xfa2653d9, 0xae21069f,
+    0x07d9dabc, 0x53de8ffa, 0xafd77030, 0xfbd02576, 0xf9cabe87,
+    0xadcdebc1, 0x51c4140b, 0x05c3414d, 0xac3b9d6e, 0xf83cc828,
+    0x043537e2, 0x503262a4, 0xa451f2aa, 0xf056a7ec, 0x0c5f5826,
+    0x58580d60, 0xf1a0d143, 0xa5a78405, 0x59ae7bcf, 0x0da92e89,
+    0x0fb3b578, 0x5bb4e03e, 0xa7bd1ff4, 0xf3ba4ab2, 0x5a429691,
+    0x0e45c3d7, 0xf24c3c1d, 0xa64b695b, 0xf6790bff, 0xa27e5eb9,
+    0x5e77a173, 0x0a70f435, 0xa3882816, 0xf78f7d50, 0x0b86829a,
+    0x5f81d7dc, 0x5d9b4c2d, 0x099c196b, 0xf595e6a1, 0xa192b3e7,
+    0x086a6fc4, 0x5c6d3a82, 0xa064c548, 0xf463900e, 0x4d4f93a5,
+    0x1948c6e3, 0xe5413929, 0xb1466c6f, 0x18beb04c, 0x4cb9e50a,
+    0xb0b01ac0, 0xe4b74f86, 0xe6add477, 0xb2aa8131, 0x4ea37efb,
+    0x1aa42bbd, 0xb35cf79e, 0xe75ba2d8, 0x1b525d12, 0x4f550854,
+    0x1f676af0, 0x4b603fb6, 0xb769c07c, 0xe36e953a, 0x4a964919,
+    0x1e911c5f, 0xe298e395, 0xb69fb6d3, 0xb4852d22, 0xe0827864,
+    0x1c8b87ae, 0x488cd2e8, 0xe1740ecb, 0xb5735b8d, 0x497aa447,
+    0x1d7df101, 0xe91e610f, 0xbd193449, 0x4110cb83, 0x15179ec5,
+    0xbcef42e6, 0xe8e817a0, 0x14e1e86a, 0x40e6bd2c, 0x42fc26dd,
+    0x16fb739b, 0xeaf28c51, 0xbef5d917, 0x170d0534, 0x430a5072,
+    0xbf03afb8, 0xeb04fafe, 0xbb36985a, 0xef31cd1c, 0x133832d6,
+    0x473f6790, 0xeec7bbb3, 0xbac0eef5, 0x46c9113f, 0x12ce4479,
+    0x10d4df88, 0x44d38ace, 0xb8da7504, 0xecdd2042, 0x4525fc61,
+    0x1122a927, 0xed2b56ed, 0xb92c03ab, 0x9a9f274a, 0xce98720c,
+    0x32918dc6, 0x6696d880, 0xcf6e04a3, 0x9b6951e5, 0x6760ae2f,
+    0x3367fb69, 0x317d6098, 0x657a35de, 0x9973ca14, 0xcd749f52,
+    0x648c4371, 0x308b1637, 0xcc82e9fd, 0x9885bcbb, 0xc8b7de1f,
+    0x9cb08b59, 0x60b97493, 0x34be21d5, 0x9d46fdf6, 0xc941a8b0,
+    0x3548577a, 0x614f023c, 0x635599cd, 0x3752cc8b, 0xcb5b3341,
+    0x9f5c6607, 0x36a4ba24, 0x62a3ef62, 0x9eaa10a8, 0xcaad45ee,
+    0x3eced5e0, 0x6ac980a6, 0x96c07f6c, 0xc2c72a2a, 0x6b3ff609,
+    0x3f38a34f, 0xc3315c85, 0x973609c3, 0x952c9232, 0xc12bc774,
+    0x3d2238be, 0x69256df8, 0xc0ddb1db, 0x94dae49d, 0x68d31b57,
+    0x3cd44e11, 0x6ce62cb5, 0x38e179f3, 0xc4e88639, 0x90efd37f,
+    0x39170f5c, 0x6d105a1a, 0x9119a5d0, 0xc51ef096, 0xc7046b67,
+    0x93033e21, 0x6f0ac1eb, 0x3b0d94ad, 0x92f5488e, 0xc6f21dc8,
+    0x3afbe202, 0x6efcb744, 0xd7d0b4ef, 0x83d7e1a9, 0x7fde1e63,
+    0x2bd94b25, 0x82219706, 0xd626c240, 0x2a2f3d8a, 0x7e2868cc,
+    0x7c32f33d, 0x2835a67b, 0xd43c59b1, 0x803b0cf7, 0x29c3d0d4,
+    0x7dc48592, 0x81cd7a58, 0xd5ca2f1e, 0x85f84dba, 0xd1ff18fc,
+    0x2df6e736, 0x79f1b270, 0xd0096e53, 0x840e3b15, 0x7807c4df,
+    0x2c009199, 0x2e1a0a68, 0x7a1d5f2e, 0x8614a0e4, 0xd213f5a2,
+    0x7beb2981, 0x2fec7cc7, 0xd3e5830d, 0x87e2d64b, 0x73814645,
+    0x27861303, 0xdb8fecc9, 0x8f88b98f, 0x267065ac, 0x727730ea,
+    0x8e7ecf20, 0xda799a66, 0xd8630197, 0x8c6454d1, 0x706dab1b,
+    0x246afe5d, 0x8d92227e, 0xd9957738, 0x259c88f2, 0x719bddb4,
+    0x21a9bf10, 0x75aeea56, 0x89a7159c, 0xdda040da, 0x74589cf9,
+    0x205fc9bf, 0xdc563675, 0x88516333, 0x8a4bf8c2, 0xde4cad84,
+    0x2245524e, 0x76420708, 0xdfbadb2b, 0x8bbd8e6d, 0x77b471a7,
+    0x23b324e1},
+   {0x00000000, 0x30d23865, 0x61a470ca, 0x517648af, 0xc348e194,
+    0xf39ad9f1, 0xa2ec915e, 0x923ea93b, 0x837db5d9, 0xb3af8dbc,
+    0xe2d9c513, 0xd20bfd76, 0x4035544d, 0x70e76c28, 0x21912487,
+    0x11431ce2, 0x03171d43, 0x33c52526, 0x62b36d89, 0x526155ec,
+    0xc05ffcd7, 0xf08dc4b2, 0xa1fb8c1d, 0x9129b478, 0x806aa89a,
+    0xb0b890ff, 0xe1ced850, 0xd11ce035, 0x4322490e, 0x73f0716b,
+    0x228639c4, 0x125401a1, 0x062e3a86, 0x36fc02e3, 0x678a4a4c,
+    0x57587229, 0xc566db12, 0xf5b4e377, 0xa4c2abd8, 0x941093bd,
+    0x85538f5f, 0xb581b73a, 0xe4f7ff95, 0xd425c7f0, 0x461b6ecb,
+    0x76c956ae, 0x27bf1e01, 0x176d2664, 0x053927c5, 0x35eb1fa0,
+    0x649d570f, 0x544f6f6a, 0xc671c651, 0xf6a3fe34, 0xa7d5b69b,
+    0x97078efe, 0x8644921c, 0xb696aa79, 0xe7e0e2d6, 0xd732dab3,
+    0x450c7388, 0x75de4bed, 0x24a80342, 0x147a3b27, 0x0c5c750c,
+    0x3c8e4d69, 0x6df805c6, 0x5d2a3da3, 0xcf149498, 0xffc6acfd,
+    0xaeb0e452, 0x9e62dc37, 0x8f21c0d5, 0xbff3f8b0, 0xee85b01f,
+    0xde57887a, 0x4c692141, 0x7cbb1924, 0x2dcd518b, 0x1d1f69ee,
+    0x0f4b684f, 0x3f99502a, 0x6eef1885, 0x5e3d20e0, 0xcc0389db,
+    0xfcd1b1be, 0xada7f911, 0x9d75c174, 0x8c36dd96, 0xbce4e5f3,
+    0xed92ad5c, 0xdd409539, 0x4f7e3c02, 0x7fac0467, 0x2eda4cc8,
+    0x1e0874ad, 0x0a724f8a, 0x3aa077ef, 0x6bd63f40, 0x5b040725,
+    0xc93aae1e, 0xf9e8967b, 0xa89eded4, 0x984ce6b1, 0x890ffa53,
+    0xb9ddc236, 0xe8ab8a99, 0xd879b2fc, 0x4a471bc7, 0x7a9523a2,
+    0x2be36b0d, 0x1b315368, 0x096552c9, 0x39b76aac, 0x68c12203,
+    0x58131a66, 0xca2db35d, 0xfaff8b38, 0xab89c397, 0x9b5bfbf2,
+    0x8a18e710, 0xbacadf75, 0xebbc97da, 0xdb6eafbf, 0x49500684,
+    0x79823ee1, 0x28f4764e, 0x18264e2b, 0x18b8ea18, 0x286ad27d,
+    0x791c9ad2, 0x49cea2b7, 0xdbf00b8c, 0xeb2233e9, 0xba547b46,
+    0x8a864323, 0x9bc55fc1, 0xab1767a4, 0xfa612f0b, 0xcab3176e,
+    0x588dbe55, 0x685f8630, 0x3929ce9f, 0x09fbf6fa, 0x1baff75b,
+    0x2b7dcf3e, 0x7a0b8791, 0x4ad9bff4, 0xd8e716cf, 0xe8352eaa,
+    0xb9436605, 0x89915e60, 0x98d24282, 0xa8007ae7, 0xf9763248,
+    0xc9a40a2d, 0x5b9aa316, 0x6b489b73, 0x3a3ed3dc, 0x0aecebb9,
+    0x1e96d09e, 0x2e44e8fb, 0x7f32a054, 0x4fe09831, 0xddde310a,
+    0xed0c096f, 0xbc7a41c0, 0x8ca879a5, 0x9deb6547, 0xad395d22,
+    0xfc4f158d, 0xcc9d2de8, 0x5ea384d3, 0x6e71bcb6, 0x3f07f419,
+    0x0fd5cc7c, 0x1d81cddd, 0x2d53f5b8, 0x7c25bd17, 0x4cf78572,
+    0xdec92c49, 0xee1b142c, 0xbf6d5c83, 0x8fbf64e6, 0x9efc7804,
+    0xae2e4061, 0xff5808ce, 0xcf8a30ab, 0x5db49990, 0x6d66a1f5,
+    0x3c10e95a, 0x0cc2d13f, 0x14e49f14, 0x2436a771, 0x7540efde,
+    0x4592d7bb, 0xd7ac7e80, 0xe77e46e5, 0xb6080e4a, 0x86da362f,
+    0x97992acd, 0xa74b12a8, 0xf63d5a07, 0xc6ef6262, 0x54d1cb59,
+    0x6403f33c, 0x3575bb93, 0x05a783f6, 0x17f38257, 0x2721ba32,
+    0x7657f29d, 0x4685caf8, 0xd4bb63c3, 0xe4695ba6, 0xb51f1309,
+    0x85cd2b6c, 0x948e378e, 0xa45c0feb, 0xf52a4744, 0xc5f87f21,
+    0x57c6d61a, 0x6714ee7f, 0x3662a6d0, 0x06b09eb5, 0x12caa592,
+    0x22189df7, 0x736ed558, 0x43bced3d, 0xd1824406, 0xe1507c63,
+    0xb02634cc, 0x80f40ca9, 0x91b7104b, 0xa165282e, 0xf0136081,
+    0xc0c158e4, 0x52fff1df, 0x622dc9ba, 0x335b8115, 0x0389b970,
+    0x11ddb8d1, 0x210f80b4, 0x7079c81b, 0x40abf07e, 0xd2955945,
+    0xe2476120, 0xb331298f, 0x83e311ea, 0x92a00d08, 0xa272356d,
+    0xf3047dc2, 0xc3d645a7, 0x51e8ec9c, 0x613ad4f9, 0x304c9c56,
+    0x009ea433},
+   {0x00000000, 0x3171d430, 0x62e3a860, 0x53927c50, 0xc5c750c0,
+    0xf4b684f0, 0xa724f8a0, 0x96552c90, 0x8e62d771, 0xbf130341,
+    0xec817f11, 0xddf0ab21, 0x4ba587b1, 0x7ad45381, 0x29462fd1,
+    0x1837fbe1, 0x1929d813, 0x28580c23, 0x7bca7073, 0x4abba443,
+    0xdcee88d3, 0xed9f5ce3, 0xbe0d20b3, 0x8f7cf483, 0x974b0f62,
+    0xa63adb52, 0xf5a8a702, 0xc4d97332, 0x528c5fa2, 0x63fd8b92,
+    0x306ff7c2, 0x011e23f2, 0x3253b026, 0x03226416, 0x50b01846,
+    0x61c1cc76, 0xf794e0e6, 0xc6e534d6, 0x95774886, 0xa4069cb6,
+    0xbc316757, 0x8d40b367, 0xded2cf37, 0xefa31b07, 0x79f63797,
+    0x4887e3a7, 0x1b159ff7, 0x2a644bc7, 0x2b7a6835, 0x1a0bbc05,
+    0x4999c055, 0x78e81465, 0xeebd38f5, 0xdfccecc5, 0x8c5e9095,
+    0xbd2f44a5, 0xa518bf44, 0x94696b74, 0xc7fb1724, 0xf68ac314,
+    0x60dfef84, 0x51ae3bb4, 0x023c47e4, 0x334d93d4, 0x64a7604c,
+    0x55d6b47c, 0x0644c82c, 0x37351c1c, 0xa160308c, 0x9011e4bc,
+    0xc38398ec, 0xf2f24cdc, 0xeac5b73d, 0xdbb4630d, 0x88261f5d,
+    0xb957cb6d, 0x2f02e7fd, 0x1e7333cd, 0x4de14f9d, 0x7c909bad,
+    0x7d8eb85f, 0x4cff6c6f, 0x1f6d103f, 0x2e1cc40f, 0xb849e89f,
+    0x89383caf, 0xdaaa40ff, 0xebdb94cf, 0xf3ec6f2e, 0xc29dbb1e,
+    0x910fc74e, 0xa07e137e, 0x362b3fee, 0x075aebde, 0x54c8978e,
+    0x65b943be, 0x56f4d06a, 0x6785045a, 0x3417780a, 0x0566ac3a,
+    0x933380aa, 0xa242549a, 0xf1d028ca, 0xc0a1fcfa, 0xd896071b,
+    0xe9e7d32b, 0xba75af7b, 0x8b047b4b, 0x1d5157db, 0x2c2083eb,
+    0x7fb2ffbb, 0x4ec32b8b, 0x4fdd0879, 0x7eacdc49, 0x2d3ea019,
+    0x1c4f7429, 0x8a1a58b9, 0xbb6b8c89, 0xe8f9f0d9, 0xd98824e9,
+    0xc1bfdf08, 0xf0ce0b38, 0xa35c7768, 0x922da358, 0x04788fc8,
+    0x35095bf8, 0x669b27a8, 0x57eaf398, 0xc94ec098, 0xf83f14a8,
+    0xabad68f8, 0x9adcbcc8, 0x0c899058, 0x3df84468, 0x6e6a3838,
+    0x5f1bec08, 0x472c17e9, 0x765dc3d9, 0x25cfbf89, 0x14be6bb9,
+    0x82eb4729, 0xb39a9319, 0xe008ef49, 0xd1793b79, 0xd067188b,
+    0xe116ccbb, 0xb284b0eb, 0x83f564db, 0x15a0484b, 0x24d19c7b,
+    0x7743e02b, 0x4632341b, 0x5e05cffa, 0x6f741bca, 0x3ce6679a,
+    0x0d97b3aa, 0x9bc29f3a, 0xaab34b0a, 0xf921375a, 0xc850e36a,
+    0xfb1d70be, 0xca6ca48e, 0x99fed8de, 0xa88f0cee, 0x3eda207e,
+    0x0fabf44e, 0x5c39881e, 0x6d485c2e, 0x757fa7cf, 0x440e73ff,
+    0x179c0faf, 0x26eddb9f, 0xb0b8f70f, 0x81c9233f, 0xd25b5f6f,
+    0xe32a8b5f, 0xe234a8ad, 0xd3457c9d, 0x80d700cd, 0xb1a6d4fd,
+    0x27f3f86d, 0x16822c5d, 0x4510500d, 0x7461843d, 0x6c567fdc,
+    0x5d27abec, 0x0eb5d7bc, 0x3fc4038c, 0xa9912f1c, 0x98e0fb2c,
+    0xcb72877c, 0xfa03534c, 0xade9a0d4, 0x9c9874e4, 0xcf0a08b4,
+    0xfe7bdc84, 0x682ef014, 0x595f2424, 0x0acd5874, 0x3bbc8c44,
+    0x238b77a5, 0x12faa395, 0x4168dfc5, 0x70190bf5, 0xe64c2765,
+    0xd73df355, 0x84af8f05, 0xb5de5b35, 0xb4c078c7, 0x85b1acf7,
+    0xd623d0a7, 0xe7520497, 0x71072807, 0x4076fc37, 0x13e48067,
+    0x22955457, 0x3aa2afb6, 0x0bd37b86, 0x584107d6, 0x6930d3e6,
+    0xff65ff76, 0xce142b46, 0x9d865716, 0xacf78326, 0x9fba10f2,
+    0xaecbc4c2, 0xfd59b892, 0xcc286ca2, 0x5a7d4032, 0x6b0c9402,
+    0x389ee852, 0x09ef3c62, 0x11d8c783, 0x20a913b3, 0x733b6fe3,
+    0x424abbd3, 0xd41f9743, 0xe56e4373, 0xb6fc3f23, 0x878deb13,
+    0x8693c8e1, 0xb7e21cd1, 0xe4706081, 0xd501b4b1, 0x43549821,
+    0x72254c11, 0x21b73041, 0x10c6e471, 0x08f11f90, 0x3980cba0,
+    0x6a12b7f0, 0x5b6363c0, 0xcd364f50, 0xfc479b60, 0xafd5e730,
+    0x9ea43300},
+   {0x00000000, 0x9771f7c1, 0x2b0f9973, 0xbc7e6eb2, 0x561f32e6,
+    0xc16ec527, 0x7d10ab95, 0xea615c54, 0xac3e65cc, 0x3b4f920d,
+    0x8731fcbf, 0x10400b7e, 0xfa21572a, 0x6d50a0eb, 0xd12ece59,
+    0x465f3998, 0x5d90bd69, 0xcae14aa8, 0x769f241a, 0xe1eed3db,
+    0x0b8f8f8f, 0x9cfe784e, 0x208016fc, 0xb7f1e13d, 0xf1aed8a5,
+    0x66df2f64, 0xdaa141d6, 0x4dd0b617, 0xa7b1ea43, 0x30c01d82,
+    0x8cbe7330, 0x1bcf84f1, 0xbb217ad2, 0x2c508d13, 0x902ee3a1,
+    0x075f1460, 0xed3e4834, 0x7a4fbff5, 0xc631d147, 0x51402686,
+    0x171f1f1e, 0x806ee8df, 0x3c10866d, 0xab6171ac, 0x41002df8,
+    0xd671da39, 0x6a0fb48b, 0xfd7e434a, 0xe6b1c7bb, 0x71c0307a,
+    0xcdbe5ec8, 0x5acfa909, 0xb0aef55d, 0x27df029c, 0x9ba16c2e,
+    0x0cd09bef, 0x4a8fa277, 0xddfe55b6, 0x61803b04, 0xf6f1ccc5,
+    0x1c909091, 0x8be16750, 0x379f09e2, 0xa0eefe23, 0x73ae8355,
+    0xe4df7494, 0x58a11a26, 0xcfd0ede7, 0x25b1b1b3, 0xb2c04672,
+    0x0ebe28c0, 0x99cfdf01, 0xdf90e699, 0x48e11158, 0xf49f7fea,
+    0x63ee882b, 0x898fd47f, 0x1efe23be, 0xa2804d0c, 0x35f1bacd,
+    0x2e3e3e3c, 0xb94fc9fd, 0x0531a74f, 0x9240508e, 0x78210cda,
+    0xef50fb1b, 0x532e95a9, 0xc45f6268, 0x82005bf0, 0x1571ac31,
+    0xa90fc283, 0x3e7e3542, 0xd41f6916, 0x436e9ed7, 0xff10f065,
+    0x686107a4, 0xc88ff987, 0x5ffe0e46, 0xe38060f4, 0x74f19735,
+    0x9e90cb61, 0x09e13ca0, 0xb59f5212, 0x22eea5d3, 0x64b19c4b,
+    0xf3c06b8a, 0x4fbe0538, 0xd8cff2f9, 0x32aeaead, 0xa5df596c,
+    0x19a137de, 0x8ed0c01f, 0x951f44ee, 0x026eb32f, 0xbe10dd9d,
+    0x29612a5c, 0xc3007608, 0x547181c9, 0xe80fef7b, 0x7f7e18ba,
+    0x39212122, 0xae50d6e3, 0x122eb851, 0x855f4f90, 0x6f3e13c4,
+    0xf84fe405, 0x44318ab7, 0xd3407d76, 0xe75d06aa, 0x702cf16b,
+    0xcc529fd9, 0x5b236818, 0xb142344c, 0x2633c38d, 0x9a4dad3f,
+    0x0d3c5afe, 0x4b636366, 0xdc1294a7, 0x606cfa15, 0xf71d0dd4,
+    0x1d7c5180, 0x8a0da641, 0x3673c8f3, 0xa1023f32, 0xbacdbbc3,
+    0x2dbc4c02, 0x91c222b0, 0x06b3d571, 0xecd28925, 0x7ba37ee4,
+    0xc7dd1056, 0x50ace797, 0x16f3de0f, 0x818229ce, 0x3dfc477c,
+    0xaa8db0bd, 0x40ecece9, 0xd79d1b28, 0x6be3759a, 0xfc92825b,
+    0x5c7c7c78, 0xcb0d8bb9, 0x7773e50b, 0xe00212ca, 0x0a634e9e,
+    0x9d12b95f, 0x216cd7ed, 0xb61d202c, 0xf04219b4, 0x6733ee75,
+    0xdb4d80c7, 0x4c3c7706, 0xa65d2b52, 0x312cdc93, 0x8d52b221,
+    0x1a2345e0, 0x01ecc111, 0x969d36d0, 0x2ae35862, 0xbd92afa3,
+    0x57f3f3f7, 0xc0820436, 0x7cfc6a84, 0xeb8d9d45, 0xadd2a4dd,
+    0x3aa3531c, 0x86dd3dae, 0x11acca6f, 0xfbcd963b, 0x6cbc61fa,
+    0xd0c20f48, 0x47b3f889, 0x94f385ff, 0x0382723e, 0xbffc1c8c,
+    0x288deb4d, 0xc2ecb719, 0x559d40d8, 0xe9e32e6a, 0x7e92d9ab,
+    0x38cde033, 0xafbc17f2, 0x13c27940, 0x84b38e81, 0x6ed2d2d5,
+    0xf9a32514, 0x45dd4ba6, 0xd2acbc67, 0xc9633896, 0x5e12cf57,
+    0xe26ca1e5, 0x751d5624, 0x9f7c0a70, 0x080dfdb1, 0xb4739303,
+    0x230264c2, 0x655d5d5a, 0xf22caa9b, 0x4e52c429, 0xd92333e8,
+    0x33426fbc, 0xa433987d, 0x184df6cf, 0x8f3c010e, 0x2fd2ff2d,
+    0xb8a308ec, 0x04dd665e, 0x93ac919f, 0x79cdcdcb, 0xeebc3a0a,
+    0x52c254b8, 0xc5b3a379, 0x83ec9ae1, 0x149d6d20, 0xa8e30392,
+    0x3f92f453, 0xd5f3a807, 0x42825fc6, 0xfefc3174, 0x698dc6b5,
+    0x72424244, 0xe533b585, 0x594ddb37, 0xce3c2cf6, 0x245d70a2,
+    0xb32c8763, 0x0f52e9d1, 0x98231e10, 0xde7c2788, 0x490dd049,
+    0xf573befb, 0x6202493a, 0x8863156e, 0x1f12e2af, 0xa36c8c1d,
+    0x341d7bdc},
+   {0x00000000, 0xcb567ba5, 0x934081bb, 0x5816fa1e, 0x236d7587,
+    0xe83b0e22, 0xb02df43c, 0x7b7b8f99, 0x46daeb0e, 0x8d8c90ab,
+    0xd59a6ab5, 0x1ecc1110, 0x65b79e89, 0xaee1e52c, 0xf6f71f32,
+    0x3da16497, 0x8db5d61c, 0x46e3adb9, 0x1ef557a7, 0xd5a32c02,
+    0xaed8a39b, 0x658ed83e, 0x3d982220, 0xf6ce5985, 0xcb6f3d12,
+    0x003946b7, 0x582fbca9, 0x9379c70c, 0xe8024895, 0x23543330,
+    0x7b42c92e, 0xb014b28b, 0x1e87dac9, 0xd5d1a16c, 0x8dc75b72,
+    0x469120d7, 0x3deaaf4e, 0xf6bcd4eb, 0xaeaa2ef5, 0x65fc5550,
+    0x585d31c7, 0x930b4a62, 0xcb1db07c, 0x004bcbd9, 0x7b304440,
+    0xb0663fe5, 0xe870c5fb, 0x2326be5e, 0x93320cd5, 0x58647770,
+    0x00728d6e, 0xcb24f6cb, 0xb05f7952, 0x7b0902f7, 0x231ff8e9,
+    0xe849834c, 0xd5e8e7db, 0x1ebe9c7e, 0x46a86660, 0x8dfe1dc5,
+    0xf685925c, 0x3dd3e9f9, 0x65c513e7, 0xae936842, 0x3d0fb592,
+    0xf659ce37, 0xae4f3429, 0x65194f8c, 0x1e62c015, 0xd534bbb0,
+    0x8d2241ae, 0x46743a0b, 0x7bd55e9c, 0xb0832539, 0xe895df27,
+    0x23c3a482, 0x58b82b1b, 0x93ee50be, 0xcbf8aaa0, 0x00aed105,
+    0xb0ba638e, 0x7bec182b, 0x23fae235, 0xe8ac9990, 0x93d71609,
+    0x58816dac, 0x009797b2, 0xcbc1ec17, 0xf6608880, 0x3d36f325,
+    0x6520093b, 0xae76729e, 0xd50dfd07, 0x1e5b86a2, 0x464d7cbc,
+    0x8d1b0719, 0x23886f5b, 0xe8de14fe, 0xb0c8eee0, 0x7b9e9545,
+    0x00e51adc, 0xcbb36179, 0x93a59b67, 0x58f3e0c2, 0x65528455,
+    0xae04fff0, 0xf61205ee, 0x3d447e4b, 0x463ff1d2, 0x8d698a77,
+    0xd57f7069, 0x1e290bcc, 0xae3db947, 0x656bc2e2, 0x3d7d38fc,
+    0xf62b4359, 0x8d50ccc0, 0x4606b765, 0x1e104d7b, 0xd54636de,
+    0xe8e75249, 0x23b129ec, 0x7ba7d3f2, 0xb0f1a857, 0xcb8a27ce,
+    0x00dc5c6b, 0x58caa675, 0x939cddd0, 0x7a1f6b24, 0xb1491081,
+    0xe95fea9f, 0x2209913a, 0x59721ea3, 0x92246506, 0xca329f18,
+    0x0164e4bd, 0x3cc5802a, 0xf793fb8f, 0xaf850191, 0x64d37a34,
+    0x1fa8f5ad, 0xd4fe8e08, 0x8ce87416, 0x47be0fb3, 0xf7aabd38,
+    0x3cfcc69d, 0x64ea3c83, 0xafbc4726, 0xd4c7c8bf, 0x1f91b31a,
+    0x47874904, 0x8cd132a1, 0xb1705636, 0x7a262d93, 0x2230d78d,
+    0xe966ac28, 0x921d23b1, 0x594b5814, 0x015da20a, 0xca0bd9af,
+    0x6498b1ed, 0xafceca48, 0xf7d83056, 0x3c8e4bf3, 0x47f5c46a,
+    0x8ca3bfcf, 0xd4b545d1, 0x1fe33e74, 0x22425ae3, 0xe9142146,
+    0xb102db58, 0x7a54a0fd, 0x012f2f64, 0xca7954c1, 0x926faedf,
+    0x5939d57a, 0xe92d67f1, 0x227b1c54, 0x7a6de64a, 0xb13b9def,
+    0xca401276, 0x011669d3, 0x590093cd, 0x9256e868, 0xaff78cff,
+    0x64a1f75a, 0x3cb70d44, 0xf7e176e1, 0x8c9af978, 0x47cc82dd,
+    0x1fda78c3, 0xd48c0366, 0x4710deb6, 0x8c46a513, 0xd4505f0d,
+    0x1f0624a8, 0x647dab31, 0xaf2bd094, 0xf73d2a8a, 0x3c6b512f,
+    0x01ca35b8, 0xca9c4e1d, 0x928ab403, 0x59dccfa6, 0x22a7403f,
+    0xe9f13b9a, 0xb1e7c184, 0x7ab1ba21, 0xcaa508aa, 0x01f3730f,
+    0x59e58911, 0x92b3f2b4, 0xe9c87d2d, 0x229e0688, 0x7a88fc96,
+    0xb1de8733, 0x8c7fe3a4, 0x47299801, 0x1f3f621f, 0xd46919ba,
+    0xaf129623, 0x6444ed86, 0x3c521798, 0xf7046c3d, 0x5997047f,
+    0x92c17fda, 0xcad785c4, 0x0181fe61, 0x7afa71f8, 0xb1ac0a5d,
+    0xe9baf043, 0x22ec8be6, 0x1f4def71, 0xd41b94d4, 0x8c0d6eca,
+    0x475b156f, 0x3c209af6, 0xf776e153, 0xaf601b4d, 0x643660e8,
+    0xd422d263, 0x1f74a9c6, 0x476253d8, 0x8c34287d, 0xf74fa7e4,
+    0x3c19dc41, 0x640f265f, 0xaf595dfa, 0x92f8396d, 0x59ae42c8,
+    0x01b8b8d6, 0xcaeec373, 0xb1954cea, 0x7ac3374f, 0x22d5cd51,
+    0xe983b6f4},
+   {0x00000000, 0xf43ed648, 0xed91da61, 0x19af0c29, 0xdecfc233,
+    0x2af1147b, 0x335e1852, 0xc760ce1a, 0xb873f297, 0x4c4d24df,
+    0x55e228f6, 0xa1dcfebe, 0x66bc30a4, 0x9282e6ec, 0x8b2deac5,
+    0x7f133c8d, 0x750b93df, 0x81354597, 0x989a49be, 0x6ca49ff6,
+    0xabc451ec, 0x5ffa87a4, 0x46558b8d, 0xb26b5dc5, 0xcd786148,
+    0x3946b700, 0x20e9bb29, 0xd4d76d61, 0x13b7a37b, 0xe7897533,
+    0xfe26791a, 0x0a18af52, 0xea1727be, 0x1e29f1f6, 0x0786fddf,
+    0xf3b82b97, 0x34d8e58d, 0xc0e633c5, 0xd9493fec, 0x2d77e9a4,
+    0x5264d529, 0xa65a0361, 0xbff50f48, 0x4bcbd900, 0x8cab171a,
+    0x7895c152, 0x613acd7b, 0x95041b33, 0x9f1cb461, 0x6b226229,
+    0x728d6e00, 0x86b3b848, 0x41d37652, 0xb5eda01a, 0xac42ac33,
+    0x587c7a7b, 0x276f46f6, 0xd35190be, 0xcafe9c97, 0x3ec04adf,
+    0xf9a084c5, 0x0d9e528d, 0x14315ea4, 0xe00f88ec, 0xd1c2398d,
+    0x25fcefc5, 0x3c53e3ec, 0xc86d35a4, 0x0f0dfbbe, 0xfb332df6,
+    0xe29c21df, 0x16a2f797, 0x69b1cb1a, 0x9d8f1d52, 0x8420117b,
+    0x701ec733, 0xb77e0929, 0x4340df61, 0x5aefd348, 0xaed10500,
+    0xa4c9aa52, 0x50f77c1a, 0x49587033, 0xbd66a67b, 0x7a066861,
+    0x8e38be29, 0x9797b200, 0x63a96448, 0x1cba58c5, 0xe8848e8d,
+    0xf12b82a4, 0x051554ec, 0xc2759af6, 0x364b4cbe, 0x2fe44097,
+    0xdbda96df, 0x3bd51e33, 0xcfebc87b, 0xd644c452, 0x227a121a,
+    0xe51adc00, 0x11240a48, 0x088b0661, 0xfcb5d029, 0x83a6eca4,
+    0x77983aec, 0x6e3736c5, 0x9a09e08d, 0x5d692e97, 0xa957f8df,
+    0xb0f8f4f6, 0x44c622be, 0x4ede8dec, 0xbae05ba4, 0xa34f578d,
+    0x577181c5, 0x90114fdf, 0x642f9997, 0x7d8095be, 0x89be43f6,
+    0xf6ad7f7b, 0x0293a933, 0x1b3ca51a, 0xef027352, 0x2862bd48,
+    0xdc5c6b00, 0xc5f36729, 0x31cdb161, 0xa66805eb, 0x5256d3a3,
+    0x4bf9df8a, 0xbfc709c2, 0x78a7c7d8, 0x8c991190, 0x95361db9,
+    0x6108cbf1, 0x1e1bf77c, 0xea252134, 0xf38a2d1d, 0x07b4fb55,
+    0xc0d4354f, 0x34eae307, 0x2d45ef2e, 0xd97b3966, 0xd3639634,
+    0x275d407c, 0x3ef24c55, 0xcacc9a1d, 0x0dac5407, 0xf992824f,
+    0xe03d8e66, 0x1403582e, 0x6b1064a3, 0x9f2eb2eb, 0x8681bec2,
+    0x72bf688a, 0xb5dfa690, 0x41e170d8, 0x584e7cf1, 0xac70aab9,
+    0x4c7f2255, 0xb841f41d, 0xa1eef834, 0x55d02e7c, 0x92b0e066,
+    0x668e362e, 0x7f213a07, 0x8b1fec4f, 0xf40cd0c2, 0x0032068a,
+    0x199d0aa3, 0xeda3dceb, 0x2ac312f1, 0xdefdc4b9, 0xc752c890,
+    0x336c1ed8, 0x3974b18a, 0xcd4a67c2, 0xd4e56beb, 0x20dbbda3,
+    0xe7bb73b9, 0x1385a5f1, 0x0a2aa9d8, 0xfe147f90, 0x8107431d,
+    0x75399555, 0x6c96997c, 0x98a84f34, 0x5fc8812e, 0xabf65766,
+    0xb2595b4f, 0x46678d07, 0x77aa3c66, 0x8394ea2e, 0x9a3be607,
+    0x6e05304f, 0xa965fe55, 0x5d5b281d, 0x44f42434, 0xb0caf27c,
+    0xcfd9cef1, 0x3be718b9, 0x22481490, 0xd676c2d8, 0x11160cc2,
+    0xe528da8a, 0xfc87d6a3, 0x08b900eb, 0x02a1afb9, 0xf69f79f1,
+    0xef3075d8, 0x1b0ea390, 0xdc6e6d8a, 0x2850bbc2, 0x31ffb7eb,
+    0xc5c161a3, 0xbad25d2e, 0x4eec8b66, 0x5743874f, 0xa37d5107,
+    0x641d9f1d, 0x90234955, 0x898c457c, 0x7db29334, 0x9dbd1bd8,
+    0x6983cd90, 0x702cc1b9, 0x841217f1, 0x4372d9eb, 0xb74c0fa3,
+    0xaee3038a, 0x5addd5c2, 0x25cee94f, 0xd1f03f07, 0xc85f332e,
+    0x3c61e566, 0xfb012b7c, 0x0f3ffd34, 0x1690f11d, 0xe2ae2755,
+    0xe8b68807, 0x1c885e4f, 0x05275266, 0xf119842e, 0x36794a34,
+    0xc2479c7c, 0xdbe89055, 0x2fd6461d, 0x50c57a90, 0xa4fbacd8,
+    0xbd54a0f1, 0x496a76b9, 0x8e0ab8a3, 0x7a346eeb, 0x639b62c2,
+    0x97a5b48a}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0x48d63ef400000000, 0x61da91ed00000000,
+    0x290caf1900000000, 0x33c2cfde00000000, 0x7b14f12a00000000,
+    0x52185e3300000000, 0x1ace60c700000000, 0x97f273b800000000,
+    0xdf244d4c00000000, 0xf628e25500000000, 0xbefedca100000000,
+    0xa430bc6600000000, 0xece6829200000000, 0xc5ea2d8b00000000,
+    0x8d3c137f00000000, 0xdf930b7500000000, 0x9745358100000000,
+    0xbe499a9800000000, 0xf69fa46c00000000, 0xec51c4ab00000000,
+    0xa487fa5f00000000, 0x8d8b554600000000, 0xc55d6bb200000000,
+    0x486178cd00000000, 0x00b7463900000000, 0x29bbe92000000000,
+    0x616dd7d400000000, 0x7ba3b71300000000, 0x337589e700000000,
+    0x1a7926fe00000000, 0x52af180a00000000, 0xbe2717ea00000000,
+    0xf6f1291e00000000, 0xdffd860700000000, 0x972bb8f300000000,
+    0x8de5d83400000000, 0xc533e6c000000000, 0xec3f49d900000000,
+    0xa4e9772d00000000, 0x29d5645200000000, 0x61035aa600000000,
+    0x480ff5bf00000000, 0x00d9cb4b00000000, 0x1a17ab8c00000000,
+    0x52c1957800000000, 0x7bcd3a6100000000, 0x331b049500000000,
+    0x61b41c9f00000000, 0x2962226b00000000, 0x006e8d7200000000,
+    0x48b8b38600000000, 0x5276d34100000000, 0x1aa0edb500000000,
+    0x33ac42ac00000000, 0x7b7a7c5800000000, 0xf6466f2700000000,
+    0xbe9051d300000000, 0x979cfeca00000000, 0xdf4ac03e00000000,
+    0xc584a0f900000000, 0x8d529e0d00000000, 0xa45e311400000000,
+    0xec880fe000000000, 0x8d39c2d100000000, 0xc5effc2500000000,
+    0xece3533c00000000, 0xa4356dc800000000, 0xbefb0d0f00000000,
+    0xf62d33fb00000000, 0xdf219ce200000000, 0x97f7a21600000000,
+    0x1acbb16900000000, 0x521d8f9d00000000, 0x7b11208400000000,
+    0x33c71e7000000000, 0x29097eb700000000, 0x61df404300000000,
+    0x48d3ef5a00000000, 0x0005d1ae00000000, 0x52aac9a400000000,
+    0x1a7cf75000000000, 0x3370584900000000, 0x7ba666bd00000000,
+    0x6168067a00000000, 0x29be388e00000000, 0x00b2979700000000,
+    0x4864a96300000000, 0xc558ba1c00000000, 0x8d8e84e800000000,
+    0xa4822bf100000000, 0xec54150500000000, 0xf69a75c200000000,
+    0xbe4c4b3600000000, 0x9740e42f00000000, 0xdf96dadb00000000,
+    0x331ed53b00000000, 0x7bc8ebcf00000000, 0x52c444d600000000,
+    0x1a127a2200000000, 0x00dc1ae500000000, 0x480a241100000000,
+    0x61068b0800000000, 0x29d0b5fc00000000, 0xa4eca68300000000,
+    0xec3a987700000000, 0xc536376e00000000, 0x8de0099a00000000,
+    0x972e695d00000000, 0xdff857a900000000, 0xf6f4f8b000000000,
+    0xbe22c64400000000, 0xec8dde4e00000000, 0xa45be0ba00000000,
+    0x8d574fa300000000, 0xc581715700000000, 0xdf4f119000000000,
+    0x97992f6400000000, 0xbe95807d00000000, 0xf643be8900000000,
+    0x7b7fadf600000000, 0x33a9930200000000, 0x1aa53c1b00000000,
+    0x527302ef00000000, 0x48bd622800000000, 0x006b5cdc00000000,
+    0x2967f3c500000000, 0x61b1cd3100000000, 0xeb0568a600000000,
+    0xa3d3565200000000, 0x8adff94b00000000, 0xc209c7bf00000000,
+    0xd8c7a77800000000, 0x9011998c00000000, 0xb91d369500000000,
+    0xf1cb086100000000, 0x7cf71b1e00000000, 0x342125ea00000000,
+    0x1d2d8af300000000, 0x55fbb40700000000, 0x4f35d4c000000000,
+    0x07e3ea3400000000, 0x2eef452d00000000, 0x66397bd900000000,
+    0x349663d300000000, 0x7c405d2700000000, 0x554cf23e00000000,
+    0x1d9accca00000000, 0x0754ac0d00000000, 0x4f8292f900000000,
+    0x668e3de000000000, 0x2e58031400000000, 0xa364106b00000000,
+    0xebb22e9f00000000, 0xc2be818600000000, 0x8a68bf7200000000,
+    0x90a6dfb500000000, 0xd870e14100000000, 0xf17c4e5800000000,
+    0xb9aa70ac00000000, 0x55227f4c00000000, 0x1df441b800000000,
+    0x34f8eea100000000, 0x7c2ed05500000000, 0x66e0b09200000000,
+    0x2e368e6600000000, 0x073a217f00000000, 0x4fec1f8b00000000,
+    0xc2d00cf400000000, 0x8a06320000000000, 0xa30a9d1900000000,
+    0xebdca3ed00000000, 0xf112c32a00000000, 0xb9c4fdde00000000,
+    0x90c852c700000000, 0xd81e6c3300000000, 0x8ab1743900000000,
+    0xc2674acd00000000, 0xeb6be5d400000000, 0xa3bddb2000000000,
+    0xb973bbe700000000, 0xf1a5851300000000, 0xd8a92a0a00000000,
+    0x907f14fe00000000, 0x1d43078100000000, 0x5595397500000000,
+    0x7c99966c00000000, 0x344fa89800000000, 0x2e81c85f00000000,
+    0x6657f6ab00000000, 0x4f5b59b200000000, 0x078d674600000000,
+    0x663caa7700000000, 0x2eea948300000000, 0x07e63b9a00000000,
+    0x4f30056e00000000, 0x55fe65a900000000, 0x1d285b5d00000000,
+    0x3424f44400000000, 0x7cf2cab000000000, 0xf1ced9cf00000000,
+    0xb918e73b00000000, 0x9014482200000000, 0xd8c276d600000000,
+    0xc20c161100000000, 0x8ada28e500000000, 0xa3d687fc00000000,
+    0xeb00b90800000000, 0xb9afa10200000000, 0xf1799ff600000000,
+    0xd87530ef00000000, 0x90a30e1b00000000, 0x8a6d6edc00000000,
+    0xc2bb502800000000, 0xebb7ff3100000000, 0xa361c1c500000000,
+    0x2e5dd2ba00000000, 0x668bec4e00000000, 0x4f87435700000000,
+    0x07517da300000000, 0x1d9f1d6400000000, 0x5549239000000000,
+    0x7c458c8900000000, 0x3493b27d00000000, 0xd81bbd9d00000000,
+    0x90cd836900000000, 0xb9c12c7000000000, 0xf117128400000000,
+    0xebd9724300000000, 0xa30f4cb700000000, 0x8a03e3ae00000000,
+    0xc2d5dd5a00000000, 0x4fe9ce2500000000, 0x073ff0d100000000,
+    0x2e335fc800000000, 0x66e5613c00000000, 0x7c2b01fb00000000,
+    0x34fd3f0f00000000, 0x1df1901600000000, 0x5527aee200000000,
+    0x0788b6e800000000, 0x4f5e881c00000000, 0x6652270500000000,
+    0x2e8419f100000000, 0x344a793600000000, 0x7c9c47c200000000,
+    0x5590e8db00000000, 0x1d46d62f00000000, 0x907ac55000000000,
+    0xd8acfba400000000, 0xf1a054bd00000000, 0xb9766a4900000000,
+    0xa3b80a8e00000000, 0xeb6e347a00000000, 0xc2629b6300000000,
+    0x8ab4a59700000000},
+   {0x0000000000000000, 0xa57b56cb00000000, 0xbb81409300000000,
+    0x1efa165800000000, 0x87756d2300000000, 0x220e3be800000000,
+    0x3cf42db000000000, 0x998f7b7b00000000, 0x0eebda4600000000,
+    0xab908c8d00000000, 0xb56a9ad500000000, 0x1011cc1e00000000,
+    0x899eb76500000000, 0x2ce5e1ae00000000, 0x321ff7f600000000,
+    0x9764a13d00000000, 0x1cd6b58d00000000, 0xb9ade34600000000,
+    0xa757f51e00000000, 0x022ca3d500000000, 0x9ba3d8ae00000000,
+    0x3ed88e6500000000, 0x2022983d00000000, 0x8559cef600000000,
+    0x123d6fcb00000000, 0xb746390000000000, 0xa9bc2f5800000000,
+    0x0cc7799300000000, 0x954802e800000000, 0x3033542300000000,
+    0x2ec9427b00000000, 0x8bb214b000000000, 0xc9da871e00000000,
+    0x6ca1d1d500000000, 0x725bc78d00000000, 0xd720914600000000,
+    0x4eafea3d00000000, 0xebd4bcf600000000, 0xf52eaaae00000000,
+    0x5055fc6500000000, 0xc7315d5800000000, 0x624a0b9300000000,
+    0x7cb01dcb00000000, 0xd9cb4b0000000000, 0x4044307b00000000,
+    0xe53f66b000000000, 0xfbc570e800000000, 0x5ebe262300000000,
+    0xd50c329300000000, 0x7077645800000000, 0x6e8d720000000000,
+    0xcbf624cb00000000, 0x52795fb000000000, 0xf702097b00000000,
+    0xe9f81f2300000000, 0x4c8349e800000000, 0xdbe7e8d500000000,
+    0x7e9cbe1e00000000, 0x6066a84600000000, 0xc51dfe8d00000000,
+    0x5c9285f600000000, 0xf9e9d33d00000000, 0xe713c56500000000,
+    0x426893ae00000000, 0x92b50f3d00000000, 0x37ce59f600000000,
+    0x29344fae00000000, 0x8c4f196500000000, 0x15c0621e00000000,
+    0xb0bb34d500000000, 0xae41228d00000000, 0x0b3a744600000000,
+    0x9c5ed57b00000000, 0x392583b000000000, 0x27df95e800000000,
+    0x82a4c32300000000, 0x1b2bb85800000000, 0xbe50ee9300000000,
+    0xa0aaf8cb00000000, 0x05d1ae0000000000, 0x8e63bab000000000,
+    0x2b18ec7b00000000, 0x35e2fa2300000000, 0x9099ace800000000,
+    0x0916d79300000000, 0xac6d815800000000, 0xb297970000000000,
+    0x17ecc1cb00000000, 0x808860f600000000, 0x25f3363d00000000,
+    0x3b09206500000000, 0x9e7276ae00000000, 0x07fd0dd500000000,
+    0xa2865b1e00000000, 0xbc7c4d4600000000, 0x19071b8d00000000,
+    0x5b6f882300000000, 0xfe14dee800000000, 0xe0eec8b000000000,
+    0x45959e7b00000000, 0xdc1ae50000000000, 0x7961b3cb00000000,
+    0x679ba59300000000, 0xc2e0f35800000000, 0x5584526500000000,
+    0xf0ff04ae00000000, 0xee0512f600000000, 0x4b7e443d00000000,
+    0xd2f13f4600000000, 0x778a698d00000000, 0x69707fd500000000,
+    0xcc0b291e00000000, 0x47b93dae00000000, 0xe2c26b6500000000,
+    0xfc387d3d00000000, 0x59432bf600000000, 0xc0cc508d00000000,
+    0x65b7064600000000, 0x7b4d101e00000000, 0xde3646d500000000,
+    0x4952e7e800000000, 0xec29b12300000000, 0xf2d3a77b00000000,
+    0x57a8f1b000000000, 0xce278acb00000000, 0x6b5cdc0000000000,
+    0x75a6ca5800000000, 0xd0dd9c9300000000, 0x246b1f7a00000000,
+    0x811049b100000000, 0x9fea5fe900000000, 0x3a91092200000000,
+    0xa31e725900000000, 0x0665249200000000, 0x189f32ca00000000,
+    0xbde4640100000000, 0x2a80c53c00000000, 0x8ffb93f700000000,
+    0x910185af00000000, 0x347ad36400000000, 0xadf5a81f00000000,
+    0x088efed400000000, 0x1674e88c00000000, 0xb30fbe4700000000,
+    0x38bdaaf700000000, 0x9dc6fc3c00000000, 0x833cea6400000000,
+    0x2647bcaf00000000, 0xbfc8c7d400000000, 0x1ab3911f00000000,
+    0x0449874700000000, 0xa132d18c00000000, 0x365670b100000000,
+    0x932d267a00000000, 0x8dd7302200000000, 0x28ac66e900000000,
+    0xb1231d9200000000, 0x14584b5900000000, 0x0aa25d0100000000,
+    0xafd90bca00000000, 0xedb1986400000000, 0x48caceaf00000000,
+    0x5630d8f700000000, 0xf34b8e3c00000000, 0x6ac4f54700000000,
+    0xcfbfa38c00000000, 0xd145b5d400000000, 0x743ee31f00000000,
+    0xe35a422200000000, 0x462114e900000000, 0x58db02b100000000,
+    0xfda0547a00000000, 0x642f2f0100000000, 0xc15479ca00000000,
+    0xdfae6f9200000000, 0x7ad5395900000000, 0xf1672de900000000,
+    0x541c7b2200000000, 0x4ae66d7a00000000, 0xef9d3bb100000000,
+    0x761240ca00000000, 0xd369160100000000, 0xcd93005900000000,
+    0x68e8569200000000, 0xff8cf7af00000000, 0x5af7a16400000000,
+    0x440db73c00000000, 0xe176e1f700000000, 0x78f99a8c00000000,
+    0xdd82cc4700000000, 0xc378da1f00000000, 0x66038cd400000000,
+    0xb6de104700000000, 0x13a5468c00000000, 0x0d5f50d400000000,
+    0xa824061f00000000, 0x31ab7d6400000000, 0x94d02baf00000000,
+    0x8a2a3df700000000, 0x2f516b3c00000000, 0xb835ca0100000000,
+    0x1d4e9cca00000000, 0x03b48a9200000000, 0xa6cfdc5900000000,
+    0x3f40a72200000000, 0x9a3bf1e900000000, 0x84c1e7b100000000,
+    0x21bab17a00000000, 0xaa08a5ca00000000, 0x0f73f30100000000,
+    0x1189e55900000000, 0xb4f2b39200000000, 0x2d7dc8e900000000,
+    0x88069e2200000000, 0x96fc887a00000000, 0x3387deb100000000,
+    0xa4e37f8c00000000, 0x0198294700000000, 0x1f623f1f00000000,
+    0xba1969d400000000, 0x239612af00000000, 0x86ed446400000000,
+    0x9817523c00000000, 0x3d6c04f700000000, 0x7f04975900000000,
+    0xda7fc19200000000, 0xc485d7ca00000000, 0x61fe810100000000,
+    0xf871fa7a00000000, 0x5d0aacb100000000, 0x43f0bae900000000,
+    0xe68bec2200000000, 0x71ef4d1f00000000, 0xd4941bd400000000,
+    0xca6e0d8c00000000, 0x6f155b4700000000, 0xf69a203c00000000,
+    0x53e176f700000000, 0x4d1b60af00000000, 0xe860366400000000,
+    0x63d222d400000000, 0xc6a9741f00000000, 0xd853624700000000,
+    0x7d28348c00000000, 0xe4a74ff700000000, 0x41dc193c00000000,
+    0x5f260f6400000000, 0xfa5d59af00000000, 0x6d39f89200000000,
+    0xc842ae5900000000, 0xd6b8b80100000000, 0x73c3eeca00000000,
+    0xea4c95b100000000, 0x4f37c37a00000000, 0x51cdd52200000000,
+    0xf4b683e900000000},
+   {0x0000000000000000, 0xc1f7719700000000, 0x73990f2b00000000,
+    0xb26e7ebc00000000, 0xe6321f5600000000, 0x27c56ec100000000,
+    0x95ab107d00000000, 0x545c61ea00000000, 0xcc653eac00000000,
+    0x0d924f3b00000000, 0xbffc318700000000, 0x7e0b401000000000,
+    0x2a5721fa00000000, 0xeba0506d00000000, 0x59ce2ed100000000,
+    0x98395f4600000000, 0x69bd905d00000000, 0xa84ae1ca00000000,
+    0x1a249f7600000000, 0xdbd3eee100000000, 0x8f8f8f0b00000000,
+    0x4e78fe9c00000000, 0xfc16802000000000, 0x3de1f1b700000000,
+    0xa5d8aef100000000, 0x642fdf6600000000, 0xd641a1da00000000,
+    0x17b6d04d00000000, 0x43eab1a700000000, 0x821dc03000000000,
+    0x3073be8c00000000, 0xf184cf1b00000000, 0xd27a21bb00000000,
+    0x138d502c00000000, 0xa1e32e9000000000, 0x60145f0700000000,
+    0x34483eed00000000, 0xf5bf4f7a00000000, 0x47d131c600000000,
+    0x8626405100000000, 0x1e1f1f1700000000, 0xdfe86e8000000000,
+    0x6d86103c00000000, 0xac7161ab00000000, 0xf82d004100000000,
+    0x39da71d600000000, 0x8bb40f6a00000000, 0x4a437efd00000000,
+    0xbbc7b1e600000000, 0x7a30c07100000000, 0xc85ebecd00000000,
+    0x09a9cf5a00000000, 0x5df5aeb000000000, 0x9c02df2700000000,
+    0x2e6ca19b00000000, 0xef9bd00c00000000, 0x77a28f4a00000000,
+    0xb655fedd00000000, 0x043b806100000000, 0xc5ccf1f600000000,
+    0x9190901c00000000, 0x5067e18b00000000, 0xe2099f3700000000,
+    0x23feeea000000000, 0x5583ae7300000000, 0x9474dfe400000000,
+    0x261aa15800000000, 0xe7edd0cf00000000, 0xb3b1b12500000000,
+    0x7246c0b200000000, 0xc028be0e00000000, 0x01dfcf9900000000,
+    0x99e690df00000000, 0x5811e14800000000, 0xea7f9ff400000000,
+    0x2b88ee6300000000, 0x7fd48f8900000000, 0xbe23fe1e00000000,
+    0x0c4d80a200000000, 0xcdbaf13500000000, 0x3c3e3e2e00000000,
+    0xfdc94fb900000000, 0x4fa7310500000000, 0x8e50409200000000,
+    0xda0c217800000000, 0x1bfb50ef00000000, 0xa9952e5300000000,
+    0x68625fc400000000, 0xf05b008200000000, 0x31ac711500000000,
+    0x83c20fa900000000, 0x42357e3e00000000, 0x16691fd400000000,
+    0xd79e6e4300000000, 0x65f010ff00000000, 0xa407616800000000,
+    0x87f98fc800000000, 0x460efe5f00000000, 0xf46080e300000000,
+    0x3597f17400000000, 0x61cb909e00000000, 0xa03ce10900000000,
+    0x12529fb500000000, 0xd3a5ee2200000000, 0x4b9cb16400000000,
+    0x8a6bc0f300000000, 0x3805be4f00000000, 0xf9f2cfd800000000,
+    0xadaeae3200000000, 0x6c59dfa500000000, 0xde37a11900000000,
+    0x1fc0d08e00000000, 0xee441f9500000000, 0x2fb36e0200000000,
+    0x9ddd10be00000000, 0x5c2a612900000000, 0x087600c300000000,
+    0xc981715400000000, 0x7bef0fe800000000, 0xba187e7f00000000,
+    0x2221213900000000, 0xe3d650ae00000000, 0x51b82e1200000000,
+    0x904f5f8500000000, 0xc4133e6f00000000, 0x05e44ff800000000,
+    0xb78a314400000000, 0x767d40d300000000, 0xaa065de700000000,
+    0x6bf12c7000000000, 0xd99f52cc00000000, 0x1868235b00000000,
+    0x4c3442b100000000, 0x8dc3332600000000, 0x3fad4d9a00000000,
+    0xfe5a3c0d00000000, 0x6663634b00000000, 0xa79412dc00000000,
+    0x15fa6c6000000000, 0xd40d1df700000000, 0x80517c1d00000000,
+    0x41a60d8a00000000, 0xf3c8733600000000, 0x323f02a100000000,
+    0xc3bbcdba00000000, 0x024cbc2d00000000, 0xb022c29100000000,
+    0x71d5b30600000000, 0x2589d2ec00000000, 0xe47ea37b00000000,
+    0x5610ddc700000000, 0x97e7ac5000000000, 0x0fdef31600000000,
+    0xce29828100000000, 0x7c47fc3d00000000, 0xbdb08daa00000000,
+    0xe9ecec4000000000, 0x281b9dd700000000, 0x9a75e36b00000000,
+    0x5b8292fc00000000, 0x787c7c5c00000000, 0xb98b0dcb00000000,
+    0x0be5737700000000, 0xca1202e000000000, 0x9e4e630a00000000,
+    0x5fb9129d00000000, 0xedd76c2100000000, 0x2c201db600000000,
+    0xb41942f000000000, 0x75ee336700000000, 0xc7804ddb00000000,
+    0x06773c4c00000000, 0x522b5da600000000, 0x93dc2c3100000000,
+    0x21b2528d00000000, 0xe045231a00000000, 0x11c1ec0100000000,
+    0xd0369d9600000000, 0x6258e32a00000000, 0xa3af92bd00000000,
+    0xf7f3f35700000000, 0x360482c000000000, 0x846afc7c00000000,
+    0x459d8deb00000000, 0xdda4d2ad00000000, 0x1c53a33a00000000,
+    0xae3ddd8600000000, 0x6fcaac1100000000, 0x3b96cdfb00000000,
+    0xfa61bc6c00000000, 0x480fc2d000000000, 0x89f8b34700000000,
+    0xff85f39400000000, 0x3e72820300000000, 0x8c1cfcbf00000000,
+    0x4deb8d2800000000, 0x19b7ecc200000000, 0xd8409d5500000000,
+    0x6a2ee3e900000000, 0xabd9927e00000000, 0x33e0cd3800000000,
+    0xf217bcaf00000000, 0x4079c21300000000, 0x818eb38400000000,
+    0xd5d2d26e00000000, 0x1425a3f900000000, 0xa64bdd4500000000,
+    0x67bcacd200000000, 0x963863c900000000, 0x57cf125e00000000,
+    0xe5a16ce200000000, 0x24561d7500000000, 0x700a7c9f00000000,
+    0xb1fd0d0800000000, 0x039373b400000000, 0xc264022300000000,
+    0x5a5d5d6500000000, 0x9baa2cf200000000, 0x29c4524e00000000,
+    0xe83323d900000000, 0xbc6f423300000000, 0x7d9833a400000000,
+    0xcff64d1800000000, 0x0e013c8f00000000, 0x2dffd22f00000000,
+    0xec08a3b800000000, 0x5e66dd0400000000, 0x9f91ac9300000000,
+    0xcbcdcd7900000000, 0x0a3abcee00000000, 0xb854c25200000000,
+    0x79a3b3c500000000, 0xe19aec8300000000, 0x206d9d1400000000,
+    0x9203e3a800000000, 0x53f4923f00000000, 0x07a8f3d500000000,
+    0xc65f824200000000, 0x7431fcfe00000000, 0xb5c68d6900000000,
+    0x4442427200000000, 0x85b533e500000000, 0x37db4d5900000000,
+    0xf62c3cce00000000, 0xa2705d2400000000, 0x63872cb300000000,
+    0xd1e9520f00000000, 0x101e239800000000, 0x88277cde00000000,
+    0x49d00d4900000000, 0xfbbe73f500000000, 0x3a49026200000000,
+    0x6e15638800000000, 0xafe2121f00000000, 0x1d8c6ca300000000,
+    0xdc7b1d3400000000},
+   {0x0000000000000000, 0x30d4713100000000, 0x60a8e36200000000,
+    0x507c925300000000, 0xc050c7c500000000, 0xf084b6f400000000,
+    0xa0f824a700000000, 0x902c559600000000, 0x71d7628e00000000,
+    0x410313bf00000000, 0x117f81ec00000000, 0x21abf0dd00000000,
+    0xb187a54b00000000, 0x8153d47a00000000, 0xd12f462900000000,
+    0xe1fb371800000000, 0x13d8291900000000, 0x230c582800000000,
+    0x7370ca7b00000000, 0x43a4bb4a00000000, 0xd388eedc00000000,
+    0xe35c9fed00000000, 0xb3200dbe00000000, 0x83f47c8f00000000,
+    0x620f4b9700000000, 0x52db3aa600000000, 0x02a7a8f500000000,
+    0x3273d9c400000000, 0xa25f8c5200000000, 0x928bfd6300000000,
+    0xc2f76f3000000000, 0xf2231e0100000000, 0x26b0533200000000,
+    0x1664220300000000, 0x4618b05000000000, 0x76ccc16100000000,
+    0xe6e094f700000000, 0xd634e5c600000000, 0x8648779500000000,
+    0xb69c06a400000000, 0x576731bc00000000, 0x67b3408d00000000,
+    0x37cfd2de00000000, 0x071ba3ef00000000, 0x9737f67900000000,
+    0xa7e3874800000000, 0xf79f151b00000000, 0xc74b642a00000000,
+    0x35687a2b00000000, 0x05bc0b1a00000000, 0x55c0994900000000,
+    0x6514e87800000000, 0xf538bdee00000000, 0xc5ecccdf00000000,
+    0x95905e8c00000000, 0xa5442fbd00000000, 0x44bf18a500000000,
+    0x746b699400000000, 0x2417fbc700000000, 0x14c38af600000000,
+    0x84efdf6000000000, 0xb43bae5100000000, 0xe4473c0200000000,
+    0xd4934d3300000000, 0x4c60a76400000000, 0x7cb4d65500000000,
+    0x2cc8440600000000, 0x1c1c353700000000, 0x8c3060a100000000,
+    0xbce4119000000000, 0xec9883c300000000, 0xdc4cf2f200000000,
+    0x3db7c5ea00000000, 0x0d63b4db00000000, 0x5d1f268800000000,
+    0x6dcb57b900000000, 0xfde7022f00000000, 0xcd33731e00000000,
+    0x9d4fe14d00000000, 0xad9b907c00000000, 0x5fb88e7d00000000,
+    0x6f6cff4c00000000, 0x3f106d1f00000000, 0x0fc41c2e00000000,
+    0x9fe849b800000000, 0xaf3c388900000000, 0xff40aada00000000,
+    0xcf94dbeb00000000, 0x2e6fecf300000000, 0x1ebb9dc200000000,
+    0x4ec70f9100000000, 0x7e137ea000000000, 0xee3f2b3600000000,
+    0xdeeb5a0700000000, 0x8e97c85400000000, 0xbe43b96500000000,
+    0x6ad0f45600000000, 0x5a04856700000000, 0x0a78173400000000,
+    0x3aac660500000000, 0xaa80339300000000, 0x9a5442a200000000,
+    0xca28d0f100000000, 0xfafca1c000000000, 0x1b0796d800000000,
+    0x2bd3e7e900000000, 0x7baf75ba00000000, 0x4b7b048b00000000,
+    0xdb57511d00000000, 0xeb83202c00000000, 0xbbffb27f00000000,
+    0x8b2bc34e00000000, 0x7908dd4f00000000, 0x49dcac7e00000000,
+    0x19a03e2d00000000, 0x29744f1c00000000, 0xb9581a8a00000000,
+    0x898c6bbb00000000, 0xd9f0f9e800000000, 0xe92488d900000000,
+    0x08dfbfc100000000, 0x380bcef000000000, 0x68775ca300000000,
+    0x58a32d9200000000, 0xc88f780400000000, 0xf85b093500000000,
+    0xa8279b6600000000, 0x98f3ea5700000000, 0x98c04ec900000000,
+    0xa8143ff800000000, 0xf868adab00000000, 0xc8bcdc9a00000000,
+    0x5890890c00000000, 0x6844f83d00000000, 0x38386a6e00000000,
+    0x08ec1b5f00000000, 0xe9172c4700000000, 0xd9c35d7600000000,
+    0x89bfcf2500000000, 0xb96bbe1400000000, 0x2947eb8200000000,
+    0x19939ab300000000, 0x49ef08e000000000, 0x793b79d100000000,
+    0x8b1867d000000000, 0xbbcc16e100000000, 0xebb084b200000000,
+    0xdb64f58300000000, 0x4b48a01500000000, 0x7b9cd12400000000,
+    0x2be0437700000000, 0x1b34324600000000, 0xfacf055e00000000,
+    0xca1b746f00000000, 0x9a67e63c00000000, 0xaab3970d00000000,
+    0x3a9fc29b00000000, 0x0a4bb3aa00000000, 0x5a3721f900000000,
+    0x6ae350c800000000, 0xbe701dfb00000000, 0x8ea46cca00000000,
+    0xded8fe9900000000, 0xee0c8fa800000000, 0x7e20da3e00000000,
+    0x4ef4ab0f00000000, 0x1e88395c00000000, 0x2e5c486d00000000,
+    0xcfa77f7500000000, 0xff730e4400000000, 0xaf0f9c1700000000,
+    0x9fdbed2600000000, 0x0ff7b8b000000000, 0x3f23c98100000000,
+    0x6f5f5bd200000000, 0x5f8b2ae300000000, 0xada834e200000000,
+    0x9d7c45d300000000, 0xcd00d78000000000, 0xfdd4a6b100000000,
+    0x6df8f32700000000, 0x5d2c821600000000, 0x0d50104500000000,
+    0x3d84617400000000, 0xdc7f566c00000000, 0xecab275d00000000,
+    0xbcd7b50e00000000, 0x8c03c43f00000000, 0x1c2f91a900000000,
+    0x2cfbe09800000000, 0x7c8772cb00000000, 0x4c5303fa00000000,
+    0xd4a0e9ad00000000, 0xe474989c00000000, 0xb4080acf00000000,
+    0x84dc7bfe00000000, 0x14f02e6800000000, 0x24245f5900000000,
+    0x7458cd0a00000000, 0x448cbc3b00000000, 0xa5778b2300000000,
+    0x95a3fa1200000000, 0xc5df684100000000, 0xf50b197000000000,
+    0x65274ce600000000, 0x55f33dd700000000, 0x058faf8400000000,
+    0x355bdeb500000000, 0xc778c0b400000000, 0xf7acb18500000000,
+    0xa7d023d600000000, 0x970452e700000000, 0x0728077100000000,
+    0x37fc764000000000, 0x6780e41300000000, 0x5754952200000000,
+    0xb6afa23a00000000, 0x867bd30b00000000, 0xd607415800000000,
+    0xe6d3306900000000, 0x76ff65ff00000000, 0x462b14ce00000000,
+    0x1657869d00000000, 0x2683f7ac00000000, 0xf210ba9f00000000,
+    0xc2c4cbae00000000, 0x92b859fd00000000, 0xa26c28cc00000000,
+    0x32407d5a00000000, 0x02940c6b00000000, 0x52e89e3800000000,
+    0x623cef0900000000, 0x83c7d81100000000, 0xb313a92000000000,
+    0xe36f3b7300000000, 0xd3bb4a4200000000, 0x43971fd400000000,
+    0x73436ee500000000, 0x233ffcb600000000, 0x13eb8d8700000000,
+    0xe1c8938600000000, 0xd11ce2b700000000, 0x816070e400000000,
+    0xb1b401d500000000, 0x2198544300000000, 0x114c257200000000,
+    0x4130b72100000000, 0x71e4c61000000000, 0x901ff10800000000,
+    0xa0cb803900000000, 0xf0b7126a00000000, 0xc063635b00000000,
+    0x504f36cd00000000, 0x609b47fc00000000, 0x30e7d5af00000000,
+    0x0033a49e00000000},
+   {0x0000000000000000, 0x6538d23000000000, 0xca70a46100000000,
+    0xaf48765100000000, 0x94e148c300000000, 0xf1d99af300000000,
+    0x5e91eca200000000, 0x3ba93e9200000000, 0xd9b57d8300000000,
+    0xbc8dafb300000000, 0x13c5d9e200000000, 0x76fd0bd200000000,
+    0x4d54354000000000, 0x286ce77000000000, 0x8724912100000000,
+    0xe21c431100000000, 0x431d170300000000, 0x2625c53300000000,
+    0x896db36200000000, 0xec55615200000000, 0xd7fc5fc000000000,
+    0xb2c48df000000000, 0x1d8cfba100000000, 0x78b4299100000000,
+    0x9aa86a8000000000, 0xff90b8b000000000, 0x50d8cee100000000,
+    0x35e01cd100000000, 0x0e49224300000000, 0x6b71f07300000000,
+    0xc439862200000000, 0xa101541200000000, 0x863a2e0600000000,
+    0xe302fc3600000000, 0x4c4a8a6700000000, 0x2972585700000000,
+    0x12db66c500000000, 0x77e3b4f500000000, 0xd8abc2a400000000,
+    0xbd93109400000000, 0x5f8f538500000000, 0x3ab781b500000000,
+    0x95fff7e400000000, 0xf0c725d400000000, 0xcb6e1b4600000000,
+    0xae56c97600000000, 0x011ebf2700000000, 0x64266d1700000000,
+    0xc527390500000000, 0xa01feb3500000000, 0x0f579d6400000000,
+    0x6a6f4f5400000000, 0x51c671c600000000, 0x34fea3f600000000,
+    0x9bb6d5a700000000, 0xfe8e079700000000, 0x1c92448600000000,
+    0x79aa96b600000000, 0xd6e2e0e700000000, 0xb3da32d700000000,
+    0x88730c4500000000, 0xed4bde7500000000, 0x4203a82400000000,
+    0x273b7a1400000000, 0x0c755c0c00000000, 0x694d8e3c00000000,
+    0xc605f86d00000000, 0xa33d2a5d00000000, 0x989414cf00000000,
+    0xfdacc6ff00000000, 0x52e4b0ae00000000, 0x37dc629e00000000,
+    0xd5c0218f00000000, 0xb0f8f3bf00000000, 0x1fb085ee00000000,
+    0x7a8857de00000000, 0x4121694c00000000, 0x2419bb7c00000000,
+    0x8b51cd2d00000000, 0xee691f1d00000000, 0x4f684b0f00000000,
+    0x2a50993f00000000, 0x8518ef6e00000000, 0xe0203d5e00000000,
+    0xdb8903cc00000000, 0xbeb1d1fc00000000, 0x11f9a7ad00000000,
+    0x74c1759d00000000, 0x96dd368c00000000, 0xf3e5e4bc00000000,
+    0x5cad92ed00000000, 0x399540dd00000000, 0x023c7e4f00000000,
+    0x6704ac7f00000000, 0xc84cda2e00000000, 0xad74081e00000000,
+    0x8a4f720a00000000, 0xef77a03a00000000, 0x403fd66b00000000,
+    0x2507045b00000000, 0x1eae3ac900000000, 0x7b96e8f900000000,
+    0xd4de9ea800000000, 0xb1e64c9800000000, 0x53fa0f8900000000,
+    0x36c2ddb900000000, 0x998aabe800000000, 0xfcb279d800000000,
+    0xc71b474a00000000, 0xa223957a00000000, 0x0d6be32b00000000,
+    0x6853311b00000000, 0xc952650900000000, 0xac6ab73900000000,
+    0x0322c16800000000, 0x661a135800000000, 0x5db32dca00000000,
+    0x388bfffa00000000, 0x97c389ab00000000, 0xf2fb5b9b00000000,
+    0x10e7188a00000000, 0x75dfcaba00000000, 0xda97bceb00000000,
+    0xbfaf6edb00000000, 0x8406504900000000, 0xe13e827900000000,
+    0x4e76f42800000000, 0x2b4e261800000000, 0x18eab81800000000,
+    0x7dd26a2800000000, 0xd29a1c7900000000, 0xb7a2ce4900000000,
+    0x8c0bf0db00000000, 0xe93322eb00000000, 0x467b54ba00000000,
+    0x2343868a00000000, 0xc15fc59b00000000, 0xa46717ab00000000,
+    0x0b2f61fa00000000, 0x6e17b3ca00000000, 0x55be8d5800000000,
+    0x30865f6800000000, 0x9fce293900000000, 0xfaf6fb0900000000,
+    0x5bf7af1b00000000, 0x3ecf7d2b00000000, 0x91870b7a00000000,
+    0xf4bfd94a00000000, 0xcf16e7d800000000, 0xaa2e35e800000000,
+    0x056643b900000000, 0x605e918900000000, 0x8242d29800000000,
+    0xe77a00a800000000, 0x483276f900000000, 0x2d0aa4c900000000,
+    0x16a39a5b00000000, 0x739b486b00000000, 0xdcd33e3a00000000,
+    0xb9ebec0a00000000, 0x9ed0961e00000000, 0xfbe8442e00000000,
+    0x54a0327f00000000, 0x3198e04f00000000, 0x0a31dedd00000000,
+    0x6f090ced00000000, 0xc0417abc00000000, 0xa579a88c00000000,
+    0x4765eb9d00000000, 0x225d39ad00000000, 0x8d154ffc00000000,
+    0xe82d9dcc00000000, 0xd384a35e00000000, 0xb6bc716e00000000,
+    0x19f4073f00000000, 0x7cccd50f00000000, 0xddcd811d00000000,
+    0xb8f5532d00000000, 0x17bd257c00000000, 0x7285f74c00000000,
+    0x492cc9de00000000, 0x2c141bee00000000, 0x835c6dbf00000000,
+    0xe664bf8f00000000, 0x0478fc9e00000000, 0x61402eae00000000,
+    0xce0858ff00000000, 0xab308acf00000000, 0x9099b45d00000000,
+    0xf5a1666d00000000, 0x5ae9103c00000000, 0x3fd1c20c00000000,
+    0x149fe41400000000, 0x71a7362400000000, 0xdeef407500000000,
+    0xbbd7924500000000, 0x807eacd700000000, 0xe5467ee700000000,
+    0x4a0e08b600000000, 0x2f36da8600000000, 0xcd2a999700000000,
+    0xa8124ba700000000, 0x075a3df600000000, 0x6262efc600000000,
+    0x59cbd15400000000, 0x3cf3036400000000, 0x93bb753500000000,
+    0xf683a70500000000, 0x5782f31700000000, 0x32ba212700000000,
+    0x9df2577600000000, 0xf8ca854600000000, 0xc363bbd400000000,
+    0xa65b69e400000000, 0x09131fb500000000, 0x6c2bcd8500000000,
+    0x8e378e9400000000, 0xeb0f5ca400000000, 0x44472af500000000,
+    0x217ff8c500000000, 0x1ad6c65700000000, 0x7fee146700000000,
+    0xd0a6623600000000, 0xb59eb00600000000, 0x92a5ca1200000000,
+    0xf79d182200000000, 0x58d56e7300000000, 0x3dedbc4300000000,
+    0x064482d100000000, 0x637c50e100000000, 0xcc3426b000000000,
+    0xa90cf48000000000, 0x4b10b79100000000, 0x2e2865a100000000,
+    0x816013f000000000, 0xe458c1c000000000, 0xdff1ff5200000000,
+    0xbac92d6200000000, 0x15815b3300000000, 0x70b9890300000000,
+    0xd1b8dd1100000000, 0xb4800f2100000000, 0x1bc8797000000000,
+    0x7ef0ab4000000000, 0x455995d200000000, 0x206147e200000000,
+    0x8f2931b300000000, 0xea11e38300000000, 0x080da09200000000,
+    0x6d3572a200000000, 0xc27d04f300000000, 0xa745d6c300000000,
+    0x9cece85100000000, 0xf9d43a6100000000, 0x569c4c3000000000,
+    0x33a49e0000000000},
+   {0x0000000000000000, 0x4655075400000000, 0x8caa0ea800000000,
+    0xcaff09fc00000000, 0xe923f15500000000, 0xaf76f60100000000,
+    0x6589fffd00000000, 0x23dcf8a900000000, 0xd247e2ab00000000,
+    0x9412e5ff00000000, 0x5eedec0300000000, 0x18b8eb5700000000,
+    0x3b6413fe00000000, 0x7d3114aa00000000, 0xb7ce1d5600000000,
+    0xf19b1a0200000000, 0x55f9285200000000, 0x13ac2f0600000000,
+    0xd95326fa00000000, 0x9f0621ae00000000, 0xbcdad90700000000,
+    0xfa8fde5300000000, 0x3070d7af00000000, 0x7625d0fb00000000,
+    0x87becaf900000000, 0xc1ebcdad00000000, 0x0b14c45100000000,
+    0x4d41c30500000000, 0x6e9d3bac00000000, 0x28c83cf800000000,
+    0xe237350400000000, 0xa462325000000000, 0xaaf251a400000000,
+    0xeca756f000000000, 0x26585f0c00000000, 0x600d585800000000,
+    0x43d1a0f100000000, 0x0584a7a500000000, 0xcf7bae5900000000,
+    0x892ea90d00000000, 0x78b5b30f00000000, 0x3ee0b45b00000000,
+    0xf41fbda700000000, 0xb24abaf300000000, 0x9196425a00000000,
+    0xd7c3450e00000000, 0x1d3c4cf200000000, 0x5b694ba600000000,
+    0xff0b79f600000000, 0xb95e7ea200000000, 0x73a1775e00000000,
+    0x35f4700a00000000, 0x162888a300000000, 0x507d8ff700000000,
+    0x9a82860b00000000, 0xdcd7815f00000000, 0x2d4c9b5d00000000,
+    0x6b199c0900000000, 0xa1e695f500000000, 0xe7b392a100000000,
+    0xc46f6a0800000000, 0x823a6d5c00000000, 0x48c564a000000000,
+    0x0e9063f400000000, 0xa5934f4d00000000, 0xe3c6481900000000,
+    0x293941e500000000, 0x6f6c46b100000000, 0x4cb0be1800000000,
+    0x0ae5b94c00000000, 0xc01ab0b000000000, 0x864fb7e400000000,
+    0x77d4ade600000000, 0x3181aab200000000, 0xfb7ea34e00000000,
+    0xbd2ba41a00000000, 0x9ef75cb300000000, 0xd8a25be700000000,
+    0x125d521b00000000, 0x5408554f00000000, 0xf06a671f00000000,
+    0xb63f604b00000000, 0x7cc069b700000000, 0x3a956ee300000000,
+    0x1949964a00000000, 0x5f1c911e00000000, 0x95e398e200000000,
+    0xd3b69fb600000000, 0x222d85b400000000, 0x647882e000000000,
+    0xae878b1c00000000, 0xe8d28c4800000000, 0xcb0e74e100000000,
+    0x8d5b73b500000000, 0x47a47a4900000000, 0x01f17d1d00000000,
+    0x0f611ee900000000, 0x493419bd00000000, 0x83cb104100000000,
+    0xc59e171500000000, 0xe642efbc00000000, 0xa017e8e800000000,
+    0x6ae8e11400000000, 0x2cbde64000000000, 0xdd26fc4200000000,
+    0x9b73fb1600000000, 0x518cf2ea00000000, 0x17d9f5be00000000,
+    0x34050d1700000000, 0x72500a4300000000, 0xb8af03bf00000000,
+    0xfefa04eb00000000, 0x5a9836bb00000000, 0x1ccd31ef00000000,
+    0xd632381300000000, 0x90673f4700000000, 0xb3bbc7ee00000000,
+    0xf5eec0ba00000000, 0x3f11c94600000000, 0x7944ce1200000000,
+    0x88dfd41000000000, 0xce8ad34400000000, 0x0475dab800000000,
+    0x4220ddec00000000, 0x61fc254500000000, 0x27a9221100000000,
+    0xed562bed00000000, 0xab032cb900000000, 0x4a279f9a00000000,
+    0x0c7298ce00000000, 0xc68d913200000000, 0x80d8966600000000,
+    0xa3046ecf00000000, 0xe551699b00000000, 0x2fae606700000000,
+    0x69fb673300000000, 0x98607d3100000000, 0xde357a6500000000,
+    0x14ca739900000000, 0x529f74cd00000000, 0x71438c6400000000,
+    0x37168b3000000000, 0xfde982cc00000000, 0xbbbc859800000000,
+    0x1fdeb7c800000000, 0x598bb09c00000000, 0x9374b96000000000,
+    0xd521be3400000000, 0xf6fd469d00000000, 0xb0a841c900000000,
+    0x7a57483500000000, 0x3c024f6100000000, 0xcd99556300000000,
+    0x8bcc523700000000, 0x41335bcb00000000, 0x07665c9f00000000,
+    0x24baa43600000000, 0x62efa36200000000, 0xa810aa9e00000000,
+    0xee45adca00000000, 0xe0d5ce3e00000000, 0xa680c96a00000000,
+    0x6c7fc09600000000, 0x2a2ac7c200000000, 0x09f63f6b00000000,
+    0x4fa3383f00000000, 0x855c31c300000000, 0xc309369700000000,
+    0x32922c9500000000, 0x74c72bc100000000, 0xbe38223d00000000,
+    0xf86d256900000000, 0xdbb1ddc000000000, 0x9de4da9400000000,
+    0x571bd36800000000, 0x114ed43c00000000, 0xb52ce66c00000000,
+    0xf379e13800000000, 0x3986e8c400000000, 0x7fd3ef9000000000,
+    0x5c0f173900000000, 0x1a5a106d00000000, 0xd0a5199100000000,
+    0x96f01ec500000000, 0x676b04c700000000, 0x213e039300000000,
+    0xebc10a6f00000000, 0xad940d3b00000000, 0x8e48f59200000000,
+    0xc81df2c600000000, 0x02e2fb3a00000000, 0x44b7fc6e00000000,
+    0xefb4d0d700000000, 0xa9e1d78300000000, 0x631ede7f00000000,
+    0x254bd92b00000000, 0x0697218200000000, 0x40c226d600000000,
+    0x8a3d2f2a00000000, 0xcc68287e00000000, 0x3df3327c00000000,
+    0x7ba6352800000000, 0xb1593cd400000000, 0xf70c3b8000000000,
+    0xd4d0c32900000000, 0x9285c47d00000000, 0x587acd8100000000,
+    0x1e2fcad500000000, 0xba4df88500000000, 0xfc18ffd100000000,
+    0x36e7f62d00000000, 0x70b2f17900000000, 0x536e09d000000000,
+    0x153b0e8400000000, 0xdfc4077800000000, 0x9991002c00000000,
+    0x680a1a2e00000000, 0x2e5f1d7a00000000, 0xe4a0148600000000,
+    0xa2f513d200000000, 0x8129eb7b00000000, 0xc77cec2f00000000,
+    0x0d83e5d300000000, 0x4bd6e28700000000, 0x4546817300000000,
+    0x0313862700000000, 0xc9ec8fdb00000000, 0x8fb9888f00000000,
+    0xac65702600000000, 0xea30777200000000, 0x20cf7e8e00000000,
+    0x669a79da00000000, 0x970163d800000000, 0xd154648c00000000,
+    0x1bab6d7000000000, 0x5dfe6a2400000000, 0x7e22928d00000000,
+    0x387795d900000000, 0xf2889c2500000000, 0xb4dd9b7100000000,
+    0x10bfa92100000000, 0x56eaae7500000000, 0x9c15a78900000000,
+    0xda40a0dd00000000, 0xf99c587400000000, 0xbfc95f2000000000,
+    0x753656dc00000000, 0x3363518800000000, 0xc2f84b8a00000000,
+    0x84ad4cde00000000, 0x4e52452200000000, 0x0807427600000000,
+    0x2bdbbadf00000000, 0x6d8ebd8b00000000, 0xa771b47700000000,
+    0xe124b32300000000},
+   {0x0000000000000000, 0x01fd8e6700000000, 0x02fa1dcf00000000,
+    0x030793a800000000, 0xf582d79b00000000, 0xf47f59fc00000000,
+    0xf778ca5400000000, 0xf685443300000000, 0x1b73433200000000,
+    0x1a8ecd5500000000, 0x19895efd00000000, 0x1874d09a00000000,
+    0xeef194a900000000, 0xef0c1ace00000000, 0xec0b896600000000,
+    0xedf6070100000000, 0x36e6866400000000, 0x371b080300000000,
+    0x341c9bab00000000, 0x35e115cc00000000, 0xc36451ff00000000,
+    0xc299df9800000000, 0xc19e4c3000000000, 0xc063c25700000000,
+    0x2d95c55600000000, 0x2c684b3100000000, 0x2f6fd89900000000,
+    0x2e9256fe00000000, 0xd81712cd00000000, 0xd9ea9caa00000000,
+    0xdaed0f0200000000, 0xdb10816500000000, 0x6ccc0dc900000000,
+    0x6d3183ae00000000, 0x6e36100600000000, 0x6fcb9e6100000000,
+    0x994eda5200000000, 0x98b3543500000000, 0x9bb4c79d00000000,
+    0x9a4949fa00000000, 0x77bf4efb00000000, 0x7642c09c00000000,
+    0x7545533400000000, 0x74b8dd5300000000, 0x823d996000000000,
+    0x83c0170700000000, 0x80c784af00000000, 0x813a0ac800000000,
+    0x5a2a8bad00000000, 0x5bd705ca00000000, 0x58d0966200000000,
+    0x592d180500000000, 0xafa85c3600000000, 0xae55d25100000000,
+    0xad5241f900000000, 0xacafcf9e00000000, 0x4159c89f00000000,
+    0x40a446f800000000, 0x43a3d55000000000, 0x425e5b3700000000,
+    0xb4db1f0400000000, 0xb526916300000000, 0xb62102cb00000000,
+    0xb7dc8cac00000000, 0x29eef79700000000, 0x281379f000000000,
+    0x2b14ea5800000000, 0x2ae9643f00000000, 0xdc6c200c00000000,
+    0xdd91ae6b00000000, 0xde963dc300000000, 0xdf6bb3a400000000,
+    0x329db4a500000000, 0x33603ac200000000, 0x3067a96a00000000,
+    0x319a270d00000000, 0xc71f633e00000000, 0xc6e2ed5900000000,
+    0xc5e57ef100000000, 0xc418f09600000000, 0x1f0871f300000000,
+    0x1ef5ff9400000000, 0x1df26c3c00000000, 0x1c0fe25b00000000,
+    0xea8aa66800000000, 0xeb77280f00000000, 0xe870bba700000000,
+    0xe98d35c000000000, 0x047b32c100000000, 0x0586bca600000000,
+    0x06812f0e00000000, 0x077ca16900000000, 0xf1f9e55a00000000,
+    0xf0046b3d00000000, 0xf303f89500000000, 0xf2fe76f200000000,
+    0x4522fa5e00000000, 0x44df743900000000, 0x47d8e79100000000,
+    0x462569f600000000, 0xb0a02dc500000000, 0xb15da3a200000000,
+    0xb25a300a00000000, 0xb3a7be6d00000000, 0x5e51b96c00000000,
+    0x5fac370b00000000, 0x5caba4a300000000, 0x5d562ac400000000,
+    0xabd36ef700000000, 0xaa2ee09000000000, 0xa929733800000000,
+    0xa8d4fd5f00000000, 0x73c47c3a00000000, 0x7239f25d00000000,
+    0x713e61f500000000, 0x70c3ef9200000000, 0x8646aba100000000,
+    0x87bb25c600000000, 0x84bcb66e00000000, 0x8541380900000000,
+    0x68b73f0800000000, 0x694ab16f00000000, 0x6a4d22c700000000,
+    0x6bb0aca000000000, 0x9d35e89300000000, 0x9cc866f400000000,
+    0x9fcff55c00000000, 0x9e327b3b00000000, 0xa3aa032a00000000,
+    0xa2578d4d00000000, 0xa1501ee500000000, 0xa0ad908200000000,
+    0x5628d4b100000000, 0x57d55ad600000000, 0x54d2c97e00000000,
+    0x552f471900000000, 0xb8d9401800000000, 0xb924ce7f00000000,
+    0xba235dd700000000, 0xbbded3b000000000, 0x4d5b978300000000,
+    0x4ca619e400000000, 0x4fa18a4c00000000, 0x4e5c042b00000000,
+    0x954c854e00000000, 0x94b10b2900000000, 0x97b6988100000000,
+    0x964b16e600000000, 0x60ce52d500000000, 0x6133dcb200000000,
+    0x62344f1a00000000, 0x63c9c17d00000000, 0x8e3fc67c00000000,
+    0x8fc2481b00000000, 0x8cc5dbb300000000, 0x8d3855d400000000,
+    0x7bbd11e700000000, 0x7a409f8000000000, 0x79470c2800000000,
+    0x78ba824f00000000, 0xcf660ee300000000, 0xce9b808400000000,
+    0xcd9c132c00000000, 0xcc619d4b00000000, 0x3ae4d97800000000,
+    0x3b19571f00000000, 0x381ec4b700000000, 0x39e34ad000000000,
+    0xd4154dd100000000, 0xd5e8c3b600000000, 0xd6ef501e00000000,
+    0xd712de7900000000, 0x21979a4a00000000, 0x206a142d00000000,
+    0x236d878500000000, 0x229009e200000000, 0xf980888700000000,
+    0xf87d06e000000000, 0xfb7a954800000000, 0xfa871b2f00000000,
+    0x0c025f1c00000000, 0x0dffd17b00000000, 0x0ef842d300000000,
+    0x0f05ccb400000000, 0xe2f3cbb500000000, 0xe30e45d200000000,
+    0xe009d67a00000000, 0xe1f4581d00000000, 0x17711c2e00000000,
+    0x168c924900000000, 0x158b01e100000000, 0x14768f8600000000,
+    0x8a44f4bd00000000, 0x8bb97ada00000000, 0x88bee97200000000,
+    0x8943671500000000, 0x7fc6232600000000, 0x7e3bad4100000000,
+    0x7d3c3ee900000000, 0x7cc1b08e00000000, 0x9137b78f00000000,
+    0x90ca39e800000000, 0x93cdaa4000000000, 0x9230242700000000,
+    0x64b5601400000000, 0x6548ee7300000000, 0x664f7ddb00000000,
+    0x67b2f3bc00000000, 0xbca272d900000000, 0xbd5ffcbe00000000,
+    0xbe586f1600000000, 0xbfa5e17100000000, 0x4920a54200000000,
+    0x48dd2b2500000000, 0x4bdab88d00000000, 0x4a2736ea00000000,
+    0xa7d131eb00000000, 0xa62cbf8c00000000, 0xa52b2c2400000000,
+    0xa4d6a24300000000, 0x5253e67000000000, 0x53ae681700000000,
+    0x50a9fbbf00000000, 0x515475d800000000, 0xe688f97400000000,
+    0xe775771300000000, 0xe472e4bb00000000, 0xe58f6adc00000000,
+    0x130a2eef00000000, 0x12f7a08800000000, 0x11f0332000000000,
+    0x100dbd4700000000, 0xfdfbba4600000000, 0xfc06342100000000,
+    0xff01a78900000000, 0xfefc29ee00000000, 0x08796ddd00000000,
+    0x0984e3ba00000000, 0x0a83701200000000, 0x0b7efe7500000000,
+    0xd06e7f1000000000, 0xd193f17700000000, 0xd29462df00000000,
+    0xd369ecb800000000, 0x25eca88b00000000, 0x241126ec00000000,
+    0x2716b54400000000, 0x26eb3b2300000000, 0xcb1d3c2200000000,
+    0xcae0b24500000000, 0xc9e721ed00000000, 0xc81aaf8a00000000,
+    0x3e9febb900000000, 0x3f6265de00000000, 0x3c65f67600000000,
+    0x3d98781100000000},
+   {0x0000000000000000, 0xfe0d0cf200000000, 0x0d6df4e100000000,
+    0xf360f81300000000, 0xebac04c600000000, 0x15a1083400000000,
+    0xe6c1f02700000000, 0x18ccfcd500000000, 0x272fe58900000000,
+    0xd922e97b00000000, 0x2a42116800000000, 0xd44f1d9a00000000,
+    0xcc83e14f00000000, 0x328eedbd00000000, 0xc1ee15ae00000000,
+    0x3fe3195c00000000, 0xbf28261600000000, 0x41252ae400000000,
+    0xb245d2f700000000, 0x4c48de0500000000, 0x548422d000000000,
+    0xaa892e2200000000, 0x59e9d63100000000, 0xa7e4dac300000000,
+    0x9807c39f00000000, 0x660acf6d00000000, 0x956a377e00000000,
+    0x6b673b8c00000000, 0x73abc75900000000, 0x8da6cbab00000000,
+    0x7ec633b800000000, 0x80cb3f4a00000000, 0x7e514c2c00000000,
+    0x805c40de00000000, 0x733cb8cd00000000, 0x8d31b43f00000000,
+    0x95fd48ea00000000, 0x6bf0441800000000, 0x9890bc0b00000000,
+    0x669db0f900000000, 0x597ea9a500000000, 0xa773a55700000000,
+    0x54135d4400000000, 0xaa1e51b600000000, 0xb2d2ad6300000000,
+    0x4cdfa19100000000, 0xbfbf598200000000, 0x41b2557000000000,
+    0xc1796a3a00000000, 0x3f7466c800000000, 0xcc149edb00000000,
+    0x3219922900000000, 0x2ad56efc00000000, 0xd4d8620e00000000,
+    0x27b89a1d00000000, 0xd9b596ef00000000, 0xe6568fb300000000,
+    0x185b834100000000, 0xeb3b7b5200000000, 0x153677a000000000,
+    0x0dfa8b7500000000, 0xf3f7878700000000, 0x00977f9400000000,
+    0xfe9a736600000000, 0xfca2985800000000, 0x02af94aa00000000,
+    0xf1cf6cb900000000, 0x0fc2604b00000000, 0x170e9c9e00000000,
+    0xe903906c00000000, 0x1a63687f00000000, 0xe46e648d00000000,
+    0xdb8d7dd100000000, 0x2580712300000000, 0xd6e0893000000000,
+    0x28ed85c200000000, 0x3021791700000000, 0xce2c75e500000000,
+    0x3d4c8df600000000, 0xc341810400000000, 0x438abe4e00000000,
+    0xbd87b2bc00000000, 0x4ee74aaf00000000, 0xb0ea465d00000000,
+    0xa826ba8800000000, 0x562bb67a00000000, 0xa54b4e6900000000,
+    0x5b46429b00000000, 0x64a55bc700000000, 0x9aa8573500000000,
+    0x69c8af2600000000, 0x97c5a3d400000000, 0x8f095f0100000000,
+    0x710453f300000000, 0x8264abe000000000, 0x7c69a71200000000,
+    0x82f3d47400000000, 0x7cfed88600000000, 0x8f9e209500000000,
+    0x71932c6700000000, 0x695fd0b200000000, 0x9752dc4000000000,
+    0x6432245300000000, 0x9a3f28a100000000, 0xa5dc31fd00000000,
+    0x5bd13d0f00000000, 0xa8b1c51c00000000, 0x56bcc9ee00000000,
+    0x4e70353b00000000, 0xb07d39c900000000, 0x431dc1da00000000,
+    0xbd10cd2800000000, 0x3ddbf26200000000, 0xc3d6fe9000000000,
+    0x30b6068300000000, 0xcebb0a7100000000, 0xd677f6a400000000,
+    0x287afa5600000000, 0xdb1a024500000000, 0x25170eb700000000,
+    0x1af417eb00000000, 0xe4f91b1900000000, 0x1799e30a00000000,
+    0xe994eff800000000, 0xf158132d00000000, 0x0f551fdf00000000,
+    0xfc35e7cc00000000, 0x0238eb3e00000000, 0xf84531b100000000,
+    0x06483d4300000000, 0xf528c55000000000, 0x0b25c9a200000000,
+    0x13e9357700000000, 0xede4398500000000, 0x1e84c19600000000,
+    0xe089cd6400000000, 0xdf6ad43800000000, 0x2167d8ca00000000,
+    0xd20720d900000000, 0x2c0a2c2b00000000, 0x34c6d0fe00000000,
+    0xcacbdc0c00000000, 0x39ab241f00000000, 0xc7a628ed00000000,
+    0x476d17a700000000, 0xb9601b5500000000, 0x4a00e34600000000,
+    0xb40defb400000000, 0xacc1136100000000, 0x52cc1f9300000000,
+    0xa1ace78000000000, 0x5fa1eb7200000000, 0x6042f22e00000000,
+    0x9e4ffedc00000000, 0x6d2f06cf00000000, 0x93220a3d00000000,
+    0x8beef6e800000000, 0x75e3fa1a00000000, 0x8683020900000000,
+    0x788e0efb00000000, 0x86147d9d00000000, 0x7819716f00000000,
+    0x8b79897c00000000, 0x7574858e00000000, 0x6db8795b00000000,
+    0x93b575a900000000, 0x60d58dba00000000, 0x9ed8814800000000,
+    0xa13b981400000000, 0x5f3694e600000000, 0xac566cf500000000,
+    0x525b600700000000, 0x4a979cd200000000, 0xb49a902000000000,
+    0x47fa683300000000, 0xb9f764c100000000, 0x393c5b8b00000000,
+    0xc731577900000000, 0x3451af6a00000000, 0xca5ca39800000000,
+    0xd2905f4d00000000, 0x2c9d53bf00000000, 0xdffdabac00000000,
+    0x21f0a75e00000000, 0x1e13be0200000000, 0xe01eb2f000000000,
+    0x137e4ae300000000, 0xed73461100000000, 0xf5bfbac400000000,
+    0x0bb2b63600000000, 0xf8d24e2500000000, 0x06df42d700000000,
+    0x04e7a9e900000000, 0xfaeaa51b00000000, 0x098a5d0800000000,
+    0xf78751fa00000000, 0xef4bad2f00000000, 0x1146a1dd00000000,
+    0xe22659ce00000000, 0x1c2b553c00000000, 0x23c84c6000000000,
+    0xddc5409200000000, 0x2ea5b88100000000, 0xd0a8b47300000000,
+    0xc86448a600000000, 0x3669445400000000, 0xc509bc4700000000,
+    0x3b04b0b500000000, 0xbbcf8fff00000000, 0x45c2830d00000000,
+    0xb6a27b1e00000000, 0x48af77ec00000000, 0x50638b3900000000,
+    0xae6e87cb00000000, 0x5d0e7fd800000000, 0xa303732a00000000,
+    0x9ce06a7600000000, 0x62ed668400000000, 0x918d9e9700000000,
+    0x6f80926500000000, 0x774c6eb000000000, 0x8941624200000000,
+    0x7a219a5100000000, 0x842c96a300000000, 0x7ab6e5c500000000,
+    0x84bbe93700000000, 0x77db112400000000, 0x89d61dd600000000,
+    0x911ae10300000000, 0x6f17edf100000000, 0x9c7715e200000000,
+    0x627a191000000000, 0x5d99004c00000000, 0xa3940cbe00000000,
+    0x50f4f4ad00000000, 0xaef9f85f00000000, 0xb635048a00000000,
+    0x4838087800000000, 0xbb58f06b00000000, 0x4555fc9900000000,
+    0xc59ec3d300000000, 0x3b93cf2100000000, 0xc8f3373200000000,
+    0x36fe3bc000000000, 0x2e32c71500000000, 0xd03fcbe700000000,
+    0x235f33f400000000, 0xdd523f0600000000, 0xe2b1265a00000000,
+    0x1cbc2aa800000000, 0xefdcd2bb00000000, 0x11d1de4900000000,
+    0x091d229c00000000, 0xf7102e6e00000000, 0x0470d67d00000000,
+    0xfa7dda8f00000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d,
+    0x6821ff4a, 0xb3657823, 0xfa590504, 0x423b04da, 0x0b0779fd,
+    0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9,
+    0xb86201de, 0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd,
+    0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0, 0xc64d0d6e,
+    0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224,
+    0x7528754d, 0x3c14086a, 0x0d006599, 0x443c18be, 0x9f789fd7,
+    0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+    0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e,
+    0x271a9e09, 0xfc5e1960, 0xb5626447, 0x89766c2d, 0xc04a110a,
+    0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e,
+    0x732f6929, 0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e,
+    0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3, 0x1a00cb32,
+    0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478,
+    0xa965b311, 0xe059ce36, 0x583bcfe8, 0x1107b2cf, 0xca4335a6,
+    0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+    0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb,
+    0xf6573dcc, 0x2d13baa5, 0x642fc782, 0xdc4dc65c, 0x9571bb7b,
+    0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f,
+    0x2614c358, 0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2,
+    0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf, 0x553baa71,
+    0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b,
+    0xe65ed252, 0xaf62af75, 0x9376a71f, 0xda4ada38, 0x010e5d51,
+    0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+    0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8,
+    0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1, 0x34019664, 0x7d3deb43,
+    0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47,
+    0xce589360, 0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7,
+    0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba, 0xb0779fd0,
+    0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a,
+    0x0312e7f3, 0x4a2e9ad4, 0xf24c9b0a, 0xbb70e62d, 0x60346144,
+    0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+    0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190,
+    0x51200cb7, 0x8a648bde, 0xc358f6f9, 0x7b3af727, 0x32068a00,
+    0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04,
+    0x8163f223, 0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20,
+    0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d, 0xff4cfe93,
+    0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9,
+    0x4c2986b0, 0x0515fb97, 0x2e015d56, 0x673d2071, 0xbc79a718,
+    0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+    0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1,
+    0x041ba6c6, 0xdf5f21af, 0x96635c88, 0xaa7754e2, 0xe34b29c5,
+    0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1,
+    0x502e51e6, 0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751,
+    0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c, 0x230138cf,
+    0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785,
+    0x906440ec, 0xd9583dcb, 0x613a3c15, 0x28064132, 0xf342c65b,
+    0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+    0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316,
+    0xcf56ce31, 0x14124958, 0x5d2e347f, 0xe54c35a1, 0xac704886,
+    0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82,
+    0x1f1530a5},
+   {0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1,
+    0xcde3e919, 0x75e69c41, 0x1de5b089, 0x4e2dfd53, 0x262ed19b,
+    0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112,
+    0x53c84dda, 0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe,
+    0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f, 0xd27607f5,
+    0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec,
+    0xa7909bb4, 0xcf93b77c, 0x3d5b83bd, 0x5558af75, 0xed5dda2d,
+    0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+    0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f,
+    0xbe9597f7, 0x0690e2af, 0x6e93ce67, 0xa100791b, 0xc90355d3,
+    0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a,
+    0xbce5c992, 0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110,
+    0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1, 0x7ab7077a,
+    0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63,
+    0x0f519b3b, 0x6752b7f3, 0x349afa29, 0x5c99d6e1, 0xe49ca3b9,
+    0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+    0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d,
+    0x2b0f14c5, 0x930a619d, 0xfb094d55, 0xa8c1008f, 0xc0c22c47,
+    0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce,
+    0xb524b006, 0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f,
+    0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e, 0x09c17994,
+    0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d,
+    0x7c27e5d5, 0x1424c91d, 0xdbb77e61, 0xb3b452a9, 0x0bb127f1,
+    0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+    0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3,
+    0x58796a2b, 0xe07c1f73, 0x887f33bb, 0xf56e0ef4, 0x9d6d223c,
+    0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5,
+    0xe88bbe7d, 0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff,
+    0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e, 0x6935f452,
+    0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b,
+    0x1cd36813, 0x74d044db, 0x27180901, 0x4f1b25c9, 0xf71e5091,
+    0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+    0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898,
+    0x05d66450, 0xbdd31108, 0xd5d03dc0, 0x8618701a, 0xee1b5cd2,
+    0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b,
+    0x9bfdc093, 0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7,
+    0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766, 0x1a438abc,
+    0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5,
+    0x6fa516fd, 0x07a63a35, 0x8fd9098e, 0xe7da2546, 0x5fdf501e,
+    0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+    0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c,
+    0x0c171dc4, 0xb412689c, 0xdc114454, 0x1382f328, 0x7b81dfe0,
+    0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69,
+    0x0e6743a1, 0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23,
+    0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2, 0xb2828a33,
+    0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a,
+    0xc7641672, 0xaf673aba, 0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0,
+    0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+    0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544,
+    0xe33a998c, 0x5b3fecd4, 0x333cc01c, 0x60f48dc6, 0x08f7a10e,
+    0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187,
+    0x7d113d4f},
+   {0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777,
+    0x5dc55c6e, 0x697997b4, 0x8649fcad, 0x6006181f, 0x8f367306,
+    0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab,
+    0xe64fe4b2, 0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4,
+    0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93, 0xa00a2821,
+    0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f,
+    0xc973bf95, 0x2643d48c, 0x85f4168d, 0x6ac47d94, 0x5e78b64e,
+    0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+    0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5,
+    0xb83752fc, 0x8c8b9926, 0x63bbf23f, 0x45f826b3, 0xaac84daa,
+    0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107,
+    0xc3b1da1e, 0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576,
+    0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201, 0x0e045beb,
+    0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785,
+    0x677dcc5f, 0x884da746, 0x6e0243f4, 0x813228ed, 0xb58ee337,
+    0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+    0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2,
+    0x93cd37bb, 0xa771fc61, 0x48419778, 0xae0e73ca, 0x413e18d3,
+    0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e,
+    0x28478f67, 0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc,
+    0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb, 0xebf65579,
+    0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917,
+    0x828fc2cd, 0x6dbfa9d4, 0x4bfc7d58, 0xa4cc1641, 0x9070dd9b,
+    0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+    0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230,
+    0x763f3929, 0x4283f2f3, 0xadb399ea, 0x1c08b7d6, 0xf338dccf,
+    0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062,
+    0x9a414b7b, 0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413,
+    0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364, 0xdc0487e8,
+    0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86,
+    0xb57d105c, 0x5a4d7b45, 0xbc029ff7, 0x5332f4ee, 0x678e3f34,
+    0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+    0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c,
+    0xc439fd35, 0xf08536ef, 0x1fb55df6, 0xf9fab944, 0x16cad25d,
+    0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0,
+    0x7fb345e9, 0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf,
+    0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8, 0x39f6897a,
+    0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514,
+    0x508f1ece, 0xbfbf75d7, 0x120cec3d, 0xfd3c8724, 0xc9804cfe,
+    0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+    0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355,
+    0x2fcfa84c, 0x1b736396, 0xf443088f, 0xd200dc03, 0x3d30b71a,
+    0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7,
+    0x544920ae, 0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6,
+    0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1, 0x97f8fab0,
+    0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de,
+    0xfe816d04, 0x11b1061d, 0xf7fee2af, 0x18ce89b6, 0x2c72426c,
+    0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+    0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9,
+    0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623, 0x37f2d291, 0xd8c2b988,
+    0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525,
+    0xb1bb2e3c},
+   {0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0,
+    0xd854d11c, 0x906761e8, 0xa8760e44, 0xc5670b91, 0xfd76643d,
+    0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79,
+    0x6d1105d5, 0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127,
+    0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97, 0x4a456a42,
+    0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e,
+    0xda220baa, 0xe2336406, 0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f,
+    0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+    0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076,
+    0x069b6fda, 0x4ea8df2e, 0x76b9b082, 0x948ad484, 0xac9bbb28,
+    0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c,
+    0x3cfcdac0, 0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1,
+    0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151, 0x37516aae,
+    0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2,
+    0xa7360b46, 0x9f2764ea, 0xf236613f, 0xca270e93, 0x8214be67,
+    0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+    0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd,
+    0x6027da61, 0x28146a95, 0x10050539, 0x7d1400ec, 0x45056f40,
+    0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104,
+    0xd5620ea8, 0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d,
+    0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd, 0xe99ed468,
+    0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574,
+    0x79f9b580, 0x41e8da2c, 0xa3dbbe2a, 0x9bcad186, 0xd3f96172,
+    0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+    0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b,
+    0xbee864a7, 0xf6dbd453, 0xcecabbff, 0x6ea2d55c, 0x56b3baf0,
+    0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4,
+    0xc6d4db18, 0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39,
+    0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089, 0xe180b48f,
+    0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593,
+    0x71e7d567, 0x49f6bacb, 0x24e7bf1e, 0x1cf6d0b2, 0x54c56046,
+    0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+    0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb,
+    0xad5eb117, 0xe56d01e3, 0xdd7c6e4f, 0xb06d6b9a, 0x887c0436,
+    0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72,
+    0x181b65de, 0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c,
+    0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c, 0x3f4f0a49,
+    0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55,
+    0xaf286ba1, 0x9739040d, 0x59f3bff2, 0x61e2d05e, 0x29d160aa,
+    0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+    0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3,
+    0x44c0657f, 0x0cf3d58b, 0x34e2ba27, 0xd6d1de21, 0xeec0b18d,
+    0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9,
+    0x7ea7d065, 0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544,
+    0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4, 0x425b0aa5,
+    0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9,
+    0xd23c6b4d, 0xea2d04e1, 0x873c0134, 0xbf2d6e98, 0xf71ede6c,
+    0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+    0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6,
+    0x152dba6a, 0x5d1e0a9e, 0x650f6532, 0x081e60e7, 0x300f0f4b,
+    0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f,
+    0xa0686ea3}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0xac6f1138, 0x58df2270, 0xf4b03348, 0xb0be45e0,
+    0x1cd154d8, 0xe8616790, 0x440e76a8, 0x910b67c5, 0x3d6476fd,
+    0xc9d445b5, 0x65bb548d, 0x21b52225, 0x8dda331d, 0x796a0055,
+    0xd505116d, 0xd361228f, 0x7f0e33b7, 0x8bbe00ff, 0x27d111c7,
+    0x63df676f, 0xcfb07657, 0x3b00451f, 0x976f5427, 0x426a454a,
+    0xee055472, 0x1ab5673a, 0xb6da7602, 0xf2d400aa, 0x5ebb1192,
+    0xaa0b22da, 0x066433e2, 0x57b5a81b, 0xfbdab923, 0x0f6a8a6b,
+    0xa3059b53, 0xe70bedfb, 0x4b64fcc3, 0xbfd4cf8b, 0x13bbdeb3,
+    0xc6becfde, 0x6ad1dee6, 0x9e61edae, 0x320efc96, 0x76008a3e,
+    0xda6f9b06, 0x2edfa84e, 0x82b0b976, 0x84d48a94, 0x28bb9bac,
+    0xdc0ba8e4, 0x7064b9dc, 0x346acf74, 0x9805de4c, 0x6cb5ed04,
+    0xc0dafc3c, 0x15dfed51, 0xb9b0fc69, 0x4d00cf21, 0xe16fde19,
+    0xa561a8b1, 0x090eb989, 0xfdbe8ac1, 0x51d19bf9, 0xae6a5137,
+    0x0205400f, 0xf6b57347, 0x5ada627f, 0x1ed414d7, 0xb2bb05ef,
+    0x460b36a7, 0xea64279f, 0x3f6136f2, 0x930e27ca, 0x67be1482,
+    0xcbd105ba, 0x8fdf7312, 0x23b0622a, 0xd7005162, 0x7b6f405a,
+    0x7d0b73b8, 0xd1646280, 0x25d451c8, 0x89bb40f0, 0xcdb53658,
+    0x61da2760, 0x956a1428, 0x39050510, 0xec00147d, 0x406f0545,
+    0xb4df360d, 0x18b02735, 0x5cbe519d, 0xf0d140a5, 0x046173ed,
+    0xa80e62d5, 0xf9dff92c, 0x55b0e814, 0xa100db5c, 0x0d6fca64,
+    0x4961bccc, 0xe50eadf4, 0x11be9ebc, 0xbdd18f84, 0x68d49ee9,
+    0xc4bb8fd1, 0x300bbc99, 0x9c64ada1, 0xd86adb09, 0x7405ca31,
+    0x80b5f979, 0x2cdae841, 0x2abedba3, 0x86d1ca9b, 0x7261f9d3,
+    0xde0ee8eb, 0x9a009e43, 0x366f8f7b, 0xc2dfbc33, 0x6eb0ad0b,
+    0xbbb5bc66, 0x17daad5e, 0xe36a9e16, 0x4f058f2e, 0x0b0bf986,
+    0xa764e8be, 0x53d4dbf6, 0xffbbcace, 0x5cd5a26e, 0xf0bab356,
+    0x040a801e, 0xa8659126, 0xec6be78e, 0x4004f6b6, 0xb4b4c5fe,
+    0x18dbd4c6, 0xcddec5ab, 0x61b1d493, 0x9501e7db, 0x396ef6e3,
+    0x7d60804b, 0xd10f9173, 0x25bfa23b, 0x89d0b303, 0x8fb480e1,
+    0x23db91d9, 0xd76ba291, 0x7b04b3a9, 0x3f0ac501, 0x9365d439,
+    0x67d5e771, 0xcbbaf649, 0x1ebfe724, 0xb2d0f61c, 0x4660c554,
+    0xea0fd46c, 0xae01a2c4, 0x026eb3fc, 0xf6de80b4, 0x5ab1918c,
+    0x0b600a75, 0xa70f1b4d, 0x53bf2805, 0xffd0393d, 0xbbde4f95,
+    0x17b15ead, 0xe3016de5, 0x4f6e7cdd, 0x9a6b6db0, 0x36047c88,
+    0xc2b44fc0, 0x6edb5ef8, 0x2ad52850, 0x86ba3968, 0x720a0a20,
+    0xde651b18, 0xd80128fa, 0x746e39c2, 0x80de0a8a, 0x2cb11bb2,
+    0x68bf6d1a, 0xc4d07c22, 0x30604f6a, 0x9c0f5e52, 0x490a4f3f,
+    0xe5655e07, 0x11d56d4f, 0xbdba7c77, 0xf9b40adf, 0x55db1be7,
+    0xa16b28af, 0x0d043997, 0xf2bff359, 0x5ed0e261, 0xaa60d129,
+    0x060fc011, 0x4201b6b9, 0xee6ea781, 0x1ade94c9, 0xb6b185f1,
+    0x63b4949c, 0xcfdb85a4, 0x3b6bb6ec, 0x9704a7d4, 0xd30ad17c,
+    0x7f65c044, 0x8bd5f30c, 0x27bae234, 0x21ded1d6, 0x8db1c0ee,
+    0x7901f3a6, 0xd56ee29e, 0x91609436, 0x3d0f850e, 0xc9bfb646,
+    0x65d0a77e, 0xb0d5b613, 0x1cbaa72b, 0xe80a9463, 0x4465855b,
+    0x006bf3f3, 0xac04e2cb, 0x58b4d183, 0xf4dbc0bb, 0xa50a5b42,
+    0x09654a7a, 0xfdd57932, 0x51ba680a, 0x15b41ea2, 0xb9db0f9a,
+    0x4d6b3cd2, 0xe1042dea, 0x34013c87, 0x986e2dbf, 0x6cde1ef7,
+    0xc0b10fcf, 0x84bf7967, 0x28d0685f, 0xdc605b17, 0x700f4a2f,
+    0x766b79cd, 0xda0468f5, 0x2eb45bbd, 0x82db4a85, 0xc6d53c2d,
+    0x6aba2d15, 0x9e0a1e5d, 0x32650f65, 0xe7601e08, 0x4b0f0f30,
+    0xbfbf3c78, 0x13d02d40, 0x57de5be8, 0xfbb14ad0, 0x0f017998,
+    0xa36e68a0},
+   {0x00000000, 0x196b30ef, 0xc3a08cdb, 0xdacbbc34, 0x7737f5b2,
+    0x6e5cc55d, 0xb4977969, 0xadfc4986, 0x1f180660, 0x0673368f,
+    0xdcb88abb, 0xc5d3ba54, 0x682ff3d2, 0x7144c33d, 0xab8f7f09,
+    0xb2e44fe6, 0x3e300cc0, 0x275b3c2f, 0xfd90801b, 0xe4fbb0f4,
+    0x4907f972, 0x506cc99d, 0x8aa775a9, 0x93cc4546, 0x21280aa0,
+    0x38433a4f, 0xe288867b, 0xfbe3b694, 0x561fff12, 0x4f74cffd,
+    0x95bf73c9, 0x8cd44326, 0x8d16f485, 0x947dc46a, 0x4eb6785e,
+    0x57dd48b1, 0xfa210137, 0xe34a31d8, 0x39818dec, 0x20eabd03,
+    0x920ef2e5, 0x8b65c20a, 0x51ae7e3e, 0x48c54ed1, 0xe5390757,
+    0xfc5237b8, 0x26998b8c, 0x3ff2bb63, 0xb326f845, 0xaa4dc8aa,
+    0x7086749e, 0x69ed4471, 0xc4110df7, 0xdd7a3d18, 0x07b1812c,
+    0x1edab1c3, 0xac3efe25, 0xb555ceca, 0x6f9e72fe, 0x76f54211,
+    0xdb090b97, 0xc2623b78, 0x18a9874c, 0x01c2b7a3, 0xeb5b040e,
+    0xf23034e1, 0x28fb88d5, 0x3190b83a, 0x9c6cf1bc, 0x8507c153,
+    0x5fcc7d67, 0x46a74d88, 0xf443026e, 0xed283281, 0x37e38eb5,
+    0x2e88be5a, 0x8374f7dc, 0x9a1fc733, 0x40d47b07, 0x59bf4be8,
+    0xd56b08ce, 0xcc003821, 0x16cb8415, 0x0fa0b4fa, 0xa25cfd7c,
+    0xbb37cd93, 0x61fc71a7, 0x78974148, 0xca730eae, 0xd3183e41,
+    0x09d38275, 0x10b8b29a, 0xbd44fb1c, 0xa42fcbf3, 0x7ee477c7,
+    0x678f4728, 0x664df08b, 0x7f26c064, 0xa5ed7c50, 0xbc864cbf,
+    0x117a0539, 0x081135d6, 0xd2da89e2, 0xcbb1b90d, 0x7955f6eb,
+    0x603ec604, 0xbaf57a30, 0xa39e4adf, 0x0e620359, 0x170933b6,
+    0xcdc28f82, 0xd4a9bf6d, 0x587dfc4b, 0x4116cca4, 0x9bdd7090,
+    0x82b6407f, 0x2f4a09f9, 0x36213916, 0xecea8522, 0xf581b5cd,
+    0x4765fa2b, 0x5e0ecac4, 0x84c576f0, 0x9dae461f, 0x30520f99,
+    0x29393f76, 0xf3f28342, 0xea99b3ad, 0xd6b7081c, 0xcfdc38f3,
+    0x151784c7, 0x0c7cb428, 0xa180fdae, 0xb8ebcd41, 0x62207175,
+    0x7b4b419a, 0xc9af0e7c, 0xd0c43e93, 0x0a0f82a7, 0x1364b248,
+    0xbe98fbce, 0xa7f3cb21, 0x7d387715, 0x645347fa, 0xe88704dc,
+    0xf1ec3433, 0x2b278807, 0x324cb8e8, 0x9fb0f16e, 0x86dbc181,
+    0x5c107db5, 0x457b4d5a, 0xf79f02bc, 0xeef43253, 0x343f8e67,
+    0x2d54be88, 0x80a8f70e, 0x99c3c7e1, 0x43087bd5, 0x5a634b3a,
+    0x5ba1fc99, 0x42cacc76, 0x98017042, 0x816a40ad, 0x2c96092b,
+    0x35fd39c4, 0xef3685f0, 0xf65db51f, 0x44b9faf9, 0x5dd2ca16,
+    0x87197622, 0x9e7246cd, 0x338e0f4b, 0x2ae53fa4, 0xf02e8390,
+    0xe945b37f, 0x6591f059, 0x7cfac0b6, 0xa6317c82, 0xbf5a4c6d,
+    0x12a605eb, 0x0bcd3504, 0xd1068930, 0xc86db9df, 0x7a89f639,
+    0x63e2c6d6, 0xb9297ae2, 0xa0424a0d, 0x0dbe038b, 0x14d53364,
+    0xce1e8f50, 0xd775bfbf, 0x3dec0c12, 0x24873cfd, 0xfe4c80c9,
+    0xe727b026, 0x4adbf9a0, 0x53b0c94f, 0x897b757b, 0x90104594,
+    0x22f40a72, 0x3b9f3a9d, 0xe15486a9, 0xf83fb646, 0x55c3ffc0,
+    0x4ca8cf2f, 0x9663731b, 0x8f0843f4, 0x03dc00d2, 0x1ab7303d,
+    0xc07c8c09, 0xd917bce6, 0x74ebf560, 0x6d80c58f, 0xb74b79bb,
+    0xae204954, 0x1cc406b2, 0x05af365d, 0xdf648a69, 0xc60fba86,
+    0x6bf3f300, 0x7298c3ef, 0xa8537fdb, 0xb1384f34, 0xb0faf897,
+    0xa991c878, 0x735a744c, 0x6a3144a3, 0xc7cd0d25, 0xdea63dca,
+    0x046d81fe, 0x1d06b111, 0xafe2fef7, 0xb689ce18, 0x6c42722c,
+    0x752942c3, 0xd8d50b45, 0xc1be3baa, 0x1b75879e, 0x021eb771,
+    0x8ecaf457, 0x97a1c4b8, 0x4d6a788c, 0x54014863, 0xf9fd01e5,
+    0xe096310a, 0x3a5d8d3e, 0x2336bdd1, 0x91d2f237, 0x88b9c2d8,
+    0x52727eec, 0x4b194e03, 0xe6e50785, 0xff8e376a, 0x25458b5e,
+    0x3c2ebbb1},
+   {0x00000000, 0xc82c0368, 0x905906d0, 0x587505b8, 0xd1c5e0a5,
+    0x19e9e3cd, 0x419ce675, 0x89b0e51d, 0x53fd2d4e, 0x9bd12e26,
+    0xc3a42b9e, 0x0b8828f6, 0x8238cdeb, 0x4a14ce83, 0x1261cb3b,
+    0xda4dc853, 0xa6fa5b9c, 0x6ed658f4, 0x36a35d4c, 0xfe8f5e24,
+    0x773fbb39, 0xbf13b851, 0xe766bde9, 0x2f4abe81, 0xf50776d2,
+    0x3d2b75ba, 0x655e7002, 0xad72736a, 0x24c29677, 0xecee951f,
+    0xb49b90a7, 0x7cb793cf, 0xbd835b3d, 0x75af5855, 0x2dda5ded,
+    0xe5f65e85, 0x6c46bb98, 0xa46ab8f0, 0xfc1fbd48, 0x3433be20,
+    0xee7e7673, 0x2652751b, 0x7e2770a3, 0xb60b73cb, 0x3fbb96d6,
+    0xf79795be, 0xafe29006, 0x67ce936e, 0x1b7900a1, 0xd35503c9,
+    0x8b200671, 0x430c0519, 0xcabce004, 0x0290e36c, 0x5ae5e6d4,
+    0x92c9e5bc, 0x48842def, 0x80a82e87, 0xd8dd2b3f, 0x10f12857,
+    0x9941cd4a, 0x516dce22, 0x0918cb9a, 0xc134c8f2, 0x7a07b77a,
+    0xb22bb412, 0xea5eb1aa, 0x2272b2c2, 0xabc257df, 0x63ee54b7,
+    0x3b9b510f, 0xf3b75267, 0x29fa9a34, 0xe1d6995c, 0xb9a39ce4,
+    0x718f9f8c, 0xf83f7a91, 0x301379f9, 0x68667c41, 0xa04a7f29,
+    0xdcfdece6, 0x14d1ef8e, 0x4ca4ea36, 0x8488e95e, 0x0d380c43,
+    0xc5140f2b, 0x9d610a93, 0x554d09fb, 0x8f00c1a8, 0x472cc2c0,
+    0x1f59c778, 0xd775c410, 0x5ec5210d, 0x96e92265, 0xce9c27dd,
+    0x06b024b5, 0xc784ec47, 0x0fa8ef2f, 0x57ddea97, 0x9ff1e9ff,
+    0x16410ce2, 0xde6d0f8a, 0x86180a32, 0x4e34095a, 0x9479c109,
+    0x5c55c261, 0x0420c7d9, 0xcc0cc4b1, 0x45bc21ac, 0x8d9022c4,
+    0xd5e5277c, 0x1dc92414, 0x617eb7db, 0xa952b4b3, 0xf127b10b,
+    0x390bb263, 0xb0bb577e, 0x78975416, 0x20e251ae, 0xe8ce52c6,
+    0x32839a95, 0xfaaf99fd, 0xa2da9c45, 0x6af69f2d, 0xe3467a30,
+    0x2b6a7958, 0x731f7ce0, 0xbb337f88, 0xf40e6ef5, 0x3c226d9d,
+    0x64576825, 0xac7b6b4d, 0x25cb8e50, 0xede78d38, 0xb5928880,
+    0x7dbe8be8, 0xa7f343bb, 0x6fdf40d3, 0x37aa456b, 0xff864603,
+    0x7636a31e, 0xbe1aa076, 0xe66fa5ce, 0x2e43a6a6, 0x52f43569,
+    0x9ad83601, 0xc2ad33b9, 0x0a8130d1, 0x8331d5cc, 0x4b1dd6a4,
+    0x1368d31c, 0xdb44d074, 0x01091827, 0xc9251b4f, 0x91501ef7,
+    0x597c1d9f, 0xd0ccf882, 0x18e0fbea, 0x4095fe52, 0x88b9fd3a,
+    0x498d35c8, 0x81a136a0, 0xd9d43318, 0x11f83070, 0x9848d56d,
+    0x5064d605, 0x0811d3bd, 0xc03dd0d5, 0x1a701886, 0xd25c1bee,
+    0x8a291e56, 0x42051d3e, 0xcbb5f823, 0x0399fb4b, 0x5becfef3,
+    0x93c0fd9b, 0xef776e54, 0x275b6d3c, 0x7f2e6884, 0xb7026bec,
+    0x3eb28ef1, 0xf69e8d99, 0xaeeb8821, 0x66c78b49, 0xbc8a431a,
+    0x74a64072, 0x2cd345ca, 0xe4ff46a2, 0x6d4fa3bf, 0xa563a0d7,
+    0xfd16a56f, 0x353aa607, 0x8e09d98f, 0x4625dae7, 0x1e50df5f,
+    0xd67cdc37, 0x5fcc392a, 0x97e03a42, 0xcf953ffa, 0x07b93c92,
+    0xddf4f4c1, 0x15d8f7a9, 0x4dadf211, 0x8581f179, 0x0c311464,
+    0xc41d170c, 0x9c6812b4, 0x544411dc, 0x28f38213, 0xe0df817b,
+    0xb8aa84c3, 0x708687ab, 0xf93662b6, 0x311a61de, 0x696f6466,
+    0xa143670e, 0x7b0eaf5d, 0xb322ac35, 0xeb57a98d, 0x237baae5,
+    0xaacb4ff8, 0x62e74c90, 0x3a924928, 0xf2be4a40, 0x338a82b2,
+    0xfba681da, 0xa3d38462, 0x6bff870a, 0xe24f6217, 0x2a63617f,
+    0x721664c7, 0xba3a67af, 0x6077affc, 0xa85bac94, 0xf02ea92c,
+    0x3802aa44, 0xb1b24f59, 0x799e4c31, 0x21eb4989, 0xe9c74ae1,
+    0x9570d92e, 0x5d5cda46, 0x0529dffe, 0xcd05dc96, 0x44b5398b,
+    0x8c993ae3, 0xd4ec3f5b, 0x1cc03c33, 0xc68df460, 0x0ea1f708,
+    0x56d4f2b0, 0x9ef8f1d8, 0x174814c5, 0xdf6417ad, 0x87111215,
+    0x4f3d117d},
+   {0x00000000, 0x277d3c49, 0x4efa7892, 0x698744db, 0x6d821d21,
+    0x4aff2168, 0x237865b3, 0x040559fa, 0xda043b42, 0xfd79070b,
+    0x94fe43d0, 0xb3837f99, 0xb7862663, 0x90fb1a2a, 0xf97c5ef1,
+    0xde0162b8, 0xb4097684, 0x93744acd, 0xfaf30e16, 0xdd8e325f,
+    0xd98b6ba5, 0xfef657ec, 0x97711337, 0xb00c2f7e, 0x6e0d4dc6,
+    0x4970718f, 0x20f73554, 0x078a091d, 0x038f50e7, 0x24f26cae,
+    0x4d752875, 0x6a08143c, 0x9965000d, 0xbe183c44, 0xd79f789f,
+    0xf0e244d6, 0xf4e71d2c, 0xd39a2165, 0xba1d65be, 0x9d6059f7,
+    0x43613b4f, 0x641c0706, 0x0d9b43dd, 0x2ae67f94, 0x2ee3266e,
+    0x099e1a27, 0x60195efc, 0x476462b5, 0x2d6c7689, 0x0a114ac0,
+    0x63960e1b, 0x44eb3252, 0x40ee6ba8, 0x679357e1, 0x0e14133a,
+    0x29692f73, 0xf7684dcb, 0xd0157182, 0xb9923559, 0x9eef0910,
+    0x9aea50ea, 0xbd976ca3, 0xd4102878, 0xf36d1431, 0x32cb001a,
+    0x15b63c53, 0x7c317888, 0x5b4c44c1, 0x5f491d3b, 0x78342172,
+    0x11b365a9, 0x36ce59e0, 0xe8cf3b58, 0xcfb20711, 0xa63543ca,
+    0x81487f83, 0x854d2679, 0xa2301a30, 0xcbb75eeb, 0xecca62a2,
+    0x86c2769e, 0xa1bf4ad7, 0xc8380e0c, 0xef453245, 0xeb406bbf,
+    0xcc3d57f6, 0xa5ba132d, 0x82c72f64, 0x5cc64ddc, 0x7bbb7195,
+    0x123c354e, 0x35410907, 0x314450fd, 0x16396cb4, 0x7fbe286f,
+    0x58c31426, 0xabae0017, 0x8cd33c5e, 0xe5547885, 0xc22944cc,
+    0xc62c1d36, 0xe151217f, 0x88d665a4, 0xafab59ed, 0x71aa3b55,
+    0x56d7071c, 0x3f5043c7, 0x182d7f8e, 0x1c282674, 0x3b551a3d,
+    0x52d25ee6, 0x75af62af, 0x1fa77693, 0x38da4ada, 0x515d0e01,
+    0x76203248, 0x72256bb2, 0x555857fb, 0x3cdf1320, 0x1ba22f69,
+    0xc5a34dd1, 0xe2de7198, 0x8b593543, 0xac24090a, 0xa82150f0,
+    0x8f5c6cb9, 0xe6db2862, 0xc1a6142b, 0x64960134, 0x43eb3d7d,
+    0x2a6c79a6, 0x0d1145ef, 0x09141c15, 0x2e69205c, 0x47ee6487,
+    0x609358ce, 0xbe923a76, 0x99ef063f, 0xf06842e4, 0xd7157ead,
+    0xd3102757, 0xf46d1b1e, 0x9dea5fc5, 0xba97638c, 0xd09f77b0,
+    0xf7e24bf9, 0x9e650f22, 0xb918336b, 0xbd1d6a91, 0x9a6056d8,
+    0xf3e71203, 0xd49a2e4a, 0x0a9b4cf2, 0x2de670bb, 0x44613460,
+    0x631c0829, 0x671951d3, 0x40646d9a, 0x29e32941, 0x0e9e1508,
+    0xfdf30139, 0xda8e3d70, 0xb30979ab, 0x947445e2, 0x90711c18,
+    0xb70c2051, 0xde8b648a, 0xf9f658c3, 0x27f73a7b, 0x008a0632,
+    0x690d42e9, 0x4e707ea0, 0x4a75275a, 0x6d081b13, 0x048f5fc8,
+    0x23f26381, 0x49fa77bd, 0x6e874bf4, 0x07000f2f, 0x207d3366,
+    0x24786a9c, 0x030556d5, 0x6a82120e, 0x4dff2e47, 0x93fe4cff,
+    0xb48370b6, 0xdd04346d, 0xfa790824, 0xfe7c51de, 0xd9016d97,
+    0xb086294c, 0x97fb1505, 0x565d012e, 0x71203d67, 0x18a779bc,
+    0x3fda45f5, 0x3bdf1c0f, 0x1ca22046, 0x7525649d, 0x525858d4,
+    0x8c593a6c, 0xab240625, 0xc2a342fe, 0xe5de7eb7, 0xe1db274d,
+    0xc6a61b04, 0xaf215fdf, 0x885c6396, 0xe25477aa, 0xc5294be3,
+    0xacae0f38, 0x8bd33371, 0x8fd66a8b, 0xa8ab56c2, 0xc12c1219,
+    0xe6512e50, 0x38504ce8, 0x1f2d70a1, 0x76aa347a, 0x51d70833,
+    0x55d251c9, 0x72af6d80, 0x1b28295b, 0x3c551512, 0xcf380123,
+    0xe8453d6a, 0x81c279b1, 0xa6bf45f8, 0xa2ba1c02, 0x85c7204b,
+    0xec406490, 0xcb3d58d9, 0x153c3a61, 0x32410628, 0x5bc642f3,
+    0x7cbb7eba, 0x78be2740, 0x5fc31b09, 0x36445fd2, 0x1139639b,
+    0x7b3177a7, 0x5c4c4bee, 0x35cb0f35, 0x12b6337c, 0x16b36a86,
+    0x31ce56cf, 0x58491214, 0x7f342e5d, 0xa1354ce5, 0x864870ac,
+    0xefcf3477, 0xc8b2083e, 0xccb751c4, 0xebca6d8d, 0x824d2956,
+    0xa530151f}};
+
+#endif /* W */
+
+#endif /* N == 2 */
+#if N == 3
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xba4fc28e, 0x7173f3ed, 0xcb3c3163, 0xe2e7e7da,
+    0x58a82554, 0x93941437, 0x29dbd6b9, 0xc023b945, 0x7a6c7bcb,
+    0xb1504aa8, 0x0b1f8826, 0x22c45e9f, 0x988b9c11, 0x53b7ad72,
+    0xe9f86ffc, 0x85ab047b, 0x3fe4c6f5, 0xf4d8f796, 0x4e973518,
+    0x674ce3a1, 0xdd03212f, 0x163f104c, 0xac70d2c2, 0x4588bd3e,
+    0xffc77fb0, 0x34fb4ed3, 0x8eb48c5d, 0xa76f5ae4, 0x1d20986a,
+    0xd61ca909, 0x6c536b87, 0x0eba7e07, 0xb4f5bc89, 0x7fc98dea,
+    0xc5864f64, 0xec5d99dd, 0x56125b53, 0x9d2e6a30, 0x2761a8be,
+    0xce99c742, 0x74d605cc, 0xbfea34af, 0x05a5f621, 0x2c7e2098,
+    0x9631e216, 0x5d0dd375, 0xe74211fb, 0x8b117a7c, 0x315eb8f2,
+    0xfa628991, 0x402d4b1f, 0x69f69da6, 0xd3b95f28, 0x18856e4b,
+    0xa2caacc5, 0x4b32c339, 0xf17d01b7, 0x3a4130d4, 0x800ef25a,
+    0xa9d524e3, 0x139ae66d, 0xd8a6d70e, 0x62e91580, 0x1d74fc0e,
+    0xa73b3e80, 0x6c070fe3, 0xd648cd6d, 0xff931bd4, 0x45dcd95a,
+    0x8ee0e839, 0x34af2ab7, 0xdd57454b, 0x671887c5, 0xac24b6a6,
+    0x166b7428, 0x3fb0a291, 0x85ff601f, 0x4ec3517c, 0xf48c93f2,
+    0x98dff875, 0x22903afb, 0xe9ac0b98, 0x53e3c916, 0x7a381faf,
+    0xc077dd21, 0x0b4bec42, 0xb1042ecc, 0x58fc4130, 0xe2b383be,
+    0x298fb2dd, 0x93c07053, 0xba1ba6ea, 0x00546464, 0xcb685507,
+    0x71279789, 0x13ce8209, 0xa9814087, 0x62bd71e4, 0xd8f2b36a,
+    0xf12965d3, 0x4b66a75d, 0x805a963e, 0x3a1554b0, 0xd3ed3b4c,
+    0x69a2f9c2, 0xa29ec8a1, 0x18d10a2f, 0x310adc96, 0x8b451e18,
+    0x40792f7b, 0xfa36edf5, 0x96658672, 0x2c2a44fc, 0xe716759f,
+    0x5d59b711, 0x748261a8, 0xcecda326, 0x05f19245, 0xbfbe50cb,
+    0x56463f37, 0xec09fdb9, 0x2735ccda, 0x9d7a0e54, 0xb4a1d8ed,
+    0x0eee1a63, 0xc5d22b00, 0x7f9de98e, 0x3ae9f81c, 0x80a63a92,
+    0x4b9a0bf1, 0xf1d5c97f, 0xd80e1fc6, 0x6241dd48, 0xa97dec2b,
+    0x13322ea5, 0xfaca4159, 0x408583d7, 0x8bb9b2b4, 0x31f6703a,
+    0x182da683, 0xa262640d, 0x695e556e, 0xd31197e0, 0xbf42fc67,
+    0x050d3ee9, 0xce310f8a, 0x747ecd04, 0x5da51bbd, 0xe7ead933,
+    0x2cd6e850, 0x96992ade, 0x7f614522, 0xc52e87ac, 0x0e12b6cf,
+    0xb45d7441, 0x9d86a2f8, 0x27c96076, 0xecf55115, 0x56ba939b,
+    0x3453861b, 0x8e1c4495, 0x452075f6, 0xff6fb778, 0xd6b461c1,
+    0x6cfba34f, 0xa7c7922c, 0x1d8850a2, 0xf4703f5e, 0x4e3ffdd0,
+    0x8503ccb3, 0x3f4c0e3d, 0x1697d884, 0xacd81a0a, 0x67e42b69,
+    0xddabe9e7, 0xb1f88260, 0x0bb740ee, 0xc08b718d, 0x7ac4b303,
+    0x531f65ba, 0xe950a734, 0x226c9657, 0x982354d9, 0x71db3b25,
+    0xcb94f9ab, 0x00a8c8c8, 0xbae70a46, 0x933cdcff, 0x29731e71,
+    0xe24f2f12, 0x5800ed9c, 0x279d0412, 0x9dd2c69c, 0x56eef7ff,
+    0xeca13571, 0xc57ae3c8, 0x7f352146, 0xb4091025, 0x0e46d2ab,
+    0xe7bebd57, 0x5df17fd9, 0x96cd4eba, 0x2c828c34, 0x05595a8d,
+    0xbf169803, 0x742aa960, 0xce656bee, 0xa2360069, 0x1879c2e7,
+    0xd345f384, 0x690a310a, 0x40d1e7b3, 0xfa9e253d, 0x31a2145e,
+    0x8bedd6d0, 0x6215b92c, 0xd85a7ba2, 0x13664ac1, 0xa929884f,
+    0x80f25ef6, 0x3abd9c78, 0xf181ad1b, 0x4bce6f95, 0x29277a15,
+    0x9368b89b, 0x585489f8, 0xe21b4b76, 0xcbc09dcf, 0x718f5f41,
+    0xbab36e22, 0x00fcacac, 0xe904c350, 0x534b01de, 0x987730bd,
+    0x2238f233, 0x0be3248a, 0xb1ace604, 0x7a90d767, 0xc0df15e9,
+    0xac8c7e6e, 0x16c3bce0, 0xddff8d83, 0x67b04f0d, 0x4e6b99b4,
+    0xf4245b3a, 0x3f186a59, 0x8557a8d7, 0x6cafc72b, 0xd6e005a5,
+    0x1ddc34c6, 0xa793f648, 0x8e4820f1, 0x3407e27f, 0xff3bd31c,
+    0x45741192},
+   {0x00000000, 0x75d3f038, 0xeba7e070, 0x9e741048, 0xd2a3b611,
+    0xa7704629, 0x39045661, 0x4cd7a659, 0xa0ab1ad3, 0xd578eaeb,
+    0x4b0cfaa3, 0x3edf0a9b, 0x7208acc2, 0x07db5cfa, 0x99af4cb2,
+    0xec7cbc8a, 0x44ba4357, 0x3169b36f, 0xaf1da327, 0xdace531f,
+    0x9619f546, 0xe3ca057e, 0x7dbe1536, 0x086de50e, 0xe4115984,
+    0x91c2a9bc, 0x0fb6b9f4, 0x7a6549cc, 0x36b2ef95, 0x43611fad,
+    0xdd150fe5, 0xa8c6ffdd, 0x897486ae, 0xfca77696, 0x62d366de,
+    0x170096e6, 0x5bd730bf, 0x2e04c087, 0xb070d0cf, 0xc5a320f7,
+    0x29df9c7d, 0x5c0c6c45, 0xc2787c0d, 0xb7ab8c35, 0xfb7c2a6c,
+    0x8eafda54, 0x10dbca1c, 0x65083a24, 0xcdcec5f9, 0xb81d35c1,
+    0x26692589, 0x53bad5b1, 0x1f6d73e8, 0x6abe83d0, 0xf4ca9398,
+    0x811963a0, 0x6d65df2a, 0x18b62f12, 0x86c23f5a, 0xf311cf62,
+    0xbfc6693b, 0xca159903, 0x5461894b, 0x21b27973, 0x17057bad,
+    0x62d68b95, 0xfca29bdd, 0x89716be5, 0xc5a6cdbc, 0xb0753d84,
+    0x2e012dcc, 0x5bd2ddf4, 0xb7ae617e, 0xc27d9146, 0x5c09810e,
+    0x29da7136, 0x650dd76f, 0x10de2757, 0x8eaa371f, 0xfb79c727,
+    0x53bf38fa, 0x266cc8c2, 0xb818d88a, 0xcdcb28b2, 0x811c8eeb,
+    0xf4cf7ed3, 0x6abb6e9b, 0x1f689ea3, 0xf3142229, 0x86c7d211,
+    0x18b3c259, 0x6d603261, 0x21b79438, 0x54646400, 0xca107448,
+    0xbfc38470, 0x9e71fd03, 0xeba20d3b, 0x75d61d73, 0x0005ed4b,
+    0x4cd24b12, 0x3901bb2a, 0xa775ab62, 0xd2a65b5a, 0x3edae7d0,
+    0x4b0917e8, 0xd57d07a0, 0xa0aef798, 0xec7951c1, 0x99aaa1f9,
+    0x07deb1b1, 0x720d4189, 0xdacbbe54, 0xaf184e6c, 0x316c5e24,
+    0x44bfae1c, 0x08680845, 0x7dbbf87d, 0xe3cfe835, 0x961c180d,
+    0x7a60a487, 0x0fb354bf, 0x91c744f7, 0xe414b4cf, 0xa8c31296,
+    0xdd10e2ae, 0x4364f2e6, 0x36b702de, 0x2e0af75a, 0x5bd90762,
+    0xc5ad172a, 0xb07ee712, 0xfca9414b, 0x897ab173, 0x170ea13b,
+    0x62dd5103, 0x8ea1ed89, 0xfb721db1, 0x65060df9, 0x10d5fdc1,
+    0x5c025b98, 0x29d1aba0, 0xb7a5bbe8, 0xc2764bd0, 0x6ab0b40d,
+    0x1f634435, 0x8117547d, 0xf4c4a445, 0xb813021c, 0xcdc0f224,
+    0x53b4e26c, 0x26671254, 0xca1baede, 0xbfc85ee6, 0x21bc4eae,
+    0x546fbe96, 0x18b818cf, 0x6d6be8f7, 0xf31ff8bf, 0x86cc0887,
+    0xa77e71f4, 0xd2ad81cc, 0x4cd99184, 0x390a61bc, 0x75ddc7e5,
+    0x000e37dd, 0x9e7a2795, 0xeba9d7ad, 0x07d56b27, 0x72069b1f,
+    0xec728b57, 0x99a17b6f, 0xd576dd36, 0xa0a52d0e, 0x3ed13d46,
+    0x4b02cd7e, 0xe3c432a3, 0x9617c29b, 0x0863d2d3, 0x7db022eb,
+    0x316784b2, 0x44b4748a, 0xdac064c2, 0xaf1394fa, 0x436f2870,
+    0x36bcd848, 0xa8c8c800, 0xdd1b3838, 0x91cc9e61, 0xe41f6e59,
+    0x7a6b7e11, 0x0fb88e29, 0x390f8cf7, 0x4cdc7ccf, 0xd2a86c87,
+    0xa77b9cbf, 0xebac3ae6, 0x9e7fcade, 0x000bda96, 0x75d82aae,
+    0x99a49624, 0xec77661c, 0x72037654, 0x07d0866c, 0x4b072035,
+    0x3ed4d00d, 0xa0a0c045, 0xd573307d, 0x7db5cfa0, 0x08663f98,
+    0x96122fd0, 0xe3c1dfe8, 0xaf1679b1, 0xdac58989, 0x44b199c1,
+    0x316269f9, 0xdd1ed573, 0xa8cd254b, 0x36b93503, 0x436ac53b,
+    0x0fbd6362, 0x7a6e935a, 0xe41a8312, 0x91c9732a, 0xb07b0a59,
+    0xc5a8fa61, 0x5bdcea29, 0x2e0f1a11, 0x62d8bc48, 0x170b4c70,
+    0x897f5c38, 0xfcacac00, 0x10d0108a, 0x6503e0b2, 0xfb77f0fa,
+    0x8ea400c2, 0xc273a69b, 0xb7a056a3, 0x29d446eb, 0x5c07b6d3,
+    0xf4c1490e, 0x8112b936, 0x1f66a97e, 0x6ab55946, 0x2662ff1f,
+    0x53b10f27, 0xcdc51f6f, 0xb816ef57, 0x546a53dd, 0x21b9a3e5,
+    0xbfcdb3ad, 0xca1e4395, 0x86c9e5cc, 0xf31a15f4, 0x6d6e05bc,
+    0x18bdf584},
+   {0x00000000, 0x5c15eeb4, 0xb82bdd68, 0xe43e33dc, 0x75bbcc21,
+    0x29ae2295, 0xcd901149, 0x9185fffd, 0xeb779842, 0xb76276f6,
+    0x535c452a, 0x0f49ab9e, 0x9ecc5463, 0xc2d9bad7, 0x26e7890b,
+    0x7af267bf, 0xd3034675, 0x8f16a8c1, 0x6b289b1d, 0x373d75a9,
+    0xa6b88a54, 0xfaad64e0, 0x1e93573c, 0x4286b988, 0x3874de37,
+    0x64613083, 0x805f035f, 0xdc4aedeb, 0x4dcf1216, 0x11dafca2,
+    0xf5e4cf7e, 0xa9f121ca, 0xa3eafa1b, 0xffff14af, 0x1bc12773,
+    0x47d4c9c7, 0xd651363a, 0x8a44d88e, 0x6e7aeb52, 0x326f05e6,
+    0x489d6259, 0x14888ced, 0xf0b6bf31, 0xaca35185, 0x3d26ae78,
+    0x613340cc, 0x850d7310, 0xd9189da4, 0x70e9bc6e, 0x2cfc52da,
+    0xc8c26106, 0x94d78fb2, 0x0552704f, 0x59479efb, 0xbd79ad27,
+    0xe16c4393, 0x9b9e242c, 0xc78bca98, 0x23b5f944, 0x7fa017f0,
+    0xee25e80d, 0xb23006b9, 0x560e3565, 0x0a1bdbd1, 0x423982c7,
+    0x1e2c6c73, 0xfa125faf, 0xa607b11b, 0x37824ee6, 0x6b97a052,
+    0x8fa9938e, 0xd3bc7d3a, 0xa94e1a85, 0xf55bf431, 0x1165c7ed,
+    0x4d702959, 0xdcf5d6a4, 0x80e03810, 0x64de0bcc, 0x38cbe578,
+    0x913ac4b2, 0xcd2f2a06, 0x291119da, 0x7504f76e, 0xe4810893,
+    0xb894e627, 0x5caad5fb, 0x00bf3b4f, 0x7a4d5cf0, 0x2658b244,
+    0xc2668198, 0x9e736f2c, 0x0ff690d1, 0x53e37e65, 0xb7dd4db9,
+    0xebc8a30d, 0xe1d378dc, 0xbdc69668, 0x59f8a5b4, 0x05ed4b00,
+    0x9468b4fd, 0xc87d5a49, 0x2c436995, 0x70568721, 0x0aa4e09e,
+    0x56b10e2a, 0xb28f3df6, 0xee9ad342, 0x7f1f2cbf, 0x230ac20b,
+    0xc734f1d7, 0x9b211f63, 0x32d03ea9, 0x6ec5d01d, 0x8afbe3c1,
+    0xd6ee0d75, 0x476bf288, 0x1b7e1c3c, 0xff402fe0, 0xa355c154,
+    0xd9a7a6eb, 0x85b2485f, 0x618c7b83, 0x3d999537, 0xac1c6aca,
+    0xf009847e, 0x1437b7a2, 0x48225916, 0x8473058e, 0xd866eb3a,
+    0x3c58d8e6, 0x604d3652, 0xf1c8c9af, 0xaddd271b, 0x49e314c7,
+    0x15f6fa73, 0x6f049dcc, 0x33117378, 0xd72f40a4, 0x8b3aae10,
+    0x1abf51ed, 0x46aabf59, 0xa2948c85, 0xfe816231, 0x577043fb,
+    0x0b65ad4f, 0xef5b9e93, 0xb34e7027, 0x22cb8fda, 0x7ede616e,
+    0x9ae052b2, 0xc6f5bc06, 0xbc07dbb9, 0xe012350d, 0x042c06d1,
+    0x5839e865, 0xc9bc1798, 0x95a9f92c, 0x7197caf0, 0x2d822444,
+    0x2799ff95, 0x7b8c1121, 0x9fb222fd, 0xc3a7cc49, 0x522233b4,
+    0x0e37dd00, 0xea09eedc, 0xb61c0068, 0xccee67d7, 0x90fb8963,
+    0x74c5babf, 0x28d0540b, 0xb955abf6, 0xe5404542, 0x017e769e,
+    0x5d6b982a, 0xf49ab9e0, 0xa88f5754, 0x4cb16488, 0x10a48a3c,
+    0x812175c1, 0xdd349b75, 0x390aa8a9, 0x651f461d, 0x1fed21a2,
+    0x43f8cf16, 0xa7c6fcca, 0xfbd3127e, 0x6a56ed83, 0x36430337,
+    0xd27d30eb, 0x8e68de5f, 0xc64a8749, 0x9a5f69fd, 0x7e615a21,
+    0x2274b495, 0xb3f14b68, 0xefe4a5dc, 0x0bda9600, 0x57cf78b4,
+    0x2d3d1f0b, 0x7128f1bf, 0x9516c263, 0xc9032cd7, 0x5886d32a,
+    0x04933d9e, 0xe0ad0e42, 0xbcb8e0f6, 0x1549c13c, 0x495c2f88,
+    0xad621c54, 0xf177f2e0, 0x60f20d1d, 0x3ce7e3a9, 0xd8d9d075,
+    0x84cc3ec1, 0xfe3e597e, 0xa22bb7ca, 0x46158416, 0x1a006aa2,
+    0x8b85955f, 0xd7907beb, 0x33ae4837, 0x6fbba683, 0x65a07d52,
+    0x39b593e6, 0xdd8ba03a, 0x819e4e8e, 0x101bb173, 0x4c0e5fc7,
+    0xa8306c1b, 0xf42582af, 0x8ed7e510, 0xd2c20ba4, 0x36fc3878,
+    0x6ae9d6cc, 0xfb6c2931, 0xa779c785, 0x4347f459, 0x1f521aed,
+    0xb6a33b27, 0xeab6d593, 0x0e88e64f, 0x529d08fb, 0xc318f706,
+    0x9f0d19b2, 0x7b332a6e, 0x2726c4da, 0x5dd4a365, 0x01c14dd1,
+    0xe5ff7e0d, 0xb9ea90b9, 0x286f6f44, 0x747a81f0, 0x9044b22c,
+    0xcc515c98},
+   {0x00000000, 0x0d0a7ded, 0x1a14fbda, 0x171e8637, 0x3429f7b4,
+    0x39238a59, 0x2e3d0c6e, 0x23377183, 0x6853ef68, 0x65599285,
+    0x724714b2, 0x7f4d695f, 0x5c7a18dc, 0x51706531, 0x466ee306,
+    0x4b649eeb, 0xd0a7ded0, 0xddada33d, 0xcab3250a, 0xc7b958e7,
+    0xe48e2964, 0xe9845489, 0xfe9ad2be, 0xf390af53, 0xb8f431b8,
+    0xb5fe4c55, 0xa2e0ca62, 0xafeab78f, 0x8cddc60c, 0x81d7bbe1,
+    0x96c93dd6, 0x9bc3403b, 0xa4a3cb51, 0xa9a9b6bc, 0xbeb7308b,
+    0xb3bd4d66, 0x908a3ce5, 0x9d804108, 0x8a9ec73f, 0x8794bad2,
+    0xccf02439, 0xc1fa59d4, 0xd6e4dfe3, 0xdbeea20e, 0xf8d9d38d,
+    0xf5d3ae60, 0xe2cd2857, 0xefc755ba, 0x74041581, 0x790e686c,
+    0x6e10ee5b, 0x631a93b6, 0x402de235, 0x4d279fd8, 0x5a3919ef,
+    0x57336402, 0x1c57fae9, 0x115d8704, 0x06430133, 0x0b497cde,
+    0x287e0d5d, 0x257470b0, 0x326af687, 0x3f608b6a, 0x4cabe053,
+    0x41a19dbe, 0x56bf1b89, 0x5bb56664, 0x788217e7, 0x75886a0a,
+    0x6296ec3d, 0x6f9c91d0, 0x24f80f3b, 0x29f272d6, 0x3eecf4e1,
+    0x33e6890c, 0x10d1f88f, 0x1ddb8562, 0x0ac50355, 0x07cf7eb8,
+    0x9c0c3e83, 0x9106436e, 0x8618c559, 0x8b12b8b4, 0xa825c937,
+    0xa52fb4da, 0xb23132ed, 0xbf3b4f00, 0xf45fd1eb, 0xf955ac06,
+    0xee4b2a31, 0xe34157dc, 0xc076265f, 0xcd7c5bb2, 0xda62dd85,
+    0xd768a068, 0xe8082b02, 0xe50256ef, 0xf21cd0d8, 0xff16ad35,
+    0xdc21dcb6, 0xd12ba15b, 0xc635276c, 0xcb3f5a81, 0x805bc46a,
+    0x8d51b987, 0x9a4f3fb0, 0x9745425d, 0xb47233de, 0xb9784e33,
+    0xae66c804, 0xa36cb5e9, 0x38aff5d2, 0x35a5883f, 0x22bb0e08,
+    0x2fb173e5, 0x0c860266, 0x018c7f8b, 0x1692f9bc, 0x1b988451,
+    0x50fc1aba, 0x5df66757, 0x4ae8e160, 0x47e29c8d, 0x64d5ed0e,
+    0x69df90e3, 0x7ec116d4, 0x73cb6b39, 0x9957c0a6, 0x945dbd4b,
+    0x83433b7c, 0x8e494691, 0xad7e3712, 0xa0744aff, 0xb76accc8,
+    0xba60b125, 0xf1042fce, 0xfc0e5223, 0xeb10d414, 0xe61aa9f9,
+    0xc52dd87a, 0xc827a597, 0xdf3923a0, 0xd2335e4d, 0x49f01e76,
+    0x44fa639b, 0x53e4e5ac, 0x5eee9841, 0x7dd9e9c2, 0x70d3942f,
+    0x67cd1218, 0x6ac76ff5, 0x21a3f11e, 0x2ca98cf3, 0x3bb70ac4,
+    0x36bd7729, 0x158a06aa, 0x18807b47, 0x0f9efd70, 0x0294809d,
+    0x3df40bf7, 0x30fe761a, 0x27e0f02d, 0x2aea8dc0, 0x09ddfc43,
+    0x04d781ae, 0x13c90799, 0x1ec37a74, 0x55a7e49f, 0x58ad9972,
+    0x4fb31f45, 0x42b962a8, 0x618e132b, 0x6c846ec6, 0x7b9ae8f1,
+    0x7690951c, 0xed53d527, 0xe059a8ca, 0xf7472efd, 0xfa4d5310,
+    0xd97a2293, 0xd4705f7e, 0xc36ed949, 0xce64a4a4, 0x85003a4f,
+    0x880a47a2, 0x9f14c195, 0x921ebc78, 0xb129cdfb, 0xbc23b016,
+    0xab3d3621, 0xa6374bcc, 0xd5fc20f5, 0xd8f65d18, 0xcfe8db2f,
+    0xc2e2a6c2, 0xe1d5d741, 0xecdfaaac, 0xfbc12c9b, 0xf6cb5176,
+    0xbdafcf9d, 0xb0a5b270, 0xa7bb3447, 0xaab149aa, 0x89863829,
+    0x848c45c4, 0x9392c3f3, 0x9e98be1e, 0x055bfe25, 0x085183c8,
+    0x1f4f05ff, 0x12457812, 0x31720991, 0x3c78747c, 0x2b66f24b,
+    0x266c8fa6, 0x6d08114d, 0x60026ca0, 0x771cea97, 0x7a16977a,
+    0x5921e6f9, 0x542b9b14, 0x43351d23, 0x4e3f60ce, 0x715feba4,
+    0x7c559649, 0x6b4b107e, 0x66416d93, 0x45761c10, 0x487c61fd,
+    0x5f62e7ca, 0x52689a27, 0x190c04cc, 0x14067921, 0x0318ff16,
+    0x0e1282fb, 0x2d25f378, 0x202f8e95, 0x373108a2, 0x3a3b754f,
+    0xa1f83574, 0xacf24899, 0xbbecceae, 0xb6e6b343, 0x95d1c2c0,
+    0x98dbbf2d, 0x8fc5391a, 0x82cf44f7, 0xc9abda1c, 0xc4a1a7f1,
+    0xd3bf21c6, 0xdeb55c2b, 0xfd822da8, 0xf0885045, 0xe796d672,
+    0xea9cab9f},
+   {0x00000000, 0x3743f7bd, 0x6e87ef7a, 0x59c418c7, 0xdd0fdef4,
+    0xea4c2949, 0xb388318e, 0x84cbc633, 0xbff3cb19, 0x88b03ca4,
+    0xd1742463, 0xe637d3de, 0x62fc15ed, 0x55bfe250, 0x0c7bfa97,
+    0x3b380d2a, 0x7a0be0c3, 0x4d48177e, 0x148c0fb9, 0x23cff804,
+    0xa7043e37, 0x9047c98a, 0xc983d14d, 0xfec026f0, 0xc5f82bda,
+    0xf2bbdc67, 0xab7fc4a0, 0x9c3c331d, 0x18f7f52e, 0x2fb40293,
+    0x76701a54, 0x4133ede9, 0xf417c186, 0xc354363b, 0x9a902efc,
+    0xadd3d941, 0x29181f72, 0x1e5be8cf, 0x479ff008, 0x70dc07b5,
+    0x4be40a9f, 0x7ca7fd22, 0x2563e5e5, 0x12201258, 0x96ebd46b,
+    0xa1a823d6, 0xf86c3b11, 0xcf2fccac, 0x8e1c2145, 0xb95fd6f8,
+    0xe09bce3f, 0xd7d83982, 0x5313ffb1, 0x6450080c, 0x3d9410cb,
+    0x0ad7e776, 0x31efea5c, 0x06ac1de1, 0x5f680526, 0x682bf29b,
+    0xece034a8, 0xdba3c315, 0x8267dbd2, 0xb5242c6f, 0xedc3f5fd,
+    0xda800240, 0x83441a87, 0xb407ed3a, 0x30cc2b09, 0x078fdcb4,
+    0x5e4bc473, 0x690833ce, 0x52303ee4, 0x6573c959, 0x3cb7d19e,
+    0x0bf42623, 0x8f3fe010, 0xb87c17ad, 0xe1b80f6a, 0xd6fbf8d7,
+    0x97c8153e, 0xa08be283, 0xf94ffa44, 0xce0c0df9, 0x4ac7cbca,
+    0x7d843c77, 0x244024b0, 0x1303d30d, 0x283bde27, 0x1f78299a,
+    0x46bc315d, 0x71ffc6e0, 0xf53400d3, 0xc277f76e, 0x9bb3efa9,
+    0xacf01814, 0x19d4347b, 0x2e97c3c6, 0x7753db01, 0x40102cbc,
+    0xc4dbea8f, 0xf3981d32, 0xaa5c05f5, 0x9d1ff248, 0xa627ff62,
+    0x916408df, 0xc8a01018, 0xffe3e7a5, 0x7b282196, 0x4c6bd62b,
+    0x15afceec, 0x22ec3951, 0x63dfd4b8, 0x549c2305, 0x0d583bc2,
+    0x3a1bcc7f, 0xbed00a4c, 0x8993fdf1, 0xd057e536, 0xe714128b,
+    0xdc2c1fa1, 0xeb6fe81c, 0xb2abf0db, 0x85e80766, 0x0123c155,
+    0x366036e8, 0x6fa42e2f, 0x58e7d992, 0xde6b9d0b, 0xe9286ab6,
+    0xb0ec7271, 0x87af85cc, 0x036443ff, 0x3427b442, 0x6de3ac85,
+    0x5aa05b38, 0x61985612, 0x56dba1af, 0x0f1fb968, 0x385c4ed5,
+    0xbc9788e6, 0x8bd47f5b, 0xd210679c, 0xe5539021, 0xa4607dc8,
+    0x93238a75, 0xcae792b2, 0xfda4650f, 0x796fa33c, 0x4e2c5481,
+    0x17e84c46, 0x20abbbfb, 0x1b93b6d1, 0x2cd0416c, 0x751459ab,
+    0x4257ae16, 0xc69c6825, 0xf1df9f98, 0xa81b875f, 0x9f5870e2,
+    0x2a7c5c8d, 0x1d3fab30, 0x44fbb3f7, 0x73b8444a, 0xf7738279,
+    0xc03075c4, 0x99f46d03, 0xaeb79abe, 0x958f9794, 0xa2cc6029,
+    0xfb0878ee, 0xcc4b8f53, 0x48804960, 0x7fc3bedd, 0x2607a61a,
+    0x114451a7, 0x5077bc4e, 0x67344bf3, 0x3ef05334, 0x09b3a489,
+    0x8d7862ba, 0xba3b9507, 0xe3ff8dc0, 0xd4bc7a7d, 0xef847757,
+    0xd8c780ea, 0x8103982d, 0xb6406f90, 0x328ba9a3, 0x05c85e1e,
+    0x5c0c46d9, 0x6b4fb164, 0x33a868f6, 0x04eb9f4b, 0x5d2f878c,
+    0x6a6c7031, 0xeea7b602, 0xd9e441bf, 0x80205978, 0xb763aec5,
+    0x8c5ba3ef, 0xbb185452, 0xe2dc4c95, 0xd59fbb28, 0x51547d1b,
+    0x66178aa6, 0x3fd39261, 0x089065dc, 0x49a38835, 0x7ee07f88,
+    0x2724674f, 0x106790f2, 0x94ac56c1, 0xa3efa17c, 0xfa2bb9bb,
+    0xcd684e06, 0xf650432c, 0xc113b491, 0x98d7ac56, 0xaf945beb,
+    0x2b5f9dd8, 0x1c1c6a65, 0x45d872a2, 0x729b851f, 0xc7bfa970,
+    0xf0fc5ecd, 0xa938460a, 0x9e7bb1b7, 0x1ab07784, 0x2df38039,
+    0x743798fe, 0x43746f43, 0x784c6269, 0x4f0f95d4, 0x16cb8d13,
+    0x21887aae, 0xa543bc9d, 0x92004b20, 0xcbc453e7, 0xfc87a45a,
+    0xbdb449b3, 0x8af7be0e, 0xd333a6c9, 0xe4705174, 0x60bb9747,
+    0x57f860fa, 0x0e3c783d, 0x397f8f80, 0x024782aa, 0x35047517,
+    0x6cc06dd0, 0x5b839a6d, 0xdf485c5e, 0xe80babe3, 0xb1cfb324,
+    0x868c4499},
+   {0x00000000, 0xb93b4ce7, 0x779aef3f, 0xcea1a3d8, 0xef35de7e,
+    0x560e9299, 0x98af3141, 0x21947da6, 0xdb87ca0d, 0x62bc86ea,
+    0xac1d2532, 0x152669d5, 0x34b21473, 0x8d895894, 0x4328fb4c,
+    0xfa13b7ab, 0xb2e3e2eb, 0x0bd8ae0c, 0xc5790dd4, 0x7c424133,
+    0x5dd63c95, 0xe4ed7072, 0x2a4cd3aa, 0x93779f4d, 0x696428e6,
+    0xd05f6401, 0x1efec7d9, 0xa7c58b3e, 0x8651f698, 0x3f6aba7f,
+    0xf1cb19a7, 0x48f05540, 0x602bb327, 0xd910ffc0, 0x17b15c18,
+    0xae8a10ff, 0x8f1e6d59, 0x362521be, 0xf8848266, 0x41bfce81,
+    0xbbac792a, 0x029735cd, 0xcc369615, 0x750ddaf2, 0x5499a754,
+    0xeda2ebb3, 0x2303486b, 0x9a38048c, 0xd2c851cc, 0x6bf31d2b,
+    0xa552bef3, 0x1c69f214, 0x3dfd8fb2, 0x84c6c355, 0x4a67608d,
+    0xf35c2c6a, 0x094f9bc1, 0xb074d726, 0x7ed574fe, 0xc7ee3819,
+    0xe67a45bf, 0x5f410958, 0x91e0aa80, 0x28dbe667, 0xc057664e,
+    0x796c2aa9, 0xb7cd8971, 0x0ef6c596, 0x2f62b830, 0x9659f4d7,
+    0x58f8570f, 0xe1c31be8, 0x1bd0ac43, 0xa2ebe0a4, 0x6c4a437c,
+    0xd5710f9b, 0xf4e5723d, 0x4dde3eda, 0x837f9d02, 0x3a44d1e5,
+    0x72b484a5, 0xcb8fc842, 0x052e6b9a, 0xbc15277d, 0x9d815adb,
+    0x24ba163c, 0xea1bb5e4, 0x5320f903, 0xa9334ea8, 0x1008024f,
+    0xdea9a197, 0x6792ed70, 0x460690d6, 0xff3ddc31, 0x319c7fe9,
+    0x88a7330e, 0xa07cd569, 0x1947998e, 0xd7e63a56, 0x6edd76b1,
+    0x4f490b17, 0xf67247f0, 0x38d3e428, 0x81e8a8cf, 0x7bfb1f64,
+    0xc2c05383, 0x0c61f05b, 0xb55abcbc, 0x94cec11a, 0x2df58dfd,
+    0xe3542e25, 0x5a6f62c2, 0x129f3782, 0xaba47b65, 0x6505d8bd,
+    0xdc3e945a, 0xfdaae9fc, 0x4491a51b, 0x8a3006c3, 0x330b4a24,
+    0xc918fd8f, 0x7023b168, 0xbe8212b0, 0x07b95e57, 0x262d23f1,
+    0x9f166f16, 0x51b7ccce, 0xe88c8029, 0x8542ba6d, 0x3c79f68a,
+    0xf2d85552, 0x4be319b5, 0x6a776413, 0xd34c28f4, 0x1ded8b2c,
+    0xa4d6c7cb, 0x5ec57060, 0xe7fe3c87, 0x295f9f5f, 0x9064d3b8,
+    0xb1f0ae1e, 0x08cbe2f9, 0xc66a4121, 0x7f510dc6, 0x37a15886,
+    0x8e9a1461, 0x403bb7b9, 0xf900fb5e, 0xd89486f8, 0x61afca1f,
+    0xaf0e69c7, 0x16352520, 0xec26928b, 0x551dde6c, 0x9bbc7db4,
+    0x22873153, 0x03134cf5, 0xba280012, 0x7489a3ca, 0xcdb2ef2d,
+    0xe569094a, 0x5c5245ad, 0x92f3e675, 0x2bc8aa92, 0x0a5cd734,
+    0xb3679bd3, 0x7dc6380b, 0xc4fd74ec, 0x3eeec347, 0x87d58fa0,
+    0x49742c78, 0xf04f609f, 0xd1db1d39, 0x68e051de, 0xa641f206,
+    0x1f7abee1, 0x578aeba1, 0xeeb1a746, 0x2010049e, 0x992b4879,
+    0xb8bf35df, 0x01847938, 0xcf25dae0, 0x761e9607, 0x8c0d21ac,
+    0x35366d4b, 0xfb97ce93, 0x42ac8274, 0x6338ffd2, 0xda03b335,
+    0x14a210ed, 0xad995c0a, 0x4515dc23, 0xfc2e90c4, 0x328f331c,
+    0x8bb47ffb, 0xaa20025d, 0x131b4eba, 0xddbaed62, 0x6481a185,
+    0x9e92162e, 0x27a95ac9, 0xe908f911, 0x5033b5f6, 0x71a7c850,
+    0xc89c84b7, 0x063d276f, 0xbf066b88, 0xf7f63ec8, 0x4ecd722f,
+    0x806cd1f7, 0x39579d10, 0x18c3e0b6, 0xa1f8ac51, 0x6f590f89,
+    0xd662436e, 0x2c71f4c5, 0x954ab822, 0x5beb1bfa, 0xe2d0571d,
+    0xc3442abb, 0x7a7f665c, 0xb4dec584, 0x0de58963, 0x253e6f04,
+    0x9c0523e3, 0x52a4803b, 0xeb9fccdc, 0xca0bb17a, 0x7330fd9d,
+    0xbd915e45, 0x04aa12a2, 0xfeb9a509, 0x4782e9ee, 0x89234a36,
+    0x301806d1, 0x118c7b77, 0xa8b73790, 0x66169448, 0xdf2dd8af,
+    0x97dd8def, 0x2ee6c108, 0xe04762d0, 0x597c2e37, 0x78e85391,
+    0xc1d31f76, 0x0f72bcae, 0xb649f049, 0x4c5a47e2, 0xf5610b05,
+    0x3bc0a8dd, 0x82fbe43a, 0xa36f999c, 0x1a54d57b, 0xd4f576a3,
+    0x6dce3a44},
+   {0x00000000, 0x0f69022b, 0x1ed20456, 0x11bb067d, 0x3da408ac,
+    0x32cd0a87, 0x23760cfa, 0x2c1f0ed1, 0x7b481158, 0x74211373,
+    0x659a150e, 0x6af31725, 0x46ec19f4, 0x49851bdf, 0x583e1da2,
+    0x57571f89, 0xf69022b0, 0xf9f9209b, 0xe84226e6, 0xe72b24cd,
+    0xcb342a1c, 0xc45d2837, 0xd5e62e4a, 0xda8f2c61, 0x8dd833e8,
+    0x82b131c3, 0x930a37be, 0x9c633595, 0xb07c3b44, 0xbf15396f,
+    0xaeae3f12, 0xa1c73d39, 0xe8cc3391, 0xe7a531ba, 0xf61e37c7,
+    0xf97735ec, 0xd5683b3d, 0xda013916, 0xcbba3f6b, 0xc4d33d40,
+    0x938422c9, 0x9ced20e2, 0x8d56269f, 0x823f24b4, 0xae202a65,
+    0xa149284e, 0xb0f22e33, 0xbf9b2c18, 0x1e5c1121, 0x1135130a,
+    0x008e1577, 0x0fe7175c, 0x23f8198d, 0x2c911ba6, 0x3d2a1ddb,
+    0x32431ff0, 0x65140079, 0x6a7d0252, 0x7bc6042f, 0x74af0604,
+    0x58b008d5, 0x57d90afe, 0x46620c83, 0x490b0ea8, 0xd47411d3,
+    0xdb1d13f8, 0xcaa61585, 0xc5cf17ae, 0xe9d0197f, 0xe6b91b54,
+    0xf7021d29, 0xf86b1f02, 0xaf3c008b, 0xa05502a0, 0xb1ee04dd,
+    0xbe8706f6, 0x92980827, 0x9df10a0c, 0x8c4a0c71, 0x83230e5a,
+    0x22e43363, 0x2d8d3148, 0x3c363735, 0x335f351e, 0x1f403bcf,
+    0x102939e4, 0x01923f99, 0x0efb3db2, 0x59ac223b, 0x56c52010,
+    0x477e266d, 0x48172446, 0x64082a97, 0x6b6128bc, 0x7ada2ec1,
+    0x75b32cea, 0x3cb82242, 0x33d12069, 0x226a2614, 0x2d03243f,
+    0x011c2aee, 0x0e7528c5, 0x1fce2eb8, 0x10a72c93, 0x47f0331a,
+    0x48993131, 0x5922374c, 0x564b3567, 0x7a543bb6, 0x753d399d,
+    0x64863fe0, 0x6bef3dcb, 0xca2800f2, 0xc54102d9, 0xd4fa04a4,
+    0xdb93068f, 0xf78c085e, 0xf8e50a75, 0xe95e0c08, 0xe6370e23,
+    0xb16011aa, 0xbe091381, 0xafb215fc, 0xa0db17d7, 0x8cc41906,
+    0x83ad1b2d, 0x92161d50, 0x9d7f1f7b, 0xad045557, 0xa26d577c,
+    0xb3d65101, 0xbcbf532a, 0x90a05dfb, 0x9fc95fd0, 0x8e7259ad,
+    0x811b5b86, 0xd64c440f, 0xd9254624, 0xc89e4059, 0xc7f74272,
+    0xebe84ca3, 0xe4814e88, 0xf53a48f5, 0xfa534ade, 0x5b9477e7,
+    0x54fd75cc, 0x454673b1, 0x4a2f719a, 0x66307f4b, 0x69597d60,
+    0x78e27b1d, 0x778b7936, 0x20dc66bf, 0x2fb56494, 0x3e0e62e9,
+    0x316760c2, 0x1d786e13, 0x12116c38, 0x03aa6a45, 0x0cc3686e,
+    0x45c866c6, 0x4aa164ed, 0x5b1a6290, 0x547360bb, 0x786c6e6a,
+    0x77056c41, 0x66be6a3c, 0x69d76817, 0x3e80779e, 0x31e975b5,
+    0x205273c8, 0x2f3b71e3, 0x03247f32, 0x0c4d7d19, 0x1df67b64,
+    0x129f794f, 0xb3584476, 0xbc31465d, 0xad8a4020, 0xa2e3420b,
+    0x8efc4cda, 0x81954ef1, 0x902e488c, 0x9f474aa7, 0xc810552e,
+    0xc7795705, 0xd6c25178, 0xd9ab5353, 0xf5b45d82, 0xfadd5fa9,
+    0xeb6659d4, 0xe40f5bff, 0x79704484, 0x761946af, 0x67a240d2,
+    0x68cb42f9, 0x44d44c28, 0x4bbd4e03, 0x5a06487e, 0x556f4a55,
+    0x023855dc, 0x0d5157f7, 0x1cea518a, 0x138353a1, 0x3f9c5d70,
+    0x30f55f5b, 0x214e5926, 0x2e275b0d, 0x8fe06634, 0x8089641f,
+    0x91326262, 0x9e5b6049, 0xb2446e98, 0xbd2d6cb3, 0xac966ace,
+    0xa3ff68e5, 0xf4a8776c, 0xfbc17547, 0xea7a733a, 0xe5137111,
+    0xc90c7fc0, 0xc6657deb, 0xd7de7b96, 0xd8b779bd, 0x91bc7715,
+    0x9ed5753e, 0x8f6e7343, 0x80077168, 0xac187fb9, 0xa3717d92,
+    0xb2ca7bef, 0xbda379c4, 0xeaf4664d, 0xe59d6466, 0xf426621b,
+    0xfb4f6030, 0xd7506ee1, 0xd8396cca, 0xc9826ab7, 0xc6eb689c,
+    0x672c55a5, 0x6845578e, 0x79fe51f3, 0x769753d8, 0x5a885d09,
+    0x55e15f22, 0x445a595f, 0x4b335b74, 0x1c6444fd, 0x130d46d6,
+    0x02b640ab, 0x0ddf4280, 0x21c04c51, 0x2ea94e7a, 0x3f124807,
+    0x307b4a2c},
+   {0x00000000, 0x5fe4dc5f, 0xbfc9b8be, 0xe02d64e1, 0x7a7f078d,
+    0x259bdbd2, 0xc5b6bf33, 0x9a52636c, 0xf4fe0f1a, 0xab1ad345,
+    0x4b37b7a4, 0x14d36bfb, 0x8e810897, 0xd165d4c8, 0x3148b029,
+    0x6eac6c76, 0xec1068c5, 0xb3f4b49a, 0x53d9d07b, 0x0c3d0c24,
+    0x966f6f48, 0xc98bb317, 0x29a6d7f6, 0x76420ba9, 0x18ee67df,
+    0x470abb80, 0xa727df61, 0xf8c3033e, 0x62916052, 0x3d75bc0d,
+    0xdd58d8ec, 0x82bc04b3, 0xddcca77b, 0x82287b24, 0x62051fc5,
+    0x3de1c39a, 0xa7b3a0f6, 0xf8577ca9, 0x187a1848, 0x479ec417,
+    0x2932a861, 0x76d6743e, 0x96fb10df, 0xc91fcc80, 0x534dafec,
+    0x0ca973b3, 0xec841752, 0xb360cb0d, 0x31dccfbe, 0x6e3813e1,
+    0x8e157700, 0xd1f1ab5f, 0x4ba3c833, 0x1447146c, 0xf46a708d,
+    0xab8eacd2, 0xc522c0a4, 0x9ac61cfb, 0x7aeb781a, 0x250fa445,
+    0xbf5dc729, 0xe0b91b76, 0x00947f97, 0x5f70a3c8, 0xbe753807,
+    0xe191e458, 0x01bc80b9, 0x5e585ce6, 0xc40a3f8a, 0x9beee3d5,
+    0x7bc38734, 0x24275b6b, 0x4a8b371d, 0x156feb42, 0xf5428fa3,
+    0xaaa653fc, 0x30f43090, 0x6f10eccf, 0x8f3d882e, 0xd0d95471,
+    0x526550c2, 0x0d818c9d, 0xedace87c, 0xb2483423, 0x281a574f,
+    0x77fe8b10, 0x97d3eff1, 0xc83733ae, 0xa69b5fd8, 0xf97f8387,
+    0x1952e766, 0x46b63b39, 0xdce45855, 0x8300840a, 0x632de0eb,
+    0x3cc93cb4, 0x63b99f7c, 0x3c5d4323, 0xdc7027c2, 0x8394fb9d,
+    0x19c698f1, 0x462244ae, 0xa60f204f, 0xf9ebfc10, 0x97479066,
+    0xc8a34c39, 0x288e28d8, 0x776af487, 0xed3897eb, 0xb2dc4bb4,
+    0x52f12f55, 0x0d15f30a, 0x8fa9f7b9, 0xd04d2be6, 0x30604f07,
+    0x6f849358, 0xf5d6f034, 0xaa322c6b, 0x4a1f488a, 0x15fb94d5,
+    0x7b57f8a3, 0x24b324fc, 0xc49e401d, 0x9b7a9c42, 0x0128ff2e,
+    0x5ecc2371, 0xbee14790, 0xe1059bcf, 0x790606ff, 0x26e2daa0,
+    0xc6cfbe41, 0x992b621e, 0x03790172, 0x5c9ddd2d, 0xbcb0b9cc,
+    0xe3546593, 0x8df809e5, 0xd21cd5ba, 0x3231b15b, 0x6dd56d04,
+    0xf7870e68, 0xa863d237, 0x484eb6d6, 0x17aa6a89, 0x95166e3a,
+    0xcaf2b265, 0x2adfd684, 0x753b0adb, 0xef6969b7, 0xb08db5e8,
+    0x50a0d109, 0x0f440d56, 0x61e86120, 0x3e0cbd7f, 0xde21d99e,
+    0x81c505c1, 0x1b9766ad, 0x4473baf2, 0xa45ede13, 0xfbba024c,
+    0xa4caa184, 0xfb2e7ddb, 0x1b03193a, 0x44e7c565, 0xdeb5a609,
+    0x81517a56, 0x617c1eb7, 0x3e98c2e8, 0x5034ae9e, 0x0fd072c1,
+    0xeffd1620, 0xb019ca7f, 0x2a4ba913, 0x75af754c, 0x958211ad,
+    0xca66cdf2, 0x48dac941, 0x173e151e, 0xf71371ff, 0xa8f7ada0,
+    0x32a5cecc, 0x6d411293, 0x8d6c7672, 0xd288aa2d, 0xbc24c65b,
+    0xe3c01a04, 0x03ed7ee5, 0x5c09a2ba, 0xc65bc1d6, 0x99bf1d89,
+    0x79927968, 0x2676a537, 0xc7733ef8, 0x9897e2a7, 0x78ba8646,
+    0x275e5a19, 0xbd0c3975, 0xe2e8e52a, 0x02c581cb, 0x5d215d94,
+    0x338d31e2, 0x6c69edbd, 0x8c44895c, 0xd3a05503, 0x49f2366f,
+    0x1616ea30, 0xf63b8ed1, 0xa9df528e, 0x2b63563d, 0x74878a62,
+    0x94aaee83, 0xcb4e32dc, 0x511c51b0, 0x0ef88def, 0xeed5e90e,
+    0xb1313551, 0xdf9d5927, 0x80798578, 0x6054e199, 0x3fb03dc6,
+    0xa5e25eaa, 0xfa0682f5, 0x1a2be614, 0x45cf3a4b, 0x1abf9983,
+    0x455b45dc, 0xa576213d, 0xfa92fd62, 0x60c09e0e, 0x3f244251,
+    0xdf0926b0, 0x80edfaef, 0xee419699, 0xb1a54ac6, 0x51882e27,
+    0x0e6cf278, 0x943e9114, 0xcbda4d4b, 0x2bf729aa, 0x7413f5f5,
+    0xf6aff146, 0xa94b2d19, 0x496649f8, 0x168295a7, 0x8cd0f6cb,
+    0xd3342a94, 0x33194e75, 0x6cfd922a, 0x0251fe5c, 0x5db52203,
+    0xbd9846e2, 0xe27c9abd, 0x782ef9d1, 0x27ca258e, 0xc7e7416f,
+    0x98039d30}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0x5fdce45f00000000, 0xbeb8c9bf00000000,
+    0xe1642de000000000, 0x8d077f7a00000000, 0xd2db9b2500000000,
+    0x33bfb6c500000000, 0x6c63529a00000000, 0x1a0ffef400000000,
+    0x45d31aab00000000, 0xa4b7374b00000000, 0xfb6bd31400000000,
+    0x9708818e00000000, 0xc8d465d100000000, 0x29b0483100000000,
+    0x766cac6e00000000, 0xc56810ec00000000, 0x9ab4f4b300000000,
+    0x7bd0d95300000000, 0x240c3d0c00000000, 0x486f6f9600000000,
+    0x17b38bc900000000, 0xf6d7a62900000000, 0xa90b427600000000,
+    0xdf67ee1800000000, 0x80bb0a4700000000, 0x61df27a700000000,
+    0x3e03c3f800000000, 0x5260916200000000, 0x0dbc753d00000000,
+    0xecd858dd00000000, 0xb304bc8200000000, 0x7ba7ccdd00000000,
+    0x247b288200000000, 0xc51f056200000000, 0x9ac3e13d00000000,
+    0xf6a0b3a700000000, 0xa97c57f800000000, 0x48187a1800000000,
+    0x17c49e4700000000, 0x61a8322900000000, 0x3e74d67600000000,
+    0xdf10fb9600000000, 0x80cc1fc900000000, 0xecaf4d5300000000,
+    0xb373a90c00000000, 0x521784ec00000000, 0x0dcb60b300000000,
+    0xbecfdc3100000000, 0xe113386e00000000, 0x0077158e00000000,
+    0x5fabf1d100000000, 0x33c8a34b00000000, 0x6c14471400000000,
+    0x8d706af400000000, 0xd2ac8eab00000000, 0xa4c022c500000000,
+    0xfb1cc69a00000000, 0x1a78eb7a00000000, 0x45a40f2500000000,
+    0x29c75dbf00000000, 0x761bb9e000000000, 0x977f940000000000,
+    0xc8a3705f00000000, 0x073875be00000000, 0x58e491e100000000,
+    0xb980bc0100000000, 0xe65c585e00000000, 0x8a3f0ac400000000,
+    0xd5e3ee9b00000000, 0x3487c37b00000000, 0x6b5b272400000000,
+    0x1d378b4a00000000, 0x42eb6f1500000000, 0xa38f42f500000000,
+    0xfc53a6aa00000000, 0x9030f43000000000, 0xcfec106f00000000,
+    0x2e883d8f00000000, 0x7154d9d000000000, 0xc250655200000000,
+    0x9d8c810d00000000, 0x7ce8aced00000000, 0x233448b200000000,
+    0x4f571a2800000000, 0x108bfe7700000000, 0xf1efd39700000000,
+    0xae3337c800000000, 0xd85f9ba600000000, 0x87837ff900000000,
+    0x66e7521900000000, 0x393bb64600000000, 0x5558e4dc00000000,
+    0x0a84008300000000, 0xebe02d6300000000, 0xb43cc93c00000000,
+    0x7c9fb96300000000, 0x23435d3c00000000, 0xc22770dc00000000,
+    0x9dfb948300000000, 0xf198c61900000000, 0xae44224600000000,
+    0x4f200fa600000000, 0x10fcebf900000000, 0x6690479700000000,
+    0x394ca3c800000000, 0xd8288e2800000000, 0x87f46a7700000000,
+    0xeb9738ed00000000, 0xb44bdcb200000000, 0x552ff15200000000,
+    0x0af3150d00000000, 0xb9f7a98f00000000, 0xe62b4dd000000000,
+    0x074f603000000000, 0x5893846f00000000, 0x34f0d6f500000000,
+    0x6b2c32aa00000000, 0x8a481f4a00000000, 0xd594fb1500000000,
+    0xa3f8577b00000000, 0xfc24b32400000000, 0x1d409ec400000000,
+    0x429c7a9b00000000, 0x2eff280100000000, 0x7123cc5e00000000,
+    0x9047e1be00000000, 0xcf9b05e100000000, 0xff06067900000000,
+    0xa0dae22600000000, 0x41becfc600000000, 0x1e622b9900000000,
+    0x7201790300000000, 0x2ddd9d5c00000000, 0xccb9b0bc00000000,
+    0x936554e300000000, 0xe509f88d00000000, 0xbad51cd200000000,
+    0x5bb1313200000000, 0x046dd56d00000000, 0x680e87f700000000,
+    0x37d263a800000000, 0xd6b64e4800000000, 0x896aaa1700000000,
+    0x3a6e169500000000, 0x65b2f2ca00000000, 0x84d6df2a00000000,
+    0xdb0a3b7500000000, 0xb76969ef00000000, 0xe8b58db000000000,
+    0x09d1a05000000000, 0x560d440f00000000, 0x2061e86100000000,
+    0x7fbd0c3e00000000, 0x9ed921de00000000, 0xc105c58100000000,
+    0xad66971b00000000, 0xf2ba734400000000, 0x13de5ea400000000,
+    0x4c02bafb00000000, 0x84a1caa400000000, 0xdb7d2efb00000000,
+    0x3a19031b00000000, 0x65c5e74400000000, 0x09a6b5de00000000,
+    0x567a518100000000, 0xb71e7c6100000000, 0xe8c2983e00000000,
+    0x9eae345000000000, 0xc172d00f00000000, 0x2016fdef00000000,
+    0x7fca19b000000000, 0x13a94b2a00000000, 0x4c75af7500000000,
+    0xad11829500000000, 0xf2cd66ca00000000, 0x41c9da4800000000,
+    0x1e153e1700000000, 0xff7113f700000000, 0xa0adf7a800000000,
+    0xcccea53200000000, 0x9312416d00000000, 0x72766c8d00000000,
+    0x2daa88d200000000, 0x5bc624bc00000000, 0x041ac0e300000000,
+    0xe57eed0300000000, 0xbaa2095c00000000, 0xd6c15bc600000000,
+    0x891dbf9900000000, 0x6879927900000000, 0x37a5762600000000,
+    0xf83e73c700000000, 0xa7e2979800000000, 0x4686ba7800000000,
+    0x195a5e2700000000, 0x75390cbd00000000, 0x2ae5e8e200000000,
+    0xcb81c50200000000, 0x945d215d00000000, 0xe2318d3300000000,
+    0xbded696c00000000, 0x5c89448c00000000, 0x0355a0d300000000,
+    0x6f36f24900000000, 0x30ea161600000000, 0xd18e3bf600000000,
+    0x8e52dfa900000000, 0x3d56632b00000000, 0x628a877400000000,
+    0x83eeaa9400000000, 0xdc324ecb00000000, 0xb0511c5100000000,
+    0xef8df80e00000000, 0x0ee9d5ee00000000, 0x513531b100000000,
+    0x27599ddf00000000, 0x7885798000000000, 0x99e1546000000000,
+    0xc63db03f00000000, 0xaa5ee2a500000000, 0xf58206fa00000000,
+    0x14e62b1a00000000, 0x4b3acf4500000000, 0x8399bf1a00000000,
+    0xdc455b4500000000, 0x3d2176a500000000, 0x62fd92fa00000000,
+    0x0e9ec06000000000, 0x5142243f00000000, 0xb02609df00000000,
+    0xeffaed8000000000, 0x999641ee00000000, 0xc64aa5b100000000,
+    0x272e885100000000, 0x78f26c0e00000000, 0x14913e9400000000,
+    0x4b4ddacb00000000, 0xaa29f72b00000000, 0xf5f5137400000000,
+    0x46f1aff600000000, 0x192d4ba900000000, 0xf849664900000000,
+    0xa795821600000000, 0xcbf6d08c00000000, 0x942a34d300000000,
+    0x754e193300000000, 0x2a92fd6c00000000, 0x5cfe510200000000,
+    0x0322b55d00000000, 0xe24698bd00000000, 0xbd9a7ce200000000,
+    0xd1f92e7800000000, 0x8e25ca2700000000, 0x6f41e7c700000000,
+    0x309d039800000000},
+   {0x0000000000000000, 0x2b02690f00000000, 0x5604d21e00000000,
+    0x7d06bb1100000000, 0xac08a43d00000000, 0x870acd3200000000,
+    0xfa0c762300000000, 0xd10e1f2c00000000, 0x5811487b00000000,
+    0x7313217400000000, 0x0e159a6500000000, 0x2517f36a00000000,
+    0xf419ec4600000000, 0xdf1b854900000000, 0xa21d3e5800000000,
+    0x891f575700000000, 0xb02290f600000000, 0x9b20f9f900000000,
+    0xe62642e800000000, 0xcd242be700000000, 0x1c2a34cb00000000,
+    0x37285dc400000000, 0x4a2ee6d500000000, 0x612c8fda00000000,
+    0xe833d88d00000000, 0xc331b18200000000, 0xbe370a9300000000,
+    0x9535639c00000000, 0x443b7cb000000000, 0x6f3915bf00000000,
+    0x123faeae00000000, 0x393dc7a100000000, 0x9133cce800000000,
+    0xba31a5e700000000, 0xc7371ef600000000, 0xec3577f900000000,
+    0x3d3b68d500000000, 0x163901da00000000, 0x6b3fbacb00000000,
+    0x403dd3c400000000, 0xc922849300000000, 0xe220ed9c00000000,
+    0x9f26568d00000000, 0xb4243f8200000000, 0x652a20ae00000000,
+    0x4e2849a100000000, 0x332ef2b000000000, 0x182c9bbf00000000,
+    0x21115c1e00000000, 0x0a13351100000000, 0x77158e0000000000,
+    0x5c17e70f00000000, 0x8d19f82300000000, 0xa61b912c00000000,
+    0xdb1d2a3d00000000, 0xf01f433200000000, 0x7900146500000000,
+    0x52027d6a00000000, 0x2f04c67b00000000, 0x0406af7400000000,
+    0xd508b05800000000, 0xfe0ad95700000000, 0x830c624600000000,
+    0xa80e0b4900000000, 0xd31174d400000000, 0xf8131ddb00000000,
+    0x8515a6ca00000000, 0xae17cfc500000000, 0x7f19d0e900000000,
+    0x541bb9e600000000, 0x291d02f700000000, 0x021f6bf800000000,
+    0x8b003caf00000000, 0xa00255a000000000, 0xdd04eeb100000000,
+    0xf60687be00000000, 0x2708989200000000, 0x0c0af19d00000000,
+    0x710c4a8c00000000, 0x5a0e238300000000, 0x6333e42200000000,
+    0x48318d2d00000000, 0x3537363c00000000, 0x1e355f3300000000,
+    0xcf3b401f00000000, 0xe439291000000000, 0x993f920100000000,
+    0xb23dfb0e00000000, 0x3b22ac5900000000, 0x1020c55600000000,
+    0x6d267e4700000000, 0x4624174800000000, 0x972a086400000000,
+    0xbc28616b00000000, 0xc12eda7a00000000, 0xea2cb37500000000,
+    0x4222b83c00000000, 0x6920d13300000000, 0x14266a2200000000,
+    0x3f24032d00000000, 0xee2a1c0100000000, 0xc528750e00000000,
+    0xb82ece1f00000000, 0x932ca71000000000, 0x1a33f04700000000,
+    0x3131994800000000, 0x4c37225900000000, 0x67354b5600000000,
+    0xb63b547a00000000, 0x9d393d7500000000, 0xe03f866400000000,
+    0xcb3def6b00000000, 0xf20028ca00000000, 0xd90241c500000000,
+    0xa404fad400000000, 0x8f0693db00000000, 0x5e088cf700000000,
+    0x750ae5f800000000, 0x080c5ee900000000, 0x230e37e600000000,
+    0xaa1160b100000000, 0x811309be00000000, 0xfc15b2af00000000,
+    0xd717dba000000000, 0x0619c48c00000000, 0x2d1bad8300000000,
+    0x501d169200000000, 0x7b1f7f9d00000000, 0x575504ad00000000,
+    0x7c576da200000000, 0x0151d6b300000000, 0x2a53bfbc00000000,
+    0xfb5da09000000000, 0xd05fc99f00000000, 0xad59728e00000000,
+    0x865b1b8100000000, 0x0f444cd600000000, 0x244625d900000000,
+    0x59409ec800000000, 0x7242f7c700000000, 0xa34ce8eb00000000,
+    0x884e81e400000000, 0xf5483af500000000, 0xde4a53fa00000000,
+    0xe777945b00000000, 0xcc75fd5400000000, 0xb173464500000000,
+    0x9a712f4a00000000, 0x4b7f306600000000, 0x607d596900000000,
+    0x1d7be27800000000, 0x36798b7700000000, 0xbf66dc2000000000,
+    0x9464b52f00000000, 0xe9620e3e00000000, 0xc260673100000000,
+    0x136e781d00000000, 0x386c111200000000, 0x456aaa0300000000,
+    0x6e68c30c00000000, 0xc666c84500000000, 0xed64a14a00000000,
+    0x90621a5b00000000, 0xbb60735400000000, 0x6a6e6c7800000000,
+    0x416c057700000000, 0x3c6abe6600000000, 0x1768d76900000000,
+    0x9e77803e00000000, 0xb575e93100000000, 0xc873522000000000,
+    0xe3713b2f00000000, 0x327f240300000000, 0x197d4d0c00000000,
+    0x647bf61d00000000, 0x4f799f1200000000, 0x764458b300000000,
+    0x5d4631bc00000000, 0x20408aad00000000, 0x0b42e3a200000000,
+    0xda4cfc8e00000000, 0xf14e958100000000, 0x8c482e9000000000,
+    0xa74a479f00000000, 0x2e5510c800000000, 0x055779c700000000,
+    0x7851c2d600000000, 0x5353abd900000000, 0x825db4f500000000,
+    0xa95fddfa00000000, 0xd45966eb00000000, 0xff5b0fe400000000,
+    0x8444707900000000, 0xaf46197600000000, 0xd240a26700000000,
+    0xf942cb6800000000, 0x284cd44400000000, 0x034ebd4b00000000,
+    0x7e48065a00000000, 0x554a6f5500000000, 0xdc55380200000000,
+    0xf757510d00000000, 0x8a51ea1c00000000, 0xa153831300000000,
+    0x705d9c3f00000000, 0x5b5ff53000000000, 0x26594e2100000000,
+    0x0d5b272e00000000, 0x3466e08f00000000, 0x1f64898000000000,
+    0x6262329100000000, 0x49605b9e00000000, 0x986e44b200000000,
+    0xb36c2dbd00000000, 0xce6a96ac00000000, 0xe568ffa300000000,
+    0x6c77a8f400000000, 0x4775c1fb00000000, 0x3a737aea00000000,
+    0x117113e500000000, 0xc07f0cc900000000, 0xeb7d65c600000000,
+    0x967bded700000000, 0xbd79b7d800000000, 0x1577bc9100000000,
+    0x3e75d59e00000000, 0x43736e8f00000000, 0x6871078000000000,
+    0xb97f18ac00000000, 0x927d71a300000000, 0xef7bcab200000000,
+    0xc479a3bd00000000, 0x4d66f4ea00000000, 0x66649de500000000,
+    0x1b6226f400000000, 0x30604ffb00000000, 0xe16e50d700000000,
+    0xca6c39d800000000, 0xb76a82c900000000, 0x9c68ebc600000000,
+    0xa5552c6700000000, 0x8e57456800000000, 0xf351fe7900000000,
+    0xd853977600000000, 0x095d885a00000000, 0x225fe15500000000,
+    0x5f595a4400000000, 0x745b334b00000000, 0xfd44641c00000000,
+    0xd6460d1300000000, 0xab40b60200000000, 0x8042df0d00000000,
+    0x514cc02100000000, 0x7a4ea92e00000000, 0x0748123f00000000,
+    0x2c4a7b3000000000},
+   {0x0000000000000000, 0xe74c3bb900000000, 0x3fef9a7700000000,
+    0xd8a3a1ce00000000, 0x7ede35ef00000000, 0x99920e5600000000,
+    0x4131af9800000000, 0xa67d942100000000, 0x0dca87db00000000,
+    0xea86bc6200000000, 0x32251dac00000000, 0xd569261500000000,
+    0x7314b23400000000, 0x9458898d00000000, 0x4cfb284300000000,
+    0xabb713fa00000000, 0xebe2e3b200000000, 0x0caed80b00000000,
+    0xd40d79c500000000, 0x3341427c00000000, 0x953cd65d00000000,
+    0x7270ede400000000, 0xaad34c2a00000000, 0x4d9f779300000000,
+    0xe628646900000000, 0x01645fd000000000, 0xd9c7fe1e00000000,
+    0x3e8bc5a700000000, 0x98f6518600000000, 0x7fba6a3f00000000,
+    0xa719cbf100000000, 0x4055f04800000000, 0x27b32b6000000000,
+    0xc0ff10d900000000, 0x185cb11700000000, 0xff108aae00000000,
+    0x596d1e8f00000000, 0xbe21253600000000, 0x668284f800000000,
+    0x81cebf4100000000, 0x2a79acbb00000000, 0xcd35970200000000,
+    0x159636cc00000000, 0xf2da0d7500000000, 0x54a7995400000000,
+    0xb3eba2ed00000000, 0x6b48032300000000, 0x8c04389a00000000,
+    0xcc51c8d200000000, 0x2b1df36b00000000, 0xf3be52a500000000,
+    0x14f2691c00000000, 0xb28ffd3d00000000, 0x55c3c68400000000,
+    0x8d60674a00000000, 0x6a2c5cf300000000, 0xc19b4f0900000000,
+    0x26d774b000000000, 0xfe74d57e00000000, 0x1938eec700000000,
+    0xbf457ae600000000, 0x5809415f00000000, 0x80aae09100000000,
+    0x67e6db2800000000, 0x4e6657c000000000, 0xa92a6c7900000000,
+    0x7189cdb700000000, 0x96c5f60e00000000, 0x30b8622f00000000,
+    0xd7f4599600000000, 0x0f57f85800000000, 0xe81bc3e100000000,
+    0x43acd01b00000000, 0xa4e0eba200000000, 0x7c434a6c00000000,
+    0x9b0f71d500000000, 0x3d72e5f400000000, 0xda3ede4d00000000,
+    0x029d7f8300000000, 0xe5d1443a00000000, 0xa584b47200000000,
+    0x42c88fcb00000000, 0x9a6b2e0500000000, 0x7d2715bc00000000,
+    0xdb5a819d00000000, 0x3c16ba2400000000, 0xe4b51bea00000000,
+    0x03f9205300000000, 0xa84e33a900000000, 0x4f02081000000000,
+    0x97a1a9de00000000, 0x70ed926700000000, 0xd690064600000000,
+    0x31dc3dff00000000, 0xe97f9c3100000000, 0x0e33a78800000000,
+    0x69d57ca000000000, 0x8e99471900000000, 0x563ae6d700000000,
+    0xb176dd6e00000000, 0x170b494f00000000, 0xf04772f600000000,
+    0x28e4d33800000000, 0xcfa8e88100000000, 0x641ffb7b00000000,
+    0x8353c0c200000000, 0x5bf0610c00000000, 0xbcbc5ab500000000,
+    0x1ac1ce9400000000, 0xfd8df52d00000000, 0x252e54e300000000,
+    0xc2626f5a00000000, 0x82379f1200000000, 0x657ba4ab00000000,
+    0xbdd8056500000000, 0x5a943edc00000000, 0xfce9aafd00000000,
+    0x1ba5914400000000, 0xc306308a00000000, 0x244a0b3300000000,
+    0x8ffd18c900000000, 0x68b1237000000000, 0xb01282be00000000,
+    0x575eb90700000000, 0xf1232d2600000000, 0x166f169f00000000,
+    0xceccb75100000000, 0x29808ce800000000, 0x6dba428500000000,
+    0x8af6793c00000000, 0x5255d8f200000000, 0xb519e34b00000000,
+    0x1364776a00000000, 0xf4284cd300000000, 0x2c8bed1d00000000,
+    0xcbc7d6a400000000, 0x6070c55e00000000, 0x873cfee700000000,
+    0x5f9f5f2900000000, 0xb8d3649000000000, 0x1eaef0b100000000,
+    0xf9e2cb0800000000, 0x21416ac600000000, 0xc60d517f00000000,
+    0x8658a13700000000, 0x61149a8e00000000, 0xb9b73b4000000000,
+    0x5efb00f900000000, 0xf88694d800000000, 0x1fcaaf6100000000,
+    0xc7690eaf00000000, 0x2025351600000000, 0x8b9226ec00000000,
+    0x6cde1d5500000000, 0xb47dbc9b00000000, 0x5331872200000000,
+    0xf54c130300000000, 0x120028ba00000000, 0xcaa3897400000000,
+    0x2defb2cd00000000, 0x4a0969e500000000, 0xad45525c00000000,
+    0x75e6f39200000000, 0x92aac82b00000000, 0x34d75c0a00000000,
+    0xd39b67b300000000, 0x0b38c67d00000000, 0xec74fdc400000000,
+    0x47c3ee3e00000000, 0xa08fd58700000000, 0x782c744900000000,
+    0x9f604ff000000000, 0x391ddbd100000000, 0xde51e06800000000,
+    0x06f241a600000000, 0xe1be7a1f00000000, 0xa1eb8a5700000000,
+    0x46a7b1ee00000000, 0x9e04102000000000, 0x79482b9900000000,
+    0xdf35bfb800000000, 0x3879840100000000, 0xe0da25cf00000000,
+    0x07961e7600000000, 0xac210d8c00000000, 0x4b6d363500000000,
+    0x93ce97fb00000000, 0x7482ac4200000000, 0xd2ff386300000000,
+    0x35b303da00000000, 0xed10a21400000000, 0x0a5c99ad00000000,
+    0x23dc154500000000, 0xc4902efc00000000, 0x1c338f3200000000,
+    0xfb7fb48b00000000, 0x5d0220aa00000000, 0xba4e1b1300000000,
+    0x62edbadd00000000, 0x85a1816400000000, 0x2e16929e00000000,
+    0xc95aa92700000000, 0x11f908e900000000, 0xf6b5335000000000,
+    0x50c8a77100000000, 0xb7849cc800000000, 0x6f273d0600000000,
+    0x886b06bf00000000, 0xc83ef6f700000000, 0x2f72cd4e00000000,
+    0xf7d16c8000000000, 0x109d573900000000, 0xb6e0c31800000000,
+    0x51acf8a100000000, 0x890f596f00000000, 0x6e4362d600000000,
+    0xc5f4712c00000000, 0x22b84a9500000000, 0xfa1beb5b00000000,
+    0x1d57d0e200000000, 0xbb2a44c300000000, 0x5c667f7a00000000,
+    0x84c5deb400000000, 0x6389e50d00000000, 0x046f3e2500000000,
+    0xe323059c00000000, 0x3b80a45200000000, 0xdccc9feb00000000,
+    0x7ab10bca00000000, 0x9dfd307300000000, 0x455e91bd00000000,
+    0xa212aa0400000000, 0x09a5b9fe00000000, 0xeee9824700000000,
+    0x364a238900000000, 0xd106183000000000, 0x777b8c1100000000,
+    0x9037b7a800000000, 0x4894166600000000, 0xafd82ddf00000000,
+    0xef8ddd9700000000, 0x08c1e62e00000000, 0xd06247e000000000,
+    0x372e7c5900000000, 0x9153e87800000000, 0x761fd3c100000000,
+    0xaebc720f00000000, 0x49f049b600000000, 0xe2475a4c00000000,
+    0x050b61f500000000, 0xdda8c03b00000000, 0x3ae4fb8200000000,
+    0x9c996fa300000000, 0x7bd5541a00000000, 0xa376f5d400000000,
+    0x443ace6d00000000},
+   {0x0000000000000000, 0xbdf7433700000000, 0x7aef876e00000000,
+    0xc718c45900000000, 0xf4de0fdd00000000, 0x49294cea00000000,
+    0x8e3188b300000000, 0x33c6cb8400000000, 0x19cbf3bf00000000,
+    0xa43cb08800000000, 0x632474d100000000, 0xded337e600000000,
+    0xed15fc6200000000, 0x50e2bf5500000000, 0x97fa7b0c00000000,
+    0x2a0d383b00000000, 0xc3e00b7a00000000, 0x7e17484d00000000,
+    0xb90f8c1400000000, 0x04f8cf2300000000, 0x373e04a700000000,
+    0x8ac9479000000000, 0x4dd183c900000000, 0xf026c0fe00000000,
+    0xda2bf8c500000000, 0x67dcbbf200000000, 0xa0c47fab00000000,
+    0x1d333c9c00000000, 0x2ef5f71800000000, 0x9302b42f00000000,
+    0x541a707600000000, 0xe9ed334100000000, 0x86c117f400000000,
+    0x3b3654c300000000, 0xfc2e909a00000000, 0x41d9d3ad00000000,
+    0x721f182900000000, 0xcfe85b1e00000000, 0x08f09f4700000000,
+    0xb507dc7000000000, 0x9f0ae44b00000000, 0x22fda77c00000000,
+    0xe5e5632500000000, 0x5812201200000000, 0x6bd4eb9600000000,
+    0xd623a8a100000000, 0x113b6cf800000000, 0xaccc2fcf00000000,
+    0x45211c8e00000000, 0xf8d65fb900000000, 0x3fce9be000000000,
+    0x8239d8d700000000, 0xb1ff135300000000, 0x0c08506400000000,
+    0xcb10943d00000000, 0x76e7d70a00000000, 0x5ceaef3100000000,
+    0xe11dac0600000000, 0x2605685f00000000, 0x9bf22b6800000000,
+    0xa834e0ec00000000, 0x15c3a3db00000000, 0xd2db678200000000,
+    0x6f2c24b500000000, 0xfdf5c3ed00000000, 0x400280da00000000,
+    0x871a448300000000, 0x3aed07b400000000, 0x092bcc3000000000,
+    0xb4dc8f0700000000, 0x73c44b5e00000000, 0xce33086900000000,
+    0xe43e305200000000, 0x59c9736500000000, 0x9ed1b73c00000000,
+    0x2326f40b00000000, 0x10e03f8f00000000, 0xad177cb800000000,
+    0x6a0fb8e100000000, 0xd7f8fbd600000000, 0x3e15c89700000000,
+    0x83e28ba000000000, 0x44fa4ff900000000, 0xf90d0cce00000000,
+    0xcacbc74a00000000, 0x773c847d00000000, 0xb024402400000000,
+    0x0dd3031300000000, 0x27de3b2800000000, 0x9a29781f00000000,
+    0x5d31bc4600000000, 0xe0c6ff7100000000, 0xd30034f500000000,
+    0x6ef777c200000000, 0xa9efb39b00000000, 0x1418f0ac00000000,
+    0x7b34d41900000000, 0xc6c3972e00000000, 0x01db537700000000,
+    0xbc2c104000000000, 0x8feadbc400000000, 0x321d98f300000000,
+    0xf5055caa00000000, 0x48f21f9d00000000, 0x62ff27a600000000,
+    0xdf08649100000000, 0x1810a0c800000000, 0xa5e7e3ff00000000,
+    0x9621287b00000000, 0x2bd66b4c00000000, 0xecceaf1500000000,
+    0x5139ec2200000000, 0xb8d4df6300000000, 0x05239c5400000000,
+    0xc23b580d00000000, 0x7fcc1b3a00000000, 0x4c0ad0be00000000,
+    0xf1fd938900000000, 0x36e557d000000000, 0x8b1214e700000000,
+    0xa11f2cdc00000000, 0x1ce86feb00000000, 0xdbf0abb200000000,
+    0x6607e88500000000, 0x55c1230100000000, 0xe836603600000000,
+    0x2f2ea46f00000000, 0x92d9e75800000000, 0x0b9d6bde00000000,
+    0xb66a28e900000000, 0x7172ecb000000000, 0xcc85af8700000000,
+    0xff43640300000000, 0x42b4273400000000, 0x85ace36d00000000,
+    0x385ba05a00000000, 0x1256986100000000, 0xafa1db5600000000,
+    0x68b91f0f00000000, 0xd54e5c3800000000, 0xe68897bc00000000,
+    0x5b7fd48b00000000, 0x9c6710d200000000, 0x219053e500000000,
+    0xc87d60a400000000, 0x758a239300000000, 0xb292e7ca00000000,
+    0x0f65a4fd00000000, 0x3ca36f7900000000, 0x81542c4e00000000,
+    0x464ce81700000000, 0xfbbbab2000000000, 0xd1b6931b00000000,
+    0x6c41d02c00000000, 0xab59147500000000, 0x16ae574200000000,
+    0x25689cc600000000, 0x989fdff100000000, 0x5f871ba800000000,
+    0xe270589f00000000, 0x8d5c7c2a00000000, 0x30ab3f1d00000000,
+    0xf7b3fb4400000000, 0x4a44b87300000000, 0x798273f700000000,
+    0xc47530c000000000, 0x036df49900000000, 0xbe9ab7ae00000000,
+    0x94978f9500000000, 0x2960cca200000000, 0xee7808fb00000000,
+    0x538f4bcc00000000, 0x6049804800000000, 0xddbec37f00000000,
+    0x1aa6072600000000, 0xa751441100000000, 0x4ebc775000000000,
+    0xf34b346700000000, 0x3453f03e00000000, 0x89a4b30900000000,
+    0xba62788d00000000, 0x07953bba00000000, 0xc08dffe300000000,
+    0x7d7abcd400000000, 0x577784ef00000000, 0xea80c7d800000000,
+    0x2d98038100000000, 0x906f40b600000000, 0xa3a98b3200000000,
+    0x1e5ec80500000000, 0xd9460c5c00000000, 0x64b14f6b00000000,
+    0xf668a83300000000, 0x4b9feb0400000000, 0x8c872f5d00000000,
+    0x31706c6a00000000, 0x02b6a7ee00000000, 0xbf41e4d900000000,
+    0x7859208000000000, 0xc5ae63b700000000, 0xefa35b8c00000000,
+    0x525418bb00000000, 0x954cdce200000000, 0x28bb9fd500000000,
+    0x1b7d545100000000, 0xa68a176600000000, 0x6192d33f00000000,
+    0xdc65900800000000, 0x3588a34900000000, 0x887fe07e00000000,
+    0x4f67242700000000, 0xf290671000000000, 0xc156ac9400000000,
+    0x7ca1efa300000000, 0xbbb92bfa00000000, 0x064e68cd00000000,
+    0x2c4350f600000000, 0x91b413c100000000, 0x56acd79800000000,
+    0xeb5b94af00000000, 0xd89d5f2b00000000, 0x656a1c1c00000000,
+    0xa272d84500000000, 0x1f859b7200000000, 0x70a9bfc700000000,
+    0xcd5efcf000000000, 0x0a4638a900000000, 0xb7b17b9e00000000,
+    0x8477b01a00000000, 0x3980f32d00000000, 0xfe98377400000000,
+    0x436f744300000000, 0x69624c7800000000, 0xd4950f4f00000000,
+    0x138dcb1600000000, 0xae7a882100000000, 0x9dbc43a500000000,
+    0x204b009200000000, 0xe753c4cb00000000, 0x5aa487fc00000000,
+    0xb349b4bd00000000, 0x0ebef78a00000000, 0xc9a633d300000000,
+    0x745170e400000000, 0x4797bb6000000000, 0xfa60f85700000000,
+    0x3d783c0e00000000, 0x808f7f3900000000, 0xaa82470200000000,
+    0x1775043500000000, 0xd06dc06c00000000, 0x6d9a835b00000000,
+    0x5e5c48df00000000, 0xe3ab0be800000000, 0x24b3cfb100000000,
+    0x99448c8600000000},
+   {0x0000000000000000, 0xed7d0a0d00000000, 0xdafb141a00000000,
+    0x37861e1700000000, 0xb4f7293400000000, 0x598a233900000000,
+    0x6e0c3d2e00000000, 0x8371372300000000, 0x68ef536800000000,
+    0x8592596500000000, 0xb214477200000000, 0x5f694d7f00000000,
+    0xdc187a5c00000000, 0x3165705100000000, 0x06e36e4600000000,
+    0xeb9e644b00000000, 0xd0dea7d000000000, 0x3da3addd00000000,
+    0x0a25b3ca00000000, 0xe758b9c700000000, 0x64298ee400000000,
+    0x895484e900000000, 0xbed29afe00000000, 0x53af90f300000000,
+    0xb831f4b800000000, 0x554cfeb500000000, 0x62cae0a200000000,
+    0x8fb7eaaf00000000, 0x0cc6dd8c00000000, 0xe1bbd78100000000,
+    0xd63dc99600000000, 0x3b40c39b00000000, 0x51cba3a400000000,
+    0xbcb6a9a900000000, 0x8b30b7be00000000, 0x664dbdb300000000,
+    0xe53c8a9000000000, 0x0841809d00000000, 0x3fc79e8a00000000,
+    0xd2ba948700000000, 0x3924f0cc00000000, 0xd459fac100000000,
+    0xe3dfe4d600000000, 0x0ea2eedb00000000, 0x8dd3d9f800000000,
+    0x60aed3f500000000, 0x5728cde200000000, 0xba55c7ef00000000,
+    0x8115047400000000, 0x6c680e7900000000, 0x5bee106e00000000,
+    0xb6931a6300000000, 0x35e22d4000000000, 0xd89f274d00000000,
+    0xef19395a00000000, 0x0264335700000000, 0xe9fa571c00000000,
+    0x04875d1100000000, 0x3301430600000000, 0xde7c490b00000000,
+    0x5d0d7e2800000000, 0xb070742500000000, 0x87f66a3200000000,
+    0x6a8b603f00000000, 0x53e0ab4c00000000, 0xbe9da14100000000,
+    0x891bbf5600000000, 0x6466b55b00000000, 0xe717827800000000,
+    0x0a6a887500000000, 0x3dec966200000000, 0xd0919c6f00000000,
+    0x3b0ff82400000000, 0xd672f22900000000, 0xe1f4ec3e00000000,
+    0x0c89e63300000000, 0x8ff8d11000000000, 0x6285db1d00000000,
+    0x5503c50a00000000, 0xb87ecf0700000000, 0x833e0c9c00000000,
+    0x6e43069100000000, 0x59c5188600000000, 0xb4b8128b00000000,
+    0x37c925a800000000, 0xdab42fa500000000, 0xed3231b200000000,
+    0x004f3bbf00000000, 0xebd15ff400000000, 0x06ac55f900000000,
+    0x312a4bee00000000, 0xdc5741e300000000, 0x5f2676c000000000,
+    0xb25b7ccd00000000, 0x85dd62da00000000, 0x68a068d700000000,
+    0x022b08e800000000, 0xef5602e500000000, 0xd8d01cf200000000,
+    0x35ad16ff00000000, 0xb6dc21dc00000000, 0x5ba12bd100000000,
+    0x6c2735c600000000, 0x815a3fcb00000000, 0x6ac45b8000000000,
+    0x87b9518d00000000, 0xb03f4f9a00000000, 0x5d42459700000000,
+    0xde3372b400000000, 0x334e78b900000000, 0x04c866ae00000000,
+    0xe9b56ca300000000, 0xd2f5af3800000000, 0x3f88a53500000000,
+    0x080ebb2200000000, 0xe573b12f00000000, 0x6602860c00000000,
+    0x8b7f8c0100000000, 0xbcf9921600000000, 0x5184981b00000000,
+    0xba1afc5000000000, 0x5767f65d00000000, 0x60e1e84a00000000,
+    0x8d9ce24700000000, 0x0eedd56400000000, 0xe390df6900000000,
+    0xd416c17e00000000, 0x396bcb7300000000, 0xa6c0579900000000,
+    0x4bbd5d9400000000, 0x7c3b438300000000, 0x9146498e00000000,
+    0x12377ead00000000, 0xff4a74a000000000, 0xc8cc6ab700000000,
+    0x25b160ba00000000, 0xce2f04f100000000, 0x23520efc00000000,
+    0x14d410eb00000000, 0xf9a91ae600000000, 0x7ad82dc500000000,
+    0x97a527c800000000, 0xa02339df00000000, 0x4d5e33d200000000,
+    0x761ef04900000000, 0x9b63fa4400000000, 0xace5e45300000000,
+    0x4198ee5e00000000, 0xc2e9d97d00000000, 0x2f94d37000000000,
+    0x1812cd6700000000, 0xf56fc76a00000000, 0x1ef1a32100000000,
+    0xf38ca92c00000000, 0xc40ab73b00000000, 0x2977bd3600000000,
+    0xaa068a1500000000, 0x477b801800000000, 0x70fd9e0f00000000,
+    0x9d80940200000000, 0xf70bf43d00000000, 0x1a76fe3000000000,
+    0x2df0e02700000000, 0xc08dea2a00000000, 0x43fcdd0900000000,
+    0xae81d70400000000, 0x9907c91300000000, 0x747ac31e00000000,
+    0x9fe4a75500000000, 0x7299ad5800000000, 0x451fb34f00000000,
+    0xa862b94200000000, 0x2b138e6100000000, 0xc66e846c00000000,
+    0xf1e89a7b00000000, 0x1c95907600000000, 0x27d553ed00000000,
+    0xcaa859e000000000, 0xfd2e47f700000000, 0x10534dfa00000000,
+    0x93227ad900000000, 0x7e5f70d400000000, 0x49d96ec300000000,
+    0xa4a464ce00000000, 0x4f3a008500000000, 0xa2470a8800000000,
+    0x95c1149f00000000, 0x78bc1e9200000000, 0xfbcd29b100000000,
+    0x16b023bc00000000, 0x21363dab00000000, 0xcc4b37a600000000,
+    0xf520fcd500000000, 0x185df6d800000000, 0x2fdbe8cf00000000,
+    0xc2a6e2c200000000, 0x41d7d5e100000000, 0xacaadfec00000000,
+    0x9b2cc1fb00000000, 0x7651cbf600000000, 0x9dcfafbd00000000,
+    0x70b2a5b000000000, 0x4734bba700000000, 0xaa49b1aa00000000,
+    0x2938868900000000, 0xc4458c8400000000, 0xf3c3929300000000,
+    0x1ebe989e00000000, 0x25fe5b0500000000, 0xc883510800000000,
+    0xff054f1f00000000, 0x1278451200000000, 0x9109723100000000,
+    0x7c74783c00000000, 0x4bf2662b00000000, 0xa68f6c2600000000,
+    0x4d11086d00000000, 0xa06c026000000000, 0x97ea1c7700000000,
+    0x7a97167a00000000, 0xf9e6215900000000, 0x149b2b5400000000,
+    0x231d354300000000, 0xce603f4e00000000, 0xa4eb5f7100000000,
+    0x4996557c00000000, 0x7e104b6b00000000, 0x936d416600000000,
+    0x101c764500000000, 0xfd617c4800000000, 0xcae7625f00000000,
+    0x279a685200000000, 0xcc040c1900000000, 0x2179061400000000,
+    0x16ff180300000000, 0xfb82120e00000000, 0x78f3252d00000000,
+    0x958e2f2000000000, 0xa208313700000000, 0x4f753b3a00000000,
+    0x7435f8a100000000, 0x9948f2ac00000000, 0xaeceecbb00000000,
+    0x43b3e6b600000000, 0xc0c2d19500000000, 0x2dbfdb9800000000,
+    0x1a39c58f00000000, 0xf744cf8200000000, 0x1cdaabc900000000,
+    0xf1a7a1c400000000, 0xc621bfd300000000, 0x2b5cb5de00000000,
+    0xa82d82fd00000000, 0x455088f000000000, 0x72d696e700000000,
+    0x9fab9cea00000000},
+   {0x0000000000000000, 0xb4ee155c00000000, 0x68dd2bb800000000,
+    0xdc333ee400000000, 0x21ccbb7500000000, 0x9522ae2900000000,
+    0x491190cd00000000, 0xfdff859100000000, 0x429877eb00000000,
+    0xf67662b700000000, 0x2a455c5300000000, 0x9eab490f00000000,
+    0x6354cc9e00000000, 0xd7bad9c200000000, 0x0b89e72600000000,
+    0xbf67f27a00000000, 0x754603d300000000, 0xc1a8168f00000000,
+    0x1d9b286b00000000, 0xa9753d3700000000, 0x548ab8a600000000,
+    0xe064adfa00000000, 0x3c57931e00000000, 0x88b9864200000000,
+    0x37de743800000000, 0x8330616400000000, 0x5f035f8000000000,
+    0xebed4adc00000000, 0x1612cf4d00000000, 0xa2fcda1100000000,
+    0x7ecfe4f500000000, 0xca21f1a900000000, 0x1bfaeaa300000000,
+    0xaf14ffff00000000, 0x7327c11b00000000, 0xc7c9d44700000000,
+    0x3a3651d600000000, 0x8ed8448a00000000, 0x52eb7a6e00000000,
+    0xe6056f3200000000, 0x59629d4800000000, 0xed8c881400000000,
+    0x31bfb6f000000000, 0x8551a3ac00000000, 0x78ae263d00000000,
+    0xcc40336100000000, 0x10730d8500000000, 0xa49d18d900000000,
+    0x6ebce97000000000, 0xda52fc2c00000000, 0x0661c2c800000000,
+    0xb28fd79400000000, 0x4f70520500000000, 0xfb9e475900000000,
+    0x27ad79bd00000000, 0x93436ce100000000, 0x2c249e9b00000000,
+    0x98ca8bc700000000, 0x44f9b52300000000, 0xf017a07f00000000,
+    0x0de825ee00000000, 0xb90630b200000000, 0x65350e5600000000,
+    0xd1db1b0a00000000, 0xc782394200000000, 0x736c2c1e00000000,
+    0xaf5f12fa00000000, 0x1bb107a600000000, 0xe64e823700000000,
+    0x52a0976b00000000, 0x8e93a98f00000000, 0x3a7dbcd300000000,
+    0x851a4ea900000000, 0x31f45bf500000000, 0xedc7651100000000,
+    0x5929704d00000000, 0xa4d6f5dc00000000, 0x1038e08000000000,
+    0xcc0bde6400000000, 0x78e5cb3800000000, 0xb2c43a9100000000,
+    0x062a2fcd00000000, 0xda19112900000000, 0x6ef7047500000000,
+    0x930881e400000000, 0x27e694b800000000, 0xfbd5aa5c00000000,
+    0x4f3bbf0000000000, 0xf05c4d7a00000000, 0x44b2582600000000,
+    0x988166c200000000, 0x2c6f739e00000000, 0xd190f60f00000000,
+    0x657ee35300000000, 0xb94dddb700000000, 0x0da3c8eb00000000,
+    0xdc78d3e100000000, 0x6896c6bd00000000, 0xb4a5f85900000000,
+    0x004bed0500000000, 0xfdb4689400000000, 0x495a7dc800000000,
+    0x9569432c00000000, 0x2187567000000000, 0x9ee0a40a00000000,
+    0x2a0eb15600000000, 0xf63d8fb200000000, 0x42d39aee00000000,
+    0xbf2c1f7f00000000, 0x0bc20a2300000000, 0xd7f134c700000000,
+    0x631f219b00000000, 0xa93ed03200000000, 0x1dd0c56e00000000,
+    0xc1e3fb8a00000000, 0x750deed600000000, 0x88f26b4700000000,
+    0x3c1c7e1b00000000, 0xe02f40ff00000000, 0x54c155a300000000,
+    0xeba6a7d900000000, 0x5f48b28500000000, 0x837b8c6100000000,
+    0x3795993d00000000, 0xca6a1cac00000000, 0x7e8409f000000000,
+    0xa2b7371400000000, 0x1659224800000000, 0x8e05738400000000,
+    0x3aeb66d800000000, 0xe6d8583c00000000, 0x52364d6000000000,
+    0xafc9c8f100000000, 0x1b27ddad00000000, 0xc714e34900000000,
+    0x73faf61500000000, 0xcc9d046f00000000, 0x7873113300000000,
+    0xa4402fd700000000, 0x10ae3a8b00000000, 0xed51bf1a00000000,
+    0x59bfaa4600000000, 0x858c94a200000000, 0x316281fe00000000,
+    0xfb43705700000000, 0x4fad650b00000000, 0x939e5bef00000000,
+    0x27704eb300000000, 0xda8fcb2200000000, 0x6e61de7e00000000,
+    0xb252e09a00000000, 0x06bcf5c600000000, 0xb9db07bc00000000,
+    0x0d3512e000000000, 0xd1062c0400000000, 0x65e8395800000000,
+    0x9817bcc900000000, 0x2cf9a99500000000, 0xf0ca977100000000,
+    0x4424822d00000000, 0x95ff992700000000, 0x21118c7b00000000,
+    0xfd22b29f00000000, 0x49cca7c300000000, 0xb433225200000000,
+    0x00dd370e00000000, 0xdcee09ea00000000, 0x68001cb600000000,
+    0xd767eecc00000000, 0x6389fb9000000000, 0xbfbac57400000000,
+    0x0b54d02800000000, 0xf6ab55b900000000, 0x424540e500000000,
+    0x9e767e0100000000, 0x2a986b5d00000000, 0xe0b99af400000000,
+    0x54578fa800000000, 0x8864b14c00000000, 0x3c8aa41000000000,
+    0xc175218100000000, 0x759b34dd00000000, 0xa9a80a3900000000,
+    0x1d461f6500000000, 0xa221ed1f00000000, 0x16cff84300000000,
+    0xcafcc6a700000000, 0x7e12d3fb00000000, 0x83ed566a00000000,
+    0x3703433600000000, 0xeb307dd200000000, 0x5fde688e00000000,
+    0x49874ac600000000, 0xfd695f9a00000000, 0x215a617e00000000,
+    0x95b4742200000000, 0x684bf1b300000000, 0xdca5e4ef00000000,
+    0x0096da0b00000000, 0xb478cf5700000000, 0x0b1f3d2d00000000,
+    0xbff1287100000000, 0x63c2169500000000, 0xd72c03c900000000,
+    0x2ad3865800000000, 0x9e3d930400000000, 0x420eade000000000,
+    0xf6e0b8bc00000000, 0x3cc1491500000000, 0x882f5c4900000000,
+    0x541c62ad00000000, 0xe0f277f100000000, 0x1d0df26000000000,
+    0xa9e3e73c00000000, 0x75d0d9d800000000, 0xc13ecc8400000000,
+    0x7e593efe00000000, 0xcab72ba200000000, 0x1684154600000000,
+    0xa26a001a00000000, 0x5f95858b00000000, 0xeb7b90d700000000,
+    0x3748ae3300000000, 0x83a6bb6f00000000, 0x527da06500000000,
+    0xe693b53900000000, 0x3aa08bdd00000000, 0x8e4e9e8100000000,
+    0x73b11b1000000000, 0xc75f0e4c00000000, 0x1b6c30a800000000,
+    0xaf8225f400000000, 0x10e5d78e00000000, 0xa40bc2d200000000,
+    0x7838fc3600000000, 0xccd6e96a00000000, 0x31296cfb00000000,
+    0x85c779a700000000, 0x59f4474300000000, 0xed1a521f00000000,
+    0x273ba3b600000000, 0x93d5b6ea00000000, 0x4fe6880e00000000,
+    0xfb089d5200000000, 0x06f718c300000000, 0xb2190d9f00000000,
+    0x6e2a337b00000000, 0xdac4262700000000, 0x65a3d45d00000000,
+    0xd14dc10100000000, 0x0d7effe500000000, 0xb990eab900000000,
+    0x446f6f2800000000, 0xf0817a7400000000, 0x2cb2449000000000,
+    0x985c51cc00000000},
+   {0x0000000000000000, 0x38f0d37500000000, 0x70e0a7eb00000000,
+    0x4810749e00000000, 0x11b6a3d200000000, 0x294670a700000000,
+    0x6156043900000000, 0x59a6d74c00000000, 0xd31aaba000000000,
+    0xebea78d500000000, 0xa3fa0c4b00000000, 0x9b0adf3e00000000,
+    0xc2ac087200000000, 0xfa5cdb0700000000, 0xb24caf9900000000,
+    0x8abc7cec00000000, 0x5743ba4400000000, 0x6fb3693100000000,
+    0x27a31daf00000000, 0x1f53ceda00000000, 0x46f5199600000000,
+    0x7e05cae300000000, 0x3615be7d00000000, 0x0ee56d0800000000,
+    0x845911e400000000, 0xbca9c29100000000, 0xf4b9b60f00000000,
+    0xcc49657a00000000, 0x95efb23600000000, 0xad1f614300000000,
+    0xe50f15dd00000000, 0xddffc6a800000000, 0xae86748900000000,
+    0x9676a7fc00000000, 0xde66d36200000000, 0xe696001700000000,
+    0xbf30d75b00000000, 0x87c0042e00000000, 0xcfd070b000000000,
+    0xf720a3c500000000, 0x7d9cdf2900000000, 0x456c0c5c00000000,
+    0x0d7c78c200000000, 0x358cabb700000000, 0x6c2a7cfb00000000,
+    0x54daaf8e00000000, 0x1ccadb1000000000, 0x243a086500000000,
+    0xf9c5cecd00000000, 0xc1351db800000000, 0x8925692600000000,
+    0xb1d5ba5300000000, 0xe8736d1f00000000, 0xd083be6a00000000,
+    0x9893caf400000000, 0xa063198100000000, 0x2adf656d00000000,
+    0x122fb61800000000, 0x5a3fc28600000000, 0x62cf11f300000000,
+    0x3b69c6bf00000000, 0x039915ca00000000, 0x4b89615400000000,
+    0x7379b22100000000, 0xad7b051700000000, 0x958bd66200000000,
+    0xdd9ba2fc00000000, 0xe56b718900000000, 0xbccda6c500000000,
+    0x843d75b000000000, 0xcc2d012e00000000, 0xf4ddd25b00000000,
+    0x7e61aeb700000000, 0x46917dc200000000, 0x0e81095c00000000,
+    0x3671da2900000000, 0x6fd70d6500000000, 0x5727de1000000000,
+    0x1f37aa8e00000000, 0x27c779fb00000000, 0xfa38bf5300000000,
+    0xc2c86c2600000000, 0x8ad818b800000000, 0xb228cbcd00000000,
+    0xeb8e1c8100000000, 0xd37ecff400000000, 0x9b6ebb6a00000000,
+    0xa39e681f00000000, 0x292214f300000000, 0x11d2c78600000000,
+    0x59c2b31800000000, 0x6132606d00000000, 0x3894b72100000000,
+    0x0064645400000000, 0x487410ca00000000, 0x7084c3bf00000000,
+    0x03fd719e00000000, 0x3b0da2eb00000000, 0x731dd67500000000,
+    0x4bed050000000000, 0x124bd24c00000000, 0x2abb013900000000,
+    0x62ab75a700000000, 0x5a5ba6d200000000, 0xd0e7da3e00000000,
+    0xe817094b00000000, 0xa0077dd500000000, 0x98f7aea000000000,
+    0xc15179ec00000000, 0xf9a1aa9900000000, 0xb1b1de0700000000,
+    0x89410d7200000000, 0x54becbda00000000, 0x6c4e18af00000000,
+    0x245e6c3100000000, 0x1caebf4400000000, 0x4508680800000000,
+    0x7df8bb7d00000000, 0x35e8cfe300000000, 0x0d181c9600000000,
+    0x87a4607a00000000, 0xbf54b30f00000000, 0xf744c79100000000,
+    0xcfb414e400000000, 0x9612c3a800000000, 0xaee210dd00000000,
+    0xe6f2644300000000, 0xde02b73600000000, 0x5af70a2e00000000,
+    0x6207d95b00000000, 0x2a17adc500000000, 0x12e77eb000000000,
+    0x4b41a9fc00000000, 0x73b17a8900000000, 0x3ba10e1700000000,
+    0x0351dd6200000000, 0x89eda18e00000000, 0xb11d72fb00000000,
+    0xf90d066500000000, 0xc1fdd51000000000, 0x985b025c00000000,
+    0xa0abd12900000000, 0xe8bba5b700000000, 0xd04b76c200000000,
+    0x0db4b06a00000000, 0x3544631f00000000, 0x7d54178100000000,
+    0x45a4c4f400000000, 0x1c0213b800000000, 0x24f2c0cd00000000,
+    0x6ce2b45300000000, 0x5412672600000000, 0xdeae1bca00000000,
+    0xe65ec8bf00000000, 0xae4ebc2100000000, 0x96be6f5400000000,
+    0xcf18b81800000000, 0xf7e86b6d00000000, 0xbff81ff300000000,
+    0x8708cc8600000000, 0xf4717ea700000000, 0xcc81add200000000,
+    0x8491d94c00000000, 0xbc610a3900000000, 0xe5c7dd7500000000,
+    0xdd370e0000000000, 0x95277a9e00000000, 0xadd7a9eb00000000,
+    0x276bd50700000000, 0x1f9b067200000000, 0x578b72ec00000000,
+    0x6f7ba19900000000, 0x36dd76d500000000, 0x0e2da5a000000000,
+    0x463dd13e00000000, 0x7ecd024b00000000, 0xa332c4e300000000,
+    0x9bc2179600000000, 0xd3d2630800000000, 0xeb22b07d00000000,
+    0xb284673100000000, 0x8a74b44400000000, 0xc264c0da00000000,
+    0xfa9413af00000000, 0x70286f4300000000, 0x48d8bc3600000000,
+    0x00c8c8a800000000, 0x38381bdd00000000, 0x619ecc9100000000,
+    0x596e1fe400000000, 0x117e6b7a00000000, 0x298eb80f00000000,
+    0xf78c0f3900000000, 0xcf7cdc4c00000000, 0x876ca8d200000000,
+    0xbf9c7ba700000000, 0xe63aaceb00000000, 0xdeca7f9e00000000,
+    0x96da0b0000000000, 0xae2ad87500000000, 0x2496a49900000000,
+    0x1c6677ec00000000, 0x5476037200000000, 0x6c86d00700000000,
+    0x3520074b00000000, 0x0dd0d43e00000000, 0x45c0a0a000000000,
+    0x7d3073d500000000, 0xa0cfb57d00000000, 0x983f660800000000,
+    0xd02f129600000000, 0xe8dfc1e300000000, 0xb17916af00000000,
+    0x8989c5da00000000, 0xc199b14400000000, 0xf969623100000000,
+    0x73d51edd00000000, 0x4b25cda800000000, 0x0335b93600000000,
+    0x3bc56a4300000000, 0x6263bd0f00000000, 0x5a936e7a00000000,
+    0x12831ae400000000, 0x2a73c99100000000, 0x590a7bb000000000,
+    0x61faa8c500000000, 0x29eadc5b00000000, 0x111a0f2e00000000,
+    0x48bcd86200000000, 0x704c0b1700000000, 0x385c7f8900000000,
+    0x00acacfc00000000, 0x8a10d01000000000, 0xb2e0036500000000,
+    0xfaf077fb00000000, 0xc200a48e00000000, 0x9ba673c200000000,
+    0xa356a0b700000000, 0xeb46d42900000000, 0xd3b6075c00000000,
+    0x0e49c1f400000000, 0x36b9128100000000, 0x7ea9661f00000000,
+    0x4659b56a00000000, 0x1fff622600000000, 0x270fb15300000000,
+    0x6f1fc5cd00000000, 0x57ef16b800000000, 0xdd536a5400000000,
+    0xe5a3b92100000000, 0xadb3cdbf00000000, 0x95431eca00000000,
+    0xcce5c98600000000, 0xf4151af300000000, 0xbc056e6d00000000,
+    0x84f5bd1800000000},
+   {0x0000000000000000, 0x8ec24fba00000000, 0xedf3737100000000,
+    0x63313ccb00000000, 0xdae7e7e200000000, 0x5425a85800000000,
+    0x3714949300000000, 0xb9d6db2900000000, 0x45b923c000000000,
+    0xcb7b6c7a00000000, 0xa84a50b100000000, 0x26881f0b00000000,
+    0x9f5ec42200000000, 0x119c8b9800000000, 0x72adb75300000000,
+    0xfc6ff8e900000000, 0x7b04ab8500000000, 0xf5c6e43f00000000,
+    0x96f7d8f400000000, 0x1835974e00000000, 0xa1e34c6700000000,
+    0x2f2103dd00000000, 0x4c103f1600000000, 0xc2d270ac00000000,
+    0x3ebd884500000000, 0xb07fc7ff00000000, 0xd34efb3400000000,
+    0x5d8cb48e00000000, 0xe45a6fa700000000, 0x6a98201d00000000,
+    0x09a91cd600000000, 0x876b536c00000000, 0x077eba0e00000000,
+    0x89bcf5b400000000, 0xea8dc97f00000000, 0x644f86c500000000,
+    0xdd995dec00000000, 0x535b125600000000, 0x306a2e9d00000000,
+    0xbea8612700000000, 0x42c799ce00000000, 0xcc05d67400000000,
+    0xaf34eabf00000000, 0x21f6a50500000000, 0x98207e2c00000000,
+    0x16e2319600000000, 0x75d30d5d00000000, 0xfb1142e700000000,
+    0x7c7a118b00000000, 0xf2b85e3100000000, 0x918962fa00000000,
+    0x1f4b2d4000000000, 0xa69df66900000000, 0x285fb9d300000000,
+    0x4b6e851800000000, 0xc5accaa200000000, 0x39c3324b00000000,
+    0xb7017df100000000, 0xd430413a00000000, 0x5af20e8000000000,
+    0xe324d5a900000000, 0x6de69a1300000000, 0x0ed7a6d800000000,
+    0x8015e96200000000, 0x0efc741d00000000, 0x803e3ba700000000,
+    0xe30f076c00000000, 0x6dcd48d600000000, 0xd41b93ff00000000,
+    0x5ad9dc4500000000, 0x39e8e08e00000000, 0xb72aaf3400000000,
+    0x4b4557dd00000000, 0xc587186700000000, 0xa6b624ac00000000,
+    0x28746b1600000000, 0x91a2b03f00000000, 0x1f60ff8500000000,
+    0x7c51c34e00000000, 0xf2938cf400000000, 0x75f8df9800000000,
+    0xfb3a902200000000, 0x980bace900000000, 0x16c9e35300000000,
+    0xaf1f387a00000000, 0x21dd77c000000000, 0x42ec4b0b00000000,
+    0xcc2e04b100000000, 0x3041fc5800000000, 0xbe83b3e200000000,
+    0xddb28f2900000000, 0x5370c09300000000, 0xeaa61bba00000000,
+    0x6464540000000000, 0x075568cb00000000, 0x8997277100000000,
+    0x0982ce1300000000, 0x874081a900000000, 0xe471bd6200000000,
+    0x6ab3f2d800000000, 0xd36529f100000000, 0x5da7664b00000000,
+    0x3e965a8000000000, 0xb054153a00000000, 0x4c3bedd300000000,
+    0xc2f9a26900000000, 0xa1c89ea200000000, 0x2f0ad11800000000,
+    0x96dc0a3100000000, 0x181e458b00000000, 0x7b2f794000000000,
+    0xf5ed36fa00000000, 0x7286659600000000, 0xfc442a2c00000000,
+    0x9f7516e700000000, 0x11b7595d00000000, 0xa861827400000000,
+    0x26a3cdce00000000, 0x4592f10500000000, 0xcb50bebf00000000,
+    0x373f465600000000, 0xb9fd09ec00000000, 0xdacc352700000000,
+    0x540e7a9d00000000, 0xedd8a1b400000000, 0x631aee0e00000000,
+    0x002bd2c500000000, 0x8ee99d7f00000000, 0x1cf8e93a00000000,
+    0x923aa68000000000, 0xf10b9a4b00000000, 0x7fc9d5f100000000,
+    0xc61f0ed800000000, 0x48dd416200000000, 0x2bec7da900000000,
+    0xa52e321300000000, 0x5941cafa00000000, 0xd783854000000000,
+    0xb4b2b98b00000000, 0x3a70f63100000000, 0x83a62d1800000000,
+    0x0d6462a200000000, 0x6e555e6900000000, 0xe09711d300000000,
+    0x67fc42bf00000000, 0xe93e0d0500000000, 0x8a0f31ce00000000,
+    0x04cd7e7400000000, 0xbd1ba55d00000000, 0x33d9eae700000000,
+    0x50e8d62c00000000, 0xde2a999600000000, 0x2245617f00000000,
+    0xac872ec500000000, 0xcfb6120e00000000, 0x41745db400000000,
+    0xf8a2869d00000000, 0x7660c92700000000, 0x1551f5ec00000000,
+    0x9b93ba5600000000, 0x1b86533400000000, 0x95441c8e00000000,
+    0xf675204500000000, 0x78b76fff00000000, 0xc161b4d600000000,
+    0x4fa3fb6c00000000, 0x2c92c7a700000000, 0xa250881d00000000,
+    0x5e3f70f400000000, 0xd0fd3f4e00000000, 0xb3cc038500000000,
+    0x3d0e4c3f00000000, 0x84d8971600000000, 0x0a1ad8ac00000000,
+    0x692be46700000000, 0xe7e9abdd00000000, 0x6082f8b100000000,
+    0xee40b70b00000000, 0x8d718bc000000000, 0x03b3c47a00000000,
+    0xba651f5300000000, 0x34a750e900000000, 0x57966c2200000000,
+    0xd954239800000000, 0x253bdb7100000000, 0xabf994cb00000000,
+    0xc8c8a80000000000, 0x460ae7ba00000000, 0xffdc3c9300000000,
+    0x711e732900000000, 0x122f4fe200000000, 0x9ced005800000000,
+    0x12049d2700000000, 0x9cc6d29d00000000, 0xfff7ee5600000000,
+    0x7135a1ec00000000, 0xc8e37ac500000000, 0x4621357f00000000,
+    0x251009b400000000, 0xabd2460e00000000, 0x57bdbee700000000,
+    0xd97ff15d00000000, 0xba4ecd9600000000, 0x348c822c00000000,
+    0x8d5a590500000000, 0x039816bf00000000, 0x60a92a7400000000,
+    0xee6b65ce00000000, 0x690036a200000000, 0xe7c2791800000000,
+    0x84f345d300000000, 0x0a310a6900000000, 0xb3e7d14000000000,
+    0x3d259efa00000000, 0x5e14a23100000000, 0xd0d6ed8b00000000,
+    0x2cb9156200000000, 0xa27b5ad800000000, 0xc14a661300000000,
+    0x4f8829a900000000, 0xf65ef28000000000, 0x789cbd3a00000000,
+    0x1bad81f100000000, 0x956fce4b00000000, 0x157a272900000000,
+    0x9bb8689300000000, 0xf889545800000000, 0x764b1be200000000,
+    0xcf9dc0cb00000000, 0x415f8f7100000000, 0x226eb3ba00000000,
+    0xacacfc0000000000, 0x50c304e900000000, 0xde014b5300000000,
+    0xbd30779800000000, 0x33f2382200000000, 0x8a24e30b00000000,
+    0x04e6acb100000000, 0x67d7907a00000000, 0xe915dfc000000000,
+    0x6e7e8cac00000000, 0xe0bcc31600000000, 0x838dffdd00000000,
+    0x0d4fb06700000000, 0xb4996b4e00000000, 0x3a5b24f400000000,
+    0x596a183f00000000, 0xd7a8578500000000, 0x2bc7af6c00000000,
+    0xa505e0d600000000, 0xc634dc1d00000000, 0x48f693a700000000,
+    0xf120488e00000000, 0x7fe2073400000000, 0x1cd33bff00000000,
+    0x9211744500000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x3171d430, 0x62e3a860, 0x53927c50, 0xc5c750c0,
+    0xf4b684f0, 0xa724f8a0, 0x96552c90, 0x8e62d771, 0xbf130341,
+    0xec817f11, 0xddf0ab21, 0x4ba587b1, 0x7ad45381, 0x29462fd1,
+    0x1837fbe1, 0x1929d813, 0x28580c23, 0x7bca7073, 0x4abba443,
+    0xdcee88d3, 0xed9f5ce3, 0xbe0d20b3, 0x8f7cf483, 0x974b0f62,
+    0xa63adb52, 0xf5a8a702, 0xc4d97332, 0x528c5fa2, 0x63fd8b92,
+    0x306ff7c2, 0x011e23f2, 0x3253b026, 0x03226416, 0x50b01846,
+    0x61c1cc76, 0xf794e0e6, 0xc6e534d6, 0x95774886, 0xa4069cb6,
+    0xbc316757, 0x8d40b367, 0xded2cf37, 0xefa31b07, 0x79f63797,
+    0x4887e3a7, 0x1b159ff7, 0x2a644bc7, 0x2b7a6835, 0x1a0bbc05,
+    0x4999c055, 0x78e81465, 0xeebd38f5, 0xdfccecc5, 0x8c5e9095,
+    0xbd2f44a5, 0xa518bf44, 0x94696b74, 0xc7fb1724, 0xf68ac314,
+    0x60dfef84, 0x51ae3bb4, 0x023c47e4, 0x334d93d4, 0x64a7604c,
+    0x55d6b47c, 0x0644c82c, 0x37351c1c, 0xa160308c, 0x9011e4bc,
+    0xc38398ec, 0xf2f24cdc, 0xeac5b73d, 0xdbb4630d, 0x88261f5d,
+    0xb957cb6d, 0x2f02e7fd, 0x1e7333cd, 0x4de14f9d, 0x7c909bad,
+    0x7d8eb85f, 0x4cff6c6f, 0x1f6d103f, 0x2e1cc40f, 0xb849e89f,
+    0x89383caf, 0xdaaa40ff, 0xebdb94cf, 0xf3ec6f2e, 0xc29dbb1e,
+    0x910fc74e, 0xa07e137e, 0x362b3fee, 0x075aebde, 0x54c8978e,
+    0x65b943be, 0x56f4d06a, 0x6785045a, 0x3417780a, 0x0566ac3a,
+    0x933380aa, 0xa242549a, 0xf1d028ca, 0xc0a1fcfa, 0xd896071b,
+    0xe9e7d32b, 0xba75af7b, 0x8b047b4b, 0x1d5157db, 0x2c2083eb,
+    0x7fb2ffbb, 0x4ec32b8b, 0x4fdd0879, 0x7eacdc49, 0x2d3ea019,
+    0x1c4f7429, 0x8a1a58b9, 0xbb6b8c89, 0xe8f9f0d9, 0xd98824e9,
+    0xc1bfdf08, 0xf0ce0b38, 0xa35c7768, 0x922da358, 0x04788fc8,
+    0x35095bf8, 0x669b27a8, 0x57eaf398, 0xc94ec098, 0xf83f14a8,
+    0xabad68f8, 0x9adcbcc8, 0x0c899058, 0x3df84468, 0x6e6a3838,
+    0x5f1bec08, 0x472c17e9, 0x765dc3d9, 0x25cfbf89, 0x14be6bb9,
+    0x82eb4729, 0xb39a9319, 0xe008ef49, 0xd1793b79, 0xd067188b,
+    0xe116ccbb, 0xb284b0eb, 0x83f564db, 0x15a0484b, 0x24d19c7b,
+    0x7743e02b, 0x4632341b, 0x5e05cffa, 0x6f741bca, 0x3ce6679a,
+    0x0d97b3aa, 0x9bc29f3a, 0xaab34b0a, 0xf921375a, 0xc850e36a,
+    0xfb1d70be, 0xca6ca48e, 0x99fed8de, 0xa88f0cee, 0x3eda207e,
+    0x0fabf44e, 0x5c39881e, 0x6d485c2e, 0x757fa7cf, 0x440e73ff,
+    0x179c0faf, 0x26eddb9f, 0xb0b8f70f, 0x81c9233f, 0xd25b5f6f,
+    0xe32a8b5f, 0xe234a8ad, 0xd3457c9d, 0x80d700cd, 0xb1a6d4fd,
+    0x27f3f86d, 0x16822c5d, 0x4510500d, 0x7461843d, 0x6c567fdc,
+    0x5d27abec, 0x0eb5d7bc, 0x3fc4038c, 0xa9912f1c, 0x98e0fb2c,
+    0xcb72877c, 0xfa03534c, 0xade9a0d4, 0x9c9874e4, 0xcf0a08b4,
+    0xfe7bdc84, 0x682ef014, 0x595f2424, 0x0acd5874, 0x3bbc8c44,
+    0x238b77a5, 0x12faa395, 0x4168dfc5, 0x70190bf5, 0xe64c2765,
+    0xd73df355, 0x84af8f05, 0xb5de5b35, 0xb4c078c7, 0x85b1acf7,
+    0xd623d0a7, 0xe7520497, 0x71072807, 0x4076fc37, 0x13e48067,
+    0x22955457, 0x3aa2afb6, 0x0bd37b86, 0x584107d6, 0x6930d3e6,
+    0xff65ff76, 0xce142b46, 0x9d865716, 0xacf78326, 0x9fba10f2,
+    0xaecbc4c2, 0xfd59b892, 0xcc286ca2, 0x5a7d4032, 0x6b0c9402,
+    0x389ee852, 0x09ef3c62, 0x11d8c783, 0x20a913b3, 0x733b6fe3,
+    0x424abbd3, 0xd41f9743, 0xe56e4373, 0xb6fc3f23, 0x878deb13,
+    0x8693c8e1, 0xb7e21cd1, 0xe4706081, 0xd501b4b1, 0x43549821,
+    0x72254c11, 0x21b73041, 0x10c6e471, 0x08f11f90, 0x3980cba0,
+    0x6a12b7f0, 0x5b6363c0, 0xcd364f50, 0xfc479b60, 0xafd5e730,
+    0x9ea43300},
+   {0x00000000, 0x9771f7c1, 0x2b0f9973, 0xbc7e6eb2, 0x561f32e6,
+    0xc16ec527, 0x7d10ab95, 0xea615c54, 0xac3e65cc, 0x3b4f920d,
+    0x8731fcbf, 0x10400b7e, 0xfa21572a, 0x6d50a0eb, 0xd12ece59,
+    0x465f3998, 0x5d90bd69, 0xcae14aa8, 0x769f241a, 0xe1eed3db,
+    0x0b8f8f8f, 0x9cfe784e, 0x208016fc, 0xb7f1e13d, 0xf1aed8a5,
+    0x66df2f64, 0xdaa141d6, 0x4dd0b617, 0xa7b1ea43, 0x30c01d82,
+    0x8cbe7330, 0x1bcf84f1, 0xbb217ad2, 0x2c508d13, 0x902ee3a1,
+    0x075f1460, 0xed3e4834, 0x7a4fbff5, 0xc631d147, 0x51402686,
+    0x171f1f1e, 0x806ee8df, 0x3c10866d, 0xab6171ac, 0x41002df8,
+    0xd671da39, 0x6a0fb48b, 0xfd7e434a, 0xe6b1c7bb, 0x71c0307a,
+    0xcdbe5ec8, 0x5acfa909, 0xb0aef55d, 0x27df029c, 0x9ba16c2e,
+    0x0cd09bef, 0x4a8fa277, 0xddfe55b6, 0x61803b04, 0xf6f1ccc5,
+    0x1c909091, 0x8be16750, 0x379f09e2, 0xa0eefe23, 0x73ae8355,
+    0xe4df7494, 0x58a11a26, 0xcfd0ede7, 0x25b1b1b3, 0xb2c04672,
+    0x0ebe28c0, 0x99cfdf01, 0xdf90e699, 0x48e11158, 0xf49f7fea,
+    0x63ee882b, 0x898fd47f, 0x1efe23be, 0xa2804d0c, 0x35f1bacd,
+    0x2e3e3e3c, 0xb94fc9fd, 0x0531a74f, 0x9240508e, 0x78210cda,
+    0xef50fb1b, 0x532e95a9, 0xc45f6268, 0x82005bf0, 0x1571ac31,
+    0xa90fc283, 0x3e7e3542, 0xd41f6916, 0x436e9ed7, 0xff10f065,
+    0x686107a4, 0xc88ff987, 0x5ffe0e46, 0xe38060f4, 0x74f19735,
+    0x9e90cb61, 0x09e13ca0, 0xb59f5212, 0x22eea5d3, 0x64b19c4b,
+    0xf3c06b8a, 0x4fbe0538, 0xd8cff2f9, 0x32aeaead, 0xa5df596c,
+    0x19a137de, 0x8ed0c01f, 0x951f44ee, 0x026eb32f, 0xbe10dd9d,
+    0x29612a5c, 0xc3007608, 0x547181c9, 0xe80fef7b, 0x7f7e18ba,
+    0x39212122, 0xae50d6e3, 0x122eb851, 0x855f4f90, 0x6f3e13c4,
+    0xf84fe405, 0x44318ab7, 0xd3407d76, 0xe75d06aa, 0x702cf16b,
+    0xcc529fd9, 0x5b236818, 0xb142344c, 0x2633c38d, 0x9a4dad3f,
+    0x0d3c5afe, 0x4b636366, 0xdc1294a7, 0x606cfa15, 0xf71d0dd4,
+    0x1d7c5180, 0x8a0da641, 0x3673c8f3, 0xa1023f32, 0xbacdbbc3,
+    0x2dbc4c02, 0x91c222b0, 0x06b3d571, 0xecd28925, 0x7ba37ee4,
+    0xc7dd1056, 0x50ace797, 0x16f3de0f, 0x818229ce, 0x3dfc477c,
+    0xaa8db0bd, 0x40ecece9, 0xd79d1b28, 0x6be3759a, 0xfc92825b,
+    0x5c7c7c78, 0xcb0d8bb9, 0x7773e50b, 0xe00212ca, 0x0a634e9e,
+    0x9d12b95f, 0x216cd7ed, 0xb61d202c, 0xf04219b4, 0x6733ee75,
+    0xdb4d80c7, 0x4c3c7706, 0xa65d2b52, 0x312cdc93, 0x8d52b221,
+    0x1a2345e0, 0x01ecc111, 0x969d36d0, 0x2ae35862, 0xbd92afa3,
+    0x57f3f3f7, 0xc0820436, 0x7cfc6a84, 0xeb8d9d45, 0xadd2a4dd,
+    0x3aa3531c, 0x86dd3dae, 0x11acca6f, 0xfbcd963b, 0x6cbc61fa,
+    0xd0c20f48, 0x47b3f889, 0x94f385ff, 0x0382723e, 0xbffc1c8c,
+    0x288deb4d, 0xc2ecb719, 0x559d40d8, 0xe9e32e6a, 0x7e92d9ab,
+    0x38cde033, 0xafbc17f2, 0x13c27940, 0x84b38e81, 0x6ed2d2d5,
+    0xf9a32514, 0x45dd4ba6, 0xd2acbc67, 0xc9633896, 0x5e12cf57,
+    0xe26ca1e5, 0x751d5624, 0x9f7c0a70, 0x080dfdb1, 0xb4739303,
+    0x230264c2, 0x655d5d5a, 0xf22caa9b, 0x4e52c429, 0xd92333e8,
+    0x33426fbc, 0xa433987d, 0x184df6cf, 0x8f3c010e, 0x2fd2ff2d,
+    0xb8a308ec, 0x04dd665e, 0x93ac919f, 0x79cdcdcb, 0xeebc3a0a,
+    0x52c254b8, 0xc5b3a379, 0x83ec9ae1, 0x149d6d20, 0xa8e30392,
+    0x3f92f453, 0xd5f3a807, 0x42825fc6, 0xfefc3174, 0x698dc6b5,
+    0x72424244, 0xe533b585, 0x594ddb37, 0xce3c2cf6, 0x245d70a2,
+    0xb32c8763, 0x0f52e9d1, 0x98231e10, 0xde7c2788, 0x490dd049,
+    0xf573befb, 0x6202493a, 0x8863156e, 0x1f12e2af, 0xa36c8c1d,
+    0x341d7bdc},
+   {0x00000000, 0xcb567ba5, 0x934081bb, 0x5816fa1e, 0x236d7587,
+    0xe83b0e22, 0xb02df43c, 0x7b7b8f99, 0x46daeb0e, 0x8d8c90ab,
+    0xd59a6ab5, 0x1ecc1110, 0x65b79e89, 0xaee1e52c, 0xf6f71f32,
+    0x3da16497, 0x8db5d61c, 0x46e3adb9, 0x1ef557a7, 0xd5a32c02,
+    0xaed8a39b, 0x658ed83e, 0x3d982220, 0xf6ce5985, 0xcb6f3d12,
+    0x003946b7, 0x582fbca9, 0x9379c70c, 0xe8024895, 0x23543330,
+    0x7b42c92e, 0xb014b28b, 0x1e87dac9, 0xd5d1a16c, 0x8dc75b72,
+    0x469120d7, 0x3deaaf4e, 0xf6bcd4eb, 0xaeaa2ef5, 0x65fc5550,
+    0x585d31c7, 0x930b4a62, 0xcb1db07c, 0x004bcbd9, 0x7b304440,
+    0xb0663fe5, 0xe870c5fb, 0x2326be5e, 0x93320cd5, 0x58647770,
+    0x00728d6e, 0xcb24f6cb, 0xb05f7952, 0x7b0902f7, 0x231ff8e9,
+    0xe849834c, 0xd5e8e7db, 0x1ebe9c7e, 0x46a86660, 0x8dfe1dc5,
+    0xf685925c, 0x3dd3e9f9, 0x65c513e7, 0xae936842, 0x3d0fb592,
+    0xf659ce37, 0xae4f3429, 0x65194f8c, 0x1e62c015, 0xd534bbb0,
+    0x8d2241ae, 0x46743a0b, 0x7bd55e9c, 0xb0832539, 0xe895df27,
+    0x23c3a482, 0x58b82b1b, 0x93ee50be, 0xcbf8aaa0, 0x00aed105,
+    0xb0ba638e, 0x7bec182b, 0x23fae235, 0xe8ac9990, 0x93d71609,
+    0x58816dac, 0x009797b2, 0xcbc1ec17, 0xf6608880, 0x3d36f325,
+    0x6520093b, 0xae76729e, 0xd50dfd07, 0x1e5b86a2, 0x464d7cbc,
+    0x8d1b0719, 0x23886f5b, 0xe8de14fe, 0xb0c8eee0, 0x7b9e9545,
+    0x00e51adc, 0xcbb36179, 0x93a59b67, 0x58f3e0c2, 0x65528455,
+    0xae04fff0, 0xf61205ee, 0x3d447e4b, 0x463ff1d2, 0x8d698a77,
+    0xd57f7069, 0x1e290bcc, 0xae3db947, 0x656bc2e2, 0x3d7d38fc,
+    0xf62b4359, 0x8d50ccc0, 0x4606b765, 0x1e104d7b, 0xd54636de,
+    0xe8e75249, 0x23b129ec, 0x7ba7d3f2, 0xb0f1a857, 0xcb8a27ce,
+    0x00dc5c6b, 0x58caa675, 0x939cddd0, 0x7a1f6b24, 0xb1491081,
+    0xe95fea9f, 0x2209913a, 0x59721ea3, 0x92246506, 0xca329f18,
+    0x0164e4bd, 0x3cc5802a, 0xf793fb8f, 0xaf850191, 0x64d37a34,
+    0x1fa8f5ad, 0xd4fe8e08, 0x8ce87416, 0x47be0fb3, 0xf7aabd38,
+    0x3cfcc69d, 0x64ea3c83, 0xafbc4726, 0xd4c7c8bf, 0x1f91b31a,
+    0x47874904, 0x8cd132a1, 0xb1705636, 0x7a262d93, 0x2230d78d,
+    0xe966ac28, 0x921d23b1, 0x594b5814, 0x015da20a, 0xca0bd9af,
+    0x6498b1ed, 0xafceca48, 0xf7d83056, 0x3c8e4bf3, 0x47f5c46a,
+    0x8ca3bfcf, 0xd4b545d1, 0x1fe33e74, 0x22425ae3, 0xe9142146,
+    0xb102db58, 0x7a54a0fd, 0x012f2f64, 0xca7954c1, 0x926faedf,
+    0x5939d57a, 0xe92d67f1, 0x227b1c54, 0x7a6de64a, 0xb13b9def,
+    0xca401276, 0x011669d3, 0x590093cd, 0x9256e868, 0xaff78cff,
+    0x64a1f75a, 0x3cb70d44, 0xf7e176e1, 0x8c9af978, 0x47cc82dd,
+    0x1fda78c3, 0xd48c0366, 0x4710deb6, 0x8c46a513, 0xd4505f0d,
+    0x1f0624a8, 0x647dab31, 0xaf2bd094, 0xf73d2a8a, 0x3c6b512f,
+    0x01ca35b8, 0xca9c4e1d, 0x928ab403, 0x59dccfa6, 0x22a7403f,
+    0xe9f13b9a, 0xb1e7c184, 0x7ab1ba21, 0xcaa508aa, 0x01f3730f,
+    0x59e58911, 0x92b3f2b4, 0xe9c87d2d, 0x229e0688, 0x7a88fc96,
+    0xb1de8733, 0x8c7fe3a4, 0x47299801, 0x1f3f621f, 0xd46919ba,
+    0xaf129623, 0x6444ed86, 0x3c521798, 0xf7046c3d, 0x5997047f,
+    0x92c17fda, 0xcad785c4, 0x0181fe61, 0x7afa71f8, 0xb1ac0a5d,
+    0xe9baf043, 0x22ec8be6, 0x1f4def71, 0xd41b94d4, 0x8c0d6eca,
+    0x475b156f, 0x3c209af6, 0xf776e153, 0xaf601b4d, 0x643660e8,
+    0xd422d263, 0x1f74a9c6, 0x476253d8, 0x8c34287d, 0xf74fa7e4,
+    0x3c19dc41, 0x640f265f, 0xaf595dfa, 0x92f8396d, 0x59ae42c8,
+    0x01b8b8d6, 0xcaeec373, 0xb1954cea, 0x7ac3374f, 0x22d5cd51,
+    0xe983b6f4},
+   {0x00000000, 0xf43ed648, 0xed91da61, 0x19af0c29, 0xdecfc233,
+    0x2af1147b, 0x335e1852, 0xc760ce1a, 0xb873f297, 0x4c4d24df,
+    0x55e228f6, 0xa1dcfebe, 0x66bc30a4, 0x9282e6ec, 0x8b2deac5,
+    0x7f133c8d, 0x750b93df, 0x81354597, 0x989a49be, 0x6ca49ff6,
+    0xabc451ec, 0x5ffa87a4, 0x46558b8d, 0xb26b5dc5, 0xcd786148,
+    0x3946b700, 0x20e9bb29, 0xd4d76d61, 0x13b7a37b, 0xe7897533,
+    0xfe26791a, 0x0a18af52, 0xea1727be, 0x1e29f1f6, 0x0786fddf,
+    0xf3b82b97, 0x34d8e58d, 0xc0e633c5, 0xd9493fec, 0x2d77e9a4,
+    0x5264d529, 0xa65a0361, 0xbff50f48, 0x4bcbd900, 0x8cab171a,
+    0x7895c152, 0x613acd7b, 0x95041b33, 0x9f1cb461, 0x6b226229,
+    0x728d6e00, 0x86b3b848, 0x41d37652, 0xb5eda01a, 0xac42ac33,
+    0x587c7a7b, 0x276f46f6, 0xd35190be, 0xcafe9c97, 0x3ec04adf,
+    0xf9a084c5, 0x0d9e528d, 0x14315ea4, 0xe00f88ec, 0xd1c2398d,
+    0x25fcefc5, 0x3c53e3ec, 0xc86d35a4, 0x0f0dfbbe, 0xfb332df6,
+    0xe29c21df, 0x16a2f797, 0x69b1cb1a, 0x9d8f1d52, 0x8420117b,
+    0x701ec733, 0xb77e0929, 0x4340df61, 0x5aefd348, 0xaed10500,
+    0xa4c9aa52, 0x50f77c1a, 0x49587033, 0xbd66a67b, 0x7a066861,
+    0x8e38be29, 0x9797b200, 0x63a96448, 0x1cba58c5, 0xe8848e8d,
+    0xf12b82a4, 0x051554ec, 0xc2759af6, 0x364b4cbe, 0x2fe44097,
+    0xdbda96df, 0x3bd51e33, 0xcfebc87b, 0xd644c452, 0x227a121a,
+    0xe51adc00, 0x11240a48, 0x088b0661, 0xfcb5d029, 0x83a6eca4,
+    0x77983aec, 0x6e3736c5, 0x9a09e08d, 0x5d692e97, 0xa957f8df,
+    0xb0f8f4f6, 0x44c622be, 0x4ede8dec, 0xbae05ba4, 0xa34f578d,
+    0x577181c5, 0x90114fdf, 0x642f9997, 0x7d8095be, 0x89be43f6,
+    0xf6ad7f7b, 0x0293a933, 0x1b3ca51a, 0xef027352, 0x2862bd48,
+    0xdc5c6b00, 0xc5f36729, 0x31cdb161, 0xa66805eb, 0x5256d3a3,
+    0x4bf9df8a, 0xbfc709c2, 0x78a7c7d8, 0x8c991190, 0x95361db9,
+    0x6108cbf1, 0x1e1bf77c, 0xea252134, 0xf38a2d1d, 0x07b4fb55,
+    0xc0d4354f, 0x34eae307, 0x2d45ef2e, 0xd97b3966, 0xd3639634,
+    0x275d407c, 0x3ef24c55, 0xcacc9a1d, 0x0dac5407, 0xf992824f,
+    0xe03d8e66, 0x1403582e, 0x6b1064a3, 0x9f2eb2eb, 0x8681bec2,
+    0x72bf688a, 0xb5dfa690, 0x41e170d8, 0x584e7cf1, 0xac70aab9,
+    0x4c7f2255, 0xb841f41d, 0xa1eef834, 0x55d02e7c, 0x92b0e066,
+    0x668e362e, 0x7f213a07, 0x8b1fec4f, 0xf40cd0c2, 0x0032068a,
+    0x199d0aa3, 0xeda3dceb, 0x2ac312f1, 0xdefdc4b9, 0xc752c890,
+    0x336c1ed8, 0x3974b18a, 0xcd4a67c2, 0xd4e56beb, 0x20dbbda3,
+    0xe7bb73b9, 0x1385a5f1, 0x0a2aa9d8, 0xfe147f90, 0x8107431d,
+    0x75399555, 0x6c96997c, 0x98a84f34, 0x5fc8812e, 0xabf65766,
+    0xb2595b4f, 0x46678d07, 0x77aa3c66, 0x8394ea2e, 0x9a3be607,
+    0x6e05304f, 0xa965fe55, 0x5d5b281d, 0x44f42434, 0xb0caf27c,
+    0xcfd9cef1, 0x3be718b9, 0x22481490, 0xd676c2d8, 0x11160cc2,
+    0xe528da8a, 0xfc87d6a3, 0x08b900eb, 0x02a1afb9, 0xf69f79f1,
+    0xef3075d8, 0x1b0ea390, 0xdc6e6d8a, 0x2850bbc2, 0x31ffb7eb,
+    0xc5c161a3, 0xbad25d2e, 0x4eec8b66, 0x5743874f, 0xa37d5107,
+    0x641d9f1d, 0x90234955, 0x898c457c, 0x7db29334, 0x9dbd1bd8,
+    0x6983cd90, 0x702cc1b9, 0x841217f1, 0x4372d9eb, 0xb74c0fa3,
+    0xaee3038a, 0x5addd5c2, 0x25cee94f, 0xd1f03f07, 0xc85f332e,
+    0x3c61e566, 0xfb012b7c, 0x0f3ffd34, 0x1690f11d, 0xe2ae2755,
+    0xe8b68807, 0x1c885e4f, 0x05275266, 0xf119842e, 0x36794a34,
+    0xc2479c7c, 0xdbe89055, 0x2fd6461d, 0x50c57a90, 0xa4fbacd8,
+    0xbd54a0f1, 0x496a76b9, 0x8e0ab8a3, 0x7a346eeb, 0x639b62c2,
+    0x97a5b48a}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0x48d63ef4, 0x61da91ed, 0x290caf19, 0x33c2cfde,
+    0x7b14f12a, 0x52185e33, 0x1ace60c7, 0x97f273b8, 0xdf244d4c,
+    0xf628e255, 0xbefedca1, 0xa430bc66, 0xece68292, 0xc5ea2d8b,
+    0x8d3c137f, 0xdf930b75, 0x97453581, 0xbe499a98, 0xf69fa46c,
+    0xec51c4ab, 0xa487fa5f, 0x8d8b5546, 0xc55d6bb2, 0x486178cd,
+    0x00b74639, 0x29bbe920, 0x616dd7d4, 0x7ba3b713, 0x337589e7,
+    0x1a7926fe, 0x52af180a, 0xbe2717ea, 0xf6f1291e, 0xdffd8607,
+    0x972bb8f3, 0x8de5d834, 0xc533e6c0, 0xec3f49d9, 0xa4e9772d,
+    0x29d56452, 0x61035aa6, 0x480ff5bf, 0x00d9cb4b, 0x1a17ab8c,
+    0x52c19578, 0x7bcd3a61, 0x331b0495, 0x61b41c9f, 0x2962226b,
+    0x006e8d72, 0x48b8b386, 0x5276d341, 0x1aa0edb5, 0x33ac42ac,
+    0x7b7a7c58, 0xf6466f27, 0xbe9051d3, 0x979cfeca, 0xdf4ac03e,
+    0xc584a0f9, 0x8d529e0d, 0xa45e3114, 0xec880fe0, 0x8d39c2d1,
+    0xc5effc25, 0xece3533c, 0xa4356dc8, 0xbefb0d0f, 0xf62d33fb,
+    0xdf219ce2, 0x97f7a216, 0x1acbb169, 0x521d8f9d, 0x7b112084,
+    0x33c71e70, 0x29097eb7, 0x61df4043, 0x48d3ef5a, 0x0005d1ae,
+    0x52aac9a4, 0x1a7cf750, 0x33705849, 0x7ba666bd, 0x6168067a,
+    0x29be388e, 0x00b29797, 0x4864a963, 0xc558ba1c, 0x8d8e84e8,
+    0xa4822bf1, 0xec541505, 0xf69a75c2, 0xbe4c4b36, 0x9740e42f,
+    0xdf96dadb, 0x331ed53b, 0x7bc8ebcf, 0x52c444d6, 0x1a127a22,
+    0x00dc1ae5, 0x480a2411, 0x61068b08, 0x29d0b5fc, 0xa4eca683,
+    0xec3a9877, 0xc536376e, 0x8de0099a, 0x972e695d, 0xdff857a9,
+    0xf6f4f8b0, 0xbe22c644, 0xec8dde4e, 0xa45be0ba, 0x8d574fa3,
+    0xc5817157, 0xdf4f1190, 0x97992f64, 0xbe95807d, 0xf643be89,
+    0x7b7fadf6, 0x33a99302, 0x1aa53c1b, 0x527302ef, 0x48bd6228,
+    0x006b5cdc, 0x2967f3c5, 0x61b1cd31, 0xeb0568a6, 0xa3d35652,
+    0x8adff94b, 0xc209c7bf, 0xd8c7a778, 0x9011998c, 0xb91d3695,
+    0xf1cb0861, 0x7cf71b1e, 0x342125ea, 0x1d2d8af3, 0x55fbb407,
+    0x4f35d4c0, 0x07e3ea34, 0x2eef452d, 0x66397bd9, 0x349663d3,
+    0x7c405d27, 0x554cf23e, 0x1d9accca, 0x0754ac0d, 0x4f8292f9,
+    0x668e3de0, 0x2e580314, 0xa364106b, 0xebb22e9f, 0xc2be8186,
+    0x8a68bf72, 0x90a6dfb5, 0xd870e141, 0xf17c4e58, 0xb9aa70ac,
+    0x55227f4c, 0x1df441b8, 0x34f8eea1, 0x7c2ed055, 0x66e0b092,
+    0x2e368e66, 0x073a217f, 0x4fec1f8b, 0xc2d00cf4, 0x8a063200,
+    0xa30a9d19, 0xebdca3ed, 0xf112c32a, 0xb9c4fdde, 0x90c852c7,
+    0xd81e6c33, 0x8ab17439, 0xc2674acd, 0xeb6be5d4, 0xa3bddb20,
+    0xb973bbe7, 0xf1a58513, 0xd8a92a0a, 0x907f14fe, 0x1d430781,
+    0x55953975, 0x7c99966c, 0x344fa898, 0x2e81c85f, 0x6657f6ab,
+    0x4f5b59b2, 0x078d6746, 0x663caa77, 0x2eea9483, 0x07e63b9a,
+    0x4f30056e, 0x55fe65a9, 0x1d285b5d, 0x3424f444, 0x7cf2cab0,
+    0xf1ced9cf, 0xb918e73b, 0x90144822, 0xd8c276d6, 0xc20c1611,
+    0x8ada28e5, 0xa3d687fc, 0xeb00b908, 0xb9afa102, 0xf1799ff6,
+    0xd87530ef, 0x90a30e1b, 0x8a6d6edc, 0xc2bb5028, 0xebb7ff31,
+    0xa361c1c5, 0x2e5dd2ba, 0x668bec4e, 0x4f874357, 0x07517da3,
+    0x1d9f1d64, 0x55492390, 0x7c458c89, 0x3493b27d, 0xd81bbd9d,
+    0x90cd8369, 0xb9c12c70, 0xf1171284, 0xebd97243, 0xa30f4cb7,
+    0x8a03e3ae, 0xc2d5dd5a, 0x4fe9ce25, 0x073ff0d1, 0x2e335fc8,
+    0x66e5613c, 0x7c2b01fb, 0x34fd3f0f, 0x1df19016, 0x5527aee2,
+    0x0788b6e8, 0x4f5e881c, 0x66522705, 0x2e8419f1, 0x344a7936,
+    0x7c9c47c2, 0x5590e8db, 0x1d46d62f, 0x907ac550, 0xd8acfba4,
+    0xf1a054bd, 0xb9766a49, 0xa3b80a8e, 0xeb6e347a, 0xc2629b63,
+    0x8ab4a597},
+   {0x00000000, 0xa57b56cb, 0xbb814093, 0x1efa1658, 0x87756d23,
+    0x220e3be8, 0x3cf42db0, 0x998f7b7b, 0x0eebda46, 0xab908c8d,
+    0xb56a9ad5, 0x1011cc1e, 0x899eb765, 0x2ce5e1ae, 0x321ff7f6,
+    0x9764a13d, 0x1cd6b58d, 0xb9ade346, 0xa757f51e, 0x022ca3d5,
+    0x9ba3d8ae, 0x3ed88e65, 0x2022983d, 0x8559cef6, 0x123d6fcb,
+    0xb7463900, 0xa9bc2f58, 0x0cc77993, 0x954802e8, 0x30335423,
+    0x2ec9427b, 0x8bb214b0, 0xc9da871e, 0x6ca1d1d5, 0x725bc78d,
+    0xd7209146, 0x4eafea3d, 0xebd4bcf6, 0xf52eaaae, 0x5055fc65,
+    0xc7315d58, 0x624a0b93, 0x7cb01dcb, 0xd9cb4b00, 0x4044307b,
+    0xe53f66b0, 0xfbc570e8, 0x5ebe2623, 0xd50c3293, 0x70776458,
+    0x6e8d7200, 0xcbf624cb, 0x52795fb0, 0xf702097b, 0xe9f81f23,
+    0x4c8349e8, 0xdbe7e8d5, 0x7e9cbe1e, 0x6066a846, 0xc51dfe8d,
+    0x5c9285f6, 0xf9e9d33d, 0xe713c565, 0x426893ae, 0x92b50f3d,
+    0x37ce59f6, 0x29344fae, 0x8c4f1965, 0x15c0621e, 0xb0bb34d5,
+    0xae41228d, 0x0b3a7446, 0x9c5ed57b, 0x392583b0, 0x27df95e8,
+    0x82a4c323, 0x1b2bb858, 0xbe50ee93, 0xa0aaf8cb, 0x05d1ae00,
+    0x8e63bab0, 0x2b18ec7b, 0x35e2fa23, 0x9099ace8, 0x0916d793,
+    0xac6d8158, 0xb2979700, 0x17ecc1cb, 0x808860f6, 0x25f3363d,
+    0x3b092065, 0x9e7276ae, 0x07fd0dd5, 0xa2865b1e, 0xbc7c4d46,
+    0x19071b8d, 0x5b6f8823, 0xfe14dee8, 0xe0eec8b0, 0x45959e7b,
+    0xdc1ae500, 0x7961b3cb, 0x679ba593, 0xc2e0f358, 0x55845265,
+    0xf0ff04ae, 0xee0512f6, 0x4b7e443d, 0xd2f13f46, 0x778a698d,
+    0x69707fd5, 0xcc0b291e, 0x47b93dae, 0xe2c26b65, 0xfc387d3d,
+    0x59432bf6, 0xc0cc508d, 0x65b70646, 0x7b4d101e, 0xde3646d5,
+    0x4952e7e8, 0xec29b123, 0xf2d3a77b, 0x57a8f1b0, 0xce278acb,
+    0x6b5cdc00, 0x75a6ca58, 0xd0dd9c93, 0x246b1f7a, 0x811049b1,
+    0x9fea5fe9, 0x3a910922, 0xa31e7259, 0x06652492, 0x189f32ca,
+    0xbde46401, 0x2a80c53c, 0x8ffb93f7, 0x910185af, 0x347ad364,
+    0xadf5a81f, 0x088efed4, 0x1674e88c, 0xb30fbe47, 0x38bdaaf7,
+    0x9dc6fc3c, 0x833cea64, 0x2647bcaf, 0xbfc8c7d4, 0x1ab3911f,
+    0x04498747, 0xa132d18c, 0x365670b1, 0x932d267a, 0x8dd73022,
+    0x28ac66e9, 0xb1231d92, 0x14584b59, 0x0aa25d01, 0xafd90bca,
+    0xedb19864, 0x48caceaf, 0x5630d8f7, 0xf34b8e3c, 0x6ac4f547,
+    0xcfbfa38c, 0xd145b5d4, 0x743ee31f, 0xe35a4222, 0x462114e9,
+    0x58db02b1, 0xfda0547a, 0x642f2f01, 0xc15479ca, 0xdfae6f92,
+    0x7ad53959, 0xf1672de9, 0x541c7b22, 0x4ae66d7a, 0xef9d3bb1,
+    0x761240ca, 0xd3691601, 0xcd930059, 0x68e85692, 0xff8cf7af,
+    0x5af7a164, 0x440db73c, 0xe176e1f7, 0x78f99a8c, 0xdd82cc47,
+    0xc378da1f, 0x66038cd4, 0xb6de1047, 0x13a5468c, 0x0d5f50d4,
+    0xa824061f, 0x31ab7d64, 0x94d02baf, 0x8a2a3df7, 0x2f516b3c,
+    0xb835ca01, 0x1d4e9cca, 0x03b48a92, 0xa6cfdc59, 0x3f40a722,
+    0x9a3bf1e9, 0x84c1e7b1, 0x21bab17a, 0xaa08a5ca, 0x0f73f301,
+    0x1189e559, 0xb4f2b392, 0x2d7dc8e9, 0x88069e22, 0x96fc887a,
+    0x3387deb1, 0xa4e37f8c, 0x01982947, 0x1f623f1f, 0xba1969d4,
+    0x239612af, 0x86ed4464, 0x9817523c, 0x3d6c04f7, 0x7f049759,
+    0xda7fc192, 0xc485d7ca, 0x61fe8101, 0xf871fa7a, 0x5d0aacb1,
+    0x43f0bae9, 0xe68bec22, 0x71ef4d1f, 0xd4941bd4, 0xca6e0d8c,
+    0x6f155b47, 0xf69a203c, 0x53e176f7, 0x4d1b60af, 0xe8603664,
+    0x63d222d4, 0xc6a9741f, 0xd8536247, 0x7d28348c, 0xe4a74ff7,
+    0x41dc193c, 0x5f260f64, 0xfa5d59af, 0x6d39f892, 0xc842ae59,
+    0xd6b8b801, 0x73c3eeca, 0xea4c95b1, 0x4f37c37a, 0x51cdd522,
+    0xf4b683e9},
+   {0x00000000, 0xc1f77197, 0x73990f2b, 0xb26e7ebc, 0xe6321f56,
+    0x27c56ec1, 0x95ab107d, 0x545c61ea, 0xcc653eac, 0x0d924f3b,
+    0xbffc3187, 0x7e0b4010, 0x2a5721fa, 0xeba0506d, 0x59ce2ed1,
+    0x98395f46, 0x69bd905d, 0xa84ae1ca, 0x1a249f76, 0xdbd3eee1,
+    0x8f8f8f0b, 0x4e78fe9c, 0xfc168020, 0x3de1f1b7, 0xa5d8aef1,
+    0x642fdf66, 0xd641a1da, 0x17b6d04d, 0x43eab1a7, 0x821dc030,
+    0x3073be8c, 0xf184cf1b, 0xd27a21bb, 0x138d502c, 0xa1e32e90,
+    0x60145f07, 0x34483eed, 0xf5bf4f7a, 0x47d131c6, 0x86264051,
+    0x1e1f1f17, 0xdfe86e80, 0x6d86103c, 0xac7161ab, 0xf82d0041,
+    0x39da71d6, 0x8bb40f6a, 0x4a437efd, 0xbbc7b1e6, 0x7a30c071,
+    0xc85ebecd, 0x09a9cf5a, 0x5df5aeb0, 0x9c02df27, 0x2e6ca19b,
+    0xef9bd00c, 0x77a28f4a, 0xb655fedd, 0x043b8061, 0xc5ccf1f6,
+    0x9190901c, 0x5067e18b, 0xe2099f37, 0x23feeea0, 0x5583ae73,
+    0x9474dfe4, 0x261aa158, 0xe7edd0cf, 0xb3b1b125, 0x7246c0b2,
+    0xc028be0e, 0x01dfcf99, 0x99e690df, 0x5811e148, 0xea7f9ff4,
+    0x2b88ee63, 0x7fd48f89, 0xbe23fe1e, 0x0c4d80a2, 0xcdbaf135,
+    0x3c3e3e2e, 0xfdc94fb9, 0x4fa73105, 0x8e504092, 0xda0c2178,
+    0x1bfb50ef, 0xa9952e53, 0x68625fc4, 0xf05b0082, 0x31ac7115,
+    0x83c20fa9, 0x42357e3e, 0x16691fd4, 0xd79e6e43, 0x65f010ff,
+    0xa4076168, 0x87f98fc8, 0x460efe5f, 0xf46080e3, 0x3597f174,
+    0x61cb909e, 0xa03ce109, 0x12529fb5, 0xd3a5ee22, 0x4b9cb164,
+    0x8a6bc0f3, 0x3805be4f, 0xf9f2cfd8, 0xadaeae32, 0x6c59dfa5,
+    0xde37a119, 0x1fc0d08e, 0xee441f95, 0x2fb36e02, 0x9ddd10be,
+    0x5c2a6129, 0x087600c3, 0xc9817154, 0x7bef0fe8, 0xba187e7f,
+    0x22212139, 0xe3d650ae, 0x51b82e12, 0x904f5f85, 0xc4133e6f,
+    0x05e44ff8, 0xb78a3144, 0x767d40d3, 0xaa065de7, 0x6bf12c70,
+    0xd99f52cc, 0x1868235b, 0x4c3442b1, 0x8dc33326, 0x3fad4d9a,
+    0xfe5a3c0d, 0x6663634b, 0xa79412dc, 0x15fa6c60, 0xd40d1df7,
+    0x80517c1d, 0x41a60d8a, 0xf3c87336, 0x323f02a1, 0xc3bbcdba,
+    0x024cbc2d, 0xb022c291, 0x71d5b306, 0x2589d2ec, 0xe47ea37b,
+    0x5610ddc7, 0x97e7ac50, 0x0fdef316, 0xce298281, 0x7c47fc3d,
+    0xbdb08daa, 0xe9ecec40, 0x281b9dd7, 0x9a75e36b, 0x5b8292fc,
+    0x787c7c5c, 0xb98b0dcb, 0x0be57377, 0xca1202e0, 0x9e4e630a,
+    0x5fb9129d, 0xedd76c21, 0x2c201db6, 0xb41942f0, 0x75ee3367,
+    0xc7804ddb, 0x06773c4c, 0x522b5da6, 0x93dc2c31, 0x21b2528d,
+    0xe045231a, 0x11c1ec01, 0xd0369d96, 0x6258e32a, 0xa3af92bd,
+    0xf7f3f357, 0x360482c0, 0x846afc7c, 0x459d8deb, 0xdda4d2ad,
+    0x1c53a33a, 0xae3ddd86, 0x6fcaac11, 0x3b96cdfb, 0xfa61bc6c,
+    0x480fc2d0, 0x89f8b347, 0xff85f394, 0x3e728203, 0x8c1cfcbf,
+    0x4deb8d28, 0x19b7ecc2, 0xd8409d55, 0x6a2ee3e9, 0xabd9927e,
+    0x33e0cd38, 0xf217bcaf, 0x4079c213, 0x818eb384, 0xd5d2d26e,
+    0x1425a3f9, 0xa64bdd45, 0x67bcacd2, 0x963863c9, 0x57cf125e,
+    0xe5a16ce2, 0x24561d75, 0x700a7c9f, 0xb1fd0d08, 0x039373b4,
+    0xc2640223, 0x5a5d5d65, 0x9baa2cf2, 0x29c4524e, 0xe83323d9,
+    0xbc6f4233, 0x7d9833a4, 0xcff64d18, 0x0e013c8f, 0x2dffd22f,
+    0xec08a3b8, 0x5e66dd04, 0x9f91ac93, 0xcbcdcd79, 0x0a3abcee,
+    0xb854c252, 0x79a3b3c5, 0xe19aec83, 0x206d9d14, 0x9203e3a8,
+    0x53f4923f, 0x07a8f3d5, 0xc65f8242, 0x7431fcfe, 0xb5c68d69,
+    0x44424272, 0x85b533e5, 0x37db4d59, 0xf62c3cce, 0xa2705d24,
+    0x63872cb3, 0xd1e9520f, 0x101e2398, 0x88277cde, 0x49d00d49,
+    0xfbbe73f5, 0x3a490262, 0x6e156388, 0xafe2121f, 0x1d8c6ca3,
+    0xdc7b1d34},
+   {0x00000000, 0x30d47131, 0x60a8e362, 0x507c9253, 0xc050c7c5,
+    0xf084b6f4, 0xa0f824a7, 0x902c5596, 0x71d7628e, 0x410313bf,
+    0x117f81ec, 0x21abf0dd, 0xb187a54b, 0x8153d47a, 0xd12f4629,
+    0xe1fb3718, 0x13d82919, 0x230c5828, 0x7370ca7b, 0x43a4bb4a,
+    0xd388eedc, 0xe35c9fed, 0xb3200dbe, 0x83f47c8f, 0x620f4b97,
+    0x52db3aa6, 0x02a7a8f5, 0x3273d9c4, 0xa25f8c52, 0x928bfd63,
+    0xc2f76f30, 0xf2231e01, 0x26b05332, 0x16642203, 0x4618b050,
+    0x76ccc161, 0xe6e094f7, 0xd634e5c6, 0x86487795, 0xb69c06a4,
+    0x576731bc, 0x67b3408d, 0x37cfd2de, 0x071ba3ef, 0x9737f679,
+    0xa7e38748, 0xf79f151b, 0xc74b642a, 0x35687a2b, 0x05bc0b1a,
+    0x55c09949, 0x6514e878, 0xf538bdee, 0xc5ecccdf, 0x95905e8c,
+    0xa5442fbd, 0x44bf18a5, 0x746b6994, 0x2417fbc7, 0x14c38af6,
+    0x84efdf60, 0xb43bae51, 0xe4473c02, 0xd4934d33, 0x4c60a764,
+    0x7cb4d655, 0x2cc84406, 0x1c1c3537, 0x8c3060a1, 0xbce41190,
+    0xec9883c3, 0xdc4cf2f2, 0x3db7c5ea, 0x0d63b4db, 0x5d1f2688,
+    0x6dcb57b9, 0xfde7022f, 0xcd33731e, 0x9d4fe14d, 0xad9b907c,
+    0x5fb88e7d, 0x6f6cff4c, 0x3f106d1f, 0x0fc41c2e, 0x9fe849b8,
+    0xaf3c3889, 0xff40aada, 0xcf94dbeb, 0x2e6fecf3, 0x1ebb9dc2,
+    0x4ec70f91, 0x7e137ea0, 0xee3f2b36, 0xdeeb5a07, 0x8e97c854,
+    0xbe43b965, 0x6ad0f456, 0x5a048567, 0x0a781734, 0x3aac6605,
+    0xaa803393, 0x9a5442a2, 0xca28d0f1, 0xfafca1c0, 0x1b0796d8,
+    0x2bd3e7e9, 0x7baf75ba, 0x4b7b048b, 0xdb57511d, 0xeb83202c,
+    0xbbffb27f, 0x8b2bc34e, 0x7908dd4f, 0x49dcac7e, 0x19a03e2d,
+    0x29744f1c, 0xb9581a8a, 0x898c6bbb, 0xd9f0f9e8, 0xe92488d9,
+    0x08dfbfc1, 0x380bcef0, 0x68775ca3, 0x58a32d92, 0xc88f7804,
+    0xf85b0935, 0xa8279b66, 0x98f3ea57, 0x98c04ec9, 0xa8143ff8,
+    0xf868adab, 0xc8bcdc9a, 0x5890890c, 0x6844f83d, 0x38386a6e,
+    0x08ec1b5f, 0xe9172c47, 0xd9c35d76, 0x89bfcf25, 0xb96bbe14,
+    0x2947eb82, 0x19939ab3, 0x49ef08e0, 0x793b79d1, 0x8b1867d0,
+    0xbbcc16e1, 0xebb084b2, 0xdb64f583, 0x4b48a015, 0x7b9cd124,
+    0x2be04377, 0x1b343246, 0xfacf055e, 0xca1b746f, 0x9a67e63c,
+    0xaab3970d, 0x3a9fc29b, 0x0a4bb3aa, 0x5a3721f9, 0x6ae350c8,
+    0xbe701dfb, 0x8ea46cca, 0xded8fe99, 0xee0c8fa8, 0x7e20da3e,
+    0x4ef4ab0f, 0x1e88395c, 0x2e5c486d, 0xcfa77f75, 0xff730e44,
+    0xaf0f9c17, 0x9fdbed26, 0x0ff7b8b0, 0x3f23c981, 0x6f5f5bd2,
+    0x5f8b2ae3, 0xada834e2, 0x9d7c45d3, 0xcd00d780, 0xfdd4a6b1,
+    0x6df8f327, 0x5d2c8216, 0x0d501045, 0x3d846174, 0xdc7f566c,
+    0xecab275d, 0xbcd7b50e, 0x8c03c43f, 0x1c2f91a9, 0x2cfbe098,
+    0x7c8772cb, 0x4c5303fa, 0xd4a0e9ad, 0xe474989c, 0xb4080acf,
+    0x84dc7bfe, 0x14f02e68, 0x24245f59, 0x7458cd0a, 0x448cbc3b,
+    0xa5778b23, 0x95a3fa12, 0xc5df6841, 0xf50b1970, 0x65274ce6,
+    0x55f33dd7, 0x058faf84, 0x355bdeb5, 0xc778c0b4, 0xf7acb185,
+    0xa7d023d6, 0x970452e7, 0x07280771, 0x37fc7640, 0x6780e413,
+    0x57549522, 0xb6afa23a, 0x867bd30b, 0xd6074158, 0xe6d33069,
+    0x76ff65ff, 0x462b14ce, 0x1657869d, 0x2683f7ac, 0xf210ba9f,
+    0xc2c4cbae, 0x92b859fd, 0xa26c28cc, 0x32407d5a, 0x02940c6b,
+    0x52e89e38, 0x623cef09, 0x83c7d811, 0xb313a920, 0xe36f3b73,
+    0xd3bb4a42, 0x43971fd4, 0x73436ee5, 0x233ffcb6, 0x13eb8d87,
+    0xe1c89386, 0xd11ce2b7, 0x816070e4, 0xb1b401d5, 0x21985443,
+    0x114c2572, 0x4130b721, 0x71e4c610, 0x901ff108, 0xa0cb8039,
+    0xf0b7126a, 0xc063635b, 0x504f36cd, 0x609b47fc, 0x30e7d5af,
+    0x0033a49e}};
+
+#endif /* W */
+
+#endif /* N == 3 */
+#if N == 4
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x3da6d0cb, 0x7b4da196, 0x46eb715d, 0xf69b432c,
+    0xcb3d93e7, 0x8dd6e2ba, 0xb0703271, 0xe8daf0a9, 0xd57c2062,
+    0x9397513f, 0xae3181f4, 0x1e41b385, 0x23e7634e, 0x650c1213,
+    0x58aac2d8, 0xd45997a3, 0xe9ff4768, 0xaf143635, 0x92b2e6fe,
+    0x22c2d48f, 0x1f640444, 0x598f7519, 0x6429a5d2, 0x3c83670a,
+    0x0125b7c1, 0x47cec69c, 0x7a681657, 0xca182426, 0xf7bef4ed,
+    0xb15585b0, 0x8cf3557b, 0xad5f59b7, 0x90f9897c, 0xd612f821,
+    0xebb428ea, 0x5bc41a9b, 0x6662ca50, 0x2089bb0d, 0x1d2f6bc6,
+    0x4585a91e, 0x782379d5, 0x3ec80888, 0x036ed843, 0xb31eea32,
+    0x8eb83af9, 0xc8534ba4, 0xf5f59b6f, 0x7906ce14, 0x44a01edf,
+    0x024b6f82, 0x3fedbf49, 0x8f9d8d38, 0xb23b5df3, 0xf4d02cae,
+    0xc976fc65, 0x91dc3ebd, 0xac7aee76, 0xea919f2b, 0xd7374fe0,
+    0x67477d91, 0x5ae1ad5a, 0x1c0adc07, 0x21ac0ccc, 0x5f52c59f,
+    0x62f41554, 0x241f6409, 0x19b9b4c2, 0xa9c986b3, 0x946f5678,
+    0xd2842725, 0xef22f7ee, 0xb7883536, 0x8a2ee5fd, 0xccc594a0,
+    0xf163446b, 0x4113761a, 0x7cb5a6d1, 0x3a5ed78c, 0x07f80747,
+    0x8b0b523c, 0xb6ad82f7, 0xf046f3aa, 0xcde02361, 0x7d901110,
+    0x4036c1db, 0x06ddb086, 0x3b7b604d, 0x63d1a295, 0x5e77725e,
+    0x189c0303, 0x253ad3c8, 0x954ae1b9, 0xa8ec3172, 0xee07402f,
+    0xd3a190e4, 0xf20d9c28, 0xcfab4ce3, 0x89403dbe, 0xb4e6ed75,
+    0x0496df04, 0x39300fcf, 0x7fdb7e92, 0x427dae59, 0x1ad76c81,
+    0x2771bc4a, 0x619acd17, 0x5c3c1ddc, 0xec4c2fad, 0xd1eaff66,
+    0x97018e3b, 0xaaa75ef0, 0x26540b8b, 0x1bf2db40, 0x5d19aa1d,
+    0x60bf7ad6, 0xd0cf48a7, 0xed69986c, 0xab82e931, 0x962439fa,
+    0xce8efb22, 0xf3282be9, 0xb5c35ab4, 0x88658a7f, 0x3815b80e,
+    0x05b368c5, 0x43581998, 0x7efec953, 0xbea58b3e, 0x83035bf5,
+    0xc5e82aa8, 0xf84efa63, 0x483ec812, 0x759818d9, 0x33736984,
+    0x0ed5b94f, 0x567f7b97, 0x6bd9ab5c, 0x2d32da01, 0x10940aca,
+    0xa0e438bb, 0x9d42e870, 0xdba9992d, 0xe60f49e6, 0x6afc1c9d,
+    0x575acc56, 0x11b1bd0b, 0x2c176dc0, 0x9c675fb1, 0xa1c18f7a,
+    0xe72afe27, 0xda8c2eec, 0x8226ec34, 0xbf803cff, 0xf96b4da2,
+    0xc4cd9d69, 0x74bdaf18, 0x491b7fd3, 0x0ff00e8e, 0x3256de45,
+    0x13fad289, 0x2e5c0242, 0x68b7731f, 0x5511a3d4, 0xe56191a5,
+    0xd8c7416e, 0x9e2c3033, 0xa38ae0f8, 0xfb202220, 0xc686f2eb,
+    0x806d83b6, 0xbdcb537d, 0x0dbb610c, 0x301db1c7, 0x76f6c09a,
+    0x4b501051, 0xc7a3452a, 0xfa0595e1, 0xbceee4bc, 0x81483477,
+    0x31380606, 0x0c9ed6cd, 0x4a75a790, 0x77d3775b, 0x2f79b583,
+    0x12df6548, 0x54341415, 0x6992c4de, 0xd9e2f6af, 0xe4442664,
+    0xa2af5739, 0x9f0987f2, 0xe1f74ea1, 0xdc519e6a, 0x9abaef37,
+    0xa71c3ffc, 0x176c0d8d, 0x2acadd46, 0x6c21ac1b, 0x51877cd0,
+    0x092dbe08, 0x348b6ec3, 0x72601f9e, 0x4fc6cf55, 0xffb6fd24,
+    0xc2102def, 0x84fb5cb2, 0xb95d8c79, 0x35aed902, 0x080809c9,
+    0x4ee37894, 0x7345a85f, 0xc3359a2e, 0xfe934ae5, 0xb8783bb8,
+    0x85deeb73, 0xdd7429ab, 0xe0d2f960, 0xa639883d, 0x9b9f58f6,
+    0x2bef6a87, 0x1649ba4c, 0x50a2cb11, 0x6d041bda, 0x4ca81716,
+    0x710ec7dd, 0x37e5b680, 0x0a43664b, 0xba33543a, 0x879584f1,
+    0xc17ef5ac, 0xfcd82567, 0xa472e7bf, 0x99d43774, 0xdf3f4629,
+    0xe29996e2, 0x52e9a493, 0x6f4f7458, 0x29a40505, 0x1402d5ce,
+    0x98f180b5, 0xa557507e, 0xe3bc2123, 0xde1af1e8, 0x6e6ac399,
+    0x53cc1352, 0x1527620f, 0x2881b2c4, 0x702b701c, 0x4d8da0d7,
+    0x0b66d18a, 0x36c00141, 0x86b03330, 0xbb16e3fb, 0xfdfd92a6,
+    0xc05b426d},
+   {0x00000000, 0x78a7608d, 0xf14ec11a, 0x89e9a197, 0xe771f4c5,
+    0x9fd69448, 0x163f35df, 0x6e985552, 0xcb0f9f7b, 0xb3a8fff6,
+    0x3a415e61, 0x42e63eec, 0x2c7e6bbe, 0x54d90b33, 0xdd30aaa4,
+    0xa597ca29, 0x93f34807, 0xeb54288a, 0x62bd891d, 0x1a1ae990,
+    0x7482bcc2, 0x0c25dc4f, 0x85cc7dd8, 0xfd6b1d55, 0x58fcd77c,
+    0x205bb7f1, 0xa9b21666, 0xd11576eb, 0xbf8d23b9, 0xc72a4334,
+    0x4ec3e2a3, 0x3664822e, 0x220ae6ff, 0x5aad8672, 0xd34427e5,
+    0xabe34768, 0xc57b123a, 0xbddc72b7, 0x3435d320, 0x4c92b3ad,
+    0xe9057984, 0x91a21909, 0x184bb89e, 0x60ecd813, 0x0e748d41,
+    0x76d3edcc, 0xff3a4c5b, 0x879d2cd6, 0xb1f9aef8, 0xc95ece75,
+    0x40b76fe2, 0x38100f6f, 0x56885a3d, 0x2e2f3ab0, 0xa7c69b27,
+    0xdf61fbaa, 0x7af63183, 0x0251510e, 0x8bb8f099, 0xf31f9014,
+    0x9d87c546, 0xe520a5cb, 0x6cc9045c, 0x146e64d1, 0x4415cdfe,
+    0x3cb2ad73, 0xb55b0ce4, 0xcdfc6c69, 0xa364393b, 0xdbc359b6,
+    0x522af821, 0x2a8d98ac, 0x8f1a5285, 0xf7bd3208, 0x7e54939f,
+    0x06f3f312, 0x686ba640, 0x10ccc6cd, 0x9925675a, 0xe18207d7,
+    0xd7e685f9, 0xaf41e574, 0x26a844e3, 0x5e0f246e, 0x3097713c,
+    0x483011b1, 0xc1d9b026, 0xb97ed0ab, 0x1ce91a82, 0x644e7a0f,
+    0xeda7db98, 0x9500bb15, 0xfb98ee47, 0x833f8eca, 0x0ad62f5d,
+    0x72714fd0, 0x661f2b01, 0x1eb84b8c, 0x9751ea1b, 0xeff68a96,
+    0x816edfc4, 0xf9c9bf49, 0x70201ede, 0x08877e53, 0xad10b47a,
+    0xd5b7d4f7, 0x5c5e7560, 0x24f915ed, 0x4a6140bf, 0x32c62032,
+    0xbb2f81a5, 0xc388e128, 0xf5ec6306, 0x8d4b038b, 0x04a2a21c,
+    0x7c05c291, 0x129d97c3, 0x6a3af74e, 0xe3d356d9, 0x9b743654,
+    0x3ee3fc7d, 0x46449cf0, 0xcfad3d67, 0xb70a5dea, 0xd99208b8,
+    0xa1356835, 0x28dcc9a2, 0x507ba92f, 0x882b9bfc, 0xf08cfb71,
+    0x79655ae6, 0x01c23a6b, 0x6f5a6f39, 0x17fd0fb4, 0x9e14ae23,
+    0xe6b3ceae, 0x43240487, 0x3b83640a, 0xb26ac59d, 0xcacda510,
+    0xa455f042, 0xdcf290cf, 0x551b3158, 0x2dbc51d5, 0x1bd8d3fb,
+    0x637fb376, 0xea9612e1, 0x9231726c, 0xfca9273e, 0x840e47b3,
+    0x0de7e624, 0x754086a9, 0xd0d74c80, 0xa8702c0d, 0x21998d9a,
+    0x593eed17, 0x37a6b845, 0x4f01d8c8, 0xc6e8795f, 0xbe4f19d2,
+    0xaa217d03, 0xd2861d8e, 0x5b6fbc19, 0x23c8dc94, 0x4d5089c6,
+    0x35f7e94b, 0xbc1e48dc, 0xc4b92851, 0x612ee278, 0x198982f5,
+    0x90602362, 0xe8c743ef, 0x865f16bd, 0xfef87630, 0x7711d7a7,
+    0x0fb6b72a, 0x39d23504, 0x41755589, 0xc89cf41e, 0xb03b9493,
+    0xdea3c1c1, 0xa604a14c, 0x2fed00db, 0x574a6056, 0xf2ddaa7f,
+    0x8a7acaf2, 0x03936b65, 0x7b340be8, 0x15ac5eba, 0x6d0b3e37,
+    0xe4e29fa0, 0x9c45ff2d, 0xcc3e5602, 0xb499368f, 0x3d709718,
+    0x45d7f795, 0x2b4fa2c7, 0x53e8c24a, 0xda0163dd, 0xa2a60350,
+    0x0731c979, 0x7f96a9f4, 0xf67f0863, 0x8ed868ee, 0xe0403dbc,
+    0x98e75d31, 0x110efca6, 0x69a99c2b, 0x5fcd1e05, 0x276a7e88,
+    0xae83df1f, 0xd624bf92, 0xb8bceac0, 0xc01b8a4d, 0x49f22bda,
+    0x31554b57, 0x94c2817e, 0xec65e1f3, 0x658c4064, 0x1d2b20e9,
+    0x73b375bb, 0x0b141536, 0x82fdb4a1, 0xfa5ad42c, 0xee34b0fd,
+    0x9693d070, 0x1f7a71e7, 0x67dd116a, 0x09454438, 0x71e224b5,
+    0xf80b8522, 0x80ace5af, 0x253b2f86, 0x5d9c4f0b, 0xd475ee9c,
+    0xacd28e11, 0xc24adb43, 0xbaedbbce, 0x33041a59, 0x4ba37ad4,
+    0x7dc7f8fa, 0x05609877, 0x8c8939e0, 0xf42e596d, 0x9ab60c3f,
+    0xe2116cb2, 0x6bf8cd25, 0x135fada8, 0xb6c86781, 0xce6f070c,
+    0x4786a69b, 0x3f21c616, 0x51b99344, 0x291ef3c9, 0xa0f7525e,
+    0xd85032d3},
+   {0x00000000, 0x15bb4109, 0x2b768212, 0x3ecdc31b, 0x56ed0424,
+    0x4356452d, 0x7d9b8636, 0x6820c73f, 0xadda0848, 0xb8614941,
+    0x86ac8a5a, 0x9317cb53, 0xfb370c6c, 0xee8c4d65, 0xd0418e7e,
+    0xc5facf77, 0x5e586661, 0x4be32768, 0x752ee473, 0x6095a57a,
+    0x08b56245, 0x1d0e234c, 0x23c3e057, 0x3678a15e, 0xf3826e29,
+    0xe6392f20, 0xd8f4ec3b, 0xcd4fad32, 0xa56f6a0d, 0xb0d42b04,
+    0x8e19e81f, 0x9ba2a916, 0xbcb0ccc2, 0xa90b8dcb, 0x97c64ed0,
+    0x827d0fd9, 0xea5dc8e6, 0xffe689ef, 0xc12b4af4, 0xd4900bfd,
+    0x116ac48a, 0x04d18583, 0x3a1c4698, 0x2fa70791, 0x4787c0ae,
+    0x523c81a7, 0x6cf142bc, 0x794a03b5, 0xe2e8aaa3, 0xf753ebaa,
+    0xc99e28b1, 0xdc2569b8, 0xb405ae87, 0xa1beef8e, 0x9f732c95,
+    0x8ac86d9c, 0x4f32a2eb, 0x5a89e3e2, 0x644420f9, 0x71ff61f0,
+    0x19dfa6cf, 0x0c64e7c6, 0x32a924dd, 0x271265d4, 0x7c8def75,
+    0x6936ae7c, 0x57fb6d67, 0x42402c6e, 0x2a60eb51, 0x3fdbaa58,
+    0x01166943, 0x14ad284a, 0xd157e73d, 0xc4eca634, 0xfa21652f,
+    0xef9a2426, 0x87bae319, 0x9201a210, 0xaccc610b, 0xb9772002,
+    0x22d58914, 0x376ec81d, 0x09a30b06, 0x1c184a0f, 0x74388d30,
+    0x6183cc39, 0x5f4e0f22, 0x4af54e2b, 0x8f0f815c, 0x9ab4c055,
+    0xa479034e, 0xb1c24247, 0xd9e28578, 0xcc59c471, 0xf294076a,
+    0xe72f4663, 0xc03d23b7, 0xd58662be, 0xeb4ba1a5, 0xfef0e0ac,
+    0x96d02793, 0x836b669a, 0xbda6a581, 0xa81de488, 0x6de72bff,
+    0x785c6af6, 0x4691a9ed, 0x532ae8e4, 0x3b0a2fdb, 0x2eb16ed2,
+    0x107cadc9, 0x05c7ecc0, 0x9e6545d6, 0x8bde04df, 0xb513c7c4,
+    0xa0a886cd, 0xc88841f2, 0xdd3300fb, 0xe3fec3e0, 0xf64582e9,
+    0x33bf4d9e, 0x26040c97, 0x18c9cf8c, 0x0d728e85, 0x655249ba,
+    0x70e908b3, 0x4e24cba8, 0x5b9f8aa1, 0xf91bdeea, 0xeca09fe3,
+    0xd26d5cf8, 0xc7d61df1, 0xaff6dace, 0xba4d9bc7, 0x848058dc,
+    0x913b19d5, 0x54c1d6a2, 0x417a97ab, 0x7fb754b0, 0x6a0c15b9,
+    0x022cd286, 0x1797938f, 0x295a5094, 0x3ce1119d, 0xa743b88b,
+    0xb2f8f982, 0x8c353a99, 0x998e7b90, 0xf1aebcaf, 0xe415fda6,
+    0xdad83ebd, 0xcf637fb4, 0x0a99b0c3, 0x1f22f1ca, 0x21ef32d1,
+    0x345473d8, 0x5c74b4e7, 0x49cff5ee, 0x770236f5, 0x62b977fc,
+    0x45ab1228, 0x50105321, 0x6edd903a, 0x7b66d133, 0x1346160c,
+    0x06fd5705, 0x3830941e, 0x2d8bd517, 0xe8711a60, 0xfdca5b69,
+    0xc3079872, 0xd6bcd97b, 0xbe9c1e44, 0xab275f4d, 0x95ea9c56,
+    0x8051dd5f, 0x1bf37449, 0x0e483540, 0x3085f65b, 0x253eb752,
+    0x4d1e706d, 0x58a53164, 0x6668f27f, 0x73d3b376, 0xb6297c01,
+    0xa3923d08, 0x9d5ffe13, 0x88e4bf1a, 0xe0c47825, 0xf57f392c,
+    0xcbb2fa37, 0xde09bb3e, 0x8596319f, 0x902d7096, 0xaee0b38d,
+    0xbb5bf284, 0xd37b35bb, 0xc6c074b2, 0xf80db7a9, 0xedb6f6a0,
+    0x284c39d7, 0x3df778de, 0x033abbc5, 0x1681facc, 0x7ea13df3,
+    0x6b1a7cfa, 0x55d7bfe1, 0x406cfee8, 0xdbce57fe, 0xce7516f7,
+    0xf0b8d5ec, 0xe50394e5, 0x8d2353da, 0x989812d3, 0xa655d1c8,
+    0xb3ee90c1, 0x76145fb6, 0x63af1ebf, 0x5d62dda4, 0x48d99cad,
+    0x20f95b92, 0x35421a9b, 0x0b8fd980, 0x1e349889, 0x3926fd5d,
+    0x2c9dbc54, 0x12507f4f, 0x07eb3e46, 0x6fcbf979, 0x7a70b870,
+    0x44bd7b6b, 0x51063a62, 0x94fcf515, 0x8147b41c, 0xbf8a7707,
+    0xaa31360e, 0xc211f131, 0xd7aab038, 0xe9677323, 0xfcdc322a,
+    0x677e9b3c, 0x72c5da35, 0x4c08192e, 0x59b35827, 0x31939f18,
+    0x2428de11, 0x1ae51d0a, 0x0f5e5c03, 0xcaa49374, 0xdf1fd27d,
+    0xe1d21166, 0xf469506f, 0x9c499750, 0x89f2d659, 0xb73f1542,
+    0xa284544b},
+   {0x00000000, 0xf7dbcb25, 0xea5be0bb, 0x1d802b9e, 0xd15bb787,
+    0x26807ca2, 0x3b00573c, 0xccdb9c19, 0xa75b19ff, 0x5080d2da,
+    0x4d00f944, 0xbadb3261, 0x7600ae78, 0x81db655d, 0x9c5b4ec3,
+    0x6b8085e6, 0x4b5a450f, 0xbc818e2a, 0xa101a5b4, 0x56da6e91,
+    0x9a01f288, 0x6dda39ad, 0x705a1233, 0x8781d916, 0xec015cf0,
+    0x1bda97d5, 0x065abc4b, 0xf181776e, 0x3d5aeb77, 0xca812052,
+    0xd7010bcc, 0x20dac0e9, 0x96b48a1e, 0x616f413b, 0x7cef6aa5,
+    0x8b34a180, 0x47ef3d99, 0xb034f6bc, 0xadb4dd22, 0x5a6f1607,
+    0x31ef93e1, 0xc63458c4, 0xdbb4735a, 0x2c6fb87f, 0xe0b42466,
+    0x176fef43, 0x0aefc4dd, 0xfd340ff8, 0xddeecf11, 0x2a350434,
+    0x37b52faa, 0xc06ee48f, 0x0cb57896, 0xfb6eb3b3, 0xe6ee982d,
+    0x11355308, 0x7ab5d6ee, 0x8d6e1dcb, 0x90ee3655, 0x6735fd70,
+    0xabee6169, 0x5c35aa4c, 0x41b581d2, 0xb66e4af7, 0x288562cd,
+    0xdf5ea9e8, 0xc2de8276, 0x35054953, 0xf9ded54a, 0x0e051e6f,
+    0x138535f1, 0xe45efed4, 0x8fde7b32, 0x7805b017, 0x65859b89,
+    0x925e50ac, 0x5e85ccb5, 0xa95e0790, 0xb4de2c0e, 0x4305e72b,
+    0x63df27c2, 0x9404ece7, 0x8984c779, 0x7e5f0c5c, 0xb2849045,
+    0x455f5b60, 0x58df70fe, 0xaf04bbdb, 0xc4843e3d, 0x335ff518,
+    0x2edfde86, 0xd90415a3, 0x15df89ba, 0xe204429f, 0xff846901,
+    0x085fa224, 0xbe31e8d3, 0x49ea23f6, 0x546a0868, 0xa3b1c34d,
+    0x6f6a5f54, 0x98b19471, 0x8531bfef, 0x72ea74ca, 0x196af12c,
+    0xeeb13a09, 0xf3311197, 0x04eadab2, 0xc83146ab, 0x3fea8d8e,
+    0x226aa610, 0xd5b16d35, 0xf56baddc, 0x02b066f9, 0x1f304d67,
+    0xe8eb8642, 0x24301a5b, 0xd3ebd17e, 0xce6bfae0, 0x39b031c5,
+    0x5230b423, 0xa5eb7f06, 0xb86b5498, 0x4fb09fbd, 0x836b03a4,
+    0x74b0c881, 0x6930e31f, 0x9eeb283a, 0x510ac59a, 0xa6d10ebf,
+    0xbb512521, 0x4c8aee04, 0x8051721d, 0x778ab938, 0x6a0a92a6,
+    0x9dd15983, 0xf651dc65, 0x018a1740, 0x1c0a3cde, 0xebd1f7fb,
+    0x270a6be2, 0xd0d1a0c7, 0xcd518b59, 0x3a8a407c, 0x1a508095,
+    0xed8b4bb0, 0xf00b602e, 0x07d0ab0b, 0xcb0b3712, 0x3cd0fc37,
+    0x2150d7a9, 0xd68b1c8c, 0xbd0b996a, 0x4ad0524f, 0x575079d1,
+    0xa08bb2f4, 0x6c502eed, 0x9b8be5c8, 0x860bce56, 0x71d00573,
+    0xc7be4f84, 0x306584a1, 0x2de5af3f, 0xda3e641a, 0x16e5f803,
+    0xe13e3326, 0xfcbe18b8, 0x0b65d39d, 0x60e5567b, 0x973e9d5e,
+    0x8abeb6c0, 0x7d657de5, 0xb1bee1fc, 0x46652ad9, 0x5be50147,
+    0xac3eca62, 0x8ce40a8b, 0x7b3fc1ae, 0x66bfea30, 0x91642115,
+    0x5dbfbd0c, 0xaa647629, 0xb7e45db7, 0x403f9692, 0x2bbf1374,
+    0xdc64d851, 0xc1e4f3cf, 0x363f38ea, 0xfae4a4f3, 0x0d3f6fd6,
+    0x10bf4448, 0xe7648f6d, 0x798fa757, 0x8e546c72, 0x93d447ec,
+    0x640f8cc9, 0xa8d410d0, 0x5f0fdbf5, 0x428ff06b, 0xb5543b4e,
+    0xded4bea8, 0x290f758d, 0x348f5e13, 0xc3549536, 0x0f8f092f,
+    0xf854c20a, 0xe5d4e994, 0x120f22b1, 0x32d5e258, 0xc50e297d,
+    0xd88e02e3, 0x2f55c9c6, 0xe38e55df, 0x14559efa, 0x09d5b564,
+    0xfe0e7e41, 0x958efba7, 0x62553082, 0x7fd51b1c, 0x880ed039,
+    0x44d54c20, 0xb30e8705, 0xae8eac9b, 0x595567be, 0xef3b2d49,
+    0x18e0e66c, 0x0560cdf2, 0xf2bb06d7, 0x3e609ace, 0xc9bb51eb,
+    0xd43b7a75, 0x23e0b150, 0x486034b6, 0xbfbbff93, 0xa23bd40d,
+    0x55e01f28, 0x993b8331, 0x6ee04814, 0x7360638a, 0x84bba8af,
+    0xa4616846, 0x53baa363, 0x4e3a88fd, 0xb9e143d8, 0x753adfc1,
+    0x82e114e4, 0x9f613f7a, 0x68baf45f, 0x033a71b9, 0xf4e1ba9c,
+    0xe9619102, 0x1eba5a27, 0xd261c63e, 0x25ba0d1b, 0x383a2685,
+    0xcfe1eda0},
+   {0x00000000, 0xa2158b34, 0x41c76099, 0xe3d2ebad, 0x838ec132,
+    0x219b4a06, 0xc249a1ab, 0x605c2a9f, 0x02f1f495, 0xa0e47fa1,
+    0x4336940c, 0xe1231f38, 0x817f35a7, 0x236abe93, 0xc0b8553e,
+    0x62adde0a, 0x05e3e92a, 0xa7f6621e, 0x442489b3, 0xe6310287,
+    0x866d2818, 0x2478a32c, 0xc7aa4881, 0x65bfc3b5, 0x07121dbf,
+    0xa507968b, 0x46d57d26, 0xe4c0f612, 0x849cdc8d, 0x268957b9,
+    0xc55bbc14, 0x674e3720, 0x0bc7d254, 0xa9d25960, 0x4a00b2cd,
+    0xe81539f9, 0x88491366, 0x2a5c9852, 0xc98e73ff, 0x6b9bf8cb,
+    0x093626c1, 0xab23adf5, 0x48f14658, 0xeae4cd6c, 0x8ab8e7f3,
+    0x28ad6cc7, 0xcb7f876a, 0x696a0c5e, 0x0e243b7e, 0xac31b04a,
+    0x4fe35be7, 0xedf6d0d3, 0x8daafa4c, 0x2fbf7178, 0xcc6d9ad5,
+    0x6e7811e1, 0x0cd5cfeb, 0xaec044df, 0x4d12af72, 0xef072446,
+    0x8f5b0ed9, 0x2d4e85ed, 0xce9c6e40, 0x6c89e574, 0x178fa4a8,
+    0xb59a2f9c, 0x5648c431, 0xf45d4f05, 0x9401659a, 0x3614eeae,
+    0xd5c60503, 0x77d38e37, 0x157e503d, 0xb76bdb09, 0x54b930a4,
+    0xf6acbb90, 0x96f0910f, 0x34e51a3b, 0xd737f196, 0x75227aa2,
+    0x126c4d82, 0xb079c6b6, 0x53ab2d1b, 0xf1bea62f, 0x91e28cb0,
+    0x33f70784, 0xd025ec29, 0x7230671d, 0x109db917, 0xb2883223,
+    0x515ad98e, 0xf34f52ba, 0x93137825, 0x3106f311, 0xd2d418bc,
+    0x70c19388, 0x1c4876fc, 0xbe5dfdc8, 0x5d8f1665, 0xff9a9d51,
+    0x9fc6b7ce, 0x3dd33cfa, 0xde01d757, 0x7c145c63, 0x1eb98269,
+    0xbcac095d, 0x5f7ee2f0, 0xfd6b69c4, 0x9d37435b, 0x3f22c86f,
+    0xdcf023c2, 0x7ee5a8f6, 0x19ab9fd6, 0xbbbe14e2, 0x586cff4f,
+    0xfa79747b, 0x9a255ee4, 0x3830d5d0, 0xdbe23e7d, 0x79f7b549,
+    0x1b5a6b43, 0xb94fe077, 0x5a9d0bda, 0xf88880ee, 0x98d4aa71,
+    0x3ac12145, 0xd913cae8, 0x7b0641dc, 0x2f1f4950, 0x8d0ac264,
+    0x6ed829c9, 0xcccda2fd, 0xac918862, 0x0e840356, 0xed56e8fb,
+    0x4f4363cf, 0x2deebdc5, 0x8ffb36f1, 0x6c29dd5c, 0xce3c5668,
+    0xae607cf7, 0x0c75f7c3, 0xefa71c6e, 0x4db2975a, 0x2afca07a,
+    0x88e92b4e, 0x6b3bc0e3, 0xc92e4bd7, 0xa9726148, 0x0b67ea7c,
+    0xe8b501d1, 0x4aa08ae5, 0x280d54ef, 0x8a18dfdb, 0x69ca3476,
+    0xcbdfbf42, 0xab8395dd, 0x09961ee9, 0xea44f544, 0x48517e70,
+    0x24d89b04, 0x86cd1030, 0x651ffb9d, 0xc70a70a9, 0xa7565a36,
+    0x0543d102, 0xe6913aaf, 0x4484b19b, 0x26296f91, 0x843ce4a5,
+    0x67ee0f08, 0xc5fb843c, 0xa5a7aea3, 0x07b22597, 0xe460ce3a,
+    0x4675450e, 0x213b722e, 0x832ef91a, 0x60fc12b7, 0xc2e99983,
+    0xa2b5b31c, 0x00a03828, 0xe372d385, 0x416758b1, 0x23ca86bb,
+    0x81df0d8f, 0x620de622, 0xc0186d16, 0xa0444789, 0x0251ccbd,
+    0xe1832710, 0x4396ac24, 0x3890edf8, 0x9a8566cc, 0x79578d61,
+    0xdb420655, 0xbb1e2cca, 0x190ba7fe, 0xfad94c53, 0x58ccc767,
+    0x3a61196d, 0x98749259, 0x7ba679f4, 0xd9b3f2c0, 0xb9efd85f,
+    0x1bfa536b, 0xf828b8c6, 0x5a3d33f2, 0x3d7304d2, 0x9f668fe6,
+    0x7cb4644b, 0xdea1ef7f, 0xbefdc5e0, 0x1ce84ed4, 0xff3aa579,
+    0x5d2f2e4d, 0x3f82f047, 0x9d977b73, 0x7e4590de, 0xdc501bea,
+    0xbc0c3175, 0x1e19ba41, 0xfdcb51ec, 0x5fdedad8, 0x33573fac,
+    0x9142b498, 0x72905f35, 0xd085d401, 0xb0d9fe9e, 0x12cc75aa,
+    0xf11e9e07, 0x530b1533, 0x31a6cb39, 0x93b3400d, 0x7061aba0,
+    0xd2742094, 0xb2280a0b, 0x103d813f, 0xf3ef6a92, 0x51fae1a6,
+    0x36b4d686, 0x94a15db2, 0x7773b61f, 0xd5663d2b, 0xb53a17b4,
+    0x172f9c80, 0xf4fd772d, 0x56e8fc19, 0x34452213, 0x9650a927,
+    0x7582428a, 0xd797c9be, 0xb7cbe321, 0x15de6815, 0xf60c83b8,
+    0x5419088c},
+   {0x00000000, 0x5e3e92a0, 0xbc7d2540, 0xe243b7e0, 0x7d163c71,
+    0x2328aed1, 0xc16b1931, 0x9f558b91, 0xfa2c78e2, 0xa412ea42,
+    0x46515da2, 0x186fcf02, 0x873a4493, 0xd904d633, 0x3b4761d3,
+    0x6579f373, 0xf1b48735, 0xaf8a1595, 0x4dc9a275, 0x13f730d5,
+    0x8ca2bb44, 0xd29c29e4, 0x30df9e04, 0x6ee10ca4, 0x0b98ffd7,
+    0x55a66d77, 0xb7e5da97, 0xe9db4837, 0x768ec3a6, 0x28b05106,
+    0xcaf3e6e6, 0x94cd7446, 0xe685789b, 0xb8bbea3b, 0x5af85ddb,
+    0x04c6cf7b, 0x9b9344ea, 0xc5add64a, 0x27ee61aa, 0x79d0f30a,
+    0x1ca90079, 0x429792d9, 0xa0d42539, 0xfeeab799, 0x61bf3c08,
+    0x3f81aea8, 0xddc21948, 0x83fc8be8, 0x1731ffae, 0x490f6d0e,
+    0xab4cdaee, 0xf572484e, 0x6a27c3df, 0x3419517f, 0xd65ae69f,
+    0x8864743f, 0xed1d874c, 0xb32315ec, 0x5160a20c, 0x0f5e30ac,
+    0x900bbb3d, 0xce35299d, 0x2c769e7d, 0x72480cdd, 0xc8e687c7,
+    0x96d81567, 0x749ba287, 0x2aa53027, 0xb5f0bbb6, 0xebce2916,
+    0x098d9ef6, 0x57b30c56, 0x32caff25, 0x6cf46d85, 0x8eb7da65,
+    0xd08948c5, 0x4fdcc354, 0x11e251f4, 0xf3a1e614, 0xad9f74b4,
+    0x395200f2, 0x676c9252, 0x852f25b2, 0xdb11b712, 0x44443c83,
+    0x1a7aae23, 0xf83919c3, 0xa6078b63, 0xc37e7810, 0x9d40eab0,
+    0x7f035d50, 0x213dcff0, 0xbe684461, 0xe056d6c1, 0x02156121,
+    0x5c2bf381, 0x2e63ff5c, 0x705d6dfc, 0x921eda1c, 0xcc2048bc,
+    0x5375c32d, 0x0d4b518d, 0xef08e66d, 0xb13674cd, 0xd44f87be,
+    0x8a71151e, 0x6832a2fe, 0x360c305e, 0xa959bbcf, 0xf767296f,
+    0x15249e8f, 0x4b1a0c2f, 0xdfd77869, 0x81e9eac9, 0x63aa5d29,
+    0x3d94cf89, 0xa2c14418, 0xfcffd6b8, 0x1ebc6158, 0x4082f3f8,
+    0x25fb008b, 0x7bc5922b, 0x998625cb, 0xc7b8b76b, 0x58ed3cfa,
+    0x06d3ae5a, 0xe49019ba, 0xbaae8b1a, 0x9421797f, 0xca1febdf,
+    0x285c5c3f, 0x7662ce9f, 0xe937450e, 0xb709d7ae, 0x554a604e,
+    0x0b74f2ee, 0x6e0d019d, 0x3033933d, 0xd27024dd, 0x8c4eb67d,
+    0x131b3dec, 0x4d25af4c, 0xaf6618ac, 0xf1588a0c, 0x6595fe4a,
+    0x3bab6cea, 0xd9e8db0a, 0x87d649aa, 0x1883c23b, 0x46bd509b,
+    0xa4fee77b, 0xfac075db, 0x9fb986a8, 0xc1871408, 0x23c4a3e8,
+    0x7dfa3148, 0xe2afbad9, 0xbc912879, 0x5ed29f99, 0x00ec0d39,
+    0x72a401e4, 0x2c9a9344, 0xced924a4, 0x90e7b604, 0x0fb23d95,
+    0x518caf35, 0xb3cf18d5, 0xedf18a75, 0x88887906, 0xd6b6eba6,
+    0x34f55c46, 0x6acbcee6, 0xf59e4577, 0xaba0d7d7, 0x49e36037,
+    0x17ddf297, 0x831086d1, 0xdd2e1471, 0x3f6da391, 0x61533131,
+    0xfe06baa0, 0xa0382800, 0x427b9fe0, 0x1c450d40, 0x793cfe33,
+    0x27026c93, 0xc541db73, 0x9b7f49d3, 0x042ac242, 0x5a1450e2,
+    0xb857e702, 0xe66975a2, 0x5cc7feb8, 0x02f96c18, 0xe0badbf8,
+    0xbe844958, 0x21d1c2c9, 0x7fef5069, 0x9dace789, 0xc3927529,
+    0xa6eb865a, 0xf8d514fa, 0x1a96a31a, 0x44a831ba, 0xdbfdba2b,
+    0x85c3288b, 0x67809f6b, 0x39be0dcb, 0xad73798d, 0xf34deb2d,
+    0x110e5ccd, 0x4f30ce6d, 0xd06545fc, 0x8e5bd75c, 0x6c1860bc,
+    0x3226f21c, 0x575f016f, 0x096193cf, 0xeb22242f, 0xb51cb68f,
+    0x2a493d1e, 0x7477afbe, 0x9634185e, 0xc80a8afe, 0xba428623,
+    0xe47c1483, 0x063fa363, 0x580131c3, 0xc754ba52, 0x996a28f2,
+    0x7b299f12, 0x25170db2, 0x406efec1, 0x1e506c61, 0xfc13db81,
+    0xa22d4921, 0x3d78c2b0, 0x63465010, 0x8105e7f0, 0xdf3b7550,
+    0x4bf60116, 0x15c893b6, 0xf78b2456, 0xa9b5b6f6, 0x36e03d67,
+    0x68deafc7, 0x8a9d1827, 0xd4a38a87, 0xb1da79f4, 0xefe4eb54,
+    0x0da75cb4, 0x5399ce14, 0xcccc4585, 0x92f2d725, 0x70b160c5,
+    0x2e8ff265},
+   {0x00000000, 0x2dae840f, 0x5b5d081e, 0x76f38c11, 0xb6ba103c,
+    0x9b149433, 0xede71822, 0xc0499c2d, 0x68985689, 0x4536d286,
+    0x33c55e97, 0x1e6bda98, 0xde2246b5, 0xf38cc2ba, 0x857f4eab,
+    0xa8d1caa4, 0xd130ad12, 0xfc9e291d, 0x8a6da50c, 0xa7c32103,
+    0x678abd2e, 0x4a243921, 0x3cd7b530, 0x1179313f, 0xb9a8fb9b,
+    0x94067f94, 0xe2f5f385, 0xcf5b778a, 0x0f12eba7, 0x22bc6fa8,
+    0x544fe3b9, 0x79e167b6, 0xa78d2cd5, 0x8a23a8da, 0xfcd024cb,
+    0xd17ea0c4, 0x11373ce9, 0x3c99b8e6, 0x4a6a34f7, 0x67c4b0f8,
+    0xcf157a5c, 0xe2bbfe53, 0x94487242, 0xb9e6f64d, 0x79af6a60,
+    0x5401ee6f, 0x22f2627e, 0x0f5ce671, 0x76bd81c7, 0x5b1305c8,
+    0x2de089d9, 0x004e0dd6, 0xc00791fb, 0xeda915f4, 0x9b5a99e5,
+    0xb6f41dea, 0x1e25d74e, 0x338b5341, 0x4578df50, 0x68d65b5f,
+    0xa89fc772, 0x8531437d, 0xf3c2cf6c, 0xde6c4b63, 0x4af62f5b,
+    0x6758ab54, 0x11ab2745, 0x3c05a34a, 0xfc4c3f67, 0xd1e2bb68,
+    0xa7113779, 0x8abfb376, 0x226e79d2, 0x0fc0fddd, 0x793371cc,
+    0x549df5c3, 0x94d469ee, 0xb97aede1, 0xcf8961f0, 0xe227e5ff,
+    0x9bc68249, 0xb6680646, 0xc09b8a57, 0xed350e58, 0x2d7c9275,
+    0x00d2167a, 0x76219a6b, 0x5b8f1e64, 0xf35ed4c0, 0xdef050cf,
+    0xa803dcde, 0x85ad58d1, 0x45e4c4fc, 0x684a40f3, 0x1eb9cce2,
+    0x331748ed, 0xed7b038e, 0xc0d58781, 0xb6260b90, 0x9b888f9f,
+    0x5bc113b2, 0x766f97bd, 0x009c1bac, 0x2d329fa3, 0x85e35507,
+    0xa84dd108, 0xdebe5d19, 0xf310d916, 0x3359453b, 0x1ef7c134,
+    0x68044d25, 0x45aac92a, 0x3c4bae9c, 0x11e52a93, 0x6716a682,
+    0x4ab8228d, 0x8af1bea0, 0xa75f3aaf, 0xd1acb6be, 0xfc0232b1,
+    0x54d3f815, 0x797d7c1a, 0x0f8ef00b, 0x22207404, 0xe269e829,
+    0xcfc76c26, 0xb934e037, 0x949a6438, 0x95ec5eb6, 0xb842dab9,
+    0xceb156a8, 0xe31fd2a7, 0x23564e8a, 0x0ef8ca85, 0x780b4694,
+    0x55a5c29b, 0xfd74083f, 0xd0da8c30, 0xa6290021, 0x8b87842e,
+    0x4bce1803, 0x66609c0c, 0x1093101d, 0x3d3d9412, 0x44dcf3a4,
+    0x697277ab, 0x1f81fbba, 0x322f7fb5, 0xf266e398, 0xdfc86797,
+    0xa93beb86, 0x84956f89, 0x2c44a52d, 0x01ea2122, 0x7719ad33,
+    0x5ab7293c, 0x9afeb511, 0xb750311e, 0xc1a3bd0f, 0xec0d3900,
+    0x32617263, 0x1fcff66c, 0x693c7a7d, 0x4492fe72, 0x84db625f,
+    0xa975e650, 0xdf866a41, 0xf228ee4e, 0x5af924ea, 0x7757a0e5,
+    0x01a42cf4, 0x2c0aa8fb, 0xec4334d6, 0xc1edb0d9, 0xb71e3cc8,
+    0x9ab0b8c7, 0xe351df71, 0xceff5b7e, 0xb80cd76f, 0x95a25360,
+    0x55ebcf4d, 0x78454b42, 0x0eb6c753, 0x2318435c, 0x8bc989f8,
+    0xa6670df7, 0xd09481e6, 0xfd3a05e9, 0x3d7399c4, 0x10dd1dcb,
+    0x662e91da, 0x4b8015d5, 0xdf1a71ed, 0xf2b4f5e2, 0x844779f3,
+    0xa9e9fdfc, 0x69a061d1, 0x440ee5de, 0x32fd69cf, 0x1f53edc0,
+    0xb7822764, 0x9a2ca36b, 0xecdf2f7a, 0xc171ab75, 0x01383758,
+    0x2c96b357, 0x5a653f46, 0x77cbbb49, 0x0e2adcff, 0x238458f0,
+    0x5577d4e1, 0x78d950ee, 0xb890ccc3, 0x953e48cc, 0xe3cdc4dd,
+    0xce6340d2, 0x66b28a76, 0x4b1c0e79, 0x3def8268, 0x10410667,
+    0xd0089a4a, 0xfda61e45, 0x8b559254, 0xa6fb165b, 0x78975d38,
+    0x5539d937, 0x23ca5526, 0x0e64d129, 0xce2d4d04, 0xe383c90b,
+    0x9570451a, 0xb8dec115, 0x100f0bb1, 0x3da18fbe, 0x4b5203af,
+    0x66fc87a0, 0xa6b51b8d, 0x8b1b9f82, 0xfde81393, 0xd046979c,
+    0xa9a7f02a, 0x84097425, 0xf2faf834, 0xdf547c3b, 0x1f1de016,
+    0x32b36419, 0x4440e808, 0x69ee6c07, 0xc13fa6a3, 0xec9122ac,
+    0x9a62aebd, 0xb7cc2ab2, 0x7785b69f, 0x5a2b3290, 0x2cd8be81,
+    0x01763a8e},
+   {0x00000000, 0x2e34cb9d, 0x5c69973a, 0x725d5ca7, 0xb8d32e74,
+    0x96e7e5e9, 0xe4bab94e, 0xca8e72d3, 0x744a2a19, 0x5a7ee184,
+    0x2823bd23, 0x061776be, 0xcc99046d, 0xe2adcff0, 0x90f09357,
+    0xbec458ca, 0xe8945432, 0xc6a09faf, 0xb4fdc308, 0x9ac90895,
+    0x50477a46, 0x7e73b1db, 0x0c2eed7c, 0x221a26e1, 0x9cde7e2b,
+    0xb2eab5b6, 0xc0b7e911, 0xee83228c, 0x240d505f, 0x0a399bc2,
+    0x7864c765, 0x56500cf8, 0xd4c4de95, 0xfaf01508, 0x88ad49af,
+    0xa6998232, 0x6c17f0e1, 0x42233b7c, 0x307e67db, 0x1e4aac46,
+    0xa08ef48c, 0x8eba3f11, 0xfce763b6, 0xd2d3a82b, 0x185ddaf8,
+    0x36691165, 0x44344dc2, 0x6a00865f, 0x3c508aa7, 0x1264413a,
+    0x60391d9d, 0x4e0dd600, 0x8483a4d3, 0xaab76f4e, 0xd8ea33e9,
+    0xf6def874, 0x481aa0be, 0x662e6b23, 0x14733784, 0x3a47fc19,
+    0xf0c98eca, 0xdefd4557, 0xaca019f0, 0x8294d26d, 0xac65cbdb,
+    0x82510046, 0xf00c5ce1, 0xde38977c, 0x14b6e5af, 0x3a822e32,
+    0x48df7295, 0x66ebb908, 0xd82fe1c2, 0xf61b2a5f, 0x844676f8,
+    0xaa72bd65, 0x60fccfb6, 0x4ec8042b, 0x3c95588c, 0x12a19311,
+    0x44f19fe9, 0x6ac55474, 0x189808d3, 0x36acc34e, 0xfc22b19d,
+    0xd2167a00, 0xa04b26a7, 0x8e7fed3a, 0x30bbb5f0, 0x1e8f7e6d,
+    0x6cd222ca, 0x42e6e957, 0x88689b84, 0xa65c5019, 0xd4010cbe,
+    0xfa35c723, 0x78a1154e, 0x5695ded3, 0x24c88274, 0x0afc49e9,
+    0xc0723b3a, 0xee46f0a7, 0x9c1bac00, 0xb22f679d, 0x0ceb3f57,
+    0x22dff4ca, 0x5082a86d, 0x7eb663f0, 0xb4381123, 0x9a0cdabe,
+    0xe8518619, 0xc6654d84, 0x9035417c, 0xbe018ae1, 0xcc5cd646,
+    0xe2681ddb, 0x28e66f08, 0x06d2a495, 0x748ff832, 0x5abb33af,
+    0xe47f6b65, 0xca4ba0f8, 0xb816fc5f, 0x962237c2, 0x5cac4511,
+    0x72988e8c, 0x00c5d22b, 0x2ef119b6, 0x5d27e147, 0x73132ada,
+    0x014e767d, 0x2f7abde0, 0xe5f4cf33, 0xcbc004ae, 0xb99d5809,
+    0x97a99394, 0x296dcb5e, 0x075900c3, 0x75045c64, 0x5b3097f9,
+    0x91bee52a, 0xbf8a2eb7, 0xcdd77210, 0xe3e3b98d, 0xb5b3b575,
+    0x9b877ee8, 0xe9da224f, 0xc7eee9d2, 0x0d609b01, 0x2354509c,
+    0x51090c3b, 0x7f3dc7a6, 0xc1f99f6c, 0xefcd54f1, 0x9d900856,
+    0xb3a4c3cb, 0x792ab118, 0x571e7a85, 0x25432622, 0x0b77edbf,
+    0x89e33fd2, 0xa7d7f44f, 0xd58aa8e8, 0xfbbe6375, 0x313011a6,
+    0x1f04da3b, 0x6d59869c, 0x436d4d01, 0xfda915cb, 0xd39dde56,
+    0xa1c082f1, 0x8ff4496c, 0x457a3bbf, 0x6b4ef022, 0x1913ac85,
+    0x37276718, 0x61776be0, 0x4f43a07d, 0x3d1efcda, 0x132a3747,
+    0xd9a44594, 0xf7908e09, 0x85cdd2ae, 0xabf91933, 0x153d41f9,
+    0x3b098a64, 0x4954d6c3, 0x67601d5e, 0xadee6f8d, 0x83daa410,
+    0xf187f8b7, 0xdfb3332a, 0xf1422a9c, 0xdf76e101, 0xad2bbda6,
+    0x831f763b, 0x499104e8, 0x67a5cf75, 0x15f893d2, 0x3bcc584f,
+    0x85080085, 0xab3ccb18, 0xd96197bf, 0xf7555c22, 0x3ddb2ef1,
+    0x13efe56c, 0x61b2b9cb, 0x4f867256, 0x19d67eae, 0x37e2b533,
+    0x45bfe994, 0x6b8b2209, 0xa10550da, 0x8f319b47, 0xfd6cc7e0,
+    0xd3580c7d, 0x6d9c54b7, 0x43a89f2a, 0x31f5c38d, 0x1fc10810,
+    0xd54f7ac3, 0xfb7bb15e, 0x8926edf9, 0xa7122664, 0x2586f409,
+    0x0bb23f94, 0x79ef6333, 0x57dba8ae, 0x9d55da7d, 0xb36111e0,
+    0xc13c4d47, 0xef0886da, 0x51ccde10, 0x7ff8158d, 0x0da5492a,
+    0x239182b7, 0xe91ff064, 0xc72b3bf9, 0xb576675e, 0x9b42acc3,
+    0xcd12a03b, 0xe3266ba6, 0x917b3701, 0xbf4ffc9c, 0x75c18e4f,
+    0x5bf545d2, 0x29a81975, 0x079cd2e8, 0xb9588a22, 0x976c41bf,
+    0xe5311d18, 0xcb05d685, 0x018ba456, 0x2fbf6fcb, 0x5de2336c,
+    0x73d6f8f1}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0x9dcb342e00000000, 0x3a97695c00000000,
+    0xa75c5d7200000000, 0x742ed3b800000000, 0xe9e5e79600000000,
+    0x4eb9bae400000000, 0xd3728eca00000000, 0x192a4a7400000000,
+    0x84e17e5a00000000, 0x23bd232800000000, 0xbe76170600000000,
+    0x6d0499cc00000000, 0xf0cfade200000000, 0x5793f09000000000,
+    0xca58c4be00000000, 0x325494e800000000, 0xaf9fa0c600000000,
+    0x08c3fdb400000000, 0x9508c99a00000000, 0x467a475000000000,
+    0xdbb1737e00000000, 0x7ced2e0c00000000, 0xe1261a2200000000,
+    0x2b7ede9c00000000, 0xb6b5eab200000000, 0x11e9b7c000000000,
+    0x8c2283ee00000000, 0x5f500d2400000000, 0xc29b390a00000000,
+    0x65c7647800000000, 0xf80c505600000000, 0x95dec4d400000000,
+    0x0815f0fa00000000, 0xaf49ad8800000000, 0x328299a600000000,
+    0xe1f0176c00000000, 0x7c3b234200000000, 0xdb677e3000000000,
+    0x46ac4a1e00000000, 0x8cf48ea000000000, 0x113fba8e00000000,
+    0xb663e7fc00000000, 0x2ba8d3d200000000, 0xf8da5d1800000000,
+    0x6511693600000000, 0xc24d344400000000, 0x5f86006a00000000,
+    0xa78a503c00000000, 0x3a41641200000000, 0x9d1d396000000000,
+    0x00d60d4e00000000, 0xd3a4838400000000, 0x4e6fb7aa00000000,
+    0xe933ead800000000, 0x74f8def600000000, 0xbea01a4800000000,
+    0x236b2e6600000000, 0x8437731400000000, 0x19fc473a00000000,
+    0xca8ec9f000000000, 0x5745fdde00000000, 0xf019a0ac00000000,
+    0x6dd2948200000000, 0xdbcb65ac00000000, 0x4600518200000000,
+    0xe15c0cf000000000, 0x7c9738de00000000, 0xafe5b61400000000,
+    0x322e823a00000000, 0x9572df4800000000, 0x08b9eb6600000000,
+    0xc2e12fd800000000, 0x5f2a1bf600000000, 0xf876468400000000,
+    0x65bd72aa00000000, 0xb6cffc6000000000, 0x2b04c84e00000000,
+    0x8c58953c00000000, 0x1193a11200000000, 0xe99ff14400000000,
+    0x7454c56a00000000, 0xd308981800000000, 0x4ec3ac3600000000,
+    0x9db122fc00000000, 0x007a16d200000000, 0xa7264ba000000000,
+    0x3aed7f8e00000000, 0xf0b5bb3000000000, 0x6d7e8f1e00000000,
+    0xca22d26c00000000, 0x57e9e64200000000, 0x849b688800000000,
+    0x19505ca600000000, 0xbe0c01d400000000, 0x23c735fa00000000,
+    0x4e15a17800000000, 0xd3de955600000000, 0x7482c82400000000,
+    0xe949fc0a00000000, 0x3a3b72c000000000, 0xa7f046ee00000000,
+    0x00ac1b9c00000000, 0x9d672fb200000000, 0x573feb0c00000000,
+    0xcaf4df2200000000, 0x6da8825000000000, 0xf063b67e00000000,
+    0x231138b400000000, 0xbeda0c9a00000000, 0x198651e800000000,
+    0x844d65c600000000, 0x7c41359000000000, 0xe18a01be00000000,
+    0x46d65ccc00000000, 0xdb1d68e200000000, 0x086fe62800000000,
+    0x95a4d20600000000, 0x32f88f7400000000, 0xaf33bb5a00000000,
+    0x656b7fe400000000, 0xf8a04bca00000000, 0x5ffc16b800000000,
+    0xc237229600000000, 0x1145ac5c00000000, 0x8c8e987200000000,
+    0x2bd2c50000000000, 0xb619f12e00000000, 0x47e1275d00000000,
+    0xda2a137300000000, 0x7d764e0100000000, 0xe0bd7a2f00000000,
+    0x33cff4e500000000, 0xae04c0cb00000000, 0x09589db900000000,
+    0x9493a99700000000, 0x5ecb6d2900000000, 0xc300590700000000,
+    0x645c047500000000, 0xf997305b00000000, 0x2ae5be9100000000,
+    0xb72e8abf00000000, 0x1072d7cd00000000, 0x8db9e3e300000000,
+    0x75b5b3b500000000, 0xe87e879b00000000, 0x4f22dae900000000,
+    0xd2e9eec700000000, 0x019b600d00000000, 0x9c50542300000000,
+    0x3b0c095100000000, 0xa6c73d7f00000000, 0x6c9ff9c100000000,
+    0xf154cdef00000000, 0x5608909d00000000, 0xcbc3a4b300000000,
+    0x18b12a7900000000, 0x857a1e5700000000, 0x2226432500000000,
+    0xbfed770b00000000, 0xd23fe38900000000, 0x4ff4d7a700000000,
+    0xe8a88ad500000000, 0x7563befb00000000, 0xa611303100000000,
+    0x3bda041f00000000, 0x9c86596d00000000, 0x014d6d4300000000,
+    0xcb15a9fd00000000, 0x56de9dd300000000, 0xf182c0a100000000,
+    0x6c49f48f00000000, 0xbf3b7a4500000000, 0x22f04e6b00000000,
+    0x85ac131900000000, 0x1867273700000000, 0xe06b776100000000,
+    0x7da0434f00000000, 0xdafc1e3d00000000, 0x47372a1300000000,
+    0x9445a4d900000000, 0x098e90f700000000, 0xaed2cd8500000000,
+    0x3319f9ab00000000, 0xf9413d1500000000, 0x648a093b00000000,
+    0xc3d6544900000000, 0x5e1d606700000000, 0x8d6feead00000000,
+    0x10a4da8300000000, 0xb7f887f100000000, 0x2a33b3df00000000,
+    0x9c2a42f100000000, 0x01e176df00000000, 0xa6bd2bad00000000,
+    0x3b761f8300000000, 0xe804914900000000, 0x75cfa56700000000,
+    0xd293f81500000000, 0x4f58cc3b00000000, 0x8500088500000000,
+    0x18cb3cab00000000, 0xbf9761d900000000, 0x225c55f700000000,
+    0xf12edb3d00000000, 0x6ce5ef1300000000, 0xcbb9b26100000000,
+    0x5672864f00000000, 0xae7ed61900000000, 0x33b5e23700000000,
+    0x94e9bf4500000000, 0x09228b6b00000000, 0xda5005a100000000,
+    0x479b318f00000000, 0xe0c76cfd00000000, 0x7d0c58d300000000,
+    0xb7549c6d00000000, 0x2a9fa84300000000, 0x8dc3f53100000000,
+    0x1008c11f00000000, 0xc37a4fd500000000, 0x5eb17bfb00000000,
+    0xf9ed268900000000, 0x642612a700000000, 0x09f4862500000000,
+    0x943fb20b00000000, 0x3363ef7900000000, 0xaea8db5700000000,
+    0x7dda559d00000000, 0xe01161b300000000, 0x474d3cc100000000,
+    0xda8608ef00000000, 0x10decc5100000000, 0x8d15f87f00000000,
+    0x2a49a50d00000000, 0xb782912300000000, 0x64f01fe900000000,
+    0xf93b2bc700000000, 0x5e6776b500000000, 0xc3ac429b00000000,
+    0x3ba012cd00000000, 0xa66b26e300000000, 0x01377b9100000000,
+    0x9cfc4fbf00000000, 0x4f8ec17500000000, 0xd245f55b00000000,
+    0x7519a82900000000, 0xe8d29c0700000000, 0x228a58b900000000,
+    0xbf416c9700000000, 0x181d31e500000000, 0x85d605cb00000000,
+    0x56a48b0100000000, 0xcb6fbf2f00000000, 0x6c33e25d00000000,
+    0xf1f8d67300000000},
+   {0x0000000000000000, 0x0f84ae2d00000000, 0x1e085d5b00000000,
+    0x118cf37600000000, 0x3c10bab600000000, 0x3394149b00000000,
+    0x2218e7ed00000000, 0x2d9c49c000000000, 0x8956986800000000,
+    0x86d2364500000000, 0x975ec53300000000, 0x98da6b1e00000000,
+    0xb54622de00000000, 0xbac28cf300000000, 0xab4e7f8500000000,
+    0xa4cad1a800000000, 0x12ad30d100000000, 0x1d299efc00000000,
+    0x0ca56d8a00000000, 0x0321c3a700000000, 0x2ebd8a6700000000,
+    0x2139244a00000000, 0x30b5d73c00000000, 0x3f31791100000000,
+    0x9bfba8b900000000, 0x947f069400000000, 0x85f3f5e200000000,
+    0x8a775bcf00000000, 0xa7eb120f00000000, 0xa86fbc2200000000,
+    0xb9e34f5400000000, 0xb667e17900000000, 0xd52c8da700000000,
+    0xdaa8238a00000000, 0xcb24d0fc00000000, 0xc4a07ed100000000,
+    0xe93c371100000000, 0xe6b8993c00000000, 0xf7346a4a00000000,
+    0xf8b0c46700000000, 0x5c7a15cf00000000, 0x53febbe200000000,
+    0x4272489400000000, 0x4df6e6b900000000, 0x606aaf7900000000,
+    0x6fee015400000000, 0x7e62f22200000000, 0x71e65c0f00000000,
+    0xc781bd7600000000, 0xc805135b00000000, 0xd989e02d00000000,
+    0xd60d4e0000000000, 0xfb9107c000000000, 0xf415a9ed00000000,
+    0xe5995a9b00000000, 0xea1df4b600000000, 0x4ed7251e00000000,
+    0x41538b3300000000, 0x50df784500000000, 0x5f5bd66800000000,
+    0x72c79fa800000000, 0x7d43318500000000, 0x6ccfc2f300000000,
+    0x634b6cde00000000, 0x5b2ff64a00000000, 0x54ab586700000000,
+    0x4527ab1100000000, 0x4aa3053c00000000, 0x673f4cfc00000000,
+    0x68bbe2d100000000, 0x793711a700000000, 0x76b3bf8a00000000,
+    0xd2796e2200000000, 0xddfdc00f00000000, 0xcc71337900000000,
+    0xc3f59d5400000000, 0xee69d49400000000, 0xe1ed7ab900000000,
+    0xf06189cf00000000, 0xffe527e200000000, 0x4982c69b00000000,
+    0x460668b600000000, 0x578a9bc000000000, 0x580e35ed00000000,
+    0x75927c2d00000000, 0x7a16d20000000000, 0x6b9a217600000000,
+    0x641e8f5b00000000, 0xc0d45ef300000000, 0xcf50f0de00000000,
+    0xdedc03a800000000, 0xd158ad8500000000, 0xfcc4e44500000000,
+    0xf3404a6800000000, 0xe2ccb91e00000000, 0xed48173300000000,
+    0x8e037bed00000000, 0x8187d5c000000000, 0x900b26b600000000,
+    0x9f8f889b00000000, 0xb213c15b00000000, 0xbd976f7600000000,
+    0xac1b9c0000000000, 0xa39f322d00000000, 0x0755e38500000000,
+    0x08d14da800000000, 0x195dbede00000000, 0x16d910f300000000,
+    0x3b45593300000000, 0x34c1f71e00000000, 0x254d046800000000,
+    0x2ac9aa4500000000, 0x9cae4b3c00000000, 0x932ae51100000000,
+    0x82a6166700000000, 0x8d22b84a00000000, 0xa0bef18a00000000,
+    0xaf3a5fa700000000, 0xbeb6acd100000000, 0xb13202fc00000000,
+    0x15f8d35400000000, 0x1a7c7d7900000000, 0x0bf08e0f00000000,
+    0x0474202200000000, 0x29e869e200000000, 0x266cc7cf00000000,
+    0x37e034b900000000, 0x38649a9400000000, 0xb65eec9500000000,
+    0xb9da42b800000000, 0xa856b1ce00000000, 0xa7d21fe300000000,
+    0x8a4e562300000000, 0x85caf80e00000000, 0x94460b7800000000,
+    0x9bc2a55500000000, 0x3f0874fd00000000, 0x308cdad000000000,
+    0x210029a600000000, 0x2e84878b00000000, 0x0318ce4b00000000,
+    0x0c9c606600000000, 0x1d10931000000000, 0x12943d3d00000000,
+    0xa4f3dc4400000000, 0xab77726900000000, 0xbafb811f00000000,
+    0xb57f2f3200000000, 0x98e366f200000000, 0x9767c8df00000000,
+    0x86eb3ba900000000, 0x896f958400000000, 0x2da5442c00000000,
+    0x2221ea0100000000, 0x33ad197700000000, 0x3c29b75a00000000,
+    0x11b5fe9a00000000, 0x1e3150b700000000, 0x0fbda3c100000000,
+    0x00390dec00000000, 0x6372613200000000, 0x6cf6cf1f00000000,
+    0x7d7a3c6900000000, 0x72fe924400000000, 0x5f62db8400000000,
+    0x50e675a900000000, 0x416a86df00000000, 0x4eee28f200000000,
+    0xea24f95a00000000, 0xe5a0577700000000, 0xf42ca40100000000,
+    0xfba80a2c00000000, 0xd63443ec00000000, 0xd9b0edc100000000,
+    0xc83c1eb700000000, 0xc7b8b09a00000000, 0x71df51e300000000,
+    0x7e5bffce00000000, 0x6fd70cb800000000, 0x6053a29500000000,
+    0x4dcfeb5500000000, 0x424b457800000000, 0x53c7b60e00000000,
+    0x5c43182300000000, 0xf889c98b00000000, 0xf70d67a600000000,
+    0xe68194d000000000, 0xe9053afd00000000, 0xc499733d00000000,
+    0xcb1ddd1000000000, 0xda912e6600000000, 0xd515804b00000000,
+    0xed711adf00000000, 0xe2f5b4f200000000, 0xf379478400000000,
+    0xfcfde9a900000000, 0xd161a06900000000, 0xdee50e4400000000,
+    0xcf69fd3200000000, 0xc0ed531f00000000, 0x642782b700000000,
+    0x6ba32c9a00000000, 0x7a2fdfec00000000, 0x75ab71c100000000,
+    0x5837380100000000, 0x57b3962c00000000, 0x463f655a00000000,
+    0x49bbcb7700000000, 0xffdc2a0e00000000, 0xf058842300000000,
+    0xe1d4775500000000, 0xee50d97800000000, 0xc3cc90b800000000,
+    0xcc483e9500000000, 0xddc4cde300000000, 0xd24063ce00000000,
+    0x768ab26600000000, 0x790e1c4b00000000, 0x6882ef3d00000000,
+    0x6706411000000000, 0x4a9a08d000000000, 0x451ea6fd00000000,
+    0x5492558b00000000, 0x5b16fba600000000, 0x385d977800000000,
+    0x37d9395500000000, 0x2655ca2300000000, 0x29d1640e00000000,
+    0x044d2dce00000000, 0x0bc983e300000000, 0x1a45709500000000,
+    0x15c1deb800000000, 0xb10b0f1000000000, 0xbe8fa13d00000000,
+    0xaf03524b00000000, 0xa087fc6600000000, 0x8d1bb5a600000000,
+    0x829f1b8b00000000, 0x9313e8fd00000000, 0x9c9746d000000000,
+    0x2af0a7a900000000, 0x2574098400000000, 0x34f8faf200000000,
+    0x3b7c54df00000000, 0x16e01d1f00000000, 0x1964b33200000000,
+    0x08e8404400000000, 0x076cee6900000000, 0xa3a63fc100000000,
+    0xac2291ec00000000, 0xbdae629a00000000, 0xb22accb700000000,
+    0x9fb6857700000000, 0x90322b5a00000000, 0x81bed82c00000000,
+    0x8e3a760100000000},
+   {0x0000000000000000, 0xa0923e5e00000000, 0x40257dbc00000000,
+    0xe0b743e200000000, 0x713c167d00000000, 0xd1ae282300000000,
+    0x31196bc100000000, 0x918b559f00000000, 0xe2782cfa00000000,
+    0x42ea12a400000000, 0xa25d514600000000, 0x02cf6f1800000000,
+    0x93443a8700000000, 0x33d604d900000000, 0xd361473b00000000,
+    0x73f3796500000000, 0x3587b4f100000000, 0x95158aaf00000000,
+    0x75a2c94d00000000, 0xd530f71300000000, 0x44bba28c00000000,
+    0xe4299cd200000000, 0x049edf3000000000, 0xa40ce16e00000000,
+    0xd7ff980b00000000, 0x776da65500000000, 0x97dae5b700000000,
+    0x3748dbe900000000, 0xa6c38e7600000000, 0x0651b02800000000,
+    0xe6e6f3ca00000000, 0x4674cd9400000000, 0x9b7885e600000000,
+    0x3beabbb800000000, 0xdb5df85a00000000, 0x7bcfc60400000000,
+    0xea44939b00000000, 0x4ad6adc500000000, 0xaa61ee2700000000,
+    0x0af3d07900000000, 0x7900a91c00000000, 0xd992974200000000,
+    0x3925d4a000000000, 0x99b7eafe00000000, 0x083cbf6100000000,
+    0xa8ae813f00000000, 0x4819c2dd00000000, 0xe88bfc8300000000,
+    0xaeff311700000000, 0x0e6d0f4900000000, 0xeeda4cab00000000,
+    0x4e4872f500000000, 0xdfc3276a00000000, 0x7f51193400000000,
+    0x9fe65ad600000000, 0x3f74648800000000, 0x4c871ded00000000,
+    0xec1523b300000000, 0x0ca2605100000000, 0xac305e0f00000000,
+    0x3dbb0b9000000000, 0x9d2935ce00000000, 0x7d9e762c00000000,
+    0xdd0c487200000000, 0xc787e6c800000000, 0x6715d89600000000,
+    0x87a29b7400000000, 0x2730a52a00000000, 0xb6bbf0b500000000,
+    0x1629ceeb00000000, 0xf69e8d0900000000, 0x560cb35700000000,
+    0x25ffca3200000000, 0x856df46c00000000, 0x65dab78e00000000,
+    0xc54889d000000000, 0x54c3dc4f00000000, 0xf451e21100000000,
+    0x14e6a1f300000000, 0xb4749fad00000000, 0xf200523900000000,
+    0x52926c6700000000, 0xb2252f8500000000, 0x12b711db00000000,
+    0x833c444400000000, 0x23ae7a1a00000000, 0xc31939f800000000,
+    0x638b07a600000000, 0x10787ec300000000, 0xb0ea409d00000000,
+    0x505d037f00000000, 0xf0cf3d2100000000, 0x614468be00000000,
+    0xc1d656e000000000, 0x2161150200000000, 0x81f32b5c00000000,
+    0x5cff632e00000000, 0xfc6d5d7000000000, 0x1cda1e9200000000,
+    0xbc4820cc00000000, 0x2dc3755300000000, 0x8d514b0d00000000,
+    0x6de608ef00000000, 0xcd7436b100000000, 0xbe874fd400000000,
+    0x1e15718a00000000, 0xfea2326800000000, 0x5e300c3600000000,
+    0xcfbb59a900000000, 0x6f2967f700000000, 0x8f9e241500000000,
+    0x2f0c1a4b00000000, 0x6978d7df00000000, 0xc9eae98100000000,
+    0x295daa6300000000, 0x89cf943d00000000, 0x1844c1a200000000,
+    0xb8d6fffc00000000, 0x5861bc1e00000000, 0xf8f3824000000000,
+    0x8b00fb2500000000, 0x2b92c57b00000000, 0xcb25869900000000,
+    0x6bb7b8c700000000, 0xfa3ced5800000000, 0x5aaed30600000000,
+    0xba1990e400000000, 0x1a8baeba00000000, 0x7f79219400000000,
+    0xdfeb1fca00000000, 0x3f5c5c2800000000, 0x9fce627600000000,
+    0x0e4537e900000000, 0xaed709b700000000, 0x4e604a5500000000,
+    0xeef2740b00000000, 0x9d010d6e00000000, 0x3d93333000000000,
+    0xdd2470d200000000, 0x7db64e8c00000000, 0xec3d1b1300000000,
+    0x4caf254d00000000, 0xac1866af00000000, 0x0c8a58f100000000,
+    0x4afe956500000000, 0xea6cab3b00000000, 0x0adbe8d900000000,
+    0xaa49d68700000000, 0x3bc2831800000000, 0x9b50bd4600000000,
+    0x7be7fea400000000, 0xdb75c0fa00000000, 0xa886b99f00000000,
+    0x081487c100000000, 0xe8a3c42300000000, 0x4831fa7d00000000,
+    0xd9baafe200000000, 0x792891bc00000000, 0x999fd25e00000000,
+    0x390dec0000000000, 0xe401a47200000000, 0x44939a2c00000000,
+    0xa424d9ce00000000, 0x04b6e79000000000, 0x953db20f00000000,
+    0x35af8c5100000000, 0xd518cfb300000000, 0x758af1ed00000000,
+    0x0679888800000000, 0xa6ebb6d600000000, 0x465cf53400000000,
+    0xe6cecb6a00000000, 0x77459ef500000000, 0xd7d7a0ab00000000,
+    0x3760e34900000000, 0x97f2dd1700000000, 0xd186108300000000,
+    0x71142edd00000000, 0x91a36d3f00000000, 0x3131536100000000,
+    0xa0ba06fe00000000, 0x002838a000000000, 0xe09f7b4200000000,
+    0x400d451c00000000, 0x33fe3c7900000000, 0x936c022700000000,
+    0x73db41c500000000, 0xd3497f9b00000000, 0x42c22a0400000000,
+    0xe250145a00000000, 0x02e757b800000000, 0xa27569e600000000,
+    0xb8fec75c00000000, 0x186cf90200000000, 0xf8dbbae000000000,
+    0x584984be00000000, 0xc9c2d12100000000, 0x6950ef7f00000000,
+    0x89e7ac9d00000000, 0x297592c300000000, 0x5a86eba600000000,
+    0xfa14d5f800000000, 0x1aa3961a00000000, 0xba31a84400000000,
+    0x2bbafddb00000000, 0x8b28c38500000000, 0x6b9f806700000000,
+    0xcb0dbe3900000000, 0x8d7973ad00000000, 0x2deb4df300000000,
+    0xcd5c0e1100000000, 0x6dce304f00000000, 0xfc4565d000000000,
+    0x5cd75b8e00000000, 0xbc60186c00000000, 0x1cf2263200000000,
+    0x6f015f5700000000, 0xcf93610900000000, 0x2f2422eb00000000,
+    0x8fb61cb500000000, 0x1e3d492a00000000, 0xbeaf777400000000,
+    0x5e18349600000000, 0xfe8a0ac800000000, 0x238642ba00000000,
+    0x83147ce400000000, 0x63a33f0600000000, 0xc331015800000000,
+    0x52ba54c700000000, 0xf2286a9900000000, 0x129f297b00000000,
+    0xb20d172500000000, 0xc1fe6e4000000000, 0x616c501e00000000,
+    0x81db13fc00000000, 0x21492da200000000, 0xb0c2783d00000000,
+    0x1050466300000000, 0xf0e7058100000000, 0x50753bdf00000000,
+    0x1601f64b00000000, 0xb693c81500000000, 0x56248bf700000000,
+    0xf6b6b5a900000000, 0x673de03600000000, 0xc7afde6800000000,
+    0x27189d8a00000000, 0x878aa3d400000000, 0xf479dab100000000,
+    0x54ebe4ef00000000, 0xb45ca70d00000000, 0x14ce995300000000,
+    0x8545cccc00000000, 0x25d7f29200000000, 0xc560b17000000000,
+    0x65f28f2e00000000},
+   {0x0000000000000000, 0x348b15a200000000, 0x9960c74100000000,
+    0xadebd2e300000000, 0x32c18e8300000000, 0x064a9b2100000000,
+    0xaba149c200000000, 0x9f2a5c6000000000, 0x95f4f10200000000,
+    0xa17fe4a000000000, 0x0c94364300000000, 0x381f23e100000000,
+    0xa7357f8100000000, 0x93be6a2300000000, 0x3e55b8c000000000,
+    0x0adead6200000000, 0x2ae9e30500000000, 0x1e62f6a700000000,
+    0xb389244400000000, 0x870231e600000000, 0x18286d8600000000,
+    0x2ca3782400000000, 0x8148aac700000000, 0xb5c3bf6500000000,
+    0xbf1d120700000000, 0x8b9607a500000000, 0x267dd54600000000,
+    0x12f6c0e400000000, 0x8ddc9c8400000000, 0xb957892600000000,
+    0x14bc5bc500000000, 0x20374e6700000000, 0x54d2c70b00000000,
+    0x6059d2a900000000, 0xcdb2004a00000000, 0xf93915e800000000,
+    0x6613498800000000, 0x52985c2a00000000, 0xff738ec900000000,
+    0xcbf89b6b00000000, 0xc126360900000000, 0xf5ad23ab00000000,
+    0x5846f14800000000, 0x6ccde4ea00000000, 0xf3e7b88a00000000,
+    0xc76cad2800000000, 0x6a877fcb00000000, 0x5e0c6a6900000000,
+    0x7e3b240e00000000, 0x4ab031ac00000000, 0xe75be34f00000000,
+    0xd3d0f6ed00000000, 0x4cfaaa8d00000000, 0x7871bf2f00000000,
+    0xd59a6dcc00000000, 0xe111786e00000000, 0xebcfd50c00000000,
+    0xdf44c0ae00000000, 0x72af124d00000000, 0x462407ef00000000,
+    0xd90e5b8f00000000, 0xed854e2d00000000, 0x406e9cce00000000,
+    0x74e5896c00000000, 0xa8a48f1700000000, 0x9c2f9ab500000000,
+    0x31c4485600000000, 0x054f5df400000000, 0x9a65019400000000,
+    0xaeee143600000000, 0x0305c6d500000000, 0x378ed37700000000,
+    0x3d507e1500000000, 0x09db6bb700000000, 0xa430b95400000000,
+    0x90bbacf600000000, 0x0f91f09600000000, 0x3b1ae53400000000,
+    0x96f137d700000000, 0xa27a227500000000, 0x824d6c1200000000,
+    0xb6c679b000000000, 0x1b2dab5300000000, 0x2fa6bef100000000,
+    0xb08ce29100000000, 0x8407f73300000000, 0x29ec25d000000000,
+    0x1d67307200000000, 0x17b99d1000000000, 0x233288b200000000,
+    0x8ed95a5100000000, 0xba524ff300000000, 0x2578139300000000,
+    0x11f3063100000000, 0xbc18d4d200000000, 0x8893c17000000000,
+    0xfc76481c00000000, 0xc8fd5dbe00000000, 0x65168f5d00000000,
+    0x519d9aff00000000, 0xceb7c69f00000000, 0xfa3cd33d00000000,
+    0x57d701de00000000, 0x635c147c00000000, 0x6982b91e00000000,
+    0x5d09acbc00000000, 0xf0e27e5f00000000, 0xc4696bfd00000000,
+    0x5b43379d00000000, 0x6fc8223f00000000, 0xc223f0dc00000000,
+    0xf6a8e57e00000000, 0xd69fab1900000000, 0xe214bebb00000000,
+    0x4fff6c5800000000, 0x7b7479fa00000000, 0xe45e259a00000000,
+    0xd0d5303800000000, 0x7d3ee2db00000000, 0x49b5f77900000000,
+    0x436b5a1b00000000, 0x77e04fb900000000, 0xda0b9d5a00000000,
+    0xee8088f800000000, 0x71aad49800000000, 0x4521c13a00000000,
+    0xe8ca13d900000000, 0xdc41067b00000000, 0x50491f2f00000000,
+    0x64c20a8d00000000, 0xc929d86e00000000, 0xfda2cdcc00000000,
+    0x628891ac00000000, 0x5603840e00000000, 0xfbe856ed00000000,
+    0xcf63434f00000000, 0xc5bdee2d00000000, 0xf136fb8f00000000,
+    0x5cdd296c00000000, 0x68563cce00000000, 0xf77c60ae00000000,
+    0xc3f7750c00000000, 0x6e1ca7ef00000000, 0x5a97b24d00000000,
+    0x7aa0fc2a00000000, 0x4e2be98800000000, 0xe3c03b6b00000000,
+    0xd74b2ec900000000, 0x486172a900000000, 0x7cea670b00000000,
+    0xd101b5e800000000, 0xe58aa04a00000000, 0xef540d2800000000,
+    0xdbdf188a00000000, 0x7634ca6900000000, 0x42bfdfcb00000000,
+    0xdd9583ab00000000, 0xe91e960900000000, 0x44f544ea00000000,
+    0x707e514800000000, 0x049bd82400000000, 0x3010cd8600000000,
+    0x9dfb1f6500000000, 0xa9700ac700000000, 0x365a56a700000000,
+    0x02d1430500000000, 0xaf3a91e600000000, 0x9bb1844400000000,
+    0x916f292600000000, 0xa5e43c8400000000, 0x080fee6700000000,
+    0x3c84fbc500000000, 0xa3aea7a500000000, 0x9725b20700000000,
+    0x3ace60e400000000, 0x0e45754600000000, 0x2e723b2100000000,
+    0x1af92e8300000000, 0xb712fc6000000000, 0x8399e9c200000000,
+    0x1cb3b5a200000000, 0x2838a00000000000, 0x85d372e300000000,
+    0xb158674100000000, 0xbb86ca2300000000, 0x8f0ddf8100000000,
+    0x22e60d6200000000, 0x166d18c000000000, 0x894744a000000000,
+    0xbdcc510200000000, 0x102783e100000000, 0x24ac964300000000,
+    0xf8ed903800000000, 0xcc66859a00000000, 0x618d577900000000,
+    0x550642db00000000, 0xca2c1ebb00000000, 0xfea70b1900000000,
+    0x534cd9fa00000000, 0x67c7cc5800000000, 0x6d19613a00000000,
+    0x5992749800000000, 0xf479a67b00000000, 0xc0f2b3d900000000,
+    0x5fd8efb900000000, 0x6b53fa1b00000000, 0xc6b828f800000000,
+    0xf2333d5a00000000, 0xd204733d00000000, 0xe68f669f00000000,
+    0x4b64b47c00000000, 0x7fefa1de00000000, 0xe0c5fdbe00000000,
+    0xd44ee81c00000000, 0x79a53aff00000000, 0x4d2e2f5d00000000,
+    0x47f0823f00000000, 0x737b979d00000000, 0xde90457e00000000,
+    0xea1b50dc00000000, 0x75310cbc00000000, 0x41ba191e00000000,
+    0xec51cbfd00000000, 0xd8dade5f00000000, 0xac3f573300000000,
+    0x98b4429100000000, 0x355f907200000000, 0x01d485d000000000,
+    0x9efed9b000000000, 0xaa75cc1200000000, 0x079e1ef100000000,
+    0x33150b5300000000, 0x39cba63100000000, 0x0d40b39300000000,
+    0xa0ab617000000000, 0x942074d200000000, 0x0b0a28b200000000,
+    0x3f813d1000000000, 0x926aeff300000000, 0xa6e1fa5100000000,
+    0x86d6b43600000000, 0xb25da19400000000, 0x1fb6737700000000,
+    0x2b3d66d500000000, 0xb4173ab500000000, 0x809c2f1700000000,
+    0x2d77fdf400000000, 0x19fce85600000000, 0x1322453400000000,
+    0x27a9509600000000, 0x8a42827500000000, 0xbec997d700000000,
+    0x21e3cbb700000000, 0x1568de1500000000, 0xb8830cf600000000,
+    0x8c08195400000000},
+   {0x0000000000000000, 0x25cbdbf700000000, 0xbbe05bea00000000,
+    0x9e2b801d00000000, 0x87b75bd100000000, 0xa27c802600000000,
+    0x3c57003b00000000, 0x199cdbcc00000000, 0xff195ba700000000,
+    0xdad2805000000000, 0x44f9004d00000000, 0x6132dbba00000000,
+    0x78ae007600000000, 0x5d65db8100000000, 0xc34e5b9c00000000,
+    0xe685806b00000000, 0x0f455a4b00000000, 0x2a8e81bc00000000,
+    0xb4a501a100000000, 0x916eda5600000000, 0x88f2019a00000000,
+    0xad39da6d00000000, 0x33125a7000000000, 0x16d9818700000000,
+    0xf05c01ec00000000, 0xd597da1b00000000, 0x4bbc5a0600000000,
+    0x6e7781f100000000, 0x77eb5a3d00000000, 0x522081ca00000000,
+    0xcc0b01d700000000, 0xe9c0da2000000000, 0x1e8ab49600000000,
+    0x3b416f6100000000, 0xa56aef7c00000000, 0x80a1348b00000000,
+    0x993def4700000000, 0xbcf634b000000000, 0x22ddb4ad00000000,
+    0x07166f5a00000000, 0xe193ef3100000000, 0xc45834c600000000,
+    0x5a73b4db00000000, 0x7fb86f2c00000000, 0x6624b4e000000000,
+    0x43ef6f1700000000, 0xddc4ef0a00000000, 0xf80f34fd00000000,
+    0x11cfeedd00000000, 0x3404352a00000000, 0xaa2fb53700000000,
+    0x8fe46ec000000000, 0x9678b50c00000000, 0xb3b36efb00000000,
+    0x2d98eee600000000, 0x0853351100000000, 0xeed6b57a00000000,
+    0xcb1d6e8d00000000, 0x5536ee9000000000, 0x70fd356700000000,
+    0x6961eeab00000000, 0x4caa355c00000000, 0xd281b54100000000,
+    0xf74a6eb600000000, 0xcd62852800000000, 0xe8a95edf00000000,
+    0x7682dec200000000, 0x5349053500000000, 0x4ad5def900000000,
+    0x6f1e050e00000000, 0xf135851300000000, 0xd4fe5ee400000000,
+    0x327bde8f00000000, 0x17b0057800000000, 0x899b856500000000,
+    0xac505e9200000000, 0xb5cc855e00000000, 0x90075ea900000000,
+    0x0e2cdeb400000000, 0x2be7054300000000, 0xc227df6300000000,
+    0xe7ec049400000000, 0x79c7848900000000, 0x5c0c5f7e00000000,
+    0x459084b200000000, 0x605b5f4500000000, 0xfe70df5800000000,
+    0xdbbb04af00000000, 0x3d3e84c400000000, 0x18f55f3300000000,
+    0x86dedf2e00000000, 0xa31504d900000000, 0xba89df1500000000,
+    0x9f4204e200000000, 0x016984ff00000000, 0x24a25f0800000000,
+    0xd3e831be00000000, 0xf623ea4900000000, 0x68086a5400000000,
+    0x4dc3b1a300000000, 0x545f6a6f00000000, 0x7194b19800000000,
+    0xefbf318500000000, 0xca74ea7200000000, 0x2cf16a1900000000,
+    0x093ab1ee00000000, 0x971131f300000000, 0xb2daea0400000000,
+    0xab4631c800000000, 0x8e8dea3f00000000, 0x10a66a2200000000,
+    0x356db1d500000000, 0xdcad6bf500000000, 0xf966b00200000000,
+    0x674d301f00000000, 0x4286ebe800000000, 0x5b1a302400000000,
+    0x7ed1ebd300000000, 0xe0fa6bce00000000, 0xc531b03900000000,
+    0x23b4305200000000, 0x067feba500000000, 0x98546bb800000000,
+    0xbd9fb04f00000000, 0xa4036b8300000000, 0x81c8b07400000000,
+    0x1fe3306900000000, 0x3a28eb9e00000000, 0x9ac50a5100000000,
+    0xbf0ed1a600000000, 0x212551bb00000000, 0x04ee8a4c00000000,
+    0x1d72518000000000, 0x38b98a7700000000, 0xa6920a6a00000000,
+    0x8359d19d00000000, 0x65dc51f600000000, 0x40178a0100000000,
+    0xde3c0a1c00000000, 0xfbf7d1eb00000000, 0xe26b0a2700000000,
+    0xc7a0d1d000000000, 0x598b51cd00000000, 0x7c408a3a00000000,
+    0x9580501a00000000, 0xb04b8bed00000000, 0x2e600bf000000000,
+    0x0babd00700000000, 0x12370bcb00000000, 0x37fcd03c00000000,
+    0xa9d7502100000000, 0x8c1c8bd600000000, 0x6a990bbd00000000,
+    0x4f52d04a00000000, 0xd179505700000000, 0xf4b28ba000000000,
+    0xed2e506c00000000, 0xc8e58b9b00000000, 0x56ce0b8600000000,
+    0x7305d07100000000, 0x844fbec700000000, 0xa184653000000000,
+    0x3fafe52d00000000, 0x1a643eda00000000, 0x03f8e51600000000,
+    0x26333ee100000000, 0xb818befc00000000, 0x9dd3650b00000000,
+    0x7b56e56000000000, 0x5e9d3e9700000000, 0xc0b6be8a00000000,
+    0xe57d657d00000000, 0xfce1beb100000000, 0xd92a654600000000,
+    0x4701e55b00000000, 0x62ca3eac00000000, 0x8b0ae48c00000000,
+    0xaec13f7b00000000, 0x30eabf6600000000, 0x1521649100000000,
+    0x0cbdbf5d00000000, 0x297664aa00000000, 0xb75de4b700000000,
+    0x92963f4000000000, 0x7413bf2b00000000, 0x51d864dc00000000,
+    0xcff3e4c100000000, 0xea383f3600000000, 0xf3a4e4fa00000000,
+    0xd66f3f0d00000000, 0x4844bf1000000000, 0x6d8f64e700000000,
+    0x57a78f7900000000, 0x726c548e00000000, 0xec47d49300000000,
+    0xc98c0f6400000000, 0xd010d4a800000000, 0xf5db0f5f00000000,
+    0x6bf08f4200000000, 0x4e3b54b500000000, 0xa8bed4de00000000,
+    0x8d750f2900000000, 0x135e8f3400000000, 0x369554c300000000,
+    0x2f098f0f00000000, 0x0ac254f800000000, 0x94e9d4e500000000,
+    0xb1220f1200000000, 0x58e2d53200000000, 0x7d290ec500000000,
+    0xe3028ed800000000, 0xc6c9552f00000000, 0xdf558ee300000000,
+    0xfa9e551400000000, 0x64b5d50900000000, 0x417e0efe00000000,
+    0xa7fb8e9500000000, 0x8230556200000000, 0x1c1bd57f00000000,
+    0x39d00e8800000000, 0x204cd54400000000, 0x05870eb300000000,
+    0x9bac8eae00000000, 0xbe67555900000000, 0x492d3bef00000000,
+    0x6ce6e01800000000, 0xf2cd600500000000, 0xd706bbf200000000,
+    0xce9a603e00000000, 0xeb51bbc900000000, 0x757a3bd400000000,
+    0x50b1e02300000000, 0xb634604800000000, 0x93ffbbbf00000000,
+    0x0dd43ba200000000, 0x281fe05500000000, 0x31833b9900000000,
+    0x1448e06e00000000, 0x8a63607300000000, 0xafa8bb8400000000,
+    0x466861a400000000, 0x63a3ba5300000000, 0xfd883a4e00000000,
+    0xd843e1b900000000, 0xc1df3a7500000000, 0xe414e18200000000,
+    0x7a3f619f00000000, 0x5ff4ba6800000000, 0xb9713a0300000000,
+    0x9cbae1f400000000, 0x029161e900000000, 0x275aba1e00000000,
+    0x3ec661d200000000, 0x1b0dba2500000000, 0x85263a3800000000,
+    0xa0ede1cf00000000},
+   {0x0000000000000000, 0x0941bb1500000000, 0x1282762b00000000,
+    0x1bc3cd3e00000000, 0x2404ed5600000000, 0x2d45564300000000,
+    0x36869b7d00000000, 0x3fc7206800000000, 0x4808daad00000000,
+    0x414961b800000000, 0x5a8aac8600000000, 0x53cb179300000000,
+    0x6c0c37fb00000000, 0x654d8cee00000000, 0x7e8e41d000000000,
+    0x77cffac500000000, 0x6166585e00000000, 0x6827e34b00000000,
+    0x73e42e7500000000, 0x7aa5956000000000, 0x4562b50800000000,
+    0x4c230e1d00000000, 0x57e0c32300000000, 0x5ea1783600000000,
+    0x296e82f300000000, 0x202f39e600000000, 0x3becf4d800000000,
+    0x32ad4fcd00000000, 0x0d6a6fa500000000, 0x042bd4b000000000,
+    0x1fe8198e00000000, 0x16a9a29b00000000, 0xc2ccb0bc00000000,
+    0xcb8d0ba900000000, 0xd04ec69700000000, 0xd90f7d8200000000,
+    0xe6c85dea00000000, 0xef89e6ff00000000, 0xf44a2bc100000000,
+    0xfd0b90d400000000, 0x8ac46a1100000000, 0x8385d10400000000,
+    0x98461c3a00000000, 0x9107a72f00000000, 0xaec0874700000000,
+    0xa7813c5200000000, 0xbc42f16c00000000, 0xb5034a7900000000,
+    0xa3aae8e200000000, 0xaaeb53f700000000, 0xb1289ec900000000,
+    0xb86925dc00000000, 0x87ae05b400000000, 0x8eefbea100000000,
+    0x952c739f00000000, 0x9c6dc88a00000000, 0xeba2324f00000000,
+    0xe2e3895a00000000, 0xf920446400000000, 0xf061ff7100000000,
+    0xcfa6df1900000000, 0xc6e7640c00000000, 0xdd24a93200000000,
+    0xd465122700000000, 0x75ef8d7c00000000, 0x7cae366900000000,
+    0x676dfb5700000000, 0x6e2c404200000000, 0x51eb602a00000000,
+    0x58aadb3f00000000, 0x4369160100000000, 0x4a28ad1400000000,
+    0x3de757d100000000, 0x34a6ecc400000000, 0x2f6521fa00000000,
+    0x26249aef00000000, 0x19e3ba8700000000, 0x10a2019200000000,
+    0x0b61ccac00000000, 0x022077b900000000, 0x1489d52200000000,
+    0x1dc86e3700000000, 0x060ba30900000000, 0x0f4a181c00000000,
+    0x308d387400000000, 0x39cc836100000000, 0x220f4e5f00000000,
+    0x2b4ef54a00000000, 0x5c810f8f00000000, 0x55c0b49a00000000,
+    0x4e0379a400000000, 0x4742c2b100000000, 0x7885e2d900000000,
+    0x71c459cc00000000, 0x6a0794f200000000, 0x63462fe700000000,
+    0xb7233dc000000000, 0xbe6286d500000000, 0xa5a14beb00000000,
+    0xace0f0fe00000000, 0x9327d09600000000, 0x9a666b8300000000,
+    0x81a5a6bd00000000, 0x88e41da800000000, 0xff2be76d00000000,
+    0xf66a5c7800000000, 0xeda9914600000000, 0xe4e82a5300000000,
+    0xdb2f0a3b00000000, 0xd26eb12e00000000, 0xc9ad7c1000000000,
+    0xc0ecc70500000000, 0xd645659e00000000, 0xdf04de8b00000000,
+    0xc4c713b500000000, 0xcd86a8a000000000, 0xf24188c800000000,
+    0xfb0033dd00000000, 0xe0c3fee300000000, 0xe98245f600000000,
+    0x9e4dbf3300000000, 0x970c042600000000, 0x8ccfc91800000000,
+    0x858e720d00000000, 0xba49526500000000, 0xb308e97000000000,
+    0xa8cb244e00000000, 0xa18a9f5b00000000, 0xeade1bf900000000,
+    0xe39fa0ec00000000, 0xf85c6dd200000000, 0xf11dd6c700000000,
+    0xcedaf6af00000000, 0xc79b4dba00000000, 0xdc58808400000000,
+    0xd5193b9100000000, 0xa2d6c15400000000, 0xab977a4100000000,
+    0xb054b77f00000000, 0xb9150c6a00000000, 0x86d22c0200000000,
+    0x8f93971700000000, 0x94505a2900000000, 0x9d11e13c00000000,
+    0x8bb843a700000000, 0x82f9f8b200000000, 0x993a358c00000000,
+    0x907b8e9900000000, 0xafbcaef100000000, 0xa6fd15e400000000,
+    0xbd3ed8da00000000, 0xb47f63cf00000000, 0xc3b0990a00000000,
+    0xcaf1221f00000000, 0xd132ef2100000000, 0xd873543400000000,
+    0xe7b4745c00000000, 0xeef5cf4900000000, 0xf536027700000000,
+    0xfc77b96200000000, 0x2812ab4500000000, 0x2153105000000000,
+    0x3a90dd6e00000000, 0x33d1667b00000000, 0x0c16461300000000,
+    0x0557fd0600000000, 0x1e94303800000000, 0x17d58b2d00000000,
+    0x601a71e800000000, 0x695bcafd00000000, 0x729807c300000000,
+    0x7bd9bcd600000000, 0x441e9cbe00000000, 0x4d5f27ab00000000,
+    0x569cea9500000000, 0x5fdd518000000000, 0x4974f31b00000000,
+    0x4035480e00000000, 0x5bf6853000000000, 0x52b73e2500000000,
+    0x6d701e4d00000000, 0x6431a55800000000, 0x7ff2686600000000,
+    0x76b3d37300000000, 0x017c29b600000000, 0x083d92a300000000,
+    0x13fe5f9d00000000, 0x1abfe48800000000, 0x2578c4e000000000,
+    0x2c397ff500000000, 0x37fab2cb00000000, 0x3ebb09de00000000,
+    0x9f31968500000000, 0x96702d9000000000, 0x8db3e0ae00000000,
+    0x84f25bbb00000000, 0xbb357bd300000000, 0xb274c0c600000000,
+    0xa9b70df800000000, 0xa0f6b6ed00000000, 0xd7394c2800000000,
+    0xde78f73d00000000, 0xc5bb3a0300000000, 0xccfa811600000000,
+    0xf33da17e00000000, 0xfa7c1a6b00000000, 0xe1bfd75500000000,
+    0xe8fe6c4000000000, 0xfe57cedb00000000, 0xf71675ce00000000,
+    0xecd5b8f000000000, 0xe59403e500000000, 0xda53238d00000000,
+    0xd312989800000000, 0xc8d155a600000000, 0xc190eeb300000000,
+    0xb65f147600000000, 0xbf1eaf6300000000, 0xa4dd625d00000000,
+    0xad9cd94800000000, 0x925bf92000000000, 0x9b1a423500000000,
+    0x80d98f0b00000000, 0x8998341e00000000, 0x5dfd263900000000,
+    0x54bc9d2c00000000, 0x4f7f501200000000, 0x463eeb0700000000,
+    0x79f9cb6f00000000, 0x70b8707a00000000, 0x6b7bbd4400000000,
+    0x623a065100000000, 0x15f5fc9400000000, 0x1cb4478100000000,
+    0x07778abf00000000, 0x0e3631aa00000000, 0x31f111c200000000,
+    0x38b0aad700000000, 0x237367e900000000, 0x2a32dcfc00000000,
+    0x3c9b7e6700000000, 0x35dac57200000000, 0x2e19084c00000000,
+    0x2758b35900000000, 0x189f933100000000, 0x11de282400000000,
+    0x0a1de51a00000000, 0x035c5e0f00000000, 0x7493a4ca00000000,
+    0x7dd21fdf00000000, 0x6611d2e100000000, 0x6f5069f400000000,
+    0x5097499c00000000, 0x59d6f28900000000, 0x42153fb700000000,
+    0x4b5484a200000000},
+   {0x0000000000000000, 0x8d60a77800000000, 0x1ac14ef100000000,
+    0x97a1e98900000000, 0xc5f471e700000000, 0x4894d69f00000000,
+    0xdf353f1600000000, 0x5255986e00000000, 0x7b9f0fcb00000000,
+    0xf6ffa8b300000000, 0x615e413a00000000, 0xec3ee64200000000,
+    0xbe6b7e2c00000000, 0x330bd95400000000, 0xa4aa30dd00000000,
+    0x29ca97a500000000, 0x0748f39300000000, 0x8a2854eb00000000,
+    0x1d89bd6200000000, 0x90e91a1a00000000, 0xc2bc827400000000,
+    0x4fdc250c00000000, 0xd87dcc8500000000, 0x551d6bfd00000000,
+    0x7cd7fc5800000000, 0xf1b75b2000000000, 0x6616b2a900000000,
+    0xeb7615d100000000, 0xb9238dbf00000000, 0x34432ac700000000,
+    0xa3e2c34e00000000, 0x2e82643600000000, 0xffe60a2200000000,
+    0x7286ad5a00000000, 0xe52744d300000000, 0x6847e3ab00000000,
+    0x3a127bc500000000, 0xb772dcbd00000000, 0x20d3353400000000,
+    0xadb3924c00000000, 0x847905e900000000, 0x0919a29100000000,
+    0x9eb84b1800000000, 0x13d8ec6000000000, 0x418d740e00000000,
+    0xccedd37600000000, 0x5b4c3aff00000000, 0xd62c9d8700000000,
+    0xf8aef9b100000000, 0x75ce5ec900000000, 0xe26fb74000000000,
+    0x6f0f103800000000, 0x3d5a885600000000, 0xb03a2f2e00000000,
+    0x279bc6a700000000, 0xaafb61df00000000, 0x8331f67a00000000,
+    0x0e51510200000000, 0x99f0b88b00000000, 0x14901ff300000000,
+    0x46c5879d00000000, 0xcba520e500000000, 0x5c04c96c00000000,
+    0xd1646e1400000000, 0xfecd154400000000, 0x73adb23c00000000,
+    0xe40c5bb500000000, 0x696cfccd00000000, 0x3b3964a300000000,
+    0xb659c3db00000000, 0x21f82a5200000000, 0xac988d2a00000000,
+    0x85521a8f00000000, 0x0832bdf700000000, 0x9f93547e00000000,
+    0x12f3f30600000000, 0x40a66b6800000000, 0xcdc6cc1000000000,
+    0x5a67259900000000, 0xd70782e100000000, 0xf985e6d700000000,
+    0x74e541af00000000, 0xe344a82600000000, 0x6e240f5e00000000,
+    0x3c71973000000000, 0xb111304800000000, 0x26b0d9c100000000,
+    0xabd07eb900000000, 0x821ae91c00000000, 0x0f7a4e6400000000,
+    0x98dba7ed00000000, 0x15bb009500000000, 0x47ee98fb00000000,
+    0xca8e3f8300000000, 0x5d2fd60a00000000, 0xd04f717200000000,
+    0x012b1f6600000000, 0x8c4bb81e00000000, 0x1bea519700000000,
+    0x968af6ef00000000, 0xc4df6e8100000000, 0x49bfc9f900000000,
+    0xde1e207000000000, 0x537e870800000000, 0x7ab410ad00000000,
+    0xf7d4b7d500000000, 0x60755e5c00000000, 0xed15f92400000000,
+    0xbf40614a00000000, 0x3220c63200000000, 0xa5812fbb00000000,
+    0x28e188c300000000, 0x0663ecf500000000, 0x8b034b8d00000000,
+    0x1ca2a20400000000, 0x91c2057c00000000, 0xc3979d1200000000,
+    0x4ef73a6a00000000, 0xd956d3e300000000, 0x5436749b00000000,
+    0x7dfce33e00000000, 0xf09c444600000000, 0x673dadcf00000000,
+    0xea5d0ab700000000, 0xb80892d900000000, 0x356835a100000000,
+    0xa2c9dc2800000000, 0x2fa97b5000000000, 0xfc9b2b8800000000,
+    0x71fb8cf000000000, 0xe65a657900000000, 0x6b3ac20100000000,
+    0x396f5a6f00000000, 0xb40ffd1700000000, 0x23ae149e00000000,
+    0xaeceb3e600000000, 0x8704244300000000, 0x0a64833b00000000,
+    0x9dc56ab200000000, 0x10a5cdca00000000, 0x42f055a400000000,
+    0xcf90f2dc00000000, 0x58311b5500000000, 0xd551bc2d00000000,
+    0xfbd3d81b00000000, 0x76b37f6300000000, 0xe11296ea00000000,
+    0x6c72319200000000, 0x3e27a9fc00000000, 0xb3470e8400000000,
+    0x24e6e70d00000000, 0xa986407500000000, 0x804cd7d000000000,
+    0x0d2c70a800000000, 0x9a8d992100000000, 0x17ed3e5900000000,
+    0x45b8a63700000000, 0xc8d8014f00000000, 0x5f79e8c600000000,
+    0xd2194fbe00000000, 0x037d21aa00000000, 0x8e1d86d200000000,
+    0x19bc6f5b00000000, 0x94dcc82300000000, 0xc689504d00000000,
+    0x4be9f73500000000, 0xdc481ebc00000000, 0x5128b9c400000000,
+    0x78e22e6100000000, 0xf582891900000000, 0x6223609000000000,
+    0xef43c7e800000000, 0xbd165f8600000000, 0x3076f8fe00000000,
+    0xa7d7117700000000, 0x2ab7b60f00000000, 0x0435d23900000000,
+    0x8955754100000000, 0x1ef49cc800000000, 0x93943bb000000000,
+    0xc1c1a3de00000000, 0x4ca104a600000000, 0xdb00ed2f00000000,
+    0x56604a5700000000, 0x7faaddf200000000, 0xf2ca7a8a00000000,
+    0x656b930300000000, 0xe80b347b00000000, 0xba5eac1500000000,
+    0x373e0b6d00000000, 0xa09fe2e400000000, 0x2dff459c00000000,
+    0x02563ecc00000000, 0x8f3699b400000000, 0x1897703d00000000,
+    0x95f7d74500000000, 0xc7a24f2b00000000, 0x4ac2e85300000000,
+    0xdd6301da00000000, 0x5003a6a200000000, 0x79c9310700000000,
+    0xf4a9967f00000000, 0x63087ff600000000, 0xee68d88e00000000,
+    0xbc3d40e000000000, 0x315de79800000000, 0xa6fc0e1100000000,
+    0x2b9ca96900000000, 0x051ecd5f00000000, 0x887e6a2700000000,
+    0x1fdf83ae00000000, 0x92bf24d600000000, 0xc0eabcb800000000,
+    0x4d8a1bc000000000, 0xda2bf24900000000, 0x574b553100000000,
+    0x7e81c29400000000, 0xf3e165ec00000000, 0x64408c6500000000,
+    0xe9202b1d00000000, 0xbb75b37300000000, 0x3615140b00000000,
+    0xa1b4fd8200000000, 0x2cd45afa00000000, 0xfdb034ee00000000,
+    0x70d0939600000000, 0xe7717a1f00000000, 0x6a11dd6700000000,
+    0x3844450900000000, 0xb524e27100000000, 0x22850bf800000000,
+    0xafe5ac8000000000, 0x862f3b2500000000, 0x0b4f9c5d00000000,
+    0x9cee75d400000000, 0x118ed2ac00000000, 0x43db4ac200000000,
+    0xcebbedba00000000, 0x591a043300000000, 0xd47aa34b00000000,
+    0xfaf8c77d00000000, 0x7798600500000000, 0xe039898c00000000,
+    0x6d592ef400000000, 0x3f0cb69a00000000, 0xb26c11e200000000,
+    0x25cdf86b00000000, 0xa8ad5f1300000000, 0x8167c8b600000000,
+    0x0c076fce00000000, 0x9ba6864700000000, 0x16c6213f00000000,
+    0x4493b95100000000, 0xc9f31e2900000000, 0x5e52f7a000000000,
+    0xd33250d800000000},
+   {0x0000000000000000, 0xcbd0a63d00000000, 0x96a14d7b00000000,
+    0x5d71eb4600000000, 0x2c439bf600000000, 0xe7933dcb00000000,
+    0xbae2d68d00000000, 0x713270b000000000, 0xa9f0dae800000000,
+    0x62207cd500000000, 0x3f51979300000000, 0xf48131ae00000000,
+    0x85b3411e00000000, 0x4e63e72300000000, 0x13120c6500000000,
+    0xd8c2aa5800000000, 0xa39759d400000000, 0x6847ffe900000000,
+    0x353614af00000000, 0xfee6b29200000000, 0x8fd4c22200000000,
+    0x4404641f00000000, 0x19758f5900000000, 0xd2a5296400000000,
+    0x0a67833c00000000, 0xc1b7250100000000, 0x9cc6ce4700000000,
+    0x5716687a00000000, 0x262418ca00000000, 0xedf4bef700000000,
+    0xb08555b100000000, 0x7b55f38c00000000, 0xb7595fad00000000,
+    0x7c89f99000000000, 0x21f812d600000000, 0xea28b4eb00000000,
+    0x9b1ac45b00000000, 0x50ca626600000000, 0x0dbb892000000000,
+    0xc66b2f1d00000000, 0x1ea9854500000000, 0xd579237800000000,
+    0x8808c83e00000000, 0x43d86e0300000000, 0x32ea1eb300000000,
+    0xf93ab88e00000000, 0xa44b53c800000000, 0x6f9bf5f500000000,
+    0x14ce067900000000, 0xdf1ea04400000000, 0x826f4b0200000000,
+    0x49bfed3f00000000, 0x388d9d8f00000000, 0xf35d3bb200000000,
+    0xae2cd0f400000000, 0x65fc76c900000000, 0xbd3edc9100000000,
+    0x76ee7aac00000000, 0x2b9f91ea00000000, 0xe04f37d700000000,
+    0x917d476700000000, 0x5aade15a00000000, 0x07dc0a1c00000000,
+    0xcc0cac2100000000, 0x9fc5525f00000000, 0x5415f46200000000,
+    0x09641f2400000000, 0xc2b4b91900000000, 0xb386c9a900000000,
+    0x78566f9400000000, 0x252784d200000000, 0xeef722ef00000000,
+    0x363588b700000000, 0xfde52e8a00000000, 0xa094c5cc00000000,
+    0x6b4463f100000000, 0x1a76134100000000, 0xd1a6b57c00000000,
+    0x8cd75e3a00000000, 0x4707f80700000000, 0x3c520b8b00000000,
+    0xf782adb600000000, 0xaaf346f000000000, 0x6123e0cd00000000,
+    0x1011907d00000000, 0xdbc1364000000000, 0x86b0dd0600000000,
+    0x4d607b3b00000000, 0x95a2d16300000000, 0x5e72775e00000000,
+    0x03039c1800000000, 0xc8d33a2500000000, 0xb9e14a9500000000,
+    0x7231eca800000000, 0x2f4007ee00000000, 0xe490a1d300000000,
+    0x289c0df200000000, 0xe34cabcf00000000, 0xbe3d408900000000,
+    0x75ede6b400000000, 0x04df960400000000, 0xcf0f303900000000,
+    0x927edb7f00000000, 0x59ae7d4200000000, 0x816cd71a00000000,
+    0x4abc712700000000, 0x17cd9a6100000000, 0xdc1d3c5c00000000,
+    0xad2f4cec00000000, 0x66ffead100000000, 0x3b8e019700000000,
+    0xf05ea7aa00000000, 0x8b0b542600000000, 0x40dbf21b00000000,
+    0x1daa195d00000000, 0xd67abf6000000000, 0xa748cfd000000000,
+    0x6c9869ed00000000, 0x31e982ab00000000, 0xfa39249600000000,
+    0x22fb8ece00000000, 0xe92b28f300000000, 0xb45ac3b500000000,
+    0x7f8a658800000000, 0x0eb8153800000000, 0xc568b30500000000,
+    0x9819584300000000, 0x53c9fe7e00000000, 0x3e8ba5be00000000,
+    0xf55b038300000000, 0xa82ae8c500000000, 0x63fa4ef800000000,
+    0x12c83e4800000000, 0xd918987500000000, 0x8469733300000000,
+    0x4fb9d50e00000000, 0x977b7f5600000000, 0x5cabd96b00000000,
+    0x01da322d00000000, 0xca0a941000000000, 0xbb38e4a000000000,
+    0x70e8429d00000000, 0x2d99a9db00000000, 0xe6490fe600000000,
+    0x9d1cfc6a00000000, 0x56cc5a5700000000, 0x0bbdb11100000000,
+    0xc06d172c00000000, 0xb15f679c00000000, 0x7a8fc1a100000000,
+    0x27fe2ae700000000, 0xec2e8cda00000000, 0x34ec268200000000,
+    0xff3c80bf00000000, 0xa24d6bf900000000, 0x699dcdc400000000,
+    0x18afbd7400000000, 0xd37f1b4900000000, 0x8e0ef00f00000000,
+    0x45de563200000000, 0x89d2fa1300000000, 0x42025c2e00000000,
+    0x1f73b76800000000, 0xd4a3115500000000, 0xa59161e500000000,
+    0x6e41c7d800000000, 0x33302c9e00000000, 0xf8e08aa300000000,
+    0x202220fb00000000, 0xebf286c600000000, 0xb6836d8000000000,
+    0x7d53cbbd00000000, 0x0c61bb0d00000000, 0xc7b11d3000000000,
+    0x9ac0f67600000000, 0x5110504b00000000, 0x2a45a3c700000000,
+    0xe19505fa00000000, 0xbce4eebc00000000, 0x7734488100000000,
+    0x0606383100000000, 0xcdd69e0c00000000, 0x90a7754a00000000,
+    0x5b77d37700000000, 0x83b5792f00000000, 0x4865df1200000000,
+    0x1514345400000000, 0xdec4926900000000, 0xaff6e2d900000000,
+    0x642644e400000000, 0x3957afa200000000, 0xf287099f00000000,
+    0xa14ef7e100000000, 0x6a9e51dc00000000, 0x37efba9a00000000,
+    0xfc3f1ca700000000, 0x8d0d6c1700000000, 0x46ddca2a00000000,
+    0x1bac216c00000000, 0xd07c875100000000, 0x08be2d0900000000,
+    0xc36e8b3400000000, 0x9e1f607200000000, 0x55cfc64f00000000,
+    0x24fdb6ff00000000, 0xef2d10c200000000, 0xb25cfb8400000000,
+    0x798c5db900000000, 0x02d9ae3500000000, 0xc909080800000000,
+    0x9478e34e00000000, 0x5fa8457300000000, 0x2e9a35c300000000,
+    0xe54a93fe00000000, 0xb83b78b800000000, 0x73ebde8500000000,
+    0xab2974dd00000000, 0x60f9d2e000000000, 0x3d8839a600000000,
+    0xf6589f9b00000000, 0x876aef2b00000000, 0x4cba491600000000,
+    0x11cba25000000000, 0xda1b046d00000000, 0x1617a84c00000000,
+    0xddc70e7100000000, 0x80b6e53700000000, 0x4b66430a00000000,
+    0x3a5433ba00000000, 0xf184958700000000, 0xacf57ec100000000,
+    0x6725d8fc00000000, 0xbfe772a400000000, 0x7437d49900000000,
+    0x29463fdf00000000, 0xe29699e200000000, 0x93a4e95200000000,
+    0x58744f6f00000000, 0x0505a42900000000, 0xced5021400000000,
+    0xb580f19800000000, 0x7e5057a500000000, 0x2321bce300000000,
+    0xe8f11ade00000000, 0x99c36a6e00000000, 0x5213cc5300000000,
+    0x0f62271500000000, 0xc4b2812800000000, 0x1c702b7000000000,
+    0xd7a08d4d00000000, 0x8ad1660b00000000, 0x4101c03600000000,
+    0x3033b08600000000, 0xfbe316bb00000000, 0xa692fdfd00000000,
+    0x6d425bc000000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xf20c0dfe, 0xe1f46d0d, 0x13f860f3, 0xc604aceb,
+    0x3408a115, 0x27f0c1e6, 0xd5fccc18, 0x89e52f27, 0x7be922d9,
+    0x6811422a, 0x9a1d4fd4, 0x4fe183cc, 0xbded8e32, 0xae15eec1,
+    0x5c19e33f, 0x162628bf, 0xe42a2541, 0xf7d245b2, 0x05de484c,
+    0xd0228454, 0x222e89aa, 0x31d6e959, 0xc3dae4a7, 0x9fc30798,
+    0x6dcf0a66, 0x7e376a95, 0x8c3b676b, 0x59c7ab73, 0xabcba68d,
+    0xb833c67e, 0x4a3fcb80, 0x2c4c517e, 0xde405c80, 0xcdb83c73,
+    0x3fb4318d, 0xea48fd95, 0x1844f06b, 0x0bbc9098, 0xf9b09d66,
+    0xa5a97e59, 0x57a573a7, 0x445d1354, 0xb6511eaa, 0x63add2b2,
+    0x91a1df4c, 0x8259bfbf, 0x7055b241, 0x3a6a79c1, 0xc866743f,
+    0xdb9e14cc, 0x29921932, 0xfc6ed52a, 0x0e62d8d4, 0x1d9ab827,
+    0xef96b5d9, 0xb38f56e6, 0x41835b18, 0x527b3beb, 0xa0773615,
+    0x758bfa0d, 0x8787f7f3, 0x947f9700, 0x66739afe, 0x5898a2fc,
+    0xaa94af02, 0xb96ccff1, 0x4b60c20f, 0x9e9c0e17, 0x6c9003e9,
+    0x7f68631a, 0x8d646ee4, 0xd17d8ddb, 0x23718025, 0x3089e0d6,
+    0xc285ed28, 0x17792130, 0xe5752cce, 0xf68d4c3d, 0x048141c3,
+    0x4ebe8a43, 0xbcb287bd, 0xaf4ae74e, 0x5d46eab0, 0x88ba26a8,
+    0x7ab62b56, 0x694e4ba5, 0x9b42465b, 0xc75ba564, 0x3557a89a,
+    0x26afc869, 0xd4a3c597, 0x015f098f, 0xf3530471, 0xe0ab6482,
+    0x12a7697c, 0x74d4f382, 0x86d8fe7c, 0x95209e8f, 0x672c9371,
+    0xb2d05f69, 0x40dc5297, 0x53243264, 0xa1283f9a, 0xfd31dca5,
+    0x0f3dd15b, 0x1cc5b1a8, 0xeec9bc56, 0x3b35704e, 0xc9397db0,
+    0xdac11d43, 0x28cd10bd, 0x62f2db3d, 0x90fed6c3, 0x8306b630,
+    0x710abbce, 0xa4f677d6, 0x56fa7a28, 0x45021adb, 0xb70e1725,
+    0xeb17f41a, 0x191bf9e4, 0x0ae39917, 0xf8ef94e9, 0x2d1358f1,
+    0xdf1f550f, 0xcce735fc, 0x3eeb3802, 0xb13145f8, 0x433d4806,
+    0x50c528f5, 0xa2c9250b, 0x7735e913, 0x8539e4ed, 0x96c1841e,
+    0x64cd89e0, 0x38d46adf, 0xcad86721, 0xd92007d2, 0x2b2c0a2c,
+    0xfed0c634, 0x0cdccbca, 0x1f24ab39, 0xed28a6c7, 0xa7176d47,
+    0x551b60b9, 0x46e3004a, 0xb4ef0db4, 0x6113c1ac, 0x931fcc52,
+    0x80e7aca1, 0x72eba15f, 0x2ef24260, 0xdcfe4f9e, 0xcf062f6d,
+    0x3d0a2293, 0xe8f6ee8b, 0x1afae375, 0x09028386, 0xfb0e8e78,
+    0x9d7d1486, 0x6f711978, 0x7c89798b, 0x8e857475, 0x5b79b86d,
+    0xa975b593, 0xba8dd560, 0x4881d89e, 0x14983ba1, 0xe694365f,
+    0xf56c56ac, 0x07605b52, 0xd29c974a, 0x20909ab4, 0x3368fa47,
+    0xc164f7b9, 0x8b5b3c39, 0x795731c7, 0x6aaf5134, 0x98a35cca,
+    0x4d5f90d2, 0xbf539d2c, 0xacabfddf, 0x5ea7f021, 0x02be131e,
+    0xf0b21ee0, 0xe34a7e13, 0x114673ed, 0xc4babff5, 0x36b6b20b,
+    0x254ed2f8, 0xd742df06, 0xe9a9e704, 0x1ba5eafa, 0x085d8a09,
+    0xfa5187f7, 0x2fad4bef, 0xdda14611, 0xce5926e2, 0x3c552b1c,
+    0x604cc823, 0x9240c5dd, 0x81b8a52e, 0x73b4a8d0, 0xa64864c8,
+    0x54446936, 0x47bc09c5, 0xb5b0043b, 0xff8fcfbb, 0x0d83c245,
+    0x1e7ba2b6, 0xec77af48, 0x398b6350, 0xcb876eae, 0xd87f0e5d,
+    0x2a7303a3, 0x766ae09c, 0x8466ed62, 0x979e8d91, 0x6592806f,
+    0xb06e4c77, 0x42624189, 0x519a217a, 0xa3962c84, 0xc5e5b67a,
+    0x37e9bb84, 0x2411db77, 0xd61dd689, 0x03e11a91, 0xf1ed176f,
+    0xe215779c, 0x10197a62, 0x4c00995d, 0xbe0c94a3, 0xadf4f450,
+    0x5ff8f9ae, 0x8a0435b6, 0x78083848, 0x6bf058bb, 0x99fc5545,
+    0xd3c39ec5, 0x21cf933b, 0x3237f3c8, 0xc03bfe36, 0x15c7322e,
+    0xe7cb3fd0, 0xf4335f23, 0x063f52dd, 0x5a26b1e2, 0xa82abc1c,
+    0xbbd2dcef, 0x49ded111, 0x9c221d09, 0x6e2e10f7, 0x7dd67004,
+    0x8fda7dfa},
+   {0x00000000, 0x678efd01, 0xcf1dfa02, 0xa8930703, 0x9bd782f5,
+    0xfc597ff4, 0x54ca78f7, 0x334485f6, 0x3243731b, 0x55cd8e1a,
+    0xfd5e8919, 0x9ad07418, 0xa994f1ee, 0xce1a0cef, 0x66890bec,
+    0x0107f6ed, 0x6486e636, 0x03081b37, 0xab9b1c34, 0xcc15e135,
+    0xff5164c3, 0x98df99c2, 0x304c9ec1, 0x57c263c0, 0x56c5952d,
+    0x314b682c, 0x99d86f2f, 0xfe56922e, 0xcd1217d8, 0xaa9cead9,
+    0x020fedda, 0x658110db, 0xc90dcc6c, 0xae83316d, 0x0610366e,
+    0x619ecb6f, 0x52da4e99, 0x3554b398, 0x9dc7b49b, 0xfa49499a,
+    0xfb4ebf77, 0x9cc04276, 0x34534575, 0x53ddb874, 0x60993d82,
+    0x0717c083, 0xaf84c780, 0xc80a3a81, 0xad8b2a5a, 0xca05d75b,
+    0x6296d058, 0x05182d59, 0x365ca8af, 0x51d255ae, 0xf94152ad,
+    0x9ecfafac, 0x9fc85941, 0xf846a440, 0x50d5a343, 0x375b5e42,
+    0x041fdbb4, 0x639126b5, 0xcb0221b6, 0xac8cdcb7, 0x97f7ee29,
+    0xf0791328, 0x58ea142b, 0x3f64e92a, 0x0c206cdc, 0x6bae91dd,
+    0xc33d96de, 0xa4b36bdf, 0xa5b49d32, 0xc23a6033, 0x6aa96730,
+    0x0d279a31, 0x3e631fc7, 0x59ede2c6, 0xf17ee5c5, 0x96f018c4,
+    0xf371081f, 0x94fff51e, 0x3c6cf21d, 0x5be20f1c, 0x68a68aea,
+    0x0f2877eb, 0xa7bb70e8, 0xc0358de9, 0xc1327b04, 0xa6bc8605,
+    0x0e2f8106, 0x69a17c07, 0x5ae5f9f1, 0x3d6b04f0, 0x95f803f3,
+    0xf276fef2, 0x5efa2245, 0x3974df44, 0x91e7d847, 0xf6692546,
+    0xc52da0b0, 0xa2a35db1, 0x0a305ab2, 0x6dbea7b3, 0x6cb9515e,
+    0x0b37ac5f, 0xa3a4ab5c, 0xc42a565d, 0xf76ed3ab, 0x90e02eaa,
+    0x387329a9, 0x5ffdd4a8, 0x3a7cc473, 0x5df23972, 0xf5613e71,
+    0x92efc370, 0xa1ab4686, 0xc625bb87, 0x6eb6bc84, 0x09384185,
+    0x083fb768, 0x6fb14a69, 0xc7224d6a, 0xa0acb06b, 0x93e8359d,
+    0xf466c89c, 0x5cf5cf9f, 0x3b7b329e, 0x2a03aaa3, 0x4d8d57a2,
+    0xe51e50a1, 0x8290ada0, 0xb1d42856, 0xd65ad557, 0x7ec9d254,
+    0x19472f55, 0x1840d9b8, 0x7fce24b9, 0xd75d23ba, 0xb0d3debb,
+    0x83975b4d, 0xe419a64c, 0x4c8aa14f, 0x2b045c4e, 0x4e854c95,
+    0x290bb194, 0x8198b697, 0xe6164b96, 0xd552ce60, 0xb2dc3361,
+    0x1a4f3462, 0x7dc1c963, 0x7cc63f8e, 0x1b48c28f, 0xb3dbc58c,
+    0xd455388d, 0xe711bd7b, 0x809f407a, 0x280c4779, 0x4f82ba78,
+    0xe30e66cf, 0x84809bce, 0x2c139ccd, 0x4b9d61cc, 0x78d9e43a,
+    0x1f57193b, 0xb7c41e38, 0xd04ae339, 0xd14d15d4, 0xb6c3e8d5,
+    0x1e50efd6, 0x79de12d7, 0x4a9a9721, 0x2d146a20, 0x85876d23,
+    0xe2099022, 0x878880f9, 0xe0067df8, 0x48957afb, 0x2f1b87fa,
+    0x1c5f020c, 0x7bd1ff0d, 0xd342f80e, 0xb4cc050f, 0xb5cbf3e2,
+    0xd2450ee3, 0x7ad609e0, 0x1d58f4e1, 0x2e1c7117, 0x49928c16,
+    0xe1018b15, 0x868f7614, 0xbdf4448a, 0xda7ab98b, 0x72e9be88,
+    0x15674389, 0x2623c67f, 0x41ad3b7e, 0xe93e3c7d, 0x8eb0c17c,
+    0x8fb73791, 0xe839ca90, 0x40aacd93, 0x27243092, 0x1460b564,
+    0x73ee4865, 0xdb7d4f66, 0xbcf3b267, 0xd972a2bc, 0xbefc5fbd,
+    0x166f58be, 0x71e1a5bf, 0x42a52049, 0x252bdd48, 0x8db8da4b,
+    0xea36274a, 0xeb31d1a7, 0x8cbf2ca6, 0x242c2ba5, 0x43a2d6a4,
+    0x70e65352, 0x1768ae53, 0xbffba950, 0xd8755451, 0x74f988e6,
+    0x137775e7, 0xbbe472e4, 0xdc6a8fe5, 0xef2e0a13, 0x88a0f712,
+    0x2033f011, 0x47bd0d10, 0x46bafbfd, 0x213406fc, 0x89a701ff,
+    0xee29fcfe, 0xdd6d7908, 0xbae38409, 0x1270830a, 0x75fe7e0b,
+    0x107f6ed0, 0x77f193d1, 0xdf6294d2, 0xb8ec69d3, 0x8ba8ec25,
+    0xec261124, 0x44b51627, 0x233beb26, 0x223c1dcb, 0x45b2e0ca,
+    0xed21e7c9, 0x8aaf1ac8, 0xb9eb9f3e, 0xde65623f, 0x76f6653c,
+    0x1178983d},
+   {0x00000000, 0x54075546, 0xa80eaa8c, 0xfc09ffca, 0x55f123e9,
+    0x01f676af, 0xfdff8965, 0xa9f8dc23, 0xabe247d2, 0xffe51294,
+    0x03eced5e, 0x57ebb818, 0xfe13643b, 0xaa14317d, 0x561dceb7,
+    0x021a9bf1, 0x5228f955, 0x062fac13, 0xfa2653d9, 0xae21069f,
+    0x07d9dabc, 0x53de8ffa, 0xafd77030, 0xfbd02576, 0xf9cabe87,
+    0xadcdebc1, 0x51c4140b, 0x05c3414d, 0xac3b9d6e, 0xf83cc828,
+    0x043537e2, 0x503262a4, 0xa451f2aa, 0xf056a7ec, 0x0c5f5826,
+    0x58580d60, 0xf1a0d143, 0xa5a78405, 0x59ae7bcf, 0x0da92e89,
+    0x0fb3b578, 0x5bb4e03e, 0xa7bd1ff4, 0xf3ba4ab2, 0x5a429691,
+    0x0e45c3d7, 0xf24c3c1d, 0xa64b695b, 0xf6790bff, 0xa27e5eb9,
+    0x5e77a173, 0x0a70f435, 0xa3882816, 0xf78f7d50, 0x0b86829a,
+    0x5f81d7dc, 0x5d9b4c2d, 0x099c196b, 0xf595e6a1, 0xa192b3e7,
+    0x086a6fc4, 0x5c6d3a82, 0xa064c548, 0xf463900e, 0x4d4f93a5,
+    0x1948c6e3, 0xe5413929, 0xb1466c6f, 0x18beb04c, 0x4cb9e50a,
+    0xb0b01ac0, 0xe4b74f86, 0xe6add477, 0xb2aa8131, 0x4ea37efb,
+    0x1aa42bbd, 0xb35cf79e, 0xe75ba2d8, 0x1b525d12, 0x4f550854,
+    0x1f676af0, 0x4b603fb6, 0xb769c07c, 0xe36e953a, 0x4a964919,
+    0x1e911c5f, 0xe298e395, 0xb69fb6d3, 0xb4852d22, 0xe0827864,
+    0x1c8b87ae, 0x488cd2e8, 0xe1740ecb, 0xb5735b8d, 0x497aa447,
+    0x1d7df101, 0xe91e610f, 0xbd193449, 0x4110cb83, 0x15179ec5,
+    0xbcef42e6, 0xe8e817a0, 0x14e1e86a, 0x40e6bd2c, 0x42fc26dd,
+    0x16fb739b, 0xeaf28c51, 0xbef5d917, 0x170d0534, 0x430a5072,
+    0xbf03afb8, 0xeb04fafe, 0xbb36985a, 0xef31cd1c, 0x133832d6,
+    0x473f6790, 0xeec7bbb3, 0xbac0eef5, 0x46c9113f, 0x12ce4479,
+    0x10d4df88, 0x44d38ace, 0xb8da7504, 0xecdd2042, 0x4525fc61,
+    0x1122a927, 0xed2b56ed, 0xb92c03ab, 0x9a9f274a, 0xce98720c,
+    0x32918dc6, 0x6696d880, 0xcf6e04a3, 0x9b6951e5, 0x6760ae2f,
+    0x3367fb69, 0x317d6098, 0x657a35de, 0x9973ca14, 0xcd749f52,
+    0x648c4371, 0x308b1637, 0xcc82e9fd, 0x9885bcbb, 0xc8b7de1f,
+    0x9cb08b59, 0x60b97493, 0x34be21d5, 0x9d46fdf6, 0xc941a8b0,
+    0x3548577a, 0x614f023c, 0x635599cd, 0x3752cc8b, 0xcb5b3341,
+    0x9f5c6607, 0x36a4ba24, 0x62a3ef62, 0x9eaa10a8, 0xcaad45ee,
+    0x3eced5e0, 0x6ac980a6, 0x96c07f6c, 0xc2c72a2a, 0x6b3ff609,
+    0x3f38a34f, 0xc3315c85, 0x973609c3, 0x952c9232, 0xc12bc774,
+    0x3d2238be, 0x69256df8, 0xc0ddb1db, 0x94dae49d, 0x68d31b57,
+    0x3cd44e11, 0x6ce62cb5, 0x38e179f3, 0xc4e88639, 0x90efd37f,
+    0x39170f5c, 0x6d105a1a, 0x9119a5d0, 0xc51ef096, 0xc7046b67,
+    0x93033e21, 0x6f0ac1eb, 0x3b0d94ad, 0x92f5488e, 0xc6f21dc8,
+    0x3afbe202, 0x6efcb744, 0xd7d0b4ef, 0x83d7e1a9, 0x7fde1e63,
+    0x2bd94b25, 0x82219706, 0xd626c240, 0x2a2f3d8a, 0x7e2868cc,
+    0x7c32f33d, 0x2835a67b, 0xd43c59b1, 0x803b0cf7, 0x29c3d0d4,
+    0x7dc48592, 0x81cd7a58, 0xd5ca2f1e, 0x85f84dba, 0xd1ff18fc,
+    0x2df6e736, 0x79f1b270, 0xd0096e53, 0x840e3b15, 0x7807c4df,
+    0x2c009199, 0x2e1a0a68, 0x7a1d5f2e, 0x8614a0e4, 0xd213f5a2,
+    0x7beb2981, 0x2fec7cc7, 0xd3e5830d, 0x87e2d64b, 0x73814645,
+    0x27861303, 0xdb8fecc9, 0x8f88b98f, 0x267065ac, 0x727730ea,
+    0x8e7ecf20, 0xda799a66, 0xd8630197, 0x8c6454d1, 0x706dab1b,
+    0x246afe5d, 0x8d92227e, 0xd9957738, 0x259c88f2, 0x719bddb4,
+    0x21a9bf10, 0x75aeea56, 0x89a7159c, 0xdda040da, 0x74589cf9,
+    0x205fc9bf, 0xdc563675, 0x88516333, 0x8a4bf8c2, 0xde4cad84,
+    0x2245524e, 0x76420708, 0xdfbadb2b, 0x8bbd8e6d, 0x77b471a7,
+    0x23b324e1},
+   {0x00000000, 0x30d23865, 0x61a470ca, 0x517648af, 0xc348e194,
+    0xf39ad9f1, 0xa2ec915e, 0x923ea93b, 0x837db5d9, 0xb3af8dbc,
+    0xe2d9c513, 0xd20bfd76, 0x4035544d, 0x70e76c28, 0x21912487,
+    0x11431ce2, 0x03171d43, 0x33c52526, 0x62b36d89, 0x526155ec,
+    0xc05ffcd7, 0xf08dc4b2, 0xa1fb8c1d, 0x9129b478, 0x806aa89a,
+    0xb0b890ff, 0xe1ced850, 0xd11ce035, 0x4322490e, 0x73f0716b,
+    0x228639c4, 0x125401a1, 0x062e3a86, 0x36fc02e3, 0x678a4a4c,
+    0x57587229, 0xc566db12, 0xf5b4e377, 0xa4c2abd8, 0x941093bd,
+    0x85538f5f, 0xb581b73a, 0xe4f7ff95, 0xd425c7f0, 0x461b6ecb,
+    0x76c956ae, 0x27bf1e01, 0x176d2664, 0x053927c5, 0x35eb1fa0,
+    0x649d570f, 0x544f6f6a, 0xc671c651, 0xf6a3fe34, 0xa7d5b69b,
+    0x97078efe, 0x8644921c, 0xb696aa79, 0xe7e0e2d6, 0xd732dab3,
+    0x450c7388, 0x75de4bed, 0x24a80342, 0x147a3b27, 0x0c5c750c,
+    0x3c8e4d69, 0x6df805c6, 0x5d2a3da3, 0xcf149498, 0xffc6acfd,
+    0xaeb0e452, 0x9e62dc37, 0x8f21c0d5, 0xbff3f8b0, 0xee85b01f,
+    0xde57887a, 0x4c692141, 0x7cbb1924, 0x2dcd518b, 0x1d1f69ee,
+    0x0f4b684f, 0x3f99502a, 0x6eef1885, 0x5e3d20e0, 0xcc0389db,
+    0xfcd1b1be, 0xada7f911, 0x9d75c174, 0x8c36dd96, 0xbce4e5f3,
+    0xed92ad5c, 0xdd409539, 0x4f7e3c02, 0x7fac0467, 0x2eda4cc8,
+    0x1e0874ad, 0x0a724f8a, 0x3aa077ef, 0x6bd63f40, 0x5b040725,
+    0xc93aae1e, 0xf9e8967b, 0xa89eded4, 0x984ce6b1, 0x890ffa53,
+    0xb9ddc236, 0xe8ab8a99, 0xd879b2fc, 0x4a471bc7, 0x7a9523a2,
+    0x2be36b0d, 0x1b315368, 0x096552c9, 0x39b76aac, 0x68c12203,
+    0x58131a66, 0xca2db35d, 0xfaff8b38, 0xab89c397, 0x9b5bfbf2,
+    0x8a18e710, 0xbacadf75, 0xebbc97da, 0xdb6eafbf, 0x49500684,
+    0x79823ee1, 0x28f4764e, 0x18264e2b, 0x18b8ea18, 0x286ad27d,
+    0x791c9ad2, 0x49cea2b7, 0xdbf00b8c, 0xeb2233e9, 0xba547b46,
+    0x8a864323, 0x9bc55fc1, 0xab1767a4, 0xfa612f0b, 0xcab3176e,
+    0x588dbe55, 0x685f8630, 0x3929ce9f, 0x09fbf6fa, 0x1baff75b,
+    0x2b7dcf3e, 0x7a0b8791, 0x4ad9bff4, 0xd8e716cf, 0xe8352eaa,
+    0xb9436605, 0x89915e60, 0x98d24282, 0xa8007ae7, 0xf9763248,
+    0xc9a40a2d, 0x5b9aa316, 0x6b489b73, 0x3a3ed3dc, 0x0aecebb9,
+    0x1e96d09e, 0x2e44e8fb, 0x7f32a054, 0x4fe09831, 0xddde310a,
+    0xed0c096f, 0xbc7a41c0, 0x8ca879a5, 0x9deb6547, 0xad395d22,
+    0xfc4f158d, 0xcc9d2de8, 0x5ea384d3, 0x6e71bcb6, 0x3f07f419,
+    0x0fd5cc7c, 0x1d81cddd, 0x2d53f5b8, 0x7c25bd17, 0x4cf78572,
+    0xdec92c49, 0xee1b142c, 0xbf6d5c83, 0x8fbf64e6, 0x9efc7804,
+    0xae2e4061, 0xff5808ce, 0xcf8a30ab, 0x5db49990, 0x6d66a1f5,
+    0x3c10e95a, 0x0cc2d13f, 0x14e49f14, 0x2436a771, 0x7540efde,
+    0x4592d7bb, 0xd7ac7e80, 0xe77e46e5, 0xb6080e4a, 0x86da362f,
+    0x97992acd, 0xa74b12a8, 0xf63d5a07, 0xc6ef6262, 0x54d1cb59,
+    0x6403f33c, 0x3575bb93, 0x05a783f6, 0x17f38257, 0x2721ba32,
+    0x7657f29d, 0x4685caf8, 0xd4bb63c3, 0xe4695ba6, 0xb51f1309,
+    0x85cd2b6c, 0x948e378e, 0xa45c0feb, 0xf52a4744, 0xc5f87f21,
+    0x57c6d61a, 0x6714ee7f, 0x3662a6d0, 0x06b09eb5, 0x12caa592,
+    0x22189df7, 0x736ed558, 0x43bced3d, 0xd1824406, 0xe1507c63,
+    0xb02634cc, 0x80f40ca9, 0x91b7104b, 0xa165282e, 0xf0136081,
+    0xc0c158e4, 0x52fff1df, 0x622dc9ba, 0x335b8115, 0x0389b970,
+    0x11ddb8d1, 0x210f80b4, 0x7079c81b, 0x40abf07e, 0xd2955945,
+    0xe2476120, 0xb331298f, 0x83e311ea, 0x92a00d08, 0xa272356d,
+    0xf3047dc2, 0xc3d645a7, 0x51e8ec9c, 0x613ad4f9, 0x304c9c56,
+    0x009ea433}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0x6538d230, 0xca70a461, 0xaf487651, 0x94e148c3,
+    0xf1d99af3, 0x5e91eca2, 0x3ba93e92, 0xd9b57d83, 0xbc8dafb3,
+    0x13c5d9e2, 0x76fd0bd2, 0x4d543540, 0x286ce770, 0x87249121,
+    0xe21c4311, 0x431d1703, 0x2625c533, 0x896db362, 0xec556152,
+    0xd7fc5fc0, 0xb2c48df0, 0x1d8cfba1, 0x78b42991, 0x9aa86a80,
+    0xff90b8b0, 0x50d8cee1, 0x35e01cd1, 0x0e492243, 0x6b71f073,
+    0xc4398622, 0xa1015412, 0x863a2e06, 0xe302fc36, 0x4c4a8a67,
+    0x29725857, 0x12db66c5, 0x77e3b4f5, 0xd8abc2a4, 0xbd931094,
+    0x5f8f5385, 0x3ab781b5, 0x95fff7e4, 0xf0c725d4, 0xcb6e1b46,
+    0xae56c976, 0x011ebf27, 0x64266d17, 0xc5273905, 0xa01feb35,
+    0x0f579d64, 0x6a6f4f54, 0x51c671c6, 0x34fea3f6, 0x9bb6d5a7,
+    0xfe8e0797, 0x1c924486, 0x79aa96b6, 0xd6e2e0e7, 0xb3da32d7,
+    0x88730c45, 0xed4bde75, 0x4203a824, 0x273b7a14, 0x0c755c0c,
+    0x694d8e3c, 0xc605f86d, 0xa33d2a5d, 0x989414cf, 0xfdacc6ff,
+    0x52e4b0ae, 0x37dc629e, 0xd5c0218f, 0xb0f8f3bf, 0x1fb085ee,
+    0x7a8857de, 0x4121694c, 0x2419bb7c, 0x8b51cd2d, 0xee691f1d,
+    0x4f684b0f, 0x2a50993f, 0x8518ef6e, 0xe0203d5e, 0xdb8903cc,
+    0xbeb1d1fc, 0x11f9a7ad, 0x74c1759d, 0x96dd368c, 0xf3e5e4bc,
+    0x5cad92ed, 0x399540dd, 0x023c7e4f, 0x6704ac7f, 0xc84cda2e,
+    0xad74081e, 0x8a4f720a, 0xef77a03a, 0x403fd66b, 0x2507045b,
+    0x1eae3ac9, 0x7b96e8f9, 0xd4de9ea8, 0xb1e64c98, 0x53fa0f89,
+    0x36c2ddb9, 0x998aabe8, 0xfcb279d8, 0xc71b474a, 0xa223957a,
+    0x0d6be32b, 0x6853311b, 0xc9526509, 0xac6ab739, 0x0322c168,
+    0x661a1358, 0x5db32dca, 0x388bfffa, 0x97c389ab, 0xf2fb5b9b,
+    0x10e7188a, 0x75dfcaba, 0xda97bceb, 0xbfaf6edb, 0x84065049,
+    0xe13e8279, 0x4e76f428, 0x2b4e2618, 0x18eab818, 0x7dd26a28,
+    0xd29a1c79, 0xb7a2ce49, 0x8c0bf0db, 0xe93322eb, 0x467b54ba,
+    0x2343868a, 0xc15fc59b, 0xa46717ab, 0x0b2f61fa, 0x6e17b3ca,
+    0x55be8d58, 0x30865f68, 0x9fce2939, 0xfaf6fb09, 0x5bf7af1b,
+    0x3ecf7d2b, 0x91870b7a, 0xf4bfd94a, 0xcf16e7d8, 0xaa2e35e8,
+    0x056643b9, 0x605e9189, 0x8242d298, 0xe77a00a8, 0x483276f9,
+    0x2d0aa4c9, 0x16a39a5b, 0x739b486b, 0xdcd33e3a, 0xb9ebec0a,
+    0x9ed0961e, 0xfbe8442e, 0x54a0327f, 0x3198e04f, 0x0a31dedd,
+    0x6f090ced, 0xc0417abc, 0xa579a88c, 0x4765eb9d, 0x225d39ad,
+    0x8d154ffc, 0xe82d9dcc, 0xd384a35e, 0xb6bc716e, 0x19f4073f,
+    0x7cccd50f, 0xddcd811d, 0xb8f5532d, 0x17bd257c, 0x7285f74c,
+    0x492cc9de, 0x2c141bee, 0x835c6dbf, 0xe664bf8f, 0x0478fc9e,
+    0x61402eae, 0xce0858ff, 0xab308acf, 0x9099b45d, 0xf5a1666d,
+    0x5ae9103c, 0x3fd1c20c, 0x149fe414, 0x71a73624, 0xdeef4075,
+    0xbbd79245, 0x807eacd7, 0xe5467ee7, 0x4a0e08b6, 0x2f36da86,
+    0xcd2a9997, 0xa8124ba7, 0x075a3df6, 0x6262efc6, 0x59cbd154,
+    0x3cf30364, 0x93bb7535, 0xf683a705, 0x5782f317, 0x32ba2127,
+    0x9df25776, 0xf8ca8546, 0xc363bbd4, 0xa65b69e4, 0x09131fb5,
+    0x6c2bcd85, 0x8e378e94, 0xeb0f5ca4, 0x44472af5, 0x217ff8c5,
+    0x1ad6c657, 0x7fee1467, 0xd0a66236, 0xb59eb006, 0x92a5ca12,
+    0xf79d1822, 0x58d56e73, 0x3dedbc43, 0x064482d1, 0x637c50e1,
+    0xcc3426b0, 0xa90cf480, 0x4b10b791, 0x2e2865a1, 0x816013f0,
+    0xe458c1c0, 0xdff1ff52, 0xbac92d62, 0x15815b33, 0x70b98903,
+    0xd1b8dd11, 0xb4800f21, 0x1bc87970, 0x7ef0ab40, 0x455995d2,
+    0x206147e2, 0x8f2931b3, 0xea11e383, 0x080da092, 0x6d3572a2,
+    0xc27d04f3, 0xa745d6c3, 0x9cece851, 0xf9d43a61, 0x569c4c30,
+    0x33a49e00},
+   {0x00000000, 0x46550754, 0x8caa0ea8, 0xcaff09fc, 0xe923f155,
+    0xaf76f601, 0x6589fffd, 0x23dcf8a9, 0xd247e2ab, 0x9412e5ff,
+    0x5eedec03, 0x18b8eb57, 0x3b6413fe, 0x7d3114aa, 0xb7ce1d56,
+    0xf19b1a02, 0x55f92852, 0x13ac2f06, 0xd95326fa, 0x9f0621ae,
+    0xbcdad907, 0xfa8fde53, 0x3070d7af, 0x7625d0fb, 0x87becaf9,
+    0xc1ebcdad, 0x0b14c451, 0x4d41c305, 0x6e9d3bac, 0x28c83cf8,
+    0xe2373504, 0xa4623250, 0xaaf251a4, 0xeca756f0, 0x26585f0c,
+    0x600d5858, 0x43d1a0f1, 0x0584a7a5, 0xcf7bae59, 0x892ea90d,
+    0x78b5b30f, 0x3ee0b45b, 0xf41fbda7, 0xb24abaf3, 0x9196425a,
+    0xd7c3450e, 0x1d3c4cf2, 0x5b694ba6, 0xff0b79f6, 0xb95e7ea2,
+    0x73a1775e, 0x35f4700a, 0x162888a3, 0x507d8ff7, 0x9a82860b,
+    0xdcd7815f, 0x2d4c9b5d, 0x6b199c09, 0xa1e695f5, 0xe7b392a1,
+    0xc46f6a08, 0x823a6d5c, 0x48c564a0, 0x0e9063f4, 0xa5934f4d,
+    0xe3c64819, 0x293941e5, 0x6f6c46b1, 0x4cb0be18, 0x0ae5b94c,
+    0xc01ab0b0, 0x864fb7e4, 0x77d4ade6, 0x3181aab2, 0xfb7ea34e,
+    0xbd2ba41a, 0x9ef75cb3, 0xd8a25be7, 0x125d521b, 0x5408554f,
+    0xf06a671f, 0xb63f604b, 0x7cc069b7, 0x3a956ee3, 0x1949964a,
+    0x5f1c911e, 0x95e398e2, 0xd3b69fb6, 0x222d85b4, 0x647882e0,
+    0xae878b1c, 0xe8d28c48, 0xcb0e74e1, 0x8d5b73b5, 0x47a47a49,
+    0x01f17d1d, 0x0f611ee9, 0x493419bd, 0x83cb1041, 0xc59e1715,
+    0xe642efbc, 0xa017e8e8, 0x6ae8e114, 0x2cbde640, 0xdd26fc42,
+    0x9b73fb16, 0x518cf2ea, 0x17d9f5be, 0x34050d17, 0x72500a43,
+    0xb8af03bf, 0xfefa04eb, 0x5a9836bb, 0x1ccd31ef, 0xd6323813,
+    0x90673f47, 0xb3bbc7ee, 0xf5eec0ba, 0x3f11c946, 0x7944ce12,
+    0x88dfd410, 0xce8ad344, 0x0475dab8, 0x4220ddec, 0x61fc2545,
+    0x27a92211, 0xed562bed, 0xab032cb9, 0x4a279f9a, 0x0c7298ce,
+    0xc68d9132, 0x80d89666, 0xa3046ecf, 0xe551699b, 0x2fae6067,
+    0x69fb6733, 0x98607d31, 0xde357a65, 0x14ca7399, 0x529f74cd,
+    0x71438c64, 0x37168b30, 0xfde982cc, 0xbbbc8598, 0x1fdeb7c8,
+    0x598bb09c, 0x9374b960, 0xd521be34, 0xf6fd469d, 0xb0a841c9,
+    0x7a574835, 0x3c024f61, 0xcd995563, 0x8bcc5237, 0x41335bcb,
+    0x07665c9f, 0x24baa436, 0x62efa362, 0xa810aa9e, 0xee45adca,
+    0xe0d5ce3e, 0xa680c96a, 0x6c7fc096, 0x2a2ac7c2, 0x09f63f6b,
+    0x4fa3383f, 0x855c31c3, 0xc3093697, 0x32922c95, 0x74c72bc1,
+    0xbe38223d, 0xf86d2569, 0xdbb1ddc0, 0x9de4da94, 0x571bd368,
+    0x114ed43c, 0xb52ce66c, 0xf379e138, 0x3986e8c4, 0x7fd3ef90,
+    0x5c0f1739, 0x1a5a106d, 0xd0a51991, 0x96f01ec5, 0x676b04c7,
+    0x213e0393, 0xebc10a6f, 0xad940d3b, 0x8e48f592, 0xc81df2c6,
+    0x02e2fb3a, 0x44b7fc6e, 0xefb4d0d7, 0xa9e1d783, 0x631ede7f,
+    0x254bd92b, 0x06972182, 0x40c226d6, 0x8a3d2f2a, 0xcc68287e,
+    0x3df3327c, 0x7ba63528, 0xb1593cd4, 0xf70c3b80, 0xd4d0c329,
+    0x9285c47d, 0x587acd81, 0x1e2fcad5, 0xba4df885, 0xfc18ffd1,
+    0x36e7f62d, 0x70b2f179, 0x536e09d0, 0x153b0e84, 0xdfc40778,
+    0x9991002c, 0x680a1a2e, 0x2e5f1d7a, 0xe4a01486, 0xa2f513d2,
+    0x8129eb7b, 0xc77cec2f, 0x0d83e5d3, 0x4bd6e287, 0x45468173,
+    0x03138627, 0xc9ec8fdb, 0x8fb9888f, 0xac657026, 0xea307772,
+    0x20cf7e8e, 0x669a79da, 0x970163d8, 0xd154648c, 0x1bab6d70,
+    0x5dfe6a24, 0x7e22928d, 0x387795d9, 0xf2889c25, 0xb4dd9b71,
+    0x10bfa921, 0x56eaae75, 0x9c15a789, 0xda40a0dd, 0xf99c5874,
+    0xbfc95f20, 0x753656dc, 0x33635188, 0xc2f84b8a, 0x84ad4cde,
+    0x4e524522, 0x08074276, 0x2bdbbadf, 0x6d8ebd8b, 0xa771b477,
+    0xe124b323},
+   {0x00000000, 0x01fd8e67, 0x02fa1dcf, 0x030793a8, 0xf582d79b,
+    0xf47f59fc, 0xf778ca54, 0xf6854433, 0x1b734332, 0x1a8ecd55,
+    0x19895efd, 0x1874d09a, 0xeef194a9, 0xef0c1ace, 0xec0b8966,
+    0xedf60701, 0x36e68664, 0x371b0803, 0x341c9bab, 0x35e115cc,
+    0xc36451ff, 0xc299df98, 0xc19e4c30, 0xc063c257, 0x2d95c556,
+    0x2c684b31, 0x2f6fd899, 0x2e9256fe, 0xd81712cd, 0xd9ea9caa,
+    0xdaed0f02, 0xdb108165, 0x6ccc0dc9, 0x6d3183ae, 0x6e361006,
+    0x6fcb9e61, 0x994eda52, 0x98b35435, 0x9bb4c79d, 0x9a4949fa,
+    0x77bf4efb, 0x7642c09c, 0x75455334, 0x74b8dd53, 0x823d9960,
+    0x83c01707, 0x80c784af, 0x813a0ac8, 0x5a2a8bad, 0x5bd705ca,
+    0x58d09662, 0x592d1805, 0xafa85c36, 0xae55d251, 0xad5241f9,
+    0xacafcf9e, 0x4159c89f, 0x40a446f8, 0x43a3d550, 0x425e5b37,
+    0xb4db1f04, 0xb5269163, 0xb62102cb, 0xb7dc8cac, 0x29eef797,
+    0x281379f0, 0x2b14ea58, 0x2ae9643f, 0xdc6c200c, 0xdd91ae6b,
+    0xde963dc3, 0xdf6bb3a4, 0x329db4a5, 0x33603ac2, 0x3067a96a,
+    0x319a270d, 0xc71f633e, 0xc6e2ed59, 0xc5e57ef1, 0xc418f096,
+    0x1f0871f3, 0x1ef5ff94, 0x1df26c3c, 0x1c0fe25b, 0xea8aa668,
+    0xeb77280f, 0xe870bba7, 0xe98d35c0, 0x047b32c1, 0x0586bca6,
+    0x06812f0e, 0x077ca169, 0xf1f9e55a, 0xf0046b3d, 0xf303f895,
+    0xf2fe76f2, 0x4522fa5e, 0x44df7439, 0x47d8e791, 0x462569f6,
+    0xb0a02dc5, 0xb15da3a2, 0xb25a300a, 0xb3a7be6d, 0x5e51b96c,
+    0x5fac370b, 0x5caba4a3, 0x5d562ac4, 0xabd36ef7, 0xaa2ee090,
+    0xa9297338, 0xa8d4fd5f, 0x73c47c3a, 0x7239f25d, 0x713e61f5,
+    0x70c3ef92, 0x8646aba1, 0x87bb25c6, 0x84bcb66e, 0x85413809,
+    0x68b73f08, 0x694ab16f, 0x6a4d22c7, 0x6bb0aca0, 0x9d35e893,
+    0x9cc866f4, 0x9fcff55c, 0x9e327b3b, 0xa3aa032a, 0xa2578d4d,
+    0xa1501ee5, 0xa0ad9082, 0x5628d4b1, 0x57d55ad6, 0x54d2c97e,
+    0x552f4719, 0xb8d94018, 0xb924ce7f, 0xba235dd7, 0xbbded3b0,
+    0x4d5b9783, 0x4ca619e4, 0x4fa18a4c, 0x4e5c042b, 0x954c854e,
+    0x94b10b29, 0x97b69881, 0x964b16e6, 0x60ce52d5, 0x6133dcb2,
+    0x62344f1a, 0x63c9c17d, 0x8e3fc67c, 0x8fc2481b, 0x8cc5dbb3,
+    0x8d3855d4, 0x7bbd11e7, 0x7a409f80, 0x79470c28, 0x78ba824f,
+    0xcf660ee3, 0xce9b8084, 0xcd9c132c, 0xcc619d4b, 0x3ae4d978,
+    0x3b19571f, 0x381ec4b7, 0x39e34ad0, 0xd4154dd1, 0xd5e8c3b6,
+    0xd6ef501e, 0xd712de79, 0x21979a4a, 0x206a142d, 0x236d8785,
+    0x229009e2, 0xf9808887, 0xf87d06e0, 0xfb7a9548, 0xfa871b2f,
+    0x0c025f1c, 0x0dffd17b, 0x0ef842d3, 0x0f05ccb4, 0xe2f3cbb5,
+    0xe30e45d2, 0xe009d67a, 0xe1f4581d, 0x17711c2e, 0x168c9249,
+    0x158b01e1, 0x14768f86, 0x8a44f4bd, 0x8bb97ada, 0x88bee972,
+    0x89436715, 0x7fc62326, 0x7e3bad41, 0x7d3c3ee9, 0x7cc1b08e,
+    0x9137b78f, 0x90ca39e8, 0x93cdaa40, 0x92302427, 0x64b56014,
+    0x6548ee73, 0x664f7ddb, 0x67b2f3bc, 0xbca272d9, 0xbd5ffcbe,
+    0xbe586f16, 0xbfa5e171, 0x4920a542, 0x48dd2b25, 0x4bdab88d,
+    0x4a2736ea, 0xa7d131eb, 0xa62cbf8c, 0xa52b2c24, 0xa4d6a243,
+    0x5253e670, 0x53ae6817, 0x50a9fbbf, 0x515475d8, 0xe688f974,
+    0xe7757713, 0xe472e4bb, 0xe58f6adc, 0x130a2eef, 0x12f7a088,
+    0x11f03320, 0x100dbd47, 0xfdfbba46, 0xfc063421, 0xff01a789,
+    0xfefc29ee, 0x08796ddd, 0x0984e3ba, 0x0a837012, 0x0b7efe75,
+    0xd06e7f10, 0xd193f177, 0xd29462df, 0xd369ecb8, 0x25eca88b,
+    0x241126ec, 0x2716b544, 0x26eb3b23, 0xcb1d3c22, 0xcae0b245,
+    0xc9e721ed, 0xc81aaf8a, 0x3e9febb9, 0x3f6265de, 0x3c65f676,
+    0x3d987811},
+   {0x00000000, 0xfe0d0cf2, 0x0d6df4e1, 0xf360f813, 0xebac04c6,
+    0x15a10834, 0xe6c1f027, 0x18ccfcd5, 0x272fe589, 0xd922e97b,
+    0x2a421168, 0xd44f1d9a, 0xcc83e14f, 0x328eedbd, 0xc1ee15ae,
+    0x3fe3195c, 0xbf282616, 0x41252ae4, 0xb245d2f7, 0x4c48de05,
+    0x548422d0, 0xaa892e22, 0x59e9d631, 0xa7e4dac3, 0x9807c39f,
+    0x660acf6d, 0x956a377e, 0x6b673b8c, 0x73abc759, 0x8da6cbab,
+    0x7ec633b8, 0x80cb3f4a, 0x7e514c2c, 0x805c40de, 0x733cb8cd,
+    0x8d31b43f, 0x95fd48ea, 0x6bf04418, 0x9890bc0b, 0x669db0f9,
+    0x597ea9a5, 0xa773a557, 0x54135d44, 0xaa1e51b6, 0xb2d2ad63,
+    0x4cdfa191, 0xbfbf5982, 0x41b25570, 0xc1796a3a, 0x3f7466c8,
+    0xcc149edb, 0x32199229, 0x2ad56efc, 0xd4d8620e, 0x27b89a1d,
+    0xd9b596ef, 0xe6568fb3, 0x185b8341, 0xeb3b7b52, 0x153677a0,
+    0x0dfa8b75, 0xf3f78787, 0x00977f94, 0xfe9a7366, 0xfca29858,
+    0x02af94aa, 0xf1cf6cb9, 0x0fc2604b, 0x170e9c9e, 0xe903906c,
+    0x1a63687f, 0xe46e648d, 0xdb8d7dd1, 0x25807123, 0xd6e08930,
+    0x28ed85c2, 0x30217917, 0xce2c75e5, 0x3d4c8df6, 0xc3418104,
+    0x438abe4e, 0xbd87b2bc, 0x4ee74aaf, 0xb0ea465d, 0xa826ba88,
+    0x562bb67a, 0xa54b4e69, 0x5b46429b, 0x64a55bc7, 0x9aa85735,
+    0x69c8af26, 0x97c5a3d4, 0x8f095f01, 0x710453f3, 0x8264abe0,
+    0x7c69a712, 0x82f3d474, 0x7cfed886, 0x8f9e2095, 0x71932c67,
+    0x695fd0b2, 0x9752dc40, 0x64322453, 0x9a3f28a1, 0xa5dc31fd,
+    0x5bd13d0f, 0xa8b1c51c, 0x56bcc9ee, 0x4e70353b, 0xb07d39c9,
+    0x431dc1da, 0xbd10cd28, 0x3ddbf262, 0xc3d6fe90, 0x30b60683,
+    0xcebb0a71, 0xd677f6a4, 0x287afa56, 0xdb1a0245, 0x25170eb7,
+    0x1af417eb, 0xe4f91b19, 0x1799e30a, 0xe994eff8, 0xf158132d,
+    0x0f551fdf, 0xfc35e7cc, 0x0238eb3e, 0xf84531b1, 0x06483d43,
+    0xf528c550, 0x0b25c9a2, 0x13e93577, 0xede43985, 0x1e84c196,
+    0xe089cd64, 0xdf6ad438, 0x2167d8ca, 0xd20720d9, 0x2c0a2c2b,
+    0x34c6d0fe, 0xcacbdc0c, 0x39ab241f, 0xc7a628ed, 0x476d17a7,
+    0xb9601b55, 0x4a00e346, 0xb40defb4, 0xacc11361, 0x52cc1f93,
+    0xa1ace780, 0x5fa1eb72, 0x6042f22e, 0x9e4ffedc, 0x6d2f06cf,
+    0x93220a3d, 0x8beef6e8, 0x75e3fa1a, 0x86830209, 0x788e0efb,
+    0x86147d9d, 0x7819716f, 0x8b79897c, 0x7574858e, 0x6db8795b,
+    0x93b575a9, 0x60d58dba, 0x9ed88148, 0xa13b9814, 0x5f3694e6,
+    0xac566cf5, 0x525b6007, 0x4a979cd2, 0xb49a9020, 0x47fa6833,
+    0xb9f764c1, 0x393c5b8b, 0xc7315779, 0x3451af6a, 0xca5ca398,
+    0xd2905f4d, 0x2c9d53bf, 0xdffdabac, 0x21f0a75e, 0x1e13be02,
+    0xe01eb2f0, 0x137e4ae3, 0xed734611, 0xf5bfbac4, 0x0bb2b636,
+    0xf8d24e25, 0x06df42d7, 0x04e7a9e9, 0xfaeaa51b, 0x098a5d08,
+    0xf78751fa, 0xef4bad2f, 0x1146a1dd, 0xe22659ce, 0x1c2b553c,
+    0x23c84c60, 0xddc54092, 0x2ea5b881, 0xd0a8b473, 0xc86448a6,
+    0x36694454, 0xc509bc47, 0x3b04b0b5, 0xbbcf8fff, 0x45c2830d,
+    0xb6a27b1e, 0x48af77ec, 0x50638b39, 0xae6e87cb, 0x5d0e7fd8,
+    0xa303732a, 0x9ce06a76, 0x62ed6684, 0x918d9e97, 0x6f809265,
+    0x774c6eb0, 0x89416242, 0x7a219a51, 0x842c96a3, 0x7ab6e5c5,
+    0x84bbe937, 0x77db1124, 0x89d61dd6, 0x911ae103, 0x6f17edf1,
+    0x9c7715e2, 0x627a1910, 0x5d99004c, 0xa3940cbe, 0x50f4f4ad,
+    0xaef9f85f, 0xb635048a, 0x48380878, 0xbb58f06b, 0x4555fc99,
+    0xc59ec3d3, 0x3b93cf21, 0xc8f33732, 0x36fe3bc0, 0x2e32c715,
+    0xd03fcbe7, 0x235f33f4, 0xdd523f06, 0xe2b1265a, 0x1cbc2aa8,
+    0xefdcd2bb, 0x11d1de49, 0x091d229c, 0xf7102e6e, 0x0470d67d,
+    0xfa7dda8f}};
+
+#endif /* W */
+
+#endif /* N == 4 */
+#if N == 5
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xddc0152b, 0xbe6c5ca7, 0x63ac498c, 0x7934cfbf,
+    0xa4f4da94, 0xc7589318, 0x1a988633, 0xf2699f7e, 0x2fa98a55,
+    0x4c05c3d9, 0x91c5d6f2, 0x8b5d50c1, 0x569d45ea, 0x35310c66,
+    0xe8f1194d, 0xe13f480d, 0x3cff5d26, 0x5f5314aa, 0x82930181,
+    0x980b87b2, 0x45cb9299, 0x2667db15, 0xfba7ce3e, 0x1356d773,
+    0xce96c258, 0xad3a8bd4, 0x70fa9eff, 0x6a6218cc, 0xb7a20de7,
+    0xd40e446b, 0x09ce5140, 0xc792e6eb, 0x1a52f3c0, 0x79feba4c,
+    0xa43eaf67, 0xbea62954, 0x63663c7f, 0x00ca75f3, 0xdd0a60d8,
+    0x35fb7995, 0xe83b6cbe, 0x8b972532, 0x56573019, 0x4ccfb62a,
+    0x910fa301, 0xf2a3ea8d, 0x2f63ffa6, 0x26adaee6, 0xfb6dbbcd,
+    0x98c1f241, 0x4501e76a, 0x5f996159, 0x82597472, 0xe1f53dfe,
+    0x3c3528d5, 0xd4c43198, 0x090424b3, 0x6aa86d3f, 0xb7687814,
+    0xadf0fe27, 0x7030eb0c, 0x139ca280, 0xce5cb7ab, 0x8ac9bb27,
+    0x5709ae0c, 0x34a5e780, 0xe965f2ab, 0xf3fd7498, 0x2e3d61b3,
+    0x4d91283f, 0x90513d14, 0x78a02459, 0xa5603172, 0xc6cc78fe,
+    0x1b0c6dd5, 0x0194ebe6, 0xdc54fecd, 0xbff8b741, 0x6238a26a,
+    0x6bf6f32a, 0xb636e601, 0xd59aaf8d, 0x085abaa6, 0x12c23c95,
+    0xcf0229be, 0xacae6032, 0x716e7519, 0x999f6c54, 0x445f797f,
+    0x27f330f3, 0xfa3325d8, 0xe0aba3eb, 0x3d6bb6c0, 0x5ec7ff4c,
+    0x8307ea67, 0x4d5b5dcc, 0x909b48e7, 0xf337016b, 0x2ef71440,
+    0x346f9273, 0xe9af8758, 0x8a03ced4, 0x57c3dbff, 0xbf32c2b2,
+    0x62f2d799, 0x015e9e15, 0xdc9e8b3e, 0xc6060d0d, 0x1bc61826,
+    0x786a51aa, 0xa5aa4481, 0xac6415c1, 0x71a400ea, 0x12084966,
+    0xcfc85c4d, 0xd550da7e, 0x0890cf55, 0x6b3c86d9, 0xb6fc93f2,
+    0x5e0d8abf, 0x83cd9f94, 0xe061d618, 0x3da1c333, 0x27394500,
+    0xfaf9502b, 0x995519a7, 0x44950c8c, 0x107f00bf, 0xcdbf1594,
+    0xae135c18, 0x73d34933, 0x694bcf00, 0xb48bda2b, 0xd72793a7,
+    0x0ae7868c, 0xe2169fc1, 0x3fd68aea, 0x5c7ac366, 0x81bad64d,
+    0x9b22507e, 0x46e24555, 0x254e0cd9, 0xf88e19f2, 0xf14048b2,
+    0x2c805d99, 0x4f2c1415, 0x92ec013e, 0x8874870d, 0x55b49226,
+    0x3618dbaa, 0xebd8ce81, 0x0329d7cc, 0xdee9c2e7, 0xbd458b6b,
+    0x60859e40, 0x7a1d1873, 0xa7dd0d58, 0xc47144d4, 0x19b151ff,
+    0xd7ede654, 0x0a2df37f, 0x6981baf3, 0xb441afd8, 0xaed929eb,
+    0x73193cc0, 0x10b5754c, 0xcd756067, 0x2584792a, 0xf8446c01,
+    0x9be8258d, 0x462830a6, 0x5cb0b695, 0x8170a3be, 0xe2dcea32,
+    0x3f1cff19, 0x36d2ae59, 0xeb12bb72, 0x88bef2fe, 0x557ee7d5,
+    0x4fe661e6, 0x922674cd, 0xf18a3d41, 0x2c4a286a, 0xc4bb3127,
+    0x197b240c, 0x7ad76d80, 0xa71778ab, 0xbd8ffe98, 0x604febb3,
+    0x03e3a23f, 0xde23b714, 0x9ab6bb98, 0x4776aeb3, 0x24dae73f,
+    0xf91af214, 0xe3827427, 0x3e42610c, 0x5dee2880, 0x802e3dab,
+    0x68df24e6, 0xb51f31cd, 0xd6b37841, 0x0b736d6a, 0x11ebeb59,
+    0xcc2bfe72, 0xaf87b7fe, 0x7247a2d5, 0x7b89f395, 0xa649e6be,
+    0xc5e5af32, 0x1825ba19, 0x02bd3c2a, 0xdf7d2901, 0xbcd1608d,
+    0x611175a6, 0x89e06ceb, 0x542079c0, 0x378c304c, 0xea4c2567,
+    0xf0d4a354, 0x2d14b67f, 0x4eb8fff3, 0x9378ead8, 0x5d245d73,
+    0x80e44858, 0xe34801d4, 0x3e8814ff, 0x241092cc, 0xf9d087e7,
+    0x9a7cce6b, 0x47bcdb40, 0xaf4dc20d, 0x728dd726, 0x11219eaa,
+    0xcce18b81, 0xd6790db2, 0x0bb91899, 0x68155115, 0xb5d5443e,
+    0xbc1b157e, 0x61db0055, 0x027749d9, 0xdfb75cf2, 0xc52fdac1,
+    0x18efcfea, 0x7b438666, 0xa683934d, 0x4e728a00, 0x93b29f2b,
+    0xf01ed6a7, 0x2ddec38c, 0x374645bf, 0xea865094, 0x892a1918,
+    0x54ea0c33},
+   {0x00000000, 0x20fe017e, 0x41fc02fc, 0x61020382, 0x83f805f8,
+    0xa3060486, 0xc2040704, 0xe2fa067a, 0x021c7d01, 0x22e27c7f,
+    0x43e07ffd, 0x631e7e83, 0x81e478f9, 0xa11a7987, 0xc0187a05,
+    0xe0e67b7b, 0x0438fa02, 0x24c6fb7c, 0x45c4f8fe, 0x653af980,
+    0x87c0fffa, 0xa73efe84, 0xc63cfd06, 0xe6c2fc78, 0x06248703,
+    0x26da867d, 0x47d885ff, 0x67268481, 0x85dc82fb, 0xa5228385,
+    0xc4208007, 0xe4de8179, 0x0871f404, 0x288ff57a, 0x498df6f8,
+    0x6973f786, 0x8b89f1fc, 0xab77f082, 0xca75f300, 0xea8bf27e,
+    0x0a6d8905, 0x2a93887b, 0x4b918bf9, 0x6b6f8a87, 0x89958cfd,
+    0xa96b8d83, 0xc8698e01, 0xe8978f7f, 0x0c490e06, 0x2cb70f78,
+    0x4db50cfa, 0x6d4b0d84, 0x8fb10bfe, 0xaf4f0a80, 0xce4d0902,
+    0xeeb3087c, 0x0e557307, 0x2eab7279, 0x4fa971fb, 0x6f577085,
+    0x8dad76ff, 0xad537781, 0xcc517403, 0xecaf757d, 0x10e3e808,
+    0x301de976, 0x511feaf4, 0x71e1eb8a, 0x931bedf0, 0xb3e5ec8e,
+    0xd2e7ef0c, 0xf219ee72, 0x12ff9509, 0x32019477, 0x530397f5,
+    0x73fd968b, 0x910790f1, 0xb1f9918f, 0xd0fb920d, 0xf0059373,
+    0x14db120a, 0x34251374, 0x552710f6, 0x75d91188, 0x972317f2,
+    0xb7dd168c, 0xd6df150e, 0xf6211470, 0x16c76f0b, 0x36396e75,
+    0x573b6df7, 0x77c56c89, 0x953f6af3, 0xb5c16b8d, 0xd4c3680f,
+    0xf43d6971, 0x18921c0c, 0x386c1d72, 0x596e1ef0, 0x79901f8e,
+    0x9b6a19f4, 0xbb94188a, 0xda961b08, 0xfa681a76, 0x1a8e610d,
+    0x3a706073, 0x5b7263f1, 0x7b8c628f, 0x997664f5, 0xb988658b,
+    0xd88a6609, 0xf8746777, 0x1caae60e, 0x3c54e770, 0x5d56e4f2,
+    0x7da8e58c, 0x9f52e3f6, 0xbface288, 0xdeaee10a, 0xfe50e074,
+    0x1eb69b0f, 0x3e489a71, 0x5f4a99f3, 0x7fb4988d, 0x9d4e9ef7,
+    0xbdb09f89, 0xdcb29c0b, 0xfc4c9d75, 0x21c7d010, 0x0139d16e,
+    0x603bd2ec, 0x40c5d392, 0xa23fd5e8, 0x82c1d496, 0xe3c3d714,
+    0xc33dd66a, 0x23dbad11, 0x0325ac6f, 0x6227afed, 0x42d9ae93,
+    0xa023a8e9, 0x80dda997, 0xe1dfaa15, 0xc121ab6b, 0x25ff2a12,
+    0x05012b6c, 0x640328ee, 0x44fd2990, 0xa6072fea, 0x86f92e94,
+    0xe7fb2d16, 0xc7052c68, 0x27e35713, 0x071d566d, 0x661f55ef,
+    0x46e15491, 0xa41b52eb, 0x84e55395, 0xe5e75017, 0xc5195169,
+    0x29b62414, 0x0948256a, 0x684a26e8, 0x48b42796, 0xaa4e21ec,
+    0x8ab02092, 0xebb22310, 0xcb4c226e, 0x2baa5915, 0x0b54586b,
+    0x6a565be9, 0x4aa85a97, 0xa8525ced, 0x88ac5d93, 0xe9ae5e11,
+    0xc9505f6f, 0x2d8ede16, 0x0d70df68, 0x6c72dcea, 0x4c8cdd94,
+    0xae76dbee, 0x8e88da90, 0xef8ad912, 0xcf74d86c, 0x2f92a317,
+    0x0f6ca269, 0x6e6ea1eb, 0x4e90a095, 0xac6aa6ef, 0x8c94a791,
+    0xed96a413, 0xcd68a56d, 0x31243818, 0x11da3966, 0x70d83ae4,
+    0x50263b9a, 0xb2dc3de0, 0x92223c9e, 0xf3203f1c, 0xd3de3e62,
+    0x33384519, 0x13c64467, 0x72c447e5, 0x523a469b, 0xb0c040e1,
+    0x903e419f, 0xf13c421d, 0xd1c24363, 0x351cc21a, 0x15e2c364,
+    0x74e0c0e6, 0x541ec198, 0xb6e4c7e2, 0x961ac69c, 0xf718c51e,
+    0xd7e6c460, 0x3700bf1b, 0x17febe65, 0x76fcbde7, 0x5602bc99,
+    0xb4f8bae3, 0x9406bb9d, 0xf504b81f, 0xd5fab961, 0x3955cc1c,
+    0x19abcd62, 0x78a9cee0, 0x5857cf9e, 0xbaadc9e4, 0x9a53c89a,
+    0xfb51cb18, 0xdbafca66, 0x3b49b11d, 0x1bb7b063, 0x7ab5b3e1,
+    0x5a4bb29f, 0xb8b1b4e5, 0x984fb59b, 0xf94db619, 0xd9b3b767,
+    0x3d6d361e, 0x1d933760, 0x7c9134e2, 0x5c6f359c, 0xbe9533e6,
+    0x9e6b3298, 0xff69311a, 0xdf973064, 0x3f714b1f, 0x1f8f4a61,
+    0x7e8d49e3, 0x5e73489d, 0xbc894ee7, 0x9c774f99, 0xfd754c1b,
+    0xdd8b4d65},
+   {0x00000000, 0x438fa020, 0x871f4040, 0xc490e060, 0x0bd2f671,
+    0x485d5651, 0x8ccdb631, 0xcf421611, 0x17a5ece2, 0x542a4cc2,
+    0x90baaca2, 0xd3350c82, 0x1c771a93, 0x5ff8bab3, 0x9b685ad3,
+    0xd8e7faf3, 0x2f4bd9c4, 0x6cc479e4, 0xa8549984, 0xebdb39a4,
+    0x24992fb5, 0x67168f95, 0xa3866ff5, 0xe009cfd5, 0x38ee3526,
+    0x7b619506, 0xbff17566, 0xfc7ed546, 0x333cc357, 0x70b36377,
+    0xb4238317, 0xf7ac2337, 0x5e97b388, 0x1d1813a8, 0xd988f3c8,
+    0x9a0753e8, 0x554545f9, 0x16cae5d9, 0xd25a05b9, 0x91d5a599,
+    0x49325f6a, 0x0abdff4a, 0xce2d1f2a, 0x8da2bf0a, 0x42e0a91b,
+    0x016f093b, 0xc5ffe95b, 0x8670497b, 0x71dc6a4c, 0x3253ca6c,
+    0xf6c32a0c, 0xb54c8a2c, 0x7a0e9c3d, 0x39813c1d, 0xfd11dc7d,
+    0xbe9e7c5d, 0x667986ae, 0x25f6268e, 0xe166c6ee, 0xa2e966ce,
+    0x6dab70df, 0x2e24d0ff, 0xeab4309f, 0xa93b90bf, 0xbd2f6710,
+    0xfea0c730, 0x3a302750, 0x79bf8770, 0xb6fd9161, 0xf5723141,
+    0x31e2d121, 0x726d7101, 0xaa8a8bf2, 0xe9052bd2, 0x2d95cbb2,
+    0x6e1a6b92, 0xa1587d83, 0xe2d7dda3, 0x26473dc3, 0x65c89de3,
+    0x9264bed4, 0xd1eb1ef4, 0x157bfe94, 0x56f45eb4, 0x99b648a5,
+    0xda39e885, 0x1ea908e5, 0x5d26a8c5, 0x85c15236, 0xc64ef216,
+    0x02de1276, 0x4151b256, 0x8e13a447, 0xcd9c0467, 0x090ce407,
+    0x4a834427, 0xe3b8d498, 0xa03774b8, 0x64a794d8, 0x272834f8,
+    0xe86a22e9, 0xabe582c9, 0x6f7562a9, 0x2cfac289, 0xf41d387a,
+    0xb792985a, 0x7302783a, 0x308dd81a, 0xffcfce0b, 0xbc406e2b,
+    0x78d08e4b, 0x3b5f2e6b, 0xccf30d5c, 0x8f7cad7c, 0x4bec4d1c,
+    0x0863ed3c, 0xc721fb2d, 0x84ae5b0d, 0x403ebb6d, 0x03b11b4d,
+    0xdb56e1be, 0x98d9419e, 0x5c49a1fe, 0x1fc601de, 0xd08417cf,
+    0x930bb7ef, 0x579b578f, 0x1414f7af, 0x7fb2b8d1, 0x3c3d18f1,
+    0xf8adf891, 0xbb2258b1, 0x74604ea0, 0x37efee80, 0xf37f0ee0,
+    0xb0f0aec0, 0x68175433, 0x2b98f413, 0xef081473, 0xac87b453,
+    0x63c5a242, 0x204a0262, 0xe4dae202, 0xa7554222, 0x50f96115,
+    0x1376c135, 0xd7e62155, 0x94698175, 0x5b2b9764, 0x18a43744,
+    0xdc34d724, 0x9fbb7704, 0x475c8df7, 0x04d32dd7, 0xc043cdb7,
+    0x83cc6d97, 0x4c8e7b86, 0x0f01dba6, 0xcb913bc6, 0x881e9be6,
+    0x21250b59, 0x62aaab79, 0xa63a4b19, 0xe5b5eb39, 0x2af7fd28,
+    0x69785d08, 0xade8bd68, 0xee671d48, 0x3680e7bb, 0x750f479b,
+    0xb19fa7fb, 0xf21007db, 0x3d5211ca, 0x7eddb1ea, 0xba4d518a,
+    0xf9c2f1aa, 0x0e6ed29d, 0x4de172bd, 0x897192dd, 0xcafe32fd,
+    0x05bc24ec, 0x463384cc, 0x82a364ac, 0xc12cc48c, 0x19cb3e7f,
+    0x5a449e5f, 0x9ed47e3f, 0xdd5bde1f, 0x1219c80e, 0x5196682e,
+    0x9506884e, 0xd689286e, 0xc29ddfc1, 0x81127fe1, 0x45829f81,
+    0x060d3fa1, 0xc94f29b0, 0x8ac08990, 0x4e5069f0, 0x0ddfc9d0,
+    0xd5383323, 0x96b79303, 0x52277363, 0x11a8d343, 0xdeeac552,
+    0x9d656572, 0x59f58512, 0x1a7a2532, 0xedd60605, 0xae59a625,
+    0x6ac94645, 0x2946e665, 0xe604f074, 0xa58b5054, 0x611bb034,
+    0x22941014, 0xfa73eae7, 0xb9fc4ac7, 0x7d6caaa7, 0x3ee30a87,
+    0xf1a11c96, 0xb22ebcb6, 0x76be5cd6, 0x3531fcf6, 0x9c0a6c49,
+    0xdf85cc69, 0x1b152c09, 0x589a8c29, 0x97d89a38, 0xd4573a18,
+    0x10c7da78, 0x53487a58, 0x8baf80ab, 0xc820208b, 0x0cb0c0eb,
+    0x4f3f60cb, 0x807d76da, 0xc3f2d6fa, 0x0762369a, 0x44ed96ba,
+    0xb341b58d, 0xf0ce15ad, 0x345ef5cd, 0x77d155ed, 0xb89343fc,
+    0xfb1ce3dc, 0x3f8c03bc, 0x7c03a39c, 0xa4e4596f, 0xe76bf94f,
+    0x23fb192f, 0x6074b90f, 0xaf36af1e, 0xecb90f3e, 0x2829ef5e,
+    0x6ba64f7e},
+   {0x00000000, 0xff6571a2, 0xfb2695b5, 0x0443e417, 0xf3a15d9b,
+    0x0cc42c39, 0x0887c82e, 0xf7e2b98c, 0xe2aecdc7, 0x1dcbbc65,
+    0x19885872, 0xe6ed29d0, 0x110f905c, 0xee6ae1fe, 0xea2905e9,
+    0x154c744b, 0xc0b1ed7f, 0x3fd49cdd, 0x3b9778ca, 0xc4f20968,
+    0x3310b0e4, 0xcc75c146, 0xc8362551, 0x375354f3, 0x221f20b8,
+    0xdd7a511a, 0xd939b50d, 0x265cc4af, 0xd1be7d23, 0x2edb0c81,
+    0x2a98e896, 0xd5fd9934, 0x848fac0f, 0x7beaddad, 0x7fa939ba,
+    0x80cc4818, 0x772ef194, 0x884b8036, 0x8c086421, 0x736d1583,
+    0x662161c8, 0x9944106a, 0x9d07f47d, 0x626285df, 0x95803c53,
+    0x6ae54df1, 0x6ea6a9e6, 0x91c3d844, 0x443e4170, 0xbb5b30d2,
+    0xbf18d4c5, 0x407da567, 0xb79f1ceb, 0x48fa6d49, 0x4cb9895e,
+    0xb3dcf8fc, 0xa6908cb7, 0x59f5fd15, 0x5db61902, 0xa2d368a0,
+    0x5531d12c, 0xaa54a08e, 0xae174499, 0x5172353b, 0x0cf32eef,
+    0xf3965f4d, 0xf7d5bb5a, 0x08b0caf8, 0xff527374, 0x003702d6,
+    0x0474e6c1, 0xfb119763, 0xee5de328, 0x1138928a, 0x157b769d,
+    0xea1e073f, 0x1dfcbeb3, 0xe299cf11, 0xe6da2b06, 0x19bf5aa4,
+    0xcc42c390, 0x3327b232, 0x37645625, 0xc8012787, 0x3fe39e0b,
+    0xc086efa9, 0xc4c50bbe, 0x3ba07a1c, 0x2eec0e57, 0xd1897ff5,
+    0xd5ca9be2, 0x2aafea40, 0xdd4d53cc, 0x2228226e, 0x266bc679,
+    0xd90eb7db, 0x887c82e0, 0x7719f342, 0x735a1755, 0x8c3f66f7,
+    0x7bdddf7b, 0x84b8aed9, 0x80fb4ace, 0x7f9e3b6c, 0x6ad24f27,
+    0x95b73e85, 0x91f4da92, 0x6e91ab30, 0x997312bc, 0x6616631e,
+    0x62558709, 0x9d30f6ab, 0x48cd6f9f, 0xb7a81e3d, 0xb3ebfa2a,
+    0x4c8e8b88, 0xbb6c3204, 0x440943a6, 0x404aa7b1, 0xbf2fd613,
+    0xaa63a258, 0x5506d3fa, 0x514537ed, 0xae20464f, 0x59c2ffc3,
+    0xa6a78e61, 0xa2e46a76, 0x5d811bd4, 0x19e65dde, 0xe6832c7c,
+    0xe2c0c86b, 0x1da5b9c9, 0xea470045, 0x152271e7, 0x116195f0,
+    0xee04e452, 0xfb489019, 0x042de1bb, 0x006e05ac, 0xff0b740e,
+    0x08e9cd82, 0xf78cbc20, 0xf3cf5837, 0x0caa2995, 0xd957b0a1,
+    0x2632c103, 0x22712514, 0xdd1454b6, 0x2af6ed3a, 0xd5939c98,
+    0xd1d0788f, 0x2eb5092d, 0x3bf97d66, 0xc49c0cc4, 0xc0dfe8d3,
+    0x3fba9971, 0xc85820fd, 0x373d515f, 0x337eb548, 0xcc1bc4ea,
+    0x9d69f1d1, 0x620c8073, 0x664f6464, 0x992a15c6, 0x6ec8ac4a,
+    0x91addde8, 0x95ee39ff, 0x6a8b485d, 0x7fc73c16, 0x80a24db4,
+    0x84e1a9a3, 0x7b84d801, 0x8c66618d, 0x7303102f, 0x7740f438,
+    0x8825859a, 0x5dd81cae, 0xa2bd6d0c, 0xa6fe891b, 0x599bf8b9,
+    0xae794135, 0x511c3097, 0x555fd480, 0xaa3aa522, 0xbf76d169,
+    0x4013a0cb, 0x445044dc, 0xbb35357e, 0x4cd78cf2, 0xb3b2fd50,
+    0xb7f11947, 0x489468e5, 0x15157331, 0xea700293, 0xee33e684,
+    0x11569726, 0xe6b42eaa, 0x19d15f08, 0x1d92bb1f, 0xe2f7cabd,
+    0xf7bbbef6, 0x08decf54, 0x0c9d2b43, 0xf3f85ae1, 0x041ae36d,
+    0xfb7f92cf, 0xff3c76d8, 0x0059077a, 0xd5a49e4e, 0x2ac1efec,
+    0x2e820bfb, 0xd1e77a59, 0x2605c3d5, 0xd960b277, 0xdd235660,
+    0x224627c2, 0x370a5389, 0xc86f222b, 0xcc2cc63c, 0x3349b79e,
+    0xc4ab0e12, 0x3bce7fb0, 0x3f8d9ba7, 0xc0e8ea05, 0x919adf3e,
+    0x6effae9c, 0x6abc4a8b, 0x95d93b29, 0x623b82a5, 0x9d5ef307,
+    0x991d1710, 0x667866b2, 0x733412f9, 0x8c51635b, 0x8812874c,
+    0x7777f6ee, 0x80954f62, 0x7ff03ec0, 0x7bb3dad7, 0x84d6ab75,
+    0x512b3241, 0xae4e43e3, 0xaa0da7f4, 0x5568d656, 0xa28a6fda,
+    0x5def1e78, 0x59acfa6f, 0xa6c98bcd, 0xb385ff86, 0x4ce08e24,
+    0x48a36a33, 0xb7c61b91, 0x4024a21d, 0xbf41d3bf, 0xbb0237a8,
+    0x4467460a},
+   {0x00000000, 0x33ccbbbc, 0x67997778, 0x5455ccc4, 0xcf32eef0,
+    0xfcfe554c, 0xa8ab9988, 0x9b672234, 0x9b89ab11, 0xa84510ad,
+    0xfc10dc69, 0xcfdc67d5, 0x54bb45e1, 0x6777fe5d, 0x33223299,
+    0x00ee8925, 0x32ff20d3, 0x01339b6f, 0x556657ab, 0x66aaec17,
+    0xfdcdce23, 0xce01759f, 0x9a54b95b, 0xa99802e7, 0xa9768bc2,
+    0x9aba307e, 0xceeffcba, 0xfd234706, 0x66446532, 0x5588de8e,
+    0x01dd124a, 0x3211a9f6, 0x65fe41a6, 0x5632fa1a, 0x026736de,
+    0x31ab8d62, 0xaaccaf56, 0x990014ea, 0xcd55d82e, 0xfe996392,
+    0xfe77eab7, 0xcdbb510b, 0x99ee9dcf, 0xaa222673, 0x31450447,
+    0x0289bffb, 0x56dc733f, 0x6510c883, 0x57016175, 0x64cddac9,
+    0x3098160d, 0x0354adb1, 0x98338f85, 0xabff3439, 0xffaaf8fd,
+    0xcc664341, 0xcc88ca64, 0xff4471d8, 0xab11bd1c, 0x98dd06a0,
+    0x03ba2494, 0x30769f28, 0x642353ec, 0x57efe850, 0xcbfc834c,
+    0xf83038f0, 0xac65f434, 0x9fa94f88, 0x04ce6dbc, 0x3702d600,
+    0x63571ac4, 0x509ba178, 0x5075285d, 0x63b993e1, 0x37ec5f25,
+    0x0420e499, 0x9f47c6ad, 0xac8b7d11, 0xf8deb1d5, 0xcb120a69,
+    0xf903a39f, 0xcacf1823, 0x9e9ad4e7, 0xad566f5b, 0x36314d6f,
+    0x05fdf6d3, 0x51a83a17, 0x626481ab, 0x628a088e, 0x5146b332,
+    0x05137ff6, 0x36dfc44a, 0xadb8e67e, 0x9e745dc2, 0xca219106,
+    0xf9ed2aba, 0xae02c2ea, 0x9dce7956, 0xc99bb592, 0xfa570e2e,
+    0x61302c1a, 0x52fc97a6, 0x06a95b62, 0x3565e0de, 0x358b69fb,
+    0x0647d247, 0x52121e83, 0x61dea53f, 0xfab9870b, 0xc9753cb7,
+    0x9d20f073, 0xaeec4bcf, 0x9cfde239, 0xaf315985, 0xfb649541,
+    0xc8a82efd, 0x53cf0cc9, 0x6003b775, 0x34567bb1, 0x079ac00d,
+    0x07744928, 0x34b8f294, 0x60ed3e50, 0x532185ec, 0xc846a7d8,
+    0xfb8a1c64, 0xafdfd0a0, 0x9c136b1c, 0x92157069, 0xa1d9cbd5,
+    0xf58c0711, 0xc640bcad, 0x5d279e99, 0x6eeb2525, 0x3abee9e1,
+    0x0972525d, 0x099cdb78, 0x3a5060c4, 0x6e05ac00, 0x5dc917bc,
+    0xc6ae3588, 0xf5628e34, 0xa13742f0, 0x92fbf94c, 0xa0ea50ba,
+    0x9326eb06, 0xc77327c2, 0xf4bf9c7e, 0x6fd8be4a, 0x5c1405f6,
+    0x0841c932, 0x3b8d728e, 0x3b63fbab, 0x08af4017, 0x5cfa8cd3,
+    0x6f36376f, 0xf451155b, 0xc79daee7, 0x93c86223, 0xa004d99f,
+    0xf7eb31cf, 0xc4278a73, 0x907246b7, 0xa3befd0b, 0x38d9df3f,
+    0x0b156483, 0x5f40a847, 0x6c8c13fb, 0x6c629ade, 0x5fae2162,
+    0x0bfbeda6, 0x3837561a, 0xa350742e, 0x909ccf92, 0xc4c90356,
+    0xf705b8ea, 0xc514111c, 0xf6d8aaa0, 0xa28d6664, 0x9141ddd8,
+    0x0a26ffec, 0x39ea4450, 0x6dbf8894, 0x5e733328, 0x5e9dba0d,
+    0x6d5101b1, 0x3904cd75, 0x0ac876c9, 0x91af54fd, 0xa263ef41,
+    0xf6362385, 0xc5fa9839, 0x59e9f325, 0x6a254899, 0x3e70845d,
+    0x0dbc3fe1, 0x96db1dd5, 0xa517a669, 0xf1426aad, 0xc28ed111,
+    0xc2605834, 0xf1ace388, 0xa5f92f4c, 0x963594f0, 0x0d52b6c4,
+    0x3e9e0d78, 0x6acbc1bc, 0x59077a00, 0x6b16d3f6, 0x58da684a,
+    0x0c8fa48e, 0x3f431f32, 0xa4243d06, 0x97e886ba, 0xc3bd4a7e,
+    0xf071f1c2, 0xf09f78e7, 0xc353c35b, 0x97060f9f, 0xa4cab423,
+    0x3fad9617, 0x0c612dab, 0x5834e16f, 0x6bf85ad3, 0x3c17b283,
+    0x0fdb093f, 0x5b8ec5fb, 0x68427e47, 0xf3255c73, 0xc0e9e7cf,
+    0x94bc2b0b, 0xa77090b7, 0xa79e1992, 0x9452a22e, 0xc0076eea,
+    0xf3cbd556, 0x68acf762, 0x5b604cde, 0x0f35801a, 0x3cf93ba6,
+    0x0ee89250, 0x3d2429ec, 0x6971e528, 0x5abd5e94, 0xc1da7ca0,
+    0xf216c71c, 0xa6430bd8, 0x958fb064, 0x95613941, 0xa6ad82fd,
+    0xf2f84e39, 0xc134f585, 0x5a53d7b1, 0x699f6c0d, 0x3dcaa0c9,
+    0x0e061b75},
+   {0x00000000, 0x21c69623, 0x438d2c46, 0x624bba65, 0x871a588c,
+    0xa6dcceaf, 0xc49774ca, 0xe551e2e9, 0x0bd8c7e9, 0x2a1e51ca,
+    0x4855ebaf, 0x69937d8c, 0x8cc29f65, 0xad040946, 0xcf4fb323,
+    0xee892500, 0x17b18fd2, 0x367719f1, 0x543ca394, 0x75fa35b7,
+    0x90abd75e, 0xb16d417d, 0xd326fb18, 0xf2e06d3b, 0x1c69483b,
+    0x3dafde18, 0x5fe4647d, 0x7e22f25e, 0x9b7310b7, 0xbab58694,
+    0xd8fe3cf1, 0xf938aad2, 0x2f631fa4, 0x0ea58987, 0x6cee33e2,
+    0x4d28a5c1, 0xa8794728, 0x89bfd10b, 0xebf46b6e, 0xca32fd4d,
+    0x24bbd84d, 0x057d4e6e, 0x6736f40b, 0x46f06228, 0xa3a180c1,
+    0x826716e2, 0xe02cac87, 0xc1ea3aa4, 0x38d29076, 0x19140655,
+    0x7b5fbc30, 0x5a992a13, 0xbfc8c8fa, 0x9e0e5ed9, 0xfc45e4bc,
+    0xdd83729f, 0x330a579f, 0x12ccc1bc, 0x70877bd9, 0x5141edfa,
+    0xb4100f13, 0x95d69930, 0xf79d2355, 0xd65bb576, 0x5ec63f48,
+    0x7f00a96b, 0x1d4b130e, 0x3c8d852d, 0xd9dc67c4, 0xf81af1e7,
+    0x9a514b82, 0xbb97dda1, 0x551ef8a1, 0x74d86e82, 0x1693d4e7,
+    0x375542c4, 0xd204a02d, 0xf3c2360e, 0x91898c6b, 0xb04f1a48,
+    0x4977b09a, 0x68b126b9, 0x0afa9cdc, 0x2b3c0aff, 0xce6de816,
+    0xefab7e35, 0x8de0c450, 0xac265273, 0x42af7773, 0x6369e150,
+    0x01225b35, 0x20e4cd16, 0xc5b52fff, 0xe473b9dc, 0x863803b9,
+    0xa7fe959a, 0x71a520ec, 0x5063b6cf, 0x32280caa, 0x13ee9a89,
+    0xf6bf7860, 0xd779ee43, 0xb5325426, 0x94f4c205, 0x7a7de705,
+    0x5bbb7126, 0x39f0cb43, 0x18365d60, 0xfd67bf89, 0xdca129aa,
+    0xbeea93cf, 0x9f2c05ec, 0x6614af3e, 0x47d2391d, 0x25998378,
+    0x045f155b, 0xe10ef7b2, 0xc0c86191, 0xa283dbf4, 0x83454dd7,
+    0x6dcc68d7, 0x4c0afef4, 0x2e414491, 0x0f87d2b2, 0xead6305b,
+    0xcb10a678, 0xa95b1c1d, 0x889d8a3e, 0xbd8c7e90, 0x9c4ae8b3,
+    0xfe0152d6, 0xdfc7c4f5, 0x3a96261c, 0x1b50b03f, 0x791b0a5a,
+    0x58dd9c79, 0xb654b979, 0x97922f5a, 0xf5d9953f, 0xd41f031c,
+    0x314ee1f5, 0x108877d6, 0x72c3cdb3, 0x53055b90, 0xaa3df142,
+    0x8bfb6761, 0xe9b0dd04, 0xc8764b27, 0x2d27a9ce, 0x0ce13fed,
+    0x6eaa8588, 0x4f6c13ab, 0xa1e536ab, 0x8023a088, 0xe2681aed,
+    0xc3ae8cce, 0x26ff6e27, 0x0739f804, 0x65724261, 0x44b4d442,
+    0x92ef6134, 0xb329f717, 0xd1624d72, 0xf0a4db51, 0x15f539b8,
+    0x3433af9b, 0x567815fe, 0x77be83dd, 0x9937a6dd, 0xb8f130fe,
+    0xdaba8a9b, 0xfb7c1cb8, 0x1e2dfe51, 0x3feb6872, 0x5da0d217,
+    0x7c664434, 0x855eeee6, 0xa49878c5, 0xc6d3c2a0, 0xe7155483,
+    0x0244b66a, 0x23822049, 0x41c99a2c, 0x600f0c0f, 0x8e86290f,
+    0xaf40bf2c, 0xcd0b0549, 0xeccd936a, 0x099c7183, 0x285ae7a0,
+    0x4a115dc5, 0x6bd7cbe6, 0xe34a41d8, 0xc28cd7fb, 0xa0c76d9e,
+    0x8101fbbd, 0x64501954, 0x45968f77, 0x27dd3512, 0x061ba331,
+    0xe8928631, 0xc9541012, 0xab1faa77, 0x8ad93c54, 0x6f88debd,
+    0x4e4e489e, 0x2c05f2fb, 0x0dc364d8, 0xf4fbce0a, 0xd53d5829,
+    0xb776e24c, 0x96b0746f, 0x73e19686, 0x522700a5, 0x306cbac0,
+    0x11aa2ce3, 0xff2309e3, 0xdee59fc0, 0xbcae25a5, 0x9d68b386,
+    0x7839516f, 0x59ffc74c, 0x3bb47d29, 0x1a72eb0a, 0xcc295e7c,
+    0xedefc85f, 0x8fa4723a, 0xae62e419, 0x4b3306f0, 0x6af590d3,
+    0x08be2ab6, 0x2978bc95, 0xc7f19995, 0xe6370fb6, 0x847cb5d3,
+    0xa5ba23f0, 0x40ebc119, 0x612d573a, 0x0366ed5f, 0x22a07b7c,
+    0xdb98d1ae, 0xfa5e478d, 0x9815fde8, 0xb9d36bcb, 0x5c828922,
+    0x7d441f01, 0x1f0fa564, 0x3ec93347, 0xd0401647, 0xf1868064,
+    0x93cd3a01, 0xb20bac22, 0x575a4ecb, 0x769cd8e8, 0x14d7628d,
+    0x3511f4ae},
+   {0x00000000, 0x7ef48bd1, 0xfde917a2, 0x831d9c73, 0xfe3e59b5,
+    0x80cad264, 0x03d74e17, 0x7d23c5c6, 0xf990c59b, 0x87644e4a,
+    0x0479d239, 0x7a8d59e8, 0x07ae9c2e, 0x795a17ff, 0xfa478b8c,
+    0x84b3005d, 0xf6cdfdc7, 0x88397616, 0x0b24ea65, 0x75d061b4,
+    0x08f3a472, 0x76072fa3, 0xf51ab3d0, 0x8bee3801, 0x0f5d385c,
+    0x71a9b38d, 0xf2b42ffe, 0x8c40a42f, 0xf16361e9, 0x8f97ea38,
+    0x0c8a764b, 0x727efd9a, 0xe8778d7f, 0x968306ae, 0x159e9add,
+    0x6b6a110c, 0x1649d4ca, 0x68bd5f1b, 0xeba0c368, 0x955448b9,
+    0x11e748e4, 0x6f13c335, 0xec0e5f46, 0x92fad497, 0xefd91151,
+    0x912d9a80, 0x123006f3, 0x6cc48d22, 0x1eba70b8, 0x604efb69,
+    0xe353671a, 0x9da7eccb, 0xe084290d, 0x9e70a2dc, 0x1d6d3eaf,
+    0x6399b57e, 0xe72ab523, 0x99de3ef2, 0x1ac3a281, 0x64372950,
+    0x1914ec96, 0x67e06747, 0xe4fdfb34, 0x9a0970e5, 0xd5036c0f,
+    0xabf7e7de, 0x28ea7bad, 0x561ef07c, 0x2b3d35ba, 0x55c9be6b,
+    0xd6d42218, 0xa820a9c9, 0x2c93a994, 0x52672245, 0xd17abe36,
+    0xaf8e35e7, 0xd2adf021, 0xac597bf0, 0x2f44e783, 0x51b06c52,
+    0x23ce91c8, 0x5d3a1a19, 0xde27866a, 0xa0d30dbb, 0xddf0c87d,
+    0xa30443ac, 0x2019dfdf, 0x5eed540e, 0xda5e5453, 0xa4aadf82,
+    0x27b743f1, 0x5943c820, 0x24600de6, 0x5a948637, 0xd9891a44,
+    0xa77d9195, 0x3d74e170, 0x43806aa1, 0xc09df6d2, 0xbe697d03,
+    0xc34ab8c5, 0xbdbe3314, 0x3ea3af67, 0x405724b6, 0xc4e424eb,
+    0xba10af3a, 0x390d3349, 0x47f9b898, 0x3ada7d5e, 0x442ef68f,
+    0xc7336afc, 0xb9c7e12d, 0xcbb91cb7, 0xb54d9766, 0x36500b15,
+    0x48a480c4, 0x35874502, 0x4b73ced3, 0xc86e52a0, 0xb69ad971,
+    0x3229d92c, 0x4cdd52fd, 0xcfc0ce8e, 0xb134455f, 0xcc178099,
+    0xb2e30b48, 0x31fe973b, 0x4f0a1cea, 0xafeaaeef, 0xd11e253e,
+    0x5203b94d, 0x2cf7329c, 0x51d4f75a, 0x2f207c8b, 0xac3de0f8,
+    0xd2c96b29, 0x567a6b74, 0x288ee0a5, 0xab937cd6, 0xd567f707,
+    0xa84432c1, 0xd6b0b910, 0x55ad2563, 0x2b59aeb2, 0x59275328,
+    0x27d3d8f9, 0xa4ce448a, 0xda3acf5b, 0xa7190a9d, 0xd9ed814c,
+    0x5af01d3f, 0x240496ee, 0xa0b796b3, 0xde431d62, 0x5d5e8111,
+    0x23aa0ac0, 0x5e89cf06, 0x207d44d7, 0xa360d8a4, 0xdd945375,
+    0x479d2390, 0x3969a841, 0xba743432, 0xc480bfe3, 0xb9a37a25,
+    0xc757f1f4, 0x444a6d87, 0x3abee656, 0xbe0de60b, 0xc0f96dda,
+    0x43e4f1a9, 0x3d107a78, 0x4033bfbe, 0x3ec7346f, 0xbddaa81c,
+    0xc32e23cd, 0xb150de57, 0xcfa45586, 0x4cb9c9f5, 0x324d4224,
+    0x4f6e87e2, 0x319a0c33, 0xb2879040, 0xcc731b91, 0x48c01bcc,
+    0x3634901d, 0xb5290c6e, 0xcbdd87bf, 0xb6fe4279, 0xc80ac9a8,
+    0x4b1755db, 0x35e3de0a, 0x7ae9c2e0, 0x041d4931, 0x8700d542,
+    0xf9f45e93, 0x84d79b55, 0xfa231084, 0x793e8cf7, 0x07ca0726,
+    0x8379077b, 0xfd8d8caa, 0x7e9010d9, 0x00649b08, 0x7d475ece,
+    0x03b3d51f, 0x80ae496c, 0xfe5ac2bd, 0x8c243f27, 0xf2d0b4f6,
+    0x71cd2885, 0x0f39a354, 0x721a6692, 0x0ceeed43, 0x8ff37130,
+    0xf107fae1, 0x75b4fabc, 0x0b40716d, 0x885ded1e, 0xf6a966cf,
+    0x8b8aa309, 0xf57e28d8, 0x7663b4ab, 0x08973f7a, 0x929e4f9f,
+    0xec6ac44e, 0x6f77583d, 0x1183d3ec, 0x6ca0162a, 0x12549dfb,
+    0x91490188, 0xefbd8a59, 0x6b0e8a04, 0x15fa01d5, 0x96e79da6,
+    0xe8131677, 0x9530d3b1, 0xebc45860, 0x68d9c413, 0x162d4fc2,
+    0x6453b258, 0x1aa73989, 0x99baa5fa, 0xe74e2e2b, 0x9a6debed,
+    0xe499603c, 0x6784fc4f, 0x1970779e, 0x9dc377c3, 0xe337fc12,
+    0x602a6061, 0x1edeebb0, 0x63fd2e76, 0x1d09a5a7, 0x9e1439d4,
+    0xe0e0b205},
+   {0x00000000, 0x5a392b2f, 0xb472565e, 0xee4b7d71, 0x6d08da4d,
+    0x3731f162, 0xd97a8c13, 0x8343a73c, 0xda11b49a, 0x80289fb5,
+    0x6e63e2c4, 0x345ac9eb, 0xb7196ed7, 0xed2045f8, 0x036b3889,
+    0x595213a6, 0xb1cf1fc5, 0xebf634ea, 0x05bd499b, 0x5f8462b4,
+    0xdcc7c588, 0x86feeea7, 0x68b593d6, 0x328cb8f9, 0x6bdeab5f,
+    0x31e78070, 0xdfacfd01, 0x8595d62e, 0x06d67112, 0x5cef5a3d,
+    0xb2a4274c, 0xe89d0c63, 0x6672497b, 0x3c4b6254, 0xd2001f25,
+    0x8839340a, 0x0b7a9336, 0x5143b819, 0xbf08c568, 0xe531ee47,
+    0xbc63fde1, 0xe65ad6ce, 0x0811abbf, 0x52288090, 0xd16b27ac,
+    0x8b520c83, 0x651971f2, 0x3f205add, 0xd7bd56be, 0x8d847d91,
+    0x63cf00e0, 0x39f62bcf, 0xbab58cf3, 0xe08ca7dc, 0x0ec7daad,
+    0x54fef182, 0x0dace224, 0x5795c90b, 0xb9deb47a, 0xe3e79f55,
+    0x60a43869, 0x3a9d1346, 0xd4d66e37, 0x8eef4518, 0xcce492f6,
+    0x96ddb9d9, 0x7896c4a8, 0x22afef87, 0xa1ec48bb, 0xfbd56394,
+    0x159e1ee5, 0x4fa735ca, 0x16f5266c, 0x4ccc0d43, 0xa2877032,
+    0xf8be5b1d, 0x7bfdfc21, 0x21c4d70e, 0xcf8faa7f, 0x95b68150,
+    0x7d2b8d33, 0x2712a61c, 0xc959db6d, 0x9360f042, 0x1023577e,
+    0x4a1a7c51, 0xa4510120, 0xfe682a0f, 0xa73a39a9, 0xfd031286,
+    0x13486ff7, 0x497144d8, 0xca32e3e4, 0x900bc8cb, 0x7e40b5ba,
+    0x24799e95, 0xaa96db8d, 0xf0aff0a2, 0x1ee48dd3, 0x44dda6fc,
+    0xc79e01c0, 0x9da72aef, 0x73ec579e, 0x29d57cb1, 0x70876f17,
+    0x2abe4438, 0xc4f53949, 0x9ecc1266, 0x1d8fb55a, 0x47b69e75,
+    0xa9fde304, 0xf3c4c82b, 0x1b59c448, 0x4160ef67, 0xaf2b9216,
+    0xf512b939, 0x76511e05, 0x2c68352a, 0xc223485b, 0x981a6374,
+    0xc14870d2, 0x9b715bfd, 0x753a268c, 0x2f030da3, 0xac40aa9f,
+    0xf67981b0, 0x1832fcc1, 0x420bd7ee, 0x9c25531d, 0xc61c7832,
+    0x28570543, 0x726e2e6c, 0xf12d8950, 0xab14a27f, 0x455fdf0e,
+    0x1f66f421, 0x4634e787, 0x1c0dcca8, 0xf246b1d9, 0xa87f9af6,
+    0x2b3c3dca, 0x710516e5, 0x9f4e6b94, 0xc57740bb, 0x2dea4cd8,
+    0x77d367f7, 0x99981a86, 0xc3a131a9, 0x40e29695, 0x1adbbdba,
+    0xf490c0cb, 0xaea9ebe4, 0xf7fbf842, 0xadc2d36d, 0x4389ae1c,
+    0x19b08533, 0x9af3220f, 0xc0ca0920, 0x2e817451, 0x74b85f7e,
+    0xfa571a66, 0xa06e3149, 0x4e254c38, 0x141c6717, 0x975fc02b,
+    0xcd66eb04, 0x232d9675, 0x7914bd5a, 0x2046aefc, 0x7a7f85d3,
+    0x9434f8a2, 0xce0dd38d, 0x4d4e74b1, 0x17775f9e, 0xf93c22ef,
+    0xa30509c0, 0x4b9805a3, 0x11a12e8c, 0xffea53fd, 0xa5d378d2,
+    0x2690dfee, 0x7ca9f4c1, 0x92e289b0, 0xc8dba29f, 0x9189b139,
+    0xcbb09a16, 0x25fbe767, 0x7fc2cc48, 0xfc816b74, 0xa6b8405b,
+    0x48f33d2a, 0x12ca1605, 0x50c1c1eb, 0x0af8eac4, 0xe4b397b5,
+    0xbe8abc9a, 0x3dc91ba6, 0x67f03089, 0x89bb4df8, 0xd38266d7,
+    0x8ad07571, 0xd0e95e5e, 0x3ea2232f, 0x649b0800, 0xe7d8af3c,
+    0xbde18413, 0x53aaf962, 0x0993d24d, 0xe10ede2e, 0xbb37f501,
+    0x557c8870, 0x0f45a35f, 0x8c060463, 0xd63f2f4c, 0x3874523d,
+    0x624d7912, 0x3b1f6ab4, 0x6126419b, 0x8f6d3cea, 0xd55417c5,
+    0x5617b0f9, 0x0c2e9bd6, 0xe265e6a7, 0xb85ccd88, 0x36b38890,
+    0x6c8aa3bf, 0x82c1dece, 0xd8f8f5e1, 0x5bbb52dd, 0x018279f2,
+    0xefc90483, 0xb5f02fac, 0xeca23c0a, 0xb69b1725, 0x58d06a54,
+    0x02e9417b, 0x81aae647, 0xdb93cd68, 0x35d8b019, 0x6fe19b36,
+    0x877c9755, 0xdd45bc7a, 0x330ec10b, 0x6937ea24, 0xea744d18,
+    0xb04d6637, 0x5e061b46, 0x043f3069, 0x5d6d23cf, 0x075408e0,
+    0xe91f7591, 0xb3265ebe, 0x3065f982, 0x6a5cd2ad, 0x8417afdc,
+    0xde2e84f3}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0x2f2b395a00000000, 0x5e5672b400000000,
+    0x717d4bee00000000, 0x4dda086d00000000, 0x62f1313700000000,
+    0x138c7ad900000000, 0x3ca7438300000000, 0x9ab411da00000000,
+    0xb59f288000000000, 0xc4e2636e00000000, 0xebc95a3400000000,
+    0xd76e19b700000000, 0xf84520ed00000000, 0x89386b0300000000,
+    0xa613525900000000, 0xc51fcfb100000000, 0xea34f6eb00000000,
+    0x9b49bd0500000000, 0xb462845f00000000, 0x88c5c7dc00000000,
+    0xa7eefe8600000000, 0xd693b56800000000, 0xf9b88c3200000000,
+    0x5fabde6b00000000, 0x7080e73100000000, 0x01fdacdf00000000,
+    0x2ed6958500000000, 0x1271d60600000000, 0x3d5aef5c00000000,
+    0x4c27a4b200000000, 0x630c9de800000000, 0x7b49726600000000,
+    0x54624b3c00000000, 0x251f00d200000000, 0x0a34398800000000,
+    0x36937a0b00000000, 0x19b8435100000000, 0x68c508bf00000000,
+    0x47ee31e500000000, 0xe1fd63bc00000000, 0xced65ae600000000,
+    0xbfab110800000000, 0x9080285200000000, 0xac276bd100000000,
+    0x830c528b00000000, 0xf271196500000000, 0xdd5a203f00000000,
+    0xbe56bdd700000000, 0x917d848d00000000, 0xe000cf6300000000,
+    0xcf2bf63900000000, 0xf38cb5ba00000000, 0xdca78ce000000000,
+    0xaddac70e00000000, 0x82f1fe5400000000, 0x24e2ac0d00000000,
+    0x0bc9955700000000, 0x7ab4deb900000000, 0x559fe7e300000000,
+    0x6938a46000000000, 0x46139d3a00000000, 0x376ed6d400000000,
+    0x1845ef8e00000000, 0xf692e4cc00000000, 0xd9b9dd9600000000,
+    0xa8c4967800000000, 0x87efaf2200000000, 0xbb48eca100000000,
+    0x9463d5fb00000000, 0xe51e9e1500000000, 0xca35a74f00000000,
+    0x6c26f51600000000, 0x430dcc4c00000000, 0x327087a200000000,
+    0x1d5bbef800000000, 0x21fcfd7b00000000, 0x0ed7c42100000000,
+    0x7faa8fcf00000000, 0x5081b69500000000, 0x338d2b7d00000000,
+    0x1ca6122700000000, 0x6ddb59c900000000, 0x42f0609300000000,
+    0x7e57231000000000, 0x517c1a4a00000000, 0x200151a400000000,
+    0x0f2a68fe00000000, 0xa9393aa700000000, 0x861203fd00000000,
+    0xf76f481300000000, 0xd844714900000000, 0xe4e332ca00000000,
+    0xcbc80b9000000000, 0xbab5407e00000000, 0x959e792400000000,
+    0x8ddb96aa00000000, 0xa2f0aff000000000, 0xd38de41e00000000,
+    0xfca6dd4400000000, 0xc0019ec700000000, 0xef2aa79d00000000,
+    0x9e57ec7300000000, 0xb17cd52900000000, 0x176f877000000000,
+    0x3844be2a00000000, 0x4939f5c400000000, 0x6612cc9e00000000,
+    0x5ab58f1d00000000, 0x759eb64700000000, 0x04e3fda900000000,
+    0x2bc8c4f300000000, 0x48c4591b00000000, 0x67ef604100000000,
+    0x16922baf00000000, 0x39b912f500000000, 0x051e517600000000,
+    0x2a35682c00000000, 0x5b4823c200000000, 0x74631a9800000000,
+    0xd27048c100000000, 0xfd5b719b00000000, 0x8c263a7500000000,
+    0xa30d032f00000000, 0x9faa40ac00000000, 0xb08179f600000000,
+    0xc1fc321800000000, 0xeed70b4200000000, 0x1d53259c00000000,
+    0x32781cc600000000, 0x4305572800000000, 0x6c2e6e7200000000,
+    0x50892df100000000, 0x7fa214ab00000000, 0x0edf5f4500000000,
+    0x21f4661f00000000, 0x87e7344600000000, 0xa8cc0d1c00000000,
+    0xd9b146f200000000, 0xf69a7fa800000000, 0xca3d3c2b00000000,
+    0xe516057100000000, 0x946b4e9f00000000, 0xbb4077c500000000,
+    0xd84cea2d00000000, 0xf767d37700000000, 0x861a989900000000,
+    0xa931a1c300000000, 0x9596e24000000000, 0xbabddb1a00000000,
+    0xcbc090f400000000, 0xe4eba9ae00000000, 0x42f8fbf700000000,
+    0x6dd3c2ad00000000, 0x1cae894300000000, 0x3385b01900000000,
+    0x0f22f39a00000000, 0x2009cac000000000, 0x5174812e00000000,
+    0x7e5fb87400000000, 0x661a57fa00000000, 0x49316ea000000000,
+    0x384c254e00000000, 0x17671c1400000000, 0x2bc05f9700000000,
+    0x04eb66cd00000000, 0x75962d2300000000, 0x5abd147900000000,
+    0xfcae462000000000, 0xd3857f7a00000000, 0xa2f8349400000000,
+    0x8dd30dce00000000, 0xb1744e4d00000000, 0x9e5f771700000000,
+    0xef223cf900000000, 0xc00905a300000000, 0xa305984b00000000,
+    0x8c2ea11100000000, 0xfd53eaff00000000, 0xd278d3a500000000,
+    0xeedf902600000000, 0xc1f4a97c00000000, 0xb089e29200000000,
+    0x9fa2dbc800000000, 0x39b1899100000000, 0x169ab0cb00000000,
+    0x67e7fb2500000000, 0x48ccc27f00000000, 0x746b81fc00000000,
+    0x5b40b8a600000000, 0x2a3df34800000000, 0x0516ca1200000000,
+    0xebc1c15000000000, 0xc4eaf80a00000000, 0xb597b3e400000000,
+    0x9abc8abe00000000, 0xa61bc93d00000000, 0x8930f06700000000,
+    0xf84dbb8900000000, 0xd76682d300000000, 0x7175d08a00000000,
+    0x5e5ee9d000000000, 0x2f23a23e00000000, 0x00089b6400000000,
+    0x3cafd8e700000000, 0x1384e1bd00000000, 0x62f9aa5300000000,
+    0x4dd2930900000000, 0x2ede0ee100000000, 0x01f537bb00000000,
+    0x70887c5500000000, 0x5fa3450f00000000, 0x6304068c00000000,
+    0x4c2f3fd600000000, 0x3d52743800000000, 0x12794d6200000000,
+    0xb46a1f3b00000000, 0x9b41266100000000, 0xea3c6d8f00000000,
+    0xc51754d500000000, 0xf9b0175600000000, 0xd69b2e0c00000000,
+    0xa7e665e200000000, 0x88cd5cb800000000, 0x9088b33600000000,
+    0xbfa38a6c00000000, 0xcedec18200000000, 0xe1f5f8d800000000,
+    0xdd52bb5b00000000, 0xf279820100000000, 0x8304c9ef00000000,
+    0xac2ff0b500000000, 0x0a3ca2ec00000000, 0x25179bb600000000,
+    0x546ad05800000000, 0x7b41e90200000000, 0x47e6aa8100000000,
+    0x68cd93db00000000, 0x19b0d83500000000, 0x369be16f00000000,
+    0x55977c8700000000, 0x7abc45dd00000000, 0x0bc10e3300000000,
+    0x24ea376900000000, 0x184d74ea00000000, 0x37664db000000000,
+    0x461b065e00000000, 0x69303f0400000000, 0xcf236d5d00000000,
+    0xe008540700000000, 0x91751fe900000000, 0xbe5e26b300000000,
+    0x82f9653000000000, 0xadd25c6a00000000, 0xdcaf178400000000,
+    0xf3842ede00000000},
+   {0x0000000000000000, 0xd18bf47e00000000, 0xa217e9fd00000000,
+    0x739c1d8300000000, 0xb5593efe00000000, 0x64d2ca8000000000,
+    0x174ed70300000000, 0xc6c5237d00000000, 0x9bc590f900000000,
+    0x4a4e648700000000, 0x39d2790400000000, 0xe8598d7a00000000,
+    0x2e9cae0700000000, 0xff175a7900000000, 0x8c8b47fa00000000,
+    0x5d00b38400000000, 0xc7fdcdf600000000, 0x1676398800000000,
+    0x65ea240b00000000, 0xb461d07500000000, 0x72a4f30800000000,
+    0xa32f077600000000, 0xd0b31af500000000, 0x0138ee8b00000000,
+    0x5c385d0f00000000, 0x8db3a97100000000, 0xfe2fb4f200000000,
+    0x2fa4408c00000000, 0xe96163f100000000, 0x38ea978f00000000,
+    0x4b768a0c00000000, 0x9afd7e7200000000, 0x7f8d77e800000000,
+    0xae06839600000000, 0xdd9a9e1500000000, 0x0c116a6b00000000,
+    0xcad4491600000000, 0x1b5fbd6800000000, 0x68c3a0eb00000000,
+    0xb948549500000000, 0xe448e71100000000, 0x35c3136f00000000,
+    0x465f0eec00000000, 0x97d4fa9200000000, 0x5111d9ef00000000,
+    0x809a2d9100000000, 0xf306301200000000, 0x228dc46c00000000,
+    0xb870ba1e00000000, 0x69fb4e6000000000, 0x1a6753e300000000,
+    0xcbeca79d00000000, 0x0d2984e000000000, 0xdca2709e00000000,
+    0xaf3e6d1d00000000, 0x7eb5996300000000, 0x23b52ae700000000,
+    0xf23ede9900000000, 0x81a2c31a00000000, 0x5029376400000000,
+    0x96ec141900000000, 0x4767e06700000000, 0x34fbfde400000000,
+    0xe570099a00000000, 0x0f6c03d500000000, 0xdee7f7ab00000000,
+    0xad7bea2800000000, 0x7cf01e5600000000, 0xba353d2b00000000,
+    0x6bbec95500000000, 0x1822d4d600000000, 0xc9a920a800000000,
+    0x94a9932c00000000, 0x4522675200000000, 0x36be7ad100000000,
+    0xe7358eaf00000000, 0x21f0add200000000, 0xf07b59ac00000000,
+    0x83e7442f00000000, 0x526cb05100000000, 0xc891ce2300000000,
+    0x191a3a5d00000000, 0x6a8627de00000000, 0xbb0dd3a000000000,
+    0x7dc8f0dd00000000, 0xac4304a300000000, 0xdfdf192000000000,
+    0x0e54ed5e00000000, 0x53545eda00000000, 0x82dfaaa400000000,
+    0xf143b72700000000, 0x20c8435900000000, 0xe60d602400000000,
+    0x3786945a00000000, 0x441a89d900000000, 0x95917da700000000,
+    0x70e1743d00000000, 0xa16a804300000000, 0xd2f69dc000000000,
+    0x037d69be00000000, 0xc5b84ac300000000, 0x1433bebd00000000,
+    0x67afa33e00000000, 0xb624574000000000, 0xeb24e4c400000000,
+    0x3aaf10ba00000000, 0x49330d3900000000, 0x98b8f94700000000,
+    0x5e7dda3a00000000, 0x8ff62e4400000000, 0xfc6a33c700000000,
+    0x2de1c7b900000000, 0xb71cb9cb00000000, 0x66974db500000000,
+    0x150b503600000000, 0xc480a44800000000, 0x0245873500000000,
+    0xd3ce734b00000000, 0xa0526ec800000000, 0x71d99ab600000000,
+    0x2cd9293200000000, 0xfd52dd4c00000000, 0x8ecec0cf00000000,
+    0x5f4534b100000000, 0x998017cc00000000, 0x480be3b200000000,
+    0x3b97fe3100000000, 0xea1c0a4f00000000, 0xefaeeaaf00000000,
+    0x3e251ed100000000, 0x4db9035200000000, 0x9c32f72c00000000,
+    0x5af7d45100000000, 0x8b7c202f00000000, 0xf8e03dac00000000,
+    0x296bc9d200000000, 0x746b7a5600000000, 0xa5e08e2800000000,
+    0xd67c93ab00000000, 0x07f767d500000000, 0xc13244a800000000,
+    0x10b9b0d600000000, 0x6325ad5500000000, 0xb2ae592b00000000,
+    0x2853275900000000, 0xf9d8d32700000000, 0x8a44cea400000000,
+    0x5bcf3ada00000000, 0x9d0a19a700000000, 0x4c81edd900000000,
+    0x3f1df05a00000000, 0xee96042400000000, 0xb396b7a000000000,
+    0x621d43de00000000, 0x11815e5d00000000, 0xc00aaa2300000000,
+    0x06cf895e00000000, 0xd7447d2000000000, 0xa4d860a300000000,
+    0x755394dd00000000, 0x90239d4700000000, 0x41a8693900000000,
+    0x323474ba00000000, 0xe3bf80c400000000, 0x257aa3b900000000,
+    0xf4f157c700000000, 0x876d4a4400000000, 0x56e6be3a00000000,
+    0x0be60dbe00000000, 0xda6df9c000000000, 0xa9f1e44300000000,
+    0x787a103d00000000, 0xbebf334000000000, 0x6f34c73e00000000,
+    0x1ca8dabd00000000, 0xcd232ec300000000, 0x57de50b100000000,
+    0x8655a4cf00000000, 0xf5c9b94c00000000, 0x24424d3200000000,
+    0xe2876e4f00000000, 0x330c9a3100000000, 0x409087b200000000,
+    0x911b73cc00000000, 0xcc1bc04800000000, 0x1d90343600000000,
+    0x6e0c29b500000000, 0xbf87ddcb00000000, 0x7942feb600000000,
+    0xa8c90ac800000000, 0xdb55174b00000000, 0x0adee33500000000,
+    0xe0c2e97a00000000, 0x31491d0400000000, 0x42d5008700000000,
+    0x935ef4f900000000, 0x559bd78400000000, 0x841023fa00000000,
+    0xf78c3e7900000000, 0x2607ca0700000000, 0x7b07798300000000,
+    0xaa8c8dfd00000000, 0xd910907e00000000, 0x089b640000000000,
+    0xce5e477d00000000, 0x1fd5b30300000000, 0x6c49ae8000000000,
+    0xbdc25afe00000000, 0x273f248c00000000, 0xf6b4d0f200000000,
+    0x8528cd7100000000, 0x54a3390f00000000, 0x92661a7200000000,
+    0x43edee0c00000000, 0x3071f38f00000000, 0xe1fa07f100000000,
+    0xbcfab47500000000, 0x6d71400b00000000, 0x1eed5d8800000000,
+    0xcf66a9f600000000, 0x09a38a8b00000000, 0xd8287ef500000000,
+    0xabb4637600000000, 0x7a3f970800000000, 0x9f4f9e9200000000,
+    0x4ec46aec00000000, 0x3d58776f00000000, 0xecd3831100000000,
+    0x2a16a06c00000000, 0xfb9d541200000000, 0x8801499100000000,
+    0x598abdef00000000, 0x048a0e6b00000000, 0xd501fa1500000000,
+    0xa69de79600000000, 0x771613e800000000, 0xb1d3309500000000,
+    0x6058c4eb00000000, 0x13c4d96800000000, 0xc24f2d1600000000,
+    0x58b2536400000000, 0x8939a71a00000000, 0xfaa5ba9900000000,
+    0x2b2e4ee700000000, 0xedeb6d9a00000000, 0x3c6099e400000000,
+    0x4ffc846700000000, 0x9e77701900000000, 0xc377c39d00000000,
+    0x12fc37e300000000, 0x61602a6000000000, 0xb0ebde1e00000000,
+    0x762efd6300000000, 0xa7a5091d00000000, 0xd439149e00000000,
+    0x05b2e0e000000000},
+   {0x0000000000000000, 0x2396c62100000000, 0x462c8d4300000000,
+    0x65ba4b6200000000, 0x8c581a8700000000, 0xafcedca600000000,
+    0xca7497c400000000, 0xe9e251e500000000, 0xe9c7d80b00000000,
+    0xca511e2a00000000, 0xafeb554800000000, 0x8c7d936900000000,
+    0x659fc28c00000000, 0x460904ad00000000, 0x23b34fcf00000000,
+    0x002589ee00000000, 0xd28fb11700000000, 0xf119773600000000,
+    0x94a33c5400000000, 0xb735fa7500000000, 0x5ed7ab9000000000,
+    0x7d416db100000000, 0x18fb26d300000000, 0x3b6de0f200000000,
+    0x3b48691c00000000, 0x18deaf3d00000000, 0x7d64e45f00000000,
+    0x5ef2227e00000000, 0xb710739b00000000, 0x9486b5ba00000000,
+    0xf13cfed800000000, 0xd2aa38f900000000, 0xa41f632f00000000,
+    0x8789a50e00000000, 0xe233ee6c00000000, 0xc1a5284d00000000,
+    0x284779a800000000, 0x0bd1bf8900000000, 0x6e6bf4eb00000000,
+    0x4dfd32ca00000000, 0x4dd8bb2400000000, 0x6e4e7d0500000000,
+    0x0bf4366700000000, 0x2862f04600000000, 0xc180a1a300000000,
+    0xe216678200000000, 0x87ac2ce000000000, 0xa43aeac100000000,
+    0x7690d23800000000, 0x5506141900000000, 0x30bc5f7b00000000,
+    0x132a995a00000000, 0xfac8c8bf00000000, 0xd95e0e9e00000000,
+    0xbce445fc00000000, 0x9f7283dd00000000, 0x9f570a3300000000,
+    0xbcc1cc1200000000, 0xd97b877000000000, 0xfaed415100000000,
+    0x130f10b400000000, 0x3099d69500000000, 0x55239df700000000,
+    0x76b55bd600000000, 0x483fc65e00000000, 0x6ba9007f00000000,
+    0x0e134b1d00000000, 0x2d858d3c00000000, 0xc467dcd900000000,
+    0xe7f11af800000000, 0x824b519a00000000, 0xa1dd97bb00000000,
+    0xa1f81e5500000000, 0x826ed87400000000, 0xe7d4931600000000,
+    0xc442553700000000, 0x2da004d200000000, 0x0e36c2f300000000,
+    0x6b8c899100000000, 0x481a4fb000000000, 0x9ab0774900000000,
+    0xb926b16800000000, 0xdc9cfa0a00000000, 0xff0a3c2b00000000,
+    0x16e86dce00000000, 0x357eabef00000000, 0x50c4e08d00000000,
+    0x735226ac00000000, 0x7377af4200000000, 0x50e1696300000000,
+    0x355b220100000000, 0x16cde42000000000, 0xff2fb5c500000000,
+    0xdcb973e400000000, 0xb903388600000000, 0x9a95fea700000000,
+    0xec20a57100000000, 0xcfb6635000000000, 0xaa0c283200000000,
+    0x899aee1300000000, 0x6078bff600000000, 0x43ee79d700000000,
+    0x265432b500000000, 0x05c2f49400000000, 0x05e77d7a00000000,
+    0x2671bb5b00000000, 0x43cbf03900000000, 0x605d361800000000,
+    0x89bf67fd00000000, 0xaa29a1dc00000000, 0xcf93eabe00000000,
+    0xec052c9f00000000, 0x3eaf146600000000, 0x1d39d24700000000,
+    0x7883992500000000, 0x5b155f0400000000, 0xb2f70ee100000000,
+    0x9161c8c000000000, 0xf4db83a200000000, 0xd74d458300000000,
+    0xd768cc6d00000000, 0xf4fe0a4c00000000, 0x9144412e00000000,
+    0xb2d2870f00000000, 0x5b30d6ea00000000, 0x78a610cb00000000,
+    0x1d1c5ba900000000, 0x3e8a9d8800000000, 0x907e8cbd00000000,
+    0xb3e84a9c00000000, 0xd65201fe00000000, 0xf5c4c7df00000000,
+    0x1c26963a00000000, 0x3fb0501b00000000, 0x5a0a1b7900000000,
+    0x799cdd5800000000, 0x79b954b600000000, 0x5a2f929700000000,
+    0x3f95d9f500000000, 0x1c031fd400000000, 0xf5e14e3100000000,
+    0xd677881000000000, 0xb3cdc37200000000, 0x905b055300000000,
+    0x42f13daa00000000, 0x6167fb8b00000000, 0x04ddb0e900000000,
+    0x274b76c800000000, 0xcea9272d00000000, 0xed3fe10c00000000,
+    0x8885aa6e00000000, 0xab136c4f00000000, 0xab36e5a100000000,
+    0x88a0238000000000, 0xed1a68e200000000, 0xce8caec300000000,
+    0x276eff2600000000, 0x04f8390700000000, 0x6142726500000000,
+    0x42d4b44400000000, 0x3461ef9200000000, 0x17f729b300000000,
+    0x724d62d100000000, 0x51dba4f000000000, 0xb839f51500000000,
+    0x9baf333400000000, 0xfe15785600000000, 0xdd83be7700000000,
+    0xdda6379900000000, 0xfe30f1b800000000, 0x9b8abada00000000,
+    0xb81c7cfb00000000, 0x51fe2d1e00000000, 0x7268eb3f00000000,
+    0x17d2a05d00000000, 0x3444667c00000000, 0xe6ee5e8500000000,
+    0xc57898a400000000, 0xa0c2d3c600000000, 0x835415e700000000,
+    0x6ab6440200000000, 0x4920822300000000, 0x2c9ac94100000000,
+    0x0f0c0f6000000000, 0x0f29868e00000000, 0x2cbf40af00000000,
+    0x49050bcd00000000, 0x6a93cdec00000000, 0x83719c0900000000,
+    0xa0e75a2800000000, 0xc55d114a00000000, 0xe6cbd76b00000000,
+    0xd8414ae300000000, 0xfbd78cc200000000, 0x9e6dc7a000000000,
+    0xbdfb018100000000, 0x5419506400000000, 0x778f964500000000,
+    0x1235dd2700000000, 0x31a31b0600000000, 0x318692e800000000,
+    0x121054c900000000, 0x77aa1fab00000000, 0x543cd98a00000000,
+    0xbdde886f00000000, 0x9e484e4e00000000, 0xfbf2052c00000000,
+    0xd864c30d00000000, 0x0acefbf400000000, 0x29583dd500000000,
+    0x4ce276b700000000, 0x6f74b09600000000, 0x8696e17300000000,
+    0xa500275200000000, 0xc0ba6c3000000000, 0xe32caa1100000000,
+    0xe30923ff00000000, 0xc09fe5de00000000, 0xa525aebc00000000,
+    0x86b3689d00000000, 0x6f51397800000000, 0x4cc7ff5900000000,
+    0x297db43b00000000, 0x0aeb721a00000000, 0x7c5e29cc00000000,
+    0x5fc8efed00000000, 0x3a72a48f00000000, 0x19e462ae00000000,
+    0xf006334b00000000, 0xd390f56a00000000, 0xb62abe0800000000,
+    0x95bc782900000000, 0x9599f1c700000000, 0xb60f37e600000000,
+    0xd3b57c8400000000, 0xf023baa500000000, 0x19c1eb4000000000,
+    0x3a572d6100000000, 0x5fed660300000000, 0x7c7ba02200000000,
+    0xaed198db00000000, 0x8d475efa00000000, 0xe8fd159800000000,
+    0xcb6bd3b900000000, 0x2289825c00000000, 0x011f447d00000000,
+    0x64a50f1f00000000, 0x4733c93e00000000, 0x471640d000000000,
+    0x648086f100000000, 0x013acd9300000000, 0x22ac0bb200000000,
+    0xcb4e5a5700000000, 0xe8d89c7600000000, 0x8d62d71400000000,
+    0xaef4113500000000},
+   {0x0000000000000000, 0xbcbbcc3300000000, 0x7877996700000000,
+    0xc4cc555400000000, 0xf0ee32cf00000000, 0x4c55fefc00000000,
+    0x8899aba800000000, 0x3422679b00000000, 0x11ab899b00000000,
+    0xad1045a800000000, 0x69dc10fc00000000, 0xd567dccf00000000,
+    0xe145bb5400000000, 0x5dfe776700000000, 0x9932223300000000,
+    0x2589ee0000000000, 0xd320ff3200000000, 0x6f9b330100000000,
+    0xab57665500000000, 0x17ecaa6600000000, 0x23cecdfd00000000,
+    0x9f7501ce00000000, 0x5bb9549a00000000, 0xe70298a900000000,
+    0xc28b76a900000000, 0x7e30ba9a00000000, 0xbafcefce00000000,
+    0x064723fd00000000, 0x3265446600000000, 0x8ede885500000000,
+    0x4a12dd0100000000, 0xf6a9113200000000, 0xa641fe6500000000,
+    0x1afa325600000000, 0xde36670200000000, 0x628dab3100000000,
+    0x56afccaa00000000, 0xea14009900000000, 0x2ed855cd00000000,
+    0x926399fe00000000, 0xb7ea77fe00000000, 0x0b51bbcd00000000,
+    0xcf9dee9900000000, 0x732622aa00000000, 0x4704453100000000,
+    0xfbbf890200000000, 0x3f73dc5600000000, 0x83c8106500000000,
+    0x7561015700000000, 0xc9dacd6400000000, 0x0d16983000000000,
+    0xb1ad540300000000, 0x858f339800000000, 0x3934ffab00000000,
+    0xfdf8aaff00000000, 0x414366cc00000000, 0x64ca88cc00000000,
+    0xd87144ff00000000, 0x1cbd11ab00000000, 0xa006dd9800000000,
+    0x9424ba0300000000, 0x289f763000000000, 0xec53236400000000,
+    0x50e8ef5700000000, 0x4c83fccb00000000, 0xf03830f800000000,
+    0x34f465ac00000000, 0x884fa99f00000000, 0xbc6dce0400000000,
+    0x00d6023700000000, 0xc41a576300000000, 0x78a19b5000000000,
+    0x5d28755000000000, 0xe193b96300000000, 0x255fec3700000000,
+    0x99e4200400000000, 0xadc6479f00000000, 0x117d8bac00000000,
+    0xd5b1def800000000, 0x690a12cb00000000, 0x9fa303f900000000,
+    0x2318cfca00000000, 0xe7d49a9e00000000, 0x5b6f56ad00000000,
+    0x6f4d313600000000, 0xd3f6fd0500000000, 0x173aa85100000000,
+    0xab81646200000000, 0x8e088a6200000000, 0x32b3465100000000,
+    0xf67f130500000000, 0x4ac4df3600000000, 0x7ee6b8ad00000000,
+    0xc25d749e00000000, 0x069121ca00000000, 0xba2aedf900000000,
+    0xeac202ae00000000, 0x5679ce9d00000000, 0x92b59bc900000000,
+    0x2e0e57fa00000000, 0x1a2c306100000000, 0xa697fc5200000000,
+    0x625ba90600000000, 0xdee0653500000000, 0xfb698b3500000000,
+    0x47d2470600000000, 0x831e125200000000, 0x3fa5de6100000000,
+    0x0b87b9fa00000000, 0xb73c75c900000000, 0x73f0209d00000000,
+    0xcf4becae00000000, 0x39e2fd9c00000000, 0x855931af00000000,
+    0x419564fb00000000, 0xfd2ea8c800000000, 0xc90ccf5300000000,
+    0x75b7036000000000, 0xb17b563400000000, 0x0dc09a0700000000,
+    0x2849740700000000, 0x94f2b83400000000, 0x503eed6000000000,
+    0xec85215300000000, 0xd8a746c800000000, 0x641c8afb00000000,
+    0xa0d0dfaf00000000, 0x1c6b139c00000000, 0x6970159200000000,
+    0xd5cbd9a100000000, 0x11078cf500000000, 0xadbc40c600000000,
+    0x999e275d00000000, 0x2525eb6e00000000, 0xe1e9be3a00000000,
+    0x5d52720900000000, 0x78db9c0900000000, 0xc460503a00000000,
+    0x00ac056e00000000, 0xbc17c95d00000000, 0x8835aec600000000,
+    0x348e62f500000000, 0xf04237a100000000, 0x4cf9fb9200000000,
+    0xba50eaa000000000, 0x06eb269300000000, 0xc22773c700000000,
+    0x7e9cbff400000000, 0x4abed86f00000000, 0xf605145c00000000,
+    0x32c9410800000000, 0x8e728d3b00000000, 0xabfb633b00000000,
+    0x1740af0800000000, 0xd38cfa5c00000000, 0x6f37366f00000000,
+    0x5b1551f400000000, 0xe7ae9dc700000000, 0x2362c89300000000,
+    0x9fd904a000000000, 0xcf31ebf700000000, 0x738a27c400000000,
+    0xb746729000000000, 0x0bfdbea300000000, 0x3fdfd93800000000,
+    0x8364150b00000000, 0x47a8405f00000000, 0xfb138c6c00000000,
+    0xde9a626c00000000, 0x6221ae5f00000000, 0xa6edfb0b00000000,
+    0x1a56373800000000, 0x2e7450a300000000, 0x92cf9c9000000000,
+    0x5603c9c400000000, 0xeab805f700000000, 0x1c1114c500000000,
+    0xa0aad8f600000000, 0x64668da200000000, 0xd8dd419100000000,
+    0xecff260a00000000, 0x5044ea3900000000, 0x9488bf6d00000000,
+    0x2833735e00000000, 0x0dba9d5e00000000, 0xb101516d00000000,
+    0x75cd043900000000, 0xc976c80a00000000, 0xfd54af9100000000,
+    0x41ef63a200000000, 0x852336f600000000, 0x3998fac500000000,
+    0x25f3e95900000000, 0x9948256a00000000, 0x5d84703e00000000,
+    0xe13fbc0d00000000, 0xd51ddb9600000000, 0x69a617a500000000,
+    0xad6a42f100000000, 0x11d18ec200000000, 0x345860c200000000,
+    0x88e3acf100000000, 0x4c2ff9a500000000, 0xf094359600000000,
+    0xc4b6520d00000000, 0x780d9e3e00000000, 0xbcc1cb6a00000000,
+    0x007a075900000000, 0xf6d3166b00000000, 0x4a68da5800000000,
+    0x8ea48f0c00000000, 0x321f433f00000000, 0x063d24a400000000,
+    0xba86e89700000000, 0x7e4abdc300000000, 0xc2f171f000000000,
+    0xe7789ff000000000, 0x5bc353c300000000, 0x9f0f069700000000,
+    0x23b4caa400000000, 0x1796ad3f00000000, 0xab2d610c00000000,
+    0x6fe1345800000000, 0xd35af86b00000000, 0x83b2173c00000000,
+    0x3f09db0f00000000, 0xfbc58e5b00000000, 0x477e426800000000,
+    0x735c25f300000000, 0xcfe7e9c000000000, 0x0b2bbc9400000000,
+    0xb79070a700000000, 0x92199ea700000000, 0x2ea2529400000000,
+    0xea6e07c000000000, 0x56d5cbf300000000, 0x62f7ac6800000000,
+    0xde4c605b00000000, 0x1a80350f00000000, 0xa63bf93c00000000,
+    0x5092e80e00000000, 0xec29243d00000000, 0x28e5716900000000,
+    0x945ebd5a00000000, 0xa07cdac100000000, 0x1cc716f200000000,
+    0xd80b43a600000000, 0x64b08f9500000000, 0x4139619500000000,
+    0xfd82ada600000000, 0x394ef8f200000000, 0x85f534c100000000,
+    0xb1d7535a00000000, 0x0d6c9f6900000000, 0xc9a0ca3d00000000,
+    0x751b060e00000000},
+   {0x0000000000000000, 0xa27165ff00000000, 0xb59526fb00000000,
+    0x17e4430400000000, 0x9b5da1f300000000, 0x392cc40c00000000,
+    0x2ec8870800000000, 0x8cb9e2f700000000, 0xc7cdaee200000000,
+    0x65bccb1d00000000, 0x7258881900000000, 0xd029ede600000000,
+    0x5c900f1100000000, 0xfee16aee00000000, 0xe90529ea00000000,
+    0x4b744c1500000000, 0x7fedb1c000000000, 0xdd9cd43f00000000,
+    0xca78973b00000000, 0x6809f2c400000000, 0xe4b0103300000000,
+    0x46c175cc00000000, 0x512536c800000000, 0xf354533700000000,
+    0xb8201f2200000000, 0x1a517add00000000, 0x0db539d900000000,
+    0xafc45c2600000000, 0x237dbed100000000, 0x810cdb2e00000000,
+    0x96e8982a00000000, 0x3499fdd500000000, 0x0fac8f8400000000,
+    0xadddea7b00000000, 0xba39a97f00000000, 0x1848cc8000000000,
+    0x94f12e7700000000, 0x36804b8800000000, 0x2164088c00000000,
+    0x83156d7300000000, 0xc861216600000000, 0x6a10449900000000,
+    0x7df4079d00000000, 0xdf85626200000000, 0x533c809500000000,
+    0xf14de56a00000000, 0xe6a9a66e00000000, 0x44d8c39100000000,
+    0x70413e4400000000, 0xd2305bbb00000000, 0xc5d418bf00000000,
+    0x67a57d4000000000, 0xeb1c9fb700000000, 0x496dfa4800000000,
+    0x5e89b94c00000000, 0xfcf8dcb300000000, 0xb78c90a600000000,
+    0x15fdf55900000000, 0x0219b65d00000000, 0xa068d3a200000000,
+    0x2cd1315500000000, 0x8ea054aa00000000, 0x994417ae00000000,
+    0x3b35725100000000, 0xef2ef30c00000000, 0x4d5f96f300000000,
+    0x5abbd5f700000000, 0xf8cab00800000000, 0x747352ff00000000,
+    0xd602370000000000, 0xc1e6740400000000, 0x639711fb00000000,
+    0x28e35dee00000000, 0x8a92381100000000, 0x9d767b1500000000,
+    0x3f071eea00000000, 0xb3befc1d00000000, 0x11cf99e200000000,
+    0x062bdae600000000, 0xa45abf1900000000, 0x90c342cc00000000,
+    0x32b2273300000000, 0x2556643700000000, 0x872701c800000000,
+    0x0b9ee33f00000000, 0xa9ef86c000000000, 0xbe0bc5c400000000,
+    0x1c7aa03b00000000, 0x570eec2e00000000, 0xf57f89d100000000,
+    0xe29bcad500000000, 0x40eaaf2a00000000, 0xcc534ddd00000000,
+    0x6e22282200000000, 0x79c66b2600000000, 0xdbb70ed900000000,
+    0xe0827c8800000000, 0x42f3197700000000, 0x55175a7300000000,
+    0xf7663f8c00000000, 0x7bdfdd7b00000000, 0xd9aeb88400000000,
+    0xce4afb8000000000, 0x6c3b9e7f00000000, 0x274fd26a00000000,
+    0x853eb79500000000, 0x92daf49100000000, 0x30ab916e00000000,
+    0xbc12739900000000, 0x1e63166600000000, 0x0987556200000000,
+    0xabf6309d00000000, 0x9f6fcd4800000000, 0x3d1ea8b700000000,
+    0x2afaebb300000000, 0x888b8e4c00000000, 0x04326cbb00000000,
+    0xa643094400000000, 0xb1a74a4000000000, 0x13d62fbf00000000,
+    0x58a263aa00000000, 0xfad3065500000000, 0xed37455100000000,
+    0x4f4620ae00000000, 0xc3ffc25900000000, 0x618ea7a600000000,
+    0x766ae4a200000000, 0xd41b815d00000000, 0xde5de61900000000,
+    0x7c2c83e600000000, 0x6bc8c0e200000000, 0xc9b9a51d00000000,
+    0x450047ea00000000, 0xe771221500000000, 0xf095611100000000,
+    0x52e404ee00000000, 0x199048fb00000000, 0xbbe12d0400000000,
+    0xac056e0000000000, 0x0e740bff00000000, 0x82cde90800000000,
+    0x20bc8cf700000000, 0x3758cff300000000, 0x9529aa0c00000000,
+    0xa1b057d900000000, 0x03c1322600000000, 0x1425712200000000,
+    0xb65414dd00000000, 0x3aedf62a00000000, 0x989c93d500000000,
+    0x8f78d0d100000000, 0x2d09b52e00000000, 0x667df93b00000000,
+    0xc40c9cc400000000, 0xd3e8dfc000000000, 0x7199ba3f00000000,
+    0xfd2058c800000000, 0x5f513d3700000000, 0x48b57e3300000000,
+    0xeac41bcc00000000, 0xd1f1699d00000000, 0x73800c6200000000,
+    0x64644f6600000000, 0xc6152a9900000000, 0x4aacc86e00000000,
+    0xe8ddad9100000000, 0xff39ee9500000000, 0x5d488b6a00000000,
+    0x163cc77f00000000, 0xb44da28000000000, 0xa3a9e18400000000,
+    0x01d8847b00000000, 0x8d61668c00000000, 0x2f10037300000000,
+    0x38f4407700000000, 0x9a85258800000000, 0xae1cd85d00000000,
+    0x0c6dbda200000000, 0x1b89fea600000000, 0xb9f89b5900000000,
+    0x354179ae00000000, 0x97301c5100000000, 0x80d45f5500000000,
+    0x22a53aaa00000000, 0x69d176bf00000000, 0xcba0134000000000,
+    0xdc44504400000000, 0x7e3535bb00000000, 0xf28cd74c00000000,
+    0x50fdb2b300000000, 0x4719f1b700000000, 0xe568944800000000,
+    0x3173151500000000, 0x930270ea00000000, 0x84e633ee00000000,
+    0x2697561100000000, 0xaa2eb4e600000000, 0x085fd11900000000,
+    0x1fbb921d00000000, 0xbdcaf7e200000000, 0xf6bebbf700000000,
+    0x54cfde0800000000, 0x432b9d0c00000000, 0xe15af8f300000000,
+    0x6de31a0400000000, 0xcf927ffb00000000, 0xd8763cff00000000,
+    0x7a07590000000000, 0x4e9ea4d500000000, 0xecefc12a00000000,
+    0xfb0b822e00000000, 0x597ae7d100000000, 0xd5c3052600000000,
+    0x77b260d900000000, 0x605623dd00000000, 0xc227462200000000,
+    0x89530a3700000000, 0x2b226fc800000000, 0x3cc62ccc00000000,
+    0x9eb7493300000000, 0x120eabc400000000, 0xb07fce3b00000000,
+    0xa79b8d3f00000000, 0x05eae8c000000000, 0x3edf9a9100000000,
+    0x9caeff6e00000000, 0x8b4abc6a00000000, 0x293bd99500000000,
+    0xa5823b6200000000, 0x07f35e9d00000000, 0x10171d9900000000,
+    0xb266786600000000, 0xf912347300000000, 0x5b63518c00000000,
+    0x4c87128800000000, 0xeef6777700000000, 0x624f958000000000,
+    0xc03ef07f00000000, 0xd7dab37b00000000, 0x75abd68400000000,
+    0x41322b5100000000, 0xe3434eae00000000, 0xf4a70daa00000000,
+    0x56d6685500000000, 0xda6f8aa200000000, 0x781eef5d00000000,
+    0x6ffaac5900000000, 0xcd8bc9a600000000, 0x86ff85b300000000,
+    0x248ee04c00000000, 0x336aa34800000000, 0x911bc6b700000000,
+    0x1da2244000000000, 0xbfd341bf00000000, 0xa83702bb00000000,
+    0x0a46674400000000},
+   {0x0000000000000000, 0x20a08f4300000000, 0x40401f8700000000,
+    0x60e090c400000000, 0x71f6d20b00000000, 0x51565d4800000000,
+    0x31b6cd8c00000000, 0x111642cf00000000, 0xe2eca51700000000,
+    0xc24c2a5400000000, 0xa2acba9000000000, 0x820c35d300000000,
+    0x931a771c00000000, 0xb3baf85f00000000, 0xd35a689b00000000,
+    0xf3fae7d800000000, 0xc4d94b2f00000000, 0xe479c46c00000000,
+    0x849954a800000000, 0xa439dbeb00000000, 0xb52f992400000000,
+    0x958f166700000000, 0xf56f86a300000000, 0xd5cf09e000000000,
+    0x2635ee3800000000, 0x0695617b00000000, 0x6675f1bf00000000,
+    0x46d57efc00000000, 0x57c33c3300000000, 0x7763b37000000000,
+    0x178323b400000000, 0x3723acf700000000, 0x88b3975e00000000,
+    0xa813181d00000000, 0xc8f388d900000000, 0xe853079a00000000,
+    0xf945455500000000, 0xd9e5ca1600000000, 0xb9055ad200000000,
+    0x99a5d59100000000, 0x6a5f324900000000, 0x4affbd0a00000000,
+    0x2a1f2dce00000000, 0x0abfa28d00000000, 0x1ba9e04200000000,
+    0x3b096f0100000000, 0x5be9ffc500000000, 0x7b49708600000000,
+    0x4c6adc7100000000, 0x6cca533200000000, 0x0c2ac3f600000000,
+    0x2c8a4cb500000000, 0x3d9c0e7a00000000, 0x1d3c813900000000,
+    0x7ddc11fd00000000, 0x5d7c9ebe00000000, 0xae86796600000000,
+    0x8e26f62500000000, 0xeec666e100000000, 0xce66e9a200000000,
+    0xdf70ab6d00000000, 0xffd0242e00000000, 0x9f30b4ea00000000,
+    0xbf903ba900000000, 0x10672fbd00000000, 0x30c7a0fe00000000,
+    0x5027303a00000000, 0x7087bf7900000000, 0x6191fdb600000000,
+    0x413172f500000000, 0x21d1e23100000000, 0x01716d7200000000,
+    0xf28b8aaa00000000, 0xd22b05e900000000, 0xb2cb952d00000000,
+    0x926b1a6e00000000, 0x837d58a100000000, 0xa3ddd7e200000000,
+    0xc33d472600000000, 0xe39dc86500000000, 0xd4be649200000000,
+    0xf41eebd100000000, 0x94fe7b1500000000, 0xb45ef45600000000,
+    0xa548b69900000000, 0x85e839da00000000, 0xe508a91e00000000,
+    0xc5a8265d00000000, 0x3652c18500000000, 0x16f24ec600000000,
+    0x7612de0200000000, 0x56b2514100000000, 0x47a4138e00000000,
+    0x67049ccd00000000, 0x07e40c0900000000, 0x2744834a00000000,
+    0x98d4b8e300000000, 0xb87437a000000000, 0xd894a76400000000,
+    0xf834282700000000, 0xe9226ae800000000, 0xc982e5ab00000000,
+    0xa962756f00000000, 0x89c2fa2c00000000, 0x7a381df400000000,
+    0x5a9892b700000000, 0x3a78027300000000, 0x1ad88d3000000000,
+    0x0bcecfff00000000, 0x2b6e40bc00000000, 0x4b8ed07800000000,
+    0x6b2e5f3b00000000, 0x5c0df3cc00000000, 0x7cad7c8f00000000,
+    0x1c4dec4b00000000, 0x3ced630800000000, 0x2dfb21c700000000,
+    0x0d5bae8400000000, 0x6dbb3e4000000000, 0x4d1bb10300000000,
+    0xbee156db00000000, 0x9e41d99800000000, 0xfea1495c00000000,
+    0xde01c61f00000000, 0xcf1784d000000000, 0xefb70b9300000000,
+    0x8f579b5700000000, 0xaff7141400000000, 0xd1b8b27f00000000,
+    0xf1183d3c00000000, 0x91f8adf800000000, 0xb15822bb00000000,
+    0xa04e607400000000, 0x80eeef3700000000, 0xe00e7ff300000000,
+    0xc0aef0b000000000, 0x3354176800000000, 0x13f4982b00000000,
+    0x731408ef00000000, 0x53b487ac00000000, 0x42a2c56300000000,
+    0x62024a2000000000, 0x02e2dae400000000, 0x224255a700000000,
+    0x1561f95000000000, 0x35c1761300000000, 0x5521e6d700000000,
+    0x7581699400000000, 0x64972b5b00000000, 0x4437a41800000000,
+    0x24d734dc00000000, 0x0477bb9f00000000, 0xf78d5c4700000000,
+    0xd72dd30400000000, 0xb7cd43c000000000, 0x976dcc8300000000,
+    0x867b8e4c00000000, 0xa6db010f00000000, 0xc63b91cb00000000,
+    0xe69b1e8800000000, 0x590b252100000000, 0x79abaa6200000000,
+    0x194b3aa600000000, 0x39ebb5e500000000, 0x28fdf72a00000000,
+    0x085d786900000000, 0x68bde8ad00000000, 0x481d67ee00000000,
+    0xbbe7803600000000, 0x9b470f7500000000, 0xfba79fb100000000,
+    0xdb0710f200000000, 0xca11523d00000000, 0xeab1dd7e00000000,
+    0x8a514dba00000000, 0xaaf1c2f900000000, 0x9dd26e0e00000000,
+    0xbd72e14d00000000, 0xdd92718900000000, 0xfd32feca00000000,
+    0xec24bc0500000000, 0xcc84334600000000, 0xac64a38200000000,
+    0x8cc42cc100000000, 0x7f3ecb1900000000, 0x5f9e445a00000000,
+    0x3f7ed49e00000000, 0x1fde5bdd00000000, 0x0ec8191200000000,
+    0x2e68965100000000, 0x4e88069500000000, 0x6e2889d600000000,
+    0xc1df9dc200000000, 0xe17f128100000000, 0x819f824500000000,
+    0xa13f0d0600000000, 0xb0294fc900000000, 0x9089c08a00000000,
+    0xf069504e00000000, 0xd0c9df0d00000000, 0x233338d500000000,
+    0x0393b79600000000, 0x6373275200000000, 0x43d3a81100000000,
+    0x52c5eade00000000, 0x7265659d00000000, 0x1285f55900000000,
+    0x32257a1a00000000, 0x0506d6ed00000000, 0x25a659ae00000000,
+    0x4546c96a00000000, 0x65e6462900000000, 0x74f004e600000000,
+    0x54508ba500000000, 0x34b01b6100000000, 0x1410942200000000,
+    0xe7ea73fa00000000, 0xc74afcb900000000, 0xa7aa6c7d00000000,
+    0x870ae33e00000000, 0x961ca1f100000000, 0xb6bc2eb200000000,
+    0xd65cbe7600000000, 0xf6fc313500000000, 0x496c0a9c00000000,
+    0x69cc85df00000000, 0x092c151b00000000, 0x298c9a5800000000,
+    0x389ad89700000000, 0x183a57d400000000, 0x78dac71000000000,
+    0x587a485300000000, 0xab80af8b00000000, 0x8b2020c800000000,
+    0xebc0b00c00000000, 0xcb603f4f00000000, 0xda767d8000000000,
+    0xfad6f2c300000000, 0x9a36620700000000, 0xba96ed4400000000,
+    0x8db541b300000000, 0xad15cef000000000, 0xcdf55e3400000000,
+    0xed55d17700000000, 0xfc4393b800000000, 0xdce31cfb00000000,
+    0xbc038c3f00000000, 0x9ca3037c00000000, 0x6f59e4a400000000,
+    0x4ff96be700000000, 0x2f19fb2300000000, 0x0fb9746000000000,
+    0x1eaf36af00000000, 0x3e0fb9ec00000000, 0x5eef292800000000,
+    0x7e4fa66b00000000},
+   {0x0000000000000000, 0x7e01fe2000000000, 0xfc02fc4100000000,
+    0x8203026100000000, 0xf805f88300000000, 0x860406a300000000,
+    0x040704c200000000, 0x7a06fae200000000, 0x017d1c0200000000,
+    0x7f7ce22200000000, 0xfd7fe04300000000, 0x837e1e6300000000,
+    0xf978e48100000000, 0x87791aa100000000, 0x057a18c000000000,
+    0x7b7be6e000000000, 0x02fa380400000000, 0x7cfbc62400000000,
+    0xfef8c44500000000, 0x80f93a6500000000, 0xfaffc08700000000,
+    0x84fe3ea700000000, 0x06fd3cc600000000, 0x78fcc2e600000000,
+    0x0387240600000000, 0x7d86da2600000000, 0xff85d84700000000,
+    0x8184266700000000, 0xfb82dc8500000000, 0x858322a500000000,
+    0x078020c400000000, 0x7981dee400000000, 0x04f4710800000000,
+    0x7af58f2800000000, 0xf8f68d4900000000, 0x86f7736900000000,
+    0xfcf1898b00000000, 0x82f077ab00000000, 0x00f375ca00000000,
+    0x7ef28bea00000000, 0x05896d0a00000000, 0x7b88932a00000000,
+    0xf98b914b00000000, 0x878a6f6b00000000, 0xfd8c958900000000,
+    0x838d6ba900000000, 0x018e69c800000000, 0x7f8f97e800000000,
+    0x060e490c00000000, 0x780fb72c00000000, 0xfa0cb54d00000000,
+    0x840d4b6d00000000, 0xfe0bb18f00000000, 0x800a4faf00000000,
+    0x02094dce00000000, 0x7c08b3ee00000000, 0x0773550e00000000,
+    0x7972ab2e00000000, 0xfb71a94f00000000, 0x8570576f00000000,
+    0xff76ad8d00000000, 0x817753ad00000000, 0x037451cc00000000,
+    0x7d75afec00000000, 0x08e8e31000000000, 0x76e91d3000000000,
+    0xf4ea1f5100000000, 0x8aebe17100000000, 0xf0ed1b9300000000,
+    0x8eece5b300000000, 0x0cefe7d200000000, 0x72ee19f200000000,
+    0x0995ff1200000000, 0x7794013200000000, 0xf597035300000000,
+    0x8b96fd7300000000, 0xf190079100000000, 0x8f91f9b100000000,
+    0x0d92fbd000000000, 0x739305f000000000, 0x0a12db1400000000,
+    0x7413253400000000, 0xf610275500000000, 0x8811d97500000000,
+    0xf217239700000000, 0x8c16ddb700000000, 0x0e15dfd600000000,
+    0x701421f600000000, 0x0b6fc71600000000, 0x756e393600000000,
+    0xf76d3b5700000000, 0x896cc57700000000, 0xf36a3f9500000000,
+    0x8d6bc1b500000000, 0x0f68c3d400000000, 0x71693df400000000,
+    0x0c1c921800000000, 0x721d6c3800000000, 0xf01e6e5900000000,
+    0x8e1f907900000000, 0xf4196a9b00000000, 0x8a1894bb00000000,
+    0x081b96da00000000, 0x761a68fa00000000, 0x0d618e1a00000000,
+    0x7360703a00000000, 0xf163725b00000000, 0x8f628c7b00000000,
+    0xf564769900000000, 0x8b6588b900000000, 0x09668ad800000000,
+    0x776774f800000000, 0x0ee6aa1c00000000, 0x70e7543c00000000,
+    0xf2e4565d00000000, 0x8ce5a87d00000000, 0xf6e3529f00000000,
+    0x88e2acbf00000000, 0x0ae1aede00000000, 0x74e050fe00000000,
+    0x0f9bb61e00000000, 0x719a483e00000000, 0xf3994a5f00000000,
+    0x8d98b47f00000000, 0xf79e4e9d00000000, 0x899fb0bd00000000,
+    0x0b9cb2dc00000000, 0x759d4cfc00000000, 0x10d0c72100000000,
+    0x6ed1390100000000, 0xecd23b6000000000, 0x92d3c54000000000,
+    0xe8d53fa200000000, 0x96d4c18200000000, 0x14d7c3e300000000,
+    0x6ad63dc300000000, 0x11addb2300000000, 0x6fac250300000000,
+    0xedaf276200000000, 0x93aed94200000000, 0xe9a823a000000000,
+    0x97a9dd8000000000, 0x15aadfe100000000, 0x6bab21c100000000,
+    0x122aff2500000000, 0x6c2b010500000000, 0xee28036400000000,
+    0x9029fd4400000000, 0xea2f07a600000000, 0x942ef98600000000,
+    0x162dfbe700000000, 0x682c05c700000000, 0x1357e32700000000,
+    0x6d561d0700000000, 0xef551f6600000000, 0x9154e14600000000,
+    0xeb521ba400000000, 0x9553e58400000000, 0x1750e7e500000000,
+    0x695119c500000000, 0x1424b62900000000, 0x6a25480900000000,
+    0xe8264a6800000000, 0x9627b44800000000, 0xec214eaa00000000,
+    0x9220b08a00000000, 0x1023b2eb00000000, 0x6e224ccb00000000,
+    0x1559aa2b00000000, 0x6b58540b00000000, 0xe95b566a00000000,
+    0x975aa84a00000000, 0xed5c52a800000000, 0x935dac8800000000,
+    0x115eaee900000000, 0x6f5f50c900000000, 0x16de8e2d00000000,
+    0x68df700d00000000, 0xeadc726c00000000, 0x94dd8c4c00000000,
+    0xeedb76ae00000000, 0x90da888e00000000, 0x12d98aef00000000,
+    0x6cd874cf00000000, 0x17a3922f00000000, 0x69a26c0f00000000,
+    0xeba16e6e00000000, 0x95a0904e00000000, 0xefa66aac00000000,
+    0x91a7948c00000000, 0x13a496ed00000000, 0x6da568cd00000000,
+    0x1838243100000000, 0x6639da1100000000, 0xe43ad87000000000,
+    0x9a3b265000000000, 0xe03ddcb200000000, 0x9e3c229200000000,
+    0x1c3f20f300000000, 0x623eded300000000, 0x1945383300000000,
+    0x6744c61300000000, 0xe547c47200000000, 0x9b463a5200000000,
+    0xe140c0b000000000, 0x9f413e9000000000, 0x1d423cf100000000,
+    0x6343c2d100000000, 0x1ac21c3500000000, 0x64c3e21500000000,
+    0xe6c0e07400000000, 0x98c11e5400000000, 0xe2c7e4b600000000,
+    0x9cc61a9600000000, 0x1ec518f700000000, 0x60c4e6d700000000,
+    0x1bbf003700000000, 0x65befe1700000000, 0xe7bdfc7600000000,
+    0x99bc025600000000, 0xe3baf8b400000000, 0x9dbb069400000000,
+    0x1fb804f500000000, 0x61b9fad500000000, 0x1ccc553900000000,
+    0x62cdab1900000000, 0xe0cea97800000000, 0x9ecf575800000000,
+    0xe4c9adba00000000, 0x9ac8539a00000000, 0x18cb51fb00000000,
+    0x66caafdb00000000, 0x1db1493b00000000, 0x63b0b71b00000000,
+    0xe1b3b57a00000000, 0x9fb24b5a00000000, 0xe5b4b1b800000000,
+    0x9bb54f9800000000, 0x19b64df900000000, 0x67b7b3d900000000,
+    0x1e366d3d00000000, 0x6037931d00000000, 0xe234917c00000000,
+    0x9c356f5c00000000, 0xe63395be00000000, 0x98326b9e00000000,
+    0x1a3169ff00000000, 0x643097df00000000, 0x1f4b713f00000000,
+    0x614a8f1f00000000, 0xe3498d7e00000000, 0x9d48735e00000000,
+    0xe74e89bc00000000, 0x994f779c00000000, 0x1b4c75fd00000000,
+    0x654d8bdd00000000},
+   {0x0000000000000000, 0x2b15c0dd00000000, 0xa75c6cbe00000000,
+    0x8c49ac6300000000, 0xbfcf347900000000, 0x94daf4a400000000,
+    0x189358c700000000, 0x3386981a00000000, 0x7e9f69f200000000,
+    0x558aa92f00000000, 0xd9c3054c00000000, 0xf2d6c59100000000,
+    0xc1505d8b00000000, 0xea459d5600000000, 0x660c313500000000,
+    0x4d19f1e800000000, 0x0d483fe100000000, 0x265dff3c00000000,
+    0xaa14535f00000000, 0x8101938200000000, 0xb2870b9800000000,
+    0x9992cb4500000000, 0x15db672600000000, 0x3ecea7fb00000000,
+    0x73d7561300000000, 0x58c296ce00000000, 0xd48b3aad00000000,
+    0xff9efa7000000000, 0xcc18626a00000000, 0xe70da2b700000000,
+    0x6b440ed400000000, 0x4051ce0900000000, 0xebe692c700000000,
+    0xc0f3521a00000000, 0x4cbafe7900000000, 0x67af3ea400000000,
+    0x5429a6be00000000, 0x7f3c666300000000, 0xf375ca0000000000,
+    0xd8600add00000000, 0x9579fb3500000000, 0xbe6c3be800000000,
+    0x3225978b00000000, 0x1930575600000000, 0x2ab6cf4c00000000,
+    0x01a30f9100000000, 0x8deaa3f200000000, 0xa6ff632f00000000,
+    0xe6aead2600000000, 0xcdbb6dfb00000000, 0x41f2c19800000000,
+    0x6ae7014500000000, 0x5961995f00000000, 0x7274598200000000,
+    0xfe3df5e100000000, 0xd528353c00000000, 0x9831c4d400000000,
+    0xb324040900000000, 0x3f6da86a00000000, 0x147868b700000000,
+    0x27fef0ad00000000, 0x0ceb307000000000, 0x80a29c1300000000,
+    0xabb75cce00000000, 0x27bbc98a00000000, 0x0cae095700000000,
+    0x80e7a53400000000, 0xabf265e900000000, 0x9874fdf300000000,
+    0xb3613d2e00000000, 0x3f28914d00000000, 0x143d519000000000,
+    0x5924a07800000000, 0x723160a500000000, 0xfe78ccc600000000,
+    0xd56d0c1b00000000, 0xe6eb940100000000, 0xcdfe54dc00000000,
+    0x41b7f8bf00000000, 0x6aa2386200000000, 0x2af3f66b00000000,
+    0x01e636b600000000, 0x8daf9ad500000000, 0xa6ba5a0800000000,
+    0x953cc21200000000, 0xbe2902cf00000000, 0x3260aeac00000000,
+    0x19756e7100000000, 0x546c9f9900000000, 0x7f795f4400000000,
+    0xf330f32700000000, 0xd82533fa00000000, 0xeba3abe000000000,
+    0xc0b66b3d00000000, 0x4cffc75e00000000, 0x67ea078300000000,
+    0xcc5d5b4d00000000, 0xe7489b9000000000, 0x6b0137f300000000,
+    0x4014f72e00000000, 0x73926f3400000000, 0x5887afe900000000,
+    0xd4ce038a00000000, 0xffdbc35700000000, 0xb2c232bf00000000,
+    0x99d7f26200000000, 0x159e5e0100000000, 0x3e8b9edc00000000,
+    0x0d0d06c600000000, 0x2618c61b00000000, 0xaa516a7800000000,
+    0x8144aaa500000000, 0xc11564ac00000000, 0xea00a47100000000,
+    0x6649081200000000, 0x4d5cc8cf00000000, 0x7eda50d500000000,
+    0x55cf900800000000, 0xd9863c6b00000000, 0xf293fcb600000000,
+    0xbf8a0d5e00000000, 0x949fcd8300000000, 0x18d661e000000000,
+    0x33c3a13d00000000, 0x0045392700000000, 0x2b50f9fa00000000,
+    0xa719559900000000, 0x8c0c954400000000, 0xbf007f1000000000,
+    0x9415bfcd00000000, 0x185c13ae00000000, 0x3349d37300000000,
+    0x00cf4b6900000000, 0x2bda8bb400000000, 0xa79327d700000000,
+    0x8c86e70a00000000, 0xc19f16e200000000, 0xea8ad63f00000000,
+    0x66c37a5c00000000, 0x4dd6ba8100000000, 0x7e50229b00000000,
+    0x5545e24600000000, 0xd90c4e2500000000, 0xf2198ef800000000,
+    0xb24840f100000000, 0x995d802c00000000, 0x15142c4f00000000,
+    0x3e01ec9200000000, 0x0d87748800000000, 0x2692b45500000000,
+    0xaadb183600000000, 0x81ced8eb00000000, 0xccd7290300000000,
+    0xe7c2e9de00000000, 0x6b8b45bd00000000, 0x409e856000000000,
+    0x73181d7a00000000, 0x580ddda700000000, 0xd44471c400000000,
+    0xff51b11900000000, 0x54e6edd700000000, 0x7ff32d0a00000000,
+    0xf3ba816900000000, 0xd8af41b400000000, 0xeb29d9ae00000000,
+    0xc03c197300000000, 0x4c75b51000000000, 0x676075cd00000000,
+    0x2a79842500000000, 0x016c44f800000000, 0x8d25e89b00000000,
+    0xa630284600000000, 0x95b6b05c00000000, 0xbea3708100000000,
+    0x32eadce200000000, 0x19ff1c3f00000000, 0x59aed23600000000,
+    0x72bb12eb00000000, 0xfef2be8800000000, 0xd5e77e5500000000,
+    0xe661e64f00000000, 0xcd74269200000000, 0x413d8af100000000,
+    0x6a284a2c00000000, 0x2731bbc400000000, 0x0c247b1900000000,
+    0x806dd77a00000000, 0xab7817a700000000, 0x98fe8fbd00000000,
+    0xb3eb4f6000000000, 0x3fa2e30300000000, 0x14b723de00000000,
+    0x98bbb69a00000000, 0xb3ae764700000000, 0x3fe7da2400000000,
+    0x14f21af900000000, 0x277482e300000000, 0x0c61423e00000000,
+    0x8028ee5d00000000, 0xab3d2e8000000000, 0xe624df6800000000,
+    0xcd311fb500000000, 0x4178b3d600000000, 0x6a6d730b00000000,
+    0x59ebeb1100000000, 0x72fe2bcc00000000, 0xfeb787af00000000,
+    0xd5a2477200000000, 0x95f3897b00000000, 0xbee649a600000000,
+    0x32afe5c500000000, 0x19ba251800000000, 0x2a3cbd0200000000,
+    0x01297ddf00000000, 0x8d60d1bc00000000, 0xa675116100000000,
+    0xeb6ce08900000000, 0xc079205400000000, 0x4c308c3700000000,
+    0x67254cea00000000, 0x54a3d4f000000000, 0x7fb6142d00000000,
+    0xf3ffb84e00000000, 0xd8ea789300000000, 0x735d245d00000000,
+    0x5848e48000000000, 0xd40148e300000000, 0xff14883e00000000,
+    0xcc92102400000000, 0xe787d0f900000000, 0x6bce7c9a00000000,
+    0x40dbbc4700000000, 0x0dc24daf00000000, 0x26d78d7200000000,
+    0xaa9e211100000000, 0x818be1cc00000000, 0xb20d79d600000000,
+    0x9918b90b00000000, 0x1551156800000000, 0x3e44d5b500000000,
+    0x7e151bbc00000000, 0x5500db6100000000, 0xd949770200000000,
+    0xf25cb7df00000000, 0xc1da2fc500000000, 0xeacfef1800000000,
+    0x6686437b00000000, 0x4d9383a600000000, 0x008a724e00000000,
+    0x2b9fb29300000000, 0xa7d61ef000000000, 0x8cc3de2d00000000,
+    0xbf45463700000000, 0x945086ea00000000, 0x18192a8900000000,
+    0x330cea5400000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x3743f7bd, 0x6e87ef7a, 0x59c418c7, 0xdd0fdef4,
+    0xea4c2949, 0xb388318e, 0x84cbc633, 0xbff3cb19, 0x88b03ca4,
+    0xd1742463, 0xe637d3de, 0x62fc15ed, 0x55bfe250, 0x0c7bfa97,
+    0x3b380d2a, 0x7a0be0c3, 0x4d48177e, 0x148c0fb9, 0x23cff804,
+    0xa7043e37, 0x9047c98a, 0xc983d14d, 0xfec026f0, 0xc5f82bda,
+    0xf2bbdc67, 0xab7fc4a0, 0x9c3c331d, 0x18f7f52e, 0x2fb40293,
+    0x76701a54, 0x4133ede9, 0xf417c186, 0xc354363b, 0x9a902efc,
+    0xadd3d941, 0x29181f72, 0x1e5be8cf, 0x479ff008, 0x70dc07b5,
+    0x4be40a9f, 0x7ca7fd22, 0x2563e5e5, 0x12201258, 0x96ebd46b,
+    0xa1a823d6, 0xf86c3b11, 0xcf2fccac, 0x8e1c2145, 0xb95fd6f8,
+    0xe09bce3f, 0xd7d83982, 0x5313ffb1, 0x6450080c, 0x3d9410cb,
+    0x0ad7e776, 0x31efea5c, 0x06ac1de1, 0x5f680526, 0x682bf29b,
+    0xece034a8, 0xdba3c315, 0x8267dbd2, 0xb5242c6f, 0xedc3f5fd,
+    0xda800240, 0x83441a87, 0xb407ed3a, 0x30cc2b09, 0x078fdcb4,
+    0x5e4bc473, 0x690833ce, 0x52303ee4, 0x6573c959, 0x3cb7d19e,
+    0x0bf42623, 0x8f3fe010, 0xb87c17ad, 0xe1b80f6a, 0xd6fbf8d7,
+    0x97c8153e, 0xa08be283, 0xf94ffa44, 0xce0c0df9, 0x4ac7cbca,
+    0x7d843c77, 0x244024b0, 0x1303d30d, 0x283bde27, 0x1f78299a,
+    0x46bc315d, 0x71ffc6e0, 0xf53400d3, 0xc277f76e, 0x9bb3efa9,
+    0xacf01814, 0x19d4347b, 0x2e97c3c6, 0x7753db01, 0x40102cbc,
+    0xc4dbea8f, 0xf3981d32, 0xaa5c05f5, 0x9d1ff248, 0xa627ff62,
+    0x916408df, 0xc8a01018, 0xffe3e7a5, 0x7b282196, 0x4c6bd62b,
+    0x15afceec, 0x22ec3951, 0x63dfd4b8, 0x549c2305, 0x0d583bc2,
+    0x3a1bcc7f, 0xbed00a4c, 0x8993fdf1, 0xd057e536, 0xe714128b,
+    0xdc2c1fa1, 0xeb6fe81c, 0xb2abf0db, 0x85e80766, 0x0123c155,
+    0x366036e8, 0x6fa42e2f, 0x58e7d992, 0xde6b9d0b, 0xe9286ab6,
+    0xb0ec7271, 0x87af85cc, 0x036443ff, 0x3427b442, 0x6de3ac85,
+    0x5aa05b38, 0x61985612, 0x56dba1af, 0x0f1fb968, 0x385c4ed5,
+    0xbc9788e6, 0x8bd47f5b, 0xd210679c, 0xe5539021, 0xa4607dc8,
+    0x93238a75, 0xcae792b2, 0xfda4650f, 0x796fa33c, 0x4e2c5481,
+    0x17e84c46, 0x20abbbfb, 0x1b93b6d1, 0x2cd0416c, 0x751459ab,
+    0x4257ae16, 0xc69c6825, 0xf1df9f98, 0xa81b875f, 0x9f5870e2,
+    0x2a7c5c8d, 0x1d3fab30, 0x44fbb3f7, 0x73b8444a, 0xf7738279,
+    0xc03075c4, 0x99f46d03, 0xaeb79abe, 0x958f9794, 0xa2cc6029,
+    0xfb0878ee, 0xcc4b8f53, 0x48804960, 0x7fc3bedd, 0x2607a61a,
+    0x114451a7, 0x5077bc4e, 0x67344bf3, 0x3ef05334, 0x09b3a489,
+    0x8d7862ba, 0xba3b9507, 0xe3ff8dc0, 0xd4bc7a7d, 0xef847757,
+    0xd8c780ea, 0x8103982d, 0xb6406f90, 0x328ba9a3, 0x05c85e1e,
+    0x5c0c46d9, 0x6b4fb164, 0x33a868f6, 0x04eb9f4b, 0x5d2f878c,
+    0x6a6c7031, 0xeea7b602, 0xd9e441bf, 0x80205978, 0xb763aec5,
+    0x8c5ba3ef, 0xbb185452, 0xe2dc4c95, 0xd59fbb28, 0x51547d1b,
+    0x66178aa6, 0x3fd39261, 0x089065dc, 0x49a38835, 0x7ee07f88,
+    0x2724674f, 0x106790f2, 0x94ac56c1, 0xa3efa17c, 0xfa2bb9bb,
+    0xcd684e06, 0xf650432c, 0xc113b491, 0x98d7ac56, 0xaf945beb,
+    0x2b5f9dd8, 0x1c1c6a65, 0x45d872a2, 0x729b851f, 0xc7bfa970,
+    0xf0fc5ecd, 0xa938460a, 0x9e7bb1b7, 0x1ab07784, 0x2df38039,
+    0x743798fe, 0x43746f43, 0x784c6269, 0x4f0f95d4, 0x16cb8d13,
+    0x21887aae, 0xa543bc9d, 0x92004b20, 0xcbc453e7, 0xfc87a45a,
+    0xbdb449b3, 0x8af7be0e, 0xd333a6c9, 0xe4705174, 0x60bb9747,
+    0x57f860fa, 0x0e3c783d, 0x397f8f80, 0x024782aa, 0x35047517,
+    0x6cc06dd0, 0x5b839a6d, 0xdf485c5e, 0xe80babe3, 0xb1cfb324,
+    0x868c4499},
+   {0x00000000, 0xb93b4ce7, 0x779aef3f, 0xcea1a3d8, 0xef35de7e,
+    0x560e9299, 0x98af3141, 0x21947da6, 0xdb87ca0d, 0x62bc86ea,
+    0xac1d2532, 0x152669d5, 0x34b21473, 0x8d895894, 0x4328fb4c,
+    0xfa13b7ab, 0xb2e3e2eb, 0x0bd8ae0c, 0xc5790dd4, 0x7c424133,
+    0x5dd63c95, 0xe4ed7072, 0x2a4cd3aa, 0x93779f4d, 0x696428e6,
+    0xd05f6401, 0x1efec7d9, 0xa7c58b3e, 0x8651f698, 0x3f6aba7f,
+    0xf1cb19a7, 0x48f05540, 0x602bb327, 0xd910ffc0, 0x17b15c18,
+    0xae8a10ff, 0x8f1e6d59, 0x362521be, 0xf8848266, 0x41bfce81,
+    0xbbac792a, 0x029735cd, 0xcc369615, 0x750ddaf2, 0x5499a754,
+    0xeda2ebb3, 0x2303486b, 0x9a38048c, 0xd2c851cc, 0x6bf31d2b,
+    0xa552bef3, 0x1c69f214, 0x3dfd8fb2, 0x84c6c355, 0x4a67608d,
+    0xf35c2c6a, 0x094f9bc1, 0xb074d726, 0x7ed574fe, 0xc7ee3819,
+    0xe67a45bf, 0x5f410958, 0x91e0aa80, 0x28dbe667, 0xc057664e,
+    0x796c2aa9, 0xb7cd8971, 0x0ef6c596, 0x2f62b830, 0x9659f4d7,
+    0x58f8570f, 0xe1c31be8, 0x1bd0ac43, 0xa2ebe0a4, 0x6c4a437c,
+    0xd5710f9b, 0xf4e5723d, 0x4dde3eda, 0x837f9d02, 0x3a44d1e5,
+    0x72b484a5, 0xcb8fc842, 0x052e6b9a, 0xbc15277d, 0x9d815adb,
+    0x24ba163c, 0xea1bb5e4, 0x5320f903, 0xa9334ea8, 0x1008024f,
+    0xdea9a197, 0x6792ed70, 0x460690d6, 0xff3ddc31, 0x319c7fe9,
+    0x88a7330e, 0xa07cd569, 0x1947998e, 0xd7e63a56, 0x6edd76b1,
+    0x4f490b17, 0xf67247f0, 0x38d3e428, 0x81e8a8cf, 0x7bfb1f64,
+    0xc2c05383, 0x0c61f05b, 0xb55abcbc, 0x94cec11a, 0x2df58dfd,
+    0xe3542e25, 0x5a6f62c2, 0x129f3782, 0xaba47b65, 0x6505d8bd,
+    0xdc3e945a, 0xfdaae9fc, 0x4491a51b, 0x8a3006c3, 0x330b4a24,
+    0xc918fd8f, 0x7023b168, 0xbe8212b0, 0x07b95e57, 0x262d23f1,
+    0x9f166f16, 0x51b7ccce, 0xe88c8029, 0x8542ba6d, 0x3c79f68a,
+    0xf2d85552, 0x4be319b5, 0x6a776413, 0xd34c28f4, 0x1ded8b2c,
+    0xa4d6c7cb, 0x5ec57060, 0xe7fe3c87, 0x295f9f5f, 0x9064d3b8,
+    0xb1f0ae1e, 0x08cbe2f9, 0xc66a4121, 0x7f510dc6, 0x37a15886,
+    0x8e9a1461, 0x403bb7b9, 0xf900fb5e, 0xd89486f8, 0x61afca1f,
+    0xaf0e69c7, 0x16352520, 0xec26928b, 0x551dde6c, 0x9bbc7db4,
+    0x22873153, 0x03134cf5, 0xba280012, 0x7489a3ca, 0xcdb2ef2d,
+    0xe569094a, 0x5c5245ad, 0x92f3e675, 0x2bc8aa92, 0x0a5cd734,
+    0xb3679bd3, 0x7dc6380b, 0xc4fd74ec, 0x3eeec347, 0x87d58fa0,
+    0x49742c78, 0xf04f609f, 0xd1db1d39, 0x68e051de, 0xa641f206,
+    0x1f7abee1, 0x578aeba1, 0xeeb1a746, 0x2010049e, 0x992b4879,
+    0xb8bf35df, 0x01847938, 0xcf25dae0, 0x761e9607, 0x8c0d21ac,
+    0x35366d4b, 0xfb97ce93, 0x42ac8274, 0x6338ffd2, 0xda03b335,
+    0x14a210ed, 0xad995c0a, 0x4515dc23, 0xfc2e90c4, 0x328f331c,
+    0x8bb47ffb, 0xaa20025d, 0x131b4eba, 0xddbaed62, 0x6481a185,
+    0x9e92162e, 0x27a95ac9, 0xe908f911, 0x5033b5f6, 0x71a7c850,
+    0xc89c84b7, 0x063d276f, 0xbf066b88, 0xf7f63ec8, 0x4ecd722f,
+    0x806cd1f7, 0x39579d10, 0x18c3e0b6, 0xa1f8ac51, 0x6f590f89,
+    0xd662436e, 0x2c71f4c5, 0x954ab822, 0x5beb1bfa, 0xe2d0571d,
+    0xc3442abb, 0x7a7f665c, 0xb4dec584, 0x0de58963, 0x253e6f04,
+    0x9c0523e3, 0x52a4803b, 0xeb9fccdc, 0xca0bb17a, 0x7330fd9d,
+    0xbd915e45, 0x04aa12a2, 0xfeb9a509, 0x4782e9ee, 0x89234a36,
+    0x301806d1, 0x118c7b77, 0xa8b73790, 0x66169448, 0xdf2dd8af,
+    0x97dd8def, 0x2ee6c108, 0xe04762d0, 0x597c2e37, 0x78e85391,
+    0xc1d31f76, 0x0f72bcae, 0xb649f049, 0x4c5a47e2, 0xf5610b05,
+    0x3bc0a8dd, 0x82fbe43a, 0xa36f999c, 0x1a54d57b, 0xd4f576a3,
+    0x6dce3a44},
+   {0x00000000, 0x0f69022b, 0x1ed20456, 0x11bb067d, 0x3da408ac,
+    0x32cd0a87, 0x23760cfa, 0x2c1f0ed1, 0x7b481158, 0x74211373,
+    0x659a150e, 0x6af31725, 0x46ec19f4, 0x49851bdf, 0x583e1da2,
+    0x57571f89, 0xf69022b0, 0xf9f9209b, 0xe84226e6, 0xe72b24cd,
+    0xcb342a1c, 0xc45d2837, 0xd5e62e4a, 0xda8f2c61, 0x8dd833e8,
+    0x82b131c3, 0x930a37be, 0x9c633595, 0xb07c3b44, 0xbf15396f,
+    0xaeae3f12, 0xa1c73d39, 0xe8cc3391, 0xe7a531ba, 0xf61e37c7,
+    0xf97735ec, 0xd5683b3d, 0xda013916, 0xcbba3f6b, 0xc4d33d40,
+    0x938422c9, 0x9ced20e2, 0x8d56269f, 0x823f24b4, 0xae202a65,
+    0xa149284e, 0xb0f22e33, 0xbf9b2c18, 0x1e5c1121, 0x1135130a,
+    0x008e1577, 0x0fe7175c, 0x23f8198d, 0x2c911ba6, 0x3d2a1ddb,
+    0x32431ff0, 0x65140079, 0x6a7d0252, 0x7bc6042f, 0x74af0604,
+    0x58b008d5, 0x57d90afe, 0x46620c83, 0x490b0ea8, 0xd47411d3,
+    0xdb1d13f8, 0xcaa61585, 0xc5cf17ae, 0xe9d0197f, 0xe6b91b54,
+    0xf7021d29, 0xf86b1f02, 0xaf3c008b, 0xa05502a0, 0xb1ee04dd,
+    0xbe8706f6, 0x92980827, 0x9df10a0c, 0x8c4a0c71, 0x83230e5a,
+    0x22e43363, 0x2d8d3148, 0x3c363735, 0x335f351e, 0x1f403bcf,
+    0x102939e4, 0x01923f99, 0x0efb3db2, 0x59ac223b, 0x56c52010,
+    0x477e266d, 0x48172446, 0x64082a97, 0x6b6128bc, 0x7ada2ec1,
+    0x75b32cea, 0x3cb82242, 0x33d12069, 0x226a2614, 0x2d03243f,
+    0x011c2aee, 0x0e7528c5, 0x1fce2eb8, 0x10a72c93, 0x47f0331a,
+    0x48993131, 0x5922374c, 0x564b3567, 0x7a543bb6, 0x753d399d,
+    0x64863fe0, 0x6bef3dcb, 0xca2800f2, 0xc54102d9, 0xd4fa04a4,
+    0xdb93068f, 0xf78c085e, 0xf8e50a75, 0xe95e0c08, 0xe6370e23,
+    0xb16011aa, 0xbe091381, 0xafb215fc, 0xa0db17d7, 0x8cc41906,
+    0x83ad1b2d, 0x92161d50, 0x9d7f1f7b, 0xad045557, 0xa26d577c,
+    0xb3d65101, 0xbcbf532a, 0x90a05dfb, 0x9fc95fd0, 0x8e7259ad,
+    0x811b5b86, 0xd64c440f, 0xd9254624, 0xc89e4059, 0xc7f74272,
+    0xebe84ca3, 0xe4814e88, 0xf53a48f5, 0xfa534ade, 0x5b9477e7,
+    0x54fd75cc, 0x454673b1, 0x4a2f719a, 0x66307f4b, 0x69597d60,
+    0x78e27b1d, 0x778b7936, 0x20dc66bf, 0x2fb56494, 0x3e0e62e9,
+    0x316760c2, 0x1d786e13, 0x12116c38, 0x03aa6a45, 0x0cc3686e,
+    0x45c866c6, 0x4aa164ed, 0x5b1a6290, 0x547360bb, 0x786c6e6a,
+    0x77056c41, 0x66be6a3c, 0x69d76817, 0x3e80779e, 0x31e975b5,
+    0x205273c8, 0x2f3b71e3, 0x03247f32, 0x0c4d7d19, 0x1df67b64,
+    0x129f794f, 0xb3584476, 0xbc31465d, 0xad8a4020, 0xa2e3420b,
+    0x8efc4cda, 0x81954ef1, 0x902e488c, 0x9f474aa7, 0xc810552e,
+    0xc7795705, 0xd6c25178, 0xd9ab5353, 0xf5b45d82, 0xfadd5fa9,
+    0xeb6659d4, 0xe40f5bff, 0x79704484, 0x761946af, 0x67a240d2,
+    0x68cb42f9, 0x44d44c28, 0x4bbd4e03, 0x5a06487e, 0x556f4a55,
+    0x023855dc, 0x0d5157f7, 0x1cea518a, 0x138353a1, 0x3f9c5d70,
+    0x30f55f5b, 0x214e5926, 0x2e275b0d, 0x8fe06634, 0x8089641f,
+    0x91326262, 0x9e5b6049, 0xb2446e98, 0xbd2d6cb3, 0xac966ace,
+    0xa3ff68e5, 0xf4a8776c, 0xfbc17547, 0xea7a733a, 0xe5137111,
+    0xc90c7fc0, 0xc6657deb, 0xd7de7b96, 0xd8b779bd, 0x91bc7715,
+    0x9ed5753e, 0x8f6e7343, 0x80077168, 0xac187fb9, 0xa3717d92,
+    0xb2ca7bef, 0xbda379c4, 0xeaf4664d, 0xe59d6466, 0xf426621b,
+    0xfb4f6030, 0xd7506ee1, 0xd8396cca, 0xc9826ab7, 0xc6eb689c,
+    0x672c55a5, 0x6845578e, 0x79fe51f3, 0x769753d8, 0x5a885d09,
+    0x55e15f22, 0x445a595f, 0x4b335b74, 0x1c6444fd, 0x130d46d6,
+    0x02b640ab, 0x0ddf4280, 0x21c04c51, 0x2ea94e7a, 0x3f124807,
+    0x307b4a2c},
+   {0x00000000, 0x5fe4dc5f, 0xbfc9b8be, 0xe02d64e1, 0x7a7f078d,
+    0x259bdbd2, 0xc5b6bf33, 0x9a52636c, 0xf4fe0f1a, 0xab1ad345,
+    0x4b37b7a4, 0x14d36bfb, 0x8e810897, 0xd165d4c8, 0x3148b029,
+    0x6eac6c76, 0xec1068c5, 0xb3f4b49a, 0x53d9d07b, 0x0c3d0c24,
+    0x966f6f48, 0xc98bb317, 0x29a6d7f6, 0x76420ba9, 0x18ee67df,
+    0x470abb80, 0xa727df61, 0xf8c3033e, 0x62916052, 0x3d75bc0d,
+    0xdd58d8ec, 0x82bc04b3, 0xddcca77b, 0x82287b24, 0x62051fc5,
+    0x3de1c39a, 0xa7b3a0f6, 0xf8577ca9, 0x187a1848, 0x479ec417,
+    0x2932a861, 0x76d6743e, 0x96fb10df, 0xc91fcc80, 0x534dafec,
+    0x0ca973b3, 0xec841752, 0xb360cb0d, 0x31dccfbe, 0x6e3813e1,
+    0x8e157700, 0xd1f1ab5f, 0x4ba3c833, 0x1447146c, 0xf46a708d,
+    0xab8eacd2, 0xc522c0a4, 0x9ac61cfb, 0x7aeb781a, 0x250fa445,
+    0xbf5dc729, 0xe0b91b76, 0x00947f97, 0x5f70a3c8, 0xbe753807,
+    0xe191e458, 0x01bc80b9, 0x5e585ce6, 0xc40a3f8a, 0x9beee3d5,
+    0x7bc38734, 0x24275b6b, 0x4a8b371d, 0x156feb42, 0xf5428fa3,
+    0xaaa653fc, 0x30f43090, 0x6f10eccf, 0x8f3d882e, 0xd0d95471,
+    0x526550c2, 0x0d818c9d, 0xedace87c, 0xb2483423, 0x281a574f,
+    0x77fe8b10, 0x97d3eff1, 0xc83733ae, 0xa69b5fd8, 0xf97f8387,
+    0x1952e766, 0x46b63b39, 0xdce45855, 0x8300840a, 0x632de0eb,
+    0x3cc93cb4, 0x63b99f7c, 0x3c5d4323, 0xdc7027c2, 0x8394fb9d,
+    0x19c698f1, 0x462244ae, 0xa60f204f, 0xf9ebfc10, 0x97479066,
+    0xc8a34c39, 0x288e28d8, 0x776af487, 0xed3897eb, 0xb2dc4bb4,
+    0x52f12f55, 0x0d15f30a, 0x8fa9f7b9, 0xd04d2be6, 0x30604f07,
+    0x6f849358, 0xf5d6f034, 0xaa322c6b, 0x4a1f488a, 0x15fb94d5,
+    0x7b57f8a3, 0x24b324fc, 0xc49e401d, 0x9b7a9c42, 0x0128ff2e,
+    0x5ecc2371, 0xbee14790, 0xe1059bcf, 0x790606ff, 0x26e2daa0,
+    0xc6cfbe41, 0x992b621e, 0x03790172, 0x5c9ddd2d, 0xbcb0b9cc,
+    0xe3546593, 0x8df809e5, 0xd21cd5ba, 0x3231b15b, 0x6dd56d04,
+    0xf7870e68, 0xa863d237, 0x484eb6d6, 0x17aa6a89, 0x95166e3a,
+    0xcaf2b265, 0x2adfd684, 0x753b0adb, 0xef6969b7, 0xb08db5e8,
+    0x50a0d109, 0x0f440d56, 0x61e86120, 0x3e0cbd7f, 0xde21d99e,
+    0x81c505c1, 0x1b9766ad, 0x4473baf2, 0xa45ede13, 0xfbba024c,
+    0xa4caa184, 0xfb2e7ddb, 0x1b03193a, 0x44e7c565, 0xdeb5a609,
+    0x81517a56, 0x617c1eb7, 0x3e98c2e8, 0x5034ae9e, 0x0fd072c1,
+    0xeffd1620, 0xb019ca7f, 0x2a4ba913, 0x75af754c, 0x958211ad,
+    0xca66cdf2, 0x48dac941, 0x173e151e, 0xf71371ff, 0xa8f7ada0,
+    0x32a5cecc, 0x6d411293, 0x8d6c7672, 0xd288aa2d, 0xbc24c65b,
+    0xe3c01a04, 0x03ed7ee5, 0x5c09a2ba, 0xc65bc1d6, 0x99bf1d89,
+    0x79927968, 0x2676a537, 0xc7733ef8, 0x9897e2a7, 0x78ba8646,
+    0x275e5a19, 0xbd0c3975, 0xe2e8e52a, 0x02c581cb, 0x5d215d94,
+    0x338d31e2, 0x6c69edbd, 0x8c44895c, 0xd3a05503, 0x49f2366f,
+    0x1616ea30, 0xf63b8ed1, 0xa9df528e, 0x2b63563d, 0x74878a62,
+    0x94aaee83, 0xcb4e32dc, 0x511c51b0, 0x0ef88def, 0xeed5e90e,
+    0xb1313551, 0xdf9d5927, 0x80798578, 0x6054e199, 0x3fb03dc6,
+    0xa5e25eaa, 0xfa0682f5, 0x1a2be614, 0x45cf3a4b, 0x1abf9983,
+    0x455b45dc, 0xa576213d, 0xfa92fd62, 0x60c09e0e, 0x3f244251,
+    0xdf0926b0, 0x80edfaef, 0xee419699, 0xb1a54ac6, 0x51882e27,
+    0x0e6cf278, 0x943e9114, 0xcbda4d4b, 0x2bf729aa, 0x7413f5f5,
+    0xf6aff146, 0xa94b2d19, 0x496649f8, 0x168295a7, 0x8cd0f6cb,
+    0xd3342a94, 0x33194e75, 0x6cfd922a, 0x0251fe5c, 0x5db52203,
+    0xbd9846e2, 0xe27c9abd, 0x782ef9d1, 0x27ca258e, 0xc7e7416f,
+    0x98039d30}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0x5fdce45f, 0xbeb8c9bf, 0xe1642de0, 0x8d077f7a,
+    0xd2db9b25, 0x33bfb6c5, 0x6c63529a, 0x1a0ffef4, 0x45d31aab,
+    0xa4b7374b, 0xfb6bd314, 0x9708818e, 0xc8d465d1, 0x29b04831,
+    0x766cac6e, 0xc56810ec, 0x9ab4f4b3, 0x7bd0d953, 0x240c3d0c,
+    0x486f6f96, 0x17b38bc9, 0xf6d7a629, 0xa90b4276, 0xdf67ee18,
+    0x80bb0a47, 0x61df27a7, 0x3e03c3f8, 0x52609162, 0x0dbc753d,
+    0xecd858dd, 0xb304bc82, 0x7ba7ccdd, 0x247b2882, 0xc51f0562,
+    0x9ac3e13d, 0xf6a0b3a7, 0xa97c57f8, 0x48187a18, 0x17c49e47,
+    0x61a83229, 0x3e74d676, 0xdf10fb96, 0x80cc1fc9, 0xecaf4d53,
+    0xb373a90c, 0x521784ec, 0x0dcb60b3, 0xbecfdc31, 0xe113386e,
+    0x0077158e, 0x5fabf1d1, 0x33c8a34b, 0x6c144714, 0x8d706af4,
+    0xd2ac8eab, 0xa4c022c5, 0xfb1cc69a, 0x1a78eb7a, 0x45a40f25,
+    0x29c75dbf, 0x761bb9e0, 0x977f9400, 0xc8a3705f, 0x073875be,
+    0x58e491e1, 0xb980bc01, 0xe65c585e, 0x8a3f0ac4, 0xd5e3ee9b,
+    0x3487c37b, 0x6b5b2724, 0x1d378b4a, 0x42eb6f15, 0xa38f42f5,
+    0xfc53a6aa, 0x9030f430, 0xcfec106f, 0x2e883d8f, 0x7154d9d0,
+    0xc2506552, 0x9d8c810d, 0x7ce8aced, 0x233448b2, 0x4f571a28,
+    0x108bfe77, 0xf1efd397, 0xae3337c8, 0xd85f9ba6, 0x87837ff9,
+    0x66e75219, 0x393bb646, 0x5558e4dc, 0x0a840083, 0xebe02d63,
+    0xb43cc93c, 0x7c9fb963, 0x23435d3c, 0xc22770dc, 0x9dfb9483,
+    0xf198c619, 0xae442246, 0x4f200fa6, 0x10fcebf9, 0x66904797,
+    0x394ca3c8, 0xd8288e28, 0x87f46a77, 0xeb9738ed, 0xb44bdcb2,
+    0x552ff152, 0x0af3150d, 0xb9f7a98f, 0xe62b4dd0, 0x074f6030,
+    0x5893846f, 0x34f0d6f5, 0x6b2c32aa, 0x8a481f4a, 0xd594fb15,
+    0xa3f8577b, 0xfc24b324, 0x1d409ec4, 0x429c7a9b, 0x2eff2801,
+    0x7123cc5e, 0x9047e1be, 0xcf9b05e1, 0xff060679, 0xa0dae226,
+    0x41becfc6, 0x1e622b99, 0x72017903, 0x2ddd9d5c, 0xccb9b0bc,
+    0x936554e3, 0xe509f88d, 0xbad51cd2, 0x5bb13132, 0x046dd56d,
+    0x680e87f7, 0x37d263a8, 0xd6b64e48, 0x896aaa17, 0x3a6e1695,
+    0x65b2f2ca, 0x84d6df2a, 0xdb0a3b75, 0xb76969ef, 0xe8b58db0,
+    0x09d1a050, 0x560d440f, 0x2061e861, 0x7fbd0c3e, 0x9ed921de,
+    0xc105c581, 0xad66971b, 0xf2ba7344, 0x13de5ea4, 0x4c02bafb,
+    0x84a1caa4, 0xdb7d2efb, 0x3a19031b, 0x65c5e744, 0x09a6b5de,
+    0x567a5181, 0xb71e7c61, 0xe8c2983e, 0x9eae3450, 0xc172d00f,
+    0x2016fdef, 0x7fca19b0, 0x13a94b2a, 0x4c75af75, 0xad118295,
+    0xf2cd66ca, 0x41c9da48, 0x1e153e17, 0xff7113f7, 0xa0adf7a8,
+    0xcccea532, 0x9312416d, 0x72766c8d, 0x2daa88d2, 0x5bc624bc,
+    0x041ac0e3, 0xe57eed03, 0xbaa2095c, 0xd6c15bc6, 0x891dbf99,
+    0x68799279, 0x37a57626, 0xf83e73c7, 0xa7e29798, 0x4686ba78,
+    0x195a5e27, 0x75390cbd, 0x2ae5e8e2, 0xcb81c502, 0x945d215d,
+    0xe2318d33, 0xbded696c, 0x5c89448c, 0x0355a0d3, 0x6f36f249,
+    0x30ea1616, 0xd18e3bf6, 0x8e52dfa9, 0x3d56632b, 0x628a8774,
+    0x83eeaa94, 0xdc324ecb, 0xb0511c51, 0xef8df80e, 0x0ee9d5ee,
+    0x513531b1, 0x27599ddf, 0x78857980, 0x99e15460, 0xc63db03f,
+    0xaa5ee2a5, 0xf58206fa, 0x14e62b1a, 0x4b3acf45, 0x8399bf1a,
+    0xdc455b45, 0x3d2176a5, 0x62fd92fa, 0x0e9ec060, 0x5142243f,
+    0xb02609df, 0xeffaed80, 0x999641ee, 0xc64aa5b1, 0x272e8851,
+    0x78f26c0e, 0x14913e94, 0x4b4ddacb, 0xaa29f72b, 0xf5f51374,
+    0x46f1aff6, 0x192d4ba9, 0xf8496649, 0xa7958216, 0xcbf6d08c,
+    0x942a34d3, 0x754e1933, 0x2a92fd6c, 0x5cfe5102, 0x0322b55d,
+    0xe24698bd, 0xbd9a7ce2, 0xd1f92e78, 0x8e25ca27, 0x6f41e7c7,
+    0x309d0398},
+   {0x00000000, 0x2b02690f, 0x5604d21e, 0x7d06bb11, 0xac08a43d,
+    0x870acd32, 0xfa0c7623, 0xd10e1f2c, 0x5811487b, 0x73132174,
+    0x0e159a65, 0x2517f36a, 0xf419ec46, 0xdf1b8549, 0xa21d3e58,
+    0x891f5757, 0xb02290f6, 0x9b20f9f9, 0xe62642e8, 0xcd242be7,
+    0x1c2a34cb, 0x37285dc4, 0x4a2ee6d5, 0x612c8fda, 0xe833d88d,
+    0xc331b182, 0xbe370a93, 0x9535639c, 0x443b7cb0, 0x6f3915bf,
+    0x123faeae, 0x393dc7a1, 0x9133cce8, 0xba31a5e7, 0xc7371ef6,
+    0xec3577f9, 0x3d3b68d5, 0x163901da, 0x6b3fbacb, 0x403dd3c4,
+    0xc9228493, 0xe220ed9c, 0x9f26568d, 0xb4243f82, 0x652a20ae,
+    0x4e2849a1, 0x332ef2b0, 0x182c9bbf, 0x21115c1e, 0x0a133511,
+    0x77158e00, 0x5c17e70f, 0x8d19f823, 0xa61b912c, 0xdb1d2a3d,
+    0xf01f4332, 0x79001465, 0x52027d6a, 0x2f04c67b, 0x0406af74,
+    0xd508b058, 0xfe0ad957, 0x830c6246, 0xa80e0b49, 0xd31174d4,
+    0xf8131ddb, 0x8515a6ca, 0xae17cfc5, 0x7f19d0e9, 0x541bb9e6,
+    0x291d02f7, 0x021f6bf8, 0x8b003caf, 0xa00255a0, 0xdd04eeb1,
+    0xf60687be, 0x27089892, 0x0c0af19d, 0x710c4a8c, 0x5a0e2383,
+    0x6333e422, 0x48318d2d, 0x3537363c, 0x1e355f33, 0xcf3b401f,
+    0xe4392910, 0x993f9201, 0xb23dfb0e, 0x3b22ac59, 0x1020c556,
+    0x6d267e47, 0x46241748, 0x972a0864, 0xbc28616b, 0xc12eda7a,
+    0xea2cb375, 0x4222b83c, 0x6920d133, 0x14266a22, 0x3f24032d,
+    0xee2a1c01, 0xc528750e, 0xb82ece1f, 0x932ca710, 0x1a33f047,
+    0x31319948, 0x4c372259, 0x67354b56, 0xb63b547a, 0x9d393d75,
+    0xe03f8664, 0xcb3def6b, 0xf20028ca, 0xd90241c5, 0xa404fad4,
+    0x8f0693db, 0x5e088cf7, 0x750ae5f8, 0x080c5ee9, 0x230e37e6,
+    0xaa1160b1, 0x811309be, 0xfc15b2af, 0xd717dba0, 0x0619c48c,
+    0x2d1bad83, 0x501d1692, 0x7b1f7f9d, 0x575504ad, 0x7c576da2,
+    0x0151d6b3, 0x2a53bfbc, 0xfb5da090, 0xd05fc99f, 0xad59728e,
+    0x865b1b81, 0x0f444cd6, 0x244625d9, 0x59409ec8, 0x7242f7c7,
+    0xa34ce8eb, 0x884e81e4, 0xf5483af5, 0xde4a53fa, 0xe777945b,
+    0xcc75fd54, 0xb1734645, 0x9a712f4a, 0x4b7f3066, 0x607d5969,
+    0x1d7be278, 0x36798b77, 0xbf66dc20, 0x9464b52f, 0xe9620e3e,
+    0xc2606731, 0x136e781d, 0x386c1112, 0x456aaa03, 0x6e68c30c,
+    0xc666c845, 0xed64a14a, 0x90621a5b, 0xbb607354, 0x6a6e6c78,
+    0x416c0577, 0x3c6abe66, 0x1768d769, 0x9e77803e, 0xb575e931,
+    0xc8735220, 0xe3713b2f, 0x327f2403, 0x197d4d0c, 0x647bf61d,
+    0x4f799f12, 0x764458b3, 0x5d4631bc, 0x20408aad, 0x0b42e3a2,
+    0xda4cfc8e, 0xf14e9581, 0x8c482e90, 0xa74a479f, 0x2e5510c8,
+    0x055779c7, 0x7851c2d6, 0x5353abd9, 0x825db4f5, 0xa95fddfa,
+    0xd45966eb, 0xff5b0fe4, 0x84447079, 0xaf461976, 0xd240a267,
+    0xf942cb68, 0x284cd444, 0x034ebd4b, 0x7e48065a, 0x554a6f55,
+    0xdc553802, 0xf757510d, 0x8a51ea1c, 0xa1538313, 0x705d9c3f,
+    0x5b5ff530, 0x26594e21, 0x0d5b272e, 0x3466e08f, 0x1f648980,
+    0x62623291, 0x49605b9e, 0x986e44b2, 0xb36c2dbd, 0xce6a96ac,
+    0xe568ffa3, 0x6c77a8f4, 0x4775c1fb, 0x3a737aea, 0x117113e5,
+    0xc07f0cc9, 0xeb7d65c6, 0x967bded7, 0xbd79b7d8, 0x1577bc91,
+    0x3e75d59e, 0x43736e8f, 0x68710780, 0xb97f18ac, 0x927d71a3,
+    0xef7bcab2, 0xc479a3bd, 0x4d66f4ea, 0x66649de5, 0x1b6226f4,
+    0x30604ffb, 0xe16e50d7, 0xca6c39d8, 0xb76a82c9, 0x9c68ebc6,
+    0xa5552c67, 0x8e574568, 0xf351fe79, 0xd8539776, 0x095d885a,
+    0x225fe155, 0x5f595a44, 0x745b334b, 0xfd44641c, 0xd6460d13,
+    0xab40b602, 0x8042df0d, 0x514cc021, 0x7a4ea92e, 0x0748123f,
+    0x2c4a7b30},
+   {0x00000000, 0xe74c3bb9, 0x3fef9a77, 0xd8a3a1ce, 0x7ede35ef,
+    0x99920e56, 0x4131af98, 0xa67d9421, 0x0dca87db, 0xea86bc62,
+    0x32251dac, 0xd5692615, 0x7314b234, 0x9458898d, 0x4cfb2843,
+    0xabb713fa, 0xebe2e3b2, 0x0caed80b, 0xd40d79c5, 0x3341427c,
+    0x953cd65d, 0x7270ede4, 0xaad34c2a, 0x4d9f7793, 0xe6286469,
+    0x01645fd0, 0xd9c7fe1e, 0x3e8bc5a7, 0x98f65186, 0x7fba6a3f,
+    0xa719cbf1, 0x4055f048, 0x27b32b60, 0xc0ff10d9, 0x185cb117,
+    0xff108aae, 0x596d1e8f, 0xbe212536, 0x668284f8, 0x81cebf41,
+    0x2a79acbb, 0xcd359702, 0x159636cc, 0xf2da0d75, 0x54a79954,
+    0xb3eba2ed, 0x6b480323, 0x8c04389a, 0xcc51c8d2, 0x2b1df36b,
+    0xf3be52a5, 0x14f2691c, 0xb28ffd3d, 0x55c3c684, 0x8d60674a,
+    0x6a2c5cf3, 0xc19b4f09, 0x26d774b0, 0xfe74d57e, 0x1938eec7,
+    0xbf457ae6, 0x5809415f, 0x80aae091, 0x67e6db28, 0x4e6657c0,
+    0xa92a6c79, 0x7189cdb7, 0x96c5f60e, 0x30b8622f, 0xd7f45996,
+    0x0f57f858, 0xe81bc3e1, 0x43acd01b, 0xa4e0eba2, 0x7c434a6c,
+    0x9b0f71d5, 0x3d72e5f4, 0xda3ede4d, 0x029d7f83, 0xe5d1443a,
+    0xa584b472, 0x42c88fcb, 0x9a6b2e05, 0x7d2715bc, 0xdb5a819d,
+    0x3c16ba24, 0xe4b51bea, 0x03f92053, 0xa84e33a9, 0x4f020810,
+    0x97a1a9de, 0x70ed9267, 0xd6900646, 0x31dc3dff, 0xe97f9c31,
+    0x0e33a788, 0x69d57ca0, 0x8e994719, 0x563ae6d7, 0xb176dd6e,
+    0x170b494f, 0xf04772f6, 0x28e4d338, 0xcfa8e881, 0x641ffb7b,
+    0x8353c0c2, 0x5bf0610c, 0xbcbc5ab5, 0x1ac1ce94, 0xfd8df52d,
+    0x252e54e3, 0xc2626f5a, 0x82379f12, 0x657ba4ab, 0xbdd80565,
+    0x5a943edc, 0xfce9aafd, 0x1ba59144, 0xc306308a, 0x244a0b33,
+    0x8ffd18c9, 0x68b12370, 0xb01282be, 0x575eb907, 0xf1232d26,
+    0x166f169f, 0xceccb751, 0x29808ce8, 0x6dba4285, 0x8af6793c,
+    0x5255d8f2, 0xb519e34b, 0x1364776a, 0xf4284cd3, 0x2c8bed1d,
+    0xcbc7d6a4, 0x6070c55e, 0x873cfee7, 0x5f9f5f29, 0xb8d36490,
+    0x1eaef0b1, 0xf9e2cb08, 0x21416ac6, 0xc60d517f, 0x8658a137,
+    0x61149a8e, 0xb9b73b40, 0x5efb00f9, 0xf88694d8, 0x1fcaaf61,
+    0xc7690eaf, 0x20253516, 0x8b9226ec, 0x6cde1d55, 0xb47dbc9b,
+    0x53318722, 0xf54c1303, 0x120028ba, 0xcaa38974, 0x2defb2cd,
+    0x4a0969e5, 0xad45525c, 0x75e6f392, 0x92aac82b, 0x34d75c0a,
+    0xd39b67b3, 0x0b38c67d, 0xec74fdc4, 0x47c3ee3e, 0xa08fd587,
+    0x782c7449, 0x9f604ff0, 0x391ddbd1, 0xde51e068, 0x06f241a6,
+    0xe1be7a1f, 0xa1eb8a57, 0x46a7b1ee, 0x9e041020, 0x79482b99,
+    0xdf35bfb8, 0x38798401, 0xe0da25cf, 0x07961e76, 0xac210d8c,
+    0x4b6d3635, 0x93ce97fb, 0x7482ac42, 0xd2ff3863, 0x35b303da,
+    0xed10a214, 0x0a5c99ad, 0x23dc1545, 0xc4902efc, 0x1c338f32,
+    0xfb7fb48b, 0x5d0220aa, 0xba4e1b13, 0x62edbadd, 0x85a18164,
+    0x2e16929e, 0xc95aa927, 0x11f908e9, 0xf6b53350, 0x50c8a771,
+    0xb7849cc8, 0x6f273d06, 0x886b06bf, 0xc83ef6f7, 0x2f72cd4e,
+    0xf7d16c80, 0x109d5739, 0xb6e0c318, 0x51acf8a1, 0x890f596f,
+    0x6e4362d6, 0xc5f4712c, 0x22b84a95, 0xfa1beb5b, 0x1d57d0e2,
+    0xbb2a44c3, 0x5c667f7a, 0x84c5deb4, 0x6389e50d, 0x046f3e25,
+    0xe323059c, 0x3b80a452, 0xdccc9feb, 0x7ab10bca, 0x9dfd3073,
+    0x455e91bd, 0xa212aa04, 0x09a5b9fe, 0xeee98247, 0x364a2389,
+    0xd1061830, 0x777b8c11, 0x9037b7a8, 0x48941666, 0xafd82ddf,
+    0xef8ddd97, 0x08c1e62e, 0xd06247e0, 0x372e7c59, 0x9153e878,
+    0x761fd3c1, 0xaebc720f, 0x49f049b6, 0xe2475a4c, 0x050b61f5,
+    0xdda8c03b, 0x3ae4fb82, 0x9c996fa3, 0x7bd5541a, 0xa376f5d4,
+    0x443ace6d},
+   {0x00000000, 0xbdf74337, 0x7aef876e, 0xc718c459, 0xf4de0fdd,
+    0x49294cea, 0x8e3188b3, 0x33c6cb84, 0x19cbf3bf, 0xa43cb088,
+    0x632474d1, 0xded337e6, 0xed15fc62, 0x50e2bf55, 0x97fa7b0c,
+    0x2a0d383b, 0xc3e00b7a, 0x7e17484d, 0xb90f8c14, 0x04f8cf23,
+    0x373e04a7, 0x8ac94790, 0x4dd183c9, 0xf026c0fe, 0xda2bf8c5,
+    0x67dcbbf2, 0xa0c47fab, 0x1d333c9c, 0x2ef5f718, 0x9302b42f,
+    0x541a7076, 0xe9ed3341, 0x86c117f4, 0x3b3654c3, 0xfc2e909a,
+    0x41d9d3ad, 0x721f1829, 0xcfe85b1e, 0x08f09f47, 0xb507dc70,
+    0x9f0ae44b, 0x22fda77c, 0xe5e56325, 0x58122012, 0x6bd4eb96,
+    0xd623a8a1, 0x113b6cf8, 0xaccc2fcf, 0x45211c8e, 0xf8d65fb9,
+    0x3fce9be0, 0x8239d8d7, 0xb1ff1353, 0x0c085064, 0xcb10943d,
+    0x76e7d70a, 0x5ceaef31, 0xe11dac06, 0x2605685f, 0x9bf22b68,
+    0xa834e0ec, 0x15c3a3db, 0xd2db6782, 0x6f2c24b5, 0xfdf5c3ed,
+    0x400280da, 0x871a4483, 0x3aed07b4, 0x092bcc30, 0xb4dc8f07,
+    0x73c44b5e, 0xce330869, 0xe43e3052, 0x59c97365, 0x9ed1b73c,
+    0x2326f40b, 0x10e03f8f, 0xad177cb8, 0x6a0fb8e1, 0xd7f8fbd6,
+    0x3e15c897, 0x83e28ba0, 0x44fa4ff9, 0xf90d0cce, 0xcacbc74a,
+    0x773c847d, 0xb0244024, 0x0dd30313, 0x27de3b28, 0x9a29781f,
+    0x5d31bc46, 0xe0c6ff71, 0xd30034f5, 0x6ef777c2, 0xa9efb39b,
+    0x1418f0ac, 0x7b34d419, 0xc6c3972e, 0x01db5377, 0xbc2c1040,
+    0x8feadbc4, 0x321d98f3, 0xf5055caa, 0x48f21f9d, 0x62ff27a6,
+    0xdf086491, 0x1810a0c8, 0xa5e7e3ff, 0x9621287b, 0x2bd66b4c,
+    0xecceaf15, 0x5139ec22, 0xb8d4df63, 0x05239c54, 0xc23b580d,
+    0x7fcc1b3a, 0x4c0ad0be, 0xf1fd9389, 0x36e557d0, 0x8b1214e7,
+    0xa11f2cdc, 0x1ce86feb, 0xdbf0abb2, 0x6607e885, 0x55c12301,
+    0xe8366036, 0x2f2ea46f, 0x92d9e758, 0x0b9d6bde, 0xb66a28e9,
+    0x7172ecb0, 0xcc85af87, 0xff436403, 0x42b42734, 0x85ace36d,
+    0x385ba05a, 0x12569861, 0xafa1db56, 0x68b91f0f, 0xd54e5c38,
+    0xe68897bc, 0x5b7fd48b, 0x9c6710d2, 0x219053e5, 0xc87d60a4,
+    0x758a2393, 0xb292e7ca, 0x0f65a4fd, 0x3ca36f79, 0x81542c4e,
+    0x464ce817, 0xfbbbab20, 0xd1b6931b, 0x6c41d02c, 0xab591475,
+    0x16ae5742, 0x25689cc6, 0x989fdff1, 0x5f871ba8, 0xe270589f,
+    0x8d5c7c2a, 0x30ab3f1d, 0xf7b3fb44, 0x4a44b873, 0x798273f7,
+    0xc47530c0, 0x036df499, 0xbe9ab7ae, 0x94978f95, 0x2960cca2,
+    0xee7808fb, 0x538f4bcc, 0x60498048, 0xddbec37f, 0x1aa60726,
+    0xa7514411, 0x4ebc7750, 0xf34b3467, 0x3453f03e, 0x89a4b309,
+    0xba62788d, 0x07953bba, 0xc08dffe3, 0x7d7abcd4, 0x577784ef,
+    0xea80c7d8, 0x2d980381, 0x906f40b6, 0xa3a98b32, 0x1e5ec805,
+    0xd9460c5c, 0x64b14f6b, 0xf668a833, 0x4b9feb04, 0x8c872f5d,
+    0x31706c6a, 0x02b6a7ee, 0xbf41e4d9, 0x78592080, 0xc5ae63b7,
+    0xefa35b8c, 0x525418bb, 0x954cdce2, 0x28bb9fd5, 0x1b7d5451,
+    0xa68a1766, 0x6192d33f, 0xdc659008, 0x3588a349, 0x887fe07e,
+    0x4f672427, 0xf2906710, 0xc156ac94, 0x7ca1efa3, 0xbbb92bfa,
+    0x064e68cd, 0x2c4350f6, 0x91b413c1, 0x56acd798, 0xeb5b94af,
+    0xd89d5f2b, 0x656a1c1c, 0xa272d845, 0x1f859b72, 0x70a9bfc7,
+    0xcd5efcf0, 0x0a4638a9, 0xb7b17b9e, 0x8477b01a, 0x3980f32d,
+    0xfe983774, 0x436f7443, 0x69624c78, 0xd4950f4f, 0x138dcb16,
+    0xae7a8821, 0x9dbc43a5, 0x204b0092, 0xe753c4cb, 0x5aa487fc,
+    0xb349b4bd, 0x0ebef78a, 0xc9a633d3, 0x745170e4, 0x4797bb60,
+    0xfa60f857, 0x3d783c0e, 0x808f7f39, 0xaa824702, 0x17750435,
+    0xd06dc06c, 0x6d9a835b, 0x5e5c48df, 0xe3ab0be8, 0x24b3cfb1,
+    0x99448c86}};
+
+#endif /* W */
+
+#endif /* N == 5 */
+#if N == 6
+
+#if W == 8
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0x1c291d04, 0x38523a08, 0x247b270c, 0x70a47410,
+    0x6c8d6914, 0x48f64e18, 0x54df531c, 0xe148e820, 0xfd61f524,
+    0xd91ad228, 0xc533cf2c, 0x91ec9c30, 0x8dc58134, 0xa9bea638,
+    0xb597bb3c, 0xc77da6b1, 0xdb54bbb5, 0xff2f9cb9, 0xe30681bd,
+    0xb7d9d2a1, 0xabf0cfa5, 0x8f8be8a9, 0x93a2f5ad, 0x26354e91,
+    0x3a1c5395, 0x1e677499, 0x024e699d, 0x56913a81, 0x4ab82785,
+    0x6ec30089, 0x72ea1d8d, 0x8b173b93, 0x973e2697, 0xb345019b,
+    0xaf6c1c9f, 0xfbb34f83, 0xe79a5287, 0xc3e1758b, 0xdfc8688f,
+    0x6a5fd3b3, 0x7676ceb7, 0x520de9bb, 0x4e24f4bf, 0x1afba7a3,
+    0x06d2baa7, 0x22a99dab, 0x3e8080af, 0x4c6a9d22, 0x50438026,
+    0x7438a72a, 0x6811ba2e, 0x3ccee932, 0x20e7f436, 0x049cd33a,
+    0x18b5ce3e, 0xad227502, 0xb10b6806, 0x95704f0a, 0x8959520e,
+    0xdd860112, 0xc1af1c16, 0xe5d43b1a, 0xf9fd261e, 0x13c201d7,
+    0x0feb1cd3, 0x2b903bdf, 0x37b926db, 0x636675c7, 0x7f4f68c3,
+    0x5b344fcf, 0x471d52cb, 0xf28ae9f7, 0xeea3f4f3, 0xcad8d3ff,
+    0xd6f1cefb, 0x822e9de7, 0x9e0780e3, 0xba7ca7ef, 0xa655baeb,
+    0xd4bfa766, 0xc896ba62, 0xeced9d6e, 0xf0c4806a, 0xa41bd376,
+    0xb832ce72, 0x9c49e97e, 0x8060f47a, 0x35f74f46, 0x29de5242,
+    0x0da5754e, 0x118c684a, 0x45533b56, 0x597a2652, 0x7d01015e,
+    0x61281c5a, 0x98d53a44, 0x84fc2740, 0xa087004c, 0xbcae1d48,
+    0xe8714e54, 0xf4585350, 0xd023745c, 0xcc0a6958, 0x799dd264,
+    0x65b4cf60, 0x41cfe86c, 0x5de6f568, 0x0939a674, 0x1510bb70,
+    0x316b9c7c, 0x2d428178, 0x5fa89cf5, 0x438181f1, 0x67faa6fd,
+    0x7bd3bbf9, 0x2f0ce8e5, 0x3325f5e1, 0x175ed2ed, 0x0b77cfe9,
+    0xbee074d5, 0xa2c969d1, 0x86b24edd, 0x9a9b53d9, 0xce4400c5,
+    0xd26d1dc1, 0xf6163acd, 0xea3f27c9, 0x278403ae, 0x3bad1eaa,
+    0x1fd639a6, 0x03ff24a2, 0x572077be, 0x4b096aba, 0x6f724db6,
+    0x735b50b2, 0xc6cceb8e, 0xdae5f68a, 0xfe9ed186, 0xe2b7cc82,
+    0xb6689f9e, 0xaa41829a, 0x8e3aa596, 0x9213b892, 0xe0f9a51f,
+    0xfcd0b81b, 0xd8ab9f17, 0xc4828213, 0x905dd10f, 0x8c74cc0b,
+    0xa80feb07, 0xb426f603, 0x01b14d3f, 0x1d98503b, 0x39e37737,
+    0x25ca6a33, 0x7115392f, 0x6d3c242b, 0x49470327, 0x556e1e23,
+    0xac93383d, 0xb0ba2539, 0x94c10235, 0x88e81f31, 0xdc374c2d,
+    0xc01e5129, 0xe4657625, 0xf84c6b21, 0x4ddbd01d, 0x51f2cd19,
+    0x7589ea15, 0x69a0f711, 0x3d7fa40d, 0x2156b909, 0x052d9e05,
+    0x19048301, 0x6bee9e8c, 0x77c78388, 0x53bca484, 0x4f95b980,
+    0x1b4aea9c, 0x0763f798, 0x2318d094, 0x3f31cd90, 0x8aa676ac,
+    0x968f6ba8, 0xb2f44ca4, 0xaedd51a0, 0xfa0202bc, 0xe62b1fb8,
+    0xc25038b4, 0xde7925b0, 0x34460279, 0x286f1f7d, 0x0c143871,
+    0x103d2575, 0x44e27669, 0x58cb6b6d, 0x7cb04c61, 0x60995165,
+    0xd50eea59, 0xc927f75d, 0xed5cd051, 0xf175cd55, 0xa5aa9e49,
+    0xb983834d, 0x9df8a441, 0x81d1b945, 0xf33ba4c8, 0xef12b9cc,
+    0xcb699ec0, 0xd74083c4, 0x839fd0d8, 0x9fb6cddc, 0xbbcdead0,
+    0xa7e4f7d4, 0x12734ce8, 0x0e5a51ec, 0x2a2176e0, 0x36086be4,
+    0x62d738f8, 0x7efe25fc, 0x5a8502f0, 0x46ac1ff4, 0xbf5139ea,
+    0xa37824ee, 0x870303e2, 0x9b2a1ee6, 0xcff54dfa, 0xd3dc50fe,
+    0xf7a777f2, 0xeb8e6af6, 0x5e19d1ca, 0x4230ccce, 0x664bebc2,
+    0x7a62f6c6, 0x2ebda5da, 0x3294b8de, 0x16ef9fd2, 0x0ac682d6,
+    0x782c9f5b, 0x6405825f, 0x407ea553, 0x5c57b857, 0x0888eb4b,
+    0x14a1f64f, 0x30dad143, 0x2cf3cc47, 0x9964777b, 0x854d6a7f,
+    0xa1364d73, 0xbd1f5077, 0xe9c0036b, 0xf5e91e6f, 0xd1923963,
+    0xcdbb2467},
+   {0x00000000, 0x4f08075c, 0x9e100eb8, 0xd11809e4, 0x39cc6b81,
+    0x76c46cdd, 0xa7dc6539, 0xe8d46265, 0x7398d702, 0x3c90d05e,
+    0xed88d9ba, 0xa280dee6, 0x4a54bc83, 0x055cbbdf, 0xd444b23b,
+    0x9b4cb567, 0xe731ae04, 0xa839a958, 0x7921a0bc, 0x3629a7e0,
+    0xdefdc585, 0x91f5c2d9, 0x40edcb3d, 0x0fe5cc61, 0x94a97906,
+    0xdba17e5a, 0x0ab977be, 0x45b170e2, 0xad651287, 0xe26d15db,
+    0x33751c3f, 0x7c7d1b63, 0xcb8f2af9, 0x84872da5, 0x559f2441,
+    0x1a97231d, 0xf2434178, 0xbd4b4624, 0x6c534fc0, 0x235b489c,
+    0xb817fdfb, 0xf71ffaa7, 0x2607f343, 0x690ff41f, 0x81db967a,
+    0xced39126, 0x1fcb98c2, 0x50c39f9e, 0x2cbe84fd, 0x63b683a1,
+    0xb2ae8a45, 0xfda68d19, 0x1572ef7c, 0x5a7ae820, 0x8b62e1c4,
+    0xc46ae698, 0x5f2653ff, 0x102e54a3, 0xc1365d47, 0x8e3e5a1b,
+    0x66ea387e, 0x29e23f22, 0xf8fa36c6, 0xb7f2319a, 0x92f22303,
+    0xddfa245f, 0x0ce22dbb, 0x43ea2ae7, 0xab3e4882, 0xe4364fde,
+    0x352e463a, 0x7a264166, 0xe16af401, 0xae62f35d, 0x7f7afab9,
+    0x3072fde5, 0xd8a69f80, 0x97ae98dc, 0x46b69138, 0x09be9664,
+    0x75c38d07, 0x3acb8a5b, 0xebd383bf, 0xa4db84e3, 0x4c0fe686,
+    0x0307e1da, 0xd21fe83e, 0x9d17ef62, 0x065b5a05, 0x49535d59,
+    0x984b54bd, 0xd74353e1, 0x3f973184, 0x709f36d8, 0xa1873f3c,
+    0xee8f3860, 0x597d09fa, 0x16750ea6, 0xc76d0742, 0x8865001e,
+    0x60b1627b, 0x2fb96527, 0xfea16cc3, 0xb1a96b9f, 0x2ae5def8,
+    0x65edd9a4, 0xb4f5d040, 0xfbfdd71c, 0x1329b579, 0x5c21b225,
+    0x8d39bbc1, 0xc231bc9d, 0xbe4ca7fe, 0xf144a0a2, 0x205ca946,
+    0x6f54ae1a, 0x8780cc7f, 0xc888cb23, 0x1990c2c7, 0x5698c59b,
+    0xcdd470fc, 0x82dc77a0, 0x53c47e44, 0x1ccc7918, 0xf4181b7d,
+    0xbb101c21, 0x6a0815c5, 0x25001299, 0x200830f7, 0x6f0037ab,
+    0xbe183e4f, 0xf1103913, 0x19c45b76, 0x56cc5c2a, 0x87d455ce,
+    0xc8dc5292, 0x5390e7f5, 0x1c98e0a9, 0xcd80e94d, 0x8288ee11,
+    0x6a5c8c74, 0x25548b28, 0xf44c82cc, 0xbb448590, 0xc7399ef3,
+    0x883199af, 0x5929904b, 0x16219717, 0xfef5f572, 0xb1fdf22e,
+    0x60e5fbca, 0x2fedfc96, 0xb4a149f1, 0xfba94ead, 0x2ab14749,
+    0x65b94015, 0x8d6d2270, 0xc265252c, 0x137d2cc8, 0x5c752b94,
+    0xeb871a0e, 0xa48f1d52, 0x759714b6, 0x3a9f13ea, 0xd24b718f,
+    0x9d4376d3, 0x4c5b7f37, 0x0353786b, 0x981fcd0c, 0xd717ca50,
+    0x060fc3b4, 0x4907c4e8, 0xa1d3a68d, 0xeedba1d1, 0x3fc3a835,
+    0x70cbaf69, 0x0cb6b40a, 0x43beb356, 0x92a6bab2, 0xddaebdee,
+    0x357adf8b, 0x7a72d8d7, 0xab6ad133, 0xe462d66f, 0x7f2e6308,
+    0x30266454, 0xe13e6db0, 0xae366aec, 0x46e20889, 0x09ea0fd5,
+    0xd8f20631, 0x97fa016d, 0xb2fa13f4, 0xfdf214a8, 0x2cea1d4c,
+    0x63e21a10, 0x8b367875, 0xc43e7f29, 0x152676cd, 0x5a2e7191,
+    0xc162c4f6, 0x8e6ac3aa, 0x5f72ca4e, 0x107acd12, 0xf8aeaf77,
+    0xb7a6a82b, 0x66bea1cf, 0x29b6a693, 0x55cbbdf0, 0x1ac3baac,
+    0xcbdbb348, 0x84d3b414, 0x6c07d671, 0x230fd12d, 0xf217d8c9,
+    0xbd1fdf95, 0x26536af2, 0x695b6dae, 0xb843644a, 0xf74b6316,
+    0x1f9f0173, 0x5097062f, 0x818f0fcb, 0xce870897, 0x7975390d,
+    0x367d3e51, 0xe76537b5, 0xa86d30e9, 0x40b9528c, 0x0fb155d0,
+    0xdea95c34, 0x91a15b68, 0x0aedee0f, 0x45e5e953, 0x94fde0b7,
+    0xdbf5e7eb, 0x3321858e, 0x7c2982d2, 0xad318b36, 0xe2398c6a,
+    0x9e449709, 0xd14c9055, 0x005499b1, 0x4f5c9eed, 0xa788fc88,
+    0xe880fbd4, 0x3998f230, 0x7690f56c, 0xeddc400b, 0xa2d44757,
+    0x73cc4eb3, 0x3cc449ef, 0xd4102b8a, 0x9b182cd6, 0x4a002532,
+    0x0508226e},
+   {0x00000000, 0x401061ee, 0x8020c3dc, 0xc030a232, 0x05adf149,
+    0x45bd90a7, 0x858d3295, 0xc59d537b, 0x0b5be292, 0x4b4b837c,
+    0x8b7b214e, 0xcb6b40a0, 0x0ef613db, 0x4ee67235, 0x8ed6d007,
+    0xcec6b1e9, 0x16b7c524, 0x56a7a4ca, 0x969706f8, 0xd6876716,
+    0x131a346d, 0x530a5583, 0x933af7b1, 0xd32a965f, 0x1dec27b6,
+    0x5dfc4658, 0x9dcce46a, 0xdddc8584, 0x1841d6ff, 0x5851b711,
+    0x98611523, 0xd87174cd, 0x2d6f8a48, 0x6d7feba6, 0xad4f4994,
+    0xed5f287a, 0x28c27b01, 0x68d21aef, 0xa8e2b8dd, 0xe8f2d933,
+    0x263468da, 0x66240934, 0xa614ab06, 0xe604cae8, 0x23999993,
+    0x6389f87d, 0xa3b95a4f, 0xe3a93ba1, 0x3bd84f6c, 0x7bc82e82,
+    0xbbf88cb0, 0xfbe8ed5e, 0x3e75be25, 0x7e65dfcb, 0xbe557df9,
+    0xfe451c17, 0x3083adfe, 0x7093cc10, 0xb0a36e22, 0xf0b30fcc,
+    0x352e5cb7, 0x753e3d59, 0xb50e9f6b, 0xf51efe85, 0x5adf1490,
+    0x1acf757e, 0xdaffd74c, 0x9aefb6a2, 0x5f72e5d9, 0x1f628437,
+    0xdf522605, 0x9f4247eb, 0x5184f602, 0x119497ec, 0xd1a435de,
+    0x91b45430, 0x5429074b, 0x143966a5, 0xd409c497, 0x9419a579,
+    0x4c68d1b4, 0x0c78b05a, 0xcc481268, 0x8c587386, 0x49c520fd,
+    0x09d54113, 0xc9e5e321, 0x89f582cf, 0x47333326, 0x072352c8,
+    0xc713f0fa, 0x87039114, 0x429ec26f, 0x028ea381, 0xc2be01b3,
+    0x82ae605d, 0x77b09ed8, 0x37a0ff36, 0xf7905d04, 0xb7803cea,
+    0x721d6f91, 0x320d0e7f, 0xf23dac4d, 0xb22dcda3, 0x7ceb7c4a,
+    0x3cfb1da4, 0xfccbbf96, 0xbcdbde78, 0x79468d03, 0x3956eced,
+    0xf9664edf, 0xb9762f31, 0x61075bfc, 0x21173a12, 0xe1279820,
+    0xa137f9ce, 0x64aaaab5, 0x24bacb5b, 0xe48a6969, 0xa49a0887,
+    0x6a5cb96e, 0x2a4cd880, 0xea7c7ab2, 0xaa6c1b5c, 0x6ff14827,
+    0x2fe129c9, 0xefd18bfb, 0xafc1ea15, 0xb5be2920, 0xf5ae48ce,
+    0x359eeafc, 0x758e8b12, 0xb013d869, 0xf003b987, 0x30331bb5,
+    0x70237a5b, 0xbee5cbb2, 0xfef5aa5c, 0x3ec5086e, 0x7ed56980,
+    0xbb483afb, 0xfb585b15, 0x3b68f927, 0x7b7898c9, 0xa309ec04,
+    0xe3198dea, 0x23292fd8, 0x63394e36, 0xa6a41d4d, 0xe6b47ca3,
+    0x2684de91, 0x6694bf7f, 0xa8520e96, 0xe8426f78, 0x2872cd4a,
+    0x6862aca4, 0xadffffdf, 0xedef9e31, 0x2ddf3c03, 0x6dcf5ded,
+    0x98d1a368, 0xd8c1c286, 0x18f160b4, 0x58e1015a, 0x9d7c5221,
+    0xdd6c33cf, 0x1d5c91fd, 0x5d4cf013, 0x938a41fa, 0xd39a2014,
+    0x13aa8226, 0x53bae3c8, 0x9627b0b3, 0xd637d15d, 0x1607736f,
+    0x56171281, 0x8e66664c, 0xce7607a2, 0x0e46a590, 0x4e56c47e,
+    0x8bcb9705, 0xcbdbf6eb, 0x0beb54d9, 0x4bfb3537, 0x853d84de,
+    0xc52de530, 0x051d4702, 0x450d26ec, 0x80907597, 0xc0801479,
+    0x00b0b64b, 0x40a0d7a5, 0xef613db0, 0xaf715c5e, 0x6f41fe6c,
+    0x2f519f82, 0xeaccccf9, 0xaadcad17, 0x6aec0f25, 0x2afc6ecb,
+    0xe43adf22, 0xa42abecc, 0x641a1cfe, 0x240a7d10, 0xe1972e6b,
+    0xa1874f85, 0x61b7edb7, 0x21a78c59, 0xf9d6f894, 0xb9c6997a,
+    0x79f63b48, 0x39e65aa6, 0xfc7b09dd, 0xbc6b6833, 0x7c5bca01,
+    0x3c4babef, 0xf28d1a06, 0xb29d7be8, 0x72add9da, 0x32bdb834,
+    0xf720eb4f, 0xb7308aa1, 0x77002893, 0x3710497d, 0xc20eb7f8,
+    0x821ed616, 0x422e7424, 0x023e15ca, 0xc7a346b1, 0x87b3275f,
+    0x4783856d, 0x0793e483, 0xc955556a, 0x89453484, 0x497596b6,
+    0x0965f758, 0xccf8a423, 0x8ce8c5cd, 0x4cd867ff, 0x0cc80611,
+    0xd4b972dc, 0x94a91332, 0x5499b100, 0x1489d0ee, 0xd1148395,
+    0x9104e27b, 0x51344049, 0x112421a7, 0xdfe2904e, 0x9ff2f1a0,
+    0x5fc25392, 0x1fd2327c, 0xda4f6107, 0x9a5f00e9, 0x5a6fa2db,
+    0x1a7fc335},
+   {0x00000000, 0x6e9024b1, 0xdd204962, 0xb3b06dd3, 0xbface435,
+    0xd13cc084, 0x628cad57, 0x0c1c89e6, 0x7ab5be9b, 0x14259a2a,
+    0xa795f7f9, 0xc905d348, 0xc5195aae, 0xab897e1f, 0x183913cc,
+    0x76a9377d, 0xf56b7d36, 0x9bfb5987, 0x284b3454, 0x46db10e5,
+    0x4ac79903, 0x2457bdb2, 0x97e7d061, 0xf977f4d0, 0x8fdec3ad,
+    0xe14ee71c, 0x52fe8acf, 0x3c6eae7e, 0x30722798, 0x5ee20329,
+    0xed526efa, 0x83c24a4b, 0xef3a8c9d, 0x81aaa82c, 0x321ac5ff,
+    0x5c8ae14e, 0x509668a8, 0x3e064c19, 0x8db621ca, 0xe326057b,
+    0x958f3206, 0xfb1f16b7, 0x48af7b64, 0x263f5fd5, 0x2a23d633,
+    0x44b3f282, 0xf7039f51, 0x9993bbe0, 0x1a51f1ab, 0x74c1d51a,
+    0xc771b8c9, 0xa9e19c78, 0xa5fd159e, 0xcb6d312f, 0x78dd5cfc,
+    0x164d784d, 0x60e44f30, 0x0e746b81, 0xbdc40652, 0xd35422e3,
+    0xdf48ab05, 0xb1d88fb4, 0x0268e267, 0x6cf8c6d6, 0xdb996fcb,
+    0xb5094b7a, 0x06b926a9, 0x68290218, 0x64358bfe, 0x0aa5af4f,
+    0xb915c29c, 0xd785e62d, 0xa12cd150, 0xcfbcf5e1, 0x7c0c9832,
+    0x129cbc83, 0x1e803565, 0x701011d4, 0xc3a07c07, 0xad3058b6,
+    0x2ef212fd, 0x4062364c, 0xf3d25b9f, 0x9d427f2e, 0x915ef6c8,
+    0xffced279, 0x4c7ebfaa, 0x22ee9b1b, 0x5447ac66, 0x3ad788d7,
+    0x8967e504, 0xe7f7c1b5, 0xebeb4853, 0x857b6ce2, 0x36cb0131,
+    0x585b2580, 0x34a3e356, 0x5a33c7e7, 0xe983aa34, 0x87138e85,
+    0x8b0f0763, 0xe59f23d2, 0x562f4e01, 0x38bf6ab0, 0x4e165dcd,
+    0x2086797c, 0x933614af, 0xfda6301e, 0xf1bab9f8, 0x9f2a9d49,
+    0x2c9af09a, 0x420ad42b, 0xc1c89e60, 0xaf58bad1, 0x1ce8d702,
+    0x7278f3b3, 0x7e647a55, 0x10f45ee4, 0xa3443337, 0xcdd41786,
+    0xbb7d20fb, 0xd5ed044a, 0x665d6999, 0x08cd4d28, 0x04d1c4ce,
+    0x6a41e07f, 0xd9f18dac, 0xb761a91d, 0xb2dea967, 0xdc4e8dd6,
+    0x6ffee005, 0x016ec4b4, 0x0d724d52, 0x63e269e3, 0xd0520430,
+    0xbec22081, 0xc86b17fc, 0xa6fb334d, 0x154b5e9e, 0x7bdb7a2f,
+    0x77c7f3c9, 0x1957d778, 0xaae7baab, 0xc4779e1a, 0x47b5d451,
+    0x2925f0e0, 0x9a959d33, 0xf405b982, 0xf8193064, 0x968914d5,
+    0x25397906, 0x4ba95db7, 0x3d006aca, 0x53904e7b, 0xe02023a8,
+    0x8eb00719, 0x82ac8eff, 0xec3caa4e, 0x5f8cc79d, 0x311ce32c,
+    0x5de425fa, 0x3374014b, 0x80c46c98, 0xee544829, 0xe248c1cf,
+    0x8cd8e57e, 0x3f6888ad, 0x51f8ac1c, 0x27519b61, 0x49c1bfd0,
+    0xfa71d203, 0x94e1f6b2, 0x98fd7f54, 0xf66d5be5, 0x45dd3636,
+    0x2b4d1287, 0xa88f58cc, 0xc61f7c7d, 0x75af11ae, 0x1b3f351f,
+    0x1723bcf9, 0x79b39848, 0xca03f59b, 0xa493d12a, 0xd23ae657,
+    0xbcaac2e6, 0x0f1aaf35, 0x618a8b84, 0x6d960262, 0x030626d3,
+    0xb0b64b00, 0xde266fb1, 0x6947c6ac, 0x07d7e21d, 0xb4678fce,
+    0xdaf7ab7f, 0xd6eb2299, 0xb87b0628, 0x0bcb6bfb, 0x655b4f4a,
+    0x13f27837, 0x7d625c86, 0xced23155, 0xa04215e4, 0xac5e9c02,
+    0xc2ceb8b3, 0x717ed560, 0x1feef1d1, 0x9c2cbb9a, 0xf2bc9f2b,
+    0x410cf2f8, 0x2f9cd649, 0x23805faf, 0x4d107b1e, 0xfea016cd,
+    0x9030327c, 0xe6990501, 0x880921b0, 0x3bb94c63, 0x552968d2,
+    0x5935e134, 0x37a5c585, 0x8415a856, 0xea858ce7, 0x867d4a31,
+    0xe8ed6e80, 0x5b5d0353, 0x35cd27e2, 0x39d1ae04, 0x57418ab5,
+    0xe4f1e766, 0x8a61c3d7, 0xfcc8f4aa, 0x9258d01b, 0x21e8bdc8,
+    0x4f789979, 0x4364109f, 0x2df4342e, 0x9e4459fd, 0xf0d47d4c,
+    0x73163707, 0x1d8613b6, 0xae367e65, 0xc0a65ad4, 0xccbad332,
+    0xa22af783, 0x119a9a50, 0x7f0abee1, 0x09a3899c, 0x6733ad2d,
+    0xd483c0fe, 0xba13e44f, 0xb60f6da9, 0xd89f4918, 0x6b2f24cb,
+    0x05bf007a},
+   {0x00000000, 0x6051243f, 0xc0a2487e, 0xa0f36c41, 0x84a8e60d,
+    0xe4f9c232, 0x440aae73, 0x245b8a4c, 0x0cbdbaeb, 0x6cec9ed4,
+    0xcc1ff295, 0xac4ed6aa, 0x88155ce6, 0xe84478d9, 0x48b71498,
+    0x28e630a7, 0x197b75d6, 0x792a51e9, 0xd9d93da8, 0xb9881997,
+    0x9dd393db, 0xfd82b7e4, 0x5d71dba5, 0x3d20ff9a, 0x15c6cf3d,
+    0x7597eb02, 0xd5648743, 0xb535a37c, 0x916e2930, 0xf13f0d0f,
+    0x51cc614e, 0x319d4571, 0x32f6ebac, 0x52a7cf93, 0xf254a3d2,
+    0x920587ed, 0xb65e0da1, 0xd60f299e, 0x76fc45df, 0x16ad61e0,
+    0x3e4b5147, 0x5e1a7578, 0xfee91939, 0x9eb83d06, 0xbae3b74a,
+    0xdab29375, 0x7a41ff34, 0x1a10db0b, 0x2b8d9e7a, 0x4bdcba45,
+    0xeb2fd604, 0x8b7ef23b, 0xaf257877, 0xcf745c48, 0x6f873009,
+    0x0fd61436, 0x27302491, 0x476100ae, 0xe7926cef, 0x87c348d0,
+    0xa398c29c, 0xc3c9e6a3, 0x633a8ae2, 0x036baedd, 0x65edd758,
+    0x05bcf367, 0xa54f9f26, 0xc51ebb19, 0xe1453155, 0x8114156a,
+    0x21e7792b, 0x41b65d14, 0x69506db3, 0x0901498c, 0xa9f225cd,
+    0xc9a301f2, 0xedf88bbe, 0x8da9af81, 0x2d5ac3c0, 0x4d0be7ff,
+    0x7c96a28e, 0x1cc786b1, 0xbc34eaf0, 0xdc65cecf, 0xf83e4483,
+    0x986f60bc, 0x389c0cfd, 0x58cd28c2, 0x702b1865, 0x107a3c5a,
+    0xb089501b, 0xd0d87424, 0xf483fe68, 0x94d2da57, 0x3421b616,
+    0x54709229, 0x571b3cf4, 0x374a18cb, 0x97b9748a, 0xf7e850b5,
+    0xd3b3daf9, 0xb3e2fec6, 0x13119287, 0x7340b6b8, 0x5ba6861f,
+    0x3bf7a220, 0x9b04ce61, 0xfb55ea5e, 0xdf0e6012, 0xbf5f442d,
+    0x1fac286c, 0x7ffd0c53, 0x4e604922, 0x2e316d1d, 0x8ec2015c,
+    0xee932563, 0xcac8af2f, 0xaa998b10, 0x0a6ae751, 0x6a3bc36e,
+    0x42ddf3c9, 0x228cd7f6, 0x827fbbb7, 0xe22e9f88, 0xc67515c4,
+    0xa62431fb, 0x06d75dba, 0x66867985, 0xcbdbaeb0, 0xab8a8a8f,
+    0x0b79e6ce, 0x6b28c2f1, 0x4f7348bd, 0x2f226c82, 0x8fd100c3,
+    0xef8024fc, 0xc766145b, 0xa7373064, 0x07c45c25, 0x6795781a,
+    0x43cef256, 0x239fd669, 0x836cba28, 0xe33d9e17, 0xd2a0db66,
+    0xb2f1ff59, 0x12029318, 0x7253b727, 0x56083d6b, 0x36591954,
+    0x96aa7515, 0xf6fb512a, 0xde1d618d, 0xbe4c45b2, 0x1ebf29f3,
+    0x7eee0dcc, 0x5ab58780, 0x3ae4a3bf, 0x9a17cffe, 0xfa46ebc1,
+    0xf92d451c, 0x997c6123, 0x398f0d62, 0x59de295d, 0x7d85a311,
+    0x1dd4872e, 0xbd27eb6f, 0xdd76cf50, 0xf590fff7, 0x95c1dbc8,
+    0x3532b789, 0x556393b6, 0x713819fa, 0x11693dc5, 0xb19a5184,
+    0xd1cb75bb, 0xe05630ca, 0x800714f5, 0x20f478b4, 0x40a55c8b,
+    0x64fed6c7, 0x04aff2f8, 0xa45c9eb9, 0xc40dba86, 0xeceb8a21,
+    0x8cbaae1e, 0x2c49c25f, 0x4c18e660, 0x68436c2c, 0x08124813,
+    0xa8e12452, 0xc8b0006d, 0xae3679e8, 0xce675dd7, 0x6e943196,
+    0x0ec515a9, 0x2a9e9fe5, 0x4acfbbda, 0xea3cd79b, 0x8a6df3a4,
+    0xa28bc303, 0xc2dae73c, 0x62298b7d, 0x0278af42, 0x2623250e,
+    0x46720131, 0xe6816d70, 0x86d0494f, 0xb74d0c3e, 0xd71c2801,
+    0x77ef4440, 0x17be607f, 0x33e5ea33, 0x53b4ce0c, 0xf347a24d,
+    0x93168672, 0xbbf0b6d5, 0xdba192ea, 0x7b52feab, 0x1b03da94,
+    0x3f5850d8, 0x5f0974e7, 0xfffa18a6, 0x9fab3c99, 0x9cc09244,
+    0xfc91b67b, 0x5c62da3a, 0x3c33fe05, 0x18687449, 0x78395076,
+    0xd8ca3c37, 0xb89b1808, 0x907d28af, 0xf02c0c90, 0x50df60d1,
+    0x308e44ee, 0x14d5cea2, 0x7484ea9d, 0xd47786dc, 0xb426a2e3,
+    0x85bbe792, 0xe5eac3ad, 0x4519afec, 0x25488bd3, 0x0113019f,
+    0x614225a0, 0xc1b149e1, 0xa1e06dde, 0x89065d79, 0xe9577946,
+    0x49a41507, 0x29f53138, 0x0daebb74, 0x6dff9f4b, 0xcd0cf30a,
+    0xad5dd735},
+   {0x00000000, 0x925b2b91, 0x215a21d3, 0xb3010a42, 0x42b443a6,
+    0xd0ef6837, 0x63ee6275, 0xf1b549e4, 0x8568874c, 0x1733acdd,
+    0xa432a69f, 0x36698d0e, 0xc7dcc4ea, 0x5587ef7b, 0xe686e539,
+    0x74ddcea8, 0x0f3d7869, 0x9d6653f8, 0x2e6759ba, 0xbc3c722b,
+    0x4d893bcf, 0xdfd2105e, 0x6cd31a1c, 0xfe88318d, 0x8a55ff25,
+    0x180ed4b4, 0xab0fdef6, 0x3954f567, 0xc8e1bc83, 0x5aba9712,
+    0xe9bb9d50, 0x7be0b6c1, 0x1e7af0d2, 0x8c21db43, 0x3f20d101,
+    0xad7bfa90, 0x5cceb374, 0xce9598e5, 0x7d9492a7, 0xefcfb936,
+    0x9b12779e, 0x09495c0f, 0xba48564d, 0x28137ddc, 0xd9a63438,
+    0x4bfd1fa9, 0xf8fc15eb, 0x6aa73e7a, 0x114788bb, 0x831ca32a,
+    0x301da968, 0xa24682f9, 0x53f3cb1d, 0xc1a8e08c, 0x72a9eace,
+    0xe0f2c15f, 0x942f0ff7, 0x06742466, 0xb5752e24, 0x272e05b5,
+    0xd69b4c51, 0x44c067c0, 0xf7c16d82, 0x659a4613, 0x3cf5e1a4,
+    0xaeaeca35, 0x1dafc077, 0x8ff4ebe6, 0x7e41a202, 0xec1a8993,
+    0x5f1b83d1, 0xcd40a840, 0xb99d66e8, 0x2bc64d79, 0x98c7473b,
+    0x0a9c6caa, 0xfb29254e, 0x69720edf, 0xda73049d, 0x48282f0c,
+    0x33c899cd, 0xa193b25c, 0x1292b81e, 0x80c9938f, 0x717cda6b,
+    0xe327f1fa, 0x5026fbb8, 0xc27dd029, 0xb6a01e81, 0x24fb3510,
+    0x97fa3f52, 0x05a114c3, 0xf4145d27, 0x664f76b6, 0xd54e7cf4,
+    0x47155765, 0x228f1176, 0xb0d43ae7, 0x03d530a5, 0x918e1b34,
+    0x603b52d0, 0xf2607941, 0x41617303, 0xd33a5892, 0xa7e7963a,
+    0x35bcbdab, 0x86bdb7e9, 0x14e69c78, 0xe553d59c, 0x7708fe0d,
+    0xc409f44f, 0x5652dfde, 0x2db2691f, 0xbfe9428e, 0x0ce848cc,
+    0x9eb3635d, 0x6f062ab9, 0xfd5d0128, 0x4e5c0b6a, 0xdc0720fb,
+    0xa8daee53, 0x3a81c5c2, 0x8980cf80, 0x1bdbe411, 0xea6eadf5,
+    0x78358664, 0xcb348c26, 0x596fa7b7, 0x79ebc348, 0xebb0e8d9,
+    0x58b1e29b, 0xcaeac90a, 0x3b5f80ee, 0xa904ab7f, 0x1a05a13d,
+    0x885e8aac, 0xfc834404, 0x6ed86f95, 0xddd965d7, 0x4f824e46,
+    0xbe3707a2, 0x2c6c2c33, 0x9f6d2671, 0x0d360de0, 0x76d6bb21,
+    0xe48d90b0, 0x578c9af2, 0xc5d7b163, 0x3462f887, 0xa639d316,
+    0x1538d954, 0x8763f2c5, 0xf3be3c6d, 0x61e517fc, 0xd2e41dbe,
+    0x40bf362f, 0xb10a7fcb, 0x2351545a, 0x90505e18, 0x020b7589,
+    0x6791339a, 0xf5ca180b, 0x46cb1249, 0xd49039d8, 0x2525703c,
+    0xb77e5bad, 0x047f51ef, 0x96247a7e, 0xe2f9b4d6, 0x70a29f47,
+    0xc3a39505, 0x51f8be94, 0xa04df770, 0x3216dce1, 0x8117d6a3,
+    0x134cfd32, 0x68ac4bf3, 0xfaf76062, 0x49f66a20, 0xdbad41b1,
+    0x2a180855, 0xb84323c4, 0x0b422986, 0x99190217, 0xedc4ccbf,
+    0x7f9fe72e, 0xcc9eed6c, 0x5ec5c6fd, 0xaf708f19, 0x3d2ba488,
+    0x8e2aaeca, 0x1c71855b, 0x451e22ec, 0xd745097d, 0x6444033f,
+    0xf61f28ae, 0x07aa614a, 0x95f14adb, 0x26f04099, 0xb4ab6b08,
+    0xc076a5a0, 0x522d8e31, 0xe12c8473, 0x7377afe2, 0x82c2e606,
+    0x1099cd97, 0xa398c7d5, 0x31c3ec44, 0x4a235a85, 0xd8787114,
+    0x6b797b56, 0xf92250c7, 0x08971923, 0x9acc32b2, 0x29cd38f0,
+    0xbb961361, 0xcf4bddc9, 0x5d10f658, 0xee11fc1a, 0x7c4ad78b,
+    0x8dff9e6f, 0x1fa4b5fe, 0xaca5bfbc, 0x3efe942d, 0x5b64d23e,
+    0xc93ff9af, 0x7a3ef3ed, 0xe865d87c, 0x19d09198, 0x8b8bba09,
+    0x388ab04b, 0xaad19bda, 0xde0c5572, 0x4c577ee3, 0xff5674a1,
+    0x6d0d5f30, 0x9cb816d4, 0x0ee33d45, 0xbde23707, 0x2fb91c96,
+    0x5459aa57, 0xc60281c6, 0x75038b84, 0xe758a015, 0x16ede9f1,
+    0x84b6c260, 0x37b7c822, 0xa5ece3b3, 0xd1312d1b, 0x436a068a,
+    0xf06b0cc8, 0x62302759, 0x93856ebd, 0x01de452c, 0xb2df4f6e,
+    0x208464ff},
+   {0x00000000, 0xf3d78690, 0xe2437bd1, 0x1194fd41, 0xc16a8153,
+    0x32bd07c3, 0x2329fa82, 0xd0fe7c12, 0x87397457, 0x74eef2c7,
+    0x657a0f86, 0x96ad8916, 0x4653f504, 0xb5847394, 0xa4108ed5,
+    0x57c70845, 0x0b9e9e5f, 0xf84918cf, 0xe9dde58e, 0x1a0a631e,
+    0xcaf41f0c, 0x3923999c, 0x28b764dd, 0xdb60e24d, 0x8ca7ea08,
+    0x7f706c98, 0x6ee491d9, 0x9d331749, 0x4dcd6b5b, 0xbe1aedcb,
+    0xaf8e108a, 0x5c59961a, 0x173d3cbe, 0xe4eaba2e, 0xf57e476f,
+    0x06a9c1ff, 0xd657bded, 0x25803b7d, 0x3414c63c, 0xc7c340ac,
+    0x900448e9, 0x63d3ce79, 0x72473338, 0x8190b5a8, 0x516ec9ba,
+    0xa2b94f2a, 0xb32db26b, 0x40fa34fb, 0x1ca3a2e1, 0xef742471,
+    0xfee0d930, 0x0d375fa0, 0xddc923b2, 0x2e1ea522, 0x3f8a5863,
+    0xcc5ddef3, 0x9b9ad6b6, 0x684d5026, 0x79d9ad67, 0x8a0e2bf7,
+    0x5af057e5, 0xa927d175, 0xb8b32c34, 0x4b64aaa4, 0x2e7a797c,
+    0xddadffec, 0xcc3902ad, 0x3fee843d, 0xef10f82f, 0x1cc77ebf,
+    0x0d5383fe, 0xfe84056e, 0xa9430d2b, 0x5a948bbb, 0x4b0076fa,
+    0xb8d7f06a, 0x68298c78, 0x9bfe0ae8, 0x8a6af7a9, 0x79bd7139,
+    0x25e4e723, 0xd63361b3, 0xc7a79cf2, 0x34701a62, 0xe48e6670,
+    0x1759e0e0, 0x06cd1da1, 0xf51a9b31, 0xa2dd9374, 0x510a15e4,
+    0x409ee8a5, 0xb3496e35, 0x63b71227, 0x906094b7, 0x81f469f6,
+    0x7223ef66, 0x394745c2, 0xca90c352, 0xdb043e13, 0x28d3b883,
+    0xf82dc491, 0x0bfa4201, 0x1a6ebf40, 0xe9b939d0, 0xbe7e3195,
+    0x4da9b705, 0x5c3d4a44, 0xafeaccd4, 0x7f14b0c6, 0x8cc33656,
+    0x9d57cb17, 0x6e804d87, 0x32d9db9d, 0xc10e5d0d, 0xd09aa04c,
+    0x234d26dc, 0xf3b35ace, 0x0064dc5e, 0x11f0211f, 0xe227a78f,
+    0xb5e0afca, 0x4637295a, 0x57a3d41b, 0xa474528b, 0x748a2e99,
+    0x875da809, 0x96c95548, 0x651ed3d8, 0x5cf4f2f8, 0xaf237468,
+    0xbeb78929, 0x4d600fb9, 0x9d9e73ab, 0x6e49f53b, 0x7fdd087a,
+    0x8c0a8eea, 0xdbcd86af, 0x281a003f, 0x398efd7e, 0xca597bee,
+    0x1aa707fc, 0xe970816c, 0xf8e47c2d, 0x0b33fabd, 0x576a6ca7,
+    0xa4bdea37, 0xb5291776, 0x46fe91e6, 0x9600edf4, 0x65d76b64,
+    0x74439625, 0x879410b5, 0xd05318f0, 0x23849e60, 0x32106321,
+    0xc1c7e5b1, 0x113999a3, 0xe2ee1f33, 0xf37ae272, 0x00ad64e2,
+    0x4bc9ce46, 0xb81e48d6, 0xa98ab597, 0x5a5d3307, 0x8aa34f15,
+    0x7974c985, 0x68e034c4, 0x9b37b254, 0xccf0ba11, 0x3f273c81,
+    0x2eb3c1c0, 0xdd644750, 0x0d9a3b42, 0xfe4dbdd2, 0xefd94093,
+    0x1c0ec603, 0x40575019, 0xb380d689, 0xa2142bc8, 0x51c3ad58,
+    0x813dd14a, 0x72ea57da, 0x637eaa9b, 0x90a92c0b, 0xc76e244e,
+    0x34b9a2de, 0x252d5f9f, 0xd6fad90f, 0x0604a51d, 0xf5d3238d,
+    0xe447decc, 0x1790585c, 0x728e8b84, 0x81590d14, 0x90cdf055,
+    0x631a76c5, 0xb3e40ad7, 0x40338c47, 0x51a77106, 0xa270f796,
+    0xf5b7ffd3, 0x06607943, 0x17f48402, 0xe4230292, 0x34dd7e80,
+    0xc70af810, 0xd69e0551, 0x254983c1, 0x791015db, 0x8ac7934b,
+    0x9b536e0a, 0x6884e89a, 0xb87a9488, 0x4bad1218, 0x5a39ef59,
+    0xa9ee69c9, 0xfe29618c, 0x0dfee71c, 0x1c6a1a5d, 0xefbd9ccd,
+    0x3f43e0df, 0xcc94664f, 0xdd009b0e, 0x2ed71d9e, 0x65b3b73a,
+    0x966431aa, 0x87f0cceb, 0x74274a7b, 0xa4d93669, 0x570eb0f9,
+    0x469a4db8, 0xb54dcb28, 0xe28ac36d, 0x115d45fd, 0x00c9b8bc,
+    0xf31e3e2c, 0x23e0423e, 0xd037c4ae, 0xc1a339ef, 0x3274bf7f,
+    0x6e2d2965, 0x9dfaaff5, 0x8c6e52b4, 0x7fb9d424, 0xaf47a836,
+    0x5c902ea6, 0x4d04d3e7, 0xbed35577, 0xe9145d32, 0x1ac3dba2,
+    0x0b5726e3, 0xf880a073, 0x287edc61, 0xdba95af1, 0xca3da7b0,
+    0x39ea2120},
+   {0x00000000, 0xb9e9e5f0, 0x763fbd11, 0xcfd658e1, 0xec7f7a22,
+    0x55969fd2, 0x9a40c733, 0x23a922c3, 0xdd1282b5, 0x64fb6745,
+    0xab2d3fa4, 0x12c4da54, 0x316df897, 0x88841d67, 0x47524586,
+    0xfebba076, 0xbfc9739b, 0x0620966b, 0xc9f6ce8a, 0x701f2b7a,
+    0x53b609b9, 0xea5fec49, 0x2589b4a8, 0x9c605158, 0x62dbf12e,
+    0xdb3214de, 0x14e44c3f, 0xad0da9cf, 0x8ea48b0c, 0x374d6efc,
+    0xf89b361d, 0x4172d3ed, 0x7a7e91c7, 0xc3977437, 0x0c412cd6,
+    0xb5a8c926, 0x9601ebe5, 0x2fe80e15, 0xe03e56f4, 0x59d7b304,
+    0xa76c1372, 0x1e85f682, 0xd153ae63, 0x68ba4b93, 0x4b136950,
+    0xf2fa8ca0, 0x3d2cd441, 0x84c531b1, 0xc5b7e25c, 0x7c5e07ac,
+    0xb3885f4d, 0x0a61babd, 0x29c8987e, 0x90217d8e, 0x5ff7256f,
+    0xe61ec09f, 0x18a560e9, 0xa14c8519, 0x6e9addf8, 0xd7733808,
+    0xf4da1acb, 0x4d33ff3b, 0x82e5a7da, 0x3b0c422a, 0xf4fd238e,
+    0x4d14c67e, 0x82c29e9f, 0x3b2b7b6f, 0x188259ac, 0xa16bbc5c,
+    0x6ebde4bd, 0xd754014d, 0x29efa13b, 0x900644cb, 0x5fd01c2a,
+    0xe639f9da, 0xc590db19, 0x7c793ee9, 0xb3af6608, 0x0a4683f8,
+    0x4b345015, 0xf2ddb5e5, 0x3d0bed04, 0x84e208f4, 0xa74b2a37,
+    0x1ea2cfc7, 0xd1749726, 0x689d72d6, 0x9626d2a0, 0x2fcf3750,
+    0xe0196fb1, 0x59f08a41, 0x7a59a882, 0xc3b04d72, 0x0c661593,
+    0xb58ff063, 0x8e83b249, 0x376a57b9, 0xf8bc0f58, 0x4155eaa8,
+    0x62fcc86b, 0xdb152d9b, 0x14c3757a, 0xad2a908a, 0x539130fc,
+    0xea78d50c, 0x25ae8ded, 0x9c47681d, 0xbfee4ade, 0x0607af2e,
+    0xc9d1f7cf, 0x7038123f, 0x314ac1d2, 0x88a32422, 0x47757cc3,
+    0xfe9c9933, 0xdd35bbf0, 0x64dc5e00, 0xab0a06e1, 0x12e3e311,
+    0xec584367, 0x55b1a697, 0x9a67fe76, 0x238e1b86, 0x00273945,
+    0xb9cedcb5, 0x76188454, 0xcff161a4, 0xec1631ed, 0x55ffd41d,
+    0x9a298cfc, 0x23c0690c, 0x00694bcf, 0xb980ae3f, 0x7656f6de,
+    0xcfbf132e, 0x3104b358, 0x88ed56a8, 0x473b0e49, 0xfed2ebb9,
+    0xdd7bc97a, 0x64922c8a, 0xab44746b, 0x12ad919b, 0x53df4276,
+    0xea36a786, 0x25e0ff67, 0x9c091a97, 0xbfa03854, 0x0649dda4,
+    0xc99f8545, 0x707660b5, 0x8ecdc0c3, 0x37242533, 0xf8f27dd2,
+    0x411b9822, 0x62b2bae1, 0xdb5b5f11, 0x148d07f0, 0xad64e200,
+    0x9668a02a, 0x2f8145da, 0xe0571d3b, 0x59bef8cb, 0x7a17da08,
+    0xc3fe3ff8, 0x0c286719, 0xb5c182e9, 0x4b7a229f, 0xf293c76f,
+    0x3d459f8e, 0x84ac7a7e, 0xa70558bd, 0x1eecbd4d, 0xd13ae5ac,
+    0x68d3005c, 0x29a1d3b1, 0x90483641, 0x5f9e6ea0, 0xe6778b50,
+    0xc5dea993, 0x7c374c63, 0xb3e11482, 0x0a08f172, 0xf4b35104,
+    0x4d5ab4f4, 0x828cec15, 0x3b6509e5, 0x18cc2b26, 0xa125ced6,
+    0x6ef39637, 0xd71a73c7, 0x18eb1263, 0xa102f793, 0x6ed4af72,
+    0xd73d4a82, 0xf4946841, 0x4d7d8db1, 0x82abd550, 0x3b4230a0,
+    0xc5f990d6, 0x7c107526, 0xb3c62dc7, 0x0a2fc837, 0x2986eaf4,
+    0x906f0f04, 0x5fb957e5, 0xe650b215, 0xa72261f8, 0x1ecb8408,
+    0xd11ddce9, 0x68f43919, 0x4b5d1bda, 0xf2b4fe2a, 0x3d62a6cb,
+    0x848b433b, 0x7a30e34d, 0xc3d906bd, 0x0c0f5e5c, 0xb5e6bbac,
+    0x964f996f, 0x2fa67c9f, 0xe070247e, 0x5999c18e, 0x629583a4,
+    0xdb7c6654, 0x14aa3eb5, 0xad43db45, 0x8eeaf986, 0x37031c76,
+    0xf8d54497, 0x413ca167, 0xbf870111, 0x066ee4e1, 0xc9b8bc00,
+    0x705159f0, 0x53f87b33, 0xea119ec3, 0x25c7c622, 0x9c2e23d2,
+    0xdd5cf03f, 0x64b515cf, 0xab634d2e, 0x128aa8de, 0x31238a1d,
+    0x88ca6fed, 0x471c370c, 0xfef5d2fc, 0x004e728a, 0xb9a7977a,
+    0x7671cf9b, 0xcf982a6b, 0xec3108a8, 0x55d8ed58, 0x9a0eb5b9,
+    0x23e75049}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x0000000000000000, 0xf0e5e9b900000000, 0x11bd3f7600000000,
+    0xe158d6cf00000000, 0x227a7fec00000000, 0xd29f965500000000,
+    0x33c7409a00000000, 0xc322a92300000000, 0xb58212dd00000000,
+    0x4567fb6400000000, 0xa43f2dab00000000, 0x54dac41200000000,
+    0x97f86d3100000000, 0x671d848800000000, 0x8645524700000000,
+    0x76a0bbfe00000000, 0x9b73c9bf00000000, 0x6b96200600000000,
+    0x8acef6c900000000, 0x7a2b1f7000000000, 0xb909b65300000000,
+    0x49ec5fea00000000, 0xa8b4892500000000, 0x5851609c00000000,
+    0x2ef1db6200000000, 0xde1432db00000000, 0x3f4ce41400000000,
+    0xcfa90dad00000000, 0x0c8ba48e00000000, 0xfc6e4d3700000000,
+    0x1d369bf800000000, 0xedd3724100000000, 0xc7917e7a00000000,
+    0x377497c300000000, 0xd62c410c00000000, 0x26c9a8b500000000,
+    0xe5eb019600000000, 0x150ee82f00000000, 0xf4563ee000000000,
+    0x04b3d75900000000, 0x72136ca700000000, 0x82f6851e00000000,
+    0x63ae53d100000000, 0x934bba6800000000, 0x5069134b00000000,
+    0xa08cfaf200000000, 0x41d42c3d00000000, 0xb131c58400000000,
+    0x5ce2b7c500000000, 0xac075e7c00000000, 0x4d5f88b300000000,
+    0xbdba610a00000000, 0x7e98c82900000000, 0x8e7d219000000000,
+    0x6f25f75f00000000, 0x9fc01ee600000000, 0xe960a51800000000,
+    0x19854ca100000000, 0xf8dd9a6e00000000, 0x083873d700000000,
+    0xcb1adaf400000000, 0x3bff334d00000000, 0xdaa7e58200000000,
+    0x2a420c3b00000000, 0x8e23fdf400000000, 0x7ec6144d00000000,
+    0x9f9ec28200000000, 0x6f7b2b3b00000000, 0xac59821800000000,
+    0x5cbc6ba100000000, 0xbde4bd6e00000000, 0x4d0154d700000000,
+    0x3ba1ef2900000000, 0xcb44069000000000, 0x2a1cd05f00000000,
+    0xdaf939e600000000, 0x19db90c500000000, 0xe93e797c00000000,
+    0x0866afb300000000, 0xf883460a00000000, 0x1550344b00000000,
+    0xe5b5ddf200000000, 0x04ed0b3d00000000, 0xf408e28400000000,
+    0x372a4ba700000000, 0xc7cfa21e00000000, 0x269774d100000000,
+    0xd6729d6800000000, 0xa0d2269600000000, 0x5037cf2f00000000,
+    0xb16f19e000000000, 0x418af05900000000, 0x82a8597a00000000,
+    0x724db0c300000000, 0x9315660c00000000, 0x63f08fb500000000,
+    0x49b2838e00000000, 0xb9576a3700000000, 0x580fbcf800000000,
+    0xa8ea554100000000, 0x6bc8fc6200000000, 0x9b2d15db00000000,
+    0x7a75c31400000000, 0x8a902aad00000000, 0xfc30915300000000,
+    0x0cd578ea00000000, 0xed8dae2500000000, 0x1d68479c00000000,
+    0xde4aeebf00000000, 0x2eaf070600000000, 0xcff7d1c900000000,
+    0x3f12387000000000, 0xd2c14a3100000000, 0x2224a38800000000,
+    0xc37c754700000000, 0x33999cfe00000000, 0xf0bb35dd00000000,
+    0x005edc6400000000, 0xe1060aab00000000, 0x11e3e31200000000,
+    0x674358ec00000000, 0x97a6b15500000000, 0x76fe679a00000000,
+    0x861b8e2300000000, 0x4539270000000000, 0xb5dcceb900000000,
+    0x5484187600000000, 0xa461f1cf00000000, 0xed3116ec00000000,
+    0x1dd4ff5500000000, 0xfc8c299a00000000, 0x0c69c02300000000,
+    0xcf4b690000000000, 0x3fae80b900000000, 0xdef6567600000000,
+    0x2e13bfcf00000000, 0x58b3043100000000, 0xa856ed8800000000,
+    0x490e3b4700000000, 0xb9ebd2fe00000000, 0x7ac97bdd00000000,
+    0x8a2c926400000000, 0x6b7444ab00000000, 0x9b91ad1200000000,
+    0x7642df5300000000, 0x86a736ea00000000, 0x67ffe02500000000,
+    0x971a099c00000000, 0x5438a0bf00000000, 0xa4dd490600000000,
+    0x45859fc900000000, 0xb560767000000000, 0xc3c0cd8e00000000,
+    0x3325243700000000, 0xd27df2f800000000, 0x22981b4100000000,
+    0xe1bab26200000000, 0x115f5bdb00000000, 0xf0078d1400000000,
+    0x00e264ad00000000, 0x2aa0689600000000, 0xda45812f00000000,
+    0x3b1d57e000000000, 0xcbf8be5900000000, 0x08da177a00000000,
+    0xf83ffec300000000, 0x1967280c00000000, 0xe982c1b500000000,
+    0x9f227a4b00000000, 0x6fc793f200000000, 0x8e9f453d00000000,
+    0x7e7aac8400000000, 0xbd5805a700000000, 0x4dbdec1e00000000,
+    0xace53ad100000000, 0x5c00d36800000000, 0xb1d3a12900000000,
+    0x4136489000000000, 0xa06e9e5f00000000, 0x508b77e600000000,
+    0x93a9dec500000000, 0x634c377c00000000, 0x8214e1b300000000,
+    0x72f1080a00000000, 0x0451b3f400000000, 0xf4b45a4d00000000,
+    0x15ec8c8200000000, 0xe509653b00000000, 0x262bcc1800000000,
+    0xd6ce25a100000000, 0x3796f36e00000000, 0xc7731ad700000000,
+    0x6312eb1800000000, 0x93f702a100000000, 0x72afd46e00000000,
+    0x824a3dd700000000, 0x416894f400000000, 0xb18d7d4d00000000,
+    0x50d5ab8200000000, 0xa030423b00000000, 0xd690f9c500000000,
+    0x2675107c00000000, 0xc72dc6b300000000, 0x37c82f0a00000000,
+    0xf4ea862900000000, 0x040f6f9000000000, 0xe557b95f00000000,
+    0x15b250e600000000, 0xf86122a700000000, 0x0884cb1e00000000,
+    0xe9dc1dd100000000, 0x1939f46800000000, 0xda1b5d4b00000000,
+    0x2afeb4f200000000, 0xcba6623d00000000, 0x3b438b8400000000,
+    0x4de3307a00000000, 0xbd06d9c300000000, 0x5c5e0f0c00000000,
+    0xacbbe6b500000000, 0x6f994f9600000000, 0x9f7ca62f00000000,
+    0x7e2470e000000000, 0x8ec1995900000000, 0xa483956200000000,
+    0x54667cdb00000000, 0xb53eaa1400000000, 0x45db43ad00000000,
+    0x86f9ea8e00000000, 0x761c033700000000, 0x9744d5f800000000,
+    0x67a13c4100000000, 0x110187bf00000000, 0xe1e46e0600000000,
+    0x00bcb8c900000000, 0xf059517000000000, 0x337bf85300000000,
+    0xc39e11ea00000000, 0x22c6c72500000000, 0xd2232e9c00000000,
+    0x3ff05cdd00000000, 0xcf15b56400000000, 0x2e4d63ab00000000,
+    0xdea88a1200000000, 0x1d8a233100000000, 0xed6fca8800000000,
+    0x0c371c4700000000, 0xfcd2f5fe00000000, 0x8a724e0000000000,
+    0x7a97a7b900000000, 0x9bcf717600000000, 0x6b2a98cf00000000,
+    0xa80831ec00000000, 0x58edd85500000000, 0xb9b50e9a00000000,
+    0x4950e72300000000},
+   {0x0000000000000000, 0x9086d7f300000000, 0xd17b43e200000000,
+    0x41fd941100000000, 0x53816ac100000000, 0xc307bd3200000000,
+    0x82fa292300000000, 0x127cfed000000000, 0x5774398700000000,
+    0xc7f2ee7400000000, 0x860f7a6500000000, 0x1689ad9600000000,
+    0x04f5534600000000, 0x947384b500000000, 0xd58e10a400000000,
+    0x4508c75700000000, 0x5f9e9e0b00000000, 0xcf1849f800000000,
+    0x8ee5dde900000000, 0x1e630a1a00000000, 0x0c1ff4ca00000000,
+    0x9c99233900000000, 0xdd64b72800000000, 0x4de260db00000000,
+    0x08eaa78c00000000, 0x986c707f00000000, 0xd991e46e00000000,
+    0x4917339d00000000, 0x5b6bcd4d00000000, 0xcbed1abe00000000,
+    0x8a108eaf00000000, 0x1a96595c00000000, 0xbe3c3d1700000000,
+    0x2ebaeae400000000, 0x6f477ef500000000, 0xffc1a90600000000,
+    0xedbd57d600000000, 0x7d3b802500000000, 0x3cc6143400000000,
+    0xac40c3c700000000, 0xe948049000000000, 0x79ced36300000000,
+    0x3833477200000000, 0xa8b5908100000000, 0xbac96e5100000000,
+    0x2a4fb9a200000000, 0x6bb22db300000000, 0xfb34fa4000000000,
+    0xe1a2a31c00000000, 0x712474ef00000000, 0x30d9e0fe00000000,
+    0xa05f370d00000000, 0xb223c9dd00000000, 0x22a51e2e00000000,
+    0x63588a3f00000000, 0xf3de5dcc00000000, 0xb6d69a9b00000000,
+    0x26504d6800000000, 0x67add97900000000, 0xf72b0e8a00000000,
+    0xe557f05a00000000, 0x75d127a900000000, 0x342cb3b800000000,
+    0xa4aa644b00000000, 0x7c797a2e00000000, 0xecffaddd00000000,
+    0xad0239cc00000000, 0x3d84ee3f00000000, 0x2ff810ef00000000,
+    0xbf7ec71c00000000, 0xfe83530d00000000, 0x6e0584fe00000000,
+    0x2b0d43a900000000, 0xbb8b945a00000000, 0xfa76004b00000000,
+    0x6af0d7b800000000, 0x788c296800000000, 0xe80afe9b00000000,
+    0xa9f76a8a00000000, 0x3971bd7900000000, 0x23e7e42500000000,
+    0xb36133d600000000, 0xf29ca7c700000000, 0x621a703400000000,
+    0x70668ee400000000, 0xe0e0591700000000, 0xa11dcd0600000000,
+    0x319b1af500000000, 0x7493dda200000000, 0xe4150a5100000000,
+    0xa5e89e4000000000, 0x356e49b300000000, 0x2712b76300000000,
+    0xb794609000000000, 0xf669f48100000000, 0x66ef237200000000,
+    0xc245473900000000, 0x52c390ca00000000, 0x133e04db00000000,
+    0x83b8d32800000000, 0x91c42df800000000, 0x0142fa0b00000000,
+    0x40bf6e1a00000000, 0xd039b9e900000000, 0x95317ebe00000000,
+    0x05b7a94d00000000, 0x444a3d5c00000000, 0xd4cceaaf00000000,
+    0xc6b0147f00000000, 0x5636c38c00000000, 0x17cb579d00000000,
+    0x874d806e00000000, 0x9ddbd93200000000, 0x0d5d0ec100000000,
+    0x4ca09ad000000000, 0xdc264d2300000000, 0xce5ab3f300000000,
+    0x5edc640000000000, 0x1f21f01100000000, 0x8fa727e200000000,
+    0xcaafe0b500000000, 0x5a29374600000000, 0x1bd4a35700000000,
+    0x8b5274a400000000, 0x992e8a7400000000, 0x09a85d8700000000,
+    0x4855c99600000000, 0xd8d31e6500000000, 0xf8f2f45c00000000,
+    0x687423af00000000, 0x2989b7be00000000, 0xb90f604d00000000,
+    0xab739e9d00000000, 0x3bf5496e00000000, 0x7a08dd7f00000000,
+    0xea8e0a8c00000000, 0xaf86cddb00000000, 0x3f001a2800000000,
+    0x7efd8e3900000000, 0xee7b59ca00000000, 0xfc07a71a00000000,
+    0x6c8170e900000000, 0x2d7ce4f800000000, 0xbdfa330b00000000,
+    0xa76c6a5700000000, 0x37eabda400000000, 0x761729b500000000,
+    0xe691fe4600000000, 0xf4ed009600000000, 0x646bd76500000000,
+    0x2596437400000000, 0xb510948700000000, 0xf01853d000000000,
+    0x609e842300000000, 0x2163103200000000, 0xb1e5c7c100000000,
+    0xa399391100000000, 0x331feee200000000, 0x72e27af300000000,
+    0xe264ad0000000000, 0x46cec94b00000000, 0xd6481eb800000000,
+    0x97b58aa900000000, 0x07335d5a00000000, 0x154fa38a00000000,
+    0x85c9747900000000, 0xc434e06800000000, 0x54b2379b00000000,
+    0x11baf0cc00000000, 0x813c273f00000000, 0xc0c1b32e00000000,
+    0x504764dd00000000, 0x423b9a0d00000000, 0xd2bd4dfe00000000,
+    0x9340d9ef00000000, 0x03c60e1c00000000, 0x1950574000000000,
+    0x89d680b300000000, 0xc82b14a200000000, 0x58adc35100000000,
+    0x4ad13d8100000000, 0xda57ea7200000000, 0x9baa7e6300000000,
+    0x0b2ca99000000000, 0x4e246ec700000000, 0xdea2b93400000000,
+    0x9f5f2d2500000000, 0x0fd9fad600000000, 0x1da5040600000000,
+    0x8d23d3f500000000, 0xccde47e400000000, 0x5c58901700000000,
+    0x848b8e7200000000, 0x140d598100000000, 0x55f0cd9000000000,
+    0xc5761a6300000000, 0xd70ae4b300000000, 0x478c334000000000,
+    0x0671a75100000000, 0x96f770a200000000, 0xd3ffb7f500000000,
+    0x4379600600000000, 0x0284f41700000000, 0x920223e400000000,
+    0x807edd3400000000, 0x10f80ac700000000, 0x51059ed600000000,
+    0xc183492500000000, 0xdb15107900000000, 0x4b93c78a00000000,
+    0x0a6e539b00000000, 0x9ae8846800000000, 0x88947ab800000000,
+    0x1812ad4b00000000, 0x59ef395a00000000, 0xc969eea900000000,
+    0x8c6129fe00000000, 0x1ce7fe0d00000000, 0x5d1a6a1c00000000,
+    0xcd9cbdef00000000, 0xdfe0433f00000000, 0x4f6694cc00000000,
+    0x0e9b00dd00000000, 0x9e1dd72e00000000, 0x3ab7b36500000000,
+    0xaa31649600000000, 0xebccf08700000000, 0x7b4a277400000000,
+    0x6936d9a400000000, 0xf9b00e5700000000, 0xb84d9a4600000000,
+    0x28cb4db500000000, 0x6dc38ae200000000, 0xfd455d1100000000,
+    0xbcb8c90000000000, 0x2c3e1ef300000000, 0x3e42e02300000000,
+    0xaec437d000000000, 0xef39a3c100000000, 0x7fbf743200000000,
+    0x65292d6e00000000, 0xf5affa9d00000000, 0xb4526e8c00000000,
+    0x24d4b97f00000000, 0x36a847af00000000, 0xa62e905c00000000,
+    0xe7d3044d00000000, 0x7755d3be00000000, 0x325d14e900000000,
+    0xa2dbc31a00000000, 0xe326570b00000000, 0x73a080f800000000,
+    0x61dc7e2800000000, 0xf15aa9db00000000, 0xb0a73dca00000000,
+    0x2021ea3900000000},
+   {0x0000000000000000, 0x912b5b9200000000, 0xd3215a2100000000,
+    0x420a01b300000000, 0xa643b44200000000, 0x3768efd000000000,
+    0x7562ee6300000000, 0xe449b5f100000000, 0x4c87688500000000,
+    0xddac331700000000, 0x9fa632a400000000, 0x0e8d693600000000,
+    0xeac4dcc700000000, 0x7bef875500000000, 0x39e586e600000000,
+    0xa8cedd7400000000, 0x69783d0f00000000, 0xf853669d00000000,
+    0xba59672e00000000, 0x2b723cbc00000000, 0xcf3b894d00000000,
+    0x5e10d2df00000000, 0x1c1ad36c00000000, 0x8d3188fe00000000,
+    0x25ff558a00000000, 0xb4d40e1800000000, 0xf6de0fab00000000,
+    0x67f5543900000000, 0x83bce1c800000000, 0x1297ba5a00000000,
+    0x509dbbe900000000, 0xc1b6e07b00000000, 0xd2f07a1e00000000,
+    0x43db218c00000000, 0x01d1203f00000000, 0x90fa7bad00000000,
+    0x74b3ce5c00000000, 0xe59895ce00000000, 0xa792947d00000000,
+    0x36b9cfef00000000, 0x9e77129b00000000, 0x0f5c490900000000,
+    0x4d5648ba00000000, 0xdc7d132800000000, 0x3834a6d900000000,
+    0xa91ffd4b00000000, 0xeb15fcf800000000, 0x7a3ea76a00000000,
+    0xbb88471100000000, 0x2aa31c8300000000, 0x68a91d3000000000,
+    0xf98246a200000000, 0x1dcbf35300000000, 0x8ce0a8c100000000,
+    0xceeaa97200000000, 0x5fc1f2e000000000, 0xf70f2f9400000000,
+    0x6624740600000000, 0x242e75b500000000, 0xb5052e2700000000,
+    0x514c9bd600000000, 0xc067c04400000000, 0x826dc1f700000000,
+    0x13469a6500000000, 0xa4e1f53c00000000, 0x35caaeae00000000,
+    0x77c0af1d00000000, 0xe6ebf48f00000000, 0x02a2417e00000000,
+    0x93891aec00000000, 0xd1831b5f00000000, 0x40a840cd00000000,
+    0xe8669db900000000, 0x794dc62b00000000, 0x3b47c79800000000,
+    0xaa6c9c0a00000000, 0x4e2529fb00000000, 0xdf0e726900000000,
+    0x9d0473da00000000, 0x0c2f284800000000, 0xcd99c83300000000,
+    0x5cb293a100000000, 0x1eb8921200000000, 0x8f93c98000000000,
+    0x6bda7c7100000000, 0xfaf127e300000000, 0xb8fb265000000000,
+    0x29d07dc200000000, 0x811ea0b600000000, 0x1035fb2400000000,
+    0x523ffa9700000000, 0xc314a10500000000, 0x275d14f400000000,
+    0xb6764f6600000000, 0xf47c4ed500000000, 0x6557154700000000,
+    0x76118f2200000000, 0xe73ad4b000000000, 0xa530d50300000000,
+    0x341b8e9100000000, 0xd0523b6000000000, 0x417960f200000000,
+    0x0373614100000000, 0x92583ad300000000, 0x3a96e7a700000000,
+    0xabbdbc3500000000, 0xe9b7bd8600000000, 0x789ce61400000000,
+    0x9cd553e500000000, 0x0dfe087700000000, 0x4ff409c400000000,
+    0xdedf525600000000, 0x1f69b22d00000000, 0x8e42e9bf00000000,
+    0xcc48e80c00000000, 0x5d63b39e00000000, 0xb92a066f00000000,
+    0x28015dfd00000000, 0x6a0b5c4e00000000, 0xfb2007dc00000000,
+    0x53eedaa800000000, 0xc2c5813a00000000, 0x80cf808900000000,
+    0x11e4db1b00000000, 0xf5ad6eea00000000, 0x6486357800000000,
+    0x268c34cb00000000, 0xb7a76f5900000000, 0x48c3eb7900000000,
+    0xd9e8b0eb00000000, 0x9be2b15800000000, 0x0ac9eaca00000000,
+    0xee805f3b00000000, 0x7fab04a900000000, 0x3da1051a00000000,
+    0xac8a5e8800000000, 0x044483fc00000000, 0x956fd86e00000000,
+    0xd765d9dd00000000, 0x464e824f00000000, 0xa20737be00000000,
+    0x332c6c2c00000000, 0x71266d9f00000000, 0xe00d360d00000000,
+    0x21bbd67600000000, 0xb0908de400000000, 0xf29a8c5700000000,
+    0x63b1d7c500000000, 0x87f8623400000000, 0x16d339a600000000,
+    0x54d9381500000000, 0xc5f2638700000000, 0x6d3cbef300000000,
+    0xfc17e56100000000, 0xbe1de4d200000000, 0x2f36bf4000000000,
+    0xcb7f0ab100000000, 0x5a54512300000000, 0x185e509000000000,
+    0x89750b0200000000, 0x9a33916700000000, 0x0b18caf500000000,
+    0x4912cb4600000000, 0xd83990d400000000, 0x3c70252500000000,
+    0xad5b7eb700000000, 0xef517f0400000000, 0x7e7a249600000000,
+    0xd6b4f9e200000000, 0x479fa27000000000, 0x0595a3c300000000,
+    0x94bef85100000000, 0x70f74da000000000, 0xe1dc163200000000,
+    0xa3d6178100000000, 0x32fd4c1300000000, 0xf34bac6800000000,
+    0x6260f7fa00000000, 0x206af64900000000, 0xb141addb00000000,
+    0x5508182a00000000, 0xc42343b800000000, 0x8629420b00000000,
+    0x1702199900000000, 0xbfccc4ed00000000, 0x2ee79f7f00000000,
+    0x6ced9ecc00000000, 0xfdc6c55e00000000, 0x198f70af00000000,
+    0x88a42b3d00000000, 0xcaae2a8e00000000, 0x5b85711c00000000,
+    0xec221e4500000000, 0x7d0945d700000000, 0x3f03446400000000,
+    0xae281ff600000000, 0x4a61aa0700000000, 0xdb4af19500000000,
+    0x9940f02600000000, 0x086babb400000000, 0xa0a576c000000000,
+    0x318e2d5200000000, 0x73842ce100000000, 0xe2af777300000000,
+    0x06e6c28200000000, 0x97cd991000000000, 0xd5c798a300000000,
+    0x44ecc33100000000, 0x855a234a00000000, 0x147178d800000000,
+    0x567b796b00000000, 0xc75022f900000000, 0x2319970800000000,
+    0xb232cc9a00000000, 0xf038cd2900000000, 0x611396bb00000000,
+    0xc9dd4bcf00000000, 0x58f6105d00000000, 0x1afc11ee00000000,
+    0x8bd74a7c00000000, 0x6f9eff8d00000000, 0xfeb5a41f00000000,
+    0xbcbfa5ac00000000, 0x2d94fe3e00000000, 0x3ed2645b00000000,
+    0xaff93fc900000000, 0xedf33e7a00000000, 0x7cd865e800000000,
+    0x9891d01900000000, 0x09ba8b8b00000000, 0x4bb08a3800000000,
+    0xda9bd1aa00000000, 0x72550cde00000000, 0xe37e574c00000000,
+    0xa17456ff00000000, 0x305f0d6d00000000, 0xd416b89c00000000,
+    0x453de30e00000000, 0x0737e2bd00000000, 0x961cb92f00000000,
+    0x57aa595400000000, 0xc68102c600000000, 0x848b037500000000,
+    0x15a058e700000000, 0xf1e9ed1600000000, 0x60c2b68400000000,
+    0x22c8b73700000000, 0xb3e3eca500000000, 0x1b2d31d100000000,
+    0x8a066a4300000000, 0xc80c6bf000000000, 0x5927306200000000,
+    0xbd6e859300000000, 0x2c45de0100000000, 0x6e4fdfb200000000,
+    0xff64842000000000},
+   {0x0000000000000000, 0x3f24516000000000, 0x7e48a2c000000000,
+    0x416cf3a000000000, 0x0de6a88400000000, 0x32c2f9e400000000,
+    0x73ae0a4400000000, 0x4c8a5b2400000000, 0xebbabd0c00000000,
+    0xd49eec6c00000000, 0x95f21fcc00000000, 0xaad64eac00000000,
+    0xe65c158800000000, 0xd97844e800000000, 0x9814b74800000000,
+    0xa730e62800000000, 0xd6757b1900000000, 0xe9512a7900000000,
+    0xa83dd9d900000000, 0x971988b900000000, 0xdb93d39d00000000,
+    0xe4b782fd00000000, 0xa5db715d00000000, 0x9aff203d00000000,
+    0x3dcfc61500000000, 0x02eb977500000000, 0x438764d500000000,
+    0x7ca335b500000000, 0x30296e9100000000, 0x0f0d3ff100000000,
+    0x4e61cc5100000000, 0x71459d3100000000, 0xacebf63200000000,
+    0x93cfa75200000000, 0xd2a354f200000000, 0xed87059200000000,
+    0xa10d5eb600000000, 0x9e290fd600000000, 0xdf45fc7600000000,
+    0xe061ad1600000000, 0x47514b3e00000000, 0x78751a5e00000000,
+    0x3919e9fe00000000, 0x063db89e00000000, 0x4ab7e3ba00000000,
+    0x7593b2da00000000, 0x34ff417a00000000, 0x0bdb101a00000000,
+    0x7a9e8d2b00000000, 0x45badc4b00000000, 0x04d62feb00000000,
+    0x3bf27e8b00000000, 0x777825af00000000, 0x485c74cf00000000,
+    0x0930876f00000000, 0x3614d60f00000000, 0x9124302700000000,
+    0xae00614700000000, 0xef6c92e700000000, 0xd048c38700000000,
+    0x9cc298a300000000, 0xa3e6c9c300000000, 0xe28a3a6300000000,
+    0xddae6b0300000000, 0x58d7ed6500000000, 0x67f3bc0500000000,
+    0x269f4fa500000000, 0x19bb1ec500000000, 0x553145e100000000,
+    0x6a15148100000000, 0x2b79e72100000000, 0x145db64100000000,
+    0xb36d506900000000, 0x8c49010900000000, 0xcd25f2a900000000,
+    0xf201a3c900000000, 0xbe8bf8ed00000000, 0x81afa98d00000000,
+    0xc0c35a2d00000000, 0xffe70b4d00000000, 0x8ea2967c00000000,
+    0xb186c71c00000000, 0xf0ea34bc00000000, 0xcfce65dc00000000,
+    0x83443ef800000000, 0xbc606f9800000000, 0xfd0c9c3800000000,
+    0xc228cd5800000000, 0x65182b7000000000, 0x5a3c7a1000000000,
+    0x1b5089b000000000, 0x2474d8d000000000, 0x68fe83f400000000,
+    0x57dad29400000000, 0x16b6213400000000, 0x2992705400000000,
+    0xf43c1b5700000000, 0xcb184a3700000000, 0x8a74b99700000000,
+    0xb550e8f700000000, 0xf9dab3d300000000, 0xc6fee2b300000000,
+    0x8792111300000000, 0xb8b6407300000000, 0x1f86a65b00000000,
+    0x20a2f73b00000000, 0x61ce049b00000000, 0x5eea55fb00000000,
+    0x12600edf00000000, 0x2d445fbf00000000, 0x6c28ac1f00000000,
+    0x530cfd7f00000000, 0x2249604e00000000, 0x1d6d312e00000000,
+    0x5c01c28e00000000, 0x632593ee00000000, 0x2fafc8ca00000000,
+    0x108b99aa00000000, 0x51e76a0a00000000, 0x6ec33b6a00000000,
+    0xc9f3dd4200000000, 0xf6d78c2200000000, 0xb7bb7f8200000000,
+    0x889f2ee200000000, 0xc41575c600000000, 0xfb3124a600000000,
+    0xba5dd70600000000, 0x8579866600000000, 0xb0aedbcb00000000,
+    0x8f8a8aab00000000, 0xcee6790b00000000, 0xf1c2286b00000000,
+    0xbd48734f00000000, 0x826c222f00000000, 0xc300d18f00000000,
+    0xfc2480ef00000000, 0x5b1466c700000000, 0x643037a700000000,
+    0x255cc40700000000, 0x1a78956700000000, 0x56f2ce4300000000,
+    0x69d69f2300000000, 0x28ba6c8300000000, 0x179e3de300000000,
+    0x66dba0d200000000, 0x59fff1b200000000, 0x1893021200000000,
+    0x27b7537200000000, 0x6b3d085600000000, 0x5419593600000000,
+    0x1575aa9600000000, 0x2a51fbf600000000, 0x8d611dde00000000,
+    0xb2454cbe00000000, 0xf329bf1e00000000, 0xcc0dee7e00000000,
+    0x8087b55a00000000, 0xbfa3e43a00000000, 0xfecf179a00000000,
+    0xc1eb46fa00000000, 0x1c452df900000000, 0x23617c9900000000,
+    0x620d8f3900000000, 0x5d29de5900000000, 0x11a3857d00000000,
+    0x2e87d41d00000000, 0x6feb27bd00000000, 0x50cf76dd00000000,
+    0xf7ff90f500000000, 0xc8dbc19500000000, 0x89b7323500000000,
+    0xb693635500000000, 0xfa19387100000000, 0xc53d691100000000,
+    0x84519ab100000000, 0xbb75cbd100000000, 0xca3056e000000000,
+    0xf514078000000000, 0xb478f42000000000, 0x8b5ca54000000000,
+    0xc7d6fe6400000000, 0xf8f2af0400000000, 0xb99e5ca400000000,
+    0x86ba0dc400000000, 0x218aebec00000000, 0x1eaeba8c00000000,
+    0x5fc2492c00000000, 0x60e6184c00000000, 0x2c6c436800000000,
+    0x1348120800000000, 0x5224e1a800000000, 0x6d00b0c800000000,
+    0xe87936ae00000000, 0xd75d67ce00000000, 0x9631946e00000000,
+    0xa915c50e00000000, 0xe59f9e2a00000000, 0xdabbcf4a00000000,
+    0x9bd73cea00000000, 0xa4f36d8a00000000, 0x03c38ba200000000,
+    0x3ce7dac200000000, 0x7d8b296200000000, 0x42af780200000000,
+    0x0e25232600000000, 0x3101724600000000, 0x706d81e600000000,
+    0x4f49d08600000000, 0x3e0c4db700000000, 0x01281cd700000000,
+    0x4044ef7700000000, 0x7f60be1700000000, 0x33eae53300000000,
+    0x0cceb45300000000, 0x4da247f300000000, 0x7286169300000000,
+    0xd5b6f0bb00000000, 0xea92a1db00000000, 0xabfe527b00000000,
+    0x94da031b00000000, 0xd850583f00000000, 0xe774095f00000000,
+    0xa618faff00000000, 0x993cab9f00000000, 0x4492c09c00000000,
+    0x7bb691fc00000000, 0x3ada625c00000000, 0x05fe333c00000000,
+    0x4974681800000000, 0x7650397800000000, 0x373ccad800000000,
+    0x08189bb800000000, 0xaf287d9000000000, 0x900c2cf000000000,
+    0xd160df5000000000, 0xee448e3000000000, 0xa2ced51400000000,
+    0x9dea847400000000, 0xdc8677d400000000, 0xe3a226b400000000,
+    0x92e7bb8500000000, 0xadc3eae500000000, 0xecaf194500000000,
+    0xd38b482500000000, 0x9f01130100000000, 0xa025426100000000,
+    0xe149b1c100000000, 0xde6de0a100000000, 0x795d068900000000,
+    0x467957e900000000, 0x0715a44900000000, 0x3831f52900000000,
+    0x74bbae0d00000000, 0x4b9fff6d00000000, 0x0af30ccd00000000,
+    0x35d75dad00000000},
+   {0x0000000000000000, 0xb124906e00000000, 0x624920dd00000000,
+    0xd36db0b300000000, 0x35e4acbf00000000, 0x84c03cd100000000,
+    0x57ad8c6200000000, 0xe6891c0c00000000, 0x9bbeb57a00000000,
+    0x2a9a251400000000, 0xf9f795a700000000, 0x48d305c900000000,
+    0xae5a19c500000000, 0x1f7e89ab00000000, 0xcc13391800000000,
+    0x7d37a97600000000, 0x367d6bf500000000, 0x8759fb9b00000000,
+    0x54344b2800000000, 0xe510db4600000000, 0x0399c74a00000000,
+    0xb2bd572400000000, 0x61d0e79700000000, 0xd0f477f900000000,
+    0xadc3de8f00000000, 0x1ce74ee100000000, 0xcf8afe5200000000,
+    0x7eae6e3c00000000, 0x9827723000000000, 0x2903e25e00000000,
+    0xfa6e52ed00000000, 0x4b4ac28300000000, 0x9d8c3aef00000000,
+    0x2ca8aa8100000000, 0xffc51a3200000000, 0x4ee18a5c00000000,
+    0xa868965000000000, 0x194c063e00000000, 0xca21b68d00000000,
+    0x7b0526e300000000, 0x06328f9500000000, 0xb7161ffb00000000,
+    0x647baf4800000000, 0xd55f3f2600000000, 0x33d6232a00000000,
+    0x82f2b34400000000, 0x519f03f700000000, 0xe0bb939900000000,
+    0xabf1511a00000000, 0x1ad5c17400000000, 0xc9b871c700000000,
+    0x789ce1a900000000, 0x9e15fda500000000, 0x2f316dcb00000000,
+    0xfc5cdd7800000000, 0x4d784d1600000000, 0x304fe46000000000,
+    0x816b740e00000000, 0x5206c4bd00000000, 0xe32254d300000000,
+    0x05ab48df00000000, 0xb48fd8b100000000, 0x67e2680200000000,
+    0xd6c6f86c00000000, 0xcb6f99db00000000, 0x7a4b09b500000000,
+    0xa926b90600000000, 0x1802296800000000, 0xfe8b356400000000,
+    0x4fafa50a00000000, 0x9cc215b900000000, 0x2de685d700000000,
+    0x50d12ca100000000, 0xe1f5bccf00000000, 0x32980c7c00000000,
+    0x83bc9c1200000000, 0x6535801e00000000, 0xd411107000000000,
+    0x077ca0c300000000, 0xb65830ad00000000, 0xfd12f22e00000000,
+    0x4c36624000000000, 0x9f5bd2f300000000, 0x2e7f429d00000000,
+    0xc8f65e9100000000, 0x79d2ceff00000000, 0xaabf7e4c00000000,
+    0x1b9bee2200000000, 0x66ac475400000000, 0xd788d73a00000000,
+    0x04e5678900000000, 0xb5c1f7e700000000, 0x5348ebeb00000000,
+    0xe26c7b8500000000, 0x3101cb3600000000, 0x80255b5800000000,
+    0x56e3a33400000000, 0xe7c7335a00000000, 0x34aa83e900000000,
+    0x858e138700000000, 0x63070f8b00000000, 0xd2239fe500000000,
+    0x014e2f5600000000, 0xb06abf3800000000, 0xcd5d164e00000000,
+    0x7c79862000000000, 0xaf14369300000000, 0x1e30a6fd00000000,
+    0xf8b9baf100000000, 0x499d2a9f00000000, 0x9af09a2c00000000,
+    0x2bd40a4200000000, 0x609ec8c100000000, 0xd1ba58af00000000,
+    0x02d7e81c00000000, 0xb3f3787200000000, 0x557a647e00000000,
+    0xe45ef41000000000, 0x373344a300000000, 0x8617d4cd00000000,
+    0xfb207dbb00000000, 0x4a04edd500000000, 0x99695d6600000000,
+    0x284dcd0800000000, 0xcec4d10400000000, 0x7fe0416a00000000,
+    0xac8df1d900000000, 0x1da961b700000000, 0x67a9deb200000000,
+    0xd68d4edc00000000, 0x05e0fe6f00000000, 0xb4c46e0100000000,
+    0x524d720d00000000, 0xe369e26300000000, 0x300452d000000000,
+    0x8120c2be00000000, 0xfc176bc800000000, 0x4d33fba600000000,
+    0x9e5e4b1500000000, 0x2f7adb7b00000000, 0xc9f3c77700000000,
+    0x78d7571900000000, 0xabbae7aa00000000, 0x1a9e77c400000000,
+    0x51d4b54700000000, 0xe0f0252900000000, 0x339d959a00000000,
+    0x82b905f400000000, 0x643019f800000000, 0xd514899600000000,
+    0x0679392500000000, 0xb75da94b00000000, 0xca6a003d00000000,
+    0x7b4e905300000000, 0xa82320e000000000, 0x1907b08e00000000,
+    0xff8eac8200000000, 0x4eaa3cec00000000, 0x9dc78c5f00000000,
+    0x2ce31c3100000000, 0xfa25e45d00000000, 0x4b01743300000000,
+    0x986cc48000000000, 0x294854ee00000000, 0xcfc148e200000000,
+    0x7ee5d88c00000000, 0xad88683f00000000, 0x1cacf85100000000,
+    0x619b512700000000, 0xd0bfc14900000000, 0x03d271fa00000000,
+    0xb2f6e19400000000, 0x547ffd9800000000, 0xe55b6df600000000,
+    0x3636dd4500000000, 0x87124d2b00000000, 0xcc588fa800000000,
+    0x7d7c1fc600000000, 0xae11af7500000000, 0x1f353f1b00000000,
+    0xf9bc231700000000, 0x4898b37900000000, 0x9bf503ca00000000,
+    0x2ad193a400000000, 0x57e63ad200000000, 0xe6c2aabc00000000,
+    0x35af1a0f00000000, 0x848b8a6100000000, 0x6202966d00000000,
+    0xd326060300000000, 0x004bb6b000000000, 0xb16f26de00000000,
+    0xacc6476900000000, 0x1de2d70700000000, 0xce8f67b400000000,
+    0x7fabf7da00000000, 0x9922ebd600000000, 0x28067bb800000000,
+    0xfb6bcb0b00000000, 0x4a4f5b6500000000, 0x3778f21300000000,
+    0x865c627d00000000, 0x5531d2ce00000000, 0xe41542a000000000,
+    0x029c5eac00000000, 0xb3b8cec200000000, 0x60d57e7100000000,
+    0xd1f1ee1f00000000, 0x9abb2c9c00000000, 0x2b9fbcf200000000,
+    0xf8f20c4100000000, 0x49d69c2f00000000, 0xaf5f802300000000,
+    0x1e7b104d00000000, 0xcd16a0fe00000000, 0x7c32309000000000,
+    0x010599e600000000, 0xb021098800000000, 0x634cb93b00000000,
+    0xd268295500000000, 0x34e1355900000000, 0x85c5a53700000000,
+    0x56a8158400000000, 0xe78c85ea00000000, 0x314a7d8600000000,
+    0x806eede800000000, 0x53035d5b00000000, 0xe227cd3500000000,
+    0x04aed13900000000, 0xb58a415700000000, 0x66e7f1e400000000,
+    0xd7c3618a00000000, 0xaaf4c8fc00000000, 0x1bd0589200000000,
+    0xc8bde82100000000, 0x7999784f00000000, 0x9f10644300000000,
+    0x2e34f42d00000000, 0xfd59449e00000000, 0x4c7dd4f000000000,
+    0x0737167300000000, 0xb613861d00000000, 0x657e36ae00000000,
+    0xd45aa6c000000000, 0x32d3bacc00000000, 0x83f72aa200000000,
+    0x509a9a1100000000, 0xe1be0a7f00000000, 0x9c89a30900000000,
+    0x2dad336700000000, 0xfec083d400000000, 0x4fe413ba00000000,
+    0xa96d0fb600000000, 0x18499fd800000000, 0xcb242f6b00000000,
+    0x7a00bf0500000000},
+   {0x0000000000000000, 0xee61104000000000, 0xdcc3208000000000,
+    0x32a230c000000000, 0x49f1ad0500000000, 0xa790bd4500000000,
+    0x95328d8500000000, 0x7b539dc500000000, 0x92e25b0b00000000,
+    0x7c834b4b00000000, 0x4e217b8b00000000, 0xa0406bcb00000000,
+    0xdb13f60e00000000, 0x3572e64e00000000, 0x07d0d68e00000000,
+    0xe9b1c6ce00000000, 0x24c5b71600000000, 0xcaa4a75600000000,
+    0xf806979600000000, 0x166787d600000000, 0x6d341a1300000000,
+    0x83550a5300000000, 0xb1f73a9300000000, 0x5f962ad300000000,
+    0xb627ec1d00000000, 0x5846fc5d00000000, 0x6ae4cc9d00000000,
+    0x8485dcdd00000000, 0xffd6411800000000, 0x11b7515800000000,
+    0x2315619800000000, 0xcd7471d800000000, 0x488a6f2d00000000,
+    0xa6eb7f6d00000000, 0x94494fad00000000, 0x7a285fed00000000,
+    0x017bc22800000000, 0xef1ad26800000000, 0xddb8e2a800000000,
+    0x33d9f2e800000000, 0xda68342600000000, 0x3409246600000000,
+    0x06ab14a600000000, 0xe8ca04e600000000, 0x9399992300000000,
+    0x7df8896300000000, 0x4f5ab9a300000000, 0xa13ba9e300000000,
+    0x6c4fd83b00000000, 0x822ec87b00000000, 0xb08cf8bb00000000,
+    0x5eede8fb00000000, 0x25be753e00000000, 0xcbdf657e00000000,
+    0xf97d55be00000000, 0x171c45fe00000000, 0xfead833000000000,
+    0x10cc937000000000, 0x226ea3b000000000, 0xcc0fb3f000000000,
+    0xb75c2e3500000000, 0x593d3e7500000000, 0x6b9f0eb500000000,
+    0x85fe1ef500000000, 0x9014df5a00000000, 0x7e75cf1a00000000,
+    0x4cd7ffda00000000, 0xa2b6ef9a00000000, 0xd9e5725f00000000,
+    0x3784621f00000000, 0x052652df00000000, 0xeb47429f00000000,
+    0x02f6845100000000, 0xec97941100000000, 0xde35a4d100000000,
+    0x3054b49100000000, 0x4b07295400000000, 0xa566391400000000,
+    0x97c409d400000000, 0x79a5199400000000, 0xb4d1684c00000000,
+    0x5ab0780c00000000, 0x681248cc00000000, 0x8673588c00000000,
+    0xfd20c54900000000, 0x1341d50900000000, 0x21e3e5c900000000,
+    0xcf82f58900000000, 0x2633334700000000, 0xc852230700000000,
+    0xfaf013c700000000, 0x1491038700000000, 0x6fc29e4200000000,
+    0x81a38e0200000000, 0xb301bec200000000, 0x5d60ae8200000000,
+    0xd89eb07700000000, 0x36ffa03700000000, 0x045d90f700000000,
+    0xea3c80b700000000, 0x916f1d7200000000, 0x7f0e0d3200000000,
+    0x4dac3df200000000, 0xa3cd2db200000000, 0x4a7ceb7c00000000,
+    0xa41dfb3c00000000, 0x96bfcbfc00000000, 0x78dedbbc00000000,
+    0x038d467900000000, 0xedec563900000000, 0xdf4e66f900000000,
+    0x312f76b900000000, 0xfc5b076100000000, 0x123a172100000000,
+    0x209827e100000000, 0xcef937a100000000, 0xb5aaaa6400000000,
+    0x5bcbba2400000000, 0x69698ae400000000, 0x87089aa400000000,
+    0x6eb95c6a00000000, 0x80d84c2a00000000, 0xb27a7cea00000000,
+    0x5c1b6caa00000000, 0x2748f16f00000000, 0xc929e12f00000000,
+    0xfb8bd1ef00000000, 0x15eac1af00000000, 0x2029beb500000000,
+    0xce48aef500000000, 0xfcea9e3500000000, 0x128b8e7500000000,
+    0x69d813b000000000, 0x87b903f000000000, 0xb51b333000000000,
+    0x5b7a237000000000, 0xb2cbe5be00000000, 0x5caaf5fe00000000,
+    0x6e08c53e00000000, 0x8069d57e00000000, 0xfb3a48bb00000000,
+    0x155b58fb00000000, 0x27f9683b00000000, 0xc998787b00000000,
+    0x04ec09a300000000, 0xea8d19e300000000, 0xd82f292300000000,
+    0x364e396300000000, 0x4d1da4a600000000, 0xa37cb4e600000000,
+    0x91de842600000000, 0x7fbf946600000000, 0x960e52a800000000,
+    0x786f42e800000000, 0x4acd722800000000, 0xa4ac626800000000,
+    0xdfffffad00000000, 0x319eefed00000000, 0x033cdf2d00000000,
+    0xed5dcf6d00000000, 0x68a3d19800000000, 0x86c2c1d800000000,
+    0xb460f11800000000, 0x5a01e15800000000, 0x21527c9d00000000,
+    0xcf336cdd00000000, 0xfd915c1d00000000, 0x13f04c5d00000000,
+    0xfa418a9300000000, 0x14209ad300000000, 0x2682aa1300000000,
+    0xc8e3ba5300000000, 0xb3b0279600000000, 0x5dd137d600000000,
+    0x6f73071600000000, 0x8112175600000000, 0x4c66668e00000000,
+    0xa20776ce00000000, 0x90a5460e00000000, 0x7ec4564e00000000,
+    0x0597cb8b00000000, 0xebf6dbcb00000000, 0xd954eb0b00000000,
+    0x3735fb4b00000000, 0xde843d8500000000, 0x30e52dc500000000,
+    0x02471d0500000000, 0xec260d4500000000, 0x9775908000000000,
+    0x791480c000000000, 0x4bb6b00000000000, 0xa5d7a04000000000,
+    0xb03d61ef00000000, 0x5e5c71af00000000, 0x6cfe416f00000000,
+    0x829f512f00000000, 0xf9ccccea00000000, 0x17addcaa00000000,
+    0x250fec6a00000000, 0xcb6efc2a00000000, 0x22df3ae400000000,
+    0xccbe2aa400000000, 0xfe1c1a6400000000, 0x107d0a2400000000,
+    0x6b2e97e100000000, 0x854f87a100000000, 0xb7edb76100000000,
+    0x598ca72100000000, 0x94f8d6f900000000, 0x7a99c6b900000000,
+    0x483bf67900000000, 0xa65ae63900000000, 0xdd097bfc00000000,
+    0x33686bbc00000000, 0x01ca5b7c00000000, 0xefab4b3c00000000,
+    0x061a8df200000000, 0xe87b9db200000000, 0xdad9ad7200000000,
+    0x34b8bd3200000000, 0x4feb20f700000000, 0xa18a30b700000000,
+    0x9328007700000000, 0x7d49103700000000, 0xf8b70ec200000000,
+    0x16d61e8200000000, 0x24742e4200000000, 0xca153e0200000000,
+    0xb146a3c700000000, 0x5f27b38700000000, 0x6d85834700000000,
+    0x83e4930700000000, 0x6a5555c900000000, 0x8434458900000000,
+    0xb696754900000000, 0x58f7650900000000, 0x23a4f8cc00000000,
+    0xcdc5e88c00000000, 0xff67d84c00000000, 0x1106c80c00000000,
+    0xdc72b9d400000000, 0x3213a99400000000, 0x00b1995400000000,
+    0xeed0891400000000, 0x958314d100000000, 0x7be2049100000000,
+    0x4940345100000000, 0xa721241100000000, 0x4e90e2df00000000,
+    0xa0f1f29f00000000, 0x9253c25f00000000, 0x7c32d21f00000000,
+    0x07614fda00000000, 0xe9005f9a00000000, 0xdba26f5a00000000,
+    0x35c37f1a00000000},
+   {0x0000000000000000, 0x5c07084f00000000, 0xb80e109e00000000,
+    0xe40918d100000000, 0x816bcc3900000000, 0xdd6cc47600000000,
+    0x3965dca700000000, 0x6562d4e800000000, 0x02d7987300000000,
+    0x5ed0903c00000000, 0xbad988ed00000000, 0xe6de80a200000000,
+    0x83bc544a00000000, 0xdfbb5c0500000000, 0x3bb244d400000000,
+    0x67b54c9b00000000, 0x04ae31e700000000, 0x58a939a800000000,
+    0xbca0217900000000, 0xe0a7293600000000, 0x85c5fdde00000000,
+    0xd9c2f59100000000, 0x3dcbed4000000000, 0x61cce50f00000000,
+    0x0679a99400000000, 0x5a7ea1db00000000, 0xbe77b90a00000000,
+    0xe270b14500000000, 0x871265ad00000000, 0xdb156de200000000,
+    0x3f1c753300000000, 0x631b7d7c00000000, 0xf92a8fcb00000000,
+    0xa52d878400000000, 0x41249f5500000000, 0x1d23971a00000000,
+    0x784143f200000000, 0x24464bbd00000000, 0xc04f536c00000000,
+    0x9c485b2300000000, 0xfbfd17b800000000, 0xa7fa1ff700000000,
+    0x43f3072600000000, 0x1ff40f6900000000, 0x7a96db8100000000,
+    0x2691d3ce00000000, 0xc298cb1f00000000, 0x9e9fc35000000000,
+    0xfd84be2c00000000, 0xa183b66300000000, 0x458aaeb200000000,
+    0x198da6fd00000000, 0x7cef721500000000, 0x20e87a5a00000000,
+    0xc4e1628b00000000, 0x98e66ac400000000, 0xff53265f00000000,
+    0xa3542e1000000000, 0x475d36c100000000, 0x1b5a3e8e00000000,
+    0x7e38ea6600000000, 0x223fe22900000000, 0xc636faf800000000,
+    0x9a31f2b700000000, 0x0323f29200000000, 0x5f24fadd00000000,
+    0xbb2de20c00000000, 0xe72aea4300000000, 0x82483eab00000000,
+    0xde4f36e400000000, 0x3a462e3500000000, 0x6641267a00000000,
+    0x01f46ae100000000, 0x5df362ae00000000, 0xb9fa7a7f00000000,
+    0xe5fd723000000000, 0x809fa6d800000000, 0xdc98ae9700000000,
+    0x3891b64600000000, 0x6496be0900000000, 0x078dc37500000000,
+    0x5b8acb3a00000000, 0xbf83d3eb00000000, 0xe384dba400000000,
+    0x86e60f4c00000000, 0xdae1070300000000, 0x3ee81fd200000000,
+    0x62ef179d00000000, 0x055a5b0600000000, 0x595d534900000000,
+    0xbd544b9800000000, 0xe15343d700000000, 0x8431973f00000000,
+    0xd8369f7000000000, 0x3c3f87a100000000, 0x60388fee00000000,
+    0xfa097d5900000000, 0xa60e751600000000, 0x42076dc700000000,
+    0x1e00658800000000, 0x7b62b16000000000, 0x2765b92f00000000,
+    0xc36ca1fe00000000, 0x9f6ba9b100000000, 0xf8dee52a00000000,
+    0xa4d9ed6500000000, 0x40d0f5b400000000, 0x1cd7fdfb00000000,
+    0x79b5291300000000, 0x25b2215c00000000, 0xc1bb398d00000000,
+    0x9dbc31c200000000, 0xfea74cbe00000000, 0xa2a044f100000000,
+    0x46a95c2000000000, 0x1aae546f00000000, 0x7fcc808700000000,
+    0x23cb88c800000000, 0xc7c2901900000000, 0x9bc5985600000000,
+    0xfc70d4cd00000000, 0xa077dc8200000000, 0x447ec45300000000,
+    0x1879cc1c00000000, 0x7d1b18f400000000, 0x211c10bb00000000,
+    0xc515086a00000000, 0x9912002500000000, 0xf730082000000000,
+    0xab37006f00000000, 0x4f3e18be00000000, 0x133910f100000000,
+    0x765bc41900000000, 0x2a5ccc5600000000, 0xce55d48700000000,
+    0x9252dcc800000000, 0xf5e7905300000000, 0xa9e0981c00000000,
+    0x4de980cd00000000, 0x11ee888200000000, 0x748c5c6a00000000,
+    0x288b542500000000, 0xcc824cf400000000, 0x908544bb00000000,
+    0xf39e39c700000000, 0xaf99318800000000, 0x4b90295900000000,
+    0x1797211600000000, 0x72f5f5fe00000000, 0x2ef2fdb100000000,
+    0xcafbe56000000000, 0x96fced2f00000000, 0xf149a1b400000000,
+    0xad4ea9fb00000000, 0x4947b12a00000000, 0x1540b96500000000,
+    0x70226d8d00000000, 0x2c2565c200000000, 0xc82c7d1300000000,
+    0x942b755c00000000, 0x0e1a87eb00000000, 0x521d8fa400000000,
+    0xb614977500000000, 0xea139f3a00000000, 0x8f714bd200000000,
+    0xd376439d00000000, 0x377f5b4c00000000, 0x6b78530300000000,
+    0x0ccd1f9800000000, 0x50ca17d700000000, 0xb4c30f0600000000,
+    0xe8c4074900000000, 0x8da6d3a100000000, 0xd1a1dbee00000000,
+    0x35a8c33f00000000, 0x69afcb7000000000, 0x0ab4b60c00000000,
+    0x56b3be4300000000, 0xb2baa69200000000, 0xeebdaedd00000000,
+    0x8bdf7a3500000000, 0xd7d8727a00000000, 0x33d16aab00000000,
+    0x6fd662e400000000, 0x08632e7f00000000, 0x5464263000000000,
+    0xb06d3ee100000000, 0xec6a36ae00000000, 0x8908e24600000000,
+    0xd50fea0900000000, 0x3106f2d800000000, 0x6d01fa9700000000,
+    0xf413fab200000000, 0xa814f2fd00000000, 0x4c1dea2c00000000,
+    0x101ae26300000000, 0x7578368b00000000, 0x297f3ec400000000,
+    0xcd76261500000000, 0x91712e5a00000000, 0xf6c462c100000000,
+    0xaac36a8e00000000, 0x4eca725f00000000, 0x12cd7a1000000000,
+    0x77afaef800000000, 0x2ba8a6b700000000, 0xcfa1be6600000000,
+    0x93a6b62900000000, 0xf0bdcb5500000000, 0xacbac31a00000000,
+    0x48b3dbcb00000000, 0x14b4d38400000000, 0x71d6076c00000000,
+    0x2dd10f2300000000, 0xc9d817f200000000, 0x95df1fbd00000000,
+    0xf26a532600000000, 0xae6d5b6900000000, 0x4a6443b800000000,
+    0x16634bf700000000, 0x73019f1f00000000, 0x2f06975000000000,
+    0xcb0f8f8100000000, 0x970887ce00000000, 0x0d39757900000000,
+    0x513e7d3600000000, 0xb53765e700000000, 0xe9306da800000000,
+    0x8c52b94000000000, 0xd055b10f00000000, 0x345ca9de00000000,
+    0x685ba19100000000, 0x0feeed0a00000000, 0x53e9e54500000000,
+    0xb7e0fd9400000000, 0xebe7f5db00000000, 0x8e85213300000000,
+    0xd282297c00000000, 0x368b31ad00000000, 0x6a8c39e200000000,
+    0x0997449e00000000, 0x55904cd100000000, 0xb199540000000000,
+    0xed9e5c4f00000000, 0x88fc88a700000000, 0xd4fb80e800000000,
+    0x30f2983900000000, 0x6cf5907600000000, 0x0b40dced00000000,
+    0x5747d4a200000000, 0xb34ecc7300000000, 0xef49c43c00000000,
+    0x8a2b10d400000000, 0xd62c189b00000000, 0x3225004a00000000,
+    0x6e22080500000000},
+   {0x0000000000000000, 0x041d291c00000000, 0x083a523800000000,
+    0x0c277b2400000000, 0x1074a47000000000, 0x14698d6c00000000,
+    0x184ef64800000000, 0x1c53df5400000000, 0x20e848e100000000,
+    0x24f561fd00000000, 0x28d21ad900000000, 0x2ccf33c500000000,
+    0x309cec9100000000, 0x3481c58d00000000, 0x38a6bea900000000,
+    0x3cbb97b500000000, 0xb1a67dc700000000, 0xb5bb54db00000000,
+    0xb99c2fff00000000, 0xbd8106e300000000, 0xa1d2d9b700000000,
+    0xa5cff0ab00000000, 0xa9e88b8f00000000, 0xadf5a29300000000,
+    0x914e352600000000, 0x95531c3a00000000, 0x9974671e00000000,
+    0x9d694e0200000000, 0x813a915600000000, 0x8527b84a00000000,
+    0x8900c36e00000000, 0x8d1dea7200000000, 0x933b178b00000000,
+    0x97263e9700000000, 0x9b0145b300000000, 0x9f1c6caf00000000,
+    0x834fb3fb00000000, 0x87529ae700000000, 0x8b75e1c300000000,
+    0x8f68c8df00000000, 0xb3d35f6a00000000, 0xb7ce767600000000,
+    0xbbe90d5200000000, 0xbff4244e00000000, 0xa3a7fb1a00000000,
+    0xa7bad20600000000, 0xab9da92200000000, 0xaf80803e00000000,
+    0x229d6a4c00000000, 0x2680435000000000, 0x2aa7387400000000,
+    0x2eba116800000000, 0x32e9ce3c00000000, 0x36f4e72000000000,
+    0x3ad39c0400000000, 0x3eceb51800000000, 0x027522ad00000000,
+    0x06680bb100000000, 0x0a4f709500000000, 0x0e52598900000000,
+    0x120186dd00000000, 0x161cafc100000000, 0x1a3bd4e500000000,
+    0x1e26fdf900000000, 0xd701c21300000000, 0xd31ceb0f00000000,
+    0xdf3b902b00000000, 0xdb26b93700000000, 0xc775666300000000,
+    0xc3684f7f00000000, 0xcf4f345b00000000, 0xcb521d4700000000,
+    0xf7e98af200000000, 0xf3f4a3ee00000000, 0xffd3d8ca00000000,
+    0xfbcef1d600000000, 0xe79d2e8200000000, 0xe380079e00000000,
+    0xefa77cba00000000, 0xebba55a600000000, 0x66a7bfd400000000,
+    0x62ba96c800000000, 0x6e9dedec00000000, 0x6a80c4f000000000,
+    0x76d31ba400000000, 0x72ce32b800000000, 0x7ee9499c00000000,
+    0x7af4608000000000, 0x464ff73500000000, 0x4252de2900000000,
+    0x4e75a50d00000000, 0x4a688c1100000000, 0x563b534500000000,
+    0x52267a5900000000, 0x5e01017d00000000, 0x5a1c286100000000,
+    0x443ad59800000000, 0x4027fc8400000000, 0x4c0087a000000000,
+    0x481daebc00000000, 0x544e71e800000000, 0x505358f400000000,
+    0x5c7423d000000000, 0x58690acc00000000, 0x64d29d7900000000,
+    0x60cfb46500000000, 0x6ce8cf4100000000, 0x68f5e65d00000000,
+    0x74a6390900000000, 0x70bb101500000000, 0x7c9c6b3100000000,
+    0x7881422d00000000, 0xf59ca85f00000000, 0xf181814300000000,
+    0xfda6fa6700000000, 0xf9bbd37b00000000, 0xe5e80c2f00000000,
+    0xe1f5253300000000, 0xedd25e1700000000, 0xe9cf770b00000000,
+    0xd574e0be00000000, 0xd169c9a200000000, 0xdd4eb28600000000,
+    0xd9539b9a00000000, 0xc50044ce00000000, 0xc11d6dd200000000,
+    0xcd3a16f600000000, 0xc9273fea00000000, 0xae03842700000000,
+    0xaa1ead3b00000000, 0xa639d61f00000000, 0xa224ff0300000000,
+    0xbe77205700000000, 0xba6a094b00000000, 0xb64d726f00000000,
+    0xb2505b7300000000, 0x8eebccc600000000, 0x8af6e5da00000000,
+    0x86d19efe00000000, 0x82ccb7e200000000, 0x9e9f68b600000000,
+    0x9a8241aa00000000, 0x96a53a8e00000000, 0x92b8139200000000,
+    0x1fa5f9e000000000, 0x1bb8d0fc00000000, 0x179fabd800000000,
+    0x138282c400000000, 0x0fd15d9000000000, 0x0bcc748c00000000,
+    0x07eb0fa800000000, 0x03f626b400000000, 0x3f4db10100000000,
+    0x3b50981d00000000, 0x3777e33900000000, 0x336aca2500000000,
+    0x2f39157100000000, 0x2b243c6d00000000, 0x2703474900000000,
+    0x231e6e5500000000, 0x3d3893ac00000000, 0x3925bab000000000,
+    0x3502c19400000000, 0x311fe88800000000, 0x2d4c37dc00000000,
+    0x29511ec000000000, 0x257665e400000000, 0x216b4cf800000000,
+    0x1dd0db4d00000000, 0x19cdf25100000000, 0x15ea897500000000,
+    0x11f7a06900000000, 0x0da47f3d00000000, 0x09b9562100000000,
+    0x059e2d0500000000, 0x0183041900000000, 0x8c9eee6b00000000,
+    0x8883c77700000000, 0x84a4bc5300000000, 0x80b9954f00000000,
+    0x9cea4a1b00000000, 0x98f7630700000000, 0x94d0182300000000,
+    0x90cd313f00000000, 0xac76a68a00000000, 0xa86b8f9600000000,
+    0xa44cf4b200000000, 0xa051ddae00000000, 0xbc0202fa00000000,
+    0xb81f2be600000000, 0xb43850c200000000, 0xb02579de00000000,
+    0x7902463400000000, 0x7d1f6f2800000000, 0x7138140c00000000,
+    0x75253d1000000000, 0x6976e24400000000, 0x6d6bcb5800000000,
+    0x614cb07c00000000, 0x6551996000000000, 0x59ea0ed500000000,
+    0x5df727c900000000, 0x51d05ced00000000, 0x55cd75f100000000,
+    0x499eaaa500000000, 0x4d8383b900000000, 0x41a4f89d00000000,
+    0x45b9d18100000000, 0xc8a43bf300000000, 0xccb912ef00000000,
+    0xc09e69cb00000000, 0xc48340d700000000, 0xd8d09f8300000000,
+    0xdccdb69f00000000, 0xd0eacdbb00000000, 0xd4f7e4a700000000,
+    0xe84c731200000000, 0xec515a0e00000000, 0xe076212a00000000,
+    0xe46b083600000000, 0xf838d76200000000, 0xfc25fe7e00000000,
+    0xf002855a00000000, 0xf41fac4600000000, 0xea3951bf00000000,
+    0xee2478a300000000, 0xe203038700000000, 0xe61e2a9b00000000,
+    0xfa4df5cf00000000, 0xfe50dcd300000000, 0xf277a7f700000000,
+    0xf66a8eeb00000000, 0xcad1195e00000000, 0xcecc304200000000,
+    0xc2eb4b6600000000, 0xc6f6627a00000000, 0xdaa5bd2e00000000,
+    0xdeb8943200000000, 0xd29fef1600000000, 0xd682c60a00000000,
+    0x5b9f2c7800000000, 0x5f82056400000000, 0x53a57e4000000000,
+    0x57b8575c00000000, 0x4beb880800000000, 0x4ff6a11400000000,
+    0x43d1da3000000000, 0x47ccf32c00000000, 0x7b77649900000000,
+    0x7f6a4d8500000000, 0x734d36a100000000, 0x77501fbd00000000,
+    0x6b03c0e900000000, 0x6f1ee9f500000000, 0x633992d100000000,
+    0x6724bbcd00000000}};
+
+#else /* W == 4 */
+
+static const uint32_t crc32c_braid_table[][256] = {
+   {0x00000000, 0xba4fc28e, 0x7173f3ed, 0xcb3c3163, 0xe2e7e7da,
+    0x58a82554, 0x93941437, 0x29dbd6b9, 0xc023b945, 0x7a6c7bcb,
+    0xb1504aa8, 0x0b1f8826, 0x22c45e9f, 0x988b9c11, 0x53b7ad72,
+    0xe9f86ffc, 0x85ab047b, 0x3fe4c6f5, 0xf4d8f796, 0x4e973518,
+    0x674ce3a1, 0xdd03212f, 0x163f104c, 0xac70d2c2, 0x4588bd3e,
+    0xffc77fb0, 0x34fb4ed3, 0x8eb48c5d, 0xa76f5ae4, 0x1d20986a,
+    0xd61ca909, 0x6c536b87, 0x0eba7e07, 0xb4f5bc89, 0x7fc98dea,
+    0xc5864f64, 0xec5d99dd, 0x56125b53, 0x9d2e6a30, 0x2761a8be,
+    0xce99c742, 0x74d605cc, 0xbfea34af, 0x05a5f621, 0x2c7e2098,
+    0x9631e216, 0x5d0dd375, 0xe74211fb, 0x8b117a7c, 0x315eb8f2,
+    0xfa628991, 0x402d4b1f, 0x69f69da6, 0xd3b95f28, 0x18856e4b,
+    0xa2caacc5, 0x4b32c339, 0xf17d01b7, 0x3a4130d4, 0x800ef25a,
+    0xa9d524e3, 0x139ae66d, 0xd8a6d70e, 0x62e91580, 0x1d74fc0e,
+    0xa73b3e80, 0x6c070fe3, 0xd648cd6d, 0xff931bd4, 0x45dcd95a,
+    0x8ee0e839, 0x34af2ab7, 0xdd57454b, 0x671887c5, 0xac24b6a6,
+    0x166b7428, 0x3fb0a291, 0x85ff601f, 0x4ec3517c, 0xf48c93f2,
+    0x98dff875, 0x22903afb, 0xe9ac0b98, 0x53e3c916, 0x7a381faf,
+    0xc077dd21, 0x0b4bec42, 0xb1042ecc, 0x58fc4130, 0xe2b383be,
+    0x298fb2dd, 0x93c07053, 0xba1ba6ea, 0x00546464, 0xcb685507,
+    0x71279789, 0x13ce8209, 0xa9814087, 0x62bd71e4, 0xd8f2b36a,
+    0xf12965d3, 0x4b66a75d, 0x805a963e, 0x3a1554b0, 0xd3ed3b4c,
+    0x69a2f9c2, 0xa29ec8a1, 0x18d10a2f, 0x310adc96, 0x8b451e18,
+    0x40792f7b, 0xfa36edf5, 0x96658672, 0x2c2a44fc, 0xe716759f,
+    0x5d59b711, 0x748261a8, 0xcecda326, 0x05f19245, 0xbfbe50cb,
+    0x56463f37, 0xec09fdb9, 0x2735ccda, 0x9d7a0e54, 0xb4a1d8ed,
+    0x0eee1a63, 0xc5d22b00, 0x7f9de98e, 0x3ae9f81c, 0x80a63a92,
+    0x4b9a0bf1, 0xf1d5c97f, 0xd80e1fc6, 0x6241dd48, 0xa97dec2b,
+    0x13322ea5, 0xfaca4159, 0x408583d7, 0x8bb9b2b4, 0x31f6703a,
+    0x182da683, 0xa262640d, 0x695e556e, 0xd31197e0, 0xbf42fc67,
+    0x050d3ee9, 0xce310f8a, 0x747ecd04, 0x5da51bbd, 0xe7ead933,
+    0x2cd6e850, 0x96992ade, 0x7f614522, 0xc52e87ac, 0x0e12b6cf,
+    0xb45d7441, 0x9d86a2f8, 0x27c96076, 0xecf55115, 0x56ba939b,
+    0x3453861b, 0x8e1c4495, 0x452075f6, 0xff6fb778, 0xd6b461c1,
+    0x6cfba34f, 0xa7c7922c, 0x1d8850a2, 0xf4703f5e, 0x4e3ffdd0,
+    0x8503ccb3, 0x3f4c0e3d, 0x1697d884, 0xacd81a0a, 0x67e42b69,
+    0xddabe9e7, 0xb1f88260, 0x0bb740ee, 0xc08b718d, 0x7ac4b303,
+    0x531f65ba, 0xe950a734, 0x226c9657, 0x982354d9, 0x71db3b25,
+    0xcb94f9ab, 0x00a8c8c8, 0xbae70a46, 0x933cdcff, 0x29731e71,
+    0xe24f2f12, 0x5800ed9c, 0x279d0412, 0x9dd2c69c, 0x56eef7ff,
+    0xeca13571, 0xc57ae3c8, 0x7f352146, 0xb4091025, 0x0e46d2ab,
+    0xe7bebd57, 0x5df17fd9, 0x96cd4eba, 0x2c828c34, 0x05595a8d,
+    0xbf169803, 0x742aa960, 0xce656bee, 0xa2360069, 0x1879c2e7,
+    0xd345f384, 0x690a310a, 0x40d1e7b3, 0xfa9e253d, 0x31a2145e,
+    0x8bedd6d0, 0x6215b92c, 0xd85a7ba2, 0x13664ac1, 0xa929884f,
+    0x80f25ef6, 0x3abd9c78, 0xf181ad1b, 0x4bce6f95, 0x29277a15,
+    0x9368b89b, 0x585489f8, 0xe21b4b76, 0xcbc09dcf, 0x718f5f41,
+    0xbab36e22, 0x00fcacac, 0xe904c350, 0x534b01de, 0x987730bd,
+    0x2238f233, 0x0be3248a, 0xb1ace604, 0x7a90d767, 0xc0df15e9,
+    0xac8c7e6e, 0x16c3bce0, 0xddff8d83, 0x67b04f0d, 0x4e6b99b4,
+    0xf4245b3a, 0x3f186a59, 0x8557a8d7, 0x6cafc72b, 0xd6e005a5,
+    0x1ddc34c6, 0xa793f648, 0x8e4820f1, 0x3407e27f, 0xff3bd31c,
+    0x45741192},
+   {0x00000000, 0x75d3f038, 0xeba7e070, 0x9e741048, 0xd2a3b611,
+    0xa7704629, 0x39045661, 0x4cd7a659, 0xa0ab1ad3, 0xd578eaeb,
+    0x4b0cfaa3, 0x3edf0a9b, 0x7208acc2, 0x07db5cfa, 0x99af4cb2,
+    0xec7cbc8a, 0x44ba4357, 0x3169b36f, 0xaf1da327, 0xdace531f,
+    0x9619f546, 0xe3ca057e, 0x7dbe1536, 0x086de50e, 0xe4115984,
+    0x91c2a9bc, 0x0fb6b9f4, 0x7a6549cc, 0x36b2ef95, 0x43611fad,
+    0xdd150fe5, 0xa8c6ffdd, 0x897486ae, 0xfca77696, 0x62d366de,
+    0x170096e6, 0x5bd730bf, 0x2e04c087, 0xb070d0cf, 0xc5a320f7,
+    0x29df9c7d, 0x5c0c6c45, 0xc2787c0d, 0xb7ab8c35, 0xfb7c2a6c,
+    0x8eafda54, 0x10dbca1c, 0x65083a24, 0xcdcec5f9, 0xb81d35c1,
+    0x26692589, 0x53bad5b1, 0x1f6d73e8, 0x6abe83d0, 0xf4ca9398,
+    0x811963a0, 0x6d65df2a, 0x18b62f12, 0x86c23f5a, 0xf311cf62,
+    0xbfc6693b, 0xca159903, 0x5461894b, 0x21b27973, 0x17057bad,
+    0x62d68b95, 0xfca29bdd, 0x89716be5, 0xc5a6cdbc, 0xb0753d84,
+    0x2e012dcc, 0x5bd2ddf4, 0xb7ae617e, 0xc27d9146, 0x5c09810e,
+    0x29da7136, 0x650dd76f, 0x10de2757, 0x8eaa371f, 0xfb79c727,
+    0x53bf38fa, 0x266cc8c2, 0xb818d88a, 0xcdcb28b2, 0x811c8eeb,
+    0xf4cf7ed3, 0x6abb6e9b, 0x1f689ea3, 0xf3142229, 0x86c7d211,
+    0x18b3c259, 0x6d603261, 0x21b79438, 0x54646400, 0xca107448,
+    0xbfc38470, 0x9e71fd03, 0xeba20d3b, 0x75d61d73, 0x0005ed4b,
+    0x4cd24b12, 0x3901bb2a, 0xa775ab62, 0xd2a65b5a, 0x3edae7d0,
+    0x4b0917e8, 0xd57d07a0, 0xa0aef798, 0xec7951c1, 0x99aaa1f9,
+    0x07deb1b1, 0x720d4189, 0xdacbbe54, 0xaf184e6c, 0x316c5e24,
+    0x44bfae1c, 0x08680845, 0x7dbbf87d, 0xe3cfe835, 0x961c180d,
+    0x7a60a487, 0x0fb354bf, 0x91c744f7, 0xe414b4cf, 0xa8c31296,
+    0xdd10e2ae, 0x4364f2e6, 0x36b702de, 0x2e0af75a, 0x5bd90762,
+    0xc5ad172a, 0xb07ee712, 0xfca9414b, 0x897ab173, 0x170ea13b,
+    0x62dd5103, 0x8ea1ed89, 0xfb721db1, 0x65060df9, 0x10d5fdc1,
+    0x5c025b98, 0x29d1aba0, 0xb7a5bbe8, 0xc2764bd0, 0x6ab0b40d,
+    0x1f634435, 0x8117547d, 0xf4c4a445, 0xb813021c, 0xcdc0f224,
+    0x53b4e26c, 0x26671254, 0xca1baede, 0xbfc85ee6, 0x21bc4eae,
+    0x546fbe96, 0x18b818cf, 0x6d6be8f7, 0xf31ff8bf, 0x86cc0887,
+    0xa77e71f4, 0xd2ad81cc, 0x4cd99184, 0x390a61bc, 0x75ddc7e5,
+    0x000e37dd, 0x9e7a2795, 0xeba9d7ad, 0x07d56b27, 0x72069b1f,
+    0xec728b57, 0x99a17b6f, 0xd576dd36, 0xa0a52d0e, 0x3ed13d46,
+    0x4b02cd7e, 0xe3c432a3, 0x9617c29b, 0x0863d2d3, 0x7db022eb,
+    0x316784b2, 0x44b4748a, 0xdac064c2, 0xaf1394fa, 0x436f2870,
+    0x36bcd848, 0xa8c8c800, 0xdd1b3838, 0x91cc9e61, 0xe41f6e59,
+    0x7a6b7e11, 0x0fb88e29, 0x390f8cf7, 0x4cdc7ccf, 0xd2a86c87,
+    0xa77b9cbf, 0xebac3ae6, 0x9e7fcade, 0x000bda96, 0x75d82aae,
+    0x99a49624, 0xec77661c, 0x72037654, 0x07d0866c, 0x4b072035,
+    0x3ed4d00d, 0xa0a0c045, 0xd573307d, 0x7db5cfa0, 0x08663f98,
+    0x96122fd0, 0xe3c1dfe8, 0xaf1679b1, 0xdac58989, 0x44b199c1,
+    0x316269f9, 0xdd1ed573, 0xa8cd254b, 0x36b93503, 0x436ac53b,
+    0x0fbd6362, 0x7a6e935a, 0xe41a8312, 0x91c9732a, 0xb07b0a59,
+    0xc5a8fa61, 0x5bdcea29, 0x2e0f1a11, 0x62d8bc48, 0x170b4c70,
+    0x897f5c38, 0xfcacac00, 0x10d0108a, 0x6503e0b2, 0xfb77f0fa,
+    0x8ea400c2, 0xc273a69b, 0xb7a056a3, 0x29d446eb, 0x5c07b6d3,
+    0xf4c1490e, 0x8112b936, 0x1f66a97e, 0x6ab55946, 0x2662ff1f,
+    0x53b10f27, 0xcdc51f6f, 0xb816ef57, 0x546a53dd, 0x21b9a3e5,
+    0xbfcdb3ad, 0xca1e4395, 0x86c9e5cc, 0xf31a15f4, 0x6d6e05bc,
+    0x18bdf584},
+   {0x00000000, 0x5c15eeb4, 0xb82bdd68, 0xe43e33dc, 0x75bbcc21,
+    0x29ae2295, 0xcd901149, 0x9185fffd, 0xeb779842, 0xb76276f6,
+    0x535c452a, 0x0f49ab9e, 0x9ecc5463, 0xc2d9bad7, 0x26e7890b,
+    0x7af267bf, 0xd3034675, 0x8f16a8c1, 0x6b289b1d, 0x373d75a9,
+    0xa6b88a54, 0xfaad64e0, 0x1e93573c, 0x4286b988, 0x3874de37,
+    0x64613083, 0x805f035f, 0xdc4aedeb, 0x4dcf1216, 0x11dafca2,
+    0xf5e4cf7e, 0xa9f121ca, 0xa3eafa1b, 0xffff14af, 0x1bc12773,
+    0x47d4c9c7, 0xd651363a, 0x8a44d88e, 0x6e7aeb52, 0x326f05e6,
+    0x489d6259, 0x14888ced, 0xf0b6bf31, 0xaca35185, 0x3d26ae78,
+    0x613340cc, 0x850d7310, 0xd9189da4, 0x70e9bc6e, 0x2cfc52da,
+    0xc8c26106, 0x94d78fb2, 0x0552704f, 0x59479efb, 0xbd79ad27,
+    0xe16c4393, 0x9b9e242c, 0xc78bca98, 0x23b5f944, 0x7fa017f0,
+    0xee25e80d, 0xb23006b9, 0x560e3565, 0x0a1bdbd1, 0x423982c7,
+    0x1e2c6c73, 0xfa125faf, 0xa607b11b, 0x37824ee6, 0x6b97a052,
+    0x8fa9938e, 0xd3bc7d3a, 0xa94e1a85, 0xf55bf431, 0x1165c7ed,
+    0x4d702959, 0xdcf5d6a4, 0x80e03810, 0x64de0bcc, 0x38cbe578,
+    0x913ac4b2, 0xcd2f2a06, 0x291119da, 0x7504f76e, 0xe4810893,
+    0xb894e627, 0x5caad5fb, 0x00bf3b4f, 0x7a4d5cf0, 0x2658b244,
+    0xc2668198, 0x9e736f2c, 0x0ff690d1, 0x53e37e65, 0xb7dd4db9,
+    0xebc8a30d, 0xe1d378dc, 0xbdc69668, 0x59f8a5b4, 0x05ed4b00,
+    0x9468b4fd, 0xc87d5a49, 0x2c436995, 0x70568721, 0x0aa4e09e,
+    0x56b10e2a, 0xb28f3df6, 0xee9ad342, 0x7f1f2cbf, 0x230ac20b,
+    0xc734f1d7, 0x9b211f63, 0x32d03ea9, 0x6ec5d01d, 0x8afbe3c1,
+    0xd6ee0d75, 0x476bf288, 0x1b7e1c3c, 0xff402fe0, 0xa355c154,
+    0xd9a7a6eb, 0x85b2485f, 0x618c7b83, 0x3d999537, 0xac1c6aca,
+    0xf009847e, 0x1437b7a2, 0x48225916, 0x8473058e, 0xd866eb3a,
+    0x3c58d8e6, 0x604d3652, 0xf1c8c9af, 0xaddd271b, 0x49e314c7,
+    0x15f6fa73, 0x6f049dcc, 0x33117378, 0xd72f40a4, 0x8b3aae10,
+    0x1abf51ed, 0x46aabf59, 0xa2948c85, 0xfe816231, 0x577043fb,
+    0x0b65ad4f, 0xef5b9e93, 0xb34e7027, 0x22cb8fda, 0x7ede616e,
+    0x9ae052b2, 0xc6f5bc06, 0xbc07dbb9, 0xe012350d, 0x042c06d1,
+    0x5839e865, 0xc9bc1798, 0x95a9f92c, 0x7197caf0, 0x2d822444,
+    0x2799ff95, 0x7b8c1121, 0x9fb222fd, 0xc3a7cc49, 0x522233b4,
+    0x0e37dd00, 0xea09eedc, 0xb61c0068, 0xccee67d7, 0x90fb8963,
+    0x74c5babf, 0x28d0540b, 0xb955abf6, 0xe5404542, 0x017e769e,
+    0x5d6b982a, 0xf49ab9e0, 0xa88f5754, 0x4cb16488, 0x10a48a3c,
+    0x812175c1, 0xdd349b75, 0x390aa8a9, 0x651f461d, 0x1fed21a2,
+    0x43f8cf16, 0xa7c6fcca, 0xfbd3127e, 0x6a56ed83, 0x36430337,
+    0xd27d30eb, 0x8e68de5f, 0xc64a8749, 0x9a5f69fd, 0x7e615a21,
+    0x2274b495, 0xb3f14b68, 0xefe4a5dc, 0x0bda9600, 0x57cf78b4,
+    0x2d3d1f0b, 0x7128f1bf, 0x9516c263, 0xc9032cd7, 0x5886d32a,
+    0x04933d9e, 0xe0ad0e42, 0xbcb8e0f6, 0x1549c13c, 0x495c2f88,
+    0xad621c54, 0xf177f2e0, 0x60f20d1d, 0x3ce7e3a9, 0xd8d9d075,
+    0x84cc3ec1, 0xfe3e597e, 0xa22bb7ca, 0x46158416, 0x1a006aa2,
+    0x8b85955f, 0xd7907beb, 0x33ae4837, 0x6fbba683, 0x65a07d52,
+    0x39b593e6, 0xdd8ba03a, 0x819e4e8e, 0x101bb173, 0x4c0e5fc7,
+    0xa8306c1b, 0xf42582af, 0x8ed7e510, 0xd2c20ba4, 0x36fc3878,
+    0x6ae9d6cc, 0xfb6c2931, 0xa779c785, 0x4347f459, 0x1f521aed,
+    0xb6a33b27, 0xeab6d593, 0x0e88e64f, 0x529d08fb, 0xc318f706,
+    0x9f0d19b2, 0x7b332a6e, 0x2726c4da, 0x5dd4a365, 0x01c14dd1,
+    0xe5ff7e0d, 0xb9ea90b9, 0x286f6f44, 0x747a81f0, 0x9044b22c,
+    0xcc515c98},
+   {0x00000000, 0x0d0a7ded, 0x1a14fbda, 0x171e8637, 0x3429f7b4,
+    0x39238a59, 0x2e3d0c6e, 0x23377183, 0x6853ef68, 0x65599285,
+    0x724714b2, 0x7f4d695f, 0x5c7a18dc, 0x51706531, 0x466ee306,
+    0x4b649eeb, 0xd0a7ded0, 0xddada33d, 0xcab3250a, 0xc7b958e7,
+    0xe48e2964, 0xe9845489, 0xfe9ad2be, 0xf390af53, 0xb8f431b8,
+    0xb5fe4c55, 0xa2e0ca62, 0xafeab78f, 0x8cddc60c, 0x81d7bbe1,
+    0x96c93dd6, 0x9bc3403b, 0xa4a3cb51, 0xa9a9b6bc, 0xbeb7308b,
+    0xb3bd4d66, 0x908a3ce5, 0x9d804108, 0x8a9ec73f, 0x8794bad2,
+    0xccf02439, 0xc1fa59d4, 0xd6e4dfe3, 0xdbeea20e, 0xf8d9d38d,
+    0xf5d3ae60, 0xe2cd2857, 0xefc755ba, 0x74041581, 0x790e686c,
+    0x6e10ee5b, 0x631a93b6, 0x402de235, 0x4d279fd8, 0x5a3919ef,
+    0x57336402, 0x1c57fae9, 0x115d8704, 0x06430133, 0x0b497cde,
+    0x287e0d5d, 0x257470b0, 0x326af687, 0x3f608b6a, 0x4cabe053,
+    0x41a19dbe, 0x56bf1b89, 0x5bb56664, 0x788217e7, 0x75886a0a,
+    0x6296ec3d, 0x6f9c91d0, 0x24f80f3b, 0x29f272d6, 0x3eecf4e1,
+    0x33e6890c, 0x10d1f88f, 0x1ddb8562, 0x0ac50355, 0x07cf7eb8,
+    0x9c0c3e83, 0x9106436e, 0x8618c559, 0x8b12b8b4, 0xa825c937,
+    0xa52fb4da, 0xb23132ed, 0xbf3b4f00, 0xf45fd1eb, 0xf955ac06,
+    0xee4b2a31, 0xe34157dc, 0xc076265f, 0xcd7c5bb2, 0xda62dd85,
+    0xd768a068, 0xe8082b02, 0xe50256ef, 0xf21cd0d8, 0xff16ad35,
+    0xdc21dcb6, 0xd12ba15b, 0xc635276c, 0xcb3f5a81, 0x805bc46a,
+    0x8d51b987, 0x9a4f3fb0, 0x9745425d, 0xb47233de, 0xb9784e33,
+    0xae66c804, 0xa36cb5e9, 0x38aff5d2, 0x35a5883f, 0x22bb0e08,
+    0x2fb173e5, 0x0c860266, 0x018c7f8b, 0x1692f9bc, 0x1b988451,
+    0x50fc1aba, 0x5df66757, 0x4ae8e160, 0x47e29c8d, 0x64d5ed0e,
+    0x69df90e3, 0x7ec116d4, 0x73cb6b39, 0x9957c0a6, 0x945dbd4b,
+    0x83433b7c, 0x8e494691, 0xad7e3712, 0xa0744aff, 0xb76accc8,
+    0xba60b125, 0xf1042fce, 0xfc0e5223, 0xeb10d414, 0xe61aa9f9,
+    0xc52dd87a, 0xc827a597, 0xdf3923a0, 0xd2335e4d, 0x49f01e76,
+    0x44fa639b, 0x53e4e5ac, 0x5eee9841, 0x7dd9e9c2, 0x70d3942f,
+    0x67cd1218, 0x6ac76ff5, 0x21a3f11e, 0x2ca98cf3, 0x3bb70ac4,
+    0x36bd7729, 0x158a06aa, 0x18807b47, 0x0f9efd70, 0x0294809d,
+    0x3df40bf7, 0x30fe761a, 0x27e0f02d, 0x2aea8dc0, 0x09ddfc43,
+    0x04d781ae, 0x13c90799, 0x1ec37a74, 0x55a7e49f, 0x58ad9972,
+    0x4fb31f45, 0x42b962a8, 0x618e132b, 0x6c846ec6, 0x7b9ae8f1,
+    0x7690951c, 0xed53d527, 0xe059a8ca, 0xf7472efd, 0xfa4d5310,
+    0xd97a2293, 0xd4705f7e, 0xc36ed949, 0xce64a4a4, 0x85003a4f,
+    0x880a47a2, 0x9f14c195, 0x921ebc78, 0xb129cdfb, 0xbc23b016,
+    0xab3d3621, 0xa6374bcc, 0xd5fc20f5, 0xd8f65d18, 0xcfe8db2f,
+    0xc2e2a6c2, 0xe1d5d741, 0xecdfaaac, 0xfbc12c9b, 0xf6cb5176,
+    0xbdafcf9d, 0xb0a5b270, 0xa7bb3447, 0xaab149aa, 0x89863829,
+    0x848c45c4, 0x9392c3f3, 0x9e98be1e, 0x055bfe25, 0x085183c8,
+    0x1f4f05ff, 0x12457812, 0x31720991, 0x3c78747c, 0x2b66f24b,
+    0x266c8fa6, 0x6d08114d, 0x60026ca0, 0x771cea97, 0x7a16977a,
+    0x5921e6f9, 0x542b9b14, 0x43351d23, 0x4e3f60ce, 0x715feba4,
+    0x7c559649, 0x6b4b107e, 0x66416d93, 0x45761c10, 0x487c61fd,
+    0x5f62e7ca, 0x52689a27, 0x190c04cc, 0x14067921, 0x0318ff16,
+    0x0e1282fb, 0x2d25f378, 0x202f8e95, 0x373108a2, 0x3a3b754f,
+    0xa1f83574, 0xacf24899, 0xbbecceae, 0xb6e6b343, 0x95d1c2c0,
+    0x98dbbf2d, 0x8fc5391a, 0x82cf44f7, 0xc9abda1c, 0xc4a1a7f1,
+    0xd3bf21c6, 0xdeb55c2b, 0xfd822da8, 0xf0885045, 0xe796d672,
+    0xea9cab9f}};
+
+static const z_word_t crc32c_braid_big_table[][256] = {
+   {0x00000000, 0xed7d0a0d, 0xdafb141a, 0x37861e17, 0xb4f72934,
+    0x598a2339, 0x6e0c3d2e, 0x83713723, 0x68ef5368, 0x85925965,
+    0xb2144772, 0x5f694d7f, 0xdc187a5c, 0x31657051, 0x06e36e46,
+    0xeb9e644b, 0xd0dea7d0, 0x3da3addd, 0x0a25b3ca, 0xe758b9c7,
+    0x64298ee4, 0x895484e9, 0xbed29afe, 0x53af90f3, 0xb831f4b8,
+    0x554cfeb5, 0x62cae0a2, 0x8fb7eaaf, 0x0cc6dd8c, 0xe1bbd781,
+    0xd63dc996, 0x3b40c39b, 0x51cba3a4, 0xbcb6a9a9, 0x8b30b7be,
+    0x664dbdb3, 0xe53c8a90, 0x0841809d, 0x3fc79e8a, 0xd2ba9487,
+    0x3924f0cc, 0xd459fac1, 0xe3dfe4d6, 0x0ea2eedb, 0x8dd3d9f8,
+    0x60aed3f5, 0x5728cde2, 0xba55c7ef, 0x81150474, 0x6c680e79,
+    0x5bee106e, 0xb6931a63, 0x35e22d40, 0xd89f274d, 0xef19395a,
+    0x02643357, 0xe9fa571c, 0x04875d11, 0x33014306, 0xde7c490b,
+    0x5d0d7e28, 0xb0707425, 0x87f66a32, 0x6a8b603f, 0x53e0ab4c,
+    0xbe9da141, 0x891bbf56, 0x6466b55b, 0xe7178278, 0x0a6a8875,
+    0x3dec9662, 0xd0919c6f, 0x3b0ff824, 0xd672f229, 0xe1f4ec3e,
+    0x0c89e633, 0x8ff8d110, 0x6285db1d, 0x5503c50a, 0xb87ecf07,
+    0x833e0c9c, 0x6e430691, 0x59c51886, 0xb4b8128b, 0x37c925a8,
+    0xdab42fa5, 0xed3231b2, 0x004f3bbf, 0xebd15ff4, 0x06ac55f9,
+    0x312a4bee, 0xdc5741e3, 0x5f2676c0, 0xb25b7ccd, 0x85dd62da,
+    0x68a068d7, 0x022b08e8, 0xef5602e5, 0xd8d01cf2, 0x35ad16ff,
+    0xb6dc21dc, 0x5ba12bd1, 0x6c2735c6, 0x815a3fcb, 0x6ac45b80,
+    0x87b9518d, 0xb03f4f9a, 0x5d424597, 0xde3372b4, 0x334e78b9,
+    0x04c866ae, 0xe9b56ca3, 0xd2f5af38, 0x3f88a535, 0x080ebb22,
+    0xe573b12f, 0x6602860c, 0x8b7f8c01, 0xbcf99216, 0x5184981b,
+    0xba1afc50, 0x5767f65d, 0x60e1e84a, 0x8d9ce247, 0x0eedd564,
+    0xe390df69, 0xd416c17e, 0x396bcb73, 0xa6c05799, 0x4bbd5d94,
+    0x7c3b4383, 0x9146498e, 0x12377ead, 0xff4a74a0, 0xc8cc6ab7,
+    0x25b160ba, 0xce2f04f1, 0x23520efc, 0x14d410eb, 0xf9a91ae6,
+    0x7ad82dc5, 0x97a527c8, 0xa02339df, 0x4d5e33d2, 0x761ef049,
+    0x9b63fa44, 0xace5e453, 0x4198ee5e, 0xc2e9d97d, 0x2f94d370,
+    0x1812cd67, 0xf56fc76a, 0x1ef1a321, 0xf38ca92c, 0xc40ab73b,
+    0x2977bd36, 0xaa068a15, 0x477b8018, 0x70fd9e0f, 0x9d809402,
+    0xf70bf43d, 0x1a76fe30, 0x2df0e027, 0xc08dea2a, 0x43fcdd09,
+    0xae81d704, 0x9907c913, 0x747ac31e, 0x9fe4a755, 0x7299ad58,
+    0x451fb34f, 0xa862b942, 0x2b138e61, 0xc66e846c, 0xf1e89a7b,
+    0x1c959076, 0x27d553ed, 0xcaa859e0, 0xfd2e47f7, 0x10534dfa,
+    0x93227ad9, 0x7e5f70d4, 0x49d96ec3, 0xa4a464ce, 0x4f3a0085,
+    0xa2470a88, 0x95c1149f, 0x78bc1e92, 0xfbcd29b1, 0x16b023bc,
+    0x21363dab, 0xcc4b37a6, 0xf520fcd5, 0x185df6d8, 0x2fdbe8cf,
+    0xc2a6e2c2, 0x41d7d5e1, 0xacaadfec, 0x9b2cc1fb, 0x7651cbf6,
+    0x9dcfafbd, 0x70b2a5b0, 0x4734bba7, 0xaa49b1aa, 0x29388689,
+    0xc4458c84, 0xf3c39293, 0x1ebe989e, 0x25fe5b05, 0xc8835108,
+    0xff054f1f, 0x12784512, 0x91097231, 0x7c74783c, 0x4bf2662b,
+    0xa68f6c26, 0x4d11086d, 0xa06c0260, 0x97ea1c77, 0x7a97167a,
+    0xf9e62159, 0x149b2b54, 0x231d3543, 0xce603f4e, 0xa4eb5f71,
+    0x4996557c, 0x7e104b6b, 0x936d4166, 0x101c7645, 0xfd617c48,
+    0xcae7625f, 0x279a6852, 0xcc040c19, 0x21790614, 0x16ff1803,
+    0xfb82120e, 0x78f3252d, 0x958e2f20, 0xa2083137, 0x4f753b3a,
+    0x7435f8a1, 0x9948f2ac, 0xaeceecbb, 0x43b3e6b6, 0xc0c2d195,
+    0x2dbfdb98, 0x1a39c58f, 0xf744cf82, 0x1cdaabc9, 0xf1a7a1c4,
+    0xc621bfd3, 0x2b5cb5de, 0xa82d82fd, 0x455088f0, 0x72d696e7,
+    0x9fab9cea},
+   {0x00000000, 0xb4ee155c, 0x68dd2bb8, 0xdc333ee4, 0x21ccbb75,
+    0x9522ae29, 0x491190cd, 0xfdff8591, 0x429877eb, 0xf67662b7,
+    0x2a455c53, 0x9eab490f, 0x6354cc9e, 0xd7bad9c2, 0x0b89e726,
+    0xbf67f27a, 0x754603d3, 0xc1a8168f, 0x1d9b286b, 0xa9753d37,
+    0x548ab8a6, 0xe064adfa, 0x3c57931e, 0x88b98642, 0x37de7438,
+    0x83306164, 0x5f035f80, 0xebed4adc, 0x1612cf4d, 0xa2fcda11,
+    0x7ecfe4f5, 0xca21f1a9, 0x1bfaeaa3, 0xaf14ffff, 0x7327c11b,
+    0xc7c9d447, 0x3a3651d6, 0x8ed8448a, 0x52eb7a6e, 0xe6056f32,
+    0x59629d48, 0xed8c8814, 0x31bfb6f0, 0x8551a3ac, 0x78ae263d,
+    0xcc403361, 0x10730d85, 0xa49d18d9, 0x6ebce970, 0xda52fc2c,
+    0x0661c2c8, 0xb28fd794, 0x4f705205, 0xfb9e4759, 0x27ad79bd,
+    0x93436ce1, 0x2c249e9b, 0x98ca8bc7, 0x44f9b523, 0xf017a07f,
+    0x0de825ee, 0xb90630b2, 0x65350e56, 0xd1db1b0a, 0xc7823942,
+    0x736c2c1e, 0xaf5f12fa, 0x1bb107a6, 0xe64e8237, 0x52a0976b,
+    0x8e93a98f, 0x3a7dbcd3, 0x851a4ea9, 0x31f45bf5, 0xedc76511,
+    0x5929704d, 0xa4d6f5dc, 0x1038e080, 0xcc0bde64, 0x78e5cb38,
+    0xb2c43a91, 0x062a2fcd, 0xda191129, 0x6ef70475, 0x930881e4,
+    0x27e694b8, 0xfbd5aa5c, 0x4f3bbf00, 0xf05c4d7a, 0x44b25826,
+    0x988166c2, 0x2c6f739e, 0xd190f60f, 0x657ee353, 0xb94dddb7,
+    0x0da3c8eb, 0xdc78d3e1, 0x6896c6bd, 0xb4a5f859, 0x004bed05,
+    0xfdb46894, 0x495a7dc8, 0x9569432c, 0x21875670, 0x9ee0a40a,
+    0x2a0eb156, 0xf63d8fb2, 0x42d39aee, 0xbf2c1f7f, 0x0bc20a23,
+    0xd7f134c7, 0x631f219b, 0xa93ed032, 0x1dd0c56e, 0xc1e3fb8a,
+    0x750deed6, 0x88f26b47, 0x3c1c7e1b, 0xe02f40ff, 0x54c155a3,
+    0xeba6a7d9, 0x5f48b285, 0x837b8c61, 0x3795993d, 0xca6a1cac,
+    0x7e8409f0, 0xa2b73714, 0x16592248, 0x8e057384, 0x3aeb66d8,
+    0xe6d8583c, 0x52364d60, 0xafc9c8f1, 0x1b27ddad, 0xc714e349,
+    0x73faf615, 0xcc9d046f, 0x78731133, 0xa4402fd7, 0x10ae3a8b,
+    0xed51bf1a, 0x59bfaa46, 0x858c94a2, 0x316281fe, 0xfb437057,
+    0x4fad650b, 0x939e5bef, 0x27704eb3, 0xda8fcb22, 0x6e61de7e,
+    0xb252e09a, 0x06bcf5c6, 0xb9db07bc, 0x0d3512e0, 0xd1062c04,
+    0x65e83958, 0x9817bcc9, 0x2cf9a995, 0xf0ca9771, 0x4424822d,
+    0x95ff9927, 0x21118c7b, 0xfd22b29f, 0x49cca7c3, 0xb4332252,
+    0x00dd370e, 0xdcee09ea, 0x68001cb6, 0xd767eecc, 0x6389fb90,
+    0xbfbac574, 0x0b54d028, 0xf6ab55b9, 0x424540e5, 0x9e767e01,
+    0x2a986b5d, 0xe0b99af4, 0x54578fa8, 0x8864b14c, 0x3c8aa410,
+    0xc1752181, 0x759b34dd, 0xa9a80a39, 0x1d461f65, 0xa221ed1f,
+    0x16cff843, 0xcafcc6a7, 0x7e12d3fb, 0x83ed566a, 0x37034336,
+    0xeb307dd2, 0x5fde688e, 0x49874ac6, 0xfd695f9a, 0x215a617e,
+    0x95b47422, 0x684bf1b3, 0xdca5e4ef, 0x0096da0b, 0xb478cf57,
+    0x0b1f3d2d, 0xbff12871, 0x63c21695, 0xd72c03c9, 0x2ad38658,
+    0x9e3d9304, 0x420eade0, 0xf6e0b8bc, 0x3cc14915, 0x882f5c49,
+    0x541c62ad, 0xe0f277f1, 0x1d0df260, 0xa9e3e73c, 0x75d0d9d8,
+    0xc13ecc84, 0x7e593efe, 0xcab72ba2, 0x16841546, 0xa26a001a,
+    0x5f95858b, 0xeb7b90d7, 0x3748ae33, 0x83a6bb6f, 0x527da065,
+    0xe693b539, 0x3aa08bdd, 0x8e4e9e81, 0x73b11b10, 0xc75f0e4c,
+    0x1b6c30a8, 0xaf8225f4, 0x10e5d78e, 0xa40bc2d2, 0x7838fc36,
+    0xccd6e96a, 0x31296cfb, 0x85c779a7, 0x59f44743, 0xed1a521f,
+    0x273ba3b6, 0x93d5b6ea, 0x4fe6880e, 0xfb089d52, 0x06f718c3,
+    0xb2190d9f, 0x6e2a337b, 0xdac42627, 0x65a3d45d, 0xd14dc101,
+    0x0d7effe5, 0xb990eab9, 0x446f6f28, 0xf0817a74, 0x2cb24490,
+    0x985c51cc},
+   {0x00000000, 0x38f0d375, 0x70e0a7eb, 0x4810749e, 0x11b6a3d2,
+    0x294670a7, 0x61560439, 0x59a6d74c, 0xd31aaba0, 0xebea78d5,
+    0xa3fa0c4b, 0x9b0adf3e, 0xc2ac0872, 0xfa5cdb07, 0xb24caf99,
+    0x8abc7cec, 0x5743ba44, 0x6fb36931, 0x27a31daf, 0x1f53ceda,
+    0x46f51996, 0x7e05cae3, 0x3615be7d, 0x0ee56d08, 0x845911e4,
+    0xbca9c291, 0xf4b9b60f, 0xcc49657a, 0x95efb236, 0xad1f6143,
+    0xe50f15dd, 0xddffc6a8, 0xae867489, 0x9676a7fc, 0xde66d362,
+    0xe6960017, 0xbf30d75b, 0x87c0042e, 0xcfd070b0, 0xf720a3c5,
+    0x7d9cdf29, 0x456c0c5c, 0x0d7c78c2, 0x358cabb7, 0x6c2a7cfb,
+    0x54daaf8e, 0x1ccadb10, 0x243a0865, 0xf9c5cecd, 0xc1351db8,
+    0x89256926, 0xb1d5ba53, 0xe8736d1f, 0xd083be6a, 0x9893caf4,
+    0xa0631981, 0x2adf656d, 0x122fb618, 0x5a3fc286, 0x62cf11f3,
+    0x3b69c6bf, 0x039915ca, 0x4b896154, 0x7379b221, 0xad7b0517,
+    0x958bd662, 0xdd9ba2fc, 0xe56b7189, 0xbccda6c5, 0x843d75b0,
+    0xcc2d012e, 0xf4ddd25b, 0x7e61aeb7, 0x46917dc2, 0x0e81095c,
+    0x3671da29, 0x6fd70d65, 0x5727de10, 0x1f37aa8e, 0x27c779fb,
+    0xfa38bf53, 0xc2c86c26, 0x8ad818b8, 0xb228cbcd, 0xeb8e1c81,
+    0xd37ecff4, 0x9b6ebb6a, 0xa39e681f, 0x292214f3, 0x11d2c786,
+    0x59c2b318, 0x6132606d, 0x3894b721, 0x00646454, 0x487410ca,
+    0x7084c3bf, 0x03fd719e, 0x3b0da2eb, 0x731dd675, 0x4bed0500,
+    0x124bd24c, 0x2abb0139, 0x62ab75a7, 0x5a5ba6d2, 0xd0e7da3e,
+    0xe817094b, 0xa0077dd5, 0x98f7aea0, 0xc15179ec, 0xf9a1aa99,
+    0xb1b1de07, 0x89410d72, 0x54becbda, 0x6c4e18af, 0x245e6c31,
+    0x1caebf44, 0x45086808, 0x7df8bb7d, 0x35e8cfe3, 0x0d181c96,
+    0x87a4607a, 0xbf54b30f, 0xf744c791, 0xcfb414e4, 0x9612c3a8,
+    0xaee210dd, 0xe6f26443, 0xde02b736, 0x5af70a2e, 0x6207d95b,
+    0x2a17adc5, 0x12e77eb0, 0x4b41a9fc, 0x73b17a89, 0x3ba10e17,
+    0x0351dd62, 0x89eda18e, 0xb11d72fb, 0xf90d0665, 0xc1fdd510,
+    0x985b025c, 0xa0abd129, 0xe8bba5b7, 0xd04b76c2, 0x0db4b06a,
+    0x3544631f, 0x7d541781, 0x45a4c4f4, 0x1c0213b8, 0x24f2c0cd,
+    0x6ce2b453, 0x54126726, 0xdeae1bca, 0xe65ec8bf, 0xae4ebc21,
+    0x96be6f54, 0xcf18b818, 0xf7e86b6d, 0xbff81ff3, 0x8708cc86,
+    0xf4717ea7, 0xcc81add2, 0x8491d94c, 0xbc610a39, 0xe5c7dd75,
+    0xdd370e00, 0x95277a9e, 0xadd7a9eb, 0x276bd507, 0x1f9b0672,
+    0x578b72ec, 0x6f7ba199, 0x36dd76d5, 0x0e2da5a0, 0x463dd13e,
+    0x7ecd024b, 0xa332c4e3, 0x9bc21796, 0xd3d26308, 0xeb22b07d,
+    0xb2846731, 0x8a74b444, 0xc264c0da, 0xfa9413af, 0x70286f43,
+    0x48d8bc36, 0x00c8c8a8, 0x38381bdd, 0x619ecc91, 0x596e1fe4,
+    0x117e6b7a, 0x298eb80f, 0xf78c0f39, 0xcf7cdc4c, 0x876ca8d2,
+    0xbf9c7ba7, 0xe63aaceb, 0xdeca7f9e, 0x96da0b00, 0xae2ad875,
+    0x2496a499, 0x1c6677ec, 0x54760372, 0x6c86d007, 0x3520074b,
+    0x0dd0d43e, 0x45c0a0a0, 0x7d3073d5, 0xa0cfb57d, 0x983f6608,
+    0xd02f1296, 0xe8dfc1e3, 0xb17916af, 0x8989c5da, 0xc199b144,
+    0xf9696231, 0x73d51edd, 0x4b25cda8, 0x0335b936, 0x3bc56a43,
+    0x6263bd0f, 0x5a936e7a, 0x12831ae4, 0x2a73c991, 0x590a7bb0,
+    0x61faa8c5, 0x29eadc5b, 0x111a0f2e, 0x48bcd862, 0x704c0b17,
+    0x385c7f89, 0x00acacfc, 0x8a10d010, 0xb2e00365, 0xfaf077fb,
+    0xc200a48e, 0x9ba673c2, 0xa356a0b7, 0xeb46d429, 0xd3b6075c,
+    0x0e49c1f4, 0x36b91281, 0x7ea9661f, 0x4659b56a, 0x1fff6226,
+    0x270fb153, 0x6f1fc5cd, 0x57ef16b8, 0xdd536a54, 0xe5a3b921,
+    0xadb3cdbf, 0x95431eca, 0xcce5c986, 0xf4151af3, 0xbc056e6d,
+    0x84f5bd18},
+   {0x00000000, 0x8ec24fba, 0xedf37371, 0x63313ccb, 0xdae7e7e2,
+    0x5425a858, 0x37149493, 0xb9d6db29, 0x45b923c0, 0xcb7b6c7a,
+    0xa84a50b1, 0x26881f0b, 0x9f5ec422, 0x119c8b98, 0x72adb753,
+    0xfc6ff8e9, 0x7b04ab85, 0xf5c6e43f, 0x96f7d8f4, 0x1835974e,
+    0xa1e34c67, 0x2f2103dd, 0x4c103f16, 0xc2d270ac, 0x3ebd8845,
+    0xb07fc7ff, 0xd34efb34, 0x5d8cb48e, 0xe45a6fa7, 0x6a98201d,
+    0x09a91cd6, 0x876b536c, 0x077eba0e, 0x89bcf5b4, 0xea8dc97f,
+    0x644f86c5, 0xdd995dec, 0x535b1256, 0x306a2e9d, 0xbea86127,
+    0x42c799ce, 0xcc05d674, 0xaf34eabf, 0x21f6a505, 0x98207e2c,
+    0x16e23196, 0x75d30d5d, 0xfb1142e7, 0x7c7a118b, 0xf2b85e31,
+    0x918962fa, 0x1f4b2d40, 0xa69df669, 0x285fb9d3, 0x4b6e8518,
+    0xc5accaa2, 0x39c3324b, 0xb7017df1, 0xd430413a, 0x5af20e80,
+    0xe324d5a9, 0x6de69a13, 0x0ed7a6d8, 0x8015e962, 0x0efc741d,
+    0x803e3ba7, 0xe30f076c, 0x6dcd48d6, 0xd41b93ff, 0x5ad9dc45,
+    0x39e8e08e, 0xb72aaf34, 0x4b4557dd, 0xc5871867, 0xa6b624ac,
+    0x28746b16, 0x91a2b03f, 0x1f60ff85, 0x7c51c34e, 0xf2938cf4,
+    0x75f8df98, 0xfb3a9022, 0x980bace9, 0x16c9e353, 0xaf1f387a,
+    0x21dd77c0, 0x42ec4b0b, 0xcc2e04b1, 0x3041fc58, 0xbe83b3e2,
+    0xddb28f29, 0x5370c093, 0xeaa61bba, 0x64645400, 0x075568cb,
+    0x89972771, 0x0982ce13, 0x874081a9, 0xe471bd62, 0x6ab3f2d8,
+    0xd36529f1, 0x5da7664b, 0x3e965a80, 0xb054153a, 0x4c3bedd3,
+    0xc2f9a269, 0xa1c89ea2, 0x2f0ad118, 0x96dc0a31, 0x181e458b,
+    0x7b2f7940, 0xf5ed36fa, 0x72866596, 0xfc442a2c, 0x9f7516e7,
+    0x11b7595d, 0xa8618274, 0x26a3cdce, 0x4592f105, 0xcb50bebf,
+    0x373f4656, 0xb9fd09ec, 0xdacc3527, 0x540e7a9d, 0xedd8a1b4,
+    0x631aee0e, 0x002bd2c5, 0x8ee99d7f, 0x1cf8e93a, 0x923aa680,
+    0xf10b9a4b, 0x7fc9d5f1, 0xc61f0ed8, 0x48dd4162, 0x2bec7da9,
+    0xa52e3213, 0x5941cafa, 0xd7838540, 0xb4b2b98b, 0x3a70f631,
+    0x83a62d18, 0x0d6462a2, 0x6e555e69, 0xe09711d3, 0x67fc42bf,
+    0xe93e0d05, 0x8a0f31ce, 0x04cd7e74, 0xbd1ba55d, 0x33d9eae7,
+    0x50e8d62c, 0xde2a9996, 0x2245617f, 0xac872ec5, 0xcfb6120e,
+    0x41745db4, 0xf8a2869d, 0x7660c927, 0x1551f5ec, 0x9b93ba56,
+    0x1b865334, 0x95441c8e, 0xf6752045, 0x78b76fff, 0xc161b4d6,
+    0x4fa3fb6c, 0x2c92c7a7, 0xa250881d, 0x5e3f70f4, 0xd0fd3f4e,
+    0xb3cc0385, 0x3d0e4c3f, 0x84d89716, 0x0a1ad8ac, 0x692be467,
+    0xe7e9abdd, 0x6082f8b1, 0xee40b70b, 0x8d718bc0, 0x03b3c47a,
+    0xba651f53, 0x34a750e9, 0x57966c22, 0xd9542398, 0x253bdb71,
+    0xabf994cb, 0xc8c8a800, 0x460ae7ba, 0xffdc3c93, 0x711e7329,
+    0x122f4fe2, 0x9ced0058, 0x12049d27, 0x9cc6d29d, 0xfff7ee56,
+    0x7135a1ec, 0xc8e37ac5, 0x4621357f, 0x251009b4, 0xabd2460e,
+    0x57bdbee7, 0xd97ff15d, 0xba4ecd96, 0x348c822c, 0x8d5a5905,
+    0x039816bf, 0x60a92a74, 0xee6b65ce, 0x690036a2, 0xe7c27918,
+    0x84f345d3, 0x0a310a69, 0xb3e7d140, 0x3d259efa, 0x5e14a231,
+    0xd0d6ed8b, 0x2cb91562, 0xa27b5ad8, 0xc14a6613, 0x4f8829a9,
+    0xf65ef280, 0x789cbd3a, 0x1bad81f1, 0x956fce4b, 0x157a2729,
+    0x9bb86893, 0xf8895458, 0x764b1be2, 0xcf9dc0cb, 0x415f8f71,
+    0x226eb3ba, 0xacacfc00, 0x50c304e9, 0xde014b53, 0xbd307798,
+    0x33f23822, 0x8a24e30b, 0x04e6acb1, 0x67d7907a, 0xe915dfc0,
+    0x6e7e8cac, 0xe0bcc316, 0x838dffdd, 0x0d4fb067, 0xb4996b4e,
+    0x3a5b24f4, 0x596a183f, 0xd7a85785, 0x2bc7af6c, 0xa505e0d6,
+    0xc634dc1d, 0x48f693a7, 0xf120488e, 0x7fe20734, 0x1cd33bff,
+    0x92117445}};
+
+#endif /* W */
+
+#endif /* N == 6 */
+
+static const uint32_t crc32c_x2n_table[] = {
+    0x40000000, 0x20000000, 0x08000000, 0x00800000, 0x00008000,
+    0x82f63b78, 0x6ea2d55c, 0x18b8ea18, 0x510ac59a, 0xb82be955,
+    0xb8fdb1e7, 0x88e56f72, 0x74c360a4, 0xe4172b16, 0x0d65762a,
+    0x35d73a62, 0x28461564, 0xbf455269, 0xe2ea32dc, 0xfe7740e6,
+    0xf946610b, 0x3c204f8f, 0x538586e3, 0x59726915, 0x734d5309,
+    0xbc1ac763, 0x7d0722cc, 0xd289cabe, 0xe94ca9bc, 0x05b74f3f,
+    0xa51e1f42, 0x40000000};
+
+#endif /* CRC32C_BRAID_TBL_H_ */
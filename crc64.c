@@ -0,0 +1,35 @@
+/* crc64.c -- compute the CRC-64 (ECMA-182, as used by xz) of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+#include "crc32_braid_p.h"
+#include "crc64_braid_tbl.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "crc64_braid_comb_p.h"
+
+/* ========================================================================= */
+uint64_t Z_EXPORT PREFIX(crc64)(uint64_t crc, const unsigned char *buf, size_t len) {
+    if (buf == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc64)(crc, buf, len);
+}
+
+/* ========================================================================= */
+uint64_t Z_EXPORT PREFIX(crc64_combine)(uint64_t crc1, uint64_t crc2, z_off64_t len2) {
+    return multmodp64(x2nmodp64(len2, 3), crc1) ^ crc2;
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_combine_gen)(z_off64_t len2) {
+    return x2nmodp64(len2, 3);
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_combine_op)(uint64_t crc1, uint64_t crc2, const uint64_t op) {
+    return multmodp64(op, crc1) ^ crc2;
+}
+
+#endif
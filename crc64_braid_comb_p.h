@@ -0,0 +1,46 @@
+#ifndef CRC64_BRAID_COMB_P_H_
+#define CRC64_BRAID_COMB_P_H_
+
+/* Number of entries in crc64_x2n_table[], enough for any non-negative z_off64_t length in bytes */
+#define CRC64_X2N_SIZE 66
+
+/*
+  Return a(x) multiplied by b(x) modulo p(x), where p(x) is the CRC-64
+  polynomial, reflected. For speed, this requires that a not be zero.
+ */
+static uint64_t multmodp64(uint64_t a, uint64_t b) {
+    uint64_t m, p;
+
+    m = (uint64_t)1 << 63;
+    p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ CRC64_POLY : b >> 1;
+    }
+    return p;
+}
+
+/*
+  Return x^(n * 2^k) modulo p(x). Requires that crc64_x2n_table[] has been
+  initialized. Unlike the CRC-32 polynomial, x^(2^64) is not x modulo the
+  CRC-64 polynomial, so the table has an entry for every k that can occur.
+ */
+static uint64_t x2nmodp64(z_off64_t n, unsigned k) {
+    uint64_t p;
+
+    p = (uint64_t)1 << 63;           /* x^0 == 1 */
+    while (n) {
+        if (n & 1)
+            p = multmodp64(crc64_x2n_table[k], p);
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+#endif /* CRC64_BRAID_COMB_P_H_ */
@@ -0,0 +1,8511 @@
+#ifndef CRC64_BRAID_TBL_H_
+#define CRC64_BRAID_TBL_H_
+
+/* crc64_braid_tbl.h -- tables for braided CRC-64 calculation
+ * Generated automatically by makecrct.c
+ */
+
+static const uint64_t crc64_table[] = {
+    0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b,
+    0x47aa7ae9abe7ff34, 0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c,
+    0x8f54f5d357cffe68, 0x3c7ab96d5468a107, 0xf7a18709ff1ebc66,
+    0x448fcbb7fcb9e309, 0x0325b15e575e1c3d, 0xb00bfde054f94352,
+    0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e,
+    0xcbdb3e64ab761d61, 0x7d9ba13851336649, 0xceb5ed8652943926,
+    0x891f976ff973c612, 0x3a31dbd1fad4997d, 0x064b62bcaebc387a,
+    0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+    0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74,
+    0xcd905cd805ca251b, 0xf1eae5b551a2841c, 0x42c4a90b5205db73,
+    0x056ed3e2f9e22447, 0xb6409f5cfa457b28, 0xfb374270a266cc92,
+    0x48190ecea1c193fd, 0x0fb374270a266cc9, 0xbc9d3899098133a6,
+    0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa,
+    0xc74dfb1df60e6d95, 0x0c96c5795d7870f4, 0xbfb889c75edf2f9b,
+    0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0, 0x774606fda2f72ec7,
+    0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+    0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80,
+    0xc10699a158b255ef, 0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87,
+    0x09f8169ba49a54b3, 0xbad65a25a73d0bdc, 0x710d64410c4b16bd,
+    0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+    0x0adda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5,
+    0x4d77dd2c5823b7ba, 0x64b62bcaebc387a1, 0xd7986774e864d8ce,
+    0x90321d9d438327fa, 0x231c512340247895, 0x1f66e84e144cd992,
+    0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+    0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c,
+    0xd4bdd62abf3ac4f3, 0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b,
+    0x1c4359104312c5af, 0xaf6d15ae40b59ac0, 0x192d8af2baf0e1e8,
+    0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+    0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80,
+    0x2557339fee9840ef, 0xee8c0dfb45ee5d8e, 0x5da24145464902e1,
+    0x1a083bacedaefdd5, 0xa9267712ee09a2ba, 0x955cce7fba6103bd,
+    0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+    0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68,
+    0xd82b1353e242b407, 0xe451aa3eb62a1500, 0x577fe680b58d4a6f,
+    0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34, 0x6820eeb3b6bbf755,
+    0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+    0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d,
+    0x545a57dee2d35652, 0xe21ac88218962d7a, 0x5134843c1b317215,
+    0x169efed5b0d68d21, 0xa5b0b26bb371d24e, 0x99ca0b06e7197349,
+    0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+    0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147,
+    0x521135624c6f6e28, 0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040,
+    0x9aefba58b0476f74, 0x29c1f6e6b3e0301b, 0xc96c5795d7870f42,
+    0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+    0xb2bc941128085171, 0x0192d8af2baf0e1e, 0x4638a2468048f12a,
+    0xf516eef883efae45, 0x3ecdd09c2899b324, 0x8de39c222b3eec4b,
+    0xca49e6cb80d9137f, 0x7967aa75837e4c10, 0x451d1318d716ed17,
+    0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x02b769f17cf11223,
+    0xb4f7f6ad86b4690b, 0x07d9ba1385133664, 0x4073c0fa2ef4c950,
+    0xf35d8c442d53963f, 0xcf273529793b3738, 0x7c0979977a9c6857,
+    0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c, 0x435671a479aad56d,
+    0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x04fc0b4dd24d2a59,
+    0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05,
+    0x7f2cc8c92dc2746a, 0x325b15e575e1c3d0, 0x8175595b76469cbf,
+    0xc6df23b2dda1638b, 0x75f16f0cde063ce4, 0x498bd6618a6e9de3,
+    0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0x0e21ac88218962d7,
+    0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed,
+    0x8250e80521188082, 0xbe2a516875702185, 0x0d041dd676d77eea,
+    0x4aae673fdd3081de, 0xf9802b81de97deb1, 0x4fc0b4dd24d2a599,
+    0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x086ace348f355aad,
+    0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1,
+    0x73ba0db070ba049e, 0xb86133d4dbcc19ff, 0x0b4f7f6ad86b4690,
+    0x4ce50583738cb9a4, 0xffcb493d702be6cb, 0xc3b1f050244347cc,
+    0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+    0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8,
+    0xea7006b697a377d7, 0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf,
+    0x228e898c6b8b768b, 0x91a0c532682c29e4, 0x5a7bfb56c35a3485,
+    0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+    0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed,
+    0x6601423b97329582, 0xd041dd676d77eeaa, 0x636f91d96ed0b1c5,
+    0x24c5eb30c5374ef1, 0x97eba78ec690119e, 0xab911ee392f8b099,
+    0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+    0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297,
+    0x604a2087398eadf8, 0x5c3099ea6de60cff, 0xef1ed5546e415390,
+    0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb, 0x56ed3e2f9e224471,
+    0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+    0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19,
+    0x6a978742ca4ae576, 0xa14cb926613cf817, 0x1262f598629ba778,
+    0x55c88f71c97c584c, 0xe6e6c3cfcadb0723, 0xda9c7aa29eb3a624,
+    0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+    0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263,
+    0x6cdce5fe64f6dd0c, 0x50a65c93309e7c0b, 0xe388102d33392364,
+    0xa4226ac498dedc50, 0x170c267a9b79833f, 0xdcd7181e300f9e5e,
+    0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+    0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036,
+    0xe0ada17364673f59};
+
+#if defined(W) && W == 8
+
+static const z_word_t crc64_big_table[] = {
+    0x0000000000000000, 0x6f5fa703be4c2eb3, 0x5ba040a8573684f4,
+    0x34ffe7abe97aaa47, 0x335e8fff84c3d07b, 0x5c0128fc3a8ffec8,
+    0x68fecf57d3f5548f, 0x07a168546db97a3c, 0x66bc1eff0987a1f7,
+    0x09e3b9fcb7cb8f44, 0x3d1c5e575eb12503, 0x5243f954e0fd0bb0,
+    0x55e291008d44718c, 0x3abd360333085f3f, 0x0e42d1a8da72f578,
+    0x611d76ab643edbcb, 0x4966335138a19b7d, 0x2639945286edb5ce,
+    0x12c673f96f971f89, 0x7d99d4fad1db313a, 0x7a38bcaebc624b06,
+    0x15671bad022e65b5, 0x2198fc06eb54cff2, 0x4ec75b055518e141,
+    0x2fda2dae31263a8a, 0x40858aad8f6a1439, 0x747a6d066610be7e,
+    0x1b25ca05d85c90cd, 0x1c84a251b5e5eaf1, 0x73db05520ba9c442,
+    0x4724e2f9e2d36e05, 0x287b45fa5c9f40b6, 0x92cc66a2704237fb,
+    0xfd93c1a1ce0e1948, 0xc96c260a2774b30f, 0xa633810999389dbc,
+    0xa192e95df481e780, 0xcecd4e5e4acdc933, 0xfa32a9f5a3b76374,
+    0x956d0ef61dfb4dc7, 0xf470785d79c5960c, 0x9b2fdf5ec789b8bf,
+    0xafd038f52ef312f8, 0xc08f9ff690bf3c4b, 0xc72ef7a2fd064677,
+    0xa87150a1434a68c4, 0x9c8eb70aaa30c283, 0xf3d11009147cec30,
+    0xdbaa55f348e3ac86, 0xb4f5f2f0f6af8235, 0x800a155b1fd52872,
+    0xef55b258a19906c1, 0xe8f4da0ccc207cfd, 0x87ab7d0f726c524e,
+    0xb3549aa49b16f809, 0xdc0b3da7255ad6ba, 0xbd164b0c41640d71,
+    0xd249ec0fff2823c2, 0xe6b60ba416528985, 0x89e9aca7a81ea736,
+    0x8e48c4f3c5a7dd0a, 0xe11763f07bebf3b9, 0xd5e8845b929159fe,
+    0xbab723582cdd774d, 0xa187c3ebca2bb664, 0xced864e8746798d7,
+    0xfa2783439d1d3290, 0x9578244023511c23, 0x92d94c144ee8661f,
+    0xfd86eb17f0a448ac, 0xc9790cbc19dee2eb, 0xa626abbfa792cc58,
+    0xc73bdd14c3ac1793, 0xa8647a177de03920, 0x9c9b9dbc949a9367,
+    0xf3c43abf2ad6bdd4, 0xf46552eb476fc7e8, 0x9b3af5e8f923e95b,
+    0xafc512431059431c, 0xc09ab540ae156daf, 0xe8e1f0baf28a2d19,
+    0x87be57b94cc603aa, 0xb341b012a5bca9ed, 0xdc1e17111bf0875e,
+    0xdbbf7f457649fd62, 0xb4e0d846c805d3d1, 0x801f3fed217f7996,
+    0xef4098ee9f335725, 0x8e5dee45fb0d8cee, 0xe10249464541a25d,
+    0xd5fdaeedac3b081a, 0xbaa209ee127726a9, 0xbd0361ba7fce5c95,
+    0xd25cc6b9c1827226, 0xe6a3211228f8d861, 0x89fc861196b4f6d2,
+    0x334ba549ba69819f, 0x5c14024a0425af2c, 0x68ebe5e1ed5f056b,
+    0x07b442e253132bd8, 0x00152ab63eaa51e4, 0x6f4a8db580e67f57,
+    0x5bb56a1e699cd510, 0x34eacd1dd7d0fba3, 0x55f7bbb6b3ee2068,
+    0x3aa81cb50da20edb, 0x0e57fb1ee4d8a49c, 0x61085c1d5a948a2f,
+    0x66a93449372df013, 0x09f6934a8961dea0, 0x3d0974e1601b74e7,
+    0x5256d3e2de575a54, 0x7a2d961882c81ae2, 0x1572311b3c843451,
+    0x218dd6b0d5fe9e16, 0x4ed271b36bb2b0a5, 0x497319e7060bca99,
+    0x262cbee4b847e42a, 0x12d3594f513d4e6d, 0x7d8cfe4cef7160de,
+    0x1c9188e78b4fbb15, 0x73ce2fe4350395a6, 0x4731c84fdc793fe1,
+    0x286e6f4c62351152, 0x2fcf07180f8c6b6e, 0x4090a01bb1c045dd,
+    0x746f47b058baef9a, 0x1b30e0b3e6f6c129, 0x420f87d795576cc9,
+    0x2d5020d42b1b427a, 0x19afc77fc261e83d, 0x76f0607c7c2dc68e,
+    0x715108281194bcb2, 0x1e0eaf2bafd89201, 0x2af1488046a23846,
+    0x45aeef83f8ee16f5, 0x24b399289cd0cd3e, 0x4bec3e2b229ce38d,
+    0x7f13d980cbe649ca, 0x104c7e8375aa6779, 0x17ed16d718131d45,
+    0x78b2b1d4a65f33f6, 0x4c4d567f4f2599b1, 0x2312f17cf169b702,
+    0x0b69b486adf6f7b4, 0x6436138513bad907, 0x50c9f42efac07340,
+    0x3f96532d448c5df3, 0x38373b79293527cf, 0x57689c7a9779097c,
+    0x63977bd17e03a33b, 0x0cc8dcd2c04f8d88, 0x6dd5aa79a4715643,
+    0x028a0d7a1a3d78f0, 0x3675ead1f347d2b7, 0x592a4dd24d0bfc04,
+    0x5e8b258620b28638, 0x31d482859efea88b, 0x052b652e778402cc,
+    0x6a74c22dc9c82c7f, 0xd0c3e175e5155b32, 0xbf9c46765b597581,
+    0x8b63a1ddb223dfc6, 0xe43c06de0c6ff175, 0xe39d6e8a61d68b49,
+    0x8cc2c989df9aa5fa, 0xb83d2e2236e00fbd, 0xd762892188ac210e,
+    0xb67fff8aec92fac5, 0xd920588952ded476, 0xeddfbf22bba47e31,
+    0x8280182105e85082, 0x8521707568512abe, 0xea7ed776d61d040d,
+    0xde8130dd3f67ae4a, 0xb1de97de812b80f9, 0x99a5d224ddb4c04f,
+    0xf6fa752763f8eefc, 0xc205928c8a8244bb, 0xad5a358f34ce6a08,
+    0xaafb5ddb59771034, 0xc5a4fad8e73b3e87, 0xf15b1d730e4194c0,
+    0x9e04ba70b00dba73, 0xff19ccdbd43361b8, 0x90466bd86a7f4f0b,
+    0xa4b98c738305e54c, 0xcbe62b703d49cbff, 0xcc47432450f0b1c3,
+    0xa318e427eebc9f70, 0x97e7038c07c63537, 0xf8b8a48fb98a1b84,
+    0xe388443c5f7cdaad, 0x8cd7e33fe130f41e, 0xb8280494084a5e59,
+    0xd777a397b60670ea, 0xd0d6cbc3dbbf0ad6, 0xbf896cc065f32465,
+    0x8b768b6b8c898e22, 0xe4292c6832c5a091, 0x85345ac356fb7b5a,
+    0xea6bfdc0e8b755e9, 0xde941a6b01cdffae, 0xb1cbbd68bf81d11d,
+    0xb66ad53cd238ab21, 0xd935723f6c748592, 0xedca9594850e2fd5,
+    0x829532973b420166, 0xaaee776d67dd41d0, 0xc5b1d06ed9916f63,
+    0xf14e37c530ebc524, 0x9e1190c68ea7eb97, 0x99b0f892e31e91ab,
+    0xf6ef5f915d52bf18, 0xc210b83ab428155f, 0xad4f1f390a643bec,
+    0xcc5269926e5ae027, 0xa30dce91d016ce94, 0x97f2293a396c64d3,
+    0xf8ad8e3987204a60, 0xff0ce66dea99305c, 0x9053416e54d51eef,
+    0xa4aca6c5bdafb4a8, 0xcbf301c603e39a1b, 0x7144229e2f3eed56,
+    0x1e1b859d9172c3e5, 0x2ae46236780869a2, 0x45bbc535c6444711,
+    0x421aad61abfd3d2d, 0x2d450a6215b1139e, 0x19baedc9fccbb9d9,
+    0x76e54aca4287976a, 0x17f83c6126b94ca1, 0x78a79b6298f56212,
+    0x4c587cc9718fc855, 0x2307dbcacfc3e6e6, 0x24a6b39ea27a9cda,
+    0x4bf9149d1c36b269, 0x7f06f336f54c182e, 0x105954354b00369d,
+    0x382211cf179f762b, 0x577db6cca9d35898, 0x6382516740a9f2df,
+    0x0cddf664fee5dc6c, 0x0b7c9e30935ca650, 0x642339332d1088e3,
+    0x50dcde98c46a22a4, 0x3f83799b7a260c17, 0x5e9e0f301e18d7dc,
+    0x31c1a833a054f96f, 0x053e4f98492e5328, 0x6a61e89bf7627d9b,
+    0x6dc080cf9adb07a7, 0x029f27cc24972914, 0x3660c067cded8353,
+    0x593f676473a1ade0};
+
+#if N == 1
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0xdabe95afc7875f40, 0x27a584742000a005,
+    0xfd1b11dbe787ff45, 0x4f4b08e84001400a, 0x95f59d4787861f4a,
+    0x68ee8c9c6001e00f, 0xb2501933a786bf4f, 0x9e9611d080028014,
+    0x4428847f4785df54, 0xb93395a4a0022011, 0x638d000b67857f51,
+    0xd1dd1938c003c01e, 0x0b638c9707849f5e, 0xf6789d4ce003601b,
+    0x2cc608e327843f5b, 0xaff48c8aaf0b1ead, 0x754a1925688c41ed,
+    0x885108fe8f0bbea8, 0x52ef9d51488ce1e8, 0xe0bf8462ef0a5ea7,
+    0x3a0111cd288d01e7, 0xc71a0016cf0afea2, 0x1da495b9088da1e2,
+    0x31629d5a2f099eb9, 0xebdc08f5e88ec1f9, 0x16c7192e0f093ebc,
+    0xcc798c81c88e61fc, 0x7e2995b26f08deb3, 0xa497001da88f81f3,
+    0x598c11c64f087eb6, 0x83328469888f21f6, 0xcd31b63ef11823df,
+    0x178f2391369f7c9f, 0xea94324ad11883da, 0x302aa7e5169fdc9a,
+    0x827abed6b11963d5, 0x58c42b79769e3c95, 0xa5df3aa29119c3d0,
+    0x7f61af0d569e9c90, 0x53a7a7ee711aa3cb, 0x89193241b69dfc8b,
+    0x7402239a511a03ce, 0xaebcb635969d5c8e, 0x1cecaf06311be3c1,
+    0xc6523aa9f69cbc81, 0x3b492b72111b43c4, 0xe1f7beddd69c1c84,
+    0x62c53ab45e133d72, 0xb87baf1b99946232, 0x4560bec07e139d77,
+    0x9fde2b6fb994c237, 0x2d8e325c1e127d78, 0xf730a7f3d9952238,
+    0x0a2bb6283e12dd7d, 0xd0952387f995823d, 0xfc532b64de11bd66,
+    0x26edbecb1996e226, 0xdbf6af10fe111d63, 0x01483abf39964223,
+    0xb318238c9e10fd6c, 0x69a6b6235997a22c, 0x94bda7f8be105d69,
+    0x4e03325779970229, 0x08bbc3564d3e593b, 0xd20556f98ab9067b,
+    0x2f1e47226d3ef93e, 0xf5a0d28daab9a67e, 0x47f0cbbe0d3f1931,
+    0x9d4e5e11cab84671, 0x60554fca2d3fb934, 0xbaebda65eab8e674,
+    0x962dd286cd3cd92f, 0x4c9347290abb866f, 0xb18856f2ed3c792a,
+    0x6b36c35d2abb266a, 0xd966da6e8d3d9925, 0x03d84fc14abac665,
+    0xfec35e1aad3d3920, 0x247dcbb56aba6660, 0xa74f4fdce2354796,
+    0x7df1da7325b218d6, 0x80eacba8c235e793, 0x5a545e0705b2b8d3,
+    0xe8044734a234079c, 0x32bad29b65b358dc, 0xcfa1c3408234a799,
+    0x151f56ef45b3f8d9, 0x39d95e0c6237c782, 0xe367cba3a5b098c2,
+    0x1e7cda7842376787, 0xc4c24fd785b038c7, 0x769256e422368788,
+    0xac2cc34be5b1d8c8, 0x5137d2900236278d, 0x8b89473fc5b178cd,
+    0xc58a7568bc267ae4, 0x1f34e0c77ba125a4, 0xe22ff11c9c26dae1,
+    0x389164b35ba185a1, 0x8ac17d80fc273aee, 0x507fe82f3ba065ae,
+    0xad64f9f4dc279aeb, 0x77da6c5b1ba0c5ab, 0x5b1c64b83c24faf0,
+    0x81a2f117fba3a5b0, 0x7cb9e0cc1c245af5, 0xa6077563dba305b5,
+    0x14576c507c25bafa, 0xcee9f9ffbba2e5ba, 0x33f2e8245c251aff,
+    0xe94c7d8b9ba245bf, 0x6a7ef9e2132d6449, 0xb0c06c4dd4aa3b09,
+    0x4ddb7d96332dc44c, 0x9765e839f4aa9b0c, 0x2535f10a532c2443,
+    0xff8b64a594ab7b03, 0x0290757e732c8446, 0xd82ee0d1b4abdb06,
+    0xf4e8e832932fe45d, 0x2e567d9d54a8bb1d, 0xd34d6c46b32f4458,
+    0x09f3f9e974a81b18, 0xbba3e0dad32ea457, 0x611d757514a9fb17,
+    0x9c0664aef32e0452, 0x46b8f10134a95b12, 0x117786ac9a7cb276,
+    0xcbc913035dfbed36, 0x36d202d8ba7c1273, 0xec6c97777dfb4d33,
+    0x5e3c8e44da7df27c, 0x84821beb1dfaad3c, 0x79990a30fa7d5279,
+    0xa3279f9f3dfa0d39, 0x8fe1977c1a7e3262, 0x555f02d3ddf96d22,
+    0xa84413083a7e9267, 0x72fa86a7fdf9cd27, 0xc0aa9f945a7f7268,
+    0x1a140a3b9df82d28, 0xe70f1be07a7fd26d, 0x3db18e4fbdf88d2d,
+    0xbe830a263577acdb, 0x643d9f89f2f0f39b, 0x99268e5215770cde,
+    0x43981bfdd2f0539e, 0xf1c802ce7576ecd1, 0x2b769761b2f1b391,
+    0xd66d86ba55764cd4, 0x0cd3131592f11394, 0x20151bf6b5752ccf,
+    0xfaab8e5972f2738f, 0x07b09f8295758cca, 0xdd0e0a2d52f2d38a,
+    0x6f5e131ef5746cc5, 0xb5e086b132f33385, 0x48fb976ad574ccc0,
+    0x924502c512f39380, 0xdc4630926b6491a9, 0x06f8a53dace3cee9,
+    0xfbe3b4e64b6431ac, 0x215d21498ce36eec, 0x930d387a2b65d1a3,
+    0x49b3add5ece28ee3, 0xb4a8bc0e0b6571a6, 0x6e1629a1cce22ee6,
+    0x42d02142eb6611bd, 0x986eb4ed2ce14efd, 0x6575a536cb66b1b8,
+    0xbfcb30990ce1eef8, 0x0d9b29aaab6751b7, 0xd725bc056ce00ef7,
+    0x2a3eadde8b67f1b2, 0xf08038714ce0aef2, 0x73b2bc18c46f8f04,
+    0xa90c29b703e8d044, 0x5417386ce46f2f01, 0x8ea9adc323e87041,
+    0x3cf9b4f0846ecf0e, 0xe647215f43e9904e, 0x1b5c3084a46e6f0b,
+    0xc1e2a52b63e9304b, 0xed24adc8446d0f10, 0x379a386783ea5050,
+    0xca8129bc646daf15, 0x103fbc13a3eaf055, 0xa26fa520046c4f1a,
+    0x78d1308fc3eb105a, 0x85ca2154246cef1f, 0x5f74b4fbe3ebb05f,
+    0x19cc45fad742eb4d, 0xc372d05510c5b40d, 0x3e69c18ef7424b48,
+    0xe4d7542130c51408, 0x56874d129743ab47, 0x8c39d8bd50c4f407,
+    0x7122c966b7430b42, 0xab9c5cc970c45402, 0x875a542a57406b59,
+    0x5de4c18590c73419, 0xa0ffd05e7740cb5c, 0x7a4145f1b0c7941c,
+    0xc8115cc217412b53, 0x12afc96dd0c67413, 0xefb4d8b637418b56,
+    0x350a4d19f0c6d416, 0xb638c9707849f5e0, 0x6c865cdfbfceaaa0,
+    0x919d4d04584955e5, 0x4b23d8ab9fce0aa5, 0xf973c1983848b5ea,
+    0x23cd5437ffcfeaaa, 0xded645ec184815ef, 0x0468d043dfcf4aaf,
+    0x28aed8a0f84b75f4, 0xf2104d0f3fcc2ab4, 0x0f0b5cd4d84bd5f1,
+    0xd5b5c97b1fcc8ab1, 0x67e5d048b84a35fe, 0xbd5b45e77fcd6abe,
+    0x4040543c984a95fb, 0x9afec1935fcdcabb, 0xd4fdf3c4265ac892,
+    0x0e43666be1dd97d2, 0xf35877b0065a6897, 0x29e6e21fc1dd37d7,
+    0x9bb6fb2c665b8898, 0x41086e83a1dcd7d8, 0xbc137f58465b289d,
+    0x66adeaf781dc77dd, 0x4a6be214a6584886, 0x90d577bb61df17c6,
+    0x6dce66608658e883, 0xb770f3cf41dfb7c3, 0x0520eafce659088c,
+    0xdf9e7f5321de57cc, 0x22856e88c659a889, 0xf83bfb2701def7c9,
+    0x7b097f4e8951d63f, 0xa1b7eae14ed6897f, 0x5cacfb3aa951763a,
+    0x86126e956ed6297a, 0x344277a6c9509635, 0xeefce2090ed7c975,
+    0x13e7f3d2e9503630, 0xc959667d2ed76970, 0xe59f6e9e0953562b,
+    0x3f21fb31ced4096b, 0xc23aeaea2953f62e, 0x18847f45eed4a96e,
+    0xaad4667649521621, 0x706af3d98ed54961, 0x8d71e2026952b624,
+    0x57cf77adaed5e964},
+   {0x0000000000000000, 0x22ef0d5934f964ec, 0x45de1ab269f2c9d8,
+    0x673117eb5d0bad34, 0x8bbc3564d3e593b0, 0xa953383de71cf75c,
+    0xce622fd6ba175a68, 0xec8d228f8eee3e84, 0x85a0c5e208c539e5,
+    0xa74fc8bb3c3c5d09, 0xc07edf506137f03d, 0xe291d20955ce94d1,
+    0x0e1cf086db20aa55, 0x2cf3fddfefd9ceb9, 0x4bc2ea34b2d2638d,
+    0x692de76d862b0761, 0x999924efbe846d4f, 0xbb7629b68a7d09a3,
+    0xdc473e5dd776a497, 0xfea83304e38fc07b, 0x1225118b6d61feff,
+    0x30ca1cd259989a13, 0x57fb0b3904933727, 0x75140660306a53cb,
+    0x1c39e10db64154aa, 0x3ed6ec5482b83046, 0x59e7fbbfdfb39d72,
+    0x7b08f6e6eb4af99e, 0x9785d46965a4c71a, 0xb56ad930515da3f6,
+    0xd25bcedb0c560ec2, 0xf0b4c38238af6a2e, 0xa1eae6f4d206c41b,
+    0x8305ebade6ffa0f7, 0xe434fc46bbf40dc3, 0xc6dbf11f8f0d692f,
+    0x2a56d39001e357ab, 0x08b9dec9351a3347, 0x6f88c92268119e73,
+    0x4d67c47b5ce8fa9f, 0x244a2316dac3fdfe, 0x06a52e4fee3a9912,
+    0x619439a4b3313426, 0x437b34fd87c850ca, 0xaff6167209266e4e,
+    0x8d191b2b3ddf0aa2, 0xea280cc060d4a796, 0xc8c70199542dc37a,
+    0x3873c21b6c82a954, 0x1a9ccf42587bcdb8, 0x7dadd8a90570608c,
+    0x5f42d5f031890460, 0xb3cff77fbf673ae4, 0x9120fa268b9e5e08,
+    0xf611edcdd695f33c, 0xd4fee094e26c97d0, 0xbdd307f9644790b1,
+    0x9f3c0aa050bef45d, 0xf80d1d4b0db55969, 0xdae21012394c3d85,
+    0x366f329db7a20301, 0x14803fc4835b67ed, 0x73b1282fde50cad9,
+    0x515e2576eaa9ae35, 0xd10d62c20b0396b3, 0xf3e26f9b3ffaf25f,
+    0x94d3787062f15f6b, 0xb63c752956083b87, 0x5ab157a6d8e60503,
+    0x785e5affec1f61ef, 0x1f6f4d14b114ccdb, 0x3d80404d85eda837,
+    0x54ada72003c6af56, 0x7642aa79373fcbba, 0x1173bd926a34668e,
+    0x339cb0cb5ecd0262, 0xdf119244d0233ce6, 0xfdfe9f1de4da580a,
+    0x9acf88f6b9d1f53e, 0xb82085af8d2891d2, 0x4894462db587fbfc,
+    0x6a7b4b74817e9f10, 0x0d4a5c9fdc753224, 0x2fa551c6e88c56c8,
+    0xc32873496662684c, 0xe1c77e10529b0ca0, 0x86f669fb0f90a194,
+    0xa41964a23b69c578, 0xcd3483cfbd42c219, 0xefdb8e9689bba6f5,
+    0x88ea997dd4b00bc1, 0xaa059424e0496f2d, 0x4688b6ab6ea751a9,
+    0x6467bbf25a5e3545, 0x0356ac1907559871, 0x21b9a14033acfc9d,
+    0x70e78436d90552a8, 0x5208896fedfc3644, 0x35399e84b0f79b70,
+    0x17d693dd840eff9c, 0xfb5bb1520ae0c118, 0xd9b4bc0b3e19a5f4,
+    0xbe85abe0631208c0, 0x9c6aa6b957eb6c2c, 0xf54741d4d1c06b4d,
+    0xd7a84c8de5390fa1, 0xb0995b66b832a295, 0x9276563f8ccbc679,
+    0x7efb74b00225f8fd, 0x5c1479e936dc9c11, 0x3b256e026bd73125,
+    0x19ca635b5f2e55c9, 0xe97ea0d967813fe7, 0xcb91ad8053785b0b,
+    0xaca0ba6b0e73f63f, 0x8e4fb7323a8a92d3, 0x62c295bdb464ac57,
+    0x402d98e4809dc8bb, 0x271c8f0fdd96658f, 0x05f38256e96f0163,
+    0x6cde653b6f440602, 0x4e3168625bbd62ee, 0x29007f8906b6cfda,
+    0x0bef72d0324fab36, 0xe762505fbca195b2, 0xc58d5d068858f15e,
+    0xa2bc4aedd5535c6a, 0x805347b4e1aa3886, 0x30c26aafb90933e3,
+    0x122d67f68df0570f, 0x751c701dd0fbfa3b, 0x57f37d44e4029ed7,
+    0xbb7e5fcb6aeca053, 0x999152925e15c4bf, 0xfea04579031e698b,
+    0xdc4f482037e70d67, 0xb562af4db1cc0a06, 0x978da21485356eea,
+    0xf0bcb5ffd83ec3de, 0xd253b8a6ecc7a732, 0x3ede9a29622999b6,
+    0x1c31977056d0fd5a, 0x7b00809b0bdb506e, 0x59ef8dc23f223482,
+    0xa95b4e40078d5eac, 0x8bb4431933743a40, 0xec8554f26e7f9774,
+    0xce6a59ab5a86f398, 0x22e77b24d468cd1c, 0x0008767de091a9f0,
+    0x67396196bd9a04c4, 0x45d66ccf89636028, 0x2cfb8ba20f486749,
+    0x0e1486fb3bb103a5, 0x6925911066baae91, 0x4bca9c495243ca7d,
+    0xa747bec6dcadf4f9, 0x85a8b39fe8549015, 0xe299a474b55f3d21,
+    0xc076a92d81a659cd, 0x91288c5b6b0ff7f8, 0xb3c781025ff69314,
+    0xd4f696e902fd3e20, 0xf6199bb036045acc, 0x1a94b93fb8ea6448,
+    0x387bb4668c1300a4, 0x5f4aa38dd118ad90, 0x7da5aed4e5e1c97c,
+    0x148849b963cace1d, 0x366744e05733aaf1, 0x5156530b0a3807c5,
+    0x73b95e523ec16329, 0x9f347cddb02f5dad, 0xbddb718484d63941,
+    0xdaea666fd9dd9475, 0xf8056b36ed24f099, 0x08b1a8b4d58b9ab7,
+    0x2a5ea5ede172fe5b, 0x4d6fb206bc79536f, 0x6f80bf5f88803783,
+    0x830d9dd0066e0907, 0xa1e2908932976deb, 0xc6d387626f9cc0df,
+    0xe43c8a3b5b65a433, 0x8d116d56dd4ea352, 0xaffe600fe9b7c7be,
+    0xc8cf77e4b4bc6a8a, 0xea207abd80450e66, 0x06ad58320eab30e2,
+    0x2442556b3a52540e, 0x437342806759f93a, 0x619c4fd953a09dd6,
+    0xe1cf086db20aa550, 0xc320053486f3c1bc, 0xa41112dfdbf86c88,
+    0x86fe1f86ef010864, 0x6a733d0961ef36e0, 0x489c30505516520c,
+    0x2fad27bb081dff38, 0x0d422ae23ce49bd4, 0x646fcd8fbacf9cb5,
+    0x4680c0d68e36f859, 0x21b1d73dd33d556d, 0x035eda64e7c43181,
+    0xefd3f8eb692a0f05, 0xcd3cf5b25dd36be9, 0xaa0de25900d8c6dd,
+    0x88e2ef003421a231, 0x78562c820c8ec81f, 0x5ab921db3877acf3,
+    0x3d883630657c01c7, 0x1f673b695185652b, 0xf3ea19e6df6b5baf,
+    0xd10514bfeb923f43, 0xb6340354b6999277, 0x94db0e0d8260f69b,
+    0xfdf6e960044bf1fa, 0xdf19e43930b29516, 0xb828f3d26db93822,
+    0x9ac7fe8b59405cce, 0x764adc04d7ae624a, 0x54a5d15de35706a6,
+    0x3394c6b6be5cab92, 0x117bcbef8aa5cf7e, 0x4025ee99600c614b,
+    0x62cae3c054f505a7, 0x05fbf42b09fea893, 0x2714f9723d07cc7f,
+    0xcb99dbfdb3e9f2fb, 0xe976d6a487109617, 0x8e47c14fda1b3b23,
+    0xaca8cc16eee25fcf, 0xc5852b7b68c958ae, 0xe76a26225c303c42,
+    0x805b31c9013b9176, 0xa2b43c9035c2f59a, 0x4e391e1fbb2ccb1e,
+    0x6cd613468fd5aff2, 0x0be704add2de02c6, 0x290809f4e627662a,
+    0xd9bcca76de880c04, 0xfb53c72fea7168e8, 0x9c62d0c4b77ac5dc,
+    0xbe8ddd9d8383a130, 0x5200ff120d6d9fb4, 0x70eff24b3994fb58,
+    0x17dee5a0649f566c, 0x3531e8f950663280, 0x5c1c0f94d64d35e1,
+    0x7ef302cde2b4510d, 0x19c21526bfbffc39, 0x3b2d187f8b4698d5,
+    0xd7a03af005a8a651, 0xf54f37a93151c2bd, 0x927e20426c5a6f89,
+    0xb0912d1b58a30b65},
+   {0x0000000000000000, 0x6184d55f721267c6, 0xc309aabee424cf8c,
+    0xa28d7fe19636a84a, 0x14cbfa566747819d, 0x754f2f091555e65b,
+    0xd7c250e883634e11, 0xb64685b7f17129d7, 0x2997f4acce8f033a,
+    0x481321f3bc9d64fc, 0xea9e5e122aabccb6, 0x8b1a8b4d58b9ab70,
+    0x3d5c0efaa9c882a7, 0x5cd8dba5dbdae561, 0xfe55a4444dec4d2b,
+    0x9fd1711b3ffe2aed, 0x532fe9599d1e0674, 0x32ab3c06ef0c61b2,
+    0x902643e7793ac9f8, 0xf1a296b80b28ae3e, 0x47e4130ffa5987e9,
+    0x2660c650884be02f, 0x84edb9b11e7d4865, 0xe5696cee6c6f2fa3,
+    0x7ab81df55391054e, 0x1b3cc8aa21836288, 0xb9b1b74bb7b5cac2,
+    0xd8356214c5a7ad04, 0x6e73e7a334d684d3, 0x0ff732fc46c4e315,
+    0xad7a4d1dd0f24b5f, 0xccfe9842a2e02c99, 0xa65fd2b33a3c0ce8,
+    0xc7db07ec482e6b2e, 0x6556780dde18c364, 0x04d2ad52ac0aa4a2,
+    0xb29428e55d7b8d75, 0xd310fdba2f69eab3, 0x719d825bb95f42f9,
+    0x10195704cb4d253f, 0x8fc8261ff4b30fd2, 0xee4cf34086a16814,
+    0x4cc18ca11097c05e, 0x2d4559fe6285a798, 0x9b03dc4993f48e4f,
+    0xfa870916e1e6e989, 0x580a76f777d041c3, 0x398ea3a805c22605,
+    0xf5703beaa7220a9c, 0x94f4eeb5d5306d5a, 0x367991544306c510,
+    0x57fd440b3114a2d6, 0xe1bbc1bcc0658b01, 0x803f14e3b277ecc7,
+    0x22b26b022441448d, 0x4336be5d5653234b, 0xdce7cf4669ad09a6,
+    0xbd631a191bbf6e60, 0x1fee65f88d89c62a, 0x7e6ab0a7ff9ba1ec,
+    0xc82c35100eea883b, 0xa9a8e04f7cf8effd, 0x0b259faeeace47b7,
+    0x6aa14af198dc2071, 0xde670a4ddb760755, 0xbfe3df12a9646093,
+    0x1d6ea0f33f52c8d9, 0x7cea75ac4d40af1f, 0xcaacf01bbc3186c8,
+    0xab282544ce23e10e, 0x09a55aa558154944, 0x68218ffa2a072e82,
+    0xf7f0fee115f9046f, 0x96742bbe67eb63a9, 0x34f9545ff1ddcbe3,
+    0x557d810083cfac25, 0xe33b04b772be85f2, 0x82bfd1e800ace234,
+    0x2032ae09969a4a7e, 0x41b67b56e4882db8, 0x8d48e31446680121,
+    0xeccc364b347a66e7, 0x4e4149aaa24ccead, 0x2fc59cf5d05ea96b,
+    0x99831942212f80bc, 0xf807cc1d533de77a, 0x5a8ab3fcc50b4f30,
+    0x3b0e66a3b71928f6, 0xa4df17b888e7021b, 0xc55bc2e7faf565dd,
+    0x67d6bd066cc3cd97, 0x065268591ed1aa51, 0xb014edeeefa08386,
+    0xd19038b19db2e440, 0x731d47500b844c0a, 0x1299920f79962bcc,
+    0x7838d8fee14a0bbd, 0x19bc0da193586c7b, 0xbb317240056ec431,
+    0xdab5a71f777ca3f7, 0x6cf322a8860d8a20, 0x0d77f7f7f41fede6,
+    0xaffa8816622945ac, 0xce7e5d49103b226a, 0x51af2c522fc50887,
+    0x302bf90d5dd76f41, 0x92a686eccbe1c70b, 0xf32253b3b9f3a0cd,
+    0x4564d6044882891a, 0x24e0035b3a90eedc, 0x866d7cbaaca64696,
+    0xe7e9a9e5deb42150, 0x2b1731a77c540dc9, 0x4a93e4f80e466a0f,
+    0xe81e9b199870c245, 0x899a4e46ea62a583, 0x3fdccbf11b138c54,
+    0x5e581eae6901eb92, 0xfcd5614fff3743d8, 0x9d51b4108d25241e,
+    0x0280c50bb2db0ef3, 0x63041054c0c96935, 0xc1896fb556ffc17f,
+    0xa00dbaea24eda6b9, 0x164b3f5dd59c8f6e, 0x77cfea02a78ee8a8,
+    0xd54295e331b840e2, 0xb4c640bc43aa2724, 0x2e16bbb019e2102f,
+    0x4f926eef6bf077e9, 0xed1f110efdc6dfa3, 0x8c9bc4518fd4b865,
+    0x3add41e67ea591b2, 0x5b5994b90cb7f674, 0xf9d4eb589a815e3e,
+    0x98503e07e89339f8, 0x07814f1cd76d1315, 0x66059a43a57f74d3,
+    0xc488e5a23349dc99, 0xa50c30fd415bbb5f, 0x134ab54ab02a9288,
+    0x72ce6015c238f54e, 0xd0431ff4540e5d04, 0xb1c7caab261c3ac2,
+    0x7d3952e984fc165b, 0x1cbd87b6f6ee719d, 0xbe30f85760d8d9d7,
+    0xdfb42d0812cabe11, 0x69f2a8bfe3bb97c6, 0x08767de091a9f000,
+    0xaafb0201079f584a, 0xcb7fd75e758d3f8c, 0x54aea6454a731561,
+    0x352a731a386172a7, 0x97a70cfbae57daed, 0xf623d9a4dc45bd2b,
+    0x40655c132d3494fc, 0x21e1894c5f26f33a, 0x836cf6adc9105b70,
+    0xe2e823f2bb023cb6, 0x8849690323de1cc7, 0xe9cdbc5c51cc7b01,
+    0x4b40c3bdc7fad34b, 0x2ac416e2b5e8b48d, 0x9c82935544999d5a,
+    0xfd06460a368bfa9c, 0x5f8b39eba0bd52d6, 0x3e0fecb4d2af3510,
+    0xa1de9dafed511ffd, 0xc05a48f09f43783b, 0x62d737110975d071,
+    0x0353e24e7b67b7b7, 0xb51567f98a169e60, 0xd491b2a6f804f9a6,
+    0x761ccd476e3251ec, 0x179818181c20362a, 0xdb66805abec01ab3,
+    0xbae25505ccd27d75, 0x186f2ae45ae4d53f, 0x79ebffbb28f6b2f9,
+    0xcfad7a0cd9879b2e, 0xae29af53ab95fce8, 0x0ca4d0b23da354a2,
+    0x6d2005ed4fb13364, 0xf2f174f6704f1989, 0x9375a1a9025d7e4f,
+    0x31f8de48946bd605, 0x507c0b17e679b1c3, 0xe63a8ea017089814,
+    0x87be5bff651affd2, 0x2533241ef32c5798, 0x44b7f141813e305e,
+    0xf071b1fdc294177a, 0x91f564a2b08670bc, 0x33781b4326b0d8f6,
+    0x52fcce1c54a2bf30, 0xe4ba4baba5d396e7, 0x853e9ef4d7c1f121,
+    0x27b3e11541f7596b, 0x4637344a33e53ead, 0xd9e645510c1b1440,
+    0xb862900e7e097386, 0x1aefefefe83fdbcc, 0x7b6b3ab09a2dbc0a,
+    0xcd2dbf076b5c95dd, 0xaca96a58194ef21b, 0x0e2415b98f785a51,
+    0x6fa0c0e6fd6a3d97, 0xa35e58a45f8a110e, 0xc2da8dfb2d9876c8,
+    0x6057f21abbaede82, 0x01d32745c9bcb944, 0xb795a2f238cd9093,
+    0xd61177ad4adff755, 0x749c084cdce95f1f, 0x1518dd13aefb38d9,
+    0x8ac9ac0891051234, 0xeb4d7957e31775f2, 0x49c006b67521ddb8,
+    0x2844d3e90733ba7e, 0x9e02565ef64293a9, 0xff8683018450f46f,
+    0x5d0bfce012665c25, 0x3c8f29bf60743be3, 0x562e634ef8a81b92,
+    0x37aab6118aba7c54, 0x9527c9f01c8cd41e, 0xf4a31caf6e9eb3d8,
+    0x42e599189fef9a0f, 0x23614c47edfdfdc9, 0x81ec33a67bcb5583,
+    0xe068e6f909d93245, 0x7fb997e2362718a8, 0x1e3d42bd44357f6e,
+    0xbcb03d5cd203d724, 0xdd34e803a011b0e2, 0x6b726db451609935,
+    0x0af6b8eb2372fef3, 0xa87bc70ab54456b9, 0xc9ff1255c756317f,
+    0x05018a1765b61de6, 0x64855f4817a47a20, 0xc60820a98192d26a,
+    0xa78cf5f6f380b5ac, 0x11ca704102f19c7b, 0x704ea51e70e3fbbd,
+    0xd2c3daffe6d553f7, 0xb3470fa094c73431, 0x2c967ebbab391edc,
+    0x4d12abe4d92b791a, 0xef9fd4054f1dd150, 0x8e1b015a3d0fb696,
+    0x385d84edcc7e9f41, 0x59d951b2be6cf887, 0xfb542e53285a50cd,
+    0x9ad0fb0c5a48370b},
+   {0x0000000000000000, 0x5c2d776033c4205e, 0xb85aeec0678840bc,
+    0xe47799a0544c60e2, 0xe26d72ab601e9ffd, 0xbe4005cb53dabfa3,
+    0x5a379c6b0796df41, 0x061aeb0b3452ff1f, 0x56024a7d6f33217f,
+    0x0a2f3d1d5cf70121, 0xee58a4bd08bb61c3, 0xb275d3dd3b7f419d,
+    0xb46f38d60f2dbe82, 0xe8424fb63ce99edc, 0x0c35d61668a5fe3e,
+    0x5018a1765b61de60, 0xac0494fade6642fe, 0xf029e39aeda262a0,
+    0x145e7a3ab9ee0242, 0x48730d5a8a2a221c, 0x4e69e651be78dd03,
+    0x124491318dbcfd5d, 0xf6330891d9f09dbf, 0xaa1e7ff1ea34bde1,
+    0xfa06de87b1556381, 0xa62ba9e7829143df, 0x425c3047d6dd233d,
+    0x1e714727e5190363, 0x186bac2cd14bfc7c, 0x4446db4ce28fdc22,
+    0xa03142ecb6c3bcc0, 0xfc1c358c85079c9e, 0xcad186de13c29b79,
+    0x96fcf1be2006bb27, 0x728b681e744adbc5, 0x2ea61f7e478efb9b,
+    0x28bcf47573dc0484, 0x74918315401824da, 0x90e61ab514544438,
+    0xcccb6dd527906466, 0x9cd3cca37cf1ba06, 0xc0febbc34f359a58,
+    0x248922631b79faba, 0x78a4550328bddae4, 0x7ebebe081cef25fb,
+    0x2293c9682f2b05a5, 0xc6e450c87b676547, 0x9ac927a848a34519,
+    0x66d51224cda4d987, 0x3af86544fe60f9d9, 0xde8ffce4aa2c993b,
+    0x82a28b8499e8b965, 0x84b8608fadba467a, 0xd89517ef9e7e6624,
+    0x3ce28e4fca3206c6, 0x60cff92ff9f62698, 0x30d75859a297f8f8,
+    0x6cfa2f399153d8a6, 0x888db699c51fb844, 0xd4a0c1f9f6db981a,
+    0xd2ba2af2c2896705, 0x8e975d92f14d475b, 0x6ae0c432a50127b9,
+    0x36cdb35296c507e7, 0x077ba297888b2877, 0x5b56d5f7bb4f0829,
+    0xbf214c57ef0368cb, 0xe30c3b37dcc74895, 0xe516d03ce895b78a,
+    0xb93ba75cdb5197d4, 0x5d4c3efc8f1df736, 0x0161499cbcd9d768,
+    0x5179e8eae7b80908, 0x0d549f8ad47c2956, 0xe923062a803049b4,
+    0xb50e714ab3f469ea, 0xb3149a4187a696f5, 0xef39ed21b462b6ab,
+    0x0b4e7481e02ed649, 0x576303e1d3eaf617, 0xab7f366d56ed6a89,
+    0xf752410d65294ad7, 0x1325d8ad31652a35, 0x4f08afcd02a10a6b,
+    0x491244c636f3f574, 0x153f33a60537d52a, 0xf148aa06517bb5c8,
+    0xad65dd6662bf9596, 0xfd7d7c1039de4bf6, 0xa1500b700a1a6ba8,
+    0x452792d05e560b4a, 0x190ae5b06d922b14, 0x1f100ebb59c0d40b,
+    0x433d79db6a04f455, 0xa74ae07b3e4894b7, 0xfb67971b0d8cb4e9,
+    0xcdaa24499b49b30e, 0x91875329a88d9350, 0x75f0ca89fcc1f3b2,
+    0x29ddbde9cf05d3ec, 0x2fc756e2fb572cf3, 0x73ea2182c8930cad,
+    0x979db8229cdf6c4f, 0xcbb0cf42af1b4c11, 0x9ba86e34f47a9271,
+    0xc7851954c7beb22f, 0x23f280f493f2d2cd, 0x7fdff794a036f293,
+    0x79c51c9f94640d8c, 0x25e86bffa7a02dd2, 0xc19ff25ff3ec4d30,
+    0x9db2853fc0286d6e, 0x61aeb0b3452ff1f0, 0x3d83c7d376ebd1ae,
+    0xd9f45e7322a7b14c, 0x85d9291311639112, 0x83c3c21825316e0d,
+    0xdfeeb57816f54e53, 0x3b992cd842b92eb1, 0x67b45bb8717d0eef,
+    0x37acface2a1cd08f, 0x6b818dae19d8f0d1, 0x8ff6140e4d949033,
+    0xd3db636e7e50b06d, 0xd5c188654a024f72, 0x89ecff0579c66f2c,
+    0x6d9b66a52d8a0fce, 0x31b611c51e4e2f90, 0x0ef7452f111650ee,
+    0x52da324f22d270b0, 0xb6adabef769e1052, 0xea80dc8f455a300c,
+    0xec9a37847108cf13, 0xb0b740e442ccef4d, 0x54c0d94416808faf,
+    0x08edae242544aff1, 0x58f50f527e257191, 0x04d878324de151cf,
+    0xe0afe19219ad312d, 0xbc8296f22a691173, 0xba987df91e3bee6c,
+    0xe6b50a992dffce32, 0x02c2933979b3aed0, 0x5eefe4594a778e8e,
+    0xa2f3d1d5cf701210, 0xfedea6b5fcb4324e, 0x1aa93f15a8f852ac,
+    0x468448759b3c72f2, 0x409ea37eaf6e8ded, 0x1cb3d41e9caaadb3,
+    0xf8c44dbec8e6cd51, 0xa4e93adefb22ed0f, 0xf4f19ba8a043336f,
+    0xa8dcecc893871331, 0x4cab7568c7cb73d3, 0x10860208f40f538d,
+    0x169ce903c05dac92, 0x4ab19e63f3998ccc, 0xaec607c3a7d5ec2e,
+    0xf2eb70a39411cc70, 0xc426c3f102d4cb97, 0x980bb4913110ebc9,
+    0x7c7c2d31655c8b2b, 0x20515a515698ab75, 0x264bb15a62ca546a,
+    0x7a66c63a510e7434, 0x9e115f9a054214d6, 0xc23c28fa36863488,
+    0x9224898c6de7eae8, 0xce09feec5e23cab6, 0x2a7e674c0a6faa54,
+    0x7653102c39ab8a0a, 0x7049fb270df97515, 0x2c648c473e3d554b,
+    0xc81315e76a7135a9, 0x943e628759b515f7, 0x6822570bdcb28969,
+    0x340f206bef76a937, 0xd078b9cbbb3ac9d5, 0x8c55ceab88fee98b,
+    0x8a4f25a0bcac1694, 0xd66252c08f6836ca, 0x3215cb60db245628,
+    0x6e38bc00e8e07676, 0x3e201d76b381a816, 0x620d6a1680458848,
+    0x867af3b6d409e8aa, 0xda5784d6e7cdc8f4, 0xdc4d6fddd39f37eb,
+    0x806018bde05b17b5, 0x6417811db4177757, 0x383af67d87d35709,
+    0x098ce7b8999d7899, 0x55a190d8aa5958c7, 0xb1d60978fe153825,
+    0xedfb7e18cdd1187b, 0xebe19513f983e764, 0xb7cce273ca47c73a,
+    0x53bb7bd39e0ba7d8, 0x0f960cb3adcf8786, 0x5f8eadc5f6ae59e6,
+    0x03a3daa5c56a79b8, 0xe7d443059126195a, 0xbbf93465a2e23904,
+    0xbde3df6e96b0c61b, 0xe1cea80ea574e645, 0x05b931aef13886a7,
+    0x599446cec2fca6f9, 0xa588734247fb3a67, 0xf9a50422743f1a39,
+    0x1dd29d8220737adb, 0x41ffeae213b75a85, 0x47e501e927e5a59a,
+    0x1bc87689142185c4, 0xffbfef29406de526, 0xa392984973a9c578,
+    0xf38a393f28c81b18, 0xafa74e5f1b0c3b46, 0x4bd0d7ff4f405ba4,
+    0x17fda09f7c847bfa, 0x11e74b9448d684e5, 0x4dca3cf47b12a4bb,
+    0xa9bda5542f5ec459, 0xf590d2341c9ae407, 0xc35d61668a5fe3e0,
+    0x9f701606b99bc3be, 0x7b078fa6edd7a35c, 0x272af8c6de138302,
+    0x213013cdea417c1d, 0x7d1d64add9855c43, 0x996afd0d8dc93ca1,
+    0xc5478a6dbe0d1cff, 0x955f2b1be56cc29f, 0xc9725c7bd6a8e2c1,
+    0x2d05c5db82e48223, 0x7128b2bbb120a27d, 0x773259b085725d62,
+    0x2b1f2ed0b6b67d3c, 0xcf68b770e2fa1dde, 0x9345c010d13e3d80,
+    0x6f59f59c5439a11e, 0x337482fc67fd8140, 0xd7031b5c33b1e1a2,
+    0x8b2e6c3c0075c1fc, 0x8d34873734273ee3, 0xd119f05707e31ebd,
+    0x356e69f753af7e5f, 0x69431e97606b5e01, 0x395bbfe13b0a8061,
+    0x6576c88108cea03f, 0x810151215c82c0dd, 0xdd2c26416f46e083,
+    0xdb36cd4a5b141f9c, 0x871bba2a68d03fc2, 0x636c238a3c9c5f20,
+    0x3f4154ea0f587f7e},
+   {0x0000000000000000, 0x1dee8a5e222ca1dc, 0x3bdd14bc445943b8,
+    0x26339ee26675e264, 0x77ba297888b28770, 0x6a54a326aa9e26ac,
+    0x4c673dc4ccebc4c8, 0x5189b79aeec76514, 0xef7452f111650ee0,
+    0xf29ad8af3349af3c, 0xd4a9464d553c4d58, 0xc947cc137710ec84,
+    0x98ce7b8999d78990, 0x8520f1d7bbfb284c, 0xa3136f35dd8eca28,
+    0xbefde56bffa26bf4, 0x4c300ac98dc40345, 0x51de8097afe8a299,
+    0x77ed1e75c99d40fd, 0x6a03942bebb1e121, 0x3b8a23b105768435,
+    0x2664a9ef275a25e9, 0x0057370d412fc78d, 0x1db9bd5363036651,
+    0xa34458389ca10da5, 0xbeaad266be8dac79, 0x98994c84d8f84e1d,
+    0x8577c6dafad4efc1, 0xd4fe714014138ad5, 0xc910fb1e363f2b09,
+    0xef2365fc504ac96d, 0xf2cdefa2726668b1, 0x986015931b88068a,
+    0x858e9fcd39a4a756, 0xa3bd012f5fd14532, 0xbe538b717dfde4ee,
+    0xefda3ceb933a81fa, 0xf234b6b5b1162026, 0xd4072857d763c242,
+    0xc9e9a209f54f639e, 0x771447620aed086a, 0x6afacd3c28c1a9b6,
+    0x4cc953de4eb44bd2, 0x5127d9806c98ea0e, 0x00ae6e1a825f8f1a,
+    0x1d40e444a0732ec6, 0x3b737aa6c606cca2, 0x269df0f8e42a6d7e,
+    0xd4501f5a964c05cf, 0xc9be9504b460a413, 0xef8d0be6d2154677,
+    0xf26381b8f039e7ab, 0xa3ea36221efe82bf, 0xbe04bc7c3cd22363,
+    0x9837229e5aa7c107, 0x85d9a8c0788b60db, 0x3b244dab87290b2f,
+    0x26cac7f5a505aaf3, 0x00f95917c3704897, 0x1d17d349e15ce94b,
+    0x4c9e64d30f9b8c5f, 0x5170ee8d2db72d83, 0x7743706f4bc2cfe7,
+    0x6aadfa3169ee6e3b, 0xa218840d981e1391, 0xbff60e53ba32b24d,
+    0x99c590b1dc475029, 0x842b1aeffe6bf1f5, 0xd5a2ad7510ac94e1,
+    0xc84c272b3280353d, 0xee7fb9c954f5d759, 0xf391339776d97685,
+    0x4d6cd6fc897b1d71, 0x50825ca2ab57bcad, 0x76b1c240cd225ec9,
+    0x6b5f481eef0eff15, 0x3ad6ff8401c99a01, 0x273875da23e53bdd,
+    0x010beb384590d9b9, 0x1ce5616667bc7865, 0xee288ec415da10d4,
+    0xf3c6049a37f6b108, 0xd5f59a785183536c, 0xc81b102673aff2b0,
+    0x9992a7bc9d6897a4, 0x847c2de2bf443678, 0xa24fb300d931d41c,
+    0xbfa1395efb1d75c0, 0x015cdc3504bf1e34, 0x1cb2566b2693bfe8,
+    0x3a81c88940e65d8c, 0x276f42d762cafc50, 0x76e6f54d8c0d9944,
+    0x6b087f13ae213898, 0x4d3be1f1c854dafc, 0x50d56bafea787b20,
+    0x3a78919e8396151b, 0x27961bc0a1bab4c7, 0x01a58522c7cf56a3,
+    0x1c4b0f7ce5e3f77f, 0x4dc2b8e60b24926b, 0x502c32b8290833b7,
+    0x761fac5a4f7dd1d3, 0x6bf126046d51700f, 0xd50cc36f92f31bfb,
+    0xc8e24931b0dfba27, 0xeed1d7d3d6aa5843, 0xf33f5d8df486f99f,
+    0xa2b6ea171a419c8b, 0xbf586049386d3d57, 0x996bfeab5e18df33,
+    0x848574f57c347eef, 0x76489b570e52165e, 0x6ba611092c7eb782,
+    0x4d958feb4a0b55e6, 0x507b05b56827f43a, 0x01f2b22f86e0912e,
+    0x1c1c3871a4cc30f2, 0x3a2fa693c2b9d296, 0x27c12ccde095734a,
+    0x993cc9a61f3718be, 0x84d243f83d1bb962, 0xa2e1dd1a5b6e5b06,
+    0xbf0f57447942fada, 0xee86e0de97859fce, 0xf3686a80b5a93e12,
+    0xd55bf462d3dcdc76, 0xc8b57e3cf1f07daa, 0xd6e9a7309f3239a7,
+    0xcb072d6ebd1e987b, 0xed34b38cdb6b7a1f, 0xf0da39d2f947dbc3,
+    0xa1538e481780bed7, 0xbcbd041635ac1f0b, 0x9a8e9af453d9fd6f,
+    0x876010aa71f55cb3, 0x399df5c18e573747, 0x24737f9fac7b969b,
+    0x0240e17dca0e74ff, 0x1fae6b23e822d523, 0x4e27dcb906e5b037,
+    0x53c956e724c911eb, 0x75fac80542bcf38f, 0x6814425b60905253,
+    0x9ad9adf912f63ae2, 0x873727a730da9b3e, 0xa104b94556af795a,
+    0xbcea331b7483d886, 0xed6384819a44bd92, 0xf08d0edfb8681c4e,
+    0xd6be903dde1dfe2a, 0xcb501a63fc315ff6, 0x75adff0803933402,
+    0x6843755621bf95de, 0x4e70ebb447ca77ba, 0x539e61ea65e6d666,
+    0x0217d6708b21b372, 0x1ff95c2ea90d12ae, 0x39cac2cccf78f0ca,
+    0x24244892ed545116, 0x4e89b2a384ba3f2d, 0x536738fda6969ef1,
+    0x7554a61fc0e37c95, 0x68ba2c41e2cfdd49, 0x39339bdb0c08b85d,
+    0x24dd11852e241981, 0x02ee8f674851fbe5, 0x1f0005396a7d5a39,
+    0xa1fde05295df31cd, 0xbc136a0cb7f39011, 0x9a20f4eed1867275,
+    0x87ce7eb0f3aad3a9, 0xd647c92a1d6db6bd, 0xcba943743f411761,
+    0xed9add965934f505, 0xf07457c87b1854d9, 0x02b9b86a097e3c68,
+    0x1f5732342b529db4, 0x3964acd64d277fd0, 0x248a26886f0bde0c,
+    0x7503911281ccbb18, 0x68ed1b4ca3e01ac4, 0x4ede85aec595f8a0,
+    0x53300ff0e7b9597c, 0xedcdea9b181b3288, 0xf02360c53a379354,
+    0xd610fe275c427130, 0xcbfe74797e6ed0ec, 0x9a77c3e390a9b5f8,
+    0x879949bdb2851424, 0xa1aad75fd4f0f640, 0xbc445d01f6dc579c,
+    0x74f1233d072c2a36, 0x691fa96325008bea, 0x4f2c37814375698e,
+    0x52c2bddf6159c852, 0x034b0a458f9ead46, 0x1ea5801badb20c9a,
+    0x38961ef9cbc7eefe, 0x257894a7e9eb4f22, 0x9b8571cc164924d6,
+    0x866bfb923465850a, 0xa05865705210676e, 0xbdb6ef2e703cc6b2,
+    0xec3f58b49efba3a6, 0xf1d1d2eabcd7027a, 0xd7e24c08daa2e01e,
+    0xca0cc656f88e41c2, 0x38c129f48ae82973, 0x252fa3aaa8c488af,
+    0x031c3d48ceb16acb, 0x1ef2b716ec9dcb17, 0x4f7b008c025aae03,
+    0x52958ad220760fdf, 0x74a614304603edbb, 0x69489e6e642f4c67,
+    0xd7b57b059b8d2793, 0xca5bf15bb9a1864f, 0xec686fb9dfd4642b,
+    0xf186e5e7fdf8c5f7, 0xa00f527d133fa0e3, 0xbde1d8233113013f,
+    0x9bd246c15766e35b, 0x863ccc9f754a4287, 0xec9136ae1ca42cbc,
+    0xf17fbcf03e888d60, 0xd74c221258fd6f04, 0xcaa2a84c7ad1ced8,
+    0x9b2b1fd69416abcc, 0x86c59588b63a0a10, 0xa0f60b6ad04fe874,
+    0xbd188134f26349a8, 0x03e5645f0dc1225c, 0x1e0bee012fed8380,
+    0x383870e3499861e4, 0x25d6fabd6bb4c038, 0x745f4d278573a52c,
+    0x69b1c779a75f04f0, 0x4f82599bc12ae694, 0x526cd3c5e3064748,
+    0xa0a13c6791602ff9, 0xbd4fb639b34c8e25, 0x9b7c28dbd5396c41,
+    0x8692a285f715cd9d, 0xd71b151f19d2a889, 0xcaf59f413bfe0955,
+    0xecc601a35d8beb31, 0xf1288bfd7fa74aed, 0x4fd56e9680052119,
+    0x523be4c8a22980c5, 0x74087a2ac45c62a1, 0x69e6f074e670c37d,
+    0x386f47ee08b7a669, 0x2581cdb02a9b07b5, 0x03b253524ceee5d1,
+    0x1e5cd90c6ec2440d},
+   {0x0000000000000000, 0x3f0be14a916a6dcb, 0x7e17c29522d4db96,
+    0x411c23dfb3beb65d, 0xfc2f852a45a9b72c, 0xc3246460d4c3dae7,
+    0x823847bf677d6cba, 0xbd33a6f5f6170171, 0x6a87a57f245d70dd,
+    0x558c4435b5371d16, 0x149067ea0689ab4b, 0x2b9b86a097e3c680,
+    0x96a8205561f4c7f1, 0xa9a3c11ff09eaa3a, 0xe8bfe2c043201c67,
+    0xd7b4038ad24a71ac, 0xd50f4afe48bae1ba, 0xea04abb4d9d08c71,
+    0xab18886b6a6e3a2c, 0x94136921fb0457e7, 0x2920cfd40d135696,
+    0x162b2e9e9c793b5d, 0x57370d412fc78d00, 0x683cec0bbeade0cb,
+    0xbf88ef816ce79167, 0x80830ecbfd8dfcac, 0xc19f2d144e334af1,
+    0xfe94cc5edf59273a, 0x43a76aab294e264b, 0x7cac8be1b8244b80,
+    0x3db0a83e0b9afddd, 0x02bb49749af09016, 0x38c63ad73e7bddf1,
+    0x07cddb9daf11b03a, 0x46d1f8421caf0667, 0x79da19088dc56bac,
+    0xc4e9bffd7bd26add, 0xfbe25eb7eab80716, 0xbafe7d685906b14b,
+    0x85f59c22c86cdc80, 0x52419fa81a26ad2c, 0x6d4a7ee28b4cc0e7,
+    0x2c565d3d38f276ba, 0x135dbc77a9981b71, 0xae6e1a825f8f1a00,
+    0x9165fbc8cee577cb, 0xd079d8177d5bc196, 0xef72395dec31ac5d,
+    0xedc9702976c13c4b, 0xd2c29163e7ab5180, 0x93deb2bc5415e7dd,
+    0xacd553f6c57f8a16, 0x11e6f50333688b67, 0x2eed1449a202e6ac,
+    0x6ff1379611bc50f1, 0x50fad6dc80d63d3a, 0x874ed556529c4c96,
+    0xb845341cc3f6215d, 0xf95917c370489700, 0xc652f689e122facb,
+    0x7b61507c1735fbba, 0x446ab136865f9671, 0x057692e935e1202c,
+    0x3a7d73a3a48b4de7, 0x718c75ae7cf7bbe2, 0x4e8794e4ed9dd629,
+    0x0f9bb73b5e236074, 0x30905671cf490dbf, 0x8da3f084395e0cce,
+    0xb2a811cea8346105, 0xf3b432111b8ad758, 0xccbfd35b8ae0ba93,
+    0x1b0bd0d158aacb3f, 0x2400319bc9c0a6f4, 0x651c12447a7e10a9,
+    0x5a17f30eeb147d62, 0xe72455fb1d037c13, 0xd82fb4b18c6911d8,
+    0x9933976e3fd7a785, 0xa6387624aebdca4e, 0xa4833f50344d5a58,
+    0x9b88de1aa5273793, 0xda94fdc5169981ce, 0xe59f1c8f87f3ec05,
+    0x58acba7a71e4ed74, 0x67a75b30e08e80bf, 0x26bb78ef533036e2,
+    0x19b099a5c25a5b29, 0xce049a2f10102a85, 0xf10f7b65817a474e,
+    0xb01358ba32c4f113, 0x8f18b9f0a3ae9cd8, 0x322b1f0555b99da9,
+    0x0d20fe4fc4d3f062, 0x4c3cdd90776d463f, 0x73373cdae6072bf4,
+    0x494a4f79428c6613, 0x7641ae33d3e60bd8, 0x375d8dec6058bd85,
+    0x08566ca6f132d04e, 0xb565ca530725d13f, 0x8a6e2b19964fbcf4,
+    0xcb7208c625f10aa9, 0xf479e98cb49b6762, 0x23cdea0666d116ce,
+    0x1cc60b4cf7bb7b05, 0x5dda28934405cd58, 0x62d1c9d9d56fa093,
+    0xdfe26f2c2378a1e2, 0xe0e98e66b212cc29, 0xa1f5adb901ac7a74,
+    0x9efe4cf390c617bf, 0x9c4505870a3687a9, 0xa34ee4cd9b5cea62,
+    0xe252c71228e25c3f, 0xdd592658b98831f4, 0x606a80ad4f9f3085,
+    0x5f6161e7def55d4e, 0x1e7d42386d4beb13, 0x2176a372fc2186d8,
+    0xf6c2a0f82e6bf774, 0xc9c941b2bf019abf, 0x88d5626d0cbf2ce2,
+    0xb7de83279dd54129, 0x0aed25d26bc24058, 0x35e6c498faa82d93,
+    0x74fae74749169bce, 0x4bf1060dd87cf605, 0xe318eb5cf9ef77c4,
+    0xdc130a1668851a0f, 0x9d0f29c9db3bac52, 0xa204c8834a51c199,
+    0x1f376e76bc46c0e8, 0x203c8f3c2d2cad23, 0x6120ace39e921b7e,
+    0x5e2b4da90ff876b5, 0x899f4e23ddb20719, 0xb694af694cd86ad2,
+    0xf7888cb6ff66dc8f, 0xc8836dfc6e0cb144, 0x75b0cb09981bb035,
+    0x4abb2a430971ddfe, 0x0ba7099cbacf6ba3, 0x34ace8d62ba50668,
+    0x3617a1a2b155967e, 0x091c40e8203ffbb5, 0x4800633793814de8,
+    0x770b827d02eb2023, 0xca382488f4fc2152, 0xf533c5c265964c99,
+    0xb42fe61dd628fac4, 0x8b2407574742970f, 0x5c9004dd9508e6a3,
+    0x639be59704628b68, 0x2287c648b7dc3d35, 0x1d8c270226b650fe,
+    0xa0bf81f7d0a1518f, 0x9fb460bd41cb3c44, 0xdea84362f2758a19,
+    0xe1a3a228631fe7d2, 0xdbded18bc794aa35, 0xe4d530c156fec7fe,
+    0xa5c9131ee54071a3, 0x9ac2f254742a1c68, 0x27f154a1823d1d19,
+    0x18fab5eb135770d2, 0x59e69634a0e9c68f, 0x66ed777e3183ab44,
+    0xb15974f4e3c9dae8, 0x8e5295be72a3b723, 0xcf4eb661c11d017e,
+    0xf045572b50776cb5, 0x4d76f1dea6606dc4, 0x727d1094370a000f,
+    0x3361334b84b4b652, 0x0c6ad20115dedb99, 0x0ed19b758f2e4b8f,
+    0x31da7a3f1e442644, 0x70c659e0adfa9019, 0x4fcdb8aa3c90fdd2,
+    0xf2fe1e5fca87fca3, 0xcdf5ff155bed9168, 0x8ce9dccae8532735,
+    0xb3e23d8079394afe, 0x64563e0aab733b52, 0x5b5ddf403a195699,
+    0x1a41fc9f89a7e0c4, 0x254a1dd518cd8d0f, 0x9879bb20eeda8c7e,
+    0xa7725a6a7fb0e1b5, 0xe66e79b5cc0e57e8, 0xd96598ff5d643a23,
+    0x92949ef28518cc26, 0xad9f7fb81472a1ed, 0xec835c67a7cc17b0,
+    0xd388bd2d36a67a7b, 0x6ebb1bd8c0b17b0a, 0x51b0fa9251db16c1,
+    0x10acd94de265a09c, 0x2fa73807730fcd57, 0xf8133b8da145bcfb,
+    0xc718dac7302fd130, 0x8604f9188391676d, 0xb90f185212fb0aa6,
+    0x043cbea7e4ec0bd7, 0x3b375fed7586661c, 0x7a2b7c32c638d041,
+    0x45209d785752bd8a, 0x479bd40ccda22d9c, 0x789035465cc84057,
+    0x398c1699ef76f60a, 0x0687f7d37e1c9bc1, 0xbbb45126880b9ab0,
+    0x84bfb06c1961f77b, 0xc5a393b3aadf4126, 0xfaa872f93bb52ced,
+    0x2d1c7173e9ff5d41, 0x121790397895308a, 0x530bb3e6cb2b86d7,
+    0x6c0052ac5a41eb1c, 0xd133f459ac56ea6d, 0xee3815133d3c87a6,
+    0xaf2436cc8e8231fb, 0x902fd7861fe85c30, 0xaa52a425bb6311d7,
+    0x9559456f2a097c1c, 0xd44566b099b7ca41, 0xeb4e87fa08dda78a,
+    0x567d210ffecaa6fb, 0x6976c0456fa0cb30, 0x286ae39adc1e7d6d,
+    0x176102d04d7410a6, 0xc0d5015a9f3e610a, 0xffdee0100e540cc1,
+    0xbec2c3cfbdeaba9c, 0x81c922852c80d757, 0x3cfa8470da97d626,
+    0x03f1653a4bfdbbed, 0x42ed46e5f8430db0, 0x7de6a7af6929607b,
+    0x7f5deedbf3d9f06d, 0x40560f9162b39da6, 0x014a2c4ed10d2bfb,
+    0x3e41cd0440674630, 0x83726bf1b6704741, 0xbc798abb271a2a8a,
+    0xfd65a96494a49cd7, 0xc26e482e05cef11c, 0x15da4ba4d78480b0,
+    0x2ad1aaee46eeed7b, 0x6bcd8931f5505b26, 0x54c6687b643a36ed,
+    0xe9f5ce8e922d379c, 0xd6fe2fc403475a57, 0x97e20c1bb0f9ec0a,
+    0xa8e9ed51219381c1},
+   {0x0000000000000000, 0x54e979925cd0f10d, 0xa9d2f324b9a1e21a,
+    0xfd3b8ab6e5711317, 0xc17d4962dc4ddab1, 0x959430f0809d2bbc,
+    0x68afba4665ec38ab, 0x3c46c3d4393cc9a6, 0x10223dee1795abe7,
+    0x44cb447c4b455aea, 0xb9f0cecaae3449fd, 0xed19b758f2e4b8f0,
+    0xd15f748ccbd87156, 0x85b60d1e9708805b, 0x788d87a87279934c,
+    0x2c64fe3a2ea96241, 0x20447bdc2f2b57ce, 0x74ad024e73fba6c3,
+    0x899688f8968ab5d4, 0xdd7ff16aca5a44d9, 0xe13932bef3668d7f,
+    0xb5d04b2cafb67c72, 0x48ebc19a4ac76f65, 0x1c02b80816179e68,
+    0x3066463238befc29, 0x648f3fa0646e0d24, 0x99b4b516811f1e33,
+    0xcd5dcc84ddcfef3e, 0xf11b0f50e4f32698, 0xa5f276c2b823d795,
+    0x58c9fc745d52c482, 0x0c2085e60182358f, 0x4088f7b85e56af9c,
+    0x14618e2a02865e91, 0xe95a049ce7f74d86, 0xbdb37d0ebb27bc8b,
+    0x81f5beda821b752d, 0xd51cc748decb8420, 0x28274dfe3bba9737,
+    0x7cce346c676a663a, 0x50aaca5649c3047b, 0x0443b3c41513f576,
+    0xf9783972f062e661, 0xad9140e0acb2176c, 0x91d78334958edeca,
+    0xc53efaa6c95e2fc7, 0x380570102c2f3cd0, 0x6cec098270ffcddd,
+    0x60cc8c64717df852, 0x3425f5f62dad095f, 0xc91e7f40c8dc1a48,
+    0x9df706d2940ceb45, 0xa1b1c506ad3022e3, 0xf558bc94f1e0d3ee,
+    0x086336221491c0f9, 0x5c8a4fb0484131f4, 0x70eeb18a66e853b5,
+    0x2407c8183a38a2b8, 0xd93c42aedf49b1af, 0x8dd53b3c839940a2,
+    0xb193f8e8baa58904, 0xe57a817ae6757809, 0x18410bcc03046b1e,
+    0x4ca8725e5fd49a13, 0x8111ef70bcad5f38, 0xd5f896e2e07dae35,
+    0x28c31c54050cbd22, 0x7c2a65c659dc4c2f, 0x406ca61260e08589,
+    0x1485df803c307484, 0xe9be5536d9416793, 0xbd572ca48591969e,
+    0x9133d29eab38f4df, 0xc5daab0cf7e805d2, 0x38e121ba129916c5,
+    0x6c0858284e49e7c8, 0x504e9bfc77752e6e, 0x04a7e26e2ba5df63,
+    0xf99c68d8ced4cc74, 0xad75114a92043d79, 0xa15594ac938608f6,
+    0xf5bced3ecf56f9fb, 0x088767882a27eaec, 0x5c6e1e1a76f71be1,
+    0x6028ddce4fcbd247, 0x34c1a45c131b234a, 0xc9fa2eeaf66a305d,
+    0x9d135778aabac150, 0xb177a9428413a311, 0xe59ed0d0d8c3521c,
+    0x18a55a663db2410b, 0x4c4c23f46162b006, 0x700ae020585e79a0,
+    0x24e399b2048e88ad, 0xd9d81304e1ff9bba, 0x8d316a96bd2f6ab7,
+    0xc19918c8e2fbf0a4, 0x9570615abe2b01a9, 0x684bebec5b5a12be,
+    0x3ca2927e078ae3b3, 0x00e451aa3eb62a15, 0x540d28386266db18,
+    0xa936a28e8717c80f, 0xfddfdb1cdbc73902, 0xd1bb2526f56e5b43,
+    0x85525cb4a9beaa4e, 0x7869d6024ccfb959, 0x2c80af90101f4854,
+    0x10c66c44292381f2, 0x442f15d675f370ff, 0xb9149f60908263e8,
+    0xedfde6f2cc5292e5, 0xe1dd6314cdd0a76a, 0xb5341a8691005667,
+    0x480f903074714570, 0x1ce6e9a228a1b47d, 0x20a02a76119d7ddb,
+    0x744953e44d4d8cd6, 0x8972d952a83c9fc1, 0xdd9ba0c0f4ec6ecc,
+    0xf1ff5efada450c8d, 0xa51627688695fd80, 0x582dadde63e4ee97,
+    0x0cc4d44c3f341f9a, 0x308217980608d63c, 0x646b6e0a5ad82731,
+    0x9950e4bcbfa93426, 0xcdb99d2ee379c52b, 0x90fb71cad654a0f5,
+    0xc41208588a8451f8, 0x392982ee6ff542ef, 0x6dc0fb7c3325b3e2,
+    0x518638a80a197a44, 0x056f413a56c98b49, 0xf854cb8cb3b8985e,
+    0xacbdb21eef686953, 0x80d94c24c1c10b12, 0xd43035b69d11fa1f,
+    0x290bbf007860e908, 0x7de2c69224b01805, 0x41a405461d8cd1a3,
+    0x154d7cd4415c20ae, 0xe876f662a42d33b9, 0xbc9f8ff0f8fdc2b4,
+    0xb0bf0a16f97ff73b, 0xe4567384a5af0636, 0x196df93240de1521,
+    0x4d8480a01c0ee42c, 0x71c2437425322d8a, 0x252b3ae679e2dc87,
+    0xd810b0509c93cf90, 0x8cf9c9c2c0433e9d, 0xa09d37f8eeea5cdc,
+    0xf4744e6ab23aadd1, 0x094fc4dc574bbec6, 0x5da6bd4e0b9b4fcb,
+    0x61e07e9a32a7866d, 0x350907086e777760, 0xc8328dbe8b066477,
+    0x9cdbf42cd7d6957a, 0xd073867288020f69, 0x849affe0d4d2fe64,
+    0x79a1755631a3ed73, 0x2d480cc46d731c7e, 0x110ecf10544fd5d8,
+    0x45e7b682089f24d5, 0xb8dc3c34edee37c2, 0xec3545a6b13ec6cf,
+    0xc051bb9c9f97a48e, 0x94b8c20ec3475583, 0x698348b826364694,
+    0x3d6a312a7ae6b799, 0x012cf2fe43da7e3f, 0x55c58b6c1f0a8f32,
+    0xa8fe01dafa7b9c25, 0xfc177848a6ab6d28, 0xf037fdaea72958a7,
+    0xa4de843cfbf9a9aa, 0x59e50e8a1e88babd, 0x0d0c771842584bb0,
+    0x314ab4cc7b648216, 0x65a3cd5e27b4731b, 0x989847e8c2c5600c,
+    0xcc713e7a9e159101, 0xe015c040b0bcf340, 0xb4fcb9d2ec6c024d,
+    0x49c73364091d115a, 0x1d2e4af655cde057, 0x216889226cf129f1,
+    0x7581f0b03021d8fc, 0x88ba7a06d550cbeb, 0xdc53039489803ae6,
+    0x11ea9eba6af9ffcd, 0x4503e72836290ec0, 0xb8386d9ed3581dd7,
+    0xecd1140c8f88ecda, 0xd097d7d8b6b4257c, 0x847eae4aea64d471,
+    0x794524fc0f15c766, 0x2dac5d6e53c5366b, 0x01c8a3547d6c542a,
+    0x5521dac621bca527, 0xa81a5070c4cdb630, 0xfcf329e2981d473d,
+    0xc0b5ea36a1218e9b, 0x945c93a4fdf17f96, 0x6967191218806c81,
+    0x3d8e608044509d8c, 0x31aee56645d2a803, 0x65479cf41902590e,
+    0x987c1642fc734a19, 0xcc956fd0a0a3bb14, 0xf0d3ac04999f72b2,
+    0xa43ad596c54f83bf, 0x59015f20203e90a8, 0x0de826b27cee61a5,
+    0x218cd888524703e4, 0x7565a11a0e97f2e9, 0x885e2bacebe6e1fe,
+    0xdcb7523eb73610f3, 0xe0f191ea8e0ad955, 0xb418e878d2da2858,
+    0x492362ce37ab3b4f, 0x1dca1b5c6b7bca42, 0x5162690234af5051,
+    0x058b1090687fa15c, 0xf8b09a268d0eb24b, 0xac59e3b4d1de4346,
+    0x901f2060e8e28ae0, 0xc4f659f2b4327bed, 0x39cdd344514368fa,
+    0x6d24aad60d9399f7, 0x414054ec233afbb6, 0x15a92d7e7fea0abb,
+    0xe892a7c89a9b19ac, 0xbc7bde5ac64be8a1, 0x803d1d8eff772107,
+    0xd4d4641ca3a7d00a, 0x29efeeaa46d6c31d, 0x7d0697381a063210,
+    0x712612de1b84079f, 0x25cf6b4c4754f692, 0xd8f4e1faa225e585,
+    0x8c1d9868fef51488, 0xb05b5bbcc7c9dd2e, 0xe4b2222e9b192c23,
+    0x1989a8987e683f34, 0x4d60d10a22b8ce39, 0x61042f300c11ac78,
+    0x35ed56a250c15d75, 0xc8d6dc14b5b04e62, 0x9c3fa586e960bf6f,
+    0xa0796652d05c76c9, 0xf4901fc08c8c87c4, 0x09ab957669fd94d3,
+    0x5d42ece4352d65de},
+   {0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b,
+    0x47aa7ae9abe7ff34, 0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c,
+    0x8f54f5d357cffe68, 0x3c7ab96d5468a107, 0xf7a18709ff1ebc66,
+    0x448fcbb7fcb9e309, 0x0325b15e575e1c3d, 0xb00bfde054f94352,
+    0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e,
+    0xcbdb3e64ab761d61, 0x7d9ba13851336649, 0xceb5ed8652943926,
+    0x891f976ff973c612, 0x3a31dbd1fad4997d, 0x064b62bcaebc387a,
+    0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+    0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74,
+    0xcd905cd805ca251b, 0xf1eae5b551a2841c, 0x42c4a90b5205db73,
+    0x056ed3e2f9e22447, 0xb6409f5cfa457b28, 0xfb374270a266cc92,
+    0x48190ecea1c193fd, 0x0fb374270a266cc9, 0xbc9d3899098133a6,
+    0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa,
+    0xc74dfb1df60e6d95, 0x0c96c5795d7870f4, 0xbfb889c75edf2f9b,
+    0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0, 0x774606fda2f72ec7,
+    0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+    0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80,
+    0xc10699a158b255ef, 0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87,
+    0x09f8169ba49a54b3, 0xbad65a25a73d0bdc, 0x710d64410c4b16bd,
+    0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+    0x0adda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5,
+    0x4d77dd2c5823b7ba, 0x64b62bcaebc387a1, 0xd7986774e864d8ce,
+    0x90321d9d438327fa, 0x231c512340247895, 0x1f66e84e144cd992,
+    0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+    0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c,
+    0xd4bdd62abf3ac4f3, 0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b,
+    0x1c4359104312c5af, 0xaf6d15ae40b59ac0, 0x192d8af2baf0e1e8,
+    0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+    0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80,
+    0x2557339fee9840ef, 0xee8c0dfb45ee5d8e, 0x5da24145464902e1,
+    0x1a083bacedaefdd5, 0xa9267712ee09a2ba, 0x955cce7fba6103bd,
+    0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+    0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68,
+    0xd82b1353e242b407, 0xe451aa3eb62a1500, 0x577fe680b58d4a6f,
+    0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34, 0x6820eeb3b6bbf755,
+    0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+    0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d,
+    0x545a57dee2d35652, 0xe21ac88218962d7a, 0x5134843c1b317215,
+    0x169efed5b0d68d21, 0xa5b0b26bb371d24e, 0x99ca0b06e7197349,
+    0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+    0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147,
+    0x521135624c6f6e28, 0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040,
+    0x9aefba58b0476f74, 0x29c1f6e6b3e0301b, 0xc96c5795d7870f42,
+    0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+    0xb2bc941128085171, 0x0192d8af2baf0e1e, 0x4638a2468048f12a,
+    0xf516eef883efae45, 0x3ecdd09c2899b324, 0x8de39c222b3eec4b,
+    0xca49e6cb80d9137f, 0x7967aa75837e4c10, 0x451d1318d716ed17,
+    0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x02b769f17cf11223,
+    0xb4f7f6ad86b4690b, 0x07d9ba1385133664, 0x4073c0fa2ef4c950,
+    0xf35d8c442d53963f, 0xcf273529793b3738, 0x7c0979977a9c6857,
+    0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c, 0x435671a479aad56d,
+    0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x04fc0b4dd24d2a59,
+    0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05,
+    0x7f2cc8c92dc2746a, 0x325b15e575e1c3d0, 0x8175595b76469cbf,
+    0xc6df23b2dda1638b, 0x75f16f0cde063ce4, 0x498bd6618a6e9de3,
+    0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0x0e21ac88218962d7,
+    0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed,
+    0x8250e80521188082, 0xbe2a516875702185, 0x0d041dd676d77eea,
+    0x4aae673fdd3081de, 0xf9802b81de97deb1, 0x4fc0b4dd24d2a599,
+    0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x086ace348f355aad,
+    0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1,
+    0x73ba0db070ba049e, 0xb86133d4dbcc19ff, 0x0b4f7f6ad86b4690,
+    0x4ce50583738cb9a4, 0xffcb493d702be6cb, 0xc3b1f050244347cc,
+    0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+    0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8,
+    0xea7006b697a377d7, 0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf,
+    0x228e898c6b8b768b, 0x91a0c532682c29e4, 0x5a7bfb56c35a3485,
+    0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+    0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed,
+    0x6601423b97329582, 0xd041dd676d77eeaa, 0x636f91d96ed0b1c5,
+    0x24c5eb30c5374ef1, 0x97eba78ec690119e, 0xab911ee392f8b099,
+    0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+    0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297,
+    0x604a2087398eadf8, 0x5c3099ea6de60cff, 0xef1ed5546e415390,
+    0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb, 0x56ed3e2f9e224471,
+    0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+    0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19,
+    0x6a978742ca4ae576, 0xa14cb926613cf817, 0x1262f598629ba778,
+    0x55c88f71c97c584c, 0xe6e6c3cfcadb0723, 0xda9c7aa29eb3a624,
+    0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+    0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263,
+    0x6cdce5fe64f6dd0c, 0x50a65c93309e7c0b, 0xe388102d33392364,
+    0xa4226ac498dedc50, 0x170c267a9b79833f, 0xdcd7181e300f9e5e,
+    0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+    0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036,
+    0xe0ada17364673f59}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0x6f5fa703be4c2eb3, 0x5ba040a8573684f4,
+    0x34ffe7abe97aaa47, 0x335e8fff84c3d07b, 0x5c0128fc3a8ffec8,
+    0x68fecf57d3f5548f, 0x07a168546db97a3c, 0x66bc1eff0987a1f7,
+    0x09e3b9fcb7cb8f44, 0x3d1c5e575eb12503, 0x5243f954e0fd0bb0,
+    0x55e291008d44718c, 0x3abd360333085f3f, 0x0e42d1a8da72f578,
+    0x611d76ab643edbcb, 0x4966335138a19b7d, 0x2639945286edb5ce,
+    0x12c673f96f971f89, 0x7d99d4fad1db313a, 0x7a38bcaebc624b06,
+    0x15671bad022e65b5, 0x2198fc06eb54cff2, 0x4ec75b055518e141,
+    0x2fda2dae31263a8a, 0x40858aad8f6a1439, 0x747a6d066610be7e,
+    0x1b25ca05d85c90cd, 0x1c84a251b5e5eaf1, 0x73db05520ba9c442,
+    0x4724e2f9e2d36e05, 0x287b45fa5c9f40b6, 0x92cc66a2704237fb,
+    0xfd93c1a1ce0e1948, 0xc96c260a2774b30f, 0xa633810999389dbc,
+    0xa192e95df481e780, 0xcecd4e5e4acdc933, 0xfa32a9f5a3b76374,
+    0x956d0ef61dfb4dc7, 0xf470785d79c5960c, 0x9b2fdf5ec789b8bf,
+    0xafd038f52ef312f8, 0xc08f9ff690bf3c4b, 0xc72ef7a2fd064677,
+    0xa87150a1434a68c4, 0x9c8eb70aaa30c283, 0xf3d11009147cec30,
+    0xdbaa55f348e3ac86, 0xb4f5f2f0f6af8235, 0x800a155b1fd52872,
+    0xef55b258a19906c1, 0xe8f4da0ccc207cfd, 0x87ab7d0f726c524e,
+    0xb3549aa49b16f809, 0xdc0b3da7255ad6ba, 0xbd164b0c41640d71,
+    0xd249ec0fff2823c2, 0xe6b60ba416528985, 0x89e9aca7a81ea736,
+    0x8e48c4f3c5a7dd0a, 0xe11763f07bebf3b9, 0xd5e8845b929159fe,
+    0xbab723582cdd774d, 0xa187c3ebca2bb664, 0xced864e8746798d7,
+    0xfa2783439d1d3290, 0x9578244023511c23, 0x92d94c144ee8661f,
+    0xfd86eb17f0a448ac, 0xc9790cbc19dee2eb, 0xa626abbfa792cc58,
+    0xc73bdd14c3ac1793, 0xa8647a177de03920, 0x9c9b9dbc949a9367,
+    0xf3c43abf2ad6bdd4, 0xf46552eb476fc7e8, 0x9b3af5e8f923e95b,
+    0xafc512431059431c, 0xc09ab540ae156daf, 0xe8e1f0baf28a2d19,
+    0x87be57b94cc603aa, 0xb341b012a5bca9ed, 0xdc1e17111bf0875e,
+    0xdbbf7f457649fd62, 0xb4e0d846c805d3d1, 0x801f3fed217f7996,
+    0xef4098ee9f335725, 0x8e5dee45fb0d8cee, 0xe10249464541a25d,
+    0xd5fdaeedac3b081a, 0xbaa209ee127726a9, 0xbd0361ba7fce5c95,
+    0xd25cc6b9c1827226, 0xe6a3211228f8d861, 0x89fc861196b4f6d2,
+    0x334ba549ba69819f, 0x5c14024a0425af2c, 0x68ebe5e1ed5f056b,
+    0x07b442e253132bd8, 0x00152ab63eaa51e4, 0x6f4a8db580e67f57,
+    0x5bb56a1e699cd510, 0x34eacd1dd7d0fba3, 0x55f7bbb6b3ee2068,
+    0x3aa81cb50da20edb, 0x0e57fb1ee4d8a49c, 0x61085c1d5a948a2f,
+    0x66a93449372df013, 0x09f6934a8961dea0, 0x3d0974e1601b74e7,
+    0x5256d3e2de575a54, 0x7a2d961882c81ae2, 0x1572311b3c843451,
+    0x218dd6b0d5fe9e16, 0x4ed271b36bb2b0a5, 0x497319e7060bca99,
+    0x262cbee4b847e42a, 0x12d3594f513d4e6d, 0x7d8cfe4cef7160de,
+    0x1c9188e78b4fbb15, 0x73ce2fe4350395a6, 0x4731c84fdc793fe1,
+    0x286e6f4c62351152, 0x2fcf07180f8c6b6e, 0x4090a01bb1c045dd,
+    0x746f47b058baef9a, 0x1b30e0b3e6f6c129, 0x420f87d795576cc9,
+    0x2d5020d42b1b427a, 0x19afc77fc261e83d, 0x76f0607c7c2dc68e,
+    0x715108281194bcb2, 0x1e0eaf2bafd89201, 0x2af1488046a23846,
+    0x45aeef83f8ee16f5, 0x24b399289cd0cd3e, 0x4bec3e2b229ce38d,
+    0x7f13d980cbe649ca, 0x104c7e8375aa6779, 0x17ed16d718131d45,
+    0x78b2b1d4a65f33f6, 0x4c4d567f4f2599b1, 0x2312f17cf169b702,
+    0x0b69b486adf6f7b4, 0x6436138513bad907, 0x50c9f42efac07340,
+    0x3f96532d448c5df3, 0x38373b79293527cf, 0x57689c7a9779097c,
+    0x63977bd17e03a33b, 0x0cc8dcd2c04f8d88, 0x6dd5aa79a4715643,
+    0x028a0d7a1a3d78f0, 0x3675ead1f347d2b7, 0x592a4dd24d0bfc04,
+    0x5e8b258620b28638, 0x31d482859efea88b, 0x052b652e778402cc,
+    0x6a74c22dc9c82c7f, 0xd0c3e175e5155b32, 0xbf9c46765b597581,
+    0x8b63a1ddb223dfc6, 0xe43c06de0c6ff175, 0xe39d6e8a61d68b49,
+    0x8cc2c989df9aa5fa, 0xb83d2e2236e00fbd, 0xd762892188ac210e,
+    0xb67fff8aec92fac5, 0xd920588952ded476, 0xeddfbf22bba47e31,
+    0x8280182105e85082, 0x8521707568512abe, 0xea7ed776d61d040d,
+    0xde8130dd3f67ae4a, 0xb1de97de812b80f9, 0x99a5d224ddb4c04f,
+    0xf6fa752763f8eefc, 0xc205928c8a8244bb, 0xad5a358f34ce6a08,
+    0xaafb5ddb59771034, 0xc5a4fad8e73b3e87, 0xf15b1d730e4194c0,
+    0x9e04ba70b00dba73, 0xff19ccdbd43361b8, 0x90466bd86a7f4f0b,
+    0xa4b98c738305e54c, 0xcbe62b703d49cbff, 0xcc47432450f0b1c3,
+    0xa318e427eebc9f70, 0x97e7038c07c63537, 0xf8b8a48fb98a1b84,
+    0xe388443c5f7cdaad, 0x8cd7e33fe130f41e, 0xb8280494084a5e59,
+    0xd777a397b60670ea, 0xd0d6cbc3dbbf0ad6, 0xbf896cc065f32465,
+    0x8b768b6b8c898e22, 0xe4292c6832c5a091, 0x85345ac356fb7b5a,
+    0xea6bfdc0e8b755e9, 0xde941a6b01cdffae, 0xb1cbbd68bf81d11d,
+    0xb66ad53cd238ab21, 0xd935723f6c748592, 0xedca9594850e2fd5,
+    0x829532973b420166, 0xaaee776d67dd41d0, 0xc5b1d06ed9916f63,
+    0xf14e37c530ebc524, 0x9e1190c68ea7eb97, 0x99b0f892e31e91ab,
+    0xf6ef5f915d52bf18, 0xc210b83ab428155f, 0xad4f1f390a643bec,
+    0xcc5269926e5ae027, 0xa30dce91d016ce94, 0x97f2293a396c64d3,
+    0xf8ad8e3987204a60, 0xff0ce66dea99305c, 0x9053416e54d51eef,
+    0xa4aca6c5bdafb4a8, 0xcbf301c603e39a1b, 0x7144229e2f3eed56,
+    0x1e1b859d9172c3e5, 0x2ae46236780869a2, 0x45bbc535c6444711,
+    0x421aad61abfd3d2d, 0x2d450a6215b1139e, 0x19baedc9fccbb9d9,
+    0x76e54aca4287976a, 0x17f83c6126b94ca1, 0x78a79b6298f56212,
+    0x4c587cc9718fc855, 0x2307dbcacfc3e6e6, 0x24a6b39ea27a9cda,
+    0x4bf9149d1c36b269, 0x7f06f336f54c182e, 0x105954354b00369d,
+    0x382211cf179f762b, 0x577db6cca9d35898, 0x6382516740a9f2df,
+    0x0cddf664fee5dc6c, 0x0b7c9e30935ca650, 0x642339332d1088e3,
+    0x50dcde98c46a22a4, 0x3f83799b7a260c17, 0x5e9e0f301e18d7dc,
+    0x31c1a833a054f96f, 0x053e4f98492e5328, 0x6a61e89bf7627d9b,
+    0x6dc080cf9adb07a7, 0x029f27cc24972914, 0x3660c067cded8353,
+    0x593f676473a1ade0},
+   {0x0000000000000000, 0x0df1d05c9279e954, 0x1ae2a1b924f3d2a9,
+    0x171371e5b68a3bfd, 0xb1da4ddc62497dc1, 0xbc2b9d80f0309495,
+    0xab38ec6546baaf68, 0xa6c93c39d4c3463c, 0xe7ab9517ee3d2210,
+    0xea5a454b7c44cb44, 0xfd4934aecacef0b9, 0xf0b8e4f258b719ed,
+    0x5671d8cb8c745fd1, 0x5b8008971e0db685, 0x4c937972a8878d78,
+    0x4162a92e3afe642c, 0xce572b2fdc7b4420, 0xc3a6fb734e02ad74,
+    0xd4b58a96f8889689, 0xd9445aca6af17fdd, 0x7f8d66f3be3239e1,
+    0x727cb6af2c4bd0b5, 0x656fc74a9ac1eb48, 0x689e171608b8021c,
+    0x29fcbe3832466630, 0x240d6e64a03f8f64, 0x331e1f8116b5b499,
+    0x3eefcfdd84cc5dcd, 0x9826f3e4500f1bf1, 0x95d723b8c276f2a5,
+    0x82c4525d74fcc958, 0x8f358201e685200c, 0x9caf565eb8f78840,
+    0x915e86022a8e6114, 0x864df7e79c045ae9, 0x8bbc27bb0e7db3bd,
+    0x2d751b82dabef581, 0x2084cbde48c71cd5, 0x3797ba3bfe4d2728,
+    0x3a666a676c34ce7c, 0x7b04c34956caaa50, 0x76f51315c4b34304,
+    0x61e662f0723978f9, 0x6c17b2ace04091ad, 0xcade8e953483d791,
+    0xc72f5ec9a6fa3ec5, 0xd03c2f2c10700538, 0xddcdff708209ec6c,
+    0x52f87d71648ccc60, 0x5f09ad2df6f52534, 0x481adcc8407f1ec9,
+    0x45eb0c94d206f79d, 0xe32230ad06c5b1a1, 0xeed3e0f194bc58f5,
+    0xf9c0911422366308, 0xf4314148b04f8a5c, 0xb553e8668ab1ee70,
+    0xb8a2383a18c80724, 0xafb149dfae423cd9, 0xa24099833c3bd58d,
+    0x0489a5bae8f893b1, 0x097875e67a817ae5, 0x1e6b0403cc0b4118,
+    0x139ad45f5e72a84c, 0x385fadbc70ef1181, 0x35ae7de0e296f8d5,
+    0x22bd0c05541cc328, 0x2f4cdc59c6652a7c, 0x8985e06012a66c40,
+    0x8474303c80df8514, 0x936741d93655bee9, 0x9e969185a42c57bd,
+    0xdff438ab9ed23391, 0xd205e8f70cabdac5, 0xc5169912ba21e138,
+    0xc8e7494e2858086c, 0x6e2e7577fc9b4e50, 0x63dfa52b6ee2a704,
+    0x74ccd4ced8689cf9, 0x793d04924a1175ad, 0xf6088693ac9455a1,
+    0xfbf956cf3eedbcf5, 0xecea272a88678708, 0xe11bf7761a1e6e5c,
+    0x47d2cb4fcedd2860, 0x4a231b135ca4c134, 0x5d306af6ea2efac9,
+    0x50c1baaa7857139d, 0x11a3138442a977b1, 0x1c52c3d8d0d09ee5,
+    0x0b41b23d665aa518, 0x06b06261f4234c4c, 0xa0795e5820e00a70,
+    0xad888e04b299e324, 0xba9bffe10413d8d9, 0xb76a2fbd966a318d,
+    0xa4f0fbe2c81899c1, 0xa9012bbe5a617095, 0xbe125a5beceb4b68,
+    0xb3e38a077e92a23c, 0x152ab63eaa51e400, 0x18db666238280d54,
+    0x0fc817878ea236a9, 0x0239c7db1cdbdffd, 0x435b6ef52625bbd1,
+    0x4eaabea9b45c5285, 0x59b9cf4c02d66978, 0x54481f1090af802c,
+    0xf2812329446cc610, 0xff70f375d6152f44, 0xe8638290609f14b9,
+    0xe59252ccf2e6fded, 0x6aa7d0cd1463dde1, 0x67560091861a34b5,
+    0x7045717430900f48, 0x7db4a128a2e9e61c, 0xdb7d9d11762aa020,
+    0xd68c4d4de4534974, 0xc19f3ca852d97289, 0xcc6eecf4c0a09bdd,
+    0x8d0c45dafa5efff1, 0x80fd9586682716a5, 0x97eee463dead2d58,
+    0x9a1f343f4cd4c40c, 0x3cd6080698178230, 0x3127d85a0a6e6b64,
+    0x2634a9bfbce45099, 0x2bc579e32e9db9cd, 0xf5a054d6ca71fb90,
+    0xf851848a580812c4, 0xef42f56fee822939, 0xe2b325337cfbc06d,
+    0x447a190aa8388651, 0x498bc9563a416f05, 0x5e98b8b38ccb54f8,
+    0x536968ef1eb2bdac, 0x120bc1c1244cd980, 0x1ffa119db63530d4,
+    0x08e9607800bf0b29, 0x0518b02492c6e27d, 0xa3d18c1d4605a441,
+    0xae205c41d47c4d15, 0xb9332da462f676e8, 0xb4c2fdf8f08f9fbc,
+    0x3bf77ff9160abfb0, 0x3606afa5847356e4, 0x2115de4032f96d19,
+    0x2ce40e1ca080844d, 0x8a2d32257443c271, 0x87dce279e63a2b25,
+    0x90cf939c50b010d8, 0x9d3e43c0c2c9f98c, 0xdc5ceaeef8379da0,
+    0xd1ad3ab26a4e74f4, 0xc6be4b57dcc44f09, 0xcb4f9b0b4ebda65d,
+    0x6d86a7329a7ee061, 0x6077776e08070935, 0x7764068bbe8d32c8,
+    0x7a95d6d72cf4db9c, 0x690f0288728673d0, 0x64fed2d4e0ff9a84,
+    0x73eda3315675a179, 0x7e1c736dc40c482d, 0xd8d54f5410cf0e11,
+    0xd5249f0882b6e745, 0xc237eeed343cdcb8, 0xcfc63eb1a64535ec,
+    0x8ea4979f9cbb51c0, 0x835547c30ec2b894, 0x94463626b8488369,
+    0x99b7e67a2a316a3d, 0x3f7eda43fef22c01, 0x328f0a1f6c8bc555,
+    0x259c7bfada01fea8, 0x286daba6487817fc, 0xa75829a7aefd37f0,
+    0xaaa9f9fb3c84dea4, 0xbdba881e8a0ee559, 0xb04b584218770c0d,
+    0x1682647bccb44a31, 0x1b73b4275ecda365, 0x0c60c5c2e8479898,
+    0x0191159e7a3e71cc, 0x40f3bcb040c015e0, 0x4d026cecd2b9fcb4,
+    0x5a111d096433c749, 0x57e0cd55f64a2e1d, 0xf129f16c22896821,
+    0xfcd82130b0f08175, 0xebcb50d5067aba88, 0xe63a8089940353dc,
+    0xcdfff96aba9eea11, 0xc00e293628e70345, 0xd71d58d39e6d38b8,
+    0xdaec888f0c14d1ec, 0x7c25b4b6d8d797d0, 0x71d464ea4aae7e84,
+    0x66c7150ffc244579, 0x6b36c5536e5dac2d, 0x2a546c7d54a3c801,
+    0x27a5bc21c6da2155, 0x30b6cdc470501aa8, 0x3d471d98e229f3fc,
+    0x9b8e21a136eab5c0, 0x967ff1fda4935c94, 0x816c801812196769,
+    0x8c9d504480608e3d, 0x03a8d24566e5ae31, 0x0e590219f49c4765,
+    0x194a73fc42167c98, 0x14bba3a0d06f95cc, 0xb2729f9904acd3f0,
+    0xbf834fc596d53aa4, 0xa8903e20205f0159, 0xa561ee7cb226e80d,
+    0xe403475288d88c21, 0xe9f2970e1aa16575, 0xfee1e6ebac2b5e88,
+    0xf31036b73e52b7dc, 0x55d90a8eea91f1e0, 0x5828dad278e818b4,
+    0x4f3bab37ce622349, 0x42ca7b6b5c1bca1d, 0x5150af3402696251,
+    0x5ca17f6890108b05, 0x4bb20e8d269ab0f8, 0x4643ded1b4e359ac,
+    0xe08ae2e860201f90, 0xed7b32b4f259f6c4, 0xfa68435144d3cd39,
+    0xf799930dd6aa246d, 0xb6fb3a23ec544041, 0xbb0aea7f7e2da915,
+    0xac199b9ac8a792e8, 0xa1e84bc65ade7bbc, 0x072177ff8e1d3d80,
+    0x0ad0a7a31c64d4d4, 0x1dc3d646aaeeef29, 0x1032061a3897067d,
+    0x9f07841bde122671, 0x92f654474c6bcf25, 0x85e525a2fae1f4d8,
+    0x8814f5fe68981d8c, 0x2eddc9c7bc5b5bb0, 0x232c199b2e22b2e4,
+    0x343f687e98a88919, 0x39ceb8220ad1604d, 0x78ac110c302f0461,
+    0x755dc150a256ed35, 0x624eb0b514dcd6c8, 0x6fbf60e986a53f9c,
+    0xc9765cd0526679a0, 0xc4878c8cc01f90f4, 0xd394fd697695ab09,
+    0xde652d35e4ec425d},
+   {0x0000000000000000, 0xcb6d6a914ae10b3f, 0x96dbd42295c2177e,
+    0x5db6beb3df231c41, 0x2cb7a9452a852ffc, 0xe7dac3d4606424c3,
+    0xba6c7d67bf473882, 0x710117f6f5a633bd, 0xdd705d247fa5876a,
+    0x161d37b535448c55, 0x4bab8906ea679014, 0x80c6e397a0869b2b,
+    0xf1c7f4615520a896, 0x3aaa9ef01fc1a3a9, 0x671c2043c0e2bfe8,
+    0xac714ad28a03b4d7, 0xbae1ba48fe4a0fd5, 0x718cd0d9b4ab04ea,
+    0x2c3a6e6a6b8818ab, 0xe75704fb21691394, 0x9656130dd4cf2029,
+    0x5d3b799c9e2e2b16, 0x008dc72f410d3757, 0xcbe0adbe0bec3c68,
+    0x6791e76c81ef88bf, 0xacfc8dfdcb0e8380, 0xf14a334e142d9fc1,
+    0x3a2759df5ecc94fe, 0x4b264e29ab6aa743, 0x804b24b8e18bac7c,
+    0xddfd9a0b3ea8b03d, 0x1690f09a7449bb02, 0xf1dd7b3ed73ac638,
+    0x3ab011af9ddbcd07, 0x6706af1c42f8d146, 0xac6bc58d0819da79,
+    0xdd6ad27bfdbfe9c4, 0x1607b8eab75ee2fb, 0x4bb10659687dfeba,
+    0x80dc6cc8229cf585, 0x2cad261aa89f4152, 0xe7c04c8be27e4a6d,
+    0xba76f2383d5d562c, 0x711b98a977bc5d13, 0x001a8f5f821a6eae,
+    0xcb77e5cec8fb6591, 0x96c15b7d17d879d0, 0x5dac31ec5d3972ef,
+    0x4b3cc1762970c9ed, 0x8051abe76391c2d2, 0xdde71554bcb2de93,
+    0x168a7fc5f653d5ac, 0x678b683303f5e611, 0xace602a24914ed2e,
+    0xf150bc119637f16f, 0x3a3dd680dcd6fa50, 0x964c9c5256d54e87,
+    0x5d21f6c31c3445b8, 0x00974870c31759f9, 0xcbfa22e189f652c6,
+    0xbafb35177c50617b, 0x71965f8636b16a44, 0x2c20e135e9927605,
+    0xe74d8ba4a3737d3a, 0xe2bbf77cae758c71, 0x29d69dede494874e,
+    0x7460235e3bb79b0f, 0xbf0d49cf71569030, 0xce0c5e3984f0a38d,
+    0x056134a8ce11a8b2, 0x58d78a1b1132b4f3, 0x93bae08a5bd3bfcc,
+    0x3fcbaa58d1d00b1b, 0xf4a6c0c99b310024, 0xa9107e7a44121c65,
+    0x627d14eb0ef3175a, 0x137c031dfb5524e7, 0xd811698cb1b42fd8,
+    0x85a7d73f6e973399, 0x4ecabdae247638a6, 0x585a4d34503f83a4,
+    0x933727a51ade889b, 0xce819916c5fd94da, 0x05ecf3878f1c9fe5,
+    0x74ede4717abaac58, 0xbf808ee0305ba767, 0xe2363053ef78bb26,
+    0x295b5ac2a599b019, 0x852a10102f9a04ce, 0x4e477a81657b0ff1,
+    0x13f1c432ba5813b0, 0xd89caea3f0b9188f, 0xa99db955051f2b32,
+    0x62f0d3c44ffe200d, 0x3f466d7790dd3c4c, 0xf42b07e6da3c3773,
+    0x13668c42794f4a49, 0xd80be6d333ae4176, 0x85bd5860ec8d5d37,
+    0x4ed032f1a66c5608, 0x3fd1250753ca65b5, 0xf4bc4f96192b6e8a,
+    0xa90af125c60872cb, 0x62679bb48ce979f4, 0xce16d16606eacd23,
+    0x057bbbf74c0bc61c, 0x58cd05449328da5d, 0x93a06fd5d9c9d162,
+    0xe2a178232c6fe2df, 0x29cc12b2668ee9e0, 0x747aac01b9adf5a1,
+    0xbf17c690f34cfe9e, 0xa987360a8705459c, 0x62ea5c9bcde44ea3,
+    0x3f5ce22812c752e2, 0xf43188b9582659dd, 0x85309f4fad806a60,
+    0x4e5df5dee761615f, 0x13eb4b6d38427d1e, 0xd88621fc72a37621,
+    0x74f76b2ef8a0c2f6, 0xbf9a01bfb241c9c9, 0xe22cbf0c6d62d588,
+    0x2941d59d2783deb7, 0x5840c26bd225ed0a, 0x932da8fa98c4e635,
+    0xce9b164947e7fa74, 0x05f67cd80d06f14b, 0xc477eff95ceb18e3,
+    0x0f1a8568160a13dc, 0x52ac3bdbc9290f9d, 0x99c1514a83c804a2,
+    0xe8c046bc766e371f, 0x23ad2c2d3c8f3c20, 0x7e1b929ee3ac2061,
+    0xb576f80fa94d2b5e, 0x1907b2dd234e9f89, 0xd26ad84c69af94b6,
+    0x8fdc66ffb68c88f7, 0x44b10c6efc6d83c8, 0x35b01b9809cbb075,
+    0xfedd7109432abb4a, 0xa36bcfba9c09a70b, 0x6806a52bd6e8ac34,
+    0x7e9655b1a2a11736, 0xb5fb3f20e8401c09, 0xe84d819337630048,
+    0x2320eb027d820b77, 0x5221fcf4882438ca, 0x994c9665c2c533f5,
+    0xc4fa28d61de62fb4, 0x0f9742475707248b, 0xa3e60895dd04905c,
+    0x688b620497e59b63, 0x353ddcb748c68722, 0xfe50b62602278c1d,
+    0x8f51a1d0f781bfa0, 0x443ccb41bd60b49f, 0x198a75f26243a8de,
+    0xd2e71f6328a2a3e1, 0x35aa94c78bd1dedb, 0xfec7fe56c130d5e4,
+    0xa37140e51e13c9a5, 0x681c2a7454f2c29a, 0x191d3d82a154f127,
+    0xd2705713ebb5fa18, 0x8fc6e9a03496e659, 0x44ab83317e77ed66,
+    0xe8dac9e3f47459b1, 0x23b7a372be95528e, 0x7e011dc161b64ecf,
+    0xb56c77502b5745f0, 0xc46d60a6def1764d, 0x0f000a3794107d72,
+    0x52b6b4844b336133, 0x99dbde1501d26a0c, 0x8f4b2e8f759bd10e,
+    0x4426441e3f7ada31, 0x1990faade059c670, 0xd2fd903caab8cd4f,
+    0xa3fc87ca5f1efef2, 0x6891ed5b15fff5cd, 0x352753e8cadce98c,
+    0xfe4a3979803de2b3, 0x523b73ab0a3e5664, 0x9956193a40df5d5b,
+    0xc4e0a7899ffc411a, 0x0f8dcd18d51d4a25, 0x7e8cdaee20bb7998,
+    0xb5e1b07f6a5a72a7, 0xe8570eccb5796ee6, 0x233a645dff9865d9,
+    0x26cc1885f29e9492, 0xeda17214b87f9fad, 0xb017cca7675c83ec,
+    0x7b7aa6362dbd88d3, 0x0a7bb1c0d81bbb6e, 0xc116db5192fab051,
+    0x9ca065e24dd9ac10, 0x57cd0f730738a72f, 0xfbbc45a18d3b13f8,
+    0x30d12f30c7da18c7, 0x6d67918318f90486, 0xa60afb1252180fb9,
+    0xd70bece4a7be3c04, 0x1c668675ed5f373b, 0x41d038c6327c2b7a,
+    0x8abd5257789d2045, 0x9c2da2cd0cd49b47, 0x5740c85c46359078,
+    0x0af676ef99168c39, 0xc19b1c7ed3f78706, 0xb09a0b882651b4bb,
+    0x7bf761196cb0bf84, 0x2641dfaab393a3c5, 0xed2cb53bf972a8fa,
+    0x415dffe973711c2d, 0x8a30957839901712, 0xd7862bcbe6b30b53,
+    0x1ceb415aac52006c, 0x6dea56ac59f433d1, 0xa6873c3d131538ee,
+    0xfb31828ecc3624af, 0x305ce81f86d72f90, 0xd71163bb25a452aa,
+    0x1c7c092a6f455995, 0x41cab799b06645d4, 0x8aa7dd08fa874eeb,
+    0xfba6cafe0f217d56, 0x30cba06f45c07669, 0x6d7d1edc9ae36a28,
+    0xa610744dd0026117, 0x0a613e9f5a01d5c0, 0xc10c540e10e0deff,
+    0x9cbaeabdcfc3c2be, 0x57d7802c8522c981, 0x26d697da7084fa3c,
+    0xedbbfd4b3a65f103, 0xb00d43f8e546ed42, 0x7b602969afa7e67d,
+    0x6df0d9f3dbee5d7f, 0xa69db362910f5640, 0xfb2b0dd14e2c4a01,
+    0x3046674004cd413e, 0x414770b6f16b7283, 0x8a2a1a27bb8a79bc,
+    0xd79ca49464a965fd, 0x1cf1ce052e486ec2, 0xb08084d7a44bda15,
+    0x7bedee46eeaad12a, 0x265b50f53189cd6b, 0xed363a647b68c654,
+    0x9c372d928ecef5e9, 0x575a4703c42ffed6, 0x0aecf9b01b0ce297,
+    0xc181932151ede9a8},
+   {0x0000000000000000, 0xdca12c225e8aee1d, 0xb8435944bc14dd3b,
+    0x64e27566e29e3326, 0x7087b2887829ba77, 0xac269eaa26a3546a,
+    0xc8c4ebccc43d674c, 0x1465c7ee9ab78951, 0xe00e6511f15274ef,
+    0x3caf4933afd89af2, 0x584d3c554d46a9d4, 0x84ec107713cc47c9,
+    0x9089d799897bce98, 0x4c28fbbbd7f12085, 0x28ca8edd356f13a3,
+    0xf46ba2ff6be5fdbe, 0x4503c48dc90a304c, 0x99a2e8af9780de51,
+    0xfd409dc9751eed77, 0x21e1b1eb2b94036a, 0x35847605b1238a3b,
+    0xe9255a27efa96426, 0x8dc72f410d375700, 0x5166036353bdb91d,
+    0xa50da19c385844a3, 0x79ac8dbe66d2aabe, 0x1d4ef8d8844c9998,
+    0xc1efd4fadac67785, 0xd58a13144071fed4, 0x092b3f361efb10c9,
+    0x6dc94a50fc6523ef, 0xb1686672a2efcdf2, 0x8a06881b93156098,
+    0x56a7a439cd9f8e85, 0x3245d15f2f01bda3, 0xeee4fd7d718b53be,
+    0xfa813a93eb3cdaef, 0x262016b1b5b634f2, 0x42c263d7572807d4,
+    0x9e634ff509a2e9c9, 0x6a08ed0a62471477, 0xb6a9c1283ccdfa6a,
+    0xd24bb44ede53c94c, 0x0eea986c80d92751, 0x1a8f5f821a6eae00,
+    0xc62e73a044e4401d, 0xa2cc06c6a67a733b, 0x7e6d2ae4f8f09d26,
+    0xcf054c965a1f50d4, 0x13a460b40495bec9, 0x774615d2e60b8def,
+    0xabe739f0b88163f2, 0xbf82fe1e2236eaa3, 0x6323d23c7cbc04be,
+    0x07c1a75a9e223798, 0xdb608b78c0a8d985, 0x2f0b2987ab4d243b,
+    0xf3aa05a5f5c7ca26, 0x974870c31759f900, 0x4be95ce149d3171d,
+    0x5f8c9b0fd3649e4c, 0x832db72d8dee7051, 0xe7cfc24b6f704377,
+    0x3b6eee6931faad6a, 0x91131e980d8418a2, 0x4db232ba530ef6bf,
+    0x295047dcb190c599, 0xf5f16bfeef1a2b84, 0xe194ac1075ada2d5,
+    0x3d3580322b274cc8, 0x59d7f554c9b97fee, 0x8576d976973391f3,
+    0x711d7b89fcd66c4d, 0xadbc57aba25c8250, 0xc95e22cd40c2b176,
+    0x15ff0eef1e485f6b, 0x019ac90184ffd63a, 0xdd3be523da753827,
+    0xb9d9904538eb0b01, 0x6578bc676661e51c, 0xd410da15c48e28ee,
+    0x08b1f6379a04c6f3, 0x6c538351789af5d5, 0xb0f2af7326101bc8,
+    0xa497689dbca79299, 0x783644bfe22d7c84, 0x1cd431d900b34fa2,
+    0xc0751dfb5e39a1bf, 0x341ebf0435dc5c01, 0xe8bf93266b56b21c,
+    0x8c5de64089c8813a, 0x50fcca62d7426f27, 0x44990d8c4df5e676,
+    0x983821ae137f086b, 0xfcda54c8f1e13b4d, 0x207b78eaaf6bd550,
+    0x1b1596839e91783a, 0xc7b4baa1c01b9627, 0xa356cfc72285a501,
+    0x7ff7e3e57c0f4b1c, 0x6b92240be6b8c24d, 0xb7330829b8322c50,
+    0xd3d17d4f5aac1f76, 0x0f70516d0426f16b, 0xfb1bf3926fc30cd5,
+    0x27badfb03149e2c8, 0x4358aad6d3d7d1ee, 0x9ff986f48d5d3ff3,
+    0x8b9c411a17eab6a2, 0x573d6d38496058bf, 0x33df185eabfe6b99,
+    0xef7e347cf5748584, 0x5e16520e579b4876, 0x82b77e2c0911a66b,
+    0xe6550b4aeb8f954d, 0x3af42768b5057b50, 0x2e91e0862fb2f201,
+    0xf230cca471381c1c, 0x96d2b9c293a62f3a, 0x4a7395e0cd2cc127,
+    0xbe18371fa6c93c99, 0x62b91b3df843d284, 0x065b6e5b1adde1a2,
+    0xdafa427944570fbf, 0xce9f8597dee086ee, 0x123ea9b5806a68f3,
+    0x76dcdcd362f45bd5, 0xaa7df0f13c7eb5c8, 0xa739329f30a7e9d6,
+    0x7b981ebd6e2d07cb, 0x1f7a6bdb8cb334ed, 0xc3db47f9d239daf0,
+    0xd7be8017488e53a1, 0x0b1fac351604bdbc, 0x6ffdd953f49a8e9a,
+    0xb35cf571aa106087, 0x4737578ec1f59d39, 0x9b967bac9f7f7324,
+    0xff740eca7de14002, 0x23d522e8236bae1f, 0x37b0e506b9dc274e,
+    0xeb11c924e756c953, 0x8ff3bc4205c8fa75, 0x535290605b421468,
+    0xe23af612f9add99a, 0x3e9bda30a7273787, 0x5a79af5645b904a1,
+    0x86d883741b33eabc, 0x92bd449a818463ed, 0x4e1c68b8df0e8df0,
+    0x2afe1dde3d90bed6, 0xf65f31fc631a50cb, 0x0234930308ffad75,
+    0xde95bf2156754368, 0xba77ca47b4eb704e, 0x66d6e665ea619e53,
+    0x72b3218b70d61702, 0xae120da92e5cf91f, 0xcaf078cfccc2ca39,
+    0x165154ed92482424, 0x2d3fba84a3b2894e, 0xf19e96a6fd386753,
+    0x957ce3c01fa65475, 0x49ddcfe2412cba68, 0x5db8080cdb9b3339,
+    0x8119242e8511dd24, 0xe5fb5148678fee02, 0x395a7d6a3905001f,
+    0xcd31df9552e0fda1, 0x1190f3b70c6a13bc, 0x757286d1eef4209a,
+    0xa9d3aaf3b07ece87, 0xbdb66d1d2ac947d6, 0x6117413f7443a9cb,
+    0x05f5345996dd9aed, 0xd954187bc85774f0, 0x683c7e096ab8b902,
+    0xb49d522b3432571f, 0xd07f274dd6ac6439, 0x0cde0b6f88268a24,
+    0x18bbcc8112910375, 0xc41ae0a34c1bed68, 0xa0f895c5ae85de4e,
+    0x7c59b9e7f00f3053, 0x88321b189beacded, 0x5493373ac56023f0,
+    0x3071425c27fe10d6, 0xecd06e7e7974fecb, 0xf8b5a990e3c3779a,
+    0x241485b2bd499987, 0x40f6f0d45fd7aaa1, 0x9c57dcf6015d44bc,
+    0x362a2c073d23f174, 0xea8b002563a91f69, 0x8e69754381372c4f,
+    0x52c85961dfbdc252, 0x46ad9e8f450a4b03, 0x9a0cb2ad1b80a51e,
+    0xfeeec7cbf91e9638, 0x224febe9a7947825, 0xd6244916cc71859b,
+    0x0a85653492fb6b86, 0x6e671052706558a0, 0xb2c63c702eefb6bd,
+    0xa6a3fb9eb4583fec, 0x7a02d7bcead2d1f1, 0x1ee0a2da084ce2d7,
+    0xc2418ef856c60cca, 0x7329e88af429c138, 0xaf88c4a8aaa32f25,
+    0xcb6ab1ce483d1c03, 0x17cb9dec16b7f21e, 0x03ae5a028c007b4f,
+    0xdf0f7620d28a9552, 0xbbed03463014a674, 0x674c2f646e9e4869,
+    0x93278d9b057bb5d7, 0x4f86a1b95bf15bca, 0x2b64d4dfb96f68ec,
+    0xf7c5f8fde7e586f1, 0xe3a03f137d520fa0, 0x3f01133123d8e1bd,
+    0x5be36657c146d29b, 0x87424a759fcc3c86, 0xbc2ca41cae3691ec,
+    0x608d883ef0bc7ff1, 0x046ffd5812224cd7, 0xd8ced17a4ca8a2ca,
+    0xccab1694d61f2b9b, 0x100a3ab68895c586, 0x74e84fd06a0bf6a0,
+    0xa84963f2348118bd, 0x5c22c10d5f64e503, 0x8083ed2f01ee0b1e,
+    0xe4619849e3703838, 0x38c0b46bbdfad625, 0x2ca57385274d5f74,
+    0xf0045fa779c7b169, 0x94e62ac19b59824f, 0x484706e3c5d36c52,
+    0xf92f6091673ca1a0, 0x258e4cb339b64fbd, 0x416c39d5db287c9b,
+    0x9dcd15f785a29286, 0x89a8d2191f151bd7, 0x5509fe3b419ff5ca,
+    0x31eb8b5da301c6ec, 0xed4aa77ffd8b28f1, 0x19210580966ed54f,
+    0xc58029a2c8e43b52, 0xa1625cc42a7a0874, 0x7dc370e674f0e669,
+    0x69a6b708ee476f38, 0xb5079b2ab0cd8125, 0xd1e5ee4c5253b203,
+    0x0d44c26e0cd95c1e},
+   {0x0000000000000000, 0x5e20c43360772d5c, 0xbc408867c0ee5ab8,
+    0xe2604c54a09977e4, 0xfd9f1e60ab726de2, 0xa3bfda53cb0540be,
+    0x41df96076b9c375a, 0x1fff52340beb1a06, 0x7f21336f7d4a0256,
+    0x2101f75c1d3d2f0a, 0xc361bb08bda458ee, 0x9d417f3bddd375b2,
+    0x82be2d0fd6386fb4, 0xdc9ee93cb64f42e8, 0x3efea56816d6350c,
+    0x60de615b76a11850, 0xfe4266defa9404ac, 0xa062a2ed9ae329f0,
+    0x4202eeb93a7a5e14, 0x1c222a8a5a0d7348, 0x03dd78be51e6694e,
+    0x5dfdbc8d31914412, 0xbf9df0d9910833f6, 0xe1bd34eaf17f1eaa,
+    0x816355b187de06fa, 0xdf439182e7a92ba6, 0x3d23ddd647305c42,
+    0x630319e52747711e, 0x7cfc4bd12cac6b18, 0x22dc8fe24cdb4644,
+    0xc0bcc3b6ec4231a0, 0x9e9c07858c351cfc, 0x799bc213de86d1ca,
+    0x27bb0620bef1fc96, 0xc5db4a741e688b72, 0x9bfb8e477e1fa62e,
+    0x8404dc7375f4bc28, 0xda24184015839174, 0x38445414b51ae690,
+    0x66649027d56dcbcc, 0x06baf17ca3ccd39c, 0x589a354fc3bbfec0,
+    0xbafa791b63228924, 0xe4dabd280355a478, 0xfb25ef1c08bebe7e,
+    0xa5052b2f68c99322, 0x4765677bc850e4c6, 0x1945a348a827c99a,
+    0x87d9a4cd2412d566, 0xd9f960fe4465f83a, 0x3b992caae4fc8fde,
+    0x65b9e899848ba282, 0x7a46baad8f60b884, 0x24667e9eef1795d8,
+    0xc60632ca4f8ee23c, 0x9826f6f92ff9cf60, 0xf8f897a25958d730,
+    0xa6d85391392ffa6c, 0x44b81fc599b68d88, 0x1a98dbf6f9c1a0d4,
+    0x056789c2f22abad2, 0x5b474df1925d978e, 0xb92701a532c4e06a,
+    0xe707c59652b3cd36, 0x77288b8897a27b07, 0x29084fbbf7d5565b,
+    0xcb6803ef574c21bf, 0x9548c7dc373b0ce3, 0x8ab795e83cd016e5,
+    0xd49751db5ca73bb9, 0x36f71d8ffc3e4c5d, 0x68d7d9bc9c496101,
+    0x0809b8e7eae87951, 0x56297cd48a9f540d, 0xb44930802a0623e9,
+    0xea69f4b34a710eb5, 0xf596a687419a14b3, 0xabb662b421ed39ef,
+    0x49d62ee081744e0b, 0x17f6ead3e1036357, 0x896aed566d367fab,
+    0xd74a29650d4152f7, 0x352a6531add82513, 0x6b0aa102cdaf084f,
+    0x74f5f336c6441249, 0x2ad53705a6333f15, 0xc8b57b5106aa48f1,
+    0x9695bf6266dd65ad, 0xf64bde39107c7dfd, 0xa86b1a0a700b50a1,
+    0x4a0b565ed0922745, 0x142b926db0e50a19, 0x0bd4c059bb0e101f,
+    0x55f4046adb793d43, 0xb794483e7be04aa7, 0xe9b48c0d1b9767fb,
+    0x0eb3499b4924aacd, 0x50938da829538791, 0xb2f3c1fc89caf075,
+    0xecd305cfe9bddd29, 0xf32c57fbe256c72f, 0xad0c93c88221ea73,
+    0x4f6cdf9c22b89d97, 0x114c1baf42cfb0cb, 0x71927af4346ea89b,
+    0x2fb2bec7541985c7, 0xcdd2f293f480f223, 0x93f236a094f7df7f,
+    0x8c0d64949f1cc579, 0xd22da0a7ff6be825, 0x304decf35ff29fc1,
+    0x6e6d28c03f85b29d, 0xf0f12f45b3b0ae61, 0xaed1eb76d3c7833d,
+    0x4cb1a722735ef4d9, 0x129163111329d985, 0x0d6e312518c2c383,
+    0x534ef51678b5eedf, 0xb12eb942d82c993b, 0xef0e7d71b85bb467,
+    0x8fd01c2acefaac37, 0xd1f0d819ae8d816b, 0x3390944d0e14f68f,
+    0x6db0507e6e63dbd3, 0x724f024a6588c1d5, 0x2c6fc67905ffec89,
+    0xce0f8a2da5669b6d, 0x902f4e1ec511b631, 0xee5016112f45f70e,
+    0xb070d2224f32da52, 0x52109e76efabadb6, 0x0c305a458fdc80ea,
+    0x13cf087184379aec, 0x4defcc42e440b7b0, 0xaf8f801644d9c054,
+    0xf1af442524aeed08, 0x9171257e520ff558, 0xcf51e14d3278d804,
+    0x2d31ad1992e1afe0, 0x7311692af29682bc, 0x6cee3b1ef97d98ba,
+    0x32ceff2d990ab5e6, 0xd0aeb3793993c202, 0x8e8e774a59e4ef5e,
+    0x101270cfd5d1f3a2, 0x4e32b4fcb5a6defe, 0xac52f8a8153fa91a,
+    0xf2723c9b75488446, 0xed8d6eaf7ea39e40, 0xb3adaa9c1ed4b31c,
+    0x51cde6c8be4dc4f8, 0x0fed22fbde3ae9a4, 0x6f3343a0a89bf1f4,
+    0x31138793c8ecdca8, 0xd373cbc76875ab4c, 0x8d530ff408028610,
+    0x92ac5dc003e99c16, 0xcc8c99f3639eb14a, 0x2eecd5a7c307c6ae,
+    0x70cc1194a370ebf2, 0x97cbd402f1c326c4, 0xc9eb103191b40b98,
+    0x2b8b5c65312d7c7c, 0x75ab9856515a5120, 0x6a54ca625ab14b26,
+    0x34740e513ac6667a, 0xd61442059a5f119e, 0x88348636fa283cc2,
+    0xe8eae76d8c892492, 0xb6ca235eecfe09ce, 0x54aa6f0a4c677e2a,
+    0x0a8aab392c105376, 0x1575f90d27fb4970, 0x4b553d3e478c642c,
+    0xa935716ae71513c8, 0xf715b55987623e94, 0x6989b2dc0b572268,
+    0x37a976ef6b200f34, 0xd5c93abbcbb978d0, 0x8be9fe88abce558c,
+    0x9416acbca0254f8a, 0xca36688fc05262d6, 0x285624db60cb1532,
+    0x7676e0e800bc386e, 0x16a881b3761d203e, 0x48884580166a0d62,
+    0xaae809d4b6f37a86, 0xf4c8cde7d68457da, 0xeb379fd3dd6f4ddc,
+    0xb5175be0bd186080, 0x577717b41d811764, 0x0957d3877df63a38,
+    0x99789d99b8e78c09, 0xc75859aad890a155, 0x253815fe7809d6b1,
+    0x7b18d1cd187efbed, 0x64e783f91395e1eb, 0x3ac747ca73e2ccb7,
+    0xd8a70b9ed37bbb53, 0x8687cfadb30c960f, 0xe659aef6c5ad8e5f,
+    0xb8796ac5a5daa303, 0x5a1926910543d4e7, 0x0439e2a26534f9bb,
+    0x1bc6b0966edfe3bd, 0x45e674a50ea8cee1, 0xa78638f1ae31b905,
+    0xf9a6fcc2ce469459, 0x673afb47427388a5, 0x391a3f742204a5f9,
+    0xdb7a7320829dd21d, 0x855ab713e2eaff41, 0x9aa5e527e901e547,
+    0xc48521148976c81b, 0x26e56d4029efbfff, 0x78c5a973499892a3,
+    0x181bc8283f398af3, 0x463b0c1b5f4ea7af, 0xa45b404fffd7d04b,
+    0xfa7b847c9fa0fd17, 0xe584d648944be711, 0xbba4127bf43cca4d,
+    0x59c45e2f54a5bda9, 0x07e49a1c34d290f5, 0xe0e35f8a66615dc3,
+    0xbec39bb90616709f, 0x5ca3d7eda68f077b, 0x028313dec6f82a27,
+    0x1d7c41eacd133021, 0x435c85d9ad641d7d, 0xa13cc98d0dfd6a99,
+    0xff1c0dbe6d8a47c5, 0x9fc26ce51b2b5f95, 0xc1e2a8d67b5c72c9,
+    0x2382e482dbc5052d, 0x7da220b1bbb22871, 0x625d7285b0593277,
+    0x3c7db6b6d02e1f2b, 0xde1dfae270b768cf, 0x803d3ed110c04593,
+    0x1ea139549cf5596f, 0x4081fd67fc827433, 0xa2e1b1335c1b03d7,
+    0xfcc175003c6c2e8b, 0xe33e27343787348d, 0xbd1ee30757f019d1,
+    0x5f7eaf53f7696e35, 0x015e6b60971e4369, 0x61800a3be1bf5b39,
+    0x3fa0ce0881c87665, 0xddc0825c21510181, 0x83e0466f41262cdd,
+    0x9c1f145b4acd36db, 0xc23fd0682aba1b87, 0x205f9c3c8a236c63,
+    0x7e7f580fea54413f},
+   {0x0000000000000000, 0xc66712725fd58461, 0x8ccf24e4beaa09c3,
+    0x4aa83696e17f8da2, 0x9d81476756facb14, 0x5be65515092f4f75,
+    0x114e6383e850c2d7, 0xd72971f1b78546b6, 0x3a038fceacf49729,
+    0xfc649dbcf3211348, 0xb6ccab2a125e9eea, 0x70abb9584d8b1a8b,
+    0xa782c8a9fa0e5c3d, 0x61e5dadba5dbd85c, 0x2b4dec4d44a455fe,
+    0xed2afe3f1b71d19f, 0x74061e9d59e92f53, 0xb2610cef063cab32,
+    0xf8c93a79e7432690, 0x3eae280bb896a2f1, 0xe98759fa0f13e447,
+    0x2fe04b8850c66026, 0x65487d1eb1b9ed84, 0xa32f6f6cee6c69e5,
+    0x4e059153f51db87a, 0x88628321aac83c1b, 0xc2cab5b74bb7b1b9,
+    0x04ada7c5146235d8, 0xd384d634a3e7736e, 0x15e3c446fc32f70f,
+    0x5f4bf2d01d4d7aad, 0x992ce0a24298fecc, 0xe80c3c3ab3d25fa6,
+    0x2e6b2e48ec07dbc7, 0x64c318de0d785665, 0xa2a40aac52add204,
+    0x758d7b5de52894b2, 0xb3ea692fbafd10d3, 0xf9425fb95b829d71,
+    0x3f254dcb04571910, 0xd20fb3f41f26c88f, 0x1468a18640f34cee,
+    0x5ec09710a18cc14c, 0x98a78562fe59452d, 0x4f8ef49349dc039b,
+    0x89e9e6e1160987fa, 0xc341d077f7760a58, 0x0526c205a8a38e39,
+    0x9c0a22a7ea3b70f5, 0x5a6d30d5b5eef494, 0x10c5064354917936,
+    0xd6a214310b44fd57, 0x018b65c0bcc1bbe1, 0xc7ec77b2e3143f80,
+    0x8d444124026bb222, 0x4b2353565dbe3643, 0xa609ad6946cfe7dc,
+    0x606ebf1b191a63bd, 0x2ac6898df865ee1f, 0xeca19bffa7b06a7e,
+    0x3b88ea0e10352cc8, 0xfdeff87c4fe0a8a9, 0xb747ceeaae9f250b,
+    0x7120dc98f14aa16a, 0x550776db4d0a67de, 0x936064a912dfe3bf,
+    0xd9c8523ff3a06e1d, 0x1faf404dac75ea7c, 0xc88631bc1bf0acca,
+    0x0ee123ce442528ab, 0x44491558a55aa509, 0x822e072afa8f2168,
+    0x6f04f915e1fef0f7, 0xa963eb67be2b7496, 0xe3cbddf15f54f934,
+    0x25accf8300817d55, 0xf285be72b7043be3, 0x34e2ac00e8d1bf82,
+    0x7e4a9a9609ae3220, 0xb82d88e4567bb641, 0x2101684614e3488d,
+    0xe7667a344b36ccec, 0xadce4ca2aa49414e, 0x6ba95ed0f59cc52f,
+    0xbc802f2142198399, 0x7ae73d531dcc07f8, 0x304f0bc5fcb38a5a,
+    0xf62819b7a3660e3b, 0x1b02e788b817dfa4, 0xdd65f5fae7c25bc5,
+    0x97cdc36c06bdd667, 0x51aad11e59685206, 0x8683a0efeeed14b0,
+    0x40e4b29db13890d1, 0x0a4c840b50471d73, 0xcc2b96790f929912,
+    0xbd0b4ae1fed83878, 0x7b6c5893a10dbc19, 0x31c46e05407231bb,
+    0xf7a37c771fa7b5da, 0x208a0d86a822f36c, 0xe6ed1ff4f7f7770d,
+    0xac4529621688faaf, 0x6a223b10495d7ece, 0x8708c52f522caf51,
+    0x416fd75d0df92b30, 0x0bc7e1cbec86a692, 0xcda0f3b9b35322f3,
+    0x1a89824804d66445, 0xdcee903a5b03e024, 0x9646a6acba7c6d86,
+    0x5021b4dee5a9e9e7, 0xc90d547ca731172b, 0x0f6a460ef8e4934a,
+    0x45c27098199b1ee8, 0x83a562ea464e9a89, 0x548c131bf1cbdc3f,
+    0x92eb0169ae1e585e, 0xd84337ff4f61d5fc, 0x1e24258d10b4519d,
+    0xf30edbb20bc58002, 0x3569c9c054100463, 0x7fc1ff56b56f89c1,
+    0xb9a6ed24eaba0da0, 0x6e8f9cd55d3f4b16, 0xa8e88ea702eacf77,
+    0xe240b831e39542d5, 0x2427aa43bc40c6b4, 0x2f10e219b0bb162e,
+    0xe977f06bef6e924f, 0xa3dfc6fd0e111fed, 0x65b8d48f51c49b8c,
+    0xb291a57ee641dd3a, 0x74f6b70cb994595b, 0x3e5e819a58ebd4f9,
+    0xf83993e8073e5098, 0x15136dd71c4f8107, 0xd3747fa5439a0566,
+    0x99dc4933a2e588c4, 0x5fbb5b41fd300ca5, 0x88922ab04ab54a13,
+    0x4ef538c21560ce72, 0x045d0e54f41f43d0, 0xc23a1c26abcac7b1,
+    0x5b16fc84e952397d, 0x9d71eef6b687bd1c, 0xd7d9d86057f830be,
+    0x11beca12082db4df, 0xc697bbe3bfa8f269, 0x00f0a991e07d7608,
+    0x4a589f070102fbaa, 0x8c3f8d755ed77fcb, 0x6115734a45a6ae54,
+    0xa77261381a732a35, 0xedda57aefb0ca797, 0x2bbd45dca4d923f6,
+    0xfc94342d135c6540, 0x3af3265f4c89e121, 0x705b10c9adf66c83,
+    0xb63c02bbf223e8e2, 0xc71cde2303694988, 0x017bcc515cbccde9,
+    0x4bd3fac7bdc3404b, 0x8db4e8b5e216c42a, 0x5a9d99445593829c,
+    0x9cfa8b360a4606fd, 0xd652bda0eb398b5f, 0x1035afd2b4ec0f3e,
+    0xfd1f51edaf9ddea1, 0x3b78439ff0485ac0, 0x71d075091137d762,
+    0xb7b7677b4ee25303, 0x609e168af96715b5, 0xa6f904f8a6b291d4,
+    0xec51326e47cd1c76, 0x2a36201c18189817, 0xb31ac0be5a8066db,
+    0x757dd2cc0555e2ba, 0x3fd5e45ae42a6f18, 0xf9b2f628bbffeb79,
+    0x2e9b87d90c7aadcf, 0xe8fc95ab53af29ae, 0xa254a33db2d0a40c,
+    0x6433b14fed05206d, 0x89194f70f674f1f2, 0x4f7e5d02a9a17593,
+    0x05d66b9448def831, 0xc3b179e6170b7c50, 0x14980817a08e3ae6,
+    0xd2ff1a65ff5bbe87, 0x98572cf31e243325, 0x5e303e8141f1b744,
+    0x7a1794c2fdb171f0, 0xbc7086b0a264f591, 0xf6d8b026431b7833,
+    0x30bfa2541ccefc52, 0xe796d3a5ab4bbae4, 0x21f1c1d7f49e3e85,
+    0x6b59f74115e1b327, 0xad3ee5334a343746, 0x40141b0c5145e6d9,
+    0x8673097e0e9062b8, 0xccdb3fe8efefef1a, 0x0abc2d9ab03a6b7b,
+    0xdd955c6b07bf2dcd, 0x1bf24e19586aa9ac, 0x515a788fb915240e,
+    0x973d6afde6c0a06f, 0x0e118a5fa4585ea3, 0xc876982dfb8ddac2,
+    0x82deaebb1af25760, 0x44b9bcc94527d301, 0x9390cd38f2a295b7,
+    0x55f7df4aad7711d6, 0x1f5fe9dc4c089c74, 0xd938fbae13dd1815,
+    0x3412059108acc98a, 0xf27517e357794deb, 0xb8dd2175b606c049,
+    0x7eba3307e9d34428, 0xa99342f65e56029e, 0x6ff45084018386ff,
+    0x255c6612e0fc0b5d, 0xe33b7460bf298f3c, 0x921ba8f84e632e56,
+    0x547cba8a11b6aa37, 0x1ed48c1cf0c92795, 0xd8b39e6eaf1ca3f4,
+    0x0f9aef9f1899e542, 0xc9fdfded474c6123, 0x8355cb7ba633ec81,
+    0x4532d909f9e668e0, 0xa8182736e297b97f, 0x6e7f3544bd423d1e,
+    0x24d703d25c3db0bc, 0xe2b011a003e834dd, 0x35996051b46d726b,
+    0xf3fe7223ebb8f60a, 0xb95644b50ac77ba8, 0x7f3156c75512ffc9,
+    0xe61db665178a0105, 0x207aa417485f8564, 0x6ad29281a92008c6,
+    0xacb580f3f6f58ca7, 0x7b9cf1024170ca11, 0xbdfbe3701ea54e70,
+    0xf753d5e6ffdac3d2, 0x3134c794a00f47b3, 0xdc1e39abbb7e962c,
+    0x1a792bd9e4ab124d, 0x50d11d4f05d49fef, 0x96b60f3d5a011b8e,
+    0x419f7ecced845d38, 0x87f86cbeb251d959, 0xcd505a28532e54fb,
+    0x0b37485a0cfbd09a},
+   {0x0000000000000000, 0xec64f934590def22, 0xd8c9f269b21ade45,
+    0x34ad0b5deb173167, 0xb093e5d36435bc8b, 0x5cf71ce73d3853a9,
+    0x685a17bad62f62ce, 0x843eee8e8f228dec, 0xe539c508e2c5a085,
+    0x095d3c3cbbc84fa7, 0x3df0376150df7ec0, 0xd194ce5509d291e2,
+    0x55aa20db86f01c0e, 0xb9ced9efdffdf32c, 0x8d63d2b234eac24b,
+    0x61072b866de72d69, 0x4f6d84beef249999, 0xa3097d8ab62976bb,
+    0x97a476d75d3e47dc, 0x7bc08fe30433a8fe, 0xfffe616d8b112512,
+    0x139a9859d21cca30, 0x27379304390bfb57, 0xcb536a3060061475,
+    0xaa5441b60de1391c, 0x4630b88254ecd63e, 0x729db3dfbffbe759,
+    0x9ef94aebe6f6087b, 0x1ac7a46569d48597, 0xf6a35d5130d96ab5,
+    0xc20e560cdbce5bd2, 0x2e6aaf3882c3b4f0, 0x1bc406d2f4e6eaa1,
+    0xf7a0ffe6adeb0583, 0xc30df4bb46fc34e4, 0x2f690d8f1ff1dbc6,
+    0xab57e30190d3562a, 0x47331a35c9deb908, 0x739e116822c9886f,
+    0x9ffae85c7bc4674d, 0xfefdc3da16234a24, 0x12993aee4f2ea506,
+    0x263431b3a4399461, 0xca50c887fd347b43, 0x4e6e26097216f6af,
+    0xa20adf3d2b1b198d, 0x96a7d460c00c28ea, 0x7ac32d549901c7c8,
+    0x54a9826c1bc27338, 0xb8cd7b5842cf9c1a, 0x8c607005a9d8ad7d,
+    0x60048931f0d5425f, 0xe43a67bf7ff7cfb3, 0x085e9e8b26fa2091,
+    0x3cf395d6cded11f6, 0xd0976ce294e0fed4, 0xb1904764f907d3bd,
+    0x5df4be50a00a3c9f, 0x6959b50d4b1d0df8, 0x853d4c391210e2da,
+    0x0103a2b79d326f36, 0xed675b83c43f8014, 0xd9ca50de2f28b173,
+    0x35aea9ea76255e51, 0xb396030bc2620dd1, 0x5ff2fa3f9b6fe2f3,
+    0x6b5ff1627078d394, 0x873b085629753cb6, 0x0305e6d8a657b15a,
+    0xef611fecff5a5e78, 0xdbcc14b1144d6f1f, 0x37a8ed854d40803d,
+    0x56afc60320a7ad54, 0xbacb3f3779aa4276, 0x8e66346a92bd7311,
+    0x6202cd5ecbb09c33, 0xe63c23d0449211df, 0x0a58dae41d9ffefd,
+    0x3ef5d1b9f688cf9a, 0xd291288daf8520b8, 0xfcfb87b52d469448,
+    0x109f7e81744b7b6a, 0x243275dc9f5c4a0d, 0xc8568ce8c651a52f,
+    0x4c686266497328c3, 0xa00c9b52107ec7e1, 0x94a1900ffb69f686,
+    0x78c5693ba26419a4, 0x19c242bdcf8334cd, 0xf5a6bb89968edbef,
+    0xc10bb0d47d99ea88, 0x2d6f49e0249405aa, 0xa951a76eabb68846,
+    0x45355e5af2bb6764, 0x7198550719ac5603, 0x9dfcac3340a1b921,
+    0xa85205d93684e770, 0x4436fced6f890852, 0x709bf7b0849e3935,
+    0x9cff0e84dd93d617, 0x18c1e00a52b15bfb, 0xf4a5193e0bbcb4d9,
+    0xc0081263e0ab85be, 0x2c6ceb57b9a66a9c, 0x4d6bc0d1d44147f5,
+    0xa10f39e58d4ca8d7, 0x95a232b8665b99b0, 0x79c6cb8c3f567692,
+    0xfdf82502b074fb7e, 0x119cdc36e979145c, 0x2531d76b026e253b,
+    0xc9552e5f5b63ca19, 0xe73f8167d9a07ee9, 0x0b5b785380ad91cb,
+    0x3ff6730e6bbaa0ac, 0xd3928a3a32b74f8e, 0x57ac64b4bd95c262,
+    0xbbc89d80e4982d40, 0x8f6596dd0f8f1c27, 0x63016fe95682f305,
+    0x0206446f3b65de6c, 0xee62bd5b6268314e, 0xdacfb606897f0029,
+    0x36ab4f32d072ef0b, 0xb295a1bc5f5062e7, 0x5ef15888065d8dc5,
+    0x6a5c53d5ed4abca2, 0x8638aae1b4475380, 0xe33309b9af6ac230,
+    0x0f57f08df6672d12, 0x3bfafbd01d701c75, 0xd79e02e4447df357,
+    0x53a0ec6acb5f7ebb, 0xbfc4155e92529199, 0x8b691e037945a0fe,
+    0x670de73720484fdc, 0x060accb14daf62b5, 0xea6e358514a28d97,
+    0xdec33ed8ffb5bcf0, 0x32a7c7eca6b853d2, 0xb6992962299ade3e,
+    0x5afdd0567097311c, 0x6e50db0b9b80007b, 0x8234223fc28def59,
+    0xac5e8d07404e5ba9, 0x403a74331943b48b, 0x74977f6ef25485ec,
+    0x98f3865aab596ace, 0x1ccd68d4247be722, 0xf0a991e07d760800,
+    0xc4049abd96613967, 0x28606389cf6cd645, 0x4967480fa28bfb2c,
+    0xa503b13bfb86140e, 0x91aeba6610912569, 0x7dca4352499cca4b,
+    0xf9f4addcc6be47a7, 0x159054e89fb3a885, 0x213d5fb574a499e2,
+    0xcd59a6812da976c0, 0xf8f70f6b5b8c2891, 0x1493f65f0281c7b3,
+    0x203efd02e996f6d4, 0xcc5a0436b09b19f6, 0x4864eab83fb9941a,
+    0xa400138c66b47b38, 0x90ad18d18da34a5f, 0x7cc9e1e5d4aea57d,
+    0x1dceca63b9498814, 0xf1aa3357e0446736, 0xc507380a0b535651,
+    0x2963c13e525eb973, 0xad5d2fb0dd7c349f, 0x4139d6848471dbbd,
+    0x7594ddd96f66eada, 0x99f024ed366b05f8, 0xb79a8bd5b4a8b108,
+    0x5bfe72e1eda55e2a, 0x6f5379bc06b26f4d, 0x833780885fbf806f,
+    0x07096e06d09d0d83, 0xeb6d97328990e2a1, 0xdfc09c6f6287d3c6,
+    0x33a4655b3b8a3ce4, 0x52a34edd566d118d, 0xbec7b7e90f60feaf,
+    0x8a6abcb4e477cfc8, 0x660e4580bd7a20ea, 0xe230ab0e3258ad06,
+    0x0e54523a6b554224, 0x3af9596780427343, 0xd69da053d94f9c61,
+    0x50a50ab26d08cfe1, 0xbcc1f386340520c3, 0x886cf8dbdf1211a4,
+    0x640801ef861ffe86, 0xe036ef61093d736a, 0x0c52165550309c48,
+    0x38ff1d08bb27ad2f, 0xd49be43ce22a420d, 0xb59ccfba8fcd6f64,
+    0x59f8368ed6c08046, 0x6d553dd33dd7b121, 0x8131c4e764da5e03,
+    0x050f2a69ebf8d3ef, 0xe96bd35db2f53ccd, 0xddc6d80059e20daa,
+    0x31a2213400efe288, 0x1fc88e0c822c5678, 0xf3ac7738db21b95a,
+    0xc7017c653036883d, 0x2b658551693b671f, 0xaf5b6bdfe619eaf3,
+    0x433f92ebbf1405d1, 0x779299b6540334b6, 0x9bf660820d0edb94,
+    0xfaf14b0460e9f6fd, 0x1695b23039e419df, 0x2238b96dd2f328b8,
+    0xce5c40598bfec79a, 0x4a62aed704dc4a76, 0xa60657e35dd1a554,
+    0x92ab5cbeb6c69433, 0x7ecfa58aefcb7b11, 0x4b610c6099ee2540,
+    0xa705f554c0e3ca62, 0x93a8fe092bf4fb05, 0x7fcc073d72f91427,
+    0xfbf2e9b3fddb99cb, 0x17961087a4d676e9, 0x233b1bda4fc1478e,
+    0xcf5fe2ee16cca8ac, 0xae58c9687b2b85c5, 0x423c305c22266ae7,
+    0x76913b01c9315b80, 0x9af5c235903cb4a2, 0x1ecb2cbb1f1e394e,
+    0xf2afd58f4613d66c, 0xc602ded2ad04e70b, 0x2a6627e6f4090829,
+    0x040c88de76cabcd9, 0xe86871ea2fc753fb, 0xdcc57ab7c4d0629c,
+    0x30a183839ddd8dbe, 0xb49f6d0d12ff0052, 0x58fb94394bf2ef70,
+    0x6c569f64a0e5de17, 0x80326650f9e83135, 0xe1354dd6940f1c5c,
+    0x0d51b4e2cd02f37e, 0x39fcbfbf2615c219, 0xd598468b7f182d3b,
+    0x51a6a805f03aa0d7, 0xbdc25131a9374ff5, 0x896f5a6c42207e92,
+    0x650ba3581b2d91b0},
+   {0x0000000000000000, 0x405f87c7af95beda, 0x05a000207484a527,
+    0x45ff87e7db111bfd, 0x0a400140e8084b4f, 0x4a1f8687479df595,
+    0x0fe001609c8cee68, 0x4fbf86a7331950b2, 0x14800280d011969e,
+    0x54df85477f842844, 0x112002a0a49533b9, 0x517f85670b008d63,
+    0x1ec003c03819ddd1, 0x5e9f8407978c630b, 0x1b6003e04c9d78f6,
+    0x5b3f8427e308c62c, 0xad1e0baf8a8cf4af, 0xed418c6825194a75,
+    0xa8be0b8ffe085188, 0xe8e18c48519def52, 0xa75e0aef6284bfe0,
+    0xe7018d28cd11013a, 0xa2fe0acf16001ac7, 0xe2a18d08b995a41d,
+    0xb99e092f5a9d6231, 0xf9c18ee8f508dceb, 0xbc3e090f2e19c716,
+    0xfc618ec8818c79cc, 0xb3de086fb295297e, 0xf3818fa81d0097a4,
+    0xb67e084fc6118c59, 0xf6218f8869843283, 0xdf2318f13eb631cd,
+    0x9f7c9f3691238f17, 0xda8318d14a3294ea, 0x9adc9f16e5a72a30,
+    0xd56319b1d6be7a82, 0x953c9e76792bc458, 0xd0c31991a23adfa5,
+    0x909c9e560daf617f, 0xcba31a71eea7a753, 0x8bfc9db641321989,
+    0xce031a519a230274, 0x8e5c9d9635b6bcae, 0xc1e31b3106afec1c,
+    0x81bc9cf6a93a52c6, 0xc4431b11722b493b, 0x841c9cd6ddbef7e1,
+    0x723d135eb43ac562, 0x326294991baf7bb8, 0x779d137ec0be6045,
+    0x37c294b96f2bde9f, 0x787d121e5c328e2d, 0x382295d9f3a730f7,
+    0x7ddd123e28b62b0a, 0x3d8295f9872395d0, 0x66bd11de642b53fc,
+    0x26e29619cbbeed26, 0x631d11fe10aff6db, 0x23429639bf3a4801,
+    0x6cfd109e8c2318b3, 0x2ca2975923b6a669, 0x695d10bef8a7bd94,
+    0x290297795732034e, 0x3b593e4d56c3bb08, 0x7b06b98af95605d2,
+    0x3ef93e6d22471e2f, 0x7ea6b9aa8dd2a0f5, 0x31193f0dbecbf047,
+    0x7146b8ca115e4e9d, 0x34b93f2dca4f5560, 0x74e6b8ea65daebba,
+    0x2fd93ccd86d22d96, 0x6f86bb0a2947934c, 0x2a793cedf25688b1,
+    0x6a26bb2a5dc3366b, 0x25993d8d6eda66d9, 0x65c6ba4ac14fd803,
+    0x20393dad1a5ec3fe, 0x6066ba6ab5cb7d24, 0x964735e2dc4f4fa7,
+    0xd618b22573daf17d, 0x93e735c2a8cbea80, 0xd3b8b205075e545a,
+    0x9c0734a2344704e8, 0xdc58b3659bd2ba32, 0x99a7348240c3a1cf,
+    0xd9f8b345ef561f15, 0x82c737620c5ed939, 0xc298b0a5a3cb67e3,
+    0x8767374278da7c1e, 0xc738b085d74fc2c4, 0x88873622e4569276,
+    0xc8d8b1e54bc32cac, 0x8d27360290d23751, 0xcd78b1c53f47898b,
+    0xe47a26bc68758ac5, 0xa425a17bc7e0341f, 0xe1da269c1cf12fe2,
+    0xa185a15bb3649138, 0xee3a27fc807dc18a, 0xae65a03b2fe87f50,
+    0xeb9a27dcf4f964ad, 0xabc5a01b5b6cda77, 0xf0fa243cb8641c5b,
+    0xb0a5a3fb17f1a281, 0xf55a241ccce0b97c, 0xb505a3db637507a6,
+    0xfaba257c506c5714, 0xbae5a2bbfff9e9ce, 0xff1a255c24e8f233,
+    0xbf45a29b8b7d4ce9, 0x49642d13e2f97e6a, 0x093baad44d6cc0b0,
+    0x4cc42d33967ddb4d, 0x0c9baaf439e86597, 0x43242c530af13525,
+    0x037bab94a5648bff, 0x46842c737e759002, 0x06dbabb4d1e02ed8,
+    0x5de42f9332e8e8f4, 0x1dbba8549d7d562e, 0x58442fb3466c4dd3,
+    0x181ba874e9f9f309, 0x57a42ed3dae0a3bb, 0x17fba91475751d61,
+    0x52042ef3ae64069c, 0x125ba93401f1b846, 0x76b27c9aac867711,
+    0x36edfb5d0313c9cb, 0x73127cbad802d236, 0x334dfb7d77976cec,
+    0x7cf27dda448e3c5e, 0x3cadfa1deb1b8284, 0x79527dfa300a9979,
+    0x390dfa3d9f9f27a3, 0x62327e1a7c97e18f, 0x226df9ddd3025f55,
+    0x67927e3a081344a8, 0x27cdf9fda786fa72, 0x68727f5a949faac0,
+    0x282df89d3b0a141a, 0x6dd27f7ae01b0fe7, 0x2d8df8bd4f8eb13d,
+    0xdbac7735260a83be, 0x9bf3f0f2899f3d64, 0xde0c7715528e2699,
+    0x9e53f0d2fd1b9843, 0xd1ec7675ce02c8f1, 0x91b3f1b26197762b,
+    0xd44c7655ba866dd6, 0x9413f1921513d30c, 0xcf2c75b5f61b1520,
+    0x8f73f272598eabfa, 0xca8c7595829fb007, 0x8ad3f2522d0a0edd,
+    0xc56c74f51e135e6f, 0x8533f332b186e0b5, 0xc0cc74d56a97fb48,
+    0x8093f312c5024592, 0xa991646b923046dc, 0xe9cee3ac3da5f806,
+    0xac31644be6b4e3fb, 0xec6ee38c49215d21, 0xa3d1652b7a380d93,
+    0xe38ee2ecd5adb349, 0xa671650b0ebca8b4, 0xe62ee2cca129166e,
+    0xbd1166eb4221d042, 0xfd4ee12cedb46e98, 0xb8b166cb36a57565,
+    0xf8eee10c9930cbbf, 0xb75167abaa299b0d, 0xf70ee06c05bc25d7,
+    0xb2f1678bdead3e2a, 0xf2aee04c713880f0, 0x048f6fc418bcb273,
+    0x44d0e803b7290ca9, 0x012f6fe46c381754, 0x4170e823c3ada98e,
+    0x0ecf6e84f0b4f93c, 0x4e90e9435f2147e6, 0x0b6f6ea484305c1b,
+    0x4b30e9632ba5e2c1, 0x100f6d44c8ad24ed, 0x5050ea8367389a37,
+    0x15af6d64bc2981ca, 0x55f0eaa313bc3f10, 0x1a4f6c0420a56fa2,
+    0x5a10ebc38f30d178, 0x1fef6c245421ca85, 0x5fb0ebe3fbb4745f,
+    0x4deb42d7fa45cc19, 0x0db4c51055d072c3, 0x484b42f78ec1693e,
+    0x0814c5302154d7e4, 0x47ab4397124d8756, 0x07f4c450bdd8398c,
+    0x420b43b766c92271, 0x0254c470c95c9cab, 0x596b40572a545a87,
+    0x1934c79085c1e45d, 0x5ccb40775ed0ffa0, 0x1c94c7b0f145417a,
+    0x532b4117c25c11c8, 0x1374c6d06dc9af12, 0x568b4137b6d8b4ef,
+    0x16d4c6f0194d0a35, 0xe0f5497870c938b6, 0xa0aacebfdf5c866c,
+    0xe5554958044d9d91, 0xa50ace9fabd8234b, 0xeab5483898c173f9,
+    0xaaeacfff3754cd23, 0xef154818ec45d6de, 0xaf4acfdf43d06804,
+    0xf4754bf8a0d8ae28, 0xb42acc3f0f4d10f2, 0xf1d54bd8d45c0b0f,
+    0xb18acc1f7bc9b5d5, 0xfe354ab848d0e567, 0xbe6acd7fe7455bbd,
+    0xfb954a983c544040, 0xbbcacd5f93c1fe9a, 0x92c85a26c4f3fdd4,
+    0xd297dde16b66430e, 0x97685a06b07758f3, 0xd737ddc11fe2e629,
+    0x98885b662cfbb69b, 0xd8d7dca1836e0841, 0x9d285b46587f13bc,
+    0xdd77dc81f7eaad66, 0x864858a614e26b4a, 0xc617df61bb77d590,
+    0x83e858866066ce6d, 0xc3b7df41cff370b7, 0x8c0859e6fcea2005,
+    0xcc57de21537f9edf, 0x89a859c6886e8522, 0xc9f7de0127fb3bf8,
+    0x3fd651894e7f097b, 0x7f89d64ee1eab7a1, 0x3a7651a93afbac5c,
+    0x7a29d66e956e1286, 0x359650c9a6774234, 0x75c9d70e09e2fcee,
+    0x303650e9d2f3e713, 0x7069d72e7d6659c9, 0x2b5653099e6e9fe5,
+    0x6b09d4ce31fb213f, 0x2ef65329eaea3ac2, 0x6ea9d4ee457f8418,
+    0x211652497666d4aa, 0x6149d58ed9f36a70, 0x24b6526902e2718d,
+    0x64e9d5aead77cf57}};
+
+#endif /* N == 1 */
+#if N == 2
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0xe05dd497ca393ae4, 0x526306043b7c6b4d,
+    0xb23ed293f14551a9, 0xa4c60c0876f8d69a, 0x449bd89fbcc1ec7e,
+    0xf6a50a0c4d84bdd7, 0x16f8de9b87bd8733, 0xdb54b73b42ffb3b1,
+    0x3b0963ac88c68955, 0x8937b13f7983d8fc, 0x696a65a8b3bae218,
+    0x7f92bb333407652b, 0x9fcf6fa4fe3e5fcf, 0x2df1bd370f7b0e66,
+    0xcdac69a0c5423482, 0x2471c15d2af179e7, 0xc42c15cae0c84303,
+    0x7612c759118d12aa, 0x964f13cedbb4284e, 0x80b7cd555c09af7d,
+    0x60ea19c296309599, 0xd2d4cb516775c430, 0x32891fc6ad4cfed4,
+    0xff257666680eca56, 0x1f78a2f1a237f0b2, 0xad4670625372a11b,
+    0x4d1ba4f5994b9bff, 0x5be37a6e1ef61ccc, 0xbbbeaef9d4cf2628,
+    0x09807c6a258a7781, 0xe9dda8fdefb34d65, 0x48e382ba55e2f3ce,
+    0xa8be562d9fdbc92a, 0x1a8084be6e9e9883, 0xfadd5029a4a7a267,
+    0xec258eb2231a2554, 0x0c785a25e9231fb0, 0xbe4688b618664e19,
+    0x5e1b5c21d25f74fd, 0x93b73581171d407f, 0x73eae116dd247a9b,
+    0xc1d433852c612b32, 0x2189e712e65811d6, 0x3771398961e596e5,
+    0xd72ced1eabdcac01, 0x65123f8d5a99fda8, 0x854feb1a90a0c74c,
+    0x6c9243e77f138a29, 0x8ccf9770b52ab0cd, 0x3ef145e3446fe164,
+    0xdeac91748e56db80, 0xc8544fef09eb5cb3, 0x28099b78c3d26657,
+    0x9a3749eb329737fe, 0x7a6a9d7cf8ae0d1a, 0xb7c6f4dc3dec3998,
+    0x579b204bf7d5037c, 0xe5a5f2d8069052d5, 0x05f8264fcca96831,
+    0x1300f8d44b14ef02, 0xf35d2c43812dd5e6, 0x4163fed07068844f,
+    0xa13e2a47ba51beab, 0x91c70574abc5e79c, 0x719ad1e361fcdd78,
+    0xc3a4037090b98cd1, 0x23f9d7e75a80b635, 0x3501097cdd3d3106,
+    0xd55cddeb17040be2, 0x67620f78e6415a4b, 0x873fdbef2c7860af,
+    0x4a93b24fe93a542d, 0xaace66d823036ec9, 0x18f0b44bd2463f60,
+    0xf8ad60dc187f0584, 0xee55be479fc282b7, 0x0e086ad055fbb853,
+    0xbc36b843a4bee9fa, 0x5c6b6cd46e87d31e, 0xb5b6c42981349e7b,
+    0x55eb10be4b0da49f, 0xe7d5c22dba48f536, 0x078816ba7071cfd2,
+    0x1170c821f7cc48e1, 0xf12d1cb63df57205, 0x4313ce25ccb023ac,
+    0xa34e1ab206891948, 0x6ee27312c3cb2dca, 0x8ebfa78509f2172e,
+    0x3c817516f8b74687, 0xdcdca181328e7c63, 0xca247f1ab533fb50,
+    0x2a79ab8d7f0ac1b4, 0x9847791e8e4f901d, 0x781aad894476aaf9,
+    0xd92487cefe271452, 0x39795359341e2eb6, 0x8b4781cac55b7f1f,
+    0x6b1a555d0f6245fb, 0x7de28bc688dfc2c8, 0x9dbf5f5142e6f82c,
+    0x2f818dc2b3a3a985, 0xcfdc5955799a9361, 0x027030f5bcd8a7e3,
+    0xe22de46276e19d07, 0x501336f187a4ccae, 0xb04ee2664d9df64a,
+    0xa6b63cfdca207179, 0x46ebe86a00194b9d, 0xf4d53af9f15c1a34,
+    0x1488ee6e3b6520d0, 0xfd554693d4d66db5, 0x1d0892041eef5751,
+    0xaf364097efaa06f8, 0x4f6b940025933c1c, 0x59934a9ba22ebb2f,
+    0xb9ce9e0c681781cb, 0x0bf04c9f9952d062, 0xebad9808536bea86,
+    0x2601f1a89629de04, 0xc65c253f5c10e4e0, 0x7462f7acad55b549,
+    0x943f233b676c8fad, 0x82c7fda0e0d1089e, 0x629a29372ae8327a,
+    0xd0a4fba4dbad63d3, 0x30f92f3311945937, 0xb156a5c2f885d1bd,
+    0x510b715532bceb59, 0xe335a3c6c3f9baf0, 0x0368775109c08014,
+    0x1590a9ca8e7d0727, 0xf5cd7d5d44443dc3, 0x47f3afceb5016c6a,
+    0xa7ae7b597f38568e, 0x6a0212f9ba7a620c, 0x8a5fc66e704358e8,
+    0x386114fd81060941, 0xd83cc06a4b3f33a5, 0xcec41ef1cc82b496,
+    0x2e99ca6606bb8e72, 0x9ca718f5f7fedfdb, 0x7cfacc623dc7e53f,
+    0x9527649fd274a85a, 0x757ab008184d92be, 0xc744629be908c317,
+    0x2719b60c2331f9f3, 0x31e16897a48c7ec0, 0xd1bcbc006eb54424,
+    0x63826e939ff0158d, 0x83dfba0455c92f69, 0x4e73d3a4908b1beb,
+    0xae2e07335ab2210f, 0x1c10d5a0abf770a6, 0xfc4d013761ce4a42,
+    0xeab5dface673cd71, 0x0ae80b3b2c4af795, 0xb8d6d9a8dd0fa63c,
+    0x588b0d3f17369cd8, 0xf9b52778ad672273, 0x19e8f3ef675e1897,
+    0xabd6217c961b493e, 0x4b8bf5eb5c2273da, 0x5d732b70db9ff4e9,
+    0xbd2effe711a6ce0d, 0x0f102d74e0e39fa4, 0xef4df9e32adaa540,
+    0x22e19043ef9891c2, 0xc2bc44d425a1ab26, 0x70829647d4e4fa8f,
+    0x90df42d01eddc06b, 0x86279c4b99604758, 0x667a48dc53597dbc,
+    0xd4449a4fa21c2c15, 0x34194ed8682516f1, 0xddc4e62587965b94,
+    0x3d9932b24daf6170, 0x8fa7e021bcea30d9, 0x6ffa34b676d30a3d,
+    0x7902ea2df16e8d0e, 0x995f3eba3b57b7ea, 0x2b61ec29ca12e643,
+    0xcb3c38be002bdca7, 0x0690511ec569e825, 0xe6cd85890f50d2c1,
+    0x54f3571afe158368, 0xb4ae838d342cb98c, 0xa2565d16b3913ebf,
+    0x420b898179a8045b, 0xf0355b1288ed55f2, 0x10688f8542d46f16,
+    0x2091a0b653403621, 0xc0cc742199790cc5, 0x72f2a6b2683c5d6c,
+    0x92af7225a2056788, 0x8457acbe25b8e0bb, 0x640a7829ef81da5f,
+    0xd634aaba1ec48bf6, 0x36697e2dd4fdb112, 0xfbc5178d11bf8590,
+    0x1b98c31adb86bf74, 0xa9a611892ac3eedd, 0x49fbc51ee0fad439,
+    0x5f031b856747530a, 0xbf5ecf12ad7e69ee, 0x0d601d815c3b3847,
+    0xed3dc916960202a3, 0x04e061eb79b14fc6, 0xe4bdb57cb3887522,
+    0x568367ef42cd248b, 0xb6deb37888f41e6f, 0xa0266de30f49995c,
+    0x407bb974c570a3b8, 0xf2456be73435f211, 0x1218bf70fe0cc8f5,
+    0xdfb4d6d03b4efc77, 0x3fe90247f177c693, 0x8dd7d0d40032973a,
+    0x6d8a0443ca0badde, 0x7b72dad84db62aed, 0x9b2f0e4f878f1009,
+    0x2911dcdc76ca41a0, 0xc94c084bbcf37b44, 0x6872220c06a2c5ef,
+    0x882ff69bcc9bff0b, 0x3a1124083ddeaea2, 0xda4cf09ff7e79446,
+    0xccb42e04705a1375, 0x2ce9fa93ba632991, 0x9ed728004b267838,
+    0x7e8afc97811f42dc, 0xb3269537445d765e, 0x537b41a08e644cba,
+    0xe14593337f211d13, 0x011847a4b51827f7, 0x17e0993f32a5a0c4,
+    0xf7bd4da8f89c9a20, 0x45839f3b09d9cb89, 0xa5de4bacc3e0f16d,
+    0x4c03e3512c53bc08, 0xac5e37c6e66a86ec, 0x1e60e555172fd745,
+    0xfe3d31c2dd16eda1, 0xe8c5ef595aab6a92, 0x08983bce90925076,
+    0xbaa6e95d61d701df, 0x5afb3dcaabee3b3b, 0x9757546a6eac0fb9,
+    0x770a80fda495355d, 0xc534526e55d064f4, 0x256986f99fe95e10,
+    0x339158621854d923, 0xd3cc8cf5d26de3c7, 0x61f25e662328b26e,
+    0x81af8af1e911888a},
+   {0x0000000000000000, 0xf075e4ae5e05bdff, 0x723366771305657b,
+    0x824682d94d00d884, 0xe466ccee260acaf6, 0x14132840780f7709,
+    0x9655aa99350faf8d, 0x66204e376b0a1272, 0x5a1536f7e31b8b69,
+    0xaa60d259bd1e3696, 0x28265080f01eee12, 0xd853b42eae1b53ed,
+    0xbe73fa19c511419f, 0x4e061eb79b14fc60, 0xcc409c6ed61424e4,
+    0x3c3578c08811991b, 0xb42a6defc63716d2, 0x445f89419832ab2d,
+    0xc6190b98d53273a9, 0x366cef368b37ce56, 0x504ca101e03ddc24,
+    0xa03945afbe3861db, 0x227fc776f338b95f, 0xd20a23d8ad3d04a0,
+    0xee3f5b18252c9dbb, 0x1e4abfb67b292044, 0x9c0c3d6f3629f8c0,
+    0x6c79d9c1682c453f, 0x0a5997f60326574d, 0xfa2c73585d23eab2,
+    0x786af18110233236, 0x881f152f4e268fc9, 0xfa8c74f423603321,
+    0x0af9905a7d658ede, 0x88bf12833065565a, 0x78caf62d6e60eba5,
+    0x1eeab81a056af9d7, 0xee9f5cb45b6f4428, 0x6cd9de6d166f9cac,
+    0x9cac3ac3486a2153, 0xa0994203c07bb848, 0x50eca6ad9e7e05b7,
+    0xd2aa2474d37edd33, 0x22dfc0da8d7b60cc, 0x44ff8eede67172be,
+    0xb48a6a43b874cf41, 0x36cce89af57417c5, 0xc6b90c34ab71aa3a,
+    0x4ea6191be55725f3, 0xbed3fdb5bb52980c, 0x3c957f6cf6524088,
+    0xcce09bc2a857fd77, 0xaac0d5f5c35def05, 0x5ab5315b9d5852fa,
+    0xd8f3b382d0588a7e, 0x2886572c8e5d3781, 0x14b32fec064cae9a,
+    0xe4c6cb4258491365, 0x6680499b1549cbe1, 0x96f5ad354b4c761e,
+    0xf0d5e3022046646c, 0x00a007ac7e43d993, 0x82e6857533430117,
+    0x729361db6d46bce8, 0x67c046c3e9ce78c7, 0x97b5a26db7cbc538,
+    0x15f320b4facb1dbc, 0xe586c41aa4cea043, 0x83a68a2dcfc4b231,
+    0x73d36e8391c10fce, 0xf195ec5adcc1d74a, 0x01e008f482c46ab5,
+    0x3dd570340ad5f3ae, 0xcda0949a54d04e51, 0x4fe6164319d096d5,
+    0xbf93f2ed47d52b2a, 0xd9b3bcda2cdf3958, 0x29c6587472da84a7,
+    0xab80daad3fda5c23, 0x5bf53e0361dfe1dc, 0xd3ea2b2c2ff96e15,
+    0x239fcf8271fcd3ea, 0xa1d94d5b3cfc0b6e, 0x51aca9f562f9b691,
+    0x378ce7c209f3a4e3, 0xc7f9036c57f6191c, 0x45bf81b51af6c198,
+    0xb5ca651b44f37c67, 0x89ff1ddbcce2e57c, 0x798af97592e75883,
+    0xfbcc7bacdfe78007, 0x0bb99f0281e23df8, 0x6d99d135eae82f8a,
+    0x9dec359bb4ed9275, 0x1faab742f9ed4af1, 0xefdf53eca7e8f70e,
+    0x9d4c3237caae4be6, 0x6d39d69994abf619, 0xef7f5440d9ab2e9d,
+    0x1f0ab0ee87ae9362, 0x792afed9eca48110, 0x895f1a77b2a13cef,
+    0x0b1998aeffa1e46b, 0xfb6c7c00a1a45994, 0xc75904c029b5c08f,
+    0x372ce06e77b07d70, 0xb56a62b73ab0a5f4, 0x451f861964b5180b,
+    0x233fc82e0fbf0a79, 0xd34a2c8051bab786, 0x510cae591cba6f02,
+    0xa1794af742bfd2fd, 0x29665fd80c995d34, 0xd913bb76529ce0cb,
+    0x5b5539af1f9c384f, 0xab20dd01419985b0, 0xcd0093362a9397c2,
+    0x3d75779874962a3d, 0xbf33f5413996f2b9, 0x4f4611ef67934f46,
+    0x7373692fef82d65d, 0x83068d81b1876ba2, 0x01400f58fc87b326,
+    0xf135ebf6a2820ed9, 0x9715a5c1c9881cab, 0x6760416f978da154,
+    0xe526c3b6da8d79d0, 0x155327188488c42f, 0xcf808d87d39cf18e,
+    0x3ff569298d994c71, 0xbdb3ebf0c09994f5, 0x4dc60f5e9e9c290a,
+    0x2be64169f5963b78, 0xdb93a5c7ab938687, 0x59d5271ee6935e03,
+    0xa9a0c3b0b896e3fc, 0x9595bb7030877ae7, 0x65e05fde6e82c718,
+    0xe7a6dd0723821f9c, 0x17d339a97d87a263, 0x71f3779e168db011,
+    0x8186933048880dee, 0x03c011e90588d56a, 0xf3b5f5475b8d6895,
+    0x7baae06815abe75c, 0x8bdf04c64bae5aa3, 0x0999861f06ae8227,
+    0xf9ec62b158ab3fd8, 0x9fcc2c8633a12daa, 0x6fb9c8286da49055,
+    0xedff4af120a448d1, 0x1d8aae5f7ea1f52e, 0x21bfd69ff6b06c35,
+    0xd1ca3231a8b5d1ca, 0x538cb0e8e5b5094e, 0xa3f95446bbb0b4b1,
+    0xc5d91a71d0baa6c3, 0x35acfedf8ebf1b3c, 0xb7ea7c06c3bfc3b8,
+    0x479f98a89dba7e47, 0x350cf973f0fcc2af, 0xc5791dddaef97f50,
+    0x473f9f04e3f9a7d4, 0xb74a7baabdfc1a2b, 0xd16a359dd6f60859,
+    0x211fd13388f3b5a6, 0xa35953eac5f36d22, 0x532cb7449bf6d0dd,
+    0x6f19cf8413e749c6, 0x9f6c2b2a4de2f439, 0x1d2aa9f300e22cbd,
+    0xed5f4d5d5ee79142, 0x8b7f036a35ed8330, 0x7b0ae7c46be83ecf,
+    0xf94c651d26e8e64b, 0x093981b378ed5bb4, 0x8126949c36cbd47d,
+    0x7153703268ce6982, 0xf315f2eb25ceb106, 0x036016457bcb0cf9,
+    0x6540587210c11e8b, 0x9535bcdc4ec4a374, 0x17733e0503c47bf0,
+    0xe706daab5dc1c60f, 0xdb33a26bd5d05f14, 0x2b4646c58bd5e2eb,
+    0xa900c41cc6d53a6f, 0x597520b298d08790, 0x3f556e85f3da95e2,
+    0xcf208a2baddf281d, 0x4d6608f2e0dff099, 0xbd13ec5cbeda4d66,
+    0xa840cb443a528949, 0x58352fea645734b6, 0xda73ad332957ec32,
+    0x2a06499d775251cd, 0x4c2607aa1c5843bf, 0xbc53e304425dfe40,
+    0x3e1561dd0f5d26c4, 0xce60857351589b3b, 0xf255fdb3d9490220,
+    0x0220191d874cbfdf, 0x80669bc4ca4c675b, 0x70137f6a9449daa4,
+    0x1633315dff43c8d6, 0xe646d5f3a1467529, 0x6400572aec46adad,
+    0x9475b384b2431052, 0x1c6aa6abfc659f9b, 0xec1f4205a2602264,
+    0x6e59c0dcef60fae0, 0x9e2c2472b165471f, 0xf80c6a45da6f556d,
+    0x08798eeb846ae892, 0x8a3f0c32c96a3016, 0x7a4ae89c976f8de9,
+    0x467f905c1f7e14f2, 0xb60a74f2417ba90d, 0x344cf62b0c7b7189,
+    0xc4391285527ecc76, 0xa2195cb23974de04, 0x526cb81c677163fb,
+    0xd02a3ac52a71bb7f, 0x205fde6b74740680, 0x52ccbfb01932ba68,
+    0xa2b95b1e47370797, 0x20ffd9c70a37df13, 0xd08a3d69543262ec,
+    0xb6aa735e3f38709e, 0x46df97f0613dcd61, 0xc49915292c3d15e5,
+    0x34ecf1877238a81a, 0x08d98947fa293101, 0xf8ac6de9a42c8cfe,
+    0x7aeaef30e92c547a, 0x8a9f0b9eb729e985, 0xecbf45a9dc23fbf7,
+    0x1ccaa10782264608, 0x9e8c23decf269e8c, 0x6ef9c77091232373,
+    0xe6e6d25fdf05acba, 0x169336f181001145, 0x94d5b428cc00c9c1,
+    0x64a050869205743e, 0x02801eb1f90f664c, 0xf2f5fa1fa70adbb3,
+    0x70b378c6ea0a0337, 0x80c69c68b40fbec8, 0xbcf3e4a83c1e27d3,
+    0x4c860006621b9a2c, 0xcec082df2f1b42a8, 0x3eb56671711eff57,
+    0x589528461a14ed25, 0xa8e0cce8441150da, 0x2aa64e310911885e,
+    0xdad3aa9f571435a1},
+   {0x0000000000000000, 0x0dd9b4240837fd99, 0x1bb36848106ffb32,
+    0x166adc6c185806ab, 0x3766d09020dff664, 0x3abf64b428e80bfd,
+    0x2cd5b8d830b00d56, 0x210c0cfc3887f0cf, 0x6ecda12041bfecc8,
+    0x6314150449881151, 0x757ec96851d017fa, 0x78a77d4c59e7ea63,
+    0x59ab71b061601aac, 0x5472c5946957e735, 0x421819f8710fe19e,
+    0x4fc1addc79381c07, 0xdd9b4240837fd990, 0xd042f6648b482409,
+    0xc6282a08931022a2, 0xcbf19e2c9b27df3b, 0xeafd92d0a3a02ff4,
+    0xe72426f4ab97d26d, 0xf14efa98b3cfd4c6, 0xfc974ebcbbf8295f,
+    0xb356e360c2c03558, 0xbe8f5744caf7c8c1, 0xa8e58b28d2afce6a,
+    0xa53c3f0cda9833f3, 0x843033f0e21fc33c, 0x89e987d4ea283ea5,
+    0x9f835bb8f270380e, 0x925aef9cfa47c597, 0x29ee2baaa9f1ada5,
+    0x24379f8ea1c6503c, 0x325d43e2b99e5697, 0x3f84f7c6b1a9ab0e,
+    0x1e88fb3a892e5bc1, 0x13514f1e8119a658, 0x053b93729941a0f3,
+    0x08e2275691765d6a, 0x47238a8ae84e416d, 0x4afa3eaee079bcf4,
+    0x5c90e2c2f821ba5f, 0x514956e6f01647c6, 0x70455a1ac891b709,
+    0x7d9cee3ec0a64a90, 0x6bf63252d8fe4c3b, 0x662f8676d0c9b1a2,
+    0xf47569ea2a8e7435, 0xf9acddce22b989ac, 0xefc601a23ae18f07,
+    0xe21fb58632d6729e, 0xc313b97a0a518251, 0xceca0d5e02667fc8,
+    0xd8a0d1321a3e7963, 0xd5796516120984fa, 0x9ab8c8ca6b3198fd,
+    0x97617cee63066564, 0x810ba0827b5e63cf, 0x8cd214a673699e56,
+    0xadde185a4bee6e99, 0xa007ac7e43d99300, 0xb66d70125b8195ab,
+    0xbbb4c43653b66832, 0x53dc575553e35b4a, 0x5e05e3715bd4a6d3,
+    0x486f3f1d438ca078, 0x45b68b394bbb5de1, 0x64ba87c5733cad2e,
+    0x696333e17b0b50b7, 0x7f09ef8d6353561c, 0x72d05ba96b64ab85,
+    0x3d11f675125cb782, 0x30c842511a6b4a1b, 0x26a29e3d02334cb0,
+    0x2b7b2a190a04b129, 0x0a7726e5328341e6, 0x07ae92c13ab4bc7f,
+    0x11c44ead22ecbad4, 0x1c1dfa892adb474d, 0x8e471515d09c82da,
+    0x839ea131d8ab7f43, 0x95f47d5dc0f379e8, 0x982dc979c8c48471,
+    0xb921c585f04374be, 0xb4f871a1f8748927, 0xa292adcde02c8f8c,
+    0xaf4b19e9e81b7215, 0xe08ab43591236e12, 0xed5300119914938b,
+    0xfb39dc7d814c9520, 0xf6e06859897b68b9, 0xd7ec64a5b1fc9876,
+    0xda35d081b9cb65ef, 0xcc5f0ceda1936344, 0xc186b8c9a9a49edd,
+    0x7a327cfffa12f6ef, 0x77ebc8dbf2250b76, 0x618114b7ea7d0ddd,
+    0x6c58a093e24af044, 0x4d54ac6fdacd008b, 0x408d184bd2fafd12,
+    0x56e7c427caa2fbb9, 0x5b3e7003c2950620, 0x14ffdddfbbad1a27,
+    0x192669fbb39ae7be, 0x0f4cb597abc2e115, 0x029501b3a3f51c8c,
+    0x23990d4f9b72ec43, 0x2e40b96b934511da, 0x382a65078b1d1771,
+    0x35f3d123832aeae8, 0xa7a93ebf796d2f7f, 0xaa708a9b715ad2e6,
+    0xbc1a56f76902d44d, 0xb1c3e2d3613529d4, 0x90cfee2f59b2d91b,
+    0x9d165a0b51852482, 0x8b7c866749dd2229, 0x86a5324341eadfb0,
+    0xc9649f9f38d2c3b7, 0xc4bd2bbb30e53e2e, 0xd2d7f7d728bd3885,
+    0xdf0e43f3208ac51c, 0xfe024f0f180d35d3, 0xf3dbfb2b103ac84a,
+    0xe5b127470862cee1, 0xe868936300553378, 0xa7b8aeaaa7c6b694,
+    0xaa611a8eaff14b0d, 0xbc0bc6e2b7a94da6, 0xb1d272c6bf9eb03f,
+    0x90de7e3a871940f0, 0x9d07ca1e8f2ebd69, 0x8b6d16729776bbc2,
+    0x86b4a2569f41465b, 0xc9750f8ae6795a5c, 0xc4acbbaeee4ea7c5,
+    0xd2c667c2f616a16e, 0xdf1fd3e6fe215cf7, 0xfe13df1ac6a6ac38,
+    0xf3ca6b3ece9151a1, 0xe5a0b752d6c9570a, 0xe8790376defeaa93,
+    0x7a23ecea24b96f04, 0x77fa58ce2c8e929d, 0x619084a234d69436,
+    0x6c4930863ce169af, 0x4d453c7a04669960, 0x409c885e0c5164f9,
+    0x56f6543214096252, 0x5b2fe0161c3e9fcb, 0x14ee4dca650683cc,
+    0x1937f9ee6d317e55, 0x0f5d2582756978fe, 0x028491a67d5e8567,
+    0x23889d5a45d975a8, 0x2e51297e4dee8831, 0x383bf51255b68e9a,
+    0x35e241365d817303, 0x8e5685000e371b31, 0x838f31240600e6a8,
+    0x95e5ed481e58e003, 0x983c596c166f1d9a, 0xb93055902ee8ed55,
+    0xb4e9e1b426df10cc, 0xa2833dd83e871667, 0xaf5a89fc36b0ebfe,
+    0xe09b24204f88f7f9, 0xed42900447bf0a60, 0xfb284c685fe70ccb,
+    0xf6f1f84c57d0f152, 0xd7fdf4b06f57019d, 0xda2440946760fc04,
+    0xcc4e9cf87f38faaf, 0xc19728dc770f0736, 0x53cdc7408d48c2a1,
+    0x5e147364857f3f38, 0x487eaf089d273993, 0x45a71b2c9510c40a,
+    0x64ab17d0ad9734c5, 0x6972a3f4a5a0c95c, 0x7f187f98bdf8cff7,
+    0x72c1cbbcb5cf326e, 0x3d006660ccf72e69, 0x30d9d244c4c0d3f0,
+    0x26b30e28dc98d55b, 0x2b6aba0cd4af28c2, 0x0a66b6f0ec28d80d,
+    0x07bf02d4e41f2594, 0x11d5deb8fc47233f, 0x1c0c6a9cf470dea6,
+    0xf464f9fff425edde, 0xf9bd4ddbfc121047, 0xefd791b7e44a16ec,
+    0xe20e2593ec7deb75, 0xc302296fd4fa1bba, 0xcedb9d4bdccde623,
+    0xd8b14127c495e088, 0xd568f503cca21d11, 0x9aa958dfb59a0116,
+    0x9770ecfbbdadfc8f, 0x811a3097a5f5fa24, 0x8cc384b3adc207bd,
+    0xadcf884f9545f772, 0xa0163c6b9d720aeb, 0xb67ce007852a0c40,
+    0xbba554238d1df1d9, 0x29ffbbbf775a344e, 0x24260f9b7f6dc9d7,
+    0x324cd3f76735cf7c, 0x3f9567d36f0232e5, 0x1e996b2f5785c22a,
+    0x1340df0b5fb23fb3, 0x052a036747ea3918, 0x08f3b7434fddc481,
+    0x47321a9f36e5d886, 0x4aebaebb3ed2251f, 0x5c8172d7268a23b4,
+    0x5158c6f32ebdde2d, 0x7054ca0f163a2ee2, 0x7d8d7e2b1e0dd37b,
+    0x6be7a2470655d5d0, 0x663e16630e622849, 0xdd8ad2555dd4407b,
+    0xd053667155e3bde2, 0xc639ba1d4dbbbb49, 0xcbe00e39458c46d0,
+    0xeaec02c57d0bb61f, 0xe735b6e1753c4b86, 0xf15f6a8d6d644d2d,
+    0xfc86dea96553b0b4, 0xb34773751c6bacb3, 0xbe9ec751145c512a,
+    0xa8f41b3d0c045781, 0xa52daf190433aa18, 0x8421a3e53cb45ad7,
+    0x89f817c13483a74e, 0x9f92cbad2cdba1e5, 0x924b7f8924ec5c7c,
+    0x00119015deab99eb, 0x0dc82431d69c6472, 0x1ba2f85dcec462d9,
+    0x167b4c79c6f39f40, 0x37774085fe746f8f, 0x3aaef4a1f6439216,
+    0x2cc428cdee1b94bd, 0x211d9ce9e62c6924, 0x6edc31359f147523,
+    0x63058511972388ba, 0x756f597d8f7b8e11, 0x78b6ed59874c7388,
+    0x59bae1a5bfcb8347, 0x54635581b7fc7ede, 0x420989edafa47875,
+    0x4fd03dc9a79385ec},
+   {0x0000000000000000, 0xdda9f27ee08373ad, 0x298b4bd66e08f9df,
+    0xf422b9a88e8b8a72, 0x531697acdc11f3be, 0x8ebf65d23c928013,
+    0x7a9ddc7ab2190a61, 0xa7342e04529a79cc, 0xa62d2f59b823e77c,
+    0x7b84dd2758a094d1, 0x8fa6648fd62b1ea3, 0x520f96f136a86d0e,
+    0xf53bb8f5643214c2, 0x28924a8b84b1676f, 0xdcb0f3230a3aed1d,
+    0x0119015deab99eb0, 0xde82f198df49d07d, 0x032b03e63fcaa3d0,
+    0xf709ba4eb14129a2, 0x2aa0483051c25a0f, 0x8d946634035823c3,
+    0x503d944ae3db506e, 0xa41f2de26d50da1c, 0x79b6df9c8dd3a9b1,
+    0x78afdec1676a3701, 0xa5062cbf87e944ac, 0x512495170962cede,
+    0x8c8d6769e9e1bd73, 0x2bb9496dbb7bc4bf, 0xf610bb135bf8b712,
+    0x023202bbd5733d60, 0xdf9bf0c535f04ecd, 0x2fdd4c1a119dbe7f,
+    0xf274be64f11ecdd2, 0x065607cc7f9547a0, 0xdbfff5b29f16340d,
+    0x7ccbdbb6cd8c4dc1, 0xa16229c82d0f3e6c, 0x55409060a384b41e,
+    0x88e9621e4307c7b3, 0x89f06343a9be5903, 0x5459913d493d2aae,
+    0xa07b2895c7b6a0dc, 0x7dd2daeb2735d371, 0xdae6f4ef75afaabd,
+    0x074f0691952cd910, 0xf36dbf391ba75362, 0x2ec44d47fb2420cf,
+    0xf15fbd82ced46e02, 0x2cf64ffc2e571daf, 0xd8d4f654a0dc97dd,
+    0x057d042a405fe470, 0xa2492a2e12c59dbc, 0x7fe0d850f246ee11,
+    0x8bc261f87ccd6463, 0x566b93869c4e17ce, 0x577292db76f7897e,
+    0x8adb60a59674fad3, 0x7ef9d90d18ff70a1, 0xa3502b73f87c030c,
+    0x04640577aae67ac0, 0xd9cdf7094a65096d, 0x2def4ea1c4ee831f,
+    0xf046bcdf246df0b2, 0x5fba9834233b7cfe, 0x82136a4ac3b80f53,
+    0x7631d3e24d338521, 0xab98219cadb0f68c, 0x0cac0f98ff2a8f40,
+    0xd105fde61fa9fced, 0x2527444e9122769f, 0xf88eb63071a10532,
+    0xf997b76d9b189b82, 0x243e45137b9be82f, 0xd01cfcbbf510625d,
+    0x0db50ec5159311f0, 0xaa8120c14709683c, 0x7728d2bfa78a1b91,
+    0x830a6b17290191e3, 0x5ea39969c982e24e, 0x813869acfc72ac83,
+    0x5c919bd21cf1df2e, 0xa8b3227a927a555c, 0x751ad00472f926f1,
+    0xd22efe0020635f3d, 0x0f870c7ec0e02c90, 0xfba5b5d64e6ba6e2,
+    0x260c47a8aee8d54f, 0x271546f544514bff, 0xfabcb48ba4d23852,
+    0x0e9e0d232a59b220, 0xd337ff5dcadac18d, 0x7403d1599840b841,
+    0xa9aa232778c3cbec, 0x5d889a8ff648419e, 0x802168f116cb3233,
+    0x7067d42e32a6c281, 0xadce2650d225b12c, 0x59ec9ff85cae3b5e,
+    0x84456d86bc2d48f3, 0x23714382eeb7313f, 0xfed8b1fc0e344292,
+    0x0afa085480bfc8e0, 0xd753fa2a603cbb4d, 0xd64afb778a8525fd,
+    0x0be309096a065650, 0xffc1b0a1e48ddc22, 0x226842df040eaf8f,
+    0x855c6cdb5694d643, 0x58f59ea5b617a5ee, 0xacd7270d389c2f9c,
+    0x717ed573d81f5c31, 0xaee525b6edef12fc, 0x734cd7c80d6c6151,
+    0x876e6e6083e7eb23, 0x5ac79c1e6364988e, 0xfdf3b21a31fee142,
+    0x205a4064d17d92ef, 0xd478f9cc5ff6189d, 0x09d10bb2bf756b30,
+    0x08c80aef55ccf580, 0xd561f891b54f862d, 0x214341393bc40c5f,
+    0xfceab347db477ff2, 0x5bde9d4389dd063e, 0x86776f3d695e7593,
+    0x7255d695e7d5ffe1, 0xaffc24eb07568c4c, 0xbf7530684676f9fc,
+    0x62dcc216a6f58a51, 0x96fe7bbe287e0023, 0x4b5789c0c8fd738e,
+    0xec63a7c49a670a42, 0x31ca55ba7ae479ef, 0xc5e8ec12f46ff39d,
+    0x18411e6c14ec8030, 0x19581f31fe551e80, 0xc4f1ed4f1ed66d2d,
+    0x30d354e7905de75f, 0xed7aa69970de94f2, 0x4a4e889d2244ed3e,
+    0x97e77ae3c2c79e93, 0x63c5c34b4c4c14e1, 0xbe6c3135accf674c,
+    0x61f7c1f0993f2981, 0xbc5e338e79bc5a2c, 0x487c8a26f737d05e,
+    0x95d5785817b4a3f3, 0x32e1565c452eda3f, 0xef48a422a5ada992,
+    0x1b6a1d8a2b2623e0, 0xc6c3eff4cba5504d, 0xc7daeea9211ccefd,
+    0x1a731cd7c19fbd50, 0xee51a57f4f143722, 0x33f85701af97448f,
+    0x94cc7905fd0d3d43, 0x49658b7b1d8e4eee, 0xbd4732d39305c49c,
+    0x60eec0ad7386b731, 0x90a87c7257eb4783, 0x4d018e0cb768342e,
+    0xb92337a439e3be5c, 0x648ac5dad960cdf1, 0xc3beebde8bfab43d,
+    0x1e1719a06b79c790, 0xea35a008e5f24de2, 0x379c527605713e4f,
+    0x3685532befc8a0ff, 0xeb2ca1550f4bd352, 0x1f0e18fd81c05920,
+    0xc2a7ea8361432a8d, 0x6593c48733d95341, 0xb83a36f9d35a20ec,
+    0x4c188f515dd1aa9e, 0x91b17d2fbd52d933, 0x4e2a8dea88a297fe,
+    0x93837f946821e453, 0x67a1c63ce6aa6e21, 0xba08344206291d8c,
+    0x1d3c1a4654b36440, 0xc095e838b43017ed, 0x34b751903abb9d9f,
+    0xe91ea3eeda38ee32, 0xe807a2b330817082, 0x35ae50cdd002032f,
+    0xc18ce9655e89895d, 0x1c251b1bbe0afaf0, 0xbb11351fec90833c,
+    0x66b8c7610c13f091, 0x929a7ec982987ae3, 0x4f338cb7621b094e,
+    0xe0cfa85c654d8502, 0x3d665a2285cef6af, 0xc944e38a0b457cdd,
+    0x14ed11f4ebc60f70, 0xb3d93ff0b95c76bc, 0x6e70cd8e59df0511,
+    0x9a527426d7548f63, 0x47fb865837d7fcce, 0x46e28705dd6e627e,
+    0x9b4b757b3ded11d3, 0x6f69ccd3b3669ba1, 0xb2c03ead53e5e80c,
+    0x15f410a9017f91c0, 0xc85de2d7e1fce26d, 0x3c7f5b7f6f77681f,
+    0xe1d6a9018ff41bb2, 0x3e4d59c4ba04557f, 0xe3e4abba5a8726d2,
+    0x17c61212d40caca0, 0xca6fe06c348fdf0d, 0x6d5bce686615a6c1,
+    0xb0f23c168696d56c, 0x44d085be081d5f1e, 0x997977c0e89e2cb3,
+    0x9860769d0227b203, 0x45c984e3e2a4c1ae, 0xb1eb3d4b6c2f4bdc,
+    0x6c42cf358cac3871, 0xcb76e131de3641bd, 0x16df134f3eb53210,
+    0xe2fdaae7b03eb862, 0x3f54589950bdcbcf, 0xcf12e44674d03b7d,
+    0x12bb1638945348d0, 0xe699af901ad8c2a2, 0x3b305deefa5bb10f,
+    0x9c0473eaa8c1c8c3, 0x41ad81944842bb6e, 0xb58f383cc6c9311c,
+    0x6826ca42264a42b1, 0x693fcb1fccf3dc01, 0xb49639612c70afac,
+    0x40b480c9a2fb25de, 0x9d1d72b742785673, 0x3a295cb310e22fbf,
+    0xe780aecdf0615c12, 0x13a217657eead660, 0xce0be51b9e69a5cd,
+    0x119015deab99eb00, 0xcc39e7a04b1a98ad, 0x381b5e08c59112df,
+    0xe5b2ac7625126172, 0x42868272778818be, 0x9f2f700c970b6b13,
+    0x6b0dc9a41980e161, 0xb6a43bdaf90392cc, 0xb7bd3a8713ba0c7c,
+    0x6a14c8f9f3397fd1, 0x9e3671517db2f5a3, 0x439f832f9d31860e,
+    0xe4abad2bcfabffc2, 0x39025f552f288c6f, 0xcd20e6fda1a3061d,
+    0x10891483412075b0},
+   {0x0000000000000000, 0xec32cffb23e3ed7d, 0x4abd30dde8c9c47f,
+    0xa68fff26cb2a2902, 0x957a61bbd19388fe, 0x7948ae40f2706583,
+    0xdfc75166395a4c81, 0x33f59e9d1ab9a1fc, 0xb82c6c5c0c290f79,
+    0x541ea3a72fcae204, 0xf2915c81e4e0cb06, 0x1ea3937ac703267b,
+    0x2d560de7ddba8787, 0xc164c21cfe596afa, 0x67eb3d3a357343f8,
+    0x8bd9f2c11690ae85, 0xe2807793b75c0077, 0x0eb2b86894bfed0a,
+    0xa83d474e5f95c408, 0x440f88b57c762975, 0x77fa162866cf8889,
+    0x9bc8d9d3452c65f4, 0x3d4726f58e064cf6, 0xd175e90eade5a18b,
+    0x5aac1bcfbb750f0e, 0xb69ed4349896e273, 0x10112b1253bccb71,
+    0xfc23e4e9705f260c, 0xcfd67a746ae687f0, 0x23e4b58f49056a8d,
+    0x856b4aa9822f438f, 0x69598552a1ccaef2, 0x57d8400cc1b61e6b,
+    0xbbea8ff7e255f316, 0x1d6570d1297fda14, 0xf157bf2a0a9c3769,
+    0xc2a221b710259695, 0x2e90ee4c33c67be8, 0x881f116af8ec52ea,
+    0x642dde91db0fbf97, 0xeff42c50cd9f1112, 0x03c6e3abee7cfc6f,
+    0xa5491c8d2556d56d, 0x497bd37606b53810, 0x7a8e4deb1c0c99ec,
+    0x96bc82103fef7491, 0x30337d36f4c55d93, 0xdc01b2cdd726b0ee,
+    0xb558379f76ea1e1c, 0x596af8645509f361, 0xffe507429e23da63,
+    0x13d7c8b9bdc0371e, 0x20225624a77996e2, 0xcc1099df849a7b9f,
+    0x6a9f66f94fb0529d, 0x86ada9026c53bfe0, 0x0d745bc37ac31165,
+    0xe14694385920fc18, 0x47c96b1e920ad51a, 0xabfba4e5b1e93867,
+    0x980e3a78ab50999b, 0x743cf58388b374e6, 0xd2b30aa543995de4,
+    0x3e81c55e607ab099, 0xafb08019836c3cd6, 0x43824fe2a08fd1ab,
+    0xe50db0c46ba5f8a9, 0x093f7f3f484615d4, 0x3acae1a252ffb428,
+    0xd6f82e59711c5955, 0x7077d17fba367057, 0x9c451e8499d59d2a,
+    0x179cec458f4533af, 0xfbae23beaca6ded2, 0x5d21dc98678cf7d0,
+    0xb1131363446f1aad, 0x82e68dfe5ed6bb51, 0x6ed442057d35562c,
+    0xc85bbd23b61f7f2e, 0x246972d895fc9253, 0x4d30f78a34303ca1,
+    0xa102387117d3d1dc, 0x078dc757dcf9f8de, 0xebbf08acff1a15a3,
+    0xd84a9631e5a3b45f, 0x347859cac6405922, 0x92f7a6ec0d6a7020,
+    0x7ec569172e899d5d, 0xf51c9bd6381933d8, 0x192e542d1bfadea5,
+    0xbfa1ab0bd0d0f7a7, 0x539364f0f3331ada, 0x6066fa6de98abb26,
+    0x8c543596ca69565b, 0x2adbcab001437f59, 0xc6e9054b22a09224,
+    0xf868c01542da22bd, 0x145a0fee6139cfc0, 0xb2d5f0c8aa13e6c2,
+    0x5ee73f3389f00bbf, 0x6d12a1ae9349aa43, 0x81206e55b0aa473e,
+    0x27af91737b806e3c, 0xcb9d5e8858638341, 0x4044ac494ef32dc4,
+    0xac7663b26d10c0b9, 0x0af99c94a63ae9bb, 0xe6cb536f85d904c6,
+    0xd53ecdf29f60a53a, 0x390c0209bc834847, 0x9f83fd2f77a96145,
+    0x73b132d4544a8c38, 0x1ae8b786f58622ca, 0xf6da787dd665cfb7,
+    0x5055875b1d4fe6b5, 0xbc6748a03eac0bc8, 0x8f92d63d2415aa34,
+    0x63a019c607f64749, 0xc52fe6e0ccdc6e4b, 0x291d291bef3f8336,
+    0xa2c4dbdaf9af2db3, 0x4ef61421da4cc0ce, 0xe879eb071166e9cc,
+    0x044b24fc328504b1, 0x37beba61283ca54d, 0xdb8c759a0bdf4830,
+    0x7d038abcc0f56132, 0x91314547e3168c4f, 0xcdb9af18a9d66729,
+    0x218b60e38a358a54, 0x87049fc5411fa356, 0x6b36503e62fc4e2b,
+    0x58c3cea37845efd7, 0xb4f101585ba602aa, 0x127efe7e908c2ba8,
+    0xfe4c3185b36fc6d5, 0x7595c344a5ff6850, 0x99a70cbf861c852d,
+    0x3f28f3994d36ac2f, 0xd31a3c626ed54152, 0xe0efa2ff746ce0ae,
+    0x0cdd6d04578f0dd3, 0xaa5292229ca524d1, 0x46605dd9bf46c9ac,
+    0x2f39d88b1e8a675e, 0xc30b17703d698a23, 0x6584e856f643a321,
+    0x89b627add5a04e5c, 0xba43b930cf19efa0, 0x567176cbecfa02dd,
+    0xf0fe89ed27d02bdf, 0x1ccc46160433c6a2, 0x9715b4d712a36827,
+    0x7b277b2c3140855a, 0xdda8840afa6aac58, 0x319a4bf1d9894125,
+    0x026fd56cc330e0d9, 0xee5d1a97e0d30da4, 0x48d2e5b12bf924a6,
+    0xa4e02a4a081ac9db, 0x9a61ef1468607942, 0x765320ef4b83943f,
+    0xd0dcdfc980a9bd3d, 0x3cee1032a34a5040, 0x0f1b8eafb9f3f1bc,
+    0xe32941549a101cc1, 0x45a6be72513a35c3, 0xa994718972d9d8be,
+    0x224d83486449763b, 0xce7f4cb347aa9b46, 0x68f0b3958c80b244,
+    0x84c27c6eaf635f39, 0xb737e2f3b5dafec5, 0x5b052d08963913b8,
+    0xfd8ad22e5d133aba, 0x11b81dd57ef0d7c7, 0x78e19887df3c7935,
+    0x94d3577cfcdf9448, 0x325ca85a37f5bd4a, 0xde6e67a114165037,
+    0xed9bf93c0eaff1cb, 0x01a936c72d4c1cb6, 0xa726c9e1e66635b4,
+    0x4b14061ac585d8c9, 0xc0cdf4dbd315764c, 0x2cff3b20f0f69b31,
+    0x8a70c4063bdcb233, 0x66420bfd183f5f4e, 0x55b795600286feb2,
+    0xb9855a9b216513cf, 0x1f0aa5bdea4f3acd, 0xf3386a46c9acd7b0,
+    0x62092f012aba5bff, 0x8e3be0fa0959b682, 0x28b41fdcc2739f80,
+    0xc486d027e19072fd, 0xf7734ebafb29d301, 0x1b418141d8ca3e7c,
+    0xbdce7e6713e0177e, 0x51fcb19c3003fa03, 0xda25435d26935486,
+    0x36178ca60570b9fb, 0x90987380ce5a90f9, 0x7caabc7bedb97d84,
+    0x4f5f22e6f700dc78, 0xa36ded1dd4e33105, 0x05e2123b1fc91807,
+    0xe9d0ddc03c2af57a, 0x808958929de65b88, 0x6cbb9769be05b6f5,
+    0xca34684f752f9ff7, 0x2606a7b456cc728a, 0x15f339294c75d376,
+    0xf9c1f6d26f963e0b, 0x5f4e09f4a4bc1709, 0xb37cc60f875ffa74,
+    0x38a534ce91cf54f1, 0xd497fb35b22cb98c, 0x721804137906908e,
+    0x9e2acbe85ae57df3, 0xaddf5575405cdc0f, 0x41ed9a8e63bf3172,
+    0xe76265a8a8951870, 0x0b50aa538b76f50d, 0x35d16f0deb0c4594,
+    0xd9e3a0f6c8efa8e9, 0x7f6c5fd003c581eb, 0x935e902b20266c96,
+    0xa0ab0eb63a9fcd6a, 0x4c99c14d197c2017, 0xea163e6bd2560915,
+    0x0624f190f1b5e468, 0x8dfd0351e7254aed, 0x61cfccaac4c6a790,
+    0xc740338c0fec8e92, 0x2b72fc772c0f63ef, 0x188762ea36b6c213,
+    0xf4b5ad1115552f6e, 0x523a5237de7f066c, 0xbe089dccfd9ceb11,
+    0xd751189e5c5045e3, 0x3b63d7657fb3a89e, 0x9dec2843b499819c,
+    0x71dee7b8977a6ce1, 0x422b79258dc3cd1d, 0xae19b6deae202060,
+    0x089649f8650a0962, 0xe4a4860346e9e41f, 0x6f7d74c250794a9a,
+    0x834fbb39739aa7e7, 0x25c0441fb8b08ee5, 0xc9f28be49b536398,
+    0xfa07157981eac264, 0x1635da82a2092f19, 0xb0ba25a46923061b,
+    0x5c88ea5f4ac0eb66},
+   {0x0000000000000000, 0x09abf11afca2d0d7, 0x1357e235f945a1ae,
+    0x1afc132f05e77179, 0x26afc46bf28b435c, 0x2f0435710e29938b,
+    0x35f8265e0bcee2f2, 0x3c53d744f76c3225, 0x4d5f88d7e51686b8,
+    0x44f479cd19b4566f, 0x5e086ae21c532716, 0x57a39bf8e0f1f7c1,
+    0x6bf04cbc179dc5e4, 0x625bbda6eb3f1533, 0x78a7ae89eed8644a,
+    0x710c5f93127ab49d, 0x9abf11afca2d0d70, 0x9314e0b5368fdda7,
+    0x89e8f39a3368acde, 0x80430280cfca7c09, 0xbc10d5c438a64e2c,
+    0xb5bb24dec4049efb, 0xaf4737f1c1e3ef82, 0xa6ecc6eb3d413f55,
+    0xd7e099782f3b8bc8, 0xde4b6862d3995b1f, 0xc4b77b4dd67e2a66,
+    0xcd1c8a572adcfab1, 0xf14f5d13ddb0c894, 0xf8e4ac0921121843,
+    0xe218bf2624f5693a, 0xebb34e3cd857b9ed, 0xa7a68c743b540465,
+    0xae0d7d6ec7f6d4b2, 0xb4f16e41c211a5cb, 0xbd5a9f5b3eb3751c,
+    0x8109481fc9df4739, 0x88a2b905357d97ee, 0x925eaa2a309ae697,
+    0x9bf55b30cc383640, 0xeaf904a3de4282dd, 0xe352f5b922e0520a,
+    0xf9aee69627072373, 0xf005178cdba5f3a4, 0xcc56c0c82cc9c181,
+    0xc5fd31d2d06b1156, 0xdf0122fdd58c602f, 0xd6aad3e7292eb0f8,
+    0x3d199ddbf1790915, 0x34b26cc10ddbd9c2, 0x2e4e7fee083ca8bb,
+    0x27e58ef4f49e786c, 0x1bb659b003f24a49, 0x121da8aaff509a9e,
+    0x08e1bb85fab7ebe7, 0x014a4a9f06153b30, 0x7046150c146f8fad,
+    0x79ede416e8cd5f7a, 0x6311f739ed2a2e03, 0x6aba06231188fed4,
+    0x56e9d167e6e4ccf1, 0x5f42207d1a461c26, 0x45be33521fa16d5f,
+    0x4c15c248e303bd88, 0xdd95b7c3d9a6164f, 0xd43e46d92504c698,
+    0xcec255f620e3b7e1, 0xc769a4ecdc416736, 0xfb3a73a82b2d5513,
+    0xf29182b2d78f85c4, 0xe86d919dd268f4bd, 0xe1c660872eca246a,
+    0x90ca3f143cb090f7, 0x9961ce0ec0124020, 0x839ddd21c5f53159,
+    0x8a362c3b3957e18e, 0xb665fb7fce3bd3ab, 0xbfce0a653299037c,
+    0xa532194a377e7205, 0xac99e850cbdca2d2, 0x472aa66c138b1b3f,
+    0x4e815776ef29cbe8, 0x547d4459eaceba91, 0x5dd6b543166c6a46,
+    0x61856207e1005863, 0x682e931d1da288b4, 0x72d280321845f9cd,
+    0x7b797128e4e7291a, 0x0a752ebbf69d9d87, 0x03dedfa10a3f4d50,
+    0x1922cc8e0fd83c29, 0x10893d94f37aecfe, 0x2cdaead00416dedb,
+    0x25711bcaf8b40e0c, 0x3f8d08e5fd537f75, 0x3626f9ff01f1afa2,
+    0x7a333bb7e2f2122a, 0x7398caad1e50c2fd, 0x6964d9821bb7b384,
+    0x60cf2898e7156353, 0x5c9cffdc10795176, 0x55370ec6ecdb81a1,
+    0x4fcb1de9e93cf0d8, 0x4660ecf3159e200f, 0x376cb36007e49492,
+    0x3ec7427afb464445, 0x243b5155fea1353c, 0x2d90a04f0203e5eb,
+    0x11c3770bf56fd7ce, 0x1868861109cd0719, 0x0294953e0c2a7660,
+    0x0b3f6424f088a6b7, 0xe08c2a1828df1f5a, 0xe927db02d47dcf8d,
+    0xf3dbc82dd19abef4, 0xfa7039372d386e23, 0xc623ee73da545c06,
+    0xcf881f6926f68cd1, 0xd5740c462311fda8, 0xdcdffd5cdfb32d7f,
+    0xadd3a2cfcdc999e2, 0xa47853d5316b4935, 0xbe8440fa348c384c,
+    0xb72fb1e0c82ee89b, 0x8b7c66a43f42dabe, 0x82d797bec3e00a69,
+    0x982b8491c6077b10, 0x9180758b3aa5abc7, 0x29f3c0ac1c42321b,
+    0x205831b6e0e0e2cc, 0x3aa42299e50793b5, 0x330fd38319a54362,
+    0x0f5c04c7eec97147, 0x06f7f5dd126ba190, 0x1c0be6f2178cd0e9,
+    0x15a017e8eb2e003e, 0x64ac487bf954b4a3, 0x6d07b96105f66474,
+    0x77fbaa4e0011150d, 0x7e505b54fcb3c5da, 0x42038c100bdff7ff,
+    0x4ba87d0af77d2728, 0x51546e25f29a5651, 0x58ff9f3f0e388686,
+    0xb34cd103d66f3f6b, 0xbae720192acdefbc, 0xa01b33362f2a9ec5,
+    0xa9b0c22cd3884e12, 0x95e3156824e47c37, 0x9c48e472d846ace0,
+    0x86b4f75ddda1dd99, 0x8f1f064721030d4e, 0xfe1359d43379b9d3,
+    0xf7b8a8cecfdb6904, 0xed44bbe1ca3c187d, 0xe4ef4afb369ec8aa,
+    0xd8bc9dbfc1f2fa8f, 0xd1176ca53d502a58, 0xcbeb7f8a38b75b21,
+    0xc2408e90c4158bf6, 0x8e554cd82716367e, 0x87febdc2dbb4e6a9,
+    0x9d02aeedde5397d0, 0x94a95ff722f14707, 0xa8fa88b3d59d7522,
+    0xa15179a9293fa5f5, 0xbbad6a862cd8d48c, 0xb2069b9cd07a045b,
+    0xc30ac40fc200b0c6, 0xcaa135153ea26011, 0xd05d263a3b451168,
+    0xd9f6d720c7e7c1bf, 0xe5a50064308bf39a, 0xec0ef17ecc29234d,
+    0xf6f2e251c9ce5234, 0xff59134b356c82e3, 0x14ea5d77ed3b3b0e,
+    0x1d41ac6d1199ebd9, 0x07bdbf42147e9aa0, 0x0e164e58e8dc4a77,
+    0x3245991c1fb07852, 0x3bee6806e312a885, 0x21127b29e6f5d9fc,
+    0x28b98a331a57092b, 0x59b5d5a0082dbdb6, 0x501e24baf48f6d61,
+    0x4ae23795f1681c18, 0x4349c68f0dcacccf, 0x7f1a11cbfaa6feea,
+    0x76b1e0d106042e3d, 0x6c4df3fe03e35f44, 0x65e602e4ff418f93,
+    0xf466776fc5e42454, 0xfdcd86753946f483, 0xe731955a3ca185fa,
+    0xee9a6440c003552d, 0xd2c9b304376f6708, 0xdb62421ecbcdb7df,
+    0xc19e5131ce2ac6a6, 0xc835a02b32881671, 0xb939ffb820f2a2ec,
+    0xb0920ea2dc50723b, 0xaa6e1d8dd9b70342, 0xa3c5ec972515d395,
+    0x9f963bd3d279e1b0, 0x963dcac92edb3167, 0x8cc1d9e62b3c401e,
+    0x856a28fcd79e90c9, 0x6ed966c00fc92924, 0x677297daf36bf9f3,
+    0x7d8e84f5f68c888a, 0x742575ef0a2e585d, 0x4876a2abfd426a78,
+    0x41dd53b101e0baaf, 0x5b21409e0407cbd6, 0x528ab184f8a51b01,
+    0x2386ee17eadfaf9c, 0x2a2d1f0d167d7f4b, 0x30d10c22139a0e32,
+    0x397afd38ef38dee5, 0x05292a7c1854ecc0, 0x0c82db66e4f63c17,
+    0x167ec849e1114d6e, 0x1fd539531db39db9, 0x53c0fb1bfeb02031,
+    0x5a6b0a010212f0e6, 0x4097192e07f5819f, 0x493ce834fb575148,
+    0x756f3f700c3b636d, 0x7cc4ce6af099b3ba, 0x6638dd45f57ec2c3,
+    0x6f932c5f09dc1214, 0x1e9f73cc1ba6a689, 0x173482d6e704765e,
+    0x0dc891f9e2e30727, 0x046360e31e41d7f0, 0x3830b7a7e92de5d5,
+    0x319b46bd158f3502, 0x2b6755921068447b, 0x22cca488ecca94ac,
+    0xc97feab4349d2d41, 0xc0d41baec83ffd96, 0xda280881cdd88cef,
+    0xd383f99b317a5c38, 0xefd02edfc6166e1d, 0xe67bdfc53ab4beca,
+    0xfc87ccea3f53cfb3, 0xf52c3df0c3f11f64, 0x84206263d18babf9,
+    0x8d8b93792d297b2e, 0x9777805628ce0a57, 0x9edc714cd46cda80,
+    0xa28fa6082300e8a5, 0xab245712dfa23872, 0xb1d8443dda45490b,
+    0xb873b52726e799dc},
+   {0x0000000000000000, 0x53e7815838846436, 0xa7cf02b07108c86c,
+    0xf42883e8498cac5a, 0xdd46aa4b4d1f8e5d, 0x8ea12b13759bea6b,
+    0x7a89a8fb3c174631, 0x296e29a304932207, 0x2855fbbd3531023f,
+    0x7bb27ae50db56609, 0x8f9af90d4439ca53, 0xdc7d78557cbdae65,
+    0xf51351f6782e8c62, 0xa6f4d0ae40aae854, 0x52dc53460926440e,
+    0x013bd21e31a22038, 0x50abf77a6a62047e, 0x034c762252e66048,
+    0xf764f5ca1b6acc12, 0xa483749223eea824, 0x8ded5d31277d8a23,
+    0xde0adc691ff9ee15, 0x2a225f815675424f, 0x79c5ded96ef12679,
+    0x78fe0cc75f530641, 0x2b198d9f67d76277, 0xdf310e772e5bce2d,
+    0x8cd68f2f16dfaa1b, 0xa5b8a68c124c881c, 0xf65f27d42ac8ec2a,
+    0x0277a43c63444070, 0x519025645bc02446, 0xa157eef4d4c408fc,
+    0xf2b06facec406cca, 0x0698ec44a5ccc090, 0x557f6d1c9d48a4a6,
+    0x7c1144bf99db86a1, 0x2ff6c5e7a15fe297, 0xdbde460fe8d34ecd,
+    0x8839c757d0572afb, 0x89021549e1f50ac3, 0xdae59411d9716ef5,
+    0x2ecd17f990fdc2af, 0x7d2a96a1a879a699, 0x5444bf02acea849e,
+    0x07a33e5a946ee0a8, 0xf38bbdb2dde24cf2, 0xa06c3ceae56628c4,
+    0xf1fc198ebea60c82, 0xa21b98d6862268b4, 0x56331b3ecfaec4ee,
+    0x05d49a66f72aa0d8, 0x2cbab3c5f3b982df, 0x7f5d329dcb3de6e9,
+    0x8b75b17582b14ab3, 0xd892302dba352e85, 0xd9a9e2338b970ebd,
+    0x8a4e636bb3136a8b, 0x7e66e083fa9fc6d1, 0x2d8161dbc21ba2e7,
+    0x04ef4878c68880e0, 0x5708c920fe0ce4d6, 0xa3204ac8b780488c,
+    0xf0c7cb908f042cba, 0xd07772c206860f7d, 0x8390f39a3e026b4b,
+    0x77b87072778ec711, 0x245ff12a4f0aa327, 0x0d31d8894b998120,
+    0x5ed659d1731de516, 0xaafeda393a91494c, 0xf9195b6102152d7a,
+    0xf822897f33b70d42, 0xabc508270b336974, 0x5fed8bcf42bfc52e,
+    0x0c0a0a977a3ba118, 0x256423347ea8831f, 0x7683a26c462ce729,
+    0x82ab21840fa04b73, 0xd14ca0dc37242f45, 0x80dc85b86ce40b03,
+    0xd33b04e054606f35, 0x271387081decc36f, 0x74f406502568a759,
+    0x5d9a2ff321fb855e, 0x0e7daeab197fe168, 0xfa552d4350f34d32,
+    0xa9b2ac1b68772904, 0xa8897e0559d5093c, 0xfb6eff5d61516d0a,
+    0x0f467cb528ddc150, 0x5ca1fded1059a566, 0x75cfd44e14ca8761,
+    0x262855162c4ee357, 0xd200d6fe65c24f0d, 0x81e757a65d462b3b,
+    0x71209c36d2420781, 0x22c71d6eeac663b7, 0xd6ef9e86a34acfed,
+    0x85081fde9bceabdb, 0xac66367d9f5d89dc, 0xff81b725a7d9edea,
+    0x0ba934cdee5541b0, 0x584eb595d6d12586, 0x5975678be77305be,
+    0x0a92e6d3dff76188, 0xfeba653b967bcdd2, 0xad5de463aeffa9e4,
+    0x8433cdc0aa6c8be3, 0xd7d44c9892e8efd5, 0x23fccf70db64438f,
+    0x701b4e28e3e027b9, 0x218b6b4cb82003ff, 0x726cea1480a467c9,
+    0x864469fcc928cb93, 0xd5a3e8a4f1acafa5, 0xfccdc107f53f8da2,
+    0xaf2a405fcdbbe994, 0x5b02c3b7843745ce, 0x08e542efbcb321f8,
+    0x09de90f18d1101c0, 0x5a3911a9b59565f6, 0xae119241fc19c9ac,
+    0xfdf61319c49dad9a, 0xd4983abac00e8f9d, 0x877fbbe2f88aebab,
+    0x7357380ab10647f1, 0x20b0b952898223c7, 0x32364aafa202007f,
+    0x61d1cbf79a866449, 0x95f9481fd30ac813, 0xc61ec947eb8eac25,
+    0xef70e0e4ef1d8e22, 0xbc9761bcd799ea14, 0x48bfe2549e15464e,
+    0x1b58630ca6912278, 0x1a63b11297330240, 0x4984304aafb76676,
+    0xbdacb3a2e63bca2c, 0xee4b32fadebfae1a, 0xc7251b59da2c8c1d,
+    0x94c29a01e2a8e82b, 0x60ea19e9ab244471, 0x330d98b193a02047,
+    0x629dbdd5c8600401, 0x317a3c8df0e46037, 0xc552bf65b968cc6d,
+    0x96b53e3d81eca85b, 0xbfdb179e857f8a5c, 0xec3c96c6bdfbee6a,
+    0x1814152ef4774230, 0x4bf39476ccf32606, 0x4ac84668fd51063e,
+    0x192fc730c5d56208, 0xed0744d88c59ce52, 0xbee0c580b4ddaa64,
+    0x978eec23b04e8863, 0xc4696d7b88caec55, 0x3041ee93c146400f,
+    0x63a66fcbf9c22439, 0x9361a45b76c60883, 0xc08625034e426cb5,
+    0x34aea6eb07cec0ef, 0x674927b33f4aa4d9, 0x4e270e103bd986de,
+    0x1dc08f48035de2e8, 0xe9e80ca04ad14eb2, 0xba0f8df872552a84,
+    0xbb345fe643f70abc, 0xe8d3debe7b736e8a, 0x1cfb5d5632ffc2d0,
+    0x4f1cdc0e0a7ba6e6, 0x6672f5ad0ee884e1, 0x359574f5366ce0d7,
+    0xc1bdf71d7fe04c8d, 0x925a7645476428bb, 0xc3ca53211ca40cfd,
+    0x902dd279242068cb, 0x640551916dacc491, 0x37e2d0c95528a0a7,
+    0x1e8cf96a51bb82a0, 0x4d6b7832693fe696, 0xb943fbda20b34acc,
+    0xeaa47a8218372efa, 0xeb9fa89c29950ec2, 0xb87829c411116af4,
+    0x4c50aa2c589dc6ae, 0x1fb72b746019a298, 0x36d902d7648a809f,
+    0x653e838f5c0ee4a9, 0x91160067158248f3, 0xc2f1813f2d062cc5,
+    0xe241386da4840f02, 0xb1a6b9359c006b34, 0x458e3addd58cc76e,
+    0x1669bb85ed08a358, 0x3f079226e99b815f, 0x6ce0137ed11fe569,
+    0x98c8909698934933, 0xcb2f11cea0172d05, 0xca14c3d091b50d3d,
+    0x99f34288a931690b, 0x6ddbc160e0bdc551, 0x3e3c4038d839a167,
+    0x1752699bdcaa8360, 0x44b5e8c3e42ee756, 0xb09d6b2bada24b0c,
+    0xe37aea7395262f3a, 0xb2eacf17cee60b7c, 0xe10d4e4ff6626f4a,
+    0x1525cda7bfeec310, 0x46c24cff876aa726, 0x6fac655c83f98521,
+    0x3c4be404bb7de117, 0xc86367ecf2f14d4d, 0x9b84e6b4ca75297b,
+    0x9abf34aafbd70943, 0xc958b5f2c3536d75, 0x3d70361a8adfc12f,
+    0x6e97b742b25ba519, 0x47f99ee1b6c8871e, 0x141e1fb98e4ce328,
+    0xe0369c51c7c04f72, 0xb3d11d09ff442b44, 0x4316d699704007fe,
+    0x10f157c148c463c8, 0xe4d9d4290148cf92, 0xb73e557139ccaba4,
+    0x9e507cd23d5f89a3, 0xcdb7fd8a05dbed95, 0x399f7e624c5741cf,
+    0x6a78ff3a74d325f9, 0x6b432d24457105c1, 0x38a4ac7c7df561f7,
+    0xcc8c2f943479cdad, 0x9f6baecc0cfda99b, 0xb605876f086e8b9c,
+    0xe5e2063730eaefaa, 0x11ca85df796643f0, 0x422d048741e227c6,
+    0x13bd21e31a220380, 0x405aa0bb22a667b6, 0xb47223536b2acbec,
+    0xe795a20b53aeafda, 0xcefb8ba8573d8ddd, 0x9d1c0af06fb9e9eb,
+    0x69348918263545b1, 0x3ad308401eb12187, 0x3be8da5e2f1301bf,
+    0x680f5b0617976589, 0x9c27d8ee5e1bc9d3, 0xcfc059b6669fade5,
+    0xe6ae7015620c8fe2, 0xb549f14d5a88ebd4, 0x416172a51304478e,
+    0x1286f3fd2b8023b8},
+   {0x0000000000000000, 0x646c955f440400fe, 0xc8d92abe880801fc,
+    0xacb5bfe1cc0c0102, 0x036afa56bf1e1d7d, 0x67066f09fb1a1d83,
+    0xcbb3d0e837161c81, 0xafdf45b773121c7f, 0x06d5f4ad7e3c3afa,
+    0x62b961f23a383a04, 0xce0cde13f6343b06, 0xaa604b4cb2303bf8,
+    0x05bf0efbc1222787, 0x61d39ba485262779, 0xcd662445492a267b,
+    0xa90ab11a0d2e2685, 0x0dabe95afc7875f4, 0x69c77c05b87c750a,
+    0xc572c3e474707408, 0xa11e56bb307474f6, 0x0ec1130c43666889,
+    0x6aad865307626877, 0xc61839b2cb6e6975, 0xa274aced8f6a698b,
+    0x0b7e1df782444f0e, 0x6f1288a8c6404ff0, 0xc3a737490a4c4ef2,
+    0xa7cba2164e484e0c, 0x0814e7a13d5a5273, 0x6c7872fe795e528d,
+    0xc0cdcd1fb552538f, 0xa4a15840f1565371, 0x1b57d2b5f8f0ebe8,
+    0x7f3b47eabcf4eb16, 0xd38ef80b70f8ea14, 0xb7e26d5434fceaea,
+    0x183d28e347eef695, 0x7c51bdbc03eaf66b, 0xd0e4025dcfe6f769,
+    0xb48897028be2f797, 0x1d82261886ccd112, 0x79eeb347c2c8d1ec,
+    0xd55b0ca60ec4d0ee, 0xb13799f94ac0d010, 0x1ee8dc4e39d2cc6f,
+    0x7a8449117dd6cc91, 0xd631f6f0b1dacd93, 0xb25d63aff5decd6d,
+    0x16fc3bef04889e1c, 0x7290aeb0408c9ee2, 0xde2511518c809fe0,
+    0xba49840ec8849f1e, 0x1596c1b9bb968361, 0x71fa54e6ff92839f,
+    0xdd4feb07339e829d, 0xb9237e58779a8263, 0x1029cf427ab4a4e6,
+    0x74455a1d3eb0a418, 0xd8f0e5fcf2bca51a, 0xbc9c70a3b6b8a5e4,
+    0x13433514c5aab99b, 0x772fa04b81aeb965, 0xdb9a1faa4da2b867,
+    0xbff68af509a6b899, 0x36afa56bf1e1d7d0, 0x52c33034b5e5d72e,
+    0xfe768fd579e9d62c, 0x9a1a1a8a3dedd6d2, 0x35c55f3d4effcaad,
+    0x51a9ca620afbca53, 0xfd1c7583c6f7cb51, 0x9970e0dc82f3cbaf,
+    0x307a51c68fdded2a, 0x5416c499cbd9edd4, 0xf8a37b7807d5ecd6,
+    0x9ccfee2743d1ec28, 0x3310ab9030c3f057, 0x577c3ecf74c7f0a9,
+    0xfbc9812eb8cbf1ab, 0x9fa51471fccff155, 0x3b044c310d99a224,
+    0x5f68d96e499da2da, 0xf3dd668f8591a3d8, 0x97b1f3d0c195a326,
+    0x386eb667b287bf59, 0x5c022338f683bfa7, 0xf0b79cd93a8fbea5,
+    0x94db09867e8bbe5b, 0x3dd1b89c73a598de, 0x59bd2dc337a19820,
+    0xf5089222fbad9922, 0x9164077dbfa999dc, 0x3ebb42caccbb85a3,
+    0x5ad7d79588bf855d, 0xf662687444b3845f, 0x920efd2b00b784a1,
+    0x2df877de09113c38, 0x4994e2814d153cc6, 0xe5215d6081193dc4,
+    0x814dc83fc51d3d3a, 0x2e928d88b60f2145, 0x4afe18d7f20b21bb,
+    0xe64ba7363e0720b9, 0x822732697a032047, 0x2b2d8373772d06c2,
+    0x4f41162c3329063c, 0xe3f4a9cdff25073e, 0x87983c92bb2107c0,
+    0x28477925c8331bbf, 0x4c2bec7a8c371b41, 0xe09e539b403b1a43,
+    0x84f2c6c4043f1abd, 0x20539e84f56949cc, 0x443f0bdbb16d4932,
+    0xe88ab43a7d614830, 0x8ce62165396548ce, 0x233964d24a7754b1,
+    0x4755f18d0e73544f, 0xebe04e6cc27f554d, 0x8f8cdb33867b55b3,
+    0x26866a298b557336, 0x42eaff76cf5173c8, 0xee5f4097035d72ca,
+    0x8a33d5c847597234, 0x25ec907f344b6e4b, 0x41800520704f6eb5,
+    0xed35bac1bc436fb7, 0x89592f9ef8476f49, 0x6d5f4ad7e3c3afa0,
+    0x0933df88a7c7af5e, 0xa58660696bcbae5c, 0xc1eaf5362fcfaea2,
+    0x6e35b0815cddb2dd, 0x0a5925de18d9b223, 0xa6ec9a3fd4d5b321,
+    0xc2800f6090d1b3df, 0x6b8abe7a9dff955a, 0x0fe62b25d9fb95a4,
+    0xa35394c415f794a6, 0xc73f019b51f39458, 0x68e0442c22e18827,
+    0x0c8cd17366e588d9, 0xa0396e92aae989db, 0xc455fbcdeeed8925,
+    0x60f4a38d1fbbda54, 0x049836d25bbfdaaa, 0xa82d893397b3dba8,
+    0xcc411c6cd3b7db56, 0x639e59dba0a5c729, 0x07f2cc84e4a1c7d7,
+    0xab47736528adc6d5, 0xcf2be63a6ca9c62b, 0x662157206187e0ae,
+    0x024dc27f2583e050, 0xaef87d9ee98fe152, 0xca94e8c1ad8be1ac,
+    0x654bad76de99fdd3, 0x012738299a9dfd2d, 0xad9287c85691fc2f,
+    0xc9fe12971295fcd1, 0x760898621b334448, 0x12640d3d5f3744b6,
+    0xbed1b2dc933b45b4, 0xdabd2783d73f454a, 0x75626234a42d5935,
+    0x110ef76be02959cb, 0xbdbb488a2c2558c9, 0xd9d7ddd568215837,
+    0x70dd6ccf650f7eb2, 0x14b1f990210b7e4c, 0xb8044671ed077f4e,
+    0xdc68d32ea9037fb0, 0x73b79699da1163cf, 0x17db03c69e156331,
+    0xbb6ebc2752196233, 0xdf022978161d62cd, 0x7ba37138e74b31bc,
+    0x1fcfe467a34f3142, 0xb37a5b866f433040, 0xd716ced92b4730be,
+    0x78c98b6e58552cc1, 0x1ca51e311c512c3f, 0xb010a1d0d05d2d3d,
+    0xd47c348f94592dc3, 0x7d76859599770b46, 0x191a10cadd730bb8,
+    0xb5afaf2b117f0aba, 0xd1c33a74557b0a44, 0x7e1c7fc32669163b,
+    0x1a70ea9c626d16c5, 0xb6c5557dae6117c7, 0xd2a9c022ea651739,
+    0x5bf0efbc12227870, 0x3f9c7ae35626788e, 0x9329c5029a2a798c,
+    0xf745505dde2e7972, 0x589a15eaad3c650d, 0x3cf680b5e93865f3,
+    0x90433f54253464f1, 0xf42faa0b6130640f, 0x5d251b116c1e428a,
+    0x39498e4e281a4274, 0x95fc31afe4164376, 0xf190a4f0a0124388,
+    0x5e4fe147d3005ff7, 0x3a23741897045f09, 0x9696cbf95b085e0b,
+    0xf2fa5ea61f0c5ef5, 0x565b06e6ee5a0d84, 0x323793b9aa5e0d7a,
+    0x9e822c5866520c78, 0xfaeeb90722560c86, 0x5531fcb0514410f9,
+    0x315d69ef15401007, 0x9de8d60ed94c1105, 0xf98443519d4811fb,
+    0x508ef24b9066377e, 0x34e26714d4623780, 0x9857d8f5186e3682,
+    0xfc3b4daa5c6a367c, 0x53e4081d2f782a03, 0x37889d426b7c2afd,
+    0x9b3d22a3a7702bff, 0xff51b7fce3742b01, 0x40a73d09ead29398,
+    0x24cba856aed69366, 0x887e17b762da9264, 0xec1282e826de929a,
+    0x43cdc75f55cc8ee5, 0x27a1520011c88e1b, 0x8b14ede1ddc48f19,
+    0xef7878be99c08fe7, 0x4672c9a494eea962, 0x221e5cfbd0eaa99c,
+    0x8eabe31a1ce6a89e, 0xeac7764558e2a860, 0x451833f22bf0b41f,
+    0x2174a6ad6ff4b4e1, 0x8dc1194ca3f8b5e3, 0xe9ad8c13e7fcb51d,
+    0x4d0cd45316aae66c, 0x2960410c52aee692, 0x85d5feed9ea2e790,
+    0xe1b96bb2daa6e76e, 0x4e662e05a9b4fb11, 0x2a0abb5aedb0fbef,
+    0x86bf04bb21bcfaed, 0xe2d391e465b8fa13, 0x4bd920fe6896dc96,
+    0x2fb5b5a12c92dc68, 0x83000a40e09edd6a, 0xe76c9f1fa49add94,
+    0x48b3daa8d788c1eb, 0x2cdf4ff7938cc115, 0x806af0165f80c017,
+    0xe40665491b84c0e9}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0xfe0004445f956c64, 0xfc010888be2ad9c8,
+    0x02010ccce1bfb5ac, 0x7d1d1ebf56fa6a03, 0x831d1afb096f0667,
+    0x811c1637e8d0b3cb, 0x7f1c1273b745dfaf, 0xfa3a3c7eadf4d506,
+    0x043a383af261b962, 0x063b34f613de0cce, 0xf83b30b24c4b60aa,
+    0x872722c1fb0ebf05, 0x79272685a49bd361, 0x7b262a49452466cd,
+    0x85262e0d1ab10aa9, 0xf47578fc5ae9ab0d, 0x0a757cb8057cc769,
+    0x08747074e4c372c5, 0xf6747430bb561ea1, 0x896866430c13c10e,
+    0x776862075386ad6a, 0x75696ecbb23918c6, 0x8b696a8fedac74a2,
+    0x0e4f4482f71d7e0b, 0xf04f40c6a888126f, 0xf24e4c0a4937a7c3,
+    0x0c4e484e16a2cba7, 0x73525a3da1e71408, 0x8d525e79fe72786c,
+    0x8f5352b51fcdcdc0, 0x715356f14058a1a4, 0xe8ebf0f8b5d2571b,
+    0x16ebf4bcea473b7f, 0x14eaf8700bf88ed3, 0xeaeafc34546de2b7,
+    0x95f6ee47e3283d18, 0x6bf6ea03bcbd517c, 0x69f7e6cf5d02e4d0,
+    0x97f7e28b029788b4, 0x12d1cc861826821d, 0xecd1c8c247b3ee79,
+    0xeed0c40ea60c5bd5, 0x10d0c04af99937b1, 0x6fccd2394edce81e,
+    0x91ccd67d1149847a, 0x93cddab1f0f631d6, 0x6dcddef5af635db2,
+    0x1c9e8804ef3bfc16, 0xe29e8c40b0ae9072, 0xe09f808c511125de,
+    0x1e9f84c80e8449ba, 0x618396bbb9c19615, 0x9f8392ffe654fa71,
+    0x9d829e3307eb4fdd, 0x63829a77587e23b9, 0xe6a4b47a42cf2910,
+    0x18a4b03e1d5a4574, 0x1aa5bcf2fce5f0d8, 0xe4a5b8b6a3709cbc,
+    0x9bb9aac514354313, 0x65b9ae814ba02f77, 0x67b8a24daa1f9adb,
+    0x99b8a609f58af6bf, 0xd0d7e1f16ba5af36, 0x2ed7e5b53430c352,
+    0x2cd6e979d58f76fe, 0xd2d6ed3d8a1a1a9a, 0xadcaff4e3d5fc535,
+    0x53cafb0a62caa951, 0x51cbf7c683751cfd, 0xafcbf382dce07099,
+    0x2aeddd8fc6517a30, 0xd4edd9cb99c41654, 0xd6ecd507787ba3f8,
+    0x28ecd14327eecf9c, 0x57f0c33090ab1033, 0xa9f0c774cf3e7c57,
+    0xabf1cbb82e81c9fb, 0x55f1cffc7114a59f, 0x24a2990d314c043b,
+    0xdaa29d496ed9685f, 0xd8a391858f66ddf3, 0x26a395c1d0f3b197,
+    0x59bf87b267b66e38, 0xa7bf83f63823025c, 0xa5be8f3ad99cb7f0,
+    0x5bbe8b7e8609db94, 0xde98a5739cb8d13d, 0x2098a137c32dbd59,
+    0x2299adfb229208f5, 0xdc99a9bf7d076491, 0xa385bbccca42bb3e,
+    0x5d85bf8895d7d75a, 0x5f84b344746862f6, 0xa184b7002bfd0e92,
+    0x383c1109de77f82d, 0xc63c154d81e29449, 0xc43d1981605d21e5,
+    0x3a3d1dc53fc84d81, 0x45210fb6888d922e, 0xbb210bf2d718fe4a,
+    0xb920073e36a74be6, 0x4720037a69322782, 0xc2062d7773832d2b,
+    0x3c0629332c16414f, 0x3e0725ffcda9f4e3, 0xc00721bb923c9887,
+    0xbf1b33c825794728, 0x411b378c7aec2b4c, 0x431a3b409b539ee0,
+    0xbd1a3f04c4c6f284, 0xcc4969f5849e5320, 0x32496db1db0b3f44,
+    0x3048617d3ab48ae8, 0xce4865396521e68c, 0xb154774ad2643923,
+    0x4f54730e8df15547, 0x4d557fc26c4ee0eb, 0xb3557b8633db8c8f,
+    0x3673558b296a8626, 0xc87351cf76ffea42, 0xca725d0397405fee,
+    0x34725947c8d5338a, 0x4b6e4b347f90ec25, 0xb56e4f7020058041,
+    0xb76f43bcc1ba35ed, 0x496f47f89e2f5989, 0xa0afc3e3d74a5f6d,
+    0x5eafc7a788df3309, 0x5caecb6b696086a5, 0xa2aecf2f36f5eac1,
+    0xddb2dd5c81b0356e, 0x23b2d918de25590a, 0x21b3d5d43f9aeca6,
+    0xdfb3d190600f80c2, 0x5a95ff9d7abe8a6b, 0xa495fbd9252be60f,
+    0xa694f715c49453a3, 0x5894f3519b013fc7, 0x2788e1222c44e068,
+    0xd988e56673d18c0c, 0xdb89e9aa926e39a0, 0x2589edeecdfb55c4,
+    0x54dabb1f8da3f460, 0xaadabf5bd2369804, 0xa8dbb39733892da8,
+    0x56dbb7d36c1c41cc, 0x29c7a5a0db599e63, 0xd7c7a1e484ccf207,
+    0xd5c6ad28657347ab, 0x2bc6a96c3ae62bcf, 0xaee0876120572166,
+    0x50e083257fc24d02, 0x52e18fe99e7df8ae, 0xace18badc1e894ca,
+    0xd3fd99de76ad4b65, 0x2dfd9d9a29382701, 0x2ffc9156c88792ad,
+    0xd1fc95129712fec9, 0x4844331b62980876, 0xb644375f3d0d6412,
+    0xb4453b93dcb2d1be, 0x4a453fd78327bdda, 0x35592da434626275,
+    0xcb5929e06bf70e11, 0xc958252c8a48bbbd, 0x37582168d5ddd7d9,
+    0xb27e0f65cf6cdd70, 0x4c7e0b2190f9b114, 0x4e7f07ed714604b8,
+    0xb07f03a92ed368dc, 0xcf6311da9996b773, 0x3163159ec603db17,
+    0x3362195227bc6ebb, 0xcd621d16782902df, 0xbc314be73871a37b,
+    0x42314fa367e4cf1f, 0x4030436f865b7ab3, 0xbe30472bd9ce16d7,
+    0xc12c55586e8bc978, 0x3f2c511c311ea51c, 0x3d2d5dd0d0a110b0,
+    0xc32d59948f347cd4, 0x460b77999585767d, 0xb80b73ddca101a19,
+    0xba0a7f112bafafb5, 0x440a7b55743ac3d1, 0x3b166926c37f1c7e,
+    0xc5166d629cea701a, 0xc71761ae7d55c5b6, 0x391765ea22c0a9d2,
+    0x70782212bceff05b, 0x8e782656e37a9c3f, 0x8c792a9a02c52993,
+    0x72792ede5d5045f7, 0x0d653cadea159a58, 0xf36538e9b580f63c,
+    0xf1643425543f4390, 0x0f6430610baa2ff4, 0x8a421e6c111b255d,
+    0x74421a284e8e4939, 0x764316e4af31fc95, 0x884312a0f0a490f1,
+    0xf75f00d347e14f5e, 0x095f04971874233a, 0x0b5e085bf9cb9696,
+    0xf55e0c1fa65efaf2, 0x840d5aeee6065b56, 0x7a0d5eaab9933732,
+    0x780c5266582c829e, 0x860c562207b9eefa, 0xf9104451b0fc3155,
+    0x07104015ef695d31, 0x05114cd90ed6e89d, 0xfb11489d514384f9,
+    0x7e3766904bf28e50, 0x803762d41467e234, 0x82366e18f5d85798,
+    0x7c366a5caa4d3bfc, 0x032a782f1d08e453, 0xfd2a7c6b429d8837,
+    0xff2b70a7a3223d9b, 0x012b74e3fcb751ff, 0x9893d2ea093da740,
+    0x6693d6ae56a8cb24, 0x6492da62b7177e88, 0x9a92de26e88212ec,
+    0xe58ecc555fc7cd43, 0x1b8ec8110052a127, 0x198fc4dde1ed148b,
+    0xe78fc099be7878ef, 0x62a9ee94a4c97246, 0x9ca9ead0fb5c1e22,
+    0x9ea8e61c1ae3ab8e, 0x60a8e2584576c7ea, 0x1fb4f02bf2331845,
+    0xe1b4f46fada67421, 0xe3b5f8a34c19c18d, 0x1db5fce7138cade9,
+    0x6ce6aa1653d40c4d, 0x92e6ae520c416029, 0x90e7a29eedfed585,
+    0x6ee7a6dab26bb9e1, 0x11fbb4a9052e664e, 0xeffbb0ed5abb0a2a,
+    0xedfabc21bb04bf86, 0x13fab865e491d3e2, 0x96dc9668fe20d94b,
+    0x68dc922ca1b5b52f, 0x6add9ee0400a0083, 0x94dd9aa41f9f6ce7,
+    0xebc188d7a8dab348, 0x15c18c93f74fdf2c, 0x17c0805f16f06a80,
+    0xe9c0841b496506e4},
+   {0x0000000000000000, 0x366484385881e753, 0x6cc80871b002cfa7,
+    0x5aac8c49e88328f4, 0x5d8e1f4d4baa46dd, 0x6bea9b75132ba18e,
+    0x3146173cfba8897a, 0x07229304a3296e29, 0x3f023135bdfb5528,
+    0x0966b50de57ab27b, 0x53ca39440df99a8f, 0x65aebd7c55787ddc,
+    0x628c2e78f65113f5, 0x54e8aa40aed0f4a6, 0x0e4426094653dc52,
+    0x3820a2311ed23b01, 0x7e04626a7af7ab50, 0x4860e65222764c03,
+    0x12cc6a1bcaf564f7, 0x24a8ee23927483a4, 0x238a7d27315ded8d,
+    0x15eef91f69dc0ade, 0x4f427556815f222a, 0x7926f16ed9dec579,
+    0x4106535fc70cfe78, 0x7762d7679f8d192b, 0x2dce5b2e770e31df,
+    0x1baadf162f8fd68c, 0x1c884c128ca6b8a5, 0x2aecc82ad4275ff6,
+    0x704044633ca47702, 0x4624c05b64259051, 0xfc08c4d4f4ee57a1,
+    0xca6c40ecac6fb0f2, 0x90c0cca544ec9806, 0xa6a4489d1c6d7f55,
+    0xa186db99bf44117c, 0x97e25fa1e7c5f62f, 0xcd4ed3e80f46dedb,
+    0xfb2a57d057c73988, 0xc30af5e149150289, 0xf56e71d91194e5da,
+    0xafc2fd90f917cd2e, 0x99a679a8a1962a7d, 0x9e84eaac02bf4454,
+    0xa8e06e945a3ea307, 0xf24ce2ddb2bd8bf3, 0xc42866e5ea3c6ca0,
+    0x820ca6be8e19fcf1, 0xb4682286d6981ba2, 0xeec4aecf3e1b3356,
+    0xd8a02af7669ad405, 0xdf82b9f3c5b3ba2c, 0xe9e63dcb9d325d7f,
+    0xb34ab18275b1758b, 0x852e35ba2d3092d8, 0xbd0e978b33e2a9d9,
+    0x8b6a13b36b634e8a, 0xd1c69ffa83e0667e, 0xe7a21bc2db61812d,
+    0xe08088c67848ef04, 0xd6e40cfe20c90857, 0x8c4880b7c84a20a3,
+    0xba2c048f90cbc7f0, 0x7d0f8606c27277d0, 0x4b6b023e9af39083,
+    0x11c78e777270b877, 0x27a30a4f2af15f24, 0x2081994b89d8310d,
+    0x16e51d73d159d65e, 0x4c49913a39dafeaa, 0x7a2d1502615b19f9,
+    0x420db7337f8922f8, 0x7469330b2708c5ab, 0x2ec5bf42cf8bed5f,
+    0x18a13b7a970a0a0c, 0x1f83a87e34236425, 0x29e72c466ca28376,
+    0x734ba00f8421ab82, 0x452f2437dca04cd1, 0x030be46cb885dc80,
+    0x356f6054e0043bd3, 0x6fc3ec1d08871327, 0x59a768255006f474,
+    0x5e85fb21f32f9a5d, 0x68e17f19abae7d0e, 0x324df350432d55fa,
+    0x042977681bacb2a9, 0x3c09d559057e89a8, 0x0a6d51615dff6efb,
+    0x50c1dd28b57c460f, 0x66a55910edfda15c, 0x6187ca144ed4cf75,
+    0x57e34e2c16552826, 0x0d4fc265fed600d2, 0x3b2b465da657e781,
+    0x810742d2369c2071, 0xb763c6ea6e1dc722, 0xedcf4aa3869eefd6,
+    0xdbabce9bde1f0885, 0xdc895d9f7d3666ac, 0xeaedd9a725b781ff,
+    0xb04155eecd34a90b, 0x8625d1d695b54e58, 0xbe0573e78b677559,
+    0x8861f7dfd3e6920a, 0xd2cd7b963b65bafe, 0xe4a9ffae63e45dad,
+    0xe38b6caac0cd3384, 0xd5efe892984cd4d7, 0x8f4364db70cffc23,
+    0xb927e0e3284e1b70, 0xff0320b84c6b8b21, 0xc967a48014ea6c72,
+    0x93cb28c9fc694486, 0xa5afacf1a4e8a3d5, 0xa28d3ff507c1cdfc,
+    0x94e9bbcd5f402aaf, 0xce453784b7c3025b, 0xf821b3bcef42e508,
+    0xc001118df190de09, 0xf66595b5a911395a, 0xacc919fc419211ae,
+    0x9aad9dc41913f6fd, 0x9d8f0ec0ba3a98d4, 0xabeb8af8e2bb7f87,
+    0xf14706b10a385773, 0xc723828952b9b020, 0x7f0002a2af4a3632,
+    0x4964869af7cbd161, 0x13c80ad31f48f995, 0x25ac8eeb47c91ec6,
+    0x228e1defe4e070ef, 0x14ea99d7bc6197bc, 0x4e46159e54e2bf48,
+    0x782291a60c63581b, 0x4002339712b1631a, 0x7666b7af4a308449,
+    0x2cca3be6a2b3acbd, 0x1aaebfdefa324bee, 0x1d8c2cda591b25c7,
+    0x2be8a8e2019ac294, 0x714424abe919ea60, 0x4720a093b1980d33,
+    0x010460c8d5bd9d62, 0x3760e4f08d3c7a31, 0x6dcc68b965bf52c5,
+    0x5ba8ec813d3eb596, 0x5c8a7f859e17dbbf, 0x6aeefbbdc6963cec,
+    0x304277f42e151418, 0x0626f3cc7694f34b, 0x3e0651fd6846c84a,
+    0x0862d5c530c72f19, 0x52ce598cd84407ed, 0x64aaddb480c5e0be,
+    0x63884eb023ec8e97, 0x55ecca887b6d69c4, 0x0f4046c193ee4130,
+    0x3924c2f9cb6fa663, 0x8308c6765ba46193, 0xb56c424e032586c0,
+    0xefc0ce07eba6ae34, 0xd9a44a3fb3274967, 0xde86d93b100e274e,
+    0xe8e25d03488fc01d, 0xb24ed14aa00ce8e9, 0x842a5572f88d0fba,
+    0xbc0af743e65f34bb, 0x8a6e737bbeded3e8, 0xd0c2ff32565dfb1c,
+    0xe6a67b0a0edc1c4f, 0xe184e80eadf57266, 0xd7e06c36f5749535,
+    0x8d4ce07f1df7bdc1, 0xbb28644745765a92, 0xfd0ca41c2153cac3,
+    0xcb68202479d22d90, 0x91c4ac6d91510564, 0xa7a02855c9d0e237,
+    0xa082bb516af98c1e, 0x96e63f6932786b4d, 0xcc4ab320dafb43b9,
+    0xfa2e3718827aa4ea, 0xc20e95299ca89feb, 0xf46a1111c42978b8,
+    0xaec69d582caa504c, 0x98a21960742bb71f, 0x9f808a64d702d936,
+    0xa9e40e5c8f833e65, 0xf348821567001691, 0xc52c062d3f81f1c2,
+    0x020f84a46d3841e2, 0x346b009c35b9a6b1, 0x6ec78cd5dd3a8e45,
+    0x58a308ed85bb6916, 0x5f819be92692073f, 0x69e51fd17e13e06c,
+    0x334993989690c898, 0x052d17a0ce112fcb, 0x3d0db591d0c314ca,
+    0x0b6931a98842f399, 0x51c5bde060c1db6d, 0x67a139d838403c3e,
+    0x6083aadc9b695217, 0x56e72ee4c3e8b544, 0x0c4ba2ad2b6b9db0,
+    0x3a2f269573ea7ae3, 0x7c0be6ce17cfeab2, 0x4a6f62f64f4e0de1,
+    0x10c3eebfa7cd2515, 0x26a76a87ff4cc246, 0x2185f9835c65ac6f,
+    0x17e17dbb04e44b3c, 0x4d4df1f2ec6763c8, 0x7b2975cab4e6849b,
+    0x4309d7fbaa34bf9a, 0x756d53c3f2b558c9, 0x2fc1df8a1a36703d,
+    0x19a55bb242b7976e, 0x1e87c8b6e19ef947, 0x28e34c8eb91f1e14,
+    0x724fc0c7519c36e0, 0x442b44ff091dd1b3, 0xfe07407099d61643,
+    0xc863c448c157f110, 0x92cf480129d4d9e4, 0xa4abcc3971553eb7,
+    0xa3895f3dd27c509e, 0x95eddb058afdb7cd, 0xcf41574c627e9f39,
+    0xf925d3743aff786a, 0xc1057145242d436b, 0xf761f57d7caca438,
+    0xadcd7934942f8ccc, 0x9ba9fd0cccae6b9f, 0x9c8b6e086f8705b6,
+    0xaaefea303706e2e5, 0xf0436679df85ca11, 0xc627e24187042d42,
+    0x8003221ae321bd13, 0xb667a622bba05a40, 0xeccb2a6b532372b4,
+    0xdaafae530ba295e7, 0xdd8d3d57a88bfbce, 0xebe9b96ff00a1c9d,
+    0xb145352618893469, 0x8721b11e4008d33a, 0xbf01132f5edae83b,
+    0x89659717065b0f68, 0xd3c91b5eeed8279c, 0xe5ad9f66b659c0cf,
+    0xe28f0c621570aee6, 0xd4eb885a4df149b5, 0x8e470413a5726141,
+    0xb823802bfdf38612},
+   {0x0000000000000000, 0xd7d0a2fc1af1ab09, 0xaea145f935e25713,
+    0x7971e7052f13fc1a, 0x5c438bf26bc4af26, 0x8b93290e7135042f,
+    0xf2e2ce0b5e26f835, 0x25326cf744d7533c, 0xb88616e5d7885f4d,
+    0x6f56b419cd79f444, 0x1627531ce26a085e, 0xc1f7f1e0f89ba357,
+    0xe4c59d17bc4cf06b, 0x33153feba6bd5b62, 0x4a64d8ee89aea778,
+    0x9db47a12935f0c71, 0x700d2dcaaf11bf9a, 0xa7dd8f36b5e01493,
+    0xdeac68339af3e889, 0x097ccacf80024380, 0x2c4ea638c4d510bc,
+    0xfb9e04c4de24bbb5, 0x82efe3c1f13747af, 0x553f413debc6eca6,
+    0xc88b3b2f7899e0d7, 0x1f5b99d362684bde, 0x662a7ed64d7bb7c4,
+    0xb1fadc2a578a1ccd, 0x94c8b0dd135d4ff1, 0x4318122109ace4f8,
+    0x3a69f52426bf18e2, 0xedb957d83c4eb3eb, 0x6504543b748ca6a7,
+    0xb2d4f6c76e7d0dae, 0xcba511c2416ef1b4, 0x1c75b33e5b9f5abd,
+    0x3947dfc91f480981, 0xee977d3505b9a288, 0x97e69a302aaa5e92,
+    0x403638cc305bf59b, 0xdd8242dea304f9ea, 0x0a52e022b9f552e3,
+    0x7323072796e6aef9, 0xa4f3a5db8c1705f0, 0x81c1c92cc8c056cc,
+    0x56116bd0d231fdc5, 0x2f608cd5fd2201df, 0xf8b02e29e7d3aad6,
+    0x150979f1db9d193d, 0xc2d9db0dc16cb234, 0xbba83c08ee7f4e2e,
+    0x6c789ef4f48ee527, 0x494af203b059b61b, 0x9e9a50ffaaa81d12,
+    0xe7ebb7fa85bbe108, 0x303b15069f4a4a01, 0xad8f6f140c154670,
+    0x7a5fcde816e4ed79, 0x032e2aed39f71163, 0xd4fe88112306ba6a,
+    0xf1cce4e667d1e956, 0x261c461a7d20425f, 0x5f6da11f5233be45,
+    0x88bd03e348c2154c, 0x4f16a6d9c3b795dd, 0x98c60425d9463ed4,
+    0xe1b7e320f655c2ce, 0x366741dceca469c7, 0x13552d2ba8733afb,
+    0xc4858fd7b28291f2, 0xbdf468d29d916de8, 0x6a24ca2e8760c6e1,
+    0xf790b03c143fca90, 0x204012c00ece6199, 0x5931f5c521dd9d83,
+    0x8ee157393b2c368a, 0xabd33bce7ffb65b6, 0x7c039932650acebf,
+    0x05727e374a1932a5, 0xd2a2dccb50e899ac, 0x3f1b8b136ca62a47,
+    0xe8cb29ef7657814e, 0x91baceea59447d54, 0x466a6c1643b5d65d,
+    0x635800e107628561, 0xb488a21d1d932e68, 0xcdf945183280d272,
+    0x1a29e7e42871797b, 0x879d9df6bb2e750a, 0x504d3f0aa1dfde03,
+    0x293cd80f8ecc2219, 0xfeec7af3943d8910, 0xdbde1604d0eada2c,
+    0x0c0eb4f8ca1b7125, 0x757f53fde5088d3f, 0xa2aff101fff92636,
+    0x2a12f2e2b73b337a, 0xfdc2501eadca9873, 0x84b3b71b82d96469,
+    0x536315e79828cf60, 0x76517910dcff9c5c, 0xa181dbecc60e3755,
+    0xd8f03ce9e91dcb4f, 0x0f209e15f3ec6046, 0x9294e40760b36c37,
+    0x454446fb7a42c73e, 0x3c35a1fe55513b24, 0xebe503024fa0902d,
+    0xced76ff50b77c311, 0x1907cd0911866818, 0x60762a0c3e959402,
+    0xb7a688f024643f0b, 0x5a1fdf28182a8ce0, 0x8dcf7dd402db27e9,
+    0xf4be9ad12dc8dbf3, 0x236e382d373970fa, 0x065c54da73ee23c6,
+    0xd18cf626691f88cf, 0xa8fd1123460c74d5, 0x7f2db3df5cfddfdc,
+    0xe299c9cdcfa2d3ad, 0x35496b31d55378a4, 0x4c388c34fa4084be,
+    0x9be82ec8e0b12fb7, 0xbeda423fa4667c8b, 0x690ae0c3be97d782,
+    0x107b07c691842b98, 0xc7aba53a8b758091, 0x1b32421cacc0f329,
+    0xcce2e0e0b6315820, 0xb59307e59922a43a, 0x6243a51983d30f33,
+    0x4771c9eec7045c0f, 0x90a16b12ddf5f706, 0xe9d08c17f2e60b1c,
+    0x3e002eebe817a015, 0xa3b454f97b48ac64, 0x7464f60561b9076d,
+    0x0d1511004eaafb77, 0xdac5b3fc545b507e, 0xfff7df0b108c0342,
+    0x28277df70a7da84b, 0x51569af2256e5451, 0x8686380e3f9fff58,
+    0x6b3f6fd603d14cb3, 0xbcefcd2a1920e7ba, 0xc59e2a2f36331ba0,
+    0x124e88d32cc2b0a9, 0x377ce4246815e395, 0xe0ac46d872e4489c,
+    0x99dda1dd5df7b486, 0x4e0d032147061f8f, 0xd3b97933d45913fe,
+    0x0469dbcfcea8b8f7, 0x7d183ccae1bb44ed, 0xaac89e36fb4aefe4,
+    0x8ffaf2c1bf9dbcd8, 0x582a503da56c17d1, 0x215bb7388a7febcb,
+    0xf68b15c4908e40c2, 0x7e361627d84c558e, 0xa9e6b4dbc2bdfe87,
+    0xd09753deedae029d, 0x0747f122f75fa994, 0x22759dd5b388faa8,
+    0xf5a53f29a97951a1, 0x8cd4d82c866aadbb, 0x5b047ad09c9b06b2,
+    0xc6b000c20fc40ac3, 0x1160a23e1535a1ca, 0x6811453b3a265dd0,
+    0xbfc1e7c720d7f6d9, 0x9af38b306400a5e5, 0x4d2329cc7ef10eec,
+    0x3452cec951e2f2f6, 0xe3826c354b1359ff, 0x0e3b3bed775dea14,
+    0xd9eb99116dac411d, 0xa09a7e1442bfbd07, 0x774adce8584e160e,
+    0x5278b01f1c994532, 0x85a812e30668ee3b, 0xfcd9f5e6297b1221,
+    0x2b09571a338ab928, 0xb6bd2d08a0d5b559, 0x616d8ff4ba241e50,
+    0x181c68f19537e24a, 0xcfccca0d8fc64943, 0xeafea6facb111a7f,
+    0x3d2e0406d1e0b176, 0x445fe303fef34d6c, 0x938f41ffe402e665,
+    0x5424e4c56f7766f4, 0x83f446397586cdfd, 0xfa85a13c5a9531e7,
+    0x2d5503c040649aee, 0x08676f3704b3c9d2, 0xdfb7cdcb1e4262db,
+    0xa6c62ace31519ec1, 0x711688322ba035c8, 0xeca2f220b8ff39b9,
+    0x3b7250dca20e92b0, 0x4203b7d98d1d6eaa, 0x95d3152597ecc5a3,
+    0xb0e179d2d33b969f, 0x6731db2ec9ca3d96, 0x1e403c2be6d9c18c,
+    0xc9909ed7fc286a85, 0x2429c90fc066d96e, 0xf3f96bf3da977267,
+    0x8a888cf6f5848e7d, 0x5d582e0aef752574, 0x786a42fdaba27648,
+    0xafbae001b153dd41, 0xd6cb07049e40215b, 0x011ba5f884b18a52,
+    0x9cafdfea17ee8623, 0x4b7f7d160d1f2d2a, 0x320e9a13220cd130,
+    0xe5de38ef38fd7a39, 0xc0ec54187c2a2905, 0x173cf6e466db820c,
+    0x6e4d11e149c87e16, 0xb99db31d5339d51f, 0x3120b0fe1bfbc053,
+    0xe6f01202010a6b5a, 0x9f81f5072e199740, 0x485157fb34e83c49,
+    0x6d633b0c703f6f75, 0xbab399f06acec47c, 0xc3c27ef545dd3866,
+    0x1412dc095f2c936f, 0x89a6a61bcc739f1e, 0x5e7604e7d6823417,
+    0x2707e3e2f991c80d, 0xf0d7411ee3606304, 0xd5e52de9a7b73038,
+    0x02358f15bd469b31, 0x7b4468109255672b, 0xac94caec88a4cc22,
+    0x412d9d34b4ea7fc9, 0x96fd3fc8ae1bd4c0, 0xef8cd8cd810828da,
+    0x385c7a319bf983d3, 0x1d6e16c6df2ed0ef, 0xcabeb43ac5df7be6,
+    0xb3cf533feacc87fc, 0x641ff1c3f03d2cf5, 0xf9ab8bd163622084,
+    0x2e7b292d79938b8d, 0x570ace2856807797, 0x80da6cd44c71dc9e,
+    0xa5e8002308a68fa2, 0x7238a2df125724ab, 0x0b4945da3d44d8b1,
+    0xdc99e72627b573b8},
+   {0x0000000000000000, 0x7dede323fbcf32ec, 0x7fc4c9e8dd30bd4a,
+    0x02292acb26ff8fa6, 0xfe8893d1bb617a95, 0x836570f240ae4879,
+    0x814c5a396651c7df, 0xfca1b91a9d9ef533, 0x790f290c5c6c2cb8,
+    0x04e2ca2fa7a31e54, 0x06cbe0e4815c91f2, 0x7b2603c77a93a31e,
+    0x8787badde70d562d, 0xfa6a59fe1cc264c1, 0xf84373353a3deb67,
+    0x85ae9016c1f2d98b, 0x77005cb7937780e2, 0x0aedbf9468b8b20e,
+    0x08c4955f4e473da8, 0x7529767cb5880f44, 0x8988cf662816fa77,
+    0xf4652c45d3d9c89b, 0xf64c068ef526473d, 0x8ba1e5ad0ee975d1,
+    0x0e0f75bbcf1bac5a, 0x73e2969834d49eb6, 0x71cbbc53122b1110,
+    0x0c265f70e9e423fc, 0xf087e66a747ad6cf, 0x8d6a05498fb5e423,
+    0x8f432f82a94a6b85, 0xf2aecca152855969, 0x6b1eb6c10c40d857,
+    0x16f355e2f78feabb, 0x14da7f29d170651d, 0x69379c0a2abf57f1,
+    0x95962510b721a2c2, 0xe87bc6334cee902e, 0xea52ecf86a111f88,
+    0x97bf0fdb91de2d64, 0x12119fcd502cf4ef, 0x6ffc7ceeabe3c603,
+    0x6dd556258d1c49a5, 0x1038b50676d37b49, 0xec990c1ceb4d8e7a,
+    0x9174ef3f1082bc96, 0x935dc5f4367d3330, 0xeeb026d7cdb201dc,
+    0x1c1eea769f3758b5, 0x61f3095564f86a59, 0x63da239e4207e5ff,
+    0x1e37c0bdb9c8d713, 0xe29679a724562220, 0x9f7b9a84df9910cc,
+    0x9d52b04ff9669f6a, 0xe0bf536c02a9ad86, 0x6511c37ac35b740d,
+    0x18fc2059389446e1, 0x1ad50a921e6bc947, 0x6738e9b1e5a4fbab,
+    0x9b9950ab783a0e98, 0xe674b38883f53c74, 0xe45d9943a50ab3d2,
+    0x99b07a605ec5813e, 0xd63c6c831980b0af, 0xabd18fa0e24f8243,
+    0xa9f8a56bc4b00de5, 0xd41546483f7f3f09, 0x28b4ff52a2e1ca3a,
+    0x55591c71592ef8d6, 0x577036ba7fd17770, 0x2a9dd599841e459c,
+    0xaf33458f45ec9c17, 0xd2dea6acbe23aefb, 0xd0f78c6798dc215d,
+    0xad1a6f44631313b1, 0x51bbd65efe8de682, 0x2c56357d0542d46e,
+    0x2e7f1fb623bd5bc8, 0x5392fc95d8726924, 0xa13c30348af7304d,
+    0xdcd1d317713802a1, 0xdef8f9dc57c78d07, 0xa3151affac08bfeb,
+    0x5fb4a3e531964ad8, 0x225940c6ca597834, 0x20706a0deca6f792,
+    0x5d9d892e1769c57e, 0xd8331938d69b1cf5, 0xa5defa1b2d542e19,
+    0xa7f7d0d00baba1bf, 0xda1a33f3f0649353, 0x26bb8ae96dfa6660,
+    0x5b5669ca9635548c, 0x597f4301b0cadb2a, 0x2492a0224b05e9c6,
+    0xbd22da4215c068f8, 0xc0cf3961ee0f5a14, 0xc2e613aac8f0d5b2,
+    0xbf0bf089333fe75e, 0x43aa4993aea1126d, 0x3e47aab0556e2081,
+    0x3c6e807b7391af27, 0x41836358885e9dcb, 0xc42df34e49ac4440,
+    0xb9c0106db26376ac, 0xbbe93aa6949cf90a, 0xc604d9856f53cbe6,
+    0x3aa5609ff2cd3ed5, 0x474883bc09020c39, 0x4561a9772ffd839f,
+    0x388c4a54d432b173, 0xca2286f586b7e81a, 0xb7cf65d67d78daf6,
+    0xb5e64f1d5b875550, 0xc80bac3ea04867bc, 0x34aa15243dd6928f,
+    0x4947f607c619a063, 0x4b6edccce0e62fc5, 0x36833fef1b291d29,
+    0xb32daff9dadbc4a2, 0xcec04cda2114f64e, 0xcce9661107eb79e8,
+    0xb1048532fc244b04, 0x4da53c2861babe37, 0x3048df0b9a758cdb,
+    0x3261f5c0bc8a037d, 0x4f8c16e347453191, 0x2967d6a918afb9cd,
+    0x548a358ae3608b21, 0x56a31f41c59f0487, 0x2b4efc623e50366b,
+    0xd7ef4578a3cec358, 0xaa02a65b5801f1b4, 0xa82b8c907efe7e12,
+    0xd5c66fb385314cfe, 0x5068ffa544c39575, 0x2d851c86bf0ca799,
+    0x2fac364d99f3283f, 0x5241d56e623c1ad3, 0xaee06c74ffa2efe0,
+    0xd30d8f57046ddd0c, 0xd124a59c229252aa, 0xacc946bfd95d6046,
+    0x5e678a1e8bd8392f, 0x238a693d70170bc3, 0x21a343f656e88465,
+    0x5c4ea0d5ad27b689, 0xa0ef19cf30b943ba, 0xdd02faeccb767156,
+    0xdf2bd027ed89fef0, 0xa2c633041646cc1c, 0x2768a312d7b41597,
+    0x5a8540312c7b277b, 0x58ac6afa0a84a8dd, 0x254189d9f14b9a31,
+    0xd9e030c36cd56f02, 0xa40dd3e0971a5dee, 0xa624f92bb1e5d248,
+    0xdbc91a084a2ae0a4, 0x4279606814ef619a, 0x3f94834bef205376,
+    0x3dbda980c9dfdcd0, 0x40504aa33210ee3c, 0xbcf1f3b9af8e1b0f,
+    0xc11c109a544129e3, 0xc3353a5172bea645, 0xbed8d972897194a9,
+    0x3b76496448834d22, 0x469baa47b34c7fce, 0x44b2808c95b3f068,
+    0x395f63af6e7cc284, 0xc5fedab5f3e237b7, 0xb8133996082d055b,
+    0xba3a135d2ed28afd, 0xc7d7f07ed51db811, 0x35793cdf8798e178,
+    0x4894dffc7c57d394, 0x4abdf5375aa85c32, 0x37501614a1676ede,
+    0xcbf1af0e3cf99bed, 0xb61c4c2dc736a901, 0xb43566e6e1c926a7,
+    0xc9d885c51a06144b, 0x4c7615d3dbf4cdc0, 0x319bf6f0203bff2c,
+    0x33b2dc3b06c4708a, 0x4e5f3f18fd0b4266, 0xb2fe86026095b755,
+    0xcf1365219b5a85b9, 0xcd3a4feabda50a1f, 0xb0d7acc9466a38f3,
+    0xff5bba2a012f0962, 0x82b65909fae03b8e, 0x809f73c2dc1fb428,
+    0xfd7290e127d086c4, 0x01d329fbba4e73f7, 0x7c3ecad84181411b,
+    0x7e17e013677ecebd, 0x03fa03309cb1fc51, 0x865493265d4325da,
+    0xfbb97005a68c1736, 0xf9905ace80739890, 0x847db9ed7bbcaa7c,
+    0x78dc00f7e6225f4f, 0x0531e3d41ded6da3, 0x0718c91f3b12e205,
+    0x7af52a3cc0ddd0e9, 0x885be69d92588980, 0xf5b605be6997bb6c,
+    0xf79f2f754f6834ca, 0x8a72cc56b4a70626, 0x76d3754c2939f315,
+    0x0b3e966fd2f6c1f9, 0x0917bca4f4094e5f, 0x74fa5f870fc67cb3,
+    0xf154cf91ce34a538, 0x8cb92cb235fb97d4, 0x8e90067913041872,
+    0xf37de55ae8cb2a9e, 0x0fdc5c407555dfad, 0x7231bf638e9aed41,
+    0x701895a8a86562e7, 0x0df5768b53aa500b, 0x94450ceb0d6fd135,
+    0xe9a8efc8f6a0e3d9, 0xeb81c503d05f6c7f, 0x966c26202b905e93,
+    0x6acd9f3ab60eaba0, 0x17207c194dc1994c, 0x150956d26b3e16ea,
+    0x68e4b5f190f12406, 0xed4a25e75103fd8d, 0x90a7c6c4aacccf61,
+    0x928eec0f8c3340c7, 0xef630f2c77fc722b, 0x13c2b636ea628718,
+    0x6e2f551511adb5f4, 0x6c067fde37523a52, 0x11eb9cfdcc9d08be,
+    0xe345505c9e1851d7, 0x9ea8b37f65d7633b, 0x9c8199b44328ec9d,
+    0xe16c7a97b8e7de71, 0x1dcdc38d25792b42, 0x602020aedeb619ae,
+    0x62090a65f8499608, 0x1fe4e9460386a4e4, 0x9a4a7950c2747d6f,
+    0xe7a79a7339bb4f83, 0xe58eb0b81f44c025, 0x9863539be48bf2c9,
+    0x64c2ea81791507fa, 0x192f09a282da3516, 0x1b062369a425bab0,
+    0x66ebc04a5fea885c},
+   {0x0000000000000000, 0xad7383e07ef2a9dd, 0xdff9086ed64b8b29,
+    0x728a8b8ea8b922f4, 0xbef311dcac971653, 0x1380923cd265bf8e,
+    0x610a19b27adc9d7a, 0xcc799a52042e34a7, 0x7ce723b8592f2da6,
+    0xd194a05827dd847b, 0xa31e2bd68f64a68f, 0x0e6da836f1960f52,
+    0xc2143264f5b83bf5, 0x6f67b1848b4a9228, 0x1ded3a0a23f3b0dc,
+    0xb09eb9ea5d011901, 0x7dd049df98f182de, 0xd0a3ca3fe6032b03,
+    0xa22941b14eba09f7, 0x0f5ac2513048a02a, 0xc32358033466948d,
+    0x6e50dbe34a943d50, 0x1cda506de22d1fa4, 0xb1a9d38d9cdfb679,
+    0x01376a67c1deaf78, 0xac44e987bf2c06a5, 0xdece620917952451,
+    0x73bde1e969678d8c, 0xbfc47bbb6d49b92b, 0x12b7f85b13bb10f6,
+    0x603d73d5bb023202, 0xcd4ef035c5f09bdf, 0x7fbe9d111a4cdd2f,
+    0xd2cd1ef164be74f2, 0xa047957fcc075606, 0x0d34169fb2f5ffdb,
+    0xc14d8ccdb6dbcb7c, 0x6c3e0f2dc82962a1, 0x1eb484a360904055,
+    0xb3c707431e62e988, 0x0359bea94363f089, 0xae2a3d493d915954,
+    0xdca0b6c795287ba0, 0x71d33527ebdad27d, 0xbdaaaf75eff4e6da,
+    0x10d92c9591064f07, 0x6253a71b39bf6df3, 0xcf2024fb474dc42e,
+    0x026ed4ce82bd5ff1, 0xaf1d572efc4ff62c, 0xdd97dca054f6d4d8,
+    0x70e45f402a047d05, 0xbc9dc5122e2a49a2, 0x11ee46f250d8e07f,
+    0x6364cd7cf861c28b, 0xce174e9c86936b56, 0x7e89f776db927257,
+    0xd3fa7496a560db8a, 0xa170ff180dd9f97e, 0x0c037cf8732b50a3,
+    0xc07ae6aa77056404, 0x6d09654a09f7cdd9, 0x1f83eec4a14eef2d,
+    0xb2f06d24dfbc46f0, 0xfe7c3b233498ba5f, 0x530fb8c34a6a1382,
+    0x2185334de2d33176, 0x8cf6b0ad9c2198ab, 0x408f2aff980fac0c,
+    0xedfca91fe6fd05d1, 0x9f7622914e442725, 0x3205a17130b68ef8,
+    0x829b189b6db797f9, 0x2fe89b7b13453e24, 0x5d6210f5bbfc1cd0,
+    0xf0119315c50eb50d, 0x3c680947c12081aa, 0x911b8aa7bfd22877,
+    0xe3910129176b0a83, 0x4ee282c96999a35e, 0x83ac72fcac693881,
+    0x2edff11cd29b915c, 0x5c557a927a22b3a8, 0xf126f97204d01a75,
+    0x3d5f632000fe2ed2, 0x902ce0c07e0c870f, 0xe2a66b4ed6b5a5fb,
+    0x4fd5e8aea8470c26, 0xff4b5144f5461527, 0x5238d2a48bb4bcfa,
+    0x20b2592a230d9e0e, 0x8dc1daca5dff37d3, 0x41b8409859d10374,
+    0xeccbc3782723aaa9, 0x9e4148f68f9a885d, 0x3332cb16f1682180,
+    0x81c2a6322ed46770, 0x2cb125d25026cead, 0x5e3bae5cf89fec59,
+    0xf3482dbc866d4584, 0x3f31b7ee82437123, 0x9242340efcb1d8fe,
+    0xe0c8bf805408fa0a, 0x4dbb3c602afa53d7, 0xfd25858a77fb4ad6,
+    0x5056066a0909e30b, 0x22dc8de4a1b0c1ff, 0x8faf0e04df426822,
+    0x43d69456db6c5c85, 0xeea517b6a59ef558, 0x9c2f9c380d27d7ac,
+    0x315c1fd873d57e71, 0xfc12efedb625e5ae, 0x51616c0dc8d74c73,
+    0x23ebe783606e6e87, 0x8e9864631e9cc75a, 0x42e1fe311ab2f3fd,
+    0xef927dd164405a20, 0x9d18f65fccf978d4, 0x306b75bfb20bd109,
+    0x80f5cc55ef0ac808, 0x2d864fb591f861d5, 0x5f0cc43b39414321,
+    0xf27f47db47b3eafc, 0x3e06dd89439dde5b, 0x93755e693d6f7786,
+    0xe1ffd5e795d65572, 0x4c8c5607eb24fcaf, 0xfcf97646683075bf,
+    0x518af5a616c2dc62, 0x23007e28be7bfe96, 0x8e73fdc8c089574b,
+    0x420a679ac4a763ec, 0xef79e47aba55ca31, 0x9df36ff412ece8c5,
+    0x3080ec146c1e4118, 0x801e55fe311f5819, 0x2d6dd61e4fedf1c4,
+    0x5fe75d90e754d330, 0xf294de7099a67aed, 0x3eed44229d884e4a,
+    0x939ec7c2e37ae797, 0xe1144c4c4bc3c563, 0x4c67cfac35316cbe,
+    0x81293f99f0c1f761, 0x2c5abc798e335ebc, 0x5ed037f7268a7c48,
+    0xf3a3b4175878d595, 0x3fda2e455c56e132, 0x92a9ada522a448ef,
+    0xe023262b8a1d6a1b, 0x4d50a5cbf4efc3c6, 0xfdce1c21a9eedac7,
+    0x50bd9fc1d71c731a, 0x2237144f7fa551ee, 0x8f4497af0157f833,
+    0x433d0dfd0579cc94, 0xee4e8e1d7b8b6549, 0x9cc40593d33247bd,
+    0x31b78673adc0ee60, 0x8347eb57727ca890, 0x2e3468b70c8e014d,
+    0x5cbee339a43723b9, 0xf1cd60d9dac58a64, 0x3db4fa8bdeebbec3,
+    0x90c7796ba019171e, 0xe24df2e508a035ea, 0x4f3e710576529c37,
+    0xffa0c8ef2b538536, 0x52d34b0f55a12ceb, 0x2059c081fd180e1f,
+    0x8d2a436183eaa7c2, 0x4153d93387c49365, 0xec205ad3f9363ab8,
+    0x9eaad15d518f184c, 0x33d952bd2f7db191, 0xfe97a288ea8d2a4e,
+    0x53e42168947f8393, 0x216eaae63cc6a167, 0x8c1d2906423408ba,
+    0x4064b354461a3c1d, 0xed1730b438e895c0, 0x9f9dbb3a9051b734,
+    0x32ee38daeea31ee9, 0x82708130b3a207e8, 0x2f0302d0cd50ae35,
+    0x5d89895e65e98cc1, 0xf0fa0abe1b1b251c, 0x3c8390ec1f3511bb,
+    0x91f0130c61c7b866, 0xe37a9882c97e9a92, 0x4e091b62b78c334f,
+    0x02854d655ca8cfe0, 0xaff6ce85225a663d, 0xdd7c450b8ae344c9,
+    0x700fc6ebf411ed14, 0xbc765cb9f03fd9b3, 0x1105df598ecd706e,
+    0x638f54d72674529a, 0xcefcd7375886fb47, 0x7e626edd0587e246,
+    0xd311ed3d7b754b9b, 0xa19b66b3d3cc696f, 0x0ce8e553ad3ec0b2,
+    0xc0917f01a910f415, 0x6de2fce1d7e25dc8, 0x1f68776f7f5b7f3c,
+    0xb21bf48f01a9d6e1, 0x7f5504bac4594d3e, 0xd226875abaabe4e3,
+    0xa0ac0cd41212c617, 0x0ddf8f346ce06fca, 0xc1a6156668ce5b6d,
+    0x6cd59686163cf2b0, 0x1e5f1d08be85d044, 0xb32c9ee8c0777999,
+    0x03b227029d766098, 0xaec1a4e2e384c945, 0xdc4b2f6c4b3debb1,
+    0x7138ac8c35cf426c, 0xbd4136de31e176cb, 0x1032b53e4f13df16,
+    0x62b83eb0e7aafde2, 0xcfcbbd509958543f, 0x7d3bd07446e412cf,
+    0xd04853943816bb12, 0xa2c2d81a90af99e6, 0x0fb15bfaee5d303b,
+    0xc3c8c1a8ea73049c, 0x6ebb42489481ad41, 0x1c31c9c63c388fb5,
+    0xb1424a2642ca2668, 0x01dcf3cc1fcb3f69, 0xacaf702c613996b4,
+    0xde25fba2c980b440, 0x73567842b7721d9d, 0xbf2fe210b35c293a,
+    0x125c61f0cdae80e7, 0x60d6ea7e6517a213, 0xcda5699e1be50bce,
+    0x00eb99abde159011, 0xad981a4ba0e739cc, 0xdf1291c5085e1b38,
+    0x7261122576acb2e5, 0xbe18887772828642, 0x136b0b970c702f9f,
+    0x61e18019a4c90d6b, 0xcc9203f9da3ba4b6, 0x7c0cba13873abdb7,
+    0xd17f39f3f9c8146a, 0xa3f5b27d5171369e, 0x0e86319d2f839f43,
+    0xc2ffabcf2badabe4, 0x6f8c282f555f0239, 0x1d06a3a1fde620cd,
+    0xb075204183148910},
+   {0x0000000000000000, 0x99fd370824b4d90d, 0x32fb6f104868b31b,
+    0xab0658186cdc6a16, 0x64f6df2090d06637, 0xfd0be828b464bf3a,
+    0x560db030d8b8d52c, 0xcff08738fc0c0c21, 0xc8ecbf4120a1cd6e,
+    0x5111884904151463, 0xfa17d05168c97e75, 0x63eae7594c7da778,
+    0xac1a6061b071ab59, 0x35e7576994c57254, 0x9ee10f71f8191842,
+    0x071c3879dcadc14f, 0x90d97f8340429bdd, 0x0924488b64f642d0,
+    0xa2221093082a28c6, 0x3bdf279b2c9ef1cb, 0xf42fa0a3d092fdea,
+    0x6dd297abf42624e7, 0xc6d4cfb398fa4ef1, 0x5f29f8bbbc4e97fc,
+    0x5835c0c260e356b3, 0xc1c8f7ca44578fbe, 0x6aceafd2288be5a8,
+    0xf33398da0c3f3ca5, 0x3cc31fe2f0333084, 0xa53e28ead487e989,
+    0x0e3870f2b85b839f, 0x97c547fa9cef5a92, 0xa5adf1a9aa2bee29,
+    0x3c50c6a18e9f3724, 0x97569eb9e2435d32, 0x0eaba9b1c6f7843f,
+    0xc15b2e893afb881e, 0x58a619811e4f5113, 0xf3a0419972933b05,
+    0x6a5d76915627e208, 0x6d414ee88a8a2347, 0xf4bc79e0ae3efa4a,
+    0x5fba21f8c2e2905c, 0xc64716f0e6564951, 0x09b791c81a5a4570,
+    0x904aa6c03eee9c7d, 0x3b4cfed85232f66b, 0xa2b1c9d076862f66,
+    0x35748e2aea6975f4, 0xac89b922ceddacf9, 0x078fe13aa201c6ef,
+    0x9e72d63286b51fe2, 0x5182510a7ab913c3, 0xc87f66025e0dcace,
+    0x63793e1a32d1a0d8, 0xfa840912166579d5, 0xfd98316bcac8b89a,
+    0x64650663ee7c6197, 0xcf635e7b82a00b81, 0x569e6973a614d28c,
+    0x996eee4b5a18dead, 0x0093d9437eac07a0, 0xab95815b12706db6,
+    0x3268b65336c4b4bb, 0x4a5be3535557dc53, 0xd3a6d45b71e3055e,
+    0x78a08c431d3f6f48, 0xe15dbb4b398bb645, 0x2ead3c73c587ba64,
+    0xb7500b7be1336369, 0x1c5653638def097f, 0x85ab646ba95bd072,
+    0x82b75c1275f6113d, 0x1b4a6b1a5142c830, 0xb04c33023d9ea226,
+    0x29b1040a192a7b2b, 0xe6418332e526770a, 0x7fbcb43ac192ae07,
+    0xd4baec22ad4ec411, 0x4d47db2a89fa1d1c, 0xda829cd01515478e,
+    0x437fabd831a19e83, 0xe879f3c05d7df495, 0x7184c4c879c92d98,
+    0xbe7443f085c521b9, 0x278974f8a171f8b4, 0x8c8f2ce0cdad92a2,
+    0x15721be8e9194baf, 0x126e239135b48ae0, 0x8b931499110053ed,
+    0x20954c817ddc39fb, 0xb9687b895968e0f6, 0x7698fcb1a564ecd7,
+    0xef65cbb981d035da, 0x446393a1ed0c5fcc, 0xdd9ea4a9c9b886c1,
+    0xeff612faff7c327a, 0x760b25f2dbc8eb77, 0xdd0d7deab7148161,
+    0x44f04ae293a0586c, 0x8b00cdda6fac544d, 0x12fdfad24b188d40,
+    0xb9fba2ca27c4e756, 0x200695c203703e5b, 0x271aadbbdfddff14,
+    0xbee79ab3fb692619, 0x15e1c2ab97b54c0f, 0x8c1cf5a3b3019502,
+    0x43ec729b4f0d9923, 0xda1145936bb9402e, 0x71171d8b07652a38,
+    0xe8ea2a8323d1f335, 0x7f2f6d79bf3ea9a7, 0xe6d25a719b8a70aa,
+    0x4dd40269f7561abc, 0xd4293561d3e2c3b1, 0x1bd9b2592feecf90,
+    0x822485510b5a169d, 0x2922dd4967867c8b, 0xb0dfea414332a586,
+    0xb7c3d2389f9f64c9, 0x2e3ee530bb2bbdc4, 0x8538bd28d7f7d7d2,
+    0x1cc58a20f3430edf, 0xd3350d180f4f02fe, 0x4ac83a102bfbdbf3,
+    0xe1ce62084727b1e5, 0x78335500639368e8, 0x94b6c6a7aaaeb8a7,
+    0x0d4bf1af8e1a61aa, 0xa64da9b7e2c60bbc, 0x3fb09ebfc672d2b1,
+    0xf04019873a7ede90, 0x69bd2e8f1eca079d, 0xc2bb769772166d8b,
+    0x5b46419f56a2b486, 0x5c5a79e68a0f75c9, 0xc5a74eeeaebbacc4,
+    0x6ea116f6c267c6d2, 0xf75c21fee6d31fdf, 0x38aca6c61adf13fe,
+    0xa15191ce3e6bcaf3, 0x0a57c9d652b7a0e5, 0x93aafede760379e8,
+    0x046fb924eaec237a, 0x9d928e2cce58fa77, 0x3694d634a2849061,
+    0xaf69e13c8630496c, 0x609966047a3c454d, 0xf964510c5e889c40,
+    0x526209143254f656, 0xcb9f3e1c16e02f5b, 0xcc830665ca4dee14,
+    0x557e316deef93719, 0xfe78697582255d0f, 0x67855e7da6918402,
+    0xa875d9455a9d8823, 0x3188ee4d7e29512e, 0x9a8eb65512f53b38,
+    0x0373815d3641e235, 0x311b370e0085568e, 0xa8e6000624318f83,
+    0x03e0581e48ede595, 0x9a1d6f166c593c98, 0x55ede82e905530b9,
+    0xcc10df26b4e1e9b4, 0x6716873ed83d83a2, 0xfeebb036fc895aaf,
+    0xf9f7884f20249be0, 0x600abf47049042ed, 0xcb0ce75f684c28fb,
+    0x52f1d0574cf8f1f6, 0x9d01576fb0f4fdd7, 0x04fc6067944024da,
+    0xaffa387ff89c4ecc, 0x36070f77dc2897c1, 0xa1c2488d40c7cd53,
+    0x383f7f856473145e, 0x9339279d08af7e48, 0x0ac410952c1ba745,
+    0xc53497add017ab64, 0x5cc9a0a5f4a37269, 0xf7cff8bd987f187f,
+    0x6e32cfb5bccbc172, 0x692ef7cc6066003d, 0xf0d3c0c444d2d930,
+    0x5bd598dc280eb326, 0xc228afd40cba6a2b, 0x0dd828ecf0b6660a,
+    0x94251fe4d402bf07, 0x3f2347fcb8ded511, 0xa6de70f49c6a0c1c,
+    0xdeed25f4fff964f4, 0x471012fcdb4dbdf9, 0xec164ae4b791d7ef,
+    0x75eb7dec93250ee2, 0xba1bfad46f2902c3, 0x23e6cddc4b9ddbce,
+    0x88e095c42741b1d8, 0x111da2cc03f568d5, 0x16019ab5df58a99a,
+    0x8ffcadbdfbec7097, 0x24faf5a597301a81, 0xbd07c2adb384c38c,
+    0x72f745954f88cfad, 0xeb0a729d6b3c16a0, 0x400c2a8507e07cb6,
+    0xd9f11d8d2354a5bb, 0x4e345a77bfbbff29, 0xd7c96d7f9b0f2624,
+    0x7ccf3567f7d34c32, 0xe532026fd367953f, 0x2ac285572f6b991e,
+    0xb33fb25f0bdf4013, 0x1839ea4767032a05, 0x81c4dd4f43b7f308,
+    0x86d8e5369f1a3247, 0x1f25d23ebbaeeb4a, 0xb4238a26d772815c,
+    0x2ddebd2ef3c65851, 0xe22e3a160fca5470, 0x7bd30d1e2b7e8d7d,
+    0xd0d5550647a2e76b, 0x4928620e63163e66, 0x7b40d45d55d28add,
+    0xe2bde355716653d0, 0x49bbbb4d1dba39c6, 0xd0468c45390ee0cb,
+    0x1fb60b7dc502ecea, 0x864b3c75e1b635e7, 0x2d4d646d8d6a5ff1,
+    0xb4b05365a9de86fc, 0xb3ac6b1c757347b3, 0x2a515c1451c79ebe,
+    0x8157040c3d1bf4a8, 0x18aa330419af2da5, 0xd75ab43ce5a32184,
+    0x4ea78334c117f889, 0xe5a1db2cadcb929f, 0x7c5cec24897f4b92,
+    0xeb99abde15901100, 0x72649cd63124c80d, 0xd962c4ce5df8a21b,
+    0x409ff3c6794c7b16, 0x8f6f74fe85407737, 0x169243f6a1f4ae3a,
+    0xbd941beecd28c42c, 0x24692ce6e99c1d21, 0x2375149f3531dc6e,
+    0xba88239711850563, 0x118e7b8f7d596f75, 0x88734c8759edb678,
+    0x4783cbbfa5e1ba59, 0xde7efcb781556354, 0x7578a4afed890942,
+    0xec8593a7c93dd04f},
+   {0x0000000000000000, 0xffbd055eaee475f0, 0x7b65051377663372,
+    0x84d8004dd9824682, 0xf6ca0a26eecc66e4, 0x09770f7840281314,
+    0x8daf0f3599aa5596, 0x72120a6b374e2066, 0x698b1be3f736155a,
+    0x96361ebd59d260aa, 0x12ee1ef080502628, 0xed531bae2eb453d8,
+    0x9f4111c519fa73be, 0x60fc149bb71e064e, 0xe42414d66e9c40cc,
+    0x1b991188c078353c, 0xd21637c6ef6d2ab4, 0x2dab329841895f44,
+    0xa97332d5980b19c6, 0x56ce378b36ef6c36, 0x24dc3de001a14c50,
+    0xdb6138beaf4539a0, 0x5fb938f376c77f22, 0xa0043dadd8230ad2,
+    0xbb9d2c25185b3fee, 0x4420297bb6bf4a1e, 0xc0f829366f3d0c9c,
+    0x3f452c68c1d9796c, 0x4d572603f697590a, 0xb2ea235d58732cfa,
+    0x3632231081f16a78, 0xc98f264e2f151f88, 0x21336023f4748cfa,
+    0xde8e657d5a90f90a, 0x5a5665308312bf88, 0xa5eb606e2df6ca78,
+    0xd7f96a051ab8ea1e, 0x28446f5bb45c9fee, 0xac9c6f166dded96c,
+    0x53216a48c33aac9c, 0x48b87bc0034299a0, 0xb7057e9eada6ec50,
+    0x33dd7ed37424aad2, 0xcc607b8ddac0df22, 0xbe7271e6ed8eff44,
+    0x41cf74b8436a8ab4, 0xc51774f59ae8cc36, 0x3aaa71ab340cb9c6,
+    0xf32557e51b19a64e, 0x0c9852bbb5fdd3be, 0x884052f66c7f953c,
+    0x77fd57a8c29be0cc, 0x05ef5dc3f5d5c0aa, 0xfa52589d5b31b55a,
+    0x7e8a58d082b3f3d8, 0x81375d8e2c578628, 0x9aae4c06ec2fb314,
+    0x6513495842cbc6e4, 0xe1cb49159b498066, 0x1e764c4b35adf596,
+    0x6c64462002e3d5f0, 0x93d9437eac07a000, 0x170143337585e682,
+    0xe8bc466ddb619372, 0xc778cee9c346c067, 0x38c5cbb76da2b597,
+    0xbc1dcbfab420f315, 0x43a0cea41ac486e5, 0x31b2c4cf2d8aa683,
+    0xce0fc191836ed373, 0x4ad7c1dc5aec95f1, 0xb56ac482f408e001,
+    0xaef3d50a3470d53d, 0x514ed0549a94a0cd, 0xd596d0194316e64f,
+    0x2a2bd547edf293bf, 0x5839df2cdabcb3d9, 0xa784da727458c629,
+    0x235cda3fadda80ab, 0xdce1df61033ef55b, 0x156ef92f2c2bead3,
+    0xead3fc7182cf9f23, 0x6e0bfc3c5b4dd9a1, 0x91b6f962f5a9ac51,
+    0xe3a4f309c2e78c37, 0x1c19f6576c03f9c7, 0x98c1f61ab581bf45,
+    0x677cf3441b65cab5, 0x7ce5e2ccdb1dff89, 0x8358e79275f98a79,
+    0x0780e7dfac7bccfb, 0xf83de281029fb90b, 0x8a2fe8ea35d1996d,
+    0x7592edb49b35ec9d, 0xf14aedf942b7aa1f, 0x0ef7e8a7ec53dfef,
+    0xe64baeca37324c9d, 0x19f6ab9499d6396d, 0x9d2eabd940547fef,
+    0x6293ae87eeb00a1f, 0x1081a4ecd9fe2a79, 0xef3ca1b2771a5f89,
+    0x6be4a1ffae98190b, 0x9459a4a1007c6cfb, 0x8fc0b529c00459c7,
+    0x707db0776ee02c37, 0xf4a5b03ab7626ab5, 0x0b18b56419861f45,
+    0x790abf0f2ec83f23, 0x86b7ba51802c4ad3, 0x026fba1c59ae0c51,
+    0xfdd2bf42f74a79a1, 0x345d990cd85f6629, 0xcbe09c5276bb13d9,
+    0x4f389c1faf39555b, 0xb085994101dd20ab, 0xc297932a369300cd,
+    0x3d2a96749877753d, 0xb9f2963941f533bf, 0x464f9367ef11464f,
+    0x5dd682ef2f697373, 0xa26b87b1818d0683, 0x26b387fc580f4001,
+    0xd90e82a2f6eb35f1, 0xab1c88c9c1a51597, 0x54a18d976f416067,
+    0xd0798ddab6c326e5, 0x2fc4888418275315, 0x8ef19cd3878d80cf,
+    0x714c998d2969f53f, 0xf59499c0f0ebb3bd, 0x0a299c9e5e0fc64d,
+    0x783b96f56941e62b, 0x878693abc7a593db, 0x035e93e61e27d559,
+    0xfce396b8b0c3a0a9, 0xe77a873070bb9595, 0x18c7826ede5fe065,
+    0x9c1f822307dda6e7, 0x63a2877da939d317, 0x11b08d169e77f371,
+    0xee0d884830938681, 0x6ad58805e911c003, 0x95688d5b47f5b5f3,
+    0x5ce7ab1568e0aa7b, 0xa35aae4bc604df8b, 0x2782ae061f869909,
+    0xd83fab58b162ecf9, 0xaa2da133862ccc9f, 0x5590a46d28c8b96f,
+    0xd148a420f14affed, 0x2ef5a17e5fae8a1d, 0x356cb0f69fd6bf21,
+    0xcad1b5a83132cad1, 0x4e09b5e5e8b08c53, 0xb1b4b0bb4654f9a3,
+    0xc3a6bad0711ad9c5, 0x3c1bbf8edffeac35, 0xb8c3bfc3067ceab7,
+    0x477eba9da8989f47, 0xafc2fcf073f90c35, 0x507ff9aedd1d79c5,
+    0xd4a7f9e3049f3f47, 0x2b1afcbdaa7b4ab7, 0x5908f6d69d356ad1,
+    0xa6b5f38833d11f21, 0x226df3c5ea5359a3, 0xddd0f69b44b72c53,
+    0xc649e71384cf196f, 0x39f4e24d2a2b6c9f, 0xbd2ce200f3a92a1d,
+    0x4291e75e5d4d5fed, 0x3083ed356a037f8b, 0xcf3ee86bc4e70a7b,
+    0x4be6e8261d654cf9, 0xb45bed78b3813909, 0x7dd4cb369c942681,
+    0x8269ce6832705371, 0x06b1ce25ebf215f3, 0xf90ccb7b45166003,
+    0x8b1ec11072584065, 0x74a3c44edcbc3595, 0xf07bc403053e7317,
+    0x0fc6c15dabda06e7, 0x145fd0d56ba233db, 0xebe2d58bc546462b,
+    0x6f3ad5c61cc400a9, 0x9087d098b2207559, 0xe295daf3856e553f,
+    0x1d28dfad2b8a20cf, 0x99f0dfe0f208664d, 0x664ddabe5cec13bd,
+    0x4989523a44cb40a8, 0xb6345764ea2f3558, 0x32ec572933ad73da,
+    0xcd5152779d49062a, 0xbf43581caa07264c, 0x40fe5d4204e353bc,
+    0xc4265d0fdd61153e, 0x3b9b5851738560ce, 0x200249d9b3fd55f2,
+    0xdfbf4c871d192002, 0x5b674ccac49b6680, 0xa4da49946a7f1370,
+    0xd6c843ff5d313316, 0x297546a1f3d546e6, 0xadad46ec2a570064,
+    0x521043b284b37594, 0x9b9f65fcaba66a1c, 0x642260a205421fec,
+    0xe0fa60efdcc0596e, 0x1f4765b172242c9e, 0x6d556fda456a0cf8,
+    0x92e86a84eb8e7908, 0x16306ac9320c3f8a, 0xe98d6f979ce84a7a,
+    0xf2147e1f5c907f46, 0x0da97b41f2740ab6, 0x89717b0c2bf64c34,
+    0x76cc7e52851239c4, 0x04de7439b25c19a2, 0xfb6371671cb86c52,
+    0x7fbb712ac53a2ad0, 0x800674746bde5f20, 0x68ba3219b0bfcc52,
+    0x970737471e5bb9a2, 0x13df370ac7d9ff20, 0xec623254693d8ad0,
+    0x9e70383f5e73aab6, 0x61cd3d61f097df46, 0xe5153d2c291599c4,
+    0x1aa8387287f1ec34, 0x013129fa4789d908, 0xfe8c2ca4e96dacf8,
+    0x7a542ce930efea7a, 0x85e929b79e0b9f8a, 0xf7fb23dca945bfec,
+    0x0846268207a1ca1c, 0x8c9e26cfde238c9e, 0x7323239170c7f96e,
+    0xbaac05df5fd2e6e6, 0x45110081f1369316, 0xc1c900cc28b4d594,
+    0x3e7405928650a064, 0x4c660ff9b11e8002, 0xb3db0aa71ffaf5f2,
+    0x37030aeac678b370, 0xc8be0fb4689cc680, 0xd3271e3ca8e4f3bc,
+    0x2c9a1b620600864c, 0xa8421b2fdf82c0ce, 0x57ff1e717166b53e,
+    0x25ed141a46289558, 0xda501144e8cce0a8, 0x5e881109314ea62a,
+    0xa13514579faad3da},
+   {0x0000000000000000, 0xe43a39ca97d45de0, 0x4d6b7c3b04066352,
+    0xa95145f193d23eb2, 0x9ad6f876080cc6a4, 0x7eecc1bc9fd89b44,
+    0xd7bd844d0c0aa5f6, 0x3387bd879bdef816, 0xb1b3ff423bb754db,
+    0x5589c688ac63093b, 0xfcd883793fb13789, 0x18e2bab3a8656a69,
+    0x2b65073433bb927f, 0xcf5f3efea46fcf9f, 0x660e7b0f37bdf12d,
+    0x823442c5a069accd, 0xe779f12a5dc17124, 0x0343c8e0ca152cc4,
+    0xaa128d1159c71276, 0x4e28b4dbce134f96, 0x7daf095c55cdb780,
+    0x99953096c219ea60, 0x30c4756751cbd4d2, 0xd4fe4cadc61f8932,
+    0x56ca0e68667625ff, 0xb2f037a2f1a2781f, 0x1ba17253627046ad,
+    0xff9b4b99f5a41b4d, 0xcc1cf61e6e7ae35b, 0x2826cfd4f9aebebb,
+    0x81778a256a7c8009, 0x654db3effda8dde9, 0xcef3e255ba82e348,
+    0x2ac9db9f2d56bea8, 0x83989e6ebe84801a, 0x67a2a7a42950ddfa,
+    0x54251a23b28e25ec, 0xb01f23e9255a780c, 0x194e6618b68846be,
+    0xfd745fd2215c1b5e, 0x7f401d178135b793, 0x9b7a24dd16e1ea73,
+    0x322b612c8533d4c1, 0xd61158e612e78921, 0xe596e56189397137,
+    0x01acdcab1eed2cd7, 0xa8fd995a8d3f1265, 0x4cc7a0901aeb4f85,
+    0x298a137fe743926c, 0xcdb02ab57097cf8c, 0x64e16f44e345f13e,
+    0x80db568e7491acde, 0xb35ceb09ef4f54c8, 0x5766d2c3789b0928,
+    0xfe379732eb49379a, 0x1a0daef87c9d6a7a, 0x9839ec3ddcf4c6b7,
+    0x7c03d5f74b209b57, 0xd5529006d8f2a5e5, 0x3168a9cc4f26f805,
+    0x02ef144bd4f80013, 0xe6d52d81432c5df3, 0x4f846870d0fe6341,
+    0xabbe51ba472a3ea1, 0x9ce7c5ab7405c791, 0x78ddfc61e3d19a71,
+    0xd18cb9907003a4c3, 0x35b6805ae7d7f923, 0x06313ddd7c090135,
+    0xe20b0417ebdd5cd5, 0x4b5a41e6780f6267, 0xaf60782cefdb3f87,
+    0x2d543ae94fb2934a, 0xc96e0323d866ceaa, 0x603f46d24bb4f018,
+    0x84057f18dc60adf8, 0xb782c29f47be55ee, 0x53b8fb55d06a080e,
+    0xfae9bea443b836bc, 0x1ed3876ed46c6b5c, 0x7b9e348129c4b6b5,
+    0x9fa40d4bbe10eb55, 0x36f548ba2dc2d5e7, 0xd2cf7170ba168807,
+    0xe148ccf721c87011, 0x0572f53db61c2df1, 0xac23b0cc25ce1343,
+    0x48198906b21a4ea3, 0xca2dcbc31273e26e, 0x2e17f20985a7bf8e,
+    0x8746b7f81675813c, 0x637c8e3281a1dcdc, 0x50fb33b51a7f24ca,
+    0xb4c10a7f8dab792a, 0x1d904f8e1e794798, 0xf9aa764489ad1a78,
+    0x521427fece8724d9, 0xb62e1e3459537939, 0x1f7f5bc5ca81478b,
+    0xfb45620f5d551a6b, 0xc8c2df88c68be27d, 0x2cf8e642515fbf9d,
+    0x85a9a3b3c28d812f, 0x61939a795559dccf, 0xe3a7d8bcf5307002,
+    0x079de17662e42de2, 0xaecca487f1361350, 0x4af69d4d66e24eb0,
+    0x797120cafd3cb6a6, 0x9d4b19006ae8eb46, 0x341a5cf1f93ad5f4,
+    0xd020653b6eee8814, 0xb56dd6d4934655fd, 0x5157ef1e0492081d,
+    0xf806aaef974036af, 0x1c3c932500946b4f, 0x2fbb2ea29b4a9359,
+    0xcb8117680c9eceb9, 0x62d052999f4cf00b, 0x86ea6b530898adeb,
+    0x04de2996a8f10126, 0xe0e4105c3f255cc6, 0x49b555adacf76274,
+    0xad8f6c673b233f94, 0x9e08d1e0a0fdc782, 0x7a32e82a37299a62,
+    0xd363addba4fba4d0, 0x37599411332ff930, 0xbdd185f8c2a556b1,
+    0x59ebbc3255710b51, 0xf0baf9c3c6a335e3, 0x1480c00951776803,
+    0x27077d8ecaa99015, 0xc33d44445d7dcdf5, 0x6a6c01b5ceaff347,
+    0x8e56387f597baea7, 0x0c627abaf912026a, 0xe85843706ec65f8a,
+    0x41090681fd146138, 0xa5333f4b6ac03cd8, 0x96b482ccf11ec4ce,
+    0x728ebb0666ca992e, 0xdbdffef7f518a79c, 0x3fe5c73d62ccfa7c,
+    0x5aa874d29f642795, 0xbe924d1808b07a75, 0x17c308e99b6244c7,
+    0xf3f931230cb61927, 0xc07e8ca49768e131, 0x2444b56e00bcbcd1,
+    0x8d15f09f936e8263, 0x692fc95504badf83, 0xeb1b8b90a4d3734e,
+    0x0f21b25a33072eae, 0xa670f7aba0d5101c, 0x424ace6137014dfc,
+    0x71cd73e6acdfb5ea, 0x95f74a2c3b0be80a, 0x3ca60fdda8d9d6b8,
+    0xd89c36173f0d8b58, 0x732267ad7827b5f9, 0x97185e67eff3e819,
+    0x3e491b967c21d6ab, 0xda73225cebf58b4b, 0xe9f49fdb702b735d,
+    0x0dcea611e7ff2ebd, 0xa49fe3e0742d100f, 0x40a5da2ae3f94def,
+    0xc29198ef4390e122, 0x26aba125d444bcc2, 0x8ffae4d447968270,
+    0x6bc0dd1ed042df90, 0x584760994b9c2786, 0xbc7d5953dc487a66,
+    0x152c1ca24f9a44d4, 0xf1162568d84e1934, 0x945b968725e6c4dd,
+    0x7061af4db232993d, 0xd930eabc21e0a78f, 0x3d0ad376b634fa6f,
+    0x0e8d6ef12dea0279, 0xeab7573bba3e5f99, 0x43e612ca29ec612b,
+    0xa7dc2b00be383ccb, 0x25e869c51e519006, 0xc1d2500f8985cde6,
+    0x688315fe1a57f354, 0x8cb92c348d83aeb4, 0xbf3e91b3165d56a2,
+    0x5b04a87981890b42, 0xf255ed88125b35f0, 0x166fd442858f6810,
+    0x21364053b6a09120, 0xc50c79992174ccc0, 0x6c5d3c68b2a6f272,
+    0x886705a22572af92, 0xbbe0b825beac5784, 0x5fda81ef29780a64,
+    0xf68bc41ebaaa34d6, 0x12b1fdd42d7e6936, 0x9085bf118d17c5fb,
+    0x74bf86db1ac3981b, 0xddeec32a8911a6a9, 0x39d4fae01ec5fb49,
+    0x0a534767851b035f, 0xee697ead12cf5ebf, 0x47383b5c811d600d,
+    0xa302029616c93ded, 0xc64fb179eb61e004, 0x227588b37cb5bde4,
+    0x8b24cd42ef678356, 0x6f1ef48878b3deb6, 0x5c99490fe36d26a0,
+    0xb8a370c574b97b40, 0x11f23534e76b45f2, 0xf5c80cfe70bf1812,
+    0x77fc4e3bd0d6b4df, 0x93c677f14702e93f, 0x3a973200d4d0d78d,
+    0xdead0bca43048a6d, 0xed2ab64dd8da727b, 0x09108f874f0e2f9b,
+    0xa041ca76dcdc1129, 0x447bf3bc4b084cc9, 0xefc5a2060c227268,
+    0x0bff9bcc9bf62f88, 0xa2aede3d0824113a, 0x4694e7f79ff04cda,
+    0x75135a70042eb4cc, 0x912963ba93fae92c, 0x3878264b0028d79e,
+    0xdc421f8197fc8a7e, 0x5e765d44379526b3, 0xba4c648ea0417b53,
+    0x131d217f339345e1, 0xf72718b5a4471801, 0xc4a0a5323f99e017,
+    0x209a9cf8a84dbdf7, 0x89cbd9093b9f8345, 0x6df1e0c3ac4bdea5,
+    0x08bc532c51e3034c, 0xec866ae6c6375eac, 0x45d72f1755e5601e,
+    0xa1ed16ddc2313dfe, 0x926aab5a59efc5e8, 0x76509290ce3b9808,
+    0xdf01d7615de9a6ba, 0x3b3beeabca3dfb5a, 0xb90fac6e6a545797,
+    0x5d3595a4fd800a77, 0xf464d0556e5234c5, 0x105ee99ff9866925,
+    0x23d9541862589133, 0xc7e36dd2f58cccd3, 0x6eb22823665ef261,
+    0x8a8811e9f18aaf81}};
+
+#endif /* N == 2 */
+#if N == 3
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0x3be653a30fe1af51, 0x77cca7461fc35ea2,
+    0x4c2af4e51022f1f3, 0xef994e8c3f86bd44, 0xd47f1d2f30671215,
+    0x9855e9ca2045e3e6, 0xa3b3ba692fa44cb7, 0x4dea3233d003640d,
+    0x760c6190dfe2cb5c, 0x3a269575cfc03aaf, 0x01c0c6d6c02195fe,
+    0xa2737cbfef85d949, 0x99952f1ce0647618, 0xd5bfdbf9f04687eb,
+    0xee59885affa728ba, 0x9bd46467a006c81a, 0xa03237c4afe7674b,
+    0xec18c321bfc596b8, 0xd7fe9082b02439e9, 0x744d2aeb9f80755e,
+    0x4fab79489061da0f, 0x03818dad80432bfc, 0x3867de0e8fa284ad,
+    0xd63e56547005ac17, 0xedd805f77fe40346, 0xa1f2f1126fc6f2b5,
+    0x9a14a2b160275de4, 0x39a718d84f831153, 0x02414b7b4062be02,
+    0x4e6bbf9e50404ff1, 0x758dec3d5fa1e0a0, 0xa57067e4ef038eb1,
+    0x9e963447e0e221e0, 0xd2bcc0a2f0c0d013, 0xe95a9301ff217f42,
+    0x4ae92968d08533f5, 0x710f7acbdf649ca4, 0x3d258e2ecf466d57,
+    0x06c3dd8dc0a7c206, 0xe89a55d73f00eabc, 0xd37c067430e145ed,
+    0x9f56f29120c3b41e, 0xa4b0a1322f221b4f, 0x07031b5b008657f8,
+    0x3ce548f80f67f8a9, 0x70cfbc1d1f45095a, 0x4b29efbe10a4a60b,
+    0x3ea403834f0546ab, 0x0542502040e4e9fa, 0x4968a4c550c61809,
+    0x728ef7665f27b758, 0xd13d4d0f7083fbef, 0xeadb1eac7f6254be,
+    0xa6f1ea496f40a54d, 0x9d17b9ea60a10a1c, 0x734e31b09f0622a6,
+    0x48a8621390e78df7, 0x048296f680c57c04, 0x3f64c5558f24d355,
+    0x9cd77f3ca0809fe2, 0xa7312c9faf6130b3, 0xeb1bd87abf43c140,
+    0xd0fd8bd9b0a26e11, 0xd83860e2710903e7, 0xe3de33417ee8acb6,
+    0xaff4c7a46eca5d45, 0x94129407612bf214, 0x37a12e6e4e8fbea3,
+    0x0c477dcd416e11f2, 0x406d8928514ce001, 0x7b8bda8b5ead4f50,
+    0x95d252d1a10a67ea, 0xae340172aeebc8bb, 0xe21ef597bec93948,
+    0xd9f8a634b1289619, 0x7a4b1c5d9e8cdaae, 0x41ad4ffe916d75ff,
+    0x0d87bb1b814f840c, 0x3661e8b88eae2b5d, 0x43ec0485d10fcbfd,
+    0x780a5726deee64ac, 0x3420a3c3cecc955f, 0x0fc6f060c12d3a0e,
+    0xac754a09ee8976b9, 0x979319aae168d9e8, 0xdbb9ed4ff14a281b,
+    0xe05fbeecfeab874a, 0x0e0636b6010caff0, 0x35e065150eed00a1,
+    0x79ca91f01ecff152, 0x422cc253112e5e03, 0xe19f783a3e8a12b4,
+    0xda792b99316bbde5, 0x9653df7c21494c16, 0xadb58cdf2ea8e347,
+    0x7d4807069e0a8d56, 0x46ae54a591eb2207, 0x0a84a04081c9d3f4,
+    0x3162f3e38e287ca5, 0x92d1498aa18c3012, 0xa9371a29ae6d9f43,
+    0xe51deeccbe4f6eb0, 0xdefbbd6fb1aec1e1, 0x30a235354e09e95b,
+    0x0b44669641e8460a, 0x476e927351cab7f9, 0x7c88c1d05e2b18a8,
+    0xdf3b7bb9718f541f, 0xe4dd281a7e6efb4e, 0xa8f7dcff6e4c0abd,
+    0x93118f5c61ada5ec, 0xe69c63613e0c454c, 0xdd7a30c231edea1d,
+    0x9150c42721cf1bee, 0xaab697842e2eb4bf, 0x09052ded018af808,
+    0x32e37e4e0e6b5759, 0x7ec98aab1e49a6aa, 0x452fd90811a809fb,
+    0xab765152ee0f2141, 0x909002f1e1ee8e10, 0xdcbaf614f1cc7fe3,
+    0xe75ca5b7fe2dd0b2, 0x44ef1fded1899c05, 0x7f094c7dde683354,
+    0x3323b898ce4ac2a7, 0x08c5eb3bc1ab6df6, 0x22a86eef4d1c194b,
+    0x194e3d4c42fdb61a, 0x5564c9a952df47e9, 0x6e829a0a5d3ee8b8,
+    0xcd312063729aa40f, 0xf6d773c07d7b0b5e, 0xbafd87256d59faad,
+    0x811bd48662b855fc, 0x6f425cdc9d1f7d46, 0x54a40f7f92fed217,
+    0x188efb9a82dc23e4, 0x2368a8398d3d8cb5, 0x80db1250a299c002,
+    0xbb3d41f3ad786f53, 0xf717b516bd5a9ea0, 0xccf1e6b5b2bb31f1,
+    0xb97c0a88ed1ad151, 0x829a592be2fb7e00, 0xceb0adcef2d98ff3,
+    0xf556fe6dfd3820a2, 0x56e54404d29c6c15, 0x6d0317a7dd7dc344,
+    0x2129e342cd5f32b7, 0x1acfb0e1c2be9de6, 0xf49638bb3d19b55c,
+    0xcf706b1832f81a0d, 0x835a9ffd22daebfe, 0xb8bccc5e2d3b44af,
+    0x1b0f7637029f0818, 0x20e925940d7ea749, 0x6cc3d1711d5c56ba,
+    0x572582d212bdf9eb, 0x87d8090ba21f97fa, 0xbc3e5aa8adfe38ab,
+    0xf014ae4dbddcc958, 0xcbf2fdeeb23d6609, 0x684147879d992abe,
+    0x53a71424927885ef, 0x1f8de0c1825a741c, 0x246bb3628dbbdb4d,
+    0xca323b38721cf3f7, 0xf1d4689b7dfd5ca6, 0xbdfe9c7e6ddfad55,
+    0x8618cfdd623e0204, 0x25ab75b44d9a4eb3, 0x1e4d2617427be1e2,
+    0x5267d2f252591011, 0x698181515db8bf40, 0x1c0c6d6c02195fe0,
+    0x27ea3ecf0df8f0b1, 0x6bc0ca2a1dda0142, 0x50269989123bae13,
+    0xf39523e03d9fe2a4, 0xc8737043327e4df5, 0x845984a6225cbc06,
+    0xbfbfd7052dbd1357, 0x51e65f5fd21a3bed, 0x6a000cfcddfb94bc,
+    0x262af819cdd9654f, 0x1dccabbac238ca1e, 0xbe7f11d3ed9c86a9,
+    0x85994270e27d29f8, 0xc9b3b695f25fd80b, 0xf255e536fdbe775a,
+    0xfa900e0d3c151aac, 0xc1765dae33f4b5fd, 0x8d5ca94b23d6440e,
+    0xb6bafae82c37eb5f, 0x150940810393a7e8, 0x2eef13220c7208b9,
+    0x62c5e7c71c50f94a, 0x5923b46413b1561b, 0xb77a3c3eec167ea1,
+    0x8c9c6f9de3f7d1f0, 0xc0b69b78f3d52003, 0xfb50c8dbfc348f52,
+    0x58e372b2d390c3e5, 0x63052111dc716cb4, 0x2f2fd5f4cc539d47,
+    0x14c98657c3b23216, 0x61446a6a9c13d2b6, 0x5aa239c993f27de7,
+    0x1688cd2c83d08c14, 0x2d6e9e8f8c312345, 0x8edd24e6a3956ff2,
+    0xb53b7745ac74c0a3, 0xf91183a0bc563150, 0xc2f7d003b3b79e01,
+    0x2cae58594c10b6bb, 0x17480bfa43f119ea, 0x5b62ff1f53d3e819,
+    0x6084acbc5c324748, 0xc33716d573960bff, 0xf8d145767c77a4ae,
+    0xb4fbb1936c55555d, 0x8f1de23063b4fa0c, 0x5fe069e9d316941d,
+    0x64063a4adcf73b4c, 0x282cceafccd5cabf, 0x13ca9d0cc33465ee,
+    0xb0792765ec902959, 0x8b9f74c6e3718608, 0xc7b58023f35377fb,
+    0xfc53d380fcb2d8aa, 0x120a5bda0315f010, 0x29ec08790cf45f41,
+    0x65c6fc9c1cd6aeb2, 0x5e20af3f133701e3, 0xfd9315563c934d54,
+    0xc67546f53372e205, 0x8a5fb210235013f6, 0xb1b9e1b32cb1bca7,
+    0xc4340d8e73105c07, 0xffd25e2d7cf1f356, 0xb3f8aac86cd302a5,
+    0x881ef96b6332adf4, 0x2bad43024c96e143, 0x104b10a143774e12,
+    0x5c61e4445355bfe1, 0x6787b7e75cb410b0, 0x89de3fbda313380a,
+    0xb2386c1eacf2975b, 0xfe1298fbbcd066a8, 0xc5f4cb58b331c9f9,
+    0x664771319c95854e, 0x5da1229293742a1f, 0x118bd6778356dbec,
+    0x2a6d85d48cb774bd},
+   {0x0000000000000000, 0x4550ddde9a383296, 0x8aa1bbbd3470652c,
+    0xcff16663ae4857ba, 0x879bd851c7eed4dd, 0xc2cb058f5dd6e64b,
+    0x0d3a63ecf39eb1f1, 0x486abe3269a68367, 0x9def1f8820d3b73f,
+    0xd8bfc256baeb85a9, 0x174ea43514a3d213, 0x521e79eb8e9be085,
+    0x1a74c7d9e73d63e2, 0x5f241a077d055174, 0x90d57c64d34d06ce,
+    0xd585a1ba49753458, 0xa906903beea970fb, 0xec564de57491426d,
+    0x23a72b86dad915d7, 0x66f7f65840e12741, 0x2e9d486a2947a426,
+    0x6bcd95b4b37f96b0, 0xa43cf3d71d37c10a, 0xe16c2e09870ff39c,
+    0x34e98fb3ce7ac7c4, 0x71b9526d5442f552, 0xbe48340efa0aa2e8,
+    0xfb18e9d06032907e, 0xb37257e209941319, 0xf6228a3c93ac218f,
+    0x39d3ec5f3de47635, 0x7c833181a7dc44a3, 0xc0d58f5c725cff73,
+    0x85855282e864cde5, 0x4a7434e1462c9a5f, 0x0f24e93fdc14a8c9,
+    0x474e570db5b22bae, 0x021e8ad32f8a1938, 0xcdefecb081c24e82,
+    0x88bf316e1bfa7c14, 0x5d3a90d4528f484c, 0x186a4d0ac8b77ada,
+    0xd79b2b6966ff2d60, 0x92cbf6b7fcc71ff6, 0xdaa1488595619c91,
+    0x9ff1955b0f59ae07, 0x5000f338a111f9bd, 0x15502ee63b29cb2b,
+    0x69d31f679cf58f88, 0x2c83c2b906cdbd1e, 0xe372a4daa885eaa4,
+    0xa622790432bdd832, 0xee48c7365b1b5b55, 0xab181ae8c12369c3,
+    0x64e97c8b6f6b3e79, 0x21b9a155f5530cef, 0xf43c00efbc2638b7,
+    0xb16cdd31261e0a21, 0x7e9dbb5288565d9b, 0x3bcd668c126e6f0d,
+    0x73a7d8be7bc8ec6a, 0x36f70560e1f0defc, 0xf90663034fb88946,
+    0xbc56beddd580bbd0, 0x1373b1934bb7e063, 0x56236c4dd18fd2f5,
+    0x99d20a2e7fc7854f, 0xdc82d7f0e5ffb7d9, 0x94e869c28c5934be,
+    0xd1b8b41c16610628, 0x1e49d27fb8295192, 0x5b190fa122116304,
+    0x8e9cae1b6b64575c, 0xcbcc73c5f15c65ca, 0x043d15a65f143270,
+    0x416dc878c52c00e6, 0x0907764aac8a8381, 0x4c57ab9436b2b117,
+    0x83a6cdf798fae6ad, 0xc6f6102902c2d43b, 0xba7521a8a51e9098,
+    0xff25fc763f26a20e, 0x30d49a15916ef5b4, 0x758447cb0b56c722,
+    0x3deef9f962f04445, 0x78be2427f8c876d3, 0xb74f424456802169,
+    0xf21f9f9accb813ff, 0x279a3e2085cd27a7, 0x62cae3fe1ff51531,
+    0xad3b859db1bd428b, 0xe86b58432b85701d, 0xa001e6714223f37a,
+    0xe5513bafd81bc1ec, 0x2aa05dcc76539656, 0x6ff08012ec6ba4c0,
+    0xd3a63ecf39eb1f10, 0x96f6e311a3d32d86, 0x590785720d9b7a3c,
+    0x1c5758ac97a348aa, 0x543de69efe05cbcd, 0x116d3b40643df95b,
+    0xde9c5d23ca75aee1, 0x9bcc80fd504d9c77, 0x4e4921471938a82f,
+    0x0b19fc9983009ab9, 0xc4e89afa2d48cd03, 0x81b84724b770ff95,
+    0xc9d2f916ded67cf2, 0x8c8224c844ee4e64, 0x437342abeaa619de,
+    0x06239f75709e2b48, 0x7aa0aef4d7426feb, 0x3ff0732a4d7a5d7d,
+    0xf0011549e3320ac7, 0xb551c897790a3851, 0xfd3b76a510acbb36,
+    0xb86bab7b8a9489a0, 0x779acd1824dcde1a, 0x32ca10c6bee4ec8c,
+    0xe74fb17cf791d8d4, 0xa21f6ca26da9ea42, 0x6dee0ac1c3e1bdf8,
+    0x28bed71f59d98f6e, 0x60d4692d307f0c09, 0x2584b4f3aa473e9f,
+    0xea75d290040f6925, 0xaf250f4e9e375bb3, 0x26e76326976fc0c6,
+    0x63b7bef80d57f250, 0xac46d89ba31fa5ea, 0xe91605453927977c,
+    0xa17cbb775081141b, 0xe42c66a9cab9268d, 0x2bdd00ca64f17137,
+    0x6e8ddd14fec943a1, 0xbb087caeb7bc77f9, 0xfe58a1702d84456f,
+    0x31a9c71383cc12d5, 0x74f91acd19f42043, 0x3c93a4ff7052a324,
+    0x79c37921ea6a91b2, 0xb6321f424422c608, 0xf362c29cde1af49e,
+    0x8fe1f31d79c6b03d, 0xcab12ec3e3fe82ab, 0x054048a04db6d511,
+    0x4010957ed78ee787, 0x087a2b4cbe2864e0, 0x4d2af69224105676,
+    0x82db90f18a5801cc, 0xc78b4d2f1060335a, 0x120eec9559150702,
+    0x575e314bc32d3594, 0x98af57286d65622e, 0xddff8af6f75d50b8,
+    0x959534c49efbd3df, 0xd0c5e91a04c3e149, 0x1f348f79aa8bb6f3,
+    0x5a6452a730b38465, 0xe632ec7ae5333fb5, 0xa36231a47f0b0d23,
+    0x6c9357c7d1435a99, 0x29c38a194b7b680f, 0x61a9342b22ddeb68,
+    0x24f9e9f5b8e5d9fe, 0xeb088f9616ad8e44, 0xae5852488c95bcd2,
+    0x7bddf3f2c5e0888a, 0x3e8d2e2c5fd8ba1c, 0xf17c484ff190eda6,
+    0xb42c95916ba8df30, 0xfc462ba3020e5c57, 0xb916f67d98366ec1,
+    0x76e7901e367e397b, 0x33b74dc0ac460bed, 0x4f347c410b9a4f4e,
+    0x0a64a19f91a27dd8, 0xc595c7fc3fea2a62, 0x80c51a22a5d218f4,
+    0xc8afa410cc749b93, 0x8dff79ce564ca905, 0x420e1fadf804febf,
+    0x075ec273623ccc29, 0xd2db63c92b49f871, 0x978bbe17b171cae7,
+    0x587ad8741f399d5d, 0x1d2a05aa8501afcb, 0x5540bb98eca72cac,
+    0x10106646769f1e3a, 0xdfe10025d8d74980, 0x9ab1ddfb42ef7b16,
+    0x3594d2b5dcd820a5, 0x70c40f6b46e01233, 0xbf356908e8a84589,
+    0xfa65b4d67290771f, 0xb20f0ae41b36f478, 0xf75fd73a810ec6ee,
+    0x38aeb1592f469154, 0x7dfe6c87b57ea3c2, 0xa87bcd3dfc0b979a,
+    0xed2b10e36633a50c, 0x22da7680c87bf2b6, 0x678aab5e5243c020,
+    0x2fe0156c3be54347, 0x6ab0c8b2a1dd71d1, 0xa541aed10f95266b,
+    0xe011730f95ad14fd, 0x9c92428e3271505e, 0xd9c29f50a84962c8,
+    0x1633f93306013572, 0x536324ed9c3907e4, 0x1b099adff59f8483,
+    0x5e5947016fa7b615, 0x91a82162c1efe1af, 0xd4f8fcbc5bd7d339,
+    0x017d5d0612a2e761, 0x442d80d8889ad5f7, 0x8bdce6bb26d2824d,
+    0xce8c3b65bceab0db, 0x86e68557d54c33bc, 0xc3b658894f74012a,
+    0x0c473eeae13c5690, 0x4917e3347b046406, 0xf5415de9ae84dfd6,
+    0xb011803734bced40, 0x7fe0e6549af4bafa, 0x3ab03b8a00cc886c,
+    0x72da85b8696a0b0b, 0x378a5866f352399d, 0xf87b3e055d1a6e27,
+    0xbd2be3dbc7225cb1, 0x68ae42618e5768e9, 0x2dfe9fbf146f5a7f,
+    0xe20ff9dcba270dc5, 0xa75f2402201f3f53, 0xef359a3049b9bc34,
+    0xaa6547eed3818ea2, 0x6594218d7dc9d918, 0x20c4fc53e7f1eb8e,
+    0x5c47cdd2402daf2d, 0x1917100cda159dbb, 0xd6e6766f745dca01,
+    0x93b6abb1ee65f897, 0xdbdc158387c37bf0, 0x9e8cc85d1dfb4966,
+    0x517dae3eb3b31edc, 0x142d73e0298b2c4a, 0xc1a8d25a60fe1812,
+    0x84f80f84fac62a84, 0x4b0969e7548e7d3e, 0x0e59b439ceb64fa8,
+    0x46330a0ba710cccf, 0x0363d7d53d28fe59, 0xcc92b1b69360a9e3,
+    0x89c26c6809589b75},
+   {0x0000000000000000, 0x4dcec64d2edf818c, 0x9b9d8c9a5dbf0318,
+    0xd6534ad773608294, 0xa5e3b61f147018b5, 0xe82d70523aaf9939,
+    0x3e7e3a8549cf1bad, 0x73b0fcc867109a21, 0xd91fc31587ee2fef,
+    0x94d10558a931ae63, 0x42824f8fda512cf7, 0x0f4c89c2f48ead7b,
+    0x7cfc750a939e375a, 0x3132b347bd41b6d6, 0xe761f990ce213442,
+    0xaaaf3fdde0feb5ce, 0x20e72900a0d2415b, 0x6d29ef4d8e0dc0d7,
+    0xbb7aa59afd6d4243, 0xf6b463d7d3b2c3cf, 0x85049f1fb4a259ee,
+    0xc8ca59529a7dd862, 0x1e991385e91d5af6, 0x5357d5c8c7c2db7a,
+    0xf9f8ea15273c6eb4, 0xb4362c5809e3ef38, 0x6265668f7a836dac,
+    0x2faba0c2545cec20, 0x5c1b5c0a334c7601, 0x11d59a471d93f78d,
+    0xc786d0906ef37519, 0x8a4816dd402cf495, 0x41ce520141a482b6,
+    0x0c00944c6f7b033a, 0xda53de9b1c1b81ae, 0x979d18d632c40022,
+    0xe42de41e55d49a03, 0xa9e322537b0b1b8f, 0x7fb06884086b991b,
+    0x327eaec926b41897, 0x98d19114c64aad59, 0xd51f5759e8952cd5,
+    0x034c1d8e9bf5ae41, 0x4e82dbc3b52a2fcd, 0x3d32270bd23ab5ec,
+    0x70fce146fce53460, 0xa6afab918f85b6f4, 0xeb616ddca15a3778,
+    0x61297b01e176c3ed, 0x2ce7bd4ccfa94261, 0xfab4f79bbcc9c0f5,
+    0xb77a31d692164179, 0xc4cacd1ef506db58, 0x89040b53dbd95ad4,
+    0x5f574184a8b9d840, 0x129987c9866659cc, 0xb836b8146698ec02,
+    0xf5f87e5948476d8e, 0x23ab348e3b27ef1a, 0x6e65f2c315f86e96,
+    0x1dd50e0b72e8f4b7, 0x501bc8465c37753b, 0x864882912f57f7af,
+    0xcb8644dc01887623, 0x839ca4028349056c, 0xce52624fad9684e0,
+    0x18012898def60674, 0x55cfeed5f02987f8, 0x267f121d97391dd9,
+    0x6bb1d450b9e69c55, 0xbde29e87ca861ec1, 0xf02c58cae4599f4d,
+    0x5a83671704a72a83, 0x174da15a2a78ab0f, 0xc11eeb8d5918299b,
+    0x8cd02dc077c7a817, 0xff60d10810d73236, 0xb2ae17453e08b3ba,
+    0x64fd5d924d68312e, 0x29339bdf63b7b0a2, 0xa37b8d02239b4437,
+    0xeeb54b4f0d44c5bb, 0x38e601987e24472f, 0x7528c7d550fbc6a3,
+    0x06983b1d37eb5c82, 0x4b56fd501934dd0e, 0x9d05b7876a545f9a,
+    0xd0cb71ca448bde16, 0x7a644e17a4756bd8, 0x37aa885a8aaaea54,
+    0xe1f9c28df9ca68c0, 0xac3704c0d715e94c, 0xdf87f808b005736d,
+    0x92493e459edaf2e1, 0x441a7492edba7075, 0x09d4b2dfc365f1f9,
+    0xc252f603c2ed87da, 0x8f9c304eec320656, 0x59cf7a999f5284c2,
+    0x1401bcd4b18d054e, 0x67b1401cd69d9f6f, 0x2a7f8651f8421ee3,
+    0xfc2ccc868b229c77, 0xb1e20acba5fd1dfb, 0x1b4d35164503a835,
+    0x5683f35b6bdc29b9, 0x80d0b98c18bcab2d, 0xcd1e7fc136632aa1,
+    0xbeae83095173b080, 0xf36045447fac310c, 0x25330f930cccb398,
+    0x68fdc9de22133214, 0xe2b5df03623fc681, 0xaf7b194e4ce0470d,
+    0x792853993f80c599, 0x34e695d4115f4415, 0x4756691c764fde34,
+    0x0a98af5158905fb8, 0xdccbe5862bf0dd2c, 0x910523cb052f5ca0,
+    0x3baa1c16e5d1e96e, 0x7664da5bcb0e68e2, 0xa037908cb86eea76,
+    0xedf956c196b16bfa, 0x9e49aa09f1a1f1db, 0xd3876c44df7e7057,
+    0x05d42693ac1ef2c3, 0x481ae0de82c1734f, 0x95e1e72ea99c145d,
+    0xd82f2163874395d1, 0x0e7c6bb4f4231745, 0x43b2adf9dafc96c9,
+    0x30025131bdec0ce8, 0x7dcc977c93338d64, 0xab9fddabe0530ff0,
+    0xe6511be6ce8c8e7c, 0x4cfe243b2e723bb2, 0x0130e27600adba3e,
+    0xd763a8a173cd38aa, 0x9aad6eec5d12b926, 0xe91d92243a022307,
+    0xa4d3546914dda28b, 0x72801ebe67bd201f, 0x3f4ed8f34962a193,
+    0xb506ce2e094e5506, 0xf8c808632791d48a, 0x2e9b42b454f1561e,
+    0x635584f97a2ed792, 0x10e578311d3e4db3, 0x5d2bbe7c33e1cc3f,
+    0x8b78f4ab40814eab, 0xc6b632e66e5ecf27, 0x6c190d3b8ea07ae9,
+    0x21d7cb76a07ffb65, 0xf78481a1d31f79f1, 0xba4a47ecfdc0f87d,
+    0xc9fabb249ad0625c, 0x84347d69b40fe3d0, 0x526737bec76f6144,
+    0x1fa9f1f3e9b0e0c8, 0xd42fb52fe83896eb, 0x99e17362c6e71767,
+    0x4fb239b5b58795f3, 0x027cfff89b58147f, 0x71cc0330fc488e5e,
+    0x3c02c57dd2970fd2, 0xea518faaa1f78d46, 0xa79f49e78f280cca,
+    0x0d30763a6fd6b904, 0x40feb07741093888, 0x96adfaa03269ba1c,
+    0xdb633ced1cb63b90, 0xa8d3c0257ba6a1b1, 0xe51d06685579203d,
+    0x334e4cbf2619a2a9, 0x7e808af208c62325, 0xf4c89c2f48ead7b0,
+    0xb9065a626635563c, 0x6f5510b51555d4a8, 0x229bd6f83b8a5524,
+    0x512b2a305c9acf05, 0x1ce5ec7d72454e89, 0xcab6a6aa0125cc1d,
+    0x877860e72ffa4d91, 0x2dd75f3acf04f85f, 0x60199977e1db79d3,
+    0xb64ad3a092bbfb47, 0xfb8415edbc647acb, 0x8834e925db74e0ea,
+    0xc5fa2f68f5ab6166, 0x13a965bf86cbe3f2, 0x5e67a3f2a814627e,
+    0x167d432c2ad51131, 0x5bb38561040a90bd, 0x8de0cfb6776a1229,
+    0xc02e09fb59b593a5, 0xb39ef5333ea50984, 0xfe50337e107a8808,
+    0x280379a9631a0a9c, 0x65cdbfe44dc58b10, 0xcf628039ad3b3ede,
+    0x82ac467483e4bf52, 0x54ff0ca3f0843dc6, 0x1931caeede5bbc4a,
+    0x6a813626b94b266b, 0x274ff06b9794a7e7, 0xf11cbabce4f42573,
+    0xbcd27cf1ca2ba4ff, 0x369a6a2c8a07506a, 0x7b54ac61a4d8d1e6,
+    0xad07e6b6d7b85372, 0xe0c920fbf967d2fe, 0x9379dc339e7748df,
+    0xdeb71a7eb0a8c953, 0x08e450a9c3c84bc7, 0x452a96e4ed17ca4b,
+    0xef85a9390de97f85, 0xa24b6f742336fe09, 0x741825a350567c9d,
+    0x39d6e3ee7e89fd11, 0x4a661f2619996730, 0x07a8d96b3746e6bc,
+    0xd1fb93bc44266428, 0x9c3555f16af9e5a4, 0x57b3112d6b719387,
+    0x1a7dd76045ae120b, 0xcc2e9db736ce909f, 0x81e05bfa18111113,
+    0xf250a7327f018b32, 0xbf9e617f51de0abe, 0x69cd2ba822be882a,
+    0x2403ede50c6109a6, 0x8eacd238ec9fbc68, 0xc3621475c2403de4,
+    0x15315ea2b120bf70, 0x58ff98ef9fff3efc, 0x2b4f6427f8efa4dd,
+    0x6681a26ad6302551, 0xb0d2e8bda550a7c5, 0xfd1c2ef08b8f2649,
+    0x7754382dcba3d2dc, 0x3a9afe60e57c5350, 0xecc9b4b7961cd1c4,
+    0xa10772fab8c35048, 0xd2b78e32dfd3ca69, 0x9f79487ff10c4be5,
+    0x492a02a8826cc971, 0x04e4c4e5acb348fd, 0xae4bfb384c4dfd33,
+    0xe3853d7562927cbf, 0x35d677a211f2fe2b, 0x7818b1ef3f2d7fa7,
+    0x0ba84d27583de586, 0x46668b6a76e2640a, 0x9035c1bd0582e69e,
+    0xddfb07f02b5d6712},
+   {0x0000000000000000, 0xb91b6176fc36363f, 0xe0ee6dc6576272fb,
+    0x59f50cb0ab5444c4, 0x530474a701cafb73, 0xea1f15d1fdfccd4c,
+    0xb3ea196156a88988, 0x0af17817aa9ebfb7, 0xa608e94e0395f6e6,
+    0x1f138838ffa3c0d9, 0x46e6848854f7841d, 0xfffde5fea8c1b222,
+    0xf50c9de9025f0d95, 0x4c17fc9ffe693baa, 0x15e2f02f553d7f6e,
+    0xacf99159a90b4951, 0xdec97db7a825f349, 0x67d21cc15413c576,
+    0x3e271071ff4781b2, 0x873c71070371b78d, 0x8dcd0910a9ef083a,
+    0x34d6686655d93e05, 0x6d2364d6fe8d7ac1, 0xd43805a002bb4cfe,
+    0x78c194f9abb005af, 0xc1daf58f57863390, 0x982ff93ffcd27754,
+    0x2134984900e4416b, 0x2bc5e05eaa7afedc, 0x92de8128564cc8e3,
+    0xcb2b8d98fd188c27, 0x7230ecee012eba18, 0x2f4a5444ff45f817,
+    0x965135320373ce28, 0xcfa43982a8278aec, 0x76bf58f45411bcd3,
+    0x7c4e20e3fe8f0364, 0xc555419502b9355b, 0x9ca04d25a9ed719f,
+    0x25bb2c5355db47a0, 0x8942bd0afcd00ef1, 0x3059dc7c00e638ce,
+    0x69acd0ccabb27c0a, 0xd0b7b1ba57844a35, 0xda46c9adfd1af582,
+    0x635da8db012cc3bd, 0x3aa8a46baa788779, 0x83b3c51d564eb146,
+    0xf18329f357600b5e, 0x48984885ab563d61, 0x116d4435000279a5,
+    0xa8762543fc344f9a, 0xa2875d5456aaf02d, 0x1b9c3c22aa9cc612,
+    0x4269309201c882d6, 0xfb7251e4fdfeb4e9, 0x578bc0bd54f5fdb8,
+    0xee90a1cba8c3cb87, 0xb765ad7b03978f43, 0x0e7ecc0dffa1b97c,
+    0x048fb41a553f06cb, 0xbd94d56ca90930f4, 0xe461d9dc025d7430,
+    0x5d7ab8aafe6b420f, 0x5e94a889fe8bf02e, 0xe78fc9ff02bdc611,
+    0xbe7ac54fa9e982d5, 0x0761a43955dfb4ea, 0x0d90dc2eff410b5d,
+    0xb48bbd5803773d62, 0xed7eb1e8a82379a6, 0x5465d09e54154f99,
+    0xf89c41c7fd1e06c8, 0x418720b1012830f7, 0x18722c01aa7c7433,
+    0xa1694d77564a420c, 0xab983560fcd4fdbb, 0x1283541600e2cb84,
+    0x4b7658a6abb68f40, 0xf26d39d05780b97f, 0x805dd53e56ae0367,
+    0x3946b448aa983558, 0x60b3b8f801cc719c, 0xd9a8d98efdfa47a3,
+    0xd359a1995764f814, 0x6a42c0efab52ce2b, 0x33b7cc5f00068aef,
+    0x8aacad29fc30bcd0, 0x26553c70553bf581, 0x9f4e5d06a90dc3be,
+    0xc6bb51b60259877a, 0x7fa030c0fe6fb145, 0x755148d754f10ef2,
+    0xcc4a29a1a8c738cd, 0x95bf251103937c09, 0x2ca44467ffa54a36,
+    0x71defccd01ce0839, 0xc8c59dbbfdf83e06, 0x9130910b56ac7ac2,
+    0x282bf07daa9a4cfd, 0x22da886a0004f34a, 0x9bc1e91cfc32c575,
+    0xc234e5ac576681b1, 0x7b2f84daab50b78e, 0xd7d61583025bfedf,
+    0x6ecd74f5fe6dc8e0, 0x3738784555398c24, 0x8e231933a90fba1b,
+    0x84d26124039105ac, 0x3dc90052ffa73393, 0x643c0ce254f37757,
+    0xdd276d94a8c54168, 0xaf17817aa9ebfb70, 0x160ce00c55ddcd4f,
+    0x4ff9ecbcfe89898b, 0xf6e28dca02bfbfb4, 0xfc13f5dda8210003,
+    0x450894ab5417363c, 0x1cfd981bff4372f8, 0xa5e6f96d037544c7,
+    0x091f6834aa7e0d96, 0xb004094256483ba9, 0xe9f105f2fd1c7f6d,
+    0x50ea6484012a4952, 0x5a1b1c93abb4f6e5, 0xe3007de55782c0da,
+    0xbaf57155fcd6841e, 0x03ee102300e0b221, 0xbd295113fd17e05c,
+    0x043230650121d663, 0x5dc73cd5aa7592a7, 0xe4dc5da35643a498,
+    0xee2d25b4fcdd1b2f, 0x573644c200eb2d10, 0x0ec34872abbf69d4,
+    0xb7d8290457895feb, 0x1b21b85dfe8216ba, 0xa23ad92b02b42085,
+    0xfbcfd59ba9e06441, 0x42d4b4ed55d6527e, 0x4825ccfaff48edc9,
+    0xf13ead8c037edbf6, 0xa8cba13ca82a9f32, 0x11d0c04a541ca90d,
+    0x63e02ca455321315, 0xdafb4dd2a904252a, 0x830e4162025061ee,
+    0x3a152014fe6657d1, 0x30e4580354f8e866, 0x89ff3975a8cede59,
+    0xd00a35c5039a9a9d, 0x691154b3ffacaca2, 0xc5e8c5ea56a7e5f3,
+    0x7cf3a49caa91d3cc, 0x2506a82c01c59708, 0x9c1dc95afdf3a137,
+    0x96ecb14d576d1e80, 0x2ff7d03bab5b28bf, 0x7602dc8b000f6c7b,
+    0xcf19bdfdfc395a44, 0x926305570252184b, 0x2b786421fe642e74,
+    0x728d689155306ab0, 0xcb9609e7a9065c8f, 0xc16771f00398e338,
+    0x787c1086ffaed507, 0x21891c3654fa91c3, 0x98927d40a8cca7fc,
+    0x346bec1901c7eead, 0x8d708d6ffdf1d892, 0xd48581df56a59c56,
+    0x6d9ee0a9aa93aa69, 0x676f98be000d15de, 0xde74f9c8fc3b23e1,
+    0x8781f578576f6725, 0x3e9a940eab59511a, 0x4caa78e0aa77eb02,
+    0xf5b119965641dd3d, 0xac441526fd1599f9, 0x155f74500123afc6,
+    0x1fae0c47abbd1071, 0xa6b56d31578b264e, 0xff406181fcdf628a,
+    0x465b00f700e954b5, 0xeaa291aea9e21de4, 0x53b9f0d855d42bdb,
+    0x0a4cfc68fe806f1f, 0xb3579d1e02b65920, 0xb9a6e509a828e697,
+    0x00bd847f541ed0a8, 0x594888cfff4a946c, 0xe053e9b9037ca253,
+    0xe3bdf99a039c1072, 0x5aa698ecffaa264d, 0x0353945c54fe6289,
+    0xba48f52aa8c854b6, 0xb0b98d3d0256eb01, 0x09a2ec4bfe60dd3e,
+    0x5057e0fb553499fa, 0xe94c818da902afc5, 0x45b510d40009e694,
+    0xfcae71a2fc3fd0ab, 0xa55b7d12576b946f, 0x1c401c64ab5da250,
+    0x16b1647301c31de7, 0xafaa0505fdf52bd8, 0xf65f09b556a16f1c,
+    0x4f4468c3aa975923, 0x3d74842dabb9e33b, 0x846fe55b578fd504,
+    0xdd9ae9ebfcdb91c0, 0x6481889d00eda7ff, 0x6e70f08aaa731848,
+    0xd76b91fc56452e77, 0x8e9e9d4cfd116ab3, 0x3785fc3a01275c8c,
+    0x9b7c6d63a82c15dd, 0x22670c15541a23e2, 0x7b9200a5ff4e6726,
+    0xc28961d303785119, 0xc87819c4a9e6eeae, 0x716378b255d0d891,
+    0x28967402fe849c55, 0x918d157402b2aa6a, 0xccf7addefcd9e865,
+    0x75eccca800efde5a, 0x2c19c018abbb9a9e, 0x9502a16e578daca1,
+    0x9ff3d979fd131316, 0x26e8b80f01252529, 0x7f1db4bfaa7161ed,
+    0xc606d5c9564757d2, 0x6aff4490ff4c1e83, 0xd3e425e6037a28bc,
+    0x8a112956a82e6c78, 0x330a482054185a47, 0x39fb3037fe86e5f0,
+    0x80e0514102b0d3cf, 0xd9155df1a9e4970b, 0x600e3c8755d2a134,
+    0x123ed06954fc1b2c, 0xab25b11fa8ca2d13, 0xf2d0bdaf039e69d7,
+    0x4bcbdcd9ffa85fe8, 0x413aa4ce5536e05f, 0xf821c5b8a900d660,
+    0xa1d4c908025492a4, 0x18cfa87efe62a49b, 0xb43639275769edca,
+    0x0d2d5851ab5fdbf5, 0x54d854e1000b9f31, 0xedc33597fc3da90e,
+    0xe7324d8056a316b9, 0x5e292cf6aa952086, 0x07dc204601c16442,
+    0xbec74130fdf7527d},
+   {0x0000000000000000, 0xe88a0d0c5521de3d, 0x43ccb533054da2ff,
+    0xab46b83f506c7cc2, 0x87996a660a9b45fe, 0x6f13676a5fba9bc3,
+    0xc455df550fd6e701, 0x2cdfd2595af7393c, 0x9dea7be7ba389579,
+    0x756076ebef194b44, 0xde26ced4bf753786, 0x36acc3d8ea54e9bb,
+    0x1a731181b0a3d087, 0xf2f91c8de5820eba, 0x59bfa4b2b5ee7278,
+    0xb135a9bee0cfac45, 0xa90c58e4db7f3477, 0x418655e88e5eea4a,
+    0xeac0edd7de329688, 0x024ae0db8b1348b5, 0x2e953282d1e47189,
+    0xc61f3f8e84c5afb4, 0x6d5987b1d4a9d376, 0x85d38abd81880d4b,
+    0x34e623036147a10e, 0xdc6c2e0f34667f33, 0x772a9630640a03f1,
+    0x9fa09b3c312bddcc, 0xb37f49656bdce4f0, 0x5bf544693efd3acd,
+    0xf0b3fc566e91460f, 0x1839f15a3bb09832, 0xc0c01ee219f0766b,
+    0x284a13ee4cd1a856, 0x830cabd11cbdd494, 0x6b86a6dd499c0aa9,
+    0x47597484136b3395, 0xafd37988464aeda8, 0x0495c1b71626916a,
+    0xec1fccbb43074f57, 0x5d2a6505a3c8e312, 0xb5a06809f6e93d2f,
+    0x1ee6d036a68541ed, 0xf66cdd3af3a49fd0, 0xdab30f63a953a6ec,
+    0x3239026ffc7278d1, 0x997fba50ac1e0413, 0x71f5b75cf93fda2e,
+    0x69cc4606c28f421c, 0x81464b0a97ae9c21, 0x2a00f335c7c2e0e3,
+    0xc28afe3992e33ede, 0xee552c60c81407e2, 0x06df216c9d35d9df,
+    0xad999953cd59a51d, 0x4513945f98787b20, 0xf4263de178b7d765,
+    0x1cac30ed2d960958, 0xb7ea88d27dfa759a, 0x5f6085de28dbaba7,
+    0x73bf5787722c929b, 0x9b355a8b270d4ca6, 0x3073e2b477613064,
+    0xd8f9efb82240ee59, 0x135892ef9ceef253, 0xfbd29fe3c9cf2c6e,
+    0x509427dc99a350ac, 0xb81e2ad0cc828e91, 0x94c1f8899675b7ad,
+    0x7c4bf585c3546990, 0xd70d4dba93381552, 0x3f8740b6c619cb6f,
+    0x8eb2e90826d6672a, 0x6638e40473f7b917, 0xcd7e5c3b239bc5d5,
+    0x25f4513776ba1be8, 0x092b836e2c4d22d4, 0xe1a18e62796cfce9,
+    0x4ae7365d2900802b, 0xa26d3b517c215e16, 0xba54ca0b4791c624,
+    0x52dec70712b01819, 0xf9987f3842dc64db, 0x1112723417fdbae6,
+    0x3dcda06d4d0a83da, 0xd547ad61182b5de7, 0x7e01155e48472125,
+    0x968b18521d66ff18, 0x27beb1ecfda9535d, 0xcf34bce0a8888d60,
+    0x647204dff8e4f1a2, 0x8cf809d3adc52f9f, 0xa027db8af73216a3,
+    0x48add686a213c89e, 0xe3eb6eb9f27fb45c, 0x0b6163b5a75e6a61,
+    0xd3988c0d851e8438, 0x3b128101d03f5a05, 0x9054393e805326c7,
+    0x78de3432d572f8fa, 0x5401e66b8f85c1c6, 0xbc8beb67daa41ffb,
+    0x17cd53588ac86339, 0xff475e54dfe9bd04, 0x4e72f7ea3f261141,
+    0xa6f8fae66a07cf7c, 0x0dbe42d93a6bb3be, 0xe5344fd56f4a6d83,
+    0xc9eb9d8c35bd54bf, 0x21619080609c8a82, 0x8a2728bf30f0f640,
+    0x62ad25b365d1287d, 0x7a94d4e95e61b04f, 0x921ed9e50b406e72,
+    0x395861da5b2c12b0, 0xd1d26cd60e0dcc8d, 0xfd0dbe8f54faf5b1,
+    0x1587b38301db2b8c, 0xbec10bbc51b7574e, 0x564b06b004968973,
+    0xe77eaf0ee4592536, 0x0ff4a202b178fb0b, 0xa4b21a3de11487c9,
+    0x4c381731b43559f4, 0x60e7c568eec260c8, 0x886dc864bbe3bef5,
+    0x232b705beb8fc237, 0xcba17d57beae1c0a, 0x26b125df39dde4a6,
+    0xce3b28d36cfc3a9b, 0x657d90ec3c904659, 0x8df79de069b19864,
+    0xa1284fb93346a158, 0x49a242b566677f65, 0xe2e4fa8a360b03a7,
+    0x0a6ef786632add9a, 0xbb5b5e3883e571df, 0x53d15334d6c4afe2,
+    0xf897eb0b86a8d320, 0x101de607d3890d1d, 0x3cc2345e897e3421,
+    0xd4483952dc5fea1c, 0x7f0e816d8c3396de, 0x97848c61d91248e3,
+    0x8fbd7d3be2a2d0d1, 0x67377037b7830eec, 0xcc71c808e7ef722e,
+    0x24fbc504b2ceac13, 0x0824175de839952f, 0xe0ae1a51bd184b12,
+    0x4be8a26eed7437d0, 0xa362af62b855e9ed, 0x125706dc589a45a8,
+    0xfadd0bd00dbb9b95, 0x519bb3ef5dd7e757, 0xb911bee308f6396a,
+    0x95ce6cba52010056, 0x7d4461b60720de6b, 0xd602d989574ca2a9,
+    0x3e88d485026d7c94, 0xe6713b3d202d92cd, 0x0efb3631750c4cf0,
+    0xa5bd8e0e25603032, 0x4d3783027041ee0f, 0x61e8515b2ab6d733,
+    0x89625c577f97090e, 0x2224e4682ffb75cc, 0xcaaee9647adaabf1,
+    0x7b9b40da9a1507b4, 0x93114dd6cf34d989, 0x3857f5e99f58a54b,
+    0xd0ddf8e5ca797b76, 0xfc022abc908e424a, 0x148827b0c5af9c77,
+    0xbfce9f8f95c3e0b5, 0x57449283c0e23e88, 0x4f7d63d9fb52a6ba,
+    0xa7f76ed5ae737887, 0x0cb1d6eafe1f0445, 0xe43bdbe6ab3eda78,
+    0xc8e409bff1c9e344, 0x206e04b3a4e83d79, 0x8b28bc8cf48441bb,
+    0x63a2b180a1a59f86, 0xd297183e416a33c3, 0x3a1d1532144bedfe,
+    0x915bad0d4427913c, 0x79d1a00111064f01, 0x550e72584bf1763d,
+    0xbd847f541ed0a800, 0x16c2c76b4ebcd4c2, 0xfe48ca671b9d0aff,
+    0x35e9b730a53316f5, 0xdd63ba3cf012c8c8, 0x76250203a07eb40a,
+    0x9eaf0f0ff55f6a37, 0xb270dd56afa8530b, 0x5afad05afa898d36,
+    0xf1bc6865aae5f1f4, 0x19366569ffc42fc9, 0xa803ccd71f0b838c,
+    0x4089c1db4a2a5db1, 0xebcf79e41a462173, 0x034574e84f67ff4e,
+    0x2f9aa6b11590c672, 0xc710abbd40b1184f, 0x6c56138210dd648d,
+    0x84dc1e8e45fcbab0, 0x9ce5efd47e4c2282, 0x746fe2d82b6dfcbf,
+    0xdf295ae77b01807d, 0x37a357eb2e205e40, 0x1b7c85b274d7677c,
+    0xf3f688be21f6b941, 0x58b03081719ac583, 0xb03a3d8d24bb1bbe,
+    0x010f9433c474b7fb, 0xe985993f915569c6, 0x42c32100c1391504,
+    0xaa492c0c9418cb39, 0x8696fe55ceeff205, 0x6e1cf3599bce2c38,
+    0xc55a4b66cba250fa, 0x2dd0466a9e838ec7, 0xf529a9d2bcc3609e,
+    0x1da3a4dee9e2bea3, 0xb6e51ce1b98ec261, 0x5e6f11edecaf1c5c,
+    0x72b0c3b4b6582560, 0x9a3aceb8e379fb5d, 0x317c7687b315879f,
+    0xd9f67b8be63459a2, 0x68c3d23506fbf5e7, 0x8049df3953da2bda,
+    0x2b0f670603b65718, 0xc3856a0a56978925, 0xef5ab8530c60b019,
+    0x07d0b55f59416e24, 0xac960d60092d12e6, 0x441c006c5c0cccdb,
+    0x5c25f13667bc54e9, 0xb4affc3a329d8ad4, 0x1fe9440562f1f616,
+    0xf763490937d0282b, 0xdbbc9b506d271117, 0x3336965c3806cf2a,
+    0x98702e63686ab3e8, 0x70fa236f3d4b6dd5, 0xc1cf8ad1dd84c190,
+    0x294587dd88a51fad, 0x82033fe2d8c9636f, 0x6a8932ee8de8bd52,
+    0x4656e0b7d71f846e, 0xaedcedbb823e5a53, 0x059a5584d2522691,
+    0xed1058888773f8ac},
+   {0x0000000000000000, 0x4d624bbe73bbc94c, 0x9ac4977ce7779298,
+    0xd7a6dcc294cc5bd4, 0xa75181d261e13bb5, 0xea33ca6c125af2f9,
+    0x3d9516ae8696a92d, 0x70f75d10f52d6061, 0xdc7bac8f6ccc69ef,
+    0x9119e7311f77a0a3, 0x46bf3bf38bbbfb77, 0x0bdd704df800323b,
+    0x7b2a2d5d0d2d525a, 0x364866e37e969b16, 0xe1eeba21ea5ac0c2,
+    0xac8cf19f99e1098e, 0x2a2ff6357696cd5b, 0x674dbd8b052d0417,
+    0xb0eb614991e15fc3, 0xfd892af7e25a968f, 0x8d7e77e71777f6ee,
+    0xc01c3c5964cc3fa2, 0x17bae09bf0006476, 0x5ad8ab2583bbad3a,
+    0xf6545aba1a5aa4b4, 0xbb36110469e16df8, 0x6c90cdc6fd2d362c,
+    0x21f286788e96ff60, 0x5105db687bbb9f01, 0x1c6790d60800564d,
+    0xcbc14c149ccc0d99, 0x86a307aaef77c4d5, 0x545fec6aed2d9ab6,
+    0x193da7d49e9653fa, 0xce9b7b160a5a082e, 0x83f930a879e1c162,
+    0xf30e6db88ccca103, 0xbe6c2606ff77684f, 0x69cafac46bbb339b,
+    0x24a8b17a1800fad7, 0x882440e581e1f359, 0xc5460b5bf25a3a15,
+    0x12e0d799669661c1, 0x5f829c27152da88d, 0x2f75c137e000c8ec,
+    0x62178a8993bb01a0, 0xb5b1564b07775a74, 0xf8d31df574cc9338,
+    0x7e701a5f9bbb57ed, 0x331251e1e8009ea1, 0xe4b48d237cccc575,
+    0xa9d6c69d0f770c39, 0xd9219b8dfa5a6c58, 0x9443d03389e1a514,
+    0x43e50cf11d2dfec0, 0x0e87474f6e96378c, 0xa20bb6d0f7773e02,
+    0xef69fd6e84ccf74e, 0x38cf21ac1000ac9a, 0x75ad6a1263bb65d6,
+    0x055a3702969605b7, 0x48387cbce52dccfb, 0x9f9ea07e71e1972f,
+    0xd2fcebc0025a5e63, 0xa8bfd8d5da5b356c, 0xe5dd936ba9e0fc20,
+    0x327b4fa93d2ca7f4, 0x7f1904174e976eb8, 0x0fee5907bbba0ed9,
+    0x428c12b9c801c795, 0x952ace7b5ccd9c41, 0xd84885c52f76550d,
+    0x74c4745ab6975c83, 0x39a63fe4c52c95cf, 0xee00e32651e0ce1b,
+    0xa362a898225b0757, 0xd395f588d7766736, 0x9ef7be36a4cdae7a,
+    0x495162f43001f5ae, 0x0433294a43ba3ce2, 0x82902ee0accdf837,
+    0xcff2655edf76317b, 0x1854b99c4bba6aaf, 0x5536f2223801a3e3,
+    0x25c1af32cd2cc382, 0x68a3e48cbe970ace, 0xbf05384e2a5b511a,
+    0xf26773f059e09856, 0x5eeb826fc00191d8, 0x1389c9d1b3ba5894,
+    0xc42f151327760340, 0x894d5ead54cdca0c, 0xf9ba03bda1e0aa6d,
+    0xb4d84803d25b6321, 0x637e94c1469738f5, 0x2e1cdf7f352cf1b9,
+    0xfce034bf3776afda, 0xb1827f0144cd6696, 0x6624a3c3d0013d42,
+    0x2b46e87da3baf40e, 0x5bb1b56d5697946f, 0x16d3fed3252c5d23,
+    0xc1752211b1e006f7, 0x8c1769afc25bcfbb, 0x209b98305bbac635,
+    0x6df9d38e28010f79, 0xba5f0f4cbccd54ad, 0xf73d44f2cf769de1,
+    0x87ca19e23a5bfd80, 0xcaa8525c49e034cc, 0x1d0e8e9edd2c6f18,
+    0x506cc520ae97a654, 0xd6cfc28a41e06281, 0x9bad8934325babcd,
+    0x4c0b55f6a697f019, 0x01691e48d52c3955, 0x719e435820015934,
+    0x3cfc08e653ba9078, 0xeb5ad424c776cbac, 0xa6389f9ab4cd02e0,
+    0x0ab46e052d2c0b6e, 0x47d625bb5e97c222, 0x9070f979ca5b99f6,
+    0xdd12b2c7b9e050ba, 0xade5efd74ccd30db, 0xe087a4693f76f997,
+    0x372178ababbaa243, 0x7a433315d8016b0f, 0xc3a71e801bb8745d,
+    0x8ec5553e6803bd11, 0x596389fcfccfe6c5, 0x1401c2428f742f89,
+    0x64f69f527a594fe8, 0x2994d4ec09e286a4, 0xfe32082e9d2edd70,
+    0xb3504390ee95143c, 0x1fdcb20f77741db2, 0x52bef9b104cfd4fe,
+    0x8518257390038f2a, 0xc87a6ecde3b84666, 0xb88d33dd16952607,
+    0xf5ef7863652eef4b, 0x2249a4a1f1e2b49f, 0x6f2bef1f82597dd3,
+    0xe988e8b56d2eb906, 0xa4eaa30b1e95704a, 0x734c7fc98a592b9e,
+    0x3e2e3477f9e2e2d2, 0x4ed969670ccf82b3, 0x03bb22d97f744bff,
+    0xd41dfe1bebb8102b, 0x997fb5a59803d967, 0x35f3443a01e2d0e9,
+    0x78910f84725919a5, 0xaf37d346e6954271, 0xe25598f8952e8b3d,
+    0x92a2c5e86003eb5c, 0xdfc08e5613b82210, 0x08665294877479c4,
+    0x4504192af4cfb088, 0x97f8f2eaf695eeeb, 0xda9ab954852e27a7,
+    0x0d3c659611e27c73, 0x405e2e286259b53f, 0x30a973389774d55e,
+    0x7dcb3886e4cf1c12, 0xaa6de444700347c6, 0xe70faffa03b88e8a,
+    0x4b835e659a598704, 0x06e115dbe9e24e48, 0xd147c9197d2e159c,
+    0x9c2582a70e95dcd0, 0xecd2dfb7fbb8bcb1, 0xa1b09409880375fd,
+    0x761648cb1ccf2e29, 0x3b7403756f74e765, 0xbdd704df800323b0,
+    0xf0b54f61f3b8eafc, 0x271393a36774b128, 0x6a71d81d14cf7864,
+    0x1a86850de1e21805, 0x57e4ceb39259d149, 0x8042127106958a9d,
+    0xcd2059cf752e43d1, 0x61aca850eccf4a5f, 0x2ccee3ee9f748313,
+    0xfb683f2c0bb8d8c7, 0xb60a74927803118b, 0xc6fd29828d2e71ea,
+    0x8b9f623cfe95b8a6, 0x5c39befe6a59e372, 0x115bf54019e22a3e,
+    0x6b18c655c1e34131, 0x267a8debb258887d, 0xf1dc51292694d3a9,
+    0xbcbe1a97552f1ae5, 0xcc494787a0027a84, 0x812b0c39d3b9b3c8,
+    0x568dd0fb4775e81c, 0x1bef9b4534ce2150, 0xb7636adaad2f28de,
+    0xfa012164de94e192, 0x2da7fda64a58ba46, 0x60c5b61839e3730a,
+    0x1032eb08ccce136b, 0x5d50a0b6bf75da27, 0x8af67c742bb981f3,
+    0xc79437ca580248bf, 0x41373060b7758c6a, 0x0c557bdec4ce4526,
+    0xdbf3a71c50021ef2, 0x9691eca223b9d7be, 0xe666b1b2d694b7df,
+    0xab04fa0ca52f7e93, 0x7ca226ce31e32547, 0x31c06d704258ec0b,
+    0x9d4c9cefdbb9e585, 0xd02ed751a8022cc9, 0x07880b933cce771d,
+    0x4aea402d4f75be51, 0x3a1d1d3dba58de30, 0x777f5683c9e3177c,
+    0xa0d98a415d2f4ca8, 0xedbbc1ff2e9485e4, 0x3f472a3f2ccedb87,
+    0x722561815f7512cb, 0xa583bd43cbb9491f, 0xe8e1f6fdb8028053,
+    0x9816abed4d2fe032, 0xd574e0533e94297e, 0x02d23c91aa5872aa,
+    0x4fb0772fd9e3bbe6, 0xe33c86b04002b268, 0xae5ecd0e33b97b24,
+    0x79f811cca77520f0, 0x349a5a72d4cee9bc, 0x446d076221e389dd,
+    0x090f4cdc52584091, 0xdea9901ec6941b45, 0x93cbdba0b52fd209,
+    0x1568dc0a5a5816dc, 0x580a97b429e3df90, 0x8fac4b76bd2f8444,
+    0xc2ce00c8ce944d08, 0xb2395dd83bb92d69, 0xff5b16664802e425,
+    0x28fdcaa4dccebff1, 0x659f811aaf7576bd, 0xc913708536947f33,
+    0x84713b3b452fb67f, 0x53d7e7f9d1e3edab, 0x1eb5ac47a25824e7,
+    0x6e42f15757754486, 0x2320bae924ce8dca, 0xf486662bb002d61e,
+    0xb9e42d95c3b91f52},
+   {0x0000000000000000, 0x1596922b987ef63f, 0x2b2d245730fdec7e,
+    0x3ebbb67ca8831a41, 0x565a48ae61fbd8fc, 0x43ccda85f9852ec3,
+    0x7d776cf951063482, 0x68e1fed2c978c2bd, 0xacb4915cc3f7b1f8,
+    0xb92203775b8947c7, 0x8799b50bf30a5d86, 0x920f27206b74abb9,
+    0xfaeed9f2a20c6904, 0xef784bd93a729f3b, 0xd1c3fda592f1857a,
+    0xc4556f8e0a8f7345, 0xcbb18d9228e17d75, 0xde271fb9b09f8b4a,
+    0xe09ca9c5181c910b, 0xf50a3bee80626734, 0x9debc53c491aa589,
+    0x887d5717d16453b6, 0xb6c6e16b79e749f7, 0xa3507340e199bfc8,
+    0x67051cceeb16cc8d, 0x72938ee573683ab2, 0x4c283899dbeb20f3,
+    0x59beaab24395d6cc, 0x315f54608aed1471, 0x24c9c64b1293e24e,
+    0x1a727037ba10f80f, 0x0fe4e21c226e0e30, 0x05bbb40ffecce46f,
+    0x102d262466b21250, 0x2e969058ce310811, 0x3b000273564ffe2e,
+    0x53e1fca19f373c93, 0x46776e8a0749caac, 0x78ccd8f6afcad0ed,
+    0x6d5a4add37b426d2, 0xa90f25533d3b5597, 0xbc99b778a545a3a8,
+    0x822201040dc6b9e9, 0x97b4932f95b84fd6, 0xff556dfd5cc08d6b,
+    0xeac3ffd6c4be7b54, 0xd47849aa6c3d6115, 0xc1eedb81f443972a,
+    0xce0a399dd62d991a, 0xdb9cabb64e536f25, 0xe5271dcae6d07564,
+    0xf0b18fe17eae835b, 0x98507133b7d641e6, 0x8dc6e3182fa8b7d9,
+    0xb37d5564872bad98, 0xa6ebc74f1f555ba7, 0x62bea8c115da28e2,
+    0x77283aea8da4dedd, 0x49938c962527c49c, 0x5c051ebdbd5932a3,
+    0x34e4e06f7421f01e, 0x21727244ec5f0621, 0x1fc9c43844dc1c60,
+    0x0a5f5613dca2ea5f, 0x0b77681ffd99c8de, 0x1ee1fa3465e73ee1,
+    0x205a4c48cd6424a0, 0x35ccde63551ad29f, 0x5d2d20b19c621022,
+    0x48bbb29a041ce61d, 0x760004e6ac9ffc5c, 0x639696cd34e10a63,
+    0xa7c3f9433e6e7926, 0xb2556b68a6108f19, 0x8ceedd140e939558,
+    0x99784f3f96ed6367, 0xf199b1ed5f95a1da, 0xe40f23c6c7eb57e5,
+    0xdab495ba6f684da4, 0xcf220791f716bb9b, 0xc0c6e58dd578b5ab,
+    0xd55077a64d064394, 0xebebc1dae58559d5, 0xfe7d53f17dfbafea,
+    0x969cad23b4836d57, 0x830a3f082cfd9b68, 0xbdb18974847e8129,
+    0xa8271b5f1c007716, 0x6c7274d1168f0453, 0x79e4e6fa8ef1f26c,
+    0x475f50862672e82d, 0x52c9c2adbe0c1e12, 0x3a283c7f7774dcaf,
+    0x2fbeae54ef0a2a90, 0x11051828478930d1, 0x04938a03dff7c6ee,
+    0x0eccdc1003552cb1, 0x1b5a4e3b9b2bda8e, 0x25e1f84733a8c0cf,
+    0x30776a6cabd636f0, 0x589694be62aef44d, 0x4d000695fad00272,
+    0x73bbb0e952531833, 0x662d22c2ca2dee0c, 0xa2784d4cc0a29d49,
+    0xb7eedf6758dc6b76, 0x8955691bf05f7137, 0x9cc3fb3068218708,
+    0xf42205e2a15945b5, 0xe1b497c93927b38a, 0xdf0f21b591a4a9cb,
+    0xca99b39e09da5ff4, 0xc57d51822bb451c4, 0xd0ebc3a9b3caa7fb,
+    0xee5075d51b49bdba, 0xfbc6e7fe83374b85, 0x9327192c4a4f8938,
+    0x86b18b07d2317f07, 0xb80a3d7b7ab26546, 0xad9caf50e2cc9379,
+    0x69c9c0dee843e03c, 0x7c5f52f5703d1603, 0x42e4e489d8be0c42,
+    0x577276a240c0fa7d, 0x3f93887089b838c0, 0x2a051a5b11c6ceff,
+    0x14beac27b945d4be, 0x01283e0c213b2281, 0x16eed03ffb3391bc,
+    0x03784214634d6783, 0x3dc3f468cbce7dc2, 0x2855664353b08bfd,
+    0x40b498919ac84940, 0x55220aba02b6bf7f, 0x6b99bcc6aa35a53e,
+    0x7e0f2eed324b5301, 0xba5a416338c42044, 0xafccd348a0bad67b,
+    0x917765340839cc3a, 0x84e1f71f90473a05, 0xec0009cd593ff8b8,
+    0xf9969be6c1410e87, 0xc72d2d9a69c214c6, 0xd2bbbfb1f1bce2f9,
+    0xdd5f5dadd3d2ecc9, 0xc8c9cf864bac1af6, 0xf67279fae32f00b7,
+    0xe3e4ebd17b51f688, 0x8b051503b2293435, 0x9e9387282a57c20a,
+    0xa028315482d4d84b, 0xb5bea37f1aaa2e74, 0x71ebccf110255d31,
+    0x647d5eda885bab0e, 0x5ac6e8a620d8b14f, 0x4f507a8db8a64770,
+    0x27b1845f71de85cd, 0x32271674e9a073f2, 0x0c9ca008412369b3,
+    0x190a3223d95d9f8c, 0x1355643005ff75d3, 0x06c3f61b9d8183ec,
+    0x38784067350299ad, 0x2deed24cad7c6f92, 0x450f2c9e6404ad2f,
+    0x5099beb5fc7a5b10, 0x6e2208c954f94151, 0x7bb49ae2cc87b76e,
+    0xbfe1f56cc608c42b, 0xaa7767475e763214, 0x94ccd13bf6f52855,
+    0x815a43106e8bde6a, 0xe9bbbdc2a7f31cd7, 0xfc2d2fe93f8deae8,
+    0xc2969995970ef0a9, 0xd7000bbe0f700696, 0xd8e4e9a22d1e08a6,
+    0xcd727b89b560fe99, 0xf3c9cdf51de3e4d8, 0xe65f5fde859d12e7,
+    0x8ebea10c4ce5d05a, 0x9b283327d49b2665, 0xa593855b7c183c24,
+    0xb0051770e466ca1b, 0x745078feeee9b95e, 0x61c6ead576974f61,
+    0x5f7d5ca9de145520, 0x4aebce82466aa31f, 0x220a30508f1261a2,
+    0x379ca27b176c979d, 0x09271407bfef8ddc, 0x1cb1862c27917be3,
+    0x1d99b82006aa5962, 0x080f2a0b9ed4af5d, 0x36b49c773657b51c,
+    0x23220e5cae294323, 0x4bc3f08e6751819e, 0x5e5562a5ff2f77a1,
+    0x60eed4d957ac6de0, 0x757846f2cfd29bdf, 0xb12d297cc55de89a,
+    0xa4bbbb575d231ea5, 0x9a000d2bf5a004e4, 0x8f969f006ddef2db,
+    0xe77761d2a4a63066, 0xf2e1f3f93cd8c659, 0xcc5a4585945bdc18,
+    0xd9ccd7ae0c252a27, 0xd62835b22e4b2417, 0xc3bea799b635d228,
+    0xfd0511e51eb6c869, 0xe89383ce86c83e56, 0x80727d1c4fb0fceb,
+    0x95e4ef37d7ce0ad4, 0xab5f594b7f4d1095, 0xbec9cb60e733e6aa,
+    0x7a9ca4eeedbc95ef, 0x6f0a36c575c263d0, 0x51b180b9dd417991,
+    0x44271292453f8fae, 0x2cc6ec408c474d13, 0x39507e6b1439bb2c,
+    0x07ebc817bcbaa16d, 0x127d5a3c24c45752, 0x18220c2ff866bd0d,
+    0x0db49e0460184b32, 0x330f2878c89b5173, 0x2699ba5350e5a74c,
+    0x4e784481999d65f1, 0x5beed6aa01e393ce, 0x655560d6a960898f,
+    0x70c3f2fd311e7fb0, 0xb4969d733b910cf5, 0xa1000f58a3effaca,
+    0x9fbbb9240b6ce08b, 0x8a2d2b0f931216b4, 0xe2ccd5dd5a6ad409,
+    0xf75a47f6c2142236, 0xc9e1f18a6a973877, 0xdc7763a1f2e9ce48,
+    0xd39381bdd087c078, 0xc605139648f93647, 0xf8bea5eae07a2c06,
+    0xed2837c17804da39, 0x85c9c913b17c1884, 0x905f5b382902eebb,
+    0xaee4ed448181f4fa, 0xbb727f6f19ff02c5, 0x7f2710e113707180,
+    0x6ab182ca8b0e87bf, 0x540a34b6238d9dfe, 0x419ca69dbbf36bc1,
+    0x297d584f728ba97c, 0x3cebca64eaf55f43, 0x02507c1842764502,
+    0x17c6ee33da08b33d},
+   {0x0000000000000000, 0x2ddda07ff6672378, 0x5bbb40ffecce46f0,
+    0x7666e0801aa96588, 0xb77681ffd99c8de0, 0x9aab21802ffbae98,
+    0xeccdc1003552cb10, 0xc110617fc335e868, 0xfc35acd41c370545,
+    0xd1e80cabea50263d, 0xa78eec2bf0f943b5, 0x8a534c54069e60cd,
+    0x4b432d2bc5ab88a5, 0x669e8d5433ccabdd, 0x10f86dd42965ce55,
+    0x3d25cdabdf02ed2d, 0x6ab3f6839760140f, 0x476e56fc61073777,
+    0x3108b67c7bae52ff, 0x1cd516038dc97187, 0xddc5777c4efc99ef,
+    0xf018d703b89bba97, 0x867e3783a232df1f, 0xaba397fc5455fc67,
+    0x96865a578b57114a, 0xbb5bfa287d303232, 0xcd3d1aa8679957ba,
+    0xe0e0bad791fe74c2, 0x21f0dba852cb9caa, 0x0c2d7bd7a4acbfd2,
+    0x7a4b9b57be05da5a, 0x57963b284862f922, 0xd567ed072ec0281e,
+    0xf8ba4d78d8a70b66, 0x8edcadf8c20e6eee, 0xa3010d8734694d96,
+    0x62116cf8f75ca5fe, 0x4fcccc87013b8686, 0x39aa2c071b92e30e,
+    0x14778c78edf5c076, 0x295241d332f72d5b, 0x048fe1acc4900e23,
+    0x72e9012cde396bab, 0x5f34a153285e48d3, 0x9e24c02ceb6ba0bb,
+    0xb3f960531d0c83c3, 0xc59f80d307a5e64b, 0xe84220acf1c2c533,
+    0xbfd41b84b9a03c11, 0x9209bbfb4fc71f69, 0xe46f5b7b556e7ae1,
+    0xc9b2fb04a3095999, 0x08a29a7b603cb1f1, 0x257f3a04965b9289,
+    0x5319da848cf2f701, 0x7ec47afb7a95d479, 0x43e1b750a5973954,
+    0x6e3c172f53f01a2c, 0x185af7af49597fa4, 0x358757d0bf3e5cdc,
+    0xf49736af7c0bb4b4, 0xd94a96d08a6c97cc, 0xaf2c765090c5f244,
+    0x82f1d62f66a2d13c, 0x38177525f28e4eb9, 0x15cad55a04e96dc1,
+    0x63ac35da1e400849, 0x4e7195a5e8272b31, 0x8f61f4da2b12c359,
+    0xa2bc54a5dd75e021, 0xd4dab425c7dc85a9, 0xf907145a31bba6d1,
+    0xc422d9f1eeb94bfc, 0xe9ff798e18de6884, 0x9f99990e02770d0c,
+    0xb2443971f4102e74, 0x7354580e3725c61c, 0x5e89f871c142e564,
+    0x28ef18f1dbeb80ec, 0x0532b88e2d8ca394, 0x52a483a665ee5ab6,
+    0x7f7923d9938979ce, 0x091fc35989201c46, 0x24c263267f473f3e,
+    0xe5d20259bc72d756, 0xc80fa2264a15f42e, 0xbe6942a650bc91a6,
+    0x93b4e2d9a6dbb2de, 0xae912f7279d95ff3, 0x834c8f0d8fbe7c8b,
+    0xf52a6f8d95171903, 0xd8f7cff263703a7b, 0x19e7ae8da045d213,
+    0x343a0ef25622f16b, 0x425cee724c8b94e3, 0x6f814e0dbaecb79b,
+    0xed709822dc4e66a7, 0xc0ad385d2a2945df, 0xb6cbd8dd30802057,
+    0x9b1678a2c6e7032f, 0x5a0619dd05d2eb47, 0x77dbb9a2f3b5c83f,
+    0x01bd5922e91cadb7, 0x2c60f95d1f7b8ecf, 0x114534f6c07963e2,
+    0x3c989489361e409a, 0x4afe74092cb72512, 0x6723d476dad0066a,
+    0xa633b50919e5ee02, 0x8bee1576ef82cd7a, 0xfd88f5f6f52ba8f2,
+    0xd0555589034c8b8a, 0x87c36ea14b2e72a8, 0xaa1ecedebd4951d0,
+    0xdc782e5ea7e03458, 0xf1a58e2151871720, 0x30b5ef5e92b2ff48,
+    0x1d684f2164d5dc30, 0x6b0eafa17e7cb9b8, 0x46d30fde881b9ac0,
+    0x7bf6c275571977ed, 0x562b620aa17e5495, 0x204d828abbd7311d,
+    0x0d9022f54db01265, 0xcc80438a8e85fa0d, 0xe15de3f578e2d975,
+    0x973b0375624bbcfd, 0xbae6a30a942c9f85, 0x702eea4be51c9d72,
+    0x5df34a34137bbe0a, 0x2b95aab409d2db82, 0x06480acbffb5f8fa,
+    0xc7586bb43c801092, 0xea85cbcbcae733ea, 0x9ce32b4bd04e5662,
+    0xb13e8b342629751a, 0x8c1b469ff92b9837, 0xa1c6e6e00f4cbb4f,
+    0xd7a0066015e5dec7, 0xfa7da61fe382fdbf, 0x3b6dc76020b715d7,
+    0x16b0671fd6d036af, 0x60d6879fcc795327, 0x4d0b27e03a1e705f,
+    0x1a9d1cc8727c897d, 0x3740bcb7841baa05, 0x41265c379eb2cf8d,
+    0x6cfbfc4868d5ecf5, 0xadeb9d37abe0049d, 0x80363d485d8727e5,
+    0xf650ddc8472e426d, 0xdb8d7db7b1496115, 0xe6a8b01c6e4b8c38,
+    0xcb751063982caf40, 0xbd13f0e38285cac8, 0x90ce509c74e2e9b0,
+    0x51de31e3b7d701d8, 0x7c03919c41b022a0, 0x0a65711c5b194728,
+    0x27b8d163ad7e6450, 0xa549074ccbdcb56c, 0x8894a7333dbb9614,
+    0xfef247b32712f39c, 0xd32fe7ccd175d0e4, 0x123f86b31240388c,
+    0x3fe226cce4271bf4, 0x4984c64cfe8e7e7c, 0x6459663308e95d04,
+    0x597cab98d7ebb029, 0x74a10be7218c9351, 0x02c7eb673b25f6d9,
+    0x2f1a4b18cd42d5a1, 0xee0a2a670e773dc9, 0xc3d78a18f8101eb1,
+    0xb5b16a98e2b97b39, 0x986ccae714de5841, 0xcffaf1cf5cbca163,
+    0xe22751b0aadb821b, 0x9441b130b072e793, 0xb99c114f4615c4eb,
+    0x788c703085202c83, 0x5551d04f73470ffb, 0x233730cf69ee6a73,
+    0x0eea90b09f89490b, 0x33cf5d1b408ba426, 0x1e12fd64b6ec875e,
+    0x68741de4ac45e2d6, 0x45a9bd9b5a22c1ae, 0x84b9dce4991729c6,
+    0xa9647c9b6f700abe, 0xdf029c1b75d96f36, 0xf2df3c6483be4c4e,
+    0x48399f6e1792d3cb, 0x65e43f11e1f5f0b3, 0x1382df91fb5c953b,
+    0x3e5f7fee0d3bb643, 0xff4f1e91ce0e5e2b, 0xd292beee38697d53,
+    0xa4f45e6e22c018db, 0x8929fe11d4a73ba3, 0xb40c33ba0ba5d68e,
+    0x99d193c5fdc2f5f6, 0xefb77345e76b907e, 0xc26ad33a110cb306,
+    0x037ab245d2395b6e, 0x2ea7123a245e7816, 0x58c1f2ba3ef71d9e,
+    0x751c52c5c8903ee6, 0x228a69ed80f2c7c4, 0x0f57c9927695e4bc,
+    0x793129126c3c8134, 0x54ec896d9a5ba24c, 0x95fce812596e4a24,
+    0xb821486daf09695c, 0xce47a8edb5a00cd4, 0xe39a089243c72fac,
+    0xdebfc5399cc5c281, 0xf36265466aa2e1f9, 0x850485c6700b8471,
+    0xa8d925b9866ca709, 0x69c944c645594f61, 0x4414e4b9b33e6c19,
+    0x32720439a9970991, 0x1fafa4465ff02ae9, 0x9d5e72693952fbd5,
+    0xb083d216cf35d8ad, 0xc6e53296d59cbd25, 0xeb3892e923fb9e5d,
+    0x2a28f396e0ce7635, 0x07f553e916a9554d, 0x7193b3690c0030c5,
+    0x5c4e1316fa6713bd, 0x616bdebd2565fe90, 0x4cb67ec2d302dde8,
+    0x3ad09e42c9abb860, 0x170d3e3d3fcc9b18, 0xd61d5f42fcf97370,
+    0xfbc0ff3d0a9e5008, 0x8da61fbd10373580, 0xa07bbfc2e65016f8,
+    0xf7ed84eaae32efda, 0xda3024955855cca2, 0xac56c41542fca92a,
+    0x818b646ab49b8a52, 0x409b051577ae623a, 0x6d46a56a81c94142,
+    0x1b2045ea9b6024ca, 0x36fde5956d0707b2, 0x0bd8283eb205ea9f,
+    0x260588414462c9e7, 0x506368c15ecbac6f, 0x7dbec8bea8ac8f17,
+    0xbcaea9c16b99677f, 0x917309be9dfe4407, 0xe715e93e8757218f,
+    0xcac84941713002f7}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0x782367f67fa0dd2d, 0xf046ceecff40bb5b,
+    0x8865a91a80e06676, 0xe08d9cd9ff8176b7, 0x98aefb2f8021ab9a,
+    0x10cb523500c1cdec, 0x68e835c37f6110c1, 0x4505371cd4ac35fc,
+    0x3d2650eaab0ce8d1, 0xb543f9f02bec8ea7, 0xcd609e06544c538a,
+    0xa588abc52b2d434b, 0xddabcc33548d9e66, 0x55ce6529d46df810,
+    0x2ded02dfabcd253d, 0x0f14609783f6b36a, 0x77370761fc566e47,
+    0xff52ae7b7cb60831, 0x8771c98d0316d51c, 0xef99fc4e7c77c5dd,
+    0x97ba9bb803d718f0, 0x1fdf32a283377e86, 0x67fc5554fc97a3ab,
+    0x4a11578b575a8696, 0x3232307d28fa5bbb, 0xba579967a81a3dcd,
+    0xc274fe91d7bae0e0, 0xaa9ccb52a8dbf021, 0xd2bfaca4d77b2d0c,
+    0x5ada05be579b4b7a, 0x22f96248283b9657, 0x1e28c02e07ed67d5,
+    0x660ba7d8784dbaf8, 0xee6e0ec2f8addc8e, 0x964d6934870d01a3,
+    0xfea55cf7f86c1162, 0x86863b0187cccc4f, 0x0ee3921b072caa39,
+    0x76c0f5ed788c7714, 0x5b2df732d3415229, 0x230e90c4ace18f04,
+    0xab6b39de2c01e972, 0xd3485e2853a1345f, 0xbba06beb2cc0249e,
+    0xc3830c1d5360f9b3, 0x4be6a507d3809fc5, 0x33c5c2f1ac2042e8,
+    0x113ca0b9841bd4bf, 0x691fc74ffbbb0992, 0xe17a6e557b5b6fe4,
+    0x995909a304fbb2c9, 0xf1b13c607b9aa208, 0x89925b96043a7f25,
+    0x01f7f28c84da1953, 0x79d4957afb7ac47e, 0x543997a550b7e143,
+    0x2c1af0532f173c6e, 0xa47f5949aff75a18, 0xdc5c3ebfd0578735,
+    0xb4b40b7caf3697f4, 0xcc976c8ad0964ad9, 0x44f2c59050762caf,
+    0x3cd1a2662fd6f182, 0xb94e8ef225751738, 0xc16de9045ad5ca15,
+    0x4908401eda35ac63, 0x312b27e8a595714e, 0x59c3122bdaf4618f,
+    0x21e075dda554bca2, 0xa985dcc725b4dad4, 0xd1a6bb315a1407f9,
+    0xfc4bb9eef1d922c4, 0x8468de188e79ffe9, 0x0c0d77020e99999f,
+    0x742e10f4713944b2, 0x1cc625370e585473, 0x64e542c171f8895e,
+    0xec80ebdbf118ef28, 0x94a38c2d8eb83205, 0xb65aee65a683a452,
+    0xce798993d923797f, 0x461c208959c31f09, 0x3e3f477f2663c224,
+    0x56d772bc5902d2e5, 0x2ef4154a26a20fc8, 0xa691bc50a64269be,
+    0xdeb2dba6d9e2b493, 0xf35fd979722f91ae, 0x8b7cbe8f0d8f4c83,
+    0x031917958d6f2af5, 0x7b3a7063f2cff7d8, 0x13d245a08daee719,
+    0x6bf12256f20e3a34, 0xe3948b4c72ee5c42, 0x9bb7ecba0d4e816f,
+    0xa7664edc229870ed, 0xdf45292a5d38adc0, 0x57208030ddd8cbb6,
+    0x2f03e7c6a278169b, 0x47ebd205dd19065a, 0x3fc8b5f3a2b9db77,
+    0xb7ad1ce92259bd01, 0xcf8e7b1f5df9602c, 0xe26379c0f6344511,
+    0x9a401e368994983c, 0x1225b72c0974fe4a, 0x6a06d0da76d42367,
+    0x02eee51909b533a6, 0x7acd82ef7615ee8b, 0xf2a82bf5f6f588fd,
+    0x8a8b4c03895555d0, 0xa8722e4ba16ec387, 0xd05149bddece1eaa,
+    0x5834e0a75e2e78dc, 0x20178751218ea5f1, 0x48ffb2925eefb530,
+    0x30dcd564214f681d, 0xb8b97c7ea1af0e6b, 0xc09a1b88de0fd346,
+    0xed77195775c2f67b, 0x95547ea10a622b56, 0x1d31d7bb8a824d20,
+    0x6512b04df522900d, 0x0dfa858e8a4380cc, 0x75d9e278f5e35de1,
+    0xfdbc4b6275033b97, 0x859f2c940aa3e6ba, 0x729d1ce54bea2e70,
+    0x0abe7b13344af35d, 0x82dbd209b4aa952b, 0xfaf8b5ffcb0a4806,
+    0x9210803cb46b58c7, 0xea33e7cacbcb85ea, 0x62564ed04b2be39c,
+    0x1a752926348b3eb1, 0x37982bf99f461b8c, 0x4fbb4c0fe0e6c6a1,
+    0xc7dee5156006a0d7, 0xbffd82e31fa67dfa, 0xd715b72060c76d3b,
+    0xaf36d0d61f67b016, 0x275379cc9f87d660, 0x5f701e3ae0270b4d,
+    0x7d897c72c81c9d1a, 0x05aa1b84b7bc4037, 0x8dcfb29e375c2641,
+    0xf5ecd56848fcfb6c, 0x9d04e0ab379debad, 0xe527875d483d3680,
+    0x6d422e47c8dd50f6, 0x156149b1b77d8ddb, 0x388c4b6e1cb0a8e6,
+    0x40af2c98631075cb, 0xc8ca8582e3f013bd, 0xb0e9e2749c50ce90,
+    0xd801d7b7e331de51, 0xa022b0419c91037c, 0x2847195b1c71650a,
+    0x50647ead63d1b827, 0x6cb5dccb4c0749a5, 0x1496bb3d33a79488,
+    0x9cf31227b347f2fe, 0xe4d075d1cce72fd3, 0x8c384012b3863f12,
+    0xf41b27e4cc26e23f, 0x7c7e8efe4cc68449, 0x045de90833665964,
+    0x29b0ebd798ab7c59, 0x51938c21e70ba174, 0xd9f6253b67ebc702,
+    0xa1d542cd184b1a2f, 0xc93d770e672a0aee, 0xb11e10f8188ad7c3,
+    0x397bb9e2986ab1b5, 0x4158de14e7ca6c98, 0x63a1bc5ccff1facf,
+    0x1b82dbaab05127e2, 0x93e772b030b14194, 0xebc415464f119cb9,
+    0x832c208530708c78, 0xfb0f47734fd05155, 0x736aee69cf303723,
+    0x0b49899fb090ea0e, 0x26a48b401b5dcf33, 0x5e87ecb664fd121e,
+    0xd6e245ace41d7468, 0xaec1225a9bbda945, 0xc6291799e4dcb984,
+    0xbe0a706f9b7c64a9, 0x366fd9751b9c02df, 0x4e4cbe83643cdff2,
+    0xcbd392176e9f3948, 0xb3f0f5e1113fe465, 0x3b955cfb91df8213,
+    0x43b63b0dee7f5f3e, 0x2b5e0ece911e4fff, 0x537d6938eebe92d2,
+    0xdb18c0226e5ef4a4, 0xa33ba7d411fe2989, 0x8ed6a50bba330cb4,
+    0xf6f5c2fdc593d199, 0x7e906be74573b7ef, 0x06b30c113ad36ac2,
+    0x6e5b39d245b27a03, 0x16785e243a12a72e, 0x9e1df73ebaf2c158,
+    0xe63e90c8c5521c75, 0xc4c7f280ed698a22, 0xbce4957692c9570f,
+    0x34813c6c12293179, 0x4ca25b9a6d89ec54, 0x244a6e5912e8fc95,
+    0x5c6909af6d4821b8, 0xd40ca0b5eda847ce, 0xac2fc74392089ae3,
+    0x81c2c59c39c5bfde, 0xf9e1a26a466562f3, 0x71840b70c6850485,
+    0x09a76c86b925d9a8, 0x614f5945c644c969, 0x196c3eb3b9e41444,
+    0x910997a939047232, 0xe92af05f46a4af1f, 0xd5fb523969725e9d,
+    0xadd835cf16d283b0, 0x25bd9cd59632e5c6, 0x5d9efb23e99238eb,
+    0x3576cee096f3282a, 0x4d55a916e953f507, 0xc530000c69b39371,
+    0xbd1367fa16134e5c, 0x90fe6525bdde6b61, 0xe8dd02d3c27eb64c,
+    0x60b8abc9429ed03a, 0x189bcc3f3d3e0d17, 0x7073f9fc425f1dd6,
+    0x08509e0a3dffc0fb, 0x80353710bd1fa68d, 0xf81650e6c2bf7ba0,
+    0xdaef32aeea84edf7, 0xa2cc5558952430da, 0x2aa9fc4215c456ac,
+    0x528a9bb46a648b81, 0x3a62ae7715059b40, 0x4241c9816aa5466d,
+    0xca24609bea45201b, 0xb207076d95e5fd36, 0x9fea05b23e28d80b,
+    0xe7c9624441880526, 0x6faccb5ec1686350, 0x178faca8bec8be7d,
+    0x7f67996bc1a9aebc, 0x0744fe9dbe097391, 0x8f2157873ee915e7,
+    0xf70230714149c8ca},
+   {0x0000000000000000, 0x3ff67e982b929615, 0x7eecfd3057242d2b,
+    0x411a83a87cb6bb3e, 0xfcd8fb61ae485a56, 0xc32e85f985dacc43,
+    0x82340651f96c777d, 0xbdc278c9d2fee168, 0xf8b1f7c35c91b4ac,
+    0xc747895b770322b9, 0x865d0af30bb59987, 0xb9ab746b20270f92,
+    0x04690ca2f2d9eefa, 0x3b9f723ad94b78ef, 0x7a85f192a5fdc3d1,
+    0x45738f0a8e6f55c4, 0x757de128928db1cb, 0x4a8b9fb0b91f27de,
+    0x0b911c18c5a99ce0, 0x34676280ee3b0af5, 0x89a51a493cc5eb9d,
+    0xb65364d117577d88, 0xf749e7796be1c6b6, 0xc8bf99e1407350a3,
+    0x8dcc16ebce1c0567, 0xb23a6873e58e9372, 0xf320ebdb9938284c,
+    0xccd69543b2aabe59, 0x7114ed8a60545f31, 0x4ee293124bc6c924,
+    0x0ff810ba3770721a, 0x300e6e221ce2e40f, 0x6fe4ccfe0fb4bb05,
+    0x5012b26624262d10, 0x110831ce5890962e, 0x2efe4f567302003b,
+    0x933c379fa1fce153, 0xacca49078a6e7746, 0xedd0caaff6d8cc78,
+    0xd226b437dd4a5a6d, 0x97553b3d53250fa9, 0xa8a345a578b799bc,
+    0xe9b9c60d04012282, 0xd64fb8952f93b497, 0x6b8dc05cfd6d55ff,
+    0x547bbec4d6ffc3ea, 0x15613d6caa4978d4, 0x2a9743f481dbeec1,
+    0x1a992dd69d390ace, 0x256f534eb6ab9cdb, 0x6475d0e6ca1d27e5,
+    0x5b83ae7ee18fb1f0, 0xe641d6b733715098, 0xd9b7a82f18e3c68d,
+    0x98ad2b8764557db3, 0xa75b551f4fc7eba6, 0xe228da15c1a8be62,
+    0xdddea48dea3a2877, 0x9cc42725968c9349, 0xa33259bdbd1e055c,
+    0x1ef021746fe0e434, 0x21065fec44727221, 0x601cdc4438c4c91f,
+    0x5feaa2dc13565f0a, 0xdec899fd1f68770b, 0xe13ee76534fae11e,
+    0xa02464cd484c5a20, 0x9fd21a5563decc35, 0x2210629cb1202d5d,
+    0x1de61c049ab2bb48, 0x5cfc9face6040076, 0x630ae134cd969663,
+    0x26796e3e43f9c3a7, 0x198f10a6686b55b2, 0x5895930e14ddee8c,
+    0x6763ed963f4f7899, 0xdaa1955fedb199f1, 0xe557ebc7c6230fe4,
+    0xa44d686fba95b4da, 0x9bbb16f7910722cf, 0xabb578d58de5c6c0,
+    0x9443064da67750d5, 0xd55985e5dac1ebeb, 0xeaaffb7df1537dfe,
+    0x576d83b423ad9c96, 0x689bfd2c083f0a83, 0x29817e847489b1bd,
+    0x1677001c5f1b27a8, 0x53048f16d174726c, 0x6cf2f18efae6e479,
+    0x2de8722686505f47, 0x121e0cbeadc2c952, 0xafdc74777f3c283a,
+    0x902a0aef54aebe2f, 0xd130894728180511, 0xeec6f7df038a9304,
+    0xb12c550310dccc0e, 0x8eda2b9b3b4e5a1b, 0xcfc0a83347f8e125,
+    0xf036d6ab6c6a7730, 0x4df4ae62be949658, 0x7202d0fa9506004d,
+    0x33185352e9b0bb73, 0x0cee2dcac2222d66, 0x499da2c04c4d78a2,
+    0x766bdc5867dfeeb7, 0x37715ff01b695589, 0x0887216830fbc39c,
+    0xb54559a1e20522f4, 0x8ab32739c997b4e1, 0xcba9a491b5210fdf,
+    0xf45fda099eb399ca, 0xc451b42b82517dc5, 0xfba7cab3a9c3ebd0,
+    0xbabd491bd57550ee, 0x854b3783fee7c6fb, 0x38894f4a2c192793,
+    0x077f31d2078bb186, 0x4665b27a7b3d0ab8, 0x7993cce250af9cad,
+    0x3ce043e8dec0c969, 0x03163d70f5525f7c, 0x420cbed889e4e442,
+    0x7dfac040a2767257, 0xc038b8897088933f, 0xffcec6115b1a052a,
+    0xbed445b927acbe14, 0x81223b210c3e2801, 0xbc9133fb3fd0ee16,
+    0x83674d6314427803, 0xc27dcecb68f4c33d, 0xfd8bb05343665528,
+    0x4049c89a9198b440, 0x7fbfb602ba0a2255, 0x3ea535aac6bc996b,
+    0x01534b32ed2e0f7e, 0x4420c43863415aba, 0x7bd6baa048d3ccaf,
+    0x3acc390834657791, 0x053a47901ff7e184, 0xb8f83f59cd0900ec,
+    0x870e41c1e69b96f9, 0xc614c2699a2d2dc7, 0xf9e2bcf1b1bfbbd2,
+    0xc9ecd2d3ad5d5fdd, 0xf61aac4b86cfc9c8, 0xb7002fe3fa7972f6,
+    0x88f6517bd1ebe4e3, 0x353429b20315058b, 0x0ac2572a2887939e,
+    0x4bd8d482543128a0, 0x742eaa1a7fa3beb5, 0x315d2510f1cceb71,
+    0x0eab5b88da5e7d64, 0x4fb1d820a6e8c65a, 0x7047a6b88d7a504f,
+    0xcd85de715f84b127, 0xf273a0e974162732, 0xb369234108a09c0c,
+    0x8c9f5dd923320a19, 0xd375ff0530645513, 0xec83819d1bf6c306,
+    0xad99023567407838, 0x926f7cad4cd2ee2d, 0x2fad04649e2c0f45,
+    0x105b7afcb5be9950, 0x5141f954c908226e, 0x6eb787cce29ab47b,
+    0x2bc408c66cf5e1bf, 0x1432765e476777aa, 0x5528f5f63bd1cc94,
+    0x6ade8b6e10435a81, 0xd71cf3a7c2bdbbe9, 0xe8ea8d3fe92f2dfc,
+    0xa9f00e97959996c2, 0x9606700fbe0b00d7, 0xa6081e2da2e9e4d8,
+    0x99fe60b5897b72cd, 0xd8e4e31df5cdc9f3, 0xe7129d85de5f5fe6,
+    0x5ad0e54c0ca1be8e, 0x65269bd42733289b, 0x243c187c5b8593a5,
+    0x1bca66e4701705b0, 0x5eb9e9eefe785074, 0x614f9776d5eac661,
+    0x205514dea95c7d5f, 0x1fa36a4682ceeb4a, 0xa261128f50300a22,
+    0x9d976c177ba29c37, 0xdc8defbf07142709, 0xe37b91272c86b11c,
+    0x6259aa0620b8991d, 0x5dafd49e0b2a0f08, 0x1cb55736779cb436,
+    0x234329ae5c0e2223, 0x9e8151678ef0c34b, 0xa1772fffa562555e,
+    0xe06dac57d9d4ee60, 0xdf9bd2cff2467875, 0x9ae85dc57c292db1,
+    0xa51e235d57bbbba4, 0xe404a0f52b0d009a, 0xdbf2de6d009f968f,
+    0x6630a6a4d26177e7, 0x59c6d83cf9f3e1f2, 0x18dc5b9485455acc,
+    0x272a250caed7ccd9, 0x17244b2eb23528d6, 0x28d235b699a7bec3,
+    0x69c8b61ee51105fd, 0x563ec886ce8393e8, 0xebfcb04f1c7d7280,
+    0xd40aced737efe495, 0x95104d7f4b595fab, 0xaae633e760cbc9be,
+    0xef95bcedeea49c7a, 0xd063c275c5360a6f, 0x917941ddb980b151,
+    0xae8f3f4592122744, 0x134d478c40ecc62c, 0x2cbb39146b7e5039,
+    0x6da1babc17c8eb07, 0x5257c4243c5a7d12, 0x0dbd66f82f0c2218,
+    0x324b1860049eb40d, 0x73519bc878280f33, 0x4ca7e55053ba9926,
+    0xf1659d998144784e, 0xce93e301aad6ee5b, 0x8f8960a9d6605565,
+    0xb07f1e31fdf2c370, 0xf50c913b739d96b4, 0xcafaefa3580f00a1,
+    0x8be06c0b24b9bb9f, 0xb41612930f2b2d8a, 0x09d46a5addd5cce2,
+    0x362214c2f6475af7, 0x7738976a8af1e1c9, 0x48cee9f2a16377dc,
+    0x78c087d0bd8193d3, 0x4736f948961305c6, 0x062c7ae0eaa5bef8,
+    0x39da0478c13728ed, 0x84187cb113c9c985, 0xbbee0229385b5f90,
+    0xfaf4818144ede4ae, 0xc502ff196f7f72bb, 0x80717013e110277f,
+    0xbf870e8bca82b16a, 0xfe9d8d23b6340a54, 0xc16bf3bb9da69c41,
+    0x7ca98b724f587d29, 0x435ff5ea64caeb3c, 0x02457642187c5002,
+    0x3db308da33eec617},
+   {0x0000000000000000, 0x4cc9bb73be4b624d, 0x989277e77c97c49a,
+    0xd45bcc94c2dca6d7, 0xb53be161d28151a7, 0xf9f25a126cca33ea,
+    0x2da99686ae16953d, 0x61602df5105df770, 0xef69cc6c8fac7bdc,
+    0xa3a0771f31e71991, 0x77fbbb8bf33bbf46, 0x3b3200f84d70dd0b,
+    0x5a522d0d5d2d2a7b, 0x169b967ee3664836, 0xc2c05aea21baeee1,
+    0x8e09e1999ff18cac, 0x5bcd967635f62f2a, 0x17042d058bbd4d67,
+    0xc35fe1914961ebb0, 0x8f965ae2f72a89fd, 0xeef67717e7777e8d,
+    0xa23fcc64593c1cc0, 0x766400f09be0ba17, 0x3aadbb8325abd85a,
+    0xb4a45a1aba5a54f6, 0xf86de169041136bb, 0x2c362dfdc6cd906c,
+    0x60ff968e7886f221, 0x019fbb7b68db0551, 0x4d560008d690671c,
+    0x990dcc9c144cc1cb, 0xd5c477efaa07a386, 0xb69a2ded6aec5f54,
+    0xfa53969ed4a73d19, 0x2e085a0a167b9bce, 0x62c1e179a830f983,
+    0x03a1cc8cb86d0ef3, 0x4f6877ff06266cbe, 0x9b33bb6bc4faca69,
+    0xd7fa00187ab1a824, 0x59f3e181e5402488, 0x153a5af25b0b46c5,
+    0xc161966699d7e012, 0x8da82d15279c825f, 0xecc800e037c1752f,
+    0xa001bb93898a1762, 0x745a77074b56b1b5, 0x3893cc74f51dd3f8,
+    0xed57bb9b5f1a707e, 0xa19e00e8e1511233, 0x75c5cc7c238db4e4,
+    0x390c770f9dc6d6a9, 0x586c5afa8d9b21d9, 0x14a5e18933d04394,
+    0xc0fe2d1df10ce543, 0x8c37966e4f47870e, 0x023e77f7d0b60ba2,
+    0x4ef7cc846efd69ef, 0x9aac0010ac21cf38, 0xd665bb63126aad75,
+    0xb705969602375a05, 0xfbcc2de5bc7c3848, 0x2f97e1717ea09e9f,
+    0x635e5a02c0ebfcd2, 0x6c355bdad5d8bfa8, 0x20fce0a96b93dde5,
+    0xf4a72c3da94f7b32, 0xb86e974e1704197f, 0xd90ebabb0759ee0f,
+    0x95c701c8b9128c42, 0x419ccd5c7bce2a95, 0x0d55762fc58548d8,
+    0x835c97b65a74c474, 0xcf952cc5e43fa639, 0x1bcee05126e300ee,
+    0x57075b2298a862a3, 0x366776d788f595d3, 0x7aaecda436bef79e,
+    0xaef50130f4625149, 0xe23cba434a293304, 0x37f8cdace02e9082,
+    0x7b3176df5e65f2cf, 0xaf6aba4b9cb95418, 0xe3a3013822f23655,
+    0x82c32ccd32afc125, 0xce0a97be8ce4a368, 0x1a515b2a4e3805bf,
+    0x5698e059f07367f2, 0xd89101c06f82eb5e, 0x9458bab3d1c98913,
+    0x4003762713152fc4, 0x0ccacd54ad5e4d89, 0x6daae0a1bd03baf9,
+    0x21635bd20348d8b4, 0xf5389746c1947e63, 0xb9f12c357fdf1c2e,
+    0xdaaf7637bf34e0fc, 0x9666cd44017f82b1, 0x423d01d0c3a32466,
+    0x0ef4baa37de8462b, 0x6f9497566db5b15b, 0x235d2c25d3fed316,
+    0xf706e0b1112275c1, 0xbbcf5bc2af69178c, 0x35c6ba5b30989b20,
+    0x790f01288ed3f96d, 0xad54cdbc4c0f5fba, 0xe19d76cff2443df7,
+    0x80fd5b3ae219ca87, 0xcc34e0495c52a8ca, 0x186f2cdd9e8e0e1d,
+    0x54a697ae20c56c50, 0x8162e0418ac2cfd6, 0xcdab5b323489ad9b,
+    0x19f097a6f6550b4c, 0x55392cd5481e6901, 0x3459012058439e71,
+    0x7890ba53e608fc3c, 0xaccb76c724d45aeb, 0xe002cdb49a9f38a6,
+    0x6e0b2c2d056eb40a, 0x22c2975ebb25d647, 0xf6995bca79f97090,
+    0xba50e0b9c7b212dd, 0xdb30cd4cd7efe5ad, 0x97f9763f69a487e0,
+    0x43a2baabab782137, 0x0f6b01d81533437a, 0x5d74b81b801ea7c3,
+    0x11bd03683e55c58e, 0xc5e6cffcfc896359, 0x892f748f42c20114,
+    0xe84f597a529ff664, 0xa486e209ecd49429, 0x70dd2e9d2e0832fe,
+    0x3c1495ee904350b3, 0xb21d74770fb2dc1f, 0xfed4cf04b1f9be52,
+    0x2a8f039073251885, 0x6646b8e3cd6e7ac8, 0x07269516dd338db8,
+    0x4bef2e656378eff5, 0x9fb4e2f1a1a44922, 0xd37d59821fef2b6f,
+    0x06b92e6db5e888e9, 0x4a70951e0ba3eaa4, 0x9e2b598ac97f4c73,
+    0xd2e2e2f977342e3e, 0xb382cf0c6769d94e, 0xff4b747fd922bb03,
+    0x2b10b8eb1bfe1dd4, 0x67d90398a5b57f99, 0xe9d0e2013a44f335,
+    0xa5195972840f9178, 0x714295e646d337af, 0x3d8b2e95f89855e2,
+    0x5ceb0360e8c5a292, 0x1022b813568ec0df, 0xc479748794526608,
+    0x88b0cff42a190445, 0xebee95f6eaf2f897, 0xa7272e8554b99ada,
+    0x737ce21196653c0d, 0x3fb55962282e5e40, 0x5ed574973873a930,
+    0x121ccfe48638cb7d, 0xc647037044e46daa, 0x8a8eb803faaf0fe7,
+    0x0487599a655e834b, 0x484ee2e9db15e106, 0x9c152e7d19c947d1,
+    0xd0dc950ea782259c, 0xb1bcb8fbb7dfd2ec, 0xfd7503880994b0a1,
+    0x292ecf1ccb481676, 0x65e7746f7503743b, 0xb0230380df04d7bd,
+    0xfceab8f3614fb5f0, 0x28b17467a3931327, 0x6478cf141dd8716a,
+    0x0518e2e10d85861a, 0x49d15992b3cee457, 0x9d8a950671124280,
+    0xd1432e75cf5920cd, 0x5f4acfec50a8ac61, 0x1383749feee3ce2c,
+    0xc7d8b80b2c3f68fb, 0x8b11037892740ab6, 0xea712e8d8229fdc6,
+    0xa6b895fe3c629f8b, 0x72e3596afebe395c, 0x3e2ae21940f55b11,
+    0x3141e3c155c6186b, 0x7d8858b2eb8d7a26, 0xa9d394262951dcf1,
+    0xe51a2f55971abebc, 0x847a02a0874749cc, 0xc8b3b9d3390c2b81,
+    0x1ce87547fbd08d56, 0x5021ce34459bef1b, 0xde282fadda6a63b7,
+    0x92e194de642101fa, 0x46ba584aa6fda72d, 0x0a73e33918b6c560,
+    0x6b13cecc08eb3210, 0x27da75bfb6a0505d, 0xf381b92b747cf68a,
+    0xbf480258ca3794c7, 0x6a8c75b760303741, 0x2645cec4de7b550c,
+    0xf21e02501ca7f3db, 0xbed7b923a2ec9196, 0xdfb794d6b2b166e6,
+    0x937e2fa50cfa04ab, 0x4725e331ce26a27c, 0x0bec5842706dc031,
+    0x85e5b9dbef9c4c9d, 0xc92c02a851d72ed0, 0x1d77ce3c930b8807,
+    0x51be754f2d40ea4a, 0x30de58ba3d1d1d3a, 0x7c17e3c983567f77,
+    0xa84c2f5d418ad9a0, 0xe485942effc1bbed, 0x87dbce2c3f2a473f,
+    0xcb12755f81612572, 0x1f49b9cb43bd83a5, 0x538002b8fdf6e1e8,
+    0x32e02f4dedab1698, 0x7e29943e53e074d5, 0xaa7258aa913cd202,
+    0xe6bbe3d92f77b04f, 0x68b20240b0863ce3, 0x247bb9330ecd5eae,
+    0xf02075a7cc11f879, 0xbce9ced4725a9a34, 0xdd89e32162076d44,
+    0x91405852dc4c0f09, 0x451b94c61e90a9de, 0x09d22fb5a0dbcb93,
+    0xdc16585a0adc6815, 0x90dfe329b4970a58, 0x44842fbd764bac8f,
+    0x084d94cec800cec2, 0x692db93bd85d39b2, 0x25e4024866165bff,
+    0xf1bfcedca4cafd28, 0xbd7675af1a819f65, 0x337f9436857013c9,
+    0x7fb62f453b3b7184, 0xabede3d1f9e7d753, 0xe72458a247acb51e,
+    0x8644755757f1426e, 0xca8dce24e9ba2023, 0x1ed602b02b6686f4,
+    0x521fb9c3952de4b9},
+   {0x0000000000000000, 0x3dde21550c0d8ae8, 0xffa24d0533b5cc43,
+    0xc27c6c503fb846ab, 0xfe459b0a666a9987, 0xc39bba5f6a67136f,
+    0x01e7d60f55df55c4, 0x3c39f75a59d2df2c, 0x799538bae77bea9d,
+    0x444b19efeb766075, 0x863775bfd4ce26de, 0xbbe954ead8c3ac36,
+    0x87d0a3b08111731a, 0xba0e82e58d1cf9f2, 0x7872eeb5b2a4bf59,
+    0x45accfe0bea935b1, 0x77347fdbe4580ca9, 0x4aea5e8ee8558641,
+    0x889632ded7edc0ea, 0xb548138bdbe04a02, 0x8971e4d18232952e,
+    0xb4afc5848e3f1fc6, 0x76d3a9d4b187596d, 0x4b0d8881bd8ad385,
+    0x0ea147610323e634, 0x337f66340f2e6cdc, 0xf1030a6430962a77,
+    0xccdd2b313c9ba09f, 0xf0e4dc6b65497fb3, 0xcd3afd3e6944f55b,
+    0x0f46916e56fcb3f0, 0x3298b03b5af13918, 0x6b76f019e21ec0c0,
+    0x56a8d14cee134a28, 0x94d4bd1cd1ab0c83, 0xa90a9c49dda6866b,
+    0x95336b1384745947, 0xa8ed4a468879d3af, 0x6a912616b7c19504,
+    0x574f0743bbcc1fec, 0x12e3c8a305652a5d, 0x2f3de9f60968a0b5,
+    0xed4185a636d0e61e, 0xd09fa4f33add6cf6, 0xeca653a9630fb3da,
+    0xd17872fc6f023932, 0x13041eac50ba7f99, 0x2eda3ff95cb7f571,
+    0x1c428fc20646cc69, 0x219cae970a4b4681, 0xe3e0c2c735f3002a,
+    0xde3ee39239fe8ac2, 0xe20714c8602c55ee, 0xdfd9359d6c21df06,
+    0x1da559cd539999ad, 0x207b78985f941345, 0x65d7b778e13d26f4,
+    0x5809962ded30ac1c, 0x9a75fa7dd288eab7, 0xa7abdb28de85605f,
+    0x9b922c728757bf73, 0xa64c0d278b5a359b, 0x64306177b4e27330,
+    0x59ee4022b8eff9d8, 0x53f2ee9cef925813, 0x6e2ccfc9e39fd2fb,
+    0xac50a399dc279450, 0x918e82ccd02a1eb8, 0xadb7759689f8c194,
+    0x906954c385f54b7c, 0x52153893ba4d0dd7, 0x6fcb19c6b640873f,
+    0x2a67d62608e9b28e, 0x17b9f77304e43866, 0xd5c59b233b5c7ecd,
+    0xe81bba763751f425, 0xd4224d2c6e832b09, 0xe9fc6c79628ea1e1,
+    0x2b8000295d36e74a, 0x165e217c513b6da2, 0x24c691470bca54ba,
+    0x1918b01207c7de52, 0xdb64dc42387f98f9, 0xe6bafd1734721211,
+    0xda830a4d6da0cd3d, 0xe75d2b1861ad47d5, 0x252147485e15017e,
+    0x18ff661d52188b96, 0x5d53a9fdecb1be27, 0x608d88a8e0bc34cf,
+    0xa2f1e4f8df047264, 0x9f2fc5add309f88c, 0xa31632f78adb27a0,
+    0x9ec813a286d6ad48, 0x5cb47ff2b96eebe3, 0x616a5ea7b563610b,
+    0x38841e850d8c98d3, 0x055a3fd00181123b, 0xc72653803e395490,
+    0xfaf872d53234de78, 0xc6c1858f6be60154, 0xfb1fa4da67eb8bbc,
+    0x3963c88a5853cd17, 0x04bde9df545e47ff, 0x4111263feaf7724e,
+    0x7ccf076ae6faf8a6, 0xbeb36b3ad942be0d, 0x836d4a6fd54f34e5,
+    0xbf54bd358c9debc9, 0x828a9c6080906121, 0x40f6f030bf28278a,
+    0x7d28d165b325ad62, 0x4fb0615ee9d4947a, 0x726e400be5d91e92,
+    0xb0122c5bda615839, 0x8dcc0d0ed66cd2d1, 0xb1f5fa548fbe0dfd,
+    0x8c2bdb0183b38715, 0x4e57b751bc0bc1be, 0x73899604b0064b56,
+    0x362559e40eaf7ee7, 0x0bfb78b102a2f40f, 0xc98714e13d1ab2a4,
+    0xf45935b43117384c, 0xc860c2ee68c5e760, 0xf5bee3bb64c86d88,
+    0x37c28feb5b702b23, 0x0a1caebe577da1cb, 0xa6e4dd39df25b126,
+    0x9b3afc6cd3283bce, 0x5946903cec907d65, 0x6498b169e09df78d,
+    0x58a14633b94f28a1, 0x657f6766b542a249, 0xa7030b368afae4e2,
+    0x9add2a6386f76e0a, 0xdf71e583385e5bbb, 0xe2afc4d63453d153,
+    0x20d3a8860beb97f8, 0x1d0d89d307e61d10, 0x21347e895e34c23c,
+    0x1cea5fdc523948d4, 0xde96338c6d810e7f, 0xe34812d9618c8497,
+    0xd1d0a2e23b7dbd8f, 0xec0e83b737703767, 0x2e72efe708c871cc,
+    0x13acceb204c5fb24, 0x2f9539e85d172408, 0x124b18bd511aaee0,
+    0xd03774ed6ea2e84b, 0xede955b862af62a3, 0xa8459a58dc065712,
+    0x959bbb0dd00bddfa, 0x57e7d75defb39b51, 0x6a39f608e3be11b9,
+    0x56000152ba6cce95, 0x6bde2007b661447d, 0xa9a24c5789d902d6,
+    0x947c6d0285d4883e, 0xcd922d203d3b71e6, 0xf04c0c753136fb0e,
+    0x323060250e8ebda5, 0x0fee41700283374d, 0x33d7b62a5b51e861,
+    0x0e09977f575c6289, 0xcc75fb2f68e42422, 0xf1abda7a64e9aeca,
+    0xb407159ada409b7b, 0x89d934cfd64d1193, 0x4ba5589fe9f55738,
+    0x767b79cae5f8ddd0, 0x4a428e90bc2a02fc, 0x779cafc5b0278814,
+    0xb5e0c3958f9fcebf, 0x883ee2c083924457, 0xbaa652fbd9637d4f,
+    0x877873aed56ef7a7, 0x45041ffeead6b10c, 0x78da3eabe6db3be4,
+    0x44e3c9f1bf09e4c8, 0x793de8a4b3046e20, 0xbb4184f48cbc288b,
+    0x869fa5a180b1a263, 0xc3336a413e1897d2, 0xfeed4b1432151d3a,
+    0x3c9127440dad5b91, 0x014f061101a0d179, 0x3d76f14b58720e55,
+    0x00a8d01e547f84bd, 0xc2d4bc4e6bc7c216, 0xff0a9d1b67ca48fe,
+    0xf51633a530b7e935, 0xc8c812f03cba63dd, 0x0ab47ea003022576,
+    0x376a5ff50f0faf9e, 0x0b53a8af56dd70b2, 0x368d89fa5ad0fa5a,
+    0xf4f1e5aa6568bcf1, 0xc92fc4ff69653619, 0x8c830b1fd7cc03a8,
+    0xb15d2a4adbc18940, 0x7321461ae479cfeb, 0x4eff674fe8744503,
+    0x72c69015b1a69a2f, 0x4f18b140bdab10c7, 0x8d64dd108213566c,
+    0xb0bafc458e1edc84, 0x82224c7ed4efe59c, 0xbffc6d2bd8e26f74,
+    0x7d80017be75a29df, 0x405e202eeb57a337, 0x7c67d774b2857c1b,
+    0x41b9f621be88f6f3, 0x83c59a718130b058, 0xbe1bbb248d3d3ab0,
+    0xfbb774c433940f01, 0xc66955913f9985e9, 0x041539c10021c342,
+    0x39cb18940c2c49aa, 0x05f2efce55fe9686, 0x382cce9b59f31c6e,
+    0xfa50a2cb664b5ac5, 0xc78e839e6a46d02d, 0x9e60c3bcd2a929f5,
+    0xa3bee2e9dea4a31d, 0x61c28eb9e11ce5b6, 0x5c1cafeced116f5e,
+    0x602558b6b4c3b072, 0x5dfb79e3b8ce3a9a, 0x9f8715b387767c31,
+    0xa25934e68b7bf6d9, 0xe7f5fb0635d2c368, 0xda2bda5339df4980,
+    0x1857b60306670f2b, 0x258997560a6a85c3, 0x19b0600c53b85aef,
+    0x246e41595fb5d007, 0xe6122d09600d96ac, 0xdbcc0c5c6c001c44,
+    0xe954bc6736f1255c, 0xd48a9d323afcafb4, 0x16f6f1620544e91f,
+    0x2b28d037094963f7, 0x1711276d509bbcdb, 0x2acf06385c963633,
+    0xe8b36a68632e7098, 0xd56d4b3d6f23fa70, 0x90c184ddd18acfc1,
+    0xad1fa588dd874529, 0x6f63c9d8e23f0382, 0x52bde88dee32896a,
+    0x6e841fd7b7e05646, 0x535a3e82bbeddcae, 0x912652d284559a05,
+    0xacf87387885810ed},
+   {0x0000000000000000, 0x3f3636fc76611bb9, 0xfb726257c66deee0,
+    0xc44454abb00cf559, 0x73fbca01a7740453, 0x4ccdfcfdd1151fea,
+    0x8889a8566119eab3, 0xb7bf9eaa1778f10a, 0xe6f695034ee908a6,
+    0xd9c0a3ff3888131f, 0x1d84f7548884e646, 0x22b2c1a8fee5fdff,
+    0x950d5f02e99d0cf5, 0xaa3b69fe9ffc174c, 0x6e7f3d552ff0e215,
+    0x51490ba95991f9ac, 0x49f325a8b77dc9de, 0x76c51354c11cd267,
+    0xb28147ff7110273e, 0x8db7710307713c87, 0x3a08efa91009cd8d,
+    0x053ed9556668d634, 0xc17a8dfed664236d, 0xfe4cbb02a00538d4,
+    0xaf05b0abf994c178, 0x903386578ff5dac1, 0x5477d2fc3ff92f98,
+    0x6b41e40049983421, 0xdcfe7aaa5ee0c52b, 0xe3c84c562881de92,
+    0x278c18fd988d2bcb, 0x18ba2e01eeec3072, 0x17f845ff44544a2f,
+    0x28ce730332355196, 0xec8a27a88239a4cf, 0xd3bc1154f458bf76,
+    0x64038ffee3204e7c, 0x5b35b902954155c5, 0x9f71eda9254da09c,
+    0xa047db55532cbb25, 0xf10ed0fc0abd4289, 0xce38e6007cdc5930,
+    0x0a7cb2abccd0ac69, 0x354a8457bab1b7d0, 0x82f51afdadc946da,
+    0xbdc32c01dba85d63, 0x798778aa6ba4a83a, 0x46b14e561dc5b383,
+    0x5e0b6057f32983f1, 0x613d56ab85489848, 0xa579020035446d11,
+    0x9a4f34fc432576a8, 0x2df0aa56545d87a2, 0x12c69caa223c9c1b,
+    0xd682c80192306942, 0xe9b4fefde45172fb, 0xb8fdf554bdc08b57,
+    0x87cbc3a8cba190ee, 0x438f97037bad65b7, 0x7cb9a1ff0dcc7e0e,
+    0xcb063f551ab48f04, 0xf43009a96cd594bd, 0x30745d02dcd961e4,
+    0x0f426bfeaab87a5d, 0x2ef08bfe89a8945e, 0x11c6bd02ffc98fe7,
+    0xd582e9a94fc57abe, 0xeab4df5539a46107, 0x5d0b41ff2edc900d,
+    0x623d770358bd8bb4, 0xa67923a8e8b17eed, 0x994f15549ed06554,
+    0xc8061efdc7419cf8, 0xf7302801b1208741, 0x33747caa012c7218,
+    0x0c424a56774d69a1, 0xbbfdd4fc603598ab, 0x84cbe20016548312,
+    0x408fb6aba658764b, 0x7fb98057d0396df2, 0x6703ae563ed55d80,
+    0x583598aa48b44639, 0x9c71cc01f8b8b360, 0xa347fafd8ed9a8d9,
+    0x14f8645799a159d3, 0x2bce52abefc0426a, 0xef8a06005fccb733,
+    0xd0bc30fc29adac8a, 0x81f53b55703c5526, 0xbec30da9065d4e9f,
+    0x7a875902b651bbc6, 0x45b16ffec030a07f, 0xf20ef154d7485175,
+    0xcd38c7a8a1294acc, 0x097c93031125bf95, 0x364aa5ff6744a42c,
+    0x3908ce01cdfcde71, 0x063ef8fdbb9dc5c8, 0xc27aac560b913091,
+    0xfd4c9aaa7df02b28, 0x4af304006a88da22, 0x75c532fc1ce9c19b,
+    0xb1816657ace534c2, 0x8eb750abda842f7b, 0xdffe5b028315d6d7,
+    0xe0c86dfef574cd6e, 0x248c395545783837, 0x1bba0fa93319238e,
+    0xac0591032461d284, 0x9333a7ff5200c93d, 0x5777f354e20c3c64,
+    0x6841c5a8946d27dd, 0x70fbeba97a8117af, 0x4fcddd550ce00c16,
+    0x8b8989febcecf94f, 0xb4bfbf02ca8de2f6, 0x030021a8ddf513fc,
+    0x3c361754ab940845, 0xf87243ff1b98fd1c, 0xc74475036df9e6a5,
+    0x960d7eaa34681f09, 0xa93b4856420904b0, 0x6d7f1cfdf205f1e9,
+    0x52492a018464ea50, 0xe5f6b4ab931c1b5a, 0xdac08257e57d00e3,
+    0x1e84d6fc5571f5ba, 0x21b2e0002310ee03, 0x5ce017fd135129bd,
+    0x63d6210165303204, 0xa79275aad53cc75d, 0x98a44356a35ddce4,
+    0x2f1bddfcb4252dee, 0x102deb00c2443657, 0xd469bfab7248c30e,
+    0xeb5f89570429d8b7, 0xba1682fe5db8211b, 0x8520b4022bd93aa2,
+    0x4164e0a99bd5cffb, 0x7e52d655edb4d442, 0xc9ed48fffacc2548,
+    0xf6db7e038cad3ef1, 0x329f2aa83ca1cba8, 0x0da91c544ac0d011,
+    0x15133255a42ce063, 0x2a2504a9d24dfbda, 0xee61500262410e83,
+    0xd15766fe1420153a, 0x66e8f8540358e430, 0x59decea87539ff89,
+    0x9d9a9a03c5350ad0, 0xa2acacffb3541169, 0xf3e5a756eac5e8c5,
+    0xccd391aa9ca4f37c, 0x0897c5012ca80625, 0x37a1f3fd5ac91d9c,
+    0x801e6d574db1ec96, 0xbf285bab3bd0f72f, 0x7b6c0f008bdc0276,
+    0x445a39fcfdbd19cf, 0x4b18520257056392, 0x742e64fe2164782b,
+    0xb06a305591688d72, 0x8f5c06a9e70996cb, 0x38e39803f07167c1,
+    0x07d5aeff86107c78, 0xc391fa54361c8921, 0xfca7cca8407d9298,
+    0xadeec70119ec6b34, 0x92d8f1fd6f8d708d, 0x569ca556df8185d4,
+    0x69aa93aaa9e09e6d, 0xde150d00be986f67, 0xe1233bfcc8f974de,
+    0x25676f5778f58187, 0x1a5159ab0e949a3e, 0x02eb77aae078aa4c,
+    0x3ddd41569619b1f5, 0xf99915fd261544ac, 0xc6af230150745f15,
+    0x7110bdab470cae1f, 0x4e268b57316db5a6, 0x8a62dffc816140ff,
+    0xb554e900f7005b46, 0xe41de2a9ae91a2ea, 0xdb2bd455d8f0b953,
+    0x1f6f80fe68fc4c0a, 0x2059b6021e9d57b3, 0x97e628a809e5a6b9,
+    0xa8d01e547f84bd00, 0x6c944affcf884859, 0x53a27c03b9e953e0,
+    0x72109c039af9bde3, 0x4d26aaffec98a65a, 0x8962fe545c945303,
+    0xb654c8a82af548ba, 0x01eb56023d8db9b0, 0x3edd60fe4beca209,
+    0xfa993455fbe05750, 0xc5af02a98d814ce9, 0x94e60900d410b545,
+    0xabd03ffca271aefc, 0x6f946b57127d5ba5, 0x50a25dab641c401c,
+    0xe71dc3017364b116, 0xd82bf5fd0505aaaf, 0x1c6fa156b5095ff6,
+    0x235997aac368444f, 0x3be3b9ab2d84743d, 0x04d58f575be56f84,
+    0xc091dbfcebe99add, 0xffa7ed009d888164, 0x481873aa8af0706e,
+    0x772e4556fc916bd7, 0xb36a11fd4c9d9e8e, 0x8c5c27013afc8537,
+    0xdd152ca8636d7c9b, 0xe2231a54150c6722, 0x26674effa500927b,
+    0x19517803d36189c2, 0xaeeee6a9c41978c8, 0x91d8d055b2786371,
+    0x559c84fe02749628, 0x6aaab20274158d91, 0x65e8d9fcdeadf7cc,
+    0x5adeef00a8ccec75, 0x9e9abbab18c0192c, 0xa1ac8d576ea10295,
+    0x161313fd79d9f39f, 0x292525010fb8e826, 0xed6171aabfb41d7f,
+    0xd2574756c9d506c6, 0x831e4cff9044ff6a, 0xbc287a03e625e4d3,
+    0x786c2ea85629118a, 0x475a185420480a33, 0xf0e586fe3730fb39,
+    0xcfd3b0024151e080, 0x0b97e4a9f15d15d9, 0x34a1d255873c0e60,
+    0x2c1bfc5469d03e12, 0x132dcaa81fb125ab, 0xd7699e03afbdd0f2,
+    0xe85fa8ffd9dccb4b, 0x5fe03655cea43a41, 0x60d600a9b8c521f8,
+    0xa492540208c9d4a1, 0x9ba462fe7ea8cf18, 0xcaed6957273936b4,
+    0xf5db5fab51582d0d, 0x319f0b00e154d854, 0x0ea93dfc9735c3ed,
+    0xb916a356804d32e7, 0x862095aaf62c295e, 0x4264c1014620dc07,
+    0x7d52f7fd3041c7be},
+   {0x0000000000000000, 0x8c81df2e4dc6ce4d, 0x1803bf5d9a8c9d9b,
+    0x94826073d74a53d6, 0xb51870141fb6e3a5, 0x3999af3a52702de8,
+    0xad1bcf49853a7e3e, 0x219a1067c8fcb073, 0xef2fee8715c31fd9,
+    0x63ae31a95805d194, 0xf72c51da8f4f8242, 0x7bad8ef4c2894c0f,
+    0x5a379e930a75fc7c, 0xd6b641bd47b33231, 0x423421ce90f961e7,
+    0xceb5fee0dd3fafaa, 0x5b41d2a00029e720, 0xd7c00d8e4def296d,
+    0x43426dfd9aa57abb, 0xcfc3b2d3d763b4f6, 0xee59a2b41f9f0485,
+    0x62d87d9a5259cac8, 0xf65a1de98513991e, 0x7adbc2c7c8d55753,
+    0xb46e3c2715eaf8f9, 0x38efe309582c36b4, 0xac6d837a8f666562,
+    0x20ec5c54c2a0ab2f, 0x01764c330a5c1b5c, 0x8df7931d479ad511,
+    0x1975f36e90d086c7, 0x95f42c40dd16488a, 0xb682a4410152ce41,
+    0x3a037b6f4c94000c, 0xae811b1c9bde53da, 0x2200c432d6189d97,
+    0x039ad4551ee42de4, 0x8f1b0b7b5322e3a9, 0x1b996b088468b07f,
+    0x9718b426c9ae7e32, 0x59ad4ac61491d198, 0xd52c95e859571fd5,
+    0x41aef59b8e1d4c03, 0xcd2f2ab5c3db824e, 0xecb53ad20b27323d,
+    0x6034e5fc46e1fc70, 0xf4b6858f91abafa6, 0x78375aa1dc6d61eb,
+    0xedc376e1017b2961, 0x6142a9cf4cbde72c, 0xf5c0c9bc9bf7b4fa,
+    0x79411692d6317ab7, 0x58db06f51ecdcac4, 0xd45ad9db530b0489,
+    0x40d8b9a88441575f, 0xcc596686c9879912, 0x02ec986614b836b8,
+    0x8e6d4748597ef8f5, 0x1aef273b8e34ab23, 0x966ef815c3f2656e,
+    0xb7f4e8720b0ed51d, 0x3b75375c46c81b50, 0xaff7572f91824886,
+    0x23768801dc4486cb, 0x6c05498302a49c83, 0xe08496ad4f6252ce,
+    0x7406f6de98280118, 0xf88729f0d5eecf55, 0xd91d39971d127f26,
+    0x559ce6b950d4b16b, 0xc11e86ca879ee2bd, 0x4d9f59e4ca582cf0,
+    0x832aa7041767835a, 0x0fab782a5aa14d17, 0x9b2918598deb1ec1,
+    0x17a8c777c02dd08c, 0x3632d71008d160ff, 0xbab3083e4517aeb2,
+    0x2e31684d925dfd64, 0xa2b0b763df9b3329, 0x37449b23028d7ba3,
+    0xbbc5440d4f4bb5ee, 0x2f47247e9801e638, 0xa3c6fb50d5c72875,
+    0x825ceb371d3b9806, 0x0edd341950fd564b, 0x9a5f546a87b7059d,
+    0x16de8b44ca71cbd0, 0xd86b75a4174e647a, 0x54eaaa8a5a88aa37,
+    0xc068caf98dc2f9e1, 0x4ce915d7c00437ac, 0x6d7305b008f887df,
+    0xe1f2da9e453e4992, 0x7570baed92741a44, 0xf9f165c3dfb2d409,
+    0xda87edc203f652c2, 0x560632ec4e309c8f, 0xc284529f997acf59,
+    0x4e058db1d4bc0114, 0x6f9f9dd61c40b167, 0xe31e42f851867f2a,
+    0x779c228b86cc2cfc, 0xfb1dfda5cb0ae2b1, 0x35a8034516354d1b,
+    0xb929dc6b5bf38356, 0x2dabbc188cb9d080, 0xa12a6336c17f1ecd,
+    0x80b073510983aebe, 0x0c31ac7f444560f3, 0x98b3cc0c930f3325,
+    0x14321322dec9fd68, 0x81c63f6203dfb5e2, 0x0d47e04c4e197baf,
+    0x99c5803f99532879, 0x15445f11d495e634, 0x34de4f761c695647,
+    0xb85f905851af980a, 0x2cddf02b86e5cbdc, 0xa05c2f05cb230591,
+    0x6ee9d1e5161caa3b, 0xe2680ecb5bda6476, 0x76ea6eb88c9037a0,
+    0xfa6bb196c156f9ed, 0xdbf1a1f109aa499e, 0x57707edf446c87d3,
+    0xc3f21eac9326d405, 0x4f73c182dee01a48, 0x5d149ca92ee7e195,
+    0xd195438763212fd8, 0x451723f4b46b7c0e, 0xc996fcdaf9adb243,
+    0xe80cecbd31510230, 0x648d33937c97cc7d, 0xf00f53e0abdd9fab,
+    0x7c8e8ccee61b51e6, 0xb23b722e3b24fe4c, 0x3ebaad0076e23001,
+    0xaa38cd73a1a863d7, 0x26b9125dec6ead9a, 0x0723023a24921de9,
+    0x8ba2dd146954d3a4, 0x1f20bd67be1e8072, 0x93a16249f3d84e3f,
+    0x06554e092ece06b5, 0x8ad491276308c8f8, 0x1e56f154b4429b2e,
+    0x92d72e7af9845563, 0xb34d3e1d3178e510, 0x3fcce1337cbe2b5d,
+    0xab4e8140abf4788b, 0x27cf5e6ee632b6c6, 0xe97aa08e3b0d196c,
+    0x65fb7fa076cbd721, 0xf1791fd3a18184f7, 0x7df8c0fdec474aba,
+    0x5c62d09a24bbfac9, 0xd0e30fb4697d3484, 0x44616fc7be376752,
+    0xc8e0b0e9f3f1a91f, 0xeb9638e82fb52fd4, 0x6717e7c66273e199,
+    0xf39587b5b539b24f, 0x7f14589bf8ff7c02, 0x5e8e48fc3003cc71,
+    0xd20f97d27dc5023c, 0x468df7a1aa8f51ea, 0xca0c288fe7499fa7,
+    0x04b9d66f3a76300d, 0x8838094177b0fe40, 0x1cba6932a0faad96,
+    0x903bb61ced3c63db, 0xb1a1a67b25c0d3a8, 0x3d20795568061de5,
+    0xa9a21926bf4c4e33, 0x2523c608f28a807e, 0xb0d7ea482f9cc8f4,
+    0x3c563566625a06b9, 0xa8d45515b510556f, 0x24558a3bf8d69b22,
+    0x05cf9a5c302a2b51, 0x894e45727dece51c, 0x1dcc2501aaa6b6ca,
+    0x914dfa2fe7607887, 0x5ff804cf3a5fd72d, 0xd379dbe177991960,
+    0x47fbbb92a0d34ab6, 0xcb7a64bced1584fb, 0xeae074db25e93488,
+    0x6661abf5682ffac5, 0xf2e3cb86bf65a913, 0x7e6214a8f2a3675e,
+    0x3111d52a2c437d16, 0xbd900a046185b35b, 0x29126a77b6cfe08d,
+    0xa593b559fb092ec0, 0x8409a53e33f59eb3, 0x08887a107e3350fe,
+    0x9c0a1a63a9790328, 0x108bc54de4bfcd65, 0xde3e3bad398062cf,
+    0x52bfe4837446ac82, 0xc63d84f0a30cff54, 0x4abc5bdeeeca3119,
+    0x6b264bb92636816a, 0xe7a794976bf04f27, 0x7325f4e4bcba1cf1,
+    0xffa42bcaf17cd2bc, 0x6a50078a2c6a9a36, 0xe6d1d8a461ac547b,
+    0x7253b8d7b6e607ad, 0xfed267f9fb20c9e0, 0xdf48779e33dc7993,
+    0x53c9a8b07e1ab7de, 0xc74bc8c3a950e408, 0x4bca17ede4962a45,
+    0x857fe90d39a985ef, 0x09fe3623746f4ba2, 0x9d7c5650a3251874,
+    0x11fd897eeee3d639, 0x30679919261f664a, 0xbce646376bd9a807,
+    0x28642644bc93fbd1, 0xa4e5f96af155359c, 0x8793716b2d11b357,
+    0x0b12ae4560d77d1a, 0x9f90ce36b79d2ecc, 0x13111118fa5be081,
+    0x328b017f32a750f2, 0xbe0ade517f619ebf, 0x2a88be22a82bcd69,
+    0xa609610ce5ed0324, 0x68bc9fec38d2ac8e, 0xe43d40c2751462c3,
+    0x70bf20b1a25e3115, 0xfc3eff9fef98ff58, 0xdda4eff827644f2b,
+    0x512530d66aa28166, 0xc5a750a5bde8d2b0, 0x49268f8bf02e1cfd,
+    0xdcd2a3cb2d385477, 0x50537ce560fe9a3a, 0xc4d11c96b7b4c9ec,
+    0x4850c3b8fa7207a1, 0x69cad3df328eb7d2, 0xe54b0cf17f48799f,
+    0x71c96c82a8022a49, 0xfd48b3ace5c4e404, 0x33fd4d4c38fb4bae,
+    0xbf7c9262753d85e3, 0x2bfef211a277d635, 0xa77f2d3fefb11878,
+    0x86e53d58274da80b, 0x0a64e2766a8b6646, 0x9ee68205bdc13590,
+    0x12675d2bf007fbdd},
+   {0x0000000000000000, 0x9632389adedd5045, 0x2c657034bdbba18a,
+    0xba5748ae6366f1cf, 0xddd4eec751d89b87, 0x4be6d65d8f05cbc2,
+    0xf1b19ef3ec633a0d, 0x6783a66932be6a48, 0x3fb7d320881fef9d,
+    0xa985ebba56c2bfd8, 0x13d2a31435a44e17, 0x85e09b8eeb791e52,
+    0xe2633de7d9c7741a, 0x7451057d071a245f, 0xce064dd3647cd590,
+    0x58347549baa185d5, 0xfb70a9ee3b9006a9, 0x6d429174e54d56ec,
+    0xd715d9da862ba723, 0x4127e14058f6f766, 0x26a447296a489d2e,
+    0xb0967fb3b495cd6b, 0x0ac1371dd7f33ca4, 0x9cf30f87092e6ce1,
+    0xc4c77aceb38fe934, 0x52f542546d52b971, 0xe8a20afa0e3448be,
+    0x7e903260d0e918fb, 0x19139409e25772b3, 0x8f21ac933c8a22f6,
+    0x3576e43d5fecd339, 0xa344dca78131837c, 0x73ff5c725c8fd5c0,
+    0xe5cd64e882528585, 0x5f9a2c46e134744a, 0xc9a814dc3fe9240f,
+    0xae2bb2b50d574e47, 0x38198a2fd38a1e02, 0x824ec281b0ecefcd,
+    0x147cfa1b6e31bf88, 0x4c488f52d4903a5d, 0xda7ab7c80a4d6a18,
+    0x602dff66692b9bd7, 0xf61fc7fcb7f6cb92, 0x919c61958548a1da,
+    0x07ae590f5b95f19f, 0xbdf911a138f30050, 0x2bcb293be62e5015,
+    0x888ff59c671fd369, 0x1ebdcd06b9c2832c, 0xa4ea85a8daa472e3,
+    0x32d8bd32047922a6, 0x555b1b5b36c748ee, 0xc36923c1e81a18ab,
+    0x793e6b6f8b7ce964, 0xef0c53f555a1b921, 0xb73826bcef003cf4,
+    0x210a1e2631dd6cb1, 0x9b5d568852bb9d7e, 0x0d6f6e128c66cd3b,
+    0x6aecc87bbed8a773, 0xfcdef0e16005f736, 0x4689b84f036306f9,
+    0xd0bb80d5ddbe56bc, 0x63e0b74b93b17313, 0xf5d28fd14d6c2356,
+    0x4f85c77f2e0ad299, 0xd9b7ffe5f0d782dc, 0xbe34598cc269e894,
+    0x280661161cb4b8d1, 0x925129b87fd2491e, 0x04631122a10f195b,
+    0x5c57646b1bae9c8e, 0xca655cf1c573cccb, 0x7032145fa6153d04,
+    0xe6002cc578c86d41, 0x81838aac4a760709, 0x17b1b23694ab574c,
+    0xade6fa98f7cda683, 0x3bd4c2022910f6c6, 0x98901ea5a82175ba,
+    0x0ea2263f76fc25ff, 0xb4f56e91159ad430, 0x22c7560bcb478475,
+    0x4544f062f9f9ee3d, 0xd376c8f82724be78, 0x6921805644424fb7,
+    0xff13b8cc9a9f1ff2, 0xa727cd85203e9a27, 0x3115f51ffee3ca62,
+    0x8b42bdb19d853bad, 0x1d70852b43586be8, 0x7af3234271e601a0,
+    0xecc11bd8af3b51e5, 0x56965376cc5da02a, 0xc0a46bec1280f06f,
+    0x101feb39cf3ea6d3, 0x862dd3a311e3f696, 0x3c7a9b0d72850759,
+    0xaa48a397ac58571c, 0xcdcb05fe9ee63d54, 0x5bf93d64403b6d11,
+    0xe1ae75ca235d9cde, 0x779c4d50fd80cc9b, 0x2fa838194721494e,
+    0xb99a008399fc190b, 0x03cd482dfa9ae8c4, 0x95ff70b72447b881,
+    0xf27cd6de16f9d2c9, 0x644eee44c824828c, 0xde19a6eaab427343,
+    0x482b9e70759f2306, 0xeb6f42d7f4aea07a, 0x7d5d7a4d2a73f03f,
+    0xc70a32e3491501f0, 0x51380a7997c851b5, 0x36bbac10a5763bfd,
+    0xa089948a7bab6bb8, 0x1adedc2418cd9a77, 0x8cece4bec610ca32,
+    0xd4d891f77cb14fe7, 0x42eaa96da26c1fa2, 0xf8bde1c3c10aee6d,
+    0x6e8fd9591fd7be28, 0x090c7f302d69d460, 0x9f3e47aaf3b48425,
+    0x25690f0490d275ea, 0xb35b379e4e0f25af, 0xc6c06f972663e726,
+    0x50f2570df8beb763, 0xeaa51fa39bd846ac, 0x7c972739450516e9,
+    0x1b14815077bb7ca1, 0x8d26b9caa9662ce4, 0x3771f164ca00dd2b,
+    0xa143c9fe14dd8d6e, 0xf977bcb7ae7c08bb, 0x6f45842d70a158fe,
+    0xd512cc8313c7a931, 0x4320f419cd1af974, 0x24a35270ffa4933c,
+    0xb2916aea2179c379, 0x08c62244421f32b6, 0x9ef41ade9cc262f3,
+    0x3db0c6791df3e18f, 0xab82fee3c32eb1ca, 0x11d5b64da0484005,
+    0x87e78ed77e951040, 0xe06428be4c2b7a08, 0x7656102492f62a4d,
+    0xcc01588af190db82, 0x5a3360102f4d8bc7, 0x0207155995ec0e12,
+    0x94352dc34b315e57, 0x2e62656d2857af98, 0xb8505df7f68affdd,
+    0xdfd3fb9ec4349595, 0x49e1c3041ae9c5d0, 0xf3b68baa798f341f,
+    0x6584b330a752645a, 0xb53f33e57aec32e6, 0x230d0b7fa43162a3,
+    0x995a43d1c757936c, 0x0f687b4b198ac329, 0x68ebdd222b34a961,
+    0xfed9e5b8f5e9f924, 0x448ead16968f08eb, 0xd2bc958c485258ae,
+    0x8a88e0c5f2f3dd7b, 0x1cbad85f2c2e8d3e, 0xa6ed90f14f487cf1,
+    0x30dfa86b91952cb4, 0x575c0e02a32b46fc, 0xc16e36987df616b9,
+    0x7b397e361e90e776, 0xed0b46acc04db733, 0x4e4f9a0b417c344f,
+    0xd87da2919fa1640a, 0x622aea3ffcc795c5, 0xf418d2a5221ac580,
+    0x939b74cc10a4afc8, 0x05a94c56ce79ff8d, 0xbffe04f8ad1f0e42,
+    0x29cc3c6273c25e07, 0x71f8492bc963dbd2, 0xe7ca71b117be8b97,
+    0x5d9d391f74d87a58, 0xcbaf0185aa052a1d, 0xac2ca7ec98bb4055,
+    0x3a1e9f7646661010, 0x8049d7d82500e1df, 0x167bef42fbddb19a,
+    0xa520d8dcb5d29435, 0x3312e0466b0fc470, 0x8945a8e8086935bf,
+    0x1f779072d6b465fa, 0x78f4361be40a0fb2, 0xeec60e813ad75ff7,
+    0x5491462f59b1ae38, 0xc2a37eb5876cfe7d, 0x9a970bfc3dcd7ba8,
+    0x0ca53366e3102bed, 0xb6f27bc88076da22, 0x20c043525eab8a67,
+    0x4743e53b6c15e02f, 0xd171dda1b2c8b06a, 0x6b26950fd1ae41a5,
+    0xfd14ad950f7311e0, 0x5e5071328e42929c, 0xc86249a8509fc2d9,
+    0x7235010633f93316, 0xe407399ced246353, 0x83849ff5df9a091b,
+    0x15b6a76f0147595e, 0xafe1efc16221a891, 0x39d3d75bbcfcf8d4,
+    0x61e7a212065d7d01, 0xf7d59a88d8802d44, 0x4d82d226bbe6dc8b,
+    0xdbb0eabc653b8cce, 0xbc334cd55785e686, 0x2a01744f8958b6c3,
+    0x90563ce1ea3e470c, 0x0664047b34e31749, 0xd6df84aee95d41f5,
+    0x40edbc34378011b0, 0xfabaf49a54e6e07f, 0x6c88cc008a3bb03a,
+    0x0b0b6a69b885da72, 0x9d3952f366588a37, 0x276e1a5d053e7bf8,
+    0xb15c22c7dbe32bbd, 0xe968578e6142ae68, 0x7f5a6f14bf9ffe2d,
+    0xc50d27badcf90fe2, 0x533f1f2002245fa7, 0x34bcb949309a35ef,
+    0xa28e81d3ee4765aa, 0x18d9c97d8d219465, 0x8eebf1e753fcc420,
+    0x2daf2d40d2cd475c, 0xbb9d15da0c101719, 0x01ca5d746f76e6d6,
+    0x97f865eeb1abb693, 0xf07bc3878315dcdb, 0x6649fb1d5dc88c9e,
+    0xdc1eb3b33eae7d51, 0x4a2c8b29e0732d14, 0x1218fe605ad2a8c1,
+    0x842ac6fa840ff884, 0x3e7d8e54e769094b, 0xa84fb6ce39b4590e,
+    0xcfcc10a70b0a3346, 0x59fe283dd5d76303, 0xe3a96093b6b192cc,
+    0x759b5809686cc289},
+   {0x0000000000000000, 0x51afe10fa353e63b, 0xa25ec31f46a7cc77,
+    0xf3f12210e5f42a4c, 0x44bd863f8c4e99ef, 0x151267302f1d7fd4,
+    0xe6e34520cae95598, 0xb74ca42f69bab3a3, 0x0d6403d03332ea4d,
+    0x5ccbe2df90610c76, 0xaf3ac0cf7595263a, 0xfe9521c0d6c6c001,
+    0x49d985efbf7c73a2, 0x187664e01c2f9599, 0xeb8746f0f9dbbfd5,
+    0xba28a7ff5a8859ee, 0x1ac806a06764d49b, 0x4b67e7afc43732a0,
+    0xb896c5bf21c318ec, 0xe93924b08290fed7, 0x5e75809feb2a4d74,
+    0x0fda61904879ab4f, 0xfc2b4380ad8d8103, 0xad84a28f0ede6738,
+    0x17ac057054563ed6, 0x4603e47ff705d8ed, 0xb5f2c66f12f1f2a1,
+    0xe45d2760b1a2149a, 0x5311834fd818a739, 0x02be62407b4b4102,
+    0xf14f40509ebf6b4e, 0xa0e0a15f3dec8d75, 0xb18e03efe46770a5,
+    0xe021e2e04734969e, 0x13d0c0f0a2c0bcd2, 0x427f21ff01935ae9,
+    0xf53385d06829e94a, 0xa49c64dfcb7a0f71, 0x576d46cf2e8e253d,
+    0x06c2a7c08dddc306, 0xbcea003fd7559ae8, 0xed45e13074067cd3,
+    0x1eb4c32091f2569f, 0x4f1b222f32a1b0a4, 0xf85786005b1b0307,
+    0xa9f8670ff848e53c, 0x5a09451f1dbccf70, 0x0ba6a410beef294b,
+    0xab46054f8303a43e, 0xfae9e44020504205, 0x0918c650c5a46849,
+    0x58b7275f66f78e72, 0xeffb83700f4d3dd1, 0xbe54627fac1edbea,
+    0x4da5406f49eaf1a6, 0x1c0aa160eab9179d, 0xa622069fb0314e73,
+    0xf78de7901362a848, 0x047cc580f6968204, 0x55d3248f55c5643f,
+    0xe29f80a03c7fd79c, 0xb33061af9f2c31a7, 0x40c143bf7ad81beb,
+    0x116ea2b0d98bfdd0, 0xe7030971e26038d8, 0xb6ace87e4133dee3,
+    0x455dca6ea4c7f4af, 0x14f22b6107941294, 0xa3be8f4e6e2ea137,
+    0xf2116e41cd7d470c, 0x01e04c5128896d40, 0x504fad5e8bda8b7b,
+    0xea670aa1d152d295, 0xbbc8ebae720134ae, 0x4839c9be97f51ee2,
+    0x199628b134a6f8d9, 0xaeda8c9e5d1c4b7a, 0xff756d91fe4fad41,
+    0x0c844f811bbb870d, 0x5d2bae8eb8e86136, 0xfdcb0fd18504ec43,
+    0xac64eede26570a78, 0x5f95cccec3a32034, 0x0e3a2dc160f0c60f,
+    0xb97689ee094a75ac, 0xe8d968e1aa199397, 0x1b284af14fedb9db,
+    0x4a87abfeecbe5fe0, 0xf0af0c01b636060e, 0xa100ed0e1565e035,
+    0x52f1cf1ef091ca79, 0x035e2e1153c22c42, 0xb4128a3e3a789fe1,
+    0xe5bd6b31992b79da, 0x164c49217cdf5396, 0x47e3a82edf8cb5ad,
+    0x568d0a9e0607487d, 0x0722eb91a554ae46, 0xf4d3c98140a0840a,
+    0xa57c288ee3f36231, 0x12308ca18a49d192, 0x439f6dae291a37a9,
+    0xb06e4fbeccee1de5, 0xe1c1aeb16fbdfbde, 0x5be9094e3535a230,
+    0x0a46e8419666440b, 0xf9b7ca5173926e47, 0xa8182b5ed0c1887c,
+    0x1f548f71b97b3bdf, 0x4efb6e7e1a28dde4, 0xbd0a4c6effdcf7a8,
+    0xeca5ad615c8f1193, 0x4c450c3e61639ce6, 0x1deaed31c2307add,
+    0xee1bcf2127c45091, 0xbfb42e2e8497b6aa, 0x08f88a01ed2d0509,
+    0x59576b0e4e7ee332, 0xaaa6491eab8ac97e, 0xfb09a81108d92f45,
+    0x41210fee525176ab, 0x108eeee1f1029090, 0xe37fccf114f6badc,
+    0xb2d02dfeb7a55ce7, 0x059c89d1de1fef44, 0x543368de7d4c097f,
+    0xa7c24ace98b82333, 0xf66dabc13bebc508, 0x4b191c4def6ea822,
+    0x1ab6fd424c3d4e19, 0xe947df52a9c96455, 0xb8e83e5d0a9a826e,
+    0x0fa49a72632031cd, 0x5e0b7b7dc073d7f6, 0xadfa596d2587fdba,
+    0xfc55b86286d41b81, 0x467d1f9ddc5c426f, 0x17d2fe927f0fa454,
+    0xe423dc829afb8e18, 0xb58c3d8d39a86823, 0x02c099a25012db80,
+    0x536f78adf3413dbb, 0xa09e5abd16b517f7, 0xf131bbb2b5e6f1cc,
+    0x51d11aed880a7cb9, 0x007efbe22b599a82, 0xf38fd9f2ceadb0ce,
+    0xa22038fd6dfe56f5, 0x156c9cd20444e556, 0x44c37ddda717036d,
+    0xb7325fcd42e32921, 0xe69dbec2e1b0cf1a, 0x5cb5193dbb3896f4,
+    0x0d1af832186b70cf, 0xfeebda22fd9f5a83, 0xaf443b2d5eccbcb8,
+    0x18089f0237760f1b, 0x49a77e0d9425e920, 0xba565c1d71d1c36c,
+    0xebf9bd12d2822557, 0xfa971fa20b09d887, 0xab38feada85a3ebc,
+    0x58c9dcbd4dae14f0, 0x09663db2eefdf2cb, 0xbe2a999d87474168,
+    0xef8578922414a753, 0x1c745a82c1e08d1f, 0x4ddbbb8d62b36b24,
+    0xf7f31c72383b32ca, 0xa65cfd7d9b68d4f1, 0x55addf6d7e9cfebd,
+    0x04023e62ddcf1886, 0xb34e9a4db475ab25, 0xe2e17b4217264d1e,
+    0x11105952f2d26752, 0x40bfb85d51818169, 0xe05f19026c6d0c1c,
+    0xb1f0f80dcf3eea27, 0x4201da1d2acac06b, 0x13ae3b1289992650,
+    0xa4e29f3de02395f3, 0xf54d7e32437073c8, 0x06bc5c22a6845984,
+    0x5713bd2d05d7bfbf, 0xed3b1ad25f5fe651, 0xbc94fbddfc0c006a,
+    0x4f65d9cd19f82a26, 0x1eca38c2baabcc1d, 0xa9869cedd3117fbe,
+    0xf8297de270429985, 0x0bd85ff295b6b3c9, 0x5a77befd36e555f2,
+    0xac1a153c0d0e90fa, 0xfdb5f433ae5d76c1, 0x0e44d6234ba95c8d,
+    0x5feb372ce8fabab6, 0xe8a7930381400915, 0xb908720c2213ef2e,
+    0x4af9501cc7e7c562, 0x1b56b11364b42359, 0xa17e16ec3e3c7ab7,
+    0xf0d1f7e39d6f9c8c, 0x0320d5f3789bb6c0, 0x528f34fcdbc850fb,
+    0xe5c390d3b272e358, 0xb46c71dc11210563, 0x479d53ccf4d52f2f,
+    0x1632b2c35786c914, 0xb6d2139c6a6a4461, 0xe77df293c939a25a,
+    0x148cd0832ccd8816, 0x4523318c8f9e6e2d, 0xf26f95a3e624dd8e,
+    0xa3c074ac45773bb5, 0x503156bca08311f9, 0x019eb7b303d0f7c2,
+    0xbbb6104c5958ae2c, 0xea19f143fa0b4817, 0x19e8d3531fff625b,
+    0x4847325cbcac8460, 0xff0b9673d51637c3, 0xaea4777c7645d1f8,
+    0x5d55556c93b1fbb4, 0x0cfab46330e21d8f, 0x1d9416d3e969e05f,
+    0x4c3bf7dc4a3a0664, 0xbfcad5ccafce2c28, 0xee6534c30c9dca13,
+    0x592990ec652779b0, 0x088671e3c6749f8b, 0xfb7753f32380b5c7,
+    0xaad8b2fc80d353fc, 0x10f01503da5b0a12, 0x415ff40c7908ec29,
+    0xb2aed61c9cfcc665, 0xe30137133faf205e, 0x544d933c561593fd,
+    0x05e27233f54675c6, 0xf613502310b25f8a, 0xa7bcb12cb3e1b9b1,
+    0x075c10738e0d34c4, 0x56f3f17c2d5ed2ff, 0xa502d36cc8aaf8b3,
+    0xf4ad32636bf91e88, 0x43e1964c0243ad2b, 0x124e7743a1104b10,
+    0xe1bf555344e4615c, 0xb010b45ce7b78767, 0x0a3813a3bd3fde89,
+    0x5b97f2ac1e6c38b2, 0xa866d0bcfb9812fe, 0xf9c931b358cbf4c5,
+    0x4e85959c31714766, 0x1f2a74939222a15d, 0xecdb568377d68b11,
+    0xbd74b78cd4856d2a}};
+
+#endif /* N == 3 */
+#if N == 4
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0x60095b008a9efa44, 0xc012b601153df488,
+    0xa01bed019fa30ecc, 0x12fdc3298575f795, 0x72f498290feb0dd1,
+    0xd2ef75289048031d, 0xb2e62e281ad6f959, 0x25fb86530aebef2a,
+    0x45f2dd538075156e, 0xe5e930521fd61ba2, 0x85e06b529548e1e6,
+    0x3706457a8f9e18bf, 0x570f1e7a0500e2fb, 0xf714f37b9aa3ec37,
+    0x971da87b103d1673, 0x4bf70ca615d7de54, 0x2bfe57a69f492410,
+    0x8be5baa700ea2adc, 0xebece1a78a74d098, 0x590acf8f90a229c1,
+    0x3903948f1a3cd385, 0x9918798e859fdd49, 0xf911228e0f01270d,
+    0x6e0c8af51f3c317e, 0x0e05d1f595a2cb3a, 0xae1e3cf40a01c5f6,
+    0xce1767f4809f3fb2, 0x7cf149dc9a49c6eb, 0x1cf812dc10d73caf,
+    0xbce3ffdd8f743263, 0xdceaa4dd05eac827, 0x97ee194c2bafbca8,
+    0xf7e7424ca13146ec, 0x57fcaf4d3e924820, 0x37f5f44db40cb264,
+    0x8513da65aeda4b3d, 0xe51a81652444b179, 0x45016c64bbe7bfb5,
+    0x25083764317945f1, 0xb2159f1f21445382, 0xd21cc41fabdaa9c6,
+    0x7207291e3479a70a, 0x120e721ebee75d4e, 0xa0e85c36a431a417,
+    0xc0e107362eaf5e53, 0x60faea37b10c509f, 0x00f3b1373b92aadb,
+    0xdc1915ea3e7862fc, 0xbc104eeab4e698b8, 0x1c0ba3eb2b459674,
+    0x7c02f8eba1db6c30, 0xcee4d6c3bb0d9569, 0xaeed8dc331936f2d,
+    0x0ef660c2ae3061e1, 0x6eff3bc224ae9ba5, 0xf9e293b934938dd6,
+    0x99ebc8b9be0d7792, 0x39f025b821ae795e, 0x59f97eb8ab30831a,
+    0xeb1f5090b1e67a43, 0x8b160b903b788007, 0x2b0de691a4db8ecb,
+    0x4b04bd912e45748f, 0xbd049db3f85167d5, 0xdd0dc6b372cf9d91,
+    0x7d162bb2ed6c935d, 0x1d1f70b267f26919, 0xaff95e9a7d249040,
+    0xcff0059af7ba6a04, 0x6febe89b681964c8, 0x0fe2b39be2879e8c,
+    0x98ff1be0f2ba88ff, 0xf8f640e0782472bb, 0x58edade1e7877c77,
+    0x38e4f6e16d198633, 0x8a02d8c977cf7f6a, 0xea0b83c9fd51852e,
+    0x4a106ec862f28be2, 0x2a1935c8e86c71a6, 0xf6f39115ed86b981,
+    0x96faca15671843c5, 0x36e12714f8bb4d09, 0x56e87c147225b74d,
+    0xe40e523c68f34e14, 0x8407093ce26db450, 0x241ce43d7dceba9c,
+    0x4415bf3df75040d8, 0xd3081746e76d56ab, 0xb3014c466df3acef,
+    0x131aa147f250a223, 0x7313fa4778ce5867, 0xc1f5d46f6218a13e,
+    0xa1fc8f6fe8865b7a, 0x01e7626e772555b6, 0x61ee396efdbbaff2,
+    0x2aea84ffd3fedb7d, 0x4ae3dfff59602139, 0xeaf832fec6c32ff5,
+    0x8af169fe4c5dd5b1, 0x381747d6568b2ce8, 0x581e1cd6dc15d6ac,
+    0xf805f1d743b6d860, 0x980caad7c9282224, 0x0f1102acd9153457,
+    0x6f1859ac538bce13, 0xcf03b4adcc28c0df, 0xaf0aefad46b63a9b,
+    0x1decc1855c60c3c2, 0x7de59a85d6fe3986, 0xddfe7784495d374a,
+    0xbdf72c84c3c3cd0e, 0x611d8859c6290529, 0x0114d3594cb7ff6d,
+    0xa10f3e58d314f1a1, 0xc1066558598a0be5, 0x73e04b70435cf2bc,
+    0x13e91070c9c208f8, 0xb3f2fd7156610634, 0xd3fba671dcfffc70,
+    0x44e60e0accc2ea03, 0x24ef550a465c1047, 0x84f4b80bd9ff1e8b,
+    0xe4fde30b5361e4cf, 0x561bcd2349b71d96, 0x36129623c329e7d2,
+    0x96097b225c8ae91e, 0xf6002022d614135a, 0xe8d1944c5facd12f,
+    0x88d8cf4cd5322b6b, 0x28c3224d4a9125a7, 0x48ca794dc00fdfe3,
+    0xfa2c5765dad926ba, 0x9a250c655047dcfe, 0x3a3ee164cfe4d232,
+    0x5a37ba64457a2876, 0xcd2a121f55473e05, 0xad23491fdfd9c441,
+    0x0d38a41e407aca8d, 0x6d31ff1ecae430c9, 0xdfd7d136d032c990,
+    0xbfde8a365aac33d4, 0x1fc56737c50f3d18, 0x7fcc3c374f91c75c,
+    0xa32698ea4a7b0f7b, 0xc32fc3eac0e5f53f, 0x63342eeb5f46fbf3,
+    0x033d75ebd5d801b7, 0xb1db5bc3cf0ef8ee, 0xd1d200c3459002aa,
+    0x71c9edc2da330c66, 0x11c0b6c250adf622, 0x86dd1eb94090e051,
+    0xe6d445b9ca0e1a15, 0x46cfa8b855ad14d9, 0x26c6f3b8df33ee9d,
+    0x9420dd90c5e517c4, 0xf42986904f7bed80, 0x54326b91d0d8e34c,
+    0x343b30915a461908, 0x7f3f8d0074036d87, 0x1f36d600fe9d97c3,
+    0xbf2d3b01613e990f, 0xdf246001eba0634b, 0x6dc24e29f1769a12,
+    0x0dcb15297be86056, 0xadd0f828e44b6e9a, 0xcdd9a3286ed594de,
+    0x5ac40b537ee882ad, 0x3acd5053f47678e9, 0x9ad6bd526bd57625,
+    0xfadfe652e14b8c61, 0x4839c87afb9d7538, 0x2830937a71038f7c,
+    0x882b7e7beea081b0, 0xe822257b643e7bf4, 0x34c881a661d4b3d3,
+    0x54c1daa6eb4a4997, 0xf4da37a774e9475b, 0x94d36ca7fe77bd1f,
+    0x2635428fe4a14446, 0x463c198f6e3fbe02, 0xe627f48ef19cb0ce,
+    0x862eaf8e7b024a8a, 0x113307f56b3f5cf9, 0x713a5cf5e1a1a6bd,
+    0xd121b1f47e02a871, 0xb128eaf4f49c5235, 0x03cec4dcee4aab6c,
+    0x63c79fdc64d45128, 0xc3dc72ddfb775fe4, 0xa3d529dd71e9a5a0,
+    0x55d509ffa7fdb6fa, 0x35dc52ff2d634cbe, 0x95c7bffeb2c04272,
+    0xf5cee4fe385eb836, 0x4728cad62288416f, 0x272191d6a816bb2b,
+    0x873a7cd737b5b5e7, 0xe73327d7bd2b4fa3, 0x702e8facad1659d0,
+    0x1027d4ac2788a394, 0xb03c39adb82bad58, 0xd03562ad32b5571c,
+    0x62d34c852863ae45, 0x02da1785a2fd5401, 0xa2c1fa843d5e5acd,
+    0xc2c8a184b7c0a089, 0x1e220559b22a68ae, 0x7e2b5e5938b492ea,
+    0xde30b358a7179c26, 0xbe39e8582d896662, 0x0cdfc670375f9f3b,
+    0x6cd69d70bdc1657f, 0xcccd707122626bb3, 0xacc42b71a8fc91f7,
+    0x3bd9830ab8c18784, 0x5bd0d80a325f7dc0, 0xfbcb350badfc730c,
+    0x9bc26e0b27628948, 0x292440233db47011, 0x492d1b23b72a8a55,
+    0xe936f62228898499, 0x893fad22a2177edd, 0xc23b10b38c520a52,
+    0xa2324bb306ccf016, 0x0229a6b2996ffeda, 0x6220fdb213f1049e,
+    0xd0c6d39a0927fdc7, 0xb0cf889a83b90783, 0x10d4659b1c1a094f,
+    0x70dd3e9b9684f30b, 0xe7c096e086b9e578, 0x87c9cde00c271f3c,
+    0x27d220e1938411f0, 0x47db7be1191aebb4, 0xf53d55c903cc12ed,
+    0x95340ec98952e8a9, 0x352fe3c816f1e665, 0x5526b8c89c6f1c21,
+    0x89cc1c159985d406, 0xe9c54715131b2e42, 0x49deaa148cb8208e,
+    0x29d7f1140626daca, 0x9b31df3c1cf02393, 0xfb38843c966ed9d7,
+    0x5b23693d09cdd71b, 0x3b2a323d83532d5f, 0xac379a46936e3b2c,
+    0xcc3ec14619f0c168, 0x6c252c478653cfa4, 0x0c2c77470ccd35e0,
+    0xbeca596f161bccb9, 0xdec3026f9c8536fd, 0x7ed8ef6e03263831,
+    0x1ed1b46e89b8c275},
+   {0x0000000000000000, 0x437b87b31057bcdb, 0x86f70f6620af79b6,
+    0xc58c88d530f8c56d, 0x9f36b1e7ee50ede9, 0xdc4d3654fe075132,
+    0x19c1be81ceff945f, 0x5aba3932dea82884, 0xacb5cce473afc557,
+    0xefce4b5763f8798c, 0x2a42c3825300bce1, 0x693944314357003a,
+    0x33837d039dff28be, 0x70f8fab08da89465, 0xb5747265bd505108,
+    0xf60ff5d6ad07edd3, 0xcbb336e34851942b, 0x88c8b150580628f0,
+    0x4d44398568feed9d, 0x0e3fbe3678a95146, 0x54858704a60179c2,
+    0x17fe00b7b656c519, 0xd272886286ae0074, 0x91090fd196f9bcaf,
+    0x6706fa073bfe517c, 0x247d7db42ba9eda7, 0xe1f1f5611b5128ca,
+    0xa28a72d20b069411, 0xf8304be0d5aebc95, 0xbb4bcc53c5f9004e,
+    0x7ec74486f501c523, 0x3dbcc335e55679f8, 0x05bec2ed3fad36d3,
+    0x46c5455e2ffa8a08, 0x8349cd8b1f024f65, 0xc0324a380f55f3be,
+    0x9a88730ad1fddb3a, 0xd9f3f4b9c1aa67e1, 0x1c7f7c6cf152a28c,
+    0x5f04fbdfe1051e57, 0xa90b0e094c02f384, 0xea7089ba5c554f5f,
+    0x2ffc016f6cad8a32, 0x6c8786dc7cfa36e9, 0x363dbfeea2521e6d,
+    0x7546385db205a2b6, 0xb0cab08882fd67db, 0xf3b1373b92aadb00,
+    0xce0df40e77fca2f8, 0x8d7673bd67ab1e23, 0x48fafb685753db4e,
+    0x0b817cdb47046795, 0x513b45e999ac4f11, 0x1240c25a89fbf3ca,
+    0xd7cc4a8fb90336a7, 0x94b7cd3ca9548a7c, 0x62b838ea045367af,
+    0x21c3bf591404db74, 0xe44f378c24fc1e19, 0xa734b03f34aba2c2,
+    0xfd8e890dea038a46, 0xbef50ebefa54369d, 0x7b79866bcaacf3f0,
+    0x380201d8dafb4f2b, 0x0b7d85da7f5a6da6, 0x480602696f0dd17d,
+    0x8d8a8abc5ff51410, 0xcef10d0f4fa2a8cb, 0x944b343d910a804f,
+    0xd730b38e815d3c94, 0x12bc3b5bb1a5f9f9, 0x51c7bce8a1f24522,
+    0xa7c8493e0cf5a8f1, 0xe4b3ce8d1ca2142a, 0x213f46582c5ad147,
+    0x6244c1eb3c0d6d9c, 0x38fef8d9e2a54518, 0x7b857f6af2f2f9c3,
+    0xbe09f7bfc20a3cae, 0xfd72700cd25d8075, 0xc0ceb339370bf98d,
+    0x83b5348a275c4556, 0x4639bc5f17a4803b, 0x05423bec07f33ce0,
+    0x5ff802ded95b1464, 0x1c83856dc90ca8bf, 0xd90f0db8f9f46dd2,
+    0x9a748a0be9a3d109, 0x6c7b7fdd44a43cda, 0x2f00f86e54f38001,
+    0xea8c70bb640b456c, 0xa9f7f708745cf9b7, 0xf34dce3aaaf4d133,
+    0xb0364989baa36de8, 0x75bac15c8a5ba885, 0x36c146ef9a0c145e,
+    0x0ec3473740f75b75, 0x4db8c08450a0e7ae, 0x88344851605822c3,
+    0xcb4fcfe2700f9e18, 0x91f5f6d0aea7b69c, 0xd28e7163bef00a47,
+    0x1702f9b68e08cf2a, 0x54797e059e5f73f1, 0xa2768bd333589e22,
+    0xe10d0c60230f22f9, 0x248184b513f7e794, 0x67fa030603a05b4f,
+    0x3d403a34dd0873cb, 0x7e3bbd87cd5fcf10, 0xbbb73552fda70a7d,
+    0xf8ccb2e1edf0b6a6, 0xc57071d408a6cf5e, 0x860bf66718f17385,
+    0x43877eb22809b6e8, 0x00fcf901385e0a33, 0x5a46c033e6f622b7,
+    0x193d4780f6a19e6c, 0xdcb1cf55c6595b01, 0x9fca48e6d60ee7da,
+    0x69c5bd307b090a09, 0x2abe3a836b5eb6d2, 0xef32b2565ba673bf,
+    0xac4935e54bf1cf64, 0xf6f30cd79559e7e0, 0xb5888b64850e5b3b,
+    0x700403b1b5f69e56, 0x337f8402a5a1228d, 0x16fb0bb4feb4db4c,
+    0x55808c07eee36797, 0x900c04d2de1ba2fa, 0xd3778361ce4c1e21,
+    0x89cdba5310e436a5, 0xcab63de000b38a7e, 0x0f3ab535304b4f13,
+    0x4c413286201cf3c8, 0xba4ec7508d1b1e1b, 0xf93540e39d4ca2c0,
+    0x3cb9c836adb467ad, 0x7fc24f85bde3db76, 0x257876b7634bf3f2,
+    0x6603f104731c4f29, 0xa38f79d143e48a44, 0xe0f4fe6253b3369f,
+    0xdd483d57b6e54f67, 0x9e33bae4a6b2f3bc, 0x5bbf3231964a36d1,
+    0x18c4b582861d8a0a, 0x427e8cb058b5a28e, 0x01050b0348e21e55,
+    0xc48983d6781adb38, 0x87f20465684d67e3, 0x71fdf1b3c54a8a30,
+    0x32867600d51d36eb, 0xf70afed5e5e5f386, 0xb4717966f5b24f5d,
+    0xeecb40542b1a67d9, 0xadb0c7e73b4ddb02, 0x683c4f320bb51e6f,
+    0x2b47c8811be2a2b4, 0x1345c959c119ed9f, 0x503e4eead14e5144,
+    0x95b2c63fe1b69429, 0xd6c9418cf1e128f2, 0x8c7378be2f490076,
+    0xcf08ff0d3f1ebcad, 0x0a8477d80fe679c0, 0x49fff06b1fb1c51b,
+    0xbff005bdb2b628c8, 0xfc8b820ea2e19413, 0x39070adb9219517e,
+    0x7a7c8d68824eeda5, 0x20c6b45a5ce6c521, 0x63bd33e94cb179fa,
+    0xa631bb3c7c49bc97, 0xe54a3c8f6c1e004c, 0xd8f6ffba894879b4,
+    0x9b8d7809991fc56f, 0x5e01f0dca9e70002, 0x1d7a776fb9b0bcd9,
+    0x47c04e5d6718945d, 0x04bbc9ee774f2886, 0xc137413b47b7edeb,
+    0x824cc68857e05130, 0x7443335efae7bce3, 0x3738b4edeab00038,
+    0xf2b43c38da48c555, 0xb1cfbb8bca1f798e, 0xeb7582b914b7510a,
+    0xa80e050a04e0edd1, 0x6d828ddf341828bc, 0x2ef90a6c244f9467,
+    0x1d868e6e81eeb6ea, 0x5efd09dd91b90a31, 0x9b718108a141cf5c,
+    0xd80a06bbb1167387, 0x82b03f896fbe5b03, 0xc1cbb83a7fe9e7d8,
+    0x044730ef4f1122b5, 0x473cb75c5f469e6e, 0xb133428af24173bd,
+    0xf248c539e216cf66, 0x37c44decd2ee0a0b, 0x74bfca5fc2b9b6d0,
+    0x2e05f36d1c119e54, 0x6d7e74de0c46228f, 0xa8f2fc0b3cbee7e2,
+    0xeb897bb82ce95b39, 0xd635b88dc9bf22c1, 0x954e3f3ed9e89e1a,
+    0x50c2b7ebe9105b77, 0x13b93058f947e7ac, 0x4903096a27efcf28,
+    0x0a788ed937b873f3, 0xcff4060c0740b69e, 0x8c8f81bf17170a45,
+    0x7a807469ba10e796, 0x39fbf3daaa475b4d, 0xfc777b0f9abf9e20,
+    0xbf0cfcbc8ae822fb, 0xe5b6c58e54400a7f, 0xa6cd423d4417b6a4,
+    0x6341cae874ef73c9, 0x203a4d5b64b8cf12, 0x18384c83be438039,
+    0x5b43cb30ae143ce2, 0x9ecf43e59eecf98f, 0xddb4c4568ebb4554,
+    0x870efd6450136dd0, 0xc4757ad74044d10b, 0x01f9f20270bc1466,
+    0x428275b160eba8bd, 0xb48d8067cdec456e, 0xf7f607d4ddbbf9b5,
+    0x327a8f01ed433cd8, 0x710108b2fd148003, 0x2bbb318023bca887,
+    0x68c0b63333eb145c, 0xad4c3ee60313d131, 0xee37b95513446dea,
+    0xd38b7a60f6121412, 0x90f0fdd3e645a8c9, 0x557c7506d6bd6da4,
+    0x1607f2b5c6ead17f, 0x4cbdcb871842f9fb, 0x0fc64c3408154520,
+    0xca4ac4e138ed804d, 0x8931435228ba3c96, 0x7f3eb68485bdd145,
+    0x3c45313795ea6d9e, 0xf9c9b9e2a512a8f3, 0xbab23e51b5451428,
+    0xe00807636bed3cac, 0xa37380d07bba8077, 0x66ff08054b42451a,
+    0x25848fb65b15f9c1},
+   {0x0000000000000000, 0x2df61769fd69b698, 0x5bec2ed3fad36d30,
+    0x761a39ba07badba8, 0xb7d85da7f5a6da60, 0x9a2e4ace08cf6cf8,
+    0xec3473740f75b750, 0xc1c2641df21c01c8, 0xfd6814644443aa45,
+    0xd09e030db92a1cdd, 0xa6843ab7be90c775, 0x8b722dde43f971ed,
+    0x4ab049c3b1e57025, 0x67465eaa4c8cc6bd, 0x115c67104b361d15,
+    0x3caa7079b65fab8d, 0x680887e327894a0f, 0x45fe908adae0fc97,
+    0x33e4a930dd5a273f, 0x1e12be59203391a7, 0xdfd0da44d22f906f,
+    0xf226cd2d2f4626f7, 0x843cf49728fcfd5f, 0xa9cae3fed5954bc7,
+    0x9560938763cae04a, 0xb89684ee9ea356d2, 0xce8cbd5499198d7a,
+    0xe37aaa3d64703be2, 0x22b8ce20966c3a2a, 0x0f4ed9496b058cb2,
+    0x7954e0f36cbf571a, 0x54a2f79a91d6e182, 0xd0110fc64f12941e,
+    0xfde718afb27b2286, 0x8bfd2115b5c1f92e, 0xa60b367c48a84fb6,
+    0x67c95261bab44e7e, 0x4a3f450847ddf8e6, 0x3c257cb24067234e,
+    0x11d36bdbbd0e95d6, 0x2d791ba20b513e5b, 0x008f0ccbf63888c3,
+    0x76953571f182536b, 0x5b6322180cebe5f3, 0x9aa14605fef7e43b,
+    0xb757516c039e52a3, 0xc14d68d60424890b, 0xecbb7fbff94d3f93,
+    0xb8198825689bde11, 0x95ef9f4c95f26889, 0xe3f5a6f69248b321,
+    0xce03b19f6f2105b9, 0x0fc1d5829d3d0471, 0x2237c2eb6054b2e9,
+    0x542dfb5167ee6941, 0x79dbec389a87dfd9, 0x45719c412cd87454,
+    0x68878b28d1b1c2cc, 0x1e9db292d60b1964, 0x336ba5fb2b62affc,
+    0xf2a9c1e6d97eae34, 0xdf5fd68f241718ac, 0xa945ef3523adc304,
+    0x84b3f85cdec4759c, 0x32fab0a7312b36b9, 0x1f0ca7cecc428021,
+    0x69169e74cbf85b89, 0x44e0891d3691ed11, 0x8522ed00c48decd9,
+    0xa8d4fa6939e45a41, 0xdecec3d33e5e81e9, 0xf338d4bac3373771,
+    0xcf92a4c375689cfc, 0xe264b3aa88012a64, 0x947e8a108fbbf1cc,
+    0xb9889d7972d24754, 0x784af96480ce469c, 0x55bcee0d7da7f004,
+    0x23a6d7b77a1d2bac, 0x0e50c0de87749d34, 0x5af2374416a27cb6,
+    0x7704202debcbca2e, 0x011e1997ec711186, 0x2ce80efe1118a71e,
+    0xed2a6ae3e304a6d6, 0xc0dc7d8a1e6d104e, 0xb6c6443019d7cbe6,
+    0x9b305359e4be7d7e, 0xa79a232052e1d6f3, 0x8a6c3449af88606b,
+    0xfc760df3a832bbc3, 0xd1801a9a555b0d5b, 0x10427e87a7470c93,
+    0x3db469ee5a2eba0b, 0x4bae50545d9461a3, 0x6658473da0fdd73b,
+    0xe2ebbf617e39a2a7, 0xcf1da8088350143f, 0xb90791b284eacf97,
+    0x94f186db7983790f, 0x5533e2c68b9f78c7, 0x78c5f5af76f6ce5f,
+    0x0edfcc15714c15f7, 0x2329db7c8c25a36f, 0x1f83ab053a7a08e2,
+    0x3275bc6cc713be7a, 0x446f85d6c0a965d2, 0x699992bf3dc0d34a,
+    0xa85bf6a2cfdcd282, 0x85ade1cb32b5641a, 0xf3b7d871350fbfb2,
+    0xde41cf18c866092a, 0x8ae3388259b0e8a8, 0xa7152feba4d95e30,
+    0xd10f1651a3638598, 0xfcf901385e0a3300, 0x3d3b6525ac1632c8,
+    0x10cd724c517f8450, 0x66d74bf656c55ff8, 0x4b215c9fabace960,
+    0x778b2ce61df342ed, 0x5a7d3b8fe09af475, 0x2c670235e7202fdd,
+    0x0191155c1a499945, 0xc0537141e855988d, 0xeda56628153c2e15,
+    0x9bbf5f921286f5bd, 0xb64948fbefef4325, 0x65f5614e62566d72,
+    0x480376279f3fdbea, 0x3e194f9d98850042, 0x13ef58f465ecb6da,
+    0xd22d3ce997f0b712, 0xffdb2b806a99018a, 0x89c1123a6d23da22,
+    0xa4370553904a6cba, 0x989d752a2615c737, 0xb56b6243db7c71af,
+    0xc3715bf9dcc6aa07, 0xee874c9021af1c9f, 0x2f45288dd3b31d57,
+    0x02b33fe42edaabcf, 0x74a9065e29607067, 0x595f1137d409c6ff,
+    0x0dfde6ad45df277d, 0x200bf1c4b8b691e5, 0x5611c87ebf0c4a4d,
+    0x7be7df174265fcd5, 0xba25bb0ab079fd1d, 0x97d3ac634d104b85,
+    0xe1c995d94aaa902d, 0xcc3f82b0b7c326b5, 0xf095f2c9019c8d38,
+    0xdd63e5a0fcf53ba0, 0xab79dc1afb4fe008, 0x868fcb7306265690,
+    0x474daf6ef43a5758, 0x6abbb8070953e1c0, 0x1ca181bd0ee93a68,
+    0x315796d4f3808cf0, 0xb5e46e882d44f96c, 0x981279e1d02d4ff4,
+    0xee08405bd797945c, 0xc3fe57322afe22c4, 0x023c332fd8e2230c,
+    0x2fca2446258b9594, 0x59d01dfc22314e3c, 0x74260a95df58f8a4,
+    0x488c7aec69075329, 0x657a6d85946ee5b1, 0x1360543f93d43e19,
+    0x3e9643566ebd8881, 0xff54274b9ca18949, 0xd2a2302261c83fd1,
+    0xa4b809986672e479, 0x894e1ef19b1b52e1, 0xddece96b0acdb363,
+    0xf01afe02f7a405fb, 0x8600c7b8f01ede53, 0xabf6d0d10d7768cb,
+    0x6a34b4ccff6b6903, 0x47c2a3a50202df9b, 0x31d89a1f05b80433,
+    0x1c2e8d76f8d1b2ab, 0x2084fd0f4e8e1926, 0x0d72ea66b3e7afbe,
+    0x7b68d3dcb45d7416, 0x569ec4b54934c28e, 0x975ca0a8bb28c346,
+    0xbaaab7c1464175de, 0xccb08e7b41fbae76, 0xe1469912bc9218ee,
+    0x570fd1e9537d5bcb, 0x7af9c680ae14ed53, 0x0ce3ff3aa9ae36fb,
+    0x2115e85354c78063, 0xe0d78c4ea6db81ab, 0xcd219b275bb23733,
+    0xbb3ba29d5c08ec9b, 0x96cdb5f4a1615a03, 0xaa67c58d173ef18e,
+    0x8791d2e4ea574716, 0xf18beb5eeded9cbe, 0xdc7dfc3710842a26,
+    0x1dbf982ae2982bee, 0x30498f431ff19d76, 0x4653b6f9184b46de,
+    0x6ba5a190e522f046, 0x3f07560a74f411c4, 0x12f14163899da75c,
+    0x64eb78d98e277cf4, 0x491d6fb0734eca6c, 0x88df0bad8152cba4,
+    0xa5291cc47c3b7d3c, 0xd333257e7b81a694, 0xfec5321786e8100c,
+    0xc26f426e30b7bb81, 0xef995507cdde0d19, 0x99836cbdca64d6b1,
+    0xb4757bd4370d6029, 0x75b71fc9c51161e1, 0x584108a03878d779,
+    0x2e5b311a3fc20cd1, 0x03ad2673c2abba49, 0x871ede2f1c6fcfd5,
+    0xaae8c946e106794d, 0xdcf2f0fce6bca2e5, 0xf104e7951bd5147d,
+    0x30c68388e9c915b5, 0x1d3094e114a0a32d, 0x6b2aad5b131a7885,
+    0x46dcba32ee73ce1d, 0x7a76ca4b582c6590, 0x5780dd22a545d308,
+    0x219ae498a2ff08a0, 0x0c6cf3f15f96be38, 0xcdae97ecad8abff0,
+    0xe058808550e30968, 0x9642b93f5759d2c0, 0xbbb4ae56aa306458,
+    0xef1659cc3be685da, 0xc2e04ea5c68f3342, 0xb4fa771fc135e8ea,
+    0x990c60763c5c5e72, 0x58ce046bce405fba, 0x753813023329e922,
+    0x03222ab83493328a, 0x2ed43dd1c9fa8412, 0x127e4da87fa52f9f,
+    0x3f885ac182cc9907, 0x4992637b857642af, 0x64647412781ff437,
+    0xa5a6100f8a03f5ff, 0x88500766776a4367, 0xfe4a3edc70d098cf,
+    0xd3bc29b58db92e57},
+   {0x0000000000000000, 0xcbeac29cc4acdae4, 0x050d2a122657ab4d,
+    0xcee7e88ee2fb71a9, 0x0a1a54244caf569a, 0xc1f096b888038c7e,
+    0x0f177e366af8fdd7, 0xc4fdbcaaae542733, 0x1434a848995ead34,
+    0xdfde6ad45df277d0, 0x1139825abf090679, 0xdad340c67ba5dc9d,
+    0x1e2efc6cd5f1fbae, 0xd5c43ef0115d214a, 0x1b23d67ef3a650e3,
+    0xd0c914e2370a8a07, 0x2869509132bd5a68, 0xe383920df611808c,
+    0x2d647a8314eaf125, 0xe68eb81fd0462bc1, 0x227304b57e120cf2,
+    0xe999c629babed616, 0x277e2ea75845a7bf, 0xec94ec3b9ce97d5b,
+    0x3c5df8d9abe3f75c, 0xf7b73a456f4f2db8, 0x3950d2cb8db45c11,
+    0xf2ba1057491886f5, 0x3647acfde74ca1c6, 0xfdad6e6123e07b22,
+    0x334a86efc11b0a8b, 0xf8a0447305b7d06f, 0x50d2a122657ab4d0,
+    0x9b3863bea1d66e34, 0x55df8b30432d1f9d, 0x9e3549ac8781c579,
+    0x5ac8f50629d5e24a, 0x9122379aed7938ae, 0x5fc5df140f824907,
+    0x942f1d88cb2e93e3, 0x44e6096afc2419e4, 0x8f0ccbf63888c300,
+    0x41eb2378da73b2a9, 0x8a01e1e41edf684d, 0x4efc5d4eb08b4f7e,
+    0x85169fd27427959a, 0x4bf1775c96dce433, 0x801bb5c052703ed7,
+    0x78bbf1b357c7eeb8, 0xb351332f936b345c, 0x7db6dba1719045f5,
+    0xb65c193db53c9f11, 0x72a1a5971b68b822, 0xb94b670bdfc462c6,
+    0x77ac8f853d3f136f, 0xbc464d19f993c98b, 0x6c8f59fbce99438c,
+    0xa7659b670a359968, 0x698273e9e8cee8c1, 0xa268b1752c623225,
+    0x66950ddf82361516, 0xad7fcf43469acff2, 0x639827cda461be5b,
+    0xa872e55160cd64bf, 0xa1a54244caf569a0, 0x6a4f80d80e59b344,
+    0xa4a86856eca2c2ed, 0x6f42aaca280e1809, 0xabbf1660865a3f3a,
+    0x6055d4fc42f6e5de, 0xaeb23c72a00d9477, 0x6558feee64a14e93,
+    0xb591ea0c53abc494, 0x7e7b289097071e70, 0xb09cc01e75fc6fd9,
+    0x7b760282b150b53d, 0xbf8bbe281f04920e, 0x74617cb4dba848ea,
+    0xba86943a39533943, 0x716c56a6fdffe3a7, 0x89cc12d5f84833c8,
+    0x4226d0493ce4e92c, 0x8cc138c7de1f9885, 0x472bfa5b1ab34261,
+    0x83d646f1b4e76552, 0x483c846d704bbfb6, 0x86db6ce392b0ce1f,
+    0x4d31ae7f561c14fb, 0x9df8ba9d61169efc, 0x56127801a5ba4418,
+    0x98f5908f474135b1, 0x531f521383edef55, 0x97e2eeb92db9c866,
+    0x5c082c25e9151282, 0x92efc4ab0bee632b, 0x59050637cf42b9cf,
+    0xf177e366af8fdd70, 0x3a9d21fa6b230794, 0xf47ac97489d8763d,
+    0x3f900be84d74acd9, 0xfb6db742e3208bea, 0x308775de278c510e,
+    0xfe609d50c57720a7, 0x358a5fcc01dbfa43, 0xe5434b2e36d17044,
+    0x2ea989b2f27daaa0, 0xe04e613c1086db09, 0x2ba4a3a0d42a01ed,
+    0xef591f0a7a7e26de, 0x24b3dd96bed2fc3a, 0xea5435185c298d93,
+    0x21bef78498855777, 0xd91eb3f79d328718, 0x12f4716b599e5dfc,
+    0xdc1399e5bb652c55, 0x17f95b797fc9f6b1, 0xd304e7d3d19dd182,
+    0x18ee254f15310b66, 0xd609cdc1f7ca7acf, 0x1de30f5d3366a02b,
+    0xcd2a1bbf046c2a2c, 0x06c0d923c0c0f0c8, 0xc82731ad223b8161,
+    0x03cdf331e6975b85, 0xc7304f9b48c37cb6, 0x0cda8d078c6fa652,
+    0xc23d65896e94d7fb, 0x09d7a715aa380d1f, 0xd1922ba23ae4cdc5,
+    0x1a78e93efe481721, 0xd49f01b01cb36688, 0x1f75c32cd81fbc6c,
+    0xdb887f86764b9b5f, 0x1062bd1ab2e741bb, 0xde855594501c3012,
+    0x156f970894b0eaf6, 0xc5a683eaa3ba60f1, 0x0e4c41766716ba15,
+    0xc0aba9f885edcbbc, 0x0b416b6441411158, 0xcfbcd7ceef15366b,
+    0x045615522bb9ec8f, 0xcab1fddcc9429d26, 0x015b3f400dee47c2,
+    0xf9fb7b33085997ad, 0x3211b9afccf54d49, 0xfcf651212e0e3ce0,
+    0x371c93bdeaa2e604, 0xf3e12f1744f6c137, 0x380bed8b805a1bd3,
+    0xf6ec050562a16a7a, 0x3d06c799a60db09e, 0xedcfd37b91073a99,
+    0x262511e755abe07d, 0xe8c2f969b75091d4, 0x23283bf573fc4b30,
+    0xe7d5875fdda86c03, 0x2c3f45c31904b6e7, 0xe2d8ad4dfbffc74e,
+    0x29326fd13f531daa, 0x81408a805f9e7915, 0x4aaa481c9b32a3f1,
+    0x844da09279c9d258, 0x4fa7620ebd6508bc, 0x8b5adea413312f8f,
+    0x40b01c38d79df56b, 0x8e57f4b6356684c2, 0x45bd362af1ca5e26,
+    0x957422c8c6c0d421, 0x5e9ee054026c0ec5, 0x907908dae0977f6c,
+    0x5b93ca46243ba588, 0x9f6e76ec8a6f82bb, 0x5484b4704ec3585f,
+    0x9a635cfeac3829f6, 0x51899e626894f312, 0xa929da116d23237d,
+    0x62c3188da98ff999, 0xac24f0034b748830, 0x67ce329f8fd852d4,
+    0xa3338e35218c75e7, 0x68d94ca9e520af03, 0xa63ea42707dbdeaa,
+    0x6dd466bbc377044e, 0xbd1d7259f47d8e49, 0x76f7b0c530d154ad,
+    0xb810584bd22a2504, 0x73fa9ad71686ffe0, 0xb707267db8d2d8d3,
+    0x7cede4e17c7e0237, 0xb20a0c6f9e85739e, 0x79e0cef35a29a97a,
+    0x703769e6f011a465, 0xbbddab7a34bd7e81, 0x753a43f4d6460f28,
+    0xbed0816812ead5cc, 0x7a2d3dc2bcbef2ff, 0xb1c7ff5e7812281b,
+    0x7f2017d09ae959b2, 0xb4cad54c5e458356, 0x6403c1ae694f0951,
+    0xafe90332ade3d3b5, 0x610eebbc4f18a21c, 0xaae429208bb478f8,
+    0x6e19958a25e05fcb, 0xa5f35716e14c852f, 0x6b14bf9803b7f486,
+    0xa0fe7d04c71b2e62, 0x585e3977c2acfe0d, 0x93b4fbeb060024e9,
+    0x5d531365e4fb5540, 0x96b9d1f920578fa4, 0x52446d538e03a897,
+    0x99aeafcf4aaf7273, 0x57494741a85403da, 0x9ca385dd6cf8d93e,
+    0x4c6a913f5bf25339, 0x878053a39f5e89dd, 0x4967bb2d7da5f874,
+    0x828d79b1b9092290, 0x4670c51b175d05a3, 0x8d9a0787d3f1df47,
+    0x437def09310aaeee, 0x88972d95f5a6740a, 0x20e5c8c4956b10b5,
+    0xeb0f0a5851c7ca51, 0x25e8e2d6b33cbbf8, 0xee02204a7790611c,
+    0x2aff9ce0d9c4462f, 0xe1155e7c1d689ccb, 0x2ff2b6f2ff93ed62,
+    0xe418746e3b3f3786, 0x34d1608c0c35bd81, 0xff3ba210c8996765,
+    0x31dc4a9e2a6216cc, 0xfa368802eececc28, 0x3ecb34a8409aeb1b,
+    0xf521f634843631ff, 0x3bc61eba66cd4056, 0xf02cdc26a2619ab2,
+    0x088c9855a7d64add, 0xc3665ac9637a9039, 0x0d81b2478181e190,
+    0xc66b70db452d3b74, 0x0296cc71eb791c47, 0xc97c0eed2fd5c6a3,
+    0x079be663cd2eb70a, 0xcc7124ff09826dee, 0x1cb8301d3e88e7e9,
+    0xd752f281fa243d0d, 0x19b51a0f18df4ca4, 0xd25fd893dc739640,
+    0x16a264397227b173, 0xdd48a6a5b68b6b97, 0x13af4e2b54701a3e,
+    0xd8458cb790dcc0da},
+   {0x0000000000000000, 0x31fcf86fdac7850f, 0x63f9f0dfb58f0a1e,
+    0x520508b06f488f11, 0xc7f3e1bf6b1e143c, 0xf60f19d0b1d99133,
+    0xa40a1160de911e22, 0x95f6e90f04569b2d, 0x1d3f6c55793236fd,
+    0x2cc3943aa3f5b3f2, 0x7ec69c8accbd3ce3, 0x4f3a64e5167ab9ec,
+    0xdacc8dea122c22c1, 0xeb307585c8eba7ce, 0xb9357d35a7a328df,
+    0x88c9855a7d64add0, 0x3a7ed8aaf2646dfa, 0x0b8220c528a3e8f5,
+    0x5987287547eb67e4, 0x687bd01a9d2ce2eb, 0xfd8d3915997a79c6,
+    0xcc71c17a43bdfcc9, 0x9e74c9ca2cf573d8, 0xaf8831a5f632f6d7,
+    0x2741b4ff8b565b07, 0x16bd4c905191de08, 0x44b844203ed95119,
+    0x7544bc4fe41ed416, 0xe0b25540e0484f3b, 0xd14ead2f3a8fca34,
+    0x834ba59f55c74525, 0xb2b75df08f00c02a, 0x74fdb155e4c8dbf4,
+    0x4501493a3e0f5efb, 0x1704418a5147d1ea, 0x26f8b9e58b8054e5,
+    0xb30e50ea8fd6cfc8, 0x82f2a88555114ac7, 0xd0f7a0353a59c5d6,
+    0xe10b585ae09e40d9, 0x69c2dd009dfaed09, 0x583e256f473d6806,
+    0x0a3b2ddf2875e717, 0x3bc7d5b0f2b26218, 0xae313cbff6e4f935,
+    0x9fcdc4d02c237c3a, 0xcdc8cc60436bf32b, 0xfc34340f99ac7624,
+    0x4e8369ff16acb60e, 0x7f7f9190cc6b3301, 0x2d7a9920a323bc10,
+    0x1c86614f79e4391f, 0x897088407db2a232, 0xb88c702fa775273d,
+    0xea89789fc83da82c, 0xdb7580f012fa2d23, 0x53bc05aa6f9e80f3,
+    0x6240fdc5b55905fc, 0x3045f575da118aed, 0x01b90d1a00d60fe2,
+    0x944fe415048094cf, 0xa5b31c7ade4711c0, 0xf7b614cab10f9ed1,
+    0xc64aeca56bc81bde, 0xe9fb62abc991b7e8, 0xd8079ac4135632e7,
+    0x8a0292747c1ebdf6, 0xbbfe6a1ba6d938f9, 0x2e088314a28fa3d4,
+    0x1ff47b7b784826db, 0x4df173cb1700a9ca, 0x7c0d8ba4cdc72cc5,
+    0xf4c40efeb0a38115, 0xc538f6916a64041a, 0x973dfe21052c8b0b,
+    0xa6c1064edfeb0e04, 0x3337ef41dbbd9529, 0x02cb172e017a1026,
+    0x50ce1f9e6e329f37, 0x6132e7f1b4f51a38, 0xd385ba013bf5da12,
+    0xe279426ee1325f1d, 0xb07c4ade8e7ad00c, 0x8180b2b154bd5503,
+    0x14765bbe50ebce2e, 0x258aa3d18a2c4b21, 0x778fab61e564c430,
+    0x4673530e3fa3413f, 0xcebad65442c7ecef, 0xff462e3b980069e0,
+    0xad43268bf748e6f1, 0x9cbfdee42d8f63fe, 0x094937eb29d9f8d3,
+    0x38b5cf84f31e7ddc, 0x6ab0c7349c56f2cd, 0x5b4c3f5b469177c2,
+    0x9d06d3fe2d596c1c, 0xacfa2b91f79ee913, 0xfeff232198d66602,
+    0xcf03db4e4211e30d, 0x5af5324146477820, 0x6b09ca2e9c80fd2f,
+    0x390cc29ef3c8723e, 0x08f03af1290ff731, 0x8039bfab546b5ae1,
+    0xb1c547c48eacdfee, 0xe3c04f74e1e450ff, 0xd23cb71b3b23d5f0,
+    0x47ca5e143f754edd, 0x7636a67be5b2cbd2, 0x2433aecb8afa44c3,
+    0x15cf56a4503dc1cc, 0xa7780b54df3d01e6, 0x9684f33b05fa84e9,
+    0xc481fb8b6ab20bf8, 0xf57d03e4b0758ef7, 0x608beaebb42315da,
+    0x517712846ee490d5, 0x03721a3401ac1fc4, 0x328ee25bdb6b9acb,
+    0xba476701a60f371b, 0x8bbb9f6e7cc8b214, 0xd9be97de13803d05,
+    0xe8426fb1c947b80a, 0x7db486becd112327, 0x4c487ed117d6a628,
+    0x1e4d7661789e2939, 0x2fb18e0ea259ac36, 0x412e6a7c3c2d7155,
+    0x70d29213e6eaf45a, 0x22d79aa389a27b4b, 0x132b62cc5365fe44,
+    0x86dd8bc357336569, 0xb72173ac8df4e066, 0xe5247b1ce2bc6f77,
+    0xd4d88373387bea78, 0x5c110629451f47a8, 0x6dedfe469fd8c2a7,
+    0x3fe8f6f6f0904db6, 0x0e140e992a57c8b9, 0x9be2e7962e015394,
+    0xaa1e1ff9f4c6d69b, 0xf81b17499b8e598a, 0xc9e7ef264149dc85,
+    0x7b50b2d6ce491caf, 0x4aac4ab9148e99a0, 0x18a942097bc616b1,
+    0x2955ba66a10193be, 0xbca35369a5570893, 0x8d5fab067f908d9c,
+    0xdf5aa3b610d8028d, 0xeea65bd9ca1f8782, 0x666fde83b77b2a52,
+    0x579326ec6dbcaf5d, 0x05962e5c02f4204c, 0x346ad633d833a543,
+    0xa19c3f3cdc653e6e, 0x9060c75306a2bb61, 0xc265cfe369ea3470,
+    0xf399378cb32db17f, 0x35d3db29d8e5aaa1, 0x042f234602222fae,
+    0x562a2bf66d6aa0bf, 0x67d6d399b7ad25b0, 0xf2203a96b3fbbe9d,
+    0xc3dcc2f9693c3b92, 0x91d9ca490674b483, 0xa0253226dcb3318c,
+    0x28ecb77ca1d79c5c, 0x19104f137b101953, 0x4b1547a314589642,
+    0x7ae9bfccce9f134d, 0xef1f56c3cac98860, 0xdee3aeac100e0d6f,
+    0x8ce6a61c7f46827e, 0xbd1a5e73a5810771, 0x0fad03832a81c75b,
+    0x3e51fbecf0464254, 0x6c54f35c9f0ecd45, 0x5da80b3345c9484a,
+    0xc85ee23c419fd367, 0xf9a21a539b585668, 0xaba712e3f410d979,
+    0x9a5bea8c2ed75c76, 0x12926fd653b3f1a6, 0x236e97b9897474a9,
+    0x716b9f09e63cfbb8, 0x409767663cfb7eb7, 0xd5618e6938ade59a,
+    0xe49d7606e26a6095, 0xb6987eb68d22ef84, 0x876486d957e56a8b,
+    0xa8d508d7f5bcc6bd, 0x9929f0b82f7b43b2, 0xcb2cf8084033cca3,
+    0xfad000679af449ac, 0x6f26e9689ea2d281, 0x5eda11074465578e,
+    0x0cdf19b72b2dd89f, 0x3d23e1d8f1ea5d90, 0xb5ea64828c8ef040,
+    0x84169ced5649754f, 0xd613945d3901fa5e, 0xe7ef6c32e3c67f51,
+    0x7219853de790e47c, 0x43e57d523d576173, 0x11e075e2521fee62,
+    0x201c8d8d88d86b6d, 0x92abd07d07d8ab47, 0xa3572812dd1f2e48,
+    0xf15220a2b257a159, 0xc0aed8cd68902456, 0x555831c26cc6bf7b,
+    0x64a4c9adb6013a74, 0x36a1c11dd949b565, 0x075d3972038e306a,
+    0x8f94bc287eea9dba, 0xbe684447a42d18b5, 0xec6d4cf7cb6597a4,
+    0xdd91b49811a212ab, 0x48675d9715f48986, 0x799ba5f8cf330c89,
+    0x2b9ead48a07b8398, 0x1a6255277abc0697, 0xdc28b98211741d49,
+    0xedd441edcbb39846, 0xbfd1495da4fb1757, 0x8e2db1327e3c9258,
+    0x1bdb583d7a6a0975, 0x2a27a052a0ad8c7a, 0x7822a8e2cfe5036b,
+    0x49de508d15228664, 0xc117d5d768462bb4, 0xf0eb2db8b281aebb,
+    0xa2ee2508ddc921aa, 0x9312dd67070ea4a5, 0x06e4346803583f88,
+    0x3718cc07d99fba87, 0x651dc4b7b6d73596, 0x54e13cd86c10b099,
+    0xe6566128e31070b3, 0xd7aa994739d7f5bc, 0x85af91f7569f7aad,
+    0xb45369988c58ffa2, 0x21a58097880e648f, 0x105978f852c9e180,
+    0x425c70483d816e91, 0x73a08827e746eb9e, 0xfb690d7d9a22464e,
+    0xca95f51240e5c341, 0x9890fda22fad4c50, 0xa96c05cdf56ac95f,
+    0x3c9aecc2f13c5272, 0x0d6614ad2bfbd77d, 0x5f631c1d44b3586c,
+    0x6e9fe4729e74dd63},
+   {0x0000000000000000, 0x825cd4f8785ae2aa, 0x966106db5fbbdbd1,
+    0x143dd22327e1397b, 0xbe1aa29d1079a927, 0x3c46766568234b8d,
+    0x287ba4464fc272f6, 0xaa2770be3798905c, 0xeeedea118ffd4ccb,
+    0x6cb13ee9f7a7ae61, 0x788ceccad046971a, 0xfad03832a81c75b0,
+    0x50f7488c9f84e5ec, 0xd2ab9c74e7de0746, 0xc6964e57c03f3e3d,
+    0x44ca9aafb865dc97, 0x4f037b08b0f48713, 0xcd5faff0c8ae65b9,
+    0xd9627dd3ef4f5cc2, 0x5b3ea92b9715be68, 0xf119d995a08d2e34,
+    0x73450d6dd8d7cc9e, 0x6778df4eff36f5e5, 0xe5240bb6876c174f,
+    0xa1ee91193f09cbd8, 0x23b245e147532972, 0x378f97c260b21009,
+    0xb5d3433a18e8f2a3, 0x1ff433842f7062ff, 0x9da8e77c572a8055,
+    0x8995355f70cbb92e, 0x0bc9e1a708915b84, 0x9e06f61161e90e26,
+    0x1c5a22e919b3ec8c, 0x0867f0ca3e52d5f7, 0x8a3b24324608375d,
+    0x201c548c7190a701, 0xa240807409ca45ab, 0xb67d52572e2b7cd0,
+    0x342186af56719e7a, 0x70eb1c00ee1442ed, 0xf2b7c8f8964ea047,
+    0xe68a1adbb1af993c, 0x64d6ce23c9f57b96, 0xcef1be9dfe6debca,
+    0x4cad6a6586370960, 0x5890b846a1d6301b, 0xdacc6cbed98cd2b1,
+    0xd1058d19d11d8935, 0x535959e1a9476b9f, 0x47648bc28ea652e4,
+    0xc5385f3af6fcb04e, 0x6f1f2f84c1642012, 0xed43fb7cb93ec2b8,
+    0xf97e295f9edffbc3, 0x7b22fda7e6851969, 0x3fe867085ee0c5fe,
+    0xbdb4b3f026ba2754, 0xa98961d3015b1e2f, 0x2bd5b52b7901fc85,
+    0x81f2c5954e996cd9, 0x03ae116d36c38e73, 0x1793c34e1122b708,
+    0x95cf17b6697855a2, 0xaed543096cdc02c9, 0x2c8997f11486e063,
+    0x38b445d23367d918, 0xbae8912a4b3d3bb2, 0x10cfe1947ca5abee,
+    0x9293356c04ff4944, 0x86aee74f231e703f, 0x04f233b75b449295,
+    0x4038a918e3214e02, 0xc2647de09b7baca8, 0xd659afc3bc9a95d3,
+    0x54057b3bc4c07779, 0xfe220b85f358e725, 0x7c7edf7d8b02058f,
+    0x68430d5eace33cf4, 0xea1fd9a6d4b9de5e, 0xe1d63801dc2885da,
+    0x638aecf9a4726770, 0x77b73eda83935e0b, 0xf5ebea22fbc9bca1,
+    0x5fcc9a9ccc512cfd, 0xdd904e64b40bce57, 0xc9ad9c4793eaf72c,
+    0x4bf148bfebb01586, 0x0f3bd21053d5c911, 0x8d6706e82b8f2bbb,
+    0x995ad4cb0c6e12c0, 0x1b0600337434f06a, 0xb121708d43ac6036,
+    0x337da4753bf6829c, 0x274076561c17bbe7, 0xa51ca2ae644d594d,
+    0x30d3b5180d350cef, 0xb28f61e0756fee45, 0xa6b2b3c3528ed73e,
+    0x24ee673b2ad43594, 0x8ec917851d4ca5c8, 0x0c95c37d65164762,
+    0x18a8115e42f77e19, 0x9af4c5a63aad9cb3, 0xde3e5f0982c84024,
+    0x5c628bf1fa92a28e, 0x485f59d2dd739bf5, 0xca038d2aa529795f,
+    0x6024fd9492b1e903, 0xe278296ceaeb0ba9, 0xf645fb4fcd0a32d2,
+    0x74192fb7b550d078, 0x7fd0ce10bdc18bfc, 0xfd8c1ae8c59b6956,
+    0xe9b1c8cbe27a502d, 0x6bed1c339a20b287, 0xc1ca6c8dadb822db,
+    0x4396b875d5e2c071, 0x57ab6a56f203f90a, 0xd5f7beae8a591ba0,
+    0x913d2401323cc737, 0x1361f0f94a66259d, 0x075c22da6d871ce6,
+    0x8500f62215ddfe4c, 0x2f27869c22456e10, 0xad7b52645a1f8cba,
+    0xb94680477dfeb5c1, 0x3b1a54bf05a4576b, 0xcf72293976b61b17,
+    0x4d2efdc10eecf9bd, 0x59132fe2290dc0c6, 0xdb4ffb1a5157226c,
+    0x71688ba466cfb230, 0xf3345f5c1e95509a, 0xe7098d7f397469e1,
+    0x65555987412e8b4b, 0x219fc328f94b57dc, 0xa3c317d08111b576,
+    0xb7fec5f3a6f08c0d, 0x35a2110bdeaa6ea7, 0x9f8561b5e932fefb,
+    0x1dd9b54d91681c51, 0x09e4676eb689252a, 0x8bb8b396ced3c780,
+    0x80715231c6429c04, 0x022d86c9be187eae, 0x161054ea99f947d5,
+    0x944c8012e1a3a57f, 0x3e6bf0acd63b3523, 0xbc372454ae61d789,
+    0xa80af6778980eef2, 0x2a56228ff1da0c58, 0x6e9cb82049bfd0cf,
+    0xecc06cd831e53265, 0xf8fdbefb16040b1e, 0x7aa16a036e5ee9b4,
+    0xd0861abd59c679e8, 0x52dace45219c9b42, 0x46e71c66067da239,
+    0xc4bbc89e7e274093, 0x5174df28175f1531, 0xd3280bd06f05f79b,
+    0xc715d9f348e4cee0, 0x45490d0b30be2c4a, 0xef6e7db50726bc16,
+    0x6d32a94d7f7c5ebc, 0x790f7b6e589d67c7, 0xfb53af9620c7856d,
+    0xbf99353998a259fa, 0x3dc5e1c1e0f8bb50, 0x29f833e2c719822b,
+    0xaba4e71abf436081, 0x018397a488dbf0dd, 0x83df435cf0811277,
+    0x97e2917fd7602b0c, 0x15be4587af3ac9a6, 0x1e77a420a7ab9222,
+    0x9c2b70d8dff17088, 0x8816a2fbf81049f3, 0x0a4a7603804aab59,
+    0xa06d06bdb7d23b05, 0x2231d245cf88d9af, 0x360c0066e869e0d4,
+    0xb450d49e9033027e, 0xf09a4e312856dee9, 0x72c69ac9500c3c43,
+    0x66fb48ea77ed0538, 0xe4a79c120fb7e792, 0x4e80ecac382f77ce,
+    0xccdc385440759564, 0xd8e1ea776794ac1f, 0x5abd3e8f1fce4eb5,
+    0x61a76a301a6a19de, 0xe3fbbec86230fb74, 0xf7c66ceb45d1c20f,
+    0x759ab8133d8b20a5, 0xdfbdc8ad0a13b0f9, 0x5de11c5572495253,
+    0x49dcce7655a86b28, 0xcb801a8e2df28982, 0x8f4a802195975515,
+    0x0d1654d9edcdb7bf, 0x192b86faca2c8ec4, 0x9b775202b2766c6e,
+    0x315022bc85eefc32, 0xb30cf644fdb41e98, 0xa7312467da5527e3,
+    0x256df09fa20fc549, 0x2ea41138aa9e9ecd, 0xacf8c5c0d2c47c67,
+    0xb8c517e3f525451c, 0x3a99c31b8d7fa7b6, 0x90beb3a5bae737ea,
+    0x12e2675dc2bdd540, 0x06dfb57ee55cec3b, 0x848361869d060e91,
+    0xc049fb292563d206, 0x42152fd15d3930ac, 0x5628fdf27ad809d7,
+    0xd474290a0282eb7d, 0x7e5359b4351a7b21, 0xfc0f8d4c4d40998b,
+    0xe8325f6f6aa1a0f0, 0x6a6e8b9712fb425a, 0xffa19c217b8317f8,
+    0x7dfd48d903d9f552, 0x69c09afa2438cc29, 0xeb9c4e025c622e83,
+    0x41bb3ebc6bfabedf, 0xc3e7ea4413a05c75, 0xd7da38673441650e,
+    0x5586ec9f4c1b87a4, 0x114c7630f47e5b33, 0x9310a2c88c24b999,
+    0x872d70ebabc580e2, 0x0571a413d39f6248, 0xaf56d4ade407f214,
+    0x2d0a00559c5d10be, 0x3937d276bbbc29c5, 0xbb6b068ec3e6cb6f,
+    0xb0a2e729cb7790eb, 0x32fe33d1b32d7241, 0x26c3e1f294cc4b3a,
+    0xa49f350aec96a990, 0x0eb845b4db0e39cc, 0x8ce4914ca354db66,
+    0x98d9436f84b5e21d, 0x1a859797fcef00b7, 0x5e4f0d38448adc20,
+    0xdc13d9c03cd03e8a, 0xc82e0be31b3107f1, 0x4a72df1b636be55b,
+    0xe055afa554f37507, 0x62097b5d2ca997ad, 0x7634a97e0b48aed6,
+    0xf4687d8673124c7c},
+   {0x0000000000000000, 0x0c3cfd59426228ab, 0x1879fab284c45156,
+    0x144507ebc6a679fd, 0x30f3f5650988a2ac, 0x3ccf083c4bea8a07,
+    0x288a0fd78d4cf3fa, 0x24b6f28ecf2edb51, 0x61e7eaca13114558,
+    0x6ddb179351736df3, 0x799e107897d5140e, 0x75a2ed21d5b73ca5,
+    0x51141faf1a99e7f4, 0x5d28e2f658fbcf5f, 0x496de51d9e5db6a2,
+    0x45511844dc3f9e09, 0xc3cfd59426228ab0, 0xcff328cd6440a21b,
+    0xdbb62f26a2e6dbe6, 0xd78ad27fe084f34d, 0xf33c20f12faa281c,
+    0xff00dda86dc800b7, 0xeb45da43ab6e794a, 0xe779271ae90c51e1,
+    0xa2283f5e3533cfe8, 0xae14c2077751e743, 0xba51c5ecb1f79ebe,
+    0xb66d38b5f395b615, 0x92dbca3b3cbb6d44, 0x9ee737627ed945ef,
+    0x8aa23089b87f3c12, 0x869ecdd0fa1d14b9, 0x15470403e34b0be5,
+    0x197bf95aa129234e, 0x0d3efeb1678f5ab3, 0x010203e825ed7218,
+    0x25b4f166eac3a949, 0x29880c3fa8a181e2, 0x3dcd0bd46e07f81f,
+    0x31f1f68d2c65d0b4, 0x74a0eec9f05a4ebd, 0x789c1390b2386616,
+    0x6cd9147b749e1feb, 0x60e5e92236fc3740, 0x44531bacf9d2ec11,
+    0x486fe6f5bbb0c4ba, 0x5c2ae11e7d16bd47, 0x50161c473f7495ec,
+    0xd688d197c5698155, 0xdab42cce870ba9fe, 0xcef12b2541add003,
+    0xc2cdd67c03cff8a8, 0xe67b24f2cce123f9, 0xea47d9ab8e830b52,
+    0xfe02de40482572af, 0xf23e23190a475a04, 0xb76f3b5dd678c40d,
+    0xbb53c604941aeca6, 0xaf16c1ef52bc955b, 0xa32a3cb610debdf0,
+    0x879cce38dff066a1, 0x8ba033619d924e0a, 0x9fe5348a5b3437f7,
+    0x93d9c9d319561f5c, 0x2a8e0807c69617ca, 0x26b2f55e84f43f61,
+    0x32f7f2b54252469c, 0x3ecb0fec00306e37, 0x1a7dfd62cf1eb566,
+    0x1641003b8d7c9dcd, 0x020407d04bdae430, 0x0e38fa8909b8cc9b,
+    0x4b69e2cdd5875292, 0x47551f9497e57a39, 0x5310187f514303c4,
+    0x5f2ce52613212b6f, 0x7b9a17a8dc0ff03e, 0x77a6eaf19e6dd895,
+    0x63e3ed1a58cba168, 0x6fdf10431aa989c3, 0xe941dd93e0b49d7a,
+    0xe57d20caa2d6b5d1, 0xf13827216470cc2c, 0xfd04da782612e487,
+    0xd9b228f6e93c3fd6, 0xd58ed5afab5e177d, 0xc1cbd2446df86e80,
+    0xcdf72f1d2f9a462b, 0x88a63759f3a5d822, 0x849aca00b1c7f089,
+    0x90dfcdeb77618974, 0x9ce330b23503a1df, 0xb855c23cfa2d7a8e,
+    0xb4693f65b84f5225, 0xa02c388e7ee92bd8, 0xac10c5d73c8b0373,
+    0x3fc90c0425dd1c2f, 0x33f5f15d67bf3484, 0x27b0f6b6a1194d79,
+    0x2b8c0befe37b65d2, 0x0f3af9612c55be83, 0x030604386e379628,
+    0x174303d3a891efd5, 0x1b7ffe8aeaf3c77e, 0x5e2ee6ce36cc5977,
+    0x52121b9774ae71dc, 0x46571c7cb2080821, 0x4a6be125f06a208a,
+    0x6edd13ab3f44fbdb, 0x62e1eef27d26d370, 0x76a4e919bb80aa8d,
+    0x7a981440f9e28226, 0xfc06d99003ff969f, 0xf03a24c9419dbe34,
+    0xe47f2322873bc7c9, 0xe843de7bc559ef62, 0xccf52cf50a773433,
+    0xc0c9d1ac48151c98, 0xd48cd6478eb36565, 0xd8b02b1eccd14dce,
+    0x9de1335a10eed3c7, 0x91ddce03528cfb6c, 0x8598c9e8942a8291,
+    0x89a434b1d648aa3a, 0xad12c63f1966716b, 0xa12e3b665b0459c0,
+    0xb56b3c8d9da2203d, 0xb957c1d4dfc00896, 0x551c100f8d2c2f94,
+    0x5920ed56cf4e073f, 0x4d65eabd09e87ec2, 0x415917e44b8a5669,
+    0x65efe56a84a48d38, 0x69d31833c6c6a593, 0x7d961fd80060dc6e,
+    0x71aae2814202f4c5, 0x34fbfac59e3d6acc, 0x38c7079cdc5f4267,
+    0x2c8200771af93b9a, 0x20befd2e589b1331, 0x04080fa097b5c860,
+    0x0834f2f9d5d7e0cb, 0x1c71f51213719936, 0x104d084b5113b19d,
+    0x96d3c59bab0ea524, 0x9aef38c2e96c8d8f, 0x8eaa3f292fcaf472,
+    0x8296c2706da8dcd9, 0xa62030fea2860788, 0xaa1ccda7e0e42f23,
+    0xbe59ca4c264256de, 0xb265371564207e75, 0xf7342f51b81fe07c,
+    0xfb08d208fa7dc8d7, 0xef4dd5e33cdbb12a, 0xe37128ba7eb99981,
+    0xc7c7da34b19742d0, 0xcbfb276df3f56a7b, 0xdfbe208635531386,
+    0xd382dddf77313b2d, 0x405b140c6e672471, 0x4c67e9552c050cda,
+    0x5822eebeeaa37527, 0x541e13e7a8c15d8c, 0x70a8e16967ef86dd,
+    0x7c941c30258dae76, 0x68d11bdbe32bd78b, 0x64ede682a149ff20,
+    0x21bcfec67d766129, 0x2d80039f3f144982, 0x39c50474f9b2307f,
+    0x35f9f92dbbd018d4, 0x114f0ba374fec385, 0x1d73f6fa369ceb2e,
+    0x0936f111f03a92d3, 0x050a0c48b258ba78, 0x8394c1984845aec1,
+    0x8fa83cc10a27866a, 0x9bed3b2acc81ff97, 0x97d1c6738ee3d73c,
+    0xb36734fd41cd0c6d, 0xbf5bc9a403af24c6, 0xab1ece4fc5095d3b,
+    0xa7223316876b7590, 0xe2732b525b54eb99, 0xee4fd60b1936c332,
+    0xfa0ad1e0df90bacf, 0xf6362cb99df29264, 0xd280de3752dc4935,
+    0xdebc236e10be619e, 0xcaf92485d6181863, 0xc6c5d9dc947a30c8,
+    0x7f9218084bba385e, 0x73aee55109d810f5, 0x67ebe2bacf7e6908,
+    0x6bd71fe38d1c41a3, 0x4f61ed6d42329af2, 0x435d10340050b259,
+    0x571817dfc6f6cba4, 0x5b24ea868494e30f, 0x1e75f2c258ab7d06,
+    0x12490f9b1ac955ad, 0x060c0870dc6f2c50, 0x0a30f5299e0d04fb,
+    0x2e8607a75123dfaa, 0x22bafafe1341f701, 0x36fffd15d5e78efc,
+    0x3ac3004c9785a657, 0xbc5dcd9c6d98b2ee, 0xb06130c52ffa9a45,
+    0xa424372ee95ce3b8, 0xa818ca77ab3ecb13, 0x8cae38f964101042,
+    0x8092c5a0267238e9, 0x94d7c24be0d44114, 0x98eb3f12a2b669bf,
+    0xddba27567e89f7b6, 0xd186da0f3cebdf1d, 0xc5c3dde4fa4da6e0,
+    0xc9ff20bdb82f8e4b, 0xed49d2337701551a, 0xe1752f6a35637db1,
+    0xf5302881f3c5044c, 0xf90cd5d8b1a72ce7, 0x6ad51c0ba8f133bb,
+    0x66e9e152ea931b10, 0x72ace6b92c3562ed, 0x7e901be06e574a46,
+    0x5a26e96ea1799117, 0x561a1437e31bb9bc, 0x425f13dc25bdc041,
+    0x4e63ee8567dfe8ea, 0x0b32f6c1bbe076e3, 0x070e0b98f9825e48,
+    0x134b0c733f2427b5, 0x1f77f12a7d460f1e, 0x3bc103a4b268d44f,
+    0x37fdfefdf00afce4, 0x23b8f91636ac8519, 0x2f84044f74ceadb2,
+    0xa91ac99f8ed3b90b, 0xa52634c6ccb191a0, 0xb163332d0a17e85d,
+    0xbd5fce744875c0f6, 0x99e93cfa875b1ba7, 0x95d5c1a3c539330c,
+    0x8190c648039f4af1, 0x8dac3b1141fd625a, 0xc8fd23559dc2fc53,
+    0xc4c1de0cdfa0d4f8, 0xd084d9e71906ad05, 0xdcb824be5b6485ae,
+    0xf80ed630944a5eff, 0xf4322b69d6287654, 0xe0772c82108e0fa9,
+    0xec4bd1db52ec2702},
+   {0x0000000000000000, 0xaa38201f1a585f28, 0xc6a8ef159bbea0d5,
+    0x6c90cf0a81e6fffd, 0x1f89710098735f2f, 0xb5b1511f822b0007,
+    0xd9219e1503cdfffa, 0x7319be0a1995a0d2, 0x3f12e20130e6be5e,
+    0x952ac21e2abee176, 0xf9ba0d14ab581e8b, 0x53822d0bb10041a3,
+    0x209b9301a895e171, 0x8aa3b31eb2cdbe59, 0xe6337c14332b41a4,
+    0x4c0b5c0b29731e8c, 0x7e25c40261cd7cbc, 0xd41de41d7b952394,
+    0xb88d2b17fa73dc69, 0x12b50b08e02b8341, 0x61acb502f9be2393,
+    0xcb94951de3e67cbb, 0xa7045a1762008346, 0x0d3c7a087858dc6e,
+    0x41372603512bc2e2, 0xeb0f061c4b739dca, 0x879fc916ca956237,
+    0x2da7e909d0cd3d1f, 0x5ebe5703c9589dcd, 0xf486771cd300c2e5,
+    0x9816b81652e63d18, 0x322e980948be6230, 0xfc4b8804c39af978,
+    0x5673a81bd9c2a650, 0x3ae36711582459ad, 0x90db470e427c0685,
+    0xe3c2f9045be9a657, 0x49fad91b41b1f97f, 0x256a1611c0570682,
+    0x8f52360eda0f59aa, 0xc3596a05f37c4726, 0x69614a1ae924180e,
+    0x05f1851068c2e7f3, 0xafc9a50f729ab8db, 0xdcd01b056b0f1809,
+    0x76e83b1a71574721, 0x1a78f410f0b1b8dc, 0xb040d40feae9e7f4,
+    0x826e4c06a25785c4, 0x28566c19b80fdaec, 0x44c6a31339e92511,
+    0xeefe830c23b17a39, 0x9de73d063a24daeb, 0x37df1d19207c85c3,
+    0x5b4fd213a19a7a3e, 0xf177f20cbbc22516, 0xbd7cae0792b13b9a,
+    0x17448e1888e964b2, 0x7bd44112090f9b4f, 0xd1ec610d1357c467,
+    0xa2f5df070ac264b5, 0x08cdff18109a3b9d, 0x645d3012917cc460,
+    0xce65100d8b249b48, 0x6a4fbf22283bec75, 0xc0779f3d3263b35d,
+    0xace75037b3854ca0, 0x06df7028a9dd1388, 0x75c6ce22b048b35a,
+    0xdffeee3daa10ec72, 0xb36e21372bf6138f, 0x1956012831ae4ca7,
+    0x555d5d2318dd522b, 0xff657d3c02850d03, 0x93f5b2368363f2fe,
+    0x39cd9229993badd6, 0x4ad42c2380ae0d04, 0xe0ec0c3c9af6522c,
+    0x8c7cc3361b10add1, 0x2644e3290148f2f9, 0x146a7b2049f690c9,
+    0xbe525b3f53aecfe1, 0xd2c29435d248301c, 0x78fab42ac8106f34,
+    0x0be30a20d185cfe6, 0xa1db2a3fcbdd90ce, 0xcd4be5354a3b6f33,
+    0x6773c52a5063301b, 0x2b78992179102e97, 0x8140b93e634871bf,
+    0xedd07634e2ae8e42, 0x47e8562bf8f6d16a, 0x34f1e821e16371b8,
+    0x9ec9c83efb3b2e90, 0xf25907347addd16d, 0x5861272b60858e45,
+    0x96043726eba1150d, 0x3c3c1739f1f94a25, 0x50acd833701fb5d8,
+    0xfa94f82c6a47eaf0, 0x898d462673d24a22, 0x23b56639698a150a,
+    0x4f25a933e86ceaf7, 0xe51d892cf234b5df, 0xa916d527db47ab53,
+    0x032ef538c11ff47b, 0x6fbe3a3240f90b86, 0xc5861a2d5aa154ae,
+    0xb69fa4274334f47c, 0x1ca78438596cab54, 0x70374b32d88a54a9,
+    0xda0f6b2dc2d20b81, 0xe821f3248a6c69b1, 0x4219d33b90343699,
+    0x2e891c3111d2c964, 0x84b13c2e0b8a964c, 0xf7a88224121f369e,
+    0x5d90a23b084769b6, 0x31006d3189a1964b, 0x9b384d2e93f9c963,
+    0xd7331125ba8ad7ef, 0x7d0b313aa0d288c7, 0x119bfe302134773a,
+    0xbba3de2f3b6c2812, 0xc8ba602522f988c0, 0x6282403a38a1d7e8,
+    0x0e128f30b9472815, 0xa42aaf2fa31f773d, 0xd49f7e445077d8ea,
+    0x7ea75e5b4a2f87c2, 0x12379151cbc9783f, 0xb80fb14ed1912717,
+    0xcb160f44c80487c5, 0x612e2f5bd25cd8ed, 0x0dbee05153ba2710,
+    0xa786c04e49e27838, 0xeb8d9c45609166b4, 0x41b5bc5a7ac9399c,
+    0x2d257350fb2fc661, 0x871d534fe1779949, 0xf404ed45f8e2399b,
+    0x5e3ccd5ae2ba66b3, 0x32ac0250635c994e, 0x9894224f7904c666,
+    0xaababa4631baa456, 0x00829a592be2fb7e, 0x6c125553aa040483,
+    0xc62a754cb05c5bab, 0xb533cb46a9c9fb79, 0x1f0beb59b391a451,
+    0x739b245332775bac, 0xd9a3044c282f0484, 0x95a85847015c1a08,
+    0x3f9078581b044520, 0x5300b7529ae2badd, 0xf938974d80bae5f5,
+    0x8a212947992f4527, 0x2019095883771a0f, 0x4c89c6520291e5f2,
+    0xe6b1e64d18c9bada, 0x28d4f64093ed2192, 0x82ecd65f89b57eba,
+    0xee7c195508538147, 0x4444394a120bde6f, 0x375d87400b9e7ebd,
+    0x9d65a75f11c62195, 0xf1f568559020de68, 0x5bcd484a8a788140,
+    0x17c61441a30b9fcc, 0xbdfe345eb953c0e4, 0xd16efb5438b53f19,
+    0x7b56db4b22ed6031, 0x084f65413b78c0e3, 0xa277455e21209fcb,
+    0xcee78a54a0c66036, 0x64dfaa4bba9e3f1e, 0x56f13242f2205d2e,
+    0xfcc9125de8780206, 0x9059dd57699efdfb, 0x3a61fd4873c6a2d3,
+    0x497843426a530201, 0xe340635d700b5d29, 0x8fd0ac57f1eda2d4,
+    0x25e88c48ebb5fdfc, 0x69e3d043c2c6e370, 0xc3dbf05cd89ebc58,
+    0xaf4b3f56597843a5, 0x05731f4943201c8d, 0x766aa1435ab5bc5f,
+    0xdc52815c40ede377, 0xb0c24e56c10b1c8a, 0x1afa6e49db5343a2,
+    0xbed0c166784c349f, 0x14e8e17962146bb7, 0x78782e73e3f2944a,
+    0xd2400e6cf9aacb62, 0xa159b066e03f6bb0, 0x0b619079fa673498,
+    0x67f15f737b81cb65, 0xcdc97f6c61d9944d, 0x81c2236748aa8ac1,
+    0x2bfa037852f2d5e9, 0x476acc72d3142a14, 0xed52ec6dc94c753c,
+    0x9e4b5267d0d9d5ee, 0x34737278ca818ac6, 0x58e3bd724b67753b,
+    0xf2db9d6d513f2a13, 0xc0f5056419814823, 0x6acd257b03d9170b,
+    0x065dea71823fe8f6, 0xac65ca6e9867b7de, 0xdf7c746481f2170c,
+    0x7544547b9baa4824, 0x19d49b711a4cb7d9, 0xb3ecbb6e0014e8f1,
+    0xffe7e7652967f67d, 0x55dfc77a333fa955, 0x394f0870b2d956a8,
+    0x9377286fa8810980, 0xe06e9665b114a952, 0x4a56b67aab4cf67a,
+    0x26c679702aaa0987, 0x8cfe596f30f256af, 0x429b4962bbd6cde7,
+    0xe8a3697da18e92cf, 0x8433a67720686d32, 0x2e0b86683a30321a,
+    0x5d12386223a592c8, 0xf72a187d39fdcde0, 0x9bbad777b81b321d,
+    0x3182f768a2436d35, 0x7d89ab638b3073b9, 0xd7b18b7c91682c91,
+    0xbb214476108ed36c, 0x111964690ad68c44, 0x6200da6313432c96,
+    0xc838fa7c091b73be, 0xa4a8357688fd8c43, 0x0e90156992a5d36b,
+    0x3cbe8d60da1bb15b, 0x9686ad7fc043ee73, 0xfa16627541a5118e,
+    0x502e426a5bfd4ea6, 0x2337fc604268ee74, 0x890fdc7f5830b15c,
+    0xe59f1375d9d64ea1, 0x4fa7336ac38e1189, 0x03ac6f61eafd0f05,
+    0xa9944f7ef0a5502d, 0xc50480747143afd0, 0x6f3ca06b6b1bf0f8,
+    0x1c251e61728e502a, 0xb61d3e7e68d60f02, 0xda8df174e930f0ff,
+    0x70b5d16bf368afd7}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0x285f581a1f2038aa, 0xd5a0be9b15efa8c6,
+    0xfdffe6810acf906c, 0x2f5f73980071891f, 0x07002b821f51b1b5,
+    0xfaffcd03159e21d9, 0xd2a095190abe1973, 0x5ebee63001e2123f,
+    0x76e1be2a1ec22a95, 0x8b1e58ab140dbaf9, 0xa34100b10b2d8253,
+    0x71e195a801939b20, 0x59becdb21eb3a38a, 0xa4412b33147c33e6,
+    0x8c1e73290b5c0b4c, 0xbc7ccd6102c4257e, 0x9423957b1de41dd4,
+    0x69dc73fa172b8db8, 0x41832be0080bb512, 0x9323bef902b5ac61,
+    0xbb7ce6e31d9594cb, 0x46830062175a04a7, 0x6edc5878087a3c0d,
+    0xe2c22b5103263741, 0xca9d734b1c060feb, 0x376295ca16c99f87,
+    0x1f3dcdd009e9a72d, 0xcd9d58c90357be5e, 0xe5c200d31c7786f4,
+    0x183de65216b81698, 0x3062be4809982e32, 0x78f99ac304884bfc,
+    0x50a6c2d91ba87356, 0xad5924581167e33a, 0x85067c420e47db90,
+    0x57a6e95b04f9c2e3, 0x7ff9b1411bd9fa49, 0x820657c011166a25,
+    0xaa590fda0e36528f, 0x26477cf3056a59c3, 0x0e1824e91a4a6169,
+    0xf3e7c2681085f105, 0xdbb89a720fa5c9af, 0x09180f6b051bd0dc,
+    0x214757711a3be876, 0xdcb8b1f010f4781a, 0xf4e7e9ea0fd440b0,
+    0xc48557a2064c6e82, 0xecda0fb8196c5628, 0x1125e93913a3c644,
+    0x397ab1230c83feee, 0xebda243a063de79d, 0xc3857c20191ddf37,
+    0x3e7a9aa113d24f5b, 0x1625c2bb0cf277f1, 0x9a3bb19207ae7cbd,
+    0xb264e988188e4417, 0x4f9b0f091241d47b, 0x67c457130d61ecd1,
+    0xb564c20a07dff5a2, 0x9d3b9a1018ffcd08, 0x60c47c9112305d64,
+    0x489b248b0d1065ce, 0x75ec3b2822bf4f6a, 0x5db363323d9f77c0,
+    0xa04c85b33750e7ac, 0x8813dda92870df06, 0x5ab348b022cec675,
+    0x72ec10aa3deefedf, 0x8f13f62b37216eb3, 0xa74cae3128015619,
+    0x2b52dd18235d5d55, 0x030d85023c7d65ff, 0xfef2638336b2f593,
+    0xd6ad3b992992cd39, 0x040dae80232cd44a, 0x2c52f69a3c0cece0,
+    0xd1ad101b36c37c8c, 0xf9f2480129e34426, 0xc990f649207b6a14,
+    0xe1cfae533f5b52be, 0x1c3048d23594c2d2, 0x346f10c82ab4fa78,
+    0xe6cf85d1200ae30b, 0xce90ddcb3f2adba1, 0x336f3b4a35e54bcd,
+    0x1b3063502ac57367, 0x972e10792199782b, 0xbf7148633eb94081,
+    0x428eaee23476d0ed, 0x6ad1f6f82b56e847, 0xb87163e121e8f134,
+    0x902e3bfb3ec8c99e, 0x6dd1dd7a340759f2, 0x458e85602b276158,
+    0x0d15a1eb26370496, 0x254af9f139173c3c, 0xd8b51f7033d8ac50,
+    0xf0ea476a2cf894fa, 0x224ad27326468d89, 0x0a158a693966b523,
+    0xf7ea6ce833a9254f, 0xdfb534f22c891de5, 0x53ab47db27d516a9,
+    0x7bf41fc138f52e03, 0x860bf940323abe6f, 0xae54a15a2d1a86c5,
+    0x7cf4344327a49fb6, 0x54ab6c593884a71c, 0xa9548ad8324b3770,
+    0x810bd2c22d6b0fda, 0xb1696c8a24f321e8, 0x993634903bd31942,
+    0x64c9d211311c892e, 0x4c968a0b2e3cb184, 0x9e361f122482a8f7,
+    0xb66947083ba2905d, 0x4b96a189316d0031, 0x63c9f9932e4d389b,
+    0xefd78aba251133d7, 0xc788d2a03a310b7d, 0x3a77342130fe9b11,
+    0x12286c3b2fdea3bb, 0xc088f9222560bac8, 0xe8d7a1383a408262,
+    0x152847b9308f120e, 0x3d771fa32faf2aa4, 0xead87750447e9fd4,
+    0xc2872f4a5b5ea77e, 0x3f78c9cb51913712, 0x172791d14eb10fb8,
+    0xc58704c8440f16cb, 0xedd85cd25b2f2e61, 0x1027ba5351e0be0d,
+    0x3878e2494ec086a7, 0xb4669160459c8deb, 0x9c39c97a5abcb541,
+    0x61c62ffb5073252d, 0x499977e14f531d87, 0x9b39e2f845ed04f4,
+    0xb366bae25acd3c5e, 0x4e995c635002ac32, 0x66c604794f229498,
+    0x56a4ba3146babaaa, 0x7efbe22b599a8200, 0x830404aa5355126c,
+    0xab5b5cb04c752ac6, 0x79fbc9a946cb33b5, 0x51a491b359eb0b1f,
+    0xac5b773253249b73, 0x84042f284c04a3d9, 0x081a5c014758a895,
+    0x2045041b5878903f, 0xddbae29a52b70053, 0xf5e5ba804d9738f9,
+    0x27452f994729218a, 0x0f1a778358091920, 0xf2e5910252c6894c,
+    0xdabac9184de6b1e6, 0x9221ed9340f6d428, 0xba7eb5895fd6ec82,
+    0x4781530855197cee, 0x6fde0b124a394444, 0xbd7e9e0b40875d37,
+    0x9521c6115fa7659d, 0x68de20905568f5f1, 0x4081788a4a48cd5b,
+    0xcc9f0ba34114c617, 0xe4c053b95e34febd, 0x193fb53854fb6ed1,
+    0x3160ed224bdb567b, 0xe3c0783b41654f08, 0xcb9f20215e4577a2,
+    0x3660c6a0548ae7ce, 0x1e3f9eba4baadf64, 0x2e5d20f24232f156,
+    0x060278e85d12c9fc, 0xfbfd9e6957dd5990, 0xd3a2c67348fd613a,
+    0x0102536a42437849, 0x295d0b705d6340e3, 0xd4a2edf157acd08f,
+    0xfcfdb5eb488ce825, 0x70e3c6c243d0e369, 0x58bc9ed85cf0dbc3,
+    0xa5437859563f4baf, 0x8d1c2043491f7305, 0x5fbcb55a43a16a76,
+    0x77e3ed405c8152dc, 0x8a1c0bc1564ec2b0, 0xa24353db496efa1a,
+    0x9f344c7866c1d0be, 0xb76b146279e1e814, 0x4a94f2e3732e7878,
+    0x62cbaaf96c0e40d2, 0xb06b3fe066b059a1, 0x983467fa7990610b,
+    0x65cb817b735ff167, 0x4d94d9616c7fc9cd, 0xc18aaa486723c281,
+    0xe9d5f2527803fa2b, 0x142a14d372cc6a47, 0x3c754cc96dec52ed,
+    0xeed5d9d067524b9e, 0xc68a81ca78727334, 0x3b75674b72bde358,
+    0x132a3f516d9ddbf2, 0x234881196405f5c0, 0x0b17d9037b25cd6a,
+    0xf6e83f8271ea5d06, 0xdeb767986eca65ac, 0x0c17f28164747cdf,
+    0x2448aa9b7b544475, 0xd9b74c1a719bd419, 0xf1e814006ebbecb3,
+    0x7df6672965e7e7ff, 0x55a93f337ac7df55, 0xa856d9b270084f39,
+    0x800981a86f287793, 0x52a914b165966ee0, 0x7af64cab7ab6564a,
+    0x8709aa2a7079c626, 0xaf56f2306f59fe8c, 0xe7cdd6bb62499b42,
+    0xcf928ea17d69a3e8, 0x326d682077a63384, 0x1a32303a68860b2e,
+    0xc892a5236238125d, 0xe0cdfd397d182af7, 0x1d321bb877d7ba9b,
+    0x356d43a268f78231, 0xb973308b63ab897d, 0x912c68917c8bb1d7,
+    0x6cd38e10764421bb, 0x448cd60a69641911, 0x962c431363da0062,
+    0xbe731b097cfa38c8, 0x438cfd887635a8a4, 0x6bd3a5926915900e,
+    0x5bb11bda608dbe3c, 0x73ee43c07fad8696, 0x8e11a541756216fa,
+    0xa64efd5b6a422e50, 0x74ee684260fc3723, 0x5cb130587fdc0f89,
+    0xa14ed6d975139fe5, 0x89118ec36a33a74f, 0x050ffdea616fac03,
+    0x2d50a5f07e4f94a9, 0xd0af4371748004c5, 0xf8f01b6b6ba03c6f,
+    0x2a508e72611e251c, 0x020fd6687e3e1db6, 0xfff030e974f18dda,
+    0xd7af68f36bd1b570},
+   {0x0000000000000000, 0xab28624259fd3c0c, 0x5651c484b2fa7918,
+    0xfd79a6c6eb074514, 0xaca2880965f5f330, 0x078aea4b3c08cf3c,
+    0xfaf34c8dd70f8a28, 0x51db2ecf8ef2b624, 0x58451113caeae761,
+    0xf36d73519317db6d, 0x0e14d59778109e79, 0xa53cb7d521eda275,
+    0xf4e7991aaf1f1451, 0x5fcffb58f6e2285d, 0xa2b65d9e1de56d49,
+    0x099e3fdc44185145, 0xb08a222694d5cfc3, 0x1ba24064cd28f3cf,
+    0xe6dbe6a2262fb6db, 0x4df384e07fd28ad7, 0x1c28aa2ff1203cf3,
+    0xb700c86da8dd00ff, 0x4a796eab43da45eb, 0xe1510ce91a2779e7,
+    0xe8cf33355e3f28a2, 0x43e7517707c214ae, 0xbe9ef7b1ecc551ba,
+    0x15b695f3b5386db6, 0x446dbb3c3bcadb92, 0xef45d97e6237e79e,
+    0x123c7fb88930a28a, 0xb9141dfad0cd9e86, 0xe50b4be303044715,
+    0x4e2329a15af97b19, 0xb35a8f67b1fe3e0d, 0x1872ed25e8030201,
+    0x49a9c3ea66f1b425, 0xe281a1a83f0c8829, 0x1ff8076ed40bcd3d,
+    0xb4d0652c8df6f131, 0xbd4e5af0c9eea074, 0x166638b290139c78,
+    0xeb1f9e747b14d96c, 0x4037fc3622e9e560, 0x11ecd2f9ac1b5344,
+    0xbac4b0bbf5e66f48, 0x47bd167d1ee12a5c, 0xec95743f471c1650,
+    0x558169c597d188d6, 0xfea90b87ce2cb4da, 0x03d0ad41252bf1ce,
+    0xa8f8cf037cd6cdc2, 0xf923e1ccf2247be6, 0x520b838eabd947ea,
+    0xaf72254840de02fe, 0x045a470a19233ef2, 0x0dc478d65d3b6fb7,
+    0xa6ec1a9404c653bb, 0x5b95bc52efc116af, 0xf0bdde10b63c2aa3,
+    0xa166f0df38ce9c87, 0x0a4e929d6133a08b, 0xf737345b8a34e59f,
+    0x5c1f5619d3c9d993, 0xca1796c607088e2a, 0x613ff4845ef5b226,
+    0x9c465242b5f2f732, 0x376e3000ec0fcb3e, 0x66b51ecf62fd7d1a,
+    0xcd9d7c8d3b004116, 0x30e4da4bd0070402, 0x9bccb80989fa380e,
+    0x925287d5cde2694b, 0x397ae597941f5547, 0xc40343517f181053,
+    0x6f2b211326e52c5f, 0x3ef00fdca8179a7b, 0x95d86d9ef1eaa677,
+    0x68a1cb581aede363, 0xc389a91a4310df6f, 0x7a9db4e093dd41e9,
+    0xd1b5d6a2ca207de5, 0x2ccc7064212738f1, 0x87e4122678da04fd,
+    0xd63f3ce9f628b2d9, 0x7d175eabafd58ed5, 0x806ef86d44d2cbc1,
+    0x2b469a2f1d2ff7cd, 0x22d8a5f35937a688, 0x89f0c7b100ca9a84,
+    0x74896177ebcddf90, 0xdfa10335b230e39c, 0x8e7a2dfa3cc255b8,
+    0x25524fb8653f69b4, 0xd82be97e8e382ca0, 0x73038b3cd7c510ac,
+    0x2f1cdd25040cc93f, 0x8434bf675df1f533, 0x794d19a1b6f6b027,
+    0xd2657be3ef0b8c2b, 0x83be552c61f93a0f, 0x2896376e38040603,
+    0xd5ef91a8d3034317, 0x7ec7f3ea8afe7f1b, 0x7759cc36cee62e5e,
+    0xdc71ae74971b1252, 0x210808b27c1c5746, 0x8a206af025e16b4a,
+    0xdbfb443fab13dd6e, 0x70d3267df2eee162, 0x8daa80bb19e9a476,
+    0x2682e2f94014987a, 0x9f96ff0390d906fc, 0x34be9d41c9243af0,
+    0xc9c73b8722237fe4, 0x62ef59c57bde43e8, 0x3334770af52cf5cc,
+    0x981c1548acd1c9c0, 0x6565b38e47d68cd4, 0xce4dd1cc1e2bb0d8,
+    0xc7d3ee105a33e19d, 0x6cfb8c5203cedd91, 0x91822a94e8c99885,
+    0x3aaa48d6b134a489, 0x6b7166193fc612ad, 0xc059045b663b2ea1,
+    0x3d20a29d8d3c6bb5, 0x9608c0dfd4c157b9, 0x942f2c8d0f101c55,
+    0x3f074ecf56ed2059, 0xc27ee809bdea654d, 0x69568a4be4175941,
+    0x388da4846ae5ef65, 0x93a5c6c63318d369, 0x6edc6000d81f967d,
+    0xc5f4024281e2aa71, 0xcc6a3d9ec5fafb34, 0x67425fdc9c07c738,
+    0x9a3bf91a7700822c, 0x31139b582efdbe20, 0x60c8b597a00f0804,
+    0xcbe0d7d5f9f23408, 0x3699711312f5711c, 0x9db113514b084d10,
+    0x24a50eab9bc5d396, 0x8f8d6ce9c238ef9a, 0x72f4ca2f293faa8e,
+    0xd9dca86d70c29682, 0x880786a2fe3020a6, 0x232fe4e0a7cd1caa,
+    0xde5642264cca59be, 0x757e2064153765b2, 0x7ce01fb8512f34f7,
+    0xd7c87dfa08d208fb, 0x2ab1db3ce3d54def, 0x8199b97eba2871e3,
+    0xd04297b134dac7c7, 0x7b6af5f36d27fbcb, 0x861353358620bedf,
+    0x2d3b3177dfdd82d3, 0x7124676e0c145b40, 0xda0c052c55e9674c,
+    0x2775a3eabeee2258, 0x8c5dc1a8e7131e54, 0xdd86ef6769e1a870,
+    0x76ae8d25301c947c, 0x8bd72be3db1bd168, 0x20ff49a182e6ed64,
+    0x2961767dc6febc21, 0x8249143f9f03802d, 0x7f30b2f97404c539,
+    0xd418d0bb2df9f935, 0x85c3fe74a30b4f11, 0x2eeb9c36faf6731d,
+    0xd3923af011f13609, 0x78ba58b2480c0a05, 0xc1ae454898c19483,
+    0x6a86270ac13ca88f, 0x97ff81cc2a3bed9b, 0x3cd7e38e73c6d197,
+    0x6d0ccd41fd3467b3, 0xc624af03a4c95bbf, 0x3b5d09c54fce1eab,
+    0x90756b87163322a7, 0x99eb545b522b73e2, 0x32c336190bd64fee,
+    0xcfba90dfe0d10afa, 0x6492f29db92c36f6, 0x3549dc5237de80d2,
+    0x9e61be106e23bcde, 0x631818d68524f9ca, 0xc8307a94dcd9c5c6,
+    0x5e38ba4b0818927f, 0xf510d80951e5ae73, 0x08697ecfbae2eb67,
+    0xa3411c8de31fd76b, 0xf29a32426ded614f, 0x59b2500034105d43,
+    0xa4cbf6c6df171857, 0x0fe3948486ea245b, 0x067dab58c2f2751e,
+    0xad55c91a9b0f4912, 0x502c6fdc70080c06, 0xfb040d9e29f5300a,
+    0xaadf2351a707862e, 0x01f74113fefaba22, 0xfc8ee7d515fdff36,
+    0x57a685974c00c33a, 0xeeb2986d9ccd5dbc, 0x459afa2fc53061b0,
+    0xb8e35ce92e3724a4, 0x13cb3eab77ca18a8, 0x42101064f938ae8c,
+    0xe9387226a0c59280, 0x1441d4e04bc2d794, 0xbf69b6a2123feb98,
+    0xb6f7897e5627badd, 0x1ddfeb3c0fda86d1, 0xe0a64dfae4ddc3c5,
+    0x4b8e2fb8bd20ffc9, 0x1a55017733d249ed, 0xb17d63356a2f75e1,
+    0x4c04c5f3812830f5, 0xe72ca7b1d8d50cf9, 0xbb33f1a80b1cd56a,
+    0x101b93ea52e1e966, 0xed62352cb9e6ac72, 0x464a576ee01b907e,
+    0x179179a16ee9265a, 0xbcb91be337141a56, 0x41c0bd25dc135f42,
+    0xeae8df6785ee634e, 0xe376e0bbc1f6320b, 0x485e82f9980b0e07,
+    0xb527243f730c4b13, 0x1e0f467d2af1771f, 0x4fd468b2a403c13b,
+    0xe4fc0af0fdfefd37, 0x1985ac3616f9b823, 0xb2adce744f04842f,
+    0x0bb9d38e9fc91aa9, 0xa091b1ccc63426a5, 0x5de8170a2d3363b1,
+    0xf6c0754874ce5fbd, 0xa71b5b87fa3ce999, 0x0c3339c5a3c1d595,
+    0xf14a9f0348c69081, 0x5a62fd41113bac8d, 0x53fcc29d5523fdc8,
+    0xf8d4a0df0cdec1c4, 0x05ad0619e7d984d0, 0xae85645bbe24b8dc,
+    0xff5e4a9430d60ef8, 0x547628d6692b32f4, 0xa90f8e10822c77e0,
+    0x0227ec52dbd14bec},
+   {0x0000000000000000, 0xaae25a78f8d45c82, 0xd1dbbb5fdb066196,
+    0x7b39e12723d23d14, 0x27a979109da21abe, 0x8d4b23686576463c,
+    0xf672c24f46a47b28, 0x5c909837be7027aa, 0xcb4cfd8f11eaedee,
+    0x61aea7f7e93eb16c, 0x1a9746d0caec8c78, 0xb0751ca83238d0fa,
+    0xece5849f8c48f750, 0x4607dee7749cabd2, 0x3d3e3fc0574e96c6,
+    0x97dc65b8af9aca44, 0x1387f4b0087b034f, 0xb965aec8f0af5fcd,
+    0xc25c4fefd37d62d9, 0x68be15972ba93e5b, 0x342e8da095d919f1,
+    0x9eccd7d86d0d4573, 0xe5f536ff4edf7867, 0x4f176c87b60b24e5,
+    0xd8cb093f1991eea1, 0x72295347e145b223, 0x0910b260c2978f37,
+    0xa3f2e8183a43d3b5, 0xff62702f8433f41f, 0x55802a577ce7a89d,
+    0x2eb9cb705f359589, 0x845b9108a7e1c90b, 0x260ee96111f6069e,
+    0x8cecb319e9225a1c, 0xf7d5523ecaf06708, 0x5d37084632243b8a,
+    0x01a790718c541c20, 0xab45ca09748040a2, 0xd07c2b2e57527db6,
+    0x7a9e7156af862134, 0xed4214ee001ceb70, 0x47a04e96f8c8b7f2,
+    0x3c99afb1db1a8ae6, 0x967bf5c923ced664, 0xcaeb6dfe9dbef1ce,
+    0x60093786656aad4c, 0x1b30d6a146b89058, 0xb1d28cd9be6cccda,
+    0x35891dd1198d05d1, 0x9f6b47a9e1595953, 0xe452a68ec28b6447,
+    0x4eb0fcf63a5f38c5, 0x122064c1842f1f6f, 0xb8c23eb97cfb43ed,
+    0xc3fbdf9e5f297ef9, 0x691985e6a7fd227b, 0xfec5e05e0867e83f,
+    0x5427ba26f0b3b4bd, 0x2f1e5b01d36189a9, 0x85fc01792bb5d52b,
+    0xd96c994e95c5f281, 0x738ec3366d11ae03, 0x08b722114ec39317,
+    0xa2557869b617cf95, 0xc902dc6c0943d5ae, 0x63e08614f197892c,
+    0x18d96733d245b438, 0xb23b3d4b2a91e8ba, 0xeeaba57c94e1cf10,
+    0x4449ff046c359392, 0x3f701e234fe7ae86, 0x9592445bb733f204,
+    0x024e21e318a93840, 0xa8ac7b9be07d64c2, 0xd3959abcc3af59d6,
+    0x7977c0c43b7b0554, 0x25e758f3850b22fe, 0x8f05028b7ddf7e7c,
+    0xf43ce3ac5e0d4368, 0x5edeb9d4a6d91fea, 0xda8528dc0138d6e1,
+    0x706772a4f9ec8a63, 0x0b5e9383da3eb777, 0xa1bcc9fb22eaebf5,
+    0xfd2c51cc9c9acc5f, 0x57ce0bb4644e90dd, 0x2cf7ea93479cadc9,
+    0x8615b0ebbf48f14b, 0x11c9d55310d23b0f, 0xbb2b8f2be806678d,
+    0xc0126e0ccbd45a99, 0x6af034743300061b, 0x3660ac438d7021b1,
+    0x9c82f63b75a47d33, 0xe7bb171c56764027, 0x4d594d64aea21ca5,
+    0xef0c350d18b5d330, 0x45ee6f75e0618fb2, 0x3ed78e52c3b3b2a6,
+    0x9435d42a3b67ee24, 0xc8a54c1d8517c98e, 0x624716657dc3950c,
+    0x197ef7425e11a818, 0xb39cad3aa6c5f49a, 0x2440c882095f3ede,
+    0x8ea292faf18b625c, 0xf59b73ddd2595f48, 0x5f7929a52a8d03ca,
+    0x03e9b19294fd2460, 0xa90bebea6c2978e2, 0xd2320acd4ffb45f6,
+    0x78d050b5b72f1974, 0xfc8bc1bd10ced07f, 0x56699bc5e81a8cfd,
+    0x2d507ae2cbc8b1e9, 0x87b2209a331ced6b, 0xdb22b8ad8d6ccac1,
+    0x71c0e2d575b89643, 0x0af903f2566aab57, 0xa01b598aaebef7d5,
+    0x37c73c3201243d91, 0x9d25664af9f06113, 0xe61c876dda225c07,
+    0x4cfedd1522f60085, 0x106e45229c86272f, 0xba8c1f5a64527bad,
+    0xc1b5fe7d478046b9, 0x6b57a405bf541a3b, 0x171bb676392972cf,
+    0xbdf9ec0ec1fd2e4d, 0xc6c00d29e22f1359, 0x6c2257511afb4fdb,
+    0x30b2cf66a48b6871, 0x9a50951e5c5f34f3, 0xe16974397f8d09e7,
+    0x4b8b2e4187595565, 0xdc574bf928c39f21, 0x76b51181d017c3a3,
+    0x0d8cf0a6f3c5feb7, 0xa76eaade0b11a235, 0xfbfe32e9b561859f,
+    0x511c68914db5d91d, 0x2a2589b66e67e409, 0x80c7d3ce96b3b88b,
+    0x049c42c631527180, 0xae7e18bec9862d02, 0xd547f999ea541016,
+    0x7fa5a3e112804c94, 0x23353bd6acf06b3e, 0x89d761ae542437bc,
+    0xf2ee808977f60aa8, 0x580cdaf18f22562a, 0xcfd0bf4920b89c6e,
+    0x6532e531d86cc0ec, 0x1e0b0416fbbefdf8, 0xb4e95e6e036aa17a,
+    0xe879c659bd1a86d0, 0x429b9c2145ceda52, 0x39a27d06661ce746,
+    0x9340277e9ec8bbc4, 0x31155f1728df7451, 0x9bf7056fd00b28d3,
+    0xe0cee448f3d915c7, 0x4a2cbe300b0d4945, 0x16bc2607b57d6eef,
+    0xbc5e7c7f4da9326d, 0xc7679d586e7b0f79, 0x6d85c72096af53fb,
+    0xfa59a298393599bf, 0x50bbf8e0c1e1c53d, 0x2b8219c7e233f829,
+    0x816043bf1ae7a4ab, 0xddf0db88a4978301, 0x771281f05c43df83,
+    0x0c2b60d77f91e297, 0xa6c93aaf8745be15, 0x2292aba720a4771e,
+    0x8870f1dfd8702b9c, 0xf34910f8fba21688, 0x59ab4a8003764a0a,
+    0x053bd2b7bd066da0, 0xafd988cf45d23122, 0xd4e069e866000c36,
+    0x7e0233909ed450b4, 0xe9de5628314e9af0, 0x433c0c50c99ac672,
+    0x3805ed77ea48fb66, 0x92e7b70f129ca7e4, 0xce772f38acec804e,
+    0x649575405438dccc, 0x1fac946777eae1d8, 0xb54ece1f8f3ebd5a,
+    0xde196a1a306aa761, 0x74fb3062c8befbe3, 0x0fc2d145eb6cc6f7,
+    0xa5208b3d13b89a75, 0xf9b0130aadc8bddf, 0x53524972551ce15d,
+    0x286ba85576cedc49, 0x8289f22d8e1a80cb, 0x1555979521804a8f,
+    0xbfb7cdedd954160d, 0xc48e2ccafa862b19, 0x6e6c76b20252779b,
+    0x32fcee85bc225031, 0x981eb4fd44f60cb3, 0xe32755da672431a7,
+    0x49c50fa29ff06d25, 0xcd9e9eaa3811a42e, 0x677cc4d2c0c5f8ac,
+    0x1c4525f5e317c5b8, 0xb6a77f8d1bc3993a, 0xea37e7baa5b3be90,
+    0x40d5bdc25d67e212, 0x3bec5ce57eb5df06, 0x910e069d86618384,
+    0x06d2632529fb49c0, 0xac30395dd12f1542, 0xd709d87af2fd2856,
+    0x7deb82020a2974d4, 0x217b1a35b459537e, 0x8b99404d4c8d0ffc,
+    0xf0a0a16a6f5f32e8, 0x5a42fb12978b6e6a, 0xf817837b219ca1ff,
+    0x52f5d903d948fd7d, 0x29cc3824fa9ac069, 0x832e625c024e9ceb,
+    0xdfbefa6bbc3ebb41, 0x755ca01344eae7c3, 0x0e6541346738dad7,
+    0xa4871b4c9fec8655, 0x335b7ef430764c11, 0x99b9248cc8a21093,
+    0xe280c5abeb702d87, 0x48629fd313a47105, 0x14f207e4add456af,
+    0xbe105d9c55000a2d, 0xc529bcbb76d23739, 0x6fcbe6c38e066bbb,
+    0xeb9077cb29e7a2b0, 0x41722db3d133fe32, 0x3a4bcc94f2e1c326,
+    0x90a996ec0a359fa4, 0xcc390edbb445b80e, 0x66db54a34c91e48c,
+    0x1de2b5846f43d998, 0xb700effc9797851a, 0x20dc8a44380d4f5e,
+    0x8a3ed03cc0d913dc, 0xf107311be30b2ec8, 0x5be56b631bdf724a,
+    0x0775f354a5af55e0, 0xad97a92c5d7b0962, 0xd6ae480b7ea93476,
+    0x7c4c1273867d68f4},
+   {0x0000000000000000, 0x0f85c7da6ff8fc31, 0x1e0a8fb5dff0f963,
+    0x118f486fb0080552, 0x3c141e6bbfe1f3c7, 0x3391d9b1d0190ff6,
+    0x221e91de60110aa4, 0x2d9b56040fe9f695, 0xfd363279556c3f1d,
+    0xf2b3f5a33a94c32c, 0xe33cbdcc8a9cc67e, 0xecb97a16e5643a4f,
+    0xc1222c12ea8dccda, 0xcea7ebc8857530eb, 0xdf28a3a7357d35b9,
+    0xd0ad647d5a85c988, 0xfa6d64f2aad87e3a, 0xf5e8a328c520820b,
+    0xe467eb4775288759, 0xebe22c9d1ad07b68, 0xc6797a9915398dfd,
+    0xc9fcbd437ac171cc, 0xd873f52ccac9749e, 0xd7f632f6a53188af,
+    0x075b568bffb44127, 0x08de9151904cbd16, 0x1951d93e2044b844,
+    0x16d41ee44fbc4475, 0x3b4f48e04055b2e0, 0x34ca8f3a2fad4ed1,
+    0x2545c7559fa54b83, 0x2ac0008ff05db7b2, 0xf4dbc8e455b1fd74,
+    0xfb5e0f3e3a490145, 0xead147518a410417, 0xe554808be5b9f826,
+    0xc8cfd68fea500eb3, 0xc74a115585a8f282, 0xd6c5593a35a0f7d0,
+    0xd9409ee05a580be1, 0x09edfa9d00ddc269, 0x06683d476f253e58,
+    0x17e77528df2d3b0a, 0x1862b2f2b0d5c73b, 0x35f9e4f6bf3c31ae,
+    0x3a7c232cd0c4cd9f, 0x2bf36b4360ccc8cd, 0x2476ac990f3434fc,
+    0x0eb6ac16ff69834e, 0x01336bcc90917f7f, 0x10bc23a320997a2d,
+    0x1f39e4794f61861c, 0x32a2b27d40887089, 0x3d2775a72f708cb8,
+    0x2ca83dc89f7889ea, 0x232dfa12f08075db, 0xf3809e6faa05bc53,
+    0xfc0559b5c5fd4062, 0xed8a11da75f54530, 0xe20fd6001a0db901,
+    0xcf94800415e44f94, 0xc01147de7a1cb3a5, 0xd19e0fb1ca14b6f7,
+    0xde1bc86ba5ec4ac6, 0xe8b791c9ab62fbe9, 0xe7325613c49a07d8,
+    0xf6bd1e7c7492028a, 0xf938d9a61b6afebb, 0xd4a38fa21483082e,
+    0xdb2648787b7bf41f, 0xcaa90017cb73f14d, 0xc52cc7cda48b0d7c,
+    0x1581a3b0fe0ec4f4, 0x1a04646a91f638c5, 0x0b8b2c0521fe3d97,
+    0x040eebdf4e06c1a6, 0x2995bddb41ef3733, 0x26107a012e17cb02,
+    0x379f326e9e1fce50, 0x381af5b4f1e73261, 0x12daf53b01ba85d3,
+    0x1d5f32e16e4279e2, 0x0cd07a8ede4a7cb0, 0x0355bd54b1b28081,
+    0x2eceeb50be5b7614, 0x214b2c8ad1a38a25, 0x30c464e561ab8f77,
+    0x3f41a33f0e537346, 0xefecc74254d6bace, 0xe06900983b2e46ff,
+    0xf1e648f78b2643ad, 0xfe638f2de4debf9c, 0xd3f8d929eb374909,
+    0xdc7d1ef384cfb538, 0xcdf2569c34c7b06a, 0xc27791465b3f4c5b,
+    0x1c6c592dfed3069d, 0x13e99ef7912bfaac, 0x0266d6982123fffe,
+    0x0de311424edb03cf, 0x207847464132f55a, 0x2ffd809c2eca096b,
+    0x3e72c8f39ec20c39, 0x31f70f29f13af008, 0xe15a6b54abbf3980,
+    0xeedfac8ec447c5b1, 0xff50e4e1744fc0e3, 0xf0d5233b1bb73cd2,
+    0xdd4e753f145eca47, 0xd2cbb2e57ba63676, 0xc344fa8acbae3324,
+    0xccc13d50a456cf15, 0xe6013ddf540b78a7, 0xe984fa053bf38496,
+    0xf80bb26a8bfb81c4, 0xf78e75b0e4037df5, 0xda1523b4ebea8b60,
+    0xd590e46e84127751, 0xc41fac01341a7203, 0xcb9a6bdb5be28e32,
+    0x1b370fa6016747ba, 0x14b2c87c6e9fbb8b, 0x053d8013de97bed9,
+    0x0ab847c9b16f42e8, 0x272311cdbe86b47d, 0x28a6d617d17e484c,
+    0x39299e7861764d1e, 0x36ac59a20e8eb12f, 0x55712d3c7c6a2e41,
+    0x5af4eae61392d270, 0x4b7ba289a39ad722, 0x44fe6553cc622b13,
+    0x69653357c38bdd86, 0x66e0f48dac7321b7, 0x776fbce21c7b24e5,
+    0x78ea7b387383d8d4, 0xa8471f452906115c, 0xa7c2d89f46feed6d,
+    0xb64d90f0f6f6e83f, 0xb9c8572a990e140e, 0x9453012e96e7e29b,
+    0x9bd6c6f4f91f1eaa, 0x8a598e9b49171bf8, 0x85dc494126efe7c9,
+    0xaf1c49ced6b2507b, 0xa0998e14b94aac4a, 0xb116c67b0942a918,
+    0xbe9301a166ba5529, 0x930857a56953a3bc, 0x9c8d907f06ab5f8d,
+    0x8d02d810b6a35adf, 0x82871fcad95ba6ee, 0x522a7bb783de6f66,
+    0x5dafbc6dec269357, 0x4c20f4025c2e9605, 0x43a533d833d66a34,
+    0x6e3e65dc3c3f9ca1, 0x61bba20653c76090, 0x7034ea69e3cf65c2,
+    0x7fb12db38c3799f3, 0xa1aae5d829dbd335, 0xae2f220246232f04,
+    0xbfa06a6df62b2a56, 0xb025adb799d3d667, 0x9dbefbb3963a20f2,
+    0x923b3c69f9c2dcc3, 0x83b4740649cad991, 0x8c31b3dc263225a0,
+    0x5c9cd7a17cb7ec28, 0x5319107b134f1019, 0x42965814a347154b,
+    0x4d139fceccbfe97a, 0x6088c9cac3561fef, 0x6f0d0e10acaee3de,
+    0x7e82467f1ca6e68c, 0x710781a5735e1abd, 0x5bc7812a8303ad0f,
+    0x544246f0ecfb513e, 0x45cd0e9f5cf3546c, 0x4a48c945330ba85d,
+    0x67d39f413ce25ec8, 0x6856589b531aa2f9, 0x79d910f4e312a7ab,
+    0x765cd72e8cea5b9a, 0xa6f1b353d66f9212, 0xa9747489b9976e23,
+    0xb8fb3ce6099f6b71, 0xb77efb3c66679740, 0x9ae5ad38698e61d5,
+    0x95606ae206769de4, 0x84ef228db67e98b6, 0x8b6ae557d9866487,
+    0xbdc6bcf5d708d5a8, 0xb2437b2fb8f02999, 0xa3cc334008f82ccb,
+    0xac49f49a6700d0fa, 0x81d2a29e68e9266f, 0x8e5765440711da5e,
+    0x9fd82d2bb719df0c, 0x905deaf1d8e1233d, 0x40f08e8c8264eab5,
+    0x4f754956ed9c1684, 0x5efa01395d9413d6, 0x517fc6e3326cefe7,
+    0x7ce490e73d851972, 0x7361573d527de543, 0x62ee1f52e275e011,
+    0x6d6bd8888d8d1c20, 0x47abd8077dd0ab92, 0x482e1fdd122857a3,
+    0x59a157b2a22052f1, 0x56249068cdd8aec0, 0x7bbfc66cc2315855,
+    0x743a01b6adc9a464, 0x65b549d91dc1a136, 0x6a308e0372395d07,
+    0xba9dea7e28bc948f, 0xb5182da4474468be, 0xa49765cbf74c6dec,
+    0xab12a21198b491dd, 0x8689f415975d6748, 0x890c33cff8a59b79,
+    0x98837ba048ad9e2b, 0x9706bc7a2755621a, 0x491d741182b928dc,
+    0x4698b3cbed41d4ed, 0x5717fba45d49d1bf, 0x58923c7e32b12d8e,
+    0x75096a7a3d58db1b, 0x7a8cada052a0272a, 0x6b03e5cfe2a82278,
+    0x648622158d50de49, 0xb42b4668d7d517c1, 0xbbae81b2b82debf0,
+    0xaa21c9dd0825eea2, 0xa5a40e0767dd1293, 0x883f58036834e406,
+    0x87ba9fd907cc1837, 0x9635d7b6b7c41d65, 0x99b0106cd83ce154,
+    0xb37010e3286156e6, 0xbcf5d7394799aad7, 0xad7a9f56f791af85,
+    0xa2ff588c986953b4, 0x8f640e889780a521, 0x80e1c952f8785910,
+    0x916e813d48705c42, 0x9eeb46e72788a073, 0x4e46229a7d0d69fb,
+    0x41c3e54012f595ca, 0x504cad2fa2fd9098, 0x5fc96af5cd056ca9,
+    0x72523cf1c2ec9a3c, 0x7dd7fb2bad14660d, 0x6c58b3441d1c635f,
+    0x63dd749e72e49f6e},
+   {0x0000000000000000, 0xe4daacc49cc2eacb, 0x4dab5726122a0d05,
+    0xa971fbe28ee8e7ce, 0x9a56af4c24541a0a, 0x7e8c0388b896f0c1,
+    0xd7fdf86a367e170f, 0x332754aeaabcfdc4, 0x34ad5e9948a83414,
+    0xd077f25dd46adedf, 0x790609bf5a823911, 0x9ddca57bc640d3da,
+    0xaefbf1d56cfc2e1e, 0x4a215d11f03ec4d5, 0xe350a6f37ed6231b,
+    0x078a0a37e214c9d0, 0x685abd3291506928, 0x8c8011f60d9283e3,
+    0x25f1ea14837a642d, 0xc12b46d01fb88ee6, 0xf20c127eb5047322,
+    0x16d6beba29c699e9, 0xbfa74558a72e7e27, 0x5b7de99c3bec94ec,
+    0x5cf7e3abd9f85d3c, 0xb82d4f6f453ab7f7, 0x115cb48dcbd25039,
+    0xf58618495710baf2, 0xc6a14ce7fdac4736, 0x227be023616eadfd,
+    0x8b0a1bc1ef864a33, 0x6fd0b7057344a0f8, 0xd0b47a6522a1d250,
+    0x346ed6a1be63389b, 0x9d1f2d43308bdf55, 0x79c58187ac49359e,
+    0x4ae2d52906f5c85a, 0xae3879ed9a372291, 0x0749820f14dfc55f,
+    0xe3932ecb881d2f94, 0xe41924fc6a09e644, 0x00c38838f6cb0c8f,
+    0xa9b273da7823eb41, 0x4d68df1ee4e1018a, 0x7e4f8bb04e5dfc4e,
+    0x9a952774d29f1685, 0x33e4dc965c77f14b, 0xd73e7052c0b51b80,
+    0xb8eec757b3f1bb78, 0x5c346b932f3351b3, 0xf5459071a1dbb67d,
+    0x119f3cb53d195cb6, 0x22b8681b97a5a172, 0xc662c4df0b674bb9,
+    0x6f133f3d858fac77, 0x8bc993f9194d46bc, 0x8c4399cefb598f6c,
+    0x6899350a679b65a7, 0xc1e8cee8e9738269, 0x2532622c75b168a2,
+    0x16153682df0d9566, 0xf2cf9a4643cf7fad, 0x5bbe61a4cd279863,
+    0xbf64cd6051e572a8, 0xa069f5ca4442a5a1, 0x44b3590ed8804f6a,
+    0xedc2a2ec5668a8a4, 0x09180e28caaa426f, 0x3a3f5a866016bfab,
+    0xdee5f642fcd45560, 0x77940da0723cb2ae, 0x934ea164eefe5865,
+    0x94c4ab530cea91b5, 0x701e079790287b7e, 0xd96ffc751ec09cb0,
+    0x3db550b18202767b, 0x0e92041f28be8bbf, 0xea48a8dbb47c6174,
+    0x433953393a9486ba, 0xa7e3fffda6566c71, 0xc83348f8d512cc89,
+    0x2ce9e43c49d02642, 0x85981fdec738c18c, 0x6142b31a5bfa2b47,
+    0x5265e7b4f146d683, 0xb6bf4b706d843c48, 0x1fceb092e36cdb86,
+    0xfb141c567fae314d, 0xfc9e16619dbaf89d, 0x1844baa501781256,
+    0xb13541478f90f598, 0x55efed8313521f53, 0x66c8b92db9eee297,
+    0x821215e9252c085c, 0x2b63ee0babc4ef92, 0xcfb942cf37060559,
+    0x70dd8faf66e377f1, 0x9407236bfa219d3a, 0x3d76d88974c97af4,
+    0xd9ac744de80b903f, 0xea8b20e342b76dfb, 0x0e518c27de758730,
+    0xa72077c5509d60fe, 0x43fadb01cc5f8a35, 0x4470d1362e4b43e5,
+    0xa0aa7df2b289a92e, 0x09db86103c614ee0, 0xed012ad4a0a3a42b,
+    0xde267e7a0a1f59ef, 0x3afcd2be96ddb324, 0x938d295c183554ea,
+    0x7757859884f7be21, 0x1887329df7b31ed9, 0xfc5d9e596b71f412,
+    0x552c65bbe59913dc, 0xb1f6c97f795bf917, 0x82d19dd1d3e704d3,
+    0x660b31154f25ee18, 0xcf7acaf7c1cd09d6, 0x2ba066335d0fe31d,
+    0x2c2a6c04bf1b2acd, 0xc8f0c0c023d9c006, 0x61813b22ad3127c8,
+    0x855b97e631f3cd03, 0xb67cc3489b4f30c7, 0x52a66f8c078dda0c,
+    0xfbd7946e89653dc2, 0x1f0d38aa15a7d709, 0xc5cde43aa22b92d1,
+    0x211748fe3ee9781a, 0x8866b31cb0019fd4, 0x6cbc1fd82cc3751f,
+    0x5f9b4b76867f88db, 0xbb41e7b21abd6210, 0x12301c50945585de,
+    0xf6eab09408976f15, 0xf160baa3ea83a6c5, 0x15ba166776414c0e,
+    0xbccbed85f8a9abc0, 0x58114141646b410b, 0x6b3615efced7bccf,
+    0x8fecb92b52155604, 0x269d42c9dcfdb1ca, 0xc247ee0d403f5b01,
+    0xad975908337bfbf9, 0x494df5ccafb91132, 0xe03c0e2e2151f6fc,
+    0x04e6a2eabd931c37, 0x37c1f644172fe1f3, 0xd31b5a808bed0b38,
+    0x7a6aa1620505ecf6, 0x9eb00da699c7063d, 0x993a07917bd3cfed,
+    0x7de0ab55e7112526, 0xd49150b769f9c2e8, 0x304bfc73f53b2823,
+    0x036ca8dd5f87d5e7, 0xe7b60419c3453f2c, 0x4ec7fffb4dadd8e2,
+    0xaa1d533fd16f3229, 0x15799e5f808a4081, 0xf1a3329b1c48aa4a,
+    0x58d2c97992a04d84, 0xbc0865bd0e62a74f, 0x8f2f3113a4de5a8b,
+    0x6bf59dd7381cb040, 0xc2846635b6f4578e, 0x265ecaf12a36bd45,
+    0x21d4c0c6c8227495, 0xc50e6c0254e09e5e, 0x6c7f97e0da087990,
+    0x88a53b2446ca935b, 0xbb826f8aec766e9f, 0x5f58c34e70b48454,
+    0xf62938acfe5c639a, 0x12f39468629e8951, 0x7d23236d11da29a9,
+    0x99f98fa98d18c362, 0x3088744b03f024ac, 0xd452d88f9f32ce67,
+    0xe7758c21358e33a3, 0x03af20e5a94cd968, 0xaadedb0727a43ea6,
+    0x4e0477c3bb66d46d, 0x498e7df459721dbd, 0xad54d130c5b0f776,
+    0x04252ad24b5810b8, 0xe0ff8616d79afa73, 0xd3d8d2b87d2607b7,
+    0x37027e7ce1e4ed7c, 0x9e73859e6f0c0ab2, 0x7aa9295af3cee079,
+    0x65a411f0e6693770, 0x817ebd347aabddbb, 0x280f46d6f4433a75,
+    0xccd5ea126881d0be, 0xfff2bebcc23d2d7a, 0x1b2812785effc7b1,
+    0xb259e99ad017207f, 0x5683455e4cd5cab4, 0x51094f69aec10364,
+    0xb5d3e3ad3203e9af, 0x1ca2184fbceb0e61, 0xf878b48b2029e4aa,
+    0xcb5fe0258a95196e, 0x2f854ce11657f3a5, 0x86f4b70398bf146b,
+    0x622e1bc7047dfea0, 0x0dfeacc277395e58, 0xe9240006ebfbb493,
+    0x4055fbe46513535d, 0xa48f5720f9d1b996, 0x97a8038e536d4452,
+    0x7372af4acfafae99, 0xda0354a841474957, 0x3ed9f86cdd85a39c,
+    0x3953f25b3f916a4c, 0xdd895e9fa3538087, 0x74f8a57d2dbb6749,
+    0x902209b9b1798d82, 0xa3055d171bc57046, 0x47dff1d387079a8d,
+    0xeeae0a3109ef7d43, 0x0a74a6f5952d9788, 0xb5106b95c4c8e520,
+    0x51cac751580a0feb, 0xf8bb3cb3d6e2e825, 0x1c6190774a2002ee,
+    0x2f46c4d9e09cff2a, 0xcb9c681d7c5e15e1, 0x62ed93fff2b6f22f,
+    0x86373f3b6e7418e4, 0x81bd350c8c60d134, 0x656799c810a23bff,
+    0xcc16622a9e4adc31, 0x28ccceee028836fa, 0x1beb9a40a834cb3e,
+    0xff31368434f621f5, 0x5640cd66ba1ec63b, 0xb29a61a226dc2cf0,
+    0xdd4ad6a755988c08, 0x39907a63c95a66c3, 0x90e1818147b2810d,
+    0x743b2d45db706bc6, 0x471c79eb71cc9602, 0xa3c6d52fed0e7cc9,
+    0x0ab72ecd63e69b07, 0xee6d8209ff2471cc, 0xe9e7883e1d30b81c,
+    0x0d3d24fa81f252d7, 0xa44cdf180f1ab519, 0x409673dc93d85fd2,
+    0x73b127723964a216, 0x976b8bb6a5a648dd, 0x3e1a70542b4eaf13,
+    0xdac0dc90b78c45d8},
+   {0x0000000000000000, 0x98b669fd6917f62d, 0x306dd3fad32eec5b,
+    0xa8dbba07ba391a76, 0x60daa6f5a75dd8b7, 0xf86ccf08ce4a2e9a,
+    0x50b7750f747334ec, 0xc8011cf21d64c2c1, 0x45aa4344641468fd,
+    0xdd1c2ab90d039ed0, 0x75c790beb73a84a6, 0xed71f943de2d728b,
+    0x2570e5b1c349b04a, 0xbdc68c4caa5e4667, 0x151d364b10675c11,
+    0x8dab5fb67970aa3c, 0x0f4a8927e3870868, 0x97fce0da8a90fe45,
+    0x3f275add30a9e433, 0xa791332059be121e, 0x6f902fd244dad0df,
+    0xf726462f2dcd26f2, 0x5ffdfc2897f43c84, 0xc74b95d5fee3caa9,
+    0x4ae0ca6387936095, 0xd256a39eee8496b8, 0x7a8d199954bd8cce,
+    0xe23b70643daa7ae3, 0x2a3a6c9620ceb822, 0xb28c056b49d94e0f,
+    0x1a57bf6cf3e05479, 0x82e1d6919af7a254, 0x1e94124fc60f11d0,
+    0x86227bb2af18e7fd, 0x2ef9c1b51521fd8b, 0xb64fa8487c360ba6,
+    0x7e4eb4ba6152c967, 0xe6f8dd4708453f4a, 0x4e236740b27c253c,
+    0xd6950ebddb6bd311, 0x5b3e510ba21b792d, 0xc38838f6cb0c8f00,
+    0x6b5382f171359576, 0xf3e5eb0c1822635b, 0x3be4f7fe0546a19a,
+    0xa3529e036c5157b7, 0x0b892404d6684dc1, 0x933f4df9bf7fbbec,
+    0x11de9b68258819b8, 0x8968f2954c9fef95, 0x21b34892f6a6f5e3,
+    0xb905216f9fb103ce, 0x71043d9d82d5c10f, 0xe9b25460ebc23722,
+    0x4169ee6751fb2d54, 0xd9df879a38ecdb79, 0x5474d82c419c7145,
+    0xccc2b1d1288b8768, 0x64190bd692b29d1e, 0xfcaf622bfba56b33,
+    0x34ae7ed9e6c1a9f2, 0xac1817248fd65fdf, 0x04c3ad2335ef45a9,
+    0x9c75c4de5cf8b384, 0xb9362b31a7b0fa32, 0x218042cccea70c1f,
+    0x895bf8cb749e1669, 0x11ed91361d89e044, 0xd9ec8dc400ed2285,
+    0x415ae43969fad4a8, 0xe9815e3ed3c3cede, 0x713737c3bad438f3,
+    0xfc9c6875c3a492cf, 0x642a0188aab364e2, 0xccf1bb8f108a7e94,
+    0x5447d272799d88b9, 0x9c46ce8064f94a78, 0x04f0a77d0deebc55,
+    0xac2b1d7ab7d7a623, 0x349d7487dec0500e, 0xb67ca2164437f25a,
+    0x2ecacbeb2d200477, 0x861171ec97191e01, 0x1ea71811fe0ee82c,
+    0xd6a604e3e36a2aed, 0x4e106d1e8a7ddcc0, 0xe6cbd7193044c6b6,
+    0x7e7dbee45953309b, 0xf3d6e15220239aa7, 0x6b6088af49346c8a,
+    0xc3bb32a8f30d76fc, 0x5b0d5b559a1a80d1, 0x930c47a7877e4210,
+    0x0bba2e5aee69b43d, 0xa361945d5450ae4b, 0x3bd7fda03d475866,
+    0xa7a2397e61bfebe2, 0x3f14508308a81dcf, 0x97cfea84b29107b9,
+    0x0f798379db86f194, 0xc7789f8bc6e23355, 0x5fcef676aff5c578,
+    0xf7154c7115ccdf0e, 0x6fa3258c7cdb2923, 0xe2087a3a05ab831f,
+    0x7abe13c76cbc7532, 0xd265a9c0d6856f44, 0x4ad3c03dbf929969,
+    0x82d2dccfa2f65ba8, 0x1a64b532cbe1ad85, 0xb2bf0f3571d8b7f3,
+    0x2a0966c818cf41de, 0xa8e8b0598238e38a, 0x305ed9a4eb2f15a7,
+    0x988563a351160fd1, 0x00330a5e3801f9fc, 0xc83216ac25653b3d,
+    0x50847f514c72cd10, 0xf85fc556f64bd766, 0x60e9acab9f5c214b,
+    0xed42f31de62c8b77, 0x75f49ae08f3b7d5a, 0xdd2f20e73502672c,
+    0x4599491a5c159101, 0x8d9855e8417153c0, 0x152e3c152866a5ed,
+    0xbdf58612925fbf9b, 0x2543efeffb4849b6, 0x726d56624e61f565,
+    0xeadb3f9f27760348, 0x420085989d4f193e, 0xdab6ec65f458ef13,
+    0x12b7f097e93c2dd2, 0x8a01996a802bdbff, 0x22da236d3a12c189,
+    0xba6c4a90530537a4, 0x37c715262a759d98, 0xaf717cdb43626bb5,
+    0x07aac6dcf95b71c3, 0x9f1caf21904c87ee, 0x571db3d38d28452f,
+    0xcfabda2ee43fb302, 0x677060295e06a974, 0xffc609d437115f59,
+    0x7d27df45ade6fd0d, 0xe591b6b8c4f10b20, 0x4d4a0cbf7ec81156,
+    0xd5fc654217dfe77b, 0x1dfd79b00abb25ba, 0x854b104d63acd397,
+    0x2d90aa4ad995c9e1, 0xb526c3b7b0823fcc, 0x388d9c01c9f295f0,
+    0xa03bf5fca0e563dd, 0x08e04ffb1adc79ab, 0x9056260673cb8f86,
+    0x58573af46eaf4d47, 0xc0e1530907b8bb6a, 0x683ae90ebd81a11c,
+    0xf08c80f3d4965731, 0x6cf9442d886ee4b5, 0xf44f2dd0e1791298,
+    0x5c9497d75b4008ee, 0xc422fe2a3257fec3, 0x0c23e2d82f333c02,
+    0x94958b254624ca2f, 0x3c4e3122fc1dd059, 0xa4f858df950a2674,
+    0x29530769ec7a8c48, 0xb1e56e94856d7a65, 0x193ed4933f546013,
+    0x8188bd6e5643963e, 0x4989a19c4b2754ff, 0xd13fc8612230a2d2,
+    0x79e472669809b8a4, 0xe1521b9bf11e4e89, 0x63b3cd0a6be9ecdd,
+    0xfb05a4f702fe1af0, 0x53de1ef0b8c70086, 0xcb68770dd1d0f6ab,
+    0x03696bffccb4346a, 0x9bdf0202a5a3c247, 0x3304b8051f9ad831,
+    0xabb2d1f8768d2e1c, 0x26198e4e0ffd8420, 0xbeafe7b366ea720d,
+    0x16745db4dcd3687b, 0x8ec23449b5c49e56, 0x46c328bba8a05c97,
+    0xde754146c1b7aaba, 0x76aefb417b8eb0cc, 0xee1892bc129946e1,
+    0xcb5b7d53e9d10f57, 0x53ed14ae80c6f97a, 0xfb36aea93affe30c,
+    0x6380c75453e81521, 0xab81dba64e8cd7e0, 0x3337b25b279b21cd,
+    0x9bec085c9da23bbb, 0x035a61a1f4b5cd96, 0x8ef13e178dc567aa,
+    0x164757eae4d29187, 0xbe9ceded5eeb8bf1, 0x262a841037fc7ddc,
+    0xee2b98e22a98bf1d, 0x769df11f438f4930, 0xde464b18f9b65346,
+    0x46f022e590a1a56b, 0xc411f4740a56073f, 0x5ca79d896341f112,
+    0xf47c278ed978eb64, 0x6cca4e73b06f1d49, 0xa4cb5281ad0bdf88,
+    0x3c7d3b7cc41c29a5, 0x94a6817b7e2533d3, 0x0c10e8861732c5fe,
+    0x81bbb7306e426fc2, 0x190ddecd075599ef, 0xb1d664cabd6c8399,
+    0x29600d37d47b75b4, 0xe16111c5c91fb775, 0x79d77838a0084158,
+    0xd10cc23f1a315b2e, 0x49baabc27326ad03, 0xd5cf6f1c2fde1e87,
+    0x4d7906e146c9e8aa, 0xe5a2bce6fcf0f2dc, 0x7d14d51b95e704f1,
+    0xb515c9e98883c630, 0x2da3a014e194301d, 0x85781a135bad2a6b,
+    0x1dce73ee32badc46, 0x90652c584bca767a, 0x08d345a522dd8057,
+    0xa008ffa298e49a21, 0x38be965ff1f36c0c, 0xf0bf8aadec97aecd,
+    0x6809e350858058e0, 0xc0d259573fb94296, 0x586430aa56aeb4bb,
+    0xda85e63bcc5916ef, 0x42338fc6a54ee0c2, 0xeae835c11f77fab4,
+    0x725e5c3c76600c99, 0xba5f40ce6b04ce58, 0x22e9293302133875,
+    0x8a329334b82a2203, 0x1284fac9d13dd42e, 0x9f2fa57fa84d7e12,
+    0x0799cc82c15a883f, 0xaf4276857b639249, 0x37f41f7812746464,
+    0xfff5038a0f10a6a5, 0x67436a7766075088, 0xcf98d070dc3e4afe,
+    0x572eb98db529bcd3},
+   {0x0000000000000000, 0xdbbc5710b3877b43, 0xb679af20660ff786,
+    0x6dc5f830d5888cc5, 0xe9ed50eee7b1369f, 0x325107fe54364ddc,
+    0x5f94ffce81bec119, 0x8428a8de3239ba5a, 0x57c5af73e4ccb5ac,
+    0x8c79f863574bceef, 0xe1bc005382c3422a, 0x3a00574331443969,
+    0xbe28ff9d037d8333, 0x6594a88db0faf870, 0x085150bd657274b5,
+    0xd3ed07add6f50ff6, 0x2b945148e336b3cb, 0xf028065850b1c888,
+    0x9dedfe688539444d, 0x4651a97836be3f0e, 0xc27901a604878554,
+    0x19c556b6b700fe17, 0x7400ae86628872d2, 0xafbcf996d10f0991,
+    0x7c51fe3b07fa0667, 0xa7eda92bb47d7d24, 0xca28511b61f5f1e1,
+    0x1194060bd2728aa2, 0x95bcaed5e04b30f8, 0x4e00f9c553cc4bbb,
+    0x23c501f58644c77e, 0xf87956e535c3bc3d, 0xd336ad3fedc2be05,
+    0x088afa2f5e45c546, 0x654f021f8bcd4983, 0xbef3550f384a32c0,
+    0x3adbfdd10a73889a, 0xe167aac1b9f4f3d9, 0x8ca252f16c7c7f1c,
+    0x571e05e1dffb045f, 0x84f3024c090e0ba9, 0x5f4f555cba8970ea,
+    0x328aad6c6f01fc2f, 0xe936fa7cdc86876c, 0x6d1e52a2eebf3d36,
+    0xb6a205b25d384675, 0xdb67fd8288b0cab0, 0x00dbaa923b37b1f3,
+    0xf8a2fc770ef40dce, 0x231eab67bd73768d, 0x4edb535768fbfa48,
+    0x95670447db7c810b, 0x114fac99e9453b51, 0xcaf3fb895ac24012,
+    0xa73603b98f4accd7, 0x7c8a54a93ccdb794, 0xaf675304ea38b862,
+    0x74db041459bfc321, 0x191efc248c374fe4, 0xc2a2ab343fb034a7,
+    0x468a03ea0d898efd, 0x9d3654fabe0ef5be, 0xf0f3acca6b86797b,
+    0x2b4ffbdad8010238, 0xa66d5a7fda857d0b, 0x7dd10d6f69020648,
+    0x1014f55fbc8a8a8d, 0xcba8a24f0f0df1ce, 0x4f800a913d344b94,
+    0x943c5d818eb330d7, 0xf9f9a5b15b3bbc12, 0x2245f2a1e8bcc751,
+    0xf1a8f50c3e49c8a7, 0x2a14a21c8dceb3e4, 0x47d15a2c58463f21,
+    0x9c6d0d3cebc14462, 0x1845a5e2d9f8fe38, 0xc3f9f2f26a7f857b,
+    0xae3c0ac2bff709be, 0x75805dd20c7072fd, 0x8df90b3739b3cec0,
+    0x56455c278a34b583, 0x3b80a4175fbc3946, 0xe03cf307ec3b4205,
+    0x64145bd9de02f85f, 0xbfa80cc96d85831c, 0xd26df4f9b80d0fd9,
+    0x09d1a3e90b8a749a, 0xda3ca444dd7f7b6c, 0x0180f3546ef8002f,
+    0x6c450b64bb708cea, 0xb7f95c7408f7f7a9, 0x33d1f4aa3ace4df3,
+    0xe86da3ba894936b0, 0x85a85b8a5cc1ba75, 0x5e140c9aef46c136,
+    0x755bf7403747c30e, 0xaee7a05084c0b84d, 0xc322586051483488,
+    0x189e0f70e2cf4fcb, 0x9cb6a7aed0f6f591, 0x470af0be63718ed2,
+    0x2acf088eb6f90217, 0xf1735f9e057e7954, 0x229e5833d38b76a2,
+    0xf9220f23600c0de1, 0x94e7f713b5848124, 0x4f5ba0030603fa67,
+    0xcb7308dd343a403d, 0x10cf5fcd87bd3b7e, 0x7d0aa7fd5235b7bb,
+    0xa6b6f0ede1b2ccf8, 0x5ecfa608d47170c5, 0x8573f11867f60b86,
+    0xe8b60928b27e8743, 0x330a5e3801f9fc00, 0xb722f6e633c0465a,
+    0x6c9ea1f680473d19, 0x015b59c655cfb1dc, 0xdae70ed6e648ca9f,
+    0x090a097b30bdc569, 0xd2b65e6b833abe2a, 0xbf73a65b56b232ef,
+    0x64cff14be53549ac, 0xe0e75995d70cf3f6, 0x3b5b0e85648b88b5,
+    0x569ef6b5b1030470, 0x8d22a1a502847f33, 0x4cdbb4feb40bfb16,
+    0x9767e3ee078c8055, 0xfaa21bded2040c90, 0x211e4cce618377d3,
+    0xa536e41053bacd89, 0x7e8ab300e03db6ca, 0x134f4b3035b53a0f,
+    0xc8f31c208632414c, 0x1b1e1b8d50c74eba, 0xc0a24c9de34035f9,
+    0xad67b4ad36c8b93c, 0x76dbe3bd854fc27f, 0xf2f34b63b7767825,
+    0x294f1c7304f10366, 0x448ae443d1798fa3, 0x9f36b35362fef4e0,
+    0x674fe5b6573d48dd, 0xbcf3b2a6e4ba339e, 0xd1364a963132bf5b,
+    0x0a8a1d8682b5c418, 0x8ea2b558b08c7e42, 0x551ee248030b0501,
+    0x38db1a78d68389c4, 0xe3674d686504f287, 0x308a4ac5b3f1fd71,
+    0xeb361dd500768632, 0x86f3e5e5d5fe0af7, 0x5d4fb2f5667971b4,
+    0xd9671a2b5440cbee, 0x02db4d3be7c7b0ad, 0x6f1eb50b324f3c68,
+    0xb4a2e21b81c8472b, 0x9fed19c159c94513, 0x44514ed1ea4e3e50,
+    0x2994b6e13fc6b295, 0xf228e1f18c41c9d6, 0x7600492fbe78738c,
+    0xadbc1e3f0dff08cf, 0xc079e60fd877840a, 0x1bc5b11f6bf0ff49,
+    0xc828b6b2bd05f0bf, 0x1394e1a20e828bfc, 0x7e511992db0a0739,
+    0xa5ed4e82688d7c7a, 0x21c5e65c5ab4c620, 0xfa79b14ce933bd63,
+    0x97bc497c3cbb31a6, 0x4c001e6c8f3c4ae5, 0xb4794889bafff6d8,
+    0x6fc51f9909788d9b, 0x0200e7a9dcf0015e, 0xd9bcb0b96f777a1d,
+    0x5d9418675d4ec047, 0x86284f77eec9bb04, 0xebedb7473b4137c1,
+    0x3051e05788c64c82, 0xe3bce7fa5e334374, 0x3800b0eaedb43837,
+    0x55c548da383cb4f2, 0x8e791fca8bbbcfb1, 0x0a51b714b98275eb,
+    0xd1ede0040a050ea8, 0xbc281834df8d826d, 0x67944f246c0af92e,
+    0xeab6ee816e8e861d, 0x310ab991dd09fd5e, 0x5ccf41a10881719b,
+    0x877316b1bb060ad8, 0x035bbe6f893fb082, 0xd8e7e97f3ab8cbc1,
+    0xb522114fef304704, 0x6e9e465f5cb73c47, 0xbd7341f28a4233b1,
+    0x66cf16e239c548f2, 0x0b0aeed2ec4dc437, 0xd0b6b9c25fcabf74,
+    0x549e111c6df3052e, 0x8f22460cde747e6d, 0xe2e7be3c0bfcf2a8,
+    0x395be92cb87b89eb, 0xc122bfc98db835d6, 0x1a9ee8d93e3f4e95,
+    0x775b10e9ebb7c250, 0xace747f95830b913, 0x28cfef276a090349,
+    0xf373b837d98e780a, 0x9eb640070c06f4cf, 0x450a1717bf818f8c,
+    0x96e710ba6974807a, 0x4d5b47aadaf3fb39, 0x209ebf9a0f7b77fc,
+    0xfb22e88abcfc0cbf, 0x7f0a40548ec5b6e5, 0xa4b617443d42cda6,
+    0xc973ef74e8ca4163, 0x12cfb8645b4d3a20, 0x398043be834c3818,
+    0xe23c14ae30cb435b, 0x8ff9ec9ee543cf9e, 0x5445bb8e56c4b4dd,
+    0xd06d135064fd0e87, 0x0bd14440d77a75c4, 0x6614bc7002f2f901,
+    0xbda8eb60b1758242, 0x6e45eccd67808db4, 0xb5f9bbddd407f6f7,
+    0xd83c43ed018f7a32, 0x038014fdb2080171, 0x87a8bc238031bb2b,
+    0x5c14eb3333b6c068, 0x31d11303e63e4cad, 0xea6d441355b937ee,
+    0x121412f6607a8bd3, 0xc9a845e6d3fdf090, 0xa46dbdd606757c55,
+    0x7fd1eac6b5f20716, 0xfbf9421887cbbd4c, 0x20451508344cc60f,
+    0x4d80ed38e1c44aca, 0x963cba2852433189, 0x45d1bd8584b63e7f,
+    0x9e6dea953731453c, 0xf3a812a5e2b9c9f9, 0x281445b5513eb2ba,
+    0xac3ced6b630708e0, 0x7780ba7bd08073a3, 0x1a45424b0508ff66,
+    0xc1f9155bb68f8425},
+   {0x0000000000000000, 0x44fa9e8a005b0960, 0x88f43d1501b612c0,
+    0xcc0ea39f01ed1ba0, 0x95f7758529c3fd12, 0xd10deb0f2998f472,
+    0x1d0348902875efd2, 0x59f9d61a282ee6b2, 0x2aefeb0a5386fb25,
+    0x6e15758053ddf245, 0xa21bd61f5230e9e5, 0xe6e14895526be085,
+    0xbf189e8f7a450637, 0xfbe200057a1e0f57, 0x37eca39a7bf314f7,
+    0x73163d107ba81d97, 0x54ded715a60cf74b, 0x1024499fa657fe2b,
+    0xdc2aea00a7bae58b, 0x98d0748aa7e1eceb, 0xc129a2908fcf0a59,
+    0x85d33c1a8f940339, 0x49dd9f858e791899, 0x0d27010f8e2211f9,
+    0x7e313c1ff58a0c6e, 0x3acba295f5d1050e, 0xf6c5010af43c1eae,
+    0xb23f9f80f46717ce, 0xebc6499adc49f17c, 0xaf3cd710dc12f81c,
+    0x6332748fddffe3bc, 0x27c8ea05dda4eadc, 0xa8bcaf2b4c19ee97,
+    0xec4631a14c42e7f7, 0x2048923e4daffc57, 0x64b20cb44df4f537,
+    0x3d4bdaae65da1385, 0x79b1442465811ae5, 0xb5bfe7bb646c0145,
+    0xf145793164370825, 0x825344211f9f15b2, 0xc6a9daab1fc41cd2,
+    0x0aa779341e290772, 0x4e5de7be1e720e12, 0x17a431a4365ce8a0,
+    0x535eaf2e3607e1c0, 0x9f500cb137eafa60, 0xdbaa923b37b1f300,
+    0xfc62783eea1519dc, 0xb898e6b4ea4e10bc, 0x7496452beba30b1c,
+    0x306cdba1ebf8027c, 0x69950dbbc3d6e4ce, 0x2d6f9331c38dedae,
+    0xe16130aec260f60e, 0xa59bae24c23bff6e, 0xd68d9334b993e2f9,
+    0x92770dbeb9c8eb99, 0x5e79ae21b825f039, 0x1a8330abb87ef959,
+    0x437ae6b190501feb, 0x0780783b900b168b, 0xcb8edba491e60d2b,
+    0x8f74452e91bd044b, 0xd56751f8b39d04bd, 0x919dcf72b3c60ddd,
+    0x5d936cedb22b167d, 0x1969f267b2701f1d, 0x4090247d9a5ef9af,
+    0x046abaf79a05f0cf, 0xc86419689be8eb6f, 0x8c9e87e29bb3e20f,
+    0xff88baf2e01bff98, 0xbb722478e040f6f8, 0x777c87e7e1aded58,
+    0x3386196de1f6e438, 0x6a7fcf77c9d8028a, 0x2e8551fdc9830bea,
+    0xe28bf262c86e104a, 0xa6716ce8c835192a, 0x81b986ed1591f3f6,
+    0xc543186715cafa96, 0x094dbbf81427e136, 0x4db72572147ce856,
+    0x144ef3683c520ee4, 0x50b46de23c090784, 0x9cbace7d3de41c24,
+    0xd84050f73dbf1544, 0xab566de7461708d3, 0xefacf36d464c01b3,
+    0x23a250f247a11a13, 0x6758ce7847fa1373, 0x3ea118626fd4f5c1,
+    0x7a5b86e86f8ffca1, 0xb65525776e62e701, 0xf2afbbfd6e39ee61,
+    0x7ddbfed3ff84ea2a, 0x39216059ffdfe34a, 0xf52fc3c6fe32f8ea,
+    0xb1d55d4cfe69f18a, 0xe82c8b56d6471738, 0xacd615dcd61c1e58,
+    0x60d8b643d7f105f8, 0x242228c9d7aa0c98, 0x573415d9ac02110f,
+    0x13ce8b53ac59186f, 0xdfc028ccadb403cf, 0x9b3ab646adef0aaf,
+    0xc2c3605c85c1ec1d, 0x8639fed6859ae57d, 0x4a375d498477fedd,
+    0x0ecdc3c3842cf7bd, 0x290529c659881d61, 0x6dffb74c59d31401,
+    0xa1f114d3583e0fa1, 0xe50b8a59586506c1, 0xbcf25c43704be073,
+    0xf808c2c97010e913, 0x3406615671fdf2b3, 0x70fcffdc71a6fbd3,
+    0x03eac2cc0a0ee644, 0x47105c460a55ef24, 0x8b1effd90bb8f484,
+    0xcfe461530be3fde4, 0x961db74923cd1b56, 0xd2e729c323961236,
+    0x1ee98a5c227b0996, 0x5a1314d6222000f6, 0x2fd1ac5f4c94d1e8,
+    0x6b2b32d54ccfd888, 0xa725914a4d22c328, 0xe3df0fc04d79ca48,
+    0xba26d9da65572cfa, 0xfedc4750650c259a, 0x32d2e4cf64e13e3a,
+    0x76287a4564ba375a, 0x053e47551f122acd, 0x41c4d9df1f4923ad,
+    0x8dca7a401ea4380d, 0xc930e4ca1eff316d, 0x90c932d036d1d7df,
+    0xd433ac5a368adebf, 0x183d0fc53767c51f, 0x5cc7914f373ccc7f,
+    0x7b0f7b4aea9826a3, 0x3ff5e5c0eac32fc3, 0xf3fb465feb2e3463,
+    0xb701d8d5eb753d03, 0xeef80ecfc35bdbb1, 0xaa029045c300d2d1,
+    0x660c33dac2edc971, 0x22f6ad50c2b6c011, 0x51e09040b91edd86,
+    0x151a0ecab945d4e6, 0xd914ad55b8a8cf46, 0x9dee33dfb8f3c626,
+    0xc417e5c590dd2094, 0x80ed7b4f908629f4, 0x4ce3d8d0916b3254,
+    0x0819465a91303b34, 0x876d0374008d3f7f, 0xc3979dfe00d6361f,
+    0x0f993e61013b2dbf, 0x4b63a0eb016024df, 0x129a76f1294ec26d,
+    0x5660e87b2915cb0d, 0x9a6e4be428f8d0ad, 0xde94d56e28a3d9cd,
+    0xad82e87e530bc45a, 0xe97876f45350cd3a, 0x2576d56b52bdd69a,
+    0x618c4be152e6dffa, 0x38759dfb7ac83948, 0x7c8f03717a933028,
+    0xb081a0ee7b7e2b88, 0xf47b3e647b2522e8, 0xd3b3d461a681c834,
+    0x97494aeba6dac154, 0x5b47e974a737daf4, 0x1fbd77fea76cd394,
+    0x4644a1e48f423526, 0x02be3f6e8f193c46, 0xceb09cf18ef427e6,
+    0x8a4a027b8eaf2e86, 0xf95c3f6bf5073311, 0xbda6a1e1f55c3a71,
+    0x71a8027ef4b121d1, 0x35529cf4f4ea28b1, 0x6cab4aeedcc4ce03,
+    0x2851d464dc9fc763, 0xe45f77fbdd72dcc3, 0xa0a5e971dd29d5a3,
+    0xfab6fda7ff09d555, 0xbe4c632dff52dc35, 0x7242c0b2febfc795,
+    0x36b85e38fee4cef5, 0x6f418822d6ca2847, 0x2bbb16a8d6912127,
+    0xe7b5b537d77c3a87, 0xa34f2bbdd72733e7, 0xd05916adac8f2e70,
+    0x94a38827acd42710, 0x58ad2bb8ad393cb0, 0x1c57b532ad6235d0,
+    0x45ae6328854cd362, 0x0154fda28517da02, 0xcd5a5e3d84fac1a2,
+    0x89a0c0b784a1c8c2, 0xae682ab25905221e, 0xea92b438595e2b7e,
+    0x269c17a758b330de, 0x6266892d58e839be, 0x3b9f5f3770c6df0c,
+    0x7f65c1bd709dd66c, 0xb36b62227170cdcc, 0xf791fca8712bc4ac,
+    0x8487c1b80a83d93b, 0xc07d5f320ad8d05b, 0x0c73fcad0b35cbfb,
+    0x488962270b6ec29b, 0x1170b43d23402429, 0x558a2ab7231b2d49,
+    0x9984892822f636e9, 0xdd7e17a222ad3f89, 0x520a528cb3103bc2,
+    0x16f0cc06b34b32a2, 0xdafe6f99b2a62902, 0x9e04f113b2fd2062,
+    0xc7fd27099ad3c6d0, 0x8307b9839a88cfb0, 0x4f091a1c9b65d410,
+    0x0bf384969b3edd70, 0x78e5b986e096c0e7, 0x3c1f270ce0cdc987,
+    0xf0118493e120d227, 0xb4eb1a19e17bdb47, 0xed12cc03c9553df5,
+    0xa9e85289c90e3495, 0x65e6f116c8e32f35, 0x211c6f9cc8b82655,
+    0x06d48599151ccc89, 0x422e1b131547c5e9, 0x8e20b88c14aade49,
+    0xcada260614f1d729, 0x9323f01c3cdf319b, 0xd7d96e963c8438fb,
+    0x1bd7cd093d69235b, 0x5f2d53833d322a3b, 0x2c3b6e93469a37ac,
+    0x68c1f01946c13ecc, 0xa4cf5386472c256c, 0xe035cd0c47772c0c,
+    0xb9cc1b166f59cabe, 0xfd36859c6f02c3de, 0x313826036eefd87e,
+    0x75c2b8896eb4d11e}};
+
+#endif /* N == 4 */
+#if N == 5
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0x69a35d91c3730254, 0xd346bb2386e604a8,
+    0xbae5e6b2459506fc, 0x3455d96ca2c217d5, 0x5df684fd61b11581,
+    0xe713624f2424137d, 0x8eb03fdee7571129, 0x68abb2d945842faa,
+    0x0108ef4886f72dfe, 0xbbed09fac3622b02, 0xd24e546b00112956,
+    0x5cfe6bb5e746387f, 0x355d362424353a2b, 0x8fb8d09661a03cd7,
+    0xe61b8d07a2d33e83, 0xd15765b28b085f54, 0xb8f43823487b5d00,
+    0x0211de910dee5bfc, 0x6bb28300ce9d59a8, 0xe502bcde29ca4881,
+    0x8ca1e14feab94ad5, 0x364407fdaf2c4c29, 0x5fe75a6c6c5f4e7d,
+    0xb9fcd76bce8c70fe, 0xd05f8afa0dff72aa, 0x6aba6c48486a7456,
+    0x031931d98b197602, 0x8da90e076c4e672b, 0xe40a5396af3d657f,
+    0x5eefb524eaa86383, 0x374ce8b529db61d7, 0x3076644eb91ea02d,
+    0x59d539df7a6da279, 0xe330df6d3ff8a485, 0x8a9382fcfc8ba6d1,
+    0x0423bd221bdcb7f8, 0x6d80e0b3d8afb5ac, 0xd76506019d3ab350,
+    0xbec65b905e49b104, 0x58ddd697fc9a8f87, 0x317e8b063fe98dd3,
+    0x8b9b6db47a7c8b2f, 0xe2383025b90f897b, 0x6c880ffb5e589852,
+    0x052b526a9d2b9a06, 0xbfceb4d8d8be9cfa, 0xd66de9491bcd9eae,
+    0xe12101fc3216ff79, 0x88825c6df165fd2d, 0x3267badfb4f0fbd1,
+    0x5bc4e74e7783f985, 0xd574d89090d4e8ac, 0xbcd7850153a7eaf8,
+    0x063263b31632ec04, 0x6f913e22d541ee50, 0x898ab3257792d0d3,
+    0xe029eeb4b4e1d287, 0x5acc0806f174d47b, 0x336f55973207d62f,
+    0xbddf6a49d550c706, 0xd47c37d81623c552, 0x6e99d16a53b6c3ae,
+    0x073a8cfb90c5c1fa, 0x60ecc89d723d405a, 0x094f950cb14e420e,
+    0xb3aa73bef4db44f2, 0xda092e2f37a846a6, 0x54b911f1d0ff578f,
+    0x3d1a4c60138c55db, 0x87ffaad256195327, 0xee5cf743956a5173,
+    0x08477a4437b96ff0, 0x61e427d5f4ca6da4, 0xdb01c167b15f6b58,
+    0xb2a29cf6722c690c, 0x3c12a328957b7825, 0x55b1feb956087a71,
+    0xef54180b139d7c8d, 0x86f7459ad0ee7ed9, 0xb1bbad2ff9351f0e,
+    0xd818f0be3a461d5a, 0x62fd160c7fd31ba6, 0x0b5e4b9dbca019f2,
+    0x85ee74435bf708db, 0xec4d29d298840a8f, 0x56a8cf60dd110c73,
+    0x3f0b92f11e620e27, 0xd9101ff6bcb130a4, 0xb0b342677fc232f0,
+    0x0a56a4d53a57340c, 0x63f5f944f9243658, 0xed45c69a1e732771,
+    0x84e69b0bdd002525, 0x3e037db9989523d9, 0x57a020285be6218d,
+    0x509aacd3cb23e077, 0x3939f1420850e223, 0x83dc17f04dc5e4df,
+    0xea7f4a618eb6e68b, 0x64cf75bf69e1f7a2, 0x0d6c282eaa92f5f6,
+    0xb789ce9cef07f30a, 0xde2a930d2c74f15e, 0x38311e0a8ea7cfdd,
+    0x5192439b4dd4cd89, 0xeb77a5290841cb75, 0x82d4f8b8cb32c921,
+    0x0c64c7662c65d808, 0x65c79af7ef16da5c, 0xdf227c45aa83dca0,
+    0xb68121d469f0def4, 0x81cdc961402bbf23, 0xe86e94f08358bd77,
+    0x528b7242c6cdbb8b, 0x3b282fd305beb9df, 0xb598100de2e9a8f6,
+    0xdc3b4d9c219aaaa2, 0x66deab2e640fac5e, 0x0f7df6bfa77cae0a,
+    0xe9667bb805af9089, 0x80c52629c6dc92dd, 0x3a20c09b83499421,
+    0x53839d0a403a9675, 0xdd33a2d4a76d875c, 0xb490ff45641e8508,
+    0x0e7519f7218b83f4, 0x67d64466e2f881a0, 0xc1d9913ae47a80b4,
+    0xa87accab270982e0, 0x129f2a19629c841c, 0x7b3c7788a1ef8648,
+    0xf58c485646b89761, 0x9c2f15c785cb9535, 0x26caf375c05e93c9,
+    0x4f69aee4032d919d, 0xa97223e3a1feaf1e, 0xc0d17e72628dad4a,
+    0x7a3498c02718abb6, 0x1397c551e46ba9e2, 0x9d27fa8f033cb8cb,
+    0xf484a71ec04fba9f, 0x4e6141ac85dabc63, 0x27c21c3d46a9be37,
+    0x108ef4886f72dfe0, 0x792da919ac01ddb4, 0xc3c84fabe994db48,
+    0xaa6b123a2ae7d91c, 0x24db2de4cdb0c835, 0x4d7870750ec3ca61,
+    0xf79d96c74b56cc9d, 0x9e3ecb568825cec9, 0x782546512af6f04a,
+    0x11861bc0e985f21e, 0xab63fd72ac10f4e2, 0xc2c0a0e36f63f6b6,
+    0x4c709f3d8834e79f, 0x25d3c2ac4b47e5cb, 0x9f36241e0ed2e337,
+    0xf695798fcda1e163, 0xf1aff5745d642099, 0x980ca8e59e1722cd,
+    0x22e94e57db822431, 0x4b4a13c618f12665, 0xc5fa2c18ffa6374c,
+    0xac5971893cd53518, 0x16bc973b794033e4, 0x7f1fcaaaba3331b0,
+    0x990447ad18e00f33, 0xf0a71a3cdb930d67, 0x4a42fc8e9e060b9b,
+    0x23e1a11f5d7509cf, 0xad519ec1ba2218e6, 0xc4f2c35079511ab2,
+    0x7e1725e23cc41c4e, 0x17b47873ffb71e1a, 0x20f890c6d66c7fcd,
+    0x495bcd57151f7d99, 0xf3be2be5508a7b65, 0x9a1d767493f97931,
+    0x14ad49aa74ae6818, 0x7d0e143bb7dd6a4c, 0xc7ebf289f2486cb0,
+    0xae48af18313b6ee4, 0x4853221f93e85067, 0x21f07f8e509b5233,
+    0x9b15993c150e54cf, 0xf2b6c4add67d569b, 0x7c06fb73312a47b2,
+    0x15a5a6e2f25945e6, 0xaf404050b7cc431a, 0xc6e31dc174bf414e,
+    0xa13559a79647c0ee, 0xc89604365534c2ba, 0x7273e28410a1c446,
+    0x1bd0bf15d3d2c612, 0x956080cb3485d73b, 0xfcc3dd5af7f6d56f,
+    0x46263be8b263d393, 0x2f8566797110d1c7, 0xc99eeb7ed3c3ef44,
+    0xa03db6ef10b0ed10, 0x1ad8505d5525ebec, 0x737b0dcc9656e9b8,
+    0xfdcb32127101f891, 0x94686f83b272fac5, 0x2e8d8931f7e7fc39,
+    0x472ed4a03494fe6d, 0x70623c151d4f9fba, 0x19c16184de3c9dee,
+    0xa32487369ba99b12, 0xca87daa758da9946, 0x4437e579bf8d886f,
+    0x2d94b8e87cfe8a3b, 0x97715e5a396b8cc7, 0xfed203cbfa188e93,
+    0x18c98ecc58cbb010, 0x716ad35d9bb8b244, 0xcb8f35efde2db4b8,
+    0xa22c687e1d5eb6ec, 0x2c9c57a0fa09a7c5, 0x453f0a31397aa591,
+    0xffdaec837cefa36d, 0x9679b112bf9ca139, 0x91433de92f5960c3,
+    0xf8e06078ec2a6297, 0x420586caa9bf646b, 0x2ba6db5b6acc663f,
+    0xa516e4858d9b7716, 0xccb5b9144ee87542, 0x76505fa60b7d73be,
+    0x1ff30237c80e71ea, 0xf9e88f306add4f69, 0x904bd2a1a9ae4d3d,
+    0x2aae3413ec3b4bc1, 0x430d69822f484995, 0xcdbd565cc81f58bc,
+    0xa41e0bcd0b6c5ae8, 0x1efbed7f4ef95c14, 0x7758b0ee8d8a5e40,
+    0x4014585ba4513f97, 0x29b705ca67223dc3, 0x9352e37822b73b3f,
+    0xfaf1bee9e1c4396b, 0x7441813706932842, 0x1de2dca6c5e02a16,
+    0xa7073a1480752cea, 0xcea4678543062ebe, 0x28bfea82e1d5103d,
+    0x411cb71322a61269, 0xfbf951a167331495, 0x925a0c30a44016c1,
+    0x1cea33ee431707e8, 0x75496e7f806405bc, 0xcfac88cdc5f10340,
+    0xa60fd55c06820114},
+   {0x0000000000000000, 0x116b8d5e67fb1fed, 0x22d71abccff63fda,
+    0x33bc97e2a80d2037, 0x45ae35799fec7fb4, 0x54c5b827f8176059,
+    0x67792fc5501a406e, 0x7612a29b37e15f83, 0x8b5c6af33fd8ff68,
+    0x9a37e7ad5823e085, 0xa98b704ff02ec0b2, 0xb8e0fd1197d5df5f,
+    0xcef25f8aa03480dc, 0xdf99d2d4c7cf9f31, 0xec2545366fc2bf06,
+    0xfd4ec8680839a0eb, 0x84607acdd0bfe055, 0x950bf793b744ffb8,
+    0xa6b760711f49df8f, 0xb7dced2f78b2c062, 0xc1ce4fb44f539fe1,
+    0xd0a5c2ea28a8800c, 0xe319550880a5a03b, 0xf272d856e75ebfd6,
+    0x0f3c103eef671f3d, 0x1e579d60889c00d0, 0x2deb0a82209120e7,
+    0x3c8087dc476a3f0a, 0x4a922547708b6089, 0x5bf9a81917707f64,
+    0x68453ffbbf7d5f53, 0x792eb2a5d88640be, 0x9a185ab00e71de2f,
+    0x8b73d7ee698ac1c2, 0xb8cf400cc187e1f5, 0xa9a4cd52a67cfe18,
+    0xdfb66fc9919da19b, 0xcedde297f666be76, 0xfd6175755e6b9e41,
+    0xec0af82b399081ac, 0x1144304331a92147, 0x002fbd1d56523eaa,
+    0x33932afffe5f1e9d, 0x22f8a7a199a40170, 0x54ea053aae455ef3,
+    0x45818864c9be411e, 0x763d1f8661b36129, 0x675692d806487ec4,
+    0x1e78207ddece3e7a, 0x0f13ad23b9352197, 0x3caf3ac1113801a0,
+    0x2dc4b79f76c31e4d, 0x5bd61504412241ce, 0x4abd985a26d95e23,
+    0x79010fb88ed47e14, 0x686a82e6e92f61f9, 0x95244a8ee116c112,
+    0x844fc7d086eddeff, 0xb7f350322ee0fec8, 0xa698dd6c491be125,
+    0xd08a7ff77efabea6, 0xc1e1f2a91901a14b, 0xf25d654bb10c817c,
+    0xe336e815d6f79e91, 0xa6e81a4bb3eda2db, 0xb7839715d416bd36,
+    0x843f00f77c1b9d01, 0x95548da91be082ec, 0xe3462f322c01dd6f,
+    0xf22da26c4bfac282, 0xc191358ee3f7e2b5, 0xd0fab8d0840cfd58,
+    0x2db470b88c355db3, 0x3cdffde6ebce425e, 0x0f636a0443c36269,
+    0x1e08e75a24387d84, 0x681a45c113d92207, 0x7971c89f74223dea,
+    0x4acd5f7ddc2f1ddd, 0x5ba6d223bbd40230, 0x228860866352428e,
+    0x33e3edd804a95d63, 0x005f7a3aaca47d54, 0x1134f764cb5f62b9,
+    0x672655fffcbe3d3a, 0x764dd8a19b4522d7, 0x45f14f43334802e0,
+    0x549ac21d54b31d0d, 0xa9d40a755c8abde6, 0xb8bf872b3b71a20b,
+    0x8b0310c9937c823c, 0x9a689d97f4879dd1, 0xec7a3f0cc366c252,
+    0xfd11b252a49dddbf, 0xcead25b00c90fd88, 0xdfc6a8ee6b6be265,
+    0x3cf040fbbd9c7cf4, 0x2d9bcda5da676319, 0x1e275a47726a432e,
+    0x0f4cd71915915cc3, 0x795e758222700340, 0x6835f8dc458b1cad,
+    0x5b896f3eed863c9a, 0x4ae2e2608a7d2377, 0xb7ac2a088244839c,
+    0xa6c7a756e5bf9c71, 0x957b30b44db2bc46, 0x8410bdea2a49a3ab,
+    0xf2021f711da8fc28, 0xe369922f7a53e3c5, 0xd0d505cdd25ec3f2,
+    0xc1be8893b5a5dc1f, 0xb8903a366d239ca1, 0xa9fbb7680ad8834c,
+    0x9a47208aa2d5a37b, 0x8b2cadd4c52ebc96, 0xfd3e0f4ff2cfe315,
+    0xec5582119534fcf8, 0xdfe915f33d39dccf, 0xce8298ad5ac2c322,
+    0x33cc50c552fb63c9, 0x22a7dd9b35007c24, 0x111b4a799d0d5c13,
+    0x0070c727faf643fe, 0x766265bccd171c7d, 0x6709e8e2aaec0390,
+    0x54b57f0002e123a7, 0x45def25e651a3c4a, 0xdf089bbcc8d55b33,
+    0xce6316e2af2e44de, 0xfddf8100072364e9, 0xecb40c5e60d87b04,
+    0x9aa6aec557392487, 0x8bcd239b30c23b6a, 0xb871b47998cf1b5d,
+    0xa91a3927ff3404b0, 0x5454f14ff70da45b, 0x453f7c1190f6bbb6,
+    0x7683ebf338fb9b81, 0x67e866ad5f00846c, 0x11fac43668e1dbef,
+    0x009149680f1ac402, 0x332dde8aa717e435, 0x224653d4c0ecfbd8,
+    0x5b68e171186abb66, 0x4a036c2f7f91a48b, 0x79bffbcdd79c84bc,
+    0x68d47693b0679b51, 0x1ec6d4088786c4d2, 0x0fad5956e07ddb3f,
+    0x3c11ceb44870fb08, 0x2d7a43ea2f8be4e5, 0xd0348b8227b2440e,
+    0xc15f06dc40495be3, 0xf2e3913ee8447bd4, 0xe3881c608fbf6439,
+    0x959abefbb85e3bba, 0x84f133a5dfa52457, 0xb74da44777a80460,
+    0xa626291910531b8d, 0x4510c10cc6a4851c, 0x547b4c52a15f9af1,
+    0x67c7dbb00952bac6, 0x76ac56ee6ea9a52b, 0x00bef4755948faa8,
+    0x11d5792b3eb3e545, 0x2269eec996bec572, 0x33026397f145da9f,
+    0xce4cabfff97c7a74, 0xdf2726a19e876599, 0xec9bb143368a45ae,
+    0xfdf03c1d51715a43, 0x8be29e86669005c0, 0x9a8913d8016b1a2d,
+    0xa935843aa9663a1a, 0xb85e0964ce9d25f7, 0xc170bbc1161b6549,
+    0xd01b369f71e07aa4, 0xe3a7a17dd9ed5a93, 0xf2cc2c23be16457e,
+    0x84de8eb889f71afd, 0x95b503e6ee0c0510, 0xa609940446012527,
+    0xb762195a21fa3aca, 0x4a2cd13229c39a21, 0x5b475c6c4e3885cc,
+    0x68fbcb8ee635a5fb, 0x799046d081ceba16, 0x0f82e44bb62fe595,
+    0x1ee96915d1d4fa78, 0x2d55fef779d9da4f, 0x3c3e73a91e22c5a2,
+    0x79e081f77b38f9e8, 0x688b0ca91cc3e605, 0x5b379b4bb4cec632,
+    0x4a5c1615d335d9df, 0x3c4eb48ee4d4865c, 0x2d2539d0832f99b1,
+    0x1e99ae322b22b986, 0x0ff2236c4cd9a66b, 0xf2bceb0444e00680,
+    0xe3d7665a231b196d, 0xd06bf1b88b16395a, 0xc1007ce6eced26b7,
+    0xb712de7ddb0c7934, 0xa6795323bcf766d9, 0x95c5c4c114fa46ee,
+    0x84ae499f73015903, 0xfd80fb3aab8719bd, 0xeceb7664cc7c0650,
+    0xdf57e18664712667, 0xce3c6cd8038a398a, 0xb82ece43346b6609,
+    0xa945431d539079e4, 0x9af9d4fffb9d59d3, 0x8b9259a19c66463e,
+    0x76dc91c9945fe6d5, 0x67b71c97f3a4f938, 0x540b8b755ba9d90f,
+    0x4560062b3c52c6e2, 0x3372a4b00bb39961, 0x221929ee6c48868c,
+    0x11a5be0cc445a6bb, 0x00ce3352a3beb956, 0xe3f8db47754927c7,
+    0xf293561912b2382a, 0xc12fc1fbbabf181d, 0xd0444ca5dd4407f0,
+    0xa656ee3eeaa55873, 0xb73d63608d5e479e, 0x8481f482255367a9,
+    0x95ea79dc42a87844, 0x68a4b1b44a91d8af, 0x79cf3cea2d6ac742,
+    0x4a73ab088567e775, 0x5b182656e29cf898, 0x2d0a84cdd57da71b,
+    0x3c610993b286b8f6, 0x0fdd9e711a8b98c1, 0x1eb6132f7d70872c,
+    0x6798a18aa5f6c792, 0x76f32cd4c20dd87f, 0x454fbb366a00f848,
+    0x542436680dfbe7a5, 0x223694f33a1ab826, 0x335d19ad5de1a7cb,
+    0x00e18e4ff5ec87fc, 0x118a031192179811, 0xecc4cb799a2e38fa,
+    0xfdaf4627fdd52717, 0xce13d1c555d80720, 0xdf785c9b322318cd,
+    0xa96afe0005c2474e, 0xb801735e623958a3, 0x8bbde4bcca347894,
+    0x9ad669e2adcf6779},
+   {0x0000000000000000, 0x2cc998523ea4a8e3, 0x599330a47d4951c6,
+    0x755aa8f643edf925, 0xb3266148fa92a38c, 0x9feff91ac4360b6f,
+    0xeab551ec87dbf24a, 0xc67cc9beb97f5aa9, 0xf4946dba5a2b599d,
+    0xd85df5e8648ff17e, 0xad075d1e2762085b, 0x81cec54c19c6a0b8,
+    0x47b20cf2a0b9fa11, 0x6b7b94a09e1d52f2, 0x1e213c56ddf0abd7,
+    0x32e8a404e3540334, 0x7bf0745f1b58adbf, 0x5739ec0d25fc055c,
+    0x226344fb6611fc79, 0x0eaadca958b5549a, 0xc8d61517e1ca0e33,
+    0xe41f8d45df6ea6d0, 0x914525b39c835ff5, 0xbd8cbde1a227f716,
+    0x8f6419e54173f422, 0xa3ad81b77fd75cc1, 0xd6f729413c3aa5e4,
+    0xfa3eb113029e0d07, 0x3c4278adbbe157ae, 0x108be0ff8545ff4d,
+    0x65d14809c6a80668, 0x4918d05bf80cae8b, 0xf7e0e8be36b15b7e,
+    0xdb2970ec0815f39d, 0xae73d81a4bf80ab8, 0x82ba4048755ca25b,
+    0x44c689f6cc23f8f2, 0x680f11a4f2875011, 0x1d55b952b16aa934,
+    0x319c21008fce01d7, 0x037485046c9a02e3, 0x2fbd1d56523eaa00,
+    0x5ae7b5a011d35325, 0x762e2df22f77fbc6, 0xb052e44c9608a16f,
+    0x9c9b7c1ea8ac098c, 0xe9c1d4e8eb41f0a9, 0xc5084cbad5e5584a,
+    0x8c109ce12de9f6c1, 0xa0d904b3134d5e22, 0xd583ac4550a0a707,
+    0xf94a34176e040fe4, 0x3f36fda9d77b554d, 0x13ff65fbe9dffdae,
+    0x66a5cd0daa32048b, 0x4a6c555f9496ac68, 0x7884f15b77c2af5c,
+    0x544d6909496607bf, 0x2117c1ff0a8bfe9a, 0x0dde59ad342f5679,
+    0xcba290138d500cd0, 0xe76b0841b3f4a433, 0x9231a0b7f0195d16,
+    0xbef838e5cebdf5f5, 0x7d197e57c26ca879, 0x51d0e605fcc8009a,
+    0x248a4ef3bf25f9bf, 0x0843d6a18181515c, 0xce3f1f1f38fe0bf5,
+    0xe2f6874d065aa316, 0x97ac2fbb45b75a33, 0xbb65b7e97b13f2d0,
+    0x898d13ed9847f1e4, 0xa5448bbfa6e35907, 0xd01e2349e50ea022,
+    0xfcd7bb1bdbaa08c1, 0x3aab72a562d55268, 0x1662eaf75c71fa8b,
+    0x633842011f9c03ae, 0x4ff1da532138ab4d, 0x06e90a08d93405c6,
+    0x2a20925ae790ad25, 0x5f7a3aaca47d5400, 0x73b3a2fe9ad9fce3,
+    0xb5cf6b4023a6a64a, 0x9906f3121d020ea9, 0xec5c5be45eeff78c,
+    0xc095c3b6604b5f6f, 0xf27d67b2831f5c5b, 0xdeb4ffe0bdbbf4b8,
+    0xabee5716fe560d9d, 0x8727cf44c0f2a57e, 0x415b06fa798dffd7,
+    0x6d929ea847295734, 0x18c8365e04c4ae11, 0x3401ae0c3a6006f2,
+    0x8af996e9f4ddf307, 0xa6300ebbca795be4, 0xd36aa64d8994a2c1,
+    0xffa33e1fb7300a22, 0x39dff7a10e4f508b, 0x15166ff330ebf868,
+    0x604cc7057306014d, 0x4c855f574da2a9ae, 0x7e6dfb53aef6aa9a,
+    0x52a4630190520279, 0x27fecbf7d3bffb5c, 0x0b3753a5ed1b53bf,
+    0xcd4b9a1b54640916, 0xe18202496ac0a1f5, 0x94d8aabf292d58d0,
+    0xb81132ed1789f033, 0xf109e2b6ef855eb8, 0xddc07ae4d121f65b,
+    0xa89ad21292cc0f7e, 0x84534a40ac68a79d, 0x422f83fe1517fd34,
+    0x6ee61bac2bb355d7, 0x1bbcb35a685eacf2, 0x37752b0856fa0411,
+    0x059d8f0cb5ae0725, 0x2954175e8b0aafc6, 0x5c0ebfa8c8e756e3,
+    0x70c727faf643fe00, 0xb6bbee444f3ca4a9, 0x9a72761671980c4a,
+    0xef28dee03275f56f, 0xc3e146b20cd15d8c, 0xfa32fcaf84d950f2,
+    0xd6fb64fdba7df811, 0xa3a1cc0bf9900134, 0x8f685459c734a9d7,
+    0x49149de77e4bf37e, 0x65dd05b540ef5b9d, 0x1087ad430302a2b8,
+    0x3c4e35113da60a5b, 0x0ea69115def2096f, 0x226f0947e056a18c,
+    0x5735a1b1a3bb58a9, 0x7bfc39e39d1ff04a, 0xbd80f05d2460aae3,
+    0x9149680f1ac40200, 0xe413c0f95929fb25, 0xc8da58ab678d53c6,
+    0x81c288f09f81fd4d, 0xad0b10a2a12555ae, 0xd851b854e2c8ac8b,
+    0xf4982006dc6c0468, 0x32e4e9b865135ec1, 0x1e2d71ea5bb7f622,
+    0x6b77d91c185a0f07, 0x47be414e26fea7e4, 0x7556e54ac5aaa4d0,
+    0x599f7d18fb0e0c33, 0x2cc5d5eeb8e3f516, 0x000c4dbc86475df5,
+    0xc67084023f38075c, 0xeab91c50019cafbf, 0x9fe3b4a64271569a,
+    0xb32a2cf47cd5fe79, 0x0dd21411b2680b8c, 0x211b8c438ccca36f,
+    0x544124b5cf215a4a, 0x7888bce7f185f2a9, 0xbef4755948faa800,
+    0x923ded0b765e00e3, 0xe76745fd35b3f9c6, 0xcbaeddaf0b175125,
+    0xf94679abe8435211, 0xd58fe1f9d6e7faf2, 0xa0d5490f950a03d7,
+    0x8c1cd15dabaeab34, 0x4a6018e312d1f19d, 0x66a980b12c75597e,
+    0x13f328476f98a05b, 0x3f3ab015513c08b8, 0x7622604ea930a633,
+    0x5aebf81c97940ed0, 0x2fb150ead479f7f5, 0x0378c8b8eadd5f16,
+    0xc504010653a205bf, 0xe9cd99546d06ad5c, 0x9c9731a22eeb5479,
+    0xb05ea9f0104ffc9a, 0x82b60df4f31bffae, 0xae7f95a6cdbf574d,
+    0xdb253d508e52ae68, 0xf7eca502b0f6068b, 0x31906cbc09895c22,
+    0x1d59f4ee372df4c1, 0x68035c1874c00de4, 0x44cac44a4a64a507,
+    0x872b82f846b5f88b, 0xabe21aaa78115068, 0xdeb8b25c3bfca94d,
+    0xf2712a0e055801ae, 0x340de3b0bc275b07, 0x18c47be28283f3e4,
+    0x6d9ed314c16e0ac1, 0x41574b46ffcaa222, 0x73bfef421c9ea116,
+    0x5f767710223a09f5, 0x2a2cdfe661d7f0d0, 0x06e547b45f735833,
+    0xc0998e0ae60c029a, 0xec501658d8a8aa79, 0x990abeae9b45535c,
+    0xb5c326fca5e1fbbf, 0xfcdbf6a75ded5534, 0xd0126ef56349fdd7,
+    0xa548c60320a404f2, 0x89815e511e00ac11, 0x4ffd97efa77ff6b8,
+    0x63340fbd99db5e5b, 0x166ea74bda36a77e, 0x3aa73f19e4920f9d,
+    0x084f9b1d07c60ca9, 0x2486034f3962a44a, 0x51dcabb97a8f5d6f,
+    0x7d1533eb442bf58c, 0xbb69fa55fd54af25, 0x97a06207c3f007c6,
+    0xe2facaf1801dfee3, 0xce3352a3beb95600, 0x70cb6a467004a3f5,
+    0x5c02f2144ea00b16, 0x29585ae20d4df233, 0x0591c2b033e95ad0,
+    0xc3ed0b0e8a960079, 0xef24935cb432a89a, 0x9a7e3baaf7df51bf,
+    0xb6b7a3f8c97bf95c, 0x845f07fc2a2ffa68, 0xa8969fae148b528b,
+    0xddcc37585766abae, 0xf105af0a69c2034d, 0x377966b4d0bd59e4,
+    0x1bb0fee6ee19f107, 0x6eea5610adf40822, 0x4223ce429350a0c1,
+    0x0b3b1e196b5c0e4a, 0x27f2864b55f8a6a9, 0x52a82ebd16155f8c,
+    0x7e61b6ef28b1f76f, 0xb81d7f5191ceadc6, 0x94d4e703af6a0525,
+    0xe18e4ff5ec87fc00, 0xcd47d7a7d22354e3, 0xffaf73a3317757d7,
+    0xd366ebf10fd3ff34, 0xa63c43074c3e0611, 0x8af5db55729aaef2,
+    0x4c8912ebcbe5f45b, 0x60408ab9f5415cb8, 0x151a224fb6aca59d,
+    0x39d3ba1d88080d7e},
+   {0x0000000000000000, 0x66bd5674a6bcbf61, 0xcd7aace94d797ec2,
+    0xabc7fa9debc5c1a3, 0x082df6f935fce301, 0x6e90a08d93405c60,
+    0xc5575a1078859dc3, 0xa3ea0c64de3922a2, 0x105bedf26bf9c602,
+    0x76e6bb86cd457963, 0xdd21411b2680b8c0, 0xbb9c176f803c07a1,
+    0x18761b0b5e052503, 0x7ecb4d7ff8b99a62, 0xd50cb7e2137c5bc1,
+    0xb3b1e196b5c0e4a0, 0x20b7dbe4d7f38c04, 0x460a8d90714f3365,
+    0xedcd770d9a8af2c6, 0x8b7021793c364da7, 0x289a2d1de20f6f05,
+    0x4e277b6944b3d064, 0xe5e081f4af7611c7, 0x835dd78009caaea6,
+    0x30ec3616bc0a4a06, 0x565160621ab6f567, 0xfd969afff17334c4,
+    0x9b2bcc8b57cf8ba5, 0x38c1c0ef89f6a907, 0x5e7c969b2f4a1666,
+    0xf5bb6c06c48fd7c5, 0x93063a72623368a4, 0x416fb7c9afe71808,
+    0x27d2e1bd095ba769, 0x8c151b20e29e66ca, 0xeaa84d544422d9ab,
+    0x494241309a1bfb09, 0x2fff17443ca74468, 0x8438edd9d76285cb,
+    0xe285bbad71de3aaa, 0x51345a3bc41ede0a, 0x37890c4f62a2616b,
+    0x9c4ef6d28967a0c8, 0xfaf3a0a62fdb1fa9, 0x5919acc2f1e23d0b,
+    0x3fa4fab6575e826a, 0x9463002bbc9b43c9, 0xf2de565f1a27fca8,
+    0x61d86c2d7814940c, 0x07653a59dea82b6d, 0xaca2c0c4356deace,
+    0xca1f96b093d155af, 0x69f59ad44de8770d, 0x0f48cca0eb54c86c,
+    0xa48f363d009109cf, 0xc2326049a62db6ae, 0x718381df13ed520e,
+    0x173ed7abb551ed6f, 0xbcf92d365e942ccc, 0xda447b42f82893ad,
+    0x79ae77262611b10f, 0x1f13215280ad0e6e, 0xb4d4dbcf6b68cfcd,
+    0xd2698dbbcdd470ac, 0x82df6f935fce3010, 0xe46239e7f9728f71,
+    0x4fa5c37a12b74ed2, 0x2918950eb40bf1b3, 0x8af2996a6a32d311,
+    0xec4fcf1ecc8e6c70, 0x47883583274badd3, 0x213563f781f712b2,
+    0x928482613437f612, 0xf439d415928b4973, 0x5ffe2e88794e88d0,
+    0x394378fcdff237b1, 0x9aa9749801cb1513, 0xfc1422eca777aa72,
+    0x57d3d8714cb26bd1, 0x316e8e05ea0ed4b0, 0xa268b477883dbc14,
+    0xc4d5e2032e810375, 0x6f12189ec544c2d6, 0x09af4eea63f87db7,
+    0xaa45428ebdc15f15, 0xccf814fa1b7de074, 0x673fee67f0b821d7,
+    0x0182b81356049eb6, 0xb2335985e3c47a16, 0xd48e0ff14578c577,
+    0x7f49f56caebd04d4, 0x19f4a3180801bbb5, 0xba1eaf7cd6389917,
+    0xdca3f90870842676, 0x776403959b41e7d5, 0x11d955e13dfd58b4,
+    0xc3b0d85af0292818, 0xa50d8e2e56959779, 0x0eca74b3bd5056da,
+    0x687722c71bece9bb, 0xcb9d2ea3c5d5cb19, 0xad2078d763697478,
+    0x06e7824a88acb5db, 0x605ad43e2e100aba, 0xd3eb35a89bd0ee1a,
+    0xb55663dc3d6c517b, 0x1e919941d6a990d8, 0x782ccf3570152fb9,
+    0xdbc6c351ae2c0d1b, 0xbd7b95250890b27a, 0x16bc6fb8e35573d9,
+    0x700139cc45e9ccb8, 0xe30703be27daa41c, 0x85ba55ca81661b7d,
+    0x2e7daf576aa3dade, 0x48c0f923cc1f65bf, 0xeb2af5471226471d,
+    0x8d97a333b49af87c, 0x265059ae5f5f39df, 0x40ed0fdaf9e386be,
+    0xf35cee4c4c23621e, 0x95e1b838ea9fdd7f, 0x3e2642a5015a1cdc,
+    0x589b14d1a7e6a3bd, 0xfb7118b579df811f, 0x9dcc4ec1df633e7e,
+    0x360bb45c34a6ffdd, 0x50b6e228921a40bc, 0x9766700d10927ea5,
+    0xf1db2679b62ec1c4, 0x5a1cdce45deb0067, 0x3ca18a90fb57bf06,
+    0x9f4b86f4256e9da4, 0xf9f6d08083d222c5, 0x52312a1d6817e366,
+    0x348c7c69ceab5c07, 0x873d9dff7b6bb8a7, 0xe180cb8bddd707c6,
+    0x4a4731163612c665, 0x2cfa676290ae7904, 0x8f106b064e975ba6,
+    0xe9ad3d72e82be4c7, 0x426ac7ef03ee2564, 0x24d7919ba5529a05,
+    0xb7d1abe9c761f2a1, 0xd16cfd9d61dd4dc0, 0x7aab07008a188c63,
+    0x1c1651742ca43302, 0xbffc5d10f29d11a0, 0xd9410b645421aec1,
+    0x7286f1f9bfe46f62, 0x143ba78d1958d003, 0xa78a461bac9834a3,
+    0xc137106f0a248bc2, 0x6af0eaf2e1e14a61, 0x0c4dbc86475df500,
+    0xafa7b0e29964d7a2, 0xc91ae6963fd868c3, 0x62dd1c0bd41da960,
+    0x04604a7f72a11601, 0xd609c7c4bf7566ad, 0xb0b491b019c9d9cc,
+    0x1b736b2df20c186f, 0x7dce3d5954b0a70e, 0xde24313d8a8985ac,
+    0xb89967492c353acd, 0x135e9dd4c7f0fb6e, 0x75e3cba0614c440f,
+    0xc6522a36d48ca0af, 0xa0ef7c4272301fce, 0x0b2886df99f5de6d,
+    0x6d95d0ab3f49610c, 0xce7fdccfe17043ae, 0xa8c28abb47ccfccf,
+    0x03057026ac093d6c, 0x65b826520ab5820d, 0xf6be1c206886eaa9,
+    0x90034a54ce3a55c8, 0x3bc4b0c925ff946b, 0x5d79e6bd83432b0a,
+    0xfe93ead95d7a09a8, 0x982ebcadfbc6b6c9, 0x33e946301003776a,
+    0x55541044b6bfc80b, 0xe6e5f1d2037f2cab, 0x8058a7a6a5c393ca,
+    0x2b9f5d3b4e065269, 0x4d220b4fe8baed08, 0xeec8072b3683cfaa,
+    0x8875515f903f70cb, 0x23b2abc27bfab168, 0x450ffdb6dd460e09,
+    0x15b91f9e4f5c4eb5, 0x730449eae9e0f1d4, 0xd8c3b37702253077,
+    0xbe7ee503a4998f16, 0x1d94e9677aa0adb4, 0x7b29bf13dc1c12d5,
+    0xd0ee458e37d9d376, 0xb65313fa91656c17, 0x05e2f26c24a588b7,
+    0x635fa418821937d6, 0xc8985e8569dcf675, 0xae2508f1cf604914,
+    0x0dcf049511596bb6, 0x6b7252e1b7e5d4d7, 0xc0b5a87c5c201574,
+    0xa608fe08fa9caa15, 0x350ec47a98afc2b1, 0x53b3920e3e137dd0,
+    0xf8746893d5d6bc73, 0x9ec93ee7736a0312, 0x3d233283ad5321b0,
+    0x5b9e64f70bef9ed1, 0xf0599e6ae02a5f72, 0x96e4c81e4696e013,
+    0x25552988f35604b3, 0x43e87ffc55eabbd2, 0xe82f8561be2f7a71,
+    0x8e92d3151893c510, 0x2d78df71c6aae7b2, 0x4bc58905601658d3,
+    0xe00273988bd39970, 0x86bf25ec2d6f2611, 0x54d6a857e0bb56bd,
+    0x326bfe234607e9dc, 0x99ac04beadc2287f, 0xff1152ca0b7e971e,
+    0x5cfb5eaed547b5bc, 0x3a4608da73fb0add, 0x9181f247983ecb7e,
+    0xf73ca4333e82741f, 0x448d45a58b4290bf, 0x223013d12dfe2fde,
+    0x89f7e94cc63bee7d, 0xef4abf386087511c, 0x4ca0b35cbebe73be,
+    0x2a1de5281802ccdf, 0x81da1fb5f3c70d7c, 0xe76749c1557bb21d,
+    0x746173b33748dab9, 0x12dc25c791f465d8, 0xb91bdf5a7a31a47b,
+    0xdfa6892edc8d1b1a, 0x7c4c854a02b439b8, 0x1af1d33ea40886d9,
+    0xb13629a34fcd477a, 0xd78b7fd7e971f81b, 0x643a9e415cb11cbb,
+    0x0287c835fa0da3da, 0xa94032a811c86279, 0xcffd64dcb774dd18,
+    0x6c1768b8694dffba, 0x0aaa3ecccff140db, 0xa16dc45124348178,
+    0xc7d0922582883e19},
+   {0x0000000000000000, 0xbc144f318e2ae3cf, 0xeaf03148b35bd91b,
+    0x56e47e793d713ad4, 0x4738cdbac9b9acb3, 0xfb2c828b47934f7c,
+    0xadc8fcf27ae275a8, 0x11dcb3c3f4c89667, 0x8e719b7593735966,
+    0x3265d4441d59baa9, 0x6481aa3d2028807d, 0xd895e50cae0263b2,
+    0xc94956cf5acaf5d5, 0x755d19fed4e0161a, 0x23b96787e9912cce,
+    0x9fad28b667bbcf01, 0x8e3b99c089e8ac49, 0x322fd6f107c24f86,
+    0x64cba8883ab37552, 0xd8dfe7b9b499969d, 0xc903547a405100fa,
+    0x75171b4bce7be335, 0x23f36532f30ad9e1, 0x9fe72a037d203a2e,
+    0x004a02b51a9bf52f, 0xbc5e4d8494b116e0, 0xeaba33fda9c02c34,
+    0x56ae7ccc27eacffb, 0x4772cf0fd322599c, 0xfb66803e5d08ba53,
+    0xad82fe4760798087, 0x1196b176ee536348, 0x8eaf9caabcdf4617,
+    0x32bbd39b32f5a5d8, 0x645fade20f849f0c, 0xd84be2d381ae7cc3,
+    0xc99751107566eaa4, 0x75831e21fb4c096b, 0x23676058c63d33bf,
+    0x9f732f694817d070, 0x00de07df2fac1f71, 0xbcca48eea186fcbe,
+    0xea2e36979cf7c66a, 0x563a79a612dd25a5, 0x47e6ca65e615b3c2,
+    0xfbf28554683f500d, 0xad16fb2d554e6ad9, 0x1102b41cdb648916,
+    0x0094056a3537ea5e, 0xbc804a5bbb1d0991, 0xea643422866c3345,
+    0x56707b130846d08a, 0x47acc8d0fc8e46ed, 0xfbb887e172a4a522,
+    0xad5cf9984fd59ff6, 0x1148b6a9c1ff7c39, 0x8ee59e1fa644b338,
+    0x32f1d12e286e50f7, 0x6415af57151f6a23, 0xd801e0669b3589ec,
+    0xc9dd53a56ffd1f8b, 0x75c91c94e1d7fc44, 0x232d62eddca6c690,
+    0x9f392ddc528c255f, 0x8f87967ed6b092ab, 0x3393d94f589a7164,
+    0x6577a73665eb4bb0, 0xd963e807ebc1a87f, 0xc8bf5bc41f093e18,
+    0x74ab14f59123ddd7, 0x224f6a8cac52e703, 0x9e5b25bd227804cc,
+    0x01f60d0b45c3cbcd, 0xbde2423acbe92802, 0xeb063c43f69812d6,
+    0x5712737278b2f119, 0x46cec0b18c7a677e, 0xfada8f80025084b1,
+    0xac3ef1f93f21be65, 0x102abec8b10b5daa, 0x01bc0fbe5f583ee2,
+    0xbda8408fd172dd2d, 0xeb4c3ef6ec03e7f9, 0x575871c762290436,
+    0x4684c20496e19251, 0xfa908d3518cb719e, 0xac74f34c25ba4b4a,
+    0x1060bc7dab90a885, 0x8fcd94cbcc2b6784, 0x33d9dbfa4201844b,
+    0x653da5837f70be9f, 0xd929eab2f15a5d50, 0xc8f559710592cb37,
+    0x74e116408bb828f8, 0x22056839b6c9122c, 0x9e11270838e3f1e3,
+    0x01280ad46a6fd4bc, 0xbd3c45e5e4453773, 0xebd83b9cd9340da7,
+    0x57cc74ad571eee68, 0x4610c76ea3d6780f, 0xfa04885f2dfc9bc0,
+    0xace0f626108da114, 0x10f4b9179ea742db, 0x8f5991a1f91c8dda,
+    0x334dde9077366e15, 0x65a9a0e94a4754c1, 0xd9bdefd8c46db70e,
+    0xc8615c1b30a52169, 0x7475132abe8fc2a6, 0x22916d5383fef872,
+    0x9e8522620dd41bbd, 0x8f139314e38778f5, 0x3307dc256dad9b3a,
+    0x65e3a25c50dca1ee, 0xd9f7ed6ddef64221, 0xc82b5eae2a3ed446,
+    0x743f119fa4143789, 0x22db6fe699650d5d, 0x9ecf20d7174fee92,
+    0x0162086170f42193, 0xbd764750fedec25c, 0xeb923929c3aff888,
+    0x578676184d851b47, 0x465ac5dbb94d8d20, 0xfa4e8aea37676eef,
+    0xacaaf4930a16543b, 0x10bebba2843cb7f4, 0x8dd783d6026f3bd3,
+    0x31c3cce78c45d81c, 0x6727b29eb134e2c8, 0xdb33fdaf3f1e0107,
+    0xcaef4e6ccbd69760, 0x76fb015d45fc74af, 0x201f7f24788d4e7b,
+    0x9c0b3015f6a7adb4, 0x03a618a3911c62b5, 0xbfb257921f36817a,
+    0xe95629eb2247bbae, 0x554266daac6d5861, 0x449ed51958a5ce06,
+    0xf88a9a28d68f2dc9, 0xae6ee451ebfe171d, 0x127aab6065d4f4d2,
+    0x03ec1a168b87979a, 0xbff8552705ad7455, 0xe91c2b5e38dc4e81,
+    0x5508646fb6f6ad4e, 0x44d4d7ac423e3b29, 0xf8c0989dcc14d8e6,
+    0xae24e6e4f165e232, 0x1230a9d57f4f01fd, 0x8d9d816318f4cefc,
+    0x3189ce5296de2d33, 0x676db02babaf17e7, 0xdb79ff1a2585f428,
+    0xcaa54cd9d14d624f, 0x76b103e85f678180, 0x20557d916216bb54,
+    0x9c4132a0ec3c589b, 0x03781f7cbeb07dc4, 0xbf6c504d309a9e0b,
+    0xe9882e340deba4df, 0x559c610583c14710, 0x4440d2c67709d177,
+    0xf8549df7f92332b8, 0xaeb0e38ec452086c, 0x12a4acbf4a78eba3,
+    0x8d0984092dc324a2, 0x311dcb38a3e9c76d, 0x67f9b5419e98fdb9,
+    0xdbedfa7010b21e76, 0xca3149b3e47a8811, 0x762506826a506bde,
+    0x20c178fb5721510a, 0x9cd537cad90bb2c5, 0x8d4386bc3758d18d,
+    0x3157c98db9723242, 0x67b3b7f484030896, 0xdba7f8c50a29eb59,
+    0xca7b4b06fee17d3e, 0x766f043770cb9ef1, 0x208b7a4e4dbaa425,
+    0x9c9f357fc39047ea, 0x03321dc9a42b88eb, 0xbf2652f82a016b24,
+    0xe9c22c81177051f0, 0x55d663b0995ab23f, 0x440ad0736d922458,
+    0xf81e9f42e3b8c797, 0xaefae13bdec9fd43, 0x12eeae0a50e31e8c,
+    0x025015a8d4dfa978, 0xbe445a995af54ab7, 0xe8a024e067847063,
+    0x54b46bd1e9ae93ac, 0x4568d8121d6605cb, 0xf97c9723934ce604,
+    0xaf98e95aae3ddcd0, 0x138ca66b20173f1f, 0x8c218edd47acf01e,
+    0x3035c1ecc98613d1, 0x66d1bf95f4f72905, 0xdac5f0a47addcaca,
+    0xcb1943678e155cad, 0x770d0c56003fbf62, 0x21e9722f3d4e85b6,
+    0x9dfd3d1eb3646679, 0x8c6b8c685d370531, 0x307fc359d31de6fe,
+    0x669bbd20ee6cdc2a, 0xda8ff21160463fe5, 0xcb5341d2948ea982,
+    0x77470ee31aa44a4d, 0x21a3709a27d57099, 0x9db73faba9ff9356,
+    0x021a171dce445c57, 0xbe0e582c406ebf98, 0xe8ea26557d1f854c,
+    0x54fe6964f3356683, 0x4522daa707fdf0e4, 0xf936959689d7132b,
+    0xafd2ebefb4a629ff, 0x13c6a4de3a8cca30, 0x8cff89026800ef6f,
+    0x30ebc633e62a0ca0, 0x660fb84adb5b3674, 0xda1bf77b5571d5bb,
+    0xcbc744b8a1b943dc, 0x77d30b892f93a013, 0x213775f012e29ac7,
+    0x9d233ac19cc87908, 0x028e1277fb73b609, 0xbe9a5d46755955c6,
+    0xe87e233f48286f12, 0x546a6c0ec6028cdd, 0x45b6dfcd32ca1aba,
+    0xf9a290fcbce0f975, 0xaf46ee858191c3a1, 0x1352a1b40fbb206e,
+    0x02c410c2e1e84326, 0xbed05ff36fc2a0e9, 0xe834218a52b39a3d,
+    0x54206ebbdc9979f2, 0x45fcdd782851ef95, 0xf9e89249a67b0c5a,
+    0xaf0cec309b0a368e, 0x1318a3011520d541, 0x8cb58bb7729b1a40,
+    0x30a1c486fcb1f98f, 0x6645baffc1c0c35b, 0xda51f5ce4fea2094,
+    0xcb8d460dbb22b6f3, 0x7799093c3508553c, 0x217d774508796fe8,
+    0x9d69387486538c27},
+   {0x0000000000000000, 0x8977a887abd06923, 0x8037fe24f8aeccc3,
+    0x094056a3537ea5e0, 0x92b753625e538703, 0x1bc0fbe5f583ee20,
+    0x1280ad46a6fd4bc0, 0x9bf705c10d2d22e3, 0xb7b609ef13a91083,
+    0x3ec1a168b87979a0, 0x3781f7cbeb07dc40, 0xbef65f4c40d7b563,
+    0x25015a8d4dfa9780, 0xac76f20ae62afea3, 0xa536a4a9b5545b43,
+    0x2c410c2e1e843260, 0xfdb4bcf5885c3f83, 0x74c31472238c56a0,
+    0x7d8342d170f2f340, 0xf4f4ea56db229a63, 0x6f03ef97d60fb880,
+    0xe67447107ddfd1a3, 0xef3411b32ea17443, 0x6643b93485711d60,
+    0x4a02b51a9bf52f00, 0xc3751d9d30254623, 0xca354b3e635be3c3,
+    0x4342e3b9c88b8ae0, 0xd8b5e678c5a6a803, 0x51c24eff6e76c120,
+    0x5882185c3d0864c0, 0xd1f5b0db96d80de3, 0x69b1d6c0bfb66183,
+    0xe0c67e47146608a0, 0xe98628e44718ad40, 0x60f18063ecc8c463,
+    0xfb0685a2e1e5e680, 0x72712d254a358fa3, 0x7b317b86194b2a43,
+    0xf246d301b29b4360, 0xde07df2fac1f7100, 0x577077a807cf1823,
+    0x5e30210b54b1bdc3, 0xd747898cff61d4e0, 0x4cb08c4df24cf603,
+    0xc5c724ca599c9f20, 0xcc8772690ae23ac0, 0x45f0daeea13253e3,
+    0x94056a3537ea5e00, 0x1d72c2b29c3a3723, 0x14329411cf4492c3,
+    0x9d453c966494fbe0, 0x06b2395769b9d903, 0x8fc591d0c269b020,
+    0x8685c773911715c0, 0x0ff26ff43ac77ce3, 0x23b363da24434e83,
+    0xaac4cb5d8f9327a0, 0xa3849dfedced8240, 0x2af33579773deb63,
+    0xb10430b87a10c980, 0x3873983fd1c0a0a3, 0x3133ce9c82be0543,
+    0xb844661b296e6c60, 0xd363ad817f6cc306, 0x5a140506d4bcaa25,
+    0x535453a587c20fc5, 0xda23fb222c1266e6, 0x41d4fee3213f4405,
+    0xc8a356648aef2d26, 0xc1e300c7d99188c6, 0x4894a8407241e1e5,
+    0x64d5a46e6cc5d385, 0xeda20ce9c715baa6, 0xe4e25a4a946b1f46,
+    0x6d95f2cd3fbb7665, 0xf662f70c32965486, 0x7f155f8b99463da5,
+    0x76550928ca389845, 0xff22a1af61e8f166, 0x2ed71174f730fc85,
+    0xa7a0b9f35ce095a6, 0xaee0ef500f9e3046, 0x279747d7a44e5965,
+    0xbc604216a9637b86, 0x3517ea9102b312a5, 0x3c57bc3251cdb745,
+    0xb52014b5fa1dde66, 0x9961189be499ec06, 0x1016b01c4f498525,
+    0x1956e6bf1c3720c5, 0x90214e38b7e749e6, 0x0bd64bf9baca6b05,
+    0x82a1e37e111a0226, 0x8be1b5dd4264a7c6, 0x02961d5ae9b4cee5,
+    0xbad27b41c0daa285, 0x33a5d3c66b0acba6, 0x3ae5856538746e46,
+    0xb3922de293a40765, 0x286528239e892586, 0xa11280a435594ca5,
+    0xa852d6076627e945, 0x21257e80cdf78066, 0x0d6472aed373b206,
+    0x8413da2978a3db25, 0x8d538c8a2bdd7ec5, 0x0424240d800d17e6,
+    0x9fd321cc8d203505, 0x16a4894b26f05c26, 0x1fe4dfe8758ef9c6,
+    0x9693776fde5e90e5, 0x4766c7b448869d06, 0xce116f33e356f425,
+    0xc7513990b02851c5, 0x4e2691171bf838e6, 0xd5d194d616d51a05,
+    0x5ca63c51bd057326, 0x55e66af2ee7bd6c6, 0xdc91c27545abbfe5,
+    0xf0d0ce5b5b2f8d85, 0x79a766dcf0ffe4a6, 0x70e7307fa3814146,
+    0xf99098f808512865, 0x62679d39057c0a86, 0xeb1035beaeac63a5,
+    0xe250631dfdd2c645, 0x6b27cb9a5602af66, 0x341ff42951d79889,
+    0xbd685caefa07f1aa, 0xb4280a0da979544a, 0x3d5fa28a02a93d69,
+    0xa6a8a74b0f841f8a, 0x2fdf0fcca45476a9, 0x269f596ff72ad349,
+    0xafe8f1e85cfaba6a, 0x83a9fdc6427e880a, 0x0ade5541e9aee129,
+    0x039e03e2bad044c9, 0x8ae9ab6511002dea, 0x111eaea41c2d0f09,
+    0x98690623b7fd662a, 0x91295080e483c3ca, 0x185ef8074f53aae9,
+    0xc9ab48dcd98ba70a, 0x40dce05b725bce29, 0x499cb6f821256bc9,
+    0xc0eb1e7f8af502ea, 0x5b1c1bbe87d82009, 0xd26bb3392c08492a,
+    0xdb2be59a7f76ecca, 0x525c4d1dd4a685e9, 0x7e1d4133ca22b789,
+    0xf76ae9b461f2deaa, 0xfe2abf17328c7b4a, 0x775d1790995c1269,
+    0xecaa12519471308a, 0x65ddbad63fa159a9, 0x6c9dec756cdffc49,
+    0xe5ea44f2c70f956a, 0x5dae22e9ee61f90a, 0xd4d98a6e45b19029,
+    0xdd99dccd16cf35c9, 0x54ee744abd1f5cea, 0xcf19718bb0327e09,
+    0x466ed90c1be2172a, 0x4f2e8faf489cb2ca, 0xc6592728e34cdbe9,
+    0xea182b06fdc8e989, 0x636f8381561880aa, 0x6a2fd5220566254a,
+    0xe3587da5aeb64c69, 0x78af7864a39b6e8a, 0xf1d8d0e3084b07a9,
+    0xf89886405b35a249, 0x71ef2ec7f0e5cb6a, 0xa01a9e1c663dc689,
+    0x296d369bcdedafaa, 0x202d60389e930a4a, 0xa95ac8bf35436369,
+    0x32adcd7e386e418a, 0xbbda65f993be28a9, 0xb29a335ac0c08d49,
+    0x3bed9bdd6b10e46a, 0x17ac97f37594d60a, 0x9edb3f74de44bf29,
+    0x979b69d78d3a1ac9, 0x1eecc15026ea73ea, 0x851bc4912bc75109,
+    0x0c6c6c168017382a, 0x052c3ab5d3699dca, 0x8c5b923278b9f4e9,
+    0xe77c59a82ebb5b8f, 0x6e0bf12f856b32ac, 0x674ba78cd615974c,
+    0xee3c0f0b7dc5fe6f, 0x75cb0aca70e8dc8c, 0xfcbca24ddb38b5af,
+    0xf5fcf4ee8846104f, 0x7c8b5c692396796c, 0x50ca50473d124b0c,
+    0xd9bdf8c096c2222f, 0xd0fdae63c5bc87cf, 0x598a06e46e6ceeec,
+    0xc27d03256341cc0f, 0x4b0aaba2c891a52c, 0x424afd019bef00cc,
+    0xcb3d5586303f69ef, 0x1ac8e55da6e7640c, 0x93bf4dda0d370d2f,
+    0x9aff1b795e49a8cf, 0x1388b3fef599c1ec, 0x887fb63ff8b4e30f,
+    0x01081eb853648a2c, 0x0848481b001a2fcc, 0x813fe09cabca46ef,
+    0xad7eecb2b54e748f, 0x240944351e9e1dac, 0x2d4912964de0b84c,
+    0xa43eba11e630d16f, 0x3fc9bfd0eb1df38c, 0xb6be175740cd9aaf,
+    0xbffe41f413b33f4f, 0x3689e973b863566c, 0x8ecd8f68910d3a0c,
+    0x07ba27ef3add532f, 0x0efa714c69a3f6cf, 0x878dd9cbc2739fec,
+    0x1c7adc0acf5ebd0f, 0x950d748d648ed42c, 0x9c4d222e37f071cc,
+    0x153a8aa99c2018ef, 0x397b868782a42a8f, 0xb00c2e00297443ac,
+    0xb94c78a37a0ae64c, 0x303bd024d1da8f6f, 0xabccd5e5dcf7ad8c,
+    0x22bb7d627727c4af, 0x2bfb2bc12459614f, 0xa28c83468f89086c,
+    0x7379339d1951058f, 0xfa0e9b1ab2816cac, 0xf34ecdb9e1ffc94c,
+    0x7a39653e4a2fa06f, 0xe1ce60ff4702828c, 0x68b9c878ecd2ebaf,
+    0x61f99edbbfac4e4f, 0xe88e365c147c276c, 0xc4cf3a720af8150c,
+    0x4db892f5a1287c2f, 0x44f8c456f256d9cf, 0xcd8f6cd15986b0ec,
+    0x5678691054ab920f, 0xdf0fc197ff7bfb2c, 0xd64f9734ac055ecc,
+    0x5f383fb307d537ef},
+   {0x0000000000000000, 0x683fe852a3af3112, 0xd07fd0a5475e6224,
+    0xb84038f7e4f15336, 0x32270e6121b2dacd, 0x5a18e633821debdf,
+    0xe258dec466ecb8e9, 0x8a673696c54389fb, 0x644e1cc24365b59a,
+    0x0c71f490e0ca8488, 0xb431cc67043bd7be, 0xdc0e2435a794e6ac,
+    0x566912a362d76f57, 0x3e56faf1c1785e45, 0x8616c20625890d73,
+    0xee292a5486263c61, 0xc89c398486cb6b34, 0xa0a3d1d625645a26,
+    0x18e3e921c1950910, 0x70dc0173623a3802, 0xfabb37e5a779b1f9,
+    0x9284dfb704d680eb, 0x2ac4e740e027d3dd, 0x42fb0f124388e2cf,
+    0xacd22546c5aedeae, 0xc4edcd146601efbc, 0x7cadf5e382f0bc8a,
+    0x14921db1215f8d98, 0x9ef52b27e41c0463, 0xf6cac37547b33571,
+    0x4e8afb82a3426647, 0x26b513d000ed5755, 0x03e0dc22a298c8ed,
+    0x6bdf34700137f9ff, 0xd39f0c87e5c6aac9, 0xbba0e4d546699bdb,
+    0x31c7d243832a1220, 0x59f83a1120852332, 0xe1b802e6c4747004,
+    0x8987eab467db4116, 0x67aec0e0e1fd7d77, 0x0f9128b242524c65,
+    0xb7d11045a6a31f53, 0xdfeef817050c2e41, 0x5589ce81c04fa7ba,
+    0x3db626d363e096a8, 0x85f61e248711c59e, 0xedc9f67624bef48c,
+    0xcb7ce5a62453a3d9, 0xa3430df487fc92cb, 0x1b033503630dc1fd,
+    0x733cdd51c0a2f0ef, 0xf95bebc705e17914, 0x91640395a64e4806,
+    0x29243b6242bf1b30, 0x411bd330e1102a22, 0xaf32f96467361643,
+    0xc70d1136c4992751, 0x7f4d29c120687467, 0x1772c19383c74575,
+    0x9d15f7054684cc8e, 0xf52a1f57e52bfd9c, 0x4d6a27a001daaeaa,
+    0x2555cff2a2759fb8, 0x07c1b845453191da, 0x6ffe5017e69ea0c8,
+    0xd7be68e0026ff3fe, 0xbf8180b2a1c0c2ec, 0x35e6b62464834b17,
+    0x5dd95e76c72c7a05, 0xe599668123dd2933, 0x8da68ed380721821,
+    0x638fa48706542440, 0x0bb04cd5a5fb1552, 0xb3f07422410a4664,
+    0xdbcf9c70e2a57776, 0x51a8aae627e6fe8d, 0x399742b48449cf9f,
+    0x81d77a4360b89ca9, 0xe9e89211c317adbb, 0xcf5d81c1c3fafaee,
+    0xa76269936055cbfc, 0x1f22516484a498ca, 0x771db936270ba9d8,
+    0xfd7a8fa0e2482023, 0x954567f241e71131, 0x2d055f05a5164207,
+    0x453ab75706b97315, 0xab139d03809f4f74, 0xc32c755123307e66,
+    0x7b6c4da6c7c12d50, 0x1353a5f4646e1c42, 0x99349362a12d95b9,
+    0xf10b7b300282a4ab, 0x494b43c7e673f79d, 0x2174ab9545dcc68f,
+    0x04216467e7a95937, 0x6c1e8c3544066825, 0xd45eb4c2a0f73b13,
+    0xbc615c9003580a01, 0x36066a06c61b83fa, 0x5e39825465b4b2e8,
+    0xe679baa38145e1de, 0x8e4652f122ead0cc, 0x606f78a5a4ccecad,
+    0x085090f70763ddbf, 0xb010a800e3928e89, 0xd82f4052403dbf9b,
+    0x524876c4857e3660, 0x3a779e9626d10772, 0x8237a661c2205444,
+    0xea084e33618f6556, 0xccbd5de361623203, 0xa482b5b1c2cd0311,
+    0x1cc28d46263c5027, 0x74fd651485936135, 0xfe9a538240d0e8ce,
+    0x96a5bbd0e37fd9dc, 0x2ee58327078e8aea, 0x46da6b75a421bbf8,
+    0xa8f3412122078799, 0xc0cca97381a8b68b, 0x788c91846559e5bd,
+    0x10b379d6c6f6d4af, 0x9ad44f4003b55d54, 0xf2eba712a01a6c46,
+    0x4aab9fe544eb3f70, 0x229477b7e7440e62, 0x0f83708a8a6323b4,
+    0x67bc98d829cc12a6, 0xdffca02fcd3d4190, 0xb7c3487d6e927082,
+    0x3da47eebabd1f979, 0x559b96b9087ec86b, 0xeddbae4eec8f9b5d,
+    0x85e4461c4f20aa4f, 0x6bcd6c48c906962e, 0x03f2841a6aa9a73c,
+    0xbbb2bced8e58f40a, 0xd38d54bf2df7c518, 0x59ea6229e8b44ce3,
+    0x31d58a7b4b1b7df1, 0x8995b28cafea2ec7, 0xe1aa5ade0c451fd5,
+    0xc71f490e0ca84880, 0xaf20a15caf077992, 0x176099ab4bf62aa4,
+    0x7f5f71f9e8591bb6, 0xf538476f2d1a924d, 0x9d07af3d8eb5a35f,
+    0x254797ca6a44f069, 0x4d787f98c9ebc17b, 0xa35155cc4fcdfd1a,
+    0xcb6ebd9eec62cc08, 0x732e856908939f3e, 0x1b116d3bab3cae2c,
+    0x91765bad6e7f27d7, 0xf949b3ffcdd016c5, 0x41098b08292145f3,
+    0x2936635a8a8e74e1, 0x0c63aca828fbeb59, 0x645c44fa8b54da4b,
+    0xdc1c7c0d6fa5897d, 0xb423945fcc0ab86f, 0x3e44a2c909493194,
+    0x567b4a9baae60086, 0xee3b726c4e1753b0, 0x86049a3eedb862a2,
+    0x682db06a6b9e5ec3, 0x00125838c8316fd1, 0xb85260cf2cc03ce7,
+    0xd06d889d8f6f0df5, 0x5a0abe0b4a2c840e, 0x32355659e983b51c,
+    0x8a756eae0d72e62a, 0xe24a86fcaeddd738, 0xc4ff952cae30806d,
+    0xacc07d7e0d9fb17f, 0x14804589e96ee249, 0x7cbfaddb4ac1d35b,
+    0xf6d89b4d8f825aa0, 0x9ee7731f2c2d6bb2, 0x26a74be8c8dc3884,
+    0x4e98a3ba6b730996, 0xa0b189eeed5535f7, 0xc88e61bc4efa04e5,
+    0x70ce594baa0b57d3, 0x18f1b11909a466c1, 0x9296878fcce7ef3a,
+    0xfaa96fdd6f48de28, 0x42e9572a8bb98d1e, 0x2ad6bf782816bc0c,
+    0x0842c8cfcf52b26e, 0x607d209d6cfd837c, 0xd83d186a880cd04a,
+    0xb002f0382ba3e158, 0x3a65c6aeeee068a3, 0x525a2efc4d4f59b1,
+    0xea1a160ba9be0a87, 0x8225fe590a113b95, 0x6c0cd40d8c3707f4,
+    0x04333c5f2f9836e6, 0xbc7304a8cb6965d0, 0xd44cecfa68c654c2,
+    0x5e2bda6cad85dd39, 0x3614323e0e2aec2b, 0x8e540ac9eadbbf1d,
+    0xe66be29b49748e0f, 0xc0def14b4999d95a, 0xa8e11919ea36e848,
+    0x10a121ee0ec7bb7e, 0x789ec9bcad688a6c, 0xf2f9ff2a682b0397,
+    0x9ac61778cb843285, 0x22862f8f2f7561b3, 0x4ab9c7dd8cda50a1,
+    0xa490ed890afc6cc0, 0xccaf05dba9535dd2, 0x74ef3d2c4da20ee4,
+    0x1cd0d57eee0d3ff6, 0x96b7e3e82b4eb60d, 0xfe880bba88e1871f,
+    0x46c8334d6c10d429, 0x2ef7db1fcfbfe53b, 0x0ba214ed6dca7a83,
+    0x639dfcbfce654b91, 0xdbddc4482a9418a7, 0xb3e22c1a893b29b5,
+    0x39851a8c4c78a04e, 0x51baf2deefd7915c, 0xe9faca290b26c26a,
+    0x81c5227ba889f378, 0x6fec082f2eafcf19, 0x07d3e07d8d00fe0b,
+    0xbf93d88a69f1ad3d, 0xd7ac30d8ca5e9c2f, 0x5dcb064e0f1d15d4,
+    0x35f4ee1cacb224c6, 0x8db4d6eb484377f0, 0xe58b3eb9ebec46e2,
+    0xc33e2d69eb0111b7, 0xab01c53b48ae20a5, 0x1341fdccac5f7393,
+    0x7b7e159e0ff04281, 0xf1192308cab3cb7a, 0x9926cb5a691cfa68,
+    0x2166f3ad8deda95e, 0x49591bff2e42984c, 0xa77031aba864a42d,
+    0xcf4fd9f90bcb953f, 0x770fe10eef3ac609, 0x1f30095c4c95f71b,
+    0x95573fca89d67ee0, 0xfd68d7982a794ff2, 0x4528ef6fce881cc4,
+    0x2d17073d6d272dd6},
+   {0x0000000000000000, 0x1f06e11514c64768, 0x3e0dc22a298c8ed0,
+    0x210b233f3d4ac9b8, 0x7c1b845453191da0, 0x631d654147df5ac8,
+    0x4216467e7a959370, 0x5d10a76b6e53d418, 0xf83708a8a6323b40,
+    0xe731e9bdb2f47c28, 0xc63aca828fbeb590, 0xd93c2b979b78f2f8,
+    0x842c8cfcf52b26e0, 0x9b2a6de9e1ed6188, 0xba214ed6dca7a830,
+    0xa527afc3c861ef58, 0x62b6be7ae36a6805, 0x7db05f6ff7ac2f6d,
+    0x5cbb7c50cae6e6d5, 0x43bd9d45de20a1bd, 0x1ead3a2eb07375a5,
+    0x01abdb3ba4b532cd, 0x20a0f80499fffb75, 0x3fa619118d39bc1d,
+    0x9a81b6d245585345, 0x858757c7519e142d, 0xa48c74f86cd4dd95,
+    0xbb8a95ed78129afd, 0xe69a328616414ee5, 0xf99cd3930287098d,
+    0xd897f0ac3fcdc035, 0xc79111b92b0b875d, 0xc56d7cf5c6d4d00a,
+    0xda6b9de0d2129762, 0xfb60bedfef585eda, 0xe4665fcafb9e19b2,
+    0xb976f8a195cdcdaa, 0xa67019b4810b8ac2, 0x877b3a8bbc41437a,
+    0x987ddb9ea8870412, 0x3d5a745d60e6eb4a, 0x225c95487420ac22,
+    0x0357b677496a659a, 0x1c5157625dac22f2, 0x4141f00933fff6ea,
+    0x5e47111c2739b182, 0x7f4c32231a73783a, 0x604ad3360eb53f52,
+    0xa7dbc28f25beb80f, 0xb8dd239a3178ff67, 0x99d600a50c3236df,
+    0x86d0e1b018f471b7, 0xdbc046db76a7a5af, 0xc4c6a7ce6261e2c7,
+    0xe5cd84f15f2b2b7f, 0xfacb65e44bed6c17, 0x5fecca27838c834f,
+    0x40ea2b32974ac427, 0x61e1080daa000d9f, 0x7ee7e918bec64af7,
+    0x23f74e73d0959eef, 0x3cf1af66c453d987, 0x1dfa8c59f919103f,
+    0x02fc6d4ceddf5757, 0x180256c022a7be91, 0x0704b7d53661f9f9,
+    0x260f94ea0b2b3041, 0x390975ff1fed7729, 0x6419d29471bea331,
+    0x7b1f33816578e459, 0x5a1410be58322de1, 0x4512f1ab4cf46a89,
+    0xe0355e68849585d1, 0xff33bf7d9053c2b9, 0xde389c42ad190b01,
+    0xc13e7d57b9df4c69, 0x9c2eda3cd78c9871, 0x83283b29c34adf19,
+    0xa2231816fe0016a1, 0xbd25f903eac651c9, 0x7ab4e8bac1cdd694,
+    0x65b209afd50b91fc, 0x44b92a90e8415844, 0x5bbfcb85fc871f2c,
+    0x06af6cee92d4cb34, 0x19a98dfb86128c5c, 0x38a2aec4bb5845e4,
+    0x27a44fd1af9e028c, 0x8283e01267ffedd4, 0x9d8501077339aabc,
+    0xbc8e22384e736304, 0xa388c32d5ab5246c, 0xfe98644634e6f074,
+    0xe19e85532020b71c, 0xc095a66c1d6a7ea4, 0xdf93477909ac39cc,
+    0xdd6f2a35e4736e9b, 0xc269cb20f0b529f3, 0xe362e81fcdffe04b,
+    0xfc64090ad939a723, 0xa174ae61b76a733b, 0xbe724f74a3ac3453,
+    0x9f796c4b9ee6fdeb, 0x807f8d5e8a20ba83, 0x2558229d424155db,
+    0x3a5ec388568712b3, 0x1b55e0b76bcddb0b, 0x045301a27f0b9c63,
+    0x5943a6c91158487b, 0x464547dc059e0f13, 0x674e64e338d4c6ab,
+    0x784885f62c1281c3, 0xbfd9944f0719069e, 0xa0df755a13df41f6,
+    0x81d456652e95884e, 0x9ed2b7703a53cf26, 0xc3c2101b54001b3e,
+    0xdcc4f10e40c65c56, 0xfdcfd2317d8c95ee, 0xe2c93324694ad286,
+    0x47ee9ce7a12b3dde, 0x58e87df2b5ed7ab6, 0x79e35ecd88a7b30e,
+    0x66e5bfd89c61f466, 0x3bf518b3f232207e, 0x24f3f9a6e6f46716,
+    0x05f8da99dbbeaeae, 0x1afe3b8ccf78e9c6, 0x3004ad80454f7d22,
+    0x2f024c9551893a4a, 0x0e096faa6cc3f3f2, 0x110f8ebf7805b49a,
+    0x4c1f29d416566082, 0x5319c8c1029027ea, 0x7212ebfe3fdaee52,
+    0x6d140aeb2b1ca93a, 0xc833a528e37d4662, 0xd735443df7bb010a,
+    0xf63e6702caf1c8b2, 0xe9388617de378fda, 0xb428217cb0645bc2,
+    0xab2ec069a4a21caa, 0x8a25e35699e8d512, 0x952302438d2e927a,
+    0x52b213faa6251527, 0x4db4f2efb2e3524f, 0x6cbfd1d08fa99bf7,
+    0x73b930c59b6fdc9f, 0x2ea997aef53c0887, 0x31af76bbe1fa4fef,
+    0x10a45584dcb08657, 0x0fa2b491c876c13f, 0xaa851b5200172e67,
+    0xb583fa4714d1690f, 0x9488d978299ba0b7, 0x8b8e386d3d5de7df,
+    0xd69e9f06530e33c7, 0xc9987e1347c874af, 0xe8935d2c7a82bd17,
+    0xf795bc396e44fa7f, 0xf569d175839bad28, 0xea6f3060975dea40,
+    0xcb64135faa1723f8, 0xd462f24abed16490, 0x89725521d082b088,
+    0x9674b434c444f7e0, 0xb77f970bf90e3e58, 0xa879761eedc87930,
+    0x0d5ed9dd25a99668, 0x125838c8316fd100, 0x33531bf70c2518b8,
+    0x2c55fae218e35fd0, 0x71455d8976b08bc8, 0x6e43bc9c6276cca0,
+    0x4f489fa35f3c0518, 0x504e7eb64bfa4270, 0x97df6f0f60f1c52d,
+    0x88d98e1a74378245, 0xa9d2ad25497d4bfd, 0xb6d44c305dbb0c95,
+    0xebc4eb5b33e8d88d, 0xf4c20a4e272e9fe5, 0xd5c929711a64565d,
+    0xcacfc8640ea21135, 0x6fe867a7c6c3fe6d, 0x70ee86b2d205b905,
+    0x51e5a58def4f70bd, 0x4ee34498fb8937d5, 0x13f3e3f395dae3cd,
+    0x0cf502e6811ca4a5, 0x2dfe21d9bc566d1d, 0x32f8c0cca8902a75,
+    0x2806fb4067e8c3b3, 0x37001a55732e84db, 0x160b396a4e644d63,
+    0x090dd87f5aa20a0b, 0x541d7f1434f1de13, 0x4b1b9e012037997b,
+    0x6a10bd3e1d7d50c3, 0x75165c2b09bb17ab, 0xd031f3e8c1daf8f3,
+    0xcf3712fdd51cbf9b, 0xee3c31c2e8567623, 0xf13ad0d7fc90314b,
+    0xac2a77bc92c3e553, 0xb32c96a98605a23b, 0x9227b596bb4f6b83,
+    0x8d215483af892ceb, 0x4ab0453a8482abb6, 0x55b6a42f9044ecde,
+    0x74bd8710ad0e2566, 0x6bbb6605b9c8620e, 0x36abc16ed79bb616,
+    0x29ad207bc35df17e, 0x08a60344fe1738c6, 0x17a0e251ead17fae,
+    0xb2874d9222b090f6, 0xad81ac873676d79e, 0x8c8a8fb80b3c1e26,
+    0x938c6ead1ffa594e, 0xce9cc9c671a98d56, 0xd19a28d3656fca3e,
+    0xf0910bec58250386, 0xef97eaf94ce344ee, 0xed6b87b5a13c13b9,
+    0xf26d66a0b5fa54d1, 0xd366459f88b09d69, 0xcc60a48a9c76da01,
+    0x917003e1f2250e19, 0x8e76e2f4e6e34971, 0xaf7dc1cbdba980c9,
+    0xb07b20decf6fc7a1, 0x155c8f1d070e28f9, 0x0a5a6e0813c86f91,
+    0x2b514d372e82a629, 0x3457ac223a44e141, 0x69470b4954173559,
+    0x7641ea5c40d17231, 0x574ac9637d9bbb89, 0x484c2876695dfce1,
+    0x8fdd39cf42567bbc, 0x90dbd8da56903cd4, 0xb1d0fbe56bdaf56c,
+    0xaed61af07f1cb204, 0xf3c6bd9b114f661c, 0xecc05c8e05892174,
+    0xcdcb7fb138c3e8cc, 0xd2cd9ea42c05afa4, 0x77ea3167e46440fc,
+    0x68ecd072f0a20794, 0x49e7f34dcde8ce2c, 0x56e11258d92e8944,
+    0x0bf1b533b77d5d5c, 0x14f75426a3bb1a34, 0x35fc77199ef1d38c,
+    0x2afa960c8a3794e4}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0x6847c61415e1061f, 0xd08e8c292ac20d3e,
+    0xb8c94a3d3f230b21, 0xa01d195354841b7c, 0xc85adf4741651d63,
+    0x7093957a7e461642, 0x18d4536e6ba7105d, 0x403b32a6a80837f8,
+    0x287cf4b2bde931e7, 0x90b5be8f82ca3ac6, 0xf8f2789b972b3cd9,
+    0xe0262bf5fc8c2c84, 0x8861ede1e96d2a9b, 0x30a8a7dcd64e21ba,
+    0x58ef61c8c3af27a5, 0x05686ae37abeb662, 0x6d2facf76f5fb07d,
+    0xd5e6e6ca507cbb5c, 0xbda120de459dbd43, 0xa57573b02e3aad1e,
+    0xcd32b5a43bdbab01, 0x75fbff9904f8a020, 0x1dbc398d1119a63f,
+    0x45535845d2b6819a, 0x2d149e51c7578785, 0x95ddd46cf8748ca4,
+    0xfd9a1278ed958abb, 0xe54e411686329ae6, 0x8d09870293d39cf9,
+    0x35c0cd3facf097d8, 0x5d870b2bb91191c7, 0x0ad0d4c6f57c6dc5,
+    0x629712d2e09d6bda, 0xda5e58efdfbe60fb, 0xb2199efbca5f66e4,
+    0xaacdcd95a1f876b9, 0xc28a0b81b41970a6, 0x7a4341bc8b3a7b87,
+    0x120487a89edb7d98, 0x4aebe6605d745a3d, 0x22ac207448955c22,
+    0x9a656a4977b65703, 0xf222ac5d6257511c, 0xeaf6ff3309f04141,
+    0x82b139271c11475e, 0x3a78731a23324c7f, 0x523fb50e36d34a60,
+    0x0fb8be258fc2dba7, 0x67ff78319a23ddb8, 0xdf36320ca500d699,
+    0xb771f418b0e1d086, 0xafa5a776db46c0db, 0xc7e26162cea7c6c4,
+    0x7f2b2b5ff184cde5, 0x176ced4be465cbfa, 0x4f838c8327caec5f,
+    0x27c44a97322bea40, 0x9f0d00aa0d08e161, 0xf74ac6be18e9e77e,
+    0xef9e95d0734ef723, 0x87d953c466aff13c, 0x3f1019f9598cfa1d,
+    0x5757dfed4c6dfc02, 0x91bea722c0560218, 0xf9f96136d5b70407,
+    0x41302b0bea940f26, 0x2977ed1fff750939, 0x31a3be7194d21964,
+    0x59e4786581331f7b, 0xe12d3258be10145a, 0x896af44cabf11245,
+    0xd1859584685e35e0, 0xb9c253907dbf33ff, 0x010b19ad429c38de,
+    0x694cdfb9577d3ec1, 0x71988cd73cda2e9c, 0x19df4ac3293b2883,
+    0xa11600fe161823a2, 0xc951c6ea03f925bd, 0x94d6cdc1bae8b47a,
+    0xfc910bd5af09b265, 0x445841e8902ab944, 0x2c1f87fc85cbbf5b,
+    0x34cbd492ee6caf06, 0x5c8c1286fb8da919, 0xe44558bbc4aea238,
+    0x8c029eafd14fa427, 0xd4edff6712e08382, 0xbcaa39730701859d,
+    0x0463734e38228ebc, 0x6c24b55a2dc388a3, 0x74f0e634466498fe,
+    0x1cb7202053859ee1, 0xa47e6a1d6ca695c0, 0xcc39ac09794793df,
+    0x9b6e73e4352a6fdd, 0xf329b5f020cb69c2, 0x4be0ffcd1fe862e3,
+    0x23a739d90a0964fc, 0x3b736ab761ae74a1, 0x5334aca3744f72be,
+    0xebfde69e4b6c799f, 0x83ba208a5e8d7f80, 0xdb5541429d225825,
+    0xb312875688c35e3a, 0x0bdbcd6bb7e0551b, 0x639c0b7fa2015304,
+    0x7b485811c9a64359, 0x130f9e05dc474546, 0xabc6d438e3644e67,
+    0xc381122cf6854878, 0x9e0619074f94d9bf, 0xf641df135a75dfa0,
+    0x4e88952e6556d481, 0x26cf533a70b7d29e, 0x3e1b00541b10c2c3,
+    0x565cc6400ef1c4dc, 0xee958c7d31d2cffd, 0x86d24a692433c9e2,
+    0xde3d2ba1e79cee47, 0xb67aedb5f27de858, 0x0eb3a788cd5ee379,
+    0x66f4619cd8bfe566, 0x7e2032f2b318f53b, 0x1667f4e6a6f9f324,
+    0xaeaebedb99daf805, 0xc6e978cf8c3bfe1a, 0x227d4f4580ad0430,
+    0x4a3a8951954c022f, 0xf2f3c36caa6f090e, 0x9ab40578bf8e0f11,
+    0x82605616d4291f4c, 0xea279002c1c81953, 0x52eeda3ffeeb1272,
+    0x3aa91c2beb0a146d, 0x62467de328a533c8, 0x0a01bbf73d4435d7,
+    0xb2c8f1ca02673ef6, 0xda8f37de178638e9, 0xc25b64b07c2128b4,
+    0xaa1ca2a469c02eab, 0x12d5e89956e3258a, 0x7a922e8d43022395,
+    0x271525a6fa13b252, 0x4f52e3b2eff2b44d, 0xf79ba98fd0d1bf6c,
+    0x9fdc6f9bc530b973, 0x87083cf5ae97a92e, 0xef4ffae1bb76af31,
+    0x5786b0dc8455a410, 0x3fc176c891b4a20f, 0x672e1700521b85aa,
+    0x0f69d11447fa83b5, 0xb7a09b2978d98894, 0xdfe75d3d6d388e8b,
+    0xc7330e53069f9ed6, 0xaf74c847137e98c9, 0x17bd827a2c5d93e8,
+    0x7ffa446e39bc95f7, 0x28ad9b8375d169f5, 0x40ea5d9760306fea,
+    0xf82317aa5f1364cb, 0x9064d1be4af262d4, 0x88b082d021557289,
+    0xe0f744c434b47496, 0x583e0ef90b977fb7, 0x3079c8ed1e7679a8,
+    0x6896a925ddd95e0d, 0x00d16f31c8385812, 0xb818250cf71b5333,
+    0xd05fe318e2fa552c, 0xc88bb076895d4571, 0xa0cc76629cbc436e,
+    0x18053c5fa39f484f, 0x7042fa4bb67e4e50, 0x2dc5f1600f6fdf97,
+    0x458237741a8ed988, 0xfd4b7d4925add2a9, 0x950cbb5d304cd4b6,
+    0x8dd8e8335bebc4eb, 0xe59f2e274e0ac2f4, 0x5d56641a7129c9d5,
+    0x3511a20e64c8cfca, 0x6dfec3c6a767e86f, 0x05b905d2b286ee70,
+    0xbd704fef8da5e551, 0xd53789fb9844e34e, 0xcde3da95f3e3f313,
+    0xa5a41c81e602f50c, 0x1d6d56bcd921fe2d, 0x752a90a8ccc0f832,
+    0xb3c3e86740fb0628, 0xdb842e73551a0037, 0x634d644e6a390b16,
+    0x0b0aa25a7fd80d09, 0x13def134147f1d54, 0x7b993720019e1b4b,
+    0xc3507d1d3ebd106a, 0xab17bb092b5c1675, 0xf3f8dac1e8f331d0,
+    0x9bbf1cd5fd1237cf, 0x237656e8c2313cee, 0x4b3190fcd7d03af1,
+    0x53e5c392bc772aac, 0x3ba20586a9962cb3, 0x836b4fbb96b52792,
+    0xeb2c89af8354218d, 0xb6ab82843a45b04a, 0xdeec44902fa4b655,
+    0x66250ead1087bd74, 0x0e62c8b90566bb6b, 0x16b69bd76ec1ab36,
+    0x7ef15dc37b20ad29, 0xc63817fe4403a608, 0xae7fd1ea51e2a017,
+    0xf690b022924d87b2, 0x9ed7763687ac81ad, 0x261e3c0bb88f8a8c,
+    0x4e59fa1fad6e8c93, 0x568da971c6c99cce, 0x3eca6f65d3289ad1,
+    0x86032558ec0b91f0, 0xee44e34cf9ea97ef, 0xb9133ca1b5876bed,
+    0xd154fab5a0666df2, 0x699db0889f4566d3, 0x01da769c8aa460cc,
+    0x190e25f2e1037091, 0x7149e3e6f4e2768e, 0xc980a9dbcbc17daf,
+    0xa1c76fcfde207bb0, 0xf9280e071d8f5c15, 0x916fc813086e5a0a,
+    0x29a6822e374d512b, 0x41e1443a22ac5734, 0x59351754490b4769,
+    0x3172d1405cea4176, 0x89bb9b7d63c94a57, 0xe1fc5d6976284c48,
+    0xbc7b5642cf39dd8f, 0xd43c9056dad8db90, 0x6cf5da6be5fbd0b1,
+    0x04b21c7ff01ad6ae, 0x1c664f119bbdc6f3, 0x742189058e5cc0ec,
+    0xcce8c338b17fcbcd, 0xa4af052ca49ecdd2, 0xfc4064e46731ea77,
+    0x9407a2f072d0ec68, 0x2ccee8cd4df3e749, 0x44892ed95812e156,
+    0x5c5d7db733b5f10b, 0x341abba32654f714, 0x8cd3f19e1977fc35,
+    0xe494378a0c96fa2a},
+   {0x0000000000000000, 0x1231afa352e83f68, 0x24625e47a5d07fd0,
+    0x3653f1e4f73840b8, 0xcddab221610e2732, 0xdfeb1d8233e6185a,
+    0xe9b8ec66c4de58e2, 0xfb8943c59636678a, 0x9ab56543c21c4e64,
+    0x8884cae090f4710c, 0xbed73b0467cc31b4, 0xace694a735240edc,
+    0x576fd762a3126956, 0x455e78c1f1fa563e, 0x730d892506c21686,
+    0x613c2686542a29ee, 0x346bcb8684399cc8, 0x265a6425d6d1a3a0,
+    0x100995c121e9e318, 0x02383a627301dc70, 0xf9b179a7e537bbfa,
+    0xeb80d604b7df8492, 0xddd327e040e7c42a, 0xcfe28843120ffb42,
+    0xaedeaec54625d2ac, 0xbcef016614cdedc4, 0x8abcf082e3f5ad7c,
+    0x988d5f21b11d9214, 0x63041ce4272bf59e, 0x7135b34775c3caf6,
+    0x476642a382fb8a4e, 0x5557ed00d013b526, 0xedc898a222dce003,
+    0xfff937017034df6b, 0xc9aac6e5870c9fd3, 0xdb9b6946d5e4a0bb,
+    0x20122a8343d2c731, 0x32238520113af859, 0x047074c4e602b8e1,
+    0x1641db67b4ea8789, 0x777dfde1e0c0ae67, 0x654c5242b228910f,
+    0x531fa3a64510d1b7, 0x412e0c0517f8eedf, 0xbaa74fc081ce8955,
+    0xa896e063d326b63d, 0x9ec51187241ef685, 0x8cf4be2476f6c9ed,
+    0xd9a35324a6e57ccb, 0xcb92fc87f40d43a3, 0xfdc10d630335031b,
+    0xeff0a2c051dd3c73, 0x1479e105c7eb5bf9, 0x06484ea695036491,
+    0x301bbf42623b2429, 0x222a10e130d31b41, 0x4316366764f932af,
+    0x512799c436110dc7, 0x67746820c1294d7f, 0x7545c78393c17217,
+    0x8ecc844605f7159d, 0x9cfd2be5571f2af5, 0xaaaeda01a0276a4d,
+    0xb89f75a2f2cf5525, 0xda91314545b8c107, 0xc8a09ee61750fe6f,
+    0xfef36f02e068bed7, 0xecc2c0a1b28081bf, 0x174b836424b6e635,
+    0x057a2cc7765ed95d, 0x3329dd23816699e5, 0x21187280d38ea68d,
+    0x4024540687a48f63, 0x5215fba5d54cb00b, 0x64460a412274f0b3,
+    0x7677a5e2709ccfdb, 0x8dfee627e6aaa851, 0x9fcf4984b4429739,
+    0xa99cb860437ad781, 0xbbad17c31192e8e9, 0xeefafac3c1815dcf,
+    0xfccb5560936962a7, 0xca98a4846451221f, 0xd8a90b2736b91d77,
+    0x232048e2a08f7afd, 0x3111e741f2674595, 0x074216a5055f052d,
+    0x1573b90657b73a45, 0x744f9f80039d13ab, 0x667e302351752cc3,
+    0x502dc1c7a64d6c7b, 0x421c6e64f4a55313, 0xb9952da162933499,
+    0xaba48202307b0bf1, 0x9df773e6c7434b49, 0x8fc6dc4595ab7421,
+    0x3759a9e767642104, 0x25680644358c1e6c, 0x133bf7a0c2b45ed4,
+    0x010a5803905c61bc, 0xfa831bc6066a0636, 0xe8b2b4655482395e,
+    0xdee14581a3ba79e6, 0xccd0ea22f152468e, 0xadeccca4a5786f60,
+    0xbfdd6307f7905008, 0x898e92e300a810b0, 0x9bbf3d4052402fd8,
+    0x60367e85c4764852, 0x7207d126969e773a, 0x445420c261a63782,
+    0x56658f61334e08ea, 0x03326261e35dbdcc, 0x1103cdc2b1b582a4,
+    0x27503c26468dc21c, 0x356193851465fd74, 0xcee8d04082539afe,
+    0xdcd97fe3d0bba596, 0xea8a8e072783e52e, 0xf8bb21a4756bda46,
+    0x998707222141f3a8, 0x8bb6a88173a9ccc0, 0xbde5596584918c78,
+    0xafd4f6c6d679b310, 0x545db503404fd49a, 0x466c1aa012a7ebf2,
+    0x703feb44e59fab4a, 0x620e44e7b7779422, 0xb423638a8a70830f,
+    0xa612cc29d898bc67, 0x90413dcd2fa0fcdf, 0x8270926e7d48c3b7,
+    0x79f9d1abeb7ea43d, 0x6bc87e08b9969b55, 0x5d9b8fec4eaedbed,
+    0x4faa204f1c46e485, 0x2e9606c9486ccd6b, 0x3ca7a96a1a84f203,
+    0x0af4588eedbcb2bb, 0x18c5f72dbf548dd3, 0xe34cb4e82962ea59,
+    0xf17d1b4b7b8ad531, 0xc72eeaaf8cb29589, 0xd51f450cde5aaae1,
+    0x8048a80c0e491fc7, 0x927907af5ca120af, 0xa42af64bab996017,
+    0xb61b59e8f9715f7f, 0x4d921a2d6f4738f5, 0x5fa3b58e3daf079d,
+    0x69f0446aca974725, 0x7bc1ebc9987f784d, 0x1afdcd4fcc5551a3,
+    0x08cc62ec9ebd6ecb, 0x3e9f930869852e73, 0x2cae3cab3b6d111b,
+    0xd7277f6ead5b7691, 0xc516d0cdffb349f9, 0xf3452129088b0941,
+    0xe1748e8a5a633629, 0x59ebfb28a8ac630c, 0x4bda548bfa445c64,
+    0x7d89a56f0d7c1cdc, 0x6fb80acc5f9423b4, 0x94314909c9a2443e,
+    0x8600e6aa9b4a7b56, 0xb053174e6c723bee, 0xa262b8ed3e9a0486,
+    0xc35e9e6b6ab02d68, 0xd16f31c838581200, 0xe73cc02ccf6052b8,
+    0xf50d6f8f9d886dd0, 0x0e842c4a0bbe0a5a, 0x1cb583e959563532,
+    0x2ae6720dae6e758a, 0x38d7ddaefc864ae2, 0x6d8030ae2c95ffc4,
+    0x7fb19f0d7e7dc0ac, 0x49e26ee989458014, 0x5bd3c14adbadbf7c,
+    0xa05a828f4d9bd8f6, 0xb26b2d2c1f73e79e, 0x8438dcc8e84ba726,
+    0x9609736bbaa3984e, 0xf73555edee89b1a0, 0xe504fa4ebc618ec8,
+    0xd3570baa4b59ce70, 0xc166a40919b1f118, 0x3aefe7cc8f879692,
+    0x28de486fdd6fa9fa, 0x1e8db98b2a57e942, 0x0cbc162878bfd62a,
+    0x6eb252cfcfc84208, 0x7c83fd6c9d207d60, 0x4ad00c886a183dd8,
+    0x58e1a32b38f002b0, 0xa368e0eeaec6653a, 0xb1594f4dfc2e5a52,
+    0x870abea90b161aea, 0x953b110a59fe2582, 0xf407378c0dd40c6c,
+    0xe636982f5f3c3304, 0xd06569cba80473bc, 0xc254c668faec4cd4,
+    0x39dd85ad6cda2b5e, 0x2bec2a0e3e321436, 0x1dbfdbeac90a548e,
+    0x0f8e74499be26be6, 0x5ad999494bf1dec0, 0x48e836ea1919e1a8,
+    0x7ebbc70eee21a110, 0x6c8a68adbcc99e78, 0x97032b682afff9f2,
+    0x853284cb7817c69a, 0xb361752f8f2f8622, 0xa150da8cddc7b94a,
+    0xc06cfc0a89ed90a4, 0xd25d53a9db05afcc, 0xe40ea24d2c3def74,
+    0xf63f0dee7ed5d01c, 0x0db64e2be8e3b796, 0x1f87e188ba0b88fe,
+    0x29d4106c4d33c846, 0x3be5bfcf1fdbf72e, 0x837aca6ded14a20b,
+    0x914b65cebffc9d63, 0xa718942a48c4dddb, 0xb5293b891a2ce2b3,
+    0x4ea0784c8c1a8539, 0x5c91d7efdef2ba51, 0x6ac2260b29cafae9,
+    0x78f389a87b22c581, 0x19cfaf2e2f08ec6f, 0x0bfe008d7de0d307,
+    0x3dadf1698ad893bf, 0x2f9c5ecad830acd7, 0xd4151d0f4e06cb5d,
+    0xc624b2ac1ceef435, 0xf0774348ebd6b48d, 0xe246ecebb93e8be5,
+    0xb71101eb692d3ec3, 0xa520ae483bc501ab, 0x93735facccfd4113,
+    0x8142f00f9e157e7b, 0x7acbb3ca082319f1, 0x68fa1c695acb2699,
+    0x5ea9ed8dadf36621, 0x4c98422eff1b5949, 0x2da464a8ab3170a7,
+    0x3f95cb0bf9d94fcf, 0x09c63aef0ee10f77, 0x1bf7954c5c09301f,
+    0xe07ed689ca3f5795, 0xf24f792a98d768fd, 0xc41c88ce6fef2845,
+    0xd62d276d3d07172d},
+   {0x0000000000000000, 0x2369d0ab87a87789, 0xc3ccaef824fe3780,
+    0xe0a57e53a3564009, 0x0387535e6253b792, 0x20ee83f5e5fbc01b,
+    0xc04bfda646ad8012, 0xe3222d0dc105f79b, 0x8310a913ef09b6b7,
+    0xa07979b868a1c13e, 0x40dc07ebcbf78137, 0x63b5d7404c5ff6be,
+    0x8097fa4d8d5a0125, 0xa3fe2ae60af276ac, 0x435b54b5a9a436a5,
+    0x6032841e2e0c412c, 0x833f5c88f5bcb4fd, 0xa0568c237214c374,
+    0x40f3f270d142837d, 0x639a22db56eaf4f4, 0x80b80fd697ef036f,
+    0xa3d1df7d104774e6, 0x4374a12eb31134ef, 0x601d718534b94366,
+    0x002ff59b1ab5024a, 0x234625309d1d75c3, 0xc3e35b633e4b35ca,
+    0xe08a8bc8b9e34243, 0x03a8a6c578e6b5d8, 0x20c1766eff4ec251,
+    0xc064083d5c188258, 0xe30dd896dbb0f5d1, 0x8361b6bfc0d6b169,
+    0xa0086614477ec6e0, 0x40ad1847e42886e9, 0x63c4c8ec6380f160,
+    0x80e6e5e1a28506fb, 0xa38f354a252d7172, 0x432a4b19867b317b,
+    0x60439bb201d346f2, 0x00711fac2fdf07de, 0x2318cf07a8777057,
+    0xc3bdb1540b21305e, 0xe0d461ff8c8947d7, 0x03f64cf24d8cb04c,
+    0x209f9c59ca24c7c5, 0xc03ae20a697287cc, 0xe35332a1eedaf045,
+    0x005eea37356a0594, 0x23373a9cb2c2721d, 0xc39244cf11943214,
+    0xe0fb9464963c459d, 0x03d9b9695739b206, 0x20b069c2d091c58f,
+    0xc015179173c78586, 0xe37cc73af46ff20f, 0x834e4324da63b323,
+    0xa027938f5dcbc4aa, 0x4082eddcfe9d84a3, 0x63eb3d777935f32a,
+    0x80c9107ab83004b1, 0xa3a0c0d13f987338, 0x4305be829cce3331,
+    0x606c6e291b6644b8, 0x06c36c7f81ad63d3, 0x25aabcd40605145a,
+    0xc50fc287a5535453, 0xe666122c22fb23da, 0x05443f21e3fed441,
+    0x262def8a6456a3c8, 0xc68891d9c700e3c1, 0xe5e1417240a89448,
+    0x85d3c56c6ea4d564, 0xa6ba15c7e90ca2ed, 0x461f6b944a5ae2e4,
+    0x6576bb3fcdf2956d, 0x865496320cf762f6, 0xa53d46998b5f157f,
+    0x459838ca28095576, 0x66f1e861afa122ff, 0x85fc30f77411d72e,
+    0xa695e05cf3b9a0a7, 0x46309e0f50efe0ae, 0x65594ea4d7479727,
+    0x867b63a9164260bc, 0xa512b30291ea1735, 0x45b7cd5132bc573c,
+    0x66de1dfab51420b5, 0x06ec99e49b186199, 0x2585494f1cb01610,
+    0xc520371cbfe65619, 0xe649e7b7384e2190, 0x056bcabaf94bd60b,
+    0x26021a117ee3a182, 0xc6a76442ddb5e18b, 0xe5ceb4e95a1d9602,
+    0x85a2dac0417bd2ba, 0xa6cb0a6bc6d3a533, 0x466e74386585e53a,
+    0x6507a493e22d92b3, 0x8625899e23286528, 0xa54c5935a48012a1,
+    0x45e9276607d652a8, 0x6680f7cd807e2521, 0x06b273d3ae72640d,
+    0x25dba37829da1384, 0xc57edd2b8a8c538d, 0xe6170d800d242404,
+    0x0535208dcc21d39f, 0x265cf0264b89a416, 0xc6f98e75e8dfe41f,
+    0xe5905ede6f779396, 0x069d8648b4c76647, 0x25f456e3336f11ce,
+    0xc55128b0903951c7, 0xe638f81b1791264e, 0x051ad516d694d1d5,
+    0x267305bd513ca65c, 0xc6d67beef26ae655, 0xe5bfab4575c291dc,
+    0x858d2f5b5bced0f0, 0xa6e4fff0dc66a779, 0x464181a37f30e770,
+    0x65285108f89890f9, 0x860a7c05399d6762, 0xa563acaebe3510eb,
+    0x45c6d2fd1d6350e2, 0x66af02569acb276b, 0x8998d75129f41f34,
+    0xaaf107faae5c68bd, 0x4a5479a90d0a28b4, 0x693da9028aa25f3d,
+    0x8a1f840f4ba7a8a6, 0xa97654a4cc0fdf2f, 0x49d32af76f599f26,
+    0x6abafa5ce8f1e8af, 0x0a887e42c6fda983, 0x29e1aee94155de0a,
+    0xc944d0bae2039e03, 0xea2d001165abe98a, 0x090f2d1ca4ae1e11,
+    0x2a66fdb723066998, 0xcac383e480502991, 0xe9aa534f07f85e18,
+    0x0aa78bd9dc48abc9, 0x29ce5b725be0dc40, 0xc96b2521f8b69c49,
+    0xea02f58a7f1eebc0, 0x0920d887be1b1c5b, 0x2a49082c39b36bd2,
+    0xcaec767f9ae52bdb, 0xe985a6d41d4d5c52, 0x89b722ca33411d7e,
+    0xaadef261b4e96af7, 0x4a7b8c3217bf2afe, 0x69125c9990175d77,
+    0x8a3071945112aaec, 0xa959a13fd6badd65, 0x49fcdf6c75ec9d6c,
+    0x6a950fc7f244eae5, 0x0af961eee922ae5d, 0x2990b1456e8ad9d4,
+    0xc935cf16cddc99dd, 0xea5c1fbd4a74ee54, 0x097e32b08b7119cf,
+    0x2a17e21b0cd96e46, 0xcab29c48af8f2e4f, 0xe9db4ce3282759c6,
+    0x89e9c8fd062b18ea, 0xaa80185681836f63, 0x4a25660522d52f6a,
+    0x694cb6aea57d58e3, 0x8a6e9ba36478af78, 0xa9074b08e3d0d8f1,
+    0x49a2355b408698f8, 0x6acbe5f0c72eef71, 0x89c63d661c9e1aa0,
+    0xaaafedcd9b366d29, 0x4a0a939e38602d20, 0x69634335bfc85aa9,
+    0x8a416e387ecdad32, 0xa928be93f965dabb, 0x498dc0c05a339ab2,
+    0x6ae4106bdd9bed3b, 0x0ad69475f397ac17, 0x29bf44de743fdb9e,
+    0xc91a3a8dd7699b97, 0xea73ea2650c1ec1e, 0x0951c72b91c41b85,
+    0x2a381780166c6c0c, 0xca9d69d3b53a2c05, 0xe9f4b97832925b8c,
+    0x8f5bbb2ea8597ce7, 0xac326b852ff10b6e, 0x4c9715d68ca74b67,
+    0x6ffec57d0b0f3cee, 0x8cdce870ca0acb75, 0xafb538db4da2bcfc,
+    0x4f104688eef4fcf5, 0x6c799623695c8b7c, 0x0c4b123d4750ca50,
+    0x2f22c296c0f8bdd9, 0xcf87bcc563aefdd0, 0xecee6c6ee4068a59,
+    0x0fcc416325037dc2, 0x2ca591c8a2ab0a4b, 0xcc00ef9b01fd4a42,
+    0xef693f3086553dcb, 0x0c64e7a65de5c81a, 0x2f0d370dda4dbf93,
+    0xcfa8495e791bff9a, 0xecc199f5feb38813, 0x0fe3b4f83fb67f88,
+    0x2c8a6453b81e0801, 0xcc2f1a001b484808, 0xef46caab9ce03f81,
+    0x8f744eb5b2ec7ead, 0xac1d9e1e35440924, 0x4cb8e04d9612492d,
+    0x6fd130e611ba3ea4, 0x8cf31debd0bfc93f, 0xaf9acd405717beb6,
+    0x4f3fb313f441febf, 0x6c5663b873e98936, 0x0c3a0d91688fcd8e,
+    0x2f53dd3aef27ba07, 0xcff6a3694c71fa0e, 0xec9f73c2cbd98d87,
+    0x0fbd5ecf0adc7a1c, 0x2cd48e648d740d95, 0xcc71f0372e224d9c,
+    0xef18209ca98a3a15, 0x8f2aa48287867b39, 0xac437429002e0cb0,
+    0x4ce60a7aa3784cb9, 0x6f8fdad124d03b30, 0x8cadf7dce5d5ccab,
+    0xafc42777627dbb22, 0x4f615924c12bfb2b, 0x6c08898f46838ca2,
+    0x8f0551199d337973, 0xac6c81b21a9b0efa, 0x4cc9ffe1b9cd4ef3,
+    0x6fa02f4a3e65397a, 0x8c820247ff60cee1, 0xafebd2ec78c8b968,
+    0x4f4eacbfdb9ef961, 0x6c277c145c368ee8, 0x0c15f80a723acfc4,
+    0x2f7c28a1f592b84d, 0xcfd956f256c4f844, 0xecb08659d16c8fcd,
+    0x0f92ab5410697856, 0x2cfb7bff97c10fdf, 0xcc5e05ac34974fd6,
+    0xef37d507b33f385f},
+   {0x0000000000000000, 0xcfe32a8e314f14bc, 0x1bd95bb34831f0ea,
+    0xd43a713d797ee456, 0xb3acb9c9bacd3847, 0x7c4f93478b822cfb,
+    0xa875e27af2fcc8ad, 0x6796c8f4c3b3dc11, 0x66597393759b718e,
+    0xa9ba591d44d46532, 0x7d8028203daa8164, 0xb26302ae0ce595d8,
+    0xd5f5ca5acf5649c9, 0x1a16e0d4fe195d75, 0xce2c91e98767b923,
+    0x01cfbb67b628ad9f, 0x49ace889c0993b8e, 0x864fc207f1d62f32,
+    0x5275b33a88a8cb64, 0x9d9699b4b9e7dfd8, 0xfa0051407a5403c9,
+    0x35e37bce4b1b1775, 0xe1d90af33265f323, 0x2e3a207d032ae79f,
+    0x2ff59b1ab5024a00, 0xe016b194844d5ebc, 0x342cc0a9fd33baea,
+    0xfbcfea27cc7cae56, 0x9c5922d30fcf7247, 0x53ba085d3e8066fb,
+    0x8780796047fe82ad, 0x486353ee76b19611, 0x1746dfbcaa9caf8e,
+    0xd8a5f5329bd3bb32, 0x0c9f840fe2ad5f64, 0xc37cae81d3e24bd8,
+    0xa4ea6675105197c9, 0x6b094cfb211e8375, 0xbf333dc658606723,
+    0x70d01748692f739f, 0x711fac2fdf07de00, 0xbefc86a1ee48cabc,
+    0x6ac6f79c97362eea, 0xa525dd12a6793a56, 0xc2b315e665cae647,
+    0x0d503f685485f2fb, 0xd96a4e552dfb16ad, 0x168964db1cb40211,
+    0x5eea37356a059400, 0x91091dbb5b4a80bc, 0x45336c86223464ea,
+    0x8ad04608137b7056, 0xed468efcd0c8ac47, 0x22a5a472e187b8fb,
+    0xf69fd54f98f95cad, 0x397cffc1a9b64811, 0x38b344a61f9ee58e,
+    0xf7506e282ed1f132, 0x236a1f1557af1564, 0xec89359b66e001d8,
+    0x8b1ffd6fa553ddc9, 0x44fcd7e1941cc975, 0x90c6a6dced622d23,
+    0x5f258c52dc2d399f, 0xab92b0d67e96878f, 0x64719a584fd99333,
+    0xb04beb6536a77765, 0x7fa8c1eb07e863d9, 0x183e091fc45bbfc8,
+    0xd7dd2391f514ab74, 0x03e752ac8c6a4f22, 0xcc047822bd255b9e,
+    0xcdcbc3450b0df601, 0x0228e9cb3a42e2bd, 0xd61298f6433c06eb,
+    0x19f1b27872731257, 0x7e677a8cb1c0ce46, 0xb1845002808fdafa,
+    0x65be213ff9f13eac, 0xaa5d0bb1c8be2a10, 0xe23e585fbe0fbc01,
+    0x2ddd72d18f40a8bd, 0xf9e703ecf63e4ceb, 0x36042962c7715857,
+    0x5192e19604c28446, 0x9e71cb18358d90fa, 0x4a4bba254cf374ac,
+    0x85a890ab7dbc6010, 0x84672bcccb94cd8f, 0x4b840142fadbd933,
+    0x9fbe707f83a53d65, 0x505d5af1b2ea29d9, 0x37cb92057159f5c8,
+    0xf828b88b4016e174, 0x2c12c9b639680522, 0xe3f1e3380827119e,
+    0xbcd46f6ad40a2801, 0x733745e4e5453cbd, 0xa70d34d99c3bd8eb,
+    0x68ee1e57ad74cc57, 0x0f78d6a36ec71046, 0xc09bfc2d5f8804fa,
+    0x14a18d1026f6e0ac, 0xdb42a79e17b9f410, 0xda8d1cf9a191598f,
+    0x156e367790de4d33, 0xc154474ae9a0a965, 0x0eb76dc4d8efbdd9,
+    0x6921a5301b5c61c8, 0xa6c28fbe2a137574, 0x72f8fe83536d9122,
+    0xbd1bd40d6222859e, 0xf57887e31493138f, 0x3a9bad6d25dc0733,
+    0xeea1dc505ca2e365, 0x2142f6de6dedf7d9, 0x46d43e2aae5e2bc8,
+    0x893714a49f113f74, 0x5d0d6599e66fdb22, 0x92ee4f17d720cf9e,
+    0x9321f47061086201, 0x5cc2defe504776bd, 0x88f8afc3293992eb,
+    0x471b854d18768657, 0x208d4db9dbc55a46, 0xef6e6737ea8a4efa,
+    0x3b54160a93f4aaac, 0xf4b73c84a2bbbe10, 0xd33b6f02d683d78d,
+    0x1cd8458ce7ccc331, 0xc8e234b19eb22767, 0x07011e3faffd33db,
+    0x6097d6cb6c4eefca, 0xaf74fc455d01fb76, 0x7b4e8d78247f1f20,
+    0xb4ada7f615300b9c, 0xb5621c91a318a603, 0x7a81361f9257b2bf,
+    0xaebb4722eb2956e9, 0x61586dacda664255, 0x06cea55819d59e44,
+    0xc92d8fd6289a8af8, 0x1d17feeb51e46eae, 0xd2f4d46560ab7a12,
+    0x9a97878b161aec03, 0x5574ad052755f8bf, 0x814edc385e2b1ce9,
+    0x4eadf6b66f640855, 0x293b3e42acd7d444, 0xe6d814cc9d98c0f8,
+    0x32e265f1e4e624ae, 0xfd014f7fd5a93012, 0xfccef41863819d8d,
+    0x332dde9652ce8931, 0xe717afab2bb06d67, 0x28f485251aff79db,
+    0x4f624dd1d94ca5ca, 0x8081675fe803b176, 0x54bb1662917d5520,
+    0x9b583ceca032419c, 0xc47db0be7c1f7803, 0x0b9e9a304d506cbf,
+    0xdfa4eb0d342e88e9, 0x1047c18305619c55, 0x77d10977c6d24044,
+    0xb83223f9f79d54f8, 0x6c0852c48ee3b0ae, 0xa3eb784abfaca412,
+    0xa224c32d0984098d, 0x6dc7e9a338cb1d31, 0xb9fd989e41b5f967,
+    0x761eb21070faeddb, 0x11887ae4b34931ca, 0xde6b506a82062576,
+    0x0a512157fb78c120, 0xc5b20bd9ca37d59c, 0x8dd15837bc86438d,
+    0x423272b98dc95731, 0x96080384f4b7b367, 0x59eb290ac5f8a7db,
+    0x3e7de1fe064b7bca, 0xf19ecb7037046f76, 0x25a4ba4d4e7a8b20,
+    0xea4790c37f359f9c, 0xeb882ba4c91d3203, 0x246b012af85226bf,
+    0xf0517017812cc2e9, 0x3fb25a99b063d655, 0x5824926d73d00a44,
+    0x97c7b8e3429f1ef8, 0x43fdc9de3be1faae, 0x8c1ee3500aaeee12,
+    0x78a9dfd4a8155002, 0xb74af55a995a44be, 0x63708467e024a0e8,
+    0xac93aee9d16bb454, 0xcb05661d12d86845, 0x04e64c9323977cf9,
+    0xd0dc3dae5ae998af, 0x1f3f17206ba68c13, 0x1ef0ac47dd8e218c,
+    0xd11386c9ecc13530, 0x0529f7f495bfd166, 0xcacadd7aa4f0c5da,
+    0xad5c158e674319cb, 0x62bf3f00560c0d77, 0xb6854e3d2f72e921,
+    0x796664b31e3dfd9d, 0x3105375d688c6b8c, 0xfee61dd359c37f30,
+    0x2adc6cee20bd9b66, 0xe53f466011f28fda, 0x82a98e94d24153cb,
+    0x4d4aa41ae30e4777, 0x9970d5279a70a321, 0x5693ffa9ab3fb79d,
+    0x575c44ce1d171a02, 0x98bf6e402c580ebe, 0x4c851f7d5526eae8,
+    0x836635f36469fe54, 0xe4f0fd07a7da2245, 0x2b13d789969536f9,
+    0xff29a6b4efebd2af, 0x30ca8c3adea4c613, 0x6fef00680289ff8c,
+    0xa00c2ae633c6eb30, 0x74365bdb4ab80f66, 0xbbd571557bf71bda,
+    0xdc43b9a1b844c7cb, 0x13a0932f890bd377, 0xc79ae212f0753721,
+    0x0879c89cc13a239d, 0x09b673fb77128e02, 0xc6555975465d9abe,
+    0x126f28483f237ee8, 0xdd8c02c60e6c6a54, 0xba1aca32cddfb645,
+    0x75f9e0bcfc90a2f9, 0xa1c3918185ee46af, 0x6e20bb0fb4a15213,
+    0x2643e8e1c210c402, 0xe9a0c26ff35fd0be, 0x3d9ab3528a2134e8,
+    0xf27999dcbb6e2054, 0x95ef512878ddfc45, 0x5a0c7ba64992e8f9,
+    0x8e360a9b30ec0caf, 0x41d5201501a31813, 0x401a9b72b78bb58c,
+    0x8ff9b1fc86c4a130, 0x5bc3c0c1ffba4566, 0x9420ea4fcef551da,
+    0xf3b622bb0d468dcb, 0x3c5508353c099977, 0xe86f790845777d21,
+    0x278c53867438699d},
+   {0x0000000000000000, 0x61bfbca67456bd66, 0xc27e794de9ac7acd,
+    0xa3c1c5eb9dfac7ab, 0x01e3fc35f9f62d08, 0x605c40938da0906e,
+    0xc39d8578105a57c5, 0xa22239de640ceaa3, 0x02c6f96bf2ed5b10,
+    0x637945cd86bbe676, 0xc0b880261b4121dd, 0xa1073c806f179cbb,
+    0x0325055e0b1b7618, 0x629ab9f87f4dcb7e, 0xc15b7c13e2b70cd5,
+    0xa0e4c0b596e1b1b3, 0x048cf3d7e4dbb720, 0x65334f71908d0a46,
+    0xc6f28a9a0d77cded, 0xa74d363c7921708b, 0x056f0fe21d2d9a28,
+    0x64d0b344697b274e, 0xc71176aff481e0e5, 0xa6aeca0980d75d83,
+    0x064a0abc1636ec30, 0x67f5b61a62605156, 0xc43473f1ff9a96fd,
+    0xa58bcf578bcc2b9b, 0x07a9f689efc0c138, 0x66164a2f9b967c5e,
+    0xc5d78fc4066cbbf5, 0xa4683362723a0693, 0x0818e7afc9b76f41,
+    0x69a75b09bde1d227, 0xca669ee2201b158c, 0xabd92244544da8ea,
+    0x09fb1b9a30414249, 0x6844a73c4417ff2f, 0xcb8562d7d9ed3884,
+    0xaa3ade71adbb85e2, 0x0ade1ec43b5a3451, 0x6b61a2624f0c8937,
+    0xc8a06789d2f64e9c, 0xa91fdb2fa6a0f3fa, 0x0b3de2f1c2ac1959,
+    0x6a825e57b6faa43f, 0xc9439bbc2b006394, 0xa8fc271a5f56def2,
+    0x0c9414782d6cd861, 0x6d2ba8de593a6507, 0xceea6d35c4c0a2ac,
+    0xaf55d193b0961fca, 0x0d77e84dd49af569, 0x6cc854eba0cc480f,
+    0xcf0991003d368fa4, 0xaeb62da6496032c2, 0x0e52ed13df818371,
+    0x6fed51b5abd73e17, 0xcc2c945e362df9bc, 0xad9328f8427b44da,
+    0x0fb111262677ae79, 0x6e0ead805221131f, 0xcdcf686bcfdbd4b4,
+    0xac70d4cdbb8d69d2, 0x1030ce5f936fdf82, 0x718f72f9e73962e4,
+    0xd24eb7127ac3a54f, 0xb3f10bb40e951829, 0x11d3326a6a99f28a,
+    0x706c8ecc1ecf4fec, 0xd3ad4b2783358847, 0xb212f781f7633521,
+    0x12f6373461828492, 0x73498b9215d439f4, 0xd0884e79882efe5f,
+    0xb137f2dffc784339, 0x1315cb019874a99a, 0x72aa77a7ec2214fc,
+    0xd16bb24c71d8d357, 0xb0d40eea058e6e31, 0x14bc3d8877b468a2,
+    0x7503812e03e2d5c4, 0xd6c244c59e18126f, 0xb77df863ea4eaf09,
+    0x155fc1bd8e4245aa, 0x74e07d1bfa14f8cc, 0xd721b8f067ee3f67,
+    0xb69e045613b88201, 0x167ac4e3855933b2, 0x77c57845f10f8ed4,
+    0xd404bdae6cf5497f, 0xb5bb010818a3f419, 0x179938d67caf1eba,
+    0x7626847008f9a3dc, 0xd5e7419b95036477, 0xb458fd3de155d911,
+    0x182829f05ad8b0c3, 0x799795562e8e0da5, 0xda5650bdb374ca0e,
+    0xbbe9ec1bc7227768, 0x19cbd5c5a32e9dcb, 0x78746963d77820ad,
+    0xdbb5ac884a82e706, 0xba0a102e3ed45a60, 0x1aeed09ba835ebd3,
+    0x7b516c3ddc6356b5, 0xd890a9d64199911e, 0xb92f157035cf2c78,
+    0x1b0d2cae51c3c6db, 0x7ab2900825957bbd, 0xd97355e3b86fbc16,
+    0xb8cce945cc390170, 0x1ca4da27be0307e3, 0x7d1b6681ca55ba85,
+    0xdedaa36a57af7d2e, 0xbf651fcc23f9c048, 0x1d47261247f52aeb,
+    0x7cf89ab433a3978d, 0xdf395f5fae595026, 0xbe86e3f9da0fed40,
+    0x1e62234c4cee5cf3, 0x7fdd9fea38b8e195, 0xdc1c5a01a542263e,
+    0xbda3e6a7d1149b58, 0x1f81df79b51871fb, 0x7e3e63dfc14ecc9d,
+    0xddffa6345cb40b36, 0xbc401a9228e2b650, 0xa57e92100d706697,
+    0xc4c12eb67926dbf1, 0x6700eb5de4dc1c5a, 0x06bf57fb908aa13c,
+    0xa49d6e25f4864b9f, 0xc522d28380d0f6f9, 0x66e317681d2a3152,
+    0x075cabce697c8c34, 0xa7b86b7bff9d3d87, 0xc607d7dd8bcb80e1,
+    0x65c612361631474a, 0x0479ae906267fa2c, 0xa65b974e066b108f,
+    0xc7e42be8723dade9, 0x6425ee03efc76a42, 0x059a52a59b91d724,
+    0xa1f261c7e9abd1b7, 0xc04ddd619dfd6cd1, 0x638c188a0007ab7a,
+    0x0233a42c7451161c, 0xa0119df2105dfcbf, 0xc1ae2154640b41d9,
+    0x626fe4bff9f18672, 0x03d058198da73b14, 0xa33498ac1b468aa7,
+    0xc28b240a6f1037c1, 0x614ae1e1f2eaf06a, 0x00f55d4786bc4d0c,
+    0xa2d76499e2b0a7af, 0xc368d83f96e61ac9, 0x60a91dd40b1cdd62,
+    0x0116a1727f4a6004, 0xad6675bfc4c709d6, 0xccd9c919b091b4b0,
+    0x6f180cf22d6b731b, 0x0ea7b054593dce7d, 0xac85898a3d3124de,
+    0xcd3a352c496799b8, 0x6efbf0c7d49d5e13, 0x0f444c61a0cbe375,
+    0xafa08cd4362a52c6, 0xce1f3072427cefa0, 0x6ddef599df86280b,
+    0x0c61493fabd0956d, 0xae4370e1cfdc7fce, 0xcffccc47bb8ac2a8,
+    0x6c3d09ac26700503, 0x0d82b50a5226b865, 0xa9ea8668201cbef6,
+    0xc8553ace544a0390, 0x6b94ff25c9b0c43b, 0x0a2b4383bde6795d,
+    0xa8097a5dd9ea93fe, 0xc9b6c6fbadbc2e98, 0x6a7703103046e933,
+    0x0bc8bfb644105455, 0xab2c7f03d2f1e5e6, 0xca93c3a5a6a75880,
+    0x6952064e3b5d9f2b, 0x08edbae84f0b224d, 0xaacf83362b07c8ee,
+    0xcb703f905f517588, 0x68b1fa7bc2abb223, 0x090e46ddb6fd0f45,
+    0xb54e5c4f9e1fb915, 0xd4f1e0e9ea490473, 0x7730250277b3c3d8,
+    0x168f99a403e57ebe, 0xb4ada07a67e9941d, 0xd5121cdc13bf297b,
+    0x76d3d9378e45eed0, 0x176c6591fa1353b6, 0xb788a5246cf2e205,
+    0xd637198218a45f63, 0x75f6dc69855e98c8, 0x144960cff10825ae,
+    0xb66b59119504cf0d, 0xd7d4e5b7e152726b, 0x7415205c7ca8b5c0,
+    0x15aa9cfa08fe08a6, 0xb1c2af987ac40e35, 0xd07d133e0e92b353,
+    0x73bcd6d5936874f8, 0x12036a73e73ec99e, 0xb02153ad8332233d,
+    0xd19eef0bf7649e5b, 0x725f2ae06a9e59f0, 0x13e096461ec8e496,
+    0xb30456f388295525, 0xd2bbea55fc7fe843, 0x717a2fbe61852fe8,
+    0x10c5931815d3928e, 0xb2e7aac671df782d, 0xd35816600589c54b,
+    0x7099d38b987302e0, 0x11266f2dec25bf86, 0xbd56bbe057a8d654,
+    0xdce9074623fe6b32, 0x7f28c2adbe04ac99, 0x1e977e0bca5211ff,
+    0xbcb547d5ae5efb5c, 0xdd0afb73da08463a, 0x7ecb3e9847f28191,
+    0x1f74823e33a43cf7, 0xbf90428ba5458d44, 0xde2ffe2dd1133022,
+    0x7dee3bc64ce9f789, 0x1c51876038bf4aef, 0xbe73bebe5cb3a04c,
+    0xdfcc021828e51d2a, 0x7c0dc7f3b51fda81, 0x1db27b55c14967e7,
+    0xb9da4837b3736174, 0xd865f491c725dc12, 0x7ba4317a5adf1bb9,
+    0x1a1b8ddc2e89a6df, 0xb839b4024a854c7c, 0xd98608a43ed3f11a,
+    0x7a47cd4fa32936b1, 0x1bf871e9d77f8bd7, 0xbb1cb15c419e3a64,
+    0xdaa30dfa35c88702, 0x7962c811a83240a9, 0x18dd74b7dc64fdcf,
+    0xbaff4d69b868176c, 0xdb40f1cfcc3eaa0a, 0x7881342451c46da1,
+    0x193e88822592d0c7},
+   {0x0000000000000000, 0xe3a8a43e5298c92c, 0xc651497da4309359,
+    0x25f9ed43f6a85a75, 0x8ca392fa486126b3, 0x6f0b36c41af9ef9f,
+    0x4af2db87ec51b5ea, 0xa95a7fb9bec97cc6, 0x9d592b5aba6d94f4,
+    0x7ef18f64e8f55dd8, 0x5b0862271e5d07ad, 0xb8a0c6194cc5ce81,
+    0x11fab9a0f20cb247, 0xf2521d9ea0947b6b, 0xd7abf0dd563c211e,
+    0x340354e304a4e832, 0xbfad581b5f74f07b, 0x5c05fc250dec3957,
+    0x79fc1166fb446322, 0x9a54b558a9dcaa0e, 0x330ecae11715d6c8,
+    0xd0a66edf458d1fe4, 0xf55f839cb3254591, 0x16f727a2e1bd8cbd,
+    0x22f47341e519648f, 0xc15cd77fb781ada3, 0xe4a53a3c4129f7d6,
+    0x070d9e0213b13efa, 0xae57e1bbad78423c, 0x4dff4585ffe08b10,
+    0x6806a8c60948d165, 0x8bae0cf85bd01849, 0x7e5bb136bee8e0f7,
+    0x9df31508ec7029db, 0xb80af84b1ad873ae, 0x5ba25c754840ba82,
+    0xf2f823ccf689c644, 0x115087f2a4110f68, 0x34a96ab152b9551d,
+    0xd701ce8f00219c31, 0xe3029a6c04857403, 0x00aa3e52561dbd2f,
+    0x2553d311a0b5e75a, 0xc6fb772ff22d2e76, 0x6fa108964ce452b0,
+    0x8c09aca81e7c9b9c, 0xa9f041ebe8d4c1e9, 0x4a58e5d5ba4c08c5,
+    0xc1f6e92de19c108c, 0x225e4d13b304d9a0, 0x07a7a05045ac83d5,
+    0xe40f046e17344af9, 0x4d557bd7a9fd363f, 0xaefddfe9fb65ff13,
+    0x8b0432aa0dcda566, 0x68ac96945f556c4a, 0x5cafc2775bf18478,
+    0xbf07664909694d54, 0x9afe8b0affc11721, 0x79562f34ad59de0d,
+    0xd00c508d1390a2cb, 0x33a4f4b341086be7, 0x165d19f0b7a03192,
+    0xf5f5bdcee538f8be, 0x79a86cc2577e197d, 0x9a00c8fc05e6d051,
+    0xbff925bff34e8a24, 0x5c518181a1d64308, 0xf50bfe381f1f3fce,
+    0x16a35a064d87f6e2, 0x335ab745bb2fac97, 0xd0f2137be9b765bb,
+    0xe4f14798ed138d89, 0x0759e3a6bf8b44a5, 0x22a00ee549231ed0,
+    0xc108aadb1bbbd7fc, 0x6852d562a572ab3a, 0x8bfa715cf7ea6216,
+    0xae039c1f01423863, 0x4dab382153daf14f, 0xc60534d9080ae906,
+    0x25ad90e75a92202a, 0x00547da4ac3a7a5f, 0xe3fcd99afea2b373,
+    0x4aa6a623406bcfb5, 0xa90e021d12f30699, 0x8cf7ef5ee45b5cec,
+    0x6f5f4b60b6c395c0, 0x5b5c1f83b2677df2, 0xb8f4bbbde0ffb4de,
+    0x9d0d56fe1657eeab, 0x7ea5f2c044cf2787, 0xd7ff8d79fa065b41,
+    0x34572947a89e926d, 0x11aec4045e36c818, 0xf206603a0cae0134,
+    0x07f3ddf4e996f98a, 0xe45b79cabb0e30a6, 0xc1a294894da66ad3,
+    0x220a30b71f3ea3ff, 0x8b504f0ea1f7df39, 0x68f8eb30f36f1615,
+    0x4d01067305c74c60, 0xaea9a24d575f854c, 0x9aaaf6ae53fb6d7e,
+    0x790252900163a452, 0x5cfbbfd3f7cbfe27, 0xbf531beda553370b,
+    0x160964541b9a4bcd, 0xf5a1c06a490282e1, 0xd0582d29bfaad894,
+    0x33f08917ed3211b8, 0xb85e85efb6e209f1, 0x5bf621d1e47ac0dd,
+    0x7e0fcc9212d29aa8, 0x9da768ac404a5384, 0x34fd1715fe832f42,
+    0xd755b32bac1be66e, 0xf2ac5e685ab3bc1b, 0x1104fa56082b7537,
+    0x2507aeb50c8f9d05, 0xc6af0a8b5e175429, 0xe356e7c8a8bf0e5c,
+    0x00fe43f6fa27c770, 0xa9a43c4f44eebbb6, 0x4a0c98711676729a,
+    0x6ff57532e0de28ef, 0x8c5dd10cb246e1c3, 0xf250d984affc32fa,
+    0x11f87dbafd64fbd6, 0x340190f90bcca1a3, 0xd7a934c75954688f,
+    0x7ef34b7ee79d1449, 0x9d5bef40b505dd65, 0xb8a2020343ad8710,
+    0x5b0aa63d11354e3c, 0x6f09f2de1591a60e, 0x8ca156e047096f22,
+    0xa958bba3b1a13557, 0x4af01f9de339fc7b, 0xe3aa60245df080bd,
+    0x0002c41a0f684991, 0x25fb2959f9c013e4, 0xc6538d67ab58dac8,
+    0x4dfd819ff088c281, 0xae5525a1a2100bad, 0x8bacc8e254b851d8,
+    0x68046cdc062098f4, 0xc15e1365b8e9e432, 0x22f6b75bea712d1e,
+    0x070f5a181cd9776b, 0xe4a7fe264e41be47, 0xd0a4aac54ae55675,
+    0x330c0efb187d9f59, 0x16f5e3b8eed5c52c, 0xf55d4786bc4d0c00,
+    0x5c07383f028470c6, 0xbfaf9c01501cb9ea, 0x9a567142a6b4e39f,
+    0x79fed57cf42c2ab3, 0x8c0b68b21114d20d, 0x6fa3cc8c438c1b21,
+    0x4a5a21cfb5244154, 0xa9f285f1e7bc8878, 0x00a8fa485975f4be,
+    0xe3005e760bed3d92, 0xc6f9b335fd4567e7, 0x2551170bafddaecb,
+    0x115243e8ab7946f9, 0xf2fae7d6f9e18fd5, 0xd7030a950f49d5a0,
+    0x34abaeab5dd11c8c, 0x9df1d112e318604a, 0x7e59752cb180a966,
+    0x5ba0986f4728f313, 0xb8083c5115b03a3f, 0x33a630a94e602276,
+    0xd00e94971cf8eb5a, 0xf5f779d4ea50b12f, 0x165fddeab8c87803,
+    0xbf05a253060104c5, 0x5cad066d5499cde9, 0x7954eb2ea231979c,
+    0x9afc4f10f0a95eb0, 0xaeff1bf3f40db682, 0x4d57bfcda6957fae,
+    0x68ae528e503d25db, 0x8b06f6b002a5ecf7, 0x225c8909bc6c9031,
+    0xc1f42d37eef4591d, 0xe40dc074185c0368, 0x07a5644a4ac4ca44,
+    0x8bf8b546f8822b87, 0x68501178aa1ae2ab, 0x4da9fc3b5cb2b8de,
+    0xae0158050e2a71f2, 0x075b27bcb0e30d34, 0xe4f38382e27bc418,
+    0xc10a6ec114d39e6d, 0x22a2caff464b5741, 0x16a19e1c42efbf73,
+    0xf5093a221077765f, 0xd0f0d761e6df2c2a, 0x3358735fb447e506,
+    0x9a020ce60a8e99c0, 0x79aaa8d8581650ec, 0x5c53459baebe0a99,
+    0xbffbe1a5fc26c3b5, 0x3455ed5da7f6dbfc, 0xd7fd4963f56e12d0,
+    0xf204a42003c648a5, 0x11ac001e515e8189, 0xb8f67fa7ef97fd4f,
+    0x5b5edb99bd0f3463, 0x7ea736da4ba76e16, 0x9d0f92e4193fa73a,
+    0xa90cc6071d9b4f08, 0x4aa462394f038624, 0x6f5d8f7ab9abdc51,
+    0x8cf52b44eb33157d, 0x25af54fd55fa69bb, 0xc607f0c30762a097,
+    0xe3fe1d80f1cafae2, 0x0056b9bea35233ce, 0xf5a30470466acb70,
+    0x160ba04e14f2025c, 0x33f24d0de25a5829, 0xd05ae933b0c29105,
+    0x7900968a0e0bedc3, 0x9aa832b45c9324ef, 0xbf51dff7aa3b7e9a,
+    0x5cf97bc9f8a3b7b6, 0x68fa2f2afc075f84, 0x8b528b14ae9f96a8,
+    0xaeab66575837ccdd, 0x4d03c2690aaf05f1, 0xe459bdd0b4667937,
+    0x07f119eee6feb01b, 0x2208f4ad1056ea6e, 0xc1a0509342ce2342,
+    0x4a0e5c6b191e3b0b, 0xa9a6f8554b86f227, 0x8c5f1516bd2ea852,
+    0x6ff7b128efb6617e, 0xc6adce91517f1db8, 0x25056aaf03e7d494,
+    0x00fc87ecf54f8ee1, 0xe35423d2a7d747cd, 0xd7577731a373afff,
+    0x34ffd30ff1eb66d3, 0x11063e4c07433ca6, 0xf2ae9a7255dbf58a,
+    0x5bf4e5cbeb12894c, 0xb85c41f5b98a4060, 0x9da5acb64f221a15,
+    0x7e0d08881dbad339},
+   {0x0000000000000000, 0xed1ffb675e8d6b11, 0xda3ff6cfbc1ad722,
+    0x37200da8e297bc33, 0xb47fec9f7935ae45, 0x596017f827b8c554,
+    0x6e401a50c52f7967, 0x835fe1379ba21276, 0x68ffd83ff36a5c8b,
+    0x85e02358ade7379a, 0xb2c02ef04f708ba9, 0x5fdfd59711fde0b8,
+    0xdc8034a08a5ff2ce, 0x319fcfc7d4d299df, 0x06bfc26f364525ec,
+    0xeba0390868c84efd, 0x55e0bfd0cd7a6084, 0xb8ff44b793f70b95,
+    0x8fdf491f7160b7a6, 0x62c0b2782feddcb7, 0xe19f534fb44fcec1,
+    0x0c80a828eac2a5d0, 0x3ba0a580085519e3, 0xd6bf5ee756d872f2,
+    0x3d1f67ef3e103c0f, 0xd0009c88609d571e, 0xe7209120820aeb2d,
+    0x0a3f6a47dc87803c, 0x89608b704725924a, 0x647f701719a8f95b,
+    0x535f7dbffb3f4568, 0xbe4086d8a5b22e79, 0x2fde710eb05a189a,
+    0xc2c18a69eed7738b, 0xf5e187c10c40cfb8, 0x18fe7ca652cda4a9,
+    0x9ba19d91c96fb6df, 0x76be66f697e2ddce, 0x419e6b5e757561fd,
+    0xac8190392bf80aec, 0x4721a93143304411, 0xaa3e52561dbd2f00,
+    0x9d1e5ffeff2a9333, 0x7001a499a1a7f822, 0xf35e45ae3a05ea54,
+    0x1e41bec964888145, 0x2961b361861f3d76, 0xc47e4806d8925667,
+    0x7a3ecede7d20781e, 0x972135b923ad130f, 0xa0013811c13aaf3c,
+    0x4d1ec3769fb7c42d, 0xce4122410415d65b, 0x235ed9265a98bd4a,
+    0x147ed48eb80f0179, 0xf9612fe9e6826a68, 0x12c116e18e4a2495,
+    0xffdeed86d0c74f84, 0xc8fee02e3250f3b7, 0x25e11b496cdd98a6,
+    0xa6befa7ef77f8ad0, 0x4ba10119a9f2e1c1, 0x7c810cb14b655df2,
+    0x919ef7d615e836e3, 0xdba2edb34b1ae8a6, 0x36bd16d4159783b7,
+    0x019d1b7cf7003f84, 0xec82e01ba98d5495, 0x6fdd012c322f46e3,
+    0x82c2fa4b6ca22df2, 0xb5e2f7e38e3591c1, 0x58fd0c84d0b8fad0,
+    0xb35d358cb870b42d, 0x5e42ceebe6fddf3c, 0x6962c343046a630f,
+    0x847d38245ae7081e, 0x0722d913c1451a68, 0xea3d22749fc87179,
+    0xdd1d2fdc7d5fcd4a, 0x3002d4bb23d2a65b, 0x8e42526386608822,
+    0x635da904d8ede333, 0x547da4ac3a7a5f00, 0xb9625fcb64f73411,
+    0x3a3dbefcff552667, 0xd722459ba1d84d76, 0xe0024833434ff145,
+    0x0d1db3541dc29a54, 0xe6bd8a5c750ad4a9, 0x0ba2713b2b87bfb8,
+    0x3c827c93c910038b, 0xd19d87f4979d689a, 0x52c266c30c3f7aec,
+    0xbfdd9da452b211fd, 0x88fd900cb025adce, 0x65e26b6beea8c6df,
+    0xf47c9cbdfb40f03c, 0x196367daa5cd9b2d, 0x2e436a72475a271e,
+    0xc35c911519d74c0f, 0x4003702282755e79, 0xad1c8b45dcf83568,
+    0x9a3c86ed3e6f895b, 0x77237d8a60e2e24a, 0x9c834482082aacb7,
+    0x719cbfe556a7c7a6, 0x46bcb24db4307b95, 0xaba3492aeabd1084,
+    0x28fca81d711f02f2, 0xc5e3537a2f9269e3, 0xf2c35ed2cd05d5d0,
+    0x1fdca5b59388bec1, 0xa19c236d363a90b8, 0x4c83d80a68b7fba9,
+    0x7ba3d5a28a20479a, 0x96bc2ec5d4ad2c8b, 0x15e3cff24f0f3efd,
+    0xf8fc3495118255ec, 0xcfdc393df315e9df, 0x22c3c25aad9882ce,
+    0xc963fb52c550cc33, 0x247c00359bdda722, 0x135c0d9d794a1b11,
+    0xfe43f6fa27c77000, 0x7d1c17cdbc656276, 0x9003ecaae2e80967,
+    0xa723e102007fb554, 0x4a3c1a655ef2de45, 0x335bd5c8bc9b08df,
+    0xde442eafe21663ce, 0xe96423070081dffd, 0x047bd8605e0cb4ec,
+    0x87243957c5aea69a, 0x6a3bc2309b23cd8b, 0x5d1bcf9879b471b8,
+    0xb00434ff27391aa9, 0x5ba40df74ff15454, 0xb6bbf690117c3f45,
+    0x819bfb38f3eb8376, 0x6c84005fad66e867, 0xefdbe16836c4fa11,
+    0x02c41a0f68499100, 0x35e417a78ade2d33, 0xd8fbecc0d4534622,
+    0x66bb6a1871e1685b, 0x8ba4917f2f6c034a, 0xbc849cd7cdfbbf79,
+    0x519b67b09376d468, 0xd2c4868708d4c61e, 0x3fdb7de05659ad0f,
+    0x08fb7048b4ce113c, 0xe5e48b2fea437a2d, 0x0e44b227828b34d0,
+    0xe35b4940dc065fc1, 0xd47b44e83e91e3f2, 0x3964bf8f601c88e3,
+    0xba3b5eb8fbbe9a95, 0x5724a5dfa533f184, 0x6004a87747a44db7,
+    0x8d1b5310192926a6, 0x1c85a4c60cc11045, 0xf19a5fa1524c7b54,
+    0xc6ba5209b0dbc767, 0x2ba5a96eee56ac76, 0xa8fa485975f4be00,
+    0x45e5b33e2b79d511, 0x72c5be96c9ee6922, 0x9fda45f197630233,
+    0x747a7cf9ffab4cce, 0x9965879ea12627df, 0xae458a3643b19bec,
+    0x435a71511d3cf0fd, 0xc0059066869ee28b, 0x2d1a6b01d813899a,
+    0x1a3a66a93a8435a9, 0xf7259dce64095eb8, 0x49651b16c1bb70c1,
+    0xa47ae0719f361bd0, 0x935aedd97da1a7e3, 0x7e4516be232cccf2,
+    0xfd1af789b88ede84, 0x10050ceee603b595, 0x27250146049409a6,
+    0xca3afa215a1962b7, 0x219ac32932d12c4a, 0xcc85384e6c5c475b,
+    0xfba535e68ecbfb68, 0x16bace81d0469079, 0x95e52fb64be4820f,
+    0x78fad4d11569e91e, 0x4fdad979f7fe552d, 0xa2c5221ea9733e3c,
+    0xe8f9387bf781e079, 0x05e6c31ca90c8b68, 0x32c6ceb44b9b375b,
+    0xdfd935d315165c4a, 0x5c86d4e48eb44e3c, 0xb1992f83d039252d,
+    0x86b9222b32ae991e, 0x6ba6d94c6c23f20f, 0x8006e04404ebbcf2,
+    0x6d191b235a66d7e3, 0x5a39168bb8f16bd0, 0xb726edece67c00c1,
+    0x34790cdb7dde12b7, 0xd966f7bc235379a6, 0xee46fa14c1c4c595,
+    0x035901739f49ae84, 0xbd1987ab3afb80fd, 0x50067ccc6476ebec,
+    0x6726716486e157df, 0x8a398a03d86c3cce, 0x09666b3443ce2eb8,
+    0xe47990531d4345a9, 0xd3599dfbffd4f99a, 0x3e46669ca159928b,
+    0xd5e65f94c991dc76, 0x38f9a4f3971cb767, 0x0fd9a95b758b0b54,
+    0xe2c6523c2b066045, 0x6199b30bb0a47233, 0x8c86486cee291922,
+    0xbba645c40cbea511, 0x56b9bea35233ce00, 0xc727497547dbf8e3,
+    0x2a38b212195693f2, 0x1d18bfbafbc12fc1, 0xf00744dda54c44d0,
+    0x7358a5ea3eee56a6, 0x9e475e8d60633db7, 0xa967532582f48184,
+    0x4478a842dc79ea95, 0xafd8914ab4b1a468, 0x42c76a2dea3ccf79,
+    0x75e7678508ab734a, 0x98f89ce25626185b, 0x1ba77dd5cd840a2d,
+    0xf6b886b29309613c, 0xc1988b1a719edd0f, 0x2c87707d2f13b61e,
+    0x92c7f6a58aa19867, 0x7fd80dc2d42cf376, 0x48f8006a36bb4f45,
+    0xa5e7fb0d68362454, 0x26b81a3af3943622, 0xcba7e15dad195d33,
+    0xfc87ecf54f8ee100, 0x1198179211038a11, 0xfa382e9a79cbc4ec,
+    0x1727d5fd2746affd, 0x2007d855c5d113ce, 0xcd1823329b5c78df,
+    0x4e47c20500fe6aa9, 0xa35839625e7301b8, 0x947834cabce4bd8b,
+    0x7967cfade269d69a},
+   {0x0000000000000000, 0x540273c3915da369, 0xa804e68623bb46d3,
+    0xfc069545b2e6e5ba, 0xd517c2a26cd95534, 0x8115b161fd84f65d,
+    0x7d1324244f6213e7, 0x291157e7de3fb08e, 0xaa2f8445d9b2ab68,
+    0xfe2df78648ef0801, 0x022b62c3fa09edbb, 0x562911006b544ed2,
+    0x7f3846e7b56bfe5c, 0x2b3a352424365d35, 0xd73ca06196d0b88f,
+    0x833ed3a2078d1be6, 0x545f088bb26557d1, 0x005d7b482338f4b8,
+    0xfc5bee0d91de1102, 0xa8599dce0083b26b, 0x8148ca29debc02e5,
+    0xd54ab9ea4fe1a18c, 0x294c2caffd074436, 0x7d4e5f6c6c5ae75f,
+    0xfe708cce6bd7fcb9, 0xaa72ff0dfa8a5fd0, 0x56746a48486cba6a,
+    0x0276198bd9311903, 0x2b674e6c070ea98d, 0x7f653daf96530ae4,
+    0x8363a8ea24b5ef5e, 0xd761db29b5e84c37, 0x2da01eb94e647630,
+    0x79a26d7adf39d559, 0x85a4f83f6ddf30e3, 0xd1a68bfcfc82938a,
+    0xf8b7dc1b22bd2304, 0xacb5afd8b3e0806d, 0x50b33a9d010665d7,
+    0x04b1495e905bc6be, 0x878f9afc97d6dd58, 0xd38de93f068b7e31,
+    0x2f8b7c7ab46d9b8b, 0x7b890fb9253038e2, 0x5298585efb0f886c,
+    0x069a2b9d6a522b05, 0xfa9cbed8d8b4cebf, 0xae9ecd1b49e96dd6,
+    0x79ff1632fc0121e1, 0x2dfd65f16d5c8288, 0xd1fbf0b4dfba6732,
+    0x85f983774ee7c45b, 0xace8d49090d874d5, 0xf8eaa7530185d7bc,
+    0x04ec3216b3633206, 0x50ee41d5223e916f, 0xd3d0927725b38a89,
+    0x87d2e1b4b4ee29e0, 0x7bd474f10608cc5a, 0x2fd6073297556f33,
+    0x06c750d5496adfbd, 0x52c52316d8377cd4, 0xaec3b6536ad1996e,
+    0xfac1c590fb8c3a07, 0x5a403d729dc8ec60, 0x0e424eb10c954f09,
+    0xf244dbf4be73aab3, 0xa646a8372f2e09da, 0x8f57ffd0f111b954,
+    0xdb558c13604c1a3d, 0x27531956d2aaff87, 0x73516a9543f75cee,
+    0xf06fb937447a4708, 0xa46dcaf4d527e461, 0x586b5fb167c101db,
+    0x0c692c72f69ca2b2, 0x25787b9528a3123c, 0x717a0856b9feb155,
+    0x8d7c9d130b1854ef, 0xd97eeed09a45f786, 0x0e1f35f92fadbbb1,
+    0x5a1d463abef018d8, 0xa61bd37f0c16fd62, 0xf219a0bc9d4b5e0b,
+    0xdb08f75b4374ee85, 0x8f0a8498d2294dec, 0x730c11dd60cfa856,
+    0x270e621ef1920b3f, 0xa430b1bcf61f10d9, 0xf032c27f6742b3b0,
+    0x0c34573ad5a4560a, 0x583624f944f9f563, 0x7127731e9ac645ed,
+    0x252500dd0b9be684, 0xd9239598b97d033e, 0x8d21e65b2820a057,
+    0x77e023cbd3ac9a50, 0x23e2500842f13939, 0xdfe4c54df017dc83,
+    0x8be6b68e614a7fea, 0xa2f7e169bf75cf64, 0xf6f592aa2e286c0d,
+    0x0af307ef9cce89b7, 0x5ef1742c0d932ade, 0xddcfa78e0a1e3138,
+    0x89cdd44d9b439251, 0x75cb410829a577eb, 0x21c932cbb8f8d482,
+    0x08d8652c66c7640c, 0x5cda16eff79ac765, 0xa0dc83aa457c22df,
+    0xf4def069d42181b6, 0x23bf2b4061c9cd81, 0x77bd5883f0946ee8,
+    0x8bbbcdc642728b52, 0xdfb9be05d32f283b, 0xf6a8e9e20d1098b5,
+    0xa2aa9a219c4d3bdc, 0x5eac0f642eabde66, 0x0aae7ca7bff67d0f,
+    0x8990af05b87b66e9, 0xdd92dcc62926c580, 0x219449839bc0203a,
+    0x75963a400a9d8353, 0x5c876da7d4a233dd, 0x08851e6445ff90b4,
+    0xf4838b21f719750e, 0xa081f8e26644d667, 0xb4807ae43a91d9c1,
+    0xe0820927abcc7aa8, 0x1c849c62192a9f12, 0x4886efa188773c7b,
+    0x6197b84656488cf5, 0x3595cb85c7152f9c, 0xc9935ec075f3ca26,
+    0x9d912d03e4ae694f, 0x1eaffea1e32372a9, 0x4aad8d62727ed1c0,
+    0xb6ab1827c098347a, 0xe2a96be451c59713, 0xcbb83c038ffa279d,
+    0x9fba4fc01ea784f4, 0x63bcda85ac41614e, 0x37bea9463d1cc227,
+    0xe0df726f88f48e10, 0xb4dd01ac19a92d79, 0x48db94e9ab4fc8c3,
+    0x1cd9e72a3a126baa, 0x35c8b0cde42ddb24, 0x61cac30e7570784d,
+    0x9dcc564bc7969df7, 0xc9ce258856cb3e9e, 0x4af0f62a51462578,
+    0x1ef285e9c01b8611, 0xe2f410ac72fd63ab, 0xb6f6636fe3a0c0c2,
+    0x9fe734883d9f704c, 0xcbe5474bacc2d325, 0x37e3d20e1e24369f,
+    0x63e1a1cd8f7995f6, 0x9920645d74f5aff1, 0xcd22179ee5a80c98,
+    0x312482db574ee922, 0x6526f118c6134a4b, 0x4c37a6ff182cfac5,
+    0x1835d53c897159ac, 0xe43340793b97bc16, 0xb03133baaaca1f7f,
+    0x330fe018ad470499, 0x670d93db3c1aa7f0, 0x9b0b069e8efc424a,
+    0xcf09755d1fa1e123, 0xe61822bac19e51ad, 0xb21a517950c3f2c4,
+    0x4e1cc43ce225177e, 0x1a1eb7ff7378b417, 0xcd7f6cd6c690f820,
+    0x997d1f1557cd5b49, 0x657b8a50e52bbef3, 0x3179f99374761d9a,
+    0x1868ae74aa49ad14, 0x4c6addb73b140e7d, 0xb06c48f289f2ebc7,
+    0xe46e3b3118af48ae, 0x6750e8931f225348, 0x33529b508e7ff021,
+    0xcf540e153c99159b, 0x9b567dd6adc4b6f2, 0xb2472a3173fb067c,
+    0xe64559f2e2a6a515, 0x1a43ccb7504040af, 0x4e41bf74c11de3c6,
+    0xeec04796a75935a1, 0xbac23455360496c8, 0x46c4a11084e27372,
+    0x12c6d2d315bfd01b, 0x3bd78534cb806095, 0x6fd5f6f75addc3fc,
+    0x93d363b2e83b2646, 0xc7d110717966852f, 0x44efc3d37eeb9ec9,
+    0x10edb010efb63da0, 0xeceb25555d50d81a, 0xb8e95696cc0d7b73,
+    0x91f801711232cbfd, 0xc5fa72b2836f6894, 0x39fce7f731898d2e,
+    0x6dfe9434a0d42e47, 0xba9f4f1d153c6270, 0xee9d3cde8461c119,
+    0x129ba99b368724a3, 0x4699da58a7da87ca, 0x6f888dbf79e53744,
+    0x3b8afe7ce8b8942d, 0xc78c6b395a5e7197, 0x938e18facb03d2fe,
+    0x10b0cb58cc8ec918, 0x44b2b89b5dd36a71, 0xb8b42ddeef358fcb,
+    0xecb65e1d7e682ca2, 0xc5a709faa0579c2c, 0x91a57a39310a3f45,
+    0x6da3ef7c83ecdaff, 0x39a19cbf12b17996, 0xc360592fe93d4391,
+    0x97622aec7860e0f8, 0x6b64bfa9ca860542, 0x3f66cc6a5bdba62b,
+    0x16779b8d85e416a5, 0x4275e84e14b9b5cc, 0xbe737d0ba65f5076,
+    0xea710ec83702f31f, 0x694fdd6a308fe8f9, 0x3d4daea9a1d24b90,
+    0xc14b3bec1334ae2a, 0x9549482f82690d43, 0xbc581fc85c56bdcd,
+    0xe85a6c0bcd0b1ea4, 0x145cf94e7fedfb1e, 0x405e8a8deeb05877,
+    0x973f51a45b581440, 0xc33d2267ca05b729, 0x3f3bb72278e35293,
+    0x6b39c4e1e9bef1fa, 0x4228930637814174, 0x162ae0c5a6dce21d,
+    0xea2c7580143a07a7, 0xbe2e06438567a4ce, 0x3d10d5e182eabf28,
+    0x6912a62213b71c41, 0x95143367a151f9fb, 0xc11640a4300c5a92,
+    0xe8071743ee33ea1c, 0xbc0564807f6e4975, 0x4003f1c5cd88accf,
+    0x140182065cd50fa6}};
+
+#endif /* N == 5 */
+#if N == 6
+
+static const uint64_t crc64_braid_table[][256] = {
+   {0x0000000000000000, 0xb5ea1af9c013aca4, 0xf90c9ad82f2947cd,
+    0x4ce68021ef3aeb69, 0x60c19a9bf15c911f, 0xd52b8062314f3dbb,
+    0x99cd0043de75d6d2, 0x2c271aba1e667a76, 0xc1833537e2b9223e,
+    0x74692fce22aa8e9a, 0x388fafefcd9065f3, 0x8d65b5160d83c957,
+    0xa142afac13e5b321, 0x14a8b555d3f61f85, 0x584e35743cccf4ec,
+    0xeda42f8dfcdf5848, 0x11dec5446a7c5af9, 0xa434dfbdaa6ff65d,
+    0xe8d25f9c45551d34, 0x5d3845658546b190, 0x711f5fdf9b20cbe6,
+    0xc4f545265b336742, 0x8813c507b4098c2b, 0x3df9dffe741a208f,
+    0xd05df07388c578c7, 0x65b7ea8a48d6d463, 0x29516aaba7ec3f0a,
+    0x9cbb705267ff93ae, 0xb09c6ae87999e9d8, 0x05767011b98a457c,
+    0x4990f03056b0ae15, 0xfc7aeac996a302b1, 0x23bd8a88d4f8b5f2,
+    0x9657907114eb1956, 0xdab11050fbd1f23f, 0x6f5b0aa93bc25e9b,
+    0x437c101325a424ed, 0xf6960aeae5b78849, 0xba708acb0a8d6320,
+    0x0f9a9032ca9ecf84, 0xe23ebfbf364197cc, 0x57d4a546f6523b68,
+    0x1b3225671968d001, 0xaed83f9ed97b7ca5, 0x82ff2524c71d06d3,
+    0x37153fdd070eaa77, 0x7bf3bffce834411e, 0xce19a5052827edba,
+    0x32634fccbe84ef0b, 0x878955357e9743af, 0xcb6fd51491ada8c6,
+    0x7e85cfed51be0462, 0x52a2d5574fd87e14, 0xe748cfae8fcbd2b0,
+    0xabae4f8f60f139d9, 0x1e445576a0e2957d, 0xf3e07afb5c3dcd35,
+    0x460a60029c2e6191, 0x0aece02373148af8, 0xbf06fadab307265c,
+    0x9321e060ad615c2a, 0x26cbfa996d72f08e, 0x6a2d7ab882481be7,
+    0xdfc76041425bb743, 0x477b1511a9f16be4, 0xf2910fe869e2c740,
+    0xbe778fc986d82c29, 0x0b9d953046cb808d, 0x27ba8f8a58adfafb,
+    0x9250957398be565f, 0xdeb615527784bd36, 0x6b5c0fabb7971192,
+    0x86f820264b4849da, 0x33123adf8b5be57e, 0x7ff4bafe64610e17,
+    0xca1ea007a472a2b3, 0xe639babdba14d8c5, 0x53d3a0447a077461,
+    0x1f352065953d9f08, 0xaadf3a9c552e33ac, 0x56a5d055c38d311d,
+    0xe34fcaac039e9db9, 0xafa94a8deca476d0, 0x1a4350742cb7da74,
+    0x36644ace32d1a002, 0x838e5037f2c20ca6, 0xcf68d0161df8e7cf,
+    0x7a82caefddeb4b6b, 0x9726e56221341323, 0x22ccff9be127bf87,
+    0x6e2a7fba0e1d54ee, 0xdbc06543ce0ef84a, 0xf7e77ff9d068823c,
+    0x420d6500107b2e98, 0x0eebe521ff41c5f1, 0xbb01ffd83f526955,
+    0x64c69f997d09de16, 0xd12c8560bd1a72b2, 0x9dca0541522099db,
+    0x28201fb89233357f, 0x040705028c554f09, 0xb1ed1ffb4c46e3ad,
+    0xfd0b9fdaa37c08c4, 0x48e18523636fa460, 0xa545aaae9fb0fc28,
+    0x10afb0575fa3508c, 0x5c493076b099bbe5, 0xe9a32a8f708a1741,
+    0xc58430356eec6d37, 0x706e2accaeffc193, 0x3c88aaed41c52afa,
+    0x8962b01481d6865e, 0x75185add177584ef, 0xc0f24024d766284b,
+    0x8c14c005385cc322, 0x39fedafcf84f6f86, 0x15d9c046e62915f0,
+    0xa033dabf263ab954, 0xecd55a9ec900523d, 0x593f40670913fe99,
+    0xb49b6feaf5cca6d1, 0x0171751335df0a75, 0x4d97f532dae5e11c,
+    0xf87defcb1af64db8, 0xd45af571049037ce, 0x61b0ef88c4839b6a,
+    0x2d566fa92bb97003, 0x98bc7550ebaadca7, 0x8ef62a2353e2d7c8,
+    0x3b1c30da93f17b6c, 0x77fab0fb7ccb9005, 0xc210aa02bcd83ca1,
+    0xee37b0b8a2be46d7, 0x5bddaa4162adea73, 0x173b2a608d97011a,
+    0xa2d130994d84adbe, 0x4f751f14b15bf5f6, 0xfa9f05ed71485952,
+    0xb67985cc9e72b23b, 0x03939f355e611e9f, 0x2fb4858f400764e9,
+    0x9a5e9f768014c84d, 0xd6b81f576f2e2324, 0x635205aeaf3d8f80,
+    0x9f28ef67399e8d31, 0x2ac2f59ef98d2195, 0x662475bf16b7cafc,
+    0xd3ce6f46d6a46658, 0xffe975fcc8c21c2e, 0x4a036f0508d1b08a,
+    0x06e5ef24e7eb5be3, 0xb30ff5dd27f8f747, 0x5eabda50db27af0f,
+    0xeb41c0a91b3403ab, 0xa7a74088f40ee8c2, 0x124d5a71341d4466,
+    0x3e6a40cb2a7b3e10, 0x8b805a32ea6892b4, 0xc766da13055279dd,
+    0x728cc0eac541d579, 0xad4ba0ab871a623a, 0x18a1ba524709ce9e,
+    0x54473a73a83325f7, 0xe1ad208a68208953, 0xcd8a3a307646f325,
+    0x786020c9b6555f81, 0x3486a0e8596fb4e8, 0x816cba11997c184c,
+    0x6cc8959c65a34004, 0xd9228f65a5b0eca0, 0x95c40f444a8a07c9,
+    0x202e15bd8a99ab6d, 0x0c090f0794ffd11b, 0xb9e315fe54ec7dbf,
+    0xf50595dfbbd696d6, 0x40ef8f267bc53a72, 0xbc9565efed6638c3,
+    0x097f7f162d759467, 0x4599ff37c24f7f0e, 0xf073e5ce025cd3aa,
+    0xdc54ff741c3aa9dc, 0x69bee58ddc290578, 0x255865ac3313ee11,
+    0x90b27f55f30042b5, 0x7d1650d80fdf1afd, 0xc8fc4a21cfccb659,
+    0x841aca0020f65d30, 0x31f0d0f9e0e5f194, 0x1dd7ca43fe838be2,
+    0xa83dd0ba3e902746, 0xe4db509bd1aacc2f, 0x51314a6211b9608b,
+    0xc98d3f32fa13bc2c, 0x7c6725cb3a001088, 0x3081a5ead53afbe1,
+    0x856bbf1315295745, 0xa94ca5a90b4f2d33, 0x1ca6bf50cb5c8197,
+    0x50403f7124666afe, 0xe5aa2588e475c65a, 0x080e0a0518aa9e12,
+    0xbde410fcd8b932b6, 0xf10290dd3783d9df, 0x44e88a24f790757b,
+    0x68cf909ee9f60f0d, 0xdd258a6729e5a3a9, 0x91c30a46c6df48c0,
+    0x242910bf06cce464, 0xd853fa76906fe6d5, 0x6db9e08f507c4a71,
+    0x215f60aebf46a118, 0x94b57a577f550dbc, 0xb89260ed613377ca,
+    0x0d787a14a120db6e, 0x419efa354e1a3007, 0xf474e0cc8e099ca3,
+    0x19d0cf4172d6c4eb, 0xac3ad5b8b2c5684f, 0xe0dc55995dff8326,
+    0x55364f609dec2f82, 0x791155da838a55f4, 0xccfb4f234399f950,
+    0x801dcf02aca31239, 0x35f7d5fb6cb0be9d, 0xea30b5ba2eeb09de,
+    0x5fdaaf43eef8a57a, 0x133c2f6201c24e13, 0xa6d6359bc1d1e2b7,
+    0x8af12f21dfb798c1, 0x3f1b35d81fa43465, 0x73fdb5f9f09edf0c,
+    0xc617af00308d73a8, 0x2bb3808dcc522be0, 0x9e599a740c418744,
+    0xd2bf1a55e37b6c2d, 0x675500ac2368c089, 0x4b721a163d0ebaff,
+    0xfe9800effd1d165b, 0xb27e80ce1227fd32, 0x07949a37d2345196,
+    0xfbee70fe44975327, 0x4e046a078484ff83, 0x02e2ea266bbe14ea,
+    0xb708f0dfabadb84e, 0x9b2fea65b5cbc238, 0x2ec5f09c75d86e9c,
+    0x622370bd9ae285f5, 0xd7c96a445af12951, 0x3a6d45c9a62e7119,
+    0x8f875f30663dddbd, 0xc361df11890736d4, 0x768bc5e849149a70,
+    0x5aacdf525772e006, 0xef46c5ab97614ca2, 0xa3a0458a785ba7cb,
+    0x164a5f73b8480b6f},
+   {0x0000000000000000, 0x8f34fb6d08cbb115, 0x8cb159f1be997caf,
+    0x0385a29cb652cdba, 0x8bba1cc8d23ce7db, 0x048ee7a5daf756ce,
+    0x070b45396ca59b74, 0x883fbe54646e2a61, 0x85ac96ba0b77d133,
+    0x0a986dd703bc6026, 0x091dcf4bb5eead9c, 0x86293426bd251c89,
+    0x0e168a72d94b36e8, 0x8122711fd18087fd, 0x82a7d38367d24a47,
+    0x0d9328ee6f19fb52, 0x9981825fb9e1bce3, 0x16b57932b12a0df6,
+    0x1530dbae0778c04c, 0x9a0420c30fb37159, 0x123b9e976bdd5b38,
+    0x9d0f65fa6316ea2d, 0x9e8ac766d5442797, 0x11be3c0bdd8f9682,
+    0x1c2d14e5b2966dd0, 0x9319ef88ba5ddcc5, 0x909c4d140c0f117f,
+    0x1fa8b67904c4a06a, 0x9797082d60aa8a0b, 0x18a3f34068613b1e,
+    0x1b2651dcde33f6a4, 0x9412aab1d6f847b1, 0xa1dbab94dccd6743,
+    0x2eef50f9d406d656, 0x2d6af26562541bec, 0xa25e09086a9faaf9,
+    0x2a61b75c0ef18098, 0xa5554c31063a318d, 0xa6d0eeadb068fc37,
+    0x29e415c0b8a34d22, 0x24773d2ed7bab670, 0xab43c643df710765,
+    0xa8c664df6923cadf, 0x27f29fb261e87bca, 0xafcd21e6058651ab,
+    0x20f9da8b0d4de0be, 0x237c7817bb1f2d04, 0xac48837ab3d49c11,
+    0x385a29cb652cdba0, 0xb76ed2a66de76ab5, 0xb4eb703adbb5a70f,
+    0x3bdf8b57d37e161a, 0xb3e03503b7103c7b, 0x3cd4ce6ebfdb8d6e,
+    0x3f516cf2098940d4, 0xb065979f0142f1c1, 0xbdf6bf716e5b0a93,
+    0x32c2441c6690bb86, 0x3147e680d0c2763c, 0xbe731dedd809c729,
+    0x364ca3b9bc67ed48, 0xb97858d4b4ac5c5d, 0xbafdfa4802fe91e7,
+    0x35c901250a3520f2, 0xd16ff8021694d003, 0x5e5b036f1e5f6116,
+    0x5ddea1f3a80dacac, 0xd2ea5a9ea0c61db9, 0x5ad5e4cac4a837d8,
+    0xd5e11fa7cc6386cd, 0xd664bd3b7a314b77, 0x5950465672fafa62,
+    0x54c36eb81de30130, 0xdbf795d51528b025, 0xd8723749a37a7d9f,
+    0x5746cc24abb1cc8a, 0xdf797270cfdfe6eb, 0x504d891dc71457fe,
+    0x53c82b8171469a44, 0xdcfcd0ec798d2b51, 0x48ee7a5daf756ce0,
+    0xc7da8130a7beddf5, 0xc45f23ac11ec104f, 0x4b6bd8c11927a15a,
+    0xc35466957d498b3b, 0x4c609df875823a2e, 0x4fe53f64c3d0f794,
+    0xc0d1c409cb1b4681, 0xcd42ece7a402bdd3, 0x4276178aacc90cc6,
+    0x41f3b5161a9bc17c, 0xcec74e7b12507069, 0x46f8f02f763e5a08,
+    0xc9cc0b427ef5eb1d, 0xca49a9dec8a726a7, 0x457d52b3c06c97b2,
+    0x70b45396ca59b740, 0xff80a8fbc2920655, 0xfc050a6774c0cbef,
+    0x7331f10a7c0b7afa, 0xfb0e4f5e1865509b, 0x743ab43310aee18e,
+    0x77bf16afa6fc2c34, 0xf88bedc2ae379d21, 0xf518c52cc12e6673,
+    0x7a2c3e41c9e5d766, 0x79a99cdd7fb71adc, 0xf69d67b0777cabc9,
+    0x7ea2d9e4131281a8, 0xf19622891bd930bd, 0xf2138015ad8bfd07,
+    0x7d277b78a5404c12, 0xe935d1c973b80ba3, 0x66012aa47b73bab6,
+    0x65848838cd21770c, 0xeab07355c5eac619, 0x628fcd01a184ec78,
+    0xedbb366ca94f5d6d, 0xee3e94f01f1d90d7, 0x610a6f9d17d621c2,
+    0x6c99477378cfda90, 0xe3adbc1e70046b85, 0xe0281e82c656a63f,
+    0x6f1ce5efce9d172a, 0xe7235bbbaaf33d4b, 0x6817a0d6a2388c5e,
+    0x6b92024a146a41e4, 0xe4a6f9271ca1f0f1, 0x30075f2f8227be83,
+    0xbf33a4428aec0f96, 0xbcb606de3cbec22c, 0x3382fdb334757339,
+    0xbbbd43e7501b5958, 0x3489b88a58d0e84d, 0x370c1a16ee8225f7,
+    0xb838e17be64994e2, 0xb5abc99589506fb0, 0x3a9f32f8819bdea5,
+    0x391a906437c9131f, 0xb62e6b093f02a20a, 0x3e11d55d5b6c886b,
+    0xb1252e3053a7397e, 0xb2a08cace5f5f4c4, 0x3d9477c1ed3e45d1,
+    0xa986dd703bc60260, 0x26b2261d330db375, 0x25378481855f7ecf,
+    0xaa037fec8d94cfda, 0x223cc1b8e9fae5bb, 0xad083ad5e13154ae,
+    0xae8d984957639914, 0x21b963245fa82801, 0x2c2a4bca30b1d353,
+    0xa31eb0a7387a6246, 0xa09b123b8e28affc, 0x2fafe95686e31ee9,
+    0xa7905702e28d3488, 0x28a4ac6fea46859d, 0x2b210ef35c144827,
+    0xa415f59e54dff932, 0x91dcf4bb5eead9c0, 0x1ee80fd6562168d5,
+    0x1d6dad4ae073a56f, 0x92595627e8b8147a, 0x1a66e8738cd63e1b,
+    0x9552131e841d8f0e, 0x96d7b182324f42b4, 0x19e34aef3a84f3a1,
+    0x14706201559d08f3, 0x9b44996c5d56b9e6, 0x98c13bf0eb04745c,
+    0x17f5c09de3cfc549, 0x9fca7ec987a1ef28, 0x10fe85a48f6a5e3d,
+    0x137b273839389387, 0x9c4fdc5531f32292, 0x085d76e4e70b6523,
+    0x87698d89efc0d436, 0x84ec2f155992198c, 0x0bd8d4785159a899,
+    0x83e76a2c353782f8, 0x0cd391413dfc33ed, 0x0f5633dd8baefe57,
+    0x8062c8b083654f42, 0x8df1e05eec7cb410, 0x02c51b33e4b70505,
+    0x0140b9af52e5c8bf, 0x8e7442c25a2e79aa, 0x064bfc963e4053cb,
+    0x897f07fb368be2de, 0x8afaa56780d92f64, 0x05ce5e0a88129e71,
+    0xe168a72d94b36e80, 0x6e5c5c409c78df95, 0x6dd9fedc2a2a122f,
+    0xe2ed05b122e1a33a, 0x6ad2bbe5468f895b, 0xe5e640884e44384e,
+    0xe663e214f816f5f4, 0x69571979f0dd44e1, 0x64c431979fc4bfb3,
+    0xebf0cafa970f0ea6, 0xe8756866215dc31c, 0x6741930b29967209,
+    0xef7e2d5f4df85868, 0x604ad6324533e97d, 0x63cf74aef36124c7,
+    0xecfb8fc3fbaa95d2, 0x78e925722d52d263, 0xf7ddde1f25996376,
+    0xf4587c8393cbaecc, 0x7b6c87ee9b001fd9, 0xf35339baff6e35b8,
+    0x7c67c2d7f7a584ad, 0x7fe2604b41f74917, 0xf0d69b26493cf802,
+    0xfd45b3c826250350, 0x727148a52eeeb245, 0x71f4ea3998bc7fff,
+    0xfec011549077ceea, 0x76ffaf00f419e48b, 0xf9cb546dfcd2559e,
+    0xfa4ef6f14a809824, 0x757a0d9c424b2931, 0x40b30cb9487e09c3,
+    0xcf87f7d440b5b8d6, 0xcc025548f6e7756c, 0x4336ae25fe2cc479,
+    0xcb0910719a42ee18, 0x443deb1c92895f0d, 0x47b8498024db92b7,
+    0xc88cb2ed2c1023a2, 0xc51f9a034309d8f0, 0x4a2b616e4bc269e5,
+    0x49aec3f2fd90a45f, 0xc69a389ff55b154a, 0x4ea586cb91353f2b,
+    0xc1917da699fe8e3e, 0xc214df3a2fac4384, 0x4d2024572767f291,
+    0xd9328ee6f19fb520, 0x5606758bf9540435, 0x5583d7174f06c98f,
+    0xdab72c7a47cd789a, 0x5288922e23a352fb, 0xddbc69432b68e3ee,
+    0xde39cbdf9d3a2e54, 0x510d30b295f19f41, 0x5c9e185cfae86413,
+    0xd3aae331f223d506, 0xd02f41ad447118bc, 0x5f1bbac04cbaa9a9,
+    0xd724049428d483c8, 0x5810fff9201f32dd, 0x5b955d65964dff67,
+    0xd4a1a6089e864e72},
+   {0x0000000000000000, 0x600ebe5f044f7d06, 0xc01d7cbe089efa0c,
+    0xa013c2e10cd1870a, 0x12e25657be33ea9d, 0x72ece808ba7c979b,
+    0xd2ff2ae9b6ad1091, 0xb2f194b6b2e26d97, 0x25c4acaf7c67d53a,
+    0x45ca12f07828a83c, 0xe5d9d01174f92f36, 0x85d76e4e70b65230,
+    0x3726faf8c2543fa7, 0x572844a7c61b42a1, 0xf73b8646cacac5ab,
+    0x97353819ce85b8ad, 0x4b89595ef8cfaa74, 0x2b87e701fc80d772,
+    0x8b9425e0f0515078, 0xeb9a9bbff41e2d7e, 0x596b0f0946fc40e9,
+    0x3965b15642b33def, 0x997673b74e62bae5, 0xf978cde84a2dc7e3,
+    0x6e4df5f184a87f4e, 0x0e434bae80e70248, 0xae50894f8c368542,
+    0xce5e37108879f844, 0x7cafa3a63a9b95d3, 0x1ca11df93ed4e8d5,
+    0xbcb2df1832056fdf, 0xdcbc6147364a12d9, 0x9712b2bdf19f54e8,
+    0xf71c0ce2f5d029ee, 0x570fce03f901aee4, 0x3701705cfd4ed3e2,
+    0x85f0e4ea4facbe75, 0xe5fe5ab54be3c373, 0x45ed985447324479,
+    0x25e3260b437d397f, 0xb2d61e128df881d2, 0xd2d8a04d89b7fcd4,
+    0x72cb62ac85667bde, 0x12c5dcf3812906d8, 0xa034484533cb6b4f,
+    0xc03af61a37841649, 0x602934fb3b559143, 0x00278aa43f1aec45,
+    0xdc9bebe30950fe9c, 0xbc9555bc0d1f839a, 0x1c86975d01ce0490,
+    0x7c88290205817996, 0xce79bdb4b7631401, 0xae7703ebb32c6907,
+    0x0e64c10abffdee0d, 0x6e6a7f55bbb2930b, 0xf95f474c75372ba6,
+    0x9951f913717856a0, 0x39423bf27da9d1aa, 0x594c85ad79e6acac,
+    0xebbd111bcb04c13b, 0x8bb3af44cf4bbc3d, 0x2ba06da5c39a3b37,
+    0x4baed3fac7d54631, 0xbcfdca504c30b755, 0xdcf3740f487fca53,
+    0x7ce0b6ee44ae4d59, 0x1cee08b140e1305f, 0xae1f9c07f2035dc8,
+    0xce112258f64c20ce, 0x6e02e0b9fa9da7c4, 0x0e0c5ee6fed2dac2,
+    0x993966ff3057626f, 0xf937d8a034181f69, 0x59241a4138c99863,
+    0x392aa41e3c86e565, 0x8bdb30a88e6488f2, 0xebd58ef78a2bf5f4,
+    0x4bc64c1686fa72fe, 0x2bc8f24982b50ff8, 0xf774930eb4ff1d21,
+    0x977a2d51b0b06027, 0x3769efb0bc61e72d, 0x576751efb82e9a2b,
+    0xe596c5590accf7bc, 0x85987b060e838aba, 0x258bb9e702520db0,
+    0x458507b8061d70b6, 0xd2b03fa1c898c81b, 0xb2be81feccd7b51d,
+    0x12ad431fc0063217, 0x72a3fd40c4494f11, 0xc05269f676ab2286,
+    0xa05cd7a972e45f80, 0x004f15487e35d88a, 0x6041ab177a7aa58c,
+    0x2bef78edbdafe3bd, 0x4be1c6b2b9e09ebb, 0xebf20453b53119b1,
+    0x8bfcba0cb17e64b7, 0x390d2eba039c0920, 0x590390e507d37426,
+    0xf91052040b02f32c, 0x991eec5b0f4d8e2a, 0x0e2bd442c1c83687,
+    0x6e256a1dc5874b81, 0xce36a8fcc956cc8b, 0xae3816a3cd19b18d,
+    0x1cc982157ffbdc1a, 0x7cc73c4a7bb4a11c, 0xdcd4feab77652616,
+    0xbcda40f4732a5b10, 0x606621b3456049c9, 0x00689fec412f34cf,
+    0xa07b5d0d4dfeb3c5, 0xc075e35249b1cec3, 0x728477e4fb53a354,
+    0x128ac9bbff1cde52, 0xb2990b5af3cd5958, 0xd297b505f782245e,
+    0x45a28d1c39079cf3, 0x25ac33433d48e1f5, 0x85bff1a2319966ff,
+    0xe5b14ffd35d61bf9, 0x5740db4b8734766e, 0x374e6514837b0b68,
+    0x975da7f58faa8c62, 0xf75319aa8be5f164, 0xeb233b8b376f702f,
+    0x8b2d85d433200d29, 0x2b3e47353ff18a23, 0x4b30f96a3bbef725,
+    0xf9c16ddc895c9ab2, 0x99cfd3838d13e7b4, 0x39dc116281c260be,
+    0x59d2af3d858d1db8, 0xcee797244b08a515, 0xaee9297b4f47d813,
+    0x0efaeb9a43965f19, 0x6ef455c547d9221f, 0xdc05c173f53b4f88,
+    0xbc0b7f2cf174328e, 0x1c18bdcdfda5b584, 0x7c160392f9eac882,
+    0xa0aa62d5cfa0da5b, 0xc0a4dc8acbefa75d, 0x60b71e6bc73e2057,
+    0x00b9a034c3715d51, 0xb2483482719330c6, 0xd2468add75dc4dc0,
+    0x7255483c790dcaca, 0x125bf6637d42b7cc, 0x856ece7ab3c70f61,
+    0xe5607025b7887267, 0x4573b2c4bb59f56d, 0x257d0c9bbf16886b,
+    0x978c982d0df4e5fc, 0xf782267209bb98fa, 0x5791e493056a1ff0,
+    0x379f5acc012562f6, 0x7c318936c6f024c7, 0x1c3f3769c2bf59c1,
+    0xbc2cf588ce6edecb, 0xdc224bd7ca21a3cd, 0x6ed3df6178c3ce5a,
+    0x0edd613e7c8cb35c, 0xaecea3df705d3456, 0xcec01d8074124950,
+    0x59f52599ba97f1fd, 0x39fb9bc6bed88cfb, 0x99e85927b2090bf1,
+    0xf9e6e778b64676f7, 0x4b1773ce04a41b60, 0x2b19cd9100eb6666,
+    0x8b0a0f700c3ae16c, 0xeb04b12f08759c6a, 0x37b8d0683e3f8eb3,
+    0x57b66e373a70f3b5, 0xf7a5acd636a174bf, 0x97ab128932ee09b9,
+    0x255a863f800c642e, 0x4554386084431928, 0xe547fa8188929e22,
+    0x854944de8cdde324, 0x127c7cc742585b89, 0x7272c2984617268f,
+    0xd26100794ac6a185, 0xb26fbe264e89dc83, 0x009e2a90fc6bb114,
+    0x609094cff824cc12, 0xc083562ef4f54b18, 0xa08de871f0ba361e,
+    0x57def1db7b5fc77a, 0x37d04f847f10ba7c, 0x97c38d6573c13d76,
+    0xf7cd333a778e4070, 0x453ca78cc56c2de7, 0x253219d3c12350e1,
+    0x8521db32cdf2d7eb, 0xe52f656dc9bdaaed, 0x721a5d7407381240,
+    0x1214e32b03776f46, 0xb20721ca0fa6e84c, 0xd2099f950be9954a,
+    0x60f80b23b90bf8dd, 0x00f6b57cbd4485db, 0xa0e5779db19502d1,
+    0xc0ebc9c2b5da7fd7, 0x1c57a88583906d0e, 0x7c5916da87df1008,
+    0xdc4ad43b8b0e9702, 0xbc446a648f41ea04, 0x0eb5fed23da38793,
+    0x6ebb408d39ecfa95, 0xcea8826c353d7d9f, 0xaea63c3331720099,
+    0x3993042afff7b834, 0x599dba75fbb8c532, 0xf98e7894f7694238,
+    0x9980c6cbf3263f3e, 0x2b71527d41c452a9, 0x4b7fec22458b2faf,
+    0xeb6c2ec3495aa8a5, 0x8b62909c4d15d5a3, 0xc0cc43668ac09392,
+    0xa0c2fd398e8fee94, 0x00d13fd8825e699e, 0x60df818786111498,
+    0xd22e153134f3790f, 0xb220ab6e30bc0409, 0x1233698f3c6d8303,
+    0x723dd7d03822fe05, 0xe508efc9f6a746a8, 0x85065196f2e83bae,
+    0x25159377fe39bca4, 0x451b2d28fa76c1a2, 0xf7eab99e4894ac35,
+    0x97e407c14cdbd133, 0x37f7c520400a5639, 0x57f97b7f44452b3f,
+    0x8b451a38720f39e6, 0xeb4ba467764044e0, 0x4b5866867a91c3ea,
+    0x2b56d8d97edebeec, 0x99a74c6fcc3cd37b, 0xf9a9f230c873ae7d,
+    0x59ba30d1c4a22977, 0x39b48e8ec0ed5471, 0xae81b6970e68ecdc,
+    0xce8f08c80a2791da, 0x6e9cca2906f616d0, 0x0e92747602b96bd6,
+    0xbc63e0c0b05b0641, 0xdc6d5e9fb4147b47, 0x7c7e9c7eb8c5fc4d,
+    0x1c702221bc8a814b},
+   {0x0000000000000000, 0x449ed83dc1d0fedb, 0x893db07b83a1fdb6,
+    0xcda368464271036d, 0x80a3cfdca84de5e9, 0xc43d17e1699d1b32,
+    0x099e7fa72bec185f, 0x4d00a79aea3ce684, 0x939f3092ff95d557,
+    0xd701e8af3e452b8c, 0x1aa280e97c3428e1, 0x5e3c58d4bde4d63a,
+    0x133cff4e57d830be, 0x57a227739608ce65, 0x9a014f35d479cd08,
+    0xde9f970815a933d3, 0xb5e6ce0e5025b42b, 0xf178163391f54af0,
+    0x3cdb7e75d384499d, 0x7845a6481254b746, 0x354501d2f86851c2,
+    0x71dbd9ef39b8af19, 0xbc78b1a97bc9ac74, 0xf8e66994ba1952af,
+    0x2679fe9cafb0617c, 0x62e726a16e609fa7, 0xaf444ee72c119cca,
+    0xebda96daedc16211, 0xa6da314007fd8495, 0xe244e97dc62d7a4e,
+    0x2fe7813b845c7923, 0x6b795906458c87f8, 0xf91533370f4576d3,
+    0xbd8beb0ace958808, 0x7028834c8ce48b65, 0x34b65b714d3475be,
+    0x79b6fceba708933a, 0x3d2824d666d86de1, 0xf08b4c9024a96e8c,
+    0xb41594ade5799057, 0x6a8a03a5f0d0a384, 0x2e14db9831005d5f,
+    0xe3b7b3de73715e32, 0xa7296be3b2a1a0e9, 0xea29cc79589d466d,
+    0xaeb71444994db8b6, 0x63147c02db3cbbdb, 0x278aa43f1aec4500,
+    0x4cf3fd395f60c2f8, 0x086d25049eb03c23, 0xc5ce4d42dcc13f4e,
+    0x8150957f1d11c195, 0xcc5032e5f72d2711, 0x88ceead836fdd9ca,
+    0x456d829e748cdaa7, 0x01f35aa3b55c247c, 0xdf6ccdaba0f517af,
+    0x9bf215966125e974, 0x56517dd02354ea19, 0x12cfa5ede28414c2,
+    0x5fcf027708b8f246, 0x1b51da4ac9680c9d, 0xd6f2b20c8b190ff0,
+    0x926c6a314ac9f12b, 0x60f2c945b184f323, 0x246c117870540df8,
+    0xe9cf793e32250e95, 0xad51a103f3f5f04e, 0xe051069919c916ca,
+    0xa4cfdea4d819e811, 0x696cb6e29a68eb7c, 0x2df26edf5bb815a7,
+    0xf36df9d74e112674, 0xb7f321ea8fc1d8af, 0x7a5049accdb0dbc2,
+    0x3ece91910c602519, 0x73ce360be65cc39d, 0x3750ee36278c3d46,
+    0xfaf3867065fd3e2b, 0xbe6d5e4da42dc0f0, 0xd514074be1a14708,
+    0x918adf762071b9d3, 0x5c29b7306200babe, 0x18b76f0da3d04465,
+    0x55b7c89749eca2e1, 0x112910aa883c5c3a, 0xdc8a78ecca4d5f57,
+    0x9814a0d10b9da18c, 0x468b37d91e34925f, 0x0215efe4dfe46c84,
+    0xcfb687a29d956fe9, 0x8b285f9f5c459132, 0xc628f805b67977b6,
+    0x82b6203877a9896d, 0x4f15487e35d88a00, 0x0b8b9043f40874db,
+    0x99e7fa72bec185f0, 0xdd79224f7f117b2b, 0x10da4a093d607846,
+    0x54449234fcb0869d, 0x194435ae168c6019, 0x5ddaed93d75c9ec2,
+    0x907985d5952d9daf, 0xd4e75de854fd6374, 0x0a78cae0415450a7,
+    0x4ee612dd8084ae7c, 0x83457a9bc2f5ad11, 0xc7dba2a6032553ca,
+    0x8adb053ce919b54e, 0xce45dd0128c94b95, 0x03e6b5476ab848f8,
+    0x47786d7aab68b623, 0x2c01347ceee431db, 0x689fec412f34cf00,
+    0xa53c84076d45cc6d, 0xe1a25c3aac9532b6, 0xaca2fba046a9d432,
+    0xe83c239d87792ae9, 0x259f4bdbc5082984, 0x610193e604d8d75f,
+    0xbf9e04ee1171e48c, 0xfb00dcd3d0a11a57, 0x36a3b49592d0193a,
+    0x723d6ca85300e7e1, 0x3f3dcb32b93c0165, 0x7ba3130f78ecffbe,
+    0xb6007b493a9dfcd3, 0xf29ea374fb4d0208, 0xc1e5928b6309e646,
+    0x857b4ab6a2d9189d, 0x48d822f0e0a81bf0, 0x0c46facd2178e52b,
+    0x41465d57cb4403af, 0x05d8856a0a94fd74, 0xc87bed2c48e5fe19,
+    0x8ce53511893500c2, 0x527aa2199c9c3311, 0x16e47a245d4ccdca,
+    0xdb4712621f3dcea7, 0x9fd9ca5fdeed307c, 0xd2d96dc534d1d6f8,
+    0x9647b5f8f5012823, 0x5be4ddbeb7702b4e, 0x1f7a058376a0d595,
+    0x74035c85332c526d, 0x309d84b8f2fcacb6, 0xfd3eecfeb08dafdb,
+    0xb9a034c3715d5100, 0xf4a093599b61b784, 0xb03e4b645ab1495f,
+    0x7d9d232218c04a32, 0x3903fb1fd910b4e9, 0xe79c6c17ccb9873a,
+    0xa302b42a0d6979e1, 0x6ea1dc6c4f187a8c, 0x2a3f04518ec88457,
+    0x673fa3cb64f462d3, 0x23a17bf6a5249c08, 0xee0213b0e7559f65,
+    0xaa9ccb8d268561be, 0x38f0a1bc6c4c9095, 0x7c6e7981ad9c6e4e,
+    0xb1cd11c7efed6d23, 0xf553c9fa2e3d93f8, 0xb8536e60c401757c,
+    0xfccdb65d05d18ba7, 0x316ede1b47a088ca, 0x75f0062686707611,
+    0xab6f912e93d945c2, 0xeff149135209bb19, 0x225221551078b874,
+    0x66ccf968d1a846af, 0x2bcc5ef23b94a02b, 0x6f5286cffa445ef0,
+    0xa2f1ee89b8355d9d, 0xe66f36b479e5a346, 0x8d166fb23c6924be,
+    0xc988b78ffdb9da65, 0x042bdfc9bfc8d908, 0x40b507f47e1827d3,
+    0x0db5a06e9424c157, 0x492b785355f43f8c, 0x8488101517853ce1,
+    0xc016c828d655c23a, 0x1e895f20c3fcf1e9, 0x5a17871d022c0f32,
+    0x97b4ef5b405d0c5f, 0xd32a3766818df284, 0x9e2a90fc6bb11400,
+    0xdab448c1aa61eadb, 0x17172087e810e9b6, 0x5389f8ba29c0176d,
+    0xa1175bced28d1565, 0xe58983f3135debbe, 0x282aebb5512ce8d3,
+    0x6cb4338890fc1608, 0x21b494127ac0f08c, 0x652a4c2fbb100e57,
+    0xa8892469f9610d3a, 0xec17fc5438b1f3e1, 0x32886b5c2d18c032,
+    0x7616b361ecc83ee9, 0xbbb5db27aeb93d84, 0xff2b031a6f69c35f,
+    0xb22ba480855525db, 0xf6b57cbd4485db00, 0x3b1614fb06f4d86d,
+    0x7f88ccc6c72426b6, 0x14f195c082a8a14e, 0x506f4dfd43785f95,
+    0x9dcc25bb01095cf8, 0xd952fd86c0d9a223, 0x94525a1c2ae544a7,
+    0xd0cc8221eb35ba7c, 0x1d6fea67a944b911, 0x59f1325a689447ca,
+    0x876ea5527d3d7419, 0xc3f07d6fbced8ac2, 0x0e531529fe9c89af,
+    0x4acdcd143f4c7774, 0x07cd6a8ed57091f0, 0x4353b2b314a06f2b,
+    0x8ef0daf556d16c46, 0xca6e02c89701929d, 0x580268f9ddc863b6,
+    0x1c9cb0c41c189d6d, 0xd13fd8825e699e00, 0x95a100bf9fb960db,
+    0xd8a1a7257585865f, 0x9c3f7f18b4557884, 0x519c175ef6247be9,
+    0x1502cf6337f48532, 0xcb9d586b225db6e1, 0x8f038056e38d483a,
+    0x42a0e810a1fc4b57, 0x063e302d602cb58c, 0x4b3e97b78a105308,
+    0x0fa04f8a4bc0add3, 0xc20327cc09b1aebe, 0x869dfff1c8615065,
+    0xede4a6f78dedd79d, 0xa97a7eca4c3d2946, 0x64d9168c0e4c2a2b,
+    0x2047ceb1cf9cd4f0, 0x6d47692b25a03274, 0x29d9b116e470ccaf,
+    0xe47ad950a601cfc2, 0xa0e4016d67d13119, 0x7e7b9665727802ca,
+    0x3ae54e58b3a8fc11, 0xf746261ef1d9ff7c, 0xb3d8fe23300901a7,
+    0xfed859b9da35e723, 0xba4681841be519f8, 0x77e5e9c259941a95,
+    0x337b31ff9844e44e},
+   {0x0000000000000000, 0x11138a3d691dd209, 0x2227147ad23ba412,
+    0x33349e47bb26761b, 0x444e28f5a4774824, 0x555da2c8cd6a9a2d,
+    0x66693c8f764cec36, 0x777ab6b21f513e3f, 0x889c51eb48ee9048,
+    0x998fdbd621f34241, 0xaabb45919ad5345a, 0xbba8cfacf3c8e653,
+    0xccd2791eec99d86c, 0xddc1f32385840a65, 0xeef56d643ea27c7e,
+    0xffe6e75957bfae77, 0x83e00cfd3ed33e15, 0x92f386c057ceec1c,
+    0xa1c71887ece89a07, 0xb0d492ba85f5480e, 0xc7ae24089aa47631,
+    0xd6bdae35f3b9a438, 0xe5893072489fd223, 0xf49aba4f2182002a,
+    0x0b7c5d16763dae5d, 0x1a6fd72b1f207c54, 0x295b496ca4060a4f,
+    0x3848c351cd1bd846, 0x4f3275e3d24ae679, 0x5e21ffdebb573470,
+    0x6d1561990071426b, 0x7c06eba4696c9062, 0x9518b6d1d2a862af,
+    0x840b3cecbbb5b0a6, 0xb73fa2ab0093c6bd, 0xa62c2896698e14b4,
+    0xd1569e2476df2a8b, 0xc04514191fc2f882, 0xf3718a5ea4e48e99,
+    0xe2620063cdf95c90, 0x1d84e73a9a46f2e7, 0x0c976d07f35b20ee,
+    0x3fa3f340487d56f5, 0x2eb0797d216084fc, 0x59cacfcf3e31bac3,
+    0x48d945f2572c68ca, 0x7beddbb5ec0a1ed1, 0x6afe51888517ccd8,
+    0x16f8ba2cec7b5cba, 0x07eb301185668eb3, 0x34dfae563e40f8a8,
+    0x25cc246b575d2aa1, 0x52b692d9480c149e, 0x43a518e42111c697,
+    0x709186a39a37b08c, 0x61820c9ef32a6285, 0x9e64ebc7a495ccf2,
+    0x8f7761facd881efb, 0xbc43ffbd76ae68e0, 0xad5075801fb3bae9,
+    0xda2ac33200e284d6, 0xcb39490f69ff56df, 0xf80dd748d2d920c4,
+    0xe91e5d75bbc4f2cd, 0xb8e9c2880a5edbdb, 0xa9fa48b5634309d2,
+    0x9aced6f2d8657fc9, 0x8bdd5ccfb178adc0, 0xfca7ea7dae2993ff,
+    0xedb46040c73441f6, 0xde80fe077c1237ed, 0xcf93743a150fe5e4,
+    0x3075936342b04b93, 0x2166195e2bad999a, 0x12528719908bef81,
+    0x03410d24f9963d88, 0x743bbb96e6c703b7, 0x652831ab8fdad1be,
+    0x561cafec34fca7a5, 0x470f25d15de175ac, 0x3b09ce75348de5ce,
+    0x2a1a44485d9037c7, 0x192eda0fe6b641dc, 0x083d50328fab93d5,
+    0x7f47e68090faadea, 0x6e546cbdf9e77fe3, 0x5d60f2fa42c109f8,
+    0x4c7378c72bdcdbf1, 0xb3959f9e7c637586, 0xa28615a3157ea78f,
+    0x91b28be4ae58d194, 0x80a101d9c745039d, 0xf7dbb76bd8143da2,
+    0xe6c83d56b109efab, 0xd5fca3110a2f99b0, 0xc4ef292c63324bb9,
+    0x2df17459d8f6b974, 0x3ce2fe64b1eb6b7d, 0x0fd660230acd1d66,
+    0x1ec5ea1e63d0cf6f, 0x69bf5cac7c81f150, 0x78acd691159c2359,
+    0x4b9848d6aeba5542, 0x5a8bc2ebc7a7874b, 0xa56d25b29018293c,
+    0xb47eaf8ff905fb35, 0x874a31c842238d2e, 0x9659bbf52b3e5f27,
+    0xe1230d47346f6118, 0xf030877a5d72b311, 0xc304193de654c50a,
+    0xd21793008f491703, 0xae1178a4e6258761, 0xbf02f2998f385568,
+    0x8c366cde341e2373, 0x9d25e6e35d03f17a, 0xea5f50514252cf45,
+    0xfb4cda6c2b4f1d4c, 0xc878442b90696b57, 0xd96bce16f974b95e,
+    0x268d294faecb1729, 0x379ea372c7d6c520, 0x04aa3d357cf0b33b,
+    0x15b9b70815ed6132, 0x62c301ba0abc5f0d, 0x73d08b8763a18d04,
+    0x40e415c0d887fb1f, 0x51f79ffdb19a2916, 0xe30b2a3bbbb3a933,
+    0xf218a006d2ae7b3a, 0xc12c3e4169880d21, 0xd03fb47c0095df28,
+    0xa74502ce1fc4e117, 0xb65688f376d9331e, 0x856216b4cdff4505,
+    0x94719c89a4e2970c, 0x6b977bd0f35d397b, 0x7a84f1ed9a40eb72,
+    0x49b06faa21669d69, 0x58a3e597487b4f60, 0x2fd95325572a715f,
+    0x3ecad9183e37a356, 0x0dfe475f8511d54d, 0x1cedcd62ec0c0744,
+    0x60eb26c685609726, 0x71f8acfbec7d452f, 0x42cc32bc575b3334,
+    0x53dfb8813e46e13d, 0x24a50e332117df02, 0x35b6840e480a0d0b,
+    0x06821a49f32c7b10, 0x179190749a31a919, 0xe877772dcd8e076e,
+    0xf964fd10a493d567, 0xca5063571fb5a37c, 0xdb43e96a76a87175,
+    0xac395fd869f94f4a, 0xbd2ad5e500e49d43, 0x8e1e4ba2bbc2eb58,
+    0x9f0dc19fd2df3951, 0x76139cea691bcb9c, 0x670016d700061995,
+    0x54348890bb206f8e, 0x452702add23dbd87, 0x325db41fcd6c83b8,
+    0x234e3e22a47151b1, 0x107aa0651f5727aa, 0x01692a58764af5a3,
+    0xfe8fcd0121f55bd4, 0xef9c473c48e889dd, 0xdca8d97bf3ceffc6,
+    0xcdbb53469ad32dcf, 0xbac1e5f4858213f0, 0xabd26fc9ec9fc1f9,
+    0x98e6f18e57b9b7e2, 0x89f57bb33ea465eb, 0xf5f3901757c8f589,
+    0xe4e01a2a3ed52780, 0xd7d4846d85f3519b, 0xc6c70e50ecee8392,
+    0xb1bdb8e2f3bfbdad, 0xa0ae32df9aa26fa4, 0x939aac98218419bf,
+    0x828926a54899cbb6, 0x7d6fc1fc1f2665c1, 0x6c7c4bc1763bb7c8,
+    0x5f48d586cd1dc1d3, 0x4e5b5fbba40013da, 0x3921e909bb512de5,
+    0x28326334d24cffec, 0x1b06fd73696a89f7, 0x0a15774e00775bfe,
+    0x5be2e8b3b1ed72e8, 0x4af1628ed8f0a0e1, 0x79c5fcc963d6d6fa,
+    0x68d676f40acb04f3, 0x1facc046159a3acc, 0x0ebf4a7b7c87e8c5,
+    0x3d8bd43cc7a19ede, 0x2c985e01aebc4cd7, 0xd37eb958f903e2a0,
+    0xc26d3365901e30a9, 0xf159ad222b3846b2, 0xe04a271f422594bb,
+    0x973091ad5d74aa84, 0x86231b903469788d, 0xb51785d78f4f0e96,
+    0xa4040feae652dc9f, 0xd802e44e8f3e4cfd, 0xc9116e73e6239ef4,
+    0xfa25f0345d05e8ef, 0xeb367a0934183ae6, 0x9c4cccbb2b4904d9,
+    0x8d5f46864254d6d0, 0xbe6bd8c1f972a0cb, 0xaf7852fc906f72c2,
+    0x509eb5a5c7d0dcb5, 0x418d3f98aecd0ebc, 0x72b9a1df15eb78a7,
+    0x63aa2be27cf6aaae, 0x14d09d5063a79491, 0x05c3176d0aba4698,
+    0x36f7892ab19c3083, 0x27e40317d881e28a, 0xcefa5e6263451047,
+    0xdfe9d45f0a58c24e, 0xecdd4a18b17eb455, 0xfdcec025d863665c,
+    0x8ab47697c7325863, 0x9ba7fcaaae2f8a6a, 0xa89362ed1509fc71,
+    0xb980e8d07c142e78, 0x46660f892bab800f, 0x577585b442b65206,
+    0x64411bf3f990241d, 0x755291ce908df614, 0x0228277c8fdcc82b,
+    0x133bad41e6c11a22, 0x200f33065de76c39, 0x311cb93b34fabe30,
+    0x4d1a529f5d962e52, 0x5c09d8a2348bfc5b, 0x6f3d46e58fad8a40,
+    0x7e2eccd8e6b05849, 0x09547a6af9e16676, 0x1847f05790fcb47f,
+    0x2b736e102bdac264, 0x3a60e42d42c7106d, 0xc58603741578be1a,
+    0xd49589497c656c13, 0xe7a1170ec7431a08, 0xf6b29d33ae5ec801,
+    0x81c82b81b10ff63e, 0x90dba1bcd8122437, 0xa3ef3ffb6334522c,
+    0xb2fcb5c60a298025},
+   {0x0000000000000000, 0x54cefb5cd8694ce3, 0xa99df6b9b0d299c6,
+    0xfd530de568bbd525, 0xc1e34258ceab2d09, 0x952db90416c261ea,
+    0x687eb4e17e79b4cf, 0x3cb04fbda610f82c, 0x111e2b9a32584497,
+    0x45d0d0c6ea310874, 0xb883dd23828add51, 0xec4d267f5ae391b2,
+    0xd0fd69c2fcf3699e, 0x8433929e249a257d, 0x79609f7b4c21f058,
+    0x2dae64279448bcbb, 0x223c573464b0892e, 0x76f2ac68bcd9c5cd,
+    0x8ba1a18dd46210e8, 0xdf6f5ad10c0b5c0b, 0xe3df156caa1ba427,
+    0xb711ee307272e8c4, 0x4a42e3d51ac93de1, 0x1e8c1889c2a07102,
+    0x33227cae56e8cdb9, 0x67ec87f28e81815a, 0x9abf8a17e63a547f,
+    0xce71714b3e53189c, 0xf2c13ef69843e0b0, 0xa60fc5aa402aac53,
+    0x5b5cc84f28917976, 0x0f923313f0f83595, 0x4478ae68c961125c,
+    0x10b6553411085ebf, 0xede558d179b38b9a, 0xb92ba38da1dac779,
+    0x859bec3007ca3f55, 0xd155176cdfa373b6, 0x2c061a89b718a693,
+    0x78c8e1d56f71ea70, 0x556685f2fb3956cb, 0x01a87eae23501a28,
+    0xfcfb734b4bebcf0d, 0xa8358817938283ee, 0x9485c7aa35927bc2,
+    0xc04b3cf6edfb3721, 0x3d1831138540e204, 0x69d6ca4f5d29aee7,
+    0x6644f95cadd19b72, 0x328a020075b8d791, 0xcfd90fe51d0302b4,
+    0x9b17f4b9c56a4e57, 0xa7a7bb04637ab67b, 0xf3694058bb13fa98,
+    0x0e3a4dbdd3a82fbd, 0x5af4b6e10bc1635e, 0x775ad2c69f89dfe5,
+    0x2394299a47e09306, 0xdec7247f2f5b4623, 0x8a09df23f7320ac0,
+    0xb6b9909e5122f2ec, 0xe2776bc2894bbe0f, 0x1f246627e1f06b2a,
+    0x4bea9d7b399927c9, 0x88f15cd192c224b8, 0xdc3fa78d4aab685b,
+    0x216caa682210bd7e, 0x75a25134fa79f19d, 0x49121e895c6909b1,
+    0x1ddce5d584004552, 0xe08fe830ecbb9077, 0xb441136c34d2dc94,
+    0x99ef774ba09a602f, 0xcd218c1778f32ccc, 0x307281f21048f9e9,
+    0x64bc7aaec821b50a, 0x580c35136e314d26, 0x0cc2ce4fb65801c5,
+    0xf191c3aadee3d4e0, 0xa55f38f6068a9803, 0xaacd0be5f672ad96,
+    0xfe03f0b92e1be175, 0x0350fd5c46a03450, 0x579e06009ec978b3,
+    0x6b2e49bd38d9809f, 0x3fe0b2e1e0b0cc7c, 0xc2b3bf04880b1959,
+    0x967d4458506255ba, 0xbbd3207fc42ae901, 0xef1ddb231c43a5e2,
+    0x124ed6c674f870c7, 0x46802d9aac913c24, 0x7a3062270a81c408,
+    0x2efe997bd2e888eb, 0xd3ad949eba535dce, 0x87636fc2623a112d,
+    0xcc89f2b95ba336e4, 0x984709e583ca7a07, 0x65140400eb71af22,
+    0x31daff5c3318e3c1, 0x0d6ab0e195081bed, 0x59a44bbd4d61570e,
+    0xa4f7465825da822b, 0xf039bd04fdb3cec8, 0xdd97d92369fb7273,
+    0x8959227fb1923e90, 0x740a2f9ad929ebb5, 0x20c4d4c60140a756,
+    0x1c749b7ba7505f7a, 0x48ba60277f391399, 0xb5e96dc21782c6bc,
+    0xe127969ecfeb8a5f, 0xeeb5a58d3f13bfca, 0xba7b5ed1e77af329,
+    0x472853348fc1260c, 0x13e6a86857a86aef, 0x2f56e7d5f1b892c3,
+    0x7b981c8929d1de20, 0x86cb116c416a0b05, 0xd205ea30990347e6,
+    0xffab8e170d4bfb5d, 0xab65754bd522b7be, 0x563678aebd99629b,
+    0x02f883f265f02e78, 0x3e48cc4fc3e0d654, 0x6a8637131b899ab7,
+    0x97d53af673324f92, 0xc31bc1aaab5b0371, 0x833a16888a8a57f5,
+    0xd7f4edd452e31b16, 0x2aa7e0313a58ce33, 0x7e691b6de23182d0,
+    0x42d954d044217afc, 0x1617af8c9c48361f, 0xeb44a269f4f3e33a,
+    0xbf8a59352c9aafd9, 0x92243d12b8d21362, 0xc6eac64e60bb5f81,
+    0x3bb9cbab08008aa4, 0x6f7730f7d069c647, 0x53c77f4a76793e6b,
+    0x07098416ae107288, 0xfa5a89f3c6aba7ad, 0xae9472af1ec2eb4e,
+    0xa10641bcee3adedb, 0xf5c8bae036539238, 0x089bb7055ee8471d,
+    0x5c554c5986810bfe, 0x60e503e42091f3d2, 0x342bf8b8f8f8bf31,
+    0xc978f55d90436a14, 0x9db60e01482a26f7, 0xb0186a26dc629a4c,
+    0xe4d6917a040bd6af, 0x19859c9f6cb0038a, 0x4d4b67c3b4d94f69,
+    0x71fb287e12c9b745, 0x2535d322caa0fba6, 0xd866dec7a21b2e83,
+    0x8ca8259b7a726260, 0xc742b8e043eb45a9, 0x938c43bc9b82094a,
+    0x6edf4e59f339dc6f, 0x3a11b5052b50908c, 0x06a1fab88d4068a0,
+    0x526f01e455292443, 0xaf3c0c013d92f166, 0xfbf2f75de5fbbd85,
+    0xd65c937a71b3013e, 0x82926826a9da4ddd, 0x7fc165c3c16198f8,
+    0x2b0f9e9f1908d41b, 0x17bfd122bf182c37, 0x43712a7e677160d4,
+    0xbe22279b0fcab5f1, 0xeaecdcc7d7a3f912, 0xe57eefd4275bcc87,
+    0xb1b01488ff328064, 0x4ce3196d97895541, 0x182de2314fe019a2,
+    0x249dad8ce9f0e18e, 0x705356d03199ad6d, 0x8d005b3559227848,
+    0xd9cea069814b34ab, 0xf460c44e15038810, 0xa0ae3f12cd6ac4f3,
+    0x5dfd32f7a5d111d6, 0x0933c9ab7db85d35, 0x35838616dba8a519,
+    0x614d7d4a03c1e9fa, 0x9c1e70af6b7a3cdf, 0xc8d08bf3b313703c,
+    0x0bcb4a591848734d, 0x5f05b105c0213fae, 0xa256bce0a89aea8b,
+    0xf69847bc70f3a668, 0xca280801d6e35e44, 0x9ee6f35d0e8a12a7,
+    0x63b5feb86631c782, 0x377b05e4be588b61, 0x1ad561c32a1037da,
+    0x4e1b9a9ff2797b39, 0xb348977a9ac2ae1c, 0xe7866c2642abe2ff,
+    0xdb36239be4bb1ad3, 0x8ff8d8c73cd25630, 0x72abd52254698315,
+    0x26652e7e8c00cff6, 0x29f71d6d7cf8fa63, 0x7d39e631a491b680,
+    0x806aebd4cc2a63a5, 0xd4a4108814432f46, 0xe8145f35b253d76a,
+    0xbcdaa4696a3a9b89, 0x4189a98c02814eac, 0x154752d0dae8024f,
+    0x38e936f74ea0bef4, 0x6c27cdab96c9f217, 0x9174c04efe722732,
+    0xc5ba3b12261b6bd1, 0xf90a74af800b93fd, 0xadc48ff35862df1e,
+    0x5097821630d90a3b, 0x0459794ae8b046d8, 0x4fb3e431d1296111,
+    0x1b7d1f6d09402df2, 0xe62e128861fbf8d7, 0xb2e0e9d4b992b434,
+    0x8e50a6691f824c18, 0xda9e5d35c7eb00fb, 0x27cd50d0af50d5de,
+    0x7303ab8c7739993d, 0x5eadcfabe3712586, 0x0a6334f73b186965,
+    0xf730391253a3bc40, 0xa3fec24e8bcaf0a3, 0x9f4e8df32dda088f,
+    0xcb8076aff5b3446c, 0x36d37b4a9d089149, 0x621d80164561ddaa,
+    0x6d8fb305b599e83f, 0x394148596df0a4dc, 0xc41245bc054b71f9,
+    0x90dcbee0dd223d1a, 0xac6cf15d7b32c536, 0xf8a20a01a35b89d5,
+    0x05f107e4cbe05cf0, 0x513ffcb813891013, 0x7c91989f87c1aca8,
+    0x285f63c35fa8e04b, 0xd50c6e263713356e, 0x81c2957aef7a798d,
+    0xbd72dac7496a81a1, 0xe9bc219b9103cd42, 0x14ef2c7ef9b81867,
+    0x4021d72221d15484},
+   {0x0000000000000000, 0x94ac823aba1ab16f, 0xbb81ab5edb3b7c5b,
+    0x2f2d29646121cd34, 0xe5dbf9961978e633, 0x71777baca362575c,
+    0x5e5a52c8c2439a68, 0xcaf6d0f278592b07, 0x596f5c079dffd2e3,
+    0xcdc3de3d27e5638c, 0xe2eef75946c4aeb8, 0x76427563fcde1fd7,
+    0xbcb4a591848734d0, 0x281827ab3e9d85bf, 0x07350ecf5fbc488b,
+    0x93998cf5e5a6f9e4, 0xb2deb80f3bffa5c6, 0x26723a3581e514a9,
+    0x095f1351e0c4d99d, 0x9df3916b5ade68f2, 0x57054199228743f5,
+    0xc3a9c3a3989df29a, 0xec84eac7f9bc3fae, 0x782868fd43a68ec1,
+    0xebb1e408a6007725, 0x7f1d66321c1ac64a, 0x50304f567d3b0b7e,
+    0xc49ccd6cc721ba11, 0x0e6a1d9ebf789116, 0x9ac69fa405622079,
+    0xb5ebb6c06443ed4d, 0x214734fade595c22, 0xf765df35d8f15509,
+    0x63c95d0f62ebe466, 0x4ce4746b03ca2952, 0xd848f651b9d0983d,
+    0x12be26a3c189b33a, 0x8612a4997b930255, 0xa93f8dfd1ab2cf61,
+    0x3d930fc7a0a87e0e, 0xae0a8332450e87ea, 0x3aa60108ff143685,
+    0x158b286c9e35fbb1, 0x8127aa56242f4ade, 0x4bd17aa45c7661d9,
+    0xdf7df89ee66cd0b6, 0xf050d1fa874d1d82, 0x64fc53c03d57aced,
+    0x45bb673ae30ef0cf, 0xd117e500591441a0, 0xfe3acc6438358c94,
+    0x6a964e5e822f3dfb, 0xa0609eacfa7616fc, 0x34cc1c96406ca793,
+    0x1be135f2214d6aa7, 0x8f4db7c89b57dbc8, 0x1cd43b3d7ef1222c,
+    0x8878b907c4eb9343, 0xa7559063a5ca5e77, 0x33f912591fd0ef18,
+    0xf90fc2ab6789c41f, 0x6da34091dd937570, 0x428e69f5bcb2b844,
+    0xd622ebcf06a8092b, 0x7c1311401eecb497, 0xe8bf937aa4f605f8,
+    0xc792ba1ec5d7c8cc, 0x533e38247fcd79a3, 0x99c8e8d6079452a4,
+    0x0d646aecbd8ee3cb, 0x22494388dcaf2eff, 0xb6e5c1b266b59f90,
+    0x257c4d4783136674, 0xb1d0cf7d3909d71b, 0x9efde61958281a2f,
+    0x0a516423e232ab40, 0xc0a7b4d19a6b8047, 0x540b36eb20713128,
+    0x7b261f8f4150fc1c, 0xef8a9db5fb4a4d73, 0xcecda94f25131151,
+    0x5a612b759f09a03e, 0x754c0211fe286d0a, 0xe1e0802b4432dc65,
+    0x2b1650d93c6bf762, 0xbfbad2e38671460d, 0x9097fb87e7508b39,
+    0x043b79bd5d4a3a56, 0x97a2f548b8ecc3b2, 0x030e777202f672dd,
+    0x2c235e1663d7bfe9, 0xb88fdc2cd9cd0e86, 0x72790cdea1942581,
+    0xe6d58ee41b8e94ee, 0xc9f8a7807aaf59da, 0x5d5425bac0b5e8b5,
+    0x8b76ce75c61de19e, 0x1fda4c4f7c0750f1, 0x30f7652b1d269dc5,
+    0xa45be711a73c2caa, 0x6ead37e3df6507ad, 0xfa01b5d9657fb6c2,
+    0xd52c9cbd045e7bf6, 0x41801e87be44ca99, 0xd21992725be2337d,
+    0x46b51048e1f88212, 0x6998392c80d94f26, 0xfd34bb163ac3fe49,
+    0x37c26be4429ad54e, 0xa36ee9def8806421, 0x8c43c0ba99a1a915,
+    0x18ef428023bb187a, 0x39a8767afde24458, 0xad04f44047f8f537,
+    0x8229dd2426d93803, 0x16855f1e9cc3896c, 0xdc738fece49aa26b,
+    0x48df0dd65e801304, 0x67f224b23fa1de30, 0xf35ea68885bb6f5f,
+    0x60c72a7d601d96bb, 0xf46ba847da0727d4, 0xdb468123bb26eae0,
+    0x4fea0319013c5b8f, 0x851cd3eb79657088, 0x11b051d1c37fc1e7,
+    0x3e9d78b5a25e0cd3, 0xaa31fa8f1844bdbc, 0xf82622803dd9692e,
+    0x6c8aa0ba87c3d841, 0x43a789dee6e21575, 0xd70b0be45cf8a41a,
+    0x1dfddb1624a18f1d, 0x8951592c9ebb3e72, 0xa67c7048ff9af346,
+    0x32d0f27245804229, 0xa1497e87a026bbcd, 0x35e5fcbd1a3c0aa2,
+    0x1ac8d5d97b1dc796, 0x8e6457e3c10776f9, 0x44928711b95e5dfe,
+    0xd03e052b0344ec91, 0xff132c4f626521a5, 0x6bbfae75d87f90ca,
+    0x4af89a8f0626cce8, 0xde5418b5bc3c7d87, 0xf17931d1dd1db0b3,
+    0x65d5b3eb670701dc, 0xaf2363191f5e2adb, 0x3b8fe123a5449bb4,
+    0x14a2c847c4655680, 0x800e4a7d7e7fe7ef, 0x1397c6889bd91e0b,
+    0x873b44b221c3af64, 0xa8166dd640e26250, 0x3cbaefecfaf8d33f,
+    0xf64c3f1e82a1f838, 0x62e0bd2438bb4957, 0x4dcd9440599a8463,
+    0xd961167ae380350c, 0x0f43fdb5e5283c27, 0x9bef7f8f5f328d48,
+    0xb4c256eb3e13407c, 0x206ed4d18409f113, 0xea980423fc50da14,
+    0x7e348619464a6b7b, 0x5119af7d276ba64f, 0xc5b52d479d711720,
+    0x562ca1b278d7eec4, 0xc2802388c2cd5fab, 0xedad0aeca3ec929f,
+    0x790188d619f623f0, 0xb3f7582461af08f7, 0x275bda1edbb5b998,
+    0x0876f37aba9474ac, 0x9cda7140008ec5c3, 0xbd9d45baded799e1,
+    0x2931c78064cd288e, 0x061ceee405ece5ba, 0x92b06cdebff654d5,
+    0x5846bc2cc7af7fd2, 0xccea3e167db5cebd, 0xe3c717721c940389,
+    0x776b9548a68eb2e6, 0xe4f219bd43284b02, 0x705e9b87f932fa6d,
+    0x5f73b2e398133759, 0xcbdf30d922098636, 0x0129e02b5a50ad31,
+    0x95856211e04a1c5e, 0xbaa84b75816bd16a, 0x2e04c94f3b716005,
+    0x843533c02335ddb9, 0x1099b1fa992f6cd6, 0x3fb4989ef80ea1e2,
+    0xab181aa44214108d, 0x61eeca563a4d3b8a, 0xf542486c80578ae5,
+    0xda6f6108e17647d1, 0x4ec3e3325b6cf6be, 0xdd5a6fc7beca0f5a,
+    0x49f6edfd04d0be35, 0x66dbc49965f17301, 0xf27746a3dfebc26e,
+    0x38819651a7b2e969, 0xac2d146b1da85806, 0x83003d0f7c899532,
+    0x17acbf35c693245d, 0x36eb8bcf18ca787f, 0xa24709f5a2d0c910,
+    0x8d6a2091c3f10424, 0x19c6a2ab79ebb54b, 0xd330725901b29e4c,
+    0x479cf063bba82f23, 0x68b1d907da89e217, 0xfc1d5b3d60935378,
+    0x6f84d7c88535aa9c, 0xfb2855f23f2f1bf3, 0xd4057c965e0ed6c7,
+    0x40a9feace41467a8, 0x8a5f2e5e9c4d4caf, 0x1ef3ac642657fdc0,
+    0x31de8500477630f4, 0xa572073afd6c819b, 0x7350ecf5fbc488b0,
+    0xe7fc6ecf41de39df, 0xc8d147ab20fff4eb, 0x5c7dc5919ae54584,
+    0x968b1563e2bc6e83, 0x0227975958a6dfec, 0x2d0abe3d398712d8,
+    0xb9a63c07839da3b7, 0x2a3fb0f2663b5a53, 0xbe9332c8dc21eb3c,
+    0x91be1bacbd002608, 0x05129996071a9767, 0xcfe449647f43bc60,
+    0x5b48cb5ec5590d0f, 0x7465e23aa478c03b, 0xe0c960001e627154,
+    0xc18e54fac03b2d76, 0x5522d6c07a219c19, 0x7a0fffa41b00512d,
+    0xeea37d9ea11ae042, 0x2455ad6cd943cb45, 0xb0f92f5663597a2a,
+    0x9fd406320278b71e, 0x0b788408b8620671, 0x98e108fd5dc4ff95,
+    0x0c4d8ac7e7de4efa, 0x2360a3a386ff83ce, 0xb7cc21993ce532a1,
+    0x7d3af16b44bc19a6, 0xe9967351fea6a8c9, 0xc6bb5a359f8765fd,
+    0x5217d80f259dd492},
+   {0x0000000000000000, 0x6294ea2bd4bcccd9, 0xc529d457a97999b2,
+    0xa7bd3e7c7dc5556b, 0x188b0784fdfd2de1, 0x7a1fedaf2941e138,
+    0xdda2d3d35484b453, 0xbf3639f88038788a, 0x31160f09fbfa5bc2,
+    0x5382e5222f46971b, 0xf43fdb5e5283c270, 0x96ab3175863f0ea9,
+    0x299d088d06077623, 0x4b09e2a6d2bbbafa, 0xecb4dcdaaf7eef91,
+    0x8e2036f17bc22348, 0x622c1e13f7f4b784, 0x00b8f43823487b5d,
+    0xa705ca445e8d2e36, 0xc591206f8a31e2ef, 0x7aa719970a099a65,
+    0x1833f3bcdeb556bc, 0xbf8ecdc0a37003d7, 0xdd1a27eb77cccf0e,
+    0x533a111a0c0eec46, 0x31aefb31d8b2209f, 0x9613c54da57775f4,
+    0xf4872f6671cbb92d, 0x4bb1169ef1f3c1a7, 0x2925fcb5254f0d7e,
+    0x8e98c2c9588a5815, 0xec0c28e28c3694cc, 0xc4583c27efe96f08,
+    0xa6ccd60c3b55a3d1, 0x0171e8704690f6ba, 0x63e5025b922c3a63,
+    0xdcd33ba3121442e9, 0xbe47d188c6a88e30, 0x19faeff4bb6ddb5b,
+    0x7b6e05df6fd11782, 0xf54e332e141334ca, 0x97dad905c0aff813,
+    0x3067e779bd6aad78, 0x52f30d5269d661a1, 0xedc534aae9ee192b,
+    0x8f51de813d52d5f2, 0x28ece0fd40978099, 0x4a780ad6942b4c40,
+    0xa6742234181dd88c, 0xc4e0c81fcca11455, 0x635df663b164413e,
+    0x01c91c4865d88de7, 0xbeff25b0e5e0f56d, 0xdc6bcf9b315c39b4,
+    0x7bd6f1e74c996cdf, 0x19421bcc9825a006, 0x97622d3de3e7834e,
+    0xf5f6c716375b4f97, 0x524bf96a4a9e1afc, 0x30df13419e22d625,
+    0x8fe92ab91e1aaeaf, 0xed7dc092caa66276, 0x4ac0feeeb763371d,
+    0x285414c563dffbc4, 0x1a68d76470dcc095, 0x78fc3d4fa4600c4c,
+    0xdf410333d9a55927, 0xbdd5e9180d1995fe, 0x02e3d0e08d21ed74,
+    0x60773acb599d21ad, 0xc7ca04b7245874c6, 0xa55eee9cf0e4b81f,
+    0x2b7ed86d8b269b57, 0x49ea32465f9a578e, 0xee570c3a225f02e5,
+    0x8cc3e611f6e3ce3c, 0x33f5dfe976dbb6b6, 0x516135c2a2677a6f,
+    0xf6dc0bbedfa22f04, 0x9448e1950b1ee3dd, 0x7844c97787287711,
+    0x1ad0235c5394bbc8, 0xbd6d1d202e51eea3, 0xdff9f70bfaed227a,
+    0x60cfcef37ad55af0, 0x025b24d8ae699629, 0xa5e61aa4d3acc342,
+    0xc772f08f07100f9b, 0x4952c67e7cd22cd3, 0x2bc62c55a86ee00a,
+    0x8c7b1229d5abb561, 0xeeeff802011779b8, 0x51d9c1fa812f0132,
+    0x334d2bd15593cdeb, 0x94f015ad28569880, 0xf664ff86fcea5459,
+    0xde30eb439f35af9d, 0xbca401684b896344, 0x1b193f14364c362f,
+    0x798dd53fe2f0faf6, 0xc6bbecc762c8827c, 0xa42f06ecb6744ea5,
+    0x03923890cbb11bce, 0x6106d2bb1f0dd717, 0xef26e44a64cff45f,
+    0x8db20e61b0733886, 0x2a0f301dcdb66ded, 0x489bda36190aa134,
+    0xf7ade3ce9932d9be, 0x953909e54d8e1567, 0x32843799304b400c,
+    0x5010ddb2e4f78cd5, 0xbc1cf55068c11819, 0xde881f7bbc7dd4c0,
+    0x79352107c1b881ab, 0x1ba1cb2c15044d72, 0xa497f2d4953c35f8,
+    0xc60318ff4180f921, 0x61be26833c45ac4a, 0x032acca8e8f96093,
+    0x8d0afa59933b43db, 0xef9e107247878f02, 0x48232e0e3a42da69,
+    0x2ab7c425eefe16b0, 0x9581fddd6ec66e3a, 0xf71517f6ba7aa2e3,
+    0x50a8298ac7bff788, 0x323cc3a113033b51, 0x34d1aec8e1b9812a,
+    0x564544e335054df3, 0xf1f87a9f48c01898, 0x936c90b49c7cd441,
+    0x2c5aa94c1c44accb, 0x4ece4367c8f86012, 0xe9737d1bb53d3579,
+    0x8be797306181f9a0, 0x05c7a1c11a43dae8, 0x67534beaceff1631,
+    0xc0ee7596b33a435a, 0xa27a9fbd67868f83, 0x1d4ca645e7bef709,
+    0x7fd84c6e33023bd0, 0xd86572124ec76ebb, 0xbaf198399a7ba262,
+    0x56fdb0db164d36ae, 0x34695af0c2f1fa77, 0x93d4648cbf34af1c,
+    0xf1408ea76b8863c5, 0x4e76b75febb01b4f, 0x2ce25d743f0cd796,
+    0x8b5f630842c982fd, 0xe9cb892396754e24, 0x67ebbfd2edb76d6c,
+    0x057f55f9390ba1b5, 0xa2c26b8544cef4de, 0xc05681ae90723807,
+    0x7f60b856104a408d, 0x1df4527dc4f68c54, 0xba496c01b933d93f,
+    0xd8dd862a6d8f15e6, 0xf08992ef0e50ee22, 0x921d78c4daec22fb,
+    0x35a046b8a7297790, 0x5734ac937395bb49, 0xe802956bf3adc3c3,
+    0x8a967f4027110f1a, 0x2d2b413c5ad45a71, 0x4fbfab178e6896a8,
+    0xc19f9de6f5aab5e0, 0xa30b77cd21167939, 0x04b649b15cd32c52,
+    0x6622a39a886fe08b, 0xd9149a6208579801, 0xbb807049dceb54d8,
+    0x1c3d4e35a12e01b3, 0x7ea9a41e7592cd6a, 0x92a58cfcf9a459a6,
+    0xf03166d72d18957f, 0x578c58ab50ddc014, 0x3518b28084610ccd,
+    0x8a2e8b7804597447, 0xe8ba6153d0e5b89e, 0x4f075f2fad20edf5,
+    0x2d93b504799c212c, 0xa3b383f5025e0264, 0xc12769ded6e2cebd,
+    0x669a57a2ab279bd6, 0x040ebd897f9b570f, 0xbb388471ffa32f85,
+    0xd9ac6e5a2b1fe35c, 0x7e11502656dab637, 0x1c85ba0d82667aee,
+    0x2eb979ac916541bf, 0x4c2d938745d98d66, 0xeb90adfb381cd80d,
+    0x890447d0eca014d4, 0x36327e286c986c5e, 0x54a69403b824a087,
+    0xf31baa7fc5e1f5ec, 0x918f4054115d3935, 0x1faf76a56a9f1a7d,
+    0x7d3b9c8ebe23d6a4, 0xda86a2f2c3e683cf, 0xb81248d9175a4f16,
+    0x072471219762379c, 0x65b09b0a43defb45, 0xc20da5763e1bae2e,
+    0xa0994f5deaa762f7, 0x4c9567bf6691f63b, 0x2e018d94b22d3ae2,
+    0x89bcb3e8cfe86f89, 0xeb2859c31b54a350, 0x541e603b9b6cdbda,
+    0x368a8a104fd01703, 0x9137b46c32154268, 0xf3a35e47e6a98eb1,
+    0x7d8368b69d6badf9, 0x1f17829d49d76120, 0xb8aabce13412344b,
+    0xda3e56cae0aef892, 0x65086f3260968018, 0x079c8519b42a4cc1,
+    0xa021bb65c9ef19aa, 0xc2b5514e1d53d573, 0xeae1458b7e8c2eb7,
+    0x8875afa0aa30e26e, 0x2fc891dcd7f5b705, 0x4d5c7bf703497bdc,
+    0xf26a420f83710356, 0x90fea82457cdcf8f, 0x374396582a089ae4,
+    0x55d77c73feb4563d, 0xdbf74a8285767575, 0xb963a0a951cab9ac,
+    0x1ede9ed52c0fecc7, 0x7c4a74fef8b3201e, 0xc37c4d06788b5894,
+    0xa1e8a72dac37944d, 0x06559951d1f2c126, 0x64c1737a054e0dff,
+    0x88cd5b9889789933, 0xea59b1b35dc455ea, 0x4de48fcf20010081,
+    0x2f7065e4f4bdcc58, 0x90465c1c7485b4d2, 0xf2d2b637a039780b,
+    0x556f884bddfc2d60, 0x37fb62600940e1b9, 0xb9db54917282c2f1,
+    0xdb4fbebaa63e0e28, 0x7cf280c6dbfb5b43, 0x1e666aed0f47979a,
+    0xa15053158f7fef10, 0xc3c4b93e5bc323c9, 0x64798742260676a2,
+    0x06ed6d69f2baba7b}};
+
+static const z_word_t crc64_braid_big_table[][256] = {
+   {0x0000000000000000, 0xd9ccbcd42bea9462, 0xb29979a957d429c5,
+    0x6b55c57d7c3ebda7, 0xe12dfdfd84078b18, 0x38e14129afed1f7a,
+    0x53b48454d3d3a2dd, 0x8a783880f83936bf, 0xc25bfafb090f1631,
+    0x1b97462f22e58253, 0x70c283525edb3ff4, 0xa90e3f867531ab96,
+    0x237607068d089d29, 0xfababbd2a6e2094b, 0x91ef7eafdadcb4ec,
+    0x4823c27bf136208e, 0x84b7f4f7131e2c62, 0x5d7b482338f4b800,
+    0x362e8d5e44ca05a7, 0xefe2318a6f2091c5, 0x659a090a9719a77a,
+    0xbc56b5debcf33318, 0xd70370a3c0cd8ebf, 0x0ecfcc77eb271add,
+    0x46ec0e0c1a113a53, 0x9f20b2d831fbae31, 0xf47577a54dc51396,
+    0x2db9cb71662f87f4, 0xa7c1f3f19e16b14b, 0x7e0d4f25b5fc2529,
+    0x15588a58c9c2988e, 0xcc94368ce2280cec, 0x086fe9ef273c58c4,
+    0xd1a3553b0cd6cca6, 0xbaf6904670e87101, 0x633a2c925b02e563,
+    0xe9421412a33bd3dc, 0x308ea8c688d147be, 0x5bdb6dbbf4effa19,
+    0x8217d16fdf056e7b, 0xca3413142e334ef5, 0x13f8afc005d9da97,
+    0x78ad6abd79e76730, 0xa161d669520df352, 0x2b19eee9aa34c5ed,
+    0xf2d5523d81de518f, 0x99809740fde0ec28, 0x404c2b94d60a784a,
+    0x8cd81d18342274a6, 0x5514a1cc1fc8e0c4, 0x3e4164b163f65d63,
+    0xe78dd865481cc901, 0x6df5e0e5b025ffbe, 0xb4395c319bcf6bdc,
+    0xdf6c994ce7f1d67b, 0x06a02598cc1b4219, 0x4e83e7e33d2d6297,
+    0x974f5b3716c7f6f5, 0xfc1a9e4a6af94b52, 0x25d6229e4113df30,
+    0xafae1a1eb92ae98f, 0x7662a6ca92c07ded, 0x1d3763b7eefec04a,
+    0xc4fbdf63c5145428, 0x95c0dc7064d7681a, 0x4c0c60a44f3dfc78,
+    0x2759a5d9330341df, 0xfe95190d18e9d5bd, 0x74ed218de0d0e302,
+    0xad219d59cb3a7760, 0xc6745824b704cac7, 0x1fb8e4f09cee5ea5,
+    0x579b268b6dd87e2b, 0x8e579a5f4632ea49, 0xe5025f223a0c57ee,
+    0x3ccee3f611e6c38c, 0xb6b6db76e9dff533, 0x6f7a67a2c2356151,
+    0x042fa2dfbe0bdcf6, 0xdde31e0b95e14894, 0x1177288777c94478,
+    0xc8bb94535c23d01a, 0xa3ee512e201d6dbd, 0x7a22edfa0bf7f9df,
+    0xf05ad57af3cecf60, 0x299669aed8245b02, 0x42c3acd3a41ae6a5,
+    0x9b0f10078ff072c7, 0xd32cd27c7ec65249, 0x0ae06ea8552cc62b,
+    0x61b5abd529127b8c, 0xb879170102f8efee, 0x32012f81fac1d951,
+    0xebcd9355d12b4d33, 0x80985628ad15f094, 0x5954eafc86ff64f6,
+    0x9daf359f43eb30de, 0x4463894b6801a4bc, 0x2f364c36143f191b,
+    0xf6faf0e23fd58d79, 0x7c82c862c7ecbbc6, 0xa54e74b6ec062fa4,
+    0xce1bb1cb90389203, 0x17d70d1fbbd20661, 0x5ff4cf644ae426ef,
+    0x863873b0610eb28d, 0xed6db6cd1d300f2a, 0x34a10a1936da9b48,
+    0xbed93299cee3adf7, 0x67158e4de5093995, 0x0c404b3099378432,
+    0xd58cf7e4b2dd1050, 0x1918c16850f51cbc, 0xc0d47dbc7b1f88de,
+    0xab81b8c107213579, 0x724d04152ccba11b, 0xf8353c95d4f297a4,
+    0x21f98041ff1803c6, 0x4aac453c8326be61, 0x9360f9e8a8cc2a03,
+    0xdb433b9359fa0a8d, 0x028f874772109eef, 0x69da423a0e2e2348,
+    0xb016feee25c4b72a, 0x3a6ec66eddfd8195, 0xe3a27abaf61715f7,
+    0x88f7bfc78a29a850, 0x513b0313a1c33c32, 0x2a81b9e1c8aed134,
+    0xf34d0535e3444556, 0x9818c0489f7af8f1, 0x41d47c9cb4906c93,
+    0xcbac441c4ca95a2c, 0x1260f8c86743ce4e, 0x79353db51b7d73e9,
+    0xa0f981613097e78b, 0xe8da431ac1a1c705, 0x3116ffceea4b5367,
+    0x5a433ab39675eec0, 0x838f8667bd9f7aa2, 0x09f7bee745a64c1d,
+    0xd03b02336e4cd87f, 0xbb6ec74e127265d8, 0x62a27b9a3998f1ba,
+    0xae364d16dbb0fd56, 0x77faf1c2f05a6934, 0x1caf34bf8c64d493,
+    0xc563886ba78e40f1, 0x4f1bb0eb5fb7764e, 0x96d70c3f745de22c,
+    0xfd82c94208635f8b, 0x244e75962389cbe9, 0x6c6db7edd2bfeb67,
+    0xb5a10b39f9557f05, 0xdef4ce44856bc2a2, 0x07387290ae8156c0,
+    0x8d404a1056b8607f, 0x548cf6c47d52f41d, 0x3fd933b9016c49ba,
+    0xe6158f6d2a86ddd8, 0x22ee500eef9289f0, 0xfb22ecdac4781d92,
+    0x907729a7b846a035, 0x49bb957393ac3457, 0xc3c3adf36b9502e8,
+    0x1a0f1127407f968a, 0x715ad45a3c412b2d, 0xa896688e17abbf4f,
+    0xe0b5aaf5e69d9fc1, 0x39791621cd770ba3, 0x522cd35cb149b604,
+    0x8be06f889aa32266, 0x01985708629a14d9, 0xd854ebdc497080bb,
+    0xb3012ea1354e3d1c, 0x6acd92751ea4a97e, 0xa659a4f9fc8ca592,
+    0x7f95182dd76631f0, 0x14c0dd50ab588c57, 0xcd0c618480b21835,
+    0x47745904788b2e8a, 0x9eb8e5d05361bae8, 0xf5ed20ad2f5f074f,
+    0x2c219c7904b5932d, 0x64025e02f583b3a3, 0xbdcee2d6de6927c1,
+    0xd69b27aba2579a66, 0x0f579b7f89bd0e04, 0x852fa3ff718438bb,
+    0x5ce31f2b5a6eacd9, 0x37b6da562650117e, 0xee7a66820dba851c,
+    0xbf416591ac79b92e, 0x668dd94587932d4c, 0x0dd81c38fbad90eb,
+    0xd414a0ecd0470489, 0x5e6c986c287e3236, 0x87a024b80394a654,
+    0xecf5e1c57faa1bf3, 0x35395d1154408f91, 0x7d1a9f6aa576af1f,
+    0xa4d623be8e9c3b7d, 0xcf83e6c3f2a286da, 0x164f5a17d94812b8,
+    0x9c37629721712407, 0x45fbde430a9bb065, 0x2eae1b3e76a50dc2,
+    0xf762a7ea5d4f99a0, 0x3bf69166bf67954c, 0xe23a2db2948d012e,
+    0x896fe8cfe8b3bc89, 0x50a3541bc35928eb, 0xdadb6c9b3b601e54,
+    0x0317d04f108a8a36, 0x684215326cb43791, 0xb18ea9e6475ea3f3,
+    0xf9ad6b9db668837d, 0x2061d7499d82171f, 0x4b341234e1bcaab8,
+    0x92f8aee0ca563eda, 0x18809660326f0865, 0xc14c2ab419859c07,
+    0xaa19efc965bb21a0, 0x73d5531d4e51b5c2, 0xb72e8c7e8b45e1ea,
+    0x6ee230aaa0af7588, 0x05b7f5d7dc91c82f, 0xdc7b4903f77b5c4d,
+    0x560371830f426af2, 0x8fcfcd5724a8fe90, 0xe49a082a58964337,
+    0x3d56b4fe737cd755, 0x75757685824af7db, 0xacb9ca51a9a063b9,
+    0xc7ec0f2cd59ede1e, 0x1e20b3f8fe744a7c, 0x94588b78064d7cc3,
+    0x4d9437ac2da7e8a1, 0x26c1f2d151995506, 0xff0d4e057a73c164,
+    0x33997889985bcd88, 0xea55c45db3b159ea, 0x81000120cf8fe44d,
+    0x58ccbdf4e465702f, 0xd2b485741c5c4690, 0x0b7839a037b6d2f2,
+    0x602dfcdd4b886f55, 0xb9e140096062fb37, 0xf1c282729154dbb9,
+    0x280e3ea6babe4fdb, 0x435bfbdbc680f27c, 0x9a97470fed6a661e,
+    0x10ef7f8f155350a1, 0xc923c35b3eb9c4c3, 0xa276062642877964,
+    0x7bbabaf2696ded06},
+   {0x0000000000000000, 0x6fb11aba3a82ac94, 0x5b7c3bdb5eab81bb,
+    0x34cd216164292d2f, 0x33e6781996f9dbe5, 0x5c5762a3ac7b7771,
+    0x689a43c2c8525a5e, 0x072b5978f2d0f6ca, 0xe3d2ff9d075c6f59,
+    0x8c63e5273ddec3cd, 0xb8aec44659f7eee2, 0xd71fdefc63754276,
+    0xd034878491a5b4bc, 0xbf859d3eab271828, 0x8b48bc5fcf0e3507,
+    0xe4f9a6e5f58c9993, 0xc6a5ff3b0fb8deb2, 0xa914e581353a7226,
+    0x9dd9c4e051135f09, 0xf268de5a6b91f39d, 0xf543872299410557,
+    0x9af29d98a3c3a9c3, 0xae3fbcf9c7ea84ec, 0xc18ea643fd682878,
+    0x257700a608e4b1eb, 0x4ac61a1c32661d7f, 0x7e0b3b7d564f3050,
+    0x11ba21c76ccd9cc4, 0x169178bf9e1d6a0e, 0x79206205a49fc69a,
+    0x4ded4364c0b6ebb5, 0x225c59defa344721, 0x0955f1d835df65f7,
+    0x66e4eb620f5dc963, 0x5229ca036b74e44c, 0x3d98d0b951f648d8,
+    0x3ab389c1a326be12, 0x5502937b99a41286, 0x61cfb21afd8d3fa9,
+    0x0e7ea8a0c70f933d, 0xea870e4532830aae, 0x853614ff0801a63a,
+    0xb1fb359e6c288b15, 0xde4a2f2456aa2781, 0xd961765ca47ad14b,
+    0xb6d06ce69ef87ddf, 0x821d4d87fad150f0, 0xedac573dc053fc64,
+    0xcff00ee33a67bb45, 0xa041145900e517d1, 0x948c353864cc3afe,
+    0xfb3d2f825e4e966a, 0xfc1676faac9e60a0, 0x93a76c40961ccc34,
+    0xa76a4d21f235e11b, 0xc8db579bc8b74d8f, 0x2c22f17e3d3bd41c,
+    0x4393ebc407b97888, 0x775ecaa5639055a7, 0x18efd01f5912f933,
+    0x1fc48967abc20ff9, 0x707593dd9140a36d, 0x44b8b2bcf5698e42,
+    0x2b09a806cfeb22d6, 0x97b4ec1e4011137c, 0xf805f6a47a93bfe8,
+    0xccc8d7c51eba92c7, 0xa379cd7f24383e53, 0xa4529407d6e8c899,
+    0xcbe38ebdec6a640d, 0xff2eafdc88434922, 0x909fb566b2c1e5b6,
+    0x74661383474d7c25, 0x1bd709397dcfd0b1, 0x2f1a285819e6fd9e,
+    0x40ab32e22364510a, 0x47806b9ad1b4a7c0, 0x28317120eb360b54,
+    0x1cfc50418f1f267b, 0x734d4afbb59d8aef, 0x511113254fa9cdce,
+    0x3ea0099f752b615a, 0x0a6d28fe11024c75, 0x65dc32442b80e0e1,
+    0x62f76b3cd950162b, 0x0d467186e3d2babf, 0x398b50e787fb9790,
+    0x563a4a5dbd793b04, 0xb2c3ecb848f5a297, 0xdd72f60272770e03,
+    0xe9bfd763165e232c, 0x860ecdd92cdc8fb8, 0x812594a1de0c7972,
+    0xee948e1be48ed5e6, 0xda59af7a80a7f8c9, 0xb5e8b5c0ba25545d,
+    0x9ee11dc675ce768b, 0xf150077c4f4cda1f, 0xc59d261d2b65f730,
+    0xaa2c3ca711e75ba4, 0xad0765dfe337ad6e, 0xc2b67f65d9b501fa,
+    0xf67b5e04bd9c2cd5, 0x99ca44be871e8041, 0x7d33e25b729219d2,
+    0x1282f8e14810b546, 0x264fd9802c399869, 0x49fec33a16bb34fd,
+    0x4ed59a42e46bc237, 0x216480f8dee96ea3, 0x15a9a199bac0438c,
+    0x7a18bb238042ef18, 0x5844e2fd7a76a839, 0x37f5f84740f404ad,
+    0x0338d92624dd2982, 0x6c89c39c1e5f8516, 0x6ba29ae4ec8f73dc,
+    0x0413805ed60ddf48, 0x30dea13fb224f267, 0x5f6fbb8588a65ef3,
+    0xbb961d607d2ac760, 0xd42707da47a86bf4, 0xe0ea26bb238146db,
+    0x8f5b3c011903ea4f, 0x88706579ebd31c85, 0xe7c17fc3d151b011,
+    0xd30c5ea2b5789d3e, 0xbcbd44188ffa31aa, 0x2e69d93d802226f8,
+    0x41d8c387baa08a6c, 0x7515e2e6de89a743, 0x1aa4f85ce40b0bd7,
+    0x1d8fa12416dbfd1d, 0x723ebb9e2c595189, 0x46f39aff48707ca6,
+    0x2942804572f2d032, 0xcdbb26a0877e49a1, 0xa20a3c1abdfce535,
+    0x96c71d7bd9d5c81a, 0xf97607c1e357648e, 0xfe5d5eb911879244,
+    0x91ec44032b053ed0, 0xa52165624f2c13ff, 0xca907fd875aebf6b,
+    0xe8cc26068f9af84a, 0x877d3cbcb51854de, 0xb3b01dddd13179f1,
+    0xdc010767ebb3d565, 0xdb2a5e1f196323af, 0xb49b44a523e18f3b,
+    0x805665c447c8a214, 0xefe77f7e7d4a0e80, 0x0b1ed99b88c69713,
+    0x64afc321b2443b87, 0x5062e240d66d16a8, 0x3fd3f8faecefba3c,
+    0x38f8a1821e3f4cf6, 0x5749bb3824bde062, 0x63849a594094cd4d,
+    0x0c3580e37a1661d9, 0x273c28e5b5fd430f, 0x488d325f8f7fef9b,
+    0x7c40133eeb56c2b4, 0x13f10984d1d46e20, 0x14da50fc230498ea,
+    0x7b6b4a461986347e, 0x4fa66b277daf1951, 0x2017719d472db5c5,
+    0xc4eed778b2a12c56, 0xab5fcdc2882380c2, 0x9f92eca3ec0aaded,
+    0xf023f619d6880179, 0xf708af612458f7b3, 0x98b9b5db1eda5b27,
+    0xac7494ba7af37608, 0xc3c58e004071da9c, 0xe199d7deba459dbd,
+    0x8e28cd6480c73129, 0xbae5ec05e4ee1c06, 0xd554f6bfde6cb092,
+    0xd27fafc72cbc4658, 0xbdceb57d163eeacc, 0x8903941c7217c7e3,
+    0xe6b28ea648956b77, 0x024b2843bd19f2e4, 0x6dfa32f9879b5e70,
+    0x59371398e3b2735f, 0x36860922d930dfcb, 0x31ad505a2be02901,
+    0x5e1c4ae011628595, 0x6ad16b81754ba8ba, 0x0560713b4fc9042e,
+    0xb9dd3523c0333584, 0xd66c2f99fab19910, 0xe2a10ef89e98b43f,
+    0x8d101442a41a18ab, 0x8a3b4d3a56caee61, 0xe58a57806c4842f5,
+    0xd14776e108616fda, 0xbef66c5b32e3c34e, 0x5a0fcabec76f5add,
+    0x35bed004fdedf649, 0x0173f16599c4db66, 0x6ec2ebdfa34677f2,
+    0x69e9b2a751968138, 0x0658a81d6b142dac, 0x3295897c0f3d0083,
+    0x5d2493c635bfac17, 0x7f78ca18cf8beb36, 0x10c9d0a2f50947a2,
+    0x2404f1c391206a8d, 0x4bb5eb79aba2c619, 0x4c9eb201597230d3,
+    0x232fa8bb63f09c47, 0x17e289da07d9b168, 0x785393603d5b1dfc,
+    0x9caa3585c8d7846f, 0xf31b2f3ff25528fb, 0xc7d60e5e967c05d4,
+    0xa86714e4acfea940, 0xaf4c4d9c5e2e5f8a, 0xc0fd572664acf31e,
+    0xf43076470085de31, 0x9b816cfd3a0772a5, 0xb088c4fbf5ec5073,
+    0xdf39de41cf6efce7, 0xebf4ff20ab47d1c8, 0x8445e59a91c57d5c,
+    0x836ebce263158b96, 0xecdfa65859972702, 0xd81287393dbe0a2d,
+    0xb7a39d83073ca6b9, 0x535a3b66f2b03f2a, 0x3ceb21dcc83293be,
+    0x082600bdac1bbe91, 0x67971a0796991205, 0x60bc437f6449e4cf,
+    0x0f0d59c55ecb485b, 0x3bc078a43ae26574, 0x5471621e0060c9e0,
+    0x762d3bc0fa548ec1, 0x199c217ac0d62255, 0x2d51001ba4ff0f7a,
+    0x42e01aa19e7da3ee, 0x45cb43d96cad5524, 0x2a7a5963562ff9b0,
+    0x1eb778023206d49f, 0x710662b80884780b, 0x95ffc45dfd08e198,
+    0xfa4edee7c78a4d0c, 0xce83ff86a3a36023, 0xa132e53c9921ccb7,
+    0xa619bc446bf13a7d, 0xc9a8a6fe517396e9, 0xfd65879f355abbc6,
+    0x92d49d250fd81752},
+   {0x0000000000000000, 0xe34c69d85cfbce54, 0xc699d2b0b9f69da9,
+    0x25d5bb68e50d53fd, 0x092dabce5842e3c1, 0xea61c21604b92d95,
+    0xcfb4797ee1b47e68, 0x2cf810a6bd4fb03c, 0x974458329a2b1e11,
+    0x740831eac6d0d045, 0x51dd8a8223dd83b8, 0xb291e35a7f264dec,
+    0x9e69f3fcc269fdd0, 0x7d259a249e923384, 0x58f0214c7b9f6079,
+    0xbbbc48942764ae2d, 0x2e89b06434573c22, 0xcdc5d9bc68acf276,
+    0xe81062d48da1a18b, 0x0b5c0b0cd15a6fdf, 0x27a41baa6c15dfe3,
+    0xc4e8727230ee11b7, 0xe13dc91ad5e3424a, 0x0271a0c289188c1e,
+    0xb9cde856ae7c2233, 0x5a81818ef287ec67, 0x7f543ae6178abf9a,
+    0x9c18533e4b7171ce, 0xb0e04398f63ec1f2, 0x53ac2a40aac50fa6,
+    0x767991284fc85c5b, 0x9535f8f01333920f, 0x5c1261c968ae7844,
+    0xbf5e08113455b610, 0x9a8bb379d158e5ed, 0x79c7daa18da32bb9,
+    0x553fca0730ec9b85, 0xb673a3df6c1755d1, 0x93a618b7891a062c,
+    0x70ea716fd5e1c878, 0xcb5639fbf2856655, 0x281a5023ae7ea801,
+    0x0dcfeb4b4b73fbfc, 0xee838293178835a8, 0xc27b9235aac78594,
+    0x2137fbedf63c4bc0, 0x04e240851331183d, 0xe7ae295d4fcad669,
+    0x729bd1ad5cf94466, 0x91d7b87500028a32, 0xb402031de50fd9cf,
+    0x574e6ac5b9f4179b, 0x7bb67a6304bba7a7, 0x98fa13bb584069f3,
+    0xbd2fa8d3bd4d3a0e, 0x5e63c10be1b6f45a, 0xe5df899fc6d25a77,
+    0x0693e0479a299423, 0x23465b2f7f24c7de, 0xc00a32f723df098a,
+    0xecf222519e90b9b6, 0x0fbe4b89c26b77e2, 0x2a6bf0e12766241f,
+    0xc92799397b9dea4b, 0xb824c292d15cf188, 0x5b68ab4a8da73fdc,
+    0x7ebd102268aa6c21, 0x9df179fa3451a275, 0xb109695c891e1249,
+    0x52450084d5e5dc1d, 0x7790bbec30e88fe0, 0x94dcd2346c1341b4,
+    0x2f609aa04b77ef99, 0xcc2cf378178c21cd, 0xe9f94810f2817230,
+    0x0ab521c8ae7abc64, 0x264d316e13350c58, 0xc50158b64fcec20c,
+    0xe0d4e3deaac391f1, 0x03988a06f6385fa5, 0x96ad72f6e50bcdaa,
+    0x75e11b2eb9f003fe, 0x5034a0465cfd5003, 0xb378c99e00069e57,
+    0x9f80d938bd492e6b, 0x7cccb0e0e1b2e03f, 0x59190b8804bfb3c2,
+    0xba55625058447d96, 0x01e92ac47f20d3bb, 0xe2a5431c23db1def,
+    0xc770f874c6d64e12, 0x243c91ac9a2d8046, 0x08c4810a2762307a,
+    0xeb88e8d27b99fe2e, 0xce5d53ba9e94add3, 0x2d113a62c26f6387,
+    0xe436a35bb9f289cc, 0x077aca83e5094798, 0x22af71eb00041465,
+    0xc1e318335cffda31, 0xed1b0895e1b06a0d, 0x0e57614dbd4ba459,
+    0x2b82da255846f7a4, 0xc8ceb3fd04bd39f0, 0x7372fb6923d997dd,
+    0x903e92b17f225989, 0xb5eb29d99a2f0a74, 0x56a74001c6d4c420,
+    0x7a5f50a77b9b741c, 0x9913397f2760ba48, 0xbcc68217c26de9b5,
+    0x5f8aebcf9e9627e1, 0xcabf133f8da5b5ee, 0x29f37ae7d15e7bba,
+    0x0c26c18f34532847, 0xef6aa85768a8e613, 0xc392b8f1d5e7562f,
+    0x20ded129891c987b, 0x050b6a416c11cb86, 0xe647039930ea05d2,
+    0x5dfb4b0d178eabff, 0xbeb722d54b7565ab, 0x9b6299bdae783656,
+    0x782ef065f283f802, 0x54d6e0c34fcc483e, 0xb79a891b1337866a,
+    0x924f3273f63ad597, 0x71035babaac11bc3, 0xf5578a8a88163a83,
+    0x161be352d4edf4d7, 0x33ce583a31e0a72a, 0xd08231e26d1b697e,
+    0xfc7a2144d054d942, 0x1f36489c8caf1716, 0x3ae3f3f469a244eb,
+    0xd9af9a2c35598abf, 0x6213d2b8123d2492, 0x815fbb604ec6eac6,
+    0xa48a0008abcbb93b, 0x47c669d0f730776f, 0x6b3e79764a7fc753,
+    0x887210ae16840907, 0xada7abc6f3895afa, 0x4eebc21eaf7294ae,
+    0xdbde3aeebc4106a1, 0x38925336e0bac8f5, 0x1d47e85e05b79b08,
+    0xfe0b8186594c555c, 0xd2f39120e403e560, 0x31bff8f8b8f82b34,
+    0x146a43905df578c9, 0xf7262a48010eb69d, 0x4c9a62dc266a18b0,
+    0xafd60b047a91d6e4, 0x8a03b06c9f9c8519, 0x694fd9b4c3674b4d,
+    0x45b7c9127e28fb71, 0xa6fba0ca22d33525, 0x832e1ba2c7de66d8,
+    0x6062727a9b25a88c, 0xa945eb43e0b842c7, 0x4a09829bbc438c93,
+    0x6fdc39f3594edf6e, 0x8c90502b05b5113a, 0xa068408db8faa106,
+    0x43242955e4016f52, 0x66f1923d010c3caf, 0x85bdfbe55df7f2fb,
+    0x3e01b3717a935cd6, 0xdd4ddaa926689282, 0xf89861c1c365c17f,
+    0x1bd408199f9e0f2b, 0x372c18bf22d1bf17, 0xd46071677e2a7143,
+    0xf1b5ca0f9b2722be, 0x12f9a3d7c7dcecea, 0x87cc5b27d4ef7ee5,
+    0x648032ff8814b0b1, 0x415589976d19e34c, 0xa219e04f31e22d18,
+    0x8ee1f0e98cad9d24, 0x6dad9931d0565370, 0x48782259355b008d,
+    0xab344b8169a0ced9, 0x108803154ec460f4, 0xf3c46acd123faea0,
+    0xd611d1a5f732fd5d, 0x355db87dabc93309, 0x19a5a8db16868335,
+    0xfae9c1034a7d4d61, 0xdf3c7a6baf701e9c, 0x3c7013b3f38bd0c8,
+    0x4d734818594acb0b, 0xae3f21c005b1055f, 0x8bea9aa8e0bc56a2,
+    0x68a6f370bc4798f6, 0x445ee3d6010828ca, 0xa7128a0e5df3e69e,
+    0x82c73166b8feb563, 0x618b58bee4057b37, 0xda37102ac361d51a,
+    0x397b79f29f9a1b4e, 0x1caec29a7a9748b3, 0xffe2ab42266c86e7,
+    0xd31abbe49b2336db, 0x3056d23cc7d8f88f, 0x1583695422d5ab72,
+    0xf6cf008c7e2e6526, 0x63faf87c6d1df729, 0x80b691a431e6397d,
+    0xa5632accd4eb6a80, 0x462f43148810a4d4, 0x6ad753b2355f14e8,
+    0x899b3a6a69a4dabc, 0xac4e81028ca98941, 0x4f02e8dad0524715,
+    0xf4bea04ef736e938, 0x17f2c996abcd276c, 0x322772fe4ec07491,
+    0xd16b1b26123bbac5, 0xfd930b80af740af9, 0x1edf6258f38fc4ad,
+    0x3b0ad93016829750, 0xd846b0e84a795904, 0x116129d131e4b34f,
+    0xf22d40096d1f7d1b, 0xd7f8fb6188122ee6, 0x34b492b9d4e9e0b2,
+    0x184c821f69a6508e, 0xfb00ebc7355d9eda, 0xded550afd050cd27,
+    0x3d9939778cab0373, 0x862571e3abcfad5e, 0x6569183bf734630a,
+    0x40bca353123930f7, 0xa3f0ca8b4ec2fea3, 0x8f08da2df38d4e9f,
+    0x6c44b3f5af7680cb, 0x4991089d4a7bd336, 0xaadd614516801d62,
+    0x3fe899b505b38f6d, 0xdca4f06d59484139, 0xf9714b05bc4512c4,
+    0x1a3d22dde0bedc90, 0x36c5327b5df16cac, 0xd5895ba3010aa2f8,
+    0xf05ce0cbe407f105, 0x13108913b8fc3f51, 0xa8acc1879f98917c,
+    0x4be0a85fc3635f28, 0x6e351337266e0cd5, 0x8d797aef7a95c281,
+    0xa1816a49c7da72bd, 0x42cd03919b21bce9, 0x6718b8f97e2cef14,
+    0x8454d12122d72140},
+   {0x0000000000000000, 0x09d21d693d8a1311, 0x12a43bd27a142722,
+    0x1b7626bb479e3433, 0x244877a4f5284e44, 0x2d9a6acdc8a25d55,
+    0x36ec4c768f3c6966, 0x3f3e511fb2b67a77, 0x4890ee48eb519c88,
+    0x4142f321d6db8f99, 0x5a34d59a9145bbaa, 0x53e6c8f3accfa8bb,
+    0x6cd899ec1e79d2cc, 0x650a848523f3c1dd, 0x7e7ca23e646df5ee,
+    0x77aebf5759e7e6ff, 0x153ed33efd0ce083, 0x1cecce57c086f392,
+    0x079ae8ec8718c7a1, 0x0e48f585ba92d4b0, 0x3176a49a0824aec7,
+    0x38a4b9f335aebdd6, 0x23d29f48723089e5, 0x2a0082214fba9af4,
+    0x5dae3d76165d7c0b, 0x547c201f2bd76f1a, 0x4f0a06a46c495b29,
+    0x46d81bcd51c34838, 0x79e64ad2e375324f, 0x703457bbdeff215e,
+    0x6b4271009961156d, 0x62906c69a4eb067c, 0xaf62a8d2d1b61895,
+    0xa6b0b5bbec3c0b84, 0xbdc69300aba23fb7, 0xb4148e6996282ca6,
+    0x8b2adf76249e56d1, 0x82f8c21f191445c0, 0x998ee4a45e8a71f3,
+    0x905cf9cd630062e2, 0xe7f2469a3ae7841d, 0xee205bf3076d970c,
+    0xf5567d4840f3a33f, 0xfc8460217d79b02e, 0xc3ba313ecfcfca59,
+    0xca682c57f245d948, 0xd11e0aecb5dbed7b, 0xd8cc17858851fe6a,
+    0xba5c7bec2cbaf816, 0xb38e66851130eb07, 0xa8f8403e56aedf34,
+    0xa12a5d576b24cc25, 0x9e140c48d992b652, 0x97c61121e418a543,
+    0x8cb0379aa3869170, 0x85622af39e0c8261, 0xf2cc95a4c7eb649e,
+    0xfb1e88cdfa61778f, 0xe068ae76bdff43bc, 0xe9bab31f807550ad,
+    0xd684e20032c32ada, 0xdf56ff690f4939cb, 0xc420d9d248d70df8,
+    0xcdf2c4bb755d1ee9, 0xdbdb5e0a88c2e9b8, 0xd2094363b548faa9,
+    0xc97f65d8f2d6ce9a, 0xc0ad78b1cf5cdd8b, 0xff9329ae7deaa7fc,
+    0xf64134c74060b4ed, 0xed37127c07fe80de, 0xe4e50f153a7493cf,
+    0x934bb04263937530, 0x9a99ad2b5e196621, 0x81ef8b9019875212,
+    0x883d96f9240d4103, 0xb703c7e696bb3b74, 0xbed1da8fab312865,
+    0xa5a7fc34ecaf1c56, 0xac75e15dd1250f47, 0xcee58d3475ce093b,
+    0xc737905d48441a2a, 0xdc41b6e60fda2e19, 0xd593ab8f32503d08,
+    0xeaadfa9080e6477f, 0xe37fe7f9bd6c546e, 0xf809c142faf2605d,
+    0xf1dbdc2bc778734c, 0x8675637c9e9f95b3, 0x8fa77e15a31586a2,
+    0x94d158aee48bb291, 0x9d0345c7d901a180, 0xa23d14d86bb7dbf7,
+    0xabef09b1563dc8e6, 0xb0992f0a11a3fcd5, 0xb94b32632c29efc4,
+    0x74b9f6d85974f12d, 0x7d6bebb164fee23c, 0x661dcd0a2360d60f,
+    0x6fcfd0631eeac51e, 0x50f1817cac5cbf69, 0x59239c1591d6ac78,
+    0x4255baaed648984b, 0x4b87a7c7ebc28b5a, 0x3c291890b2256da5,
+    0x35fb05f98faf7eb4, 0x2e8d2342c8314a87, 0x275f3e2bf5bb5996,
+    0x18616f34470d23e1, 0x11b3725d7a8730f0, 0x0ac554e63d1904c3,
+    0x0317498f009317d2, 0x618725e6a47811ae, 0x6855388f99f202bf,
+    0x73231e34de6c368c, 0x7af1035de3e6259d, 0x45cf524251505fea,
+    0x4c1d4f2b6cda4cfb, 0x576b69902b4478c8, 0x5eb974f916ce6bd9,
+    0x2917cbae4f298d26, 0x20c5d6c772a39e37, 0x3bb3f07c353daa04,
+    0x3261ed1508b7b915, 0x0d5fbc0aba01c362, 0x048da163878bd073,
+    0x1ffb87d8c015e440, 0x16299ab1fd9ff751, 0x33a9b3bb3b2a0be3,
+    0x3a7baed206a018f2, 0x210d8869413e2cc1, 0x28df95007cb43fd0,
+    0x17e1c41fce0245a7, 0x1e33d976f38856b6, 0x0545ffcdb4166285,
+    0x0c97e2a4899c7194, 0x7b395df3d07b976b, 0x72eb409aedf1847a,
+    0x699d6621aa6fb049, 0x604f7b4897e5a358, 0x5f712a572553d92f,
+    0x56a3373e18d9ca3e, 0x4dd511855f47fe0d, 0x44070cec62cded1c,
+    0x26976085c626eb60, 0x2f457decfbacf871, 0x34335b57bc32cc42,
+    0x3de1463e81b8df53, 0x02df1721330ea524, 0x0b0d0a480e84b635,
+    0x107b2cf3491a8206, 0x19a9319a74909117, 0x6e078ecd2d7777e8,
+    0x67d593a410fd64f9, 0x7ca3b51f576350ca, 0x7571a8766ae943db,
+    0x4a4ff969d85f39ac, 0x439de400e5d52abd, 0x58ebc2bba24b1e8e,
+    0x5139dfd29fc10d9f, 0x9ccb1b69ea9c1376, 0x95190600d7160067,
+    0x8e6f20bb90883454, 0x87bd3dd2ad022745, 0xb8836ccd1fb45d32,
+    0xb15171a4223e4e23, 0xaa27571f65a07a10, 0xa3f54a76582a6901,
+    0xd45bf52101cd8ffe, 0xdd89e8483c479cef, 0xc6ffcef37bd9a8dc,
+    0xcf2dd39a4653bbcd, 0xf0138285f4e5c1ba, 0xf9c19fecc96fd2ab,
+    0xe2b7b9578ef1e698, 0xeb65a43eb37bf589, 0x89f5c8571790f3f5,
+    0x8027d53e2a1ae0e4, 0x9b51f3856d84d4d7, 0x9283eeec500ec7c6,
+    0xadbdbff3e2b8bdb1, 0xa46fa29adf32aea0, 0xbf19842198ac9a93,
+    0xb6cb9948a5268982, 0xc165261ffcc16f7d, 0xc8b73b76c14b7c6c,
+    0xd3c11dcd86d5485f, 0xda1300a4bb5f5b4e, 0xe52d51bb09e92139,
+    0xecff4cd234633228, 0xf7896a6973fd061b, 0xfe5b77004e77150a,
+    0xe872edb1b3e8e25b, 0xe1a0f0d88e62f14a, 0xfad6d663c9fcc579,
+    0xf304cb0af476d668, 0xcc3a9a1546c0ac1f, 0xc5e8877c7b4abf0e,
+    0xde9ea1c73cd48b3d, 0xd74cbcae015e982c, 0xa0e203f958b97ed3,
+    0xa9301e9065336dc2, 0xb246382b22ad59f1, 0xbb9425421f274ae0,
+    0x84aa745dad913097, 0x8d786934901b2386, 0x960e4f8fd78517b5,
+    0x9fdc52e6ea0f04a4, 0xfd4c3e8f4ee402d8, 0xf49e23e6736e11c9,
+    0xefe8055d34f025fa, 0xe63a1834097a36eb, 0xd904492bbbcc4c9c,
+    0xd0d6544286465f8d, 0xcba072f9c1d86bbe, 0xc2726f90fc5278af,
+    0xb5dcd0c7a5b59e50, 0xbc0ecdae983f8d41, 0xa778eb15dfa1b972,
+    0xaeaaf67ce22baa63, 0x9194a763509dd014, 0x9846ba0a6d17c305,
+    0x83309cb12a89f736, 0x8ae281d81703e427, 0x47104563625eface,
+    0x4ec2580a5fd4e9df, 0x55b47eb1184addec, 0x5c6663d825c0cefd,
+    0x635832c79776b48a, 0x6a8a2faeaafca79b, 0x71fc0915ed6293a8,
+    0x782e147cd0e880b9, 0x0f80ab2b890f6646, 0x0652b642b4857557,
+    0x1d2490f9f31b4164, 0x14f68d90ce915275, 0x2bc8dc8f7c272802,
+    0x221ac1e641ad3b13, 0x396ce75d06330f20, 0x30befa343bb91c31,
+    0x522e965d9f521a4d, 0x5bfc8b34a2d8095c, 0x408aad8fe5463d6f,
+    0x4958b0e6d8cc2e7e, 0x7666e1f96a7a5409, 0x7fb4fc9057f04718,
+    0x64c2da2b106e732b, 0x6d10c7422de4603a, 0x1abe7815740386c5,
+    0x136c657c498995d4, 0x081a43c70e17a1e7, 0x01c85eae339db2f6,
+    0x3ef60fb1812bc881, 0x372412d8bca1db90, 0x2c523463fb3fefa3,
+    0x2580290ac6b5fcb2},
+   {0x0000000000000000, 0xdbfed0c13dd89e44, 0xb6fda1837bb03d89,
+    0x6d0371424668a3cd, 0xe9e54da8dccfa380, 0x321b9d69e1173dc4,
+    0x5f18ec2ba77f9e09, 0x84e63cea9aa7004d, 0x57d595ff92309f93,
+    0x8c2b453eafe801d7, 0xe128347ce980a21a, 0x3ad6e4bdd4583c5e,
+    0xbe30d8574eff3c13, 0x65ce08967327a257, 0x08cd79d4354f019a,
+    0xd333a91508979fde, 0x2bb425500ecee6b5, 0xf04af591331678f1,
+    0x9d4984d3757edb3c, 0x46b7541248a64578, 0xc25168f8d2014535,
+    0x19afb839efd9db71, 0x74acc97ba9b178bc, 0xaf5219ba9469e6f8,
+    0x7c61b0af9cfe7926, 0xa79f606ea126e762, 0xca9c112ce74e44af,
+    0x1162c1edda96daeb, 0x9584fd074031daa6, 0x4e7a2dc67de944e2,
+    0x23795c843b81e72f, 0xf8878c450659796b, 0xd376450f373315f9,
+    0x088895ce0aeb8bbd, 0x658be48c4c832870, 0xbe75344d715bb634,
+    0x3a9308a7ebfcb679, 0xe16dd866d624283d, 0x8c6ea924904c8bf0,
+    0x579079e5ad9415b4, 0x84a3d0f0a5038a6a, 0x5f5d003198db142e,
+    0x325e7173deb3b7e3, 0xe9a0a1b2e36b29a7, 0x6d469d5879cc29ea,
+    0xb6b84d994414b7ae, 0xdbbb3cdb027c1463, 0x0045ec1a3fa48a27,
+    0xf8c2605f39fdf34c, 0x233cb09e04256d08, 0x4e3fc1dc424dcec5,
+    0x95c1111d7f955081, 0x11272df7e53250cc, 0xcad9fd36d8eace88,
+    0xa7da8c749e826d45, 0x7c245cb5a35af301, 0xaf17f5a0abcd6cdf,
+    0x74e925619615f29b, 0x19ea5423d07d5156, 0xc21484e2eda5cf12,
+    0x46f2b8087702cf5f, 0x9d0c68c94ada511b, 0xf00f198b0cb2f2d6,
+    0x2bf1c94a316a6c92, 0x23f384b145c9f260, 0xf80d547078116c24,
+    0x950e25323e79cfe9, 0x4ef0f5f303a151ad, 0xca16c919990651e0,
+    0x11e819d8a4decfa4, 0x7ceb689ae2b66c69, 0xa715b85bdf6ef22d,
+    0x7426114ed7f96df3, 0xafd8c18fea21f3b7, 0xc2dbb0cdac49507a,
+    0x1925600c9191ce3e, 0x9dc35ce60b36ce73, 0x463d8c2736ee5037,
+    0x2b3efd657086f3fa, 0xf0c02da44d5e6dbe, 0x0847a1e14b0714d5,
+    0xd3b9712076df8a91, 0xbeba006230b7295c, 0x6544d0a30d6fb718,
+    0xe1a2ec4997c8b755, 0x3a5c3c88aa102911, 0x575f4dcaec788adc,
+    0x8ca19d0bd1a01498, 0x5f92341ed9378b46, 0x846ce4dfe4ef1502,
+    0xe96f959da287b6cf, 0x3291455c9f5f288b, 0xb67779b605f828c6,
+    0x6d89a9773820b682, 0x008ad8357e48154f, 0xdb7408f443908b0b,
+    0xf085c1be72fae799, 0x2b7b117f4f2279dd, 0x4678603d094ada10,
+    0x9d86b0fc34924454, 0x19608c16ae354419, 0xc29e5cd793edda5d,
+    0xaf9d2d95d5857990, 0x7463fd54e85de7d4, 0xa7505441e0ca780a,
+    0x7cae8480dd12e64e, 0x11adf5c29b7a4583, 0xca532503a6a2dbc7,
+    0x4eb519e93c05db8a, 0x954bc92801dd45ce, 0xf848b86a47b5e603,
+    0x23b668ab7a6d7847, 0xdb31e4ee7c34012c, 0x00cf342f41ec9f68,
+    0x6dcc456d07843ca5, 0xb63295ac3a5ca2e1, 0x32d4a946a0fba2ac,
+    0xe92a79879d233ce8, 0x842908c5db4b9f25, 0x5fd7d804e6930161,
+    0x8ce47111ee049ebf, 0x571aa1d0d3dc00fb, 0x3a19d09295b4a336,
+    0xe1e70053a86c3d72, 0x65013cb932cb3d3f, 0xbeffec780f13a37b,
+    0xd3fc9d3a497b00b6, 0x08024dfb74a39ef2, 0x46e609638b92e5c1,
+    0x9d18d9a2b64a7b85, 0xf01ba8e0f022d848, 0x2be57821cdfa460c,
+    0xaf0344cb575d4641, 0x74fd940a6a85d805, 0x19fee5482ced7bc8,
+    0xc20035891135e58c, 0x11339c9c19a27a52, 0xcacd4c5d247ae416,
+    0xa7ce3d1f621247db, 0x7c30edde5fcad99f, 0xf8d6d134c56dd9d2,
+    0x232801f5f8b54796, 0x4e2b70b7bedde45b, 0x95d5a07683057a1f,
+    0x6d522c33855c0374, 0xb6acfcf2b8849d30, 0xdbaf8db0feec3efd,
+    0x00515d71c334a0b9, 0x84b7619b5993a0f4, 0x5f49b15a644b3eb0,
+    0x324ac01822239d7d, 0xe9b410d91ffb0339, 0x3a87b9cc176c9ce7,
+    0xe179690d2ab402a3, 0x8c7a184f6cdca16e, 0x5784c88e51043f2a,
+    0xd362f464cba33f67, 0x089c24a5f67ba123, 0x659f55e7b01302ee,
+    0xbe6185268dcb9caa, 0x95904c6cbca1f038, 0x4e6e9cad81796e7c,
+    0x236dedefc711cdb1, 0xf8933d2efac953f5, 0x7c7501c4606e53b8,
+    0xa78bd1055db6cdfc, 0xca88a0471bde6e31, 0x117670862606f075,
+    0xc245d9932e916fab, 0x19bb09521349f1ef, 0x74b8781055215222,
+    0xaf46a8d168f9cc66, 0x2ba0943bf25ecc2b, 0xf05e44facf86526f,
+    0x9d5d35b889eef1a2, 0x46a3e579b4366fe6, 0xbe24693cb26f168d,
+    0x65dab9fd8fb788c9, 0x08d9c8bfc9df2b04, 0xd327187ef407b540,
+    0x57c124946ea0b50d, 0x8c3ff45553782b49, 0xe13c851715108884,
+    0x3ac255d628c816c0, 0xe9f1fcc3205f891e, 0x320f2c021d87175a,
+    0x5f0c5d405befb497, 0x84f28d8166372ad3, 0x0014b16bfc902a9e,
+    0xdbea61aac148b4da, 0xb6e910e887201717, 0x6d17c029baf88953,
+    0x65158dd2ce5b17a1, 0xbeeb5d13f38389e5, 0xd3e82c51b5eb2a28,
+    0x0816fc908833b46c, 0x8cf0c07a1294b421, 0x570e10bb2f4c2a65,
+    0x3a0d61f9692489a8, 0xe1f3b13854fc17ec, 0x32c0182d5c6b8832,
+    0xe93ec8ec61b31676, 0x843db9ae27dbb5bb, 0x5fc3696f1a032bff,
+    0xdb25558580a42bb2, 0x00db8544bd7cb5f6, 0x6dd8f406fb14163b,
+    0xb62624c7c6cc887f, 0x4ea1a882c095f114, 0x955f7843fd4d6f50,
+    0xf85c0901bb25cc9d, 0x23a2d9c086fd52d9, 0xa744e52a1c5a5294,
+    0x7cba35eb2182ccd0, 0x11b944a967ea6f1d, 0xca4794685a32f159,
+    0x19743d7d52a56e87, 0xc28aedbc6f7df0c3, 0xaf899cfe2915530e,
+    0x74774c3f14cdcd4a, 0xf09170d58e6acd07, 0x2b6fa014b3b25343,
+    0x466cd156f5daf08e, 0x9d920197c8026eca, 0xb663c8ddf9680258,
+    0x6d9d181cc4b09c1c, 0x009e695e82d83fd1, 0xdb60b99fbf00a195,
+    0x5f86857525a7a1d8, 0x847855b4187f3f9c, 0xe97b24f65e179c51,
+    0x3285f43763cf0215, 0xe1b65d226b589dcb, 0x3a488de35680038f,
+    0x574bfca110e8a042, 0x8cb52c602d303e06, 0x0853108ab7973e4b,
+    0xd3adc04b8a4fa00f, 0xbeaeb109cc2703c2, 0x655061c8f1ff9d86,
+    0x9dd7ed8df7a6e4ed, 0x46293d4cca7e7aa9, 0x2b2a4c0e8c16d964,
+    0xf0d49ccfb1ce4720, 0x7432a0252b69476d, 0xafcc70e416b1d929,
+    0xc2cf01a650d97ae4, 0x1931d1676d01e4a0, 0xca02787265967b7e,
+    0x11fca8b3584ee53a, 0x7cffd9f11e2646f7, 0xa701093023fed8b3,
+    0x23e735dab959d8fe, 0xf819e51b848146ba, 0x951a9459c2e9e577,
+    0x4ee44498ff317b33},
+   {0x0000000000000000, 0x067d4f045fbe0e60, 0x0cfa9e08be7c1dc0,
+    0x0a87d10ce1c213a0, 0x9dea33be5756e212, 0x9b977cba08e8ec72,
+    0x9110adb6e92affd2, 0x976de2b2b694f1b2, 0x3ad5677cafacc425,
+    0x3ca82878f012ca45, 0x362ff97411d0d9e5, 0x3052b6704e6ed785,
+    0xa73f54c2f8fa2637, 0xa1421bc6a7442857, 0xabc5caca46863bf7,
+    0xadb885ce19383597, 0x74aacff85e59894b, 0x72d780fc01e7872b,
+    0x785051f0e025948b, 0x7e2d1ef4bf9b9aeb, 0xe940fc46090f6b59,
+    0xef3db34256b16539, 0xe5ba624eb7737699, 0xe3c72d4ae8cd78f9,
+    0x4e7fa884f1f54d6e, 0x4802e780ae4b430e, 0x4285368c4f8950ae,
+    0x44f8798810375ece, 0xd3959b3aa6a3af7c, 0xd5e8d43ef91da11c,
+    0xdf6f053218dfb2bc, 0xd9124a364761bcdc, 0xe8549ff1bdb21297,
+    0xee29d0f5e20c1cf7, 0xe4ae01f903ce0f57, 0xe2d34efd5c700137,
+    0x75beac4feae4f085, 0x73c3e34bb55afee5, 0x794432475498ed45,
+    0x7f397d430b26e325, 0xd281f88d121ed6b2, 0xd4fcb7894da0d8d2,
+    0xde7b6685ac62cb72, 0xd8062981f3dcc512, 0x4f6bcb33454834a0,
+    0x491684371af63ac0, 0x4391553bfb342960, 0x45ec1a3fa48a2700,
+    0x9cfe5009e3eb9bdc, 0x9a831f0dbc5595bc, 0x9004ce015d97861c,
+    0x967981050229887c, 0x011463b7b4bd79ce, 0x07692cb3eb0377ae,
+    0x0deefdbf0ac1640e, 0x0b93b2bb557f6a6e, 0xa62b37754c475ff9,
+    0xa056787113f95199, 0xaad1a97df23b4239, 0xacace679ad854c59,
+    0x3bc104cb1b11bdeb, 0x3dbc4bcf44afb38b, 0x373b9ac3a56da02b,
+    0x3146d5c7fad3ae4b, 0x55b7304c50cafdbc, 0x53ca7f480f74f3dc,
+    0x594dae44eeb6e07c, 0x5f30e140b108ee1c, 0xc85d03f2079c1fae,
+    0xce204cf6582211ce, 0xc4a79dfab9e0026e, 0xc2dad2fee65e0c0e,
+    0x6f625730ff663999, 0x691f1834a0d837f9, 0x6398c938411a2459,
+    0x65e5863c1ea42a39, 0xf288648ea830db8b, 0xf4f52b8af78ed5eb,
+    0xfe72fa86164cc64b, 0xf80fb58249f2c82b, 0x211dffb40e9374f7,
+    0x2760b0b0512d7a97, 0x2de761bcb0ef6937, 0x2b9a2eb8ef516757,
+    0xbcf7cc0a59c596e5, 0xba8a830e067b9885, 0xb00d5202e7b98b25,
+    0xb6701d06b8078545, 0x1bc898c8a13fb0d2, 0x1db5d7ccfe81beb2,
+    0x173206c01f43ad12, 0x114f49c440fda372, 0x8622ab76f66952c0,
+    0x805fe472a9d75ca0, 0x8ad8357e48154f00, 0x8ca57a7a17ab4160,
+    0xbde3afbded78ef2b, 0xbb9ee0b9b2c6e14b, 0xb11931b55304f2eb,
+    0xb7647eb10cbafc8b, 0x20099c03ba2e0d39, 0x2674d307e5900359,
+    0x2cf3020b045210f9, 0x2a8e4d0f5bec1e99, 0x8736c8c142d42b0e,
+    0x814b87c51d6a256e, 0x8bcc56c9fca836ce, 0x8db119cda31638ae,
+    0x1adcfb7f1582c91c, 0x1ca1b47b4a3cc77c, 0x16266577abfed4dc,
+    0x105b2a73f440dabc, 0xc9496045b3216660, 0xcf342f41ec9f6800,
+    0xc5b3fe4d0d5d7ba0, 0xc3ceb14952e375c0, 0x54a353fbe4778472,
+    0x52de1cffbbc98a12, 0x5859cdf35a0b99b2, 0x5e2482f705b597d2,
+    0xf39c07391c8da245, 0xf5e1483d4333ac25, 0xff669931a2f1bf85,
+    0xf91bd635fd4fb1e5, 0x6e7634874bdb4057, 0x680b7b8314654e37,
+    0x628caa8ff5a75d97, 0x64f1e58baa1953f7, 0x2f706f378b3b23eb,
+    0x290d2033d4852d8b, 0x238af13f35473e2b, 0x25f7be3b6af9304b,
+    0xb29a5c89dc6dc1f9, 0xb4e7138d83d3cf99, 0xbe60c2816211dc39,
+    0xb81d8d853dafd259, 0x15a5084b2497e7ce, 0x13d8474f7b29e9ae,
+    0x195f96439aebfa0e, 0x1f22d947c555f46e, 0x884f3bf573c105dc,
+    0x8e3274f12c7f0bbc, 0x84b5a5fdcdbd181c, 0x82c8eaf99203167c,
+    0x5bdaa0cfd562aaa0, 0x5da7efcb8adca4c0, 0x57203ec76b1eb760,
+    0x515d71c334a0b900, 0xc6309371823448b2, 0xc04ddc75dd8a46d2,
+    0xcaca0d793c485572, 0xccb7427d63f65b12, 0x610fc7b37ace6e85,
+    0x677288b7257060e5, 0x6df559bbc4b27345, 0x6b8816bf9b0c7d25,
+    0xfce5f40d2d988c97, 0xfa98bb09722682f7, 0xf01f6a0593e49157,
+    0xf6622501cc5a9f37, 0xc724f0c63689317c, 0xc159bfc269373f1c,
+    0xcbde6ece88f52cbc, 0xcda321cad74b22dc, 0x5acec37861dfd36e,
+    0x5cb38c7c3e61dd0e, 0x56345d70dfa3ceae, 0x50491274801dc0ce,
+    0xfdf197ba9925f559, 0xfb8cd8bec69bfb39, 0xf10b09b22759e899,
+    0xf77646b678e7e6f9, 0x601ba404ce73174b, 0x6666eb0091cd192b,
+    0x6ce13a0c700f0a8b, 0x6a9c75082fb104eb, 0xb38e3f3e68d0b837,
+    0xb5f3703a376eb657, 0xbf74a136d6aca5f7, 0xb909ee328912ab97,
+    0x2e640c803f865a25, 0x2819438460385445, 0x229e928881fa47e5,
+    0x24e3dd8cde444985, 0x895b5842c77c7c12, 0x8f26174698c27272,
+    0x85a1c64a790061d2, 0x83dc894e26be6fb2, 0x14b16bfc902a9e00,
+    0x12cc24f8cf949060, 0x184bf5f42e5683c0, 0x1e36baf071e88da0,
+    0x7ac75f7bdbf1de57, 0x7cba107f844fd037, 0x763dc173658dc397,
+    0x70408e773a33cdf7, 0xe72d6cc58ca73c45, 0xe15023c1d3193225,
+    0xebd7f2cd32db2185, 0xedaabdc96d652fe5, 0x40123807745d1a72,
+    0x466f77032be31412, 0x4ce8a60fca2107b2, 0x4a95e90b959f09d2,
+    0xddf80bb9230bf860, 0xdb8544bd7cb5f600, 0xd10295b19d77e5a0,
+    0xd77fdab5c2c9ebc0, 0x0e6d908385a8571c, 0x0810df87da16597c,
+    0x02970e8b3bd44adc, 0x04ea418f646a44bc, 0x9387a33dd2feb50e,
+    0x95faec398d40bb6e, 0x9f7d3d356c82a8ce, 0x99007231333ca6ae,
+    0x34b8f7ff2a049339, 0x32c5b8fb75ba9d59, 0x384269f794788ef9,
+    0x3e3f26f3cbc68099, 0xa952c4417d52712b, 0xaf2f8b4522ec7f4b,
+    0xa5a85a49c32e6ceb, 0xa3d5154d9c90628b, 0x9293c08a6643ccc0,
+    0x94ee8f8e39fdc2a0, 0x9e695e82d83fd100, 0x981411868781df60,
+    0x0f79f33431152ed2, 0x0904bc306eab20b2, 0x03836d3c8f693312,
+    0x05fe2238d0d73d72, 0xa846a7f6c9ef08e5, 0xae3be8f296510685,
+    0xa4bc39fe77931525, 0xa2c176fa282d1b45, 0x35ac94489eb9eaf7,
+    0x33d1db4cc107e497, 0x39560a4020c5f737, 0x3f2b45447f7bf957,
+    0xe6390f72381a458b, 0xe044407667a44beb, 0xeac3917a8666584b,
+    0xecbede7ed9d8562b, 0x7bd33ccc6f4ca799, 0x7dae73c830f2a9f9,
+    0x7729a2c4d130ba59, 0x7154edc08e8eb439, 0xdcec680e97b681ae,
+    0xda91270ac8088fce, 0xd016f60629ca9c6e, 0xd66bb9027674920e,
+    0x41065bb0c0e063bc, 0x477b14b49f5e6ddc, 0x4dfcc5b87e9c7e7c,
+    0x4b818abc2122701c},
+   {0x0000000000000000, 0x15b1cb086dfb348f, 0xaf7c99bef159b18c,
+    0xbacd52b69ca28503, 0xdbe73cd2c81cba8b, 0xce56f7daa5e78e04,
+    0x749ba56c39450b07, 0x612a6e6454be3f88, 0x33d1770bba96ac85,
+    0x2660bc03d76d980a, 0x9cadeeb54bcf1d09, 0x891c25bd26342986,
+    0xe8364bd9728a160e, 0xfd8780d11f712281, 0x474ad26783d3a782,
+    0x52fb196fee28930d, 0xe3bce1b95f828199, 0xf60d2ab13279b516,
+    0x4cc07807aedb3015, 0x5971b30fc320049a, 0x385bdd6b979e3b12,
+    0x2dea1663fa650f9d, 0x972744d566c78a9e, 0x82968fdd0b3cbe11,
+    0xd06d96b2e5142d1c, 0xc5dc5dba88ef1993, 0x7f110f0c144d9c90,
+    0x6aa0c40479b6a81f, 0x0b8aaa602d089797, 0x1e3b616840f3a318,
+    0xa4f633dedc51261b, 0xb147f8d6b1aa1294, 0x4367cddc94abdba1,
+    0x56d606d4f950ef2e, 0xec1b546265f26a2d, 0xf9aa9f6a08095ea2,
+    0x9880f10e5cb7612a, 0x8d313a06314c55a5, 0x37fc68b0adeed0a6,
+    0x224da3b8c015e429, 0x70b6bad72e3d7724, 0x650771df43c643ab,
+    0xdfca2369df64c6a8, 0xca7be861b29ff227, 0xab518605e621cdaf,
+    0xbee04d0d8bdaf920, 0x042d1fbb17787c23, 0x119cd4b37a8348ac,
+    0xa0db2c65cb295a38, 0xb56ae76da6d26eb7, 0x0fa7b5db3a70ebb4,
+    0x1a167ed3578bdf3b, 0x7b3c10b70335e0b3, 0x6e8ddbbf6eced43c,
+    0xd4408909f26c513f, 0xc1f142019f9765b0, 0x930a5b6e71bff6bd,
+    0x86bb90661c44c232, 0x3c76c2d080e64731, 0x29c709d8ed1d73be,
+    0x48ed67bcb9a34c36, 0x5d5cacb4d45878b9, 0xe791fe0248fafdba,
+    0xf220350a2501c935, 0x03d0941602f86fd1, 0x16615f1e6f035b5e,
+    0xacac0da8f3a1de5d, 0xb91dc6a09e5aead2, 0xd837a8c4cae4d55a,
+    0xcd8663cca71fe1d5, 0x774b317a3bbd64d6, 0x62fafa7256465059,
+    0x3001e31db86ec354, 0x25b02815d595f7db, 0x9f7d7aa3493772d8,
+    0x8accb1ab24cc4657, 0xebe6dfcf707279df, 0xfe5714c71d894d50,
+    0x449a4671812bc853, 0x512b8d79ecd0fcdc, 0xe06c75af5d7aee48,
+    0xf5ddbea73081dac7, 0x4f10ec11ac235fc4, 0x5aa12719c1d86b4b,
+    0x3b8b497d956654c3, 0x2e3a8275f89d604c, 0x94f7d0c3643fe54f,
+    0x81461bcb09c4d1c0, 0xd3bd02a4e7ec42cd, 0xc60cc9ac8a177642,
+    0x7cc19b1a16b5f341, 0x697050127b4ec7ce, 0x085a3e762ff0f846,
+    0x1debf57e420bccc9, 0xa726a7c8dea949ca, 0xb2976cc0b3527d45,
+    0x40b759ca9653b470, 0x550692c2fba880ff, 0xefcbc074670a05fc,
+    0xfa7a0b7c0af13173, 0x9b5065185e4f0efb, 0x8ee1ae1033b43a74,
+    0x342cfca6af16bf77, 0x219d37aec2ed8bf8, 0x73662ec12cc518f5,
+    0x66d7e5c9413e2c7a, 0xdc1ab77fdd9ca979, 0xc9ab7c77b0679df6,
+    0xa8811213e4d9a27e, 0xbd30d91b892296f1, 0x07fd8bad158013f2,
+    0x124c40a5787b277d, 0xa30bb873c9d135e9, 0xb6ba737ba42a0166,
+    0x0c7721cd38888465, 0x19c6eac55573b0ea, 0x78ec84a101cd8f62,
+    0x6d5d4fa96c36bbed, 0xd7901d1ff0943eee, 0xc221d6179d6f0a61,
+    0x90dacf787347996c, 0x856b04701ebcade3, 0x3fa656c6821e28e0,
+    0x2a179dceefe51c6f, 0x4b3df3aabb5b23e7, 0x5e8c38a2d6a01768,
+    0xe4416a144a02926b, 0xf1f0a11c27f9a6e4, 0x83be27822f5f0730,
+    0x960fec8a42a433bf, 0x2cc2be3cde06b6bc, 0x39737534b3fd8233,
+    0x58591b50e743bdbb, 0x4de8d0588ab88934, 0xf72582ee161a0c37,
+    0xe29449e67be138b8, 0xb06f508995c9abb5, 0xa5de9b81f8329f3a,
+    0x1f13c93764901a39, 0x0aa2023f096b2eb6, 0x6b886c5b5dd5113e,
+    0x7e39a753302e25b1, 0xc4f4f5e5ac8ca0b2, 0xd1453eedc177943d,
+    0x6002c63b70dd86a9, 0x75b30d331d26b226, 0xcf7e5f8581843725,
+    0xdacf948dec7f03aa, 0xbbe5fae9b8c13c22, 0xae5431e1d53a08ad,
+    0x1499635749988dae, 0x0128a85f2463b921, 0x53d3b130ca4b2a2c,
+    0x46627a38a7b01ea3, 0xfcaf288e3b129ba0, 0xe91ee38656e9af2f,
+    0x88348de2025790a7, 0x9d8546ea6faca428, 0x2748145cf30e212b,
+    0x32f9df549ef515a4, 0xc0d9ea5ebbf4dc91, 0xd5682156d60fe81e,
+    0x6fa573e04aad6d1d, 0x7a14b8e827565992, 0x1b3ed68c73e8661a,
+    0x0e8f1d841e135295, 0xb4424f3282b1d796, 0xa1f3843aef4ae319,
+    0xf3089d5501627014, 0xe6b9565d6c99449b, 0x5c7404ebf03bc198,
+    0x49c5cfe39dc0f517, 0x28efa187c97eca9f, 0x3d5e6a8fa485fe10,
+    0x8793383938277b13, 0x9222f33155dc4f9c, 0x23650be7e4765d08,
+    0x36d4c0ef898d6987, 0x8c199259152fec84, 0x99a8595178d4d80b,
+    0xf88237352c6ae783, 0xed33fc3d4191d30c, 0x57feae8bdd33560f,
+    0x424f6583b0c86280, 0x10b47cec5ee0f18d, 0x0505b7e4331bc502,
+    0xbfc8e552afb94001, 0xaa792e5ac242748e, 0xcb53403e96fc4b06,
+    0xdee28b36fb077f89, 0x642fd98067a5fa8a, 0x719e12880a5ece05,
+    0x806eb3942da768e1, 0x95df789c405c5c6e, 0x2f122a2adcfed96d,
+    0x3aa3e122b105ede2, 0x5b898f46e5bbd26a, 0x4e38444e8840e6e5,
+    0xf4f516f814e263e6, 0xe144ddf079195769, 0xb3bfc49f9731c464,
+    0xa60e0f97facaf0eb, 0x1cc35d21666875e8, 0x097296290b934167,
+    0x6858f84d5f2d7eef, 0x7de9334532d64a60, 0xc72461f3ae74cf63,
+    0xd295aafbc38ffbec, 0x63d2522d7225e978, 0x766399251fdeddf7,
+    0xccaecb93837c58f4, 0xd91f009bee876c7b, 0xb8356effba3953f3,
+    0xad84a5f7d7c2677c, 0x1749f7414b60e27f, 0x02f83c49269bd6f0,
+    0x50032526c8b345fd, 0x45b2ee2ea5487172, 0xff7fbc9839eaf471,
+    0xeace77905411c0fe, 0x8be419f400afff76, 0x9e55d2fc6d54cbf9,
+    0x2498804af1f64efa, 0x31294b429c0d7a75, 0xc3097e48b90cb340,
+    0xd6b8b540d4f787cf, 0x6c75e7f6485502cc, 0x79c42cfe25ae3643,
+    0x18ee429a711009cb, 0x0d5f89921ceb3d44, 0xb792db248049b847,
+    0xa223102cedb28cc8, 0xf0d80943039a1fc5, 0xe569c24b6e612b4a,
+    0x5fa490fdf2c3ae49, 0x4a155bf59f389ac6, 0x2b3f3591cb86a54e,
+    0x3e8efe99a67d91c1, 0x8443ac2f3adf14c2, 0x91f267275724204d,
+    0x20b59ff1e68e32d9, 0x350454f98b750656, 0x8fc9064f17d78355,
+    0x9a78cd477a2cb7da, 0xfb52a3232e928852, 0xeee3682b4369bcdd,
+    0x542e3a9ddfcb39de, 0x419ff195b2300d51, 0x1364e8fa5c189e5c,
+    0x06d523f231e3aad3, 0xbc187144ad412fd0, 0xa9a9ba4cc0ba1b5f,
+    0xc883d428940424d7, 0xdd321f20f9ff1058, 0x67ff4d96655d955b,
+    0x724e869e08a6a1d4},
+   {0x0000000000000000, 0xa4ac13c0f91aeab5, 0xcd47292fd89a0cf9,
+    0x69eb3aef2180e64c, 0x1f915cf19b9ac160, 0xbb3d4f3162802bd5,
+    0xd2d675de4300cd99, 0x767a661eba1a272c, 0x3e22b9e2373583c1,
+    0x9a8eaa22ce2f6974, 0xf36590cdefaf8f38, 0x57c9830d16b5658d,
+    0x21b3e513acaf42a1, 0x851ff6d355b5a814, 0xecf4cc3c74354e58,
+    0x4858dffc8d2fa4ed, 0xf95a7c6a44c5de11, 0x5df66faabddf34a4,
+    0x341d55459c5fd2e8, 0x90b146856545385d, 0xe6cb209bdf5f1f71,
+    0x4267335b2645f5c4, 0x2b8c09b407c51388, 0x8f201a74fedff93d,
+    0xc778c58873f05dd0, 0x63d4d6488aeab765, 0x0a3feca7ab6a5129,
+    0xae93ff675270bb9c, 0xd8e99979e86a9cb0, 0x7c458ab911707605,
+    0x15aeb05630f09049, 0xb102a396c9ea7afc, 0xf2b5f8d4888abd23,
+    0x5619eb1471905796, 0x3ff2d1fb5010b1da, 0x9b5ec23ba90a5b6f,
+    0xed24a42513107c43, 0x4988b7e5ea0a96f6, 0x20638d0acb8a70ba,
+    0x84cf9eca32909a0f, 0xcc974136bfbf3ee2, 0x683b52f646a5d457,
+    0x01d068196725321b, 0xa57c7bd99e3fd8ae, 0xd3061dc72425ff82,
+    0x77aa0e07dd3f1537, 0x1e4134e8fcbff37b, 0xbaed272805a519ce,
+    0x0bef84becc4f6332, 0xaf43977e35558987, 0xc6a8ad9114d56fcb,
+    0x6204be51edcf857e, 0x147ed84f57d5a252, 0xb0d2cb8faecf48e7,
+    0xd939f1608f4faeab, 0x7d95e2a07655441e, 0x35cd3d5cfb7ae0f3,
+    0x91612e9c02600a46, 0xf88a147323e0ec0a, 0x5c2607b3dafa06bf,
+    0x2a5c61ad60e02193, 0x8ef0726d99facb26, 0xe71b4882b87a2d6a,
+    0x43b75b424160c7df, 0xe46bf1a911157b47, 0x40c7e269e80f91f2,
+    0x292cd886c98f77be, 0x8d80cb4630959d0b, 0xfbfaad588a8fba27,
+    0x5f56be9873955092, 0x36bd84775215b6de, 0x921197b7ab0f5c6b,
+    0xda49484b2620f886, 0x7ee55b8bdf3a1233, 0x170e6164febaf47f,
+    0xb3a272a407a01eca, 0xc5d814babdba39e6, 0x6174077a44a0d353,
+    0x089f3d956520351f, 0xac332e559c3adfaa, 0x1d318dc355d0a556,
+    0xb99d9e03acca4fe3, 0xd076a4ec8d4aa9af, 0x74dab72c7450431a,
+    0x02a0d132ce4a6436, 0xa60cc2f237508e83, 0xcfe7f81d16d068cf,
+    0x6b4bebddefca827a, 0x2313342162e52697, 0x87bf27e19bffcc22,
+    0xee541d0eba7f2a6e, 0x4af80ece4365c0db, 0x3c8268d0f97fe7f7,
+    0x982e7b1000650d42, 0xf1c541ff21e5eb0e, 0x5569523fd8ff01bb,
+    0x16de097d999fc664, 0xb2721abd60852cd1, 0xdb9920524105ca9d,
+    0x7f353392b81f2028, 0x094f558c02050704, 0xade3464cfb1fedb1,
+    0xc4087ca3da9f0bfd, 0x60a46f632385e148, 0x28fcb09faeaa45a5,
+    0x8c50a35f57b0af10, 0xe5bb99b07630495c, 0x41178a708f2aa3e9,
+    0x376dec6e353084c5, 0x93c1ffaecc2a6e70, 0xfa2ac541edaa883c,
+    0x5e86d68114b06289, 0xef847517dd5a1875, 0x4b2866d72440f2c0,
+    0x22c35c3805c0148c, 0x866f4ff8fcdafe39, 0xf01529e646c0d915,
+    0x54b93a26bfda33a0, 0x3d5200c99e5ad5ec, 0x99fe130967403f59,
+    0xd1a6ccf5ea6f9bb4, 0x750adf3513757101, 0x1ce1e5da32f5974d,
+    0xb84df61acbef7df8, 0xce37900471f55ad4, 0x6a9b83c488efb061,
+    0x0370b92ba96f562d, 0xa7dcaaeb5075bc98, 0xc8d7e253232af68e,
+    0x6c7bf193da301c3b, 0x0590cb7cfbb0fa77, 0xa13cd8bc02aa10c2,
+    0xd746bea2b8b037ee, 0x73eaad6241aadd5b, 0x1a01978d602a3b17,
+    0xbead844d9930d1a2, 0xf6f55bb1141f754f, 0x52594871ed059ffa,
+    0x3bb2729ecc8579b6, 0x9f1e615e359f9303, 0xe96407408f85b42f,
+    0x4dc81480769f5e9a, 0x24232e6f571fb8d6, 0x808f3dafae055263,
+    0x318d9e3967ef289f, 0x95218df99ef5c22a, 0xfccab716bf752466,
+    0x5866a4d6466fced3, 0x2e1cc2c8fc75e9ff, 0x8ab0d108056f034a,
+    0xe35bebe724efe506, 0x47f7f827ddf50fb3, 0x0faf27db50daab5e,
+    0xab03341ba9c041eb, 0xc2e80ef48840a7a7, 0x66441d34715a4d12,
+    0x103e7b2acb406a3e, 0xb49268ea325a808b, 0xdd79520513da66c7,
+    0x79d541c5eac08c72, 0x3a621a87aba04bad, 0x9ece094752baa118,
+    0xf72533a8733a4754, 0x538920688a20ade1, 0x25f34676303a8acd,
+    0x815f55b6c9206078, 0xe8b46f59e8a08634, 0x4c187c9911ba6c81,
+    0x0440a3659c95c86c, 0xa0ecb0a5658f22d9, 0xc9078a4a440fc495,
+    0x6dab998abd152e20, 0x1bd1ff94070f090c, 0xbf7dec54fe15e3b9,
+    0xd696d6bbdf9505f5, 0x723ac57b268fef40, 0xc33866edef6595bc,
+    0x6794752d167f7f09, 0x0e7f4fc237ff9945, 0xaad35c02cee573f0,
+    0xdca93a1c74ff54dc, 0x780529dc8de5be69, 0x11ee1333ac655825,
+    0xb54200f3557fb290, 0xfd1adf0fd850167d, 0x59b6cccf214afcc8,
+    0x305df62000ca1a84, 0x94f1e5e0f9d0f031, 0xe28b83fe43cad71d,
+    0x4627903ebad03da8, 0x2fccaad19b50dbe4, 0x8b60b911624a3151,
+    0x2cbc13fa323f8dc9, 0x8810003acb25677c, 0xe1fb3ad5eaa58130,
+    0x4557291513bf6b85, 0x332d4f0ba9a54ca9, 0x97815ccb50bfa61c,
+    0xfe6a6624713f4050, 0x5ac675e48825aae5, 0x129eaa18050a0e08,
+    0xb632b9d8fc10e4bd, 0xdfd98337dd9002f1, 0x7b7590f7248ae844,
+    0x0d0ff6e99e90cf68, 0xa9a3e529678a25dd, 0xc048dfc6460ac391,
+    0x64e4cc06bf102924, 0xd5e66f9076fa53d8, 0x714a7c508fe0b96d,
+    0x18a146bfae605f21, 0xbc0d557f577ab594, 0xca773361ed6092b8,
+    0x6edb20a1147a780d, 0x07301a4e35fa9e41, 0xa39c098ecce074f4,
+    0xebc4d67241cfd019, 0x4f68c5b2b8d53aac, 0x2683ff5d9955dce0,
+    0x822fec9d604f3655, 0xf4558a83da551179, 0x50f99943234ffbcc,
+    0x3912a3ac02cf1d80, 0x9dbeb06cfbd5f735, 0xde09eb2ebab530ea,
+    0x7aa5f8ee43afda5f, 0x134ec201622f3c13, 0xb7e2d1c19b35d6a6,
+    0xc198b7df212ff18a, 0x6534a41fd8351b3f, 0x0cdf9ef0f9b5fd73,
+    0xa8738d3000af17c6, 0xe02b52cc8d80b32b, 0x4487410c749a599e,
+    0x2d6c7be3551abfd2, 0x89c06823ac005567, 0xffba0e3d161a724b,
+    0x5b161dfdef0098fe, 0x32fd2712ce807eb2, 0x965134d2379a9407,
+    0x27539744fe70eefb, 0x83ff8484076a044e, 0xea14be6b26eae202,
+    0x4eb8adabdff008b7, 0x38c2cbb565ea2f9b, 0x9c6ed8759cf0c52e,
+    0xf585e29abd702362, 0x5129f15a446ac9d7, 0x19712ea6c9456d3a,
+    0xbddd3d66305f878f, 0xd436078911df61c3, 0x709a1449e8c58b76,
+    0x06e0725752dfac5a, 0xa24c6197abc546ef, 0xcba75b788a45a0a3,
+    0x6f0b48b8735f4a16}};
+
+#endif /* N == 6 */
+
+#endif /* W */
+
+static const uint64_t crc64_x2n_table[] = {
+    0x4000000000000000, 0x2000000000000000, 0x0800000000000000,
+    0x0080000000000000, 0x0000800000000000, 0x0000000080000000,
+    0xc96c5795d7870f42, 0x6d5f4ad7e3c3afa0, 0xd49f7e445077d8ea,
+    0x040fb02a53c216fa, 0x6bec35957b9ef3a0, 0xb0e3bb0658964afe,
+    0x218578c7a2dff638, 0x6dbb920f24dd5cf2, 0x7a140cfcdb4d5eb5,
+    0x41b3705ecbc4057b, 0xd46ab656accac1ea, 0x329beda6fc34fb73,
+    0x51a4fcd4350b9797, 0x314fa85637efae9d, 0xacf27e9a1518d512,
+    0xffe2a3388a4d8ce7, 0x48b9697e60cc2e4e, 0xada73cb78dd62460,
+    0x3ea5454d8ce5c1bb, 0x5e84e3a6c70feaf1, 0x90fd49b66cbd81d1,
+    0xe2943e0c1db254e8, 0xecfa6adeca8834a1, 0xf513e212593ee321,
+    0xf36ae57331040916, 0x63fbd333b87b6717, 0xbd60f8e152f50b8b,
+    0xa5ce4a8299c1567d, 0x0bd445f0cbdb55ee, 0xfdd6824e20134285,
+    0xcead8b6ebda2227a, 0xe44b17e4f5d4fb5c, 0x9b29c81ad01ca7c5,
+    0x1b4366e40fea4055, 0x27bca1551aae167b, 0xaa57bcd1b39a5690,
+    0xd7fce83fa1234db9, 0xcce4986efea3ff8e, 0x3602a4d9e65341f1,
+    0x722b1da2df516145, 0xecfc3ddd3a08da83, 0x0fb96dcca83507e6,
+    0x125f2fe78d70f080, 0x842f50b7651aa516, 0x09bc34188cd9836f,
+    0xf43666c84196d909, 0xb56feb30c0df6ccb, 0xaa66e04ce7f30958,
+    0xb7b1187e9af29547, 0x113255f8476495de, 0x8fb19f783095d77e,
+    0xaec4aacc7c82b133, 0xf64e6d09218428cf, 0x036a72ea5ac258a0,
+    0x5235ef12eb7aaa6a, 0x2fed7b1685657853, 0x8ef8951d46606fb5,
+    0x9d58c1090f034d14, 0x36f6c59a9fdaa97b, 0xbe2d517d98682592};
+
+#endif /* CRC64_BRAID_TBL_H_ */
@@ -81,28 +81,48 @@ const char PREFIX(deflate_copyright)[] = " deflate 1.3.1 Copyright 1995-2024 Jea
 #  define HINT_ALIGNED_WINDOW   HINT_ALIGNED_64
 /* Adjust the window size for the arch-specific deflate code. */
 #  define DEFLATE_ADJUST_WINDOW_SIZE(n) (n)
+#  ifndef ZLIB_COMPAT
+#    include "offload_deflate.h"
+#  else
 /* Invoked at the beginning of deflateSetDictionary(). Useful for checking arch-specific window data. */
-#  define DEFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
+#    define DEFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
 /* Invoked at the beginning of deflateGetDictionary(). Useful for adjusting arch-specific window data. */
-#  define DEFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
+#    define DEFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
 /* Invoked at the end of deflateResetKeep(). Useful for initializing arch-specific extension blocks. */
-#  define DEFLATE_RESET_KEEP_HOOK(strm) do {} while (0)
+#    define DEFLATE_RESET_KEEP_HOOK(strm) do {} while (0)
 /* Invoked at the beginning of deflateParams(). Useful for updating arch-specific compression parameters. */
-#  define DEFLATE_PARAMS_HOOK(strm, level, strategy, hook_flush) do {} while (0)
+#    define DEFLATE_PARAMS_HOOK(strm, level, strategy, hook_flush) do {} while (0)
 /* Returns whether the last deflate(flush) operation did everything it's supposed to do. */
-#  define DEFLATE_DONE(strm, flush) 1
+#    define DEFLATE_DONE(strm, flush) 1
 /* Adjusts the upper bound on compressed data length based on compression parameters and uncompressed data length.
  * Useful when arch-specific deflation code behaves differently than regular zlib-ng algorithms. */
-#  define DEFLATE_BOUND_ADJUST_COMPLEN(strm, complen, sourceLen) do {} while (0)
+#    define DEFLATE_BOUND_ADJUST_COMPLEN(strm, complen, sourceLen) do {} while (0)
 /* Returns whether an optimistic upper bound on compressed data length should *not* be used.
  * Useful when arch-specific deflation code behaves differently than regular zlib-ng algorithms. */
-#  define DEFLATE_NEED_CONSERVATIVE_BOUND(strm) 0
+#    define DEFLATE_NEED_CONSERVATIVE_BOUND(strm) 0
 /* Invoked for each deflate() call. Useful for plugging arch-specific deflation code. */
-#  define DEFLATE_HOOK(strm, flush, bstate) 0
+#    define DEFLATE_HOOK(strm, flush, bstate) 0
 /* Returns whether zlib-ng should compute a checksum. Set to 0 if arch-specific deflation code already does that. */
-#  define DEFLATE_NEED_CHECKSUM(strm) 1
+#    define DEFLATE_NEED_CHECKSUM(strm) 1
 /* Returns whether reproducibility parameter can be set to a given value. */
-#  define DEFLATE_CAN_SET_REPRODUCIBLE(strm, reproducible) 1
+#    define DEFLATE_CAN_SET_REPRODUCIBLE(strm, reproducible) 1
+#  endif
+#endif
+/* Invoked at the beginning of deflatePrime(). Useful for rejecting streams with arch-specific bit buffers. */
+#ifndef DEFLATE_PRIME_HOOK
+#  define DEFLATE_PRIME_HOOK(strm, bits, value) do {} while (0)
+#endif
+/* Invoked at the beginning of deflateCopy(). Useful for rejecting streams with arch-specific state that can't be copied. */
+#ifndef DEFLATE_COPY_HOOK
+#  define DEFLATE_COPY_HOOK(strm) do {} while (0)
+#endif
+/* Invoked at the beginning of deflateEnd(). Useful for releasing arch-specific resources. */
+#ifndef DEFLATE_END_HOOK
+#  define DEFLATE_END_HOOK(strm) do {} while (0)
+#endif
+/* Returns whether arch-specific deflation code failed in a way that makes the stream unusable. */
+#ifndef DEFLATE_FAILED
+#  define DEFLATE_FAILED(strm) 0
 #endif
 
 /* ===========================================================================
@@ -111,15 +131,18 @@ const char PREFIX(deflate_copyright)[] = " deflate 1.3.1 Copyright 1995-2024 Jea
 static int deflateStateCheck      (PREFIX3(stream) *strm);
 Z_INTERNAL block_state deflate_stored(deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_fast  (deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_filtered(deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_quick (deflate_state *s, int flush);
 #ifndef NO_MEDIUM_STRATEGY
 Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush);
 #endif
 Z_INTERNAL block_state deflate_slow  (deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_rle   (deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_stride(deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_huff  (deflate_state *s, int flush);
 static void lm_set_level         (deflate_state *s, int level);
 static void lm_init              (deflate_state *s);
+static void lm_init_keep         (deflate_state *s);
 Z_INTERNAL unsigned read_buf  (PREFIX3(stream) *strm, unsigned char *buf, unsigned size);
 
 /* ===========================================================================
@@ -175,6 +198,30 @@ static const config configuration_table[10] = {
 /* rank Z_BLOCK between Z_NO_FLUSH and Z_PARTIAL_FLUSH */
 #define RANK(f) (((f) * 2) - ((f) > 4 ? 9 : 0))
 
+/* In rsyncable mode, s->rsyncable is log2 of the spacing of the flush points.
+ * A flush point follows at least a quarter of the spacing after the previous
+ * one, where the top s->rsyncable bits of the rolling hash are zero.
+ */
+#define RSYNC_DEFAULT_BITS 15
+#define RSYNC_MIN_BITS     12
+#define RSYNC_MAX_BITS     20
+#define RSYNC_MIN_LEN(s)   (1u << ((s)->rsyncable - 2))
+/* Upper bound on the bytes added by one flush point: the empty stored block and
+ * the header and end of block of the block that follows it.
+ */
+#define RSYNC_FLUSH_OVERHEAD (5 + DEFLATE_BLOCK_OVERHEAD)
+
+/* Z_DEFLATE_TARGET_MBPS measures the throughput of every ADAPT_WINDOW bytes of
+ * input, and goes up a level when it is over ADAPT_UP_MARGIN times the target.
+ */
+#define ADAPT_WINDOW          (256 * 1024)
+#define ADAPT_UP_MARGIN_NUM   3
+#define ADAPT_UP_MARGIN_DEN   2
+
+/* deflateResetLazy() clears the buckets of the strings instead of the whole
+ * hash table if there are at most HASH_SIZE / LAZY_CLEAR_RATIO of them.
+ */
+#define LAZY_CLEAR_RATIO      16
 
 /* ===========================================================================
  * Initialize the hash table. prev[] will be initialized on the fly.
@@ -314,8 +361,8 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
         windowBits -= 16;
 #endif
     }
-    if (memLevel < 1 || memLevel > MAX_MEM_LEVEL || method != Z_DEFLATED || windowBits < MIN_WBITS ||
-        windowBits > MAX_WBITS || level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED ||
+    if (memLevel < 1 || memLevel > MAX_LARGE_MEM_LEVEL || method != Z_DEFLATED || windowBits < MIN_WBITS ||
+        windowBits > MAX_WBITS || level < 0 || level > 9 || strategy < 0 || strategy > MAX_STRATEGY ||
         (windowBits == 8 && wrap != 1)) {
         return Z_STREAM_ERROR;
     }
@@ -338,6 +385,9 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
     strm->state = (struct internal_state *)s;
     s->strm = strm;
     s->status = INIT_STATE;     /* to pass state test in deflateReset() */
+#ifndef ZLIB_COMPAT
+    offload_init(&s->offload);
+#endif
 
     s->wrap = wrap;
     s->gzhead = NULL;
@@ -370,7 +420,7 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
      * 8*n bits into pending_buf. (Note that the symbol buffer fills when n-1
      * symbols are written.) The closest the writing gets to what is unread is
      * then n+14 bits. Here n is lit_bufsize, which is 16384 by default, and
-     * can range from 128 to 32768.
+     * can range from 128 to 32768, or to 262144 in the large-block mode.
      *
      * Therefore, at a minimum, there are 142 bits of space between what is
      * written and what is read in the overlain buffers, so the symbols cannot
@@ -414,6 +464,13 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
     s->strategy = strategy;
     s->block_open = 0;
     s->reproducible = 0;
+    s->rsyncable = 0;
+    s->latency_bytes = 0;
+    s->latency_usec = 0;
+    s->clock = zng_clock_usec;
+    s->adapt_mbps = 0;
+    s->trial_parses = 0;
+    s->trial_skip = 0;
 
     return PREFIX(deflateReset)(strm);
 }
@@ -561,6 +618,19 @@ int32_t Z_EXPORT PREFIX(deflateResetKeep)(PREFIX3(stream) *strm) {
 #endif
         strm->adler = ADLER32_INITIAL_VALUE;
     s->last_flush = -2;
+    s->rsync_hash = 0;
+    s->rsync_run = 0;
+    s->rsync_todo = 0;
+    s->rsync_flush = 0;
+    s->latency_mark = 0;
+    s->latency_start = 0;
+    s->adapt_bytes = 0;
+    s->adapt_usec = 0;
+    s->stride = 0;
+    s->stride_next = 0;
+    s->row_dist = 0;
+    s->row_votes = 0;
+    s->trial_flushed = 0;
 
     zng_tr_init(s);
 
@@ -577,6 +647,49 @@ int32_t Z_EXPORT PREFIX(deflateReset)(PREFIX3(stream) *strm) {
     return ret;
 }
 
+/* ===========================================================================
+ * Same as deflateReset(), but for a stream that was compressed with the same
+ * level all along, the hash table is cleared lazily. If the input fit in the
+ * window, was not preceded by a dictionary, and was hashed with the integer
+ * hash, whose buckets only depend on the four bytes of each string, then only
+ * the buckets of the strings of the input can be set. For short inputs it is
+ * cheaper to clear these than the whole table.
+ */
+int32_t Z_INTERNAL PREFIX(deflateResetLazy)(PREFIX3(stream) *strm) {
+    deflate_state *s;
+    uint32_t end, str, val;
+    int ret;
+
+    if (deflateStateCheck(strm))
+        return Z_STREAM_ERROR;
+    s = strm->state;
+    end = s->strstart + s->lookahead;
+    if (s->update_hash != update_hash || strm->total_in != end || end > s->w_size || end > HASH_SIZE / LAZY_CLEAR_RATIO)
+        return PREFIX(deflateReset)(strm);
+
+    for (str = 0; str < end; str++) {
+        memcpy(&val, s->window + str, sizeof(val));
+#if BYTE_ORDER == BIG_ENDIAN
+        val = ZSWAP32(val);
+#endif
+        s->head[update_hash(0, val)] = 0;
+    }
+#ifdef ZLIB_DEBUG
+    for (str = 0; str < HASH_SIZE; str++)
+        Assert(s->head[str] == 0, "hash entry left by deflateResetLazy");
+#endif
+
+    ret = PREFIX(deflateResetKeep)(strm);
+    if (ret == Z_OK) {
+        lm_init_keep(s);
+        /* The match routines look past the end of the input, at the bytes that fill_window() zeroes the first time
+         * it reaches them. The streams reset here are reused for unrelated inputs, so have it zero them again, as
+         * for a new stream, rather than leave the last input there. */
+        s->high_water = 0;
+    }
+    return ret;
+}
+
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflateSetHeader)(PREFIX3(stream) *strm, PREFIX(gz_headerp) head) {
     if (deflateStateCheck(strm) || strm->state->wrap != 2)
@@ -606,6 +719,8 @@ int32_t Z_EXPORT PREFIX(deflatePrime)(PREFIX3(stream) *strm, int32_t bits, int32
         return Z_STREAM_ERROR;
     s = strm->state;
 
+    DEFLATE_PRIME_HOOK(strm, bits, value);  /* hook for offload providers */
+
 #ifdef LIT_MEM
     if (bits < 0 || bits > BIT_BUF_SIZE ||
         (unsigned char *)s->d_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
@@ -644,7 +759,7 @@ int32_t Z_EXPORT PREFIX(deflateParams)(PREFIX3(stream) *strm, int32_t level, int
 
     if (level == Z_DEFAULT_COMPRESSION)
         level = 6;
-    if (level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED)
+    if (level < 0 || level > 9 || strategy < 0 || strategy > MAX_STRATEGY)
         return Z_STREAM_ERROR;
     DEFLATE_PARAMS_HOOK(strm, level, strategy, &hook_flush);  /* hook for IBM Z DFLTCC */
     func = configuration_table[s->level].func;
@@ -708,7 +823,7 @@ int32_t Z_EXPORT PREFIX(deflateTune)(PREFIX3(stream) *strm, int32_t good_length,
  */
 unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long sourceLen) {
     deflate_state *s;
-    unsigned long complen, wraplen;
+    unsigned long complen, wraplen, flushlen;
 
     /* conservative upper bound for compressed data */
     complen = sourceLen + ((sourceLen + 7) >> 3) + ((sourceLen + 63) >> 6) + 5;
@@ -756,6 +871,9 @@ unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long
         wraplen = ZLIB_WRAPLEN;
     }
 
+    /* add the flushes of rsyncable mode */
+    flushlen = s->rsyncable ? (sourceLen / RSYNC_MIN_LEN(s)) * RSYNC_FLUSH_OVERHEAD : 0;
+
     /* if not default parameters, return conservative bound */
     if (DEFLATE_NEED_CONSERVATIVE_BOUND(strm) ||  /* hook for IBM Z DFLTCC */
             s->w_bits != MAX_WBITS || HASH_BITS < 15) {
@@ -765,7 +883,7 @@ unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long
             complen = sourceLen + (sourceLen >> 5) + (sourceLen >> 7) + (sourceLen >> 11) + 7;
         }
 
-        return complen + wraplen;
+        return complen + wraplen + flushlen;
     }
 
 #ifndef NO_QUICK_STRATEGY
@@ -774,9 +892,10 @@ unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long
       + (sourceLen < 9 ? 1 : 0)            /* One extra byte for lengths less than 9 */
       + DEFLATE_QUICK_OVERHEAD(sourceLen)  /* Source encoding overhead, padded to next full byte */
       + DEFLATE_BLOCK_OVERHEAD             /* Deflate block overhead bytes */
-      + wraplen;                           /* none, zlib or gzip wrapper */
+      + wraplen                            /* none, zlib or gzip wrapper */
+      + flushlen;                          /* rsyncable flush points */
 #else
-    return sourceLen + (sourceLen >> 4) + 7 + wraplen;
+    return sourceLen + (sourceLen >> 4) + 7 + wraplen + flushlen;
 #endif
 }
 
@@ -816,7 +935,7 @@ Z_INTERNAL void PREFIX(flush_pending)(PREFIX3(stream) *strm) {
     } while (0)
 
 /* ========================================================================= */
-int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
+static int32_t deflate_stream(PREFIX3(stream) *strm, int32_t flush) {
     int32_t old_flush; /* value of flush param for previous deflate call */
     deflate_state *s;
 
@@ -831,6 +950,8 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     if (strm->avail_out == 0) {
         ERR_RETURN(strm, Z_BUF_ERROR);
     }
+    if (DEFLATE_FAILED(strm))  /* hook for offload providers */
+        return Z_STREAM_ERROR;
 
     old_flush = s->last_flush;
     s->last_flush = flush;
@@ -870,7 +991,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
         unsigned int header = (Z_DEFLATED + ((s->w_bits-8)<<4)) << 8;
         unsigned int level_flags;
 
-        if (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2)
+        if ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy <= Z_FIXED) || s->level < 2)
             level_flags = 0;
         else if (s->level < 6)
             level_flags = 1;
@@ -909,7 +1030,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
             put_uint32(s, 0);
             put_byte(s, 0);
             put_byte(s, s->level == 9 ? 2 :
-                     (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ? 4 : 0));
+                     ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy <= Z_FIXED) || s->level < 2 ? 4 : 0));
             put_byte(s, OS_CODE);
             s->status = BUSY_STATE;
 
@@ -927,7 +1048,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
                      (s->gzhead->comment == NULL ? 0 : 16)
                      );
             put_uint32(s, s->gzhead->time);
-            put_byte(s, s->level == 9 ? 2 : (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ? 4 : 0));
+            put_byte(s, s->level == 9 ? 2 : ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy <= Z_FIXED) || s->level < 2 ? 4 : 0));
             put_byte(s, s->gzhead->os & 0xff);
             if (s->gzhead->extra != NULL)
                 put_short(s, (uint16_t)s->gzhead->extra_len);
@@ -1040,6 +1161,10 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
                  s->level == 0 ? deflate_stored(s, flush) :
                  s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
                  s->strategy == Z_RLE ? deflate_rle(s, flush) :
+                 s->strategy == Z_FILTERED && s->level > 1 ? deflate_filtered(s, flush) :
+#ifndef ZLIB_COMPAT
+                 s->strategy == Z_STRIDED && s->level > 1 ? deflate_stride(s, flush) :
+#endif
                  (*(configuration_table[s->level].func))(s, flush);
 
         if (bstate == finish_started || bstate == finish_done) {
@@ -1059,6 +1184,11 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
              */
         }
         if (bstate == block_done) {
+            if (flush != Z_BLOCK) {
+                /* All input so far can be decoded from the output */
+                s->latency_mark = strm->total_in;
+                s->latency_start = 0;
+            }
             if (flush == Z_PARTIAL_FLUSH) {
                 zng_tr_align(s);
             } else if (flush != Z_BLOCK) { /* FULL_FLUSH or SYNC_FLUSH */
@@ -1068,6 +1198,8 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
                  */
                 if (flush == Z_FULL_FLUSH) {
                     CLEAR_HASH(s);             /* forget history */
+                    s->rsync_flush = 0;
+                    s->trial_flushed = 1;
                     if (s->lookahead == 0) {
                         s->strstart = 0;
                         s->block_start = 0;
@@ -1112,6 +1244,204 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     return Z_OK;
 }
 
+/* ===========================================================================
+ * Scan up to len bytes of input for the next rsyncable flush point. Returns
+ * the number of bytes up to and including the flush point, or len if there is
+ * none, in which case the scan continues with the next input.
+ *
+ * The hash is the shift-xor rolling hash of insert_string_roll.c widened to 32
+ * bits, with every byte spread over the word so that the top bits depend on
+ * all of the last 32 bytes. Flush points thus only depend on the nearby input.
+ */
+static uint32_t rsync_scan(deflate_state *s, const uint8_t *buf, uint32_t len) {
+    uint32_t min_len = RSYNC_MIN_LEN(s);
+    uint32_t shift = 32 - s->rsyncable;
+    uint32_t hash = s->rsync_hash;
+    uint32_t run = s->rsync_run;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        hash = (hash << 1) ^ ((buf[i] + 1u) * 0x9E3779B1u);
+        if (++run >= min_len && (hash >> shift) == 0) {
+            s->rsync_flush = 1;
+            run = 0;
+            i++;
+            break;
+        }
+    }
+    s->rsync_hash = hash;
+    s->rsync_run = run;
+    return i;
+}
+
+/* ===========================================================================
+ * deflate() in rsyncable mode: the input is split at the flush points found by
+ * rsync_scan(), and each piece ends with a full flush. As the compressed data
+ * after a full flush only depends on the input that follows it, a local change
+ * of the input only changes the output up to the next flush point.
+ */
+static int32_t deflate_rsyncable(PREFIX3(stream) *strm, int32_t flush) {
+    deflate_state *s = strm->state;
+    int32_t sub_flush, ret;
+    uint32_t rest;
+
+    for (;;) {
+        if (s->rsync_todo == 0 && !s->rsync_flush && strm->avail_in != 0)
+            s->rsync_todo = rsync_scan(s, strm->next_in, strm->avail_in);
+
+        /* Hold back the input after the next flush point */
+        sub_flush = flush;
+        if (s->rsync_flush)
+            sub_flush = s->rsync_todo != 0 ? Z_NO_FLUSH : Z_FULL_FLUSH;
+        rest = strm->avail_in - s->rsync_todo;
+        strm->avail_in = s->rsync_todo;
+        ret = deflate_stream(strm, sub_flush);
+        s->rsync_todo = strm->avail_in;
+        strm->avail_in += rest;
+
+        if (ret != Z_OK || strm->avail_out == 0)
+            return ret;
+        /* Done once all input is taken and the flush asked for is done, which
+         * a full flush also does for anything but Z_FINISH */
+        if (strm->avail_in == 0 && (sub_flush == flush || flush == Z_NO_FLUSH ||
+                                    (sub_flush == Z_FULL_FLUSH && flush != Z_FINISH)))
+            return ret;
+    }
+}
+
+static int32_t deflate_input(PREFIX3(stream) *strm, int32_t flush) {
+    if (strm->state->rsyncable)
+        return deflate_rsyncable(strm, flush);
+    return deflate_stream(strm, flush);
+}
+
+/* ===========================================================================
+ * Whether the input that can not yet be decoded from the output is over the
+ * byte or time budget. The time is counted from the first deflate() call that
+ * left such input behind.
+ */
+static int latency_due(PREFIX3(stream) *strm) {
+    deflate_state *s = strm->state;
+    size_t held = (size_t)strm->total_in - s->latency_mark;
+    uint64_t now;
+
+    if (held == 0)
+        return 0;
+    if (s->latency_bytes != 0 && held >= s->latency_bytes)
+        return 1;
+    if (s->latency_usec != 0) {
+        now = s->clock();
+        if (s->latency_start == 0)
+            s->latency_start = now;
+        return now - s->latency_start >= s->latency_usec;
+    }
+    return 0;
+}
+
+/* ===========================================================================
+ * deflate() with a latency budget: Z_NO_FLUSH calls end with a partial flush
+ * once the buffered input is over budget, so that the caller does not need to
+ * flush every message and the blocks stay as long as the budget allows. A call
+ * with no input only checks the budget.
+ */
+static int32_t deflate_latency(PREFIX3(stream) *strm, int32_t flush) {
+    deflate_state *s = strm->state;
+    int32_t ret;
+
+    if (flush != Z_NO_FLUSH || s->status == FINISH_STATE)
+        return deflate_input(strm, flush);
+
+    if (strm->avail_in != 0 || s->pending != 0) {
+        ret = deflate_input(strm, Z_NO_FLUSH);
+        if (ret != Z_OK || strm->avail_in != 0 || strm->avail_out == 0 || !latency_due(strm))
+            return ret;
+    } else if (!latency_due(strm)) {
+        return deflate_input(strm, Z_NO_FLUSH);
+    }
+    return deflate_input(strm, Z_PARTIAL_FLUSH);
+}
+
+static int32_t deflate_budget(PREFIX3(stream) *strm, int32_t flush) {
+    deflate_state *s = strm->state;
+    if (s->latency_bytes != 0 || s->latency_usec != 0)
+        return deflate_latency(strm, flush);
+    return deflate_input(strm, flush);
+}
+
+/* ===========================================================================
+ * Move the level one step towards the throughput target after every
+ * ADAPT_WINDOW bytes of input. The level only goes up again when the input
+ * was compressed ADAPT_UP_MARGIN times faster than the target, so that it does
+ * not swing back and forth between two levels.
+ */
+static void adapt_level(PREFIX3(stream) *strm) {
+    deflate_state *s = strm->state;
+    uint64_t target = (uint64_t)s->adapt_mbps * s->adapt_usec;  /* bytes per microsecond is MB/s */
+    uint32_t avail_in = strm->avail_in;
+    uint32_t mbps = s->adapt_mbps;
+    int level = s->level;
+    int32_t ret;
+
+    if (s->adapt_bytes < target && level > 1)
+        level--;
+    else if (s->adapt_bytes * ADAPT_UP_MARGIN_DEN > target * ADAPT_UP_MARGIN_NUM && level < s->adapt_max_level)
+        level++;
+
+    if (level != s->level) {
+        /* deflateParams() ends the current block, but must neither compress the remaining input nor adapt again */
+        strm->avail_in = 0;
+        s->adapt_mbps = 0;
+        ret = PREFIX(deflateParams)(strm, level, s->strategy);
+        s->adapt_mbps = mbps;
+        strm->avail_in = avail_in;
+        /* Keep the measurement to try again after more input, e.g. when the block did not fit in the output */
+        if (ret != Z_OK)
+            return;
+    }
+    s->adapt_bytes = 0;
+    s->adapt_usec = 0;
+}
+
+/* ===========================================================================
+ * deflate() with a throughput target: the time spent in deflate() is measured
+ * for every ADAPT_WINDOW bytes of input, and the level is adapted in between.
+ * Large inputs are split so that the level also adapts within one call.
+ */
+static int32_t deflate_adaptive(PREFIX3(stream) *strm, int32_t flush) {
+    deflate_state *s = strm->state;
+    uint32_t rest, slice;
+    size_t total_in;
+    uint64_t start;
+    int32_t ret;
+
+    for (;;) {
+        slice = s->adapt_bytes < ADAPT_WINDOW ? ADAPT_WINDOW - s->adapt_bytes : ADAPT_WINDOW;
+        rest = strm->avail_in > slice ? strm->avail_in - slice : 0;
+        strm->avail_in -= rest;
+        total_in = strm->total_in;
+        start = s->clock();
+
+        ret = deflate_budget(strm, rest != 0 ? Z_NO_FLUSH : flush);
+
+        s->adapt_usec += s->clock() - start;
+        s->adapt_bytes += (uint32_t)(strm->total_in - total_in);
+        strm->avail_in += rest;
+        if (s->adapt_bytes >= ADAPT_WINDOW && s->status != FINISH_STATE)
+            adapt_level(strm);
+        if (ret != Z_OK || rest == 0 || strm->avail_out == 0)
+            return ret;
+    }
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
+    if (deflateStateCheck(strm) || flush > Z_BLOCK || flush < 0 || (strm->avail_in != 0 && strm->next_in == NULL))
+        return deflate_stream(strm, flush);
+    if (strm->state->adapt_mbps != 0)
+        return deflate_adaptive(strm, flush);
+    return deflate_budget(strm, flush);
+}
+
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflateEnd)(PREFIX3(stream) *strm) {
     if (deflateStateCheck(strm))
@@ -1119,6 +1449,8 @@ int32_t Z_EXPORT PREFIX(deflateEnd)(PREFIX3(stream) *strm) {
 
     int32_t status = strm->state->status;
 
+    DEFLATE_END_HOOK(strm);  /* hook for offload providers */
+
     /* Free allocated buffers */
     free_deflate(strm);
 
@@ -1135,6 +1467,8 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     if (deflateStateCheck(source) || dest == NULL)
         return Z_STREAM_ERROR;
 
+    DEFLATE_COPY_HOOK(source);  /* hook for offload providers */
+
     ss = source->state;
 
     memcpy((void *)dest, (void *)source, sizeof(PREFIX3(stream)));
@@ -1240,9 +1574,15 @@ static void lm_set_level(deflate_state *s, int level) {
  * Initialize the "longest match" routines for a new zlib stream
  */
 static void lm_init(deflate_state *s) {
-    s->window_size = 2 * s->w_size;
-
     CLEAR_HASH(s);
+    lm_init_keep(s);
+}
+
+/* ===========================================================================
+ * Same as lm_init(), but leave the hash table as it is
+ */
+static void lm_init_keep(deflate_state *s) {
+    s->window_size = 2 * s->w_size;
 
     /* Set the default configuration parameters:
      */
@@ -1397,6 +1737,12 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
     zng_deflate_param_value *new_level = NULL;
     zng_deflate_param_value *new_strategy = NULL;
     zng_deflate_param_value *new_reproducible = NULL;
+    zng_deflate_param_value *new_offload = NULL;
+    zng_deflate_param_value *new_rsyncable = NULL;
+    zng_deflate_param_value *new_latency_bytes = NULL;
+    zng_deflate_param_value *new_latency_usec = NULL;
+    zng_deflate_param_value *new_target_mbps = NULL;
+    zng_deflate_param_value *new_trial_parses = NULL;
     int param_buf_error;
     int version_error = 0;
     int buf_error = 0;
@@ -1423,6 +1769,24 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             case Z_DEFLATE_REPRODUCIBLE:
                 param_buf_error = deflateSetParamPre(&new_reproducible, sizeof(int), &params[i]);
                 break;
+            case Z_DEFLATE_OFFLOAD:
+                param_buf_error = deflateSetParamPre(&new_offload, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_RSYNCABLE:
+                param_buf_error = deflateSetParamPre(&new_rsyncable, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_LATENCY_BYTES:
+                param_buf_error = deflateSetParamPre(&new_latency_bytes, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_LATENCY_USEC:
+                param_buf_error = deflateSetParamPre(&new_latency_usec, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_TARGET_MBPS:
+                param_buf_error = deflateSetParamPre(&new_target_mbps, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_TRIAL_PARSES:
+                param_buf_error = deflateSetParamPre(&new_trial_parses, sizeof(int), &params[i]);
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -1459,6 +1823,73 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             stream_error = 1;
         }
     }
+    if (new_offload != NULL) {
+        int val = *(int *)new_offload->buf;
+        if (s->offload.mode == OFFLOAD_UNDECIDED || s->offload.mode == OFFLOAD_OFF) {
+            s->offload.mode = val ? OFFLOAD_UNDECIDED : OFFLOAD_OFF;
+        } else if ((s->offload.mode == OFFLOAD_ACTIVE) != (val != 0)) {
+            new_offload->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        }
+    }
+    if (new_rsyncable != NULL) {
+        int val = *(int *)new_rsyncable->buf;
+        int bits = val == 1 ? RSYNC_DEFAULT_BITS : 0;
+
+        while (val >= (2 << bits) && bits < RSYNC_MAX_BITS)
+            bits++;
+        if (val < 0 || (val > 1 && bits < RSYNC_MIN_BITS) || (val && s->offload.mode == OFFLOAD_ACTIVE)) {
+            new_rsyncable->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        } else {
+            s->rsyncable = bits;
+        }
+    }
+    if (new_latency_bytes != NULL) {
+        int val = *(int *)new_latency_bytes->buf;
+        if (val < 0) {
+            new_latency_bytes->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        } else {
+            s->latency_bytes = (uint32_t)val;
+        }
+    }
+    if (new_latency_usec != NULL) {
+        int val = *(int *)new_latency_usec->buf;
+#ifdef ZNG_CLOCK
+        if (val < 0) {
+#else
+        if (val != 0) {
+#endif
+            new_latency_usec->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        } else {
+            s->latency_usec = (uint32_t)val;
+        }
+    }
+    if (new_target_mbps != NULL) {
+        int val = *(int *)new_target_mbps->buf;
+#ifdef ZNG_CLOCK
+        if (val < 0) {
+#else
+        if (val != 0) {
+#endif
+            new_target_mbps->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        } else {
+            /* The level set now, or by Z_DEFLATE_LEVEL in the same call, is the highest one to use */
+            if (val != 0 && s->adapt_mbps == 0)
+                s->adapt_max_level = s->level;
+            s->adapt_mbps = (uint32_t)val;
+        }
+    }
+    if (new_trial_parses != NULL) {
+        s->trial_parses = *(int *)new_trial_parses->buf != 0;
+        /* Blocks are only shortened while trial parses are on */
+        if (!s->trial_parses)
+            s->sym_end = (s->lit_bufsize - 1) * SYM_SIZE;
+        s->trial_skip = 0;
+    }
 
     /* Report version errors only if there are no real errors. */
     return stream_error ? Z_STREAM_ERROR : (version_error ? Z_VERSION_ERROR : Z_OK);
@@ -1500,6 +1931,42 @@ int32_t Z_EXPORT zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value
                 else
                     *(int *)params[i].buf = s->reproducible;
                 break;
+            case Z_DEFLATE_OFFLOAD:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = s->offload.mode != OFFLOAD_OFF;
+                break;
+            case Z_DEFLATE_RSYNCABLE:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = s->rsyncable ? 1 << s->rsyncable : 0;
+                break;
+            case Z_DEFLATE_LATENCY_BYTES:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = (int)s->latency_bytes;
+                break;
+            case Z_DEFLATE_LATENCY_USEC:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = (int)s->latency_usec;
+                break;
+            case Z_DEFLATE_TARGET_MBPS:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = (int)s->adapt_mbps;
+                break;
+            case Z_DEFLATE_TRIAL_PARSES:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = s->trial_parses;
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -13,6 +13,7 @@
 #include "zutil.h"
 #include "zendian.h"
 #include "crc32.h"
+#include "offload.h"
 
 #ifdef S390_DFLTCC_DEFLATE
 #  include "arch/s390/dfltcc_common.h"
@@ -55,6 +56,20 @@
 #define HEAP_SIZE (2*L_CODES+1)
 /* maximum heap size */
 
+#ifdef ZLIB_COMPAT
+#  define MAX_LARGE_MEM_LEVEL MAX_MEM_LEVEL
+#else
+#  define MAX_LARGE_MEM_LEVEL 12
+#endif
+/* maximum memLevel, for blocks of up to 256K symbols in the large-block mode */
+
+#ifdef ZLIB_COMPAT
+#  define MAX_STRATEGY Z_FIXED
+#else
+#  define MAX_STRATEGY Z_STRIDED
+#endif
+/* last valid strategy, Z_STRIDED is not part of the zlib API */
+
 #define BIT_BUF_SIZE 64
 /* size of bit buffer in bi_buf */
 
@@ -142,41 +157,14 @@ typedef struct deflate_allocs_s {
 } deflate_allocs;
 
 struct ALIGNED_(64) internal_state {
-    PREFIX3(stream)      *strm;            /* pointer back to this zlib stream */
-    unsigned char        *pending_buf;     /* output still pending */
-    unsigned char        *pending_out;     /* next pending byte to output to the stream */
-    uint32_t             pending_buf_size; /* size of pending_buf */
-    uint32_t             pending;          /* nb of bytes in the pending buffer */
-    int                  wrap;             /* bit 0 true for zlib, bit 1 true for gzip */
-    uint32_t             gzindex;          /* where in extra, name, or comment */
-    PREFIX(gz_headerp)   gzhead;           /* gzip header information to write */
-    int                  status;           /* as the name implies */
-    int                  last_flush;       /* value of flush param for previous deflate call */
-    int                  reproducible;     /* Whether reproducible compression results are required. */
-
-    int block_open;
-    /* Whether or not a block is currently open for the QUICK deflation scheme.
-     * This is set to 1 if there is an active block, or 0 if the block was just closed.
+    /* The fields are grouped by use. The first cache line holds what the
+     * match finders and parsers read for every string, the second one what
+     * tallying symbols and sending bits updates for every symbol, and the
+     * third one what is read at most once per match or per block. The gzip
+     * header, the trees and the optional features come after them.
      */
 
-                /* used by deflate.c: */
-
-    unsigned int  w_size;            /* LZ77 window size (32K by default) */
-    unsigned int  w_bits;            /* log2(w_size)  (8..16) */
-    unsigned int  w_mask;            /* w_size - 1 */
-    unsigned int  lookahead;         /* number of valid bytes ahead in window */
-
-    unsigned int high_water;
-    /* High water mark offset in window for initialized bytes -- bytes above
-     * this are set to zero in order to avoid memory check warnings when
-     * longest match routines access bytes past the input.  This is then
-     * updated to the new high water mark.
-     */
-
-    unsigned int window_size;
-    /* Actual size of window: 2*wSize, except when the user input buffer
-     * is directly used as sliding window.
-     */
+                /* used for every string: */
 
     unsigned char *window;
     /* Sliding window. Input bytes are read into the second half of the window,
@@ -196,29 +184,63 @@ struct ALIGNED_(64) internal_state {
 
     Pos *head; /* Heads of the hash chains or 0. */
 
-    uint32_t ins_h; /* hash index of string to be inserted */
-
-    int block_start;
-    /* Window position at the beginning of the current output block. Gets
-     * negative when the window is moved backwards.
-     */
-
-    unsigned int match_length;       /* length of best match */
-    Pos          prev_match;         /* previous match */
-    int          match_available;    /* set if previous match exists */
     unsigned int strstart;           /* start of string to insert */
-    unsigned int match_start;        /* start of matching string */
+    unsigned int lookahead;          /* number of valid bytes ahead in window */
 
     unsigned int prev_length;
     /* Length of the best match at previous step. Matches not greater than this
      * are discarded. This is used in the lazy match evaluation.
      */
 
+    unsigned int match_start;        /* start of matching string */
+    unsigned int match_length;       /* length of best match */
+
     unsigned int max_chain_length;
     /* To speed up deflation, hash chains are never searched beyond this length.
      * A higher limit improves compression ratio but degrades the speed.
      */
 
+    unsigned int good_match;
+    /* Use a faster search when the previous match is longer than this */
+
+    int nice_match; /* Stop searching when current match exceeds this */
+
+    unsigned int  w_size;            /* LZ77 window size (32K by default) */
+    unsigned int  w_mask;            /* w_size - 1 */
+
+                /* used for every symbol: */
+
+#ifdef LIT_MEM
+#   define LIT_BUFS 5
+#   define SYM_SIZE 1             /* sym_next units per symbol */
+    uint16_t *d_buf;              /* buffer for distances */
+    unsigned char *l_buf;         /* buffer for literals/lengths */
+#else
+#   define LIT_BUFS 4
+#   define SYM_SIZE 3
+    unsigned char *sym_buf;       /* buffer for distances and literals/lengths */
+#endif
+
+    unsigned int sym_next;        /* running index in symbol buffer */
+    unsigned int sym_end;         /* symbol table full when sym_next reaches this */
+
+    unsigned char        *pending_buf;     /* output still pending */
+    uint32_t             pending;          /* nb of bytes in the pending buffer */
+
+    int32_t bi_valid;
+    /* Number of valid bits in bi_buf.  All bits above the last valid bit are always zero. */
+
+    uint64_t bi_buf;
+    /* Output buffer. bits are inserted starting at the bottom (least significant bits). */
+
+    int block_start;
+    /* Window position at the beginning of the current output block. Gets
+     * negative when the window is moved backwards.
+     */
+
+    unsigned int insert;          /* bytes at end of window left to insert */
+    unsigned int matches;         /* number of string matches in current block */
+
     unsigned int max_lazy_match;
     /* Attempt to find a better match only when the current match is strictly smaller
      * than this value. This mechanism is used only for compression levels >= 4.
@@ -229,19 +251,53 @@ struct ALIGNED_(64) internal_state {
      * max_insert_length is used only for compression levels <= 3.
      */
 
+                /* used for every match or block: */
+
     update_hash_cb          update_hash;
     insert_string_cb        insert_string;
     quick_insert_string_cb  quick_insert_string;
     /* Hash function callbacks that can be configured depending on the deflate
      * algorithm being used */
 
+    unsigned int window_size;
+    /* Actual size of window: 2*wSize, except when the user input buffer
+     * is directly used as sliding window.
+     */
+
+    uint32_t ins_h; /* hash index of string to be inserted */
+
     int level;    /* compression level (1..9) */
     int strategy; /* favor or force Huffman coding*/
 
-    unsigned int good_match;
-    /* Use a faster search when the previous match is longer than this */
+    int          match_available;    /* set if previous match exists */
+    Pos          prev_match;         /* previous match */
 
-    int nice_match; /* Stop searching when current match exceeds this */
+    PREFIX3(stream)      *strm;            /* pointer back to this zlib stream */
+    uint32_t             pending_buf_size; /* size of pending_buf */
+
+    int block_open;
+    /* Whether or not a block is currently open for the QUICK deflation scheme.
+     * This is set to 1 if there is an active block, or 0 if the block was just closed.
+     */
+
+                /* used by deflate.c: */
+
+    unsigned char        *pending_out;     /* next pending byte to output to the stream */
+    int                  wrap;             /* bit 0 true for zlib, bit 1 true for gzip */
+    uint32_t             gzindex;          /* where in extra, name, or comment */
+    PREFIX(gz_headerp)   gzhead;           /* gzip header information to write */
+    int                  status;           /* as the name implies */
+    int                  last_flush;       /* value of flush param for previous deflate call */
+    int                  reproducible;     /* Whether reproducible compression results are required. */
+
+    unsigned int  w_bits;            /* log2(w_size)  (8..16) */
+
+    unsigned int high_water;
+    /* High water mark offset in window for initialized bytes -- bytes above
+     * this are set to zero in order to avoid memory check warnings when
+     * longest match routines access bytes past the input.  This is then
+     * updated to the new high water mark.
+     */
 
 #if defined(_M_IX86) || defined(_M_ARM)
     int padding[2];
@@ -275,8 +331,9 @@ struct ALIGNED_(64) internal_state {
 
     unsigned int  lit_bufsize;
     /* Size of match buffer for literals/lengths.  There are 4 reasons for
-     * limiting lit_bufsize to 64K:
-     *   - frequencies can be kept in 16 bit counters
+     * limiting lit_bufsize to 64K, except in the large-block mode:
+     *   - frequencies can be kept in 16 bit counters (longer blocks are
+     *     counted again in 32 bits when they are flushed)
      *   - if compression is not successful for the first block, all input
      *     data is still in the window so we can still emit a stored block even
      *     when input comes from standard input.  (This can also be done for
@@ -291,24 +348,14 @@ struct ALIGNED_(64) internal_state {
      *     fast adaptation but have of course the overhead of transmitting
      *     trees more frequently.
      *   - I can't count above 4
+     * The large-block mode, memLevel 10 to MAX_LARGE_MEM_LEVEL, is for large
+     * homogeneous inputs, where fewer blocks save tree headers and the time
+     * spent building trees. Its blocks can only be stored if their input is
+     * still in the window, else the static trees bound their size.
      */
 
-#ifdef LIT_MEM
-#   define LIT_BUFS 5
-    uint16_t *d_buf;              /* buffer for distances */
-    unsigned char *l_buf;         /* buffer for literals/lengths */
-#else
-#   define LIT_BUFS 4
-    unsigned char *sym_buf;       /* buffer for distances and literals/lengths */
-#endif
-
-    unsigned int sym_next;        /* running index in symbol buffer */
-    unsigned int sym_end;         /* symbol table full when sym_next reaches this */
-
     unsigned long opt_len;        /* bit length of current block with optimal trees */
     unsigned long static_len;     /* bit length of current block with static trees */
-    unsigned int matches;         /* number of string matches in current block */
-    unsigned int insert;          /* bytes at end of window left to insert */
 
     /* compressed_len and bits_sent are only used if ZLIB_DEBUG is defined */
     unsigned long compressed_len; /* total bit length of compressed file mod 2^32 */
@@ -319,12 +366,35 @@ struct ALIGNED_(64) internal_state {
 #ifdef HAVE_ARCH_DEFLATE_STATE
     arch_deflate_state arch;      /* architecture-specific extensions */
 #endif
+#ifndef ZLIB_COMPAT
+    offload_state offload;        /* offload provider session */
+#endif
 
-    uint64_t bi_buf;
-    /* Output buffer. bits are inserted starting at the bottom (least significant bits). */
+    int rsyncable;                /* log2 of the spacing of rsyncable flush points, 0 if disabled */
+    uint32_t rsync_hash;          /* rolling hash of the last 32 input bytes */
+    uint32_t rsync_run;           /* input bytes scanned since the last flush point */
+    uint32_t rsync_todo;          /* scanned input bytes not yet given to the compressor */
+    int rsync_flush;              /* a full flush is owed once rsync_todo bytes are compressed */
 
-    int32_t bi_valid;
-    /* Number of valid bits in bi_buf.  All bits above the last valid bit are always zero. */
+    uint32_t latency_bytes;       /* flush once this much input can not be decoded yet, 0 if disabled */
+    uint32_t latency_usec;        /* flush once input could not be decoded for this long, 0 if disabled */
+    size_t latency_mark;          /* total_in at the last flush */
+    uint64_t latency_start;       /* clock when input was first left behind since the last flush, 0 if none */
+    uint64_t (*clock)(void);      /* microsecond clock of the latency and throughput targets, tests replace it */
+
+    uint32_t adapt_mbps;          /* throughput target of the adaptive level, 0 if disabled */
+    int adapt_max_level;          /* highest level the adaptive level goes up to */
+    uint32_t adapt_bytes;         /* input bytes since the last level decision */
+    uint64_t adapt_usec;          /* time spent in deflate() since the last level decision */
+
+    int trial_parses;             /* also try the run and literal parses of every block, keep the smallest */
+    int trial_skip;               /* blocks left to send without trial parses */
+    int trial_flushed;            /* the next block follows a full flush, its trial parses can't use earlier bytes */
+
+    int stride;                   /* dominant stride of the input for Z_STRIDED, 0 if none */
+    size_t stride_next;           /* total_in at which the stride is looked for again */
+    uint32_t row_dist;            /* most common distance of long matches for Z_FILTERED */
+    uint32_t row_votes;           /* long matches at row_dist not outvoted by other distances */
 
     /* Reserved for future use and alignment purposes */
     int32_t reserved[19];
@@ -423,6 +493,7 @@ static inline void put_uint64(deflate_state *s, uint64_t lld) {
 
 
 void Z_INTERNAL PREFIX(fill_window)(deflate_state *s);
+int32_t Z_INTERNAL PREFIX(deflateResetLazy)(PREFIX3(stream) *strm);
 void Z_INTERNAL slide_hash_c(deflate_state *s);
 
         /* in trees.c */
@@ -0,0 +1,241 @@
+/* deflate_filtered.c -- compress data using the filtered strategy of deflation algorithm
+ *
+ * Copyright (C) 1995-2024 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* Filtered data such as PNG scanlines is mostly small values with a somewhat
+ * random distribution. The useful matches are runs of zeros, the previous
+ * pixels, and the same bytes in the previous row. This parser tries these
+ * distances first, drops the short matches elsewhere that usually cost more
+ * than the literals, and does not fill the hash chains with the strings of
+ * long runs.
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+#include "insert_string_p.h"
+#include "functable.h"
+#include "zutil_p.h"
+
+#define FILTERED_NEAR       8      /* farthest distance of the previous pixels */
+#define FILTERED_SHORT      5      /* longest match only kept at the row distance */
+#define FILTERED_ROW_MATCH  16     /* shortest match that votes for its distance as the row length */
+#define FILTERED_FAST_CHAIN 4      /* the greedy parse walks 1/16 of max_chain_length */
+#define FILTERED_LIT_RUN    16     /* literals in a row after which not every string is searched */
+#define FILTERED_LIT_STEP   4      /* strings between two searches after FILTERED_LIT_RUN literals */
+
+/* Distances of the previous pixels for 1 to 8 bytes per pixel */
+static const uint8_t near_dist[] = { 1, 2, 3, 4, 6, 8 };
+
+/* ===========================================================================
+ * Compare the current string with the one dist bytes back, and set
+ * match_start and *best_len to it if it is longer than *best_len. Only
+ * matches of at least 4 bytes are looked for, shorter ones are dropped.
+ */
+static inline void probe(deflate_state *s, uint32_t dist, uint32_t *best_len, uint32_t *match_start) {
+    unsigned char *scan = s->window + s->strstart;
+    const unsigned char *match = scan - dist;
+    uint32_t len = *best_len;
+
+    /* Never match the string at window index 0, as in longest_match() */
+    if (dist >= s->strstart || dist > MAX_DIST(s))
+        return;
+    if (match[len] != scan[len] || zng_memcmp_4(match, scan) != 0)
+        return;
+    len = 2 + FUNCTABLE_CALL(compare256)(scan + 2, match + 2);
+    if (len > *best_len) {
+        *best_len = MIN(len, s->lookahead);
+        *match_start = s->strstart - dist;
+    }
+}
+
+/* ===========================================================================
+ * Set match_start to the longest match for the current string and return its
+ * length, with the same contract as longest_match(). The previous pixels and
+ * the previous row are tried first, and kept unless the hash chain gives a
+ * longer match. Matches of up to FILTERED_SHORT bytes are dropped, except at
+ * the row distance. The hash chain is walked for max_chain_length >> shift
+ * candidates.
+ */
+static uint32_t filtered_match(deflate_state *s, Pos cur_match, match_func longest_match, unsigned shift) {
+    uint32_t prev_length = s->prev_length;
+    uint32_t near_len = prev_length ? prev_length : STD_MIN_MATCH - 1;
+    uint32_t near_start = 0, match_len, dist;
+    uint32_t scan4, match4, hits = 0;
+    unsigned i;
+
+    /* Most strings match none of the previous pixels, so first find the ones
+     * that do without a branch for each.
+     */
+    if (s->strstart > FILTERED_NEAR) {
+        memcpy(&scan4, s->window + s->strstart, sizeof(scan4));
+        for (i = 0; i < sizeof(near_dist); i++) {
+            memcpy(&match4, s->window + s->strstart - near_dist[i], sizeof(match4));
+            hits |= (uint32_t)(match4 == scan4) << i;
+        }
+        for (i = 0; hits != 0; i++, hits >>= 1) {
+            if (hits & 1)
+                probe(s, near_dist[i], &near_len, &near_start);
+        }
+    }
+    if (s->row_dist > FILTERED_NEAR)
+        probe(s, s->row_dist, &near_len, &near_start);
+
+    if (near_start != 0 && (near_len >= (uint32_t)s->nice_match || near_len >= s->lookahead)) {
+        match_len = near_len;
+        s->match_start = near_start;
+    } else {
+        /* Only look for matches in the hash chain that are longer still */
+        unsigned max_chain = s->max_chain_length;
+        s->prev_length = near_len;
+        s->max_chain_length = MAX(max_chain >> shift, 1);
+        match_len = longest_match(s, cur_match);
+        s->max_chain_length = max_chain;
+        s->prev_length = prev_length;
+        if (match_len <= near_len) {
+            if (near_start == 0)
+                return match_len;
+            match_len = near_len;
+            s->match_start = near_start;
+        }
+    }
+
+    dist = s->strstart - s->match_start;
+    if (match_len <= FILTERED_SHORT && dist != s->row_dist)
+        return STD_MIN_MATCH - 1;
+
+    /* The most common distance of long matches is taken as the row length */
+    if (match_len >= FILTERED_ROW_MATCH && dist > FILTERED_NEAR) {
+        if (dist == s->row_dist)
+            s->row_votes++;
+        else if (s->row_votes > 0)
+            s->row_votes--;
+        else
+            s->row_dist = dist;
+    }
+    return match_len;
+}
+
+/* ===========================================================================
+ * Insert the strings of a match in the hash table. Of matches longer than
+ * max_insert_length, which in filtered data are mostly runs of zeros, only
+ * the first strings and the last ones, so that the rolling hash of the next
+ * string is right, are inserted.
+ */
+#define INSERT_LONG_MATCH(insert_string) \
+    static void insert_string##_filtered(deflate_state *const s, uint32_t str, uint32_t count) { \
+        if (count > s->max_insert_length + STD_MIN_MATCH) { \
+            insert_string(s, str, s->max_insert_length); \
+            str += count - STD_MIN_MATCH; \
+            count = STD_MIN_MATCH; \
+        } \
+        insert_string(s, str, count); \
+    }
+
+INSERT_LONG_MATCH(insert_string_static)
+INSERT_LONG_MATCH(insert_string_roll)
+
+/* ===========================================================================
+ * Greedy parse of filtered data for the lower levels. Lazy evaluation and
+ * long hash chains gain little on it: most matches are long runs or rows, and
+ * the far matches deep in the chains are mostly chance ones. Within long runs
+ * of literals, which are the noise of the image, the strings are still
+ * inserted in the hash table but only some of them are searched.
+ */
+static block_state deflate_filtered_fast(deflate_state *s, int flush) {
+    match_func longest_match = FUNCTABLE_FPTR(longest_match);
+    Pos hash_head;        /* head of the hash chain */
+    int bflush = 0;       /* set if current block must be flushed */
+    int64_t dist;
+    uint32_t match_len, lit_run = 0;
+
+    for (;;) {
+        /* Make sure that we always have enough lookahead, except
+         * at the end of the input file. We need STD_MAX_MATCH bytes
+         * for the next match, plus WANT_MIN_MATCH bytes to insert the
+         * string following the next match.
+         */
+        if (s->lookahead < MIN_LOOKAHEAD) {
+            PREFIX(fill_window)(s);
+            if (UNLIKELY(s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH)) {
+                return need_more;
+            }
+            if (UNLIKELY(s->lookahead == 0))
+                break; /* flush the current block */
+        }
+
+        match_len = 0;
+        if (s->lookahead >= WANT_MIN_MATCH) {
+            hash_head = quick_insert_string_static(s, s->strstart);
+            dist = (int64_t)s->strstart - hash_head;
+
+            if (dist <= MAX_DIST(s) && dist > 0 && hash_head != 0 && (lit_run < FILTERED_LIT_RUN || lit_run % FILTERED_LIT_STEP == 0))
+                match_len = filtered_match(s, hash_head, longest_match, FILTERED_FAST_CHAIN);
+        }
+
+        if (match_len >= STD_MIN_MATCH) {
+            unsigned int max_insert = s->strstart + s->lookahead - STD_MIN_MATCH;
+            /* Do not insert strings in hash table beyond this. */
+
+            check_match(s, (Pos)s->strstart, (Pos)s->match_start, match_len);
+
+            bflush = zng_tr_tally_dist(s, s->strstart - s->match_start, match_len - STD_MIN_MATCH);
+
+            s->lookahead -= match_len;
+            s->strstart++;
+            if (max_insert > s->strstart)
+                insert_string_static_filtered(s, s->strstart, MIN(match_len - 1, max_insert - s->strstart));
+            s->strstart += match_len - 1;
+            lit_run = 0;
+        } else {
+            lit_run++;
+            /* No match, output a literal byte */
+            bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+            s->lookahead--;
+            s->strstart++;
+        }
+        if (UNLIKELY(bflush))
+            FLUSH_BLOCK(s, 0);
+    }
+    s->insert = s->strstart < (STD_MIN_MATCH - 1) ? s->strstart : (STD_MIN_MATCH - 1);
+    if (UNLIKELY(flush == Z_FINISH)) {
+        FLUSH_BLOCK(s, 1);
+        return finish_done;
+    }
+    if (UNLIKELY(s->sym_next))
+        FLUSH_BLOCK(s, 0);
+    return block_done;
+}
+
+#define FIND_MATCH(s, cur_match, longest_match) filtered_match(s, cur_match, longest_match, 0)
+#define FIND_MATCH_FILTERED  1
+
+#define DEFLATE_SLOW         deflate_filtered_hash
+#define QUICK_INSERT_STRING  quick_insert_string_static
+#define INSERT_STRING        insert_string_static_filtered
+
+#include "deflate_slow_tpl.h"
+
+#define FIND_MATCH(s, cur_match, longest_match) filtered_match(s, cur_match, longest_match, 0)
+#define FIND_MATCH_FILTERED  1
+
+#define DEFLATE_SLOW         deflate_filtered_roll
+#define QUICK_INSERT_STRING  quick_insert_string_roll
+#define INSERT_STRING        insert_string_roll_filtered
+
+#include "deflate_slow_tpl.h"
+
+/* ===========================================================================
+ * Same as deflate_fast for levels 2 to 6 and deflate_slow for levels 7 to 9,
+ * with the matches of filtered data tried first. Used with the Z_FILTERED
+ * strategy for all levels from 2.
+ */
+Z_INTERNAL block_state deflate_filtered(deflate_state *s, int flush) {
+    if (s->level <= 6)
+        return deflate_filtered_fast(s, flush);
+    if (s->insert_string == &insert_string_roll)
+        return deflate_filtered_roll(s, flush);
+    return deflate_filtered_hash(s, flush);
+}
@@ -9,12 +9,44 @@
 #include "deflate_p.h"
 #include "functable.h"
 
+/* Below this many literals, tallying them one at a time is cheaper than a histogram */
+#define HUFF_TALLY_MIN 64
+
+/* ===========================================================================
+ * Tally len literals at once: the symbols are appended to the symbol buffer
+ * and their frequencies are counted with the histogram function. The symbol
+ * buffer must have room for len more symbols. Return true if it is full.
+ */
+static int huff_tally_lits(deflate_state *s, const unsigned char *buf, uint32_t len) {
+    uint32_t hist[LITERALS];
+    uint32_t i;
+
+    memset(hist, 0, sizeof(hist));
+    FUNCTABLE_CALL(histogram)(hist, buf, len);
+    for (i = 0; i < LITERALS; i++)
+        s->dyn_ltree[i].Freq += (uint16_t)hist[i];
+
+#ifdef LIT_MEM
+    memset(s->d_buf + s->sym_next, 0, len * sizeof(uint16_t));
+    memcpy(s->l_buf + s->sym_next, buf, len);
+    s->sym_next += len;
+#else
+    for (i = 0; i < len; i++) {
+        s->sym_buf[s->sym_next++] = 0;
+        s->sym_buf[s->sym_next++] = 0;
+        s->sym_buf[s->sym_next++] = buf[i];
+    }
+#endif
+    return (s->sym_next == s->sym_end);
+}
+
 /* ===========================================================================
  * For Z_HUFFMAN_ONLY, do not look for matches.  Do not maintain a hash table.
  * (It will be regenerated if this run of deflate switches away from Huffman.)
  */
 Z_INTERNAL block_state deflate_huff(deflate_state *s, int flush) {
     int bflush = 0;         /* set if current block must be flushed */
+    uint32_t len;
 
     for (;;) {
         /* Make sure that we have a literal to write. */
@@ -27,10 +59,21 @@ Z_INTERNAL block_state deflate_huff(deflate_state *s, int flush) {
             }
         }
 
-        /* Output a literal byte */
-        bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
-        s->lookahead--;
-        s->strstart++;
+        /* Output as many literal bytes as fit in the symbol buffer */
+#ifdef LIT_MEM
+        len = s->sym_end - s->sym_next;
+#else
+        len = (s->sym_end - s->sym_next) / 3;
+#endif
+        len = MIN(len, s->lookahead);
+        if (len >= HUFF_TALLY_MIN) {
+            bflush = huff_tally_lits(s, s->window + s->strstart, len);
+        } else {
+            len = 1;
+            bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+        }
+        s->lookahead -= len;
+        s->strstart += len;
         if (bflush)
             FLUSH_BLOCK(s, 0);
     }
@@ -10,6 +10,7 @@
 #include "zbuild.h"
 #include "deflate.h"
 #include "deflate_p.h"
+#include "insert_string_p.h"
 #include "functable.h"
 
 struct match {
@@ -54,9 +55,9 @@ static void insert_match(deflate_state *s, struct match match) {
         if (UNLIKELY(match.match_length > 0)) {
             if (match.strstart >= match.orgstart) {
                 if (match.strstart + match.match_length - 1 >= match.orgstart) {
-                    insert_string(s, match.strstart, match.match_length);
+                    insert_string_static(s, match.strstart, match.match_length);
                 } else {
-                    insert_string(s, match.strstart, match.orgstart - match.strstart + 1);
+                    insert_string_static(s, match.strstart, match.orgstart - match.strstart + 1);
                 }
                 match.strstart += match.match_length;
                 match.match_length = 0;
@@ -68,12 +69,12 @@ static void insert_match(deflate_state *s, struct match match) {
     /* Insert into hash table. */
     if (LIKELY(match.strstart >= match.orgstart)) {
         if (LIKELY(match.strstart + match.match_length - 1 >= match.orgstart)) {
-            insert_string(s, match.strstart, match.match_length);
+            insert_string_static(s, match.strstart, match.match_length);
         } else {
-            insert_string(s, match.strstart, match.orgstart - match.strstart + 1);
+            insert_string_static(s, match.strstart, match.orgstart - match.strstart + 1);
         }
     } else if (match.orgstart < match.strstart + match.match_length) {
-        insert_string(s, match.orgstart, match.strstart + match.match_length - match.orgstart);
+        insert_string_static(s, match.orgstart, match.strstart + match.match_length - match.orgstart);
     }
     match.strstart += match.match_length;
     match.match_length = 0;
@@ -184,7 +185,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
         } else {
             hash_head = 0;
             if (s->lookahead >= WANT_MIN_MATCH) {
-                hash_head = quick_insert_string(s, s->strstart);
+                hash_head = quick_insert_string_static(s, s->strstart);
             }
 
             current_match.strstart = (uint16_t)s->strstart;
@@ -220,7 +221,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
         /* now, look ahead one */
         if (LIKELY(!early_exit && s->lookahead > MIN_LOOKAHEAD && (uint32_t)(current_match.strstart + current_match.match_length) < (s->window_size - MIN_LOOKAHEAD))) {
             s->strstart = current_match.strstart + current_match.match_length;
-            hash_head = quick_insert_string(s, s->strstart);
+            hash_head = quick_insert_string_static(s, s->strstart);
 
             next_match.strstart = (uint16_t)s->strstart;
             next_match.orgstart = next_match.strstart;
@@ -21,6 +21,7 @@
 #include "zutil_p.h"
 #include "deflate.h"
 #include "deflate_p.h"
+#include "insert_string_p.h"
 #include "functable.h"
 #include "trees_emit.h"
 
@@ -86,7 +87,7 @@ Z_INTERNAL block_state deflate_quick(deflate_state *s, int flush) {
         }
 
         if (LIKELY(s->lookahead >= WANT_MIN_MATCH)) {
-            hash_head = quick_insert_string(s, s->strstart);
+            hash_head = quick_insert_string_static(s, s->strstart);
             dist = (int64_t)s->strstart - hash_head;
 
             if (dist <= MAX_DIST(s) && dist > 0) {
@@ -0,0 +1,215 @@
+/* deflate_stride.c -- compress data using the strided strategy of deflation algorithm
+ *
+ * Copyright (C) 1995-2024 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* Arrays of fixed size records repeat at multiples of the record size: a
+ * field is most likely to match the same field of the previous records. This
+ * strategy finds the dominant stride of the input by autocorrelation and
+ * tries the distances stride, 2*stride, ... before walking the hash chain,
+ * where these candidates are often buried behind many shorter matches.
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+#include "insert_string_p.h"
+#include "functable.h"
+
+#define STRIDE_MIN      2          /* shortest stride looked for */
+#define STRIDE_MAX      256        /* longest stride looked for */
+#define STRIDE_SAMPLE   1024       /* bytes of input sampled to find the stride */
+#define STRIDE_INTERVAL 262144     /* input bytes between two stride searches */
+#define STRIDE_PROBES   4          /* multiples of the stride tried for each string */
+
+/* ===========================================================================
+ * Find the dominant stride of the input read so far, which is the smallest
+ * distance at which bytes match most often. Set it to 0 when bytes repeat at
+ * no distance often enough, which is the case for text and random data. The
+ * search compares about one byte pair per byte of input.
+ */
+static void stride_detect(deflate_state *s) {
+    uint32_t end = s->strstart + s->lookahead;
+    uint32_t count[STRIDE_MAX + 1];
+    uint32_t best = 0, stride = 0;
+    const unsigned char *buf;
+    uint32_t len, d, i;
+
+    if (s->strm->total_in < s->stride_next || end < STRIDE_MAX + 256)
+        return;
+    s->stride_next = s->strm->total_in + STRIDE_INTERVAL;
+
+    len = MIN(end - STRIDE_MAX, STRIDE_SAMPLE);
+    buf = s->window + end - len;
+    for (d = STRIDE_MIN; d <= STRIDE_MAX; d++) {
+        const unsigned char *ref = buf - d;
+        uint32_t n = 0;
+        for (i = 0; i < len; i++)
+            n += buf[i] == ref[i];
+        count[d] = n;
+        if (n > best)
+            best = n;
+    }
+
+    /* Multiples of the stride match about as often as the stride itself */
+    if (best >= len / 4) {
+        for (d = STRIDE_MIN; count[d] < best - best / 8; d++)
+            ;
+        stride = d;
+    }
+    s->stride = stride;
+}
+
+/* ===========================================================================
+ * Set match_start to the longest match for the current string and return its
+ * length, with the same contract as longest_match(). The multiples of the
+ * stride are tried first, and the hash chain is only walked if they did not
+ * already give a match of nice_match bytes.
+ */
+static uint32_t stride_match(deflate_state *s, Pos cur_match, match_func longest_match) {
+    uint32_t prev_length = s->prev_length;
+    uint32_t best_len = prev_length ? prev_length : STD_MIN_MATCH - 1;
+    unsigned char *scan = s->window + s->strstart;
+    uint32_t match_start = 0, match_len, dist, k;
+
+    if (s->stride) {
+        for (k = 1, dist = s->stride; k <= STRIDE_PROBES; k++, dist += s->stride) {
+            const unsigned char *match = scan - dist;
+
+            /* Never match the string at window index 0, as in longest_match() */
+            if (dist >= s->strstart || dist > MAX_DIST(s))
+                break;
+            if (match[0] != scan[0] || match[1] != scan[1] || match[best_len] != scan[best_len])
+                continue;
+            match_len = 2 + FUNCTABLE_CALL(compare256)(scan + 2, match + 2);
+            if (match_len > best_len) {
+                best_len = MIN(match_len, s->lookahead);
+                match_start = s->strstart - dist;
+                if (best_len >= (uint32_t)s->nice_match || best_len >= s->lookahead)
+                    break;
+            }
+        }
+    }
+    if (match_start == 0)
+        return longest_match(s, cur_match);
+    if (best_len >= (uint32_t)s->nice_match || best_len >= s->lookahead) {
+        s->match_start = match_start;
+        return best_len;
+    }
+
+    /* Only look for matches in the hash chain that are longer still */
+    s->prev_length = best_len;
+    match_len = longest_match(s, cur_match);
+    s->prev_length = prev_length;
+    if (match_len > best_len)
+        return match_len;
+    s->match_start = match_start;
+    return best_len;
+}
+
+/* ===========================================================================
+ * Same as deflate_fast, with matches at multiples of the stride of the input
+ * tried first. Used for levels 2 to 6.
+ */
+static block_state deflate_stride_fast(deflate_state *s, int flush) {
+    match_func longest_match = FUNCTABLE_FPTR(longest_match);
+    Pos hash_head;        /* head of the hash chain */
+    int bflush = 0;       /* set if current block must be flushed */
+    int64_t dist;
+    uint32_t match_len = 0;
+
+    for (;;) {
+        /* Make sure that we always have enough lookahead, except
+         * at the end of the input file. We need STD_MAX_MATCH bytes
+         * for the next match, plus WANT_MIN_MATCH bytes to insert the
+         * string following the next match.
+         */
+        if (s->lookahead < MIN_LOOKAHEAD) {
+            PREFIX(fill_window)(s);
+            stride_detect(s);
+            if (UNLIKELY(s->lookahead < MIN_LOOKAHEAD && flush == Z_NO_FLUSH)) {
+                return need_more;
+            }
+            if (UNLIKELY(s->lookahead == 0))
+                break; /* flush the current block */
+        }
+
+        if (s->lookahead >= WANT_MIN_MATCH) {
+            hash_head = quick_insert_string_static(s, s->strstart);
+            dist = (int64_t)s->strstart - hash_head;
+
+            if (dist <= MAX_DIST(s) && dist > 0 && hash_head != 0)
+                match_len = stride_match(s, hash_head, longest_match);
+        }
+
+        if (match_len >= WANT_MIN_MATCH) {
+            check_match(s, (Pos)s->strstart, (Pos)s->match_start, match_len);
+
+            bflush = zng_tr_tally_dist(s, s->strstart - s->match_start, match_len - STD_MIN_MATCH);
+
+            s->lookahead -= match_len;
+
+            /* Insert new strings in the hash table only if the match length
+             * is not too large. This saves time but degrades compression.
+             */
+            if (match_len <= s->max_insert_length && s->lookahead >= WANT_MIN_MATCH) {
+                match_len--; /* string at strstart already in table */
+                s->strstart++;
+
+                insert_string_static(s, s->strstart, match_len);
+                s->strstart += match_len;
+            } else {
+                s->strstart += match_len;
+                quick_insert_string_static(s, s->strstart + 2 - STD_MIN_MATCH);
+            }
+            match_len = 0;
+        } else {
+            /* No match, output a literal byte */
+            bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+            s->lookahead--;
+            s->strstart++;
+        }
+        if (UNLIKELY(bflush))
+            FLUSH_BLOCK(s, 0);
+    }
+    s->insert = s->strstart < (STD_MIN_MATCH - 1) ? s->strstart : (STD_MIN_MATCH - 1);
+    if (UNLIKELY(flush == Z_FINISH)) {
+        FLUSH_BLOCK(s, 1);
+        return finish_done;
+    }
+    if (UNLIKELY(s->sym_next))
+        FLUSH_BLOCK(s, 0);
+    return block_done;
+}
+
+#define FIND_MATCH           stride_match
+#define WINDOW_FILLED        stride_detect
+
+#define DEFLATE_SLOW         deflate_stride_hash
+#define QUICK_INSERT_STRING  quick_insert_string_static
+#define INSERT_STRING        insert_string_static
+
+#include "deflate_slow_tpl.h"
+
+#define FIND_MATCH           stride_match
+#define WINDOW_FILLED        stride_detect
+
+#define DEFLATE_SLOW         deflate_stride_roll
+#define QUICK_INSERT_STRING  quick_insert_string_roll
+#define INSERT_STRING        insert_string_roll
+
+#include "deflate_slow_tpl.h"
+
+/* ===========================================================================
+ * Same as deflate_fast for levels 2 to 6 and deflate_slow for levels 7 to 9,
+ * with matches at multiples of the stride of the input tried first. Used
+ * with the Z_STRIDED strategy for all levels from 2.
+ */
+Z_INTERNAL block_state deflate_stride(deflate_state *s, int flush) {
+    if (s->level <= 6)
+        return deflate_stride_fast(s, flush);
+    if (s->insert_string == &insert_string_roll)
+        return deflate_stride_roll(s, flush);
+    return deflate_stride_hash(s, flush);
+}
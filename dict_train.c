@@ -0,0 +1,183 @@
+/* dict_train.c -- build a preset dictionary from sample data
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   The trainer picks the segments of the samples that share the most content with the other samples, in the
+   manner of a cover algorithm:
+
+   Every TRAIN_DMER_LEN byte string (dmer) of the samples is hashed, and each hash gets the number of samples it
+   occurs in. The samples are then split into as many epochs as there are segments to pick, and in every epoch the
+   TRAIN_SEGMENT_LEN byte window with the highest sum of distinct dmer counts is selected. The dmers of a selected
+   segment are not counted again, so later segments add new content instead of repeating it.
+
+   deflate() finds the end of the dictionary at the shortest distances, and with the cheapest distance codes, so
+   the segments are stored by increasing score: the content shared by the most samples ends the dictionary.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "zutil_p.h"
+
+#ifndef ZLIB_COMPAT
+
+#define TRAIN_DMER_LEN      8                       /* bytes hashed per position */
+#define TRAIN_SEGMENT_LEN   256                     /* bytes per selected segment */
+#define TRAIN_HASH_BITS     20
+#define TRAIN_HASH_SIZE     (1 << TRAIN_HASH_BITS)
+#define TRAIN_NO_DMER       UINT32_MAX              /* position without a whole dmer in its sample */
+#define TRAIN_MAX_DICT      32768                   /* deflate only uses the last 32K of a dictionary */
+
+typedef struct {
+    size_t start;
+    size_t len;
+    uint64_t score;
+} train_segment;
+
+static inline uint32_t train_hash(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return (uint32_t)((v * 0x9E3779B97F4A7C15ULL) >> (64 - TRAIN_HASH_BITS));
+}
+
+/* Best segment of [begin, end) by the sum of the counts of its distinct dmers */
+static train_segment train_select(const uint32_t *dmers, uint32_t *count, uint16_t *active, size_t begin,
+                                  size_t end) {
+    const size_t window = TRAIN_SEGMENT_LEN - TRAIN_DMER_LEN + 1;
+    train_segment best = { begin, 0, 0 };
+    uint64_t score = 0;
+    size_t first = begin, i;
+
+    for (i = begin; i < end; i++) {
+        uint32_t h = dmers[i];
+        if (h != TRAIN_NO_DMER && active[h]++ == 0)
+            score += count[h];
+        if (i - first + 1 > window) {
+            h = dmers[first++];
+            if (h != TRAIN_NO_DMER && --active[h] == 0)
+                score -= count[h];
+        }
+        if (score > best.score) {
+            best.start = first;
+            best.len = i - first + 1;
+            best.score = score;
+        }
+    }
+    for (; first < end; first++) {
+        if (dmers[first] != TRAIN_NO_DMER)
+            active[dmers[first]]--;
+    }
+    if (best.score == 0)
+        return best;
+
+    /* Trim the dmers that add nothing from both ends */
+    while (dmers[best.start] == TRAIN_NO_DMER || count[dmers[best.start]] == 0)
+        best.start++, best.len--;
+    while (dmers[best.start + best.len - 1] == TRAIN_NO_DMER || count[dmers[best.start + best.len - 1]] == 0)
+        best.len--;
+
+    /* Do not pick the same content again */
+    for (i = best.start; i < best.start + best.len; i++) {
+        if (dmers[i] != TRAIN_NO_DMER)
+            count[dmers[i]] = 0;
+    }
+    best.len += TRAIN_DMER_LEN - 1;
+    return best;
+}
+
+static int train_segment_cmp(const void *a, const void *b) {
+    const train_segment *sa = (const train_segment *)a, *sb = (const train_segment *)b;
+    if (sa->score != sb->score)
+        return sa->score < sb->score ? 1 : -1;
+    return sa->start < sb->start ? -1 : sa->start > sb->start;
+}
+
+/* ========================================================================= */
+size_t Z_EXPORT PREFIX(train_dictionary)(const uint8_t * const *samples, const size_t *sizes, size_t n,
+                                         uint8_t *dict_buf, size_t dict_cap) {
+    uint8_t *corpus = NULL;
+    uint32_t *dmers = NULL, *count = NULL, *last = NULL;
+    uint16_t *active = NULL;
+    train_segment *segments = NULL;
+    size_t total = 0, pos, i, j, epochs, epoch_len, nsegments = 0, dict_len = 0;
+
+    if (samples == NULL || sizes == NULL || dict_buf == NULL || dict_cap == 0)
+        return 0;
+    dict_cap = MIN(dict_cap, TRAIN_MAX_DICT);
+    for (i = 0; i < n; i++) {
+        if (samples[i] == NULL && sizes[i] != 0)
+            return 0;
+        total += sizes[i];
+    }
+    if (total < TRAIN_DMER_LEN)
+        return 0;
+
+    corpus = (uint8_t *)zng_alloc(total);
+    dmers = (uint32_t *)zng_alloc(total * sizeof(uint32_t));
+    count = (uint32_t *)zng_alloc(TRAIN_HASH_SIZE * sizeof(uint32_t));
+    last = (uint32_t *)zng_alloc(TRAIN_HASH_SIZE * sizeof(uint32_t));
+    active = (uint16_t *)zng_alloc(TRAIN_HASH_SIZE * sizeof(uint16_t));
+    epochs = MAX(dict_cap / TRAIN_SEGMENT_LEN, 1);
+    segments = (train_segment *)zng_alloc(epochs * sizeof(train_segment));
+    if (corpus == NULL || dmers == NULL || count == NULL || last == NULL || active == NULL || segments == NULL)
+        goto done;
+
+    /* Count in how many samples each dmer occurs */
+    memset(count, 0, TRAIN_HASH_SIZE * sizeof(uint32_t));
+    memset(last, 0xff, TRAIN_HASH_SIZE * sizeof(uint32_t));
+    memset(active, 0, TRAIN_HASH_SIZE * sizeof(uint16_t));
+    for (i = 0, pos = 0; i < n; i++) {
+        memcpy(corpus + pos, samples[i], sizes[i]);
+        for (j = 0; j < sizes[i]; j++, pos++) {
+            uint32_t h;
+            if (sizes[i] - j < TRAIN_DMER_LEN) {
+                dmers[pos] = TRAIN_NO_DMER;
+                continue;
+            }
+            h = train_hash(corpus + pos);
+            dmers[pos] = h;
+            if (last[h] != (uint32_t)i) {
+                last[h] = (uint32_t)i;
+                count[h]++;
+            }
+        }
+    }
+
+    /* Only content that occurs in more than one sample is worth a place in the dictionary */
+    if (n > 1) {
+        for (i = 0; i < TRAIN_HASH_SIZE; i++) {
+            if (count[i] < 2)
+                count[i] = 0;
+        }
+    }
+
+    epochs = MIN(epochs, MAX(total / TRAIN_SEGMENT_LEN, 1));
+    epoch_len = total / epochs;
+    for (i = 0; i < epochs; i++) {
+        size_t end = i == epochs - 1 ? total : (i + 1) * epoch_len;
+        train_segment seg = train_select(dmers, count, active, i * epoch_len, end);
+        if (seg.score != 0)
+            segments[nsegments++] = seg;
+    }
+
+    /* Fill the dictionary from its end with the best segments first */
+    qsort(segments, nsegments, sizeof(train_segment), train_segment_cmp);
+    for (i = 0; i < nsegments && dict_len < dict_cap; i++) {
+        size_t len = MIN(segments[i].len, dict_cap - dict_len);
+        dict_len += len;
+        memcpy(dict_buf + dict_cap - dict_len, corpus + segments[i].start + segments[i].len - len, len);
+    }
+    if (dict_len < dict_cap)
+        memmove(dict_buf, dict_buf + dict_cap - dict_len, dict_len);
+
+done:
+    zng_free(segments);
+    zng_free(active);
+    zng_free(last);
+    zng_free(count);
+    zng_free(dmers);
+    zng_free(corpus);
+    return dict_len;
+}
+
+#endif
@@ -51,7 +51,9 @@ static void init_functable(void) {
     // Generic code
     ft.force_init = &force_init_empty;
     ft.adler32 = &adler32_c;
+    ft.adler32_combine_n = &adler32_combine_n_c;
     ft.adler32_fold_copy = &adler32_fold_copy_c;
+    ft.adler32_multi = &adler32_multi_c;
     ft.chunkmemset_safe = &chunkmemset_safe_c;
     ft.chunksize = &chunksize_c;
     ft.crc32 = &PREFIX(crc32_braid);
@@ -59,11 +61,20 @@ static void init_functable(void) {
     ft.crc32_fold_copy = &crc32_fold_copy_c;
     ft.crc32_fold_final = &crc32_fold_final_c;
     ft.crc32_fold_reset = &crc32_fold_reset_c;
+    ft.crc32_multi = &crc32_multi_c;
+    ft.crc32c = &crc32c_braid;
+    ft.crc32c_fold = &crc32c_fold_c;
+    ft.crc32c_fold_copy = &crc32c_fold_copy_c;
+    ft.crc32c_fold_final = &crc32c_fold_final_c;
+    ft.crc32c_fold_reset = &crc32c_fold_reset_c;
+    ft.crc64 = &crc64_braid;
+    ft.histogram = &histogram_c;
     ft.inflate_fast = &inflate_fast_c;
     ft.slide_hash = &slide_hash_c;
     ft.longest_match = &longest_match_generic;
     ft.longest_match_slow = &longest_match_slow_generic;
     ft.compare256 = &compare256_generic;
+    ft.compare256_rle = &compare256_rle_generic;
 
     // Select arch-optimized functions
 
@@ -79,6 +90,7 @@ static void init_functable(void) {
         ft.slide_hash = &slide_hash_sse2;
 #  ifdef HAVE_BUILTIN_CTZ
         ft.compare256 = &compare256_sse2;
+        ft.compare256_rle = &compare256_rle_sse2;
         ft.longest_match = &longest_match_sse2;
         ft.longest_match_slow = &longest_match_slow_sse2;
 #  endif
@@ -96,6 +108,7 @@ static void init_functable(void) {
 #ifdef X86_SSE42
     if (cf.x86.has_sse42) {
         ft.adler32_fold_copy = &adler32_fold_copy_sse42;
+        ft.crc32c = &crc32c_sse42;
     }
 #endif
     // X86 - PCLMUL
@@ -106,6 +119,13 @@ static void init_functable(void) {
         ft.crc32_fold_copy = &crc32_fold_pclmulqdq_copy;
         ft.crc32_fold_final = &crc32_fold_pclmulqdq_final;
         ft.crc32_fold_reset = &crc32_fold_pclmulqdq_reset;
+        ft.crc32_multi = &crc32_multi_pclmulqdq;
+        ft.crc32c = &crc32c_pclmulqdq;
+        ft.crc32c_fold = &crc32c_fold_pclmulqdq;
+        ft.crc32c_fold_copy = &crc32c_fold_pclmulqdq_copy;
+        ft.crc32c_fold_final = &crc32c_fold_pclmulqdq_final;
+        ft.crc32c_fold_reset = &crc32c_fold_pclmulqdq_reset;
+        ft.crc64 = &crc64_pclmulqdq;
     }
 #endif
     // X86 - AVX
@@ -116,13 +136,17 @@ static void init_functable(void) {
      * to remain intact. They also allow for a count operand that isn't the CL register, avoiding contention there */
     if (cf.x86.has_avx2 && cf.x86.has_bmi2) {
         ft.adler32 = &adler32_avx2;
+        ft.adler32_combine_n = &adler32_combine_n_avx2;
         ft.adler32_fold_copy = &adler32_fold_copy_avx2;
+        ft.adler32_multi = &adler32_multi_avx2;
         ft.chunkmemset_safe = &chunkmemset_safe_avx2;
         ft.chunksize = &chunksize_avx2;
+        ft.histogram = &histogram_avx2;
         ft.inflate_fast = &inflate_fast_avx2;
         ft.slide_hash = &slide_hash_avx2;
 #  ifdef HAVE_BUILTIN_CTZ
         ft.compare256 = &compare256_avx2;
+        ft.compare256_rle = &compare256_rle_avx2;
         ft.longest_match = &longest_match_avx2;
         ft.longest_match_slow = &longest_match_slow_avx2;
 #  endif
@@ -152,6 +176,12 @@ static void init_functable(void) {
         ft.crc32_fold_copy = &crc32_fold_vpclmulqdq_copy;
         ft.crc32_fold_final = &crc32_fold_vpclmulqdq_final;
         ft.crc32_fold_reset = &crc32_fold_vpclmulqdq_reset;
+        ft.crc32c = &crc32c_vpclmulqdq;
+        ft.crc32c_fold = &crc32c_fold_vpclmulqdq;
+        ft.crc32c_fold_copy = &crc32c_fold_vpclmulqdq_copy;
+        ft.crc32c_fold_final = &crc32c_fold_vpclmulqdq_final;
+        ft.crc32c_fold_reset = &crc32c_fold_vpclmulqdq_reset;
+        ft.crc64 = &crc64_vpclmulqdq;
     }
 #endif
 
@@ -178,6 +208,7 @@ static void init_functable(void) {
         ft.slide_hash = &slide_hash_neon;
 #  ifdef HAVE_BUILTIN_CTZLL
         ft.compare256 = &compare256_neon;
+        ft.compare256_rle = &compare256_rle_neon;
         ft.longest_match = &longest_match_neon;
         ft.longest_match_slow = &longest_match_slow_neon;
 #  endif
@@ -247,15 +278,26 @@ static void init_functable(void) {
     // Assign function pointers individually for atomic operation
     FUNCTABLE_ASSIGN(ft, force_init);
     FUNCTABLE_ASSIGN(ft, adler32);
+    FUNCTABLE_ASSIGN(ft, adler32_combine_n);
     FUNCTABLE_ASSIGN(ft, adler32_fold_copy);
+    FUNCTABLE_ASSIGN(ft, adler32_multi);
     FUNCTABLE_ASSIGN(ft, chunkmemset_safe);
     FUNCTABLE_ASSIGN(ft, chunksize);
     FUNCTABLE_ASSIGN(ft, compare256);
+    FUNCTABLE_ASSIGN(ft, compare256_rle);
     FUNCTABLE_ASSIGN(ft, crc32);
     FUNCTABLE_ASSIGN(ft, crc32_fold);
     FUNCTABLE_ASSIGN(ft, crc32_fold_copy);
     FUNCTABLE_ASSIGN(ft, crc32_fold_final);
     FUNCTABLE_ASSIGN(ft, crc32_fold_reset);
+    FUNCTABLE_ASSIGN(ft, crc32_multi);
+    FUNCTABLE_ASSIGN(ft, crc32c);
+    FUNCTABLE_ASSIGN(ft, crc32c_fold);
+    FUNCTABLE_ASSIGN(ft, crc32c_fold_copy);
+    FUNCTABLE_ASSIGN(ft, crc32c_fold_final);
+    FUNCTABLE_ASSIGN(ft, crc32c_fold_reset);
+    FUNCTABLE_ASSIGN(ft, crc64);
+    FUNCTABLE_ASSIGN(ft, histogram);
     FUNCTABLE_ASSIGN(ft, inflate_fast);
     FUNCTABLE_ASSIGN(ft, longest_match);
     FUNCTABLE_ASSIGN(ft, longest_match_slow);
@@ -275,11 +317,21 @@ static uint32_t adler32_stub(uint32_t adler, const uint8_t* buf, size_t len) {
     return functable.adler32(adler, buf, len);
 }
 
+static uint32_t adler32_combine_n_stub(uint32_t adler, const uint32_t* adlers, size_t n, uint32_t op) {
+    init_functable();
+    return functable.adler32_combine_n(adler, adlers, n, op);
+}
+
 static uint32_t adler32_fold_copy_stub(uint32_t adler, uint8_t* dst, const uint8_t* src, size_t len) {
     init_functable();
     return functable.adler32_fold_copy(adler, dst, src, len);
 }
 
+static void adler32_multi_stub(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    init_functable();
+    functable.adler32_multi(bufs, lens, out, n);
+}
+
 static uint8_t* chunkmemset_safe_stub(uint8_t* out, uint8_t *from, unsigned len, unsigned left) {
     init_functable();
     return functable.chunkmemset_safe(out, from, len, left);
@@ -295,6 +347,11 @@ static uint32_t compare256_stub(const uint8_t* src0, const uint8_t* src1) {
     return functable.compare256(src0, src1);
 }
 
+static uint32_t compare256_rle_stub(const uint8_t* src0, const uint8_t* src1) {
+    init_functable();
+    return functable.compare256_rle(src0, src1);
+}
+
 static uint32_t crc32_stub(uint32_t crc, const uint8_t* buf, size_t len) {
     init_functable();
     return functable.crc32(crc, buf, len);
@@ -320,6 +377,46 @@ static uint32_t crc32_fold_reset_stub(crc32_fold* crc) {
     return functable.crc32_fold_reset(crc);
 }
 
+static void crc32_multi_stub(const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n) {
+    init_functable();
+    functable.crc32_multi(bufs, lens, out, n);
+}
+
+static uint32_t crc32c_stub(uint32_t crc, const uint8_t* buf, size_t len) {
+    init_functable();
+    return functable.crc32c(crc, buf, len);
+}
+
+static void crc32c_fold_stub(crc32_fold* crc, const uint8_t* src, size_t len, uint32_t init_crc) {
+    init_functable();
+    functable.crc32c_fold(crc, src, len, init_crc);
+}
+
+static void crc32c_fold_copy_stub(crc32_fold* crc, uint8_t* dst, const uint8_t* src, size_t len) {
+    init_functable();
+    functable.crc32c_fold_copy(crc, dst, src, len);
+}
+
+static uint32_t crc32c_fold_final_stub(crc32_fold* crc) {
+    init_functable();
+    return functable.crc32c_fold_final(crc);
+}
+
+static uint32_t crc32c_fold_reset_stub(crc32_fold* crc) {
+    init_functable();
+    return functable.crc32c_fold_reset(crc);
+}
+
+static uint64_t crc64_stub(uint64_t crc, const uint8_t* buf, size_t len) {
+    init_functable();
+    return functable.crc64(crc, buf, len);
+}
+
+static void histogram_stub(uint32_t *hist, const uint8_t* buf, size_t len) {
+    init_functable();
+    functable.histogram(hist, buf, len);
+}
+
 static void inflate_fast_stub(PREFIX3(stream) *strm, uint32_t start) {
     init_functable();
     functable.inflate_fast(strm, start);
@@ -344,15 +441,26 @@ static void slide_hash_stub(deflate_state* s) {
 Z_INTERNAL struct functable_s functable = {
     force_init_stub,
     adler32_stub,
+    adler32_combine_n_stub,
     adler32_fold_copy_stub,
+    adler32_multi_stub,
     chunkmemset_safe_stub,
     chunksize_stub,
     compare256_stub,
+    compare256_rle_stub,
     crc32_stub,
     crc32_fold_stub,
     crc32_fold_copy_stub,
     crc32_fold_final_stub,
     crc32_fold_reset_stub,
+    crc32_multi_stub,
+    crc32c_stub,
+    crc32c_fold_stub,
+    crc32c_fold_copy_stub,
+    crc32c_fold_final_stub,
+    crc32c_fold_reset_stub,
+    crc64_stub,
+    histogram_stub,
     inflate_fast_stub,
     longest_match_stub,
     longest_match_slow_stub,
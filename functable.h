@@ -26,15 +26,26 @@
 struct functable_s {
     void     (* force_init)         (void);
     uint32_t (* adler32)            (uint32_t adler, const uint8_t *buf, size_t len);
+    uint32_t (* adler32_combine_n)  (uint32_t adler, const uint32_t *adlers, size_t n, uint32_t op);
     uint32_t (* adler32_fold_copy)  (uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
+    void     (* adler32_multi)      (const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
     uint8_t* (* chunkmemset_safe)   (uint8_t *out, uint8_t *from, unsigned len, unsigned left);
     uint32_t (* chunksize)          (void);
     uint32_t (* compare256)         (const uint8_t *src0, const uint8_t *src1);
+    uint32_t (* compare256_rle)     (const uint8_t *src0, const uint8_t *src1);
     uint32_t (* crc32)              (uint32_t crc, const uint8_t *buf, size_t len);
     void     (* crc32_fold)         (struct crc32_fold_s *crc, const uint8_t *src, size_t len, uint32_t init_crc);
     void     (* crc32_fold_copy)    (struct crc32_fold_s *crc, uint8_t *dst, const uint8_t *src, size_t len);
     uint32_t (* crc32_fold_final)   (struct crc32_fold_s *crc);
     uint32_t (* crc32_fold_reset)   (struct crc32_fold_s *crc);
+    void     (* crc32_multi)        (const uint8_t * const *bufs, const size_t *lens, uint32_t *out, size_t n);
+    uint32_t (* crc32c)             (uint32_t crc, const uint8_t *buf, size_t len);
+    void     (* crc32c_fold)        (struct crc32_fold_s *crc, const uint8_t *src, size_t len, uint32_t init_crc);
+    void     (* crc32c_fold_copy)   (struct crc32_fold_s *crc, uint8_t *dst, const uint8_t *src, size_t len);
+    uint32_t (* crc32c_fold_final)  (struct crc32_fold_s *crc);
+    uint32_t (* crc32c_fold_reset)  (struct crc32_fold_s *crc);
+    uint64_t (* crc64)              (uint64_t crc, const uint8_t *buf, size_t len);
+    void     (* histogram)          (uint32_t *hist, const uint8_t *buf, size_t len);
     void     (* inflate_fast)       (PREFIX3(stream) *strm, uint32_t start);
     uint32_t (* longest_match)      (deflate_state *const s, Pos cur_match);
     uint32_t (* longest_match_slow) (deflate_state *const s, Pos cur_match);
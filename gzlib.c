@@ -65,6 +65,7 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
     state->mode = GZ_NONE;
     state->level = Z_DEFAULT_COMPRESSION;
     state->strategy = Z_DEFAULT_STRATEGY;
+    state->rsyncable = 0;
     state->direct = 0;
     while (*mode) {
         if (*mode >= '0' && *mode <= '9') {
@@ -112,6 +113,11 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
             case 'T':
                 state->direct = 1;
                 break;
+#ifndef ZLIB_COMPAT
+            case 'y':
+                state->rsyncable = 1;
+                break;
+#endif
             default:        /* could consider as an error, but just ignore */
                 {}
             }
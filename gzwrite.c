@@ -50,6 +50,18 @@ static int gz_init(gz_state *state) {
             gz_error(state, Z_MEM_ERROR, "out of memory");
             return -1;
         }
+#ifndef ZLIB_COMPAT
+        if (state->rsyncable) {
+            zng_deflate_param_value param = { Z_DEFLATE_RSYNCABLE, &state->rsyncable, sizeof(state->rsyncable), Z_OK };
+            if (zng_deflateSetParams(strm, &param, 1) != Z_OK) {
+                PREFIX(deflateEnd)(strm);
+                zng_free(state->out);
+                zng_free(state->in);
+                gz_error(state, Z_STREAM_ERROR, "internal error: cannot make deflate stream rsyncable");
+                return -1;
+            }
+        }
+#endif
         strm->next_in = NULL;
     }
 
@@ -0,0 +1,219 @@
+/* hugepage.c -- huge page backed allocation of stream buffers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   The window, prev and head tables of a deflate stream are read at random by the match and hash insertion
+   routines. With many streams at once, each in its own 4K pages, most of these reads miss the TLB. With
+   WITH_HUGE_PAGES, the default allocator of the streams takes their buffers from arenas of 2M, which are huge pages:
+   hugetlbfs pages if some are reserved, and otherwise transparent huge pages, which are asked for with madvise().
+
+   Each arena is cut into slices of the same size, a multiple of HUGE_SLICE_SIZE, so that streams with the same
+   parameters share an arena: five default deflate streams, or thirty inflate streams. A header at the start of the
+   arena keeps track of its slices, so that a slice finds its arena by rounding its address down to the huge page.
+   Arenas with free slices are on a list, and up to HUGE_SPARE_ARENAS arenas with no slice in use are kept there to
+   save the cost of mapping and faulting in a huge page for every stream that is set up. Buffers larger than an
+   arena, as with the large-block memLevels, get an arena of their own, which is unmapped when they are freed.
+ */
+
+/* MAP_ANONYMOUS, MAP_HUGETLB and madvise() are not part of POSIX */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#  define _DEFAULT_SOURCE 1
+#elif defined(__APPLE__) && !defined(_DARWIN_C_SOURCE)
+#  define _DARWIN_C_SOURCE 1
+#endif
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "hugepage.h"
+#include "zthread.h"
+
+#ifdef WITH_HUGE_PAGES
+
+#include <sys/mman.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#  define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#define HUGE_PAGE_SIZE    (2 * 1024 * 1024)
+#define HUGE_SLICE_SIZE   (32 * 1024)   /* slices are a multiple of this */
+#define HUGE_HEADER_SIZE  64            /* room for the arena header, which keeps the slices 64-byte aligned */
+#define HUGE_SPARE_ARENAS 4             /* arenas with no slice in use that are kept mapped */
+
+typedef struct huge_arena_s {
+    struct huge_arena_s *prev;          /* list of arenas with free slices */
+    struct huge_arena_s *next;
+    size_t size;                        /* bytes mapped */
+    size_t slice_size;                  /* 0 for an arena of one buffer larger than a huge page */
+    uint32_t slices;
+    uint64_t used;                      /* bitmap of the slices in use */
+} huge_arena;
+
+/* Bitmap of an arena with all its slices in use, of which there are at most 63 */
+#define HUGE_FULL(arena) (((uint64_t)1 << (arena)->slices) - 1)
+
+static zng_mutex huge_lock = ZNG_MUTEX_INIT;
+static huge_arena *huge_list;           /* arenas with free slices */
+static uint32_t huge_spare;             /* arenas on the list with no slice in use */
+
+/* Set once hugetlbfs pages could not be mapped, read and written without the lock, as huge_map() is also called
+ * without it */
+static int huge_no_hugetlb = 0;
+#if defined(__GNUC__) || defined(__clang__)
+#  define LOAD_NO_HUGETLB()  __atomic_load_n(&huge_no_hugetlb, __ATOMIC_RELAXED)
+#  define STORE_NO_HUGETLB() __atomic_store_n(&huge_no_hugetlb, 1, __ATOMIC_RELAXED)
+#else
+#  define LOAD_NO_HUGETLB()  (*(volatile int *)&huge_no_hugetlb)
+#  define STORE_NO_HUGETLB() (*(volatile int *)&huge_no_hugetlb = 1)
+#endif
+
+/* ===========================================================================
+ * Map size bytes, a multiple of the huge page size, aligned to a huge page.
+ */
+static void *huge_map(size_t size) {
+    uint8_t *map, *aligned;
+
+#ifdef MAP_HUGETLB
+    if (!LOAD_NO_HUGETLB()) {
+        map = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (map != MAP_FAILED)
+            return map;
+        STORE_NO_HUGETLB();
+    }
+#endif
+
+    /* Map one huge page more, and unmap what is before and after the aligned part */
+    map = (uint8_t *)mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED)
+        return NULL;
+    aligned = (uint8_t *)(((uintptr_t)map + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+    if (aligned != map)
+        munmap(map, aligned - map);
+    munmap(aligned + size, map + HUGE_PAGE_SIZE - aligned);
+#ifdef MADV_HUGEPAGE
+    madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+
+static void huge_link(huge_arena *arena) {
+    arena->prev = NULL;
+    arena->next = huge_list;
+    if (huge_list != NULL)
+        huge_list->prev = arena;
+    huge_list = arena;
+}
+
+static void huge_unlink(huge_arena *arena) {
+    if (arena->prev != NULL)
+        arena->prev->next = arena->next;
+    else
+        huge_list = arena->next;
+    if (arena->next != NULL)
+        arena->next->prev = arena->prev;
+}
+
+/* Cut an arena with no slice in use into slices of slice_size bytes */
+static void huge_slice(huge_arena *arena, size_t slice_size) {
+    arena->slice_size = slice_size;
+    arena->slices = (uint32_t)((HUGE_PAGE_SIZE - HUGE_HEADER_SIZE) / slice_size);
+}
+
+/* ===========================================================================
+ * Allocate size bytes in a slice of an arena with room for them, of a spare
+ * arena, or of a new one.
+ */
+void Z_INTERNAL *huge_alloc(size_t size) {
+    size_t slice_size = (size + HUGE_SLICE_SIZE - 1) & ~(size_t)(HUGE_SLICE_SIZE - 1);
+    huge_arena *arena;
+    uint32_t slice;
+
+    if (size > HUGE_PAGE_SIZE - HUGE_HEADER_SIZE) {
+        size_t map_size = (size + HUGE_HEADER_SIZE + HUGE_PAGE_SIZE - 1) & ~(size_t)(HUGE_PAGE_SIZE - 1);
+        arena = (huge_arena *)huge_map(map_size);
+        if (arena == NULL)
+            return NULL;
+        arena->size = map_size;
+        arena->slice_size = 0;
+        arena->slices = 1;
+        arena->used = 1;
+        return (uint8_t *)arena + HUGE_HEADER_SIZE;
+    }
+    if (slice_size > HUGE_PAGE_SIZE - HUGE_HEADER_SIZE)
+        slice_size = HUGE_PAGE_SIZE - HUGE_HEADER_SIZE;
+
+    zng_mutex_lock(&huge_lock);
+    for (arena = huge_list; arena != NULL; arena = arena->next) {
+        if (arena->slice_size == slice_size)
+            break;
+    }
+    if (arena == NULL) {
+        for (arena = huge_list; arena != NULL; arena = arena->next) {
+            if (arena->used == 0) {
+                huge_slice(arena, slice_size);
+                break;
+            }
+        }
+    }
+    if (arena == NULL) {
+        arena = (huge_arena *)huge_map(HUGE_PAGE_SIZE);
+        if (arena == NULL) {
+            zng_mutex_unlock(&huge_lock);
+            return NULL;
+        }
+        arena->size = HUGE_PAGE_SIZE;
+        arena->used = 0;
+        huge_slice(arena, slice_size);
+        huge_link(arena);
+    } else if (arena->used == 0) {
+        huge_spare--;
+    }
+
+    for (slice = 0; arena->used & ((uint64_t)1 << slice); slice++);
+    arena->used |= (uint64_t)1 << slice;
+    if (arena->used == HUGE_FULL(arena))
+        huge_unlink(arena);
+    zng_mutex_unlock(&huge_lock);
+
+    return (uint8_t *)arena + HUGE_HEADER_SIZE + slice * slice_size;
+}
+
+/* ===========================================================================
+ * Give a slice back to its arena, and unmap the arena if it is no longer in
+ * use and enough others are spare.
+ */
+void Z_INTERNAL huge_free(void *ptr) {
+    huge_arena *arena = (huge_arena *)((uintptr_t)ptr & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+    uint32_t slice;
+    int unmap = 0;
+
+    if (ptr == NULL)
+        return;
+    if (arena->slice_size == 0) {
+        munmap(arena, arena->size);
+        return;
+    }
+
+    slice = (uint32_t)(((uint8_t *)ptr - (uint8_t *)arena - HUGE_HEADER_SIZE) / arena->slice_size);
+
+    zng_mutex_lock(&huge_lock);
+    Assert(arena->used & ((uint64_t)1 << slice), "slice freed twice");
+    if (arena->used == HUGE_FULL(arena))
+        huge_link(arena);
+    arena->used &= ~((uint64_t)1 << slice);
+    if (arena->used == 0) {
+        if (huge_spare < HUGE_SPARE_ARENAS) {
+            huge_spare++;
+        } else {
+            huge_unlink(arena);
+            unmap = 1;
+        }
+    }
+    zng_mutex_unlock(&huge_lock);
+
+    if (unmap)
+        munmap(arena, arena->size);
+}
+
+#endif
@@ -0,0 +1,14 @@
+/* hugepage.h -- huge page backed allocation of stream buffers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef HUGEPAGE_H_
+#define HUGEPAGE_H_
+
+#ifdef WITH_HUGE_PAGES
+/* Memory from huge_alloc() must be freed with huge_free(), and the other way around */
+void Z_INTERNAL *huge_alloc(size_t size);
+void Z_INTERNAL  huge_free(void *ptr);
+#endif
+
+#endif /* HUGEPAGE_H_ */
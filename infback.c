@@ -59,6 +59,7 @@ int32_t ZNG_CONDEXPORT PREFIX(inflateBackInit)(PREFIX3(stream) *strm, int32_t wi
     state->window = window;
     state->wnext = 0;
     state->whave = 0;
+    state->wrap = 0;                    /* no check value, also for inflate_fast() */
     state->chunksize = FUNCTABLE_CALL(chunksize)();
 #ifdef INFLATE_STRICT
     state->dmax = 32768U;
@@ -114,6 +114,8 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
     unsigned char *from;        /* where to copy match from */
     unsigned dist;              /* match distance */
     unsigned extra_safe;        /* copy chunks safely in all cases */
+    unsigned char *chk;         /* output before chk is in the check value, NULL if not checking */
+    unsigned char *limit;       /* end, or where to stop decoding next to update the check value */
 
     /* copy state to local variables */
     state = (struct inflate_state *)strm->state;
@@ -139,6 +141,21 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
        window is overwritten then future matches with far distances will fail to copy correctly. */
     extra_safe = (wsize != 0 && out >= window && out + INFLATE_FAST_MIN_LEFT <= window + state->wbufsize);
 
+    /* Fold the output into the check value every INFLATE_FAST_CHKSUM_LEN bytes while it is still in the L1 cache,
+       instead of leaving it all to inflate() on return. Decoding stops early at limit for that, and inflate() calls
+       again while there is enough input and output left, so the inner loop is unchanged. Output written by inflate()
+       itself since it last checked is folded in first, state->checked then tells inflate() how much to skip. */
+    chk = NULL;
+    limit = end;
+    if (INFLATE_NEED_CHECKSUM(strm) && (state->wrap & 4)) {
+        chk = beg + state->checked;
+        if (out > chk)
+            inf_chksum_update(strm, chk, (uint32_t)(out - chk));
+        chk = out;
+        if (end - out > INFLATE_FAST_CHKSUM_LEN)
+            limit = out + INFLATE_FAST_CHKSUM_LEN;
+    }
+
 #define REFILL() do { \
         hold |= load_64_bits(in, bits); \
         in += 7; \
@@ -295,7 +312,7 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
             SET_BAD("invalid literal/length code");
             break;
         }
-    } while (in < last && out < end);
+    } while (in < last && out < limit);
 
     /* return unused bytes (on entry, bits < 8, so in won't go too far back) */
     len = bits >> 3;
@@ -303,6 +320,11 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
     bits -= len << 3;
     hold &= (UINT64_C(1) << bits) - 1;
 
+    if (chk != NULL) {
+        inf_chksum_update(strm, chk, (uint32_t)(out - chk));
+        state->checked = (uint32_t)(out - beg);
+    }
+
     /* update state and return */
     strm->next_in = in;
     strm->next_out = out;
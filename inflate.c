@@ -22,10 +22,25 @@ static int inflateStateCheck(PREFIX3(stream) *strm);
 static void updatewindow(PREFIX3(stream) *strm, const uint8_t *end, uint32_t len, int32_t cksum);
 static uint32_t syncsearch(uint32_t *have, const unsigned char *buf, uint32_t len);
 
+/* Output bytes that inflate_fast() already folded into the check value are skipped, see state->checked */
+static inline uint32_t inf_chksum_skip(struct inflate_state *state, uint32_t len) {
+    uint32_t skip = MIN(state->checked, len);
+    state->checked -= skip;
+    return skip;
+}
+
 static inline void inf_chksum_cpy(PREFIX3(stream) *strm, uint8_t *dst,
                            const uint8_t *src, uint32_t copy) {
     if (!copy) return;
     struct inflate_state *state = (struct inflate_state*)strm->state;
+    uint32_t skip = inf_chksum_skip(state, copy);
+    if (skip) {
+        memcpy(dst, src, skip);
+        dst += skip;
+        src += skip;
+        copy -= skip;
+        if (!copy) return;
+    }
 #ifdef GUNZIP
     if (state->flags) {
         FUNCTABLE_CALL(crc32_fold_copy)(&state->crc_fold, dst, src, copy);
@@ -38,14 +53,9 @@ static inline void inf_chksum_cpy(PREFIX3(stream) *strm, uint8_t *dst,
 
 static inline void inf_chksum(PREFIX3(stream) *strm, const uint8_t *src, uint32_t len) {
     struct inflate_state *state = (struct inflate_state*)strm->state;
-#ifdef GUNZIP
-    if (state->flags) {
-        FUNCTABLE_CALL(crc32_fold)(&state->crc_fold, src, len, 0);
-    } else
-#endif
-    {
-        strm->adler = state->check = FUNCTABLE_CALL(adler32)(state->check, src, len);
-    }
+    uint32_t skip = inf_chksum_skip(state, len);
+    if (len - skip)
+        inf_chksum_update(strm, src + skip, len - skip);
 }
 
 static int inflateStateCheck(PREFIX3(stream) *strm) {
@@ -246,6 +256,9 @@ int32_t ZNG_CONDEXPORT PREFIX(inflateInit2)(PREFIX3(stream) *strm, int32_t windo
     strm->state = (struct internal_state *)state;
     state->strm = strm;
     state->mode = HEAD;     /* to pass state test in inflateReset2() */
+#ifndef ZLIB_COMPAT
+    offload_init(&state->offload);
+#endif
     state->chunksize = FUNCTABLE_CALL(chunksize)();
     ret = PREFIX(inflateReset2)(strm, windowBits);
     if (ret != Z_OK) {
@@ -503,6 +516,7 @@ int32_t Z_EXPORT PREFIX(inflate)(PREFIX3(stream) *strm, int32_t flush) {
     LOAD();
     in = have;
     out = left;
+    state->checked = 0;
     ret = Z_OK;
     for (;;)
         switch (state->mode) {
@@ -1124,6 +1138,7 @@ int32_t Z_EXPORT PREFIX(inflate)(PREFIX3(stream) *strm, int32_t flush) {
 #endif
                 }
                 out = left;
+                state->checked = 0;
                 if ((state->wrap & 4) && (
 #ifdef GUNZIP
                      state->flags ? hold :
@@ -1204,6 +1219,8 @@ int32_t Z_EXPORT PREFIX(inflateEnd)(PREFIX3(stream) *strm) {
     if (inflateStateCheck(strm))
         return Z_STREAM_ERROR;
 
+    INFLATE_END_HOOK(strm);  /* hook for offload providers */
+
     /* Free allocated buffers */
     free_inflate(strm);
 
@@ -1383,6 +1400,7 @@ int32_t Z_EXPORT PREFIX(inflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     /* check input */
     if (inflateStateCheck(source) || dest == NULL)
         return Z_STREAM_ERROR;
+    INFLATE_COPY_HOOK(source);  /* hook for offload providers */
     state = (struct inflate_state *)source->state;
 
     /* copy stream */
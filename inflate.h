@@ -12,6 +12,7 @@
 #define INFLATE_H_
 
 #include "crc32.h"
+#include "offload.h"
 
 #ifdef S390_DFLTCC_INFLATE
 #  include "arch/s390/dfltcc_common.h"
@@ -150,6 +151,8 @@ struct ALIGNED_(64) inflate_state {
     code codes[ENOUGH];         /* space for code tables */
 
     inflate_allocs *alloc_bufs; /* struct for handling memory allocations */
+    uint32_t checked;           /* output bytes since inflate() last set out that inflate_fast() has already
+                                   folded into the check value */
 
 #ifdef INFLATE_STRICT
     unsigned dmax;              /* zlib header max distance (INFLATE_STRICT) */
@@ -160,6 +163,9 @@ struct ALIGNED_(64) inflate_state {
 #ifdef HAVE_ARCH_INFLATE_STATE
     arch_inflate_state arch;    /* architecture-specific extensions */
 #endif
+#ifndef ZLIB_COMPAT
+    offload_state offload;      /* offload provider session */
+#endif
 #if defined(_M_IX86) || defined(_M_ARM)
     int padding2[8];
 #endif
@@ -6,6 +6,7 @@
 #define INFLATE_P_H
 
 #include <stdlib.h>
+#include "functable.h"
 
 /* Architecture-specific hooks. */
 #ifdef S390_DFLTCC_INFLATE
@@ -20,24 +21,36 @@
 #  define HINT_ALIGNED_WINDOW   HINT_ALIGNED_64
 /* Adjust the window size for the arch-specific inflate code. */
 #  define INFLATE_ADJUST_WINDOW_SIZE(n) (n)
+#  ifndef ZLIB_COMPAT
+#    include "offload_inflate.h"
+#  else
 /* Invoked at the end of inflateResetKeep(). Useful for initializing arch-specific extension blocks. */
-#  define INFLATE_RESET_KEEP_HOOK(strm) do {} while (0)
+#    define INFLATE_RESET_KEEP_HOOK(strm) do {} while (0)
 /* Invoked at the beginning of inflatePrime(). Useful for updating arch-specific buffers. */
-#  define INFLATE_PRIME_HOOK(strm, bits, value) do {} while (0)
+#    define INFLATE_PRIME_HOOK(strm, bits, value) do {} while (0)
 /* Invoked at the beginning of each block. Useful for plugging arch-specific inflation code. */
-#  define INFLATE_TYPEDO_HOOK(strm, flush) do {} while (0)
+#    define INFLATE_TYPEDO_HOOK(strm, flush) do {} while (0)
 /* Returns whether zlib-ng should compute a checksum. Set to 0 if arch-specific inflation code already does that. */
-#  define INFLATE_NEED_CHECKSUM(strm) 1
+#    define INFLATE_NEED_CHECKSUM(strm) 1
 /* Returns whether zlib-ng should update a window. Set to 0 if arch-specific inflation code already does that. */
-#  define INFLATE_NEED_UPDATEWINDOW(strm) 1
+#    define INFLATE_NEED_UPDATEWINDOW(strm) 1
 /* Invoked at the beginning of inflateMark(). Useful for updating arch-specific pointers and offsets. */
-#  define INFLATE_MARK_HOOK(strm) do {} while (0)
+#    define INFLATE_MARK_HOOK(strm) do {} while (0)
 /* Invoked at the beginning of inflateSyncPoint(). Useful for performing arch-specific state checks. */
-#  define INFLATE_SYNC_POINT_HOOK(strm) do {} while (0)
+#    define INFLATE_SYNC_POINT_HOOK(strm) do {} while (0)
 /* Invoked at the beginning of inflateSetDictionary(). Useful for checking arch-specific window data. */
-#  define INFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
+#    define INFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
 /* Invoked at the beginning of inflateGetDictionary(). Useful for adjusting arch-specific window data. */
-#  define INFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
+#    define INFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) do {} while (0)
+#  endif
+#endif
+/* Invoked at the beginning of inflateCopy(). Useful for rejecting streams with arch-specific state that can't be copied. */
+#ifndef INFLATE_COPY_HOOK
+#  define INFLATE_COPY_HOOK(strm) do {} while (0)
+#endif
+/* Invoked at the beginning of inflateEnd(). Useful for releasing arch-specific resources. */
+#ifndef INFLATE_END_HOOK
+#  define INFLATE_END_HOOK(strm) do {} while (0)
 #endif
 
 /*
@@ -52,6 +65,19 @@
 #  define UPDATE(check, buf, len) FUNCTABLE_CALL(adler32)(check, buf, len)
 #endif
 
+/* Fold len output bytes into the running check value, crc32 for gzip or adler32 for zlib */
+static inline void inf_chksum_update(PREFIX3(stream) *strm, const uint8_t *src, uint32_t len) {
+    struct inflate_state *state = (struct inflate_state*)strm->state;
+#ifdef GUNZIP
+    if (state->flags) {
+        FUNCTABLE_CALL(crc32_fold)(&state->crc_fold, src, len, 0);
+    } else
+#endif
+    {
+        strm->adler = state->check = FUNCTABLE_CALL(adler32)(state->check, src, len);
+    }
+}
+
 /* check macros for header crc */
 #ifdef GUNZIP
 #  define CRC2(check, word) \
@@ -135,6 +161,8 @@
 
 #define INFLATE_FAST_MIN_HAVE 15
 #define INFLATE_FAST_MIN_LEFT 260
+/* Output inflate_fast() accumulates before folding it into the check value */
+#define INFLATE_FAST_CHKSUM_LEN 4096
 
 /* Load 64 bits from IN and place the bytes at offset BITS in the result. */
 static inline uint64_t load_64_bits(const unsigned char *in, unsigned bits) {
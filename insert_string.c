@@ -7,15 +7,16 @@
 
 #include "zbuild.h"
 #include "deflate.h"
+#include "insert_string_p.h"
 
-#define HASH_SLIDE           16
+Z_INTERNAL uint32_t update_hash(uint32_t h, uint32_t val) {
+    return update_hash_static(h, val);
+}
 
-#define HASH_CALC(h, val)    h = ((val * 2654435761U) >> HASH_SLIDE);
-#define HASH_CALC_VAR        h
-#define HASH_CALC_VAR_INIT   uint32_t h = 0
+Z_INTERNAL void insert_string(deflate_state *const s, uint32_t str, uint32_t count) {
+    insert_string_static(s, str, count);
+}
 
-#define UPDATE_HASH          update_hash
-#define INSERT_STRING        insert_string
-#define QUICK_INSERT_STRING  quick_insert_string
-
-#include "insert_string_tpl.h"
+Z_INTERNAL Pos quick_insert_string(deflate_state *const s, uint32_t str) {
+    return quick_insert_string_static(s, str);
+}
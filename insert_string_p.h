@@ -0,0 +1,33 @@
+/* insert_string_p.h -- Inline insert_string integer hash variant
+ *
+ * Copyright (C) 1995-2024 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ */
+
+#ifndef INSERT_STRING_P_H_
+#define INSERT_STRING_P_H_
+
+/* The deflate loops that always use the integer hash include this to have the
+ * hash insertion inlined into them, instead of calling insert_string() for
+ * every position. */
+
+#define HASH_SLIDE           16
+
+#define HASH_CALC(h, val)    h = ((val * 2654435761U) >> HASH_SLIDE);
+#define HASH_CALC_VAR        h
+#define HASH_CALC_VAR_INIT   uint32_t h = 0
+
+#define INSERT_STRING_LINKAGE static inline
+#define UPDATE_HASH          update_hash_static
+#define INSERT_STRING        insert_string_static
+#define QUICK_INSERT_STRING  quick_insert_string_static
+
+#include "insert_string_tpl.h"
+
+#undef INSERT_STRING_LINKAGE
+#undef UPDATE_HASH
+#undef INSERT_STRING
+#undef QUICK_INSERT_STRING
+
+#endif
@@ -0,0 +1,185 @@
+/* offload.c -- registry of runtime pluggable offload providers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "offload.h"
+#include "zthread.h"
+
+#ifndef ZLIB_COMPAT
+
+static const zng_offload_provider *providers[OFFLOAD_MAX_PROVIDERS];
+static int provider_count = 0;
+
+#ifdef WITH_THREADS
+static zng_mutex providers_lock = ZNG_MUTEX_INIT;
+#  define LOCK_PROVIDERS()   zng_mutex_lock(&providers_lock)
+#  define UNLOCK_PROVIDERS() zng_mutex_unlock(&providers_lock)
+#else
+#  define LOCK_PROVIDERS()   do {} while (0)
+#  define UNLOCK_PROVIDERS() do {} while (0)
+#endif
+
+/* Capabilities of the registered providers, written with the lock held and read without it */
+static uint32_t provider_caps = 0;
+#if defined(__GNUC__) || defined(__clang__)
+#  define LOAD_CAPS()      __atomic_load_n(&provider_caps, __ATOMIC_ACQUIRE)
+#  define STORE_CAPS(caps) __atomic_store_n(&provider_caps, (caps), __ATOMIC_RELEASE)
+#else
+#  define LOAD_CAPS()      (*(volatile uint32_t *)&provider_caps)
+#  define STORE_CAPS(caps) (*(volatile uint32_t *)&provider_caps = (caps))
+#endif
+
+/* Update provider_caps after the list changed, with the lock held */
+static void update_caps(void) {
+    uint32_t caps = 0;
+    int i;
+
+    for (i = 0; i < provider_count; i++)
+        caps |= providers[i]->caps;
+    STORE_CAPS(caps);
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_offload_register(const zng_offload_provider *provider) {
+    int32_t ret = Z_OK;
+    int i;
+
+    if (provider == NULL || provider->open == NULL || provider->submit == NULL ||
+        provider->complete == NULL || provider->close == NULL)
+        return Z_STREAM_ERROR;
+
+    LOCK_PROVIDERS();
+    for (i = 0; i < provider_count; i++) {
+        if (providers[i] == provider)
+            break;
+    }
+    if (i == provider_count) {
+        if (provider_count == OFFLOAD_MAX_PROVIDERS)
+            ret = Z_MEM_ERROR;
+        else
+            providers[provider_count++] = provider;
+    }
+    update_caps();
+    UNLOCK_PROVIDERS();
+    return ret;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_offload_unregister(const zng_offload_provider *provider) {
+    int32_t ret = Z_STREAM_ERROR;
+    int i;
+
+    LOCK_PROVIDERS();
+    for (i = 0; i < provider_count; i++) {
+        if (providers[i] == provider) {
+            /* Keep registration order, it defines provider priority */
+            memmove(&providers[i], &providers[i + 1], (provider_count - i - 1) * sizeof(providers[0]));
+            providers[--provider_count] = NULL;
+            ret = Z_OK;
+            break;
+        }
+    }
+    update_caps();
+    UNLOCK_PROVIDERS();
+    return ret;
+}
+
+/* ========================================================================= */
+Z_INTERNAL void offload_init(offload_state *offload) {
+    offload->provider = NULL;
+    offload->session = NULL;
+    offload->mode = OFFLOAD_UNDECIDED;
+    offload->busy = 0;
+    offload->fallback = 0;
+    offload->staged = 0;
+    memset(&offload->job, 0, sizeof(offload->job));
+}
+
+/* ========================================================================= */
+Z_INTERNAL int offload_registered(uint32_t caps) {
+    return (LOAD_CAPS() & caps) == caps;
+}
+
+/* ========================================================================= */
+Z_INTERNAL void offload_open(offload_state *offload, int32_t type, int32_t level, int32_t strategy, int32_t window_bits) {
+    int i;
+
+    offload->mode = OFFLOAD_SOFTWARE;
+
+    /* The lock is held while opening, so that a provider can't be unregistered halfway through open() */
+    LOCK_PROVIDERS();
+    for (i = 0; i < provider_count; i++) {
+        const zng_offload_provider *provider = providers[i];
+        void *session = NULL;
+
+        if ((provider->caps & (uint32_t)type) == 0)
+            continue;
+        if (provider->open(provider->opaque, &session, type, level, strategy, window_bits) == Z_OK) {
+            offload->provider = provider;
+            offload->session = session;
+            offload->mode = OFFLOAD_ACTIVE;
+            break;
+        }
+    }
+    UNLOCK_PROVIDERS();
+}
+
+/* ========================================================================= */
+Z_INTERNAL int32_t offload_submit(offload_state *offload) {
+    const zng_offload_provider *provider = offload->provider;
+    zng_offload_job *job = &offload->job;
+    int32_t err;
+
+    job->session = offload->session;
+    job->status = Z_OK;
+    job->msg = NULL;
+
+    err = provider->submit(provider->opaque, job);
+    if (err != Z_OK)
+        job->status = err;
+    else
+        offload->busy = 1;
+    return err;
+}
+
+/* ========================================================================= */
+Z_INTERNAL int32_t offload_complete(offload_state *offload) {
+    const zng_offload_provider *provider = offload->provider;
+    zng_offload_job *job = &offload->job;
+    int32_t err;
+
+    if (offload->busy) {
+        offload->busy = 0;
+        err = provider->complete(provider->opaque, job);
+        if (err != Z_OK)
+            job->status = err;
+    }
+    return job->status;
+}
+
+/* ========================================================================= */
+Z_INTERNAL int32_t offload_run(offload_state *offload) {
+    if (offload_submit(offload) == Z_OK)
+        offload_complete(offload);
+    return offload->job.status;
+}
+
+/* ========================================================================= */
+Z_INTERNAL void offload_close(offload_state *offload) {
+    /* The provider may still be writing to the buffers of the stream */
+    offload_complete(offload);
+    offload->fallback = 0;
+    offload->staged = 0;
+    offload->job.avail_in = 0;
+    if (offload->session != NULL)
+        offload->provider->close(offload->provider->opaque, offload->session);
+
+    offload->provider = NULL;
+    offload->session = NULL;
+    if (offload->mode != OFFLOAD_OFF)
+        offload->mode = OFFLOAD_UNDECIDED;
+}
+
+#endif /* ZLIB_COMPAT */
@@ -0,0 +1,61 @@
+/* offload.h -- Internal interface for runtime pluggable offload providers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef OFFLOAD_H_
+#define OFFLOAD_H_
+
+#ifndef ZLIB_COMPAT
+
+/* Maximum number of providers that can be registered at the same time */
+#define OFFLOAD_MAX_PROVIDERS 8
+
+/* Offload state of a single stream */
+typedef enum {
+    OFFLOAD_UNDECIDED = 0,  /* stream has not started yet, provider is chosen on first use */
+    OFFLOAD_OFF,            /* offloading was disabled by the application */
+    OFFLOAD_SOFTWARE,       /* no provider accepted the stream, it is processed in software */
+    OFFLOAD_ACTIVE,         /* stream is processed by the provider */
+    OFFLOAD_FAILED          /* provider failed, the stream can only be reset or ended */
+} offload_mode;
+
+typedef struct offload_state_s {
+    const zng_offload_provider *provider;   /* provider that owns the session */
+    void *session;                          /* provider session, valid when mode is OFFLOAD_ACTIVE */
+    offload_mode mode;
+    int busy;                               /* job has been submitted and not completed yet */
+    int fallback;                           /* deflate: continue in software once a full flush is done */
+    size_t staged;                          /* deflate: input bytes handed over with the outstanding job */
+    zng_offload_job job;                    /* current job, owned by the provider while busy */
+} offload_state;
+
+/* Resets the state of a stream that has just been allocated. */
+Z_INTERNAL void offload_init(offload_state *offload);
+
+/* Returns whether a registered provider has the given capability, without taking the lock of the provider list.
+ * Since providers may be registered and unregistered concurrently, it is only a hint for streams being set up. */
+Z_INTERNAL int offload_registered(uint32_t caps);
+
+/* Opens a session on the first provider that accepts it. Updates mode to either OFFLOAD_ACTIVE or OFFLOAD_SOFTWARE. */
+Z_INTERNAL void offload_open(offload_state *offload, int32_t type, int32_t level, int32_t strategy, int32_t window_bits);
+
+/* Submits the current job without waiting for it. Returns Z_OK if the job is outstanding, the error otherwise. */
+Z_INTERNAL int32_t offload_submit(offload_state *offload);
+
+/* Waits for the outstanding job, if any. Returns the job status. */
+Z_INTERNAL int32_t offload_complete(offload_state *offload);
+
+/* Submits the current job and waits for its completion. Returns the job status. */
+Z_INTERNAL int32_t offload_run(offload_state *offload);
+
+/* Waits for the outstanding job, closes the session, if any, and returns to mode OFFLOAD_UNDECIDED unless offloading
+ * was disabled. */
+Z_INTERNAL void offload_close(offload_state *offload);
+
+/* Prevents a stream from being offloaded, used by providers that are themselves built on top of zlib-ng streams. */
+Z_INTERNAL void offload_disable_deflate(PREFIX3(stream) *strm);
+Z_INTERNAL void offload_disable_inflate(PREFIX3(stream) *strm);
+
+#endif /* ZLIB_COMPAT */
+
+#endif /* OFFLOAD_H_ */
@@ -0,0 +1,144 @@
+/* offload_deflate.c -- deflate support for runtime pluggable offload providers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "offload_deflate.h"
+
+/* Returns whether the stream is still in a state where a provider can take over the whole deflate body */
+static inline int offload_deflate_can_start(deflate_state *s) {
+    return !s->reproducible && !s->rsyncable && s->strstart == 0 && s->lookahead == 0 && s->block_start == 0 && s->bi_valid == 0;
+}
+
+void Z_INTERNAL PREFIX(offload_reset_deflate_state)(PREFIX3(streamp) strm) {
+    offload_close(&strm->state->offload);
+}
+
+void Z_INTERNAL PREFIX(offload_end_deflate)(PREFIX3(streamp) strm) {
+    offload_close(&strm->state->offload);
+}
+
+Z_INTERNAL void offload_disable_deflate(PREFIX3(stream) *strm) {
+    strm->state->offload.mode = OFFLOAD_OFF;
+}
+
+int Z_INTERNAL PREFIX(offload_deflate_may_engage)(PREFIX3(streamp) strm) {
+    offload_state *offload = &strm->state->offload;
+
+    if (offload->mode == OFFLOAD_ACTIVE)
+        return 1;
+    return offload->mode == OFFLOAD_UNDECIDED && offload_registered(Z_OFFLOAD_DEFLATE);
+}
+
+int Z_INTERNAL PREFIX(offload_deflate_done)(PREFIX3(streamp) strm, int flush) {
+    offload_state *offload = &strm->state->offload;
+
+    Z_UNUSED(flush);
+    return offload->mode != OFFLOAD_ACTIVE || (strm->state->pending == 0 && !offload->busy);
+}
+
+void Z_INTERNAL PREFIX(offload_deflate_params)(PREFIX3(streamp) strm, int level, int strategy, int *flush) {
+    deflate_state *s = strm->state;
+
+    if (s->offload.mode != OFFLOAD_ACTIVE || (level == s->level && strategy == s->strategy))
+        return;
+
+    /* A session keeps the parameters it was opened with, so let the provider end its data with a full flush and
+     * compress the rest of the stream in software, which needs no history after that flush */
+    s->offload.fallback = 1;
+    *flush = Z_FULL_FLUSH;
+}
+
+/* Marks the stream as failed after the provider returned an error */
+static int offload_deflate_fail(PREFIX3(streamp) strm, block_state *result) {
+    offload_state *offload = &strm->state->offload;
+    int32_t status = offload->job.status;
+
+    strm->msg = (char *)(offload->job.msg != NULL ? offload->job.msg : ERR_MSG(status));
+    offload_close(offload);
+    offload->mode = OFFLOAD_FAILED;
+    *result = need_more;
+    return 1;
+}
+
+int Z_INTERNAL PREFIX(offload_deflate)(PREFIX3(streamp) strm, int flush, block_state *result) {
+    deflate_state *s = strm->state;
+    offload_state *offload = &s->offload;
+    zng_offload_job *job = &offload->job;
+    int32_t status;
+
+    if (offload->mode == OFFLOAD_UNDECIDED) {
+        if (offload_registered(Z_OFFLOAD_DEFLATE) && offload_deflate_can_start(s))
+            offload_open(offload, Z_OFFLOAD_DEFLATE, s->level, s->strategy, (int32_t)s->w_bits);
+        else
+            offload->mode = OFFLOAD_SOFTWARE;
+    }
+    if (offload->mode != OFFLOAD_ACTIVE)
+        return 0;
+
+    /* Input is staged in the window, which the provider makes no other use of, and output is produced into
+     * pending_buf. Both belong to the stream, so a job can run while deflate() returns to the application, which
+     * is what happens to the last input of a Z_NO_FLUSH call. The job is completed by the next call of deflate(),
+     * deflateParams(), deflateReset() or deflateEnd(). Flushes are performed by the provider, so block_done is
+     * never reported. */
+    *result = need_more;
+    for (;;) {
+        if (offload->busy) {
+            status = offload_complete(offload);
+            s->pending = (uint32_t)(job->next_out - s->pending_buf);
+            s->pending_out = s->pending_buf;
+
+            if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR)
+                return offload_deflate_fail(strm, result);
+
+            PREFIX(flush_pending)(strm);
+
+            if (status == Z_STREAM_END) {
+                /* The trailer may only be written once pending_buf is empty */
+                *result = s->pending ? finish_started : finish_done;
+                return 1;
+            }
+            if (job->flush == flush && flush != Z_NO_FLUSH && strm->avail_in == 0 && job->avail_in == 0 &&
+                job->avail_out != 0) {
+                /* The flush is complete */
+                if (offload->fallback && flush == Z_FULL_FLUSH) {
+                    offload_close(offload);
+                    offload->mode = OFFLOAD_SOFTWARE;
+                }
+                return 1;
+            }
+            /* Stop when the output does not fit or the provider made no progress */
+            if (s->pending != 0 || (job->next_out == s->pending_buf && job->avail_in == offload->staged))
+                return 1;
+        }
+
+        /* Move the input the provider left over to the start of the window and add as much new input as fits */
+        if (job->avail_in != 0 && job->next_in != s->window)
+            memmove(s->window, job->next_in, job->avail_in);
+        job->avail_in += PREFIX(read_buf)(strm, s->window + job->avail_in, s->window_size - (unsigned)job->avail_in);
+        job->next_in = s->window;
+
+        job->type = Z_OFFLOAD_DEFLATE;
+        job->flush = strm->avail_in == 0 ? flush : Z_NO_FLUSH;
+        if (job->avail_in == 0 && job->flush == Z_NO_FLUSH)
+            return 1;
+        job->next_out = s->pending_buf;
+        job->avail_out = s->pending_buf_size;
+        offload->staged = job->avail_in;
+
+        if (offload_submit(offload) != Z_OK)
+            return offload_deflate_fail(strm, result);
+
+        /* Let the provider work on the last input while the application prepares the next */
+        if (job->flush == Z_NO_FLUSH && strm->avail_in == 0)
+            return 1;
+    }
+}
+
+#endif /* ZLIB_COMPAT */
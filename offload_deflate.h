@@ -0,0 +1,53 @@
+#ifndef OFFLOAD_DEFLATE_H_
+#define OFFLOAD_DEFLATE_H_
+
+/* Deflate hooks that hand the compressed body of a stream over to a registered offload provider. */
+
+#include "deflate.h"
+
+int Z_INTERNAL PREFIX(offload_deflate)(PREFIX3(streamp) strm, int flush, block_state *result);
+int Z_INTERNAL PREFIX(offload_deflate_done)(PREFIX3(streamp) strm, int flush);
+int Z_INTERNAL PREFIX(offload_deflate_may_engage)(PREFIX3(streamp) strm);
+void Z_INTERNAL PREFIX(offload_deflate_params)(PREFIX3(streamp) strm, int level, int strategy, int *flush);
+void Z_INTERNAL PREFIX(offload_reset_deflate_state)(PREFIX3(streamp) strm);
+void Z_INTERNAL PREFIX(offload_end_deflate)(PREFIX3(streamp) strm);
+
+#define OFFLOAD_DEFLATE_ACTIVE(strm) ((strm)->state->offload.mode == OFFLOAD_ACTIVE)
+
+#define DEFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) \
+    do { if (OFFLOAD_DEFLATE_ACTIVE((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define DEFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) \
+    do { if (OFFLOAD_DEFLATE_ACTIVE((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define DEFLATE_RESET_KEEP_HOOK PREFIX(offload_reset_deflate_state)
+
+/* Changing the parameters of an engaged stream makes it continue in software after a full flush */
+#define DEFLATE_PARAMS_HOOK(strm, level, strategy, hook_flush) \
+    PREFIX(offload_deflate_params)((strm), (level), (strategy), (hook_flush))
+
+#define DEFLATE_DONE PREFIX(offload_deflate_done)
+
+/* Providers are expected to stay within the conservative bound */
+#define DEFLATE_BOUND_ADJUST_COMPLEN(strm, complen, source_len) do {} while (0)
+
+#define DEFLATE_NEED_CONSERVATIVE_BOUND(strm) (PREFIX(offload_deflate_may_engage)((strm)))
+
+#define DEFLATE_HOOK PREFIX(offload_deflate)
+
+/* The hook reads its input with read_buf() as well */
+#define DEFLATE_NEED_CHECKSUM(strm) 1
+
+#define DEFLATE_CAN_SET_REPRODUCIBLE(strm, reproducible) (!(reproducible) || !OFFLOAD_DEFLATE_ACTIVE((strm)))
+
+#define DEFLATE_PRIME_HOOK(strm, bits, value) \
+    do { if (OFFLOAD_DEFLATE_ACTIVE((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define DEFLATE_COPY_HOOK(strm) \
+    do { if (OFFLOAD_DEFLATE_ACTIVE((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define DEFLATE_END_HOOK PREFIX(offload_end_deflate)
+
+#define DEFLATE_FAILED(strm) ((strm)->state->offload.mode == OFFLOAD_FAILED)
+
+#endif
@@ -0,0 +1,109 @@
+/* offload_inflate.c -- inflate support for runtime pluggable offload providers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "inftrees.h"
+#include "inflate.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "offload_inflate.h"
+
+void Z_INTERNAL PREFIX(offload_reset_inflate_state)(PREFIX3(streamp) strm) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+
+    offload_close(&state->offload);
+}
+
+void Z_INTERNAL PREFIX(offload_end_inflate)(PREFIX3(streamp) strm) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+
+    offload_close(&state->offload);
+}
+
+Z_INTERNAL void offload_disable_inflate(PREFIX3(stream) *strm) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+
+    state->offload.mode = OFFLOAD_OFF;
+}
+
+int Z_INTERNAL PREFIX(offload_inflate_active)(PREFIX3(streamp) strm) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+
+    return state->offload.mode == OFFLOAD_ACTIVE;
+}
+
+int Z_INTERNAL PREFIX(offload_can_inflate)(PREFIX3(streamp) strm, int flush) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+    offload_state *offload = &state->offload;
+
+    if (offload->mode == OFFLOAD_UNDECIDED) {
+        /* Only whole streams are offloaded: no dictionary, no history, no pending bits and no block-level flushes */
+        if (flush == Z_BLOCK || flush == Z_TREES || state->last || state->bits != 0 || state->havedict ||
+            state->whave != 0 || state->total != 0)
+            offload->mode = OFFLOAD_SOFTWARE;
+        else
+            offload_open(offload, Z_OFFLOAD_INFLATE, 0, 0, (int32_t)state->wbits);
+    }
+    return offload->mode == OFFLOAD_ACTIVE;
+}
+
+offload_inflate_action Z_INTERNAL PREFIX(offload_inflate)(PREFIX3(streamp) strm, int flush, int *ret) {
+    struct inflate_state *state = (struct inflate_state *)strm->state;
+    zng_offload_job *job = &state->offload.job;
+    const unsigned char *in = strm->next_in;
+    unsigned char *out = strm->next_out;
+    uint32_t consumed, produced;
+    int32_t status;
+
+    /* Unlike deflate(), inflate() must return all the output it can produce, so the job is waited for right away */
+    job->type = Z_OFFLOAD_INFLATE;
+    job->flush = flush;
+    job->next_in = in;
+    job->avail_in = strm->avail_in;
+    job->next_out = out;
+    job->avail_out = strm->avail_out;
+
+    status = offload_run(&state->offload);
+
+    /* Totals are updated by inflate() itself when leaving */
+    consumed = (uint32_t)(job->next_in - in);
+    produced = (uint32_t)(job->next_out - out);
+    strm->next_in += consumed;
+    strm->avail_in -= consumed;
+    strm->next_out += produced;
+    strm->avail_out -= produced;
+
+    if (produced && (state->wrap & 4)) {
+#ifdef GUNZIP
+        if (state->flags)
+            FUNCTABLE_CALL(crc32_fold)(&state->crc_fold, out, produced, 0);
+        else
+#endif
+            strm->adler = state->check = FUNCTABLE_CALL(adler32)(state->check, out, produced);
+    }
+
+    if (status == Z_STREAM_END) {
+#ifdef GUNZIP
+        if ((state->wrap & 4) && state->flags)
+            strm->adler = state->check = FUNCTABLE_CALL(crc32_fold_final)(&state->crc_fold);
+#endif
+        /* The provider stops right after the last block, so the trailer starts at a byte boundary */
+        state->last = 1;
+        state->mode = CHECK;
+        return OFFLOAD_INFLATE_CONTINUE;
+    }
+    if (status != Z_OK && status != Z_BUF_ERROR) {
+        state->mode = BAD;
+        strm->msg = (char *)(job->msg != NULL ? job->msg : ERR_MSG(status));
+        if (status == Z_DATA_ERROR)
+            return OFFLOAD_INFLATE_CONTINUE;
+        *ret = status;
+    }
+    return OFFLOAD_INFLATE_BREAK;
+}
+
+#endif /* ZLIB_COMPAT */
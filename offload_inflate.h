@@ -0,0 +1,55 @@
+#ifndef OFFLOAD_INFLATE_H_
+#define OFFLOAD_INFLATE_H_
+
+/* Inflate hooks that hand the compressed body of a stream over to a registered offload provider. */
+
+void Z_INTERNAL PREFIX(offload_reset_inflate_state)(PREFIX3(streamp) strm);
+void Z_INTERNAL PREFIX(offload_end_inflate)(PREFIX3(streamp) strm);
+int Z_INTERNAL PREFIX(offload_can_inflate)(PREFIX3(streamp) strm, int flush);
+int Z_INTERNAL PREFIX(offload_inflate_active)(PREFIX3(streamp) strm);
+typedef enum {
+    OFFLOAD_INFLATE_CONTINUE,
+    OFFLOAD_INFLATE_BREAK,
+} offload_inflate_action;
+offload_inflate_action Z_INTERNAL PREFIX(offload_inflate)(PREFIX3(streamp) strm, int flush, int *ret);
+
+#define INFLATE_RESET_KEEP_HOOK PREFIX(offload_reset_inflate_state)
+
+#define INFLATE_PRIME_HOOK(strm, bits, value) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define INFLATE_TYPEDO_HOOK(strm, flush) \
+    if (PREFIX(offload_can_inflate)((strm), (flush))) { \
+        offload_inflate_action action; \
+\
+        RESTORE(); \
+        action = PREFIX(offload_inflate)((strm), (flush), &ret); \
+        LOAD(); \
+        if (action == OFFLOAD_INFLATE_CONTINUE) \
+            break; \
+        else \
+            goto inf_leave; \
+    }
+
+#define INFLATE_NEED_CHECKSUM(strm) (!PREFIX(offload_inflate_active)((strm)))
+
+#define INFLATE_NEED_UPDATEWINDOW(strm) (!PREFIX(offload_inflate_active)((strm)))
+
+#define INFLATE_MARK_HOOK(strm) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return -(1L << 16); } while (0)
+
+#define INFLATE_SYNC_POINT_HOOK(strm) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define INFLATE_SET_DICTIONARY_HOOK(strm, dict, dict_len) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define INFLATE_GET_DICTIONARY_HOOK(strm, dict, dict_len) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define INFLATE_COPY_HOOK(strm) \
+    do { if (PREFIX(offload_inflate_active)((strm))) return Z_STREAM_ERROR; } while (0)
+
+#define INFLATE_END_HOOK PREFIX(offload_end_inflate)
+
+#endif
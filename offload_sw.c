@@ -0,0 +1,240 @@
+/* offload_sw.c -- reference software offload provider
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   The software provider processes raw deflate streams with regular zlib-ng deflate and inflate streams that have
+   offloading disabled. When zlib-ng is built with thread support, all the jobs are processed by a single worker
+   thread, which is started when the first session is opened and joined when the last session is closed. Otherwise
+   jobs are processed synchronously in submit(). Its main purpose is to exercise and document the provider
+   interface, but it can also be used to move compression work off latency sensitive threads.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "zutil_p.h"
+#include "offload.h"
+#include "zthread.h"
+
+#ifndef ZLIB_COMPAT
+
+typedef struct sw_session_s {
+    PREFIX3(stream) strm;       /* raw deflate or inflate stream */
+    int32_t type;               /* Z_OFFLOAD_DEFLATE or Z_OFFLOAD_INFLATE */
+    zng_offload_job *job;       /* last submitted job */
+    int done;                   /* whether job has been processed */
+    struct sw_session_s *next;  /* next session in the work queue */
+} sw_session;
+
+#ifdef WITH_THREADS
+typedef struct sw_worker_s {
+    zng_mutex lock;
+    zng_cond work;              /* signalled when a job is queued or the worker should stop */
+    zng_cond done;              /* signalled when a job is processed or the worker has stopped */
+    sw_session *head;           /* work queue */
+    sw_session *tail;
+    zng_thread thread;
+    int sessions;               /* number of open sessions */
+    int running;                /* whether the worker thread exists */
+    int stopping;               /* whether the worker thread is being joined */
+} sw_worker;
+
+static sw_worker worker = { ZNG_MUTEX_INIT, ZNG_COND_INIT, ZNG_COND_INIT, NULL, NULL, 0, 0, 0, 0 };
+#endif
+
+static void sw_process(sw_session *session) {
+    zng_offload_job *job = session->job;
+    PREFIX3(stream) *strm = &session->strm;
+    uint32_t avail_in = (uint32_t)MIN(job->avail_in, UINT32_MAX);
+    uint32_t avail_out = (uint32_t)MIN(job->avail_out, UINT32_MAX);
+    int32_t ret;
+
+    strm->next_in = job->next_in;
+    strm->avail_in = avail_in;
+    strm->next_out = job->next_out;
+    strm->avail_out = avail_out;
+
+    if (session->type == Z_OFFLOAD_DEFLATE)
+        ret = PREFIX(deflate)(strm, job->flush);
+    else
+        ret = PREFIX(inflate)(strm, job->flush);
+
+    job->next_in += avail_in - strm->avail_in;
+    job->avail_in -= avail_in - strm->avail_in;
+    job->next_out += avail_out - strm->avail_out;
+    job->avail_out -= avail_out - strm->avail_out;
+
+    /* Lack of progress is not an error, the caller decides what to do about it */
+    if (ret == Z_BUF_ERROR)
+        ret = Z_OK;
+    job->status = ret;
+    job->msg = ret < 0 ? strm->msg : NULL;
+}
+
+#ifdef WITH_THREADS
+static ZNG_THREAD_PROC(sw_worker_proc, arg) {
+    Z_UNUSED(arg);
+
+    zng_mutex_lock(&worker.lock);
+    for (;;) {
+        sw_session *session;
+
+        while (worker.head == NULL && !worker.stopping)
+            zng_cond_wait(&worker.work, &worker.lock);
+        if (worker.head == NULL)
+            break;
+
+        session = worker.head;
+        worker.head = session->next;
+        if (worker.head == NULL)
+            worker.tail = NULL;
+        zng_mutex_unlock(&worker.lock);
+
+        sw_process(session);
+
+        zng_mutex_lock(&worker.lock);
+        session->done = 1;
+        zng_cond_broadcast(&worker.done);
+    }
+    zng_mutex_unlock(&worker.lock);
+    return ZNG_THREAD_RETURN;
+}
+#endif
+
+static int32_t sw_open(void *opaque, void **session_out, int32_t type, int32_t level, int32_t strategy,
+                       int32_t window_bits) {
+    sw_session *session;
+    int32_t ret;
+
+    Z_UNUSED(opaque);
+
+    session = (sw_session *)zng_alloc(sizeof(sw_session));
+    if (session == NULL)
+        return Z_MEM_ERROR;
+    memset(session, 0, sizeof(sw_session));
+    session->type = type;
+
+    if (type == Z_OFFLOAD_DEFLATE) {
+        ret = PREFIX(deflateInit2)(&session->strm, level, Z_DEFLATED, -window_bits, DEF_MEM_LEVEL, strategy);
+        if (ret == Z_OK)
+            offload_disable_deflate(&session->strm);
+    } else {
+        ret = PREFIX(inflateInit2)(&session->strm, -MAX_WBITS);
+        if (ret == Z_OK)
+            offload_disable_inflate(&session->strm);
+    }
+    if (ret != Z_OK) {
+        zng_free(session);
+        return ret;
+    }
+
+#ifdef WITH_THREADS
+    zng_mutex_lock(&worker.lock);
+    /* Wait for a worker that is being stopped by the last close() */
+    while (worker.stopping)
+        zng_cond_wait(&worker.done, &worker.lock);
+    if (!worker.running) {
+        if (zng_thread_create(&worker.thread, sw_worker_proc, NULL) != 0) {
+            zng_mutex_unlock(&worker.lock);
+            if (type == Z_OFFLOAD_DEFLATE)
+                PREFIX(deflateEnd)(&session->strm);
+            else
+                PREFIX(inflateEnd)(&session->strm);
+            zng_free(session);
+            return Z_MEM_ERROR;
+        }
+        worker.running = 1;
+    }
+    worker.sessions++;
+    zng_mutex_unlock(&worker.lock);
+#endif
+
+    *session_out = session;
+    return Z_OK;
+}
+
+static int32_t sw_submit(void *opaque, zng_offload_job *job) {
+    sw_session *session = (sw_session *)job->session;
+
+    Z_UNUSED(opaque);
+
+    session->job = job;
+    session->done = 0;
+#ifdef WITH_THREADS
+    session->next = NULL;
+    zng_mutex_lock(&worker.lock);
+    if (worker.tail != NULL)
+        worker.tail->next = session;
+    else
+        worker.head = session;
+    worker.tail = session;
+    zng_cond_signal(&worker.work);
+    zng_mutex_unlock(&worker.lock);
+#else
+    sw_process(session);
+    session->done = 1;
+#endif
+    return Z_OK;
+}
+
+static int32_t sw_complete(void *opaque, zng_offload_job *job) {
+    sw_session *session = (sw_session *)job->session;
+
+    Z_UNUSED(opaque);
+
+#ifdef WITH_THREADS
+    zng_mutex_lock(&worker.lock);
+    while (!session->done)
+        zng_cond_wait(&worker.done, &worker.lock);
+    zng_mutex_unlock(&worker.lock);
+#endif
+    return session->done ? Z_OK : Z_STREAM_ERROR;
+}
+
+static void sw_close(void *opaque, void *session_ptr) {
+    sw_session *session = (sw_session *)session_ptr;
+
+    Z_UNUSED(opaque);
+
+    if (session->type == Z_OFFLOAD_DEFLATE)
+        PREFIX(deflateEnd)(&session->strm);
+    else
+        PREFIX(inflateEnd)(&session->strm);
+    zng_free(session);
+
+#ifdef WITH_THREADS
+    zng_mutex_lock(&worker.lock);
+    if (--worker.sessions == 0) {
+        zng_thread thread = worker.thread;
+
+        worker.stopping = 1;
+        zng_cond_broadcast(&worker.work);
+        zng_mutex_unlock(&worker.lock);
+
+        zng_thread_join(thread);
+
+        zng_mutex_lock(&worker.lock);
+        worker.running = 0;
+        worker.stopping = 0;
+        zng_cond_broadcast(&worker.done);
+    }
+    zng_mutex_unlock(&worker.lock);
+#endif
+}
+
+static const zng_offload_provider sw_provider = {
+    "software",
+    Z_OFFLOAD_DEFLATE | Z_OFFLOAD_INFLATE,
+    NULL,
+    sw_open,
+    sw_submit,
+    sw_complete,
+    sw_close
+};
+
+/* ========================================================================= */
+const zng_offload_provider * Z_EXPORT zng_offload_sw_provider(void) {
+    return &sw_provider;
+}
+
+#endif /* ZLIB_COMPAT */
@@ -0,0 +1,194 @@
+/* state_cache.c -- per-thread cache of the streams of compress() and uncompress()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+   compress2() and uncompress2() set up and free a whole stream for every call, which for short buffers costs more
+   than the compression itself. With WITH_STATE_CACHE, each thread keeps the streams of its last calls instead: up to
+   CACHE_DEFLATE_STATES deflate streams, for the most recently used combinations of level, windowBits and memLevel,
+   and one inflate stream. A stream is reset when it is given back, the deflate ones with deflateResetLazy(), which
+   only clears the hash table entries that a short buffer could have set.
+
+   A stream is marked as in use while it is taken, so that a call made from within another, for instance by a signal
+   handler, does not get the same stream. Such a call finds no free stream and sets up one of its own.
+
+   The streams of a thread are freed when the thread exits. Those of a thread that never exits, such as the main
+   thread, stay allocated until the process ends: with the default parameters that is about 270K for each level that
+   was used, and 40K for the inflate stream.
+
+   The thread-local key is deleted by an atexit() handler, which in a shared library also runs when the library is
+   unloaded, so that threads that exit later do not call a destructor that is gone. With pthreads the streams of the
+   threads still running at that point are not freed.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "zutil_p.h"
+#include "deflate.h"
+#include "state_cache.h"
+#include "zthread.h"
+
+#ifdef WITH_STATE_CACHE
+
+#define CACHE_DEFLATE_STATES 4
+
+typedef struct cache_entry_s {
+    PREFIX3(stream) strm;       /* strm.state is NULL while the entry is empty, first so that done() finds the entry */
+    int32_t in_use;             /* set while the stream is taken */
+    int32_t level;
+    int32_t window_bits;
+    int32_t mem_level;
+    uint32_t last_use;          /* value of the cache clock when the stream was last taken */
+} cache_entry;
+
+typedef struct state_cache_s {
+    cache_entry deflate[CACHE_DEFLATE_STATES];
+    cache_entry inflate;
+    uint32_t clock;
+} state_cache;
+
+static zng_tls cache_key;
+static int cache_key_ok;
+static zng_once cache_once = ZNG_ONCE_INIT;
+
+/* ===========================================================================
+ * Free the streams of a thread that exits.
+ */
+static ZNG_TLS_DESTRUCTOR(cache_free, arg) {
+    state_cache *cache = (state_cache *)arg;
+    int i;
+
+    for (i = 0; i < CACHE_DEFLATE_STATES; i++) {
+        if (cache->deflate[i].strm.state != NULL)
+            PREFIX(deflateEnd)(&cache->deflate[i].strm);
+    }
+    if (cache->inflate.strm.state != NULL)
+        PREFIX(inflateEnd)(&cache->inflate.strm);
+    zng_free(cache);
+}
+
+static void cache_key_delete(void) {
+    cache_key_ok = 0;
+    zng_tls_delete(cache_key);
+}
+
+static ZNG_ONCE_PROC(cache_key_init) {
+    cache_key_ok = zng_tls_create(&cache_key, cache_free) == 0;
+    if (cache_key_ok && atexit(cache_key_delete) != 0) {
+        zng_tls_delete(cache_key);
+        cache_key_ok = 0;
+    }
+    return ZNG_ONCE_RETURN;
+}
+
+/* Return the cache of the calling thread, which is set up on its first use, or NULL if it cannot be */
+static state_cache *cache_get(void) {
+    state_cache *cache;
+
+    zng_call_once(&cache_once, cache_key_init);
+    if (!cache_key_ok)
+        return NULL;
+
+    cache = (state_cache *)zng_tls_get(cache_key);
+    if (cache == NULL) {
+        cache = (state_cache *)zng_alloc(sizeof(state_cache));
+        if (cache == NULL)
+            return NULL;
+        memset(cache, 0, sizeof(state_cache));
+        if (zng_tls_set(cache_key, cache) != 0) {
+            zng_free(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+/* ===========================================================================
+ * Take the deflate stream for the parameters, or set it up in place of the
+ * least recently used one that is free. Invalid parameters, or no free stream,
+ * give NULL, so that the caller sets up a stream of its own.
+ */
+Z_INTERNAL PREFIX3(stream) *state_cache_deflate(int32_t level, int32_t window_bits, int32_t mem_level) {
+    state_cache *cache = cache_get();
+    cache_entry *entry = NULL;
+    int i;
+
+    if (cache == NULL)
+        return NULL;
+    if (level == Z_DEFAULT_COMPRESSION)
+        level = 6;
+    if (level < 0 || level > 9)
+        return NULL;
+
+    for (i = 0; i < CACHE_DEFLATE_STATES; i++) {
+        cache_entry *e = &cache->deflate[i];
+        if (e->in_use)
+            continue;
+        if (e->strm.state != NULL && e->level == level && e->window_bits == window_bits && e->mem_level == mem_level) {
+            e->in_use = 1;
+            e->last_use = ++cache->clock;
+            return &e->strm;
+        }
+        if (entry == NULL || (entry->strm.state != NULL && (e->strm.state == NULL || e->last_use < entry->last_use)))
+            entry = e;
+    }
+    if (entry == NULL)
+        return NULL;
+
+    if (entry->strm.state != NULL)
+        PREFIX(deflateEnd)(&entry->strm);
+    memset(&entry->strm, 0, sizeof(entry->strm));
+    if (PREFIX(deflateInit2)(&entry->strm, level, Z_DEFLATED, window_bits, mem_level, Z_DEFAULT_STRATEGY) != Z_OK) {
+        entry->strm.state = NULL;
+        return NULL;
+    }
+    entry->level = level;
+    entry->window_bits = window_bits;
+    entry->mem_level = mem_level;
+    entry->in_use = 1;
+    entry->last_use = ++cache->clock;
+    return &entry->strm;
+}
+
+void Z_INTERNAL state_cache_deflate_done(PREFIX3(stream) *strm) {
+    PREFIX(deflateResetLazy)(strm);
+    ((cache_entry *)strm)->in_use = 0;
+}
+
+/* ===========================================================================
+ * Take the inflate stream, which is set up again when windowBits changes, or
+ * NULL while it is in use.
+ */
+Z_INTERNAL PREFIX3(stream) *state_cache_inflate(int32_t window_bits) {
+    state_cache *cache = cache_get();
+    cache_entry *entry;
+
+    if (cache == NULL)
+        return NULL;
+
+    entry = &cache->inflate;
+    if (entry->in_use)
+        return NULL;
+    if (entry->strm.state != NULL && entry->window_bits == window_bits) {
+        entry->in_use = 1;
+        return &entry->strm;
+    }
+
+    if (entry->strm.state != NULL)
+        PREFIX(inflateEnd)(&entry->strm);
+    memset(&entry->strm, 0, sizeof(entry->strm));
+    if (PREFIX(inflateInit2)(&entry->strm, window_bits) != Z_OK) {
+        entry->strm.state = NULL;
+        return NULL;
+    }
+    entry->window_bits = window_bits;
+    entry->in_use = 1;
+    return &entry->strm;
+}
+
+void Z_INTERNAL state_cache_inflate_done(PREFIX3(stream) *strm) {
+    PREFIX(inflateReset)(strm);
+    ((cache_entry *)strm)->in_use = 0;
+}
+
+#endif
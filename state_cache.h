@@ -0,0 +1,39 @@
+/* state_cache.h -- per-thread cache of the streams of compress() and uncompress()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef STATE_CACHE_H_
+#define STATE_CACHE_H_
+
+/* The functions return a stream that is ready for a new compressed stream, or NULL when there is none, in which case
+ * the caller sets up a stream of its own. A stream is given back with the matching done function once the call is
+ * over, whatever its outcome. */
+
+#ifdef WITH_STATE_CACHE
+Z_INTERNAL PREFIX3(stream) *state_cache_deflate(int32_t level, int32_t window_bits, int32_t mem_level);
+void Z_INTERNAL state_cache_deflate_done(PREFIX3(stream) *strm);
+Z_INTERNAL PREFIX3(stream) *state_cache_inflate(int32_t window_bits);
+void Z_INTERNAL state_cache_inflate_done(PREFIX3(stream) *strm);
+#else
+static inline PREFIX3(stream) *state_cache_deflate(int32_t level, int32_t window_bits, int32_t mem_level) {
+    Z_UNUSED(level);
+    Z_UNUSED(window_bits);
+    Z_UNUSED(mem_level);
+    return NULL;
+}
+
+static inline void state_cache_deflate_done(PREFIX3(stream) *strm) {
+    Z_UNUSED(strm);
+}
+
+static inline PREFIX3(stream) *state_cache_inflate(int32_t window_bits) {
+    Z_UNUSED(window_bits);
+    return NULL;
+}
+
+static inline void state_cache_inflate_done(PREFIX3(stream) *strm) {
+    Z_UNUSED(strm);
+}
+#endif
+
+#endif /* STATE_CACHE_H_ */
@@ -0,0 +1,100 @@
+/* benchmark_batch.cc -- benchmark batch compression of small records against compress2() per record
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  if defined(ZLIB_COMPAT)
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#ifndef ZLIB_COMPAT
+
+#define NUM_RECORDS 1024
+#define RECORD_SIZE 512
+#define OUT_SIZE    (RECORD_SIZE * 2)
+
+class batch_bench: public benchmark::Fixture {
+private:
+    uint8_t *records;
+    uint8_t *outbuff;
+    zng_batch_item items[NUM_RECORDS];
+    size_t sizes[NUM_RECORDS];
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        static const char *names[] = { "alice", "bob", "carol", "dave", "erin", "frank", "grace", "heidi" };
+
+        records = (uint8_t *)zng_alloc(NUM_RECORDS * RECORD_SIZE);
+        outbuff = (uint8_t *)zng_alloc(NUM_RECORDS * OUT_SIZE);
+        assert(records != NULL && outbuff != NULL);
+
+        srand(72);
+        for (int32_t i = 0; i < NUM_RECORDS; i++) {
+            char *rec = (char *)records + i * RECORD_SIZE;
+            int len = snprintf(rec, RECORD_SIZE,
+                "{\"id\":%d,\"user\":\"%s\",\"email\":\"%s%d@example.com\",\"created_at\":\"2024-%02d-%02dT%02d:%02d:00Z\","
+                "\"items\":[%d,%d,%d],\"total\":%d.%02d}",
+                rand(), names[rand() % 8], names[rand() % 8], rand() % 1000, 1 + rand() % 12, 1 + rand() % 28,
+                rand() % 24, rand() % 60, rand() % 1000, rand() % 1000, rand() % 1000, rand() % 500, rand() % 100);
+            sizes[i] = (size_t)len;
+        }
+    }
+
+    void Bench(benchmark::State& state, bool batch) {
+        int32_t level = (int32_t)state.range(0);
+        size_t in_bytes = 0, out_bytes = 0;
+        int32_t i;
+
+        for (auto _ : state) {
+            if (batch) {
+                for (i = 0; i < NUM_RECORDS; i++) {
+                    items[i].src = records + i * RECORD_SIZE;
+                    items[i].src_len = sizes[i];
+                    items[i].dest = outbuff + i * OUT_SIZE;
+                    items[i].dest_len = OUT_SIZE;
+                }
+                zng_compress_batch(items, NUM_RECORDS, level, 1);
+                for (i = 0; i < NUM_RECORDS; i++)
+                    out_bytes += items[i].dest_len;
+            } else {
+                for (i = 0; i < NUM_RECORDS; i++) {
+                    size_t out_len = OUT_SIZE;
+                    zng_compress2(outbuff + i * OUT_SIZE, &out_len, records + i * RECORD_SIZE, sizes[i], level);
+                    out_bytes += out_len;
+                }
+            }
+            for (i = 0; i < NUM_RECORDS; i++)
+                in_bytes += sizes[i];
+            benchmark::DoNotOptimize(outbuff);
+        }
+
+        state.SetBytesProcessed((int64_t)in_bytes);
+        state.SetItemsProcessed((int64_t)state.iterations() * NUM_RECORDS);
+        state.counters["ratio"] = out_bytes ? (double)in_bytes / (double)out_bytes : 0.0;
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(records);
+        zng_free(outbuff);
+    }
+};
+
+#define BENCHMARK_BATCH(name, batch) \
+    BENCHMARK_DEFINE_F(batch_bench, name)(benchmark::State& state) { \
+        Bench(state, batch); \
+    } \
+    BENCHMARK_REGISTER_F(batch_bench, name)->Arg(1)->Arg(6)->Arg(9);
+
+BENCHMARK_BATCH(compress2, false);
+BENCHMARK_BATCH(compress_batch, true);
+
+#endif
@@ -0,0 +1,102 @@
+/* benchmark_checksum_multi.cc -- benchmark multi-buffer crc32 and adler32 variants
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  include "arch_functions.h"
+#  include "../test_cpu_features.h"
+}
+
+#define BATCH_SIZE 64
+#define MAX_RECORD_SIZE 1024
+
+/* Hashes a batch of equally sized records, either one at a time with the single buffer
+ * variant or all at once with the multi-buffer variant */
+class checksum_multi: public benchmark::Fixture {
+private:
+    uint8_t *records;
+    const uint8_t *bufs[BATCH_SIZE];
+    size_t lens[BATCH_SIZE];
+    uint32_t out[BATCH_SIZE];
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        records = (uint8_t *)zng_alloc(BATCH_SIZE * MAX_RECORD_SIZE);
+        assert(records != NULL);
+
+        for (int32_t i = 0; i < BATCH_SIZE * MAX_RECORD_SIZE; i++) {
+            records[i] = (uint8_t)rand();
+        }
+        for (int32_t i = 0; i < BATCH_SIZE; i++) {
+            bufs[i] = records + i * MAX_RECORD_SIZE;
+            lens[i] = (size_t)state.range(0);
+        }
+    }
+
+    void BenchSingle(benchmark::State& state, crc32_func single, uint32_t init) {
+        for (auto _ : state) {
+            for (int32_t i = 0; i < BATCH_SIZE; i++)
+                out[i] = single(init, bufs[i], lens[i]);
+            benchmark::ClobberMemory();
+        }
+
+        benchmark::DoNotOptimize(out);
+    }
+
+    void BenchMulti(benchmark::State& state, checksum_multi_func multi) {
+        for (auto _ : state) {
+            multi(bufs, lens, out, BATCH_SIZE);
+            benchmark::ClobberMemory();
+        }
+
+        benchmark::DoNotOptimize(out);
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(records);
+    }
+};
+
+#define BENCHMARK_CHECKSUM_SINGLE(name, fptr, init, support_flag) \
+    BENCHMARK_DEFINE_F(checksum_multi, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        BenchSingle(state, fptr, init); \
+    } \
+    BENCHMARK_REGISTER_F(checksum_multi, name)->Arg(16)->Arg(64)->Arg(100)->Arg(256)->Arg(1000);
+
+#define BENCHMARK_CHECKSUM_MULTI(name, fptr, support_flag) \
+    BENCHMARK_DEFINE_F(checksum_multi, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        BenchMulti(state, fptr); \
+    } \
+    BENCHMARK_REGISTER_F(checksum_multi, name)->Arg(16)->Arg(64)->Arg(100)->Arg(256)->Arg(1000);
+
+BENCHMARK_CHECKSUM_MULTI(crc32_c, crc32_multi_c, 1);
+BENCHMARK_CHECKSUM_MULTI(adler32_c, adler32_multi_c, 1);
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+BENCHMARK_CHECKSUM_MULTI(crc32_native, native_crc32_multi, 1);
+BENCHMARK_CHECKSUM_MULTI(adler32_native, native_adler32_multi, 1);
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+BENCHMARK_CHECKSUM_SINGLE(crc32_pclmulqdq_single, crc32_pclmulqdq, 0, test_cpu_features.x86.has_pclmulqdq);
+BENCHMARK_CHECKSUM_MULTI(crc32_pclmulqdq, crc32_multi_pclmulqdq, test_cpu_features.x86.has_pclmulqdq);
+#endif
+#ifdef X86_AVX2
+BENCHMARK_CHECKSUM_SINGLE(adler32_avx2_single, adler32_avx2, 1, test_cpu_features.x86.has_avx2);
+BENCHMARK_CHECKSUM_MULTI(adler32_avx2, adler32_multi_avx2, test_cpu_features.x86.has_avx2);
+#endif
+
+#endif
@@ -50,6 +50,7 @@ public:
         }
 
         benchmark::DoNotOptimize(err);
+        state.SetItemsProcessed(state.iterations());
     }
 
     void TearDown(const ::benchmark::State& state) {
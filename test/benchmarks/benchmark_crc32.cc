@@ -1,4 +1,4 @@
-/* benchmark_crc32.cc -- benchmark crc32 variants
+/* benchmark_crc32.cc -- benchmark crc32 and crc64 variants
  * Copyright (C) 2022 Nathan Moinvaziri
  * For conditions of distribution and use, see copyright notice in zlib.h
  */
@@ -81,3 +81,56 @@ BENCHMARK_CRC32(vpclmulqdq, crc32_vpclmulqdq, (test_cpu_features.x86.has_pclmulq
 #endif
 
 #endif
+
+class crc64: public benchmark::Fixture {
+private:
+    uint32_t *random_ints;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        random_ints = (uint32_t *)zng_alloc(MAX_RANDOM_INTS_SIZE);
+        assert(random_ints != NULL);
+
+        for (int32_t i = 0; i < MAX_RANDOM_INTS; i++) {
+            random_ints[i] = rand();
+        }
+    }
+
+    void Bench(benchmark::State& state, crc64_func crc64) {
+        uint64_t hash = 0;
+
+        for (auto _ : state) {
+            hash = crc64(hash, (const unsigned char *)random_ints, (size_t)state.range(0));
+        }
+
+        benchmark::DoNotOptimize(hash);
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(random_ints);
+    }
+};
+
+#define BENCHMARK_CRC64(name, fptr, support_flag) \
+    BENCHMARK_DEFINE_F(crc64, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        Bench(state, fptr); \
+    } \
+    BENCHMARK_REGISTER_F(crc64, name)->Arg(1)->Arg(8)->Arg(12)->Arg(16)->Arg(32)->Arg(64)->Arg(512)->Arg(4<<10)->Arg(32<<10)->Arg(256<<10)->Arg(4096<<10);
+
+BENCHMARK_CRC64(braid, crc64_braid, 1);
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+BENCHMARK_CRC64(native, native_crc64, 1);
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+BENCHMARK_CRC64(pclmulqdq, crc64_pclmulqdq, test_cpu_features.x86.has_pclmulqdq);
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+BENCHMARK_CRC64(vpclmulqdq, crc64_vpclmulqdq, (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq));
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/* benchmark_deflate.cc -- benchmark deflate() on text, in one call or in small calls
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  if defined(ZLIB_COMPAT)
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#define INPUT_SIZE (128 * 1024)
+
+class deflate_bench: public benchmark::Fixture {
+private:
+    uint8_t *inbuff;
+    uint8_t *outbuff;
+    size_t outlen;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        static const char *levels[] = { "INFO", "INFO", "INFO", "WARN", "ERROR" };
+        static const char *paths[] = { "/", "/login", "/api/v1/items", "/api/v1/items/search", "/static/app.js" };
+        size_t pos = 0;
+
+        outlen = PREFIX(compressBound)(INPUT_SIZE);
+        inbuff = (uint8_t *)zng_alloc(INPUT_SIZE);
+        outbuff = (uint8_t *)zng_alloc(outlen);
+        assert(inbuff != NULL && outbuff != NULL);
+
+        /* Log lines, which have the mix of literals and short to medium matches of most text */
+        srand(69);
+        while (pos < INPUT_SIZE) {
+            char line[160];
+            int len = snprintf(line, sizeof(line), "2024-%02d-%02d %02d:%02d:%02d %s [worker-%d] GET %s status=%d bytes=%d\n",
+                1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60, rand() % 60, levels[rand() % 5],
+                rand() % 16, paths[rand() % 5], rand() % 8 ? 200 : 404, rand() % 100000);
+            len = (int)MIN((size_t)len, INPUT_SIZE - pos);
+            memcpy(inbuff + pos, line, len);
+            pos += len;
+        }
+    }
+
+    void Bench(benchmark::State& state, uint32_t chunk) {
+        PREFIX3(stream) strm;
+        size_t out_bytes = 0;
+        int err;
+
+        memset(&strm, 0, sizeof(strm));
+        err = PREFIX(deflateInit)(&strm, (int)state.range(0));
+        assert(err == Z_OK);
+
+        for (auto _ : state) {
+            PREFIX(deflateReset)(&strm);
+            strm.next_in = inbuff;
+            strm.next_out = outbuff;
+            strm.avail_out = (uint32_t)outlen;
+            do {
+                strm.avail_in = (uint32_t)MIN(chunk, INPUT_SIZE - strm.total_in);
+                err = PREFIX(deflate)(&strm, strm.total_in + strm.avail_in == INPUT_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            } while (err == Z_OK);
+            out_bytes += strm.total_out;
+            benchmark::DoNotOptimize(outbuff);
+        }
+
+        PREFIX(deflateEnd)(&strm);
+        state.SetBytesProcessed((int64_t)state.iterations() * INPUT_SIZE);
+        state.counters["ratio"] = out_bytes ? (double)state.iterations() * INPUT_SIZE / (double)out_bytes : 0.0;
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(inbuff);
+        zng_free(outbuff);
+    }
+};
+
+#define BENCHMARK_DEFLATE(name, chunk) \
+    BENCHMARK_DEFINE_F(deflate_bench, name)(benchmark::State& state) { \
+        Bench(state, chunk); \
+    } \
+    BENCHMARK_REGISTER_F(deflate_bench, name)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(9);
+
+BENCHMARK_DEFLATE(one_call, INPUT_SIZE);
+BENCHMARK_DEFLATE(small_calls, 1024);
@@ -0,0 +1,107 @@
+/* benchmark_dict.cc -- benchmark small record compression with a trained dictionary
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  if defined(ZLIB_COMPAT)
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#ifndef ZLIB_COMPAT
+
+#define NUM_RECORDS 1024
+#define RECORD_SIZE 512
+#define DICT_SIZE   (16 * 1024)
+
+class dict_bench: public benchmark::Fixture {
+private:
+    uint8_t *records;
+    uint8_t *outbuff;
+    uint8_t *dict;
+    const uint8_t *samples[NUM_RECORDS];
+    size_t sizes[NUM_RECORDS];
+    size_t dict_len;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        static const char *names[] = { "alice", "bob", "carol", "dave", "erin", "frank", "grace", "heidi" };
+        static const char *states[] = { "active", "suspended", "pending_verification", "closed" };
+
+        records = (uint8_t *)zng_alloc(NUM_RECORDS * RECORD_SIZE);
+        outbuff = (uint8_t *)zng_alloc(RECORD_SIZE * 2);
+        dict = (uint8_t *)zng_alloc(DICT_SIZE);
+        assert(records != NULL && outbuff != NULL && dict != NULL);
+
+        srand(61);
+        for (int32_t i = 0; i < NUM_RECORDS; i++) {
+            char *rec = (char *)records + i * RECORD_SIZE;
+            int len = snprintf(rec, RECORD_SIZE,
+                "{\"id\":%d,\"user\":{\"name\":\"%s\",\"email\":\"%s%d@example.com\",\"account_state\":\"%s\"},"
+                "\"created_at\":\"2024-%02d-%02dT%02d:%02d:00Z\",\"permissions\":[\"read\",\"write\"],"
+                "\"preferences\":{\"theme\":\"%s\",\"notifications\":%s,\"language\":\"en-US\"}}",
+                rand(), names[rand() % 8], names[rand() % 8], rand() % 1000, states[rand() % 4],
+                1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60,
+                rand() % 2 ? "dark" : "light", rand() % 2 ? "true" : "false");
+            samples[i] = (uint8_t *)rec;
+            sizes[i] = (size_t)len;
+        }
+
+        /* Train on the first half, compress the second half */
+        dict_len = zng_train_dictionary(samples, sizes, NUM_RECORDS / 2, dict, DICT_SIZE);
+        assert(dict_len > 0);
+    }
+
+    void Bench(benchmark::State& state, bool use_dict) {
+        size_t in_bytes = 0, out_bytes = 0;
+        int32_t i = NUM_RECORDS / 2;
+
+        for (auto _ : state) {
+            zng_stream strm;
+            memset(&strm, 0, sizeof(strm));
+            zng_deflateInit(&strm, (int)state.range(0));
+            if (use_dict)
+                zng_deflateSetDictionary(&strm, dict, (uint32_t)dict_len);
+            strm.next_in = samples[i];
+            strm.avail_in = (uint32_t)sizes[i];
+            strm.next_out = outbuff;
+            strm.avail_out = RECORD_SIZE * 2;
+            zng_deflate(&strm, Z_FINISH);
+            in_bytes += sizes[i];
+            out_bytes += strm.total_out;
+            zng_deflateEnd(&strm);
+            benchmark::DoNotOptimize(outbuff);
+
+            if (++i == NUM_RECORDS)
+                i = NUM_RECORDS / 2;
+        }
+
+        state.SetBytesProcessed((int64_t)in_bytes);
+        state.counters["ratio"] = out_bytes ? (double)in_bytes / (double)out_bytes : 0.0;
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(records);
+        zng_free(outbuff);
+        zng_free(dict);
+    }
+};
+
+#define BENCHMARK_DICT(name, use_dict) \
+    BENCHMARK_DEFINE_F(dict_bench, name)(benchmark::State& state) { \
+        Bench(state, use_dict); \
+    } \
+    BENCHMARK_REGISTER_F(dict_bench, name)->Arg(1)->Arg(6)->Arg(9);
+
+BENCHMARK_DICT(no_dict, false);
+BENCHMARK_DICT(trained_dict, true);
+
+#endif
@@ -0,0 +1,69 @@
+/* benchmark_histogram.cc -- benchmark histogram variants
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  include "arch_functions.h"
+#  include "../test_cpu_features.h"
+}
+
+#define MAX_RANDOM_INTS (1024 * 1024)
+#define MAX_RANDOM_INTS_SIZE (MAX_RANDOM_INTS * sizeof(uint32_t))
+
+class histogram: public benchmark::Fixture {
+private:
+    uint32_t *random_ints;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        /* Random bytes are the worst case, no two neighbouring bytes are likely to share a counter */
+        random_ints = (uint32_t *)zng_alloc(MAX_RANDOM_INTS_SIZE);
+        assert(random_ints != NULL);
+
+        for (int32_t i = 0; i < MAX_RANDOM_INTS; i++) {
+            random_ints[i] = rand();
+        }
+    }
+
+    void Bench(benchmark::State& state, histogram_func histogram) {
+        uint32_t hist[256];
+
+        memset(hist, 0, sizeof(hist));
+        for (auto _ : state) {
+            histogram(hist, (const uint8_t *)random_ints, (size_t)state.range(0));
+            benchmark::DoNotOptimize(hist);
+        }
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(random_ints);
+    }
+};
+
+#define BENCHMARK_HISTOGRAM(name, fptr, support_flag) \
+    BENCHMARK_DEFINE_F(histogram, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        Bench(state, fptr); \
+    } \
+    BENCHMARK_REGISTER_F(histogram, name)->Range(8192, MAX_RANDOM_INTS_SIZE);
+
+BENCHMARK_HISTOGRAM(c, histogram_c, 1);
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+BENCHMARK_HISTOGRAM(native, native_histogram, 1);
+#else
+
+#ifdef X86_AVX2
+BENCHMARK_HISTOGRAM(avx2, histogram_avx2, test_cpu_features.x86.has_avx2);
+#endif
+
+#endif
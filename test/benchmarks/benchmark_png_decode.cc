@@ -10,6 +10,8 @@ protected:
     /* Backing this on the heap is a more realistic benchmark */
     uint8_t *output_img_buf = NULL;
 
+    int32_t filters = PNG_FILTER_NONE;
+
 public:
     /* Let's make the vanilla version have something extremely compressible */
     virtual void init_img(png_bytep img_bytes, size_t width, size_t height) {
@@ -24,7 +26,7 @@ public:
         /* First we need to author the png bytes to be decoded */
         for (int i = 0; i < 10; ++i) {
             inpng[i] = {NULL, 0, 0};
-            encode_png(output_img_buf, &inpng[i], i, IMWIDTH, IMHEIGHT);
+            encode_png(output_img_buf, &inpng[i], i, IMWIDTH, IMHEIGHT, filters);
         }
     }
 
@@ -115,6 +117,17 @@ public:
     }
 };
 
+class png_decode_filtered: public png_decode {
+public:
+    png_decode_filtered() {
+        filters = PNG_ALL_FILTERS;
+    }
+
+    void init_img(png_bytep img_bytes, size_t width, size_t height) override {
+        init_gradient(img_bytes, width, height);
+    }
+};
+
 BENCHMARK_DEFINE_F(png_decode, png_decode)(benchmark::State &state) {
     Bench(state);
 }
@@ -124,3 +137,8 @@ BENCHMARK_DEFINE_F(png_decode_realistic, png_decode_realistic)(benchmark::State
     Bench(state);
 }
 BENCHMARK_REGISTER_F(png_decode_realistic, png_decode_realistic)->DenseRange(0, 9, 1)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(png_decode_filtered, png_decode_filtered)(benchmark::State &state) {
+    Bench(state);
+}
+BENCHMARK_REGISTER_F(png_decode_filtered, png_decode_filtered)->DenseRange(0, 9, 1)->Unit(benchmark::kMicrosecond);
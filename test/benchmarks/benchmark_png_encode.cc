@@ -13,6 +13,9 @@ private:
     /* Backing this on the heap is a more realistic benchmark */
     uint8_t *input_img_buf = NULL;
 
+protected:
+    int32_t filters = PNG_FILTER_NONE;
+
 public:
     /* Let's make the vanilla version have something extremely compressible */
     virtual void init_img(png_bytep img_bytes, size_t width, size_t height) {
@@ -35,11 +38,14 @@ public:
 
     /* State in this circumstance will convey the compression level */
     void Bench(benchmark::State &state) {
+        int64_t png_len = 0;
         for (auto _ : state) {
-            encode_png((png_bytep)input_img_buf, &outpng, state.range(0), IMWIDTH, IMHEIGHT);
+            encode_png((png_bytep)input_img_buf, &outpng, state.range(0), IMWIDTH, IMHEIGHT, filters);
+            png_len = outpng.len;
             outpng.buf_rem = outpng.len;
             outpng.len = 0;
         }
+        state.counters["png_bytes"] = (double)png_len;
     }
 
     void TearDown(const ::benchmark::State &state) {
@@ -52,3 +58,19 @@ BENCHMARK_DEFINE_F(png_encode, encode_compressible)(benchmark::State &state) {
     Bench(state);
 }
 BENCHMARK_REGISTER_F(png_encode, encode_compressible)->DenseRange(0, 9, 1)->Unit(benchmark::kMicrosecond);
+
+class png_encode_filtered: public png_encode {
+public:
+    png_encode_filtered() {
+        filters = PNG_ALL_FILTERS;
+    }
+
+    void init_img(png_bytep img_bytes, size_t width, size_t height) override {
+        init_gradient(img_bytes, width, height);
+    }
+};
+
+BENCHMARK_DEFINE_F(png_encode_filtered, encode_filtered)(benchmark::State &state) {
+    Bench(state);
+}
+BENCHMARK_REGISTER_F(png_encode_filtered, encode_filtered)->DenseRange(0, 9, 1)->Unit(benchmark::kMicrosecond);
@@ -73,7 +73,24 @@ static void init_compressible(png_bytep buf, size_t num_pix) {
     }
 }
 
-static inline void encode_png(png_bytep buf, png_dat *outpng, int32_t comp_level, uint32_t width, uint32_t height) {
+static void init_gradient(png_bytep buf, size_t width, size_t height) {
+    /* Smooth gradients with a little noise, like a photograph. The PNG
+     * filters turn these into small values with a somewhat random distribution,
+     * which libpng compresses with Z_FILTERED */
+    uint32_t seed = 7;
+
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                seed = seed * 1103515245 + 12345;
+                buf[3 * (y * width + x) + c] = (uint8_t)(x * (c + 1) / 5 + y / 3 + (seed >> 16) % 5);
+            }
+        }
+    }
+}
+
+static inline void encode_png(png_bytep buf, png_dat *outpng, int32_t comp_level, uint32_t width, uint32_t height,
+                              int32_t filters = PNG_FILTER_NONE) {
     png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 
     /* Most of this error handling is _likely_ not necessary. Likewise it's likely
@@ -96,7 +113,7 @@ static inline void encode_png(png_bytep buf, png_dat *outpng, int32_t comp_level
 
     png_write_info(png, info);
     png_set_compression_level(png, comp_level);
-    png_set_filter(png, 0, PNG_FILTER_NONE);
+    png_set_filter(png, 0, filters);
     png_write_image(png, (png_bytepp)png_row_ptrs);
     png_write_end(png, NULL);
     png_destroy_write_struct(&png, &info);
@@ -0,0 +1,98 @@
+/* benchmark_streams.cc -- benchmark many deflate streams that compress at the same time
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  if defined(ZLIB_COMPAT)
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#define MAX_STREAMS 256
+#define STREAM_SIZE (64 * 1024)     /* input of each stream */
+#define INPUT_SIZE  (1024 * 1024)   /* the streams start at different places in it */
+#define CHUNK_SIZE  4096            /* input given to a stream at a time */
+
+class streams_bench: public benchmark::Fixture {
+private:
+    PREFIX3(stream) strms[MAX_STREAMS];
+    uint8_t *inbuff;
+    uint8_t *outbuff;
+    size_t outlen;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        static const char *levels[] = { "INFO", "INFO", "INFO", "WARN", "ERROR" };
+        static const char *paths[] = { "/", "/login", "/api/v1/items", "/api/v1/items/search", "/static/app.js" };
+        size_t pos = 0;
+
+        outlen = PREFIX(compressBound)(STREAM_SIZE);
+        inbuff = (uint8_t *)zng_alloc(INPUT_SIZE);
+        outbuff = (uint8_t *)zng_alloc(outlen);
+        assert(inbuff != NULL && outbuff != NULL);
+
+        srand(74);
+        while (pos < INPUT_SIZE) {
+            char line[160];
+            int len = snprintf(line, sizeof(line), "2024-%02d-%02d %02d:%02d:%02d %s [worker-%d] GET %s status=%d bytes=%d\n",
+                1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60, rand() % 60, levels[rand() % 5],
+                rand() % 16, paths[rand() % 5], rand() % 8 ? 200 : 404, rand() % 100000);
+            len = (int)MIN((size_t)len, INPUT_SIZE - pos);
+            memcpy(inbuff + pos, line, len);
+            pos += len;
+        }
+    }
+
+    /* Give each stream a chunk of its input in turn, as a server with many connections would, so that each call
+     * finds the window and hash tables of its stream out of the caches and the TLB */
+    void Bench(benchmark::State& state) {
+        int32_t streams = (int32_t)state.range(0);
+        int32_t i;
+        int err;
+
+        for (i = 0; i < streams; i++) {
+            memset(&strms[i], 0, sizeof(strms[i]));
+            err = PREFIX(deflateInit)(&strms[i], (int)state.range(1));
+            assert(err == Z_OK);
+        }
+
+        for (auto _ : state) {
+            for (i = 0; i < streams; i++)
+                PREFIX(deflateReset)(&strms[i]);
+            for (size_t pos = 0; pos < STREAM_SIZE; pos += CHUNK_SIZE) {
+                for (i = 0; i < streams; i++) {
+                    PREFIX3(stream) *strm = &strms[i];
+                    strm->next_in = inbuff + (i * 7919 * 64) % (INPUT_SIZE - STREAM_SIZE) + pos;
+                    strm->avail_in = CHUNK_SIZE;
+                    strm->next_out = outbuff;
+                    strm->avail_out = (uint32_t)outlen;
+                    err = PREFIX(deflate)(strm, pos + CHUNK_SIZE < STREAM_SIZE ? Z_NO_FLUSH : Z_FINISH);
+                }
+            }
+            benchmark::DoNotOptimize(outbuff);
+        }
+        benchmark::DoNotOptimize(err);
+
+        for (i = 0; i < streams; i++)
+            PREFIX(deflateEnd)(&strms[i]);
+        state.SetBytesProcessed((int64_t)state.iterations() * streams * STREAM_SIZE);
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(inbuff);
+        zng_free(outbuff);
+    }
+};
+
+BENCHMARK_DEFINE_F(streams_bench, deflate)(benchmark::State& state) {
+    Bench(state);
+}
+BENCHMARK_REGISTER_F(streams_bench, deflate)->Args({1, 6})->Args({16, 6})->Args({256, 1})->Args({256, 6})->Args({256, 9});
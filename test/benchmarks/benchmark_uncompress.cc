@@ -0,0 +1,85 @@
+/* benchmark_uncompress.cc -- benchmark uncompress()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  if defined(ZLIB_COMPAT)
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#define NUM_TESTS 5
+
+static const size_t sizes[NUM_TESTS] = { 1, 64, 1024, 16 * 1024, 128 * 1024 };
+
+class uncompress_bench: public benchmark::Fixture {
+private:
+    size_t compressed_sizes[NUM_TESTS];
+    uint8_t *inbuff;
+    uint8_t *outbuff;
+    uint8_t *compressed_buff[NUM_TESTS];
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        const char teststr[42] = "Hello hello World broken Test tast mello.";
+        size_t max_size = sizes[NUM_TESTS - 1];
+
+        inbuff = (uint8_t *)zng_alloc(max_size + 1);
+        assert(inbuff != NULL);
+        outbuff = (uint8_t *)zng_alloc(max_size + 1);
+        assert(outbuff != NULL);
+
+        for (size_t pos = 0; pos < max_size; pos += 41)
+            memcpy(inbuff + pos, teststr, MIN(41, max_size - pos));
+
+        for (int i = 0; i < NUM_TESTS; i++) {
+            z_uintmax_t compr_len = PREFIX(compressBound)(sizes[i]);
+            compressed_buff[i] = (uint8_t *)zng_alloc(compr_len);
+            assert(compressed_buff[i] != NULL);
+            int err = PREFIX(compress)(compressed_buff[i], &compr_len, inbuff, sizes[i]);
+            assert(err == Z_OK);
+            Z_UNUSED(err);
+            compressed_sizes[i] = compr_len;
+        }
+    }
+
+    void Bench(benchmark::State& state) {
+        int index = 0;
+        int err = Z_OK;
+
+        /* Find the compressed buffer of the size to uncompress */
+        while (sizes[index] < (size_t)state.range(0) && index < NUM_TESTS - 1)
+            index++;
+
+        for (auto _ : state) {
+            z_uintmax_t out_size = (z_uintmax_t)state.range(0);
+            err = PREFIX(uncompress)(outbuff, &out_size, compressed_buff[index], compressed_sizes[index]);
+        }
+
+        benchmark::DoNotOptimize(err);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(inbuff);
+        zng_free(outbuff);
+        for (int i = 0; i < NUM_TESTS; i++)
+            zng_free(compressed_buff[i]);
+    }
+};
+
+#define BENCHMARK_UNCOMPRESS(name) \
+    BENCHMARK_DEFINE_F(uncompress_bench, name)(benchmark::State& state) { \
+        Bench(state); \
+    } \
+    BENCHMARK_REGISTER_F(uncompress_bench, name)->Arg(1)->Arg(64)->Arg(1024)->Arg(16<<10)->Arg(128<<10);
+
+BENCHMARK_UNCOMPRESS(uncompress_bench);
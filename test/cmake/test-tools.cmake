@@ -46,6 +46,21 @@ add_test(NAME minideflate-invalid
     -DSUCCESS_EXIT=64
     -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-redirect.cmake)
 
+if(MINIDICT_COMMAND)
+    set(TEST_COMMAND ${MINIDICT_COMMAND} "--help")
+    add_test(NAME minidict-help
+        COMMAND ${CMAKE_COMMAND}
+        "-DCOMMAND=${TEST_COMMAND}"
+        -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-redirect.cmake)
+
+    set(TEST_COMMAND ${MINIDICT_COMMAND} "--invalid")
+    add_test(NAME minidict-invalid
+        COMMAND ${CMAKE_COMMAND}
+        "-DCOMMAND=${TEST_COMMAND}"
+        -DSUCCESS_EXIT=64
+        -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-redirect.cmake)
+endif()
+
 set(TEST_COMMAND ${SWITCHLEVELS_COMMAND} "--help")
 add_test(NAME switchlevels-help
     COMMAND ${CMAKE_COMMAND}
@@ -61,6 +76,26 @@ add_test(NAME makecrct
     -DIGNORE_LINE_ENDINGS=ON
     -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
 
+# Test generated crc32c tables match tables in source directory
+set(TEST_COMMAND ${MAKECRCT_COMMAND} "-c")
+add_test(NAME makecrct-crc32c
+    COMMAND ${CMAKE_COMMAND}
+    "-DCOMMAND=${TEST_COMMAND}"
+    -DOUTPUT=${PROJECT_BINARY_DIR}/Testing/Temporary/crc32c_braid_tbl._h
+    -DCOMPARE=${PROJECT_SOURCE_DIR}/crc32c_braid_tbl.h
+    -DIGNORE_LINE_ENDINGS=ON
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
+
+# Test generated crc64 tables match tables in source directory
+set(TEST_COMMAND ${MAKECRCT_COMMAND} "-64")
+add_test(NAME makecrct-crc64
+    COMMAND ${CMAKE_COMMAND}
+    "-DCOMMAND=${TEST_COMMAND}"
+    -DOUTPUT=${PROJECT_BINARY_DIR}/Testing/Temporary/crc64_braid_tbl._h
+    -DCOMPARE=${PROJECT_SOURCE_DIR}/crc64_braid_tbl.h
+    -DIGNORE_LINE_ENDINGS=ON
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
+
 # Test generated inflate tables match tables in source directory
 add_test(NAME makefixed
     COMMAND ${CMAKE_COMMAND}
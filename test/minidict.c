@@ -0,0 +1,159 @@
+/* minidict.c -- train a preset dictionary from sample files
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+
+#include <stdio.h>
+
+#include "zutil.h"
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#  include <fcntl.h>
+#  include <io.h>
+#  define SET_BINARY_MODE(file) setmode(fileno(file), O_BINARY)
+#else
+#  define SET_BINARY_MODE(file)
+#endif
+
+/* ===========================================================================
+ * Read a whole file into memory, return NULL on failure
+ */
+static uint8_t *read_file(const char *path, size_t *size) {
+    uint8_t *buf = NULL;
+    size_t len = 0, cap = 0, read;
+    FILE *fin = fopen(path, "rb");
+
+    if (fin == NULL) {
+        fprintf(stderr, "Failed to open file: %s\n", path);
+        return NULL;
+    }
+    do {
+        if (len == cap) {
+            uint8_t *grown;
+            cap = cap ? cap * 2 : 65536;
+            grown = (uint8_t *)realloc(buf, cap);
+            if (grown == NULL) {
+                fprintf(stderr, "Not enough memory\n");
+                free(buf);
+                fclose(fin);
+                return NULL;
+            }
+            buf = grown;
+        }
+        read = fread(buf + len, 1, cap - len, fin);
+        len += read;
+    } while (read > 0);
+    fclose(fin);
+    *size = len;
+    return buf;
+}
+
+static void show_help(void) {
+    printf("Usage: minidict [-c capacity] [-s size] [-o output] sample files...\n\n"
+           "  -c : dictionary capacity in bytes (1 to 32768)\n"
+           "  -s : split each file into samples of size bytes\n"
+           "  -o : write the dictionary to output instead of standard output\n\n");
+}
+
+int main(int argc, char **argv) {
+    int32_t i, first;
+    size_t dict_cap = 32768;
+    size_t split = 0;
+    size_t nsamples = 0, max_samples = 0, nfiles, dict_len, f, j;
+    const char *out_file = NULL;
+    const uint8_t **samples = NULL;
+    uint8_t **files = NULL;
+    size_t *sizes = NULL;
+    uint8_t *dict;
+    FILE *fout = stdout;
+
+    if (argc == 1) {
+        show_help();
+        return 64;   /* EX_USAGE */
+    }
+
+    for (i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+            dict_cap = (size_t)atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+            split = (size_t)atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+            out_file = argv[++i];
+        else if (strcmp(argv[i], "--help") == 0) {
+            show_help();
+            return 0;
+        } else if (argv[i][0] == '-') {
+            show_help();
+            return 64;   /* EX_USAGE */
+        } else
+            break;
+    }
+    if (i == argc || dict_cap == 0 || dict_cap > 32768) {
+        show_help();
+        return 64;   /* EX_USAGE */
+    }
+
+    first = i;
+    nfiles = (size_t)(argc - first);
+    files = (uint8_t **)calloc(nfiles, sizeof(uint8_t *));
+    dict = (uint8_t *)malloc(dict_cap);
+    if (files == NULL || dict == NULL) {
+        fprintf(stderr, "Not enough memory\n");
+        exit(1);
+    }
+
+    for (f = 0; f < nfiles; f++) {
+        size_t size, count;
+
+        files[f] = read_file(argv[first + f], &size);
+        if (files[f] == NULL)
+            exit(1);
+
+        count = (split && size) ? (size + split - 1) / split : 1;
+        if (nsamples + count > max_samples) {
+            max_samples = MAX(max_samples * 2, nsamples + count);
+            samples = (const uint8_t **)realloc((void *)samples, max_samples * sizeof(uint8_t *));
+            sizes = (size_t *)realloc(sizes, max_samples * sizeof(size_t));
+            if (samples == NULL || sizes == NULL) {
+                fprintf(stderr, "Not enough memory\n");
+                exit(1);
+            }
+        }
+        for (j = 0; j < count; j++) {
+            size_t offset = j * split;
+            samples[nsamples] = files[f] + offset;
+            sizes[nsamples++] = split ? MIN(split, size - offset) : size;
+        }
+    }
+
+    dict_len = PREFIX(train_dictionary)(samples, sizes, nsamples, dict, dict_cap);
+    if (dict_len == 0) {
+        fprintf(stderr, "Failed to train dictionary\n");
+        exit(1);
+    }
+
+    SET_BINARY_MODE(stdout);
+    if (out_file != NULL) {
+        fout = fopen(out_file, "wb");
+        if (fout == NULL) {
+            fprintf(stderr, "Failed to open file: %s\n", out_file);
+            exit(1);
+        }
+    }
+    if (fwrite(dict, 1, dict_len, fout) != dict_len) {
+        fprintf(stderr, "Failed to write dictionary\n");
+        exit(1);
+    }
+    if (fout != stdout)
+        fclose(fout);
+    fprintf(stderr, "%zu samples, %zu byte dictionary\n", nsamples, dict_len);
+
+    for (f = 0; f < nfiles; f++)
+        free(files[f]);
+    free(files);
+    free((void *)samples);
+    free(sizes);
+    free(dict);
+    return 0;
+}
@@ -363,10 +363,60 @@ INSTANTIATE_TEST_SUITE_P(adler32, adler32_variant, testing::ValuesIn(tests));
         hash(GetParam(), func); \
     }
 
+/* Compares a variant against combining the check values one at a time, with counts crossing the block size */
+class adler32_combine_n : public ::testing::Test {
+public:
+    uint32_t *adlers;
+    size_t count;
+
+    void SetUp() override {
+        count = 65536 * 2 + 7;
+        adlers = (uint32_t *)malloc(count * sizeof(uint32_t));
+        ASSERT_TRUE(adlers != NULL);
+        srand(56);
+        for (size_t i = 0; i < count; i++)
+            adlers[i] = (uint32_t)(rand() % 65521) | ((uint32_t)(rand() % 65521) << 16);
+        /* Extremes of both halves */
+        adlers[0] = 0;
+        adlers[1] = 0xfff0fff0;
+        adlers[2] = 1;
+    }
+
+    void TearDown() override {
+        free(adlers);
+    }
+
+    void combine(adler32_combine_n_func combine_n) {
+        static const size_t counts[] = { 0, 1, 2, 3, 4, 5, 8, 17, 100, 65535, 65536, 65537, 65536 * 2 + 7 };
+        static const z_off64_t lens[] = { 0, 1, 16, 65520, 65521, 1024 * 1024, (z_off64_t)1 << 40 };
+
+        for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+            uint32_t op = (uint32_t)(lens[l] % 65521);
+            for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+                uint32_t expect = 0x12345678;
+                for (size_t i = 0; i < counts[c]; i++)
+                    expect = (uint32_t)PREFIX4(adler32_combine)(expect, adlers[i], lens[l]);
+                EXPECT_EQ(combine_n(0x12345678, adlers, counts[c], op), expect) << "len " << lens[l] << " count " << counts[c];
+            }
+        }
+    }
+};
+
+#define TEST_ADLER32_COMBINE_N(name, func, support_flag) \
+    TEST_F(adler32_combine_n, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        combine(func); \
+    }
+
 TEST_ADLER32(c, adler32_c, 1)
+TEST_ADLER32_COMBINE_N(c, adler32_combine_n_c, 1)
 
 #ifdef DISABLE_RUNTIME_CPU_DETECTION
 TEST_ADLER32(native, native_adler32, 1)
+TEST_ADLER32_COMBINE_N(native, native_adler32_combine_n, 1)
 #else
 
 #ifdef ARM_NEON
@@ -384,6 +434,7 @@ TEST_ADLER32(ssse3, adler32_ssse3, test_cpu_features.x86.has_ssse3)
 #endif
 #ifdef X86_AVX2
 TEST_ADLER32(avx2, adler32_avx2, test_cpu_features.x86.has_avx2)
+TEST_ADLER32_COMBINE_N(avx2, adler32_combine_n_avx2, test_cpu_features.x86.has_avx2)
 #endif
 #ifdef X86_AVX512
 TEST_ADLER32(avx512, adler32_avx512, test_cpu_features.x86.has_avx512_common)
@@ -393,3 +444,24 @@ TEST_ADLER32(avx512_vnni, adler32_avx512_vnni, test_cpu_features.x86.has_avx512v
 #endif
 
 #endif
+
+#ifndef ZLIB_COMPAT
+TEST(adler32, combine_api) {
+    static const size_t chunk = 1000;
+    uint8_t buf[chunk * 9 + 1];
+    uint32_t adlers[9], expect, op;
+
+    for (size_t i = 0; i < sizeof(buf); i++)
+        buf[i] = (uint8_t)(i * 7 + (i >> 5));
+    for (size_t i = 0; i < 9; i++)
+        adlers[i] = zng_adler32_z(1, buf + 1 + i * chunk, chunk);
+
+    op = zng_adler32_combine_gen((z_off64_t)chunk);
+    expect = zng_adler32_z(1, buf, sizeof(buf));
+    EXPECT_EQ(zng_adler32_combine_n(zng_adler32_z(1, buf, 1), adlers, 9, op), expect);
+    EXPECT_EQ(zng_adler32_combine_op(zng_adler32_z(1, buf, 1 + chunk * 8), adlers[8], op), expect);
+    EXPECT_EQ(zng_adler32_combine_op(adlers[0], adlers[1], op), zng_adler32_combine(adlers[0], adlers[1], (z_off64_t)chunk));
+    EXPECT_EQ(zng_adler32_combine_gen(-1), 0xffffffffu);
+    EXPECT_EQ(zng_adler32_combine_op(adlers[0], adlers[1], 0xffffffff), 0xffffffffu);
+}
+#endif
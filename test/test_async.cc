@@ -0,0 +1,253 @@
+/* test_async.cc - Test the asynchronous job queue */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#  include <poll.h>
+#endif
+
+#include <atomic>
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define NUM_JOBS  40
+#define DATA_SIZE (256 * 1024)
+#define OUT_SIZE  (DATA_SIZE + DATA_SIZE / 8 + 1024)
+#define CHUNK     (16 * 1024)
+
+class async : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *uncompr;
+    zng_async_job jobs[NUM_JOBS];
+
+    void SetUp() override {
+        static const char *const words[] = { "response ", "header ", "connection ", "keep-alive ", "content ", "\r\n" };
+        uint32_t seed = 75;
+
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(NUM_JOBS * OUT_SIZE);
+        uncompr = (uint8_t *)malloc(NUM_JOBS * DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+
+        fill_words(data, DATA_SIZE, words, sizeof(words) / sizeof(words[0]), &seed);
+        memset(jobs, 0, sizeof(jobs));
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* Set up job i to compress the first len bytes of data, or to uncompress what job i compressed */
+    void buffer_job(int i, size_t len, int32_t level, int32_t decompress) {
+        zng_async_job *job = &jobs[i];
+
+        if (decompress) {
+            job->src = compr + i * OUT_SIZE;
+            job->src_len = job->dest_len;
+            job->dest = uncompr + i * DATA_SIZE;
+            job->dest_len = DATA_SIZE;
+        } else {
+            job->src = data;
+            job->src_len = len;
+            job->dest = compr + i * OUT_SIZE;
+            job->dest_len = OUT_SIZE;
+        }
+        job->strm = NULL;
+        job->decompress = decompress;
+        job->level = level;
+        job->status = Z_VERSION_ERROR;
+    }
+};
+
+TEST_F(async, buffers) {
+    zng_async_queue *queue = zng_async_create(4);
+    zng_async_job *job;
+    uint8_t out[OUT_SIZE];
+    int i, count;
+
+    ASSERT_TRUE(queue != NULL);
+    for (i = 0; i < NUM_JOBS; i++) {
+        buffer_job(i, DATA_SIZE - i * 5000, i % 10, 0);
+        jobs[i].opaque = &jobs[i];
+        EXPECT_EQ(zng_async_submit(queue, &jobs[i]), Z_OK);
+    }
+
+    /* Each job is handed back once, with the output of compress2() */
+    for (count = 0; (job = zng_async_wait(queue)) != NULL; count++) {
+        i = (int)(job - jobs);
+        ASSERT_TRUE(i >= 0 && i < NUM_JOBS && job->opaque == job);
+        job->opaque = NULL;
+        EXPECT_EQ(job->status, Z_OK);
+
+        size_t out_len = OUT_SIZE;
+        EXPECT_EQ(zng_compress2(out, &out_len, data, job->src_len, job->level), Z_OK);
+        EXPECT_EQ(job->dest_len, out_len) << "job " << i;
+        EXPECT_EQ(memcmp(job->dest, out, out_len), 0) << "job " << i;
+    }
+    EXPECT_EQ(count, NUM_JOBS);
+    EXPECT_TRUE(zng_async_poll(queue) == NULL);
+
+    for (i = 0; i < NUM_JOBS; i++) {
+        buffer_job(i, 0, 0, 1);
+        EXPECT_EQ(zng_async_submit(queue, &jobs[i]), Z_OK);
+    }
+    for (count = 0; (job = zng_async_wait(queue)) != NULL; count++) {
+        i = (int)(job - jobs);
+        EXPECT_EQ(job->status, Z_OK);
+        EXPECT_EQ(job->dest_len, (size_t)(DATA_SIZE - i * 5000));
+        EXPECT_EQ(memcmp(job->dest, data, job->dest_len), 0) << "job " << i;
+    }
+    EXPECT_EQ(count, NUM_JOBS);
+    zng_async_destroy(queue);
+}
+
+static std::atomic<int> completed;
+
+static void count_job(zng_async_job *job) {
+    if (job->status == Z_OK)
+        completed++;
+}
+
+TEST_F(async, callbacks) {
+    zng_async_queue *queue = zng_async_create(3);
+    int i;
+
+    ASSERT_TRUE(queue != NULL);
+    completed = 0;
+    for (i = 0; i < NUM_JOBS; i++) {
+        buffer_job(i, 1000 + i * 3000, 1, 0);
+        jobs[i].callback = count_job;
+        EXPECT_EQ(zng_async_submit(queue, &jobs[i]), Z_OK);
+    }
+
+    /* Jobs with a callback are not handed back, and destroy waits for them */
+    zng_async_destroy(queue);
+    EXPECT_EQ(completed, NUM_JOBS);
+    for (i = 0; i < NUM_JOBS; i++) {
+        size_t len = DATA_SIZE;
+        EXPECT_EQ(zng_uncompress(uncompr, &len, jobs[i].dest, jobs[i].dest_len), Z_OK);
+        EXPECT_EQ(len, (size_t)(1000 + i * 3000));
+    }
+
+    queue = zng_async_create(1);
+    ASSERT_TRUE(queue != NULL);
+    buffer_job(0, 100, 6, 0);
+    jobs[0].callback = count_job;
+    EXPECT_EQ(zng_async_submit(queue, &jobs[0]), Z_OK);
+    EXPECT_TRUE(zng_async_wait(queue) == NULL);
+    EXPECT_EQ(completed, NUM_JOBS + 1);
+    zng_async_destroy(queue);
+}
+
+TEST_F(async, streams) {
+    zng_async_queue *queue = zng_async_create(2);
+    zng_stream strm[2];
+    zng_async_job *job;
+    size_t pos[2] = { 0, 0 };
+    int ended = 0;
+
+    ASSERT_TRUE(queue != NULL);
+
+    /* Two streams, deflated a chunk per job as an event loop would, waiting on the notification in between */
+    for (int i = 0; i < 2; i++) {
+        memset(&strm[i], 0, sizeof(strm[i]));
+        EXPECT_EQ(zng_deflateInit(&strm[i], i ? 9 : 1), Z_OK);
+        strm[i].next_out = compr + i * OUT_SIZE;
+        strm[i].avail_out = OUT_SIZE;
+        jobs[i].strm = &strm[i];
+        jobs[i].flush = Z_NO_FLUSH;
+        strm[i].next_in = data;
+        strm[i].avail_in = CHUNK;
+        pos[i] = CHUNK;
+        EXPECT_EQ(zng_async_submit(queue, &jobs[i]), Z_OK);
+    }
+
+    while (ended < 2) {
+#ifndef _WIN32
+        struct pollfd pfd;
+        pfd.fd = zng_async_fd(queue);
+        pfd.events = POLLIN;
+        ASSERT_GE(pfd.fd, 0);
+        ASSERT_EQ(poll(&pfd, 1, 10000), 1);
+        job = zng_async_poll(queue);
+#else
+        job = zng_async_wait(queue);
+#endif
+        ASSERT_TRUE(job != NULL);
+        int i = (int)(job - jobs);
+        if (job->flush == Z_FINISH) {
+            EXPECT_EQ(job->status, Z_STREAM_END);
+            ended++;
+            continue;
+        }
+        EXPECT_EQ(job->status, Z_OK);
+        EXPECT_EQ(strm[i].avail_in, 0u);
+        strm[i].next_in = data + pos[i];
+        strm[i].avail_in = (uint32_t)MIN(CHUNK, DATA_SIZE - pos[i]);
+        pos[i] += strm[i].avail_in;
+        if (pos[i] == DATA_SIZE)
+            job->flush = Z_FINISH;
+        EXPECT_EQ(zng_async_submit(queue, job), Z_OK);
+    }
+#ifndef _WIN32
+    /* The notification is no longer readable once every job was handed back */
+    struct pollfd pfd;
+    pfd.fd = zng_async_fd(queue);
+    pfd.events = POLLIN;
+    EXPECT_EQ(poll(&pfd, 1, 0), 0);
+#endif
+
+    for (int i = 0; i < 2; i++) {
+        size_t len = DATA_SIZE;
+        EXPECT_EQ(strm[i].total_in, (size_t)DATA_SIZE);
+        EXPECT_EQ(zng_uncompress(uncompr, &len, compr + i * OUT_SIZE, strm[i].total_out), Z_OK);
+        EXPECT_EQ(len, (size_t)DATA_SIZE);
+        EXPECT_EQ(memcmp(uncompr, data, DATA_SIZE), 0);
+        EXPECT_EQ(zng_deflateEnd(&strm[i]), Z_OK);
+    }
+    zng_async_destroy(queue);
+}
+
+TEST_F(async, errors) {
+    zng_async_queue *queue = zng_async_create(0);
+
+    ASSERT_TRUE(queue != NULL);
+    EXPECT_EQ(zng_async_submit(NULL, &jobs[0]), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_async_submit(queue, NULL), Z_STREAM_ERROR);
+    EXPECT_TRUE(zng_async_poll(NULL) == NULL);
+    EXPECT_TRUE(zng_async_wait(NULL) == NULL);
+    EXPECT_EQ(zng_async_fd(NULL), -1);
+    EXPECT_TRUE(zng_async_poll(queue) == NULL);
+    EXPECT_TRUE(zng_async_wait(queue) == NULL);
+
+    /* Errors of the jobs are reported in their status */
+    buffer_job(0, 1000, 6, 0);
+    jobs[0].dest_len = 10;
+    buffer_job(1, 1000, 10, 0);
+    buffer_job(2, 1000, 6, 0);
+    EXPECT_EQ(zng_async_submit(queue, &jobs[0]), Z_OK);
+    EXPECT_EQ(zng_async_submit(queue, &jobs[1]), Z_OK);
+    EXPECT_EQ(zng_async_submit(queue, &jobs[2]), Z_OK);
+    for (int n = 0; n < 3; n++) {
+        zng_async_job *job = zng_async_wait(queue);
+        ASSERT_TRUE(job != NULL);
+        EXPECT_EQ(job->status, job == &jobs[0] ? Z_BUF_ERROR : job == &jobs[1] ? Z_STREAM_ERROR : Z_OK);
+    }
+
+    buffer_job(2, 0, 0, 1);
+    jobs[2].src_len /= 2;
+    EXPECT_EQ(zng_async_submit(queue, &jobs[2]), Z_OK);
+    EXPECT_TRUE(zng_async_wait(queue) == &jobs[2]);
+    EXPECT_EQ(jobs[2].status, Z_DATA_ERROR);
+    zng_async_destroy(queue);
+    zng_async_destroy(NULL);
+}
@@ -0,0 +1,150 @@
+/* test_batch.cc - Test zng_compress_batch() and zng_uncompress_batch() */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define NUM_ITEMS  300
+#define MAX_RECORD 3000
+#define OUT_SIZE   (MAX_RECORD * 2)
+
+class batch : public ::testing::Test {
+public:
+    uint8_t *records, *compr, *uncompr;
+    size_t sizes[NUM_ITEMS];
+    zng_batch_item items[NUM_ITEMS];
+
+    void SetUp() override {
+        static const char *fields[] = { "\"id\":", "\"name\":\"", "\"state\":\"active\",", "\"tags\":[],", "\"n\":" };
+        uint32_t seed = 72;
+
+        records = (uint8_t *)malloc(NUM_ITEMS * MAX_RECORD);
+        compr = (uint8_t *)malloc(NUM_ITEMS * OUT_SIZE);
+        uncompr = (uint8_t *)malloc(NUM_ITEMS * MAX_RECORD);
+        ASSERT_TRUE(records != NULL && compr != NULL && uncompr != NULL);
+
+        /* JSON-like records of 0 to MAX_RECORD - 1 bytes, mostly short, and one of random bytes */
+        for (int i = 0; i < NUM_ITEMS; i++) {
+            uint8_t *rec = records + i * MAX_RECORD;
+            sizes[i] = (lcg_next(&seed) >> 16) % (i % 10 ? 300 : MAX_RECORD);
+            for (size_t pos = 0; pos < sizes[i];) {
+                uint32_t rnd = lcg_next(&seed);
+                const char *field = fields[(rnd >> 16) % 5];
+                size_t len = MIN(strlen(field), sizes[i] - pos);
+                memcpy(rec + pos, field, len);
+                pos += len;
+                if (pos < sizes[i])
+                    rec[pos++] = (uint8_t)('0' + (rnd >> 24) % 10);
+            }
+        }
+        fill_random(records + 7 * MAX_RECORD, sizes[7], &seed);
+    }
+
+    void TearDown() override {
+        free(records);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* Compress the records as a batch, and with one thread check that it gives the same output as compress2() */
+    void compress(int32_t level, int32_t threads) {
+        uint8_t out[OUT_SIZE];
+
+        for (int i = 0; i < NUM_ITEMS; i++) {
+            items[i].src = records + i * MAX_RECORD;
+            items[i].src_len = sizes[i];
+            items[i].dest = compr + i * OUT_SIZE;
+            items[i].dest_len = OUT_SIZE;
+            items[i].status = Z_VERSION_ERROR;
+        }
+        EXPECT_EQ(zng_compress_batch(items, NUM_ITEMS, level, threads), Z_OK);
+        for (int i = 0; i < NUM_ITEMS; i++)
+            EXPECT_EQ(items[i].status, Z_OK);
+        if (threads > 1)
+            return;
+
+        for (int i = 0; i < NUM_ITEMS; i++) {
+            size_t out_len = OUT_SIZE;
+            EXPECT_EQ(zng_compress2(out, &out_len, records + i * MAX_RECORD, sizes[i], level), Z_OK);
+            EXPECT_EQ(items[i].dest_len, out_len) << "level " << level << " item " << i;
+            EXPECT_EQ(memcmp(items[i].dest, out, out_len), 0) << "level " << level << " item " << i;
+        }
+    }
+
+    /* Uncompress the items as a batch and compare them with the records */
+    void uncompress(int32_t threads) {
+        for (int i = 0; i < NUM_ITEMS; i++) {
+            items[i].src = compr + i * OUT_SIZE;
+            items[i].src_len = items[i].dest_len;
+            items[i].dest = uncompr + i * MAX_RECORD;
+            items[i].dest_len = MAX_RECORD;
+            items[i].status = Z_VERSION_ERROR;
+        }
+        EXPECT_EQ(zng_uncompress_batch(items, NUM_ITEMS, threads), Z_OK);
+
+        for (int i = 0; i < NUM_ITEMS; i++) {
+            EXPECT_EQ(items[i].status, Z_OK);
+            EXPECT_EQ(items[i].dest_len, sizes[i]);
+            EXPECT_EQ(memcmp(items[i].dest, records + i * MAX_RECORD, sizes[i]), 0) << "item " << i;
+        }
+    }
+};
+
+TEST_F(batch, levels) {
+    /* The hash table is cleared lazily between the items, which must not change the output */
+    for (int32_t level = 0; level <= 9; level++) {
+        compress(level, 1);
+        uncompress(1);
+    }
+}
+
+TEST_F(batch, threads) {
+    compress(Z_DEFAULT_COMPRESSION, 4);
+    uncompress(4);
+    compress(1, 100);
+    uncompress(3);
+}
+
+TEST_F(batch, errors) {
+    /* Items that fail do not keep the others from being processed */
+    compress(6, 1);
+    for (int i = 0; i < NUM_ITEMS; i++) {
+        items[i].src = compr + i * OUT_SIZE;
+        items[i].src_len = items[i].dest_len;
+        items[i].dest = uncompr + i * MAX_RECORD;
+        items[i].dest_len = MAX_RECORD;
+        items[i].status = Z_VERSION_ERROR;
+    }
+    ASSERT_GT(sizes[10], 2u);
+    items[10].dest_len = 2;
+    items[15].src_len -= 1;
+    items[19].src_len = 0;
+    EXPECT_EQ(zng_uncompress_batch(items, NUM_ITEMS, 2), Z_BUF_ERROR);
+    for (int i = 0; i < NUM_ITEMS; i++) {
+        if (i == 10)
+            EXPECT_EQ(items[i].status, Z_BUF_ERROR);
+        else if (i == 15 || i == 19)
+            EXPECT_EQ(items[i].status, Z_DATA_ERROR);
+        else
+            EXPECT_EQ(items[i].status, Z_OK);
+    }
+
+    /* Output that does not fit, and arguments that are invalid */
+    items[0].src = records;
+    items[0].src_len = sizes[0];
+    items[0].dest = compr;
+    items[0].dest_len = 4;
+    EXPECT_EQ(zng_compress_batch(items, 1, 6, 1), Z_BUF_ERROR);
+    EXPECT_EQ(zng_compress_batch(items, 1, 10, 1), Z_STREAM_ERROR);
+    EXPECT_EQ(items[0].status, Z_STREAM_ERROR);
+    EXPECT_EQ(zng_compress_batch(NULL, 1, 6, 1), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_uncompress_batch(items, 0, 1), Z_OK);
+}
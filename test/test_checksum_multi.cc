@@ -0,0 +1,114 @@
+/* test_checksum_multi.cc -- multi-buffer crc32 and adler32 unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "zutil.h"
+#include "zutil_p.h"
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+}
+
+#include <gtest/gtest.h>
+
+/* Compares a multi-buffer variant against hashing every buffer on its own, for batches that
+ * cover equal, mixed and tiny lengths as well as counts that are not a multiple of the width */
+class checksum_multi : public ::testing::Test {
+public:
+    uint8_t *buf;
+    size_t size;
+
+    void SetUp() override {
+        size = 64 * 1024;
+        buf = (uint8_t *)zng_alloc(size);
+        ASSERT_TRUE(buf != NULL);
+        srand(54);
+        for (size_t i = 0; i < size; i++)
+            buf[i] = (uint8_t)rand();
+    }
+
+    void TearDown() override {
+        zng_free(buf);
+    }
+
+    void hash(checksum_multi_func multi, crc32_func single, uint32_t init) {
+        static const size_t max_lens[] = { 0, 1, 15, 16, 17, 64, 100, 512, 4096, 5552 + 37 };
+        const uint8_t *bufs[13];
+        size_t lens[13];
+        uint32_t out[13];
+
+        for (size_t m = 0; m < sizeof(max_lens) / sizeof(max_lens[0]); m++) {
+            for (size_t n = 0; n <= 13; n++) {
+                for (size_t i = 0; i < n; i++) {
+                    /* Alternate between equal lengths and lengths varying by a few blocks */
+                    lens[i] = (m & 1) ? max_lens[m] : max_lens[m] - MIN(max_lens[m], (i * 7) % 40);
+                    bufs[i] = buf + (i * 4099 + m * 13) % (size - lens[i]);
+                }
+                memset(out, 0, sizeof(out));
+                multi(bufs, lens, out, n);
+                for (size_t i = 0; i < n; i++)
+                    EXPECT_EQ(out[i], single(init, bufs[i], lens[i])) << "max len " << max_lens[m] << " n " << n << " i " << i;
+            }
+        }
+    }
+};
+
+#define TEST_CRC32_MULTI(name, func, support_flag) \
+    TEST_F(checksum_multi, crc32_ ## name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func, PREFIX(crc32_braid), 0); \
+    }
+
+#define TEST_ADLER32_MULTI(name, func, support_flag) \
+    TEST_F(checksum_multi, adler32_ ## name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func, adler32_c, 1); \
+    }
+
+TEST_CRC32_MULTI(c, crc32_multi_c, 1)
+TEST_ADLER32_MULTI(c, adler32_multi_c, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CRC32_MULTI(native, native_crc32_multi, 1)
+TEST_ADLER32_MULTI(native, native_adler32_multi, 1)
+
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CRC32_MULTI(pclmulqdq, crc32_multi_pclmulqdq, test_cpu_features.x86.has_pclmulqdq)
+#endif
+#ifdef X86_AVX2
+TEST_ADLER32_MULTI(avx2, adler32_multi_avx2, test_cpu_features.x86.has_avx2)
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+TEST_F(checksum_multi, api) {
+    const uint8_t *bufs[5];
+    size_t lens[5];
+    uint32_t crcs[5], adlers[5];
+
+    for (size_t i = 0; i < 5; i++) {
+        bufs[i] = buf + i * 1000;
+        lens[i] = 300 + i * 100;
+    }
+    zng_crc32_multi(bufs, lens, crcs, 5);
+    zng_adler32_multi(bufs, lens, adlers, 5);
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(crcs[i], zng_crc32_z(0, bufs[i], lens[i]));
+        EXPECT_EQ(adlers[i], zng_adler32_z(1, bufs[i], lens[i]));
+    }
+}
+#endif
@@ -0,0 +1,58 @@
+/* test_checksum_parallel.cc - Test crc32 and adler32 computed on several threads */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (8 * 1024 * 1024 + 12345)
+
+class checksum_parallel : public ::testing::Test {
+public:
+    uint8_t *buf;
+
+    void SetUp() override {
+        buf = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(buf != NULL);
+        srand(55);
+        for (size_t i = 0; i < DATA_SIZE; i++)
+            buf[i] = (uint8_t)rand();
+    }
+
+    void TearDown() override {
+        free(buf);
+    }
+};
+
+TEST_F(checksum_parallel, crc32) {
+    static const int32_t threads[] = { -1, 0, 1, 2, 3, 4, 7, 100 };
+    uint32_t expect = zng_crc32_z(0, buf, DATA_SIZE);
+    uint32_t expect_running = zng_crc32_z(0x12345678, buf, DATA_SIZE);
+
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        EXPECT_EQ(zng_crc32_parallel(0, buf, DATA_SIZE, threads[i]), expect) << "threads " << threads[i];
+        EXPECT_EQ(zng_crc32_parallel(0x12345678, buf, DATA_SIZE, threads[i]), expect_running)
+            << "threads " << threads[i];
+    }
+    EXPECT_EQ(zng_crc32_parallel(0, buf, 1000, 4), zng_crc32_z(0, buf, 1000));
+    EXPECT_EQ(zng_crc32_parallel(0x12345678, buf, 0, 4), 0x12345678u);
+    EXPECT_EQ(zng_crc32_parallel(0x12345678, NULL, 0, 4), 0u);
+}
+
+TEST_F(checksum_parallel, adler32) {
+    static const int32_t threads[] = { -1, 0, 1, 2, 3, 4, 7, 100 };
+    uint32_t expect = zng_adler32_z(1, buf, DATA_SIZE);
+    uint32_t expect_running = zng_adler32_z(0x12345678, buf, DATA_SIZE);
+
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        EXPECT_EQ(zng_adler32_parallel(1, buf, DATA_SIZE, threads[i]), expect) << "threads " << threads[i];
+        EXPECT_EQ(zng_adler32_parallel(0x12345678, buf, DATA_SIZE, threads[i]), expect_running)
+            << "threads " << threads[i];
+    }
+    EXPECT_EQ(zng_adler32_parallel(1, buf, 1000, 4), zng_adler32_z(1, buf, 1000));
+    EXPECT_EQ(zng_adler32_parallel(0x12345678, buf, 0, 4), 0x12345678u);
+    EXPECT_EQ(zng_adler32_parallel(0x12345678, NULL, 0, 4), 1u);
+}
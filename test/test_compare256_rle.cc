@@ -11,6 +11,8 @@ extern "C" {
 #  include "zbuild.h"
 #  include "zutil.h"
 #  include "compare256_rle.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
 }
 
 #include <gtest/gtest.h>
@@ -52,6 +54,10 @@ static inline void compare256_rle_match_check(compare256_rle_func compare256_rle
 
 TEST_COMPARE256_RLE(c, compare256_rle_c, 1)
 
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_COMPARE256_RLE(native, native_compare256_rle, 1)
+#else
+
 #if BYTE_ORDER == LITTLE_ENDIAN && OPTIMAL_CMP >= 32
 TEST_COMPARE256_RLE(unaligned_16, compare256_rle_unaligned_16, 1)
 #  if defined(HAVE_BUILTIN_CTZ)
@@ -61,3 +67,15 @@ TEST_COMPARE256_RLE(unaligned_32, compare256_rle_unaligned_32, 1)
 TEST_COMPARE256_RLE(unaligned_64, compare256_rle_unaligned_64, 1)
 #  endif
 #endif
+
+#if defined(X86_SSE2) && defined(HAVE_BUILTIN_CTZ)
+TEST_COMPARE256_RLE(sse2, compare256_rle_sse2, test_cpu_features.x86.has_sse2)
+#endif
+#if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
+TEST_COMPARE256_RLE(avx2, compare256_rle_avx2, test_cpu_features.x86.has_avx2)
+#endif
+#if defined(ARM_NEON) && defined(HAVE_BUILTIN_CTZLL)
+TEST_COMPARE256_RLE(neon, compare256_rle_neon, test_cpu_features.arm.has_neon)
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+/* test_compress_cache.cc - Test that compress() and uncompress() do not depend on earlier calls, whose streams may
+ * be cached and reused, and that deflateReset() compresses the same as a new stream */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (100 * 1024)
+#define COMPR_SIZE (DATA_SIZE + DATA_SIZE / 8 + 1024)
+
+class compress_cache : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *expect, *uncompr;
+
+    void SetUp() override {
+        static const char *const words[] = { "cache ", "state ", "level ", "window ", "reset ", "stream ", "\n" };
+        uint32_t seed = 73;
+
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(COMPR_SIZE);
+        expect = (uint8_t *)malloc(COMPR_SIZE);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && expect != NULL && uncompr != NULL);
+
+        /* Words, with a stretch of random bytes in the middle */
+        fill_words(data, DATA_SIZE, words, sizeof(words) / sizeof(words[0]), &seed);
+        fill_random(data + DATA_SIZE / 2, 5000, &seed);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(expect);
+        free(uncompr);
+    }
+
+    /* Compress len bytes of data at offset with strm, which is new or was reset, and return the compressed size */
+    size_t deflate_expect(PREFIX3(stream) *strm, size_t offset, size_t len) {
+        strm->next_in = data + offset;
+        strm->avail_in = (uint32_t)len;
+        strm->next_out = expect;
+        strm->avail_out = COMPR_SIZE;
+        EXPECT_EQ(PREFIX(deflate)(strm, Z_FINISH), Z_STREAM_END);
+        return strm->total_out;
+    }
+
+    /* Compress and uncompress with compress2() and uncompress2(), and compare the output with that of a new stream */
+    void check(int level, size_t offset, size_t len) {
+        PREFIX3(stream) strm;
+        z_uintmax_t compr_len = COMPR_SIZE;
+
+        EXPECT_EQ(PREFIX(compress2)(compr, &compr_len, data + offset, len, level), Z_OK);
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit)(&strm, level), Z_OK);
+        size_t expect_len = deflate_expect(&strm, offset, len);
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+        ASSERT_EQ(compr_len, expect_len) << "level " << level << " offset " << offset << " len " << len;
+        EXPECT_EQ(memcmp(compr, expect, expect_len), 0) << "level " << level << " offset " << offset << " len " << len;
+
+        EXPECT_EQ(check_uncompress(uncompr, data + offset, len, compr, compr_len), Z_OK);
+    }
+};
+
+TEST_F(compress_cache, levels) {
+    static const size_t lens[] = { 0, 1, 100, 3000, 40000, DATA_SIZE };
+
+    /* More levels than a thread keeps streams for, in an order that makes them evict each other */
+    for (int round = 0; round < 3; round++) {
+        for (int level : { 6, 1, 9, -1, 4, 0, 2, 7, 6, 3, 8, 5 }) {
+            for (size_t len : lens)
+                check(level, (DATA_SIZE - len) * round / 2, len);
+        }
+    }
+}
+
+TEST_F(compress_cache, errors) {
+    z_uintmax_t compr_len = 4, uncompr_len = DATA_SIZE;
+
+    /* Calls that fail do not leave anything behind for the next ones */
+    EXPECT_EQ(PREFIX(compress2)(compr, &compr_len, data, 3000, 6), Z_BUF_ERROR);
+    check(6, 0, 2000);
+    compr_len = COMPR_SIZE;
+    EXPECT_EQ(PREFIX(compress2)(compr, &compr_len, data, 3000, 10), Z_STREAM_ERROR);
+    check(6, 1000, 2000);
+
+    compr_len = COMPR_SIZE;
+    EXPECT_EQ(PREFIX(compress2)(compr, &compr_len, data, 30000, 6), Z_OK);
+    EXPECT_EQ(PREFIX(uncompress)(uncompr, &uncompr_len, compr, compr_len / 2), Z_DATA_ERROR);
+    uncompr_len = 100;
+    EXPECT_EQ(PREFIX(uncompress)(uncompr, &uncompr_len, compr, compr_len), Z_BUF_ERROR);
+    compr[compr_len / 2] ^= 0x55;
+    uncompr_len = DATA_SIZE;
+    EXPECT_NE(PREFIX(uncompress)(uncompr, &uncompr_len, compr, compr_len), Z_OK);
+    check(6, 0, 30000);
+}
+
+TEST_F(compress_cache, deflate_reset) {
+    PREFIX3(stream) strm, fresh;
+
+    /* A stream that was reset compresses the same as a new one, whatever it compressed before */
+    for (int level : { 1, 4, 6, 9 }) {
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit)(&strm, level), Z_OK);
+        for (size_t len : { (size_t)DATA_SIZE, (size_t)500, (size_t)20000, (size_t)77 }) {
+            memset(&fresh, 0, sizeof(fresh));
+            EXPECT_EQ(PREFIX(deflateInit)(&fresh, level), Z_OK);
+            fresh.next_in = data + DATA_SIZE - len;
+            fresh.avail_in = (uint32_t)len;
+            fresh.next_out = compr;
+            fresh.avail_out = COMPR_SIZE;
+            EXPECT_EQ(PREFIX(deflate)(&fresh, Z_FINISH), Z_STREAM_END);
+
+            EXPECT_EQ(PREFIX(deflateReset)(&strm), Z_OK);
+            size_t expect_len = deflate_expect(&strm, DATA_SIZE - len, len);
+            ASSERT_EQ(fresh.total_out, expect_len) << "level " << level << " len " << len;
+            EXPECT_EQ(memcmp(compr, expect, expect_len), 0) << "level " << level << " len " << len;
+            EXPECT_EQ(PREFIX(deflateEnd)(&fresh), Z_OK);
+        }
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+    }
+}
@@ -0,0 +1,185 @@
+/* test_crc32c.cc -- crc32c unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "zutil.h"
+#include "zutil_p.h"
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+}
+
+#include <gtest/gtest.h>
+
+typedef uint32_t (*crc32c_fold_reset_func)(crc32_fold *crc);
+typedef void     (*crc32c_fold_copy_func)(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
+typedef uint32_t (*crc32c_fold_final_func)(crc32_fold *crc);
+
+typedef struct {
+    uint32_t crc;
+    const uint8_t *buf;
+    size_t len;
+    uint32_t expect;
+} crc32c_test;
+
+static const uint8_t zeros32[32] = { 0 };
+static const uint8_t ones32[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+static const uint8_t incrementing32[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+static const uint8_t decrementing32[32] = {
+    0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10,
+    0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+
+/* Check values from RFC 3720 appendix B.4 and common test strings */
+static const crc32c_test tests[] = {
+  {0x0, (const uint8_t *)"", 0, 0x0},
+  {0xffffffff, (const uint8_t *)"", 0, 0xffffffff},
+  {0x0, (const uint8_t *)"a", 1, 0xc1d04330},
+  {0x0, (const uint8_t *)"abc", 3, 0x364b3fb7},
+  {0x0, (const uint8_t *)"123456789", 9, 0xe3069283},
+  {0x0, (const uint8_t *)"The quick brown fox jumps over the lazy dog", 43, 0x22620404},
+  {0x0, zeros32, 32, 0x8a9136aa},
+  {0x0, ones32, 32, 0x62a8ab43},
+  {0x0, incrementing32, 32, 0x46dd794e},
+  {0x0, decrementing32, 32, 0x113fdb5c},
+  {0xe3069283, (const uint8_t *)"123456789", 9, 0xa86c53f4}
+};
+
+class crc32c_variant : public ::testing::TestWithParam<crc32c_test> {
+public:
+    void hash(crc32c_test param, crc32_func crc32c) {
+        uint32_t crc = param.len ? crc32c(param.crc, param.buf, param.len) : param.crc;
+        EXPECT_EQ(crc, param.expect);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(crc32c, crc32c_variant, testing::ValuesIn(tests));
+
+/* Compares a variant against the braided implementation for many lengths, alignments and initial values */
+class crc32c_random : public ::testing::Test {
+public:
+    uint8_t *buf;
+    uint8_t *dst;
+    size_t size;
+
+    void SetUp() override {
+        size = 4096 + 64;
+        buf = (uint8_t *)zng_alloc(size);
+        dst = (uint8_t *)zng_alloc(size);
+        ASSERT_TRUE(buf != NULL && dst != NULL);
+        srand(52);
+        for (size_t i = 0; i < size; i++)
+            buf[i] = (uint8_t)rand();
+    }
+
+    void TearDown() override {
+        zng_free(buf);
+        zng_free(dst);
+    }
+
+    void hash(crc32_func crc32c) {
+        static const size_t lens[] = { 1, 3, 15, 16, 17, 31, 32, 63, 64, 65, 127, 255, 256, 257, 1000, 4096 };
+        for (size_t offset = 0; offset < 16; offset += 5) {
+            for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                uint32_t init = (uint32_t)(i * 0x9e3779b9);
+                EXPECT_EQ(crc32c(init, buf + offset, lens[i]), crc32c_braid(init, buf + offset, lens[i]))
+                    << "offset " << offset << " len " << lens[i];
+            }
+        }
+    }
+
+    void fold_copy(crc32c_fold_reset_func reset, crc32c_fold_copy_func copy, crc32c_fold_final_func final) {
+        crc32_fold ALIGNED_(16) crc_state;
+        size_t pos = 0, chunk = 1;
+
+        /* Feed the data in growing chunks to cross every partial block path */
+        reset(&crc_state);
+        memset(dst, 0, size);
+        while (pos < size) {
+            size_t len = MIN(chunk, size - pos);
+            copy(&crc_state, dst + pos, buf + pos, len);
+            pos += len;
+            chunk = chunk * 3 + 1;
+        }
+        EXPECT_EQ(final(&crc_state), crc32c_braid(0, buf, size));
+        EXPECT_EQ(memcmp(dst, buf, size), 0);
+    }
+};
+
+#define TEST_CRC32C(name, func, support_flag) \
+    TEST_P(crc32c_variant, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(GetParam(), func); \
+    } \
+    TEST_F(crc32c_random, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func); \
+    }
+
+#define TEST_CRC32C_FOLD(name, reset, copy, final, support_flag) \
+    TEST_F(crc32c_random, name ## _fold_copy) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        fold_copy(reset, copy, final); \
+    }
+
+TEST_CRC32C(braid, crc32c_braid, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CRC32C(native, native_crc32c, 1)
+
+#else
+
+#ifdef X86_SSE42
+TEST_CRC32C(sse42, crc32c_sse42, test_cpu_features.x86.has_sse42)
+#endif
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CRC32C(pclmulqdq, crc32c_pclmulqdq, test_cpu_features.x86.has_pclmulqdq)
+TEST_CRC32C_FOLD(pclmulqdq, crc32c_fold_pclmulqdq_reset, crc32c_fold_pclmulqdq_copy, crc32c_fold_pclmulqdq_final,
+                 test_cpu_features.x86.has_pclmulqdq)
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+TEST_CRC32C(vpclmulqdq, crc32c_vpclmulqdq, (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq))
+TEST_CRC32C_FOLD(vpclmulqdq, crc32c_fold_vpclmulqdq_reset, crc32c_fold_vpclmulqdq_copy, crc32c_fold_vpclmulqdq_final,
+                 (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq))
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+TEST_F(crc32c_random, api) {
+    uint32_t crc1, crc2, expect;
+    size_t len1 = 1000, len2 = size - len1;
+
+    EXPECT_EQ(zng_crc32c(0, NULL, 0), 0u);
+    expect = zng_crc32c(0, buf, size);
+    EXPECT_EQ(expect, crc32c_braid(0, buf, size));
+
+    crc1 = zng_crc32c(0, buf, len1);
+    crc2 = zng_crc32c(0, buf + len1, len2);
+    EXPECT_EQ(zng_crc32c_combine(crc1, crc2, (z_off64_t)len2), expect);
+    EXPECT_EQ(zng_crc32c_combine_op(crc1, crc2, zng_crc32c_combine_gen((z_off64_t)len2)), expect);
+
+    /* Copying with a running crc combines the crc of the copied data */
+    EXPECT_EQ(zng_crc32c_copy(0, dst, buf, len1), crc1);
+    EXPECT_EQ(zng_crc32c_copy(crc1, dst + len1, buf + len1, len2), expect);
+    EXPECT_EQ(memcmp(dst, buf, size), 0);
+    EXPECT_EQ(zng_crc32c_copy(crc1, dst, buf, 0), crc1);
+}
+#endif
@@ -0,0 +1,140 @@
+/* test_crc64.cc -- crc64 unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "zutil.h"
+#include "zutil_p.h"
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+}
+
+#include <gtest/gtest.h>
+
+typedef struct {
+    uint64_t crc;
+    const uint8_t *buf;
+    size_t len;
+    uint64_t expect;
+} crc64_test;
+
+static const uint8_t zeros32[32] = { 0 };
+static const uint8_t ones32[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+static const uint8_t incrementing32[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+static const uint8_t decrementing32[32] = {
+    0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10,
+    0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+
+/* Check values of CRC-64/XZ */
+static const crc64_test tests[] = {
+  {0x0, (const uint8_t *)"", 0, 0x0},
+  {0xffffffffffffffff, (const uint8_t *)"", 0, 0xffffffffffffffff},
+  {0x0, (const uint8_t *)"a", 1, 0x330284772e652b05},
+  {0x0, (const uint8_t *)"abc", 3, 0x2cd8094a1a277627},
+  {0x0, (const uint8_t *)"123456789", 9, 0x995dc9bbdf1939fa},
+  {0x0, (const uint8_t *)"The quick brown fox jumps over the lazy dog", 43, 0x5b5eb8c2e54aa1c4},
+  {0x0, zeros32, 32, 0xc95af8617cd5330c},
+  {0x0, ones32, 32, 0xe95dce9efaa09acf},
+  {0x0, incrementing32, 32, 0x7fe571a587084d10},
+  {0x0, decrementing32, 32, 0x5a4b06e9f8ea057f},
+  {0x995dc9bbdf1939fa, (const uint8_t *)"123456789", 9, 0x9b8177ba619c1d5e}
+};
+
+class crc64_variant : public ::testing::TestWithParam<crc64_test> {
+public:
+    void hash(crc64_test param, crc64_func crc64) {
+        uint64_t crc = param.len ? crc64(param.crc, param.buf, param.len) : param.crc;
+        EXPECT_EQ(crc, param.expect);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(crc64, crc64_variant, testing::ValuesIn(tests));
+
+/* Compares a variant against the braided implementation for many lengths, alignments and initial values */
+class crc64_random : public ::testing::Test {
+public:
+    uint8_t *buf;
+    size_t size;
+
+    void SetUp() override {
+        size = 4096 + 64;
+        buf = (uint8_t *)zng_alloc(size);
+        ASSERT_TRUE(buf != NULL);
+        srand(53);
+        for (size_t i = 0; i < size; i++)
+            buf[i] = (uint8_t)rand();
+    }
+
+    void TearDown() override {
+        zng_free(buf);
+    }
+
+    void hash(crc64_func crc64) {
+        static const size_t lens[] = { 1, 7, 8, 9, 15, 16, 17, 31, 32, 63, 64, 65, 127, 255, 256, 257, 1000, 4096 };
+        for (size_t offset = 0; offset < 16; offset += 3) {
+            for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                uint64_t init = (uint64_t)i * 0x9e3779b97f4a7c15;
+                EXPECT_EQ(crc64(init, buf + offset, lens[i]), crc64_braid(init, buf + offset, lens[i]))
+                    << "offset " << offset << " len " << lens[i];
+            }
+        }
+    }
+};
+
+#define TEST_CRC64(name, func, support_flag) \
+    TEST_P(crc64_variant, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(GetParam(), func); \
+    } \
+    TEST_F(crc64_random, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func); \
+    }
+
+TEST_CRC64(braid, crc64_braid, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CRC64(native, native_crc64, 1)
+
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CRC64(pclmulqdq, crc64_pclmulqdq, test_cpu_features.x86.has_pclmulqdq)
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+TEST_CRC64(vpclmulqdq, crc64_vpclmulqdq, (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq))
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+TEST_F(crc64_random, api) {
+    uint64_t crc1, crc2, expect;
+    size_t len1 = 1000, len2 = size - len1;
+
+    EXPECT_EQ(zng_crc64(0, NULL, 0), 0u);
+    expect = zng_crc64(0, buf, size);
+    EXPECT_EQ(expect, crc64_braid(0, buf, size));
+
+    crc1 = zng_crc64(0, buf, len1);
+    crc2 = zng_crc64(0, buf + len1, len2);
+    EXPECT_EQ(zng_crc64_combine(crc1, crc2, (z_off64_t)len2), expect);
+    EXPECT_EQ(zng_crc64_combine_op(crc1, crc2, zng_crc64_combine_gen((z_off64_t)len2)), expect);
+    EXPECT_EQ(zng_crc64_combine(crc1, 0, 0), crc1);
+}
+#endif
@@ -0,0 +1,159 @@
+/* test_deflate_adaptive.cc - Test deflate() with Z_DEFLATE_TARGET_MBPS */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ZLIBNG_ENABLE_TESTS
+#  include "deflate.h"
+#endif
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (4 * 1024 * 1024)
+
+#ifdef ZLIBNG_ENABLE_TESTS
+/* Replaces the clock, so that fake_strm deflates fake_mbps bytes per microsecond at every level */
+static zng_stream *fake_strm;
+static uint64_t fake_mbps;
+
+static uint64_t fake_clock(void) {
+    return fake_strm->total_in / fake_mbps;
+}
+#endif
+
+class deflate_adaptive : public ::testing::Test {
+public:
+    zng_stream strm;
+    uint8_t *data, *compr, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        uint32_t seed = 64;
+
+        compr_size = DATA_SIZE + DATA_SIZE / 8;
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+
+        fill_code_words(data, DATA_SIZE, &seed);
+
+        memset(&strm, 0, sizeof(strm));
+        ASSERT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+#ifdef ZLIBNG_ENABLE_TESTS
+        fake_strm = &strm;
+        fake_mbps = 100;
+        ((deflate_state *)strm.state)->clock = fake_clock;
+#endif
+    }
+
+    void TearDown() override {
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+
+    int get_param(zng_deflate_param param) {
+        int value = -1;
+        zng_deflate_param_value p = { param, &value, sizeof(value), Z_OK };
+        EXPECT_EQ(zng_deflateGetParams(&strm, &p, 1), Z_OK);
+        return value;
+    }
+
+    void set_target(int mbps) {
+        zng_deflate_param_value p = { Z_DEFLATE_TARGET_MBPS, &mbps, sizeof(mbps), Z_OK };
+        EXPECT_EQ(zng_deflateSetParams(&strm, &p, 1), Z_OK);
+    }
+
+    /* Compress in chunks of chunk bytes of input and out_chunk bytes of output, and return the lowest level seen
+       after a call */
+    int compress(uint32_t chunk, uint32_t out_chunk = DATA_SIZE) {
+        int min_level = get_param(Z_DEFLATE_LEVEL);
+        int32_t err;
+
+        strm.next_in = data;
+        strm.next_out = compr;
+        do {
+            strm.avail_in = (uint32_t)MIN(chunk, DATA_SIZE - strm.total_in);
+            strm.avail_out = (uint32_t)MIN(out_chunk, compr_size - strm.total_out);
+            err = zng_deflate(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END);
+            min_level = MIN(min_level, get_param(Z_DEFLATE_LEVEL));
+        } while (err == Z_OK);
+
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, strm.total_out), Z_OK);
+        return min_level;
+    }
+};
+
+TEST_F(deflate_adaptive, any_speed) {
+    /* Whatever the speed of this machine, the level stays between 1 and the one it started from */
+    set_target(100);
+    EXPECT_EQ(get_param(Z_DEFLATE_TARGET_MBPS), 100);
+    EXPECT_GE(compress(64 * 1024), 1);
+    EXPECT_GE(get_param(Z_DEFLATE_LEVEL), 1);
+    EXPECT_LE(get_param(Z_DEFLATE_LEVEL), 6);
+}
+
+#ifdef ZLIBNG_ENABLE_TESTS
+TEST_F(deflate_adaptive, unreachable_target) {
+    /* No level can keep up, so it goes down to 1 and stays there */
+    set_target(1000);
+    EXPECT_EQ(compress(DATA_SIZE), 1);
+    EXPECT_EQ(get_param(Z_DEFLATE_LEVEL), 1);
+}
+
+TEST_F(deflate_adaptive, easy_target) {
+    /* Every level keeps up, so the level never changes */
+    set_target(10);
+    EXPECT_EQ(compress(DATA_SIZE), 6);
+    EXPECT_EQ(get_param(Z_DEFLATE_LEVEL), 6);
+}
+
+TEST_F(deflate_adaptive, margin) {
+    /* Faster than the target, but not by the margin needed to go up again */
+    set_target(1000);
+    EXPECT_EQ(compress(DATA_SIZE), 1);
+    EXPECT_EQ(zng_deflateReset(&strm), Z_OK);
+    set_target(80);
+    EXPECT_EQ(compress(DATA_SIZE), 1);
+    EXPECT_EQ(get_param(Z_DEFLATE_LEVEL), 1);
+}
+
+TEST_F(deflate_adaptive, small_chunks) {
+    set_target(1000);
+    EXPECT_EQ(compress(1000), 1);
+}
+
+TEST_F(deflate_adaptive, small_output) {
+    /* deflateParams() often can not end the block when the output is full, the level then changes later */
+    set_target(1000);
+    EXPECT_EQ(compress(DATA_SIZE, 100), 1);
+    EXPECT_EQ(get_param(Z_DEFLATE_LEVEL), 1);
+}
+
+TEST_F(deflate_adaptive, recovers) {
+    set_target(1000);
+    EXPECT_EQ(compress(DATA_SIZE), 1);
+
+    /* Once the target is easy again, the level goes back up to the one it started from */
+    EXPECT_EQ(zng_deflateReset(&strm), Z_OK);
+    set_target(10);
+    compress(64 * 1024);
+    EXPECT_EQ(get_param(Z_DEFLATE_LEVEL), 6);
+}
+#endif
+
+TEST_F(deflate_adaptive, invalid) {
+    int mbps = -1;
+    zng_deflate_param_value p = { Z_DEFLATE_TARGET_MBPS, &mbps, sizeof(mbps), Z_OK };
+    EXPECT_EQ(zng_deflateSetParams(&strm, &p, 1), Z_STREAM_ERROR);
+    EXPECT_EQ(get_param(Z_DEFLATE_TARGET_MBPS), 0);
+}
@@ -0,0 +1,138 @@
+/* test_deflate_direct.cc - Test that deflate() gives the same output whether
+ * blocks are written straight to next_out or through the pending buffer */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deflate.h"
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (256 * 1024)
+
+class deflate_direct : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *compr_small, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        uint32_t seed = 70;
+
+        compr_size = DATA_SIZE + DATA_SIZE / 8 + 1024;
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        compr_small = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && compr_small != NULL && uncompr != NULL);
+
+        /* Text in the first half and random bytes, which are sent stored, in the second */
+        for (size_t i = 0; i < DATA_SIZE / 2; i++)
+            data[i] = (uint8_t)("abcdefgh ijklmnop\n"[(lcg_next(&seed) >> 16) % 18]);
+        fill_random(data + DATA_SIZE / 2, DATA_SIZE - DATA_SIZE / 2, &seed);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(compr_small);
+        free(uncompr);
+    }
+
+    /* Compress chunk bytes of input at a time with a sync flush every flush_every bytes, into
+     * avail_out bytes of output at a time, and return the compressed size */
+    size_t compress(uint8_t *out, int level, int window_bits, int strategy, uint32_t chunk, uint32_t flush_every,
+                    uint32_t avail_out) {
+        PREFIX3(stream) strm;
+        int32_t err, flush = Z_NO_FLUSH;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, window_bits, 8, strategy), Z_OK);
+        strm.next_in = data;
+        strm.next_out = out;
+        strm.avail_out = 1;
+        do {
+            /* Until deflate() leaves room in the output, it is called again with the same input and flush */
+            if (strm.avail_out != 0 && strm.avail_in == 0) {
+                strm.avail_in = (uint32_t)MIN(chunk, DATA_SIZE - strm.total_in);
+                if (strm.total_in + strm.avail_in == DATA_SIZE)
+                    flush = Z_FINISH;
+                else if (flush_every && (strm.total_in + strm.avail_in) % flush_every == 0)
+                    flush = Z_SYNC_FLUSH;
+                else
+                    flush = Z_NO_FLUSH;
+            }
+            strm.avail_out = (uint32_t)MIN(avail_out, compr_size - strm.total_out);
+            err = PREFIX(deflate)(&strm, flush);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR);
+        } while (err == Z_OK || err == Z_BUF_ERROR);
+        size_t compr_len = strm.total_out;
+        EXPECT_EQ(strm.next_out, out + compr_len);
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+        return compr_len;
+    }
+
+    /* Compress with all the output room at once, when blocks are written straight to next_out, and if compare is
+     * set, check that it gives the same output as compressing into a small output buffer */
+    void check(int level, int window_bits, int strategy, uint32_t chunk, uint32_t flush_every, bool compare) {
+        size_t len = compress(compr, level, window_bits, strategy, chunk, flush_every, (uint32_t)compr_size);
+        check_inflate(window_bits, len);
+
+        if (compare) {
+            size_t len_small = compress(compr_small, level, window_bits, strategy, chunk, flush_every, 61);
+            EXPECT_EQ(len, len_small) << "level " << level << " strategy " << strategy;
+            EXPECT_EQ(memcmp(compr, compr_small, MIN(len, len_small)), 0) << "level " << level << " strategy " << strategy;
+        }
+    }
+
+    void check_inflate(int window_bits, size_t len) {
+        PREFIX3(stream) strm;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(inflateInit2)(&strm, window_bits), Z_OK);
+        strm.next_in = compr;
+        strm.avail_in = (uint32_t)len;
+        strm.next_out = uncompr;
+        strm.avail_out = DATA_SIZE;
+        EXPECT_EQ(PREFIX(inflate)(&strm, Z_FINISH), Z_STREAM_END);
+        EXPECT_EQ(strm.total_out, (size_t)DATA_SIZE);
+        EXPECT_EQ(memcmp(uncompr, data, DATA_SIZE), 0);
+        EXPECT_EQ(PREFIX(inflateEnd)(&strm), Z_OK);
+    }
+};
+
+/* Some parsers keep part of their state in local variables, so their output also depends on where deflate() returned
+ * for lack of output room and is not compared: deflate_quick() and deflate_medium() at levels 1, 5 and 6, the greedy
+ * parse of Z_FILTERED, and with sync flushes level 9 as well. */
+
+TEST_F(deflate_direct, levels) {
+    /* Level 0 is left out, as its stored blocks are sized by the room in the output */
+    for (int level = 1; level <= 9; level++)
+        check(level, MAX_WBITS, Z_DEFAULT_STRATEGY, DATA_SIZE, 0, level > 1 && (level < 5 || level > 6));
+}
+
+TEST_F(deflate_direct, strategies) {
+    for (int strategy = Z_FILTERED; strategy <= MAX_STRATEGY; strategy++) {
+        check(2, MAX_WBITS, strategy, DATA_SIZE, 0, strategy != Z_FILTERED);
+        check(9, MAX_WBITS, strategy, DATA_SIZE, 0, true);
+    }
+}
+
+TEST_F(deflate_direct, flushes) {
+    /* Small input calls and sync flushes, with the gzip and raw wrappers */
+    for (int level = 1; level <= 9; level++) {
+        bool compare = level == 3 || level == 4 || level == 7 || level == 8;
+        check(level, MAX_WBITS + 16, Z_DEFAULT_STRATEGY, 1000, 10000, compare);
+        check(level, -MAX_WBITS, Z_DEFAULT_STRATEGY, 4096, 32768, compare);
+    }
+}
@@ -0,0 +1,112 @@
+/* test_deflate_filtered.cc - Test deflate() with the Z_FILTERED strategy */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define WIDTH  512
+#define HEIGHT 512
+#define BPP    3
+#define ROW    (1 + WIDTH * BPP)
+#define DATA_SIZE (ROW * HEIGHT)
+
+class deflate_filtered : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        compr_size = DATA_SIZE + DATA_SIZE / 8;
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* PNG scanlines of an RGB image with the Sub filter: noisy gradients in
+     * the top half, and flat areas with the same rows in the bottom half */
+    void init_scanlines() {
+        uint8_t row[WIDTH * BPP];
+        uint32_t seed = 67;
+
+        for (int y = 0; y < HEIGHT; y++) {
+            uint8_t *line = data + y * ROW;
+            for (int i = 0; i < WIDTH * BPP; i++) {
+                uint32_t rnd = lcg_next(&seed);
+                if (y < HEIGHT / 2)
+                    row[i] = (uint8_t)(i / BPP * (i % BPP + 1) / 5 + y / 3 + (rnd >> 16) % 5);
+                else
+                    row[i] = (uint8_t)((i / BPP / 32 + y / 32) % 2 ? 200 + i % BPP * 10 : i % BPP * 30);
+            }
+            line[0] = 1;
+            for (int i = 0; i < WIDTH * BPP; i++)
+                line[1 + i] = (uint8_t)(row[i] - (i >= BPP ? row[i - BPP] : 0));
+        }
+    }
+
+    /* Compress feeding chunk bytes of input at a time and return the compressed size */
+    size_t compress(int level, int strategy, int mem_level, uint32_t chunk) {
+        PREFIX3(stream) strm;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, MAX_WBITS, mem_level, strategy), Z_OK);
+        strm.next_in = data;
+        strm.next_out = compr;
+        strm.avail_out = (uint32_t)compr_size;
+        do {
+            strm.avail_in = (uint32_t)MIN(chunk, DATA_SIZE - strm.total_in);
+            err = PREFIX(deflate)(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END);
+        } while (err == Z_OK);
+        EXPECT_EQ(err, Z_STREAM_END);
+        size_t compr_len = strm.total_out;
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, compr_len), Z_OK);
+        return compr_len;
+    }
+};
+
+TEST_F(deflate_filtered, smaller) {
+    init_scanlines();
+    EXPECT_LT(compress(2, Z_FILTERED, 8, DATA_SIZE), compress(2, Z_DEFAULT_STRATEGY, 8, DATA_SIZE));
+    EXPECT_LT(compress(6, Z_FILTERED, 8, DATA_SIZE), compress(6, Z_DEFAULT_STRATEGY, 8, DATA_SIZE));
+}
+
+TEST_F(deflate_filtered, round_trip) {
+    init_scanlines();
+    for (int level = 1; level <= 9; level++) {
+        compress(level, Z_FILTERED, 8, 1000);
+        compress(level, Z_FILTERED, 1, 64 * 1024);
+    }
+}
+
+TEST_F(deflate_filtered, runs) {
+    /* Long runs of a few values, where most matches are at the near distances */
+    uint32_t seed = 1;
+    for (size_t i = 0; i < DATA_SIZE; i++) {
+        uint32_t rnd = lcg_next(&seed);
+        data[i] = (rnd >> 16) % 64 ? (i > 0 ? data[i - 1] : 0) : (uint8_t)(rnd >> 24);
+    }
+    for (int level = 2; level <= 9; level++)
+        compress(level, Z_FILTERED, 8, DATA_SIZE);
+}
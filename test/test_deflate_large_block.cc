@@ -0,0 +1,145 @@
+/* test_deflate_large_block.cc - Test deflate() with the memLevel of the large-block mode */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deflate.h"
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (4 * 1024 * 1024)
+
+class deflate_large_block : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *compr_copy, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        compr_size = DATA_SIZE + DATA_SIZE / 8;
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        compr_copy = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && compr_copy != NULL && uncompr != NULL);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(compr_copy);
+        free(uncompr);
+    }
+
+    /* Words picked at random, which have the same statistics all along */
+    void init_words() {
+        static const char *const words[] = { "the ", "quick ", "brown ", "fox ", "jumps ", "over ", "lazy ", "dog ",
+            "pack ", "my ", "box ", "with ", "five ", "dozen ", "liquor ", "jugs, ", "sphinx ", "of ", "black ",
+            "quartz, ", "judge ", "vow. ", "how ", "vexingly ", "daft ", "zebras ", "jump!\n" };
+        uint32_t seed = 68;
+
+        fill_words(data, DATA_SIZE, words, sizeof(words) / sizeof(words[0]), &seed);
+    }
+
+    /* Compress feeding chunk bytes of input at a time and return the compressed size */
+    size_t compress(int level, int strategy, int mem_level, uint32_t chunk) {
+        PREFIX3(stream) strm;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, MAX_WBITS, mem_level, strategy), Z_OK);
+        size_t bound = PREFIX(deflateBound)(&strm, DATA_SIZE);
+        strm.next_in = data;
+        strm.next_out = compr;
+        strm.avail_out = (uint32_t)compr_size;
+        do {
+            strm.avail_in = (uint32_t)MIN(chunk, DATA_SIZE - strm.total_in);
+            err = PREFIX(deflate)(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END);
+        } while (err == Z_OK);
+        EXPECT_EQ(err, Z_STREAM_END);
+        EXPECT_LE(strm.total_out, bound);
+        size_t compr_len = strm.total_out;
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, compr_len), Z_OK);
+        return compr_len;
+    }
+};
+
+TEST_F(deflate_large_block, smaller) {
+    init_words();
+    EXPECT_LT(compress(9, Z_DEFAULT_STRATEGY, MAX_LARGE_MEM_LEVEL, DATA_SIZE),
+              compress(9, Z_DEFAULT_STRATEGY, MAX_MEM_LEVEL, DATA_SIZE));
+}
+
+TEST_F(deflate_large_block, round_trip) {
+    init_words();
+    for (int level = 0; level <= 9; level++) {
+        for (int mem_level = MAX_MEM_LEVEL + 1; mem_level <= MAX_LARGE_MEM_LEVEL; mem_level++)
+            compress(level, Z_DEFAULT_STRATEGY, mem_level, 100 * 1000);
+    }
+}
+
+TEST_F(deflate_large_block, frequencies) {
+    /* Exactly 64K of one literal in the first block, which a 16-bit frequency would count as none */
+    memset(data, 'a', 65536);
+    for (size_t i = 65536; i < DATA_SIZE; i++)
+        data[i] = (uint8_t)('b' + i % 25);
+    compress(6, Z_HUFFMAN_ONLY, MAX_LARGE_MEM_LEVEL, DATA_SIZE);
+
+    /* Blocks of more than 64K symbols where one literal and one match length are most of them */
+    uint32_t seed = 1;
+    for (size_t i = 0; i < DATA_SIZE; i++) {
+        uint32_t rnd = lcg_next(&seed);
+        data[i] = (rnd >> 16) % 8 ? 'a' : (uint8_t)(rnd >> 24);
+    }
+    for (int strategy = Z_DEFAULT_STRATEGY; strategy <= MAX_STRATEGY; strategy++)
+        compress(6, strategy, MAX_LARGE_MEM_LEVEL, DATA_SIZE);
+}
+
+TEST_F(deflate_large_block, random) {
+    /* Blocks that are longer than the window cannot be stored, but stay within deflateBound() */
+    uint32_t seed = 2;
+    fill_random(data, DATA_SIZE, &seed);
+    compress(1, Z_DEFAULT_STRATEGY, MAX_LARGE_MEM_LEVEL, DATA_SIZE);
+    compress(9, Z_DEFAULT_STRATEGY, MAX_LARGE_MEM_LEVEL, DATA_SIZE);
+    compress(9, Z_FIXED, MAX_LARGE_MEM_LEVEL, DATA_SIZE);
+}
+
+TEST_F(deflate_large_block, copy) {
+    PREFIX3(stream) strm, strm_copy;
+
+    init_words();
+    memset(&strm, 0, sizeof(strm));
+    memset(&strm_copy, 0, sizeof(strm_copy));
+    EXPECT_EQ(PREFIX(deflateInit2)(&strm, 9, Z_DEFLATED, MAX_WBITS, MAX_LARGE_MEM_LEVEL, Z_DEFAULT_STRATEGY), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = DATA_SIZE / 2;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(PREFIX(deflate)(&strm, Z_NO_FLUSH), Z_OK);
+
+    /* The copy has the symbols of the open block and finishes the stream the same way */
+    EXPECT_EQ(PREFIX(deflateCopy)(&strm_copy, &strm), Z_OK);
+    size_t done = strm.total_out;
+    memcpy(compr_copy, compr, done);
+    strm_copy.next_out = compr_copy + done;
+    strm.avail_in = strm_copy.avail_in = DATA_SIZE - DATA_SIZE / 2;
+    EXPECT_EQ(PREFIX(deflate)(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(PREFIX(deflate)(&strm_copy, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(strm.total_out, strm_copy.total_out);
+    EXPECT_EQ(memcmp(compr, compr_copy, strm.total_out), 0);
+    EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, strm.total_out), Z_OK);
+    EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+    EXPECT_EQ(PREFIX(deflateEnd)(&strm_copy), Z_OK);
+
+    EXPECT_EQ(PREFIX(deflateInit2)(&strm, 9, Z_DEFLATED, MAX_WBITS, MAX_LARGE_MEM_LEVEL + 1, Z_DEFAULT_STRATEGY),
+              Z_STREAM_ERROR);
+}
@@ -0,0 +1,167 @@
+/* test_deflate_latency.cc - Test deflate() with Z_DEFLATE_LATENCY_BYTES and Z_DEFLATE_LATENCY_USEC */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define NUM_MESSAGES 500
+#define MAX_MESSAGE 200
+#define BUF_SIZE (NUM_MESSAGES * MAX_MESSAGE * 2)
+
+class deflate_latency : public ::testing::Test {
+public:
+    zng_stream c_stream, d_stream;
+    uint8_t *sent, *compr, *uncompr;
+    size_t sent_len;
+
+    void SetUp() override {
+        sent = (uint8_t *)malloc(BUF_SIZE);
+        compr = (uint8_t *)malloc(BUF_SIZE);
+        uncompr = (uint8_t *)malloc(BUF_SIZE);
+        ASSERT_TRUE(sent != NULL && compr != NULL && uncompr != NULL);
+        sent_len = 0;
+
+        memset(&c_stream, 0, sizeof(c_stream));
+        ASSERT_EQ(zng_deflateInit2(&c_stream, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        c_stream.next_out = compr;
+        c_stream.avail_out = BUF_SIZE;
+
+        memset(&d_stream, 0, sizeof(d_stream));
+        ASSERT_EQ(zng_inflateInit2(&d_stream, -15), Z_OK);
+        d_stream.next_in = compr;
+        d_stream.next_out = uncompr;
+        d_stream.avail_out = BUF_SIZE;
+    }
+
+    void TearDown() override {
+        EXPECT_EQ(zng_deflateEnd(&c_stream), Z_OK);
+        zng_inflateEnd(&d_stream);
+        free(sent);
+        free(compr);
+        free(uncompr);
+    }
+
+    void set_param(zng_deflate_param param, int value) {
+        zng_deflate_param_value p;
+        p.param = param;
+        p.buf = &value;
+        p.size = sizeof(value);
+        EXPECT_EQ(zng_deflateSetParams(&c_stream, &p, 1), Z_OK);
+    }
+
+    /* Deflate one JSON-like message and return the deflate() result */
+    int32_t send(int i, int32_t flush) {
+        int len = snprintf((char *)sent + sent_len, MAX_MESSAGE,
+            "{\"seq\":%d,\"method\":\"update\",\"params\":{\"key\":\"item%d\",\"value\":%d}}\n", i, i % 37, i * 7);
+        c_stream.next_in = sent + sent_len;
+        c_stream.avail_in = (uint32_t)len;
+        sent_len += len;
+        int32_t err = zng_deflate(&c_stream, flush);
+        EXPECT_EQ(c_stream.avail_in, 0u);
+        return err;
+    }
+
+    /* Inflate what deflate() has written so far and return the number of bytes that could be decoded */
+    size_t receive() {
+        d_stream.avail_in = (uint32_t)(c_stream.next_out - d_stream.next_in);
+        int err = zng_inflate(&d_stream, Z_SYNC_FLUSH);
+        EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR) << "inflate " << err;
+        EXPECT_EQ(memcmp(uncompr, sent, d_stream.total_out), 0);
+        return d_stream.total_out;
+    }
+};
+
+TEST_F(deflate_latency, bytes) {
+    size_t max_held = 0, flushed_len;
+
+    set_param(Z_DEFLATE_LATENCY_BYTES, 1000);
+    for (int i = 0; i < NUM_MESSAGES; i++) {
+        EXPECT_EQ(send(i, Z_NO_FLUSH), Z_OK);
+        max_held = MAX(max_held, sent_len - receive());
+    }
+    /* At most one message over the budget is held back */
+    EXPECT_LT(max_held, 1000u + MAX_MESSAGE);
+    EXPECT_GE(max_held, 1000u - MAX_MESSAGE);
+
+    EXPECT_EQ(zng_deflate(&c_stream, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(receive(), sent_len);
+    flushed_len = c_stream.total_out;
+
+    /* A sync flush per message costs more */
+    zng_deflateReset(&c_stream);
+    zng_inflateReset(&d_stream);
+    c_stream.next_out = compr;
+    c_stream.avail_out = BUF_SIZE;
+    d_stream.next_in = compr;
+    d_stream.next_out = uncompr;
+    d_stream.avail_out = BUF_SIZE;
+    set_param(Z_DEFLATE_LATENCY_BYTES, 0);
+    sent_len = 0;
+    for (int i = 0; i < NUM_MESSAGES; i++) {
+        EXPECT_EQ(send(i, Z_SYNC_FLUSH), Z_OK);
+        EXPECT_EQ(receive(), sent_len);
+    }
+    EXPECT_EQ(zng_deflate(&c_stream, Z_FINISH), Z_STREAM_END);
+    EXPECT_LT(flushed_len * 3 / 2, c_stream.total_out);
+}
+
+TEST_F(deflate_latency, small_output) {
+    uint8_t *out = compr;
+    int32_t err;
+
+    set_param(Z_DEFLATE_LATENCY_BYTES, 300);
+    for (int i = 0; i < NUM_MESSAGES; i++) {
+        int len = snprintf((char *)sent + sent_len, MAX_MESSAGE, "message %d of %d\n", i, NUM_MESSAGES);
+        c_stream.next_in = sent + sent_len;
+        c_stream.avail_in = (uint32_t)len;
+        sent_len += len;
+        do {
+            c_stream.next_out = out;
+            c_stream.avail_out = 3;
+            err = zng_deflate(&c_stream, Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_BUF_ERROR);
+            out = c_stream.next_out;
+        } while (c_stream.avail_out == 0);
+        EXPECT_LT(sent_len - receive(), 300u + 64);
+    }
+    do {
+        c_stream.next_out = out;
+        c_stream.avail_out = 3;
+        err = zng_deflate(&c_stream, Z_FINISH);
+        out = c_stream.next_out;
+    } while (err == Z_OK);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(receive(), sent_len);
+}
+
+TEST_F(deflate_latency, usec) {
+    int value = -1;
+    zng_deflate_param_value p;
+    int32_t err;
+
+    set_param(Z_DEFLATE_LATENCY_USEC, 1000);
+    p.param = Z_DEFLATE_LATENCY_USEC;
+    p.buf = &value;
+    p.size = sizeof(value);
+    EXPECT_EQ(zng_deflateGetParams(&c_stream, &p, 1), Z_OK);
+    EXPECT_EQ(value, 1000);
+
+    EXPECT_EQ(send(0, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(receive(), 0u);
+
+    /* Polling with no input flushes once the time is up */
+    do {
+        err = zng_deflate(&c_stream, Z_NO_FLUSH);
+        EXPECT_TRUE(err == Z_OK || err == Z_BUF_ERROR);
+    } while (err == Z_BUF_ERROR);
+    EXPECT_EQ(receive(), sent_len);
+
+    /* Nothing left to flush */
+    EXPECT_EQ(zng_deflate(&c_stream, Z_NO_FLUSH), Z_BUF_ERROR);
+    EXPECT_EQ(zng_deflate(&c_stream, Z_FINISH), Z_STREAM_END);
+}
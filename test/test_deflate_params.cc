@@ -141,3 +141,19 @@ TEST(deflate, params) {
     free(compr);
     free(uncompr);
 }
+
+TEST(deflate, init_limits) {
+    PREFIX3(stream) c_stream;
+
+    /* The zlib API keeps the limits of zlib, without the large-block mode and Z_STRIDED */
+#ifdef ZLIB_COMPAT
+    EXPECT_EQ(MAX_LARGE_MEM_LEVEL, MAX_MEM_LEVEL);
+    EXPECT_EQ(MAX_STRATEGY, Z_FIXED);
+#endif
+    memset(&c_stream, 0, sizeof(c_stream));
+    EXPECT_EQ(PREFIX(deflateInit2)(&c_stream, 6, Z_DEFLATED, MAX_WBITS, MAX_LARGE_MEM_LEVEL, MAX_STRATEGY), Z_OK);
+    EXPECT_EQ(PREFIX(deflateEnd)(&c_stream), Z_OK);
+    EXPECT_EQ(PREFIX(deflateInit2)(&c_stream, 6, Z_DEFLATED, MAX_WBITS, MAX_LARGE_MEM_LEVEL + 1, Z_DEFAULT_STRATEGY),
+              Z_STREAM_ERROR);
+    EXPECT_EQ(PREFIX(deflateInit2)(&c_stream, 6, Z_DEFLATED, MAX_WBITS, 8, MAX_STRATEGY + 1), Z_STREAM_ERROR);
+}
@@ -0,0 +1,67 @@
+/* test_deflate_reset_lazy.cc - Test that deflateResetLazy() gives the same output as deflateReset() */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "deflate.h"
+}
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE  4000
+#define COMPR_SIZE (DATA_SIZE * 2)
+
+class deflate_reset_lazy : public ::testing::Test {
+public:
+    uint8_t data[DATA_SIZE], compr[COMPR_SIZE], expect[COMPR_SIZE];
+
+    void SetUp() override {
+        uint32_t seed = 72;
+
+        /* Short words from a small alphabet, so that most strings have matches */
+        for (size_t i = 0; i < DATA_SIZE; i++)
+            data[i] = (uint8_t)((lcg_next(&seed) >> 16) % 5 ? 'a' + (lcg_next(&seed) >> 16) % 4 : ' ');
+    }
+
+    /* Compress len bytes at data + offset and return the compressed size */
+    size_t compress(PREFIX3(stream) *strm, size_t offset, size_t len, uint8_t *out) {
+        strm->next_in = data + offset;
+        strm->avail_in = (uint32_t)len;
+        strm->next_out = out;
+        strm->avail_out = COMPR_SIZE;
+        EXPECT_EQ(PREFIX(deflate)(strm, Z_FINISH), Z_STREAM_END);
+        return strm->total_out;
+    }
+
+    /* Compress the first input, reset the stream and compress the second input, and return its compressed size */
+    size_t compress_after(int level, int lazy, size_t first_len, size_t offset, size_t len, uint8_t *out) {
+        PREFIX3(stream) strm;
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit)(&strm, level), Z_OK);
+        compress(&strm, 0, first_len, compr);
+        EXPECT_EQ(lazy ? PREFIX(deflateResetLazy)(&strm) : PREFIX(deflateReset)(&strm), Z_OK);
+        size_t out_len = compress(&strm, offset, len, out);
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+        return out_len;
+    }
+};
+
+TEST_F(deflate_reset_lazy, same_output) {
+    /* A shorter second input leaves bytes of the first one past its end in the window */
+    static const size_t inputs[][3] = { { 100, 1000, 100 }, { 3000, 0, 1000 }, { 3000, 3000, 1000 }, { 0, 0, 500 }, { 3000, 1, 2999 }, { 3000, 7, 1500 }, { 2000, 2000, 2000 } };
+
+    for (int level = 1; level <= 9; level++) {
+        for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+            size_t full = compress_after(level, 0, inputs[i][0], inputs[i][1], inputs[i][2], expect);
+            size_t lazy = compress_after(level, 1, inputs[i][0], inputs[i][1], inputs[i][2], compr);
+            EXPECT_EQ(lazy, full) << "level " << level << " input " << i;
+            EXPECT_EQ(memcmp(compr, expect, full), 0) << "level " << level << " input " << i;
+        }
+    }
+}
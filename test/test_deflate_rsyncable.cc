@@ -0,0 +1,190 @@
+/* test_deflate_rsyncable.cc - Test deflate() with Z_DEFLATE_RSYNCABLE */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared_ng.h"
+
+#define DATA_SIZE (256 * 1024)
+#define TESTFILE "test_rsyncable.gz"
+
+class deflate_rsyncable : public ::testing::Test {
+public:
+    uint8_t *data;
+    uint8_t *compr;
+    uint8_t *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        static const char *const words[] = { "lorem ", "ipsum ", "dolor ", "sit ", "amet, ", "consectetur ",
+            "adipiscing ", "elit. ", "sed ", "do ", "eiusmod ", "tempor\n" };
+        uint32_t seed = 62;
+
+        data = (uint8_t *)malloc(DATA_SIZE);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        compr_size = DATA_SIZE * 2;
+        compr = (uint8_t *)malloc(compr_size);
+        ASSERT_TRUE(data != NULL && uncompr != NULL && compr != NULL);
+
+        fill_words(data, DATA_SIZE, words, sizeof(words) / sizeof(words[0]), &seed);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(uncompr);
+        free(compr);
+    }
+
+    /* Compress data with the given chunk sizes, return the compressed size */
+    size_t compress(const uint8_t *in, int rsyncable, uint32_t in_chunk, uint32_t out_chunk, int32_t flush) {
+        zng_stream strm;
+        zng_deflate_param_value param;
+        int err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+        param.param = Z_DEFLATE_RSYNCABLE;
+        param.buf = &rsyncable;
+        param.size = sizeof(rsyncable);
+        EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_OK);
+
+        strm.next_in = in;
+        strm.next_out = compr;
+        do {
+            if (strm.avail_in == 0)
+                strm.avail_in = (uint32_t)MIN(in_chunk, DATA_SIZE - strm.total_in);
+            strm.avail_out = (uint32_t)MIN(out_chunk, compr_size - strm.total_out);
+            err = zng_deflate(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : flush);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR) << "deflate " << err;
+        } while (err != Z_STREAM_END && !::testing::Test::HasFailure());
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+        return strm.total_out;
+    }
+
+    void verify(size_t len) {
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, len), Z_OK);
+    }
+
+    /* Number of full flush markers in the compressed data */
+    size_t count_flushes(size_t len) {
+        static const uint8_t marker[4] = { 0x00, 0x00, 0xff, 0xff };
+        size_t count = 0;
+        for (size_t i = 0; i + 4 <= len; i++)
+            count += memcmp(compr + i, marker, 4) == 0;
+        return count;
+    }
+};
+
+TEST_F(deflate_rsyncable, round_trip) {
+    static const uint32_t chunks[][2] = { { DATA_SIZE, DATA_SIZE * 2 }, { 1000, 1 }, { 1, 300 }, { 4096, 64 },
+                                          { 65536, 7 } };
+
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        size_t len = compress(data, 4096, chunks[i][0], chunks[i][1], Z_NO_FLUSH);
+        verify(len);
+        EXPECT_GT(count_flushes(len), 10u) << "chunks " << chunks[i][0] << " " << chunks[i][1];
+    }
+    for (int32_t flush = Z_PARTIAL_FLUSH; flush <= Z_FULL_FLUSH; flush++)
+        verify(compress(data, 4096, 3000, 500, flush));
+    verify(compress(data, 4096, 3000, 500, Z_BLOCK));
+}
+
+TEST_F(deflate_rsyncable, flush_points) {
+    /* The flush points depend only on the data, not on how it is passed in */
+    size_t whole = count_flushes(compress(data, 4096, DATA_SIZE, DATA_SIZE * 2, Z_NO_FLUSH));
+    size_t split = count_flushes(compress(data, 4096, 777, 33, Z_NO_FLUSH));
+    EXPECT_GT(whole, 10u);
+    EXPECT_EQ(split, whole);
+}
+
+TEST_F(deflate_rsyncable, resync) {
+    size_t plain_len, edited_len, common;
+    uint8_t *plain;
+
+    for (int rsyncable = 0; rsyncable <= 4096; rsyncable += 4096) {
+        plain_len = compress(data, rsyncable, DATA_SIZE, DATA_SIZE * 2, Z_NO_FLUSH);
+        plain = (uint8_t *)malloc(plain_len);
+        ASSERT_TRUE(plain != NULL);
+        memcpy(plain, compr, plain_len);
+
+        /* Change one byte early in the data */
+        data[1000] ^= 0x20;
+        edited_len = compress(data, rsyncable, DATA_SIZE, DATA_SIZE * 2, Z_NO_FLUSH);
+        data[1000] ^= 0x20;
+
+        /* Length of the common tail, without the trailing Adler-32 */
+        for (common = 4; common < MIN(plain_len, edited_len); common++) {
+            if (plain[plain_len - 1 - common] != compr[edited_len - 1 - common])
+                break;
+        }
+        if (rsyncable)
+            EXPECT_GT(common, plain_len * 9 / 10);
+        else
+            EXPECT_LT(common, plain_len / 10);
+        free(plain);
+    }
+}
+
+TEST_F(deflate_rsyncable, bound) {
+    zng_stream strm;
+    zng_deflate_param_value param;
+    int rsyncable = 4096, value = 0, invalid = 4095;
+    size_t bound, len;
+
+    /* Incompressible data, which gets the most out of the bound */
+    uint32_t seed = 62;
+    fill_random(data, DATA_SIZE, &seed);
+
+    memset(&strm, 0, sizeof(strm));
+    ASSERT_EQ(zng_deflateInit(&strm, 1), Z_OK);
+    param.param = Z_DEFLATE_RSYNCABLE;
+    param.buf = &rsyncable;
+    param.size = sizeof(rsyncable);
+    EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_OK);
+    param.buf = &value;
+    EXPECT_EQ(zng_deflateGetParams(&strm, &param, 1), Z_OK);
+    EXPECT_EQ(value, 4096);
+    param.buf = &invalid;
+    EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_STREAM_ERROR);
+
+    bound = zng_deflateBound(&strm, DATA_SIZE);
+    strm.next_in = data;
+    strm.avail_in = DATA_SIZE;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)bound;
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    len = strm.total_out;
+    EXPECT_LE(len, bound);
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+    verify(len);
+}
+
+TEST_F(deflate_rsyncable, gzopen) {
+    gzFile file;
+    size_t len;
+    FILE *fin;
+
+    file = zng_gzopen(TESTFILE, "wb6y");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzwrite(file, data, DATA_SIZE), DATA_SIZE);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+
+    fin = fopen(TESTFILE, "rb");
+    ASSERT_TRUE(fin != NULL);
+    len = fread(compr, 1, compr_size, fin);
+    fclose(fin);
+    EXPECT_GT(count_flushes(len), 2u);
+
+    file = zng_gzopen(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzread(file, uncompr, DATA_SIZE), DATA_SIZE);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    EXPECT_EQ(memcmp(uncompr, data, DATA_SIZE), 0);
+    remove(TESTFILE);
+}
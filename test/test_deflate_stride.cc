@@ -0,0 +1,140 @@
+/* test_deflate_stride.cc - Test deflate() with the Z_STRIDED strategy */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (1024 * 1024)
+
+class deflate_stride : public ::testing::Test {
+public:
+    uint8_t *data, *compr, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        static const char *names[] = { "temperature", "humidity", "pressure", "wind_speed",
+            "rain_gauge", "solar_flux", "co2_ppm", "battery" };
+        int16_t values[8] = { 500, 500, 500, 500, 500, 500, 500, 500 };
+        uint64_t timestamp = 1700000000000;
+        uint32_t seed = 66;
+
+        compr_size = DATA_SIZE + DATA_SIZE / 8;
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+
+        /* Sensor readings of 32 bytes each: id, timestamp, value, sensor and its name */
+        memset(data, 0, DATA_SIZE);
+        for (uint32_t id = 0, pos = 0; pos + 32 <= DATA_SIZE; id++, pos += 32) {
+            uint32_t rnd = lcg_next(&seed);
+            uint8_t sensor = (rnd >> 16) & 7;
+            values[sensor] += (int16_t)((rnd >> 20) % 7) - 3;
+            timestamp += 900 + (rnd >> 8) % 200;
+            memcpy(data + pos, &id, 4);
+            memcpy(data + pos + 4, &timestamp, 8);
+            memcpy(data + pos + 12, &values[sensor], 2);
+            data[pos + 14] = sensor;
+            memcpy(data + pos + 15, names[sensor], strlen(names[sensor]));
+        }
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* Compress feeding chunk bytes of input at a time and return the compressed size */
+    size_t compress(PREFIX3(stream) *strm, uint32_t chunk) {
+        int32_t err;
+
+        strm->next_in = data;
+        strm->next_out = compr;
+        strm->avail_out = (uint32_t)compr_size;
+        do {
+            strm->avail_in = (uint32_t)MIN(chunk, DATA_SIZE - strm->total_in);
+            err = PREFIX(deflate)(strm, strm->total_in + strm->avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END);
+        } while (err == Z_OK);
+        EXPECT_EQ(err, Z_STREAM_END);
+
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, strm->total_out), Z_OK);
+        return strm->total_out;
+    }
+
+    size_t compress_level(int level, int strategy, int mem_level, uint32_t chunk) {
+        PREFIX3(stream) strm;
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, MAX_WBITS, mem_level, strategy), Z_OK);
+        size_t len = compress(&strm, chunk);
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+        return len;
+    }
+};
+
+TEST_F(deflate_stride, smaller) {
+    EXPECT_LT(compress_level(2, Z_STRIDED, 8, DATA_SIZE), compress_level(2, Z_DEFAULT_STRATEGY, 8, DATA_SIZE));
+    EXPECT_LT(compress_level(9, Z_STRIDED, 8, DATA_SIZE), compress_level(9, Z_DEFAULT_STRATEGY, 8, DATA_SIZE));
+}
+
+TEST_F(deflate_stride, round_trip) {
+    for (int level = 1; level <= 9; level++) {
+        compress_level(level, Z_STRIDED, 8, 1000);
+        compress_level(level, Z_STRIDED, 1, 64 * 1024);
+    }
+}
+
+TEST_F(deflate_stride, no_stride) {
+    /* Random data has no stride and is still compressed correctly */
+    uint32_t seed = 1;
+    fill_random(data, DATA_SIZE, &seed);
+    compress_level(6, Z_STRIDED, 8, DATA_SIZE);
+}
+
+TEST_F(deflate_stride, params) {
+    PREFIX3(stream) strm;
+    int32_t err;
+
+    /* Switch between the strategies every 64K of input */
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(PREFIX(deflateInit)(&strm, 6), Z_OK);
+    strm.next_in = data;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    do {
+        int strategy = (strm.total_in / (64 * 1024)) & 1 ? Z_STRIDED : Z_DEFAULT_STRATEGY;
+        EXPECT_EQ(PREFIX(deflateParams)(&strm, 6, strategy), Z_OK);
+        strm.avail_in = (uint32_t)MIN(64 * 1024, DATA_SIZE - strm.total_in);
+        err = PREFIX(deflate)(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+        EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END);
+    } while (err == Z_OK);
+    EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, strm.total_out), Z_OK);
+    EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(PREFIX(deflateInit2)(&strm, 6, Z_DEFLATED, MAX_WBITS, 8, Z_STRIDED + 1), Z_STREAM_ERROR);
+}
+
+TEST_F(deflate_stride, set_params) {
+    zng_stream strm;
+    int strategy = Z_STRIDED;
+    zng_deflate_param_value p = { Z_DEFLATE_STRATEGY, &strategy, sizeof(strategy), Z_OK };
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 2), Z_OK);
+    EXPECT_EQ(zng_deflateSetParams(&strm, &p, 1), Z_OK);
+    strategy = -1;
+    EXPECT_EQ(zng_deflateGetParams(&strm, &p, 1), Z_OK);
+    EXPECT_EQ(strategy, Z_STRIDED);
+    EXPECT_EQ(compress(&strm, DATA_SIZE), compress_level(2, Z_STRIDED, 8, DATA_SIZE));
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+}
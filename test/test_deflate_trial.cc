@@ -0,0 +1,156 @@
+/* test_deflate_trial.cc - Test deflate() with Z_DEFLATE_TRIAL_PARSES */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared_ng.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (1024 * 1024)
+
+class deflate_trial : public ::testing::Test {
+public:
+    uint8_t *text, *samples, *compr, *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        uint32_t seed = 65;
+
+        compr_size = DATA_SIZE * 2;
+        text = (uint8_t *)malloc(DATA_SIZE);
+        samples = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(text != NULL && samples != NULL && compr != NULL && uncompr != NULL);
+
+        fill_code_words(text, DATA_SIZE, &seed);
+        /* Small differences between neighbouring samples, as in filtered image rows, interrupted by flat runs */
+        for (size_t pos = 0; pos < DATA_SIZE; pos++)
+            samples[pos] = (pos / 4096) % 4 == 3 ? 0 : (uint8_t)((lcg_next(&seed) >> 16) % 7 - 3);
+    }
+
+    void TearDown() override {
+        free(text);
+        free(samples);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* Compress with the given settings and chunk sizes, check the round trip and return the compressed size */
+    size_t compress(const uint8_t *data, int level, int mem_level, int strategy, int trial, uint32_t in_chunk,
+                    uint32_t out_chunk) {
+        zng_stream strm;
+        zng_deflate_param_value param = { Z_DEFLATE_TRIAL_PARSES, &trial, sizeof(trial), Z_OK };
+        int value = -1;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_deflateInit2(&strm, level, Z_DEFLATED, MAX_WBITS, mem_level, strategy), Z_OK);
+        EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_OK);
+        param.buf = &value;
+        EXPECT_EQ(zng_deflateGetParams(&strm, &param, 1), Z_OK);
+        EXPECT_EQ(value, trial);
+
+        strm.next_in = data;
+        strm.next_out = compr;
+        do {
+            if (strm.avail_in == 0)
+                strm.avail_in = (uint32_t)MIN(in_chunk, DATA_SIZE - strm.total_in);
+            strm.avail_out = (uint32_t)MIN(out_chunk, compr_size - strm.total_out);
+            err = zng_deflate(&strm, strm.total_in + strm.avail_in == DATA_SIZE ? Z_FINISH : Z_NO_FLUSH);
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR) << "deflate " << err;
+        } while (err != Z_STREAM_END && !::testing::Test::HasFailure());
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+
+        EXPECT_EQ(check_uncompress(uncompr, data, DATA_SIZE, compr, strm.total_out), Z_OK);
+        return strm.total_out;
+    }
+};
+
+TEST_F(deflate_trial, samples) {
+    /* The match finder spends bits on short matches that the literal and run parses do without */
+    for (int level = 2; level <= 9; level += 7) {
+        size_t plain = compress(samples, level, 8, Z_DEFAULT_STRATEGY, 0, DATA_SIZE, DATA_SIZE * 2);
+        size_t trial = compress(samples, level, 8, Z_DEFAULT_STRATEGY, 1, DATA_SIZE, DATA_SIZE * 2);
+        EXPECT_LT(trial, plain - plain / 20) << "level " << level;
+    }
+}
+
+TEST_F(deflate_trial, text) {
+    /* The match finder wins, so the trials rest and hardly cost anything */
+    size_t plain = compress(text, 6, 8, Z_DEFAULT_STRATEGY, 0, DATA_SIZE, DATA_SIZE * 2);
+    size_t trial = compress(text, 6, 8, Z_DEFAULT_STRATEGY, 1, DATA_SIZE, DATA_SIZE * 2);
+    EXPECT_LE(trial, plain + plain / 500);
+}
+
+TEST_F(deflate_trial, round_trip) {
+    static const uint32_t chunks[][2] = { { 1000, 1 }, { 1, 300 }, { 4096, 64 }, { 65536, 7 } };
+
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        compress(samples, 6, 8, Z_DEFAULT_STRATEGY, 1, chunks[i][0], chunks[i][1]);
+        compress(text, 6, 8, Z_DEFAULT_STRATEGY, 1, chunks[i][0], chunks[i][1]);
+    }
+    /* Small symbol buffers also hold the pending output */
+    for (int mem_level = 1; mem_level <= MAX_MEM_LEVEL; mem_level += 4)
+        compress(samples, 9, mem_level, Z_DEFAULT_STRATEGY, 1, 3000, 500);
+    compress(samples, 6, 8, Z_FILTERED, 1, DATA_SIZE, DATA_SIZE * 2);
+    compress(samples, 6, 8, Z_FIXED, 1, DATA_SIZE, DATA_SIZE * 2);
+}
+
+TEST_F(deflate_trial, own_parses) {
+    /* Trying a parse against itself changes nothing */
+    for (int strategy = Z_HUFFMAN_ONLY; strategy <= Z_RLE; strategy++) {
+        size_t plain = compress(samples, 6, 8, strategy, 0, DATA_SIZE, DATA_SIZE * 2);
+        uint8_t *plain_data = (uint8_t *)malloc(plain);
+        ASSERT_TRUE(plain_data != NULL);
+        memcpy(plain_data, compr, plain);
+        size_t trial = compress(samples, 6, 8, strategy, 1, DATA_SIZE, DATA_SIZE * 2);
+        EXPECT_EQ(trial, plain);
+        EXPECT_EQ(memcmp(compr, plain_data, plain), 0);
+        free(plain_data);
+    }
+}
+
+TEST_F(deflate_trial, full_flush) {
+    /* The data after every full flush decodes on its own, also where a run of zeros crosses the flush point */
+    zng_stream strm;
+    int trial = 1;
+    zng_deflate_param_value param = { Z_DEFLATE_TRIAL_PARSES, &trial, sizeof(trial), Z_OK };
+    size_t flush_in[DATA_SIZE / 65536], flush_out[DATA_SIZE / 65536];
+    int flushes = 0;
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit2(&strm, 6, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_OK);
+    strm.next_in = samples;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    for (size_t pos = 3 * 4096 + 2048; pos < DATA_SIZE; pos += 65536) {
+        strm.avail_in = (uint32_t)(pos - strm.total_in);
+        EXPECT_EQ(zng_deflate(&strm, Z_FULL_FLUSH), Z_OK);
+        flush_in[flushes] = pos;
+        flush_out[flushes++] = strm.total_out;
+    }
+    strm.avail_in = (uint32_t)(DATA_SIZE - strm.total_in);
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    size_t total = strm.total_out;
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+
+    for (int i = 0; i < flushes; i++) {
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_inflateInit2(&strm, -MAX_WBITS), Z_OK);
+        strm.next_in = compr + flush_out[i];
+        strm.avail_in = (uint32_t)(total - flush_out[i]);
+        strm.next_out = uncompr;
+        strm.avail_out = DATA_SIZE;
+        EXPECT_EQ(zng_inflate(&strm, Z_FINISH), Z_STREAM_END) << "flush " << i;
+        EXPECT_EQ(strm.total_out, DATA_SIZE - flush_in[i]);
+        EXPECT_EQ(memcmp(uncompr, samples + flush_in[i], DATA_SIZE - flush_in[i]), 0);
+        EXPECT_EQ(zng_inflateEnd(&strm), Z_OK);
+    }
+}
@@ -0,0 +1,68 @@
+/* test_histogram.cc -- histogram unit tests
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+}
+
+#include <gtest/gtest.h>
+
+#define MAX_HISTOGRAM_SIZE (4096 + 37)
+
+/* Ensure that histogram adds the byte counts of buffers with runs, random bytes and odd lengths */
+static inline void histogram_check(histogram_func histogram) {
+    uint32_t expect[256], hist[256];
+    uint8_t *buf;
+    size_t len, i;
+
+    buf = (uint8_t *)PREFIX(zcalloc)(NULL, 1, MAX_HISTOGRAM_SIZE);
+    ASSERT_TRUE(buf != NULL);
+
+    srand(1);
+    for (i = 0; i < MAX_HISTOGRAM_SIZE; i++)
+        buf[i] = (i / 100) % 3 ? (uint8_t)(i / 300) : (uint8_t)rand();
+
+    /* Count from the end of the buffer, so the start is unaligned and the counts are added to existing ones */
+    for (len = 0; len <= MAX_HISTOGRAM_SIZE; len += (len < 100 ? 1 : 97)) {
+        const uint8_t *src = buf + MAX_HISTOGRAM_SIZE - len;
+
+        for (i = 0; i < 256; i++)
+            expect[i] = hist[i] = (uint32_t)i;
+        for (i = 0; i < len; i++)
+            expect[src[i]]++;
+
+        histogram(hist, src, len);
+        EXPECT_EQ(0, memcmp(hist, expect, sizeof(hist))) << "len: " << len;
+    }
+
+    PREFIX(zcfree)(NULL, buf);
+}
+
+#define TEST_HISTOGRAM(name, func, support_flag) \
+    TEST(histogram, name) { \
+        if (!support_flag) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        histogram_check(func); \
+    }
+
+TEST_HISTOGRAM(c, histogram_c, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_HISTOGRAM(native, native_histogram, 1)
+#else
+
+#ifdef X86_AVX2
+TEST_HISTOGRAM(avx2, histogram_avx2, test_cpu_features.x86.has_avx2)
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/* test_inflate_checksum.cc - Test the check value computed while inflating with different output buffer sizes */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (512 * 1024)
+
+typedef struct {
+    int32_t window_bits;        /* 15 for zlib, 31 for gzip */
+    uint32_t out_chunk;         /* avail_out given to each inflate() call */
+    uint32_t in_chunk;          /* avail_in given to each inflate() call */
+} inflate_checksum_param;
+
+class inflate_checksum : public ::testing::TestWithParam<inflate_checksum_param> {
+public:
+    uint8_t *data, *compr, *uncompr;
+    uint32_t compr_len;
+    uint32_t check;
+
+    /* Compressible text, random bytes and a stored block, so that inflate_fast() and the slow paths of inflate()
+       both write output between check value updates */
+    void SetUp() override {
+        PREFIX3(stream) c_stream;
+        int32_t window_bits = GetParam().window_bits;
+
+        data = (uint8_t *)malloc(DATA_SIZE);
+        compr = (uint8_t *)malloc(DATA_SIZE * 2);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+
+        srand(57);
+        for (size_t i = 0; i < DATA_SIZE; i++) {
+            if (i < DATA_SIZE / 2)
+                data[i] = (uint8_t)("hello, hello world! "[i % 20] + (rand() % 16 == 0));
+            else
+                data[i] = (uint8_t)rand();
+        }
+
+        memset(&c_stream, 0, sizeof(c_stream));
+        ASSERT_EQ(PREFIX(deflateInit2)(&c_stream, 6, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        c_stream.next_out = compr;
+        c_stream.avail_out = DATA_SIZE * 2;
+        c_stream.next_in = data;
+        c_stream.avail_in = DATA_SIZE / 4;
+        ASSERT_EQ(PREFIX(deflate)(&c_stream, Z_NO_FLUSH), Z_OK);
+        ASSERT_EQ(PREFIX(deflateParams)(&c_stream, 0, Z_DEFAULT_STRATEGY), Z_OK);
+        c_stream.avail_in = DATA_SIZE / 8;
+        ASSERT_EQ(PREFIX(deflate)(&c_stream, Z_NO_FLUSH), Z_OK);
+        ASSERT_EQ(PREFIX(deflateParams)(&c_stream, 6, Z_DEFAULT_STRATEGY), Z_OK);
+        c_stream.avail_in = DATA_SIZE - DATA_SIZE / 4 - DATA_SIZE / 8;
+        ASSERT_EQ(PREFIX(deflate)(&c_stream, Z_FINISH), Z_STREAM_END);
+        compr_len = (uint32_t)c_stream.total_out;
+        ASSERT_EQ(PREFIX(deflateEnd)(&c_stream), Z_OK);
+
+        if (window_bits > MAX_WBITS)
+            check = (uint32_t)PREFIX(crc32)(0, data, DATA_SIZE);
+        else
+            check = (uint32_t)PREFIX(adler32)(1, data, DATA_SIZE);
+    }
+
+    void TearDown() override {
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+};
+
+TEST_P(inflate_checksum, chunked) {
+    inflate_checksum_param param = GetParam();
+    PREFIX3(stream) d_stream;
+    int err = Z_OK;
+
+    memset(&d_stream, 0, sizeof(d_stream));
+    ASSERT_EQ(PREFIX(inflateInit2)(&d_stream, param.window_bits), Z_OK);
+    d_stream.next_in = compr;
+    d_stream.next_out = uncompr;
+
+    while (err == Z_OK) {
+        uint32_t in_left = compr_len - (uint32_t)d_stream.total_in;
+        uint32_t out_left = DATA_SIZE - (uint32_t)d_stream.total_out;
+        d_stream.avail_in = MIN(param.in_chunk, in_left);
+        d_stream.avail_out = MIN(param.out_chunk, out_left);
+        err = PREFIX(inflate)(&d_stream, Z_NO_FLUSH);
+    }
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(d_stream.total_out, (z_size_t)DATA_SIZE);
+    EXPECT_EQ((uint32_t)d_stream.adler, check);
+    EXPECT_EQ(memcmp(uncompr, data, DATA_SIZE), 0);
+    EXPECT_EQ(PREFIX(inflateEnd)(&d_stream), Z_OK);
+}
+
+static const inflate_checksum_param params[] = {
+    { MAX_WBITS, DATA_SIZE, UINT32_MAX },
+    { MAX_WBITS, 1, 7 },
+    { MAX_WBITS, 300, 100000 },
+    { MAX_WBITS, 4097, 1000 },
+    { MAX_WBITS, 70000, 50 },
+    { MAX_WBITS, 300000, 300000 },
+    { MAX_WBITS + 16, DATA_SIZE, UINT32_MAX },
+    { MAX_WBITS + 16, 1, 7 },
+    { MAX_WBITS + 16, 300, 100000 },
+    { MAX_WBITS + 16, 4097, 1000 },
+    { MAX_WBITS + 16, 70000, 50 },
+    { MAX_WBITS + 16, 300000, 300000 },
+};
+
+INSTANTIATE_TEST_SUITE_P(inflate, inflate_checksum, testing::ValuesIn(params));
@@ -0,0 +1,362 @@
+/* test_offload.cc - Test deflate() and inflate() with a registered offload provider */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define DATA_SIZE (256 * 1024)
+
+/* Provider that forwards everything to the software provider and counts the calls */
+typedef struct {
+    uint32_t caps;
+    int accept;
+    int opened;
+    int closed;
+    int jobs;
+    int completed;
+} counting_state;
+
+static int32_t counting_open(void *opaque, void **session, int32_t type, int32_t level, int32_t strategy,
+                             int32_t window_bits) {
+    counting_state *counts = (counting_state *)opaque;
+    const zng_offload_provider *sw = zng_offload_sw_provider();
+
+    if (!counts->accept)
+        return Z_STREAM_ERROR;
+    counts->opened++;
+    return sw->open(sw->opaque, session, type, level, strategy, window_bits);
+}
+
+static int32_t counting_submit(void *opaque, zng_offload_job *job) {
+    const zng_offload_provider *sw = zng_offload_sw_provider();
+
+    ((counting_state *)opaque)->jobs++;
+    return sw->submit(sw->opaque, job);
+}
+
+static int32_t counting_complete(void *opaque, zng_offload_job *job) {
+    const zng_offload_provider *sw = zng_offload_sw_provider();
+
+    ((counting_state *)opaque)->completed++;
+    return sw->complete(sw->opaque, job);
+}
+
+static void counting_close(void *opaque, void *session) {
+    const zng_offload_provider *sw = zng_offload_sw_provider();
+
+    ((counting_state *)opaque)->closed++;
+    sw->close(sw->opaque, session);
+}
+
+class offload : public ::testing::Test {
+public:
+    counting_state counts;
+    zng_offload_provider provider;
+    uint8_t *data;
+    uint8_t *compr;
+    uint8_t *uncompr;
+    size_t compr_size;
+
+    void SetUp() override {
+        memset(&counts, 0, sizeof(counts));
+        counts.accept = 1;
+
+        provider.name = "counting";
+        provider.caps = Z_OFFLOAD_DEFLATE | Z_OFFLOAD_INFLATE;
+        provider.opaque = &counts;
+        provider.open = counting_open;
+        provider.submit = counting_submit;
+        provider.complete = counting_complete;
+        provider.close = counting_close;
+
+        data = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL);
+        /* Mix of compressible text and noise */
+        for (size_t i = 0; i < DATA_SIZE; i++)
+            data[i] = (i / 4096) % 2 ? (uint8_t)rand() : (uint8_t)("offload provider "[i % 17]);
+
+        compr_size = DATA_SIZE * 2;
+        compr = (uint8_t *)malloc(compr_size);
+        ASSERT_TRUE(compr != NULL);
+        uncompr = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(uncompr != NULL);
+
+        EXPECT_EQ(zng_offload_register(&provider), Z_OK);
+    }
+
+    void TearDown() override {
+        zng_offload_unregister(&provider);
+        free(data);
+        free(compr);
+        free(uncompr);
+    }
+
+    /* Compress with small output chunks, so that the provider is called many times */
+    size_t compress(int32_t window_bits, int offload_allowed) {
+        zng_stream strm;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        err = zng_deflateInit2(&strm, 6, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+        EXPECT_EQ(err, Z_OK);
+
+        if (!offload_allowed) {
+            zng_deflate_param_value param;
+            param.param = Z_DEFLATE_OFFLOAD;
+            param.buf = &offload_allowed;
+            param.size = sizeof(offload_allowed);
+            EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_OK);
+        }
+
+        strm.next_in = data;
+        strm.avail_in = DATA_SIZE;
+        strm.next_out = compr;
+        do {
+            strm.avail_out = (uint32_t)MIN(1000, compr + compr_size - strm.next_out);
+            err = zng_deflate(&strm, Z_FINISH);
+        } while (err == Z_OK);
+        EXPECT_EQ(err, Z_STREAM_END);
+        EXPECT_EQ(strm.total_in, DATA_SIZE);
+
+        size_t total = strm.total_out;
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+        return total;
+    }
+
+    void decompress(int32_t window_bits, size_t total) {
+        zng_stream strm;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        err = zng_inflateInit2(&strm, window_bits);
+        EXPECT_EQ(err, Z_OK);
+
+        strm.next_in = compr;
+        strm.avail_in = (uint32_t)total;
+        strm.next_out = uncompr;
+        do {
+            strm.avail_out = (uint32_t)MIN(1000, uncompr + DATA_SIZE - strm.next_out);
+            err = zng_inflate(&strm, Z_NO_FLUSH);
+        } while (err == Z_OK);
+        EXPECT_EQ(err, Z_STREAM_END) << strm.msg;
+        EXPECT_EQ(strm.total_out, DATA_SIZE);
+        EXPECT_EQ(strm.avail_in, 0);
+        EXPECT_EQ(memcmp(data, uncompr, DATA_SIZE), 0);
+        EXPECT_EQ(zng_inflateEnd(&strm), Z_OK);
+    }
+
+    void roundtrip(int32_t window_bits) {
+        size_t total = compress(window_bits, 1);
+        EXPECT_EQ(counts.opened, 1);
+        decompress(window_bits, total);
+        EXPECT_EQ(counts.opened, 2);
+        EXPECT_EQ(counts.closed, 2);
+        EXPECT_GT(counts.jobs, 2);
+    }
+};
+
+TEST_F(offload, zlib) {
+    roundtrip(MAX_WBITS);
+}
+
+TEST_F(offload, gzip) {
+    roundtrip(MAX_WBITS + 16);
+}
+
+TEST_F(offload, raw) {
+    roundtrip(-MAX_WBITS);
+}
+
+TEST_F(offload, deflate_only) {
+    provider.caps = Z_OFFLOAD_DEFLATE;
+    size_t total = compress(MAX_WBITS, 1);
+    decompress(MAX_WBITS, total);
+    EXPECT_EQ(counts.opened, 1);
+    EXPECT_EQ(counts.closed, 1);
+}
+
+TEST_F(offload, disabled) {
+    size_t total = compress(MAX_WBITS, 0);
+    EXPECT_EQ(counts.opened, 0);
+    EXPECT_EQ(counts.jobs, 0);
+
+    /* Offloaded inflate must still accept the software compressed stream */
+    decompress(MAX_WBITS, total);
+    EXPECT_EQ(counts.opened, 1);
+}
+
+TEST_F(offload, declined) {
+    counts.accept = 0;
+    size_t total = compress(MAX_WBITS + 16, 1);
+    decompress(MAX_WBITS + 16, total);
+    EXPECT_EQ(counts.opened, 0);
+    EXPECT_EQ(counts.jobs, 0);
+}
+
+TEST_F(offload, unregistered) {
+    EXPECT_EQ(zng_offload_unregister(&provider), Z_OK);
+    EXPECT_EQ(zng_offload_unregister(&provider), Z_STREAM_ERROR);
+    size_t total = compress(MAX_WBITS, 1);
+    decompress(MAX_WBITS, total);
+    EXPECT_EQ(counts.opened, 0);
+}
+
+TEST_F(offload, registered_later) {
+    zng_stream strm;
+
+    /* The stream looks for providers when it starts, not when it is initialized */
+    EXPECT_EQ(zng_offload_unregister(&provider), Z_OK);
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    size_t bound = zng_deflateBound(&strm, DATA_SIZE);
+    EXPECT_EQ(zng_offload_register(&provider), Z_OK);
+    EXPECT_GT(zng_deflateBound(&strm, DATA_SIZE), bound);
+
+    strm.next_in = data;
+    strm.avail_in = 1024;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(counts.opened, 1);
+
+    /* A stream that started in software looks again after a reset */
+    EXPECT_EQ(zng_offload_unregister(&provider), Z_OK);
+    EXPECT_EQ(zng_deflateReset(&strm), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = 1024;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(zng_deflate(&strm, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(zng_offload_register(&provider), Z_OK);
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(counts.opened, 1);
+    EXPECT_EQ(zng_deflateReset(&strm), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = 1024;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(counts.opened, 2);
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+}
+
+TEST_F(offload, overlap) {
+    zng_stream strm;
+    uint8_t *in = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(in != NULL);
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+
+    /* The job holding the last input of a call is left running, and the input buffer can be reused right away */
+    for (size_t pos = 0; pos < DATA_SIZE; pos += 4096) {
+        memcpy(in, data + pos, 4096);
+        strm.next_in = in;
+        strm.avail_in = 4096;
+        EXPECT_EQ(zng_deflate(&strm, Z_NO_FLUSH), Z_OK);
+        EXPECT_EQ(strm.avail_in, 0);
+        EXPECT_EQ(counts.completed, counts.jobs - 1);
+        memset(in, 0xa5, 4096);
+    }
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(counts.completed, counts.jobs);
+    size_t total = strm.total_out;
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+    free(in);
+
+    decompress(MAX_WBITS, total);
+}
+
+TEST_F(offload, end_while_busy) {
+    zng_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = 4096;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(zng_deflate(&strm, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(counts.completed, counts.jobs - 1);
+    /* Z_DATA_ERROR since the stream was not finished */
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_DATA_ERROR);
+    EXPECT_EQ(counts.completed, counts.jobs);
+    EXPECT_EQ(counts.closed, 1);
+}
+
+TEST_F(offload, params) {
+    zng_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = DATA_SIZE / 2;
+    strm.next_out = compr;
+    strm.avail_out = (uint32_t)compr_size;
+    EXPECT_EQ(zng_deflate(&strm, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(counts.opened, 1);
+
+    /* Unchanged parameters keep the provider */
+    EXPECT_EQ(zng_deflateParams(&strm, 6, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(counts.closed, 0);
+
+    /* New ones are applied in software after the provider flushed its data */
+    EXPECT_EQ(zng_deflateParams(&strm, 1, Z_DEFAULT_STRATEGY), Z_OK);
+    EXPECT_EQ(counts.closed, 1);
+    int jobs = counts.jobs;
+
+    strm.avail_in = DATA_SIZE - DATA_SIZE / 2;
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(counts.jobs, jobs);
+    EXPECT_EQ(counts.opened, 1);
+    size_t total = strm.total_out;
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+
+    decompress(MAX_WBITS, total);
+}
+
+TEST_F(offload, sw_provider) {
+    const zng_offload_provider *sw = zng_offload_sw_provider();
+
+    EXPECT_EQ(zng_offload_unregister(&provider), Z_OK);
+    EXPECT_EQ(zng_offload_register(sw), Z_OK);
+    EXPECT_EQ(zng_offload_register(sw), Z_OK);
+    size_t total = compress(MAX_WBITS + 16, 1);
+    decompress(MAX_WBITS + 16, total);
+    EXPECT_EQ(zng_offload_unregister(sw), Z_OK);
+}
+
+TEST_F(offload, restricted_operations) {
+    zng_stream strm;
+    uint8_t out[64];
+    uint32_t dict_len = 0;
+
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = 1024;
+    strm.next_out = out;
+    strm.avail_out = sizeof(out);
+    EXPECT_EQ(zng_deflate(&strm, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(counts.opened, 1);
+
+    zng_stream copy;
+    EXPECT_EQ(zng_deflateCopy(&copy, &strm), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_deflatePrime(&strm, 3, 1), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_deflateGetDictionary(&strm, NULL, &dict_len), Z_STREAM_ERROR);
+
+    /* Resetting the stream releases the session */
+    EXPECT_EQ(zng_deflateReset(&strm), Z_OK);
+    EXPECT_EQ(counts.closed, 1);
+    EXPECT_EQ(zng_deflatePrime(&strm, 3, 1), Z_OK);
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+    EXPECT_EQ(counts.opened, 1);
+}
@@ -1,6 +1,9 @@
 #ifndef TEST_SHARED_H
 #define TEST_SHARED_H
 
+#include <stdint.h>
+#include <string.h>
+
 /* Test definitions that can be used in the original zlib build environment. */
 
 /* "hello world" would be more standard, but the repeated "hello"
@@ -9,6 +12,43 @@
 static const char hello[] = "hello, hello!";
 static const int hello_len = sizeof(hello);
 
+/* Words of C source code, for test data that compresses like text */
+static const char *const code_words[] = { "int ", "return ", "static ", "const ", "uint8_t ", "*buf, ", "size_t ",
+    "len);\n", "if (", "s->level ", "== 0) ", "{\n", "}\n", "for (i = 0; ", "i < n; ", "i++)\n" };
+
+/* Linear congruential generator for reproducible test data, returns the next seed */
+static inline uint32_t lcg_next(uint32_t *seed) {
+    *seed = *seed * 1103515245 + 12345;
+    return *seed;
+}
+
+/* Fill len bytes at buf with words picked at random from count words */
+static inline void fill_words(uint8_t *buf, size_t len, const char *const *words, size_t count, uint32_t *seed) {
+    size_t pos = 0;
+
+    while (pos < len) {
+        const char *word = words[(lcg_next(seed) >> 16) % count];
+        size_t word_len = strlen(word);
+        if (word_len > len - pos)
+            word_len = len - pos;
+        memcpy(buf + pos, word, word_len);
+        pos += word_len;
+    }
+}
+
+/* Fill len bytes at buf with words of code_words */
+static inline void fill_code_words(uint8_t *buf, size_t len, uint32_t *seed) {
+    fill_words(buf, len, code_words, sizeof(code_words) / sizeof(code_words[0]), seed);
+}
+
+/* Fill len bytes at buf with random bytes */
+static inline void fill_random(uint8_t *buf, size_t len, uint32_t *seed) {
+    size_t pos;
+
+    for (pos = 0; pos < len; pos++)
+        buf[pos] = (uint8_t)(lcg_next(seed) >> 24);
+}
+
 /* Clang static analyzer doesn't understand googletest's ASSERT_TRUE, so we need to tell that it's like assert() */
 #ifdef __clang_analyzer__
 #  undef  ASSERT_TRUE
@@ -20,4 +20,18 @@ static inline int deflate_prime_32(PREFIX3(stream) *stream, uint32_t value) {
     return err;
 }
 
+/* Uncompress compr_len bytes at compr into uncompr and check that they give back the len bytes at data. Returns
+ * the error of uncompress(), or Z_DATA_ERROR if the output is not the same. */
+static inline int check_uncompress(uint8_t *uncompr, const uint8_t *data, size_t len, const uint8_t *compr,
+                                   size_t compr_len) {
+    z_uintmax_t out_len = len;
+    int err = PREFIX(uncompress)(uncompr, &out_len, compr, (z_uintmax_t)compr_len);
+
+    if (err != Z_OK)
+        return err;
+    if (out_len != len || memcmp(uncompr, data, len) != 0)
+        return Z_DATA_ERROR;
+    return Z_OK;
+}
+
 #endif
@@ -0,0 +1,46 @@
+/* test_state_cache.cc - Test that a stream of the state cache is not handed out twice */
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil.h"
+#  include "state_cache.h"
+}
+
+#include <gtest/gtest.h>
+
+TEST(state_cache, nested_deflate) {
+    PREFIX3(stream) *outer, *inner, *again;
+
+    /* A call made while the stream for the same parameters is taken gets another stream, or none */
+    outer = state_cache_deflate(6, MAX_WBITS, DEF_MEM_LEVEL);
+    inner = state_cache_deflate(6, MAX_WBITS, DEF_MEM_LEVEL);
+    if (outer != NULL) {
+        EXPECT_NE(outer, inner);
+    }
+    if (inner != NULL)
+        state_cache_deflate_done(inner);
+    if (outer != NULL)
+        state_cache_deflate_done(outer);
+
+    /* Both are free again afterwards, and either of them is taken again */
+    again = state_cache_deflate(6, MAX_WBITS, DEF_MEM_LEVEL);
+    EXPECT_TRUE(again == outer || again == inner);
+    if (again != NULL)
+        state_cache_deflate_done(again);
+}
+
+TEST(state_cache, nested_inflate) {
+    PREFIX3(stream) *outer, *inner, *again;
+
+    /* There is one inflate stream, so a nested call sets up a stream of its own */
+    outer = state_cache_inflate(MAX_WBITS);
+    inner = state_cache_inflate(MAX_WBITS);
+    EXPECT_EQ(inner, (PREFIX3(stream) *)NULL);
+    if (outer != NULL)
+        state_cache_inflate_done(outer);
+
+    again = state_cache_inflate(MAX_WBITS);
+    EXPECT_EQ(again, outer);
+    if (again != NULL)
+        state_cache_inflate_done(again);
+}
@@ -0,0 +1,128 @@
+/* test_stream_alloc.cc - Test the default allocator with many streams and buffers alive at once */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil.h"
+#  include "deflate.h"
+#  ifdef ZLIB_COMPAT
+#    include "zlib.h"
+#  else
+#    include "zlib-ng.h"
+#  endif
+}
+
+#include "test_shared.h"
+
+#include <gtest/gtest.h>
+
+#define NUM_STREAMS 40
+#define DATA_SIZE   (64 * 1024)
+#define CHUNK_SIZE  4000
+#define COMPR_SIZE  (DATA_SIZE * 2)
+
+TEST(stream_alloc, buffers) {
+    static const size_t sizes[] = { 1, 1000, 32 * 1024, 100 * 1024, 300 * 1024, 2 * 1024 * 1024 - 64,
+                                    2 * 1024 * 1024, 5 * 1024 * 1024 + 1 };
+    const int count = (int)(sizeof(sizes) / sizeof(sizes[0]));
+    uint8_t *bufs[3][sizeof(sizes) / sizeof(sizes[0])];
+
+    /* Buffers of each size, which must not overlap, and which are freed in another order than they came */
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < count; i++) {
+            bufs[round][i] = (uint8_t *)PREFIX(zcalloc)(NULL, 1, (unsigned)sizes[i]);
+            ASSERT_TRUE(bufs[round][i] != NULL);
+            memset(bufs[round][i], round * count + i, sizes[i]);
+        }
+    }
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < count; i++) {
+            for (size_t pos = 0; pos < sizes[i]; pos += 997)
+                ASSERT_EQ(bufs[round][i][pos], (uint8_t)(round * count + i)) << "size " << sizes[i];
+            ASSERT_EQ(bufs[round][i][sizes[i] - 1], (uint8_t)(round * count + i)) << "size " << sizes[i];
+        }
+    }
+    for (int i = count - 1; i >= 0; i--)
+        PREFIX(zcfree)(NULL, bufs[1][i]);
+    for (int i = 0; i < count; i++) {
+        PREFIX(zcfree)(NULL, bufs[0][i]);
+        PREFIX(zcfree)(NULL, bufs[2][i]);
+    }
+}
+
+TEST(stream_alloc, streams) {
+    PREFIX3(stream) def[NUM_STREAMS], inf[NUM_STREAMS];
+    bool ended[NUM_STREAMS] = { false };
+    uint8_t *data = (uint8_t *)malloc(DATA_SIZE);
+    uint8_t *compr = (uint8_t *)malloc(NUM_STREAMS * COMPR_SIZE);
+    uint8_t *uncompr = (uint8_t *)malloc(NUM_STREAMS * DATA_SIZE);
+    uint32_t seed = 74;
+
+    ASSERT_TRUE(data != NULL && compr != NULL && uncompr != NULL);
+    for (size_t pos = 0; pos < DATA_SIZE; pos++)
+        data[pos] = (uint8_t)('a' + (lcg_next(&seed) >> 16) % 8);
+
+    /* Deflate streams with different parameters, including the large-block memLevels where the API has them, and so
+     * different buffer sizes, compress at the same time */
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        memset(&def[i], 0, sizeof(def[i]));
+        EXPECT_EQ(PREFIX(deflateInit2)(&def[i], i % 10, Z_DEFLATED, 9 + i % 7, 1 + i % MAX_LARGE_MEM_LEVEL,
+                                       Z_DEFAULT_STRATEGY), Z_OK);
+        def[i].next_out = compr + i * COMPR_SIZE;
+        def[i].avail_out = COMPR_SIZE;
+    }
+    for (size_t pos = 0; pos < DATA_SIZE; pos += CHUNK_SIZE) {
+        for (int i = 0; i < NUM_STREAMS; i++) {
+            if (ended[i])
+                continue;
+            def[i].next_in = data + pos;
+            def[i].avail_in = (uint32_t)MIN(CHUNK_SIZE, DATA_SIZE - pos);
+            EXPECT_EQ(PREFIX(deflate)(&def[i], pos + CHUNK_SIZE < DATA_SIZE ? Z_NO_FLUSH : Z_FINISH),
+                      pos + CHUNK_SIZE < DATA_SIZE ? Z_OK : Z_STREAM_END);
+        }
+        /* Streams that end make room for others */
+        if (pos / CHUNK_SIZE == DATA_SIZE / CHUNK_SIZE / 2) {
+            for (int i = 0; i < NUM_STREAMS; i += 3) {
+                EXPECT_EQ(PREFIX(deflateEnd)(&def[i]), Z_DATA_ERROR);
+                ended[i] = true;
+                memset(&inf[i], 0, sizeof(inf[i]));
+                EXPECT_EQ(PREFIX(inflateInit)(&inf[i]), Z_OK);
+            }
+        }
+    }
+
+    /* And the inflate streams in between them */
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        if (ended[i]) {
+            EXPECT_EQ(PREFIX(inflateEnd)(&inf[i]), Z_OK);
+            continue;
+        }
+        EXPECT_EQ(PREFIX(deflateEnd)(&def[i]), Z_OK);
+        memset(&inf[i], 0, sizeof(inf[i]));
+        EXPECT_EQ(PREFIX(inflateInit2)(&inf[i], 9 + i % 7), Z_OK);
+        inf[i].next_in = compr + i * COMPR_SIZE;
+        inf[i].avail_in = COMPR_SIZE;
+        inf[i].next_out = uncompr + i * DATA_SIZE;
+        inf[i].avail_out = DATA_SIZE;
+    }
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        if (ended[i])
+            continue;
+        EXPECT_EQ(PREFIX(inflate)(&inf[i], Z_FINISH), Z_STREAM_END);
+        EXPECT_EQ(inf[i].total_out, (size_t)DATA_SIZE);
+        EXPECT_EQ(memcmp(uncompr + i * DATA_SIZE, data, DATA_SIZE), 0) << "stream " << i;
+    }
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        if (ended[i])
+            continue;
+        EXPECT_EQ(PREFIX(inflateEnd)(&inf[i]), Z_OK);
+    }
+
+    free(data);
+    free(compr);
+    free(uncompr);
+}
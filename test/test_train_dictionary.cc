@@ -0,0 +1,128 @@
+/* test_train_dictionary.cc - Test zng_train_dictionary() with small JSON records */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define NUM_SAMPLES 400
+#define SAMPLE_SIZE 512
+
+class train_dictionary : public ::testing::Test {
+public:
+    uint8_t sample_data[NUM_SAMPLES][SAMPLE_SIZE];
+    const uint8_t *samples[NUM_SAMPLES];
+    size_t sizes[NUM_SAMPLES];
+    uint8_t dict[32768];
+
+    void SetUp() override {
+        static const char *names[] = { "alice", "bob", "carol", "dave", "erin", "frank", "grace", "heidi" };
+        static const char *states[] = { "active", "suspended", "pending_verification", "closed" };
+
+        srand(61);
+        for (int i = 0; i < NUM_SAMPLES; i++) {
+            int len = snprintf((char *)sample_data[i], SAMPLE_SIZE,
+                "{\"id\":%d,\"user\":{\"name\":\"%s\",\"email\":\"%s%d@example.com\",\"account_state\":\"%s\"},"
+                "\"created_at\":\"2024-%02d-%02dT%02d:%02d:00Z\",\"permissions\":[\"read\",\"write\"],"
+                "\"preferences\":{\"theme\":\"%s\",\"notifications\":%s,\"language\":\"en-US\"}}",
+                rand(), names[rand() % 8], names[rand() % 8], rand() % 1000, states[rand() % 4],
+                1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60,
+                rand() % 2 ? "dark" : "light", rand() % 2 ? "true" : "false");
+            samples[i] = sample_data[i];
+            sizes[i] = (size_t)len;
+        }
+    }
+
+    /* Compress a sample with or without the dictionary, check it inflates back and return the compressed size */
+    size_t round_trip(const uint8_t *buf, size_t len, const uint8_t *dictionary, size_t dict_len) {
+        uint8_t compr[1024], uncompr[SAMPLE_SIZE];
+        zng_stream strm;
+        size_t compr_len;
+        int err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_deflateInit(&strm, Z_BEST_COMPRESSION), Z_OK);
+        if (dictionary) {
+            EXPECT_EQ(zng_deflateSetDictionary(&strm, dictionary, (uint32_t)dict_len), Z_OK);
+        }
+        strm.next_in = buf;
+        strm.avail_in = (uint32_t)len;
+        strm.next_out = compr;
+        strm.avail_out = sizeof(compr);
+        EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+        compr_len = strm.total_out;
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_inflateInit(&strm), Z_OK);
+        strm.next_in = compr;
+        strm.avail_in = (uint32_t)compr_len;
+        strm.next_out = uncompr;
+        strm.avail_out = sizeof(uncompr);
+        err = zng_inflate(&strm, Z_NO_FLUSH);
+        if (dictionary) {
+            EXPECT_EQ(err, Z_NEED_DICT);
+            EXPECT_EQ(zng_inflateSetDictionary(&strm, dictionary, (uint32_t)dict_len), Z_OK);
+            err = zng_inflate(&strm, Z_NO_FLUSH);
+        }
+        EXPECT_EQ(err, Z_STREAM_END);
+        EXPECT_EQ(strm.total_out, len);
+        EXPECT_EQ(memcmp(uncompr, buf, len), 0);
+        EXPECT_EQ(zng_inflateEnd(&strm), Z_OK);
+        return compr_len;
+    }
+};
+
+TEST_F(train_dictionary, improves_ratio) {
+    size_t plain = 0, trained = 0;
+    size_t dict_len = zng_train_dictionary(samples, sizes, NUM_SAMPLES, dict, sizeof(dict));
+
+    ASSERT_GT(dict_len, 0u);
+    ASSERT_LE(dict_len, sizeof(dict));
+
+    /* The first half of the samples trains a dictionary for the second half */
+    dict_len = zng_train_dictionary(samples, sizes, NUM_SAMPLES / 2, dict, 4096);
+    ASSERT_GT(dict_len, 0u);
+    ASSERT_LE(dict_len, 4096u);
+    for (int i = NUM_SAMPLES / 2; i < NUM_SAMPLES; i++) {
+        plain += round_trip(samples[i], sizes[i], NULL, 0);
+        trained += round_trip(samples[i], sizes[i], dict, dict_len);
+    }
+    EXPECT_LT(trained * 2, plain);
+}
+
+TEST_F(train_dictionary, capacity) {
+    static const size_t caps[] = { 1, 7, 100, 256, 1000, 32768, 65536 };
+
+    for (size_t i = 0; i < sizeof(caps) / sizeof(caps[0]); i++) {
+        size_t cap = MIN(caps[i], sizeof(dict));
+        size_t dict_len = zng_train_dictionary(samples, sizes, NUM_SAMPLES, dict, caps[i]);
+        EXPECT_GT(dict_len, 0u) << "capacity " << caps[i];
+        EXPECT_LE(dict_len, cap) << "capacity " << caps[i];
+        round_trip(samples[0], sizes[0], dict, dict_len);
+    }
+}
+
+TEST_F(train_dictionary, single_sample) {
+    size_t dict_len = zng_train_dictionary(samples, sizes, 1, dict, sizeof(dict));
+    EXPECT_GT(dict_len, 0u);
+    EXPECT_LE(dict_len, sizes[0]);
+}
+
+TEST_F(train_dictionary, invalid) {
+    static const uint8_t tiny[4] = { 1, 2, 3, 4 };
+    const uint8_t *tiny_samples[2] = { tiny, NULL };
+    size_t tiny_sizes[2] = { sizeof(tiny), 1 };
+
+    EXPECT_EQ(zng_train_dictionary(NULL, sizes, NUM_SAMPLES, dict, sizeof(dict)), 0u);
+    EXPECT_EQ(zng_train_dictionary(samples, NULL, NUM_SAMPLES, dict, sizeof(dict)), 0u);
+    EXPECT_EQ(zng_train_dictionary(samples, sizes, NUM_SAMPLES, NULL, sizeof(dict)), 0u);
+    EXPECT_EQ(zng_train_dictionary(samples, sizes, NUM_SAMPLES, dict, 0), 0u);
+    EXPECT_EQ(zng_train_dictionary(samples, sizes, 0, dict, sizeof(dict)), 0u);
+    EXPECT_EQ(zng_train_dictionary(tiny_samples, tiny_sizes, 1, dict, sizeof(dict)), 0u);
+    EXPECT_EQ(zng_train_dictionary(tiny_samples, tiny_sizes, 2, dict, sizeof(dict)), 0u);
+}
@@ -1,9 +1,10 @@
-/* makecrct.c -- output crc32 tables
+/* makecrct.c -- output crc32, crc32c and crc64 tables
  * Copyright (C) 1995-2022 Mark Adler
  * For conditions of distribution and use, see copyright notice in zlib.h
 */
 
 #include <stdio.h>
+#include <string.h>
 #include <inttypes.h>
 #include "zbuild.h"
 #include "zutil.h"
@@ -19,16 +20,34 @@
 
 #include "crc32_braid_p.h"
 
+/* Polynomial and table names of the CRC being generated, -c selects CRC-32C */
+static uint32_t crc_poly = POLY;
+static const char *tbl_file = "crc32_braid_tbl.h";
+static const char *tbl_guard = "CRC32_BRAID_TBL_H_";
+static const char *tbl_prefix = "crc";
+static const char *tbl_x2n = "x2n_table";
+
 static uint32_t crc_table[256];
 static z_word_t crc_big_table[256];
 static uint32_t x2n_table[32];
 
+static uint64_t crc64_table[256];
+static z_word_t crc64_big_table[256];
+static uint64_t crc64_x2n_table[66];
+
+#undef POLY
+#define POLY crc_poly
+
 #include "crc32_braid_comb_p.h"
+#include "crc64_braid_comb_p.h"
 
 static void make_crc_table(void);
 static void print_crc_table(void);
+static void make_crc64_table(void);
+static void print_crc64_table(void);
 
 static void braid(uint32_t ltl[][256], z_word_t big[][256], int n, int w);
+static void braid64(uint64_t ltl[][256], z_word_t big[][256], int n);
 
 static void write_table(const uint32_t *table, int k);
 static void write_table32hi(const z_word_t *table, int k);
@@ -79,6 +98,28 @@ static void make_crc_table(void) {
         x2n_table[n] = p = multmodp(p, p);
 }
 
+/*
+  Generate the byte-wise tables for the reflected CRC-64 polynomial of
+  ECMA-182, as used by xz, in the same way as for the 32-bit CRC above.
+*/
+static void make_crc64_table(void) {
+    unsigned i, j, n;
+    uint64_t p;
+
+    for (i = 0; i < 256; i++) {
+        p = i;
+        for (j = 0; j < 8; j++)
+            p = p & 1 ? (p >> 1) ^ CRC64_POLY : p >> 1;
+        crc64_table[i] = p;
+        crc64_big_table[i] = ZSWAP64(p);
+    }
+
+    p = (uint64_t)1 << 62;         /* x^1 */
+    crc64_x2n_table[0] = p;
+    for (n = 1; n < CRC64_X2N_SIZE; n++)
+        crc64_x2n_table[n] = p = multmodp64(p, p);
+}
+
 /*
   Generate the little and big-endian braid tables for the given n and z_word_t
   size w. Each array must have room for w blocks of 256 elements.
@@ -97,6 +138,24 @@ static void braid(uint32_t ltl[][256], z_word_t big[][256], int n, int w) {
     }
 }
 
+/*
+  Generate the CRC-64 braid tables for the given n. A braid word must hold the
+  whole CRC, so there are only tables for a 64-bit z_word_t.
+ */
+static void braid64(uint64_t ltl[][256], z_word_t big[][256], int n) {
+    int k;
+    uint64_t i, p, q;
+    for (k = 0; k < 8; k++) {
+        p = x2nmodp64(((z_off64_t)n * 8 + 7 - k) << 3, 0);
+        ltl[k][0] = 0;
+        big[7 - k][0] = 0;
+        for (i = 1; i < 256; i++) {
+            ltl[k][i] = q = multmodp64(i << 56, p);
+            big[7 - k][i] = ZSWAP64(q);
+        }
+    }
+}
+
 /*
    Write the 32-bit values in table[0..k-1] to out, five per line in
    hexadecimal separated by commas.
@@ -144,13 +203,13 @@ static void print_crc_table(void) {
     uint32_t ltl[8][256];
     z_word_t big[8][256];
 
-    printf("#ifndef CRC32_BRAID_TBL_H_\n");
-    printf("#define CRC32_BRAID_TBL_H_\n\n");
-    printf("/* crc32_braid_tbl.h -- tables for braided CRC calculation\n");
+    printf("#ifndef %s\n", tbl_guard);
+    printf("#define %s\n\n", tbl_guard);
+    printf("/* %s -- tables for braided CRC calculation\n", tbl_file);
     printf(" * Generated automatically by makecrct.c\n */\n\n");
 
     /* print little-endian CRC table */
-    printf("static const uint32_t crc_table[] = {\n");
+    printf("static const uint32_t %s_table[] = {\n", tbl_prefix);
     printf("    ");
     write_table(crc_table, 256);
     printf("};\n\n");
@@ -158,14 +217,14 @@ static void print_crc_table(void) {
     /* print big-endian CRC table for 64-bit z_word_t */
     printf("#ifdef W\n\n");
     printf("#if W == 8\n\n");
-    printf("static const z_word_t crc_big_table[] = {\n");
+    printf("static const z_word_t %s_big_table[] = {\n", tbl_prefix);
     printf("    ");
     write_table64(crc_big_table, 256);
     printf("};\n\n");
 
     /* print big-endian CRC table for 32-bit z_word_t */
     printf("#else /* W == 4 */\n\n");
-    printf("static const z_word_t crc_big_table[] = {\n");
+    printf("static const z_word_t %s_big_table[] = {\n", tbl_prefix);
     printf("    ");
     write_table32hi(crc_big_table, 256);
     printf("};\n\n");
@@ -182,14 +241,14 @@ static void print_crc_table(void) {
         /* write out braid tables for 64-bit z_word_t */
         printf("\n");
         printf("#if W == 8\n\n");
-        printf("static const uint32_t crc_braid_table[][256] = {\n");
+        printf("static const uint32_t %s_braid_table[][256] = {\n", tbl_prefix);
         for (k = 0; k < 8; k++) {
             printf("   {");
             write_table(ltl[k], 256);
             printf("}%s", k < 7 ? ",\n" : "");
         }
         printf("};\n\n");
-        printf("static const z_word_t crc_braid_big_table[][256] = {\n");
+        printf("static const z_word_t %s_braid_big_table[][256] = {\n", tbl_prefix);
         for (k = 0; k < 8; k++) {
             printf("   {");
             write_table64(big[k], 256);
@@ -203,14 +262,14 @@ static void print_crc_table(void) {
         /* write out braid tables for 32-bit z_word_t */
         printf("\n");
         printf("#else /* W == 4 */\n\n");
-        printf("static const uint32_t crc_braid_table[][256] = {\n");
+        printf("static const uint32_t %s_braid_table[][256] = {\n", tbl_prefix);
         for (k = 0; k < 4; k++) {
             printf("   {");
             write_table(ltl[k], 256);
             printf("}%s", k < 3 ? ",\n" : "");
         }
         printf("};\n\n");
-        printf("static const z_word_t crc_braid_big_table[][256] = {\n");
+        printf("static const z_word_t %s_braid_big_table[][256] = {\n", tbl_prefix);
         for (k = 0; k < 4; k++) {
             printf("   {");
             write_table32hi(big[k], 256);
@@ -224,19 +283,86 @@ static void print_crc_table(void) {
     printf("\n");
 
     /* write out zeros operator table */
-    printf("static const uint32_t x2n_table[] = {\n");
+    printf("static const uint32_t %s[] = {\n", tbl_x2n);
     printf("    ");
     write_table(x2n_table, 32);
     printf("};\n");
 
     printf("\n");
-    printf("#endif /* CRC32_BRAID_TBL_H_ */\n");
+    printf("#endif /* %s */\n", tbl_guard);
+}
+
+static void print_crc64_table(void) {
+    int k, n;
+    uint64_t ltl[8][256];
+    z_word_t big[8][256];
+
+    printf("#ifndef CRC64_BRAID_TBL_H_\n");
+    printf("#define CRC64_BRAID_TBL_H_\n\n");
+    printf("/* crc64_braid_tbl.h -- tables for braided CRC-64 calculation\n");
+    printf(" * Generated automatically by makecrct.c\n */\n\n");
+
+    /* print little-endian CRC table */
+    printf("static const uint64_t crc64_table[] = {\n");
+    printf("    ");
+    write_table64(crc64_table, 256);
+    printf("};\n\n");
+
+    /* print big-endian CRC and braid tables, only for 64-bit z_word_t */
+    printf("#if defined(W) && W == 8\n\n");
+    printf("static const z_word_t crc64_big_table[] = {\n");
+    printf("    ");
+    write_table64(crc64_big_table, 256);
+    printf("};\n\n");
+
+    for (n = 1; n <= 6; n++) {
+        printf("#if N == %d\n\n", n);
+
+        braid64(ltl, big, n);
+
+        printf("static const uint64_t crc64_braid_table[][256] = {\n");
+        for (k = 0; k < 8; k++) {
+            printf("   {");
+            write_table64(ltl[k], 256);
+            printf("}%s", k < 7 ? ",\n" : "");
+        }
+        printf("};\n\n");
+        printf("static const z_word_t crc64_braid_big_table[][256] = {\n");
+        for (k = 0; k < 8; k++) {
+            printf("   {");
+            write_table64(big[k], 256);
+            printf("}%s", k < 7 ? ",\n" : "");
+        }
+        printf("};\n\n");
+
+        printf("#endif /* N == %d */\n", n);
+    }
+    printf("\n#endif /* W */\n\n");
+
+    /* write out zeros operator table */
+    printf("static const uint64_t crc64_x2n_table[] = {\n");
+    printf("    ");
+    write_table64(crc64_x2n_table, CRC64_X2N_SIZE);
+    printf("};\n");
+
+    printf("\n");
+    printf("#endif /* CRC64_BRAID_TBL_H_ */\n");
 }
 
-// The output of this application can be piped out to recreate crc32 tables
+// The output of this application can be piped out to recreate crc32 tables, crc32c tables with -c or crc64 tables with -64
 int main(int argc, char *argv[]) {
-    Z_UNUSED(argc);
-    Z_UNUSED(argv);
+    if (argc > 1 && strcmp(argv[1], "-64") == 0) {
+        make_crc64_table();
+        print_crc64_table();
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+        crc_poly = CRC32C_POLY;
+        tbl_file = "crc32c_braid_tbl.h";
+        tbl_guard = "CRC32C_BRAID_TBL_H_";
+        tbl_prefix = "crc32c";
+        tbl_x2n = "crc32c_x2n_table";
+    }
 
     make_crc_table();
     print_crc_table();
@@ -75,6 +75,12 @@ static int  build_bl_tree    (deflate_state *s);
 static void send_all_trees   (deflate_state *s, int lcodes, int dcodes, int blcodes);
 static void compress_block   (deflate_state *s, const ct_data *ltree, const ct_data *dtree);
 static int  detect_data_type (deflate_state *s);
+static int  trial_parses     (deflate_state *s, const unsigned char *buf, uint32_t len);
+static void trial_next_block (deflate_state *s, uint32_t len, unsigned int syms);
+static void large_block_count(deflate_state *s, uint32_t *lfreq, uint32_t *dfreq);
+static void large_block_lens (deflate_state *s, const uint32_t *lfreq, const uint32_t *dfreq);
+static unsigned char *direct_begin(deflate_state *s, unsigned long len);
+static void direct_end       (deflate_state *s, unsigned char *pending_buf);
 
 /* ===========================================================================
  * Initialize the tree data structures for a new zlib stream.
@@ -608,6 +614,237 @@ void Z_INTERNAL zng_tr_stored_block(deflate_state *s, char *buf, uint32_t stored
     }
 }
 
+/* Whether archival mode applies, which it does not to the parses it tries */
+#define TRIAL_PARSES(s) ((s)->trial_parses && (s)->strategy != Z_HUFFMAN_ONLY && (s)->strategy != Z_RLE)
+/* Archival mode sizes blocks to span about this much input */
+#define TRIAL_SPAN(s) (MAX_DIST(s) * 3 / 4)
+/* Fewest symbols in a block sized for the trial parses */
+#define TRIAL_MIN_SYMS 1024
+/* Blocks sent without trial parses after the tallied parse won */
+#define TRIAL_SKIP 16
+
+/* ===========================================================================
+ * Parse len bytes at buf as literals, and if rle is set, as matches at
+ * distance one wherever the previous byte repeats at least STD_MIN_MATCH
+ * times, like deflate_rle(). Without trees only the frequencies are counted,
+ * otherwise the symbols are sent as the block data. The parse needs no symbol
+ * buffer, since the same input always gives the same symbols.
+ */
+static void trial_parse(deflate_state *s, const unsigned char *buf, uint32_t len, int rle,
+                        const ct_data *ltree, const ct_data *dtree) {
+    const unsigned char *end = buf + len;
+    const unsigned char *first = s->trial_flushed ? buf : s->window;  /* first byte a run may repeat */
+    const unsigned char *scan;
+
+    while (buf < end) {
+        scan = buf;
+        /* A run can continue from the last byte of the previous block, unless a full flush is in between */
+        if (rle && buf > first) {
+            const unsigned char *limit = buf + MIN((uint32_t)(end - buf), STD_MAX_MATCH);
+            while (scan < limit && *scan == buf[-1])
+                scan++;
+        }
+        if (scan - buf >= STD_MIN_MATCH) {
+            uint32_t lc = (uint32_t)(scan - buf) - STD_MIN_MATCH;
+            if (ltree == NULL) {
+                s->dyn_ltree[zng_length_code[lc] + LITERALS + 1].Freq++;
+                s->dyn_dtree[0].Freq++;
+            } else {
+                zng_emit_dist(s, ltree, dtree, lc, 1);
+            }
+            buf = scan;
+        } else {
+            if (ltree == NULL)
+                s->dyn_ltree[*buf].Freq++;
+            else
+                zng_emit_lit(s, ltree, *buf);
+            buf++;
+        }
+    }
+    if (ltree != NULL)
+        zng_emit_end_block(s, ltree, 0);
+}
+
+/* ===========================================================================
+ * Clear the literal and distance frequencies and count those of a trial parse.
+ */
+static void trial_count(deflate_state *s, const unsigned char *buf, uint32_t len, int rle) {
+    int n;
+
+    for (n = 0; n < L_CODES; n++)
+        s->dyn_ltree[n].Freq = 0;
+    for (n = 0; n < D_CODES; n++)
+        s->dyn_dtree[n].Freq = 0;
+    s->dyn_ltree[END_BLOCK].Freq = 1;
+    trial_parse(s, buf, len, rle, NULL, NULL);
+}
+
+/* ===========================================================================
+ * Return the length in bits of the block with the current frequencies,
+ * without the block header, using whichever of the static and dynamic trees
+ * flush_block would pick. Building the trees overwrites the frequencies.
+ */
+static unsigned long block_bits(deflate_state *s) {
+    int n;
+
+    for (n = 0; n < BL_CODES; n++)
+        s->bl_tree[n].Freq = 0;
+    s->opt_len = s->static_len = 0L;
+
+    build_tree(s, (tree_desc *)(&(s->l_desc)));
+    build_tree(s, (tree_desc *)(&(s->d_desc)));
+    build_bl_tree(s);
+    if (s->strategy == Z_FIXED)
+        return s->static_len;
+    return MIN(s->opt_len, s->static_len);
+}
+
+/* ===========================================================================
+ * Archival mode: compare the tallied block with the run and literal parses of
+ * its input, which need no match state and so are cheap to redo. Leave the
+ * frequencies of the smallest one in place and return -1 if it is the tallied
+ * parse, else the rle argument of trial_parse() to send it with.
+ */
+static int trial_parses(deflate_state *s, const unsigned char *buf, uint32_t len) {
+    uint16_t lfreq[L_CODES], dfreq[D_CODES];
+    unsigned long bits, best_bits;
+    int n, rle, best = -1;
+
+    /* A block can only span the window, so the frequencies of a trial parse fit in 16 bits */
+    Assert(len < 65536, "trial block too long");
+
+    for (n = 0; n < L_CODES; n++)
+        lfreq[n] = s->dyn_ltree[n].Freq;
+    for (n = 0; n < D_CODES; n++)
+        dfreq[n] = s->dyn_dtree[n].Freq;
+    best_bits = block_bits(s);
+
+    for (rle = 1; rle >= 0; rle--) {
+        trial_count(s, buf, len, rle);
+        bits = block_bits(s);
+        if (bits < best_bits) {
+            best_bits = bits;
+            best = rle;
+        }
+    }
+    if (best >= 0) {
+        trial_count(s, buf, len, best);
+    } else {
+        /* The shorter blocks cost more than they gain while the tallied parse wins, so rest for a while */
+        s->trial_skip = TRIAL_SKIP;
+        for (n = 0; n < L_CODES; n++)
+            s->dyn_ltree[n].Freq = lfreq[n];
+        for (n = 0; n < D_CODES; n++)
+            s->dyn_dtree[n].Freq = dfreq[n];
+    }
+    for (n = 0; n < BL_CODES; n++)
+        s->bl_tree[n].Freq = 0;
+    s->opt_len = s->static_len = 0L;
+    return best;
+}
+
+/* ===========================================================================
+ * Set the symbol buffer size for the next block in archival mode. The input
+ * of a block must still be in the window when it ends for the trial parses,
+ * so the next block gets as many symbols as the last one needed for about
+ * TRIAL_SPAN(s) bytes. While the trial parses rest, blocks are full size.
+ */
+static void trial_next_block(deflate_state *s, uint32_t len, unsigned int syms) {
+    unsigned int full = (s->lit_bufsize - 1) * SYM_SIZE;
+    unsigned long end = full;
+
+    if (s->trial_skip > 0)
+        s->trial_skip--;
+    if (TRIAL_PARSES(s) && s->trial_skip == 0 && len > 0) {
+        end = (unsigned long)syms * TRIAL_SPAN(s) / len;
+        end = MAX(end - end % SYM_SIZE, TRIAL_MIN_SYMS * SYM_SIZE);
+        end = MIN(end, full);
+    }
+    s->sym_end = (unsigned int)end;
+}
+
+/* ===========================================================================
+ * Set the frequencies of a tree to freq, scaled down so that their sum, which
+ * is the frequency of the root, fits in 16 bits. Symbols that occur keep a
+ * frequency of at least one.
+ */
+static void scale_freqs(ct_data *tree, const uint32_t *freq, int elems) {
+    unsigned int shift = 0;
+    uint32_t sum;
+    int n;
+
+    do {
+        sum = 0;
+        for (n = 0; n < elems; n++)
+            sum += freq[n] == 0 ? 0 : MAX(freq[n] >> shift, 1);
+    } while (sum > UINT16_MAX && ++shift);
+
+    for (n = 0; n < elems; n++)
+        tree[n].Freq = (uint16_t)(freq[n] == 0 ? 0 : MAX(freq[n] >> shift, 1));
+}
+
+/* ===========================================================================
+ * Large-block mode: a block of more than 64K symbols can wrap the 16 bit
+ * frequencies. Count them again from the symbol buffer into lfreq and dfreq,
+ * and build the trees from them scaled down, which only makes the codes a
+ * little longer than optimal.
+ */
+static void large_block_count(deflate_state *s, uint32_t *lfreq, uint32_t *dfreq) {
+    unsigned dist;      /* distance of matched string */
+    int lc;             /* match length or unmatched char (if dist == 0) */
+    unsigned sx = 0;    /* running index in symbol buffers */
+
+    memset(lfreq, 0, L_CODES * sizeof(uint32_t));
+    memset(dfreq, 0, D_CODES * sizeof(uint32_t));
+    lfreq[END_BLOCK] = 1;
+    do {
+#ifdef LIT_MEM
+        dist = s->d_buf[sx];
+        lc = s->l_buf[sx++];
+#else
+        dist = s->sym_buf[sx++] & 0xff;
+        dist += (unsigned)(s->sym_buf[sx++] & 0xff) << 8;
+        lc = s->sym_buf[sx++];
+#endif
+        if (dist == 0) {
+            lfreq[lc]++;
+        } else {
+            dist--;
+            lfreq[zng_length_code[lc] + LITERALS + 1]++;
+            dfreq[d_code(dist)]++;
+        }
+    } while (sx < s->sym_next);
+
+    scale_freqs(s->dyn_ltree, lfreq, L_CODES);
+    scale_freqs(s->dyn_dtree, dfreq, D_CODES);
+}
+
+/* ===========================================================================
+ * Large-block mode: once the literal and distance trees are built from the
+ * scaled frequencies, set opt_len and static_len from the real ones.
+ */
+static void large_block_lens(deflate_state *s, const uint32_t *lfreq, const uint32_t *dfreq) {
+    const tree_desc *desc[2] = { &s->l_desc, &s->d_desc };
+    const uint32_t *freq[2] = { lfreq, dfreq };
+    int i, n, xbits;
+
+    s->opt_len = s->static_len = 0L;
+    for (i = 0; i < 2; i++) {
+        const ct_data *tree = desc[i]->dyn_tree;
+        const ct_data *stree = desc[i]->stat_desc->static_tree;
+        const int *extra = desc[i]->stat_desc->extra_bits;
+        int base = desc[i]->stat_desc->extra_base;
+
+        for (n = 0; n <= desc[i]->max_code; n++) {
+            if (freq[i][n] == 0)
+                continue;
+            xbits = n >= base ? extra[n - base] : 0;
+            s->opt_len += (unsigned long)freq[i][n] * (unsigned int)(tree[n].Len + xbits);
+            s->static_len += (unsigned long)freq[i][n] * (unsigned int)(stree[n].Len + xbits);
+        }
+    }
+}
+
 /* ===========================================================================
  * Send one empty static block to give enough lookahead for inflate.
  * This takes 10 bits, of which 7 may remain in the bit buffer.
@@ -628,6 +865,10 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
     /* last: one if this is the last block for a file */
     unsigned long opt_lenb, static_lenb; /* opt_len and static_len in bytes */
     int max_blindex = 0;  /* index of last bit length code of non zero freq */
+    int parse = -1;       /* trial parse to send instead of the tallied symbols, or -1 */
+    int large = 0;        /* set if the block has more symbols than 16 bit frequencies can count */
+    uint32_t lfreq[L_CODES], dfreq[D_CODES]; /* frequencies of a large block */
+    unsigned char *pending_buf; /* pending_buf to restore if the block is sent to next_out, or NULL */
 
     /* Build the Huffman trees unless a stored block is forced */
     if (UNLIKELY(s->sym_next == 0)) {
@@ -635,6 +876,16 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
         opt_lenb = static_lenb = 0;
         s->static_len = 7;
     } else if (s->level > 0) {
+        /* In archival mode, switch to a cheaper parse of the same input if there is one */
+        if (TRIAL_PARSES(s) && s->trial_skip == 0 && buf != NULL)
+            parse = trial_parses(s, (const unsigned char *)buf, stored_len);
+
+        /* In the large-block mode, count the frequencies of long blocks in 32 bits */
+        if (UNLIKELY(s->sym_next / SYM_SIZE > UINT16_MAX)) {
+            large_block_count(s, lfreq, dfreq);
+            large = 1;
+        }
+
         /* Check if the file is binary or text */
         if (s->strm->data_type == Z_UNKNOWN)
             s->strm->data_type = detect_data_type(s);
@@ -645,6 +896,8 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
 
         build_tree(s, (tree_desc *)(&(s->d_desc)));
         Tracev((stderr, "\ndist data: dyn %lu, stat %lu", s->opt_len, s->static_len));
+        if (UNLIKELY(large))
+            large_block_lens(s, lfreq, dfreq);
         /* At this point, opt_len and static_len are the total bit lengths of
          * the compressed block data, excluding the tree representations.
          */
@@ -670,6 +923,9 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
         opt_lenb = static_lenb = stored_len + 5; /* force a stored block */
     }
 
+    /* At most opt_lenb bytes are sent, so skip pending_buf if they fit in the output */
+    pending_buf = direct_begin(s, opt_lenb);
+
     if (stored_len+4 <= opt_lenb && buf != NULL) {
         /* 4: two words for the lengths
          * The test buf != NULL is only necessary if LIT_BUFSIZE > WSIZE.
@@ -682,26 +938,71 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
 
     } else if (static_lenb == opt_lenb) {
         zng_tr_emit_tree(s, STATIC_TREES, last);
-        compress_block(s, (const ct_data *)static_ltree, (const ct_data *)static_dtree);
+        if (parse < 0)
+            compress_block(s, (const ct_data *)static_ltree, (const ct_data *)static_dtree);
+        else
+            trial_parse(s, (const unsigned char *)buf, stored_len, parse, static_ltree, static_dtree);
         cmpr_bits_add(s, s->static_len);
     } else {
         zng_tr_emit_tree(s, DYN_TREES, last);
         send_all_trees(s, s->l_desc.max_code+1, s->d_desc.max_code+1, max_blindex+1);
-        compress_block(s, (const ct_data *)s->dyn_ltree, (const ct_data *)s->dyn_dtree);
+        if (parse < 0)
+            compress_block(s, (const ct_data *)s->dyn_ltree, (const ct_data *)s->dyn_dtree);
+        else
+            trial_parse(s, (const unsigned char *)buf, stored_len, parse, s->dyn_ltree, s->dyn_dtree);
         cmpr_bits_add(s, s->opt_len);
     }
     Assert(s->compressed_len == s->bits_sent, "bad compressed size");
     /* The above check is made mod 2^32, for files larger than 512 MB
      * and unsigned long implemented on 32 bits.
      */
+    if (s->trial_parses)
+        trial_next_block(s, stored_len, s->sym_next);
+    s->trial_flushed = 0;
     init_block(s);
 
     if (last) {
         zng_tr_emit_align(s);
     }
+    if (pending_buf != NULL)
+        direct_end(s, pending_buf);
     Tracev((stderr, "\ncomprlen %lu(%lu) ", s->compressed_len>>3, s->compressed_len-7*last));
 }
 
+/* ===========================================================================
+ * Have a block of at most len bytes written straight to the output of the
+ * stream, which saves copying it from pending_buf, if nothing is pending and
+ * the output has room for it. DIRECT_SLOP covers the bits still in bi_buf and
+ * the alignment of the last block. Return the pending_buf to restore with
+ * direct_end(), or NULL if the block goes through pending_buf.
+ */
+#define DIRECT_SLOP 16
+
+static unsigned char *direct_begin(deflate_state *s, unsigned long len) {
+    PREFIX3(stream) *strm = s->strm;
+    unsigned char *pending_buf = s->pending_buf;
+
+    if (s->pending != 0 || strm->avail_out < len + DIRECT_SLOP)
+        return NULL;
+    s->pending_buf = s->pending_out = strm->next_out;
+    return pending_buf;
+}
+
+/* ===========================================================================
+ * Account for the bytes written to the output of the stream since
+ * direct_begin(), and go back to pending_buf.
+ */
+static void direct_end(deflate_state *s, unsigned char *pending_buf) {
+    PREFIX3(stream) *strm = s->strm;
+
+    Assert(s->pending <= strm->avail_out, "direct block overflow");
+    strm->next_out  += s->pending;
+    strm->total_out += s->pending;
+    strm->avail_out -= s->pending;
+    s->pending = 0;
+    s->pending_buf = s->pending_out = pending_buf;
+}
+
 /* ===========================================================================
  * Send the block data compressed using the given Huffman trees
  */
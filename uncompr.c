@@ -5,6 +5,7 @@
 
 #include "zbuild.h"
 #include "zutil.h"
+#include "state_cache.h"
 
 /* ===========================================================================
      Decompresses the source buffer into the destination buffer.  *sourceLen is
@@ -23,7 +24,7 @@
    an incomplete zlib stream.
 */
 int Z_EXPORT PREFIX(uncompress2)(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source, z_uintmax_t *sourceLen) {
-    PREFIX3(stream) stream;
+    PREFIX3(stream) stream, *strm;
     int err;
     const unsigned int max = (unsigned int)-1;
     z_uintmax_t len, left;
@@ -38,40 +39,50 @@ int Z_EXPORT PREFIX(uncompress2)(unsigned char *dest, z_uintmax_t *destLen, cons
         dest = buf;
     }
 
-    stream.next_in = (z_const unsigned char *)source;
-    stream.avail_in = 0;
-    stream.zalloc = NULL;
-    stream.zfree = NULL;
-    stream.opaque = NULL;
+    strm = state_cache_inflate(MAX_WBITS);
+    if (strm == NULL) {
+        strm = &stream;
+        stream.next_in = (z_const unsigned char *)source;
+        stream.avail_in = 0;
+        stream.zalloc = NULL;
+        stream.zfree = NULL;
+        stream.opaque = NULL;
 
-    err = PREFIX(inflateInit)(&stream);
-    if (err != Z_OK) return err;
+        err = PREFIX(inflateInit)(&stream);
+        if (err != Z_OK) return err;
+    }
 
-    stream.next_out = dest;
-    stream.avail_out = 0;
+    strm->next_in = (z_const unsigned char *)source;
+    strm->avail_in = 0;
+    strm->next_out = dest;
+    strm->avail_out = 0;
 
     do {
-        if (stream.avail_out == 0) {
-            stream.avail_out = left > (unsigned long)max ? max : (unsigned int)left;
-            left -= stream.avail_out;
+        if (strm->avail_out == 0) {
+            strm->avail_out = left > (unsigned long)max ? max : (unsigned int)left;
+            left -= strm->avail_out;
         }
-        if (stream.avail_in == 0) {
-            stream.avail_in = len > (unsigned long)max ? max : (unsigned int)len;
-            len -= stream.avail_in;
+        if (strm->avail_in == 0) {
+            strm->avail_in = len > (unsigned long)max ? max : (unsigned int)len;
+            len -= strm->avail_in;
         }
-        err = PREFIX(inflate)(&stream, Z_NO_FLUSH);
+        err = PREFIX(inflate)(strm, Z_NO_FLUSH);
     } while (err == Z_OK);
 
-    *sourceLen -= len + stream.avail_in;
+    *sourceLen -= len + strm->avail_in;
     if (dest != buf)
-        *destLen = (z_size_t)stream.total_out;
-    else if (stream.total_out && err == Z_BUF_ERROR)
+        *destLen = (z_size_t)strm->total_out;
+    else if (strm->total_out && err == Z_BUF_ERROR)
         left = 1;
+    left += strm->avail_out;
 
-    PREFIX(inflateEnd)(&stream);
+    if (strm == &stream)
+        PREFIX(inflateEnd)(&stream);
+    else
+        state_cache_inflate_done(strm);
     return err == Z_STREAM_END ? Z_OK :
            err == Z_NEED_DICT ? Z_DATA_ERROR  :
-           err == Z_BUF_ERROR && left + stream.avail_out ? Z_DATA_ERROR :
+           err == Z_BUF_ERROR && left ? Z_DATA_ERROR :
            err;
 }
 
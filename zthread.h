@@ -0,0 +1,186 @@
+/* zthread.h -- Minimal threading primitives used internally by zlib-ng
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef ZTHREAD_H
+#define ZTHREAD_H
+
+/* Thin wrappers around the native threading API, so that code using worker threads does not need to care whether
+ * it runs on top of pthreads or Win32 threads. Only compiled in when WITH_THREADS is defined. */
+
+#ifdef WITH_THREADS
+#  ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#      define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+
+typedef HANDLE zng_thread;
+typedef SRWLOCK zng_mutex;
+typedef CONDITION_VARIABLE zng_cond;
+typedef DWORD zng_tls;
+typedef INIT_ONCE zng_once;
+
+#    define ZNG_MUTEX_INIT SRWLOCK_INIT
+#    define ZNG_COND_INIT  CONDITION_VARIABLE_INIT
+#    define ZNG_ONCE_INIT  INIT_ONCE_STATIC_INIT
+#    define ZNG_THREAD_PROC(name, arg) DWORD WINAPI name(LPVOID arg)
+#    define ZNG_THREAD_RETURN 0
+#    define ZNG_TLS_DESTRUCTOR(name, arg) VOID NTAPI name(PVOID arg)
+#    define ZNG_ONCE_PROC(name) BOOL CALLBACK name(PINIT_ONCE once, PVOID param, PVOID *context)
+#    define ZNG_ONCE_RETURN TRUE
+
+static inline int zng_thread_create(zng_thread *thread, LPTHREAD_START_ROUTINE proc, void *arg) {
+    *thread = CreateThread(NULL, 0, proc, arg, 0, NULL);
+    return *thread == NULL;
+}
+
+static inline void zng_thread_join(zng_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static inline void zng_mutex_init(zng_mutex *mutex) {
+    InitializeSRWLock(mutex);
+}
+
+static inline void zng_mutex_destroy(zng_mutex *mutex) {
+    (void)mutex;
+}
+
+static inline void zng_mutex_lock(zng_mutex *mutex) {
+    AcquireSRWLockExclusive(mutex);
+}
+
+static inline void zng_mutex_unlock(zng_mutex *mutex) {
+    ReleaseSRWLockExclusive(mutex);
+}
+
+static inline void zng_cond_init(zng_cond *cond) {
+    InitializeConditionVariable(cond);
+}
+
+static inline void zng_cond_destroy(zng_cond *cond) {
+    (void)cond;
+}
+
+static inline void zng_cond_wait(zng_cond *cond, zng_mutex *mutex) {
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+static inline void zng_cond_signal(zng_cond *cond) {
+    WakeConditionVariable(cond);
+}
+
+static inline void zng_cond_broadcast(zng_cond *cond) {
+    WakeAllConditionVariable(cond);
+}
+
+/* Fiber local storage, unlike TlsAlloc(), calls the destructor when a thread exits */
+static inline int zng_tls_create(zng_tls *key, PFLS_CALLBACK_FUNCTION destructor) {
+    *key = FlsAlloc(destructor);
+    return *key == FLS_OUT_OF_INDEXES;
+}
+
+static inline void *zng_tls_get(zng_tls key) {
+    return FlsGetValue(key);
+}
+
+static inline int zng_tls_set(zng_tls key, void *value) {
+    return !FlsSetValue(key, value);
+}
+
+/* Calls the destructor for the values that are set */
+static inline void zng_tls_delete(zng_tls key) {
+    FlsFree(key);
+}
+
+static inline void zng_call_once(zng_once *once, PINIT_ONCE_FN proc) {
+    InitOnceExecuteOnce(once, proc, NULL, NULL);
+}
+#  else
+#    include <pthread.h>
+
+typedef pthread_t zng_thread;
+typedef pthread_mutex_t zng_mutex;
+typedef pthread_cond_t zng_cond;
+typedef pthread_key_t zng_tls;
+typedef pthread_once_t zng_once;
+
+#    define ZNG_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+#    define ZNG_COND_INIT  PTHREAD_COND_INITIALIZER
+#    define ZNG_ONCE_INIT  PTHREAD_ONCE_INIT
+#    define ZNG_THREAD_PROC(name, arg) void *name(void *arg)
+#    define ZNG_THREAD_RETURN NULL
+#    define ZNG_TLS_DESTRUCTOR(name, arg) void name(void *arg)
+#    define ZNG_ONCE_PROC(name) void name(void)
+#    define ZNG_ONCE_RETURN
+
+static inline int zng_thread_create(zng_thread *thread, void *(*proc)(void *), void *arg) {
+    return pthread_create(thread, NULL, proc, arg);
+}
+
+static inline void zng_thread_join(zng_thread thread) {
+    pthread_join(thread, NULL);
+}
+
+static inline void zng_mutex_init(zng_mutex *mutex) {
+    pthread_mutex_init(mutex, NULL);
+}
+
+static inline void zng_mutex_destroy(zng_mutex *mutex) {
+    pthread_mutex_destroy(mutex);
+}
+
+static inline void zng_mutex_lock(zng_mutex *mutex) {
+    pthread_mutex_lock(mutex);
+}
+
+static inline void zng_mutex_unlock(zng_mutex *mutex) {
+    pthread_mutex_unlock(mutex);
+}
+
+static inline void zng_cond_init(zng_cond *cond) {
+    pthread_cond_init(cond, NULL);
+}
+
+static inline void zng_cond_destroy(zng_cond *cond) {
+    pthread_cond_destroy(cond);
+}
+
+static inline void zng_cond_wait(zng_cond *cond, zng_mutex *mutex) {
+    pthread_cond_wait(cond, mutex);
+}
+
+static inline void zng_cond_signal(zng_cond *cond) {
+    pthread_cond_signal(cond);
+}
+
+static inline void zng_cond_broadcast(zng_cond *cond) {
+    pthread_cond_broadcast(cond);
+}
+
+static inline int zng_tls_create(zng_tls *key, void (*destructor)(void *)) {
+    return pthread_key_create(key, destructor);
+}
+
+static inline void *zng_tls_get(zng_tls key) {
+    return pthread_getspecific(key);
+}
+
+static inline int zng_tls_set(zng_tls key, void *value) {
+    return pthread_setspecific(key, value);
+}
+
+/* Does not call the destructor, the values that are set are left to the caller */
+static inline void zng_tls_delete(zng_tls key) {
+    pthread_key_delete(key);
+}
+
+static inline void zng_call_once(zng_once *once, void (*proc)(void)) {
+    pthread_once(once, proc);
+}
+#  endif
+#endif /* WITH_THREADS */
+
+#endif /* ZTHREAD_H */
@@ -6,6 +6,14 @@
 #include "zbuild.h"
 #include "zutil_p.h"
 #include "zutil.h"
+#include "hugepage.h"
+
+#ifdef _WIN32
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#endif
 
 z_const char * const PREFIX(z_errmsg)[10] = {
     (z_const char *)"need dictionary",     /* Z_NEED_DICT       2  */
@@ -102,10 +110,34 @@ const char * Z_EXPORT PREFIX(zError)(int err) {
 
 void Z_INTERNAL *PREFIX(zcalloc)(void *opaque, unsigned items, unsigned size) {
     Z_UNUSED(opaque);
+#ifdef WITH_HUGE_PAGES
+    return huge_alloc((size_t)items * (size_t)size);
+#else
     return zng_alloc((size_t)items * (size_t)size);
+#endif
 }
 
 void Z_INTERNAL PREFIX(zcfree)(void *opaque, void *ptr) {
     Z_UNUSED(opaque);
+#ifdef WITH_HUGE_PAGES
+    huge_free(ptr);
+#else
     zng_free(ptr);
+#endif
+}
+
+uint64_t Z_INTERNAL zng_clock_usec(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)(count.QuadPart / freq.QuadPart) * 1000000 +
+           (uint64_t)(count.QuadPart % freq.QuadPart) * 1000000 / (uint64_t)freq.QuadPart;
+#elif defined(ZNG_CLOCK)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#else
+    return 0;
+#endif
 }
@@ -137,4 +137,18 @@ void Z_INTERNAL  PREFIX(zcfree)(void *opaque, void *ptr);
 typedef void *zng_calloc_func(void *opaque, unsigned items, unsigned size);
 typedef void  zng_cfree_func(void *opaque, void *ptr);
 
+         /* time */
+
+#ifdef _WIN32
+#  define ZNG_CLOCK
+#else
+#  include <time.h>
+#  ifdef CLOCK_MONOTONIC
+#    define ZNG_CLOCK
+#  endif
+#endif
+
+/* Monotonic time in microseconds, always 0 unless ZNG_CLOCK is defined */
+uint64_t Z_INTERNAL zng_clock_usec(void);
+
 #endif /* ZUTIL_H_ */